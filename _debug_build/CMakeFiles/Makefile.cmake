@@ -0,0 +1,283 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "gmock-prefix/tmp/gmock-mkdirs.cmake"
+  "google_benchmark-prefix/tmp/google_benchmark-mkdirs.cmake"
+  "hdr_histogram-prefix/tmp/hdr_histogram-mkdirs.cmake"
+  "/root/repo/aeron-archive/src/main/cpp/CMakeLists.txt"
+  "/root/repo/aeron-archive/src/test/cpp/CMakeLists.txt"
+  "/root/repo/aeron-client/src/main/cpp/CMakeLists.txt"
+  "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt"
+  "/root/repo/aeron-cluster/src/main/cpp/CMakeLists.txt"
+  "/root/repo/aeron-cluster/src/test/cpp/CMakeLists.txt"
+  "/root/repo/aeron-driver/src/main/c/CMakeLists.txt"
+  "/root/repo/aeron-driver/src/test/c/CMakeLists.txt"
+  "/root/repo/aeron-samples/src/main/cpp/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/RepositoryInfo.txt.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/cfgcmd.txt.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/extractfile.cmake.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/mkdirs.cmake.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/verify.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "gmock-prefix/tmp/gmock-mkdirs.cmake"
+  "gmock-prefix/src/gmock-stamp/verify-gmock.cmake"
+  "gmock-prefix/src/gmock-stamp/extract-gmock.cmake"
+  "gmock-prefix/src/gmock-stamp/gmock-urlinfo.txt"
+  "gmock-prefix/tmp/gmock-cfgcmd.txt"
+  "hdr_histogram-prefix/tmp/hdr_histogram-mkdirs.cmake"
+  "hdr_histogram-prefix/src/hdr_histogram-stamp/verify-hdr_histogram.cmake"
+  "hdr_histogram-prefix/src/hdr_histogram-stamp/extract-hdr_histogram.cmake"
+  "hdr_histogram-prefix/src/hdr_histogram-stamp/hdr_histogram-urlinfo.txt"
+  "hdr_histogram-prefix/tmp/hdr_histogram-cfgcmd.txt"
+  "google_benchmark-prefix/tmp/google_benchmark-mkdirs.cmake"
+  "google_benchmark-prefix/src/google_benchmark-stamp/verify-google_benchmark.cmake"
+  "google_benchmark-prefix/src/google_benchmark-stamp/extract-google_benchmark.cmake"
+  "google_benchmark-prefix/src/google_benchmark-stamp/google_benchmark-urlinfo.txt"
+  "google_benchmark-prefix/tmp/google_benchmark-cfgcmd.txt"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "aeron-client/src/main/cpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "aeron-archive/src/main/cpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "aeron-archive/src/test/cpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "aeron-cluster/src/main/cpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "aeron-cluster/src/test/cpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "aeron-driver/src/main/c/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/gmock.dir/DependInfo.cmake"
+  "CMakeFiles/hdr_histogram.dir/DependInfo.cmake"
+  "CMakeFiles/google_benchmark.dir/DependInfo.cmake"
+  "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/aeron_client_test.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/clientConductorTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/publicationTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/exclusivePublicationTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/imageTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/fragmentAssemblyTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/laneMergerTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/sequencedMergerTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/messageCompressionTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/bulkTransferTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/consumerGroupTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/readinessSetTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/callbackDispatcherTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/asyncSchedulerTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/commandTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/utilTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/memoryMappedFileTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/broadcastReceiverTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/broadcastTransmitterTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/concurrentTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/countersManagerTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/countersIndexTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/countersSnapshotTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/compositeAgentTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/backoffIdleStrategyTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/termAppenderTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/termReaderTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/termBlockScannerTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/termRebuilderTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/termGapScannerTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/termScannerTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/manyToOneRingBufferTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/distinctErrorLogTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/errorLogReaderTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/oneToOneRingBuffertest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/messageQueueTest.dir/DependInfo.cmake"
+  "aeron-client/src/test/cpp/CMakeFiles/clientHotPathBenchmark.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/AeronStat.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/BasicPublisher.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/TimeTests.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/BasicSubscriber.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/StreamingPublisher.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/RateSubscriber.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/Pong.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/Ping.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/Throughput.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/ErrorStat.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/LossStat.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/FlowControlStat.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/PositionStat.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/ExclusiveThroughput.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/MultiStreamThroughput.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/PingPong.dir/DependInfo.cmake"
+  "aeron-samples/src/main/cpp/CMakeFiles/DriverSoak.dir/DependInfo.cmake"
+  "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/DependInfo.cmake"
+  "aeron-archive/src/test/cpp/CMakeFiles/archiveCodecsTest.dir/DependInfo.cmake"
+  "aeron-archive/src/test/cpp/CMakeFiles/archiveProxyTest.dir/DependInfo.cmake"
+  "aeron-archive/src/test/cpp/CMakeFiles/controlResponsePollerTest.dir/DependInfo.cmake"
+  "aeron-cluster/src/main/cpp/CMakeFiles/aeron_cluster_client.dir/DependInfo.cmake"
+  "aeron-cluster/src/test/cpp/CMakeFiles/clusterCodecsTest.dir/DependInfo.cmake"
+  "aeron-cluster/src/test/cpp/CMakeFiles/egressAdapterTest.dir/DependInfo.cmake"
+  "aeron-cluster/src/test/cpp/CMakeFiles/egressPollerTest.dir/DependInfo.cmake"
+  "aeron-driver/src/main/c/CMakeFiles/aeron.dir/DependInfo.cmake"
+  "aeron-driver/src/main/c/CMakeFiles/aeron_driver_agent.dir/DependInfo.cmake"
+  "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/DependInfo.cmake"
+  "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/DependInfo.cmake"
+  "aeron-driver/src/main/c/CMakeFiles/aeronmd.dir/DependInfo.cmake"
+  "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/DependInfo.cmake"
+  "aeron-driver/src/main/c/CMakeFiles/aeron_archiving_md.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/spsc_rb_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/mpsc_rb_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/broadcast_transmitter_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/broadcast_receiver_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/counters_manager_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/distinct_error_log_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_conductor_ipc_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_conductor_network_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_conductor_spy_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_conductor_counter_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/data_packet_dispatcher_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/spsc_queue_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/mpsc_queue_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/uri_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/udp_channel_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/udp_transport_poller_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/udp_destination_tracker_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/udp_channel_transport_debug_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/udp_channel_transport_aes_gcm_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/udp_channel_transport_ibverbs_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/udp_channel_transport_dpdk_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/udp_channel_transport_shm_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/int64_to_ptr_hash_map_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/int64_to_ptr_swiss_map_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/str_to_ptr_hash_map_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/deadline_timer_wheel_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/term_scanner_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/term_gap_scanner_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/term_rebuilder_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/loss_detector_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/retransmit_handler_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/loss_reporter_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/flow_control_trace_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/position_snapshot_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/stream_activity_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/logbuffer_unblocker.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/term_gap_filler_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/raw_log_pool_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/durable_log_syncer_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/term_length_advisor_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_command_pool_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_invoker_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_host_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/duty_cycle_tracker_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/clock_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/agent_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/congestion_control_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/flow_control_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/network_publication_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/send_pacer_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/pmtu_discovery_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/fec_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/frame_checksum_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_agent_binary_log_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_agent_pcap_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/c_client_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/archive_catalog_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/archive_recorder_test.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/int64_to_ptr_map_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/term_rebuilder_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/rb_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/concurrent_array_queue_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/broadcast_transmitter_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/counters_manager_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/publication_layout_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/str_to_ptr_hash_map_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_pipeline_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/mdc_fanout_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/loss_recovery_benchmark.dir/DependInfo.cmake"
+  "aeron-driver/src/test/c/CMakeFiles/driver_startup_benchmark.dir/DependInfo.cmake"
+  )
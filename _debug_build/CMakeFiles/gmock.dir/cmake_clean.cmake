@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gmock"
+  "CMakeFiles/gmock-complete"
+  "gmock-prefix/src/gmock-stamp/gmock-build"
+  "gmock-prefix/src/gmock-stamp/gmock-configure"
+  "gmock-prefix/src/gmock-stamp/gmock-download"
+  "gmock-prefix/src/gmock-stamp/gmock-install"
+  "gmock-prefix/src/gmock-stamp/gmock-mkdir"
+  "gmock-prefix/src/gmock-stamp/gmock-patch"
+  "gmock-prefix/src/gmock-stamp/gmock-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/gmock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
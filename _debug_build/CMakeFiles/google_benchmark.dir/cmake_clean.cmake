@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/google_benchmark"
+  "CMakeFiles/google_benchmark-complete"
+  "google_benchmark-prefix/src/google_benchmark-stamp/google_benchmark-build"
+  "google_benchmark-prefix/src/google_benchmark-stamp/google_benchmark-configure"
+  "google_benchmark-prefix/src/google_benchmark-stamp/google_benchmark-download"
+  "google_benchmark-prefix/src/google_benchmark-stamp/google_benchmark-install"
+  "google_benchmark-prefix/src/google_benchmark-stamp/google_benchmark-mkdir"
+  "google_benchmark-prefix/src/google_benchmark-stamp/google_benchmark-patch"
+  "google_benchmark-prefix/src/google_benchmark-stamp/google_benchmark-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/google_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdr_histogram"
+  "CMakeFiles/hdr_histogram-complete"
+  "hdr_histogram-prefix/src/hdr_histogram-stamp/hdr_histogram-build"
+  "hdr_histogram-prefix/src/hdr_histogram-stamp/hdr_histogram-configure"
+  "hdr_histogram-prefix/src/hdr_histogram-stamp/hdr_histogram-download"
+  "hdr_histogram-prefix/src/hdr_histogram-stamp/hdr_histogram-install"
+  "hdr_histogram-prefix/src/hdr_histogram-stamp/hdr_histogram-mkdir"
+  "hdr_histogram-prefix/src/hdr_histogram-stamp/hdr_histogram-patch"
+  "hdr_histogram-prefix/src/hdr_histogram-stamp/hdr_histogram-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/hdr_histogram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_debug_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("aeron-client/src/main/cpp")
+subdirs("aeron-client/src/test/cpp")
+subdirs("aeron-samples/src/main/cpp")
+subdirs("aeron-archive/src/main/cpp")
+subdirs("aeron-archive/src/test/cpp")
+subdirs("aeron-cluster/src/main/cpp")
+subdirs("aeron-cluster/src/test/cpp")
+subdirs("aeron-driver/src/main/c")
+subdirs("aeron-driver/src/test/c")
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/aeron-archive/src/main/cpp/client/AeronArchive.cpp" "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/client/AeronArchive.cpp.o" "gcc" "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/client/AeronArchive.cpp.o.d"
+  "/root/repo/aeron-archive/src/main/cpp/client/ArchiveProxy.cpp" "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/client/ArchiveProxy.cpp.o" "gcc" "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/client/ArchiveProxy.cpp.o.d"
+  "/root/repo/aeron-archive/src/main/cpp/client/ControlResponsePoller.cpp" "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/client/ControlResponsePoller.cpp.o" "gcc" "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/client/ControlResponsePoller.cpp.o.d"
+  "/root/repo/aeron-archive/src/main/cpp/client/RecordingDescriptorPoller.cpp" "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/client/RecordingDescriptorPoller.cpp.o" "gcc" "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/client/RecordingDescriptorPoller.cpp.o.d"
+  "/root/repo/aeron-archive/src/main/cpp/client/ReplayMerge.cpp" "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/client/ReplayMerge.cpp.o" "gcc" "aeron-archive/src/main/cpp/CMakeFiles/aeron_archive_client.dir/client/ReplayMerge.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
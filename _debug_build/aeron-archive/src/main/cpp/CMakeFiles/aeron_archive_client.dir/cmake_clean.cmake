@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libaeron_archive_client.a"
+  "../../../../lib/libaeron_archive_client.pdb"
+  "CMakeFiles/aeron_archive_client.dir/client/AeronArchive.cpp.o"
+  "CMakeFiles/aeron_archive_client.dir/client/AeronArchive.cpp.o.d"
+  "CMakeFiles/aeron_archive_client.dir/client/ArchiveProxy.cpp.o"
+  "CMakeFiles/aeron_archive_client.dir/client/ArchiveProxy.cpp.o.d"
+  "CMakeFiles/aeron_archive_client.dir/client/ControlResponsePoller.cpp.o"
+  "CMakeFiles/aeron_archive_client.dir/client/ControlResponsePoller.cpp.o.d"
+  "CMakeFiles/aeron_archive_client.dir/client/RecordingDescriptorPoller.cpp.o"
+  "CMakeFiles/aeron_archive_client.dir/client/RecordingDescriptorPoller.cpp.o.d"
+  "CMakeFiles/aeron_archive_client.dir/client/ReplayMerge.cpp.o"
+  "CMakeFiles/aeron_archive_client.dir/client/ReplayMerge.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aeron_archive_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
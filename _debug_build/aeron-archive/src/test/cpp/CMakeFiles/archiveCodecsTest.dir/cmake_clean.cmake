@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/archiveCodecsTest"
+  "../../../../binaries/archiveCodecsTest.pdb"
+  "CMakeFiles/archiveCodecsTest.dir/ArchiveCodecsTest.cpp.o"
+  "CMakeFiles/archiveCodecsTest.dir/ArchiveCodecsTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/archiveCodecsTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/archiveProxyTest"
+  "../../../../binaries/archiveProxyTest.pdb"
+  "CMakeFiles/archiveProxyTest.dir/ArchiveProxyTest.cpp.o"
+  "CMakeFiles/archiveProxyTest.dir/ArchiveProxyTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/archiveProxyTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
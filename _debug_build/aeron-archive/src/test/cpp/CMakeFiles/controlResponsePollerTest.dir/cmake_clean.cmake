@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/controlResponsePollerTest"
+  "../../../../binaries/controlResponsePollerTest.pdb"
+  "CMakeFiles/controlResponsePollerTest.dir/ControlResponsePollerTest.cpp.o"
+  "CMakeFiles/controlResponsePollerTest.dir/ControlResponsePollerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/controlResponsePollerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
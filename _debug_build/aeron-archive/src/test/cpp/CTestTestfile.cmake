@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/aeron-archive/src/test/cpp
+# Build directory: /root/repo/_debug_build/aeron-archive/src/test/cpp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(archiveCodecsTest "/root/repo/_debug_build/binaries/archiveCodecsTest")
+set_tests_properties(archiveCodecsTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-archive/src/test/cpp/CMakeLists.txt;28;add_test;/root/repo/aeron-archive/src/test/cpp/CMakeLists.txt;31;aeron_archive_test;/root/repo/aeron-archive/src/test/cpp/CMakeLists.txt;0;")
+add_test(archiveProxyTest "/root/repo/_debug_build/binaries/archiveProxyTest")
+set_tests_properties(archiveProxyTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-archive/src/test/cpp/CMakeLists.txt;28;add_test;/root/repo/aeron-archive/src/test/cpp/CMakeLists.txt;32;aeron_archive_test;/root/repo/aeron-archive/src/test/cpp/CMakeLists.txt;0;")
+add_test(controlResponsePollerTest "/root/repo/_debug_build/binaries/controlResponsePollerTest")
+set_tests_properties(controlResponsePollerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-archive/src/test/cpp/CMakeLists.txt;28;add_test;/root/repo/aeron-archive/src/test/cpp/CMakeLists.txt;33;aeron_archive_test;/root/repo/aeron-archive/src/test/cpp/CMakeLists.txt;0;")
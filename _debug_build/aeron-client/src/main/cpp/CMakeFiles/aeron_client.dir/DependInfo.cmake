@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/aeron-client/src/main/cpp/Aeron.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/Aeron.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/Aeron.cpp.o.d"
+  "/root/repo/aeron-client/src/main/cpp/ClientConductor.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/ClientConductor.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/ClientConductor.cpp.o.d"
+  "/root/repo/aeron-client/src/main/cpp/Counter.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/Counter.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/Counter.cpp.o.d"
+  "/root/repo/aeron-client/src/main/cpp/ExclusivePublication.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/ExclusivePublication.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/ExclusivePublication.cpp.o.d"
+  "/root/repo/aeron-client/src/main/cpp/LogBuffers.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/LogBuffers.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/LogBuffers.cpp.o.d"
+  "/root/repo/aeron-client/src/main/cpp/LogBuffersMapper.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/LogBuffersMapper.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/LogBuffersMapper.cpp.o.d"
+  "/root/repo/aeron-client/src/main/cpp/Publication.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/Publication.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/Publication.cpp.o.d"
+  "/root/repo/aeron-client/src/main/cpp/Subscription.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/Subscription.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/Subscription.cpp.o.d"
+  "/root/repo/aeron-client/src/main/cpp/util/CommandOption.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/util/CommandOption.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/util/CommandOption.cpp.o.d"
+  "/root/repo/aeron-client/src/main/cpp/util/CommandOptionParser.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/util/CommandOptionParser.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/util/CommandOptionParser.cpp.o.d"
+  "/root/repo/aeron-client/src/main/cpp/util/MemoryMappedFile.cpp" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/util/MemoryMappedFile.cpp.o" "gcc" "aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/util/MemoryMappedFile.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libaeron_client.a"
+  "../../../../lib/libaeron_client.pdb"
+  "CMakeFiles/aeron_client.dir/Aeron.cpp.o"
+  "CMakeFiles/aeron_client.dir/Aeron.cpp.o.d"
+  "CMakeFiles/aeron_client.dir/ClientConductor.cpp.o"
+  "CMakeFiles/aeron_client.dir/ClientConductor.cpp.o.d"
+  "CMakeFiles/aeron_client.dir/Counter.cpp.o"
+  "CMakeFiles/aeron_client.dir/Counter.cpp.o.d"
+  "CMakeFiles/aeron_client.dir/ExclusivePublication.cpp.o"
+  "CMakeFiles/aeron_client.dir/ExclusivePublication.cpp.o.d"
+  "CMakeFiles/aeron_client.dir/LogBuffers.cpp.o"
+  "CMakeFiles/aeron_client.dir/LogBuffers.cpp.o.d"
+  "CMakeFiles/aeron_client.dir/LogBuffersMapper.cpp.o"
+  "CMakeFiles/aeron_client.dir/LogBuffersMapper.cpp.o.d"
+  "CMakeFiles/aeron_client.dir/Publication.cpp.o"
+  "CMakeFiles/aeron_client.dir/Publication.cpp.o.d"
+  "CMakeFiles/aeron_client.dir/Subscription.cpp.o"
+  "CMakeFiles/aeron_client.dir/Subscription.cpp.o.d"
+  "CMakeFiles/aeron_client.dir/util/CommandOption.cpp.o"
+  "CMakeFiles/aeron_client.dir/util/CommandOption.cpp.o.d"
+  "CMakeFiles/aeron_client.dir/util/CommandOptionParser.cpp.o"
+  "CMakeFiles/aeron_client.dir/util/CommandOptionParser.cpp.o.d"
+  "CMakeFiles/aeron_client.dir/util/MemoryMappedFile.cpp.o"
+  "CMakeFiles/aeron_client.dir/util/MemoryMappedFile.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aeron_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
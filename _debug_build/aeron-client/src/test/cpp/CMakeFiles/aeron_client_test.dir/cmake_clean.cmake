@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libaeron_client_test.a"
+  "../../../../lib/libaeron_client_test.pdb"
+  "CMakeFiles/aeron_client_test.dir/ClientConductorFixture.cpp.o"
+  "CMakeFiles/aeron_client_test.dir/ClientConductorFixture.cpp.o.d"
+  "CMakeFiles/aeron_client_test.dir/concurrent/MockAtomicBuffer.cpp.o"
+  "CMakeFiles/aeron_client_test.dir/concurrent/MockAtomicBuffer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aeron_client_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
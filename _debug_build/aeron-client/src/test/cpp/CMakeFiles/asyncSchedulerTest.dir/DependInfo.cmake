@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/aeron-client/src/test/cpp/AsyncSchedulerTest.cpp" "aeron-client/src/test/cpp/CMakeFiles/asyncSchedulerTest.dir/AsyncSchedulerTest.cpp.o" "gcc" "aeron-client/src/test/cpp/CMakeFiles/asyncSchedulerTest.dir/AsyncSchedulerTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/aeron-client/src/test/cpp/CMakeFiles/aeron_client_test.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/asyncSchedulerTest"
+  "../../../../binaries/asyncSchedulerTest.pdb"
+  "CMakeFiles/asyncSchedulerTest.dir/AsyncSchedulerTest.cpp.o"
+  "CMakeFiles/asyncSchedulerTest.dir/AsyncSchedulerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asyncSchedulerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/backoffIdleStrategyTest"
+  "../../../../binaries/backoffIdleStrategyTest.pdb"
+  "CMakeFiles/backoffIdleStrategyTest.dir/concurrent/BackoffIdleStrategyTest.cpp.o"
+  "CMakeFiles/backoffIdleStrategyTest.dir/concurrent/BackoffIdleStrategyTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/backoffIdleStrategyTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/broadcastReceiverTest"
+  "../../../../binaries/broadcastReceiverTest.pdb"
+  "CMakeFiles/broadcastReceiverTest.dir/concurrent/BroadcastReceiverTest.cpp.o"
+  "CMakeFiles/broadcastReceiverTest.dir/concurrent/BroadcastReceiverTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/broadcastReceiverTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
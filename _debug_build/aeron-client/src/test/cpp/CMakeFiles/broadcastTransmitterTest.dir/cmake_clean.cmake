@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/broadcastTransmitterTest"
+  "../../../../binaries/broadcastTransmitterTest.pdb"
+  "CMakeFiles/broadcastTransmitterTest.dir/concurrent/BroadcastTransmitterTest.cpp.o"
+  "CMakeFiles/broadcastTransmitterTest.dir/concurrent/BroadcastTransmitterTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/broadcastTransmitterTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
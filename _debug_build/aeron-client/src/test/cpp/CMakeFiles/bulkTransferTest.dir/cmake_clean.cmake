@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/bulkTransferTest"
+  "../../../../binaries/bulkTransferTest.pdb"
+  "CMakeFiles/bulkTransferTest.dir/BulkTransferTest.cpp.o"
+  "CMakeFiles/bulkTransferTest.dir/BulkTransferTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bulkTransferTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
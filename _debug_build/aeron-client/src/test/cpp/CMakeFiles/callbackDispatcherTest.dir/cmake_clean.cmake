@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/callbackDispatcherTest"
+  "../../../../binaries/callbackDispatcherTest.pdb"
+  "CMakeFiles/callbackDispatcherTest.dir/CallbackDispatcherTest.cpp.o"
+  "CMakeFiles/callbackDispatcherTest.dir/CallbackDispatcherTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/callbackDispatcherTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
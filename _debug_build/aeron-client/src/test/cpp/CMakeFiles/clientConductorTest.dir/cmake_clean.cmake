@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/clientConductorTest"
+  "../../../../binaries/clientConductorTest.pdb"
+  "CMakeFiles/clientConductorTest.dir/ClientConductorTest.cpp.o"
+  "CMakeFiles/clientConductorTest.dir/ClientConductorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clientConductorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
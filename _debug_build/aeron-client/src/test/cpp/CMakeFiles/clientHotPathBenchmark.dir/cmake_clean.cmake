@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/clientHotPathBenchmark"
+  "../../../../binaries/clientHotPathBenchmark.pdb"
+  "CMakeFiles/clientHotPathBenchmark.dir/ClientHotPathBenchmark.cpp.o"
+  "CMakeFiles/clientHotPathBenchmark.dir/ClientHotPathBenchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clientHotPathBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/commandTest"
+  "../../../../binaries/commandTest.pdb"
+  "CMakeFiles/commandTest.dir/command/CommandTest.cpp.o"
+  "CMakeFiles/commandTest.dir/command/CommandTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/commandTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
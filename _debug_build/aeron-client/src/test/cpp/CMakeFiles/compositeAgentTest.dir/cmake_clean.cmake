@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/compositeAgentTest"
+  "../../../../binaries/compositeAgentTest.pdb"
+  "CMakeFiles/compositeAgentTest.dir/concurrent/CompositeAgentTest.cpp.o"
+  "CMakeFiles/compositeAgentTest.dir/concurrent/CompositeAgentTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compositeAgentTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
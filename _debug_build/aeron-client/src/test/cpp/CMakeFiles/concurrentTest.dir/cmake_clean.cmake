@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/concurrentTest"
+  "../../../../binaries/concurrentTest.pdb"
+  "CMakeFiles/concurrentTest.dir/concurrent/ConcurrentTest.cpp.o"
+  "CMakeFiles/concurrentTest.dir/concurrent/ConcurrentTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/concurrentTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
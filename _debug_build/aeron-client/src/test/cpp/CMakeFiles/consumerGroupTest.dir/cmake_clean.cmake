@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/consumerGroupTest"
+  "../../../../binaries/consumerGroupTest.pdb"
+  "CMakeFiles/consumerGroupTest.dir/ConsumerGroupTest.cpp.o"
+  "CMakeFiles/consumerGroupTest.dir/ConsumerGroupTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/consumerGroupTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/countersIndexTest"
+  "../../../../binaries/countersIndexTest.pdb"
+  "CMakeFiles/countersIndexTest.dir/concurrent/CountersIndexTest.cpp.o"
+  "CMakeFiles/countersIndexTest.dir/concurrent/CountersIndexTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/countersIndexTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/countersManagerTest"
+  "../../../../binaries/countersManagerTest.pdb"
+  "CMakeFiles/countersManagerTest.dir/concurrent/CountersManagerTest.cpp.o"
+  "CMakeFiles/countersManagerTest.dir/concurrent/CountersManagerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/countersManagerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
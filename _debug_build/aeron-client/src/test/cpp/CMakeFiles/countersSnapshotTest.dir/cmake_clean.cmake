@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/countersSnapshotTest"
+  "../../../../binaries/countersSnapshotTest.pdb"
+  "CMakeFiles/countersSnapshotTest.dir/concurrent/CountersSnapshotTest.cpp.o"
+  "CMakeFiles/countersSnapshotTest.dir/concurrent/CountersSnapshotTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/countersSnapshotTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/distinctErrorLogTest"
+  "../../../../binaries/distinctErrorLogTest.pdb"
+  "CMakeFiles/distinctErrorLogTest.dir/concurrent/DistinctErrorLogTest.cpp.o"
+  "CMakeFiles/distinctErrorLogTest.dir/concurrent/DistinctErrorLogTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/distinctErrorLogTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/errorLogReaderTest"
+  "../../../../binaries/errorLogReaderTest.pdb"
+  "CMakeFiles/errorLogReaderTest.dir/concurrent/ErrorLogReaderTest.cpp.o"
+  "CMakeFiles/errorLogReaderTest.dir/concurrent/ErrorLogReaderTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/errorLogReaderTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
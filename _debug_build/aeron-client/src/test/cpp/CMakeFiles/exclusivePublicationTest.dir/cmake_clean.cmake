@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/exclusivePublicationTest"
+  "../../../../binaries/exclusivePublicationTest.pdb"
+  "CMakeFiles/exclusivePublicationTest.dir/ExclusivePublicationTest.cpp.o"
+  "CMakeFiles/exclusivePublicationTest.dir/ExclusivePublicationTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exclusivePublicationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/fragmentAssemblyTest"
+  "../../../../binaries/fragmentAssemblyTest.pdb"
+  "CMakeFiles/fragmentAssemblyTest.dir/FragmentAssemblerTest.cpp.o"
+  "CMakeFiles/fragmentAssemblyTest.dir/FragmentAssemblerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fragmentAssemblyTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/imageTest"
+  "../../../../binaries/imageTest.pdb"
+  "CMakeFiles/imageTest.dir/ImageTest.cpp.o"
+  "CMakeFiles/imageTest.dir/ImageTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imageTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/laneMergerTest"
+  "../../../../binaries/laneMergerTest.pdb"
+  "CMakeFiles/laneMergerTest.dir/LaneMergerTest.cpp.o"
+  "CMakeFiles/laneMergerTest.dir/LaneMergerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/laneMergerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/manyToOneRingBufferTest"
+  "../../../../binaries/manyToOneRingBufferTest.pdb"
+  "CMakeFiles/manyToOneRingBufferTest.dir/concurrent/ManyToOneRingBufferTest.cpp.o"
+  "CMakeFiles/manyToOneRingBufferTest.dir/concurrent/ManyToOneRingBufferTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/manyToOneRingBufferTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
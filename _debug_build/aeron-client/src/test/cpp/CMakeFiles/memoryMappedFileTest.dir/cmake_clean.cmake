@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/memoryMappedFileTest"
+  "../../../../binaries/memoryMappedFileTest.pdb"
+  "CMakeFiles/memoryMappedFileTest.dir/util/MemoryMappedFileTest.cpp.o"
+  "CMakeFiles/memoryMappedFileTest.dir/util/MemoryMappedFileTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memoryMappedFileTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/messageCompressionTest"
+  "../../../../binaries/messageCompressionTest.pdb"
+  "CMakeFiles/messageCompressionTest.dir/MessageCompressionTest.cpp.o"
+  "CMakeFiles/messageCompressionTest.dir/MessageCompressionTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/messageCompressionTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
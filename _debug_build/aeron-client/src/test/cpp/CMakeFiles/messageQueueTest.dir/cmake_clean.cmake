@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/messageQueueTest"
+  "../../../../binaries/messageQueueTest.pdb"
+  "CMakeFiles/messageQueueTest.dir/concurrent/MessageQueueTest.cpp.o"
+  "CMakeFiles/messageQueueTest.dir/concurrent/MessageQueueTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/messageQueueTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/oneToOneRingBuffertest"
+  "../../../../binaries/oneToOneRingBuffertest.pdb"
+  "CMakeFiles/oneToOneRingBuffertest.dir/concurrent/OneToOneRingBufferTest.cpp.o"
+  "CMakeFiles/oneToOneRingBuffertest.dir/concurrent/OneToOneRingBufferTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oneToOneRingBuffertest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
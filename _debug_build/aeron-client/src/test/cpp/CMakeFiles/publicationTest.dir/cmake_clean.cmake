@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/publicationTest"
+  "../../../../binaries/publicationTest.pdb"
+  "CMakeFiles/publicationTest.dir/PublicationTest.cpp.o"
+  "CMakeFiles/publicationTest.dir/PublicationTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/publicationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
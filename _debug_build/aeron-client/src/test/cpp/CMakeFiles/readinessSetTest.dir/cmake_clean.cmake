@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/readinessSetTest"
+  "../../../../binaries/readinessSetTest.pdb"
+  "CMakeFiles/readinessSetTest.dir/ReadinessSetTest.cpp.o"
+  "CMakeFiles/readinessSetTest.dir/ReadinessSetTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/readinessSetTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/sequencedMergerTest"
+  "../../../../binaries/sequencedMergerTest.pdb"
+  "CMakeFiles/sequencedMergerTest.dir/SequencedMergerTest.cpp.o"
+  "CMakeFiles/sequencedMergerTest.dir/SequencedMergerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sequencedMergerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/termAppenderTest"
+  "../../../../binaries/termAppenderTest.pdb"
+  "CMakeFiles/termAppenderTest.dir/concurrent/TermAppenderTest.cpp.o"
+  "CMakeFiles/termAppenderTest.dir/concurrent/TermAppenderTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/termAppenderTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/termBlockScannerTest"
+  "../../../../binaries/termBlockScannerTest.pdb"
+  "CMakeFiles/termBlockScannerTest.dir/concurrent/TermBlockScannerTest.cpp.o"
+  "CMakeFiles/termBlockScannerTest.dir/concurrent/TermBlockScannerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/termBlockScannerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
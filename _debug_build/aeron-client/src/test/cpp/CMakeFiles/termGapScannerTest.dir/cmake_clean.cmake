@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/termGapScannerTest"
+  "../../../../binaries/termGapScannerTest.pdb"
+  "CMakeFiles/termGapScannerTest.dir/concurrent/TermGapScannerTest.cpp.o"
+  "CMakeFiles/termGapScannerTest.dir/concurrent/TermGapScannerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/termGapScannerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
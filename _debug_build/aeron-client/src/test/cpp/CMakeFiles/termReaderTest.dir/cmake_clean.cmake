@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/termReaderTest"
+  "../../../../binaries/termReaderTest.pdb"
+  "CMakeFiles/termReaderTest.dir/concurrent/TermReaderTest.cpp.o"
+  "CMakeFiles/termReaderTest.dir/concurrent/TermReaderTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/termReaderTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/termRebuilderTest"
+  "../../../../binaries/termRebuilderTest.pdb"
+  "CMakeFiles/termRebuilderTest.dir/concurrent/TermRebuilderTest.cpp.o"
+  "CMakeFiles/termRebuilderTest.dir/concurrent/TermRebuilderTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/termRebuilderTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
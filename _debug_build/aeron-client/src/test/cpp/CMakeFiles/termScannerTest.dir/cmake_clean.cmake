@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/termScannerTest"
+  "../../../../binaries/termScannerTest.pdb"
+  "CMakeFiles/termScannerTest.dir/concurrent/TermScannerTest.cpp.o"
+  "CMakeFiles/termScannerTest.dir/concurrent/TermScannerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/termScannerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/utilTest"
+  "../../../../binaries/utilTest.pdb"
+  "CMakeFiles/utilTest.dir/util/UtilTest.cpp.o"
+  "CMakeFiles/utilTest.dir/util/UtilTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utilTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,76 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/aeron-client/src/test/cpp
+# Build directory: /root/repo/_debug_build/aeron-client/src/test/cpp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(clientConductorTest "/root/repo/_debug_build/binaries/clientConductorTest")
+set_tests_properties(clientConductorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;41;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(publicationTest "/root/repo/_debug_build/binaries/publicationTest")
+set_tests_properties(publicationTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;42;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(exclusivePublicationTest "/root/repo/_debug_build/binaries/exclusivePublicationTest")
+set_tests_properties(exclusivePublicationTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;43;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(imageTest "/root/repo/_debug_build/binaries/imageTest")
+set_tests_properties(imageTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;44;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(fragmentAssemblyTest "/root/repo/_debug_build/binaries/fragmentAssemblyTest")
+set_tests_properties(fragmentAssemblyTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;45;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(laneMergerTest "/root/repo/_debug_build/binaries/laneMergerTest")
+set_tests_properties(laneMergerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;46;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(sequencedMergerTest "/root/repo/_debug_build/binaries/sequencedMergerTest")
+set_tests_properties(sequencedMergerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;47;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(messageCompressionTest "/root/repo/_debug_build/binaries/messageCompressionTest")
+set_tests_properties(messageCompressionTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;48;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(bulkTransferTest "/root/repo/_debug_build/binaries/bulkTransferTest")
+set_tests_properties(bulkTransferTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;49;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(consumerGroupTest "/root/repo/_debug_build/binaries/consumerGroupTest")
+set_tests_properties(consumerGroupTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;50;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(readinessSetTest "/root/repo/_debug_build/binaries/readinessSetTest")
+set_tests_properties(readinessSetTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;51;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(callbackDispatcherTest "/root/repo/_debug_build/binaries/callbackDispatcherTest")
+set_tests_properties(callbackDispatcherTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;52;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(asyncSchedulerTest "/root/repo/_debug_build/binaries/asyncSchedulerTest")
+set_tests_properties(asyncSchedulerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;55;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(commandTest "/root/repo/_debug_build/binaries/commandTest")
+set_tests_properties(commandTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;61;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(utilTest "/root/repo/_debug_build/binaries/utilTest")
+set_tests_properties(utilTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;62;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(memoryMappedFileTest "/root/repo/_debug_build/binaries/memoryMappedFileTest")
+set_tests_properties(memoryMappedFileTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;63;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(broadcastReceiverTest "/root/repo/_debug_build/binaries/broadcastReceiverTest")
+set_tests_properties(broadcastReceiverTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;64;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(broadcastTransmitterTest "/root/repo/_debug_build/binaries/broadcastTransmitterTest")
+set_tests_properties(broadcastTransmitterTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;65;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(concurrentTest "/root/repo/_debug_build/binaries/concurrentTest")
+set_tests_properties(concurrentTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;66;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(countersManagerTest "/root/repo/_debug_build/binaries/countersManagerTest")
+set_tests_properties(countersManagerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;67;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(countersIndexTest "/root/repo/_debug_build/binaries/countersIndexTest")
+set_tests_properties(countersIndexTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;68;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(countersSnapshotTest "/root/repo/_debug_build/binaries/countersSnapshotTest")
+set_tests_properties(countersSnapshotTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;69;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(compositeAgentTest "/root/repo/_debug_build/binaries/compositeAgentTest")
+set_tests_properties(compositeAgentTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;70;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(backoffIdleStrategyTest "/root/repo/_debug_build/binaries/backoffIdleStrategyTest")
+set_tests_properties(backoffIdleStrategyTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;71;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(termAppenderTest "/root/repo/_debug_build/binaries/termAppenderTest")
+set_tests_properties(termAppenderTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;72;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(termReaderTest "/root/repo/_debug_build/binaries/termReaderTest")
+set_tests_properties(termReaderTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;73;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(termBlockScannerTest "/root/repo/_debug_build/binaries/termBlockScannerTest")
+set_tests_properties(termBlockScannerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;74;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(termRebuilderTest "/root/repo/_debug_build/binaries/termRebuilderTest")
+set_tests_properties(termRebuilderTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;75;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(termGapScannerTest "/root/repo/_debug_build/binaries/termGapScannerTest")
+set_tests_properties(termGapScannerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;76;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(termScannerTest "/root/repo/_debug_build/binaries/termScannerTest")
+set_tests_properties(termScannerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;77;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(manyToOneRingBufferTest "/root/repo/_debug_build/binaries/manyToOneRingBufferTest")
+set_tests_properties(manyToOneRingBufferTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;78;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(distinctErrorLogTest "/root/repo/_debug_build/binaries/distinctErrorLogTest")
+set_tests_properties(distinctErrorLogTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;79;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(errorLogReaderTest "/root/repo/_debug_build/binaries/errorLogReaderTest")
+set_tests_properties(errorLogReaderTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;80;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(oneToOneRingBuffertest "/root/repo/_debug_build/binaries/oneToOneRingBuffertest")
+set_tests_properties(oneToOneRingBuffertest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;81;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
+add_test(messageQueueTest "/root/repo/_debug_build/binaries/messageQueueTest")
+set_tests_properties(messageQueueTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;38;add_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;82;aeron_client_test;/root/repo/aeron-client/src/test/cpp/CMakeLists.txt;0;")
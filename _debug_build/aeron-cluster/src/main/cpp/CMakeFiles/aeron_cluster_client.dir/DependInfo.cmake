@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/aeron-cluster/src/main/cpp/client/AeronCluster.cpp" "aeron-cluster/src/main/cpp/CMakeFiles/aeron_cluster_client.dir/client/AeronCluster.cpp.o" "gcc" "aeron-cluster/src/main/cpp/CMakeFiles/aeron_cluster_client.dir/client/AeronCluster.cpp.o.d"
+  "/root/repo/aeron-cluster/src/main/cpp/client/EgressAdapter.cpp" "aeron-cluster/src/main/cpp/CMakeFiles/aeron_cluster_client.dir/client/EgressAdapter.cpp.o" "gcc" "aeron-cluster/src/main/cpp/CMakeFiles/aeron_cluster_client.dir/client/EgressAdapter.cpp.o.d"
+  "/root/repo/aeron-cluster/src/main/cpp/client/EgressPoller.cpp" "aeron-cluster/src/main/cpp/CMakeFiles/aeron_cluster_client.dir/client/EgressPoller.cpp.o" "gcc" "aeron-cluster/src/main/cpp/CMakeFiles/aeron_cluster_client.dir/client/EgressPoller.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/aeron-client/src/main/cpp/CMakeFiles/aeron_client.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
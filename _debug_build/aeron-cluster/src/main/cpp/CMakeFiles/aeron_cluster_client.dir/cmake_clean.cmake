@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libaeron_cluster_client.a"
+  "../../../../lib/libaeron_cluster_client.pdb"
+  "CMakeFiles/aeron_cluster_client.dir/client/AeronCluster.cpp.o"
+  "CMakeFiles/aeron_cluster_client.dir/client/AeronCluster.cpp.o.d"
+  "CMakeFiles/aeron_cluster_client.dir/client/EgressAdapter.cpp.o"
+  "CMakeFiles/aeron_cluster_client.dir/client/EgressAdapter.cpp.o.d"
+  "CMakeFiles/aeron_cluster_client.dir/client/EgressPoller.cpp.o"
+  "CMakeFiles/aeron_cluster_client.dir/client/EgressPoller.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aeron_cluster_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/aeron-cluster/src/main/cpp
+# Build directory: /root/repo/_debug_build/aeron-cluster/src/main/cpp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
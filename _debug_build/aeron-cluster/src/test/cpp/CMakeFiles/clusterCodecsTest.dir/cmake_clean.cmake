@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/clusterCodecsTest"
+  "../../../../binaries/clusterCodecsTest.pdb"
+  "CMakeFiles/clusterCodecsTest.dir/ClusterCodecsTest.cpp.o"
+  "CMakeFiles/clusterCodecsTest.dir/ClusterCodecsTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clusterCodecsTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/egressAdapterTest"
+  "../../../../binaries/egressAdapterTest.pdb"
+  "CMakeFiles/egressAdapterTest.dir/EgressAdapterTest.cpp.o"
+  "CMakeFiles/egressAdapterTest.dir/EgressAdapterTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/egressAdapterTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
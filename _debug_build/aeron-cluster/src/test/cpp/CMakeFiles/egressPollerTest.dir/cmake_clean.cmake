@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/egressPollerTest"
+  "../../../../binaries/egressPollerTest.pdb"
+  "CMakeFiles/egressPollerTest.dir/EgressPollerTest.cpp.o"
+  "CMakeFiles/egressPollerTest.dir/EgressPollerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/egressPollerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/aeron-cluster/src/test/cpp
+# Build directory: /root/repo/_debug_build/aeron-cluster/src/test/cpp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(clusterCodecsTest "/root/repo/_debug_build/binaries/clusterCodecsTest")
+set_tests_properties(clusterCodecsTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-cluster/src/test/cpp/CMakeLists.txt;28;add_test;/root/repo/aeron-cluster/src/test/cpp/CMakeLists.txt;31;aeron_cluster_test;/root/repo/aeron-cluster/src/test/cpp/CMakeLists.txt;0;")
+add_test(egressAdapterTest "/root/repo/_debug_build/binaries/egressAdapterTest")
+set_tests_properties(egressAdapterTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-cluster/src/test/cpp/CMakeLists.txt;28;add_test;/root/repo/aeron-cluster/src/test/cpp/CMakeLists.txt;32;aeron_cluster_test;/root/repo/aeron-cluster/src/test/cpp/CMakeLists.txt;0;")
+add_test(egressPollerTest "/root/repo/_debug_build/binaries/egressPollerTest")
+set_tests_properties(egressPollerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-cluster/src/test/cpp/CMakeLists.txt;28;add_test;/root/repo/aeron-cluster/src/test/cpp/CMakeLists.txt;33;aeron_cluster_test;/root/repo/aeron-cluster/src/test/cpp/CMakeLists.txt;0;")
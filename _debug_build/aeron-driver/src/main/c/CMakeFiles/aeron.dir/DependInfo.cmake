@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/aeron-driver/src/main/c/aeron_alloc.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/aeron_alloc.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/aeron_alloc.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_cnc_file_descriptor.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/aeron_cnc_file_descriptor.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/aeron_cnc_file_descriptor.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/client/aeron_client_conductor.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/client/aeron_client_conductor.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/client/aeron_client_conductor.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/client/aeron_publication.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/client/aeron_publication.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/client/aeron_publication.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/client/aeron_subscription.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/client/aeron_subscription.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/client/aeron_subscription.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/client/aeronc.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/client/aeronc.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/client/aeronc.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_atomic.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/concurrent/aeron_atomic.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/concurrent/aeron_atomic.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_broadcast_receiver.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/concurrent/aeron_broadcast_receiver.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/concurrent/aeron_broadcast_receiver.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_logbuffer_descriptor.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/concurrent/aeron_logbuffer_descriptor.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/concurrent/aeron_logbuffer_descriptor.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_mpsc_rb.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/concurrent/aeron_mpsc_rb.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/concurrent/aeron_mpsc_rb.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_arrayutil.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/util/aeron_arrayutil.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/util/aeron_arrayutil.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_error.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/util/aeron_error.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/util/aeron_error.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_fileutil.c" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/util/aeron_fileutil.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron.dir/util/aeron_fileutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libaeron.pdb"
+  "../../../../lib/libaeron.so"
+  "CMakeFiles/aeron.dir/aeron_alloc.c.o"
+  "CMakeFiles/aeron.dir/aeron_alloc.c.o.d"
+  "CMakeFiles/aeron.dir/aeron_cnc_file_descriptor.c.o"
+  "CMakeFiles/aeron.dir/aeron_cnc_file_descriptor.c.o.d"
+  "CMakeFiles/aeron.dir/client/aeron_client_conductor.c.o"
+  "CMakeFiles/aeron.dir/client/aeron_client_conductor.c.o.d"
+  "CMakeFiles/aeron.dir/client/aeron_publication.c.o"
+  "CMakeFiles/aeron.dir/client/aeron_publication.c.o.d"
+  "CMakeFiles/aeron.dir/client/aeron_subscription.c.o"
+  "CMakeFiles/aeron.dir/client/aeron_subscription.c.o.d"
+  "CMakeFiles/aeron.dir/client/aeronc.c.o"
+  "CMakeFiles/aeron.dir/client/aeronc.c.o.d"
+  "CMakeFiles/aeron.dir/concurrent/aeron_atomic.c.o"
+  "CMakeFiles/aeron.dir/concurrent/aeron_atomic.c.o.d"
+  "CMakeFiles/aeron.dir/concurrent/aeron_broadcast_receiver.c.o"
+  "CMakeFiles/aeron.dir/concurrent/aeron_broadcast_receiver.c.o.d"
+  "CMakeFiles/aeron.dir/concurrent/aeron_logbuffer_descriptor.c.o"
+  "CMakeFiles/aeron.dir/concurrent/aeron_logbuffer_descriptor.c.o.d"
+  "CMakeFiles/aeron.dir/concurrent/aeron_mpsc_rb.c.o"
+  "CMakeFiles/aeron.dir/concurrent/aeron_mpsc_rb.c.o.d"
+  "CMakeFiles/aeron.dir/util/aeron_arrayutil.c.o"
+  "CMakeFiles/aeron.dir/util/aeron_arrayutil.c.o.d"
+  "CMakeFiles/aeron.dir/util/aeron_error.c.o"
+  "CMakeFiles/aeron.dir/util/aeron_error.c.o.d"
+  "CMakeFiles/aeron.dir/util/aeron_fileutil.c.o"
+  "CMakeFiles/aeron.dir/util/aeron_fileutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aeron.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
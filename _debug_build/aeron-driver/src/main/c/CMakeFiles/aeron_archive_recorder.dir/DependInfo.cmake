@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/aeron-driver/src/main/c/archive/aeron_archive_catalog.c" "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_catalog.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_catalog.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/archive/aeron_archive_recorder.c" "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recorder.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recorder.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/archive/aeron_archive_recording_session.c" "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recording_session.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recording_session.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/archive/aeron_archive_recording_writer.c" "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recording_writer.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recording_writer.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/archive/aeron_archive_replay_session.c" "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_replay_session.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_replay_session.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/aeron-driver/src/main/c/CMakeFiles/aeron.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
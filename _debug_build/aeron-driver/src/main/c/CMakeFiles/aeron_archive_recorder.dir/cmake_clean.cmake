@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libaeron_archive_recorder.pdb"
+  "../../../../lib/libaeron_archive_recorder.so"
+  "CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_catalog.c.o"
+  "CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_catalog.c.o.d"
+  "CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recorder.c.o"
+  "CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recorder.c.o.d"
+  "CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recording_session.c.o"
+  "CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recording_session.c.o.d"
+  "CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recording_writer.c.o"
+  "CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_recording_writer.c.o.d"
+  "CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_replay_session.c.o"
+  "CMakeFiles/aeron_archive_recorder.dir/archive/aeron_archive_replay_session.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aeron_archive_recorder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/aeron_archiving_md"
+  "../../../../binaries/aeron_archiving_md.pdb"
+  "CMakeFiles/aeron_archiving_md.dir/aeron_archiving_md.c.o"
+  "CMakeFiles/aeron_archiving_md.dir/aeron_archiving_md.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aeron_archiving_md.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
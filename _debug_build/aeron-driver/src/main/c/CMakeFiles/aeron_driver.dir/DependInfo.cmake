@@ -0,0 +1,95 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/aeron-driver/src/main/c/aeron_agent.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_agent.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_agent.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_alloc.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_alloc.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_alloc.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_cnc_file_descriptor.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_cnc_file_descriptor.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_cnc_file_descriptor.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_congestion_control.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_congestion_control.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_congestion_control.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_data_packet_dispatcher.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_data_packet_dispatcher.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_data_packet_dispatcher.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_driver.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_driver_command_pool.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_command_pool.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_command_pool.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_driver_conductor.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_conductor.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_conductor.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_driver_conductor_proxy.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_conductor_proxy.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_conductor_proxy.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_driver_context.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_context.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_context.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_driver_receiver.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_receiver.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_receiver.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_driver_receiver_proxy.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_receiver_proxy.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_receiver_proxy.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_driver_sender.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_sender.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_sender.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_driver_sender_proxy.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_sender_proxy.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_driver_sender_proxy.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_durable_log_syncer.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_durable_log_syncer.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_durable_log_syncer.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_duty_cycle_tracker.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_duty_cycle_tracker.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_duty_cycle_tracker.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_fec.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_fec.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_fec.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_flow_control.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_flow_control.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_flow_control.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_frame_checksum.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_frame_checksum.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_frame_checksum.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_ipc_publication.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_ipc_publication.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_ipc_publication.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_loss_detector.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_loss_detector.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_loss_detector.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_name_resolver.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_name_resolver.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_name_resolver.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_network_publication.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_network_publication.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_network_publication.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_pmtu_discovery.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_pmtu_discovery.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_pmtu_discovery.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_position.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_position.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_position.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_publication_image.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_publication_image.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_publication_image.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_raw_log_pool.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_raw_log_pool.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_raw_log_pool.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_retransmit_handler.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_retransmit_handler.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_retransmit_handler.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_send_pacer.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_send_pacer.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_send_pacer.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_system_counters.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_system_counters.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_system_counters.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/aeron_term_length_advisor.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_term_length_advisor.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/aeron_term_length_advisor.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/collections/aeron_deadline_timer_wheel.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/collections/aeron_deadline_timer_wheel.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/collections/aeron_deadline_timer_wheel.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/collections/aeron_int64_to_ptr_hash_map.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/collections/aeron_int64_to_ptr_hash_map.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/collections/aeron_int64_to_ptr_hash_map.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/collections/aeron_int64_to_ptr_swiss_map.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/collections/aeron_int64_to_ptr_swiss_map.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/collections/aeron_int64_to_ptr_swiss_map.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/collections/aeron_str_to_ptr_hash_map.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/collections/aeron_str_to_ptr_hash_map.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/collections/aeron_str_to_ptr_hash_map.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_atomic.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_atomic.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_atomic.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_broadcast_receiver.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_broadcast_receiver.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_broadcast_receiver.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_broadcast_transmitter.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_broadcast_transmitter.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_broadcast_transmitter.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_counters_manager.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_counters_manager.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_counters_manager.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_distinct_error_log.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_distinct_error_log.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_distinct_error_log.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_logbuffer_descriptor.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_logbuffer_descriptor.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_logbuffer_descriptor.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_logbuffer_unblocker.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_logbuffer_unblocker.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_logbuffer_unblocker.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_mpsc_concurrent_array_queue.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_mpsc_concurrent_array_queue.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_mpsc_concurrent_array_queue.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_mpsc_rb.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_mpsc_rb.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_mpsc_rb.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_spsc_concurrent_array_queue.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_spsc_concurrent_array_queue.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_spsc_concurrent_array_queue.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_spsc_rb.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_spsc_rb.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_spsc_rb.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_term_gap_filler.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_term_gap_filler.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_term_gap_filler.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_term_gap_scanner.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_term_gap_scanner.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_term_gap_scanner.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_term_rebuilder.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_term_rebuilder.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_term_rebuilder.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_term_scanner.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_term_scanner.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_term_scanner.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_term_unblocker.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_term_unblocker.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/concurrent/aeron_term_unblocker.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_receive_channel_endpoint.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_receive_channel_endpoint.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_receive_channel_endpoint.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_send_channel_endpoint.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_send_channel_endpoint.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_send_channel_endpoint.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_channel.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_channel_transport.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_channel_transport_aes_gcm.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_aes_gcm.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_aes_gcm.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_channel_transport_bindings.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_bindings.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_bindings.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_channel_transport_debug.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_debug.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_debug.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_channel_transport_dpdk.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_dpdk.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_dpdk.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_channel_transport_ibverbs.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_ibverbs.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_ibverbs.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_channel_transport_shm.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_shm.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_shm.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_destination_tracker.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_destination_tracker.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_destination_tracker.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_io_uring.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_io_uring.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_io_uring.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/media/aeron_udp_transport_poller.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_transport_poller.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/media/aeron_udp_transport_poller.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/reports/aeron_flow_control_trace.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/reports/aeron_flow_control_trace.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/reports/aeron_flow_control_trace.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/reports/aeron_loss_reporter.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/reports/aeron_loss_reporter.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/reports/aeron_loss_reporter.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/reports/aeron_position_snapshot.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/reports/aeron_position_snapshot.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/reports/aeron_position_snapshot.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/reports/aeron_stream_activity.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/reports/aeron_stream_activity.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/reports/aeron_stream_activity.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/uri/aeron_uri.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/uri/aeron_uri.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/uri/aeron_uri.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_arrayutil.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_arrayutil.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_arrayutil.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_clock.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_clock.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_clock.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_crc32c.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_crc32c.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_crc32c.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_error.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_error.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_error.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_fileutil.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_fileutil.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_fileutil.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_netutil.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_netutil.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_netutil.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_numautil.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_numautil.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_numautil.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_strutil.c" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_strutil.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_driver.dir/util/aeron_strutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,163 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libaeron_driver.pdb"
+  "../../../../lib/libaeron_driver.so"
+  "CMakeFiles/aeron_driver.dir/aeron_agent.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_agent.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_alloc.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_alloc.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_cnc_file_descriptor.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_cnc_file_descriptor.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_congestion_control.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_congestion_control.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_data_packet_dispatcher.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_data_packet_dispatcher.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_driver.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_driver.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_command_pool.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_command_pool.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_conductor.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_conductor.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_conductor_proxy.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_conductor_proxy.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_context.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_context.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_receiver.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_receiver.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_receiver_proxy.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_receiver_proxy.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_sender.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_sender.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_sender_proxy.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_driver_sender_proxy.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_durable_log_syncer.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_durable_log_syncer.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_duty_cycle_tracker.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_duty_cycle_tracker.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_fec.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_fec.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_flow_control.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_flow_control.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_frame_checksum.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_frame_checksum.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_ipc_publication.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_ipc_publication.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_loss_detector.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_loss_detector.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_name_resolver.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_name_resolver.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_network_publication.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_network_publication.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_pmtu_discovery.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_pmtu_discovery.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_position.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_position.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_publication_image.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_publication_image.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_raw_log_pool.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_raw_log_pool.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_retransmit_handler.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_retransmit_handler.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_send_pacer.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_send_pacer.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_system_counters.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_system_counters.c.o.d"
+  "CMakeFiles/aeron_driver.dir/aeron_term_length_advisor.c.o"
+  "CMakeFiles/aeron_driver.dir/aeron_term_length_advisor.c.o.d"
+  "CMakeFiles/aeron_driver.dir/collections/aeron_deadline_timer_wheel.c.o"
+  "CMakeFiles/aeron_driver.dir/collections/aeron_deadline_timer_wheel.c.o.d"
+  "CMakeFiles/aeron_driver.dir/collections/aeron_int64_to_ptr_hash_map.c.o"
+  "CMakeFiles/aeron_driver.dir/collections/aeron_int64_to_ptr_hash_map.c.o.d"
+  "CMakeFiles/aeron_driver.dir/collections/aeron_int64_to_ptr_swiss_map.c.o"
+  "CMakeFiles/aeron_driver.dir/collections/aeron_int64_to_ptr_swiss_map.c.o.d"
+  "CMakeFiles/aeron_driver.dir/collections/aeron_str_to_ptr_hash_map.c.o"
+  "CMakeFiles/aeron_driver.dir/collections/aeron_str_to_ptr_hash_map.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_atomic.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_atomic.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_broadcast_receiver.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_broadcast_receiver.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_broadcast_transmitter.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_broadcast_transmitter.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_counters_manager.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_counters_manager.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_distinct_error_log.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_distinct_error_log.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_logbuffer_descriptor.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_logbuffer_descriptor.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_logbuffer_unblocker.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_logbuffer_unblocker.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_mpsc_concurrent_array_queue.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_mpsc_concurrent_array_queue.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_mpsc_rb.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_mpsc_rb.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_spsc_concurrent_array_queue.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_spsc_concurrent_array_queue.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_spsc_rb.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_spsc_rb.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_term_gap_filler.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_term_gap_filler.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_term_gap_scanner.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_term_gap_scanner.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_term_rebuilder.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_term_rebuilder.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_term_scanner.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_term_scanner.c.o.d"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_term_unblocker.c.o"
+  "CMakeFiles/aeron_driver.dir/concurrent/aeron_term_unblocker.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_receive_channel_endpoint.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_receive_channel_endpoint.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_send_channel_endpoint.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_send_channel_endpoint.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_aes_gcm.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_aes_gcm.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_bindings.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_bindings.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_debug.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_debug.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_dpdk.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_dpdk.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_ibverbs.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_ibverbs.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_shm.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_channel_transport_shm.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_destination_tracker.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_destination_tracker.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_io_uring.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_io_uring.c.o.d"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_transport_poller.c.o"
+  "CMakeFiles/aeron_driver.dir/media/aeron_udp_transport_poller.c.o.d"
+  "CMakeFiles/aeron_driver.dir/reports/aeron_flow_control_trace.c.o"
+  "CMakeFiles/aeron_driver.dir/reports/aeron_flow_control_trace.c.o.d"
+  "CMakeFiles/aeron_driver.dir/reports/aeron_loss_reporter.c.o"
+  "CMakeFiles/aeron_driver.dir/reports/aeron_loss_reporter.c.o.d"
+  "CMakeFiles/aeron_driver.dir/reports/aeron_position_snapshot.c.o"
+  "CMakeFiles/aeron_driver.dir/reports/aeron_position_snapshot.c.o.d"
+  "CMakeFiles/aeron_driver.dir/reports/aeron_stream_activity.c.o"
+  "CMakeFiles/aeron_driver.dir/reports/aeron_stream_activity.c.o.d"
+  "CMakeFiles/aeron_driver.dir/uri/aeron_uri.c.o"
+  "CMakeFiles/aeron_driver.dir/uri/aeron_uri.c.o.d"
+  "CMakeFiles/aeron_driver.dir/util/aeron_arrayutil.c.o"
+  "CMakeFiles/aeron_driver.dir/util/aeron_arrayutil.c.o.d"
+  "CMakeFiles/aeron_driver.dir/util/aeron_clock.c.o"
+  "CMakeFiles/aeron_driver.dir/util/aeron_clock.c.o.d"
+  "CMakeFiles/aeron_driver.dir/util/aeron_crc32c.c.o"
+  "CMakeFiles/aeron_driver.dir/util/aeron_crc32c.c.o.d"
+  "CMakeFiles/aeron_driver.dir/util/aeron_error.c.o"
+  "CMakeFiles/aeron_driver.dir/util/aeron_error.c.o.d"
+  "CMakeFiles/aeron_driver.dir/util/aeron_fileutil.c.o"
+  "CMakeFiles/aeron_driver.dir/util/aeron_fileutil.c.o.d"
+  "CMakeFiles/aeron_driver.dir/util/aeron_netutil.c.o"
+  "CMakeFiles/aeron_driver.dir/util/aeron_netutil.c.o.d"
+  "CMakeFiles/aeron_driver.dir/util/aeron_numautil.c.o"
+  "CMakeFiles/aeron_driver.dir/util/aeron_numautil.c.o.d"
+  "CMakeFiles/aeron_driver.dir/util/aeron_strutil.c.o"
+  "CMakeFiles/aeron_driver.dir/util/aeron_strutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aeron_driver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libaeron_driver_agent.pdb"
+  "../../../../lib/libaeron_driver_agent.so"
+  "CMakeFiles/aeron_driver_agent.dir/aeron_alloc.c.o"
+  "CMakeFiles/aeron_driver_agent.dir/aeron_alloc.c.o.d"
+  "CMakeFiles/aeron_driver_agent.dir/agent/aeron_driver_agent.c.o"
+  "CMakeFiles/aeron_driver_agent.dir/agent/aeron_driver_agent.c.o.d"
+  "CMakeFiles/aeron_driver_agent.dir/agent/aeron_driver_agent_binary_log.c.o"
+  "CMakeFiles/aeron_driver_agent.dir/agent/aeron_driver_agent_binary_log.c.o.d"
+  "CMakeFiles/aeron_driver_agent.dir/agent/aeron_driver_agent_pcap.c.o"
+  "CMakeFiles/aeron_driver_agent.dir/agent/aeron_driver_agent_pcap.c.o.d"
+  "CMakeFiles/aeron_driver_agent.dir/concurrent/aeron_atomic.c.o"
+  "CMakeFiles/aeron_driver_agent.dir/concurrent/aeron_atomic.c.o.d"
+  "CMakeFiles/aeron_driver_agent.dir/concurrent/aeron_mpsc_rb.c.o"
+  "CMakeFiles/aeron_driver_agent.dir/concurrent/aeron_mpsc_rb.c.o.d"
+  "CMakeFiles/aeron_driver_agent.dir/util/aeron_error.c.o"
+  "CMakeFiles/aeron_driver_agent.dir/util/aeron_error.c.o.d"
+  "CMakeFiles/aeron_driver_agent.dir/util/aeron_fileutil.c.o"
+  "CMakeFiles/aeron_driver_agent.dir/util/aeron_fileutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aeron_driver_agent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
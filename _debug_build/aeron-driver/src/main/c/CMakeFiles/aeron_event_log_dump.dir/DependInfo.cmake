@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/aeron-driver/src/main/c/aeron_alloc.c" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/aeron_alloc.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/aeron_alloc.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/agent/aeron_driver_agent_binary_log.c" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/agent/aeron_driver_agent_binary_log.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/agent/aeron_driver_agent_binary_log.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/agent/aeron_event_log_dump.c" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/agent/aeron_event_log_dump.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/agent/aeron_event_log_dump.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_atomic.c" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/concurrent/aeron_atomic.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/concurrent/aeron_atomic.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/concurrent/aeron_logbuffer_descriptor.c" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/concurrent/aeron_logbuffer_descriptor.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/concurrent/aeron_logbuffer_descriptor.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_error.c" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/util/aeron_error.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/util/aeron_error.c.o.d"
+  "/root/repo/aeron-driver/src/main/c/util/aeron_fileutil.c" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/util/aeron_fileutil.c.o" "gcc" "aeron-driver/src/main/c/CMakeFiles/aeron_event_log_dump.dir/util/aeron_fileutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/aeron_event_log_dump"
+  "../../../../binaries/aeron_event_log_dump.pdb"
+  "CMakeFiles/aeron_event_log_dump.dir/aeron_alloc.c.o"
+  "CMakeFiles/aeron_event_log_dump.dir/aeron_alloc.c.o.d"
+  "CMakeFiles/aeron_event_log_dump.dir/agent/aeron_driver_agent_binary_log.c.o"
+  "CMakeFiles/aeron_event_log_dump.dir/agent/aeron_driver_agent_binary_log.c.o.d"
+  "CMakeFiles/aeron_event_log_dump.dir/agent/aeron_event_log_dump.c.o"
+  "CMakeFiles/aeron_event_log_dump.dir/agent/aeron_event_log_dump.c.o.d"
+  "CMakeFiles/aeron_event_log_dump.dir/concurrent/aeron_atomic.c.o"
+  "CMakeFiles/aeron_event_log_dump.dir/concurrent/aeron_atomic.c.o.d"
+  "CMakeFiles/aeron_event_log_dump.dir/concurrent/aeron_logbuffer_descriptor.c.o"
+  "CMakeFiles/aeron_event_log_dump.dir/concurrent/aeron_logbuffer_descriptor.c.o.d"
+  "CMakeFiles/aeron_event_log_dump.dir/util/aeron_error.c.o"
+  "CMakeFiles/aeron_event_log_dump.dir/util/aeron_error.c.o.d"
+  "CMakeFiles/aeron_event_log_dump.dir/util/aeron_fileutil.c.o"
+  "CMakeFiles/aeron_event_log_dump.dir/util/aeron_fileutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aeron_event_log_dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
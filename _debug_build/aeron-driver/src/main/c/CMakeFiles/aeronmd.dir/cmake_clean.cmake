@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/aeronmd"
+  "../../../../binaries/aeronmd.pdb"
+  "CMakeFiles/aeronmd.dir/aeronmd.c.o"
+  "CMakeFiles/aeronmd.dir/aeronmd.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aeronmd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
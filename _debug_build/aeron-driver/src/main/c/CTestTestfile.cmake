@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/aeron-driver/src/main/c
+# Build directory: /root/repo/_debug_build/aeron-driver/src/main/c
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/agent_test"
+  "../../../../binaries/agent_test.pdb"
+  "CMakeFiles/agent_test.dir/aeron_agent_test.cpp.o"
+  "CMakeFiles/agent_test.dir/aeron_agent_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/agent_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/archive_catalog_test"
+  "../../../../binaries/archive_catalog_test.pdb"
+  "CMakeFiles/archive_catalog_test.dir/aeron_archive_catalog_test.cpp.o"
+  "CMakeFiles/archive_catalog_test.dir/aeron_archive_catalog_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/archive_catalog_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/archive_recorder_test"
+  "../../../../binaries/archive_recorder_test.pdb"
+  "CMakeFiles/archive_recorder_test.dir/aeron_archive_recorder_test.cpp.o"
+  "CMakeFiles/archive_recorder_test.dir/aeron_archive_recorder_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/archive_recorder_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/broadcast_receiver_test"
+  "../../../../binaries/broadcast_receiver_test.pdb"
+  "CMakeFiles/broadcast_receiver_test.dir/aeron_broadcast_receiver_test.cpp.o"
+  "CMakeFiles/broadcast_receiver_test.dir/aeron_broadcast_receiver_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/broadcast_receiver_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
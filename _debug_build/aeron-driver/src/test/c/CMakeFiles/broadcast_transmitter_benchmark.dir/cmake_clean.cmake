@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/broadcast_transmitter_benchmark"
+  "../../../../binaries/broadcast_transmitter_benchmark.pdb"
+  "CMakeFiles/broadcast_transmitter_benchmark.dir/aeron_broadcast_transmitter_benchmark.cpp.o"
+  "CMakeFiles/broadcast_transmitter_benchmark.dir/aeron_broadcast_transmitter_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/broadcast_transmitter_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/broadcast_transmitter_test"
+  "../../../../binaries/broadcast_transmitter_test.pdb"
+  "CMakeFiles/broadcast_transmitter_test.dir/aeron_broadcast_transmitter_test.cpp.o"
+  "CMakeFiles/broadcast_transmitter_test.dir/aeron_broadcast_transmitter_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/broadcast_transmitter_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/c_client_test"
+  "../../../../binaries/c_client_test.pdb"
+  "CMakeFiles/c_client_test.dir/aeron_c_client_test.cpp.o"
+  "CMakeFiles/c_client_test.dir/aeron_c_client_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c_client_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
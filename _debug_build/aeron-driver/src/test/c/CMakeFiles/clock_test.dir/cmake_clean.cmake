@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/clock_test"
+  "../../../../binaries/clock_test.pdb"
+  "CMakeFiles/clock_test.dir/aeron_clock_test.cpp.o"
+  "CMakeFiles/clock_test.dir/aeron_clock_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clock_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/concurrent_array_queue_benchmark"
+  "../../../../binaries/concurrent_array_queue_benchmark.pdb"
+  "CMakeFiles/concurrent_array_queue_benchmark.dir/aeron_concurrent_array_queue_benchmark.cpp.o"
+  "CMakeFiles/concurrent_array_queue_benchmark.dir/aeron_concurrent_array_queue_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/concurrent_array_queue_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
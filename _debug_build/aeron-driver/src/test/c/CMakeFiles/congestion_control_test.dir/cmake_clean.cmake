@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/congestion_control_test"
+  "../../../../binaries/congestion_control_test.pdb"
+  "CMakeFiles/congestion_control_test.dir/aeron_congestion_control_test.cpp.o"
+  "CMakeFiles/congestion_control_test.dir/aeron_congestion_control_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/congestion_control_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
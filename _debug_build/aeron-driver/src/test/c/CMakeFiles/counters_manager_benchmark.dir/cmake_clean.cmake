@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/counters_manager_benchmark"
+  "../../../../binaries/counters_manager_benchmark.pdb"
+  "CMakeFiles/counters_manager_benchmark.dir/aeron_counters_manager_benchmark.cpp.o"
+  "CMakeFiles/counters_manager_benchmark.dir/aeron_counters_manager_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/counters_manager_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/counters_manager_test"
+  "../../../../binaries/counters_manager_test.pdb"
+  "CMakeFiles/counters_manager_test.dir/aeron_counters_manager_test.cpp.o"
+  "CMakeFiles/counters_manager_test.dir/aeron_counters_manager_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/counters_manager_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
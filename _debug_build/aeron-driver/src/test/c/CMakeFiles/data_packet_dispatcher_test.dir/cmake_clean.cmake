@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/data_packet_dispatcher_test"
+  "../../../../binaries/data_packet_dispatcher_test.pdb"
+  "CMakeFiles/data_packet_dispatcher_test.dir/aeron_data_packet_dispatcher_test.cpp.o"
+  "CMakeFiles/data_packet_dispatcher_test.dir/aeron_data_packet_dispatcher_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/data_packet_dispatcher_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/deadline_timer_wheel_test"
+  "../../../../binaries/deadline_timer_wheel_test.pdb"
+  "CMakeFiles/deadline_timer_wheel_test.dir/collections/aeron_deadline_timer_wheel_test.cpp.o"
+  "CMakeFiles/deadline_timer_wheel_test.dir/collections/aeron_deadline_timer_wheel_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/deadline_timer_wheel_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/distinct_error_log_test"
+  "../../../../binaries/distinct_error_log_test.pdb"
+  "CMakeFiles/distinct_error_log_test.dir/aeron_distinct_error_log_test.cpp.o"
+  "CMakeFiles/distinct_error_log_test.dir/aeron_distinct_error_log_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/distinct_error_log_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/driver_agent_pcap_test"
+  "../../../../binaries/driver_agent_pcap_test.pdb"
+  "CMakeFiles/driver_agent_pcap_test.dir/__/__/main/c/agent/aeron_driver_agent_pcap.c.o"
+  "CMakeFiles/driver_agent_pcap_test.dir/__/__/main/c/agent/aeron_driver_agent_pcap.c.o.d"
+  "CMakeFiles/driver_agent_pcap_test.dir/aeron_driver_agent_pcap_test.cpp.o"
+  "CMakeFiles/driver_agent_pcap_test.dir/aeron_driver_agent_pcap_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/driver_agent_pcap_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/driver_conductor_ipc_test"
+  "../../../../binaries/driver_conductor_ipc_test.pdb"
+  "CMakeFiles/driver_conductor_ipc_test.dir/aeron_driver_conductor_ipc_test.cpp.o"
+  "CMakeFiles/driver_conductor_ipc_test.dir/aeron_driver_conductor_ipc_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/driver_conductor_ipc_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/driver_host_test"
+  "../../../../binaries/driver_host_test.pdb"
+  "CMakeFiles/driver_host_test.dir/aeron_driver_host_test.cpp.o"
+  "CMakeFiles/driver_host_test.dir/aeron_driver_host_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/driver_host_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
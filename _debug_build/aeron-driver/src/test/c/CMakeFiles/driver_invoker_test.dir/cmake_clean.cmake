@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/driver_invoker_test"
+  "../../../../binaries/driver_invoker_test.pdb"
+  "CMakeFiles/driver_invoker_test.dir/aeron_driver_invoker_test.cpp.o"
+  "CMakeFiles/driver_invoker_test.dir/aeron_driver_invoker_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/driver_invoker_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
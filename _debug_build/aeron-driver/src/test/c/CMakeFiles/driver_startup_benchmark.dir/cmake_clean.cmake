@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/driver_startup_benchmark"
+  "../../../../binaries/driver_startup_benchmark.pdb"
+  "CMakeFiles/driver_startup_benchmark.dir/aeron_driver_startup_benchmark.cpp.o"
+  "CMakeFiles/driver_startup_benchmark.dir/aeron_driver_startup_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/driver_startup_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
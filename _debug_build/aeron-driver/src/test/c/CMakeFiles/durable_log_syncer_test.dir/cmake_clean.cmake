@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/durable_log_syncer_test"
+  "../../../../binaries/durable_log_syncer_test.pdb"
+  "CMakeFiles/durable_log_syncer_test.dir/aeron_durable_log_syncer_test.cpp.o"
+  "CMakeFiles/durable_log_syncer_test.dir/aeron_durable_log_syncer_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/durable_log_syncer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/duty_cycle_tracker_test"
+  "../../../../binaries/duty_cycle_tracker_test.pdb"
+  "CMakeFiles/duty_cycle_tracker_test.dir/aeron_duty_cycle_tracker_test.cpp.o"
+  "CMakeFiles/duty_cycle_tracker_test.dir/aeron_duty_cycle_tracker_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duty_cycle_tracker_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/fec_test"
+  "../../../../binaries/fec_test.pdb"
+  "CMakeFiles/fec_test.dir/aeron_fec_test.cpp.o"
+  "CMakeFiles/fec_test.dir/aeron_fec_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fec_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
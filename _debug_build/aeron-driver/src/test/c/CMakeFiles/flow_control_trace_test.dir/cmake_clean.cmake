@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/flow_control_trace_test"
+  "../../../../binaries/flow_control_trace_test.pdb"
+  "CMakeFiles/flow_control_trace_test.dir/aeron_flow_control_trace_test.cpp.o"
+  "CMakeFiles/flow_control_trace_test.dir/aeron_flow_control_trace_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/flow_control_trace_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
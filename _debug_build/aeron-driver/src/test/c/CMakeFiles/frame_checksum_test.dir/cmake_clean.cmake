@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/frame_checksum_test"
+  "../../../../binaries/frame_checksum_test.pdb"
+  "CMakeFiles/frame_checksum_test.dir/aeron_frame_checksum_test.cpp.o"
+  "CMakeFiles/frame_checksum_test.dir/aeron_frame_checksum_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frame_checksum_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/int64_to_ptr_map_benchmark"
+  "../../../../binaries/int64_to_ptr_map_benchmark.pdb"
+  "CMakeFiles/int64_to_ptr_map_benchmark.dir/collections/aeron_int64_to_ptr_map_benchmark.cpp.o"
+  "CMakeFiles/int64_to_ptr_map_benchmark.dir/collections/aeron_int64_to_ptr_map_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/int64_to_ptr_map_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/int64_to_ptr_swiss_map_test"
+  "../../../../binaries/int64_to_ptr_swiss_map_test.pdb"
+  "CMakeFiles/int64_to_ptr_swiss_map_test.dir/collections/aeron_int64_to_ptr_swiss_map_test.cpp.o"
+  "CMakeFiles/int64_to_ptr_swiss_map_test.dir/collections/aeron_int64_to_ptr_swiss_map_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/int64_to_ptr_swiss_map_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/logbuffer_unblocker"
+  "../../../../binaries/logbuffer_unblocker.pdb"
+  "CMakeFiles/logbuffer_unblocker.dir/aeron_logbuffer_unblocker_test.cpp.o"
+  "CMakeFiles/logbuffer_unblocker.dir/aeron_logbuffer_unblocker_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logbuffer_unblocker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
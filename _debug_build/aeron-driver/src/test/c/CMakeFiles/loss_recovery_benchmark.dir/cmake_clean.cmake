@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/loss_recovery_benchmark"
+  "../../../../binaries/loss_recovery_benchmark.pdb"
+  "CMakeFiles/loss_recovery_benchmark.dir/aeron_loss_recovery_benchmark.cpp.o"
+  "CMakeFiles/loss_recovery_benchmark.dir/aeron_loss_recovery_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/loss_recovery_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/loss_reporter_test"
+  "../../../../binaries/loss_reporter_test.pdb"
+  "CMakeFiles/loss_reporter_test.dir/aeron_loss_reporter_test.cpp.o"
+  "CMakeFiles/loss_reporter_test.dir/aeron_loss_reporter_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/loss_reporter_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
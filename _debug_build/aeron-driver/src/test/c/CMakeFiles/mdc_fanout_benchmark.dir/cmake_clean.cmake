@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/mdc_fanout_benchmark"
+  "../../../../binaries/mdc_fanout_benchmark.pdb"
+  "CMakeFiles/mdc_fanout_benchmark.dir/aeron_mdc_fanout_benchmark.cpp.o"
+  "CMakeFiles/mdc_fanout_benchmark.dir/aeron_mdc_fanout_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mdc_fanout_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
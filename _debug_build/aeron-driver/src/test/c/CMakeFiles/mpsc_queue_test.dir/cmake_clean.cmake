@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/mpsc_queue_test"
+  "../../../../binaries/mpsc_queue_test.pdb"
+  "CMakeFiles/mpsc_queue_test.dir/aeron_mpsc_concurrent_array_queue_test.cpp.o"
+  "CMakeFiles/mpsc_queue_test.dir/aeron_mpsc_concurrent_array_queue_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpsc_queue_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
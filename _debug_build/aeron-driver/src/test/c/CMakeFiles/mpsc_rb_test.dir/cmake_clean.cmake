@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/mpsc_rb_test"
+  "../../../../binaries/mpsc_rb_test.pdb"
+  "CMakeFiles/mpsc_rb_test.dir/aeron_mpsc_rb_test.cpp.o"
+  "CMakeFiles/mpsc_rb_test.dir/aeron_mpsc_rb_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpsc_rb_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/network_publication_test"
+  "../../../../binaries/network_publication_test.pdb"
+  "CMakeFiles/network_publication_test.dir/aeron_network_publication_test.cpp.o"
+  "CMakeFiles/network_publication_test.dir/aeron_network_publication_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/network_publication_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
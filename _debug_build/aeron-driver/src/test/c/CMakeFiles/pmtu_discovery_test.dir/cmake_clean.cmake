@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/pmtu_discovery_test"
+  "../../../../binaries/pmtu_discovery_test.pdb"
+  "CMakeFiles/pmtu_discovery_test.dir/aeron_pmtu_discovery_test.cpp.o"
+  "CMakeFiles/pmtu_discovery_test.dir/aeron_pmtu_discovery_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pmtu_discovery_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/position_snapshot_test"
+  "../../../../binaries/position_snapshot_test.pdb"
+  "CMakeFiles/position_snapshot_test.dir/aeron_position_snapshot_test.cpp.o"
+  "CMakeFiles/position_snapshot_test.dir/aeron_position_snapshot_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/position_snapshot_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
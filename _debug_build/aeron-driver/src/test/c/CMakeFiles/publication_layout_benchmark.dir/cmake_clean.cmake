@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/publication_layout_benchmark"
+  "../../../../binaries/publication_layout_benchmark.pdb"
+  "CMakeFiles/publication_layout_benchmark.dir/aeron_publication_layout_benchmark.cpp.o"
+  "CMakeFiles/publication_layout_benchmark.dir/aeron_publication_layout_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/publication_layout_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
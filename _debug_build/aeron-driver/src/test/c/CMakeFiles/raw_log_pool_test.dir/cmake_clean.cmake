@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/raw_log_pool_test"
+  "../../../../binaries/raw_log_pool_test.pdb"
+  "CMakeFiles/raw_log_pool_test.dir/aeron_raw_log_pool_test.cpp.o"
+  "CMakeFiles/raw_log_pool_test.dir/aeron_raw_log_pool_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/raw_log_pool_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/rb_benchmark"
+  "../../../../binaries/rb_benchmark.pdb"
+  "CMakeFiles/rb_benchmark.dir/aeron_rb_benchmark.cpp.o"
+  "CMakeFiles/rb_benchmark.dir/aeron_rb_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rb_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/retransmit_handler_test"
+  "../../../../binaries/retransmit_handler_test.pdb"
+  "CMakeFiles/retransmit_handler_test.dir/aeron_retransmit_handler_test.cpp.o"
+  "CMakeFiles/retransmit_handler_test.dir/aeron_retransmit_handler_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/retransmit_handler_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
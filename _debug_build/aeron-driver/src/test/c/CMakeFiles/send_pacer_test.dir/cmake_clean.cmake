@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/send_pacer_test"
+  "../../../../binaries/send_pacer_test.pdb"
+  "CMakeFiles/send_pacer_test.dir/aeron_send_pacer_test.cpp.o"
+  "CMakeFiles/send_pacer_test.dir/aeron_send_pacer_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/send_pacer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/spsc_queue_test"
+  "../../../../binaries/spsc_queue_test.pdb"
+  "CMakeFiles/spsc_queue_test.dir/aeron_spsc_concurrent_array_queue_test.cpp.o"
+  "CMakeFiles/spsc_queue_test.dir/aeron_spsc_concurrent_array_queue_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spsc_queue_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/spsc_rb_test"
+  "../../../../binaries/spsc_rb_test.pdb"
+  "CMakeFiles/spsc_rb_test.dir/aeron_spsc_rb_test.cpp.o"
+  "CMakeFiles/spsc_rb_test.dir/aeron_spsc_rb_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spsc_rb_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/str_to_ptr_hash_map_benchmark"
+  "../../../../binaries/str_to_ptr_hash_map_benchmark.pdb"
+  "CMakeFiles/str_to_ptr_hash_map_benchmark.dir/collections/aeron_str_to_ptr_hash_map_benchmark.cpp.o"
+  "CMakeFiles/str_to_ptr_hash_map_benchmark.dir/collections/aeron_str_to_ptr_hash_map_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/str_to_ptr_hash_map_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/str_to_ptr_hash_map_test"
+  "../../../../binaries/str_to_ptr_hash_map_test.pdb"
+  "CMakeFiles/str_to_ptr_hash_map_test.dir/collections/aeron_str_to_ptr_hash_map_test.cpp.o"
+  "CMakeFiles/str_to_ptr_hash_map_test.dir/collections/aeron_str_to_ptr_hash_map_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/str_to_ptr_hash_map_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/stream_activity_test"
+  "../../../../binaries/stream_activity_test.pdb"
+  "CMakeFiles/stream_activity_test.dir/aeron_stream_activity_test.cpp.o"
+  "CMakeFiles/stream_activity_test.dir/aeron_stream_activity_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stream_activity_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
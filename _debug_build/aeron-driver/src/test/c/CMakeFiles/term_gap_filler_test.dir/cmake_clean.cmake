@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/term_gap_filler_test"
+  "../../../../binaries/term_gap_filler_test.pdb"
+  "CMakeFiles/term_gap_filler_test.dir/aeron_term_gap_filler_test.cpp.o"
+  "CMakeFiles/term_gap_filler_test.dir/aeron_term_gap_filler_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/term_gap_filler_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/term_rebuilder_benchmark"
+  "../../../../binaries/term_rebuilder_benchmark.pdb"
+  "CMakeFiles/term_rebuilder_benchmark.dir/aeron_term_rebuilder_benchmark.cpp.o"
+  "CMakeFiles/term_rebuilder_benchmark.dir/aeron_term_rebuilder_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/term_rebuilder_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
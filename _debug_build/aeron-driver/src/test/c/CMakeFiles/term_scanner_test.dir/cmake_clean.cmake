@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/term_scanner_test"
+  "../../../../binaries/term_scanner_test.pdb"
+  "CMakeFiles/term_scanner_test.dir/aeron_term_scanner_test.cpp.o"
+  "CMakeFiles/term_scanner_test.dir/aeron_term_scanner_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/term_scanner_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
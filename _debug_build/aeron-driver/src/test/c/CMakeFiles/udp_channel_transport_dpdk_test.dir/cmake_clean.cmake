@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/udp_channel_transport_dpdk_test"
+  "../../../../binaries/udp_channel_transport_dpdk_test.pdb"
+  "CMakeFiles/udp_channel_transport_dpdk_test.dir/aeron_udp_channel_transport_dpdk_test.cpp.o"
+  "CMakeFiles/udp_channel_transport_dpdk_test.dir/aeron_udp_channel_transport_dpdk_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/udp_channel_transport_dpdk_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/udp_destination_tracker_test"
+  "../../../../binaries/udp_destination_tracker_test.pdb"
+  "CMakeFiles/udp_destination_tracker_test.dir/aeron_udp_destination_tracker_test.cpp.o"
+  "CMakeFiles/udp_destination_tracker_test.dir/aeron_udp_destination_tracker_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/udp_destination_tracker_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
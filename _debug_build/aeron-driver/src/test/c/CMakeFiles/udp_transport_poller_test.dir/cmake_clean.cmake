@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/udp_transport_poller_test"
+  "../../../../binaries/udp_transport_poller_test.pdb"
+  "CMakeFiles/udp_transport_poller_test.dir/aeron_udp_transport_poller_test.cpp.o"
+  "CMakeFiles/udp_transport_poller_test.dir/aeron_udp_transport_poller_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/udp_transport_poller_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/uri_test"
+  "../../../../binaries/uri_test.pdb"
+  "CMakeFiles/uri_test.dir/aeron_uri_test.cpp.o"
+  "CMakeFiles/uri_test.dir/aeron_uri_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uri_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
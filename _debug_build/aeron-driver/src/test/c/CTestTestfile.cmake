@@ -0,0 +1,122 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/aeron-driver/src/test/c
+# Build directory: /root/repo/_debug_build/aeron-driver/src/test/c
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(spsc_rb_test "/root/repo/_debug_build/binaries/spsc_rb_test")
+set_tests_properties(spsc_rb_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;32;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(mpsc_rb_test "/root/repo/_debug_build/binaries/mpsc_rb_test")
+set_tests_properties(mpsc_rb_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;33;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(broadcast_transmitter_test "/root/repo/_debug_build/binaries/broadcast_transmitter_test")
+set_tests_properties(broadcast_transmitter_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;34;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(broadcast_receiver_test "/root/repo/_debug_build/binaries/broadcast_receiver_test")
+set_tests_properties(broadcast_receiver_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;35;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(counters_manager_test "/root/repo/_debug_build/binaries/counters_manager_test")
+set_tests_properties(counters_manager_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;36;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(distinct_error_log_test "/root/repo/_debug_build/binaries/distinct_error_log_test")
+set_tests_properties(distinct_error_log_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;37;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(driver_conductor_ipc_test "/root/repo/_debug_build/binaries/driver_conductor_ipc_test")
+set_tests_properties(driver_conductor_ipc_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;38;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(driver_conductor_network_test "/root/repo/_debug_build/binaries/driver_conductor_network_test")
+set_tests_properties(driver_conductor_network_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;39;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(driver_conductor_spy_test "/root/repo/_debug_build/binaries/driver_conductor_spy_test")
+set_tests_properties(driver_conductor_spy_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;40;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(driver_conductor_counter_test "/root/repo/_debug_build/binaries/driver_conductor_counter_test")
+set_tests_properties(driver_conductor_counter_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;41;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(data_packet_dispatcher_test "/root/repo/_debug_build/binaries/data_packet_dispatcher_test")
+set_tests_properties(data_packet_dispatcher_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;42;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(spsc_queue_test "/root/repo/_debug_build/binaries/spsc_queue_test")
+set_tests_properties(spsc_queue_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;43;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(mpsc_queue_test "/root/repo/_debug_build/binaries/mpsc_queue_test")
+set_tests_properties(mpsc_queue_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;44;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(uri_test "/root/repo/_debug_build/binaries/uri_test")
+set_tests_properties(uri_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;45;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(udp_channel_test "/root/repo/_debug_build/binaries/udp_channel_test")
+set_tests_properties(udp_channel_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;46;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(udp_transport_poller_test "/root/repo/_debug_build/binaries/udp_transport_poller_test")
+set_tests_properties(udp_transport_poller_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;47;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(udp_destination_tracker_test "/root/repo/_debug_build/binaries/udp_destination_tracker_test")
+set_tests_properties(udp_destination_tracker_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;48;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(udp_channel_transport_debug_test "/root/repo/_debug_build/binaries/udp_channel_transport_debug_test")
+set_tests_properties(udp_channel_transport_debug_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;49;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(udp_channel_transport_aes_gcm_test "/root/repo/_debug_build/binaries/udp_channel_transport_aes_gcm_test")
+set_tests_properties(udp_channel_transport_aes_gcm_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;50;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(udp_channel_transport_ibverbs_test "/root/repo/_debug_build/binaries/udp_channel_transport_ibverbs_test")
+set_tests_properties(udp_channel_transport_ibverbs_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;51;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(udp_channel_transport_dpdk_test "/root/repo/_debug_build/binaries/udp_channel_transport_dpdk_test")
+set_tests_properties(udp_channel_transport_dpdk_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;52;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(udp_channel_transport_shm_test "/root/repo/_debug_build/binaries/udp_channel_transport_shm_test")
+set_tests_properties(udp_channel_transport_shm_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;53;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(int64_to_ptr_hash_map_test "/root/repo/_debug_build/binaries/int64_to_ptr_hash_map_test")
+set_tests_properties(int64_to_ptr_hash_map_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;54;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(int64_to_ptr_swiss_map_test "/root/repo/_debug_build/binaries/int64_to_ptr_swiss_map_test")
+set_tests_properties(int64_to_ptr_swiss_map_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;55;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(str_to_ptr_hash_map_test "/root/repo/_debug_build/binaries/str_to_ptr_hash_map_test")
+set_tests_properties(str_to_ptr_hash_map_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;56;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(deadline_timer_wheel_test "/root/repo/_debug_build/binaries/deadline_timer_wheel_test")
+set_tests_properties(deadline_timer_wheel_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;57;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(term_scanner_test "/root/repo/_debug_build/binaries/term_scanner_test")
+set_tests_properties(term_scanner_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;58;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(term_gap_scanner_test "/root/repo/_debug_build/binaries/term_gap_scanner_test")
+set_tests_properties(term_gap_scanner_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;59;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(term_rebuilder_test "/root/repo/_debug_build/binaries/term_rebuilder_test")
+set_tests_properties(term_rebuilder_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;60;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(loss_detector_test "/root/repo/_debug_build/binaries/loss_detector_test")
+set_tests_properties(loss_detector_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;61;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(retransmit_handler_test "/root/repo/_debug_build/binaries/retransmit_handler_test")
+set_tests_properties(retransmit_handler_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;62;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(loss_reporter_test "/root/repo/_debug_build/binaries/loss_reporter_test")
+set_tests_properties(loss_reporter_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;63;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(flow_control_trace_test "/root/repo/_debug_build/binaries/flow_control_trace_test")
+set_tests_properties(flow_control_trace_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;64;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(position_snapshot_test "/root/repo/_debug_build/binaries/position_snapshot_test")
+set_tests_properties(position_snapshot_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;65;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(stream_activity_test "/root/repo/_debug_build/binaries/stream_activity_test")
+set_tests_properties(stream_activity_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;66;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(logbuffer_unblocker "/root/repo/_debug_build/binaries/logbuffer_unblocker")
+set_tests_properties(logbuffer_unblocker PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;67;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(term_gap_filler_test "/root/repo/_debug_build/binaries/term_gap_filler_test")
+set_tests_properties(term_gap_filler_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;68;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(raw_log_pool_test "/root/repo/_debug_build/binaries/raw_log_pool_test")
+set_tests_properties(raw_log_pool_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;69;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(durable_log_syncer_test "/root/repo/_debug_build/binaries/durable_log_syncer_test")
+set_tests_properties(durable_log_syncer_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;70;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(term_length_advisor_test "/root/repo/_debug_build/binaries/term_length_advisor_test")
+set_tests_properties(term_length_advisor_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;71;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(driver_command_pool_test "/root/repo/_debug_build/binaries/driver_command_pool_test")
+set_tests_properties(driver_command_pool_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;72;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(driver_invoker_test "/root/repo/_debug_build/binaries/driver_invoker_test")
+set_tests_properties(driver_invoker_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;73;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(driver_host_test "/root/repo/_debug_build/binaries/driver_host_test")
+set_tests_properties(driver_host_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;74;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(duty_cycle_tracker_test "/root/repo/_debug_build/binaries/duty_cycle_tracker_test")
+set_tests_properties(duty_cycle_tracker_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;75;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(clock_test "/root/repo/_debug_build/binaries/clock_test")
+set_tests_properties(clock_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;76;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(agent_test "/root/repo/_debug_build/binaries/agent_test")
+set_tests_properties(agent_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;77;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(congestion_control_test "/root/repo/_debug_build/binaries/congestion_control_test")
+set_tests_properties(congestion_control_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;78;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(flow_control_test "/root/repo/_debug_build/binaries/flow_control_test")
+set_tests_properties(flow_control_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;79;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(network_publication_test "/root/repo/_debug_build/binaries/network_publication_test")
+set_tests_properties(network_publication_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;80;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(send_pacer_test "/root/repo/_debug_build/binaries/send_pacer_test")
+set_tests_properties(send_pacer_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;81;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(pmtu_discovery_test "/root/repo/_debug_build/binaries/pmtu_discovery_test")
+set_tests_properties(pmtu_discovery_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;82;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(fec_test "/root/repo/_debug_build/binaries/fec_test")
+set_tests_properties(fec_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;83;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(frame_checksum_test "/root/repo/_debug_build/binaries/frame_checksum_test")
+set_tests_properties(frame_checksum_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;84;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(driver_agent_binary_log_test "/root/repo/_debug_build/binaries/driver_agent_binary_log_test")
+set_tests_properties(driver_agent_binary_log_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;85;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(driver_agent_pcap_test "/root/repo/_debug_build/binaries/driver_agent_pcap_test")
+set_tests_properties(driver_agent_pcap_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;87;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(c_client_test "/root/repo/_debug_build/binaries/c_client_test")
+set_tests_properties(c_client_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;89;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(archive_catalog_test "/root/repo/_debug_build/binaries/archive_catalog_test")
+set_tests_properties(archive_catalog_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;91;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
+add_test(archive_recorder_test "/root/repo/_debug_build/binaries/archive_recorder_test")
+set_tests_properties(archive_recorder_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/aeron-driver/src/test/c/CMakeLists.txt;29;add_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;93;aeron_driver_test;/root/repo/aeron-driver/src/test/c/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/AeronStat"
+  "../../../../binaries/AeronStat.pdb"
+  "CMakeFiles/AeronStat.dir/AeronStat.cpp.o"
+  "CMakeFiles/AeronStat.dir/AeronStat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AeronStat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
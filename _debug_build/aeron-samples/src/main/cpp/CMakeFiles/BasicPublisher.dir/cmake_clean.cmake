@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/BasicPublisher"
+  "../../../../binaries/BasicPublisher.pdb"
+  "CMakeFiles/BasicPublisher.dir/BasicPublisher.cpp.o"
+  "CMakeFiles/BasicPublisher.dir/BasicPublisher.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BasicPublisher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
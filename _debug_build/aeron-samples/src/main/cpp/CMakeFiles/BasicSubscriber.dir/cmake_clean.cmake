@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/BasicSubscriber"
+  "../../../../binaries/BasicSubscriber.pdb"
+  "CMakeFiles/BasicSubscriber.dir/BasicSubscriber.cpp.o"
+  "CMakeFiles/BasicSubscriber.dir/BasicSubscriber.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BasicSubscriber.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
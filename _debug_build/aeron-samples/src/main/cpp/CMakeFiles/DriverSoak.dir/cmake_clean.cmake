@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/DriverSoak"
+  "../../../../binaries/DriverSoak.pdb"
+  "CMakeFiles/DriverSoak.dir/DriverSoak.cpp.o"
+  "CMakeFiles/DriverSoak.dir/DriverSoak.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DriverSoak.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/ErrorStat"
+  "../../../../binaries/ErrorStat.pdb"
+  "CMakeFiles/ErrorStat.dir/ErrorStat.cpp.o"
+  "CMakeFiles/ErrorStat.dir/ErrorStat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ErrorStat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
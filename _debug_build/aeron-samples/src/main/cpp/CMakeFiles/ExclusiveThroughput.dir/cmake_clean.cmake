@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/ExclusiveThroughput"
+  "../../../../binaries/ExclusiveThroughput.pdb"
+  "CMakeFiles/ExclusiveThroughput.dir/ExclusiveThroughput.cpp.o"
+  "CMakeFiles/ExclusiveThroughput.dir/ExclusiveThroughput.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ExclusiveThroughput.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/FlowControlStat"
+  "../../../../binaries/FlowControlStat.pdb"
+  "CMakeFiles/FlowControlStat.dir/FlowControlStat.cpp.o"
+  "CMakeFiles/FlowControlStat.dir/FlowControlStat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FlowControlStat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/LossStat"
+  "../../../../binaries/LossStat.pdb"
+  "CMakeFiles/LossStat.dir/LossStat.cpp.o"
+  "CMakeFiles/LossStat.dir/LossStat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LossStat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
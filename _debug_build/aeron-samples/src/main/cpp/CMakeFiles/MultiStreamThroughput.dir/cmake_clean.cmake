@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/MultiStreamThroughput"
+  "../../../../binaries/MultiStreamThroughput.pdb"
+  "CMakeFiles/MultiStreamThroughput.dir/MultiStreamThroughput.cpp.o"
+  "CMakeFiles/MultiStreamThroughput.dir/MultiStreamThroughput.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MultiStreamThroughput.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/Ping"
+  "../../../../binaries/Ping.pdb"
+  "CMakeFiles/Ping.dir/Ping.cpp.o"
+  "CMakeFiles/Ping.dir/Ping.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Ping.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/PingPong"
+  "../../../../binaries/PingPong.pdb"
+  "CMakeFiles/PingPong.dir/PingPong.cpp.o"
+  "CMakeFiles/PingPong.dir/PingPong.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PingPong.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
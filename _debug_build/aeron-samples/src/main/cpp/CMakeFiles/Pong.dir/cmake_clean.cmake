@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/Pong"
+  "../../../../binaries/Pong.pdb"
+  "CMakeFiles/Pong.dir/Pong.cpp.o"
+  "CMakeFiles/Pong.dir/Pong.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Pong.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/PositionStat"
+  "../../../../binaries/PositionStat.pdb"
+  "CMakeFiles/PositionStat.dir/PositionStat.cpp.o"
+  "CMakeFiles/PositionStat.dir/PositionStat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PositionStat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
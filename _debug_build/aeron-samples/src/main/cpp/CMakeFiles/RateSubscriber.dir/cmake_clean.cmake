@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/RateSubscriber"
+  "../../../../binaries/RateSubscriber.pdb"
+  "CMakeFiles/RateSubscriber.dir/RateSubscriber.cpp.o"
+  "CMakeFiles/RateSubscriber.dir/RateSubscriber.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RateSubscriber.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/StreamingPublisher"
+  "../../../../binaries/StreamingPublisher.pdb"
+  "CMakeFiles/StreamingPublisher.dir/StreamingPublisher.cpp.o"
+  "CMakeFiles/StreamingPublisher.dir/StreamingPublisher.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StreamingPublisher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
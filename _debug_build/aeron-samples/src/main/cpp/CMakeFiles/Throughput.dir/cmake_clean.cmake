@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/Throughput"
+  "../../../../binaries/Throughput.pdb"
+  "CMakeFiles/Throughput.dir/Throughput.cpp.o"
+  "CMakeFiles/Throughput.dir/Throughput.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Throughput.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
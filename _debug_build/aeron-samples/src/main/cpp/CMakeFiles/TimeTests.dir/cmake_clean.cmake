@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../binaries/TimeTests"
+  "../../../../binaries/TimeTests.pdb"
+  "CMakeFiles/TimeTests.dir/raw/TimeTests.cpp.o"
+  "CMakeFiles/TimeTests.dir/raw/TimeTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TimeTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/_debug_build/gmock-prefix/src/gmock
+# Build directory: /root/repo/_debug_build/gmock-prefix/src/gmock-build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("googlemock")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gmock_main.dir/__/googletest/src/gtest-all.cc.o"
+  "CMakeFiles/gmock_main.dir/__/googletest/src/gtest-all.cc.o.d"
+  "CMakeFiles/gmock_main.dir/src/gmock-all.cc.o"
+  "CMakeFiles/gmock_main.dir/src/gmock-all.cc.o.d"
+  "CMakeFiles/gmock_main.dir/src/gmock_main.cc.o"
+  "CMakeFiles/gmock_main.dir/src/gmock_main.cc.o.d"
+  "libgmock_main.a"
+  "libgmock_main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmock_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
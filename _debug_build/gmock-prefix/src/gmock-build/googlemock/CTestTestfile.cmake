@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/_debug_build/gmock-prefix/src/gmock/googlemock
+# Build directory: /root/repo/_debug_build/gmock-prefix/src/gmock-build/googlemock
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("gtest")
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_debug_build/gmock-prefix/src/gmock"
+  "/root/repo/_debug_build/gmock-prefix/src/gmock-build"
+  "/root/repo/_debug_build/gmock-prefix"
+  "/root/repo/_debug_build/gmock-prefix/tmp"
+  "/root/repo/_debug_build/gmock-prefix/src/gmock-stamp"
+  "/root/repo/_debug_build/gmock-prefix/src"
+  "/root/repo/_debug_build/gmock-prefix/src/gmock-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_debug_build/gmock-prefix/src/gmock-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_debug_build/gmock-prefix/src/gmock-stamp${cfgdir}") # cfgdir has leading slash
+endif()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark
+# Build directory: /root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark-build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src")
+subdirs("test")
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/benchmark.cc" "src/CMakeFiles/benchmark.dir/benchmark.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/benchmark.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/benchmark_register.cc" "src/CMakeFiles/benchmark.dir/benchmark_register.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/benchmark_register.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/colorprint.cc" "src/CMakeFiles/benchmark.dir/colorprint.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/colorprint.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/commandlineflags.cc" "src/CMakeFiles/benchmark.dir/commandlineflags.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/commandlineflags.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/complexity.cc" "src/CMakeFiles/benchmark.dir/complexity.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/complexity.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/console_reporter.cc" "src/CMakeFiles/benchmark.dir/console_reporter.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/console_reporter.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/csv_reporter.cc" "src/CMakeFiles/benchmark.dir/csv_reporter.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/csv_reporter.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/json_reporter.cc" "src/CMakeFiles/benchmark.dir/json_reporter.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/json_reporter.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/reporter.cc" "src/CMakeFiles/benchmark.dir/reporter.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/reporter.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/sleep.cc" "src/CMakeFiles/benchmark.dir/sleep.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/sleep.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/string_util.cc" "src/CMakeFiles/benchmark.dir/string_util.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/string_util.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/sysinfo.cc" "src/CMakeFiles/benchmark.dir/sysinfo.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/sysinfo.cc.o.d"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/src/timers.cc" "src/CMakeFiles/benchmark.dir/timers.cc.o" "gcc" "src/CMakeFiles/benchmark.dir/timers.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
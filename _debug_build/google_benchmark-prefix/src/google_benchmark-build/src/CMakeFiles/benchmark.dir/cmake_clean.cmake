@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark.dir/benchmark.cc.o"
+  "CMakeFiles/benchmark.dir/benchmark.cc.o.d"
+  "CMakeFiles/benchmark.dir/benchmark_register.cc.o"
+  "CMakeFiles/benchmark.dir/benchmark_register.cc.o.d"
+  "CMakeFiles/benchmark.dir/colorprint.cc.o"
+  "CMakeFiles/benchmark.dir/colorprint.cc.o.d"
+  "CMakeFiles/benchmark.dir/commandlineflags.cc.o"
+  "CMakeFiles/benchmark.dir/commandlineflags.cc.o.d"
+  "CMakeFiles/benchmark.dir/complexity.cc.o"
+  "CMakeFiles/benchmark.dir/complexity.cc.o.d"
+  "CMakeFiles/benchmark.dir/console_reporter.cc.o"
+  "CMakeFiles/benchmark.dir/console_reporter.cc.o.d"
+  "CMakeFiles/benchmark.dir/csv_reporter.cc.o"
+  "CMakeFiles/benchmark.dir/csv_reporter.cc.o.d"
+  "CMakeFiles/benchmark.dir/json_reporter.cc.o"
+  "CMakeFiles/benchmark.dir/json_reporter.cc.o.d"
+  "CMakeFiles/benchmark.dir/reporter.cc.o"
+  "CMakeFiles/benchmark.dir/reporter.cc.o.d"
+  "CMakeFiles/benchmark.dir/sleep.cc.o"
+  "CMakeFiles/benchmark.dir/sleep.cc.o.d"
+  "CMakeFiles/benchmark.dir/string_util.cc.o"
+  "CMakeFiles/benchmark.dir/string_util.cc.o.d"
+  "CMakeFiles/benchmark.dir/sysinfo.cc.o"
+  "CMakeFiles/benchmark.dir/sysinfo.cc.o.d"
+  "CMakeFiles/benchmark.dir/timers.cc.o"
+  "CMakeFiles/benchmark.dir/timers.cc.o.d"
+  "libbenchmark.a"
+  "libbenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basic_test.dir/basic_test.cc.o"
+  "CMakeFiles/basic_test.dir/basic_test.cc.o.d"
+  "basic_test"
+  "basic_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basic_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
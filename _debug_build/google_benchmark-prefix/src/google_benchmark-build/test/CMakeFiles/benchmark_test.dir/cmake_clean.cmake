@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_test.dir/benchmark_test.cc.o"
+  "CMakeFiles/benchmark_test.dir/benchmark_test.cc.o.d"
+  "benchmark_test"
+  "benchmark_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/complexity_test.cc" "test/CMakeFiles/complexity_test.dir/complexity_test.cc.o" "gcc" "test/CMakeFiles/complexity_test.dir/complexity_test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark-build/test/CMakeFiles/output_test_helper.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark-build/src/CMakeFiles/benchmark.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cxx03_test.dir/cxx03_test.cc.o"
+  "CMakeFiles/cxx03_test.dir/cxx03_test.cc.o.d"
+  "cxx03_test"
+  "cxx03_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cxx03_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/donotoptimize_test.dir/donotoptimize_test.cc.o"
+  "CMakeFiles/donotoptimize_test.dir/donotoptimize_test.cc.o.d"
+  "donotoptimize_test"
+  "donotoptimize_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/donotoptimize_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
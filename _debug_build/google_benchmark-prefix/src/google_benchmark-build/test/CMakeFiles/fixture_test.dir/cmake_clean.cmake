@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fixture_test.dir/fixture_test.cc.o"
+  "CMakeFiles/fixture_test.dir/fixture_test.cc.o.d"
+  "fixture_test"
+  "fixture_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fixture_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
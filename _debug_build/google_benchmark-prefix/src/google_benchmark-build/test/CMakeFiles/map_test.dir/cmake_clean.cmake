@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_test.dir/map_test.cc.o"
+  "CMakeFiles/map_test.dir/map_test.cc.o.d"
+  "map_test"
+  "map_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multiple_ranges_test.dir/multiple_ranges_test.cc.o"
+  "CMakeFiles/multiple_ranges_test.dir/multiple_ranges_test.cc.o.d"
+  "multiple_ranges_test"
+  "multiple_ranges_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/multiple_ranges_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/options_test.dir/options_test.cc.o"
+  "CMakeFiles/options_test.dir/options_test.cc.o.d"
+  "options_test"
+  "options_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/options_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
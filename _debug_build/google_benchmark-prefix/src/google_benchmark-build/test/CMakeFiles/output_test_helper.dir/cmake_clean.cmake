@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/output_test_helper.dir/output_test_helper.cc.o"
+  "CMakeFiles/output_test_helper.dir/output_test_helper.cc.o.d"
+  "liboutput_test_helper.a"
+  "liboutput_test_helper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/output_test_helper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
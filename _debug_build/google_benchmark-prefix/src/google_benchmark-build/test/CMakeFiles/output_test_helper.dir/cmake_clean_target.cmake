@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "liboutput_test_helper.a"
+)
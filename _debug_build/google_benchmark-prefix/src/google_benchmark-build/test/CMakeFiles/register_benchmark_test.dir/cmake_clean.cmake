@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/register_benchmark_test.dir/register_benchmark_test.cc.o"
+  "CMakeFiles/register_benchmark_test.dir/register_benchmark_test.cc.o.d"
+  "register_benchmark_test"
+  "register_benchmark_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/register_benchmark_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
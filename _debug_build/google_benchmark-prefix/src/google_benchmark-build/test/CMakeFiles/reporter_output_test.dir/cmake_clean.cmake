@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reporter_output_test.dir/reporter_output_test.cc.o"
+  "CMakeFiles/reporter_output_test.dir/reporter_output_test.cc.o.d"
+  "reporter_output_test"
+  "reporter_output_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reporter_output_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
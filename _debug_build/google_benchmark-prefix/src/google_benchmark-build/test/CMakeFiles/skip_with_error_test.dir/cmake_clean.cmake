@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/skip_with_error_test.dir/skip_with_error_test.cc.o"
+  "CMakeFiles/skip_with_error_test.dir/skip_with_error_test.cc.o.d"
+  "skip_with_error_test"
+  "skip_with_error_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/skip_with_error_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
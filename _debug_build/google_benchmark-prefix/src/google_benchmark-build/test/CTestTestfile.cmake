@@ -0,0 +1,68 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test
+# Build directory: /root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark-build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(benchmark "benchmark_test" "--benchmark_min_time=0.01")
+set_tests_properties(benchmark PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;28;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_simple "filter_test" "--benchmark_min_time=0.01" "--benchmark_filter=Foo" "3")
+set_tests_properties(filter_simple PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;32;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;36;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_simple_list_only "filter_test" "--benchmark_list_tests" "--benchmark_filter=Foo" "3")
+set_tests_properties(filter_simple_list_only PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;33;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;36;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_suffix "filter_test" "--benchmark_min_time=0.01" "--benchmark_filter=BM_.*" "4")
+set_tests_properties(filter_suffix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;32;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;37;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_suffix_list_only "filter_test" "--benchmark_list_tests" "--benchmark_filter=BM_.*" "4")
+set_tests_properties(filter_suffix_list_only PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;33;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;37;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_all "filter_test" "--benchmark_min_time=0.01" "--benchmark_filter=.*" "5")
+set_tests_properties(filter_regex_all PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;32;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;38;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_all_list_only "filter_test" "--benchmark_list_tests" "--benchmark_filter=.*" "5")
+set_tests_properties(filter_regex_all_list_only PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;33;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;38;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_blank "filter_test" "--benchmark_min_time=0.01" "--benchmark_filter=" "5")
+set_tests_properties(filter_regex_blank PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;32;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;39;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_blank_list_only "filter_test" "--benchmark_list_tests" "--benchmark_filter=" "5")
+set_tests_properties(filter_regex_blank_list_only PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;33;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;39;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_none "filter_test" "--benchmark_min_time=0.01" "--benchmark_filter=monkey" "0")
+set_tests_properties(filter_regex_none PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;32;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;40;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_none_list_only "filter_test" "--benchmark_list_tests" "--benchmark_filter=monkey" "0")
+set_tests_properties(filter_regex_none_list_only PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;33;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;40;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_wildcard "filter_test" "--benchmark_min_time=0.01" "--benchmark_filter=.*Foo.*" "3")
+set_tests_properties(filter_regex_wildcard PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;32;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;41;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_wildcard_list_only "filter_test" "--benchmark_list_tests" "--benchmark_filter=.*Foo.*" "3")
+set_tests_properties(filter_regex_wildcard_list_only PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;33;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;41;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_begin "filter_test" "--benchmark_min_time=0.01" "--benchmark_filter=^BM_.*" "4")
+set_tests_properties(filter_regex_begin PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;32;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;42;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_begin_list_only "filter_test" "--benchmark_list_tests" "--benchmark_filter=^BM_.*" "4")
+set_tests_properties(filter_regex_begin_list_only PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;33;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;42;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_begin2 "filter_test" "--benchmark_min_time=0.01" "--benchmark_filter=^N" "1")
+set_tests_properties(filter_regex_begin2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;32;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;43;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_begin2_list_only "filter_test" "--benchmark_list_tests" "--benchmark_filter=^N" "1")
+set_tests_properties(filter_regex_begin2_list_only PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;33;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;43;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_end "filter_test" "--benchmark_min_time=0.01" "--benchmark_filter=.*Ba$" "1")
+set_tests_properties(filter_regex_end PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;32;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;44;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(filter_regex_end_list_only "filter_test" "--benchmark_list_tests" "--benchmark_filter=.*Ba$" "1")
+set_tests_properties(filter_regex_end_list_only PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;33;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;44;add_filter_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(options_benchmarks "options_test" "--benchmark_min_time=0.01")
+set_tests_properties(options_benchmarks PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;47;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(basic_benchmark "basic_test" "--benchmark_min_time=0.01")
+set_tests_properties(basic_benchmark PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;50;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(diagnostics_test "diagnostics_test" "--benchmark_min_time=0.01")
+set_tests_properties(diagnostics_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;53;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(skip_with_error_test "skip_with_error_test" "--benchmark_min_time=0.01")
+set_tests_properties(skip_with_error_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;56;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(donotoptimize_test "donotoptimize_test" "--benchmark_min_time=0.01")
+set_tests_properties(donotoptimize_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;59;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(fixture_test "fixture_test" "--benchmark_min_time=0.01")
+set_tests_properties(fixture_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;62;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(register_benchmark_test "register_benchmark_test" "--benchmark_min_time=0.01")
+set_tests_properties(register_benchmark_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;65;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(map_test "map_test" "--benchmark_min_time=0.01")
+set_tests_properties(map_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;68;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(multiple_ranges_test "multiple_ranges_test" "--benchmark_min_time=0.01")
+set_tests_properties(multiple_ranges_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;71;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(reporter_output_test "reporter_output_test" "--benchmark_min_time=0.01")
+set_tests_properties(reporter_output_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;74;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(cxx03 "cxx03_test" "--benchmark_min_time=0.01")
+set_tests_properties(cxx03 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;85;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
+add_test(complexity_benchmark "complexity_test" "--benchmark_min_time=0.01")
+set_tests_properties(complexity_benchmark PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;95;add_test;/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark/test/CMakeLists.txt;0;")
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark-build"
+  "/root/repo/_debug_build/google_benchmark-prefix"
+  "/root/repo/_debug_build/google_benchmark-prefix/tmp"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark-stamp"
+  "/root/repo/_debug_build/google_benchmark-prefix/src"
+  "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_debug_build/google_benchmark-prefix/src/google_benchmark-stamp${cfgdir}") # cfgdir has leading slash
+endif()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram
+# Build directory: /root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram-build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src")
+subdirs("test")
+subdirs("examples")
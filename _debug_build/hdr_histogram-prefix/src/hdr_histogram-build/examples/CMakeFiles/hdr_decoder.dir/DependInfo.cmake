@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram/examples/hdr_decoder.c" "examples/CMakeFiles/hdr_decoder.dir/hdr_decoder.c.o" "gcc" "examples/CMakeFiles/hdr_decoder.dir/hdr_decoder.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram-build/src/CMakeFiles/hdr_histogram.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdr_decoder.dir/hdr_decoder.c.o"
+  "CMakeFiles/hdr_decoder.dir/hdr_decoder.c.o.d"
+  "hdr_decoder"
+  "hdr_decoder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdr_decoder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hiccup.dir/hiccup.c.o"
+  "CMakeFiles/hiccup.dir/hiccup.c.o.d"
+  "hiccup"
+  "hiccup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hiccup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdr_histogram.dir/hdr_encoding.c.o"
+  "CMakeFiles/hdr_histogram.dir/hdr_encoding.c.o.d"
+  "CMakeFiles/hdr_histogram.dir/hdr_histogram.c.o"
+  "CMakeFiles/hdr_histogram.dir/hdr_histogram.c.o.d"
+  "CMakeFiles/hdr_histogram.dir/hdr_histogram_log.c.o"
+  "CMakeFiles/hdr_histogram.dir/hdr_histogram_log.c.o.d"
+  "CMakeFiles/hdr_histogram.dir/hdr_interval_recorder.c.o"
+  "CMakeFiles/hdr_histogram.dir/hdr_interval_recorder.c.o.d"
+  "CMakeFiles/hdr_histogram.dir/hdr_thread.c.o"
+  "CMakeFiles/hdr_histogram.dir/hdr_thread.c.o.d"
+  "CMakeFiles/hdr_histogram.dir/hdr_time.c.o"
+  "CMakeFiles/hdr_histogram.dir/hdr_time.c.o.d"
+  "CMakeFiles/hdr_histogram.dir/hdr_writer_reader_phaser.c.o"
+  "CMakeFiles/hdr_histogram.dir/hdr_writer_reader_phaser.c.o.d"
+  "libhdr_histogram.pdb"
+  "libhdr_histogram.so"
+  "libhdr_histogram.so.1"
+  "libhdr_histogram.so.1.0.2"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdr_histogram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
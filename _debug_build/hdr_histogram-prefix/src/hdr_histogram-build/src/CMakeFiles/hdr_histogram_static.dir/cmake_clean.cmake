@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdr_histogram_static.dir/hdr_encoding.c.o"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_encoding.c.o.d"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_histogram.c.o"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_histogram.c.o.d"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_histogram_log.c.o"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_histogram_log.c.o.d"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_interval_recorder.c.o"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_interval_recorder.c.o.d"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_thread.c.o"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_thread.c.o.d"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_time.c.o"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_time.c.o.d"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_writer_reader_phaser.c.o"
+  "CMakeFiles/hdr_histogram_static.dir/hdr_writer_reader_phaser.c.o.d"
+  "libhdr_histogram_static.a"
+  "libhdr_histogram_static.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdr_histogram_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
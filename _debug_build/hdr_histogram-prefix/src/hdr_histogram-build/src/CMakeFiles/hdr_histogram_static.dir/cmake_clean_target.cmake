@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libhdr_histogram_static.a"
+)
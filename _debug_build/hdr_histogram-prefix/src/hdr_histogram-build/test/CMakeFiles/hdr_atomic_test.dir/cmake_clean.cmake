@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdr_atomic_test.dir/hdr_atomic_test.c.o"
+  "CMakeFiles/hdr_atomic_test.dir/hdr_atomic_test.c.o.d"
+  "CMakeFiles/hdr_atomic_test.dir/minunit.c.o"
+  "CMakeFiles/hdr_atomic_test.dir/minunit.c.o.d"
+  "hdr_atomic_test"
+  "hdr_atomic_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdr_atomic_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdr_histogram_log_test.dir/hdr_histogram_log_test.c.o"
+  "CMakeFiles/hdr_histogram_log_test.dir/hdr_histogram_log_test.c.o.d"
+  "CMakeFiles/hdr_histogram_log_test.dir/minunit.c.o"
+  "CMakeFiles/hdr_histogram_log_test.dir/minunit.c.o.d"
+  "hdr_histogram_log_test"
+  "hdr_histogram_log_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdr_histogram_log_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
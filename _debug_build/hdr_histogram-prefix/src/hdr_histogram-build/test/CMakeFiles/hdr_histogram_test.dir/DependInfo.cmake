@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram/test/hdr_histogram_test.c" "test/CMakeFiles/hdr_histogram_test.dir/hdr_histogram_test.c.o" "gcc" "test/CMakeFiles/hdr_histogram_test.dir/hdr_histogram_test.c.o.d"
+  "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram/test/minunit.c" "test/CMakeFiles/hdr_histogram_test.dir/minunit.c.o" "gcc" "test/CMakeFiles/hdr_histogram_test.dir/minunit.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram-build/src/CMakeFiles/hdr_histogram_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perftest.dir/hdr_histogram_perf.c.o"
+  "CMakeFiles/perftest.dir/hdr_histogram_perf.c.o.d"
+  "perftest"
+  "perftest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/perftest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
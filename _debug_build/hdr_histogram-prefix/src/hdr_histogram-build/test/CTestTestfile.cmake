@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram/test
+# Build directory: /root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram-build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Histogram "hdr_histogram_test")
+set_tests_properties(Histogram PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram/test/CMakeLists.txt;34;add_test;/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram/test/CMakeLists.txt;0;")
+add_test(HistogramLogging "hdr_histogram_log_test")
+set_tests_properties(HistogramLogging PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram/test/CMakeLists.txt;35;add_test;/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram/test/CMakeLists.txt;0;")
+add_test(HistogramAtomic "hdr_atomic_test")
+set_tests_properties(HistogramAtomic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram/test/CMakeLists.txt;36;add_test;/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram/test/CMakeLists.txt;0;")
@@ -0,0 +1,37 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+if("/root/repo/cppbuild/HdrHistogram_c.zip" STREQUAL "")
+  message(FATAL_ERROR "LOCAL can't be empty")
+endif()
+
+if(NOT EXISTS "/root/repo/cppbuild/HdrHistogram_c.zip")
+  message(FATAL_ERROR "File not found: /root/repo/cppbuild/HdrHistogram_c.zip")
+endif()
+
+if("MD5" STREQUAL "")
+  message(WARNING "File will not be verified since no URL_HASH specified")
+  return()
+endif()
+
+if("8d1d6c6df1ee8342c180529a89568081" STREQUAL "")
+  message(FATAL_ERROR "EXPECT_VALUE can't be empty")
+endif()
+
+message(STATUS "verifying file...
+     file='/root/repo/cppbuild/HdrHistogram_c.zip'")
+
+file("MD5" "/root/repo/cppbuild/HdrHistogram_c.zip" actual_value)
+
+if(NOT "${actual_value}" STREQUAL "8d1d6c6df1ee8342c180529a89568081")
+  message(FATAL_ERROR "error: MD5 hash of
+  /root/repo/cppbuild/HdrHistogram_c.zip
+does not match expected value
+  expected: '8d1d6c6df1ee8342c180529a89568081'
+    actual: '${actual_value}'
+")
+endif()
+
+message(STATUS "verifying file... done")
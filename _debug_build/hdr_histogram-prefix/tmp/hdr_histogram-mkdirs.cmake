@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram"
+  "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram-build"
+  "/root/repo/_debug_build/hdr_histogram-prefix"
+  "/root/repo/_debug_build/hdr_histogram-prefix/tmp"
+  "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram-stamp"
+  "/root/repo/_debug_build/hdr_histogram-prefix/src"
+  "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_debug_build/hdr_histogram-prefix/src/hdr_histogram-stamp${cfgdir}") # cfgdir has leading slash
+endif()
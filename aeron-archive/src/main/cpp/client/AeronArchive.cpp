@@ -0,0 +1,523 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include "AeronArchive.h"
+
+using namespace aeron;
+using namespace aeron::archive::client;
+using namespace aeron::archive::codecs;
+
+static std::int64_t nanoTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static const char *codeName(ControlResponseCode code)
+{
+    switch (code)
+    {
+        case ControlResponseCode::OK:
+            return "OK";
+
+        case ControlResponseCode::ERROR:
+            return "ERROR";
+
+        case ControlResponseCode::RECORDING_UNKNOWN:
+            return "RECORDING_UNKNOWN";
+    }
+
+    return "UNKNOWN";
+}
+
+AeronArchive::AeronArchive(const Context& context) :
+    m_ctx(context)
+{
+    m_ctx.conclude();
+    m_aeron = m_ctx.aeron();
+    m_messageTimeoutNs = m_ctx.messageTimeoutNs();
+
+    m_subscription = awaitResource<Subscription>(
+        m_aeron->addSubscription(m_ctx.controlResponseChannel(), m_ctx.controlResponseStreamId()),
+        [this](std::int64_t id) { return m_aeron->findSubscription(id); });
+    m_controlResponsePoller.reset(new ControlResponsePoller(m_subscription, FRAGMENT_LIMIT));
+
+    m_publication = awaitResource<ExclusivePublication>(
+        m_aeron->addExclusivePublication(m_ctx.controlRequestChannel(), m_ctx.controlRequestStreamId()),
+        [this](std::int64_t id) { return m_aeron->findExclusivePublication(id); });
+    m_archiveProxy.reset(new ArchiveProxy(m_publication, m_messageTimeoutNs));
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->connect(
+        m_ctx.controlResponseChannel(),
+        m_ctx.controlResponseStreamId(),
+        correlationId,
+        [this]() { invokeAeronClient(); }))
+    {
+        throw ArchiveException("cannot connect to aeron archive: " + m_ctx.controlRequestChannel(), SOURCEINFO);
+    }
+
+    m_controlSessionId = awaitSessionOpened(correlationId);
+    m_recordingDescriptorPoller.reset(
+        new RecordingDescriptorPoller(m_subscription, FRAGMENT_LIMIT, m_controlSessionId));
+}
+
+AeronArchive::~AeronArchive()
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    try
+    {
+        m_archiveProxy->closeSession(m_controlSessionId);
+    }
+    catch (const std::exception&)
+    {
+        // the archive may already be gone, the session is closed on its side when the publication goes away
+    }
+}
+
+bool AeronArchive::pollForErrorResponse(std::string& errorMessage)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    if (m_controlResponsePoller->poll() != 0 && m_controlResponsePoller->isPollComplete())
+    {
+        if (m_controlResponsePoller->isControlResponse() &&
+            ControlResponseCode::ERROR == m_controlResponsePoller->code())
+        {
+            errorMessage = m_controlResponsePoller->errorMessage();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void AeronArchive::checkForErrorResponse()
+{
+    std::string errorMessage;
+
+    if (pollForErrorResponse(errorMessage))
+    {
+        throw ArchiveException(errorMessage, SOURCEINFO);
+    }
+}
+
+std::shared_ptr<Publication> AeronArchive::addRecordedPublication(const std::string& channel, std::int32_t streamId)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    std::shared_ptr<Publication> publication = awaitResource<Publication>(
+        m_aeron->addPublication(channel, streamId),
+        [this](std::int64_t id) { return m_aeron->findPublication(id); });
+
+    if (!publication->isOriginal())
+    {
+        throw ArchiveException(
+            "publication already added for channel=" + channel + " streamId=" + std::to_string(streamId), SOURCEINFO);
+    }
+
+    startRecording(ChannelUri::addSessionId(channel, publication->sessionId()), streamId, SourceLocation::LOCAL);
+
+    return publication;
+}
+
+std::shared_ptr<ExclusivePublication> AeronArchive::addRecordedExclusivePublication(
+    const std::string& channel, std::int32_t streamId)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    std::shared_ptr<ExclusivePublication> publication = awaitResource<ExclusivePublication>(
+        m_aeron->addExclusivePublication(channel, streamId),
+        [this](std::int64_t id) { return m_aeron->findExclusivePublication(id); });
+
+    startRecording(ChannelUri::addSessionId(channel, publication->sessionId()), streamId, SourceLocation::LOCAL);
+
+    return publication;
+}
+
+std::int64_t AeronArchive::startRecording(
+    const std::string& channel, std::int32_t streamId, SourceLocation sourceLocation)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->startRecording(channel, streamId, sourceLocation, correlationId, m_controlSessionId))
+    {
+        throw ArchiveException("failed to send start recording request", SOURCEINFO);
+    }
+
+    pollForResponse(correlationId);
+
+    return correlationId;
+}
+
+std::int64_t AeronArchive::extendRecording(
+    std::int64_t recordingId, const std::string& channel, std::int32_t streamId, SourceLocation sourceLocation)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->extendRecording(
+        channel, streamId, sourceLocation, recordingId, correlationId, m_controlSessionId))
+    {
+        throw ArchiveException("failed to send extend recording request", SOURCEINFO);
+    }
+
+    pollForResponse(correlationId);
+
+    return correlationId;
+}
+
+void AeronArchive::stopRecording(const std::string& channel, std::int32_t streamId)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->stopRecording(channel, streamId, correlationId, m_controlSessionId))
+    {
+        throw ArchiveException("failed to send stop recording request", SOURCEINFO);
+    }
+
+    pollForResponse(correlationId);
+}
+
+void AeronArchive::stopRecording(const Publication& publication)
+{
+    stopRecording(ChannelUri::addSessionId(publication.channel(), publication.sessionId()), publication.streamId());
+}
+
+void AeronArchive::stopRecording(const ExclusivePublication& publication)
+{
+    stopRecording(ChannelUri::addSessionId(publication.channel(), publication.sessionId()), publication.streamId());
+}
+
+std::int64_t AeronArchive::startReplay(
+    std::int64_t recordingId,
+    std::int64_t position,
+    std::int64_t length,
+    const std::string& replayChannel,
+    std::int32_t replayStreamId)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->replay(
+        recordingId, position, length, replayChannel, replayStreamId, correlationId, m_controlSessionId))
+    {
+        throw ArchiveException("failed to send replay request", SOURCEINFO);
+    }
+
+    return pollForResponse(correlationId);
+}
+
+void AeronArchive::stopReplay(std::int64_t replaySessionId)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->stopReplay(replaySessionId, correlationId, m_controlSessionId))
+    {
+        throw ArchiveException("failed to send stop replay request", SOURCEINFO);
+    }
+
+    pollForResponse(correlationId);
+}
+
+std::shared_ptr<Subscription> AeronArchive::replay(
+    std::int64_t recordingId,
+    std::int64_t position,
+    std::int64_t length,
+    const std::string& replayChannel,
+    std::int32_t replayStreamId)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t replaySessionId = startReplay(recordingId, position, length, replayChannel, replayStreamId);
+    const std::string channel = ChannelUri::addSessionId(replayChannel, static_cast<std::int32_t>(replaySessionId));
+
+    return awaitResource<Subscription>(
+        m_aeron->addSubscription(channel, replayStreamId),
+        [this](std::int64_t id) { return m_aeron->findSubscription(id); });
+}
+
+std::int32_t AeronArchive::listRecordings(
+    std::int64_t fromRecordingId, std::int32_t recordCount, const recording_descriptor_consumer_t& consumer)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->listRecordings(fromRecordingId, recordCount, correlationId, m_controlSessionId))
+    {
+        throw ArchiveException("failed to send list recordings request", SOURCEINFO);
+    }
+
+    return pollForDescriptors(correlationId, recordCount, consumer);
+}
+
+std::int32_t AeronArchive::listRecordingsForUri(
+    std::int64_t fromRecordingId,
+    std::int32_t recordCount,
+    const std::string& channel,
+    std::int32_t streamId,
+    const recording_descriptor_consumer_t& consumer)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->listRecordingsForUri(
+        fromRecordingId, recordCount, channel, streamId, correlationId, m_controlSessionId))
+    {
+        throw ArchiveException("failed to send list recordings for uri request", SOURCEINFO);
+    }
+
+    return pollForDescriptors(correlationId, recordCount, consumer);
+}
+
+std::int32_t AeronArchive::listRecording(std::int64_t recordingId, const recording_descriptor_consumer_t& consumer)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->listRecording(recordingId, correlationId, m_controlSessionId))
+    {
+        throw ArchiveException("failed to send list recording request", SOURCEINFO);
+    }
+
+    return pollForDescriptors(correlationId, 1, consumer);
+}
+
+std::int64_t AeronArchive::getRecordingPosition(std::int64_t recordingId)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->getRecordingPosition(recordingId, correlationId, m_controlSessionId))
+    {
+        throw ArchiveException("failed to send get recording position request", SOURCEINFO);
+    }
+
+    return pollForResponse(correlationId);
+}
+
+void AeronArchive::truncateRecording(std::int64_t recordingId, std::int64_t position)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    if (!m_archiveProxy->truncateRecording(recordingId, position, correlationId, m_controlSessionId))
+    {
+        throw ArchiveException("failed to send truncate recording request", SOURCEINFO);
+    }
+
+    pollForResponse(correlationId);
+}
+
+void AeronArchive::idle()
+{
+    m_idleStrategy.idle();
+    invokeAeronClient();
+}
+
+void AeronArchive::invokeAeronClient()
+{
+    AgentInvoker<ClientConductor>& invoker = m_aeron->conductorAgentInvoker();
+
+    if (invoker.isStarted())
+    {
+        invoker.invoke();
+    }
+}
+
+template<typename Resource, typename Find>
+std::shared_ptr<Resource> AeronArchive::awaitResource(std::int64_t registrationId, Find&& find)
+{
+    const std::int64_t deadlineNs = nanoTime() + m_messageTimeoutNs;
+    m_idleStrategy.reset();
+
+    while (true)
+    {
+        std::shared_ptr<Resource> resource = find(registrationId);
+        if (nullptr != resource)
+        {
+            return resource;
+        }
+
+        if (nanoTime() > deadlineNs)
+        {
+            throw TimeoutException(
+                "media driver did not add resource: registrationId=" + std::to_string(registrationId), SOURCEINFO);
+        }
+
+        idle();
+    }
+}
+
+std::int64_t AeronArchive::awaitSessionOpened(std::int64_t correlationId)
+{
+    const std::int64_t deadlineNs = nanoTime() + m_messageTimeoutNs;
+    ControlResponsePoller& poller = *m_controlResponsePoller;
+
+    m_idleStrategy.reset();
+    while (!poller.subscription()->isConnected())
+    {
+        if (nanoTime() > deadlineNs)
+        {
+            throw TimeoutException("failed to establish response connection", SOURCEINFO);
+        }
+
+        idle();
+    }
+
+    while (true)
+    {
+        pollNextResponse(correlationId, deadlineNs);
+
+        if (poller.correlationId() != correlationId || !poller.isControlResponse())
+        {
+            invokeAeronClient();
+            continue;
+        }
+
+        const ControlResponseCode code = poller.code();
+        if (ControlResponseCode::OK != code)
+        {
+            if (ControlResponseCode::ERROR == code)
+            {
+                throw ArchiveException("error: " + poller.errorMessage(), SOURCEINFO);
+            }
+
+            throw ArchiveException(std::string("unexpected response: code=") + codeName(code), SOURCEINFO);
+        }
+
+        return poller.controlSessionId();
+    }
+}
+
+void AeronArchive::pollNextResponse(std::int64_t correlationId, std::int64_t deadlineNs)
+{
+    ControlResponsePoller& poller = *m_controlResponsePoller;
+
+    m_idleStrategy.reset();
+    while (true)
+    {
+        const int fragments = poller.poll();
+        if (poller.isPollComplete())
+        {
+            break;
+        }
+
+        if (fragments > 0)
+        {
+            continue;
+        }
+
+        if (!poller.subscription()->isConnected())
+        {
+            throw ArchiveException("subscription to archive is not connected", SOURCEINFO);
+        }
+
+        if (nanoTime() > deadlineNs)
+        {
+            throw TimeoutException(
+                "awaiting response for correlationId=" + std::to_string(correlationId), SOURCEINFO);
+        }
+
+        idle();
+    }
+}
+
+std::int64_t AeronArchive::pollForResponse(std::int64_t correlationId)
+{
+    const std::int64_t deadlineNs = nanoTime() + m_messageTimeoutNs;
+    ControlResponsePoller& poller = *m_controlResponsePoller;
+
+    while (true)
+    {
+        pollNextResponse(correlationId, deadlineNs);
+
+        if (poller.controlSessionId() != m_controlSessionId || !poller.isControlResponse())
+        {
+            invokeAeronClient();
+            continue;
+        }
+
+        if (ControlResponseCode::ERROR == poller.code())
+        {
+            throw ArchiveException(
+                "response for correlationId=" + std::to_string(correlationId) + ", error: " + poller.errorMessage(),
+                SOURCEINFO);
+        }
+
+        if (ControlResponseCode::OK != poller.code())
+        {
+            throw ArchiveException(
+                std::string("unexpected response code: ") + codeName(poller.code()), SOURCEINFO);
+        }
+
+        if (poller.correlationId() == correlationId)
+        {
+            return poller.relevantId();
+        }
+    }
+}
+
+std::int32_t AeronArchive::pollForDescriptors(
+    std::int64_t correlationId, std::int32_t recordCount, const recording_descriptor_consumer_t& consumer)
+{
+    const std::int64_t deadlineNs = nanoTime() + m_messageTimeoutNs;
+    RecordingDescriptorPoller& poller = *m_recordingDescriptorPoller;
+
+    poller.reset(correlationId, recordCount, consumer);
+    m_idleStrategy.reset();
+
+    while (true)
+    {
+        const int fragments = poller.poll();
+        if (poller.isDispatchComplete())
+        {
+            if (poller.hasError())
+            {
+                throw ArchiveException(
+                    "response for correlationId=" + std::to_string(correlationId) + ", error: " +
+                    poller.errorMessage(), SOURCEINFO);
+            }
+
+            return recordCount - poller.remainingRecordCount();
+        }
+
+        invokeAeronClient();
+
+        if (fragments > 0)
+        {
+            continue;
+        }
+
+        if (!poller.subscription()->isConnected())
+        {
+            throw ArchiveException("subscription to archive is not connected", SOURCEINFO);
+        }
+
+        if (nanoTime() > deadlineNs)
+        {
+            throw TimeoutException(
+                "awaiting recording descriptors: correlationId=" + std::to_string(correlationId), SOURCEINFO);
+        }
+
+        m_idleStrategy.idle();
+    }
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_ARCHIVE_CLIENT_AERON_ARCHIVE__
+#define INCLUDED_AERON_ARCHIVE_CLIENT_AERON_ARCHIVE__
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <Aeron.h>
+#include <concurrent/BackoffIdleStrategy.h>
+#include "ArchiveConfiguration.h"
+#include "ArchiveException.h"
+#include "ArchiveProxy.h"
+#include "ControlResponsePoller.h"
+#include "RecordingDescriptorPoller.h"
+
+/// Client for the Aeron Archive
+namespace aeron { namespace archive { namespace client {
+
+/**
+ * Client for interacting with a local or remote Aeron Archive, a port of the Java AeronArchive.
+ * <p>
+ * Requests are sent on an exclusive publication to the archive and each call waits, up to the message timeout, for
+ * the response with its correlation id on the control response subscription. Calls are serialised with a lock so an
+ * instance may be shared between threads. Errors from the archive are thrown as {@link ArchiveException} and
+ * timeouts as {@link TimeoutException}.
+ * <p>
+ * When the Aeron client uses an AgentInvoker for its conductor it is invoked while waiting.
+ */
+class AeronArchive
+{
+public:
+    static const std::int64_t NULL_TIMESTAMP = -1;
+    static const std::int64_t NULL_POSITION = -1;
+    static const int FRAGMENT_LIMIT = 10;
+
+    /**
+     * Connect to an archive, blocking until the control session is open.
+     *
+     * @param context for configuration of the client.
+     * @return the connected archive client.
+     */
+    inline static std::shared_ptr<AeronArchive> connect(const Context& context)
+    {
+        return std::make_shared<AeronArchive>(context);
+    }
+
+    inline static std::shared_ptr<AeronArchive> connect()
+    {
+        return connect(Context());
+    }
+
+    explicit AeronArchive(const Context& context);
+
+    /**
+     * Close the control session and release the publication and subscription.
+     */
+    ~AeronArchive();
+
+    AeronArchive(const AeronArchive&) = delete;
+    AeronArchive& operator=(const AeronArchive&) = delete;
+
+    inline const Context& context() const
+    {
+        return m_ctx;
+    }
+
+    inline std::int64_t controlSessionId() const
+    {
+        return m_controlSessionId;
+    }
+
+    inline ArchiveProxy& archiveProxy()
+    {
+        return *m_archiveProxy;
+    }
+
+    inline ControlResponsePoller& controlResponsePoller()
+    {
+        return *m_controlResponsePoller;
+    }
+
+    inline RecordingDescriptorPoller& recordingDescriptorPoller()
+    {
+        return *m_recordingDescriptorPoller;
+    }
+
+    /**
+     * Poll once for an asynchronous error response, e.g. to a recording that failed after it started.
+     *
+     * @param errorMessage set to the error message when an error response was read.
+     * @return true if an error response was read.
+     */
+    bool pollForErrorResponse(std::string& errorMessage);
+
+    /**
+     * Poll once for an asynchronous error response and throw it as an ArchiveException.
+     */
+    void checkForErrorResponse();
+
+    /**
+     * Add a publication and start recording it, with its session id added to the channel so only it is recorded.
+     *
+     * @return the publication, which must be the original for the channel and stream.
+     */
+    std::shared_ptr<Publication> addRecordedPublication(const std::string& channel, std::int32_t streamId);
+
+    /**
+     * Add an exclusive publication and start recording it, with its session id added to the channel.
+     */
+    std::shared_ptr<ExclusivePublication> addRecordedExclusivePublication(
+        const std::string& channel, std::int32_t streamId);
+
+    /**
+     * Start recording a channel and stream.
+     *
+     * @return the correlation id of the request, which identifies the recording subscription in the archive.
+     */
+    std::int64_t startRecording(
+        const std::string& channel, std::int32_t streamId, codecs::SourceLocation sourceLocation);
+
+    /**
+     * Extend an existing, stopped, recording with a channel and stream.
+     *
+     * @return the correlation id of the request.
+     */
+    std::int64_t extendRecording(
+        std::int64_t recordingId,
+        const std::string& channel,
+        std::int32_t streamId,
+        codecs::SourceLocation sourceLocation);
+
+    void stopRecording(const std::string& channel, std::int32_t streamId);
+
+    void stopRecording(const Publication& publication);
+
+    void stopRecording(const ExclusivePublication& publication);
+
+    /**
+     * Start a replay of a recording to a channel and stream.
+     *
+     * @param recordingId    to replay.
+     * @param position       from which to replay.
+     * @param length         to replay, or INT64_MAX to follow a live recording.
+     * @param replayChannel  to which the replay should be sent.
+     * @param replayStreamId to which the replay should be sent.
+     * @return the id of the replay session, whose low 32 bits are the session id of the replay image.
+     */
+    std::int64_t startReplay(
+        std::int64_t recordingId,
+        std::int64_t position,
+        std::int64_t length,
+        const std::string& replayChannel,
+        std::int32_t replayStreamId);
+
+    void stopReplay(std::int64_t replaySessionId);
+
+    /**
+     * Start a replay and add a subscription to it, restricted to the session id of the replay.
+     *
+     * @return the subscription for the replay.
+     */
+    std::shared_ptr<Subscription> replay(
+        std::int64_t recordingId,
+        std::int64_t position,
+        std::int64_t length,
+        const std::string& replayChannel,
+        std::int32_t replayStreamId);
+
+    /**
+     * List recordings from a recording id.
+     *
+     * @return the number of descriptors consumed.
+     */
+    std::int32_t listRecordings(
+        std::int64_t fromRecordingId, std::int32_t recordCount, const recording_descriptor_consumer_t& consumer);
+
+    /**
+     * List recordings from a recording id which match a channel and stream.
+     *
+     * @return the number of descriptors consumed.
+     */
+    std::int32_t listRecordingsForUri(
+        std::int64_t fromRecordingId,
+        std::int32_t recordCount,
+        const std::string& channel,
+        std::int32_t streamId,
+        const recording_descriptor_consumer_t& consumer);
+
+    /**
+     * List a single recording.
+     *
+     * @return 1 if the recording was found, otherwise 0.
+     */
+    std::int32_t listRecording(std::int64_t recordingId, const recording_descriptor_consumer_t& consumer);
+
+    /**
+     * Get the position recorded so far for an active recording.
+     *
+     * @return the recorded position, or NULL_POSITION if the recording is not active.
+     */
+    std::int64_t getRecordingPosition(std::int64_t recordingId);
+
+    /**
+     * Truncate a stopped recording to a position.
+     */
+    void truncateRecording(std::int64_t recordingId, std::int64_t position);
+
+private:
+    Context m_ctx;
+    std::shared_ptr<Aeron> m_aeron;
+    std::int64_t m_messageTimeoutNs;
+    std::recursive_mutex m_lock;
+    concurrent::BackoffIdleStrategy m_idleStrategy;
+    std::shared_ptr<Subscription> m_subscription;
+    std::shared_ptr<ExclusivePublication> m_publication;
+    std::unique_ptr<ControlResponsePoller> m_controlResponsePoller;
+    std::unique_ptr<ArchiveProxy> m_archiveProxy;
+    std::unique_ptr<RecordingDescriptorPoller> m_recordingDescriptorPoller;
+    std::int64_t m_controlSessionId = -1;
+
+    void idle();
+    void invokeAeronClient();
+    std::int64_t awaitSessionOpened(std::int64_t correlationId);
+    void pollNextResponse(std::int64_t correlationId, std::int64_t deadlineNs);
+    std::int64_t pollForResponse(std::int64_t correlationId);
+    std::int32_t pollForDescriptors(
+        std::int64_t correlationId, std::int32_t recordCount, const recording_descriptor_consumer_t& consumer);
+
+    template<typename Resource, typename Find>
+    std::shared_ptr<Resource> awaitResource(std::int64_t registrationId, Find&& find);
+};
+
+}}}
+
+#endif
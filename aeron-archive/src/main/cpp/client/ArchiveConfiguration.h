@@ -0,0 +1,244 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_ARCHIVE_CLIENT_ARCHIVE_CONFIGURATION__
+#define INCLUDED_AERON_ARCHIVE_CLIENT_ARCHIVE_CONFIGURATION__
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <Aeron.h>
+#include "ChannelUri.h"
+
+namespace aeron { namespace archive { namespace client {
+
+/**
+ * Defaults for the archive client, matching the Java AeronArchive.Configuration.
+ */
+namespace Configuration {
+
+static const std::int64_t MESSAGE_TIMEOUT_DEFAULT_NS = 5 * 1000 * 1000 * 1000LL;
+
+static const char *const CONTROL_CHANNEL_DEFAULT = "aeron:udp?endpoint=localhost:8010";
+static const std::int32_t CONTROL_STREAM_ID_DEFAULT = 10;
+
+static const char *const LOCAL_CONTROL_CHANNEL_DEFAULT = "aeron:ipc";
+static const std::int32_t LOCAL_CONTROL_STREAM_ID_DEFAULT = 11;
+
+static const char *const CONTROL_RESPONSE_CHANNEL_DEFAULT = "aeron:udp?endpoint=localhost:8020";
+static const std::int32_t CONTROL_RESPONSE_STREAM_ID_DEFAULT = 20;
+
+static const std::int32_t CONTROL_TERM_BUFFER_LENGTH_DEFAULT = 64 * 1024;
+static const std::int32_t CONTROL_MTU_LENGTH_DEFAULT = 4 * 1024;
+
+}
+
+/**
+ * Configuration for an {@link AeronArchive} client.
+ * <p>
+ * If no Aeron client is supplied one is connected, using the aeron directory, when the archive client connects and
+ * is closed with it. A supplied Aeron client is shared and left open.
+ */
+class Context
+{
+public:
+    using this_t = Context;
+
+    /// @cond HIDDEN_SYMBOLS
+    this_t& conclude()
+    {
+        if (nullptr == m_aeron)
+        {
+            m_aeronContext.aeronDir(m_aeronDirectoryName);
+            m_aeron = Aeron::connect(m_aeronContext);
+            m_ownsAeronClient = true;
+        }
+
+        m_controlRequestChannel = ChannelUri::putParam(
+            m_controlRequestChannel, ChannelUri::TERM_LENGTH_PARAM_NAME, std::to_string(m_controlTermBufferLength));
+        m_controlRequestChannel = ChannelUri::putParam(
+            m_controlRequestChannel, ChannelUri::MTU_LENGTH_PARAM_NAME, std::to_string(m_controlMtuLength));
+
+        return *this;
+    }
+    /// @endcond
+
+    /**
+     * Set the timeout to wait for a response from the archive to a request.
+     *
+     * @param timeoutNs to wait for a response.
+     * @return reference to this Context instance
+     */
+    inline this_t& messageTimeoutNs(std::int64_t timeoutNs)
+    {
+        m_messageTimeoutNs = timeoutNs;
+        return *this;
+    }
+
+    inline std::int64_t messageTimeoutNs() const
+    {
+        return m_messageTimeoutNs;
+    }
+
+    /**
+     * Set the channel on which requests are sent to the archive.
+     *
+     * @param channel for control requests.
+     * @return reference to this Context instance
+     */
+    inline this_t& controlRequestChannel(const std::string& channel)
+    {
+        m_controlRequestChannel = channel;
+        return *this;
+    }
+
+    inline const std::string& controlRequestChannel() const
+    {
+        return m_controlRequestChannel;
+    }
+
+    inline this_t& controlRequestStreamId(std::int32_t streamId)
+    {
+        m_controlRequestStreamId = streamId;
+        return *this;
+    }
+
+    inline std::int32_t controlRequestStreamId() const
+    {
+        return m_controlRequestStreamId;
+    }
+
+    /**
+     * Set the channel on which the archive sends responses to this client. It must be reachable from the archive.
+     *
+     * @param channel for control responses.
+     * @return reference to this Context instance
+     */
+    inline this_t& controlResponseChannel(const std::string& channel)
+    {
+        m_controlResponseChannel = channel;
+        return *this;
+    }
+
+    inline const std::string& controlResponseChannel() const
+    {
+        return m_controlResponseChannel;
+    }
+
+    inline this_t& controlResponseStreamId(std::int32_t streamId)
+    {
+        m_controlResponseStreamId = streamId;
+        return *this;
+    }
+
+    inline std::int32_t controlResponseStreamId() const
+    {
+        return m_controlResponseStreamId;
+    }
+
+    /**
+     * Set the term buffer length of the control request publication.
+     *
+     * @param length of the term buffers.
+     * @return reference to this Context instance
+     */
+    inline this_t& controlTermBufferLength(std::int32_t length)
+    {
+        m_controlTermBufferLength = length;
+        return *this;
+    }
+
+    inline std::int32_t controlTermBufferLength() const
+    {
+        return m_controlTermBufferLength;
+    }
+
+    /**
+     * Set the MTU length of the control request publication.
+     *
+     * @param length of the MTU.
+     * @return reference to this Context instance
+     */
+    inline this_t& controlMtuLength(std::int32_t length)
+    {
+        m_controlMtuLength = length;
+        return *this;
+    }
+
+    inline std::int32_t controlMtuLength() const
+    {
+        return m_controlMtuLength;
+    }
+
+    /**
+     * Set the directory of the media driver used when no Aeron client is supplied.
+     *
+     * @param directory of the media driver.
+     * @return reference to this Context instance
+     */
+    inline this_t& aeronDirectoryName(const std::string& directory)
+    {
+        m_aeronDirectoryName = directory;
+        return *this;
+    }
+
+    inline const std::string& aeronDirectoryName() const
+    {
+        return m_aeronDirectoryName;
+    }
+
+    /**
+     * Supply the Aeron client to use. It is not closed when the archive client is closed.
+     *
+     * @param aeron client to use.
+     * @return reference to this Context instance
+     */
+    inline this_t& aeron(std::shared_ptr<Aeron> aeron)
+    {
+        m_aeron = std::move(aeron);
+        m_ownsAeronClient = false;
+        return *this;
+    }
+
+    inline std::shared_ptr<Aeron> aeron() const
+    {
+        return m_aeron;
+    }
+
+    inline bool ownsAeronClient() const
+    {
+        return m_ownsAeronClient;
+    }
+
+private:
+    std::int64_t m_messageTimeoutNs = Configuration::MESSAGE_TIMEOUT_DEFAULT_NS;
+    std::string m_controlRequestChannel = Configuration::CONTROL_CHANNEL_DEFAULT;
+    std::int32_t m_controlRequestStreamId = Configuration::CONTROL_STREAM_ID_DEFAULT;
+    std::string m_controlResponseChannel = Configuration::CONTROL_RESPONSE_CHANNEL_DEFAULT;
+    std::int32_t m_controlResponseStreamId = Configuration::CONTROL_RESPONSE_STREAM_ID_DEFAULT;
+    std::int32_t m_controlTermBufferLength = Configuration::CONTROL_TERM_BUFFER_LENGTH_DEFAULT;
+    std::int32_t m_controlMtuLength = Configuration::CONTROL_MTU_LENGTH_DEFAULT;
+    std::string m_aeronDirectoryName = aeron::Context::defaultAeronPath();
+
+    /* an Aeron client keeps a reference to its context so this must outlive m_aeron, which is declared after it */
+    aeron::Context m_aeronContext;
+    std::shared_ptr<Aeron> m_aeron;
+    bool m_ownsAeronClient = false;
+};
+
+}}}
+
+#endif
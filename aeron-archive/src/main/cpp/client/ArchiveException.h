@@ -0,0 +1,36 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_ARCHIVE_CLIENT_ARCHIVE_EXCEPTION__
+#define INCLUDED_AERON_ARCHIVE_CLIENT_ARCHIVE_EXCEPTION__
+
+#include <util/Exceptions.h>
+
+namespace aeron { namespace archive { namespace client {
+
+/**
+ * An error response from the archive, or a failure to communicate with it.
+ */
+DECLARE_SOURCED_EXCEPTION (ArchiveException);
+
+/**
+ * The archive did not respond, or a connection to it could not be established, within the message timeout.
+ */
+DECLARE_SOURCED_EXCEPTION (TimeoutException);
+
+}}}
+
+#endif
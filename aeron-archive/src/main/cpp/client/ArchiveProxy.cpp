@@ -0,0 +1,313 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include "ArchiveProxy.h"
+#include "ArchiveException.h"
+
+using namespace aeron;
+using namespace aeron::archive::client;
+using namespace aeron::archive::codecs;
+
+static std::int64_t nanoTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static util::index_t varLength(const std::string& value)
+{
+    return static_cast<util::index_t>(value.length());
+}
+
+ArchiveProxy::ArchiveProxy(
+    std::shared_ptr<ExclusivePublication> publication, std::int64_t connectTimeoutNs, int retryAttempts) :
+    m_publication(std::move(publication)),
+    m_connectTimeoutNs(connectTimeoutNs),
+    m_retryAttempts(retryAttempts),
+    m_storage(INITIAL_BUFFER_LENGTH),
+    m_buffer(m_storage.data(), m_storage.size())
+{
+}
+
+concurrent::AtomicBuffer& ArchiveProxy::buffer(util::index_t length)
+{
+    if (static_cast<std::size_t>(length) > m_storage.size())
+    {
+        m_storage.resize(static_cast<std::size_t>(length));
+        m_buffer.wrap(m_storage.data(), m_storage.size());
+    }
+
+    return m_buffer;
+}
+
+bool ArchiveProxy::connect(
+    const std::string& responseChannel,
+    std::int32_t responseStreamId,
+    std::int64_t correlationId,
+    const on_idle_t& onIdle)
+{
+    ConnectRequest request;
+    request
+        .wrapAndApplyHeader(buffer(ConnectRequest::computeLength(varLength(responseChannel), 1)), 0)
+        .putVarAscii(responseChannel);
+    request.block().correlationId = correlationId;
+    request.block().responseStreamId = responseStreamId;
+
+    return offerWithTimeout(request.encodedLength(), onIdle);
+}
+
+bool ArchiveProxy::closeSession(std::int64_t controlSessionId)
+{
+    CloseSessionRequest request;
+    request.wrapAndApplyHeader(buffer(CloseSessionRequest::computeLength(0, 0)), 0);
+    request.block().controlSessionId = controlSessionId;
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::startRecording(
+    const std::string& channel,
+    std::int32_t streamId,
+    SourceLocation sourceLocation,
+    std::int64_t correlationId,
+    std::int64_t controlSessionId)
+{
+    StartRecordingRequest request;
+    request
+        .wrapAndApplyHeader(buffer(StartRecordingRequest::computeLength(varLength(channel), 1)), 0)
+        .putVarAscii(channel);
+    request.block().controlSessionId = controlSessionId;
+    request.block().correlationId = correlationId;
+    request.block().streamId = streamId;
+    request.block().sourceLocation = static_cast<std::uint8_t>(sourceLocation);
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::stopRecording(
+    const std::string& channel, std::int32_t streamId, std::int64_t correlationId, std::int64_t controlSessionId)
+{
+    StopRecordingRequest request;
+    request
+        .wrapAndApplyHeader(buffer(StopRecordingRequest::computeLength(varLength(channel), 1)), 0)
+        .putVarAscii(channel);
+    request.block().controlSessionId = controlSessionId;
+    request.block().correlationId = correlationId;
+    request.block().streamId = streamId;
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::replay(
+    std::int64_t recordingId,
+    std::int64_t position,
+    std::int64_t length,
+    const std::string& replayChannel,
+    std::int32_t replayStreamId,
+    std::int64_t correlationId,
+    std::int64_t controlSessionId)
+{
+    ReplayRequest request;
+    request
+        .wrapAndApplyHeader(buffer(ReplayRequest::computeLength(varLength(replayChannel), 1)), 0)
+        .putVarAscii(replayChannel);
+    request.block().controlSessionId = controlSessionId;
+    request.block().correlationId = correlationId;
+    request.block().recordingId = recordingId;
+    request.block().position = position;
+    request.block().length = length;
+    request.block().replayStreamId = replayStreamId;
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::stopReplay(std::int64_t replaySessionId, std::int64_t correlationId, std::int64_t controlSessionId)
+{
+    StopReplayRequest request;
+    request.wrapAndApplyHeader(buffer(StopReplayRequest::computeLength(0, 0)), 0);
+    request.block().controlSessionId = controlSessionId;
+    request.block().correlationId = correlationId;
+    request.block().replaySessionId = replaySessionId;
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::listRecordings(
+    std::int64_t fromRecordingId,
+    std::int32_t recordCount,
+    std::int64_t correlationId,
+    std::int64_t controlSessionId)
+{
+    ListRecordingsRequest request;
+    request.wrapAndApplyHeader(buffer(ListRecordingsRequest::computeLength(0, 0)), 0);
+    request.block().controlSessionId = controlSessionId;
+    request.block().correlationId = correlationId;
+    request.block().fromRecordingId = fromRecordingId;
+    request.block().recordCount = recordCount;
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::listRecordingsForUri(
+    std::int64_t fromRecordingId,
+    std::int32_t recordCount,
+    const std::string& channel,
+    std::int32_t streamId,
+    std::int64_t correlationId,
+    std::int64_t controlSessionId)
+{
+    ListRecordingsForUriRequest request;
+    request
+        .wrapAndApplyHeader(buffer(ListRecordingsForUriRequest::computeLength(varLength(channel), 1)), 0)
+        .putVarAscii(channel);
+    request.block().controlSessionId = controlSessionId;
+    request.block().correlationId = correlationId;
+    request.block().fromRecordingId = fromRecordingId;
+    request.block().recordCount = recordCount;
+    request.block().streamId = streamId;
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::listRecording(std::int64_t recordingId, std::int64_t correlationId, std::int64_t controlSessionId)
+{
+    ListRecordingRequest request;
+    request.wrapAndApplyHeader(buffer(ListRecordingRequest::computeLength(0, 0)), 0);
+    request.block().controlSessionId = controlSessionId;
+    request.block().correlationId = correlationId;
+    request.block().recordingId = recordingId;
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::extendRecording(
+    const std::string& channel,
+    std::int32_t streamId,
+    SourceLocation sourceLocation,
+    std::int64_t recordingId,
+    std::int64_t correlationId,
+    std::int64_t controlSessionId)
+{
+    ExtendRecordingRequest request;
+    request
+        .wrapAndApplyHeader(buffer(ExtendRecordingRequest::computeLength(varLength(channel), 1)), 0)
+        .putVarAscii(channel);
+    request.block().controlSessionId = controlSessionId;
+    request.block().correlationId = correlationId;
+    request.block().recordingId = recordingId;
+    request.block().streamId = streamId;
+    request.block().sourceLocation = static_cast<std::uint8_t>(sourceLocation);
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::getRecordingPosition(
+    std::int64_t recordingId, std::int64_t correlationId, std::int64_t controlSessionId)
+{
+    RecordingPositionRequest request;
+    request.wrapAndApplyHeader(buffer(RecordingPositionRequest::computeLength(0, 0)), 0);
+    request.block().controlSessionId = controlSessionId;
+    request.block().correlationId = correlationId;
+    request.block().recordingId = recordingId;
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::truncateRecording(
+    std::int64_t recordingId, std::int64_t position, std::int64_t correlationId, std::int64_t controlSessionId)
+{
+    TruncateRecordingRequest request;
+    request.wrapAndApplyHeader(buffer(TruncateRecordingRequest::computeLength(0, 0)), 0);
+    request.block().controlSessionId = controlSessionId;
+    request.block().correlationId = correlationId;
+    request.block().recordingId = recordingId;
+    request.block().position = position;
+
+    return offer(request.encodedLength());
+}
+
+bool ArchiveProxy::offer(util::index_t length)
+{
+    int attempts = m_retryAttempts;
+
+    while (true)
+    {
+        const std::int64_t result = m_publication->offer(m_buffer, 0, length);
+        if (result > 0)
+        {
+            return true;
+        }
+
+        if (PUBLICATION_CLOSED == result)
+        {
+            throw ArchiveException("connection to the archive has been closed", SOURCEINFO);
+        }
+
+        if (NOT_CONNECTED == result)
+        {
+            throw ArchiveException("connection to the archive is no longer available", SOURCEINFO);
+        }
+
+        if (MAX_POSITION_EXCEEDED == result)
+        {
+            throw ArchiveException("publication failed due to max position being reached", SOURCEINFO);
+        }
+
+        if (--attempts <= 0)
+        {
+            return false;
+        }
+
+        m_retryIdleStrategy.idle();
+    }
+}
+
+bool ArchiveProxy::offerWithTimeout(util::index_t length, const on_idle_t& onIdle)
+{
+    const std::int64_t deadlineNs = nanoTime() + m_connectTimeoutNs;
+
+    while (true)
+    {
+        const std::int64_t result = m_publication->offer(m_buffer, 0, length);
+        if (result > 0)
+        {
+            return true;
+        }
+
+        if (PUBLICATION_CLOSED == result)
+        {
+            throw ArchiveException("connection to the archive has been closed", SOURCEINFO);
+        }
+
+        if (MAX_POSITION_EXCEEDED == result)
+        {
+            throw ArchiveException("publication failed due to max position being reached", SOURCEINFO);
+        }
+
+        if (nanoTime() > deadlineNs)
+        {
+            return false;
+        }
+
+        if (onIdle)
+        {
+            onIdle();
+        }
+
+        m_retryIdleStrategy.idle();
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_ARCHIVE_CLIENT_ARCHIVE_PROXY__
+#define INCLUDED_AERON_ARCHIVE_CLIENT_ARCHIVE_PROXY__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <ExclusivePublication.h>
+#include <concurrent/YieldingIdleStrategy.h>
+#include "codecs/ArchiveCodecs.h"
+#include "ArchiveConfiguration.h"
+
+namespace aeron { namespace archive { namespace client {
+
+/**
+ * Encodes archive control requests and offers them on the control request publication.
+ * <p>
+ * Requests are encoded into a buffer owned by the proxy, which only grows for unusually long channels, so sending a
+ * request does not allocate. Not thread safe.
+ */
+class ArchiveProxy
+{
+public:
+    static const int DEFAULT_RETRY_ATTEMPTS = 3;
+    static const std::size_t INITIAL_BUFFER_LENGTH = 1024;
+
+    /// Called while waiting to connect, e.g. to invoke the Aeron client conductor.
+    typedef std::function<void()> on_idle_t;
+
+    ArchiveProxy(
+        std::shared_ptr<ExclusivePublication> publication,
+        std::int64_t connectTimeoutNs = Configuration::MESSAGE_TIMEOUT_DEFAULT_NS,
+        int retryAttempts = DEFAULT_RETRY_ATTEMPTS);
+
+    inline std::shared_ptr<ExclusivePublication> publication() const
+    {
+        return m_publication;
+    }
+
+    /**
+     * Connect to the archive, retrying until the publication connects or the connect timeout elapses.
+     *
+     * @param responseChannel  on which the archive should respond.
+     * @param responseStreamId on which the archive should respond.
+     * @param correlationId    for this request.
+     * @param onIdle           called between attempts, may be empty.
+     * @return true if the request was sent, false if the timeout elapsed first.
+     */
+    bool connect(
+        const std::string& responseChannel,
+        std::int32_t responseStreamId,
+        std::int64_t correlationId,
+        const on_idle_t& onIdle = on_idle_t());
+
+    bool closeSession(std::int64_t controlSessionId);
+
+    bool startRecording(
+        const std::string& channel,
+        std::int32_t streamId,
+        codecs::SourceLocation sourceLocation,
+        std::int64_t correlationId,
+        std::int64_t controlSessionId);
+
+    bool stopRecording(
+        const std::string& channel, std::int32_t streamId, std::int64_t correlationId, std::int64_t controlSessionId);
+
+    bool replay(
+        std::int64_t recordingId,
+        std::int64_t position,
+        std::int64_t length,
+        const std::string& replayChannel,
+        std::int32_t replayStreamId,
+        std::int64_t correlationId,
+        std::int64_t controlSessionId);
+
+    bool stopReplay(std::int64_t replaySessionId, std::int64_t correlationId, std::int64_t controlSessionId);
+
+    bool listRecordings(
+        std::int64_t fromRecordingId,
+        std::int32_t recordCount,
+        std::int64_t correlationId,
+        std::int64_t controlSessionId);
+
+    bool listRecordingsForUri(
+        std::int64_t fromRecordingId,
+        std::int32_t recordCount,
+        const std::string& channel,
+        std::int32_t streamId,
+        std::int64_t correlationId,
+        std::int64_t controlSessionId);
+
+    bool listRecording(std::int64_t recordingId, std::int64_t correlationId, std::int64_t controlSessionId);
+
+    bool extendRecording(
+        const std::string& channel,
+        std::int32_t streamId,
+        codecs::SourceLocation sourceLocation,
+        std::int64_t recordingId,
+        std::int64_t correlationId,
+        std::int64_t controlSessionId);
+
+    bool getRecordingPosition(std::int64_t recordingId, std::int64_t correlationId, std::int64_t controlSessionId);
+
+    bool truncateRecording(
+        std::int64_t recordingId, std::int64_t position, std::int64_t correlationId, std::int64_t controlSessionId);
+
+private:
+    std::shared_ptr<ExclusivePublication> m_publication;
+    std::int64_t m_connectTimeoutNs;
+    int m_retryAttempts;
+    concurrent::YieldingIdleStrategy m_retryIdleStrategy;
+    std::vector<std::uint8_t> m_storage;
+    concurrent::AtomicBuffer m_buffer;
+
+    concurrent::AtomicBuffer& buffer(util::index_t length);
+    bool offer(util::index_t length);
+    bool offerWithTimeout(util::index_t length, const on_idle_t& onIdle);
+};
+
+}}}
+
+#endif
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_ARCHIVE_CLIENT_CHANNEL_URI__
+#define INCLUDED_AERON_ARCHIVE_CLIENT_CHANNEL_URI__
+
+#include <cstdint>
+#include <string>
+
+namespace aeron { namespace archive { namespace client {
+
+namespace ChannelUri {
+
+static const char *const ENDPOINT_PARAM_NAME = "endpoint";
+static const char *const SESSION_ID_PARAM_NAME = "session-id";
+static const char *const TERM_LENGTH_PARAM_NAME = "term-length";
+static const char *const MTU_LENGTH_PARAM_NAME = "mtu";
+
+/**
+ * Set a parameter on an aeron: channel URI, replacing any existing value for the key.
+ *
+ * @param channel to add the parameter to, e.g. aeron:udp?endpoint=localhost:8010
+ * @param key     of the parameter.
+ * @param value   of the parameter.
+ * @return the channel with the parameter set.
+ */
+inline std::string putParam(const std::string& channel, const std::string& key, const std::string& value)
+{
+    const std::string::size_type query = channel.find('?');
+    if (std::string::npos == query)
+    {
+        return channel + "?" + key + "=" + value;
+    }
+
+    std::string result = channel.substr(0, query + 1);
+    std::string::size_type start = query + 1;
+    bool replaced = false;
+
+    while (start <= channel.length())
+    {
+        std::string::size_type end = channel.find('|', start);
+        if (std::string::npos == end)
+        {
+            end = channel.length();
+        }
+
+        std::string param = channel.substr(start, end - start);
+        if (0 == param.compare(0, key.length() + 1, key + "="))
+        {
+            param = key + "=" + value;
+            replaced = true;
+        }
+
+        if (!param.empty())
+        {
+            if (result.length() > query + 1)
+            {
+                result += "|";
+            }
+            result += param;
+        }
+
+        start = end + 1;
+    }
+
+    if (!replaced)
+    {
+        if (result.length() > query + 1)
+        {
+            result += "|";
+        }
+        result += key + "=" + value;
+    }
+
+    return result;
+}
+
+/**
+ * Add a session-id to a channel so only the publication with that session is matched.
+ */
+inline std::string addSessionId(const std::string& channel, std::int32_t sessionId)
+{
+    return putParam(channel, SESSION_ID_PARAM_NAME, std::to_string(sessionId));
+}
+
+}
+
+}}}
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ControlResponsePoller.h"
+
+using namespace aeron;
+using namespace aeron::archive::client;
+using namespace aeron::archive::codecs;
+
+ControlResponsePoller::ControlResponsePoller(std::shared_ptr<Subscription> subscription, int fragmentLimit) :
+    m_subscription(std::move(subscription)),
+    m_fragmentLimit(fragmentLimit),
+    m_fragmentAssembler(
+        [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            return this->onFragment(buffer, offset, length, header);
+        }),
+    m_fragmentHandler(m_fragmentAssembler.handler())
+{
+}
+
+int ControlResponsePoller::poll()
+{
+    m_controlSessionId = -1;
+    m_correlationId = -1;
+    m_relevantId = -1;
+    m_templateId = -1;
+    m_pollComplete = false;
+
+    return m_subscription->controlledPoll(m_fragmentHandler, m_fragmentLimit);
+}
+
+ControlledPollAction ControlResponsePoller::onFragment(
+    AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+{
+    if (length < MESSAGE_HEADER_LENGTH || SCHEMA_ID != codecs::schemaId(buffer, offset))
+    {
+        return ControlledPollAction::CONTINUE;
+    }
+
+    const std::uint16_t messageTemplateId = codecs::templateId(buffer, offset);
+    switch (messageTemplateId)
+    {
+        case ControlResponse::TEMPLATE_ID:
+        {
+            m_controlResponse.wrapForDecode(buffer, offset);
+            const ControlResponseDefn& response = m_controlResponse.block();
+
+            m_controlSessionId = response.controlSessionId;
+            m_correlationId = response.correlationId;
+            m_relevantId = response.relevantId;
+            m_code = static_cast<ControlResponseCode>(response.code);
+
+            if (ControlResponseCode::ERROR == m_code)
+            {
+                m_controlResponse.nextVarAscii(m_errorMessage);
+            }
+            else
+            {
+                m_errorMessage.clear();
+            }
+            break;
+        }
+
+        case RecordingDescriptor::TEMPLATE_ID:
+            break;
+
+        default:
+            return ControlledPollAction::CONTINUE;
+    }
+
+    m_templateId = messageTemplateId;
+    m_pollComplete = true;
+
+    return ControlledPollAction::BREAK;
+}
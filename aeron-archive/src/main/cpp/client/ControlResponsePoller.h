@@ -0,0 +1,122 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_ARCHIVE_CLIENT_CONTROL_RESPONSE_POLLER__
+#define INCLUDED_AERON_ARCHIVE_CLIENT_CONTROL_RESPONSE_POLLER__
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <Subscription.h>
+#include <ControlledFragmentAssembler.h>
+#include "codecs/ArchiveCodecs.h"
+
+namespace aeron { namespace archive { namespace client {
+
+/**
+ * Polls the control response subscription for one response at a time.
+ * <p>
+ * Each poll stops after the first whole message so its fields can be checked before the next is read. The handler
+ * and error message storage are set up once, so polling does not allocate once the error message has grown to the
+ * longest seen. Messages from other schemas or of unknown templates are skipped rather than thrown from the poll.
+ */
+class ControlResponsePoller
+{
+public:
+    static const int FRAGMENT_LIMIT = 10;
+
+    explicit ControlResponsePoller(std::shared_ptr<Subscription> subscription, int fragmentLimit = FRAGMENT_LIMIT);
+
+    ControlResponsePoller(const ControlResponsePoller&) = delete;
+    ControlResponsePoller& operator=(const ControlResponsePoller&) = delete;
+
+    /**
+     * Poll for the next response, resetting the fields of the previous one.
+     *
+     * @return the number of fragments read.
+     */
+    int poll();
+
+    inline std::shared_ptr<Subscription> subscription() const
+    {
+        return m_subscription;
+    }
+
+    inline std::int64_t controlSessionId() const
+    {
+        return m_controlSessionId;
+    }
+
+    inline std::int64_t correlationId() const
+    {
+        return m_correlationId;
+    }
+
+    inline std::int64_t relevantId() const
+    {
+        return m_relevantId;
+    }
+
+    inline std::int32_t templateId() const
+    {
+        return m_templateId;
+    }
+
+    inline codecs::ControlResponseCode code() const
+    {
+        return m_code;
+    }
+
+    /**
+     * The error message of the last response, empty unless code() is ERROR.
+     */
+    inline const std::string& errorMessage() const
+    {
+        return m_errorMessage;
+    }
+
+    inline bool isPollComplete() const
+    {
+        return m_pollComplete;
+    }
+
+    inline bool isControlResponse() const
+    {
+        return codecs::ControlResponse::TEMPLATE_ID == m_templateId;
+    }
+
+    ControlledPollAction onFragment(
+        concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header);
+
+private:
+    std::shared_ptr<Subscription> m_subscription;
+    int m_fragmentLimit;
+    ControlledFragmentAssembler m_fragmentAssembler;
+    controlled_poll_fragment_handler_t m_fragmentHandler;
+    codecs::ControlResponse m_controlResponse;
+
+    std::int64_t m_controlSessionId = -1;
+    std::int64_t m_correlationId = -1;
+    std::int64_t m_relevantId = -1;
+    std::int32_t m_templateId = -1;
+    codecs::ControlResponseCode m_code = codecs::ControlResponseCode::OK;
+    std::string m_errorMessage;
+    bool m_pollComplete = false;
+};
+
+}}}
+
+#endif
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecordingDescriptorPoller.h"
+
+using namespace aeron;
+using namespace aeron::archive::client;
+using namespace aeron::archive::codecs;
+
+RecordingDescriptorPoller::RecordingDescriptorPoller(
+    std::shared_ptr<Subscription> subscription, int fragmentLimit, std::int64_t controlSessionId) :
+    m_subscription(std::move(subscription)),
+    m_fragmentLimit(fragmentLimit),
+    m_controlSessionId(controlSessionId),
+    m_fragmentAssembler(
+        [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            return this->onFragment(buffer, offset, length, header);
+        }),
+    m_fragmentHandler(m_fragmentAssembler.handler())
+{
+}
+
+int RecordingDescriptorPoller::poll()
+{
+    m_isDispatchComplete = false;
+
+    return m_subscription->controlledPoll(m_fragmentHandler, m_fragmentLimit);
+}
+
+void RecordingDescriptorPoller::reset(
+    std::int64_t expectedCorrelationId, std::int32_t recordCount, const recording_descriptor_consumer_t& consumer)
+{
+    m_expectedCorrelationId = expectedCorrelationId;
+    m_remainingRecordCount = recordCount;
+    m_consumer = &consumer;
+    m_isDispatchComplete = false;
+    m_hasError = false;
+    m_errorMessage.clear();
+}
+
+ControlledPollAction RecordingDescriptorPoller::onFragment(
+    AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+{
+    if (length < MESSAGE_HEADER_LENGTH || SCHEMA_ID != schemaId(buffer, offset))
+    {
+        return ControlledPollAction::CONTINUE;
+    }
+
+    switch (templateId(buffer, offset))
+    {
+        case ControlResponse::TEMPLATE_ID:
+        {
+            m_controlResponse.wrapForDecode(buffer, offset);
+            const ControlResponseDefn& response = m_controlResponse.block();
+
+            if (response.controlSessionId != m_controlSessionId)
+            {
+                break;
+            }
+
+            const ControlResponseCode code = static_cast<ControlResponseCode>(response.code);
+            if (ControlResponseCode::RECORDING_UNKNOWN == code)
+            {
+                m_isDispatchComplete = true;
+                return ControlledPollAction::BREAK;
+            }
+
+            if (ControlResponseCode::ERROR == code && response.correlationId == m_expectedCorrelationId)
+            {
+                m_controlResponse.nextVarAscii(m_errorMessage);
+                m_hasError = true;
+                m_isDispatchComplete = true;
+                return ControlledPollAction::BREAK;
+            }
+            break;
+        }
+
+        case codecs::RecordingDescriptor::TEMPLATE_ID:
+        {
+            m_recordingDescriptorDecoder.wrapForDecode(buffer, offset);
+            const RecordingDescriptorDefn& decoded = m_recordingDescriptorDecoder.block();
+
+            if (decoded.controlSessionId != m_controlSessionId || decoded.correlationId != m_expectedCorrelationId)
+            {
+                break;
+            }
+
+            m_descriptor.controlSessionId = decoded.controlSessionId;
+            m_descriptor.correlationId = decoded.correlationId;
+            m_descriptor.recordingId = decoded.recordingId;
+            m_descriptor.startTimestamp = decoded.startTimestamp;
+            m_descriptor.stopTimestamp = decoded.stopTimestamp;
+            m_descriptor.startPosition = decoded.startPosition;
+            m_descriptor.stopPosition = decoded.stopPosition;
+            m_descriptor.initialTermId = decoded.initialTermId;
+            m_descriptor.segmentFileLength = decoded.segmentFileLength;
+            m_descriptor.termBufferLength = decoded.termBufferLength;
+            m_descriptor.mtuLength = decoded.mtuLength;
+            m_descriptor.sessionId = decoded.sessionId;
+            m_descriptor.streamId = decoded.streamId;
+            m_recordingDescriptorDecoder
+                .nextVarAscii(m_descriptor.strippedChannel)
+                .nextVarAscii(m_descriptor.originalChannel)
+                .nextVarAscii(m_descriptor.sourceIdentity);
+
+            if (nullptr != m_consumer && *m_consumer)
+            {
+                (*m_consumer)(m_descriptor);
+            }
+
+            if (0 == --m_remainingRecordCount)
+            {
+                m_isDispatchComplete = true;
+                return ControlledPollAction::BREAK;
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    return ControlledPollAction::CONTINUE;
+}
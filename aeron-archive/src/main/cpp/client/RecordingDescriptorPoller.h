@@ -0,0 +1,139 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_ARCHIVE_CLIENT_RECORDING_DESCRIPTOR_POLLER__
+#define INCLUDED_AERON_ARCHIVE_CLIENT_RECORDING_DESCRIPTOR_POLLER__
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <functional>
+#include <Subscription.h>
+#include <ControlledFragmentAssembler.h>
+#include "codecs/ArchiveCodecs.h"
+
+namespace aeron { namespace archive { namespace client {
+
+/**
+ * A recording in the archive catalog. The strings are reused between descriptors so copy any that are kept.
+ */
+struct RecordingDescriptor
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t recordingId;
+    std::int64_t startTimestamp;
+    std::int64_t stopTimestamp;
+    std::int64_t startPosition;
+    std::int64_t stopPosition;
+    std::int32_t initialTermId;
+    std::int32_t segmentFileLength;
+    std::int32_t termBufferLength;
+    std::int32_t mtuLength;
+    std::int32_t sessionId;
+    std::int32_t streamId;
+    std::string strippedChannel;
+    std::string originalChannel;
+    std::string sourceIdentity;
+};
+
+/**
+ * Called for each recording descriptor returned for a list request.
+ */
+typedef std::function<void(const RecordingDescriptor& descriptor)> recording_descriptor_consumer_t;
+
+/**
+ * Polls the control response subscription for the descriptors of a list request on a control session.
+ * <p>
+ * Dispatch is complete when the requested number of descriptors has been received, or the archive responds that
+ * there are no more recordings, or it responds with an error. Errors are held for the caller rather than thrown from
+ * the poll.
+ */
+class RecordingDescriptorPoller
+{
+public:
+    RecordingDescriptorPoller(
+        std::shared_ptr<Subscription> subscription, int fragmentLimit, std::int64_t controlSessionId);
+
+    RecordingDescriptorPoller(const RecordingDescriptorPoller&) = delete;
+    RecordingDescriptorPoller& operator=(const RecordingDescriptorPoller&) = delete;
+
+    int poll();
+
+    /**
+     * Reset for a new list request. The consumer is referenced, not copied, so must outlive the polling.
+     *
+     * @param expectedCorrelationId of the list request.
+     * @param recordCount           requested.
+     * @param consumer              for the descriptors.
+     */
+    void reset(
+        std::int64_t expectedCorrelationId, std::int32_t recordCount, const recording_descriptor_consumer_t& consumer);
+
+    inline std::shared_ptr<Subscription> subscription() const
+    {
+        return m_subscription;
+    }
+
+    inline std::int64_t controlSessionId() const
+    {
+        return m_controlSessionId;
+    }
+
+    inline bool isDispatchComplete() const
+    {
+        return m_isDispatchComplete;
+    }
+
+    inline std::int32_t remainingRecordCount() const
+    {
+        return m_remainingRecordCount;
+    }
+
+    inline bool hasError() const
+    {
+        return m_hasError;
+    }
+
+    inline const std::string& errorMessage() const
+    {
+        return m_errorMessage;
+    }
+
+    ControlledPollAction onFragment(
+        concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header);
+
+private:
+    std::shared_ptr<Subscription> m_subscription;
+    int m_fragmentLimit;
+    std::int64_t m_controlSessionId;
+    ControlledFragmentAssembler m_fragmentAssembler;
+    controlled_poll_fragment_handler_t m_fragmentHandler;
+    codecs::ControlResponse m_controlResponse;
+    codecs::RecordingDescriptor m_recordingDescriptorDecoder;
+    RecordingDescriptor m_descriptor;
+    const recording_descriptor_consumer_t *m_consumer = nullptr;
+
+    std::int64_t m_expectedCorrelationId = -1;
+    std::int32_t m_remainingRecordCount = 0;
+    bool m_isDispatchComplete = false;
+    bool m_hasError = false;
+    std::string m_errorMessage;
+};
+
+}}}
+
+#endif
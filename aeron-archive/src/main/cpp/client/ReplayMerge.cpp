@@ -0,0 +1,194 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <limits>
+#include "ReplayMerge.h"
+#include "ChannelUri.h"
+
+using namespace aeron;
+using namespace aeron::archive::client;
+
+ReplayMerge::ReplayMerge(
+    std::shared_ptr<AeronArchive> archive,
+    std::int64_t recordingId,
+    std::int64_t startPosition,
+    const std::string& replayChannel,
+    std::int32_t replayStreamId,
+    const std::string& liveChannel,
+    std::int32_t liveStreamId,
+    std::int64_t liveAddThreshold) :
+    m_archive(std::move(archive)),
+    m_replayChannel(replayChannel),
+    m_liveChannel(liveChannel),
+    m_recordingId(recordingId),
+    m_startPosition(startPosition),
+    m_liveAddThreshold(liveAddThreshold),
+    m_replayStreamId(replayStreamId),
+    m_liveStreamId(liveStreamId)
+{
+    m_aeron = m_archive->context().aeron();
+}
+
+ReplayMerge::~ReplayMerge()
+{
+    if (State::MERGED != m_state && State::CLOSED != m_state)
+    {
+        try
+        {
+            stopReplay();
+        }
+        catch (const std::exception&)
+        {
+            // the replay ends on its own when the archive sees the replay subscription go away
+        }
+    }
+
+    m_state = State::CLOSED;
+}
+
+int ReplayMerge::doWork()
+{
+    switch (m_state)
+    {
+        case State::AWAIT_INITIAL_RECORDING_POSITION:
+            return awaitInitialRecordingPosition();
+
+        case State::AWAIT_REPLAY:
+            return awaitReplay();
+
+        case State::AWAIT_CATCH_UP:
+            return awaitCatchUp();
+
+        case State::AWAIT_LIVE_JOIN:
+            return awaitLiveJoin();
+
+        default:
+            return 0;
+    }
+}
+
+int ReplayMerge::awaitInitialRecordingPosition()
+{
+    m_recordingPosition = m_archive->getRecordingPosition(m_recordingId);
+    if (AeronArchive::NULL_POSITION == m_recordingPosition)
+    {
+        throw ArchiveException(
+            "recording is not active, cannot merge with live: recordingId=" + std::to_string(m_recordingId),
+            SOURCEINFO);
+    }
+
+    if (0 == m_archive->listRecording(
+        m_recordingId, [&](const RecordingDescriptor& descriptor) { m_liveSessionId = descriptor.sessionId; }))
+    {
+        throw ArchiveException("unknown recording: recordingId=" + std::to_string(m_recordingId), SOURCEINFO);
+    }
+
+    m_replaySessionId = m_archive->startReplay(
+        m_recordingId, m_startPosition, std::numeric_limits<std::int64_t>::max(), m_replayChannel, m_replayStreamId);
+    m_replaySubscriptionId = m_aeron->addSubscription(
+        ChannelUri::addSessionId(m_replayChannel, static_cast<std::int32_t>(m_replaySessionId)), m_replayStreamId);
+    m_state = State::AWAIT_REPLAY;
+
+    return 1;
+}
+
+int ReplayMerge::awaitReplay()
+{
+    if (nullptr == m_replaySubscription)
+    {
+        m_replaySubscription = m_aeron->findSubscription(m_replaySubscriptionId);
+        if (nullptr == m_replaySubscription)
+        {
+            return 0;
+        }
+    }
+
+    m_replayImage = m_replaySubscription->imageBySessionId(static_cast<std::int32_t>(m_replaySessionId));
+    if (nullptr == m_replayImage)
+    {
+        return 0;
+    }
+
+    m_state = State::AWAIT_CATCH_UP;
+
+    return 1;
+}
+
+int ReplayMerge::awaitCatchUp()
+{
+    if (m_replayImage->isClosed() || !m_replaySubscription->isConnected())
+    {
+        throw ArchiveException(
+            "replay ended before catching up with live: recordingId=" + std::to_string(m_recordingId), SOURCEINFO);
+    }
+
+    if (m_replayImage->position() < m_recordingPosition - m_liveAddThreshold)
+    {
+        return 0;
+    }
+
+    m_recordingPosition = m_archive->getRecordingPosition(m_recordingId);
+    if (m_replayImage->position() < m_recordingPosition - m_liveAddThreshold)
+    {
+        return 1;
+    }
+
+    m_liveSubscriptionId = m_aeron->addSubscription(
+        ChannelUri::addSessionId(m_liveChannel, m_liveSessionId), m_liveStreamId);
+    m_state = State::AWAIT_LIVE_JOIN;
+
+    return 1;
+}
+
+int ReplayMerge::awaitLiveJoin()
+{
+    if (m_replayImage->isClosed() || !m_replaySubscription->isConnected())
+    {
+        throw ArchiveException(
+            "replay ended before merging with live: recordingId=" + std::to_string(m_recordingId), SOURCEINFO);
+    }
+
+    if (nullptr == m_liveSubscription)
+    {
+        m_liveSubscription = m_aeron->findSubscription(m_liveSubscriptionId);
+        if (nullptr == m_liveSubscription)
+        {
+            return 0;
+        }
+    }
+
+    if (nullptr == m_liveImage)
+    {
+        m_liveImage = m_liveSubscription->imageBySessionId(m_liveSessionId);
+
+        return nullptr == m_liveImage ? 0 : 1;
+    }
+
+    return 0;
+}
+
+void ReplayMerge::stopReplay()
+{
+    if (-1 != m_replaySessionId)
+    {
+        const std::int64_t replaySessionId = m_replaySessionId;
+
+        m_replaySessionId = -1;
+        m_replayImage = nullptr;
+        m_replaySubscription = nullptr;
+        m_archive->stopReplay(replaySessionId);
+    }
+}
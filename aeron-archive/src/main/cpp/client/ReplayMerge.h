@@ -0,0 +1,209 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_ARCHIVE_CLIENT_REPLAY_MERGE__
+#define INCLUDED_AERON_ARCHIVE_CLIENT_REPLAY_MERGE__
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include "AeronArchive.h"
+
+namespace aeron { namespace archive { namespace client {
+
+/**
+ * Replay a recording from a position and merge onto the live stream it is recording, so a late joining subscriber
+ * sees every message once and without a gap.
+ * <p>
+ * The replay is consumed until it comes within the live add threshold of the recorded position, then a subscription
+ * to the live channel is added for the session of the recording. The replay continues until it has passed the join
+ * position of the live image, after which the live image is polled from the replay position: fragments already
+ * delivered from the replay are dropped before reaching the handler and the first fragment past it completes the
+ * merge, stopping the replay. Both images carry the same frames at the same positions so there is nothing to compare
+ * but positions.
+ * <p>
+ * Only the thread calling {@link #poll} should use an instance. The recording must be active for the whole merge.
+ */
+class ReplayMerge
+{
+public:
+    /**
+     * The default distance from the recorded position at which the live subscription is added.
+     */
+    static const std::int64_t LIVE_ADD_THRESHOLD = 64 * 1024;
+
+    enum class State : std::int8_t
+    {
+        AWAIT_INITIAL_RECORDING_POSITION,
+        AWAIT_REPLAY,
+        AWAIT_CATCH_UP,
+        AWAIT_LIVE_JOIN,
+        MERGED,
+        CLOSED
+    };
+
+    /**
+     * @param archive          client used to query the recording and to start and stop the replay.
+     * @param recordingId      of the active recording of the live stream.
+     * @param startPosition    in the recording from which to replay.
+     * @param replayChannel    to which the replay is sent, which must be distinct from the live channel or stream.
+     * @param replayStreamId   to which the replay is sent.
+     * @param liveChannel      on which the live stream is received.
+     * @param liveStreamId     of the live stream.
+     * @param liveAddThreshold distance from the recorded position at which to add the live subscription.
+     */
+    ReplayMerge(
+        std::shared_ptr<AeronArchive> archive,
+        std::int64_t recordingId,
+        std::int64_t startPosition,
+        const std::string& replayChannel,
+        std::int32_t replayStreamId,
+        const std::string& liveChannel,
+        std::int32_t liveStreamId,
+        std::int64_t liveAddThreshold = LIVE_ADD_THRESHOLD);
+
+    /**
+     * Stop the replay if it is still running.
+     */
+    ~ReplayMerge();
+
+    ReplayMerge(const ReplayMerge&) = delete;
+    ReplayMerge& operator=(const ReplayMerge&) = delete;
+
+    /**
+     * Progress the merge and poll the replay, or once merged the live image, for fragments.
+     *
+     * @param fragmentHandler to which fragments are delivered.
+     * @param fragmentLimit   for the number of fragments delivered.
+     * @return the amount of work done.
+     * @throws ArchiveException if the recording is not active or the replay ends before the merge.
+     */
+    template<typename F>
+    inline int poll(F&& fragmentHandler, int fragmentLimit)
+    {
+        int workCount = doWork();
+
+        switch (m_state)
+        {
+            case State::AWAIT_CATCH_UP:
+                workCount += m_replayImage->poll(fragmentHandler, fragmentLimit);
+                break;
+
+            case State::AWAIT_LIVE_JOIN:
+                workCount += m_replayImage->poll(fragmentHandler, fragmentLimit);
+                if (nullptr != m_liveImage && m_replayImage->position() >= m_liveImage->position())
+                {
+                    workCount += pollLiveFromReplayPosition(fragmentHandler, fragmentLimit);
+                }
+                break;
+
+            case State::MERGED:
+                workCount += m_liveImage->poll(fragmentHandler, fragmentLimit);
+                break;
+
+            default:
+                break;
+        }
+
+        return workCount;
+    }
+
+    inline State state() const
+    {
+        return m_state;
+    }
+
+    inline bool isMerged() const
+    {
+        return State::MERGED == m_state;
+    }
+
+    /**
+     * The image being consumed, the replay until merged and the live image after, or nullptr before the replay starts.
+     */
+    inline std::shared_ptr<Image> image() const
+    {
+        return State::MERGED == m_state ? m_liveImage : m_replayImage;
+    }
+
+    /**
+     * The subscription to the live stream, which is kept when the merge completes, or nullptr before it is added.
+     */
+    inline std::shared_ptr<Subscription> liveSubscription() const
+    {
+        return m_liveSubscription;
+    }
+
+private:
+    std::shared_ptr<AeronArchive> m_archive;
+    std::shared_ptr<Aeron> m_aeron;
+    std::string m_replayChannel;
+    std::string m_liveChannel;
+    std::int64_t m_recordingId;
+    std::int64_t m_startPosition;
+    std::int64_t m_liveAddThreshold;
+    std::int64_t m_recordingPosition = AeronArchive::NULL_POSITION;
+    std::int64_t m_replaySessionId = -1;
+    std::int64_t m_replaySubscriptionId = -1;
+    std::int64_t m_liveSubscriptionId = -1;
+    std::int32_t m_replayStreamId;
+    std::int32_t m_liveStreamId;
+    std::int32_t m_liveSessionId = 0;
+    State m_state = State::AWAIT_INITIAL_RECORDING_POSITION;
+    std::shared_ptr<Subscription> m_replaySubscription;
+    std::shared_ptr<Subscription> m_liveSubscription;
+    std::shared_ptr<Image> m_replayImage;
+    std::shared_ptr<Image> m_liveImage;
+
+    int doWork();
+    int awaitInitialRecordingPosition();
+    int awaitReplay();
+    int awaitCatchUp();
+    int awaitLiveJoin();
+    void stopReplay();
+
+    template<typename F>
+    inline int pollLiveFromReplayPosition(F&& fragmentHandler, int fragmentLimit)
+    {
+        const std::int64_t replayPosition = m_replayImage->position();
+
+        const int fragments = m_liveImage->poll(
+            [&](
+                concurrent::AtomicBuffer& buffer,
+                util::index_t offset,
+                util::index_t length,
+                concurrent::logbuffer::Header& header)
+            {
+                if (header.position() > replayPosition)
+                {
+                    fragmentHandler(buffer, offset, length, header);
+                }
+            },
+            fragmentLimit);
+
+        if (m_liveImage->position() > replayPosition)
+        {
+            stopReplay();
+            m_state = State::MERGED;
+        }
+
+        return fragments;
+    }
+};
+
+}}}
+
+#endif
@@ -0,0 +1,342 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_ARCHIVE_CODECS_ARCHIVE_CODECS__
+#define INCLUDED_AERON_ARCHIVE_CODECS_ARCHIVE_CODECS__
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <concurrent/AtomicBuffer.h>
+
+namespace aeron { namespace archive { namespace codecs {
+
+/**
+ * Flyweights for the archive control protocol as defined by aeron-archive-codecs.xml. The wire format is SBE: a
+ * message header, a fixed length block of little endian fields with no padding, then variable length ASCII fields
+ * each prefixed with a uint32 length.
+ * <p>
+ * These are written by hand rather than generated so the C++ client builds without the SBE tool. They must be kept in
+ * step with the schema.
+ */
+static const std::uint16_t SCHEMA_ID = 1;
+static const std::uint16_t SCHEMA_VERSION = 0;
+
+enum class ControlResponseCode : std::int32_t
+{
+    OK = 0,
+    ERROR = 1,
+    RECORDING_UNKNOWN = 2
+};
+
+enum class SourceLocation : std::uint8_t
+{
+    LOCAL = 0,
+    REMOTE = 1
+};
+
+#pragma pack(push)
+#pragma pack(1)
+struct MessageHeaderDefn
+{
+    std::uint16_t blockLength;
+    std::uint16_t templateId;
+    std::uint16_t schemaId;
+    std::uint16_t version;
+};
+
+struct ControlResponseDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t relevantId;
+    std::int32_t code;
+};
+
+struct ConnectRequestDefn
+{
+    std::int64_t correlationId;
+    std::int32_t responseStreamId;
+};
+
+struct CloseSessionRequestDefn
+{
+    std::int64_t controlSessionId;
+};
+
+struct StartRecordingRequestDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int32_t streamId;
+    std::uint8_t sourceLocation;
+};
+
+struct StopRecordingRequestDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int32_t streamId;
+};
+
+struct ReplayRequestDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t recordingId;
+    std::int64_t position;
+    std::int64_t length;
+    std::int32_t replayStreamId;
+};
+
+struct StopReplayRequestDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t replaySessionId;
+};
+
+struct ListRecordingsRequestDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t fromRecordingId;
+    std::int32_t recordCount;
+};
+
+struct ListRecordingsForUriRequestDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t fromRecordingId;
+    std::int32_t recordCount;
+    std::int32_t streamId;
+};
+
+struct ListRecordingRequestDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t recordingId;
+};
+
+struct ExtendRecordingRequestDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t recordingId;
+    std::int32_t streamId;
+    std::uint8_t sourceLocation;
+};
+
+struct RecordingPositionRequestDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t recordingId;
+};
+
+struct TruncateRecordingRequestDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t recordingId;
+    std::int64_t position;
+};
+
+struct RecordingDescriptorDefn
+{
+    std::int64_t controlSessionId;
+    std::int64_t correlationId;
+    std::int64_t recordingId;
+    std::int64_t startTimestamp;
+    std::int64_t stopTimestamp;
+    std::int64_t startPosition;
+    std::int64_t stopPosition;
+    std::int32_t initialTermId;
+    std::int32_t segmentFileLength;
+    std::int32_t termBufferLength;
+    std::int32_t mtuLength;
+    std::int32_t sessionId;
+    std::int32_t streamId;
+};
+#pragma pack(pop)
+
+static const util::index_t MESSAGE_HEADER_LENGTH = sizeof(MessageHeaderDefn);
+static const util::index_t VAR_DATA_LENGTH_FIELD_LENGTH = sizeof(std::uint32_t);
+
+/**
+ * A message of the archive protocol with a fixed block of type block_t and template id TemplateId.
+ * <p>
+ * Variable length fields follow the block and must be put, or read, in schema order. When decoding, the block
+ * length from the message header is used to find them so messages from a newer schema version with a longer block
+ * can still be read.
+ */
+template<typename block_t, std::uint16_t TemplateId>
+class MessageFlyweight
+{
+public:
+    using this_t = MessageFlyweight<block_t, TemplateId>;
+
+    static const std::uint16_t TEMPLATE_ID = TemplateId;
+    static const std::uint16_t BLOCK_LENGTH = static_cast<std::uint16_t>(sizeof(block_t));
+
+    /**
+     * Wrap a buffer to encode a message at offset, writing the message header.
+     */
+    inline this_t& wrapAndApplyHeader(concurrent::AtomicBuffer& buffer, util::index_t offset)
+    {
+        MessageHeaderDefn& header = buffer.overlayStruct<MessageHeaderDefn>(offset);
+        header.blockLength = BLOCK_LENGTH;
+        header.templateId = TEMPLATE_ID;
+        header.schemaId = SCHEMA_ID;
+        header.version = SCHEMA_VERSION;
+
+        wrap(buffer, offset, BLOCK_LENGTH);
+        std::memset(m_block, 0, sizeof(block_t));
+
+        return *this;
+    }
+
+    /**
+     * Wrap a message, including its header, at offset for decoding. The template id must already have been checked.
+     */
+    inline this_t& wrapForDecode(concurrent::AtomicBuffer& buffer, util::index_t offset)
+    {
+        const MessageHeaderDefn& header = buffer.overlayStruct<MessageHeaderDefn>(offset);
+        wrap(buffer, offset, header.blockLength);
+
+        return *this;
+    }
+
+    inline block_t& block()
+    {
+        return *m_block;
+    }
+
+    inline const block_t& block() const
+    {
+        return *m_block;
+    }
+
+    inline this_t& putVarAscii(const char *value, std::uint32_t length)
+    {
+        m_buffer.putInt32(m_limit, static_cast<std::int32_t>(length));
+        m_buffer.putBytes(m_limit + VAR_DATA_LENGTH_FIELD_LENGTH, reinterpret_cast<const std::uint8_t *>(value), length);
+        m_limit += VAR_DATA_LENGTH_FIELD_LENGTH + static_cast<util::index_t>(length);
+
+        return *this;
+    }
+
+    inline this_t& putVarAscii(const std::string& value)
+    {
+        return putVarAscii(value.c_str(), static_cast<std::uint32_t>(value.length()));
+    }
+
+    /**
+     * Read the next variable length field without copying it.
+     *
+     * @param length of the field in bytes.
+     * @return pointer to the first byte of the field in the wrapped buffer.
+     */
+    inline const char *nextVarAscii(std::uint32_t& length)
+    {
+        length = static_cast<std::uint32_t>(m_buffer.getInt32(m_limit));
+        const char *value = reinterpret_cast<const char *>(m_buffer.buffer() + m_limit + VAR_DATA_LENGTH_FIELD_LENGTH);
+        m_buffer.boundsCheck(m_limit + VAR_DATA_LENGTH_FIELD_LENGTH, static_cast<util::index_t>(length));
+        m_limit += VAR_DATA_LENGTH_FIELD_LENGTH + static_cast<util::index_t>(length);
+
+        return value;
+    }
+
+    /**
+     * Copy the next variable length field into value. Does not allocate once value has capacity for the field.
+     */
+    inline this_t& nextVarAscii(std::string& value)
+    {
+        std::uint32_t length = 0;
+        const char *data = nextVarAscii(length);
+        value.assign(data, length);
+
+        return *this;
+    }
+
+    /**
+     * The length of the message, including the header, up to the last variable length field put or read.
+     */
+    inline util::index_t encodedLength() const
+    {
+        return m_limit - m_offset;
+    }
+
+    /**
+     * The length of a message with this block and variable length fields of the given total length.
+     */
+    inline static util::index_t computeLength(util::index_t varDataLength, int varFieldCount)
+    {
+        return MESSAGE_HEADER_LENGTH + BLOCK_LENGTH + (varFieldCount * VAR_DATA_LENGTH_FIELD_LENGTH) + varDataLength;
+    }
+
+private:
+    concurrent::AtomicBuffer m_buffer;
+    block_t *m_block = nullptr;
+    util::index_t m_offset = 0;
+    util::index_t m_limit = 0;
+
+    inline void wrap(concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t blockLength)
+    {
+        m_buffer.wrap(buffer);
+        m_block = &m_buffer.overlayStruct<block_t>(offset + MESSAGE_HEADER_LENGTH);
+        m_buffer.boundsCheck(offset + MESSAGE_HEADER_LENGTH, blockLength);
+        m_offset = offset;
+        m_limit = offset + MESSAGE_HEADER_LENGTH + blockLength;
+    }
+};
+
+template<typename block_t, std::uint16_t TemplateId>
+const std::uint16_t MessageFlyweight<block_t, TemplateId>::TEMPLATE_ID;
+
+template<typename block_t, std::uint16_t TemplateId>
+const std::uint16_t MessageFlyweight<block_t, TemplateId>::BLOCK_LENGTH;
+
+typedef MessageFlyweight<ControlResponseDefn, 1> ControlResponse;
+typedef MessageFlyweight<ConnectRequestDefn, 2> ConnectRequest;
+typedef MessageFlyweight<CloseSessionRequestDefn, 3> CloseSessionRequest;
+typedef MessageFlyweight<StartRecordingRequestDefn, 4> StartRecordingRequest;
+typedef MessageFlyweight<StopRecordingRequestDefn, 5> StopRecordingRequest;
+typedef MessageFlyweight<ReplayRequestDefn, 6> ReplayRequest;
+typedef MessageFlyweight<StopReplayRequestDefn, 7> StopReplayRequest;
+typedef MessageFlyweight<ListRecordingsRequestDefn, 8> ListRecordingsRequest;
+typedef MessageFlyweight<ListRecordingsForUriRequestDefn, 9> ListRecordingsForUriRequest;
+typedef MessageFlyweight<ListRecordingRequestDefn, 10> ListRecordingRequest;
+typedef MessageFlyweight<ExtendRecordingRequestDefn, 11> ExtendRecordingRequest;
+typedef MessageFlyweight<RecordingPositionRequestDefn, 12> RecordingPositionRequest;
+typedef MessageFlyweight<TruncateRecordingRequestDefn, 13> TruncateRecordingRequest;
+typedef MessageFlyweight<RecordingDescriptorDefn, 22> RecordingDescriptor;
+
+inline std::uint16_t templateId(concurrent::AtomicBuffer& buffer, util::index_t offset)
+{
+    return buffer.overlayStruct<MessageHeaderDefn>(offset).templateId;
+}
+
+inline std::uint16_t schemaId(concurrent::AtomicBuffer& buffer, util::index_t offset)
+{
+    return buffer.overlayStruct<MessageHeaderDefn>(offset).schemaId;
+}
+
+}}}
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "codecs/ArchiveCodecs.h"
+#include "ChannelUri.h"
+
+using namespace aeron::concurrent;
+using namespace aeron::archive::codecs;
+using namespace aeron::archive::client;
+
+class ArchiveCodecsTest : public testing::Test
+{
+public:
+    ArchiveCodecsTest() : m_buffer(m_storage)
+    {
+        m_storage.fill(0);
+    }
+
+protected:
+    std::array<std::uint8_t, 1024> m_storage;
+    AtomicBuffer m_buffer;
+};
+
+TEST_F(ArchiveCodecsTest, shouldHaveBlockLengthsOfTheSchema)
+{
+    EXPECT_EQ(MESSAGE_HEADER_LENGTH, 8);
+    EXPECT_EQ(ControlResponse::BLOCK_LENGTH, 28);
+    EXPECT_EQ(ConnectRequest::BLOCK_LENGTH, 12);
+    EXPECT_EQ(CloseSessionRequest::BLOCK_LENGTH, 8);
+    EXPECT_EQ(StartRecordingRequest::BLOCK_LENGTH, 21);
+    EXPECT_EQ(StopRecordingRequest::BLOCK_LENGTH, 20);
+    EXPECT_EQ(ReplayRequest::BLOCK_LENGTH, 44);
+    EXPECT_EQ(StopReplayRequest::BLOCK_LENGTH, 24);
+    EXPECT_EQ(ListRecordingsRequest::BLOCK_LENGTH, 28);
+    EXPECT_EQ(ListRecordingsForUriRequest::BLOCK_LENGTH, 32);
+    EXPECT_EQ(ListRecordingRequest::BLOCK_LENGTH, 24);
+    EXPECT_EQ(ExtendRecordingRequest::BLOCK_LENGTH, 29);
+    EXPECT_EQ(RecordingPositionRequest::BLOCK_LENGTH, 24);
+    EXPECT_EQ(TruncateRecordingRequest::BLOCK_LENGTH, 32);
+    EXPECT_EQ(RecordingDescriptor::BLOCK_LENGTH, 80);
+}
+
+TEST_F(ArchiveCodecsTest, shouldEncodeHeaderBlockAndVarData)
+{
+    const std::string channel = "aeron:udp?endpoint=localhost:8020";
+    StartRecordingRequest request;
+
+    request.wrapAndApplyHeader(m_buffer, 16).putVarAscii(channel);
+    request.block().controlSessionId = 7;
+    request.block().correlationId = 9;
+    request.block().streamId = 1001;
+    request.block().sourceLocation = static_cast<std::uint8_t>(SourceLocation::REMOTE);
+
+    EXPECT_EQ(request.encodedLength(), StartRecordingRequest::computeLength(static_cast<int>(channel.length()), 1));
+    EXPECT_EQ(m_buffer.getUInt16(16), StartRecordingRequest::BLOCK_LENGTH);
+    EXPECT_EQ(m_buffer.getUInt16(18), 4);
+    EXPECT_EQ(m_buffer.getUInt16(20), SCHEMA_ID);
+    EXPECT_EQ(m_buffer.getUInt16(22), SCHEMA_VERSION);
+    EXPECT_EQ(m_buffer.getInt64(24), 7);
+    EXPECT_EQ(m_buffer.getInt64(32), 9);
+    EXPECT_EQ(m_buffer.getInt32(40), 1001);
+    EXPECT_EQ(m_buffer.getUInt8(44), 1);
+    EXPECT_EQ(m_buffer.getInt32(45), static_cast<std::int32_t>(channel.length()));
+    EXPECT_EQ(std::memcmp(m_buffer.buffer() + 49, channel.c_str(), channel.length()), 0);
+}
+
+TEST_F(ArchiveCodecsTest, shouldDecodeVarDataAfterLongerBlockFromNewerVersion)
+{
+    const std::uint16_t newerBlockLength = ControlResponse::BLOCK_LENGTH + 8;
+
+    m_buffer.putUInt16(0, newerBlockLength);
+    m_buffer.putUInt16(2, ControlResponse::TEMPLATE_ID);
+    m_buffer.putUInt16(4, SCHEMA_ID);
+    m_buffer.putUInt16(6, SCHEMA_VERSION + 1);
+    m_buffer.putInt64(8, 3);
+    m_buffer.putInt32(MESSAGE_HEADER_LENGTH + newerBlockLength, 5);
+    m_buffer.putBytes(MESSAGE_HEADER_LENGTH + newerBlockLength + 4, reinterpret_cast<const std::uint8_t *>("oops!"), 5);
+
+    ControlResponse response;
+    std::string errorMessage;
+    response.wrapForDecode(m_buffer, 0).nextVarAscii(errorMessage);
+
+    EXPECT_EQ(templateId(m_buffer, 0), ControlResponse::TEMPLATE_ID);
+    EXPECT_EQ(response.block().controlSessionId, 3);
+    EXPECT_EQ(errorMessage, "oops!");
+    EXPECT_EQ(response.encodedLength(), MESSAGE_HEADER_LENGTH + newerBlockLength + 9);
+}
+
+TEST_F(ArchiveCodecsTest, shouldAddParamToChannelWithoutParams)
+{
+    EXPECT_EQ(ChannelUri::putParam("aeron:ipc", "term-length", "65536"), "aeron:ipc?term-length=65536");
+}
+
+TEST_F(ArchiveCodecsTest, shouldAppendParamToChannel)
+{
+    EXPECT_EQ(
+        ChannelUri::addSessionId("aeron:udp?endpoint=localhost:8010", 42),
+        "aeron:udp?endpoint=localhost:8010|session-id=42");
+}
+
+TEST_F(ArchiveCodecsTest, shouldReplaceExistingParam)
+{
+    EXPECT_EQ(
+        ChannelUri::putParam("aeron:udp?mtu=1408|endpoint=localhost:8010", "mtu", "4096"),
+        "aeron:udp?mtu=4096|endpoint=localhost:8010");
+    EXPECT_EQ(
+        ChannelUri::putParam("aeron:udp?endpoint=localhost:8010|mtu-x=1", "mtu", "4096"),
+        "aeron:udp?endpoint=localhost:8010|mtu-x=1|mtu=4096");
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "ClientConductorFixture.h"
+#include "ArchiveProxy.h"
+#include "ArchiveException.h"
+
+using namespace aeron::concurrent;
+using namespace aeron::archive::codecs;
+using namespace aeron::archive::client;
+using namespace aeron;
+
+#define TERM_LENGTH (LogBufferDescriptor::TERM_MIN_LENGTH)
+#define PAGE_SIZE (LogBufferDescriptor::PAGE_MIN_SIZE)
+#define LOG_META_DATA_LENGTH (LogBufferDescriptor::LOG_META_DATA_LENGTH)
+
+typedef std::array<std::uint8_t,
+    ((TERM_LENGTH * LogBufferDescriptor::PARTITION_COUNT) + LOG_META_DATA_LENGTH)> term_buffer_t;
+
+static const std::string CHANNEL = "aeron:udp?endpoint=localhost:8010";
+static const std::int32_t STREAM_ID = 10;
+static const std::int32_t SESSION_ID = 200;
+static const std::int32_t PUBLICATION_LIMIT_COUNTER_ID = 0;
+static const std::int64_t CORRELATION_ID = 100;
+static const std::int32_t TERM_ID = 1;
+
+static const std::int64_t CONTROL_SESSION_ID = 7;
+static const std::int64_t REQUEST_CORRELATION_ID = 9;
+
+class ArchiveProxyTest : public testing::Test, public ClientConductorFixture
+{
+public:
+    ArchiveProxyTest() :
+        m_logBuffers(new LogBuffers(m_log.data(), static_cast<std::int64_t>(m_log.size()), TERM_LENGTH)),
+        m_publicationLimit(m_counterValuesBuffer, PUBLICATION_LIMIT_COUNTER_ID)
+    {
+        m_log.fill(0);
+
+        m_termBuffer = m_logBuffers->atomicBuffer(0);
+        m_logMetaDataBuffer = m_logBuffers->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX);
+
+        m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_MTU_LENGTH_OFFSET, 4096);
+        m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_TERM_LENGTH_OFFSET, TERM_LENGTH);
+        m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_PAGE_SIZE_OFFSET, PAGE_SIZE);
+        m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_INITIAL_TERM_ID_OFFSET, TERM_ID);
+        m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_ACTIVE_TERM_COUNT_OFFSET, 0);
+        m_logMetaDataBuffer.putInt64(
+            LogBufferDescriptor::TERM_TAIL_COUNTER_OFFSET, static_cast<std::int64_t>(TERM_ID) << 32);
+        LogBufferDescriptor::isConnected(m_logMetaDataBuffer, true);
+
+        m_publicationLimit.set(TERM_LENGTH);
+
+        m_publication = std::make_shared<ExclusivePublication>(
+            m_conductor, CHANNEL, CORRELATION_ID, CORRELATION_ID, STREAM_ID, SESSION_ID,
+            m_publicationLimit, ChannelEndpointStatus::NO_ID_ALLOCATED, m_logBuffers);
+        m_archiveProxy.reset(new ArchiveProxy(m_publication));
+    }
+
+    util::index_t messageOffset()
+    {
+        return DataFrameHeader::LENGTH;
+    }
+
+protected:
+    AERON_DECL_ALIGNED(term_buffer_t m_log, 16);
+
+    AtomicBuffer m_termBuffer;
+    AtomicBuffer m_logMetaDataBuffer;
+    std::shared_ptr<LogBuffers> m_logBuffers;
+    UnsafeBufferPosition m_publicationLimit;
+    std::shared_ptr<ExclusivePublication> m_publication;
+    std::unique_ptr<ArchiveProxy> m_archiveProxy;
+};
+
+TEST_F(ArchiveProxyTest, shouldOfferConnectRequest)
+{
+    const std::string responseChannel = "aeron:udp?endpoint=localhost:8020";
+
+    ASSERT_TRUE(m_archiveProxy->connect(responseChannel, 20, REQUEST_CORRELATION_ID));
+
+    const util::index_t offset = messageOffset();
+    ASSERT_EQ(templateId(m_termBuffer, offset), ConnectRequest::TEMPLATE_ID);
+
+    ConnectRequest request;
+    std::string channel;
+    request.wrapForDecode(m_termBuffer, offset).nextVarAscii(channel);
+
+    EXPECT_EQ(request.block().correlationId, REQUEST_CORRELATION_ID);
+    EXPECT_EQ(request.block().responseStreamId, 20);
+    EXPECT_EQ(channel, responseChannel);
+    EXPECT_EQ(
+        m_termBuffer.getInt32(0), DataFrameHeader::LENGTH + ConnectRequest::computeLength(
+            static_cast<util::index_t>(responseChannel.length()), 1));
+}
+
+TEST_F(ArchiveProxyTest, shouldOfferReplayRequest)
+{
+    ASSERT_TRUE(m_archiveProxy->replay(3, 64, 1024, CHANNEL, 30, REQUEST_CORRELATION_ID, CONTROL_SESSION_ID));
+
+    const util::index_t offset = messageOffset();
+    ASSERT_EQ(templateId(m_termBuffer, offset), ReplayRequest::TEMPLATE_ID);
+
+    ReplayRequest request;
+    std::string channel;
+    request.wrapForDecode(m_termBuffer, offset).nextVarAscii(channel);
+
+    EXPECT_EQ(request.block().controlSessionId, CONTROL_SESSION_ID);
+    EXPECT_EQ(request.block().correlationId, REQUEST_CORRELATION_ID);
+    EXPECT_EQ(request.block().recordingId, 3);
+    EXPECT_EQ(request.block().position, 64);
+    EXPECT_EQ(request.block().length, 1024);
+    EXPECT_EQ(request.block().replayStreamId, 30);
+    EXPECT_EQ(channel, CHANNEL);
+}
+
+TEST_F(ArchiveProxyTest, shouldGrowBufferForLongChannel)
+{
+    const std::string longChannel = CHANNEL + "|alias=" + std::string(ArchiveProxy::INITIAL_BUFFER_LENGTH, 'x');
+
+    ASSERT_TRUE(m_archiveProxy->startRecording(
+        longChannel, STREAM_ID, SourceLocation::LOCAL, REQUEST_CORRELATION_ID, CONTROL_SESSION_ID));
+
+    StartRecordingRequest request;
+    std::string channel;
+    request.wrapForDecode(m_termBuffer, messageOffset()).nextVarAscii(channel);
+
+    EXPECT_EQ(request.block().streamId, STREAM_ID);
+    EXPECT_EQ(request.block().sourceLocation, static_cast<std::uint8_t>(SourceLocation::LOCAL));
+    EXPECT_EQ(channel, longChannel);
+}
+
+TEST_F(ArchiveProxyTest, shouldReturnFalseWhenBackPressuredAfterRetries)
+{
+    m_publicationLimit.set(0);
+
+    EXPECT_FALSE(m_archiveProxy->closeSession(CONTROL_SESSION_ID));
+}
+
+TEST_F(ArchiveProxyTest, shouldThrowWhenNotConnected)
+{
+    LogBufferDescriptor::isConnected(m_logMetaDataBuffer, false);
+    m_publicationLimit.set(0);
+
+    EXPECT_THROW(m_archiveProxy->closeSession(CONTROL_SESSION_ID), ArchiveException);
+}
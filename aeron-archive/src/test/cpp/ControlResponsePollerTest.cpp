@@ -0,0 +1,111 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+#include "ControlResponsePoller.h"
+
+using namespace aeron;
+using namespace aeron::concurrent;
+using namespace aeron::archive::codecs;
+using namespace aeron::archive::client;
+
+static const std::int64_t CONTROL_SESSION_ID = 7;
+static const std::int64_t CORRELATION_ID = 9;
+
+class ControlResponsePollerTest : public testing::Test
+{
+public:
+    ControlResponsePollerTest() :
+        m_buffer(m_storage),
+        m_header(0, 64 * 1024),
+        m_poller(std::shared_ptr<Subscription>())
+    {
+        m_storage.fill(0);
+    }
+
+    util::index_t encodeResponse(ControlResponseCode code, std::int64_t relevantId, const std::string& errorMessage)
+    {
+        ControlResponse response;
+        response.wrapAndApplyHeader(m_buffer, 0).putVarAscii(errorMessage);
+        response.block().controlSessionId = CONTROL_SESSION_ID;
+        response.block().correlationId = CORRELATION_ID;
+        response.block().relevantId = relevantId;
+        response.block().code = static_cast<std::int32_t>(code);
+
+        return response.encodedLength();
+    }
+
+protected:
+    std::array<std::uint8_t, 1024> m_storage;
+    AtomicBuffer m_buffer;
+    Header m_header;
+    ControlResponsePoller m_poller;
+};
+
+TEST_F(ControlResponsePollerTest, shouldDecodeOkResponseAndBreak)
+{
+    const util::index_t length = encodeResponse(ControlResponseCode::OK, 42, "");
+
+    EXPECT_EQ(m_poller.onFragment(m_buffer, 0, length, m_header), ControlledPollAction::BREAK);
+    EXPECT_TRUE(m_poller.isPollComplete());
+    EXPECT_TRUE(m_poller.isControlResponse());
+    EXPECT_EQ(m_poller.controlSessionId(), CONTROL_SESSION_ID);
+    EXPECT_EQ(m_poller.correlationId(), CORRELATION_ID);
+    EXPECT_EQ(m_poller.relevantId(), 42);
+    EXPECT_EQ(m_poller.code(), ControlResponseCode::OK);
+    EXPECT_TRUE(m_poller.errorMessage().empty());
+}
+
+TEST_F(ControlResponsePollerTest, shouldDecodeErrorMessage)
+{
+    const util::index_t length = encodeResponse(ControlResponseCode::ERROR, 0, "unknown recording");
+
+    EXPECT_EQ(m_poller.onFragment(m_buffer, 0, length, m_header), ControlledPollAction::BREAK);
+    EXPECT_EQ(m_poller.code(), ControlResponseCode::ERROR);
+    EXPECT_EQ(m_poller.errorMessage(), "unknown recording");
+}
+
+TEST_F(ControlResponsePollerTest, shouldBreakOnRecordingDescriptorWithoutDecoding)
+{
+    RecordingDescriptor descriptor;
+    descriptor.wrapAndApplyHeader(m_buffer, 0);
+
+    EXPECT_EQ(
+        m_poller.onFragment(m_buffer, 0, descriptor.encodedLength(), m_header), ControlledPollAction::BREAK);
+    EXPECT_TRUE(m_poller.isPollComplete());
+    EXPECT_FALSE(m_poller.isControlResponse());
+}
+
+TEST_F(ControlResponsePollerTest, shouldSkipMessagesOfOtherSchemas)
+{
+    const util::index_t length = encodeResponse(ControlResponseCode::OK, 42, "");
+    m_buffer.putUInt16(4, SCHEMA_ID + 1);
+
+    EXPECT_EQ(m_poller.onFragment(m_buffer, 0, length, m_header), ControlledPollAction::CONTINUE);
+    EXPECT_FALSE(m_poller.isPollComplete());
+}
+
+TEST_F(ControlResponsePollerTest, shouldSkipUnknownTemplates)
+{
+    const util::index_t length = encodeResponse(ControlResponseCode::OK, 42, "");
+    m_buffer.putUInt16(2, 99);
+
+    EXPECT_EQ(m_poller.onFragment(m_buffer, 0, length, m_header), ControlledPollAction::CONTINUE);
+    EXPECT_FALSE(m_poller.isPollComplete());
+}
@@ -59,10 +59,20 @@ Aeron::Aeron(Context &context) :
         context.m_onUnavailableCounterHandler,
         context.m_mediaDriverTimeout,
         context.m_resourceLingerTimeout,
-        CncFileDescriptor::clientLivenessTimeout(m_cncBuffer)),
+        CncFileDescriptor::clientLivenessTimeout(m_cncBuffer),
+        context.m_preTouchMappedMemory,
+        context.m_lockMappedMemory,
+        context.m_lazyMapLogBuffers,
+        context.m_mapLogBuffersInBackground,
+        context.m_callbackDispatcher),
     m_idleStrategy(IDLE_SLEEP_MS),
-    m_conductorRunner(m_conductor, m_idleStrategy, m_context.m_exceptionHandler),
-    m_conductorInvoker(m_conductor, m_context.m_exceptionHandler)
+    m_conductorRunner(
+        m_conductor,
+        m_idleStrategy,
+        m_conductor.errorHandler(),
+        "aeron-client-conductor",
+        m_context.m_conductorCpuAffinity),
+    m_conductorInvoker(m_conductor, m_conductor.errorHandler())
 {
     if (m_context.m_useConductorAgentInvoker)
     {
@@ -21,6 +21,7 @@
 #include <iostream>
 #include <thread>
 #include <random>
+#include <future>
 #include <concurrent/logbuffer/TermReader.h>
 #include <util/MemoryMappedFile.h>
 #include <concurrent/broadcast/CopyBroadcastReceiver.h>
@@ -94,6 +95,45 @@ public:
         return m_conductor.addPublication(channel, streamId);
     }
 
+    /**
+     * Add a {@link Publication} and have the handler called once the media driver has answered, instead of polling
+     * Aeron::findPublication.
+     *
+     * The handler is called on the client conductor thread, or from within AgentInvoker::invoke when the conductor
+     * is invoked by the application, with either the Publication or the exception findPublication would have thrown.
+     * A Publication already added for the channel and stream completes the handler before this call returns.
+     *
+     * @param channel                 for sending the messages known to the media layer.
+     * @param streamId                within the channel scope.
+     * @param onAddPublicationHandler called once with the outcome of the add.
+     * @return registration id for the publication
+     */
+    inline std::int64_t addPublication(
+        const std::string& channel, std::int32_t streamId, const on_add_publication_t& onAddPublicationHandler)
+    {
+        return m_conductor.addPublication(channel, streamId, onAddPublicationHandler);
+    }
+
+    /**
+     * Add a {@link Publication} and return a future for it that is ready once the media driver has answered.
+     *
+     * When the conductor is invoked by the application, AgentInvoker::invoke must be called for the future to
+     * become ready.
+     *
+     * @param channel  for sending the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return future holding the Publication or the exception from the media driver.
+     */
+    inline std::future<std::shared_ptr<Publication>> asyncAddPublication(
+        const std::string& channel, std::int32_t streamId)
+    {
+        return asyncAdd<Publication>(
+            [&](const on_add_publication_t& handler)
+            {
+                m_conductor.addPublication(channel, streamId, handler);
+            });
+    }
+
     /**
      * Retrieve the Publication associated with the given registrationId.
      *
@@ -128,6 +168,43 @@ public:
         return m_conductor.addExclusivePublication(channel, streamId);
     }
 
+    /**
+     * Add an {@link ExclusivePublication} and have the handler called once the media driver has answered.
+     *
+     * @see Aeron::addPublication(const std::string&, std::int32_t, const on_add_publication_t&)
+     *
+     * @param channel                          for sending the messages known to the media layer.
+     * @param streamId                         within the channel scope.
+     * @param onAddExclusivePublicationHandler called once with the outcome of the add.
+     * @return registration id for the publication
+     */
+    inline std::int64_t addExclusivePublication(
+        const std::string& channel,
+        std::int32_t streamId,
+        const on_add_exclusive_publication_t& onAddExclusivePublicationHandler)
+    {
+        return m_conductor.addExclusivePublication(channel, streamId, onAddExclusivePublicationHandler);
+    }
+
+    /**
+     * Add an {@link ExclusivePublication} and return a future for it that is ready once the media driver has answered.
+     *
+     * @see Aeron::asyncAddPublication
+     *
+     * @param channel  for sending the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return future holding the ExclusivePublication or the exception from the media driver.
+     */
+    inline std::future<std::shared_ptr<ExclusivePublication>> asyncAddExclusivePublication(
+        const std::string& channel, std::int32_t streamId)
+    {
+        return asyncAdd<ExclusivePublication>(
+            [&](const on_add_exclusive_publication_t& handler)
+            {
+                m_conductor.addExclusivePublication(channel, streamId, handler);
+            });
+    }
+
     /**
      * Retrieve the ExclusivePublication associated with the given registrationId.
      *
@@ -186,6 +263,80 @@ public:
         return m_conductor.addSubscription(channel, streamId, onAvailableImageHandler, onUnavailableImageHandler);
     }
 
+    /**
+     * Add a new {@link Subscription} and have the handler called once the media driver has answered.
+     *
+     * @see Aeron::addPublication(const std::string&, std::int32_t, const on_add_publication_t&)
+     *
+     * @param channel                  for receiving the messages known to the media layer.
+     * @param streamId                 within the channel scope.
+     * @param onAddSubscriptionHandler called once with the outcome of the add.
+     * @return registration id for the subscription
+     */
+    inline std::int64_t addSubscription(
+        const std::string& channel, std::int32_t streamId, const on_add_subscription_t& onAddSubscriptionHandler)
+    {
+        return m_conductor.addSubscription(
+            channel,
+            streamId,
+            m_context.m_onAvailableImageHandler,
+            m_context.m_onUnavailableImageHandler,
+            onAddSubscriptionHandler);
+    }
+
+    /**
+     * Add a new {@link Subscription} and return a future for it that is ready once the media driver has answered.
+     *
+     * @see Aeron::asyncAddPublication
+     *
+     * @param channel  for receiving the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return future holding the Subscription or the exception from the media driver.
+     */
+    inline std::future<std::shared_ptr<Subscription>> asyncAddSubscription(
+        const std::string& channel, std::int32_t streamId)
+    {
+        return asyncAdd<Subscription>(
+            [&](const on_add_subscription_t& handler)
+            {
+                addSubscription(channel, streamId, handler);
+            });
+    }
+
+    /**
+     * Add many {@link Subscription}s in one go. The add commands are written to the media driver as a command batch,
+     * see batchCommands, so the driver answers them as a pipelined batch, and the handler is called once for each
+     * subscription as its answer arrives.
+     *
+     * @param channelsAndStreamIds     of the subscriptions to add.
+     * @param onAddSubscriptionHandler called once per subscription with the outcome of its add.
+     * @return registration ids for the subscriptions in the order given.
+     */
+    inline std::vector<std::int64_t> addSubscriptions(
+        const std::vector<std::pair<std::string, std::int32_t>>& channelsAndStreamIds,
+        const on_add_subscription_t& onAddSubscriptionHandler)
+    {
+        return m_conductor.addSubscriptions(
+            channelsAndStreamIds,
+            m_context.m_onAvailableImageHandler,
+            m_context.m_onUnavailableImageHandler,
+            onAddSubscriptionHandler);
+    }
+
+    /**
+     * Call func with the add and remove commands it issues through this client accumulated and written to the media
+     * driver together in as few ring buffer claims as possible once it returns, e.g. when re-adding many resources
+     * after a failover. The client lock is held while func runs. Commands are only seen by the media driver after
+     * func returns so func must not wait for an add to complete.
+     *
+     * @param func issuing the commands to batch.
+     */
+    template <typename F>
+    inline void batchCommands(F&& func)
+    {
+        m_conductor.batchCommands(std::forward<F>(func));
+    }
+
     /**
      * Retrieve the Subscription associated with the given registrationId.
      *
@@ -309,6 +460,28 @@ private:
     AgentInvoker<ClientConductor> m_conductorInvoker;
 
     MemoryMappedFile::ptr_t mapCncFile(Context& context);
+
+    template <typename Resource, typename Add>
+    static std::future<std::shared_ptr<Resource>> asyncAdd(Add&& add)
+    {
+        auto promise = std::make_shared<std::promise<std::shared_ptr<Resource>>>();
+        std::future<std::shared_ptr<Resource>> future = promise->get_future();
+
+        add(
+            [promise](std::shared_ptr<Resource> resource, std::exception_ptr error)
+            {
+                if (error)
+                {
+                    promise->set_exception(error);
+                }
+                else
+                {
+                    promise->set_value(resource);
+                }
+            });
+
+        return future;
+    }
 };
 
 }
@@ -0,0 +1,443 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ASYNCSCHEDULER_H
+#define AERON_ASYNCSCHEDULER_H
+
+/*
+ * The client is built as C++11, coroutines are only available to applications compiling against it as C++20.
+ */
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#include "Publication.h"
+#include "concurrent/AtomicBuffer.h"
+#include "concurrent/logbuffer/Header.h"
+
+namespace aeron {
+
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::logbuffer;
+
+/**
+ * Fragment handed to a coroutine resumed from AsyncScheduler::nextFragment. The buffer and header belong to the log
+ * of the Image and are only valid until the coroutine next suspends, so copy out anything needed beyond that.
+ */
+struct AsyncFragment
+{
+    AtomicBuffer *buffer = nullptr;
+    util::index_t offset = 0;
+    util::index_t length = 0;
+    Header *header = nullptr;
+};
+
+/**
+ * Coroutine returned by functions run on an AsyncScheduler. A task does not start until it is spawned and the
+ * scheduler then owns it, destroying its frame once it has completed.
+ */
+class AsyncTask
+{
+public:
+    struct promise_type
+    {
+        std::exception_ptr m_exception;
+
+        AsyncTask get_return_object()
+        {
+            return AsyncTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            m_exception = std::current_exception();
+        }
+    };
+
+    explicit AsyncTask(std::coroutine_handle<promise_type> handle) : m_handle(handle)
+    {
+    }
+
+    AsyncTask(AsyncTask&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    AsyncTask(const AsyncTask&) = delete;
+    AsyncTask& operator=(const AsyncTask&) = delete;
+    AsyncTask& operator=(AsyncTask&&) = delete;
+
+    ~AsyncTask()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    std::coroutine_handle<promise_type> release()
+    {
+        return std::exchange(m_handle, nullptr);
+    }
+
+private:
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * Runs coroutines that await fragments from Subscriptions and offers to Publications on a single thread, so an
+ * application can be written as straight line code per stream rather than as poll and retry loops.
+ * <p>
+ * The scheduler is an Agent, driven by an AgentRunner or by an AgentInvoker from the application loop, and doWork
+ * returns the number of awaits completed so the usual idle strategies apply. Each pass polls every awaited
+ * Subscription for one fragment per waiting coroutine and resumes the coroutine from within the fragment handler,
+ * so the fragment is read in place from the log without a copy. Offers are attempted immediately and only suspend on
+ * BACK_PRESSURED, NOT_CONNECTED or ADMIN_ACTION, being retried each pass until they succeed or fail outright.
+ * <p>
+ * Not thread safe, a scheduler and its tasks are to be used by one thread. The Subscriptions and Publications
+ * awaited must outlive the awaits on them.
+ */
+class AsyncScheduler
+{
+public:
+    AsyncScheduler() = default;
+
+    AsyncScheduler(const AsyncScheduler&) = delete;
+    AsyncScheduler& operator=(const AsyncScheduler&) = delete;
+
+    ~AsyncScheduler()
+    {
+        onClose();
+    }
+
+    /**
+     * Awaitable for the next fragment from a Subscription, resuming with an AsyncFragment.
+     */
+    template<typename S>
+    class FragmentAwaiter;
+
+    /**
+     * Awaitable for an offer to a Publication, resuming with the new position or a Publication error code that is
+     * not retried.
+     */
+    template<typename P>
+    class OfferAwaiter;
+
+    /**
+     * Take ownership of a task and run it until its first suspension.
+     *
+     * @param task to run.
+     */
+    void spawn(AsyncTask&& task)
+    {
+        std::coroutine_handle<AsyncTask::promise_type> handle = task.release();
+
+        m_tasks.push_back(handle);
+        handle.resume();
+        reapCompletedTasks();
+    }
+
+    /**
+     * Await the next fragment from a Subscription.
+     *
+     * @param subscription to poll, of any type with a poll(fragmentHandler, fragmentLimit) method.
+     * @return awaitable resuming with the fragment.
+     */
+    template<typename S>
+    FragmentAwaiter<S> nextFragment(S& subscription)
+    {
+        return FragmentAwaiter<S>(*this, subscription);
+    }
+
+    /**
+     * Await an offer of a range of a buffer to a Publication.
+     *
+     * @param publication to offer to, of any type with an offer(buffer, offset, length) method.
+     * @param buffer      containing the message.
+     * @param offset      in the buffer at which the message begins.
+     * @param length      of the message.
+     * @return awaitable resuming with the new position or PUBLICATION_CLOSED or MAX_POSITION_EXCEEDED.
+     */
+    template<typename P>
+    OfferAwaiter<P> offerAsync(P& publication, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        return OfferAwaiter<P>(*this, publication, buffer, offset, length);
+    }
+
+    /**
+     * Await an offer of a whole buffer to a Publication.
+     *
+     * @param publication to offer to.
+     * @param buffer      containing the message.
+     * @return awaitable resuming with the new position or a Publication error code that is not retried.
+     */
+    template<typename P>
+    OfferAwaiter<P> offerAsync(P& publication, AtomicBuffer& buffer)
+    {
+        return OfferAwaiter<P>(*this, publication, buffer, 0, buffer.capacity());
+    }
+
+    void onStart()
+    {
+    }
+
+    /**
+     * Poll each awaited Subscription and retry each pending offer once, resuming the coroutines whose awaits
+     * completed.
+     *
+     * @return the number of awaits completed.
+     */
+    int doWork()
+    {
+        int workCount = 0;
+
+        m_polling.swap(m_waiters);
+        for (Waiter *waiter : m_polling)
+        {
+            if (waiter->tryComplete())
+            {
+                workCount++;
+            }
+            else
+            {
+                m_waiters.push_back(waiter);
+            }
+        }
+        m_polling.clear();
+
+        reapCompletedTasks();
+
+        return workCount;
+    }
+
+    /**
+     * Destroy the tasks that have not yet completed.
+     */
+    void onClose()
+    {
+        for (std::coroutine_handle<AsyncTask::promise_type> handle : m_tasks)
+        {
+            handle.destroy();
+        }
+        m_tasks.clear();
+        m_waiters.clear();
+    }
+
+    const char *roleName()
+    {
+        return "async-scheduler";
+    }
+
+    /**
+     * Run the tasks until they have all completed, idling between passes.
+     *
+     * @param idleStrategy to idle with when a pass does no work.
+     */
+    template<typename IdleStrategy>
+    void run(IdleStrategy& idleStrategy)
+    {
+        while (!m_tasks.empty())
+        {
+            idleStrategy.idle(doWork());
+        }
+    }
+
+    /**
+     * The number of spawned tasks that have not yet completed.
+     *
+     * @return the number of spawned tasks that have not yet completed.
+     */
+    std::size_t taskCount() const
+    {
+        return m_tasks.size();
+    }
+
+private:
+    class Waiter
+    {
+    public:
+        virtual ~Waiter() = default;
+
+        /*
+         * Returns true once the await has completed and the coroutine has been resumed, after which the waiter must
+         * not be touched as it lives in the coroutine frame.
+         */
+        virtual bool tryComplete() = 0;
+    };
+
+    std::vector<std::coroutine_handle<AsyncTask::promise_type>> m_tasks;
+    std::vector<Waiter*> m_waiters;
+    std::vector<Waiter*> m_polling;
+
+    void reapCompletedTasks()
+    {
+        std::exception_ptr exception;
+
+        for (std::size_t i = 0; i < m_tasks.size();)
+        {
+            std::coroutine_handle<AsyncTask::promise_type> handle = m_tasks[i];
+
+            if (handle.done())
+            {
+                if (!exception)
+                {
+                    exception = handle.promise().m_exception;
+                }
+
+                handle.destroy();
+                m_tasks[i] = m_tasks.back();
+                m_tasks.pop_back();
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+public:
+    template<typename S>
+    class FragmentAwaiter : private Waiter
+    {
+    public:
+        FragmentAwaiter(AsyncScheduler& scheduler, S& subscription) :
+            m_scheduler(scheduler), m_subscription(subscription)
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_handle = handle;
+            m_scheduler.m_waiters.push_back(this);
+        }
+
+        AsyncFragment await_resume() const noexcept
+        {
+            return m_fragment;
+        }
+
+    private:
+        AsyncScheduler& m_scheduler;
+        S& m_subscription;
+        std::coroutine_handle<> m_handle;
+        AsyncFragment m_fragment;
+
+        bool tryComplete() override
+        {
+            return m_subscription.poll(
+                [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+                {
+                    m_fragment.buffer = &buffer;
+                    m_fragment.offset = offset;
+                    m_fragment.length = length;
+                    m_fragment.header = &header;
+                    m_handle.resume();
+                },
+                1) > 0;
+        }
+    };
+
+    template<typename P>
+    class OfferAwaiter : private Waiter
+    {
+    public:
+        OfferAwaiter(
+            AsyncScheduler& scheduler,
+            P& publication,
+            AtomicBuffer& buffer,
+            util::index_t offset,
+            util::index_t length) :
+            m_scheduler(scheduler), m_publication(publication), m_buffer(buffer), m_offset(offset), m_length(length)
+        {
+        }
+
+        bool await_ready()
+        {
+            return tryOffer();
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_handle = handle;
+            m_scheduler.m_waiters.push_back(this);
+        }
+
+        std::int64_t await_resume() const noexcept
+        {
+            return m_result;
+        }
+
+    private:
+        AsyncScheduler& m_scheduler;
+        P& m_publication;
+        AtomicBuffer& m_buffer;
+        util::index_t m_offset;
+        util::index_t m_length;
+        std::int64_t m_result = 0;
+        std::coroutine_handle<> m_handle;
+
+        bool tryOffer()
+        {
+            m_result = m_publication.offer(m_buffer, m_offset, m_length);
+
+            return m_result != NOT_CONNECTED && m_result != BACK_PRESSURED && m_result != ADMIN_ACTION;
+        }
+
+        bool tryComplete() override
+        {
+            if (tryOffer())
+            {
+                m_handle.resume();
+                return true;
+            }
+
+            return false;
+        }
+    };
+};
+
+}
+
+#endif
+
+#endif //AERON_ASYNCSCHEDULER_H
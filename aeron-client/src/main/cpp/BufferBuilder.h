@@ -49,6 +49,11 @@ public:
         return &m_buffer[0];
     }
 
+    std::uint32_t capacity() const
+    {
+        return m_capacity;
+    }
+
     std::uint32_t limit() const
     {
         return m_limit;
@@ -71,11 +76,20 @@ public:
         return *this;
     }
 
+    /**
+     * Grow the buffer, if necessary, so a further length bytes can be appended without reallocation.
+     */
+    this_t &reserve(std::uint32_t length)
+    {
+        ensureCapacity(length);
+        return *this;
+    }
+
     this_t &append(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
     {
         ensureCapacity(static_cast<std::uint32_t>(length));
 
-        ::memcpy(&m_buffer[0] + m_limit, buffer.buffer() + offset, static_cast<std::uint32_t>(length));
+        util::MemoryCopy::copy(&m_buffer[0] + m_limit, buffer.buffer() + offset, static_cast<std::size_t>(length));
         m_limit += length;
         return *this;
     }
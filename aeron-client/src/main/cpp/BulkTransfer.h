@@ -0,0 +1,256 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_BULKTRANSFER_H
+#define AERON_BULKTRANSFER_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <algorithm>
+#include "Aeron.h"
+#include "util/MemoryMappedFile.h"
+
+namespace aeron {
+
+/**
+ * Each chunk of a transfer is a single unfragmented message prefixed by the id of the transfer, the offset of the
+ * chunk in the transfer, and the total length of the transfer.
+ */
+namespace BulkTransfer {
+
+static const util::index_t TRANSFER_ID_OFFSET = 0;
+static const util::index_t CHUNK_OFFSET_OFFSET = 8;
+static const util::index_t TOTAL_LENGTH_OFFSET = 16;
+static const util::index_t HEADER_LENGTH = 24;
+static const int DEFAULT_CHUNK_LIMIT = 16;
+
+}
+
+/**
+ * Streams a file or a large buffer into a Publication or ExclusivePublication.
+ * <p>
+ * The source is cut into chunks that fill {@link Publication#maxPayloadLength()}, so no chunk is fragmented and each
+ * is copied once, straight from the source into the term with tryClaim. A file is mapped rather than read so the
+ * copy is from the page cache. The sender is driven by calling {@link #send()} until {@link #isComplete()}, which
+ * lets it share a duty cycle with other work and back off under back pressure like any other publisher.
+ */
+class BulkTransferSender
+{
+public:
+    /**
+     * Transfer a buffer, which must stay valid until the transfer is complete.
+     *
+     * @param transferId to tell this transfer apart from others on the stream.
+     * @param data       to transfer.
+     * @param length     of the data, which must be greater than zero.
+     */
+    BulkTransferSender(std::int64_t transferId, const std::uint8_t *data, std::int64_t length) :
+        m_transferId(transferId),
+        m_data(data),
+        m_length(length)
+    {
+        if (length <= 0)
+        {
+            throw util::IllegalArgumentException(
+                util::strPrintf("transfer length must be greater than zero: %lld", static_cast<long long>(length)),
+                SOURCEINFO);
+        }
+    }
+
+    /**
+     * Transfer the contents of a file, which is mapped for the lifetime of the sender.
+     *
+     * @param transferId to tell this transfer apart from others on the stream.
+     * @param filename   of the file to transfer.
+     */
+    BulkTransferSender(std::int64_t transferId, const std::string& filename) :
+        BulkTransferSender(transferId, util::MemoryMappedFile::mapExisting(filename.c_str()))
+    {
+    }
+
+    /**
+     * Claim and fill up to chunkLimit chunks.
+     *
+     * @param publication to send to.
+     * @param chunkLimit  the most chunks to send in this call.
+     * @return the number of chunks sent, or the result of the failed claim if none were.
+     */
+    template<typename P>
+    std::int64_t send(P& publication, int chunkLimit = BulkTransfer::DEFAULT_CHUNK_LIMIT)
+    {
+        const std::int64_t maxChunkLength = publication.maxPayloadLength() - BulkTransfer::HEADER_LENGTH;
+        int chunks = 0;
+
+        while (chunks < chunkLimit && m_position < m_length)
+        {
+            const util::index_t chunkLength = static_cast<util::index_t>(
+                std::min<std::int64_t>(maxChunkLength, m_length - m_position));
+
+            const std::int64_t result = publication.tryClaim(BulkTransfer::HEADER_LENGTH + chunkLength, m_bufferClaim);
+            if (result < 0)
+            {
+                return 0 == chunks ? result : chunks;
+            }
+
+            AtomicBuffer& buffer = m_bufferClaim.buffer();
+            const util::index_t offset = m_bufferClaim.offset();
+
+            buffer.putInt64(offset + BulkTransfer::TRANSFER_ID_OFFSET, m_transferId);
+            buffer.putInt64(offset + BulkTransfer::CHUNK_OFFSET_OFFSET, m_position);
+            buffer.putInt64(offset + BulkTransfer::TOTAL_LENGTH_OFFSET, m_length);
+            buffer.putBytes(offset + BulkTransfer::HEADER_LENGTH, m_data + m_position, chunkLength);
+            m_bufferClaim.commit();
+
+            m_position += chunkLength;
+            chunks++;
+        }
+
+        return chunks;
+    }
+
+    inline bool isComplete() const
+    {
+        return m_position >= m_length;
+    }
+
+    inline std::int64_t position() const
+    {
+        return m_position;
+    }
+
+    inline std::int64_t length() const
+    {
+        return m_length;
+    }
+
+private:
+    util::MemoryMappedFile::ptr_t m_file;
+    std::int64_t m_transferId;
+    const std::uint8_t *m_data;
+    std::int64_t m_length;
+    std::int64_t m_position = 0;
+    concurrent::logbuffer::BufferClaim m_bufferClaim;
+
+    BulkTransferSender(std::int64_t transferId, util::MemoryMappedFile::ptr_t file) :
+        BulkTransferSender(transferId, file->getMemoryPtr(), static_cast<std::int64_t>(file->getMemorySize()))
+    {
+        m_file = std::move(file);
+    }
+};
+
+/**
+ * Writes the chunks of a transfer from a {@link BulkTransferSender} straight into a mapped output file.
+ * <p>
+ * Chunks are never fragmented so the handler is used as is, without a FragmentAssembler, and each chunk is copied
+ * once, from the term to its place in the file. The file is created with the length of the transfer when the first
+ * chunk arrives. Chunks of other transfers on the stream are ignored.
+ */
+class BulkTransferReceiver
+{
+public:
+    /**
+     * @param transferId of the transfer to receive.
+     * @param filename   of the file to write the transfer to.
+     */
+    BulkTransferReceiver(std::int64_t transferId, std::string filename) :
+        m_transferId(transferId),
+        m_filename(std::move(filename))
+    {
+    }
+
+    /**
+     * Compose a fragment_handler_t that calls this BulkTransferReceiver instance.
+     *
+     * @return fragment_handler_t composed with the BulkTransferReceiver instance.
+     */
+    fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header&)
+        {
+            this->onChunk(buffer, offset, length);
+        };
+    }
+
+    inline bool isComplete() const
+    {
+        return nullptr != m_file && m_bytesReceived >= m_length;
+    }
+
+    inline std::int64_t bytesReceived() const
+    {
+        return m_bytesReceived;
+    }
+
+    /**
+     * The length of the transfer, or -1 until the first chunk has arrived.
+     */
+    inline std::int64_t length() const
+    {
+        return m_length;
+    }
+
+private:
+    std::int64_t m_transferId;
+    std::string m_filename;
+    util::MemoryMappedFile::ptr_t m_file;
+    std::int64_t m_length = -1;
+    std::int64_t m_bytesReceived = 0;
+
+    inline void onChunk(AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        if (length < BulkTransfer::HEADER_LENGTH ||
+            buffer.getInt64(offset + BulkTransfer::TRANSFER_ID_OFFSET) != m_transferId)
+        {
+            return;
+        }
+
+        const std::int64_t chunkOffset = buffer.getInt64(offset + BulkTransfer::CHUNK_OFFSET_OFFSET);
+        const std::int64_t totalLength = buffer.getInt64(offset + BulkTransfer::TOTAL_LENGTH_OFFSET);
+        const util::index_t chunkLength = length - BulkTransfer::HEADER_LENGTH;
+
+        if (nullptr == m_file)
+        {
+            if (totalLength <= 0)
+            {
+                throw util::IllegalStateException(
+                    util::strPrintf("invalid transfer length: %lld", static_cast<long long>(totalLength)), SOURCEINFO);
+            }
+
+            m_file = util::MemoryMappedFile::createNew(m_filename.c_str(), 0, static_cast<std::size_t>(totalLength));
+            m_length = totalLength;
+        }
+
+        if (totalLength != m_length || chunkOffset < 0 || chunkOffset + chunkLength > m_length)
+        {
+            throw util::IllegalStateException(
+                util::strPrintf(
+                    "chunk out of bounds: offset=%lld length=%d transferLength=%lld",
+                    static_cast<long long>(chunkOffset), chunkLength, static_cast<long long>(m_length)),
+                SOURCEINFO);
+        }
+
+        std::memcpy(
+            m_file->getMemoryPtr() + chunkOffset,
+            buffer.buffer() + offset + BulkTransfer::HEADER_LENGTH,
+            static_cast<std::size_t>(chunkLength));
+        m_bytesReceived += chunkLength;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_CALLBACKDISPATCHER_H
+#define AERON_CALLBACKDISPATCHER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <util/Exceptions.h>
+
+namespace aeron {
+
+/**
+ * Queue of client callbacks to be run away from the client conductor, so a slow error, image or counter handler does
+ * not hold up the conductor duty cycle, keepalives included, or the admin lock it holds while calling handlers.
+ * <p>
+ * Set on the Context with Context::callbackDispatcher and the client conductor enqueues its callbacks rather than
+ * calling them. Enqueuing is lock free and callbacks run in the order they were enqueued each time doWork is called,
+ * which is an Agent duty cycle so the dispatcher can run on its own AgentRunner, be added to a CompositeAgent or be
+ * called from an executor of the application.
+ * <p>
+ * As a callback runs later than the event it reports, an Image handed to an available or unavailable image handler is
+ * a copy that keeps its log mapped, an Image may be polled before its available image handler has run, and the
+ * exception handed to an error handler is a copy of the same type for the exceptions of the client and otherwise a
+ * std::runtime_error with the same message.
+ */
+class CallbackDispatcher
+{
+public:
+    typedef std::function<void()> callback_t;
+
+    CallbackDispatcher() = default;
+
+    CallbackDispatcher(const CallbackDispatcher&) = delete;
+    CallbackDispatcher& operator=(const CallbackDispatcher&) = delete;
+
+    ~CallbackDispatcher()
+    {
+        Node *node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+        while (nullptr != node)
+        {
+            Node *next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * Enqueue a callback to be run by doWork. Thread safe.
+     *
+     * @param callback to be run.
+     */
+    inline void enqueue(callback_t callback)
+    {
+        Node *node = new Node(std::move(callback));
+
+        Node *head = m_head.load(std::memory_order_relaxed);
+        do
+        {
+            node->next = head;
+        }
+        while (!m_head.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    inline void onStart()
+    {
+    }
+
+    /**
+     * Run the callbacks enqueued so far. If a callback throws then the exception is passed on and the next doWork
+     * carries on from the callback after it.
+     *
+     * @return the number of callbacks run.
+     */
+    inline int doWork()
+    {
+        if (m_index == m_callbacks.size())
+        {
+            m_callbacks.clear();
+            m_index = 0;
+            takeEnqueued();
+        }
+
+        int workCount = 0;
+
+        while (m_index < m_callbacks.size())
+        {
+            callback_t& callback = m_callbacks[m_index++];
+            workCount++;
+            callback();
+        }
+
+        return workCount;
+    }
+
+    /**
+     * Run the callbacks still enqueued.
+     */
+    inline void onClose()
+    {
+        while (doWork() > 0)
+        {
+        }
+    }
+
+    inline const char *roleName() const
+    {
+        return "aeron-client-callbacks";
+    }
+
+    /**
+     * Copy an exception so it can be rethrown after the original has gone, keeping its type for the exceptions of the
+     * client.
+     *
+     * @param exception to copy.
+     * @return the copy to be rethrown.
+     */
+    static std::exception_ptr copyException(const std::exception& exception)
+    {
+        using namespace aeron::util;
+        std::exception_ptr copy;
+
+        if (tryCopy<RegistrationException>(exception, copy) ||
+            tryCopy<IOException>(exception, copy) ||
+            tryCopy<FormatException>(exception, copy) ||
+            tryCopy<OutOfBoundsException>(exception, copy) ||
+            tryCopy<ParseException>(exception, copy) ||
+            tryCopy<ElementNotFound>(exception, copy) ||
+            tryCopy<IllegalArgumentException>(exception, copy) ||
+            tryCopy<IllegalStateException>(exception, copy) ||
+            tryCopy<DriverTimeoutException>(exception, copy) ||
+            tryCopy<ConductorServiceTimeoutException>(exception, copy) ||
+            tryCopy<UnknownSubscriptionException>(exception, copy) ||
+            tryCopy<SourcedException>(exception, copy))
+        {
+            return copy;
+        }
+
+        return std::make_exception_ptr(std::runtime_error(exception.what()));
+    }
+
+private:
+    struct Node
+    {
+        explicit Node(callback_t&& callback) : callback(std::move(callback))
+        {
+        }
+
+        callback_t callback;
+        Node *next = nullptr;
+    };
+
+    std::atomic<Node*> m_head { nullptr };
+    std::vector<callback_t> m_callbacks;
+    std::size_t m_index = 0;
+
+    inline void takeEnqueued()
+    {
+        Node *node = m_head.exchange(nullptr, std::memory_order_acquire);
+        const std::size_t start = m_callbacks.size();
+
+        while (nullptr != node)
+        {
+            Node *next = node->next;
+            m_callbacks.push_back(std::move(node->callback));
+            delete node;
+            node = next;
+        }
+
+        std::reverse(m_callbacks.begin() + static_cast<std::ptrdiff_t>(start), m_callbacks.end());
+    }
+
+    template<typename T>
+    static bool tryCopy(const std::exception& exception, std::exception_ptr& copy)
+    {
+        const T *typed = dynamic_cast<const T *>(&exception);
+
+        if (nullptr != typed)
+        {
+            copy = std::make_exception_ptr(*typed);
+            return true;
+        }
+
+        return false;
+    }
+};
+
+}
+
+#endif
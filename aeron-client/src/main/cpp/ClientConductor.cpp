@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <cstdlib>
+#include <iterator>
 #include "ClientConductor.h"
 
 namespace aeron {
@@ -22,21 +24,29 @@ ClientConductor::~ClientConductor()
 {
     std::vector<std::shared_ptr<Subscription>> subscriptions;
 
-    std::for_each(m_subscriptions.begin(), m_subscriptions.end(),
-        [&subscriptions](SubscriptionStateDefn& entry)
+    m_subscriptions.forEach(
+        [&subscriptions](std::int64_t, SubscriptionStateDefn& entry)
         {
             subscriptions.push_back(entry.m_subscriptionCache);
             entry.m_subscriptionCache.reset();
         });
 
     std::for_each(m_lingeringImageLists.begin(), m_lingeringImageLists.end(),
-        [](ImageListLingerDefn & entry)
+        [this](ImageListLingerDefn & entry)
         {
-            delete[] entry.m_imageList->m_images;
-            delete entry.m_imageList;
+            m_imageListPool.release(entry.m_imageList);
             entry.m_imageList = nullptr;
         });
 
+    std::for_each(m_lingeringAwaitingRegistrations.begin(), m_lingeringAwaitingRegistrations.end(),
+        [](AwaitingRegistrationsLingerDefn& entry)
+        {
+            delete entry.m_registrations;
+            entry.m_registrations = nullptr;
+        });
+
+    delete m_awaitingRegistrations.load();
+
     m_driverProxy.clientClose();
 }
 
@@ -47,38 +57,52 @@ std::int64_t ClientConductor::addPublication(const std::string &channel, std::in
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     std::int64_t id;
 
-    auto it = std::find_if(m_publications.begin(), m_publications.end(),
-        [channel, streamId](const PublicationStateDefn &entry)
-        {
-            return (streamId == entry.m_streamId && channel == entry.m_channel);
-        });
+    auto it = m_publicationIdByChannelAndStreamId.find(std::make_pair(channel, streamId));
 
-    if (it == m_publications.end())
+    if (it == m_publicationIdByChannelAndStreamId.end())
     {
         std::int64_t registrationId = m_driverProxy.addPublication(channel, streamId);
 
-        m_publications.emplace_back(channel, registrationId, streamId, m_epochClock());
+        PublicationStateDefn& state =
+            m_publications.emplace(registrationId, channel, registrationId, streamId, m_epochClock());
+        m_publicationIdByChannelAndStreamId.emplace(std::make_pair(channel, streamId), registrationId);
+
+        addAwaitingRegistration(registrationId, state.m_timeOfRegistration);
         id = registrationId;
     }
     else
     {
-        id = (*it).m_registrationId;
+        id = it->second;
     }
 
     return id;
 }
 
+std::int64_t ClientConductor::addPublication(
+    const std::string& channel, std::int32_t streamId, const on_add_publication_t& onAddPublicationHandler)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+    const std::int64_t registrationId = addPublication(channel, streamId);
+
+    m_publications.get(registrationId)->m_onAddHandlers.push_back(onAddPublicationHandler);
+    completePublicationRegistration(registrationId);
+
+    return registrationId;
+}
+
 std::shared_ptr<Publication> ClientConductor::findPublication(std::int64_t registrationId)
 {
+    if (isAwaitingMediaDriver(registrationId))
+    {
+        return std::shared_ptr<Publication>();
+    }
+
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto it = std::find_if(m_publications.begin(), m_publications.end(),
-        [registrationId](const PublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    PublicationStateDefn *it = m_publications.get(registrationId);
 
-    if (it == m_publications.end())
+    if (nullptr == it)
     {
         return std::shared_ptr<Publication>();
     }
@@ -124,16 +148,14 @@ void ClientConductor::releasePublication(std::int64_t registrationId)
 
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto it = std::find_if(m_publications.begin(), m_publications.end(),
-        [registrationId](const PublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    PublicationStateDefn *it = m_publications.get(registrationId);
 
-    if (it != m_publications.end())
+    if (nullptr != it)
     {
         m_driverProxy.removePublication(registrationId);
-        m_publications.erase(it);
+        removeAwaitingRegistration(registrationId);
+        m_publicationIdByChannelAndStreamId.erase(std::make_pair(it->m_channel, it->m_streamId));
+        m_publications.remove(registrationId);
     }
 }
 
@@ -144,22 +166,40 @@ std::int64_t ClientConductor::addExclusivePublication(const std::string& channel
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     std::int64_t registrationId = m_driverProxy.addExclusivePublication(channel, streamId);
 
-    m_exclusivePublications.emplace_back(channel, registrationId, streamId, m_epochClock());
+    ExclusivePublicationStateDefn& state =
+        m_exclusivePublications.emplace(registrationId, channel, registrationId, streamId, m_epochClock());
+
+    addAwaitingRegistration(registrationId, state.m_timeOfRegistration);
+
+    return registrationId;
+}
+
+std::int64_t ClientConductor::addExclusivePublication(
+    const std::string& channel,
+    std::int32_t streamId,
+    const on_add_exclusive_publication_t& onAddExclusivePublicationHandler)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+    const std::int64_t registrationId = addExclusivePublication(channel, streamId);
+
+    m_exclusivePublications.get(registrationId)->m_onAddHandlers.push_back(onAddExclusivePublicationHandler);
 
     return registrationId;
 }
 
 std::shared_ptr<ExclusivePublication> ClientConductor::findExclusivePublication(std::int64_t registrationId)
 {
+    if (isAwaitingMediaDriver(registrationId))
+    {
+        return std::shared_ptr<ExclusivePublication>();
+    }
+
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto it = std::find_if(m_exclusivePublications.begin(), m_exclusivePublications.end(),
-        [registrationId](const ExclusivePublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    ExclusivePublicationStateDefn *it = m_exclusivePublications.get(registrationId);
 
-    if (it == m_exclusivePublications.end())
+    if (nullptr == it)
     {
         return std::shared_ptr<ExclusivePublication>();
     }
@@ -205,17 +245,50 @@ void ClientConductor::releaseExclusivePublication(std::int64_t registrationId)
 
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto it = std::find_if(m_exclusivePublications.begin(), m_exclusivePublications.end(),
-        [registrationId](const ExclusivePublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    ExclusivePublicationStateDefn *it = m_exclusivePublications.get(registrationId);
 
-    if (it != m_exclusivePublications.end())
+    if (nullptr != it)
     {
         m_driverProxy.removePublication(registrationId);
-        m_exclusivePublications.erase(it);
+        removeAwaitingRegistration(registrationId);
+        m_exclusivePublications.remove(registrationId);
+    }
+}
+
+void ClientConductor::streamRange(const std::string& channel, std::int32_t& low, std::int32_t& high)
+{
+    static const std::string key = "streams=";
+    std::size_t index = channel.find(key);
+
+    while (std::string::npos != index && (0 == index || ('?' != channel[index - 1] && '|' != channel[index - 1])))
+    {
+        index = channel.find(key, index + 1);
+    }
+
+    if (std::string::npos == index)
+    {
+        return;
+    }
+
+    const char *value = channel.c_str() + index + key.length();
+    char *end = nullptr;
+    const long rangeLow = std::strtol(value, &end, 0);
+
+    if (end == value || '-' != *end)
+    {
+        return;
     }
+
+    const char *highValue = end + 1;
+    const long rangeHigh = std::strtol(highValue, &end, 0);
+
+    if (end == highValue || ('\0' != *end && '|' != *end) || rangeLow > rangeHigh)
+    {
+        return;
+    }
+
+    low = static_cast<std::int32_t>(rangeLow);
+    high = static_cast<std::int32_t>(rangeHigh);
 }
 
 std::int64_t ClientConductor::addSubscription(
@@ -230,23 +303,77 @@ std::int64_t ClientConductor::addSubscription(
 
     std::int64_t registrationId = m_driverProxy.addSubscription(channel, streamId);
 
-    m_subscriptions.emplace_back(
-        channel, registrationId, streamId, m_epochClock(), onAvailableImageHandler, onUnavailableImageHandler);
+    SubscriptionStateDefn& state = m_subscriptions.emplace(
+        registrationId,
+        channel,
+        registrationId,
+        streamId,
+        m_epochClock(),
+        dispatchImageHandler(onAvailableImageHandler),
+        dispatchImageHandler(onUnavailableImageHandler));
+
+    addAwaitingRegistration(registrationId, state.m_timeOfRegistration);
 
     return registrationId;
 }
 
-std::shared_ptr<Subscription> ClientConductor::findSubscription(std::int64_t registrationId)
+std::int64_t ClientConductor::addSubscription(
+    const std::string &channel,
+    std::int32_t streamId,
+    const on_available_image_t &onAvailableImageHandler,
+    const on_unavailable_image_t &onUnavailableImageHandler,
+    const on_add_subscription_t &onAddSubscriptionHandler)
 {
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto it = std::find_if(m_subscriptions.begin(), m_subscriptions.end(),
-        [registrationId](const SubscriptionStateDefn &entry)
+    const std::int64_t registrationId =
+        addSubscription(channel, streamId, onAvailableImageHandler, onUnavailableImageHandler);
+
+    m_subscriptions.get(registrationId)->m_onAddHandlers.push_back(onAddSubscriptionHandler);
+
+    return registrationId;
+}
+
+std::vector<std::int64_t> ClientConductor::addSubscriptions(
+    const std::vector<std::pair<std::string, std::int32_t>>& channelsAndStreamIds,
+    const on_available_image_t &onAvailableImageHandler,
+    const on_unavailable_image_t &onUnavailableImageHandler,
+    const on_add_subscription_t &onAddSubscriptionHandler)
+{
+    verifyDriverIsActive();
+
+    std::vector<std::int64_t> registrationIds;
+    registrationIds.reserve(channelsAndStreamIds.size());
+
+    batchCommands(
+        [&]()
         {
-            return (registrationId == entry.m_registrationId);
+            for (auto& channelAndStreamId : channelsAndStreamIds)
+            {
+                registrationIds.push_back(addSubscription(
+                    channelAndStreamId.first,
+                    channelAndStreamId.second,
+                    onAvailableImageHandler,
+                    onUnavailableImageHandler,
+                    onAddSubscriptionHandler));
+            }
         });
 
-    if (it == m_subscriptions.end())
+    return registrationIds;
+}
+
+std::shared_ptr<Subscription> ClientConductor::findSubscription(std::int64_t registrationId)
+{
+    if (isAwaitingMediaDriver(registrationId))
+    {
+        return std::shared_ptr<Subscription>();
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+    SubscriptionStateDefn *it = m_subscriptions.get(registrationId);
+
+    if (nullptr == it)
     {
         return std::shared_ptr<Subscription>();
     }
@@ -282,29 +409,25 @@ void ClientConductor::releaseSubscription(std::int64_t registrationId, struct Im
 
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto it = std::find_if(m_subscriptions.begin(), m_subscriptions.end(),
-        [registrationId](const SubscriptionStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    SubscriptionStateDefn *it = m_subscriptions.get(registrationId);
 
-    if (it != m_subscriptions.end())
+    if (nullptr != it)
     {
         m_driverProxy.removeSubscription((*it).m_registrationId);
 
         for (std::size_t i = 0; i < imageList->m_length; i++)
         {
-            (*it).m_onUnavailableImageHandler(imageList->m_images[i]);
+            (*it).m_onUnavailableImageHandler(*imageList->m_images[i]);
         }
 
-        m_subscriptions.erase(it);
+        removeAwaitingRegistration(registrationId);
+        m_subscriptions.remove(registrationId);
 
         lingerAllResources(m_epochClock(), imageList);
     }
     else if (nullptr != imageList)
     {
-        delete[] imageList->m_images;
-        delete imageList;
+        m_imageListPool.release(imageList);
     }
 }
 
@@ -327,24 +450,25 @@ std::int64_t ClientConductor::addCounter(
 
     std::int64_t registrationId = m_driverProxy.addCounter(typeId, keyBuffer, keyLength, label);
 
-    m_counters.emplace_back(registrationId, m_epochClock());
+    CounterStateDefn& state = m_counters.emplace(registrationId, registrationId, m_epochClock());
+
+    addAwaitingRegistration(registrationId, state.m_timeOfRegistration);
 
     return registrationId;
 }
 
 std::shared_ptr<Counter> ClientConductor::findCounter(std::int64_t registrationId)
 {
+    if (isAwaitingMediaDriver(registrationId))
+    {
+        return std::shared_ptr<Counter>();
+    }
+
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto it = std::find_if(
-        m_counters.begin(),
-        m_counters.end(),
-        [registrationId](const CounterStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    CounterStateDefn *it = m_counters.get(registrationId);
 
-    if (it == m_counters.end())
+    if (nullptr == it)
     {
         return std::shared_ptr<Counter>();
     }
@@ -379,19 +503,14 @@ void ClientConductor::releaseCounter(std::int64_t registrationId)
 
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto it = std::find_if(
-        m_counters.begin(),
-        m_counters.end(),
-        [registrationId](const CounterStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    CounterStateDefn *it = m_counters.get(registrationId);
 
-    if (it != m_counters.end())
+    if (nullptr != it)
     {
         m_driverProxy.removeCounter((*it).m_registrationId);
 
-        m_counters.erase(it);
+        removeAwaitingRegistration(registrationId);
+        m_counters.remove(registrationId);
     }
 }
 
@@ -420,24 +539,24 @@ void ClientConductor::onNewPublication(
 {
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto it = std::find_if(m_publications.begin(), m_publications.end(),
-        [registrationId](const PublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    PublicationStateDefn *it = m_publications.get(registrationId);
 
-    if (it != m_publications.end())
+    if (nullptr != it)
     {
         PublicationStateDefn& state = (*it);
 
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
         state.m_sessionId = sessionId;
         state.m_publicationLimitCounterId = publicationLimitCounterId;
         state.m_channelStatusId = channelStatusIndicatorId;
-        state.m_buffers = std::make_shared<LogBuffers>(logFileName.c_str());
         state.m_originalRegistrationId = originalRegistrationId;
 
-        m_onNewPublicationHandler(state.m_channel, streamId, sessionId, registrationId);
+        // the registration stays awaiting the driver until the log is mapped
+        mapLogBuffers(
+            logFileName,
+            [this, registrationId, streamId](std::shared_ptr<LogBuffers> logBuffers, const std::string& errorMessage)
+            {
+                onPublicationLogBuffersMapped(registrationId, streamId, logBuffers, errorMessage);
+            });
     }
 }
 
@@ -452,24 +571,88 @@ void ClientConductor::onNewExclusivePublication(
 {
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto it = std::find_if(m_exclusivePublications.begin(), m_exclusivePublications.end(),
-        [registrationId](const ExclusivePublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    ExclusivePublicationStateDefn *it = m_exclusivePublications.get(registrationId);
 
-    if (it != m_exclusivePublications.end())
+    if (nullptr != it)
     {
         ExclusivePublicationStateDefn& state = (*it);
 
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
         state.m_sessionId = sessionId;
         state.m_publicationLimitCounterId = publicationLimitCounterId;
         state.m_channelStatusId = channelStatusIndicatorId;
-        state.m_buffers = std::make_shared<LogBuffers>(logFileName.c_str());
         state.m_originalRegistrationId = originalRegistrationId;
 
-        m_onNewPublicationHandler(state.m_channel, streamId, sessionId, registrationId);
+        // the registration stays awaiting the driver until the log is mapped
+        mapLogBuffers(
+            logFileName,
+            [this, registrationId, streamId](std::shared_ptr<LogBuffers> logBuffers, const std::string& errorMessage)
+            {
+                onExclusivePublicationLogBuffersMapped(registrationId, streamId, logBuffers, errorMessage);
+            });
+    }
+}
+
+void ClientConductor::onPublicationLogBuffersMapped(
+    std::int64_t registrationId,
+    std::int32_t streamId,
+    std::shared_ptr<LogBuffers> logBuffers,
+    const std::string& errorMessage)
+{
+    PublicationStateDefn *it = m_publications.get(registrationId);
+
+    if (nullptr != it)
+    {
+        PublicationStateDefn& state = (*it);
+
+        removeAwaitingRegistration(registrationId);
+
+        if (nullptr == logBuffers)
+        {
+            state.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
+            state.m_errorCode = command::ERROR_CODE_GENERIC_ERROR;
+            state.m_errorMessage = errorMessage;
+        }
+        else
+        {
+            state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
+            state.m_buffers = std::move(logBuffers);
+
+            m_onNewPublicationHandler(state.m_channel, streamId, state.m_sessionId, registrationId);
+        }
+
+        completePublicationRegistration(registrationId);
+    }
+}
+
+void ClientConductor::onExclusivePublicationLogBuffersMapped(
+    std::int64_t registrationId,
+    std::int32_t streamId,
+    std::shared_ptr<LogBuffers> logBuffers,
+    const std::string& errorMessage)
+{
+    ExclusivePublicationStateDefn *it = m_exclusivePublications.get(registrationId);
+
+    if (nullptr != it)
+    {
+        ExclusivePublicationStateDefn& state = (*it);
+
+        removeAwaitingRegistration(registrationId);
+
+        if (nullptr == logBuffers)
+        {
+            state.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
+            state.m_errorCode = command::ERROR_CODE_GENERIC_ERROR;
+            state.m_errorMessage = errorMessage;
+        }
+        else
+        {
+            state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
+            state.m_buffers = std::move(logBuffers);
+
+            m_onNewPublicationHandler(state.m_channel, streamId, state.m_sessionId, registrationId);
+        }
+
+        completeExclusivePublicationRegistration(registrationId);
     }
 }
 
@@ -479,22 +662,20 @@ void ClientConductor::onSubscriptionReady(
 {
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto subIt = std::find_if(m_subscriptions.begin(), m_subscriptions.end(),
-        [registrationId](const SubscriptionStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    SubscriptionStateDefn *subIt = m_subscriptions.get(registrationId);
 
-    if (subIt != m_subscriptions.end() && (*subIt).m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
+    if (nullptr != subIt && (*subIt).m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
     {
         SubscriptionStateDefn& state = (*subIt);
 
         state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
+        removeAwaitingRegistration(registrationId);
         state.m_subscriptionCache =
             std::make_shared<Subscription>(
                 *this, state.m_registrationId, state.m_channel, state.m_streamId, channelStatusId);
         state.m_subscription = std::weak_ptr<Subscription>(state.m_subscriptionCache);
         m_onNewSubscriptionHandler(state.m_channel, state.m_streamId, registrationId);
+        completeSubscriptionRegistration(registrationId);
         return;
     }
 }
@@ -505,17 +686,14 @@ void ClientConductor::onAvailableCounter(
 {
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto counterIt = std::find_if(m_counters.begin(), m_counters.end(),
-        [registrationId](const CounterStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    CounterStateDefn *counterIt = m_counters.get(registrationId);
 
-    if (counterIt != m_counters.end() && (*counterIt).m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
+    if (nullptr != counterIt && (*counterIt).m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
     {
         CounterStateDefn& state = (*counterIt);
 
         state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
+        removeAwaitingRegistration(registrationId);
         state.m_counterId = counterId;
         state.m_counterCache =
             std::make_shared<Counter>(
@@ -548,55 +726,44 @@ void ClientConductor::onErrorResponse(
 {
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    auto subIt = std::find_if(m_subscriptions.begin(), m_subscriptions.end(),
-        [offendingCommandCorrelationId](const SubscriptionStateDefn &entry)
-        {
-            return (offendingCommandCorrelationId == entry.m_registrationId);
-        });
+    removeAwaitingRegistration(offendingCommandCorrelationId);
+
+    SubscriptionStateDefn *subIt = m_subscriptions.get(offendingCommandCorrelationId);
 
-    if (subIt != m_subscriptions.end())
+    if (nullptr != subIt)
     {
         (*subIt).m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
         (*subIt).m_errorCode = errorCode;
         (*subIt).m_errorMessage = errorMessage;
+        completeSubscriptionRegistration(offendingCommandCorrelationId);
         return;
     }
 
-    auto pubIt = std::find_if(m_publications.begin(), m_publications.end(),
-        [offendingCommandCorrelationId](const PublicationStateDefn &entry)
-        {
-            return (offendingCommandCorrelationId == entry.m_registrationId);
-        });
+    PublicationStateDefn *pubIt = m_publications.get(offendingCommandCorrelationId);
 
-    if (pubIt != m_publications.end())
+    if (nullptr != pubIt)
     {
         (*pubIt).m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
         (*pubIt).m_errorCode = errorCode;
         (*pubIt).m_errorMessage = errorMessage;
+        completePublicationRegistration(offendingCommandCorrelationId);
         return;
     }
 
-    auto exPubIt = std::find_if(m_exclusivePublications.begin(), m_exclusivePublications.end(),
-        [offendingCommandCorrelationId](const ExclusivePublicationStateDefn &entry)
-        {
-            return (offendingCommandCorrelationId == entry.m_registrationId);
-        });
+    ExclusivePublicationStateDefn *exPubIt = m_exclusivePublications.get(offendingCommandCorrelationId);
 
-    if (exPubIt != m_exclusivePublications.end())
+    if (nullptr != exPubIt)
     {
         (*exPubIt).m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
         (*exPubIt).m_errorCode = errorCode;
         (*exPubIt).m_errorMessage = errorMessage;
+        completeExclusivePublicationRegistration(offendingCommandCorrelationId);
         return;
     }
 
-    auto counterIt = std::find_if(m_counters.begin(), m_counters.end(),
-        [offendingCommandCorrelationId](const CounterStateDefn &entry)
-        {
-            return (offendingCommandCorrelationId == entry.m_registrationId);
-        });
+    CounterStateDefn *counterIt = m_counters.get(offendingCommandCorrelationId);
 
-    if (counterIt != m_counters.end())
+    if (nullptr != counterIt)
     {
         (*counterIt).m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
         (*counterIt).m_errorCode = errorCode;
@@ -616,41 +783,87 @@ void ClientConductor::onAvailableImage(
 {
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    std::for_each(m_subscriptions.begin(), m_subscriptions.end(),
-        [&](const SubscriptionStateDefn &entry)
+    const SubscriptionStateDefn *entry = m_subscriptions.get(subscriberPositionRegistrationId);
+
+    if (nullptr != entry && streamId >= entry->m_streamIdLow && streamId <= entry->m_streamIdHigh)
+    {
+        std::shared_ptr<Subscription> subscription = entry->m_subscription.lock();
+
+        if (subscription != nullptr &&
+            !(subscription->hasImage(correlationId)) &&
+            m_pendingImages.find(correlationId) == m_pendingImages.end())
         {
-            if (streamId == entry.m_streamId)
+            PendingImageDefn pending{
+                streamId, sessionId, sourceIdentity, subscriberPositionIndicatorId, subscriberPositionRegistrationId};
+            m_pendingImages.emplace(correlationId, std::move(pending));
+
+            try
+            {
+                mapLogBuffers(
+                    logFilename,
+                    [this, correlationId](std::shared_ptr<LogBuffers> logBuffers, const std::string& errorMessage)
+                    {
+                        onImageLogBuffersMapped(correlationId, logBuffers, errorMessage);
+                    });
+            }
+            catch (...)
             {
-                std::shared_ptr<Subscription> subscription = entry.m_subscription.lock();
+                m_pendingImages.erase(correlationId);
+                throw;
+            }
+        }
+    }
+}
 
-                if (subscription != nullptr &&
-                    !(subscription->hasImage(correlationId)) &&
-                    subscriberPositionRegistrationId == subscription->registrationId())
-                {
-                    std::shared_ptr<LogBuffers> logBuffers = std::make_shared<LogBuffers>(logFilename.c_str());
+void ClientConductor::onImageLogBuffersMapped(
+    std::int64_t correlationId, std::shared_ptr<LogBuffers> logBuffers, const std::string& errorMessage)
+{
+    auto pendingIt = m_pendingImages.find(correlationId);
 
-                    UnsafeBufferPosition subscriberPosition(m_counterValuesBuffer, subscriberPositionIndicatorId);
+    if (pendingIt == m_pendingImages.end())
+    {
+        return;
+    }
 
-                    Image image(
-                        sessionId,
-                        correlationId,
-                        subscription->registrationId(),
-                        sourceIdentity,
-                        subscriberPosition,
-                        logBuffers,
-                        m_errorHandler);
+    const PendingImageDefn pending = pendingIt->second;
+    m_pendingImages.erase(pendingIt);
 
-                    entry.m_onAvailableImageHandler(image);
+    if (nullptr == logBuffers)
+    {
+        m_errorHandler(IllegalStateException(
+            strPrintf("could not map log of image %lld: %s", correlationId, errorMessage.c_str()), SOURCEINFO));
+        return;
+    }
 
-                    struct ImageList *oldImageList = subscription->addImage(image);
+    const SubscriptionStateDefn *entry = m_subscriptions.get(pending.m_subscriptionRegistrationId);
 
-                    if (nullptr != oldImageList)
-                    {
-                        lingerResource(m_epochClock(), oldImageList);
-                    }
-                }
+    if (nullptr != entry)
+    {
+        std::shared_ptr<Subscription> subscription = entry->m_subscription.lock();
+
+        if (subscription != nullptr && !(subscription->hasImage(correlationId)))
+        {
+            UnsafeBufferPosition subscriberPosition(m_counterValuesBuffer, pending.m_subscriberPositionIndicatorId);
+
+            Image *image = new Image(
+                pending.m_sessionId,
+                correlationId,
+                subscription->registrationId(),
+                pending.m_sourceIdentity,
+                subscriberPosition,
+                logBuffers,
+                m_errorHandler);
+
+            entry->m_onAvailableImageHandler(*image);
+
+            struct ImageList *oldImageList = subscription->addImage(m_imageListPool, image);
+
+            if (nullptr != oldImageList)
+            {
+                lingerResource(m_epochClock(), oldImageList);
             }
-        });
+        }
+    }
 }
 
 void ClientConductor::onUnavailableImage(
@@ -661,39 +874,46 @@ void ClientConductor::onUnavailableImage(
     const long long now = m_epochClock();
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    std::for_each(m_subscriptions.begin(), m_subscriptions.end(),
-        [&](const SubscriptionStateDefn &entry)
-        {
-            if (subscriptionRegistrationId == entry.m_registrationId)
-            {
-                std::shared_ptr<Subscription> subscription = entry.m_subscription.lock();
+    m_pendingImages.erase(correlationId);
 
-                if (nullptr != subscription)
-                {
-                    std::pair<struct ImageList *,int> result = subscription->removeImage(correlationId);
-                    struct ImageList *oldImageList = result.first;
-                    const int index = result.second;
+    const SubscriptionStateDefn *entry = m_subscriptions.get(subscriptionRegistrationId);
 
-                    if (nullptr != oldImageList)
-                    {
-                        Image* oldArray = oldImageList->m_images;
+    if (nullptr != entry)
+    {
+        std::shared_ptr<Subscription> subscription = entry->m_subscription.lock();
 
-                        lingerResource(now, oldArray[index].logBuffers());
-                        lingerResource(now, oldImageList);
-                        entry.m_onUnavailableImageHandler(oldArray[index]);
-                    }
-                }
+        if (nullptr != subscription)
+        {
+            std::pair<struct ImageList *,int> result = subscription->removeImage(m_imageListPool, correlationId);
+            struct ImageList *oldImageList = result.first;
+            const int index = result.second;
+
+            if (nullptr != oldImageList)
+            {
+                Image *image = oldImageList->m_images[index];
+
+                lingerResource(now, image->logBuffers());
+                lingerResource(now, oldImageList);
+                entry->m_onUnavailableImageHandler(*image);
             }
-        });
+        }
+    }
 }
 
 void ClientConductor::onInterServiceTimeout(long long now)
 {
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
-    std::for_each(m_publications.begin(), m_publications.end(),
-        [&](PublicationStateDefn& entry)
+    std::vector<on_add_publication_t> publicationHandlers;
+    std::vector<on_add_exclusive_publication_t> exclusivePublicationHandlers;
+    std::vector<on_add_subscription_t> subscriptionHandlers;
+
+    m_publications.forEach(
+        [&](std::int64_t, PublicationStateDefn& entry)
         {
+            std::move(
+                entry.m_onAddHandlers.begin(), entry.m_onAddHandlers.end(), std::back_inserter(publicationHandlers));
+
             std::shared_ptr<Publication> pub = entry.m_publication.lock();
 
             if (nullptr != pub)
@@ -703,10 +923,16 @@ void ClientConductor::onInterServiceTimeout(long long now)
         });
 
     m_publications.clear();
+    m_publicationIdByChannelAndStreamId.clear();
 
-    std::for_each(m_exclusivePublications.begin(), m_exclusivePublications.end(),
-        [&](ExclusivePublicationStateDefn& entry)
+    m_exclusivePublications.forEach(
+        [&](std::int64_t, ExclusivePublicationStateDefn& entry)
         {
+            std::move(
+                entry.m_onAddHandlers.begin(),
+                entry.m_onAddHandlers.end(),
+                std::back_inserter(exclusivePublicationHandlers));
+
             std::shared_ptr<ExclusivePublication> pub = entry.m_publication.lock();
 
             if (nullptr != pub)
@@ -717,24 +943,38 @@ void ClientConductor::onInterServiceTimeout(long long now)
 
     m_exclusivePublications.clear();
 
-    std::for_each(m_subscriptions.begin(), m_subscriptions.end(),
-        [&](SubscriptionStateDefn& entry)
+    m_subscriptions.forEach(
+        [&](std::int64_t, SubscriptionStateDefn& entry)
         {
+            std::move(
+                entry.m_onAddHandlers.begin(), entry.m_onAddHandlers.end(), std::back_inserter(subscriptionHandlers));
+
             std::shared_ptr<Subscription> sub = entry.m_subscription.lock();
 
             if (nullptr != sub)
             {
-                lingerAllResources(now, sub->removeAndCloseAllImages());
+                lingerAllResources(now, sub->removeAndCloseAllImages(m_imageListPool));
             }
         });
 
     m_subscriptions.clear();
+
+    publishAwaitingRegistrations(now, new awaiting_registrations_t());
+
+    const std::exception_ptr error = std::make_exception_ptr(ConductorServiceTimeoutException(
+        strPrintf("Timeout between service calls over %d ms", m_interServiceTimeoutMs), SOURCEINFO));
+
+    failRegistration(publicationHandlers, error);
+    failRegistration(exclusivePublicationHandlers, error);
+    failRegistration(subscriptionHandlers, error);
 }
 
 void ClientConductor::onCheckManagedResources(long long now)
 {
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
 
+    timeoutRegistrationHandlers(now);
+
     // erase-remove idiom
 
     // check LogBuffers
@@ -746,14 +986,29 @@ void ClientConductor::onCheckManagedResources(long long now)
 
     m_lingeringLogBuffers.erase(logIt, m_lingeringLogBuffers.end());
 
+    // forget logs that are no longer mapped and keep the rest of the lazily mapped ones to a window of terms
+    for (auto it = m_logBuffersByFileName.begin(); it != m_logBuffersByFileName.end();)
+    {
+        std::shared_ptr<LogBuffers> logBuffers = it->second.lock();
+
+        if (!logBuffers)
+        {
+            it = m_logBuffersByFileName.erase(it);
+        }
+        else
+        {
+            logBuffers->releaseInactiveTerms();
+            ++it;
+        }
+    }
+
     // check old arrays
     auto arrayIt = std::remove_if(m_lingeringImageLists.begin(), m_lingeringImageLists.end(),
         [now, this](ImageListLingerDefn & entry)
         {
             if (now > (entry.m_timeOfLastStatusChange + m_resourceLingerTimeoutMs))
             {
-                delete[] entry.m_imageList->m_images;
-                delete entry.m_imageList;
+                m_imageListPool.release(entry.m_imageList);
                 entry.m_imageList = nullptr;
                 return true;
             }
@@ -762,6 +1017,23 @@ void ClientConductor::onCheckManagedResources(long long now)
         });
 
     m_lingeringImageLists.erase(arrayIt, m_lingeringImageLists.end());
+
+    // check old awaiting registrations
+    auto registrationsIt = std::remove_if(
+        m_lingeringAwaitingRegistrations.begin(), m_lingeringAwaitingRegistrations.end(),
+        [now, this](AwaitingRegistrationsLingerDefn& entry)
+        {
+            if (now > (entry.m_timeOfLastStatusChange + m_resourceLingerTimeoutMs))
+            {
+                delete entry.m_registrations;
+                entry.m_registrations = nullptr;
+                return true;
+            }
+
+            return false;
+        });
+
+    m_lingeringAwaitingRegistrations.erase(registrationsIt, m_lingeringAwaitingRegistrations.end());
 }
 
 void ClientConductor::lingerResource(long long now, struct ImageList *imageList)
@@ -774,17 +1046,307 @@ void ClientConductor::lingerResource(long long now, std::shared_ptr<LogBuffers>
     m_lingeringLogBuffers.emplace_back(now, logBuffers);
 }
 
+std::shared_ptr<LogBuffers> ClientConductor::getLogBuffers(const std::string& logFileName)
+{
+    std::weak_ptr<LogBuffers>& entry = m_logBuffersByFileName[logFileName];
+    std::shared_ptr<LogBuffers> logBuffers = entry.lock();
+
+    if (!logBuffers)
+    {
+        logBuffers = std::make_shared<LogBuffers>(
+            logFileName.c_str(), m_preTouchMappedMemory, m_lockMappedMemory, m_lazyMapLogBuffers);
+        entry = logBuffers;
+    }
+
+    return logBuffers;
+}
+
+void ClientConductor::mapLogBuffers(const std::string& logFileName, const on_log_buffers_mapped_t& onMapped)
+{
+    if (nullptr == m_logBuffersMapper)
+    {
+        onMapped(getLogBuffers(logFileName), std::string());
+        return;
+    }
+
+    auto it = m_logBuffersByFileName.find(logFileName);
+    if (it != m_logBuffersByFileName.end())
+    {
+        std::shared_ptr<LogBuffers> logBuffers = it->second.lock();
+
+        if (logBuffers)
+        {
+            onMapped(logBuffers, std::string());
+            return;
+        }
+    }
+
+    std::vector<on_log_buffers_mapped_t>& pending = m_pendingLogBuffers[logFileName];
+    if (pending.empty())
+    {
+        m_logBuffersMapper->map(logFileName);
+    }
+
+    pending.push_back(onMapped);
+}
+
+int ClientConductor::onLogBuffersMapped()
+{
+    if (nullptr == m_logBuffersMapper)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+    return m_logBuffersMapper->drainMapped(
+        [&](LogBuffersMapper::Mapped& mapped)
+        {
+            auto it = m_pendingLogBuffers.find(mapped.m_logFileName);
+            if (it == m_pendingLogBuffers.end())
+            {
+                return;
+            }
+
+            std::vector<on_log_buffers_mapped_t> pending;
+            pending.swap(it->second);
+            m_pendingLogBuffers.erase(it);
+
+            if (mapped.m_logBuffers)
+            {
+                m_logBuffersByFileName[mapped.m_logFileName] = mapped.m_logBuffers;
+            }
+
+            for (const on_log_buffers_mapped_t& onMapped : pending)
+            {
+                onMapped(mapped.m_logBuffers, mapped.m_errorMessage);
+            }
+        });
+}
+
+void ClientConductor::addAwaitingRegistration(std::int64_t registrationId, long long now)
+{
+    const awaiting_registrations_t *current = m_awaitingRegistrations.load(std::memory_order_relaxed);
+    auto updated = new awaiting_registrations_t(*current);
+
+    auto it = std::lower_bound(updated->begin(), updated->end(), registrationId,
+        [](const AwaitingRegistrationDefn& entry, std::int64_t id)
+        {
+            return entry.m_registrationId < id;
+        });
+
+    updated->insert(it, AwaitingRegistrationDefn{registrationId, now});
+    publishAwaitingRegistrations(now, updated);
+}
+
+void ClientConductor::removeAwaitingRegistration(std::int64_t registrationId)
+{
+    const awaiting_registrations_t *current = m_awaitingRegistrations.load(std::memory_order_relaxed);
+
+    auto it = findAwaitingRegistration(*current, registrationId);
+    if (it == current->end())
+    {
+        return;
+    }
+
+    auto updated = new awaiting_registrations_t(*current);
+    updated->erase(updated->begin() + (it - current->begin()));
+    publishAwaitingRegistrations(m_epochClock(), updated);
+}
+
+void ClientConductor::publishAwaitingRegistrations(long long now, const awaiting_registrations_t *registrations)
+{
+    const awaiting_registrations_t *old = m_awaitingRegistrations.exchange(registrations, std::memory_order_acq_rel);
+
+    m_lingeringAwaitingRegistrations.emplace_back(now, old);
+}
+
+void ClientConductor::completePublicationRegistration(std::int64_t registrationId)
+{
+    PublicationStateDefn *state = m_publications.get(registrationId);
+
+    if (nullptr != state)
+    {
+        completeRegistration(state->m_onAddHandlers, [&]() { return findPublication(registrationId); });
+    }
+}
+
+void ClientConductor::completeExclusivePublicationRegistration(std::int64_t registrationId)
+{
+    ExclusivePublicationStateDefn *state = m_exclusivePublications.get(registrationId);
+
+    if (nullptr != state)
+    {
+        completeRegistration(state->m_onAddHandlers, [&]() { return findExclusivePublication(registrationId); });
+    }
+}
+
+void ClientConductor::completeSubscriptionRegistration(std::int64_t registrationId)
+{
+    SubscriptionStateDefn *state = m_subscriptions.get(registrationId);
+
+    if (nullptr != state)
+    {
+        completeRegistration(state->m_onAddHandlers, [&]() { return findSubscription(registrationId); });
+    }
+}
+
+void ClientConductor::timeoutRegistrationHandlers(long long now)
+{
+    std::vector<std::int64_t> publicationIds;
+    std::vector<std::int64_t> exclusivePublicationIds;
+    std::vector<std::int64_t> subscriptionIds;
+    const long long deadline = now - m_driverTimeoutMs;
+
+    m_publications.forEach(
+        [&](std::int64_t registrationId, PublicationStateDefn& entry)
+        {
+            if (!entry.m_onAddHandlers.empty() && entry.m_timeOfRegistration < deadline)
+            {
+                publicationIds.push_back(registrationId);
+            }
+        });
+
+    m_exclusivePublications.forEach(
+        [&](std::int64_t registrationId, ExclusivePublicationStateDefn& entry)
+        {
+            if (!entry.m_onAddHandlers.empty() && entry.m_timeOfRegistration < deadline)
+            {
+                exclusivePublicationIds.push_back(registrationId);
+            }
+        });
+
+    m_subscriptions.forEach(
+        [&](std::int64_t registrationId, SubscriptionStateDefn& entry)
+        {
+            if (!entry.m_onAddHandlers.empty() && entry.m_timeOfRegistration < deadline)
+            {
+                subscriptionIds.push_back(registrationId);
+            }
+        });
+
+    // handlers may add or release resources so complete them once iteration is over
+    for (std::int64_t registrationId : publicationIds)
+    {
+        completePublicationRegistration(registrationId);
+    }
+
+    for (std::int64_t registrationId : exclusivePublicationIds)
+    {
+        completeExclusivePublicationRegistration(registrationId);
+    }
+
+    for (std::int64_t registrationId : subscriptionIds)
+    {
+        completeSubscriptionRegistration(registrationId);
+    }
+}
+
 void ClientConductor::lingerAllResources(long long now, struct ImageList *imageList)
 {
     if (nullptr != imageList)
     {
         for (std::size_t i = 0; i < imageList->m_length; i++)
         {
-            lingerResource(now, imageList->m_images[i].logBuffers());
+            lingerResource(now, imageList->m_images[i]->logBuffers());
         }
 
         lingerResource(now, imageList);
     }
 }
 
+void ClientConductor::dispatchHandlers()
+{
+    std::shared_ptr<CallbackDispatcher> dispatcher = m_callbackDispatcher;
+
+    exception_handler_t errorHandler = m_errorHandler;
+    m_errorHandler =
+        [dispatcher, errorHandler](const std::exception& exception)
+        {
+            std::exception_ptr copy = CallbackDispatcher::copyException(exception);
+
+            dispatcher->enqueue(
+                [errorHandler, copy]()
+                {
+                    try
+                    {
+                        std::rethrow_exception(copy);
+                    }
+                    catch (const std::exception& ex)
+                    {
+                        errorHandler(ex);
+                    }
+                });
+        };
+
+    on_new_publication_t newPublicationHandler = m_onNewPublicationHandler;
+    m_onNewPublicationHandler =
+        [dispatcher, newPublicationHandler](
+            const std::string& channel, std::int32_t streamId, std::int32_t sessionId, std::int64_t correlationId)
+        {
+            dispatcher->enqueue(
+                [newPublicationHandler, channel, streamId, sessionId, correlationId]()
+                {
+                    newPublicationHandler(channel, streamId, sessionId, correlationId);
+                });
+        };
+
+    on_new_subscription_t newSubscriptionHandler = m_onNewSubscriptionHandler;
+    m_onNewSubscriptionHandler =
+        [dispatcher, newSubscriptionHandler](
+            const std::string& channel, std::int32_t streamId, std::int64_t correlationId)
+        {
+            dispatcher->enqueue(
+                [newSubscriptionHandler, channel, streamId, correlationId]()
+                {
+                    newSubscriptionHandler(channel, streamId, correlationId);
+                });
+        };
+
+    on_available_counter_t availableCounterHandler = m_onAvailableCounterHandler;
+    m_onAvailableCounterHandler =
+        [dispatcher, availableCounterHandler](
+            CountersReader& countersReader, std::int64_t registrationId, std::int32_t counterId)
+        {
+            CountersReader *reader = &countersReader;
+            dispatcher->enqueue(
+                [availableCounterHandler, reader, registrationId, counterId]()
+                {
+                    availableCounterHandler(*reader, registrationId, counterId);
+                });
+        };
+
+    on_unavailable_counter_t unavailableCounterHandler = m_onUnavailableCounterHandler;
+    m_onUnavailableCounterHandler =
+        [dispatcher, unavailableCounterHandler](
+            CountersReader& countersReader, std::int64_t registrationId, std::int32_t counterId)
+        {
+            CountersReader *reader = &countersReader;
+            dispatcher->enqueue(
+                [unavailableCounterHandler, reader, registrationId, counterId]()
+                {
+                    unavailableCounterHandler(*reader, registrationId, counterId);
+                });
+        };
+}
+
+on_available_image_t ClientConductor::dispatchImageHandler(const on_available_image_t& handler)
+{
+    if (nullptr == m_callbackDispatcher)
+    {
+        return handler;
+    }
+
+    std::shared_ptr<CallbackDispatcher> dispatcher = m_callbackDispatcher;
+
+    return
+        [dispatcher, handler](Image& image)
+        {
+            // a copy holds the log buffers so the image stays readable however long the callback waits
+            std::shared_ptr<Image> copy = std::make_shared<Image>(image);
+
+            dispatcher->enqueue([handler, copy]() { handler(*copy); });
+        };
+}
+
 }
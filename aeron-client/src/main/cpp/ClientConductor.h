@@ -18,10 +18,16 @@
 #define INCLUDED_AERON_CLIENT_CONDUCTOR__
 
 #include <vector>
+#include <unordered_map>
 #include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <exception>
 #include <concurrent/logbuffer/TermReader.h>
 #include <concurrent/status/UnsafeBufferPosition.h>
+#include <concurrent/status/HeartbeatTimestamp.h>
 #include <util/LangUtil.h>
+#include <util/FlatMap.h>
 #include "Publication.h"
 #include "ExclusivePublication.h"
 #include "Subscription.h"
@@ -30,6 +36,7 @@
 #include "Context.h"
 #include "DriverListenerAdapter.h"
 #include "LogBuffers.h"
+#include "LogBuffersMapper.h"
 
 namespace aeron {
 
@@ -43,6 +50,19 @@ typedef std::function<long long()> nano_clock_t;
 static const long KEEPALIVE_TIMEOUT_MS = 500;
 static const long RESOURCE_TIMEOUT_MS = 1000;
 
+/**
+ * Function called once when an asynchronous add completes. On success the resource is given and the exception_ptr is
+ * null, on failure the resource is null and the exception_ptr holds the RegistrationException, DriverTimeoutException
+ * or ConductorServiceTimeoutException that find would have thrown.
+ *
+ * Called from the client conductor thread, or from within AgentInvoker::invoke when the conductor is invoked.
+ */
+typedef std::function<void(std::shared_ptr<Publication>, std::exception_ptr)> on_add_publication_t;
+
+typedef std::function<void(std::shared_ptr<ExclusivePublication>, std::exception_ptr)> on_add_exclusive_publication_t;
+
+typedef std::function<void(std::shared_ptr<Subscription>, std::exception_ptr)> on_add_subscription_t;
+
 class ClientConductor
 {
 public:
@@ -60,7 +80,12 @@ public:
         const on_unavailable_counter_t& unavailableCounterHandler,
         long driverTimeoutMs,
         long resourceLingerTimeoutMs,
-        long long interServiceTimeoutNs) :
+        long long interServiceTimeoutNs,
+        bool preTouchMappedMemory = false,
+        bool lockMappedMemory = false,
+        bool lazyMapLogBuffers = false,
+        bool mapLogBuffersInBackground = false,
+        std::shared_ptr<CallbackDispatcher> callbackDispatcher = nullptr) :
         m_driverProxy(driverProxy),
         m_driverListenerAdapter(broadcastReceiver, *this),
         m_countersReader(counterMetadataBuffer, counterValuesBuffer),
@@ -77,8 +102,22 @@ public:
         m_driverTimeoutMs(driverTimeoutMs),
         m_resourceLingerTimeoutMs(resourceLingerTimeoutMs),
         m_interServiceTimeoutMs(static_cast<long>(interServiceTimeoutNs / 1000000)),
+        m_preTouchMappedMemory(preTouchMappedMemory),
+        m_lockMappedMemory(lockMappedMemory),
+        m_lazyMapLogBuffers(lazyMapLogBuffers),
+        m_callbackDispatcher(std::move(callbackDispatcher)),
         m_driverActive(true)
     {
+        if (mapLogBuffersInBackground)
+        {
+            m_logBuffersMapper.reset(
+                new LogBuffersMapper(preTouchMappedMemory, lockMappedMemory, lazyMapLogBuffers));
+        }
+
+        if (nullptr != m_callbackDispatcher)
+        {
+            dispatchHandlers();
+        }
     }
 
     virtual ~ClientConductor();
@@ -92,6 +131,7 @@ public:
         int workCount = 0;
 
         workCount += m_driverListenerAdapter.receiveMessages();
+        workCount += onLogBuffersMapped();
         workCount += onHeartbeatCheckTimeouts();
 
         return workCount;
@@ -102,10 +142,16 @@ public:
     }
 
     std::int64_t addPublication(const std::string& channel, std::int32_t streamId);
+    std::int64_t addPublication(
+        const std::string& channel, std::int32_t streamId, const on_add_publication_t& onAddPublicationHandler);
     std::shared_ptr<Publication> findPublication(std::int64_t registrationId);
     void releasePublication(std::int64_t registrationId);
 
     std::int64_t addExclusivePublication(const std::string& channel, std::int32_t streamId);
+    std::int64_t addExclusivePublication(
+        const std::string& channel,
+        std::int32_t streamId,
+        const on_add_exclusive_publication_t& onAddExclusivePublicationHandler);
     std::shared_ptr<ExclusivePublication> findExclusivePublication(std::int64_t registrationId);
     void releaseExclusivePublication(std::int64_t registrationId);
 
@@ -114,6 +160,47 @@ public:
         std::int32_t streamId,
         const on_available_image_t &onAvailableImageHandler,
         const on_unavailable_image_t &onUnavailableImageHandler);
+    std::int64_t addSubscription(
+        const std::string& channel,
+        std::int32_t streamId,
+        const on_available_image_t &onAvailableImageHandler,
+        const on_unavailable_image_t &onUnavailableImageHandler,
+        const on_add_subscription_t &onAddSubscriptionHandler);
+    /**
+     * Call func with the commands it issues to the driver through this conductor accumulated and written to the
+     * to-driver ring in as few claims as possible once it returns. Nested calls join the outer batch.
+     */
+    template <typename F>
+    void batchCommands(F&& func)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+        if (m_driverProxy.isBatching())
+        {
+            func();
+            return;
+        }
+
+        m_driverProxy.beginBatch();
+
+        try
+        {
+            func();
+        }
+        catch (...)
+        {
+            m_driverProxy.commitBatch();
+            throw;
+        }
+
+        m_driverProxy.commitBatch();
+    }
+
+    std::vector<std::int64_t> addSubscriptions(
+        const std::vector<std::pair<std::string, std::int32_t>>& channelsAndStreamIds,
+        const on_available_image_t &onAvailableImageHandler,
+        const on_unavailable_image_t &onUnavailableImageHandler,
+        const on_add_subscription_t &onAddSubscriptionHandler);
     std::shared_ptr<Subscription> findSubscription(std::int64_t registrationId);
     void releaseSubscription(std::int64_t registrationId, struct ImageList *imageList);
 
@@ -183,6 +270,16 @@ public:
         return m_countersReader;
     }
 
+    /**
+     * The handler errors of the client are reported to, which runs through the CallbackDispatcher if there is one.
+     *
+     * @return the handler errors of the client are reported to.
+     */
+    inline exception_handler_t& errorHandler()
+    {
+        return m_errorHandler;
+    }
+
     inline std::int64_t channelStatus(std::int32_t counterId)
     {
         switch (counterId)
@@ -198,6 +295,21 @@ public:
         }
     }
 
+    /**
+     * Lock free check used by the find methods. A registration not found, or past the driver timeout, is left to the
+     * locked path to report.
+     *
+     * @param registrationId of the publication, subscription, or counter.
+     * @return true if the registration is still within the driver timeout awaiting a response from the driver.
+     */
+    inline bool isAwaitingMediaDriver(std::int64_t registrationId)
+    {
+        const awaiting_registrations_t *registrations = m_awaitingRegistrations.load(std::memory_order_acquire);
+        auto it = findAwaitingRegistration(*registrations, registrationId);
+
+        return it != registrations->end() && m_epochClock() <= (it->m_timeOfRegistration + m_driverTimeoutMs);
+    }
+
 protected:
     void onCheckManagedResources(long long now);
 
@@ -226,6 +338,7 @@ private:
         std::string m_errorMessage;
         std::shared_ptr<LogBuffers> m_buffers;
         std::weak_ptr<Publication> m_publication;
+        std::vector<on_add_publication_t> m_onAddHandlers;
 
         PublicationStateDefn(
             const std::string& channel, std::int64_t registrationId, std::int32_t streamId, long long now) :
@@ -249,6 +362,7 @@ private:
         std::string m_errorMessage;
         std::shared_ptr<LogBuffers> m_buffers;
         std::weak_ptr<ExclusivePublication> m_publication;
+        std::vector<on_add_exclusive_publication_t> m_onAddHandlers;
 
         ExclusivePublicationStateDefn(
             const std::string& channel, std::int64_t registrationId, std::int32_t streamId, long long now) :
@@ -257,11 +371,19 @@ private:
         }
     };
 
+    /*
+     * Range of stream ids set with streams=low-high on a subscription channel, whose images the driver hands over for
+     * any stream in range. low and high are left as they are when the channel does not set a valid range.
+     */
+    static void streamRange(const std::string& channel, std::int32_t& low, std::int32_t& high);
+
     struct SubscriptionStateDefn
     {
         std::string m_channel;
         std::int64_t m_registrationId;
         std::int32_t m_streamId;
+        std::int32_t m_streamIdLow;
+        std::int32_t m_streamIdHigh;
         long long m_timeOfRegistration;
         RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
         std::int32_t m_errorCode;
@@ -270,6 +392,7 @@ private:
         std::weak_ptr<Subscription> m_subscription;
         on_available_image_t m_onAvailableImageHandler;
         on_unavailable_image_t m_onUnavailableImageHandler;
+        std::vector<on_add_subscription_t> m_onAddHandlers;
 
         SubscriptionStateDefn(
             const std::string& channel,
@@ -281,10 +404,13 @@ private:
             m_channel(channel),
             m_registrationId(registrationId),
             m_streamId(streamId),
+            m_streamIdLow(streamId),
+            m_streamIdHigh(streamId),
             m_timeOfRegistration(now),
             m_onAvailableImageHandler(onAvailableImageHandler),
             m_onUnavailableImageHandler(onUnavailableImageHandler)
         {
+            streamRange(channel, m_streamIdLow, m_streamIdHigh);
         }
     };
 
@@ -328,15 +454,78 @@ private:
         }
     };
 
+    /*
+     * Registrations still awaiting the media driver, sorted by registration id. Published copy on write under the
+     * admin lock so the find methods, which applications poll until a registration completes, can answer "not yet"
+     * without taking the lock. Replaced lists linger for the resource linger timeout before being freed.
+     */
+    struct AwaitingRegistrationDefn
+    {
+        std::int64_t m_registrationId;
+        long long m_timeOfRegistration;
+    };
+
+    typedef std::vector<AwaitingRegistrationDefn> awaiting_registrations_t;
+
+    struct AwaitingRegistrationsLingerDefn
+    {
+        long long m_timeOfLastStatusChange;
+        const awaiting_registrations_t *m_registrations;
+
+        AwaitingRegistrationsLingerDefn(long long now, const awaiting_registrations_t *registrations) :
+            m_timeOfLastStatusChange(now), m_registrations(registrations)
+        {
+        }
+    };
+
     std::recursive_mutex m_adminLock;
 
-    std::vector<PublicationStateDefn> m_publications;
-    std::vector<ExclusivePublicationStateDefn> m_exclusivePublications;
-    std::vector<SubscriptionStateDefn> m_subscriptions;
-    std::vector<CounterStateDefn> m_counters;
+    std::atomic<const awaiting_registrations_t*> m_awaitingRegistrations{new awaiting_registrations_t()};
+    std::vector<AwaitingRegistrationsLingerDefn> m_lingeringAwaitingRegistrations;
+
+    struct ChannelAndStreamIdHash
+    {
+        inline std::size_t operator()(const std::pair<std::string, std::int32_t>& key) const
+        {
+            return std::hash<std::string>()(key.first) ^ (static_cast<std::size_t>(key.second) * 31);
+        }
+    };
+
+    util::FlatMap<std::int64_t, PublicationStateDefn> m_publications;
+    util::FlatMap<std::int64_t, ExclusivePublicationStateDefn> m_exclusivePublications;
+    util::FlatMap<std::int64_t, SubscriptionStateDefn> m_subscriptions;
+    util::FlatMap<std::int64_t, CounterStateDefn> m_counters;
+    std::unordered_map<std::pair<std::string, std::int32_t>, std::int64_t, ChannelAndStreamIdHash>
+        m_publicationIdByChannelAndStreamId;
 
     std::vector<LogBuffersLingerDefn> m_lingeringLogBuffers;
+
+    /*
+     * Mapped logs by file name so a log shared by several publications, or lingering after one is released, is only
+     * mapped once. Entries stay while any Publication, Image or linger holds the LogBuffers. Lazily mapped logs have
+     * their inactive terms released on each check of managed resources.
+     */
+    std::unordered_map<std::string, std::weak_ptr<LogBuffers>> m_logBuffersByFileName;
+
+    /*
+     * With logs mapped in the background, what to do with each log once mapped by file name, and the images that
+     * wait on their log by correlation id. An image that goes unavailable before its log is mapped is dropped.
+     */
+    typedef std::function<void(std::shared_ptr<LogBuffers>, const std::string&)> on_log_buffers_mapped_t;
+
+    struct PendingImageDefn
+    {
+        std::int32_t m_streamId;
+        std::int32_t m_sessionId;
+        std::string m_sourceIdentity;
+        std::int32_t m_subscriberPositionIndicatorId;
+        std::int64_t m_subscriptionRegistrationId;
+    };
+
+    std::unordered_map<std::string, std::vector<on_log_buffers_mapped_t>> m_pendingLogBuffers;
+    std::unordered_map<std::int64_t, PendingImageDefn> m_pendingImages;
     std::vector<ImageListLingerDefn> m_lingeringImageLists;
+    ImageListPool m_imageListPool;
 
     DriverProxy& m_driverProxy;
     DriverListenerAdapter<ClientConductor> m_driverListenerAdapter;
@@ -352,14 +541,24 @@ private:
 
     epoch_clock_t m_epochClock;
     long long m_timeOfLastKeepalive;
+    std::int32_t m_heartbeatTimestampId = HeartbeatTimestamp::NULL_COUNTER_ID;
     long long m_timeOfLastCheckManagedResources;
     long long m_timeOfLastDoWork;
     long m_driverTimeoutMs;
     long m_resourceLingerTimeoutMs;
     long m_interServiceTimeoutMs;
+    bool m_preTouchMappedMemory;
+    bool m_lockMappedMemory;
+    bool m_lazyMapLogBuffers;
+    std::shared_ptr<CallbackDispatcher> m_callbackDispatcher;
 
     std::atomic<bool> m_driverActive;
 
+    std::unique_ptr<LogBuffersMapper> m_logBuffersMapper;
+
+    void dispatchHandlers();
+    on_available_image_t dispatchImageHandler(const on_available_image_t& handler);
+
     inline int onHeartbeatCheckTimeouts()
     {
         // TODO: use system nano clock since it is quicker to poll, then use epochClock only for driver activity
@@ -380,7 +579,7 @@ private:
 
         if (now > (m_timeOfLastKeepalive + KEEPALIVE_TIMEOUT_MS))
         {
-            m_driverProxy.sendClientKeepalive();
+            sendHeartbeat(now);
 
             if (now > (m_driverProxy.timeOfLastDriverKeepalive() + m_driverTimeoutMs))
             {
@@ -405,6 +604,129 @@ private:
         return result;
     }
 
+    /*
+     * Once the driver has allocated the heartbeat timestamp counter for this client a plain ordered store to it
+     * replaces the keepalive command. Keepalives are sent until the counter is found or if it is freed.
+     */
+    inline void sendHeartbeat(long long now)
+    {
+        const std::int64_t clientId = m_driverProxy.clientId();
+
+        if (HeartbeatTimestamp::NULL_COUNTER_ID == m_heartbeatTimestampId ||
+            !HeartbeatTimestamp::isActive(
+                m_countersReader, m_heartbeatTimestampId, HeartbeatTimestamp::CLIENT_HEARTBEAT_TYPE_ID, clientId))
+        {
+            m_heartbeatTimestampId = HeartbeatTimestamp::findCounterIdByRegistrationId(
+                m_countersReader, HeartbeatTimestamp::CLIENT_HEARTBEAT_TYPE_ID, clientId);
+        }
+
+        if (HeartbeatTimestamp::NULL_COUNTER_ID != m_heartbeatTimestampId)
+        {
+            m_counterValuesBuffer.putInt64Ordered(CountersReader::counterOffset(m_heartbeatTimestampId), now);
+        }
+        else
+        {
+            m_driverProxy.sendClientKeepalive();
+        }
+    }
+
+    std::shared_ptr<LogBuffers> getLogBuffers(const std::string& logFileName);
+
+    /*
+     * Call onMapped with the log once mapped. Without a mapper, or when the log is already mapped, that is straight
+     * away and a failure to map throws as getLogBuffers does. Otherwise it is from onLogBuffersMapped in a later duty
+     * cycle, with null LogBuffers and the reason should the mapping fail.
+     */
+    void mapLogBuffers(const std::string& logFileName, const on_log_buffers_mapped_t& onMapped);
+    int onLogBuffersMapped();
+
+    void onPublicationLogBuffersMapped(
+        std::int64_t registrationId,
+        std::int32_t streamId,
+        std::shared_ptr<LogBuffers> logBuffers,
+        const std::string& errorMessage);
+    void onExclusivePublicationLogBuffersMapped(
+        std::int64_t registrationId,
+        std::int32_t streamId,
+        std::shared_ptr<LogBuffers> logBuffers,
+        const std::string& errorMessage);
+    void onImageLogBuffersMapped(
+        std::int64_t correlationId, std::shared_ptr<LogBuffers> logBuffers, const std::string& errorMessage);
+
+    void addAwaitingRegistration(std::int64_t registrationId, long long now);
+    void removeAwaitingRegistration(std::int64_t registrationId);
+    void publishAwaitingRegistrations(long long now, const awaiting_registrations_t *registrations);
+
+    void completePublicationRegistration(std::int64_t registrationId);
+    void completeExclusivePublicationRegistration(std::int64_t registrationId);
+    void completeSubscriptionRegistration(std::int64_t registrationId);
+    void timeoutRegistrationHandlers(long long now);
+
+    /*
+     * Resolve the handlers of an asynchronous add through the matching find method, so they see exactly what a poller
+     * would. Handlers are moved out of the state before being called as a handler may release the resource.
+     */
+    template <typename Resource, typename Find>
+    static void completeRegistration(
+        std::vector<std::function<void(std::shared_ptr<Resource>, std::exception_ptr)>>& handlers, Find&& find)
+    {
+        if (handlers.empty())
+        {
+            return;
+        }
+
+        std::shared_ptr<Resource> resource;
+        std::exception_ptr error;
+
+        try
+        {
+            resource = find();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        if (!resource && !error)
+        {
+            return;
+        }
+
+        std::vector<std::function<void(std::shared_ptr<Resource>, std::exception_ptr)>> completed;
+        completed.swap(handlers);
+
+        for (auto& handler : completed)
+        {
+            handler(resource, error);
+        }
+    }
+
+    template <typename Resource>
+    static void failRegistration(
+        std::vector<std::function<void(std::shared_ptr<Resource>, std::exception_ptr)>>& handlers,
+        const std::exception_ptr& error)
+    {
+        std::vector<std::function<void(std::shared_ptr<Resource>, std::exception_ptr)>> failed;
+        failed.swap(handlers);
+
+        for (auto& handler : failed)
+        {
+            handler(std::shared_ptr<Resource>(), error);
+        }
+    }
+
+    inline static awaiting_registrations_t::const_iterator findAwaitingRegistration(
+        const awaiting_registrations_t& registrations, std::int64_t registrationId)
+    {
+        auto it = std::lower_bound(registrations.begin(), registrations.end(), registrationId,
+            [](const AwaitingRegistrationDefn& entry, std::int64_t id)
+            {
+                return entry.m_registrationId < id;
+            });
+
+        return (it != registrations.end() && it->m_registrationId == registrationId) ? it : registrations.end();
+    }
+
     inline void verifyDriverIsActive()
     {
         if (!m_driverActive)
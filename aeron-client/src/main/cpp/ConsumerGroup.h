@@ -0,0 +1,166 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_CONSUMERGROUP_H
+#define AERON_CONSUMERGROUP_H
+
+#include <cstdint>
+#include "Aeron.h"
+#include <util/FlatMap.h>
+
+namespace aeron {
+
+/**
+ * How the stream is split among the members of a consumer group.
+ */
+enum class ConsumerGroupPartitioning : std::uint8_t
+{
+    /** Each message goes to one member chosen by a hash of its position, spreading load most evenly. */
+    MESSAGE,
+    /** Each term goes to one member in turn, so a member sees runs of consecutive messages and keeps no state. */
+    TERM
+};
+
+/**
+ * A handler that sits in a chain-of-responsibility pattern that splits a stream among the members of a consumer group
+ * so that each message is delegated to exactly one member.
+ * <p>
+ * Each member is a Subscription of its own, typically on its own thread, to the same channel and stream with the same
+ * member count and partitioning and a distinct member index. Every member reads the whole log and skips the messages
+ * owned by others, which costs a header read per fragment but needs no coordination between members: ownership is a
+ * function of the position of a message, which every member sees the same. The driver already tracks the position of
+ * each member's subscription and holds the publisher to the slowest, so a member falling behind back pressures the
+ * stream as any other subscriber would.
+ * <p>
+ * The fragments of a message stay with the member that owns its first fragment, so a FragmentAssembler may be the
+ * delegate. Messages never span terms so TERM partitioning needs no per session state.
+ */
+class ConsumerGroupMember
+{
+public:
+    /**
+     * @param memberIndex  of this member from 0 to memberCount - 1.
+     * @param memberCount  in the group.
+     * @param delegate     onto which the messages owned by this member are forwarded.
+     * @param partitioning of the stream among the members.
+     */
+    ConsumerGroupMember(
+        int memberIndex,
+        int memberCount,
+        const fragment_handler_t& delegate,
+        ConsumerGroupPartitioning partitioning = ConsumerGroupPartitioning::MESSAGE) :
+        m_memberIndex(memberIndex),
+        m_memberCount(memberCount),
+        m_partitioning(partitioning),
+        m_delegate(delegate)
+    {
+        if (memberCount < 1 || memberIndex < 0 || memberIndex >= memberCount)
+        {
+            throw util::IllegalArgumentException(
+                util::strPrintf("invalid consumer group member: index=%d count=%d", memberIndex, memberCount),
+                SOURCEINFO);
+        }
+    }
+
+    /**
+     * Compose a fragment_handler_t that calls this ConsumerGroupMember instance. Suitable for passing to
+     * Subscription::poll(fragment_handler_t, int).
+     *
+     * @return fragment_handler_t composed with the ConsumerGroupMember instance.
+     */
+    fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            this->onFragment(buffer, offset, length, header);
+        };
+    }
+
+    /**
+     * Release the state kept for a session when its Image goes inactive.
+     *
+     * @param sessionId of the Image.
+     */
+    void deleteSession(std::int32_t sessionId)
+    {
+        m_ownsMessageBySessionIdMap.remove(sessionId);
+    }
+
+    /**
+     * Member of a group of memberCount which owns the message that begins at position.
+     */
+    static inline int ownerOfMessage(std::int64_t position, int memberCount)
+    {
+        /* positions are frame aligned and messages often alike in length, so mix before taking the remainder */
+        const std::uint64_t hash = static_cast<std::uint64_t>(position) * 0x9E3779B97F4A7C15ULL;
+
+        return static_cast<int>((hash >> 32) % static_cast<std::uint64_t>(memberCount));
+    }
+
+    /**
+     * Member of a group of memberCount which owns the messages of a term.
+     */
+    static inline int ownerOfTerm(std::int32_t termId, std::int32_t initialTermId, int memberCount)
+    {
+        const std::uint32_t termCount = static_cast<std::uint32_t>(termId - initialTermId);
+
+        return static_cast<int>(termCount % static_cast<std::uint32_t>(memberCount));
+    }
+
+private:
+    int m_memberIndex;
+    int m_memberCount;
+    ConsumerGroupPartitioning m_partitioning;
+    fragment_handler_t m_delegate;
+    util::Int32FlatMap<bool> m_ownsMessageBySessionIdMap;
+
+    inline bool ownsFragment(Header& header)
+    {
+        if (ConsumerGroupPartitioning::TERM == m_partitioning)
+        {
+            return ownerOfTerm(header.termId(), header.initialTermId(), m_memberCount) == m_memberIndex;
+        }
+
+        const std::uint8_t flags = header.flags();
+
+        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
+        {
+            return ownerOfMessage(header.position(), m_memberCount) == m_memberIndex;
+        }
+
+        bool& ownsMessage = m_ownsMessageBySessionIdMap.getOrInsert(
+            header.sessionId(), []() { return std::unique_ptr<bool>(new bool(false)); });
+
+        if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
+        {
+            ownsMessage = ownerOfMessage(header.position(), m_memberCount) == m_memberIndex;
+        }
+
+        return ownsMessage;
+    }
+
+    inline void onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        if (ownsFragment(header))
+        {
+            m_delegate(buffer, offset, length, header);
+        }
+    }
+};
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include <concurrent/broadcast/CopyBroadcastReceiver.h>
 #include <concurrent/CountersReader.h>
 #include <CncFileDescriptor.h>
+#include <CallbackDispatcher.h>
 #include <iostream>
 
 namespace aeron {
@@ -336,6 +337,100 @@ public:
         return *this;
     }
 
+    /**
+     * Set whether log buffers are faulted in when mapped, so the first messages through a new Publication or Image
+     * do not pay for page faults. Costs the time to touch the whole log on the conductor thread.
+     *
+     * @param preTouchMappedMemory to fault in log buffers when mapped or not.
+     * @return reference to this Context instance
+     */
+    inline this_t& preTouchMappedMemory(bool preTouchMappedMemory)
+    {
+        m_preTouchMappedMemory = preTouchMappedMemory;
+        return *this;
+    }
+
+    /**
+     * Set whether log buffers are locked in memory with mlock when mapped, so they are never paged out. Mapping a log
+     * fails when the memlock limit of the process does not cover it.
+     *
+     * @param lockMappedMemory to lock log buffers in memory when mapped or not.
+     * @return reference to this Context instance
+     */
+    inline this_t& lockMappedMemory(bool lockMappedMemory)
+    {
+        m_lockMappedMemory = lockMappedMemory;
+        return *this;
+    }
+
+    /**
+     * Set whether log buffers are mapped lazily, for monitoring and control clients that hold many publications or
+     * images but only read positions or read the logs now and then. Only the pages touched are faulted in, and about
+     * once a second the pages of terms outside the window of the active and next term are dropped from the mapping.
+     * Takes precedence over preTouchMappedMemory and lockMappedMemory. Streams that move through terms quickly fault
+     * their pages in again, so leave it off for clients on the hot path.
+     *
+     * @param lazyMapLogBuffers to map log buffers lazily or not.
+     * @return reference to this Context instance
+     */
+    inline this_t& lazyMapLogBuffers(bool lazyMapLogBuffers)
+    {
+        m_lazyMapLogBuffers = lazyMapLogBuffers;
+        return *this;
+    }
+
+    /**
+     * Set whether the log buffers of new publications and images are mapped on a thread of their own rather than on
+     * the conductor thread, so a client that is handed many images at once, after a failover say, keeps up its
+     * keepalives while they are pre-touched or locked. A publication is found, and an image made available to its
+     * subscription, only once its log is mapped, a duty cycle or more after the driver has it ready.
+     *
+     * @param mapLogBuffersInBackground to map log buffers off the conductor thread or not.
+     * @return reference to this Context instance
+     */
+    inline this_t& mapLogBuffersInBackground(bool mapLogBuffersInBackground)
+    {
+        m_mapLogBuffersInBackground = mapLogBuffersInBackground;
+        return *this;
+    }
+
+    /**
+     * Set the CPU the conductor agent thread is pinned to when it is not driven by an invoker. -1 leaves it
+     * unpinned.
+     *
+     * @param cpuAffinity CPU to pin the conductor thread to.
+     * @return reference to this Context instance
+     */
+    inline this_t& conductorCpuAffinity(int cpuAffinity)
+    {
+        m_conductorCpuAffinity = cpuAffinity;
+        return *this;
+    }
+
+    /**
+     * Set a dispatcher through which the client conductor runs the error, publication, subscription, image and
+     * counter handlers rather than calling them on its own thread, so a slow handler cannot stall the conductor. The
+     * application runs the dispatcher, such as on its own AgentRunner.
+     *
+     * @param callbackDispatcher to run handlers through, or nullptr to call them on the conductor thread.
+     * @return reference to this Context instance
+     */
+    inline this_t& callbackDispatcher(std::shared_ptr<CallbackDispatcher> callbackDispatcher)
+    {
+        m_callbackDispatcher = std::move(callbackDispatcher);
+        return *this;
+    }
+
+    /**
+     * Get the dispatcher through which handlers are run.
+     *
+     * @return the dispatcher through which handlers are run, or nullptr if they are called on the conductor thread.
+     */
+    inline std::shared_ptr<CallbackDispatcher> callbackDispatcher() const
+    {
+        return m_callbackDispatcher;
+    }
+
     inline static std::string tmpDir()
     {
 #if defined(_MSC_VER)
@@ -404,6 +499,12 @@ private:
     long m_mediaDriverTimeout = NULL_TIMEOUT;
     long m_resourceLingerTimeout = NULL_TIMEOUT;
     bool m_useConductorAgentInvoker = false;
+    bool m_preTouchMappedMemory = false;
+    bool m_lockMappedMemory = false;
+    bool m_lazyMapLogBuffers = false;
+    bool m_mapLogBuffersInBackground = false;
+    int m_conductorCpuAffinity = -1;
+    std::shared_ptr<CallbackDispatcher> m_callbackDispatcher;
 };
 
 }
@@ -16,8 +16,8 @@
 #ifndef AERON_CONTROLLEDFRAGMENTASSEMBLER_H
 #define AERON_CONTROLLEDFRAGMENTASSEMBLER_H
 
-#include <unordered_map>
 #include "Aeron.h"
+#include <util/FlatMap.h>
 #include "BufferBuilder.h"
 
 namespace aeron {
@@ -75,13 +75,13 @@ public:
      */
     void deleteSessionBuffer(std::int32_t sessionId)
     {
-        m_builderBySessionIdMap.erase(sessionId);
+        m_builderBySessionIdMap.remove(sessionId);
     }
 
 private:
     std::size_t m_initialBufferLength;
     controlled_poll_fragment_handler_t m_delegate;
-    std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
+    util::Int32FlatMap<BufferBuilder> m_builderBySessionIdMap;
 
     ControlledPollAction onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
     {
@@ -96,8 +96,13 @@ private:
         {
             if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
             {
-                auto result = m_builderBySessionIdMap.emplace(header.sessionId(), static_cast<std::uint32_t>(m_initialBufferLength));
-                BufferBuilder& builder = result.first->second;
+                BufferBuilder& builder = m_builderBySessionIdMap.getOrInsert(
+                    header.sessionId(),
+                    [&]()
+                    {
+                        return std::unique_ptr<BufferBuilder>(
+                            new BufferBuilder(static_cast<std::uint32_t>(m_initialBufferLength)));
+                    });
 
                 builder
                     .reset()
@@ -105,11 +110,11 @@ private:
             }
             else
             {
-                auto result = m_builderBySessionIdMap.find(header.sessionId());
+                BufferBuilder *result = m_builderBySessionIdMap.get(header.sessionId());
 
-                if (result != m_builderBySessionIdMap.end())
+                if (nullptr != result)
                 {
-                    BufferBuilder& builder = result->second;
+                    BufferBuilder& builder = *result;
                     const std::uint32_t limit = builder.limit();
 
                     if (builder.limit() != DataFrameHeader::LENGTH)
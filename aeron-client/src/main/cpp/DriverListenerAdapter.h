@@ -21,6 +21,7 @@
 #include <command/ControlProtocolEvents.h>
 #include <command/PublicationBuffersReadyFlyweight.h>
 #include <command/ImageBuffersReadyFlyweight.h>
+#include <command/ImageBuffersReadyBatchFlyweight.h>
 #include <command/ImageMessageFlyweight.h>
 #include <command/ErrorResponseFlyweight.h>
 #include <command/OperationSucceededFlyweight.h>
@@ -105,6 +106,26 @@ public:
                         break;
                     }
 
+                    case ControlProtocolEvents::ON_AVAILABLE_IMAGES:
+                    {
+                        const ImageBuffersReadyBatchFlyweight imagesReady(buffer, offset);
+                        const std::string logFileName = imagesReady.logFileName();
+                        const std::string sourceIdentity = imagesReady.sourceIdentity();
+
+                        for (std::int32_t i = 0, count = imagesReady.subscriberCount(); i < count; i++)
+                        {
+                            m_driverListener.onAvailableImage(
+                                imagesReady.streamId(),
+                                imagesReady.sessionId(),
+                                logFileName,
+                                sourceIdentity,
+                                imagesReady.subscriberPositionId(i),
+                                imagesReady.subscriberRegistrationId(i),
+                                imagesReady.correlationId());
+                        }
+                        break;
+                    }
+
                     case ControlProtocolEvents::ON_OPERATION_SUCCESS:
                     {
                         const OperationSucceededFlyweight operationSucceeded(buffer, offset);
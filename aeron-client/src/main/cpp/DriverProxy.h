@@ -18,6 +18,7 @@
 #define INCLUDED_AERON_DRIVER_PROXY__
 
 #include <array>
+#include <vector>
 #include <concurrent/ringbuffer/ManyToOneRingBuffer.h>
 #include <command/PublicationMessageFlyweight.h>
 #include <command/RemoveMessageFlyweight.h>
@@ -49,6 +50,35 @@ public:
         return m_toDriverCommandBuffer.consumerHeartbeatTime();
     }
 
+    inline std::int64_t clientId() const
+    {
+        return m_clientId;
+    }
+
+    /**
+     * Start accumulating commands rather than writing each one to the driver. The accumulated commands are written
+     * with a single claim of the to-driver ring by commitBatch, or sooner if they would exceed the max message length
+     * of the ring. Keepalives are always written directly. Not thread safe, callers must serialise batches.
+     */
+    inline void beginBatch()
+    {
+        m_batching = true;
+    }
+
+    inline bool isBatching() const
+    {
+        return m_batching;
+    }
+
+    /**
+     * Write the accumulated commands to the driver and stop batching.
+     */
+    void commitBatch()
+    {
+        m_batching = false;
+        flushBatch();
+    }
+
     std::int64_t addPublication(const std::string& channel, std::int32_t streamId)
     {
         std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
@@ -154,7 +184,7 @@ public:
 
     void sendClientKeepalive()
     {
-        writeCommandToDriver([&](AtomicBuffer& buffer, util::index_t& length)
+        writeCommandToDriver(false, [&](AtomicBuffer& buffer, util::index_t& length)
         {
             CorrelatedMessageFlyweight correlatedMessage(buffer, 0);
 
@@ -276,7 +306,18 @@ private:
     ManyToOneRingBuffer& m_toDriverCommandBuffer;
     std::int64_t m_clientId;
 
+    /// Accumulated commands, each a RecordDescriptor header holding the message length and type then the message.
+    std::vector<std::uint8_t> m_batchBuffer;
+    util::index_t m_batchLength = 0;
+    bool m_batching = false;
+
     inline void writeCommandToDriver(const std::function<util::index_t(AtomicBuffer&, util::index_t &)>& filler)
+    {
+        writeCommandToDriver(m_batching, filler);
+    }
+
+    inline void writeCommandToDriver(
+        bool batch, const std::function<util::index_t(AtomicBuffer&, util::index_t &)>& filler)
     {
         AERON_DECL_ALIGNED(driver_proxy_command_buffer_t messageBuffer, 16);
         AtomicBuffer buffer(messageBuffer);
@@ -284,11 +325,71 @@ private:
 
         util::index_t msgTypeId = filler(buffer, length);
 
-        if (!m_toDriverCommandBuffer.write(msgTypeId, buffer, 0, length))
+        if (batch)
+        {
+            appendToBatch(msgTypeId, buffer, length);
+        }
+        else if (!m_toDriverCommandBuffer.write(msgTypeId, buffer, 0, length))
         {
             throw util::IllegalStateException("couldn't write command to driver", SOURCEINFO);
         }
     }
+
+    void appendToBatch(std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t length)
+    {
+        const util::index_t recordLength = ManyToOneRingBuffer::batchRecordLength(length);
+
+        if ((m_batchLength + recordLength) > m_toDriverCommandBuffer.maxMsgLength())
+        {
+            flushBatch();
+        }
+
+        if (static_cast<std::size_t>(m_batchLength + recordLength) > m_batchBuffer.size())
+        {
+            m_batchBuffer.resize(static_cast<std::size_t>(m_batchLength + recordLength));
+        }
+
+        AtomicBuffer batchBuffer(m_batchBuffer.data(), m_batchBuffer.size());
+
+        batchBuffer.putInt32(RecordDescriptor::lengthOffset(m_batchLength), length);
+        batchBuffer.putInt32(RecordDescriptor::typeOffset(m_batchLength), msgTypeId);
+        batchBuffer.putBytes(RecordDescriptor::encodedMsgOffset(m_batchLength), buffer, 0, length);
+        m_batchLength += recordLength;
+    }
+
+    void flushBatch()
+    {
+        if (0 == m_batchLength)
+        {
+            return;
+        }
+
+        AtomicBuffer batchBuffer(m_batchBuffer.data(), m_batchBuffer.size());
+        ManyToOneRingBuffer::Batch batch;
+        const util::index_t batchLength = m_batchLength;
+
+        m_batchLength = 0;
+
+        if (!m_toDriverCommandBuffer.tryClaimBatch(batch, batchLength))
+        {
+            throw util::IllegalStateException("couldn't write command batch to driver", SOURCEINFO);
+        }
+
+        for (util::index_t offset = 0; offset < batchLength;)
+        {
+            const util::index_t length = batchBuffer.getInt32(RecordDescriptor::lengthOffset(offset));
+
+            m_toDriverCommandBuffer.writeBatch(
+                batch,
+                batchBuffer.getInt32(RecordDescriptor::typeOffset(offset)),
+                batchBuffer,
+                RecordDescriptor::encodedMsgOffset(offset),
+                length);
+            offset += ManyToOneRingBuffer::batchRecordLength(length);
+        }
+
+        m_toDriverCommandBuffer.commitBatch(batch);
+    }
 };
 
 }
@@ -46,6 +46,7 @@ ExclusivePublication::ExclusivePublication(
         LogBufferDescriptor::indexByTermCount(LogBufferDescriptor::activeTermCount(m_logMetaDataBuffer))),
     m_publicationLimit(publicationLimit),
     m_channelStatusId(channelStatusId),
+    m_isSubscriberWakeup(LogBufferDescriptor::isSubscriberWakeup(m_logMetaDataBuffer)),
     m_logbuffers(buffers),
     m_headerWriter(LogBufferDescriptor::defaultFrameHeader(m_logMetaDataBuffer))
 {
@@ -104,4 +105,10 @@ std::int64_t ExclusivePublication::channelStatus()
     return m_conductor.channelStatus(m_channelStatusId);
 }
 
+
+std::int64_t ExclusivePublication::clientPublisherLimit(std::int64_t limit)
+{
+    return LogBufferDescriptor::clientPublisherLimit(m_logMetaDataBuffer, m_conductor.countersReader(), limit);
+}
+
 }
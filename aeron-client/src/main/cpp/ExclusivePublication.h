@@ -231,6 +231,26 @@ public:
         return result;
     }
 
+    /**
+     * Park the calling thread until the driver advances the publication limit beyond the current position, rather
+     * than spinning on offer after {@link #BACK_PRESSURED}. The driver wakes waiting publishers when it moves the
+     * limit so the thread uses no CPU while it is parked.
+     *
+     * @param timeoutNs to wait at most.
+     * @return true if the limit is beyond the current position so an offer may now succeed.
+     */
+    inline bool awaitPublicationLimit(std::int64_t timeoutNs)
+    {
+        const std::int64_t currentPosition = position();
+
+        if (PUBLICATION_CLOSED == currentPosition)
+        {
+            return false;
+        }
+
+        return m_publicationLimit.awaitAbove(currentPosition, timeoutNs);
+    }
+
     /**
      * Get the counter id used to represent the publication limit.
      *
@@ -257,15 +277,17 @@ public:
      * @param buffer containing message.
      * @param offset offset in the buffer at which the encoded message begins.
      * @param length in bytes of the encoded message.
-     * @param reservedValueSupplier for the frame.
+     * @param reservedValueSupplier for the frame, any callable with the signature of on_reserved_value_supplier_t
+     * which is taken by type so it can be inlined.
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
-     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * {@link #ADMIN_ACTION}, {@link #CLOSED} or, when built with AERON_NOEXCEPT_HOT_PATH,
+     * {@link #MAX_MESSAGE_LENGTH_EXCEEDED}.
      */
-    inline std::int64_t offer(
+    template <typename ReservedValueSupplier> inline std::int64_t offer(
         concurrent::AtomicBuffer& buffer,
         util::index_t offset,
         util::index_t length,
-        const on_reserved_value_supplier_t& reservedValueSupplier)
+        const ReservedValueSupplier& reservedValueSupplier) AERON_HOT_PATH_NOEXCEPT
     {
         std::int64_t newPosition = PUBLICATION_CLOSED;
 
@@ -275,7 +297,7 @@ public:
             ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
             const std::int64_t position = m_termBeginPosition + m_termOffset;
 
-            if (position < limit)
+            if (position < limit || position < clientPublisherLimit(limit))
             {
                 std::int32_t result;
                 if (length <= m_maxPayloadLength)
@@ -291,7 +313,14 @@ public:
                 }
                 else
                 {
+#if defined(AERON_NOEXCEPT_HOT_PATH)
+                    if (length > m_maxMessageLength)
+                    {
+                        return MAX_MESSAGE_LENGTH_EXCEEDED;
+                    }
+#else
                     checkForMaxMessageLength(length);
+#endif
                     result = termAppender->appendFragmentedMessage(
                         m_termId,
                         m_termOffset,
@@ -323,9 +352,10 @@ public:
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
      * {@link #ADMIN_ACTION} or {@link #CLOSED}.
      */
-    inline std::int64_t offer(concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    inline std::int64_t offer(
+        concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length) AERON_HOT_PATH_NOEXCEPT
     {
-        return offer(buffer, offset, length, DEFAULT_RESERVED_VALUE_SUPPLIER);
+        return offer(buffer, offset, length, NoReservedValueSupplier());
     }
 
     /**
@@ -334,7 +364,7 @@ public:
      * @param buffer containing message.
      * @return The new stream position on success, otherwise {@link BACK_PRESSURED} or {@link NOT_CONNECTED}.
      */
-    inline std::int64_t offer(concurrent::AtomicBuffer& buffer)
+    inline std::int64_t offer(concurrent::AtomicBuffer& buffer) AERON_HOT_PATH_NOEXCEPT
     {
         return offer(buffer, 0, buffer.capacity());
     }
@@ -348,10 +378,10 @@ public:
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
      * {@link #ADMIN_ACTION} or {@link #CLOSED}.
      */
-    template <class BufferIterator> std::int64_t offer(
+    template <class BufferIterator, typename ReservedValueSupplier = NoReservedValueSupplier> std::int64_t offer(
         BufferIterator startBuffer,
         BufferIterator lastBuffer,
-        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
     {
         util::index_t length = 0;
         for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
@@ -377,7 +407,7 @@ public:
             ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
             const std::int64_t position = m_termBeginPosition + m_termOffset;
 
-            if (position < limit)
+            if (position < limit || position < clientPublisherLimit(limit))
             {
                 std::int32_t result;
                 if (length <= m_maxPayloadLength)
@@ -423,10 +453,10 @@ public:
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
      * {@link #ADMIN_ACTION} or {@link #CLOSED}.
      */
-    std::int64_t offer(
+    template <typename ReservedValueSupplier = NoReservedValueSupplier> std::int64_t offer(
         const concurrent::AtomicBuffer buffers[],
         size_t length,
-        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
     {
         return offer(buffers, buffers + length, reservedValueSupplier);
     }
@@ -439,13 +469,186 @@ public:
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
      * {@link #ADMIN_ACTION} or {@link #CLOSED}.
      */
-    template <size_t N> std::int64_t offer(
+    template <size_t N, typename ReservedValueSupplier = NoReservedValueSupplier> std::int64_t offer(
         const std::array<concurrent::AtomicBuffer, N>& buffers,
-        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
     {
         return offer(buffers.begin(), buffers.end(), reservedValueSupplier);
     }
 
+    /**
+     * Non-blocking publish of a batch of messages, one message per buffer, with the space for the whole batch
+     * reserved by a single store of the tail. Each message must fit in {@link #maxPayloadLength()} and the aligned
+     * length of the batch, including frame headers, must not exceed {@link #maxMessageLength()}. The batch is
+     * appended in full or not at all.
+     *
+     * @param startBuffer first message of the batch.
+     * @param lastBuffer after the last message of the batch.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position after the batch, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    template <class BufferIterator, typename ReservedValueSupplier = NoReservedValueSupplier> std::int64_t offerBatch(
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
+    {
+        const util::index_t batchLength = computeBatchLength(startBuffer, lastBuffer);
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
+            const std::int64_t position = m_termBeginPosition + m_termOffset;
+
+            if (position < limit || position < clientPublisherLimit(limit))
+            {
+                const std::int32_t result = termAppender->appendUnfragmentedBatch(
+                    m_termId,
+                    m_termOffset,
+                    m_headerWriter,
+                    startBuffer,
+                    lastBuffer,
+                    batchLength,
+                    reservedValueSupplier);
+
+                newPosition = ExclusivePublication::newPosition(result);
+            }
+            else
+            {
+                newPosition = ExclusivePublication::backPressureStatus(position, batchLength);
+            }
+        }
+
+        return newPosition;
+    }
+
+    /**
+     * Non-blocking publish of an array of buffers as a batch of messages, one message per buffer.
+     *
+     * @param buffers containing the messages.
+     * @param length of the array of buffers.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position after the batch, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    template <typename ReservedValueSupplier = NoReservedValueSupplier> std::int64_t offerBatch(
+        const concurrent::AtomicBuffer buffers[],
+        size_t length,
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
+    {
+        return offerBatch(buffers, buffers + length, reservedValueSupplier);
+    }
+
+    /**
+     * Non-blocking publish of as many messages of a batch as the stream will take, one message per buffer, for
+     * senders that would otherwise retry a batch one message at a time under back pressure. Messages are appended in
+     * runs with a single store of the tail per run, and a message is appended while the position it starts at is
+     * below the publication limit, as for offer. When the next message does not fit in the rest of the term the term
+     * is padded and the publication rotates to the next term within the call. Each message must fit in
+     * {@link #maxPayloadLength()}.
+     *
+     * @param startBuffer first message of the batch.
+     * @param lastBuffer after the last message of the batch.
+     * @param messagesOffered set to the number of messages from startBuffer that were appended.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position after the messages appended, otherwise {@link #NOT_CONNECTED},
+     * {@link #BACK_PRESSURED}, {@link #MAX_POSITION_EXCEEDED} or {@link #CLOSED} when none were appended.
+     */
+    template <class BufferIterator, typename ReservedValueSupplier = NoReservedValueSupplier>
+    std::int64_t offerPartialBatch(
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        std::size_t& messagesOffered,
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
+    {
+        messagesOffered = 0;
+
+        if (isClosed())
+        {
+            return PUBLICATION_CLOSED;
+        }
+
+        std::int64_t limit = m_publicationLimit.getVolatile();
+        bool isLimitRefreshed = false;
+        std::int64_t status = BACK_PRESSURED;
+        BufferIterator it = startBuffer;
+
+        while (it != lastBuffer)
+        {
+            const std::int64_t position = m_termBeginPosition + m_termOffset;
+
+            if (position >= limit && !isLimitRefreshed)
+            {
+                limit = clientPublisherLimit(limit);
+                isLimitRefreshed = true;
+            }
+
+            if (position >= limit)
+            {
+                status = backPressureStatus(position, it->capacity() + DataFrameHeader::LENGTH);
+                break;
+            }
+
+            const util::index_t termRemaining = termBufferLength() - m_termOffset;
+            util::index_t runLength = 0;
+            std::size_t runCount = 0;
+            BufferIterator runEnd = it;
+
+            for (; runEnd != lastBuffer; ++runEnd)
+            {
+                checkForMaxPayloadLength(runEnd->capacity());
+                const util::index_t alignedLength = util::BitUtil::align(
+                    runEnd->capacity() + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+
+                if (runLength + alignedLength > termRemaining ||
+                    runLength + alignedLength > m_maxMessageLength ||
+                    position + runLength >= limit)
+                {
+                    break;
+                }
+
+                runLength += alignedLength;
+                runCount++;
+            }
+
+            ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
+
+            if (0 == runCount)
+            {
+                // the next message trips the end of the term, which pads it so the publication can rotate
+                BufferIterator next = it;
+                ++next;
+                const std::int32_t result = termAppender->appendUnfragmentedBatch(
+                    m_termId,
+                    m_termOffset,
+                    m_headerWriter,
+                    it,
+                    next,
+                    util::BitUtil::align(it->capacity() + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT),
+                    reservedValueSupplier);
+
+                status = ExclusivePublication::newPosition(result);
+                if (MAX_POSITION_EXCEEDED == status)
+                {
+                    break;
+                }
+
+                continue;
+            }
+
+            const std::int32_t result = termAppender->appendUnfragmentedBatch(
+                m_termId, m_termOffset, m_headerWriter, it, runEnd, runLength, reservedValueSupplier);
+
+            ExclusivePublication::newPosition(result);
+            messagesOffered += runCount;
+            it = runEnd;
+        }
+
+        return (messagesOffered > 0 || it == lastBuffer) ? m_termBeginPosition + m_termOffset : status;
+    }
+
     /**
      * Try to claim a range in the publication log into which a message can be written with zero copy semantics.
      * Once the message has been written then {@link BufferClaim#commit()} should be called thus making it available.
@@ -489,7 +692,7 @@ public:
             ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
             const std::int64_t position = m_termBeginPosition + m_termOffset;
 
-            if (AERON_COND_EXPECT((position < limit), true))
+            if (AERON_COND_EXPECT((position < limit), true) || position < clientPublisherLimit(limit))
             {
                 const std::int32_t result =
                     termAppender->claim(m_termId, m_termOffset, m_headerWriter, length, bufferClaim);
@@ -504,6 +707,68 @@ public:
         return newPosition;
     }
 
+    /**
+     * Try to claim a range in the publication log for a message of up to {@link #maxMessageLength()}, split into as
+     * many fragments as it needs, into which the message can be encoded in place. Once the message has been written
+     * then {@link FragmentedBufferClaim#commit()} should be called to make it available.
+     *
+     * @code
+     * FragmentedBufferClaim bufferClaim;
+     *
+     *     if (publication->tryClaimFragmented(messageLength, bufferClaim) > 0)
+     *     {
+     *         for (int i = 0; i < bufferClaim.fragmentCount(); i++)
+     *         {
+     *             AtomicBuffer fragment = bufferClaim.fragment(i);
+     *             // Encode the next part of the message into fragment
+     *         }
+     *
+     *         bufferClaim.commit();
+     *     }
+     * @endcode
+     *
+     * @param length      of the message to claim, in bytes.
+     * @param bufferClaim to be populated if the claim succeeds.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * @throws IllegalArgumentException if the length is not positive.
+     * @throws IllegalStateException if the length is greater than max message length.
+     * @see FragmentedBufferClaim::commit
+     */
+    inline std::int64_t tryClaimFragmented(
+        util::index_t length, concurrent::logbuffer::FragmentedBufferClaim& bufferClaim)
+    {
+        if (length <= 0)
+        {
+            throw util::IllegalArgumentException(
+                util::strPrintf("claim length must be positive, length=%d", length), SOURCEINFO);
+        }
+
+        checkForMaxMessageLength(length);
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
+            const std::int64_t position = m_termBeginPosition + m_termOffset;
+
+            if (position < limit || position < clientPublisherLimit(limit))
+            {
+                const std::int32_t result = termAppender->claimFragmented(
+                    m_termId, m_termOffset, m_headerWriter, length, m_maxPayloadLength, bufferClaim);
+
+                newPosition = ExclusivePublication::newPosition(result);
+            }
+            else
+            {
+                newPosition = ExclusivePublication::backPressureStatus(position, length);
+            }
+        }
+
+        return newPosition;
+    }
+
     /**
      * Add a destination manually to a multi-destination-cast Publication.
      *
@@ -555,10 +820,13 @@ private:
     ReadablePosition<UnsafeBufferPosition> m_publicationLimit;
     std::int32_t m_channelStatusId;
     std::atomic<bool> m_isClosed = { false };
+    bool m_isSubscriberWakeup;
 
     std::shared_ptr<LogBuffers> m_logbuffers;
-    std::unique_ptr<ExclusiveTermAppender> m_appenders[3];
-    HeaderWriter m_headerWriter;
+    std::unique_ptr<ExclusiveTermAppender> m_appenders[LogBufferDescriptor::PARTITION_COUNT];
+    PrecomputedHeaderWriter m_headerWriter;
+
+    std::int64_t clientPublisherLimit(std::int64_t limit);
 
     inline std::int64_t newPosition(const std::int32_t resultingOffset)
     {
@@ -566,6 +834,11 @@ private:
         {
             m_termOffset = resultingOffset;
 
+            if (m_isSubscriberWakeup)
+            {
+                LogBufferDescriptor::signalSubscribers(m_logMetaDataBuffer);
+            }
+
             return m_termBeginPosition + resultingOffset;
         }
 
@@ -626,6 +899,25 @@ private:
         }
     }
 
+    template <class BufferIterator> util::index_t computeBatchLength(BufferIterator startBuffer, BufferIterator lastBuffer)
+    {
+        util::index_t batchLength = 0;
+        for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+        {
+            checkForMaxPayloadLength(it->capacity());
+            batchLength +=
+                util::BitUtil::align(it->capacity() + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+            checkForMaxMessageLength(batchLength);
+        }
+
+        if (0 == batchLength)
+        {
+            throw util::IllegalArgumentException("batch must contain at least one message", SOURCEINFO);
+        }
+
+        return batchLength;
+    }
+
 };
 
 }
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_FIXEDTERMIMAGE_H
+#define AERON_FIXEDTERMIMAGE_H
+
+#include <cstdint>
+#include "Image.h"
+
+namespace aeron {
+
+namespace FixedTerm {
+
+constexpr std::int32_t positionBitsToShift(std::int32_t termLength)
+{
+    return termLength > 1 ? 1 + positionBitsToShift(termLength >> 1) : 0;
+}
+
+}
+
+/**
+ * A view of an {@link Image} for a stream whose term length is known when the consumer is compiled.
+ * <p>
+ * The term length mask and the position shift are constants, so finding the term and the offset to read from a
+ * position takes no loads of Image state, and the read loops are bound by a constant rather than the capacity of the
+ * term buffer. The view holds a reference to the Image, which must outlive it, and only polls. Use the Image for
+ * everything else.
+ *
+ * @tparam TermLength of the stream, checked against the Image when the view is constructed.
+ */
+template <std::int32_t TermLength>
+class FixedTermImage
+{
+public:
+    static_assert(
+        TermLength >= LogBufferDescriptor::TERM_MIN_LENGTH && TermLength <= LogBufferDescriptor::TERM_MAX_LENGTH,
+        "TermLength must be within the term length limits");
+    static_assert(0 == (TermLength & (TermLength - 1)), "TermLength must be a power of 2");
+
+    static constexpr std::int32_t TERM_LENGTH_MASK = TermLength - 1;
+    static constexpr std::int32_t POSITION_BITS_TO_SHIFT = FixedTerm::positionBitsToShift(TermLength);
+
+    /**
+     * @param image to poll, which must have a term length of TermLength.
+     * @throws util::IllegalArgumentException if the term length of the image is not TermLength.
+     */
+    explicit FixedTermImage(Image& image) :
+        m_image(image)
+    {
+        if (image.termBufferLength() != TermLength)
+        {
+            throw util::IllegalArgumentException(
+                util::strPrintf("image term length %d is not %d", image.termBufferLength(), TermLength), SOURCEINFO);
+        }
+    }
+
+    inline Image& image()
+    {
+        return m_image;
+    }
+
+    /**
+     * Poll for new messages in the stream as for {@link Image#poll}.
+     *
+     * @param fragmentHandler to which messages are delivered.
+     * @param fragmentLimit   for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     */
+    template <typename F>
+    inline int poll(F&& fragmentHandler, int fragmentLimit) AERON_HOT_PATH_NOEXCEPT
+    {
+        Image& image = m_image;
+        int result = 0;
+
+        if (!image.isClosed())
+        {
+            const std::int64_t position = image.m_subscriberPosition.get();
+            const std::int32_t termOffset = static_cast<std::int32_t>(position) & TERM_LENGTH_MASK;
+            AtomicBuffer& termBuffer =
+                image.m_termBuffers[LogBufferDescriptor::indexByPosition(position, POSITION_BITS_TO_SHIFT)];
+            TermReader::ReadOutcome readOutcome;
+
+            TermReader::fixedLengthRead<TermLength>(
+                readOutcome, termBuffer, termOffset, fragmentHandler, fragmentLimit, image.m_header,
+                image.m_exceptionHandler);
+
+            const std::int64_t newPosition = position + (readOutcome.offset - termOffset);
+            if (newPosition > position)
+            {
+                image.m_subscriberPosition.setOrdered(newPosition);
+                AERON_CLIENT_PROBE3(image_poll, image.m_sessionId, newPosition, readOutcome.fragmentsRead);
+            }
+
+            result = readOutcome.fragmentsRead;
+        }
+
+        return result;
+    }
+
+    /**
+     * Poll for new messages in the stream as for {@link Image#rawPoll}, with a handler that takes a pointer to the
+     * payload, its length and a pointer to the frame header.
+     *
+     * @param fragmentHandler to which fragments are delivered.
+     * @param fragmentLimit   for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     */
+    template <typename F>
+    inline int rawPoll(F&& fragmentHandler, int fragmentLimit) AERON_HOT_PATH_NOEXCEPT
+    {
+        Image& image = m_image;
+        int result = 0;
+
+        if (!image.isClosed())
+        {
+            const std::int64_t position = image.m_subscriberPosition.get();
+            const std::int32_t termOffset = static_cast<std::int32_t>(position) & TERM_LENGTH_MASK;
+            AtomicBuffer& termBuffer =
+                image.m_termBuffers[LogBufferDescriptor::indexByPosition(position, POSITION_BITS_TO_SHIFT)];
+            TermReader::ReadOutcome readOutcome;
+
+            TermReader::fixedLengthRawRead<TermLength>(
+                readOutcome, termBuffer, termOffset, fragmentHandler, fragmentLimit, image.m_exceptionHandler);
+
+            const std::int64_t newPosition = position + (readOutcome.offset - termOffset);
+            if (newPosition > position)
+            {
+                image.m_subscriberPosition.setOrdered(newPosition);
+            }
+
+            result = readOutcome.fragmentsRead;
+        }
+
+        return result;
+    }
+
+private:
+    Image& m_image;
+};
+
+}
+
+#endif
@@ -17,8 +17,9 @@
 #ifndef AERON_FRAGMENTASSEMBLYADAPTER_H
 #define AERON_FRAGMENTASSEMBLYADAPTER_H
 
-#include <unordered_map>
+#include <vector>
 #include "Aeron.h"
+#include <util/FlatMap.h>
 #include "BufferBuilder.h"
 
 namespace aeron {
@@ -33,8 +34,10 @@ static const std::size_t DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH = 4096;
  * buffer for reassembly before delegation.
  * <p>
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
- * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
- * {@link #deleteSessionBuffer(std::int32_t)}.
+ * On the first fragment the buffer is sized for all the fragments of the message already in the term so it is grown
+ * at most once for the common case. When sessions go inactive see {@link on_unavailable_image_t}, it is possible to
+ * release the buffer by calling {@link #deleteSessionBuffer(std::int32_t)}, which keeps it for reuse by a later
+ * session.
  */
 class FragmentAssembler
 {
@@ -67,20 +70,88 @@ public:
     }
 
     /**
-     * Free an existing session buffer to reduce memory pressure when an Image goes inactive or no more
-     * large messages are expected.
+     * Release an existing session buffer when an Image goes inactive or no more large messages are expected. The
+     * buffer is pooled for the next session to begin a fragmented message, see freeBufferPool() to free the pool.
      *
-     * @param sessionId to have its buffer freed
+     * @param sessionId to have its buffer released
      */
     void deleteSessionBuffer(std::int32_t sessionId)
     {
-        m_builderBySessionIdMap.erase(sessionId);
+        std::unique_ptr<BufferBuilder> builder = m_builderBySessionIdMap.remove(sessionId);
+
+        if (nullptr != builder)
+        {
+            m_builderPool.push_back(std::move(builder));
+        }
+    }
+
+    /**
+     * Free the pooled session buffers to reduce memory pressure.
+     */
+    void freeBufferPool()
+    {
+        m_builderPool.clear();
     }
 
 private:
     std::size_t m_initialBufferLength;
     fragment_handler_t m_delegate;
-    std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
+    util::Int32FlatMap<BufferBuilder> m_builderBySessionIdMap;
+    std::vector<std::unique_ptr<BufferBuilder>> m_builderPool;
+
+    inline BufferBuilder& builderForSession(std::int32_t sessionId)
+    {
+        return m_builderBySessionIdMap.getOrInsert(
+            sessionId,
+            [&]()
+            {
+                std::unique_ptr<BufferBuilder> builder;
+
+                if (m_builderPool.empty())
+                {
+                    builder.reset(new BufferBuilder(static_cast<std::uint32_t>(m_initialBufferLength)));
+                }
+                else
+                {
+                    builder = std::move(m_builderPool.back());
+                    m_builderPool.pop_back();
+                }
+
+                return builder;
+            });
+    }
+
+    /*
+     * Payload length of the fragments of the message beginning at frameOffset which have already been written to the
+     * term. The fragments of a session are contiguous in its term so they can be walked frame by frame.
+     */
+    inline static std::uint32_t availableMessageLength(AtomicBuffer& termBuffer, util::index_t frameOffset)
+    {
+        const util::index_t capacity = termBuffer.capacity();
+        std::uint32_t messageLength = 0;
+        util::index_t offset = frameOffset;
+
+        while (offset < capacity)
+        {
+            const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+            if (frameLength <= 0 || FrameDescriptor::isPaddingFrame(termBuffer, offset))
+            {
+                break;
+            }
+
+            messageLength += static_cast<std::uint32_t>(frameLength - DataFrameHeader::LENGTH);
+
+            if ((termBuffer.getUInt8(offset + DataFrameHeader::FLAGS_FIELD_OFFSET) & FrameDescriptor::END_FRAG) ==
+                FrameDescriptor::END_FRAG)
+            {
+                break;
+            }
+
+            offset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+        }
+
+        return messageLength;
+    }
 
     inline void onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
     {
@@ -94,20 +165,20 @@ private:
         {
             if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
             {
-                auto result = m_builderBySessionIdMap.emplace(header.sessionId(), static_cast<std::uint32_t>(m_initialBufferLength));
-                BufferBuilder& builder = result.first->second;
+                BufferBuilder& builder = builderForSession(header.sessionId());
 
                 builder
                     .reset()
+                    .reserve(availableMessageLength(buffer, offset - DataFrameHeader::LENGTH))
                     .append(buffer, offset, length, header);
             }
             else
             {
-                auto result = m_builderBySessionIdMap.find(header.sessionId());
+                BufferBuilder *result = m_builderBySessionIdMap.get(header.sessionId());
 
-                if (result != m_builderBySessionIdMap.end())
+                if (nullptr != result)
                 {
-                    BufferBuilder& builder = result->second;
+                    BufferBuilder& builder = *result;
 
                     if (builder.limit() != DataFrameHeader::LENGTH)
                     {
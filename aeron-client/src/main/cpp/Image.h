@@ -26,7 +26,9 @@
 #include <concurrent/status/UnsafeBufferPosition.h>
 #include <algorithm>
 #include <atomic>
+#include <vector>
 #include "LogBuffers.h"
+#include "util/Probes.h"
 
 namespace aeron {
 
@@ -76,6 +78,33 @@ typedef std::function<ControlledPollAction(
     util::index_t length,
     Header &header)> controlled_poll_fragment_handler_t;
 
+class Image;
+
+template <std::int32_t TermLength>
+class FixedTermImage;
+
+/**
+ * A block of complete frames scanned from an Image but not yet consumed, as handed to a batch handler by
+ * Subscription::pollBatch. The block holds the frames with their headers and may include padding frames.
+ */
+struct ImageBlock
+{
+    Image *image;
+    AtomicBuffer *termBuffer;
+    std::int32_t termOffset;
+    std::int32_t length;
+    std::int32_t sessionId;
+    std::int32_t termId;
+    std::int64_t position;
+};
+
+/**
+ * Callback for handling the blocks scanned from all the Image s of a Subscription in a single call.
+ *
+ * @param blocks scanned, at most one per Image. Valid only for the duration of the call.
+ */
+typedef std::function<void(const std::vector<ImageBlock>& blocks)> batch_block_handler_t;
+
 /**
  * Represents a replicated publication {@link Image} from a publisher to a {@link Subscription}.
  * Each {@link Image} identifies a source publisher by session id.
@@ -309,6 +338,29 @@ public:
         m_subscriberPosition.setOrdered(newPosition);
     }
 
+    /**
+     * Park the calling thread until a publisher appends beyond the consumed position or the timeout expires, rather
+     * than spinning on poll. Publishers only wake subscribers of IPC publications the driver created with subscriber
+     * wakeup enabled, for other images this returns at once.
+     *
+     * @param timeoutNs to wait at most.
+     * @return true if there may be fragments to poll, false if none arrived before the timeout or the image is closed.
+     */
+    inline bool awaitAvailable(std::int64_t timeoutNs)
+    {
+        if (isClosed())
+        {
+            return false;
+        }
+
+        return LogBufferDescriptor::awaitTailAbove(
+            m_logBuffers->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX),
+            m_subscriberPosition.get(),
+            m_positionBitsToShift,
+            m_header.initialTermId(),
+            timeoutNs);
+    }
+
     /**
      * Is the current consumed position at the end of the stream?
      *
@@ -337,7 +389,7 @@ public:
      * @see fragment_handler_t
      */
     template <typename F>
-    inline int poll(F&& fragmentHandler, int fragmentLimit)
+    inline int poll(F&& fragmentHandler, int fragmentLimit) AERON_HOT_PATH_NOEXCEPT
     {
         int result = 0;
 
@@ -351,6 +403,206 @@ public:
 
             TermReader::read(readOutcome, termBuffer, termOffset, fragmentHandler, fragmentLimit, m_header, m_exceptionHandler);
 
+            const std::int64_t newPosition = position + (readOutcome.offset - termOffset);
+            if (newPosition > position)
+            {
+                m_subscriberPosition.setOrdered(newPosition);
+                AERON_CLIENT_PROBE3(image_poll, m_sessionId, newPosition, readOutcome.fragmentsRead);
+            }
+
+            result = readOutcome.fragmentsRead;
+        }
+
+        return result;
+    }
+
+    /**
+     * Poll for new messages in a stream as for poll with a handler that takes a pointer to the payload, its length
+     * and a pointer to the frame header, as void(const std::uint8_t *, util::index_t,
+     * const DataFrameHeader::DataFrameHeaderDefn *), rather than a buffer and Header. No Header is bound per fragment
+     * and no position is computed unless the handler computes it from the frame header, which suits consumers of
+     * small messages that only need the payload.
+     *
+     * @param fragmentHandler to which fragments are delivered.
+     * @param fragmentLimit   for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     */
+    template <typename F>
+    inline int rawPoll(F&& fragmentHandler, int fragmentLimit) AERON_HOT_PATH_NOEXCEPT
+    {
+        int result = 0;
+
+        if (!isClosed())
+        {
+            const std::int64_t position = m_subscriberPosition.get();
+            const std::int32_t termOffset = (std::int32_t) position & m_termLengthMask;
+            AtomicBuffer &termBuffer = m_termBuffers[LogBufferDescriptor::indexByPosition(position,
+                m_positionBitsToShift)];
+            TermReader::ReadOutcome readOutcome;
+
+            TermReader::rawRead(
+                readOutcome, termBuffer, termOffset, fragmentHandler, fragmentLimit, m_exceptionHandler);
+
+            const std::int64_t newPosition = position + (readOutcome.offset - termOffset);
+            if (newPosition > position)
+            {
+                m_subscriberPosition.setOrdered(newPosition);
+            }
+
+            result = readOutcome.fragmentsRead;
+        }
+
+        return result;
+    }
+
+    /**
+     * Poll for new messages in a stream as for poll, delivering only the messages the filter matches. Messages the
+     * filter rejects are consumed without being delivered or counted against fragmentLimit, so a poll may pass over
+     * up to the rest of the term. The filter is tested on the first fragment of each message and the other fragments
+     * of the message follow its decision.
+     *
+     * @param fragmentHandler to which matching messages are delivered.
+     * @param filter          with a matches(AtomicBuffer&, index_t, index_t, Header&) method, such as MessageFilter.
+     * @param fragmentLimit   for the number of fragments to be delivered during one polling operation.
+     * @return the number of fragments that have been delivered.
+     *
+     * @see fragment_handler_t
+     */
+    template <typename F, typename M>
+    inline int filteredPoll(F&& fragmentHandler, M&& filter, int fragmentLimit) AERON_HOT_PATH_NOEXCEPT
+    {
+        int result = 0;
+
+        if (!isClosed())
+        {
+            const std::int64_t position = m_subscriberPosition.get();
+            const std::int32_t termOffset = (std::int32_t) position & m_termLengthMask;
+            AtomicBuffer &termBuffer = m_termBuffers[LogBufferDescriptor::indexByPosition(position,
+                m_positionBitsToShift)];
+            TermReader::ReadOutcome readOutcome;
+
+            TermReader::filteredRead(
+                readOutcome,
+                termBuffer,
+                termOffset,
+                filter,
+                fragmentHandler,
+                fragmentLimit,
+                m_isSkippingMessage,
+                m_header,
+                m_exceptionHandler);
+
+            const std::int64_t newPosition = position + (readOutcome.offset - termOffset);
+            if (newPosition > position)
+            {
+                m_subscriberPosition.setOrdered(newPosition);
+            }
+
+            result = readOutcome.fragmentsRead;
+        }
+
+        return result;
+    }
+
+    /**
+     * Poll for new messages in a stream as for poll while prefetching PrefetchLines cache lines ahead of the read
+     * cursor. The subscriber position is stored every positionUpdateFragments fragments, so flow control can advance
+     * during a long poll, and once at the end of the poll.
+     *
+     * @tparam PrefetchLines           number of cache lines to keep prefetched ahead of the frame being read.
+     * @param fragmentHandler          to which messages are delivered.
+     * @param fragmentLimit            for the number of fragments to be consumed during one polling operation.
+     * @param positionUpdateFragments  number of fragments after which the position is stored within the poll.
+     * @return the number of fragments that have been consumed.
+     *
+     * @see fragment_handler_t
+     */
+    template <int PrefetchLines, typename F>
+    inline int prefetchingPoll(
+        F&& fragmentHandler, int fragmentLimit, int positionUpdateFragments = INT32_MAX) AERON_HOT_PATH_NOEXCEPT
+    {
+        int result = 0;
+
+        if (!isClosed())
+        {
+            std::int64_t position = m_subscriberPosition.get();
+            std::int32_t termOffset = (std::int32_t) position & m_termLengthMask;
+            AtomicBuffer &termBuffer = m_termBuffers[LogBufferDescriptor::indexByPosition(position,
+                m_positionBitsToShift)];
+            const std::int32_t capacity = termBuffer.capacity();
+            const int batchFragments = std::max(positionUpdateFragments, 1);
+            TermReader::ReadOutcome readOutcome;
+
+            while (result < fragmentLimit && termOffset < capacity)
+            {
+                const int batchLimit = std::min(batchFragments, fragmentLimit - result);
+
+                TermReader::read<PrefetchLines>(
+                    readOutcome, termBuffer, termOffset, fragmentHandler, batchLimit, capacity, m_header,
+                    m_exceptionHandler);
+
+                if (readOutcome.offset > termOffset)
+                {
+                    position += readOutcome.offset - termOffset;
+                    termOffset = readOutcome.offset;
+                    m_subscriberPosition.setOrdered(position);
+                }
+
+                result += readOutcome.fragmentsRead;
+
+                if (readOutcome.fragmentsRead < batchLimit)
+                {
+                    break;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
+     * will be delivered via the fragment_handler_t up to a limited number of fragments as specified or the maximum
+     * position specified. A fragment which begins before the maximum position is read whole.
+     *
+     * @param fragmentHandler to which messages are delivered.
+     * @param maxPosition     to consume messages up to.
+     * @param fragmentLimit   for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     *
+     * @see fragment_handler_t
+     */
+    template <typename F>
+    inline int boundedPoll(F&& fragmentHandler, std::int64_t maxPosition, int fragmentLimit) AERON_HOT_PATH_NOEXCEPT
+    {
+        int result = 0;
+
+        if (!isClosed())
+        {
+            const std::int64_t position = m_subscriberPosition.get();
+            if (maxPosition <= position)
+            {
+                return 0;
+            }
+
+            const std::int32_t termOffset = (std::int32_t) position & m_termLengthMask;
+            AtomicBuffer &termBuffer = m_termBuffers[LogBufferDescriptor::indexByPosition(position,
+                m_positionBitsToShift)];
+            const std::int64_t limitOffset = std::min(
+                static_cast<std::int64_t>(termOffset) + (maxPosition - position),
+                static_cast<std::int64_t>(termBuffer.capacity()));
+            TermReader::ReadOutcome readOutcome;
+
+            TermReader::read(
+                readOutcome,
+                termBuffer,
+                termOffset,
+                fragmentHandler,
+                fragmentLimit,
+                static_cast<std::int32_t>(limitOffset),
+                m_header,
+                m_exceptionHandler);
+
             const std::int64_t newPosition = position + (readOutcome.offset - termOffset);
             if (newPosition > position)
             {
@@ -643,6 +895,104 @@ public:
         return resultingPosition;
     }
 
+    /**
+     * The lowest position from which readConsumed can read, a term behind the subscriber position or the join
+     * position if later. The driver does not clean or reuse the log below the subscriber position by less than a term,
+     * and the publisher is held within a term ahead of it, so frames in this range stay as they were when consumed.
+     *
+     * @return the lowest position from which readConsumed can read.
+     */
+    inline std::int64_t lowestConsumedPosition()
+    {
+        return std::max(m_joinPosition, m_subscriberPosition.get() - termBufferLength());
+    }
+
+    /**
+     * Read again fragments that have already been consumed, such as to recover from a failure of a handler, from a
+     * position at the start of a frame between lowestConsumedPosition and the subscriber position, without moving
+     * the subscriber position. Reading spans terms and stops at the subscriber position, after fragmentLimit
+     * fragments, or at a frame whose header does not carry the term id and offset of the position it was read at,
+     * which is the case when initialPosition is not the start of a frame.
+     *
+     * @param initialPosition from which to read, at the start of a frame.
+     * @param fragmentHandler to which fragments are delivered.
+     * @param fragmentLimit   for the number of fragments to be read.
+     * @return the position after the last fragment read, from which to continue.
+     * @throws util::IllegalArgumentException if initialPosition is out of range or not aligned to a frame.
+     *
+     * @see fragment_handler_t
+     */
+    template <typename F>
+    inline std::int64_t readConsumed(std::int64_t initialPosition, F&& fragmentHandler, int fragmentLimit)
+    {
+        std::int64_t resultingPosition = initialPosition;
+
+        if (!isClosed())
+        {
+            const std::int64_t limitPosition = m_subscriberPosition.get();
+            const std::int64_t lowestPosition = lowestConsumedPosition();
+
+            if (initialPosition < lowestPosition || initialPosition > limitPosition)
+            {
+                throw util::IllegalArgumentException(
+                    util::strPrintf("initialPosition of %d out of range %d - %d",
+                        initialPosition, lowestPosition, limitPosition),
+                    SOURCEINFO);
+            }
+
+            if (0 != (initialPosition & (FrameDescriptor::FRAME_ALIGNMENT - 1)))
+            {
+                throw util::IllegalArgumentException(
+                    util::strPrintf("initialPosition of %d not aligned to FRAME_ALIGNMENT", initialPosition),
+                    SOURCEINFO);
+            }
+
+            int fragmentsRead = 0;
+
+            try
+            {
+                while (resultingPosition < limitPosition && fragmentsRead < fragmentLimit)
+                {
+                    const std::int32_t termOffset = static_cast<std::int32_t>(resultingPosition & m_termLengthMask);
+                    const std::int32_t termId = m_header.initialTermId() +
+                        static_cast<std::int32_t>(resultingPosition >> m_positionBitsToShift);
+                    AtomicBuffer &termBuffer = m_termBuffers[LogBufferDescriptor::indexByPosition(
+                        resultingPosition, m_positionBitsToShift)];
+                    const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, termOffset);
+
+                    if (length <= 0 ||
+                        termBuffer.getInt32(termOffset + DataFrameHeader::TERM_ID_FIELD_OFFSET) != termId ||
+                        termBuffer.getInt32(termOffset + DataFrameHeader::TERM_OFFSET_FIELD_OFFSET) != termOffset)
+                    {
+                        break;
+                    }
+
+                    if (!FrameDescriptor::isPaddingFrame(termBuffer, termOffset))
+                    {
+                        m_header.buffer(termBuffer);
+                        m_header.offset(termOffset);
+
+                        fragmentHandler(
+                            termBuffer,
+                            termOffset + DataFrameHeader::LENGTH,
+                            length - DataFrameHeader::LENGTH,
+                            m_header);
+
+                        ++fragmentsRead;
+                    }
+
+                    resultingPosition += util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
+                }
+            }
+            catch (const std::exception& ex)
+            {
+                m_exceptionHandler(ex);
+            }
+        }
+
+        return resultingPosition;
+    }
+
     /**
      * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
      * will be delivered via the block_handler_t up to a limited number of bytes.
@@ -692,12 +1042,125 @@ public:
         return result;
     }
 
+    /**
+     * Poll for new messages in a stream as blockPoll(F&&, int) does and also hand over the frames of the block, found
+     * in the same pass that finds its end, so a handler forwarding whole blocks need not parse them again.
+     *
+     * @param blockHandler     to which block is delivered, with frames filled in before it is called.
+     * @param blockLengthLimit up to which a block may be in length.
+     * @param frames           to be cleared and filled with the offset and length of each frame of the block.
+     * @return the number of bytes that have been consumed.
+     *
+     * @see block_handler_t
+     * @see BlockFrame
+     */
+    template <typename F>
+    inline int blockPoll(F&& blockHandler, int blockLengthLimit, std::vector<BlockFrame>& frames)
+    {
+        int result = 0;
+
+        if (!isClosed())
+        {
+            const std::int64_t position = m_subscriberPosition.get();
+            const std::int32_t termOffset = (std::int32_t) position & m_termLengthMask;
+            AtomicBuffer &termBuffer = m_termBuffers[LogBufferDescriptor::indexByPosition(position,
+                m_positionBitsToShift)];
+            const std::int32_t limit = std::min(termOffset + blockLengthLimit, termBuffer.capacity());
+
+            const std::int32_t resultingOffset = TermBlockScanner::scan(termBuffer, termOffset, limit, frames);
+
+            const std::int32_t bytesConsumed = resultingOffset - termOffset;
+
+            if (resultingOffset > termOffset)
+            {
+                try
+                {
+                    const std::int32_t termId = termBuffer.getInt32(termOffset + DataFrameHeader::TERM_ID_FIELD_OFFSET);
+
+                    blockHandler(termBuffer, termOffset, bytesConsumed, m_sessionId, termId);
+                }
+                catch (const std::exception& ex)
+                {
+                    m_exceptionHandler(ex);
+                }
+
+                m_subscriberPosition.setOrdered(position + bytesConsumed);
+            }
+
+            result = bytesConsumed;
+        }
+
+        return result;
+    }
+
+    /// @cond HIDDEN_SYMBOLS
+    /**
+     * Scan the complete frames available from the current position, up to blockLengthLimit bytes, without consuming
+     * them.
+     *
+     * @return the length of the block, 0 if no frames are available.
+     */
+    inline std::int32_t scanBlock(ImageBlock& block, int blockLengthLimit)
+    {
+        block.length = 0;
+
+        if (!isClosed())
+        {
+            const std::int64_t position = m_subscriberPosition.get();
+            const std::int32_t termOffset = (std::int32_t) position & m_termLengthMask;
+            AtomicBuffer &termBuffer = m_termBuffers[LogBufferDescriptor::indexByPosition(position,
+                m_positionBitsToShift)];
+            const std::int32_t limit = std::min(termOffset + blockLengthLimit, termBuffer.capacity());
+            const std::int32_t resultingOffset = TermBlockScanner::scan(termBuffer, termOffset, limit);
+
+            if (resultingOffset > termOffset)
+            {
+                block.image = this;
+                block.termBuffer = &termBuffer;
+                block.termOffset = termOffset;
+                block.length = resultingOffset - termOffset;
+                block.sessionId = m_sessionId;
+                block.termId = termBuffer.getInt32(termOffset + DataFrameHeader::TERM_ID_FIELD_OFFSET);
+                block.position = position;
+            }
+        }
+
+        return block.length;
+    }
+
+    /**
+     * Consume a block previously returned by scanBlock if the position has not moved since.
+     */
+    inline void consumeBlock(const ImageBlock& block)
+    {
+        if (m_subscriberPosition.get() == block.position)
+        {
+            m_subscriberPosition.setOrdered(block.position + block.length);
+        }
+    }
+    /// @endcond
+
     std::shared_ptr<LogBuffers> logBuffers()
     {
         return m_logBuffers;
     }
 
     /// @cond HIDDEN_SYMBOLS
+    inline std::int64_t *subscriberPositionAddress()
+    {
+        return m_subscriberPosition.address();
+    }
+
+    inline std::uint8_t *logAddress()
+    {
+        return m_termBuffers[0].buffer();
+    }
+
+    inline std::int32_t positionBitsToShift() const
+    {
+        return m_positionBitsToShift;
+    }
+
     inline void close()
     {
         m_finalPosition = m_subscriberPosition.getVolatile();
@@ -705,9 +1168,26 @@ public:
                 m_logBuffers->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX));
         std::atomic_store_explicit(&m_isClosed, true, std::memory_order_release);
     }
+
+    /*
+     * Count of the ImageLists holding this Image. Only changed by the client conductor under its lock, so it needs no
+     * atomic operations, and not carried over by copies.
+     */
+    inline void retainImageListReference()
+    {
+        ++m_imageListReferences;
+    }
+
+    inline bool releaseImageListReference()
+    {
+        return 0 == --m_imageListReferences;
+    }
     /// @endcond
 
 private:
+    template <std::int32_t TermLength>
+    friend class FixedTermImage;
+
     AtomicBuffer m_termBuffers[LogBufferDescriptor::PARTITION_COUNT];
     Header m_header;
     Position<UnsafeBufferPosition> m_subscriberPosition;
@@ -724,6 +1204,8 @@ private:
     std::int32_t m_termLengthMask;
     std::int32_t m_positionBitsToShift;
     bool m_isEos;
+    std::int32_t m_imageListReferences = 0;
+    bool m_isSkippingMessage = false;
 
     void validatePosition(std::int64_t newPosition)
     {
@@ -746,17 +1228,151 @@ private:
     }
 };
 
+/// @cond HIDDEN_SYMBOLS
+/**
+ * Copy on write array of the Images of a Subscription. Entries point at Images shared by every list that holds them
+ * so a change copies pointers, not Images.
+ */
 struct ImageList
 {
-    Image *m_images;
+    Image **m_images;
     std::size_t m_length;
+    std::size_t m_capacity;
+    /* grows with each list a subscription publishes, recycled lists mean the address does not identify a version */
+    std::uint64_t m_version;
+
+    explicit ImageList(std::size_t capacity) :
+        m_images(capacity > 0 ? new Image*[capacity] : nullptr),
+        m_length(0),
+        m_capacity(capacity),
+        m_version(0)
+    {
+    }
+
+    ~ImageList()
+    {
+        delete[] m_images;
+    }
+
+    ImageList(const ImageList&) = delete;
+    ImageList& operator=(const ImageList&) = delete;
+};
+
+/**
+ * Recycles the ImageLists of released or lingered-out image list versions so image churn does not allocate once the
+ * pool is warm. Used only by the client conductor under its lock.
+ */
+class ImageListPool
+{
+public:
+    static const std::size_t MAX_POOLED_LISTS = 64;
+
+    ImageListPool() = default;
+
+    ~ImageListPool()
+    {
+        for (ImageList *list : m_pool)
+        {
+            delete list;
+        }
+    }
+
+    ImageListPool(const ImageListPool&) = delete;
+    ImageListPool& operator=(const ImageListPool&) = delete;
+
+    ImageList *acquire(std::size_t capacity)
+    {
+        for (std::size_t i = 0, size = m_pool.size(); i < size; i++)
+        {
+            if (m_pool[i]->m_capacity >= capacity)
+            {
+                ImageList *list = m_pool[i];
+                m_pool[i] = m_pool.back();
+                m_pool.pop_back();
+                list->m_length = 0;
+
+                return list;
+            }
+        }
+
+        return new ImageList(capacity < MIN_CAPACITY ? static_cast<std::size_t>(MIN_CAPACITY) : capacity);
+    }
+
+    ImageList *copyWith(const ImageList& list, Image *image)
+    {
+        ImageList *result = acquire(list.m_length + 1);
+
+        for (std::size_t i = 0; i < list.m_length; i++)
+        {
+            append(*result, list.m_images[i]);
+        }
+
+        append(*result, image);
+        result->m_version = list.m_version + 1;
+
+        return result;
+    }
+
+    ImageList *copyWithout(const ImageList& list, std::size_t index)
+    {
+        ImageList *result = acquire(list.m_length - 1);
+
+        for (std::size_t i = 0; i < list.m_length; i++)
+        {
+            if (i != index)
+            {
+                append(*result, list.m_images[i]);
+            }
+        }
+
+        result->m_version = list.m_version + 1;
+
+        return result;
+    }
+
+    /**
+     * Drop the references of the list to its Images, deleting any Image held by no other list, and keep the list
+     * for reuse.
+     */
+    void release(ImageList *list)
+    {
+        for (std::size_t i = 0; i < list->m_length; i++)
+        {
+            if (list->m_images[i]->releaseImageListReference())
+            {
+                delete list->m_images[i];
+            }
+        }
+
+        list->m_length = 0;
+
+        if (m_pool.size() < MAX_POOLED_LISTS)
+        {
+            m_pool.push_back(list);
+        }
+        else
+        {
+            delete list;
+        }
+    }
+
+    std::size_t pooledLists() const
+    {
+        return m_pool.size();
+    }
+
+private:
+    static const std::size_t MIN_CAPACITY = 4;
+
+    std::vector<ImageList*> m_pool;
 
-    ImageList(Image *images, std::size_t length) :
-        m_images(images),
-        m_length(length)
+    static void append(ImageList& list, Image *image)
     {
+        image->retainImageListReference();
+        list.m_images[list.m_length++] = image;
     }
 };
+/// @endcond
 
 }
 
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_LANEMERGER_H
+#define AERON_LANEMERGER_H
+
+#include <cstdint>
+#include <chrono>
+#include <limits>
+#include <vector>
+#include "Subscription.h"
+
+namespace aeron {
+
+/**
+ * Reserved value supplier for lane publishers which stamps each frame with a steady clock timestamp in nanoseconds,
+ * to be merged on by {@link LaneMerger::timestampKey}.
+ */
+struct LaneTimestampSupplier
+{
+    inline std::int64_t operator()(AtomicBuffer&, util::index_t, util::index_t) const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+};
+
+/**
+ * Merges the images of an IPC subscription, one per lane, into a single ordered stream of fragments.
+ * <p>
+ * Many producer threads offering to one shared IPC publication contend on its tail. Instead each producer adds its
+ * own ExclusivePublication to the channel and stream, which the driver gives a log of its own, so each lane has a
+ * single writer and no contention. The subscriber sees a lane as an image and this merger polls the lanes in key
+ * order: by the timestamp each producer stamps in the reserved value of a frame, see {@link LaneTimestampSupplier},
+ * or by position to keep lanes level.
+ * <p>
+ * Order is kept among the fragments available when a poll starts; a lane with nothing to read does not hold up the
+ * others. Each poll peeks the head of every lane, then consumes the lane with the lowest key up to the key at the
+ * head of the next lowest lane, so a producer running ahead is read in runs rather than a fragment at a time.
+ * Fragments of one message stay in order within their lane, so a FragmentAssembler may be the handler.
+ */
+class LaneMerger
+{
+public:
+    typedef std::int64_t (*key_function_t)(Header& header);
+
+    static inline std::int64_t timestampKey(Header& header)
+    {
+        return header.reservedValue();
+    }
+
+    static inline std::int64_t positionKey(Header& header)
+    {
+        return header.position();
+    }
+
+    explicit LaneMerger(key_function_t keyFunction = timestampKey) :
+        m_keyFunction(keyFunction)
+    {
+    }
+
+    /**
+     * Poll the images of a subscription in key order.
+     *
+     * @param subscription    whose images are the lanes.
+     * @param fragmentHandler to which fragments are delivered.
+     * @param fragmentLimit   for the number of fragments delivered.
+     * @return the number of fragments delivered.
+     */
+    template<typename F>
+    inline int poll(Subscription& subscription, F&& fragmentHandler, int fragmentLimit)
+    {
+        m_lanes.clear();
+        subscription.forEachImage([&](Image& image) { m_lanes.push_back(&image); });
+
+        return poll(m_lanes, fragmentHandler, fragmentLimit);
+    }
+
+    /**
+     * Poll images as lanes in key order.
+     *
+     * @param lanes           to merge.
+     * @param fragmentHandler to which fragments are delivered.
+     * @param fragmentLimit   for the number of fragments delivered.
+     * @return the number of fragments delivered.
+     */
+    template<typename F>
+    inline int poll(const std::vector<Image*>& lanes, F&& fragmentHandler, int fragmentLimit)
+    {
+        m_heads.resize(lanes.size());
+        for (std::size_t i = 0; i < lanes.size(); i++)
+        {
+            m_heads[i] = peek(*lanes[i]);
+        }
+
+        int fragmentsRead = 0;
+        while (fragmentsRead < fragmentLimit)
+        {
+            std::size_t lowest = lanes.size();
+            std::int64_t bound = std::numeric_limits<std::int64_t>::max();
+
+            for (std::size_t i = 0; i < lanes.size(); i++)
+            {
+                if (NO_FRAGMENT == m_heads[i])
+                {
+                    continue;
+                }
+
+                if (lowest == lanes.size() || m_heads[i] < m_heads[lowest])
+                {
+                    if (lowest != lanes.size())
+                    {
+                        bound = m_heads[lowest];
+                    }
+                    lowest = i;
+                }
+                else if (m_heads[i] < bound)
+                {
+                    bound = m_heads[i];
+                }
+            }
+
+            if (lowest == lanes.size())
+            {
+                break;
+            }
+
+            std::int64_t next = NO_FRAGMENT;
+            fragmentsRead += lanes[lowest]->controlledPoll(
+                [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+                {
+                    const std::int64_t key = m_keyFunction(header);
+                    if (key > bound)
+                    {
+                        next = key;
+                        return ControlledPollAction::ABORT;
+                    }
+
+                    fragmentHandler(buffer, offset, length, header);
+
+                    return ControlledPollAction::CONTINUE;
+                },
+                fragmentLimit - fragmentsRead);
+
+            m_heads[lowest] = next;
+        }
+
+        return fragmentsRead;
+    }
+
+private:
+    static const std::int64_t NO_FRAGMENT = std::numeric_limits<std::int64_t>::min();
+
+    key_function_t m_keyFunction;
+    std::vector<Image*> m_lanes;
+    std::vector<std::int64_t> m_heads;
+
+    inline std::int64_t peek(Image& image)
+    {
+        std::int64_t key = NO_FRAGMENT;
+
+        image.controlledPoll(
+            [&](AtomicBuffer&, util::index_t, util::index_t, Header& header)
+            {
+                key = m_keyFunction(header);
+                return ControlledPollAction::ABORT;
+            },
+            1);
+
+        return key;
+    }
+};
+
+}
+
+#endif
@@ -21,7 +21,8 @@ namespace aeron {
 using namespace aeron::util;
 using namespace aeron::concurrent::logbuffer;
 
-LogBuffers::LogBuffers(const char *filename)
+LogBuffers::LogBuffers(const char *filename, bool preTouch, bool lock, bool lazy) :
+    m_lazy(lazy)
 {
     const std::int64_t logLength = MemoryMappedFile::getFileSize(filename);
 
@@ -41,6 +42,37 @@ LogBuffers::LogBuffers(const char *filename)
     LogBufferDescriptor::checkTermLength(termLength);
     LogBufferDescriptor::checkPageSize(pageSize);
 
+    const std::int64_t expectedLogLength = util::BitUtil::align(
+        (static_cast<std::int64_t>(termLength) * LogBufferDescriptor::PARTITION_COUNT) +
+            LogBufferDescriptor::LOG_META_DATA_LENGTH,
+        static_cast<std::int64_t>(pageSize));
+    if (logLength != expectedLogLength)
+    {
+        throw util::IllegalStateException(
+            util::strPrintf("log buffer %s does not have %d partitions of term length %d",
+                filename, LogBufferDescriptor::PARTITION_COUNT, termLength), SOURCEINFO);
+    }
+
+    if (lazy)
+    {
+        m_memoryMappedFiles->adviseRandom();
+    }
+    else if (pageSize >= LogBufferDescriptor::HUGE_PAGE_MIN_SIZE)
+    {
+        m_memoryMappedFiles->adviseHugePages();
+    }
+
+    if (preTouch && !lazy)
+    {
+        m_memoryMappedFiles->preTouch();
+    }
+
+    if (lock && !lazy && !m_memoryMappedFiles->lock())
+    {
+        throw util::IllegalStateException(
+            std::string("could not lock log buffers in memory: ") + filename, SOURCEINFO);
+    }
+
     for (int i = 0; i < LogBufferDescriptor::PARTITION_COUNT; i++)
     {
         m_buffers[i].wrap(basePtr + (i * termLength), termLength);
@@ -61,4 +93,37 @@ LogBuffers::LogBuffers(std::uint8_t *address, std::int64_t logLength, std::int32
 
 LogBuffers::~LogBuffers() = default;
 
+int LogBuffers::releaseInactiveTerms()
+{
+    if (!m_lazy)
+    {
+        return 0;
+    }
+
+    const std::int32_t termCount =
+        LogBufferDescriptor::activeTermCount(m_buffers[LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX]);
+    if (termCount == m_releasedTermCount)
+    {
+        return 0;
+    }
+
+    const int activeIndex = LogBufferDescriptor::indexByTermCount(termCount);
+    const int nextIndex = LogBufferDescriptor::nextPartitionIndex(activeIndex);
+    const std::size_t termLength = static_cast<std::size_t>(m_buffers[0].capacity());
+    int released = 0;
+
+    for (int i = 0; i < LogBufferDescriptor::PARTITION_COUNT; i++)
+    {
+        if (i != activeIndex && i != nextIndex &&
+            m_memoryMappedFiles->release(static_cast<std::size_t>(i) * termLength, termLength))
+        {
+            released++;
+        }
+    }
+
+    m_releasedTermCount = termCount;
+
+    return released;
+}
+
 }
@@ -32,7 +32,12 @@ using namespace aeron::concurrent::logbuffer;
 class LogBuffers
 {
 public:
-    explicit LogBuffers(const char *filename);
+    /**
+     * Map a log file. A lazy mapping reserves the whole log but only faults in the pages that are touched, one at a
+     * time, and is never pre-touched, locked or backed by huge pages, so a client that only reads positions from the
+     * meta data holds little more than that page. See releaseInactiveTerms.
+     */
+    explicit LogBuffers(const char *filename, bool preTouch = false, bool lock = false, bool lazy = false);
     LogBuffers(std::uint8_t *address, std::int64_t logLength, std::int32_t termLength);
 
     virtual ~LogBuffers();
@@ -42,9 +47,26 @@ public:
         return m_buffers[index];
     }
 
+    inline bool isLazy() const
+    {
+        return m_lazy;
+    }
+
+    /**
+     * Drop the pages of the partitions outside the window of the active term and the next from a lazy mapping, each
+     * time the active term moves on, so the pages of a stream read or written through the log do not pile up in the
+     * resident set of the client. Pages of a released partition are faulted in again should it be read, by a lagging
+     * Image for instance, so a Publication or Image behind the window still works on the log.
+     *
+     * @return the number of partitions released.
+     */
+    int releaseInactiveTerms();
+
 private:
     MemoryMappedFile::ptr_t m_memoryMappedFiles;
     AtomicBuffer m_buffers[LogBufferDescriptor::PARTITION_COUNT + 1];
+    std::int64_t m_releasedTermCount = -1;
+    bool m_lazy = false;
 };
 
 }
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+#include "LogBuffersMapper.h"
+
+namespace aeron {
+
+LogBuffersMapper::LogBuffersMapper(bool preTouch, bool lock, bool lazy, const std::string& name) :
+    m_preTouchMappedMemory(preTouch),
+    m_lockMappedMemory(lock),
+    m_lazyMapLogBuffers(lazy),
+    m_name(name)
+{
+    m_thread = std::thread([this]() { run(); });
+}
+
+LogBuffersMapper::~LogBuffersMapper()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_running = false;
+    }
+
+    m_condition.notify_one();
+    m_thread.join();
+}
+
+void LogBuffersMapper::map(const std::string& logFileName)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_requests.push_back(logFileName);
+    }
+
+    m_condition.notify_one();
+}
+
+void LogBuffersMapper::run()
+{
+#if defined(__linux__)
+    // thread names are limited to 15 characters plus the terminator
+    pthread_setname_np(pthread_self(), m_name.substr(0, 15).c_str());
+#elif defined(__APPLE__)
+    pthread_setname_np(m_name.substr(0, 15).c_str());
+#endif
+
+    while (true)
+    {
+        std::string logFileName;
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_condition.wait(lock, [this]() { return !m_running || !m_requests.empty(); });
+
+            if (!m_running)
+            {
+                return;
+            }
+
+            logFileName = std::move(m_requests.front());
+            m_requests.pop_front();
+        }
+
+        Mapped mapped;
+        mapped.m_logFileName = logFileName;
+
+        try
+        {
+            mapped.m_logBuffers = std::make_shared<LogBuffers>(
+                logFileName.c_str(), m_preTouchMappedMemory, m_lockMappedMemory, m_lazyMapLogBuffers);
+        }
+        catch (const std::exception& ex)
+        {
+            mapped.m_errorMessage = ex.what();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_mapped.push_back(std::move(mapped));
+            m_hasMapped.store(true, std::memory_order_release);
+        }
+    }
+}
+
+}
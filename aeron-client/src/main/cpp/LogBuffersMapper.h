@@ -0,0 +1,110 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_LOG_BUFFERS_MAPPER__
+#define INCLUDED_AERON_LOG_BUFFERS_MAPPER__
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+
+#include "LogBuffers.h"
+
+namespace aeron {
+
+/**
+ * Maps log files on a thread of its own so the page faults of pre-touching, and the time to lock or map a log
+ * backed by huge pages, are not taken on the client conductor thread. Logs are mapped in the order they are asked
+ * for and handed back through drainMapped, which the conductor calls from its duty cycle.
+ */
+class LogBuffersMapper
+{
+public:
+    struct Mapped
+    {
+        std::string m_logFileName;
+        std::shared_ptr<LogBuffers> m_logBuffers;
+        std::string m_errorMessage;
+    };
+
+    LogBuffersMapper(bool preTouch, bool lock, bool lazy, const std::string& name = "aeron-log-mapper");
+
+    ~LogBuffersMapper();
+
+    LogBuffersMapper(const LogBuffersMapper&) = delete;
+    LogBuffersMapper& operator=(const LogBuffersMapper&) = delete;
+
+    /**
+     * Ask for a log file to be mapped. Every request gets its own result, so callers map a file once at a time.
+     */
+    void map(const std::string& logFileName);
+
+    /**
+     * Hand each log mapped since the last call to the handler, on the calling thread. A log that could not be mapped
+     * has null LogBuffers and the reason in the error message.
+     *
+     * @param handler called with each Mapped.
+     * @return the number of logs handed over.
+     */
+    template <typename F>
+    inline int drainMapped(F&& handler)
+    {
+        if (!m_hasMapped.load(std::memory_order_acquire))
+        {
+            return 0;
+        }
+
+        std::vector<Mapped> mapped;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            mapped.swap(m_mapped);
+            m_hasMapped.store(false, std::memory_order_relaxed);
+        }
+
+        for (Mapped& entry : mapped)
+        {
+            handler(entry);
+        }
+
+        return static_cast<int>(mapped.size());
+    }
+
+private:
+    void run();
+
+    const bool m_preTouchMappedMemory;
+    const bool m_lockMappedMemory;
+    const bool m_lazyMapLogBuffers;
+    const std::string m_name;
+
+    std::mutex m_lock;
+    std::condition_variable m_condition;
+    std::deque<std::string> m_requests;
+    std::vector<Mapped> m_mapped;
+    std::atomic<bool> m_hasMapped{false};
+    bool m_running = true;
+
+    std::thread m_thread;
+};
+
+}
+
+#endif
@@ -0,0 +1,254 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_MESSAGECOMPRESSION_H
+#define AERON_MESSAGECOMPRESSION_H
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "Aeron.h"
+
+namespace aeron {
+
+/**
+ * Codec used to compress and decompress whole messages, see {@link MessageCompressor} and
+ * {@link MessageDecompressor}. An instance is used by one thread at a time.
+ */
+class MessageCodec
+{
+public:
+    virtual ~MessageCodec() = default;
+
+    /**
+     * The greatest length that a message of length bytes may compress to.
+     */
+    virtual util::index_t maxCompressedLength(util::index_t length) = 0;
+
+    /**
+     * Compress a message.
+     *
+     * @param src      message to compress.
+     * @param length   of the message.
+     * @param dst      to which the compressed message is written.
+     * @param capacity of dst which is at least maxCompressedLength(length).
+     * @return the compressed length or -1 if the message could not be compressed.
+     */
+    virtual util::index_t compress(
+        const std::uint8_t *src, util::index_t length, std::uint8_t *dst, util::index_t capacity) = 0;
+
+    /**
+     * Decompress a message.
+     *
+     * @param src           compressed message.
+     * @param length        of the compressed message.
+     * @param dst           to which the message is written.
+     * @param decodedLength of the message which dst has capacity for.
+     * @return true if the message decompressed to exactly decodedLength bytes.
+     */
+    virtual bool decompress(
+        const std::uint8_t *src, util::index_t length, std::uint8_t *dst, util::index_t decodedLength) = 0;
+};
+
+/**
+ * Each message is prefixed by the length it decompresses to, or STORED if it is sent as is because it is short or
+ * did not compress.
+ */
+namespace MessageCompression {
+
+static const util::index_t HEADER_LENGTH = sizeof(std::int32_t);
+static const std::int32_t STORED = -1;
+static const util::index_t DEFAULT_MIN_COMPRESS_LENGTH = 64;
+
+}
+
+/**
+ * Compresses messages before they are offered to a Publication or ExclusivePublication.
+ * <p>
+ * Compression is per message so the driver still batches the compressed messages of a stream into datagrams. Every
+ * message offered to the stream must pass through a compressor and be received through a {@link MessageDecompressor}
+ * with the same codec. Messages shorter than the minimum compress length, or which grow, are sent as is.
+ */
+class MessageCompressor
+{
+public:
+    /**
+     * @param codec             with which messages are compressed.
+     * @param minCompressLength below which messages are sent as is.
+     */
+    explicit MessageCompressor(
+        std::shared_ptr<MessageCodec> codec,
+        util::index_t minCompressLength = MessageCompression::DEFAULT_MIN_COMPRESS_LENGTH) :
+        m_codec(std::move(codec)),
+        m_minCompressLength(minCompressLength)
+    {
+    }
+
+    /**
+     * Compress a message and offer it to a publication.
+     *
+     * @param publication to offer to.
+     * @param buffer      containing the message.
+     * @param offset      of the message in the buffer.
+     * @param length      of the message.
+     * @return the result of the offer to the publication.
+     */
+    template<typename P>
+    inline std::int64_t offer(P& publication, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        const util::index_t encodedLength = encode(buffer.buffer() + offset, length);
+        AtomicBuffer encoded(m_buffer.data(), encodedLength);
+
+        return publication.offer(encoded, 0, encodedLength);
+    }
+
+    /**
+     * Compress a message into the scratch buffer of the compressor with the header in front.
+     *
+     * @param src    message to compress.
+     * @param length of the message.
+     * @return the length of the encoded message at the start of buffer().
+     */
+    inline util::index_t encode(const std::uint8_t *src, util::index_t length)
+    {
+        if (length >= m_minCompressLength)
+        {
+            const util::index_t maxLength = m_codec->maxCompressedLength(length);
+            ensureCapacity(MessageCompression::HEADER_LENGTH + maxLength);
+
+            const util::index_t compressedLength = m_codec->compress(
+                src, length, m_buffer.data() + MessageCompression::HEADER_LENGTH, maxLength);
+
+            if (compressedLength >= 0 && compressedLength < length)
+            {
+                putHeader(length);
+                return MessageCompression::HEADER_LENGTH + compressedLength;
+            }
+        }
+
+        ensureCapacity(MessageCompression::HEADER_LENGTH + length);
+        putHeader(MessageCompression::STORED);
+        std::memcpy(m_buffer.data() + MessageCompression::HEADER_LENGTH, src, static_cast<std::size_t>(length));
+
+        return MessageCompression::HEADER_LENGTH + length;
+    }
+
+    inline std::uint8_t *buffer()
+    {
+        return m_buffer.data();
+    }
+
+private:
+    std::shared_ptr<MessageCodec> m_codec;
+    util::index_t m_minCompressLength;
+    std::vector<std::uint8_t> m_buffer;
+
+    inline void ensureCapacity(util::index_t capacity)
+    {
+        if (m_buffer.size() < static_cast<std::size_t>(capacity))
+        {
+            m_buffer.resize(static_cast<std::size_t>(capacity));
+        }
+    }
+
+    inline void putHeader(std::int32_t value)
+    {
+        std::memcpy(m_buffer.data(), &value, sizeof(value));
+    }
+};
+
+/**
+ * A handler that sits in a chain-of-responsibility pattern that decompresses messages sent through a
+ * {@link MessageCompressor} so the next handler in the chain sees them as they were offered.
+ * <p>
+ * Messages are compressed whole so fragmented messages must be reassembled first, by passing the handler of a
+ * decompressor to a FragmentAssembler. Messages sent as is are delegated without copy.
+ */
+class MessageDecompressor
+{
+public:
+    /**
+     * @param codec    with which messages were compressed.
+     * @param delegate onto which decompressed messages are forwarded.
+     */
+    MessageDecompressor(std::shared_ptr<MessageCodec> codec, const fragment_handler_t& delegate) :
+        m_codec(std::move(codec)),
+        m_delegate(delegate)
+    {
+    }
+
+    /**
+     * Compose a fragment_handler_t that calls this MessageDecompressor instance.
+     *
+     * @return fragment_handler_t composed with the MessageDecompressor instance.
+     */
+    fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            this->onMessage(buffer, offset, length, header);
+        };
+    }
+
+private:
+    std::shared_ptr<MessageCodec> m_codec;
+    fragment_handler_t m_delegate;
+    std::vector<std::uint8_t> m_buffer;
+
+    inline void onMessage(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        if (length < MessageCompression::HEADER_LENGTH)
+        {
+            throw util::IllegalStateException(
+                util::strPrintf("message too short for compression header: length=%d", length), SOURCEINFO);
+        }
+
+        const std::int32_t decodedLength = buffer.getInt32(offset);
+        const util::index_t bodyOffset = offset + MessageCompression::HEADER_LENGTH;
+        const util::index_t bodyLength = length - MessageCompression::HEADER_LENGTH;
+
+        if (MessageCompression::STORED == decodedLength)
+        {
+            m_delegate(buffer, bodyOffset, bodyLength, header);
+            return;
+        }
+
+        if (decodedLength < 0)
+        {
+            throw util::IllegalStateException(
+                util::strPrintf("invalid decompressed length: %d", decodedLength), SOURCEINFO);
+        }
+
+        if (m_buffer.size() < static_cast<std::size_t>(decodedLength))
+        {
+            m_buffer.resize(static_cast<std::size_t>(decodedLength));
+        }
+
+        if (!m_codec->decompress(buffer.buffer() + bodyOffset, bodyLength, m_buffer.data(), decodedLength))
+        {
+            throw util::IllegalStateException(
+                util::strPrintf("could not decompress message: length=%d", decodedLength), SOURCEINFO);
+        }
+
+        AtomicBuffer decoded(m_buffer.data(), decodedLength);
+        m_delegate(decoded, 0, decodedLength, header);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_MESSAGEFILTER_H
+#define AERON_MESSAGEFILTER_H
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <util/Exceptions.h>
+#include <util/StringUtil.h>
+#include <concurrent/AtomicBuffer.h>
+#include <concurrent/logbuffer/Header.h>
+
+namespace aeron {
+
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::logbuffer;
+
+/**
+ * A test on the leading bytes of a message for Image::filteredPoll and Subscription::filteredPoll, so consumers that
+ * want a small share of a stream pass over the rest reading no more than the frame header and the bytes tested.
+ * <p>
+ * Every subscriber of an Image reads the same log, mapped from the same file and for IPC written in place by the
+ * publisher, so the driver cannot give subscribers different views of it and the filter runs in the subscriber as the
+ * log is read. Messages shorter than the bytes a filter tests never match it.
+ */
+class MessageFilter
+{
+public:
+    /** Greatest type id a typeIds filter can match. */
+    static const std::uint16_t MAX_TYPE_ID = 255;
+
+    /**
+     * Filter matching every message.
+     */
+    static MessageFilter all()
+    {
+        return MessageFilter(Kind::ALL, 0);
+    }
+
+    /**
+     * Filter matching messages with the given bytes at offset in the payload.
+     *
+     * @param offset in the payload of the bytes.
+     * @param value  bytes to match.
+     * @param length of the bytes, at most 8.
+     */
+    static MessageFilter bytes(util::index_t offset, const std::uint8_t *value, util::index_t length)
+    {
+        if (length < 1 || length > 8)
+        {
+            throw util::IllegalArgumentException(
+                util::strPrintf("filter bytes length must be 1 to 8: length=%d", length), SOURCEINFO);
+        }
+
+        MessageFilter filter(Kind::BYTES, offset);
+        for (util::index_t i = 0; i < length; i++)
+        {
+            filter.m_value |= static_cast<std::uint64_t>(value[i]) << (i * 8);
+            filter.m_mask |= static_cast<std::uint64_t>(0xFF) << (i * 8);
+        }
+        filter.m_length = length;
+
+        return filter;
+    }
+
+    /**
+     * Filter matching messages whose little endian uint16 type id at offset in the payload is one of typeIds, such as
+     * the template id of an SBE message header at offset 2.
+     *
+     * @param offset  in the payload of the type id.
+     * @param typeIds to match, each at most MAX_TYPE_ID.
+     */
+    static MessageFilter typeIds(util::index_t offset, std::initializer_list<std::uint16_t> typeIds)
+    {
+        MessageFilter filter(Kind::TYPE_IDS, offset);
+        for (const std::uint16_t typeId : typeIds)
+        {
+            if (typeId > MAX_TYPE_ID)
+            {
+                throw util::IllegalArgumentException(
+                    util::strPrintf("filter type id out of range: typeId=%d", typeId), SOURCEINFO);
+            }
+
+            filter.m_typeIds[typeId >> 6] |= static_cast<std::uint64_t>(1) << (typeId & 63);
+        }
+        filter.m_length = sizeof(std::uint16_t);
+
+        return filter;
+    }
+
+    /**
+     * Filter matching messages whose int64 key at offset in the payload hashes to shardIndex of shardCount shards.
+     *
+     * @param offset     in the payload of the key.
+     * @param shardCount over which keys are spread.
+     * @param shardIndex to match from 0 to shardCount - 1.
+     */
+    static MessageFilter keyShard(util::index_t offset, int shardCount, int shardIndex)
+    {
+        if (shardCount < 1 || shardIndex < 0 || shardIndex >= shardCount)
+        {
+            throw util::IllegalArgumentException(
+                util::strPrintf("invalid filter shard: index=%d count=%d", shardIndex, shardCount), SOURCEINFO);
+        }
+
+        MessageFilter filter(Kind::KEY_SHARD, offset);
+        filter.m_shardCount = shardCount;
+        filter.m_shardIndex = shardIndex;
+        filter.m_length = sizeof(std::int64_t);
+
+        return filter;
+    }
+
+    /**
+     * Shard of shardCount to which a key hashes.
+     */
+    static inline int shardOf(std::int64_t key, int shardCount)
+    {
+        /* keys are often sequential or aligned, so mix before taking the remainder */
+        const std::uint64_t hash = static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ULL;
+
+        return static_cast<int>((hash >> 32) % static_cast<std::uint64_t>(shardCount));
+    }
+
+    inline bool matches(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header&) const
+    {
+        if (Kind::ALL == m_kind)
+        {
+            return true;
+        }
+
+        if (length < m_offset + m_length)
+        {
+            return false;
+        }
+
+        const util::index_t index = offset + m_offset;
+
+        switch (m_kind)
+        {
+            case Kind::BYTES:
+            {
+                std::uint64_t value = 0;
+                for (util::index_t i = 0; i < m_length; i++)
+                {
+                    value |= static_cast<std::uint64_t>(buffer.getUInt8(index + i)) << (i * 8);
+                }
+
+                return (value & m_mask) == m_value;
+            }
+
+            case Kind::TYPE_IDS:
+            {
+                const std::uint16_t typeId = buffer.getUInt16(index);
+
+                return typeId <= MAX_TYPE_ID &&
+                    0 != (m_typeIds[typeId >> 6] & (static_cast<std::uint64_t>(1) << (typeId & 63)));
+            }
+
+            case Kind::KEY_SHARD:
+                return shardOf(buffer.getInt64(index), m_shardCount) == m_shardIndex;
+
+            default:
+                return true;
+        }
+    }
+
+private:
+    enum class Kind : std::uint8_t
+    {
+        ALL,
+        BYTES,
+        TYPE_IDS,
+        KEY_SHARD
+    };
+
+    Kind m_kind;
+    util::index_t m_offset;
+    util::index_t m_length = 0;
+    std::uint64_t m_value = 0;
+    std::uint64_t m_mask = 0;
+    int m_shardCount = 1;
+    int m_shardIndex = 0;
+    std::array<std::uint64_t, 4> m_typeIds = {};
+
+    MessageFilter(Kind kind, util::index_t offset) :
+        m_kind(kind), m_offset(offset)
+    {
+    }
+};
+
+}
+
+#endif
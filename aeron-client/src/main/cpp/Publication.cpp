@@ -44,6 +44,7 @@ Publication::Publication(
     m_positionBitsToShift(util::BitUtil::numberOfTrailingZeroes(buffers->atomicBuffer(0).capacity())),
     m_publicationLimit(publicationLimit),
     m_channelStatusId(channelStatusId),
+    m_isSubscriberWakeup(LogBufferDescriptor::isSubscriberWakeup(m_logMetaDataBuffer)),
     m_logbuffers(buffers),
     m_headerWriter(LogBufferDescriptor::defaultFrameHeader(m_logMetaDataBuffer))
 {
@@ -95,4 +96,10 @@ std::int64_t Publication::channelStatus()
 
     return m_conductor.channelStatus(m_channelStatusId);
 }
+
+std::int64_t Publication::clientPublisherLimit(std::int64_t limit)
+{
+    return LogBufferDescriptor::clientPublisherLimit(m_logMetaDataBuffer, m_conductor.countersReader(), limit);
+}
+
 }
@@ -23,8 +23,10 @@
 #include <concurrent/AtomicBuffer.h>
 #include <concurrent/logbuffer/BufferClaim.h>
 #include <concurrent/logbuffer/TermAppender.h>
+#include <concurrent/logbuffer/TermReservation.h>
 #include <concurrent/status/UnsafeBufferPosition.h>
 #include "concurrent/status/StatusIndicatorReader.h"
+#include "util/Probes.h"
 #include "LogBuffers.h"
 
 namespace aeron {
@@ -39,6 +41,12 @@ static const std::int64_t ADMIN_ACTION = -3;
 static const std::int64_t PUBLICATION_CLOSED = -4;
 static const std::int64_t MAX_POSITION_EXCEEDED = -5;
 
+/**
+ * The message was longer than the max message length. Only returned when built with AERON_NOEXCEPT_HOT_PATH,
+ * otherwise an IllegalStateException is thrown.
+ */
+static const std::int64_t MAX_MESSAGE_LENGTH_EXCEEDED = -6;
+
 /**
  * @example BasicPublisher.cpp
  */
@@ -234,6 +242,26 @@ public:
         return m_publicationLimit.getVolatile();
     }
 
+    /**
+     * Park the calling thread until the driver advances the publication limit beyond the current position, rather
+     * than spinning on offer after {@link #BACK_PRESSURED}. The driver wakes waiting publishers when it moves the
+     * limit so the thread uses no CPU while it is parked.
+     *
+     * @param timeoutNs to wait at most.
+     * @return true if the limit is beyond the current position so an offer may now succeed.
+     */
+    inline bool awaitPublicationLimit(std::int64_t timeoutNs)
+    {
+        const std::int64_t currentPosition = position();
+
+        if (PUBLICATION_CLOSED == currentPosition)
+        {
+            return false;
+        }
+
+        return m_publicationLimit.awaitAbove(currentPosition, timeoutNs);
+    }
+
     /**
      * Get the counter id used to represent the publication limit.
      *
@@ -260,15 +288,17 @@ public:
      * @param buffer containing message.
      * @param offset offset in the buffer at which the encoded message begins.
      * @param length in bytes of the encoded message.
-     * @param reservedValueSupplier for the frame.
+     * @param reservedValueSupplier for the frame, any callable with the signature of on_reserved_value_supplier_t
+     * which is taken by type so it can be inlined.
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
-     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * {@link #ADMIN_ACTION}, {@link #CLOSED} or, when built with AERON_NOEXCEPT_HOT_PATH,
+     * {@link #MAX_MESSAGE_LENGTH_EXCEEDED}.
      */
-    inline std::int64_t offer(
+    template <typename ReservedValueSupplier> inline std::int64_t offer(
         concurrent::AtomicBuffer& buffer,
         util::index_t offset,
         util::index_t length,
-        const on_reserved_value_supplier_t& reservedValueSupplier)
+        const ReservedValueSupplier& reservedValueSupplier) AERON_HOT_PATH_NOEXCEPT
     {
         std::int64_t newPosition = PUBLICATION_CLOSED;
 
@@ -286,10 +316,11 @@ public:
 
             if (termCount != (termId - m_initialTermId))
             {
+                AERON_CLIENT_PROBE3(publication_offer, m_sessionId, m_streamId, ADMIN_ACTION);
                 return ADMIN_ACTION;
             }
 
-            if (position < limit)
+            if (position < limit || position < clientPublisherLimit(limit))
             {
                 std::int32_t resultingOffset;
                 if (length <= m_maxPayloadLength)
@@ -299,7 +330,14 @@ public:
                 }
                 else
                 {
+#if defined(AERON_NOEXCEPT_HOT_PATH)
+                    if (length > m_maxMessageLength)
+                    {
+                        return MAX_MESSAGE_LENGTH_EXCEEDED;
+                    }
+#else
                     checkForMaxMessageLength(length);
+#endif
                     resultingOffset = termAppender->appendFragmentedMessage(
                         m_headerWriter, buffer, offset, length, m_maxPayloadLength, reservedValueSupplier, termId);
                 }
@@ -314,6 +352,8 @@ public:
             }
         }
 
+        AERON_CLIENT_PROBE3(publication_offer, m_sessionId, m_streamId, newPosition);
+
         return newPosition;
     }
 
@@ -326,9 +366,10 @@ public:
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
      * {@link #ADMIN_ACTION} or {@link #CLOSED}.
      */
-    inline std::int64_t offer(concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    inline std::int64_t offer(
+        concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length) AERON_HOT_PATH_NOEXCEPT
     {
-        return offer(buffer, offset, length, DEFAULT_RESERVED_VALUE_SUPPLIER);
+        return offer(buffer, offset, length, NoReservedValueSupplier());
     }
 
     /**
@@ -337,7 +378,7 @@ public:
      * @param buffer containing message.
      * @return The new stream position on success, otherwise {@link BACK_PRESSURED} or {@link NOT_CONNECTED}.
      */
-    inline std::int64_t offer(concurrent::AtomicBuffer& buffer)
+    inline std::int64_t offer(concurrent::AtomicBuffer& buffer) AERON_HOT_PATH_NOEXCEPT
     {
         return offer(buffer, 0, buffer.capacity());
     }
@@ -351,10 +392,10 @@ public:
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
      * {@link #ADMIN_ACTION} or {@link #CLOSED}.
      */
-    template <class BufferIterator> std::int64_t offer(
+    template <class BufferIterator, typename ReservedValueSupplier = NoReservedValueSupplier> std::int64_t offer(
         BufferIterator startBuffer,
         BufferIterator lastBuffer,
-        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
     {
         util::index_t length = 0;
         for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
@@ -388,10 +429,11 @@ public:
 
             if (termCount != (termId - m_initialTermId))
             {
+                AERON_CLIENT_PROBE3(publication_offer, m_sessionId, m_streamId, ADMIN_ACTION);
                 return ADMIN_ACTION;
             }
 
-            if (position < limit)
+            if (position < limit || position < clientPublisherLimit(limit))
             {
                 std::int32_t resultingOffset;
                 if (length <= m_maxPayloadLength)
@@ -416,6 +458,8 @@ public:
             }
         }
 
+        AERON_CLIENT_PROBE3(publication_offer, m_sessionId, m_streamId, newPosition);
+
         return newPosition;
     }
 
@@ -428,10 +472,10 @@ public:
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
      * {@link #ADMIN_ACTION} or {@link #CLOSED}.
      */
-    std::int64_t offer(
+    template <typename ReservedValueSupplier = NoReservedValueSupplier> std::int64_t offer(
         const concurrent::AtomicBuffer buffers[],
         size_t length,
-        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
     {
         return offer(buffers, buffers + length, reservedValueSupplier);
     }
@@ -444,13 +488,85 @@ public:
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
      * {@link #ADMIN_ACTION} or {@link #CLOSED}.
      */
-    template <size_t N> std::int64_t offer(
+    template <size_t N, typename ReservedValueSupplier = NoReservedValueSupplier> std::int64_t offer(
         const std::array<concurrent::AtomicBuffer, N>& buffers,
-        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
     {
         return offer(buffers.begin(), buffers.end(), reservedValueSupplier);
     }
 
+    /**
+     * Non-blocking publish of a batch of messages, one message per buffer, with the space for the whole batch
+     * reserved by a single atomic increment of the tail. Each message must fit in {@link #maxPayloadLength()} and the aligned
+     * length of the batch, including frame headers, must not exceed {@link #maxMessageLength()}. The batch is
+     * appended in full or not at all.
+     *
+     * @param startBuffer first message of the batch.
+     * @param lastBuffer after the last message of the batch.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position after the batch, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    template <class BufferIterator, typename ReservedValueSupplier = NoReservedValueSupplier> std::int64_t offerBatch(
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
+    {
+        const util::index_t batchLength = computeBatchLength(startBuffer, lastBuffer);
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            const std::int32_t termCount = LogBufferDescriptor::activeTermCount(m_logMetaDataBuffer);
+            TermAppender *termAppender = m_appenders[LogBufferDescriptor::indexByTermCount(termCount)].get();
+            const std::int64_t rawTail = termAppender->rawTailVolatile();
+            const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+            const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+            const std::int64_t position =
+                LogBufferDescriptor::computeTermBeginPosition(
+                    termId, m_positionBitsToShift, m_initialTermId) + termOffset;
+
+            if (termCount != (termId - m_initialTermId))
+            {
+                return ADMIN_ACTION;
+            }
+
+            if (position < limit || position < clientPublisherLimit(limit))
+            {
+                const std::int32_t resultingOffset = termAppender->appendUnfragmentedBatch(
+                    m_headerWriter, startBuffer, lastBuffer, batchLength, reservedValueSupplier, termId);
+
+                newPosition =
+                    Publication::newPosition(
+                        termCount, static_cast<std::int32_t>(termOffset), termId, position, resultingOffset);
+            }
+            else
+            {
+                newPosition = Publication::backPressureStatus(position, batchLength);
+            }
+        }
+
+        return newPosition;
+    }
+
+    /**
+     * Non-blocking publish of an array of buffers as a batch of messages, one message per buffer.
+     *
+     * @param buffers containing the messages.
+     * @param length of the array of buffers.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position after the batch, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    template <typename ReservedValueSupplier = NoReservedValueSupplier> std::int64_t offerBatch(
+        const concurrent::AtomicBuffer buffers[],
+        size_t length,
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
+    {
+        return offerBatch(buffers, buffers + length, reservedValueSupplier);
+    }
+
     /**
      * Try to claim a range in the publication log into which a message can be written with zero copy semantics.
      * Once the message has been written then {@link BufferClaim#commit()} should be called thus making it available.
@@ -505,7 +621,7 @@ public:
                 return ADMIN_ACTION;
             }
 
-            if (position < limit)
+            if (position < limit || position < clientPublisherLimit(limit))
             {
                 const std::int32_t resultingOffset = termAppender->claim(m_headerWriter, length, bufferClaim, termId);
                 newPosition =
@@ -521,6 +637,164 @@ public:
         return newPosition;
     }
 
+    /**
+     * Try to claim a range in the publication log for a message of up to {@link #maxMessageLength()}, split into as
+     * many fragments as it needs, into which the message can be encoded in place. Once the message has been written
+     * then {@link FragmentedBufferClaim#commit()} should be called to make it available.
+     *
+     * @code
+     * FragmentedBufferClaim bufferClaim;
+     *
+     *     if (publication->tryClaimFragmented(messageLength, bufferClaim) > 0)
+     *     {
+     *         for (int i = 0; i < bufferClaim.fragmentCount(); i++)
+     *         {
+     *             AtomicBuffer fragment = bufferClaim.fragment(i);
+     *             // Encode the next part of the message into fragment
+     *         }
+     *
+     *         bufferClaim.commit();
+     *     }
+     * @endcode
+     *
+     * @param length      of the message to claim, in bytes.
+     * @param bufferClaim to be populated if the claim succeeds.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * @throws IllegalArgumentException if the length is not positive.
+     * @throws IllegalStateException if the length is greater than max message length.
+     * @see FragmentedBufferClaim::commit
+     */
+    inline std::int64_t tryClaimFragmented(
+        util::index_t length, concurrent::logbuffer::FragmentedBufferClaim& bufferClaim)
+    {
+        if (length <= 0)
+        {
+            throw util::IllegalArgumentException(
+                util::strPrintf("claim length must be positive, length=%d", length), SOURCEINFO);
+        }
+
+        checkForMaxMessageLength(length);
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            const std::int32_t termCount = LogBufferDescriptor::activeTermCount(m_logMetaDataBuffer);
+            TermAppender *termAppender = m_appenders[LogBufferDescriptor::indexByTermCount(termCount)].get();
+            const std::int64_t rawTail = termAppender->rawTailVolatile();
+            const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+            const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+            const std::int64_t position =
+                LogBufferDescriptor::computeTermBeginPosition(
+                    termId, m_positionBitsToShift, m_initialTermId) + termOffset;
+
+            if (termCount != (termId - m_initialTermId))
+            {
+                return ADMIN_ACTION;
+            }
+
+            if (position < limit || position < clientPublisherLimit(limit))
+            {
+                const std::int32_t resultingOffset = termAppender->claimFragmented(
+                    m_headerWriter, length, m_maxPayloadLength, bufferClaim, termId);
+                newPosition =
+                    Publication::newPosition(
+                        termCount, static_cast<std::int32_t>(termOffset), termId, position, resultingOffset);
+            }
+            else
+            {
+                newPosition = Publication::backPressureStatus(position, length);
+            }
+        }
+
+        return newPosition;
+    }
+
+    /**
+     * Try to reserve a range of the publication log for the calling thread with a single increment of the shared tail.
+     * Messages are then appended into the reservation, each as an unfragmented frame, with no further contention on the
+     * tail with other publishing threads. The unused part is padded by {@link TermReservation#release()}.
+     *
+     * @code
+     * TermReservation reservation;
+     *
+     *     if (publication->tryReserve(64 * 1024, reservation) > 0)
+     *     {
+     *         while (haveMessages() && reservation.append(buffer, 0, messageLength))
+     *         {
+     *             ...
+     *         }
+     *
+     *         reservation.release();
+     *     }
+     * @endcode
+     *
+     * @param length      of the range to reserve, in bytes, rounded up to the frame alignment.
+     * @param reservation to be populated if the reservation succeeds.
+     * @return The new stream position at the end of the reserved range, otherwise {@link #NOT_CONNECTED},
+     * {@link #BACK_PRESSURED}, {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * @throws IllegalArgumentException if the length is less than a frame header.
+     * @throws IllegalStateException if the length is greater than max message length.
+     * @see TermReservation::release
+     */
+    inline std::int64_t tryReserve(util::index_t length, concurrent::logbuffer::TermReservation& reservation)
+    {
+        if (length < DataFrameHeader::LENGTH)
+        {
+            throw util::IllegalArgumentException(
+                util::strPrintf("reservation must hold at least a frame header, length=%d", length), SOURCEINFO);
+        }
+
+        const util::index_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
+        checkForMaxMessageLength(alignedLength);
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            const std::int32_t termCount = LogBufferDescriptor::activeTermCount(m_logMetaDataBuffer);
+            TermAppender *termAppender = m_appenders[LogBufferDescriptor::indexByTermCount(termCount)].get();
+            const std::int64_t rawTail = termAppender->rawTailVolatile();
+            const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+            const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+            const std::int64_t position =
+                LogBufferDescriptor::computeTermBeginPosition(
+                    termId, m_positionBitsToShift, m_initialTermId) + termOffset;
+
+            if (termCount != (termId - m_initialTermId))
+            {
+                return ADMIN_ACTION;
+            }
+
+            if (position < limit || position < clientPublisherLimit(limit))
+            {
+                const std::int32_t resultingOffset = termAppender->reserve(m_headerWriter, alignedLength, termId);
+                if (resultingOffset > 0)
+                {
+                    reservation.wrap(
+                        termAppender->termBuffer(),
+                        m_headerWriter,
+                        termId,
+                        resultingOffset - alignedLength,
+                        resultingOffset,
+                        m_maxPayloadLength,
+                        position - termOffset);
+                }
+
+                newPosition =
+                    Publication::newPosition(
+                        termCount, static_cast<std::int32_t>(termOffset), termId, position, resultingOffset);
+            }
+            else
+            {
+                newPosition = Publication::backPressureStatus(position, alignedLength);
+            }
+        }
+
+        return newPosition;
+    }
+
     /**
      * Add a destination manually to a multi-destination-cast Publication.
      *
@@ -565,11 +839,14 @@ private:
     ReadablePosition<UnsafeBufferPosition> m_publicationLimit;
     std::int32_t m_channelStatusId;
     std::atomic<bool> m_isClosed = { false };
+    bool m_isSubscriberWakeup;
 
     std::shared_ptr<LogBuffers> m_logbuffers;
-    std::unique_ptr<TermAppender> m_appenders[3];
+    std::unique_ptr<TermAppender> m_appenders[LogBufferDescriptor::PARTITION_COUNT];
     HeaderWriter m_headerWriter;
 
+    std::int64_t clientPublisherLimit(std::int64_t limit);
+
     inline std::int64_t newPosition(
         std::int32_t termCount,
         std::int32_t termOffset,
@@ -579,6 +856,11 @@ private:
     {
         if (resultingOffset > 0)
         {
+            if (m_isSubscriberWakeup)
+            {
+                LogBufferDescriptor::signalSubscribers(m_logMetaDataBuffer);
+            }
+
             return (position - termOffset) + resultingOffset;
         }
 
@@ -627,6 +909,25 @@ private:
         }
     }
 
+    template <class BufferIterator> util::index_t computeBatchLength(BufferIterator startBuffer, BufferIterator lastBuffer)
+    {
+        util::index_t batchLength = 0;
+        for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+        {
+            checkForMaxPayloadLength(it->capacity());
+            batchLength +=
+                util::BitUtil::align(it->capacity() + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+            checkForMaxMessageLength(batchLength);
+        }
+
+        if (0 == batchLength)
+        {
+            throw util::IllegalArgumentException("batch must contain at least one message", SOURCEINFO);
+        }
+
+        return batchLength;
+    }
+
 };
 
 }
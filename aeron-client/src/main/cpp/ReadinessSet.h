@@ -0,0 +1,276 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_READINESSSET_H
+#define AERON_READINESSSET_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include "Subscription.h"
+#include "concurrent/reports/StreamActivityReader.h"
+
+namespace aeron {
+
+/**
+ * Finds the images with data to poll across many Subscriptions in one pass, for applications with too many mostly
+ * idle Subscriptions to poll each in turn.
+ * <p>
+ * An image is ready when a frame has been written at its subscriber position, which is what a poll would read first.
+ * The publisher tail in the log meta data is not used as images of network publications do not maintain it. The
+ * addresses of the positions and logs of all images are kept in parallel arrays, rebuilt only when a Subscription
+ * gains or loses an image, so a pass is a run of independent loads followed by a branch free gather of the ready
+ * indices rather than a call and a mispredicted branch per image.
+ * <p>
+ * With a StreamActivityReader over the stream activity ring of the driver, only the images the driver has flagged as
+ * having had data added, and those still ready at the last pass, are checked, so the cost of a pass follows the number
+ * of active streams rather than the number of streams.
+ * <p>
+ * Not thread safe, a ReadinessSet is to be used by the thread polling its Subscriptions.
+ */
+class ReadinessSet
+{
+public:
+    ReadinessSet() = default;
+
+    ReadinessSet(const ReadinessSet&) = delete;
+    ReadinessSet& operator=(const ReadinessSet&) = delete;
+
+    /**
+     * Add a Subscription whose images are to be checked for readiness.
+     *
+     * @param subscription to add.
+     */
+    void add(std::shared_ptr<Subscription> subscription)
+    {
+        m_subscriptions.push_back(std::move(subscription));
+        m_versions.push_back(static_cast<std::uint64_t>(NULL_VERSION));
+    }
+
+    /**
+     * Remove a Subscription so its images are no longer checked.
+     *
+     * @param subscription to remove.
+     * @return true if the Subscription was in the set.
+     */
+    bool remove(const Subscription& subscription)
+    {
+        for (std::size_t i = 0; i < m_subscriptions.size(); i++)
+        {
+            if (m_subscriptions[i].get() == &subscription)
+            {
+                m_subscriptions[i] = m_subscriptions.back();
+                m_subscriptions.pop_back();
+                m_versions.pop_back();
+                invalidate();
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    inline std::size_t subscriptionCount() const
+    {
+        return m_subscriptions.size();
+    }
+
+    /**
+     * Call a handler for each image that has a frame to poll at its position.
+     *
+     * @param handler called with the Image, which may be polled from within the handler.
+     * @return the number of ready images.
+     */
+    template <typename F>
+    inline int forEachReadyImage(F&& handler)
+    {
+        if (hasImagesChanged())
+        {
+            rebuild();
+        }
+
+        const std::size_t length = m_images.size();
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            m_frameLengths[i] = frameLengthAtPosition(i);
+        }
+
+        std::size_t readyCount = 0;
+        for (std::size_t i = 0; i < length; i++)
+        {
+            m_readyIndices[readyCount] = static_cast<std::uint32_t>(i);
+            readyCount += m_frameLengths[i] != 0 ? 1 : 0;
+        }
+
+        for (std::size_t i = 0; i < readyCount; i++)
+        {
+            handler(*m_images[m_readyIndices[i]]);
+        }
+
+        return static_cast<int>(readyCount);
+    }
+
+    /**
+     * Call a handler for each image that has a frame to poll at its position, checking only the images read from the
+     * stream activity ring since the last pass and those that were ready at the last pass. All images are checked
+     * when the images of a Subscription have changed or the reader has been lapped.
+     *
+     * @param reader  of the stream activity ring of the driver the Subscriptions are on.
+     * @param handler called with the Image, which may be polled from within the handler.
+     * @return the number of ready images.
+     */
+    template <typename F>
+    inline int forEachActiveImage(concurrent::reports::StreamActivityReader& reader, F&& handler)
+    {
+        bool isFullPass = false;
+
+        if (hasImagesChanged())
+        {
+            rebuild();
+            isFullPass = true;
+        }
+
+        const int entries = reader.poll(
+            [&](std::int64_t correlationId)
+            {
+                auto it = m_indexByCorrelationId.find(correlationId);
+                if (it != m_indexByCorrelationId.end() && 0 == m_isCandidate[it->second])
+                {
+                    m_isCandidate[it->second] = 1;
+                    m_candidateIndices.push_back(it->second);
+                }
+            });
+
+        if (isFullPass || concurrent::reports::StreamActivityReader::LAPPED == entries)
+        {
+            m_candidateIndices.clear();
+            for (std::size_t i = 0; i < m_images.size(); i++)
+            {
+                m_candidateIndices.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        std::size_t readyCount = 0;
+        for (const std::uint32_t index : m_candidateIndices)
+        {
+            m_isCandidate[index] = 0;
+            m_readyIndices[readyCount] = index;
+            readyCount += frameLengthAtPosition(index) != 0 ? 1 : 0;
+        }
+
+        /* an image may not be polled to the end of its data, so it is checked again on the next pass */
+        m_candidateIndices.clear();
+        for (std::size_t i = 0; i < readyCount; i++)
+        {
+            m_isCandidate[m_readyIndices[i]] = 1;
+            m_candidateIndices.push_back(m_readyIndices[i]);
+        }
+
+        for (std::size_t i = 0; i < readyCount; i++)
+        {
+            handler(*m_images[m_readyIndices[i]]);
+        }
+
+        return static_cast<int>(readyCount);
+    }
+
+private:
+    static const std::uint64_t NULL_VERSION = UINT64_MAX;
+
+    std::vector<std::shared_ptr<Subscription>> m_subscriptions;
+    std::vector<std::uint64_t> m_versions;
+
+    std::vector<Image *> m_images;
+    std::vector<volatile std::int64_t *> m_positionAddresses;
+    std::vector<std::uint8_t *> m_logAddresses;
+    std::vector<std::int32_t> m_positionBitsToShift;
+    std::vector<std::int32_t> m_frameLengths;
+    std::vector<std::uint32_t> m_readyIndices;
+
+    std::unordered_map<std::int64_t, std::uint32_t> m_indexByCorrelationId;
+    std::vector<std::uint32_t> m_candidateIndices;
+    std::vector<std::uint8_t> m_isCandidate;
+
+    inline std::int32_t frameLengthAtPosition(std::size_t i) const
+    {
+        const std::int64_t position = atomic::getInt64Volatile(m_positionAddresses[i]);
+        const std::int32_t shift = m_positionBitsToShift[i];
+        const std::int64_t termLength = std::int64_t(1) << shift;
+        const std::int64_t partitionIndex = (position >> shift) % LogBufferDescriptor::PARTITION_COUNT;
+        const std::int64_t offset = (partitionIndex * termLength) + (position & (termLength - 1));
+
+        return atomic::getInt32Volatile(reinterpret_cast<volatile std::int32_t *>(m_logAddresses[i] + offset));
+    }
+
+    inline void invalidate()
+    {
+        for (std::uint64_t& version : m_versions)
+        {
+            version = NULL_VERSION;
+        }
+    }
+
+    inline bool hasImagesChanged() const
+    {
+        bool hasChanged = false;
+
+        for (std::size_t i = 0; i < m_subscriptions.size(); i++)
+        {
+            hasChanged |= m_subscriptions[i]->imageList()->m_version != m_versions[i];
+        }
+
+        return hasChanged;
+    }
+
+    void rebuild()
+    {
+        m_images.clear();
+        m_positionAddresses.clear();
+        m_logAddresses.clear();
+        m_positionBitsToShift.clear();
+        m_indexByCorrelationId.clear();
+        m_candidateIndices.clear();
+
+        for (std::size_t i = 0; i < m_subscriptions.size(); i++)
+        {
+            const struct ImageList *imageList = m_subscriptions[i]->imageList();
+
+            for (std::size_t j = 0; j < imageList->m_length; j++)
+            {
+                Image *image = imageList->m_images[j];
+
+                m_indexByCorrelationId[image->correlationId()] = static_cast<std::uint32_t>(m_images.size());
+                m_images.push_back(image);
+                m_positionAddresses.push_back(image->subscriberPositionAddress());
+                m_logAddresses.push_back(image->logAddress());
+                m_positionBitsToShift.push_back(image->positionBitsToShift());
+            }
+
+            m_versions[i] = imageList->m_version;
+        }
+
+        m_frameLengths.resize(m_images.size());
+        m_readyIndices.resize(m_images.size());
+        m_isCandidate.assign(m_images.size(), 0);
+    }
+};
+
+}
+
+#endif //AERON_READINESSSET_H
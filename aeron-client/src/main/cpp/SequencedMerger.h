@@ -0,0 +1,376 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_SEQUENCEDMERGER_H
+#define AERON_SEQUENCEDMERGER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Subscription.h"
+
+namespace aeron {
+
+/**
+ * Merges the images of many Subscriptions, such as one per feed, into a single stream of fragments in the order of
+ * a timestamp, or other key, that each publisher puts in its fragments.
+ * <p>
+ * The key is read from the first fragment of each message, by default from the reserved value of its header or with
+ * payloadKey from the payload, and the remaining fragments of a message take the key of the first. Keys are to
+ * increase within each image. Each poll peeks the head of every image with Image::controlledPeek and keeps the heads
+ * in a min heap, then repeatedly consumes the image with the lowest key up to the key at the head of the next lowest,
+ * so the handler reads fragments in place in the logs with no copy and k images cost log k per run rather than k.
+ * <p>
+ * An image with nothing to read may yet receive a fragment with a lower key than those waiting in other images. With
+ * a lookahead of 0 the merger does not wait for it, so order is only kept among the fragments available when a poll
+ * starts. With a lookahead greater than 0 a fragment is held back while any image is empty until a fragment with a
+ * key at least lookahead beyond it has been seen, so a quiet feed delays the others by at most lookahead in key.
+ * <p>
+ * Not thread safe, a merger is to be used by the thread polling its Subscriptions.
+ */
+class SequencedMerger
+{
+public:
+    typedef std::int64_t (*key_function_t)(
+        AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header);
+
+    static inline std::int64_t reservedValueKey(AtomicBuffer&, util::index_t, util::index_t, Header& header)
+    {
+        return header.reservedValue();
+    }
+
+    /**
+     * Key read as a little endian int64 at Offset in the payload of the first fragment of a message.
+     */
+    template<util::index_t Offset>
+    static inline std::int64_t payloadKey(AtomicBuffer& buffer, util::index_t offset, util::index_t, Header&)
+    {
+        return buffer.getInt64(offset + Offset);
+    }
+
+    /**
+     * @param keyFunction to read the key of the first fragment of a message.
+     * @param lookahead   in key beyond a fragment to wait for while an image is empty, 0 for no wait.
+     */
+    explicit SequencedMerger(key_function_t keyFunction = reservedValueKey, std::int64_t lookahead = 0) :
+        m_keyFunction(keyFunction), m_lookahead(lookahead)
+    {
+    }
+
+    SequencedMerger(const SequencedMerger&) = delete;
+    SequencedMerger& operator=(const SequencedMerger&) = delete;
+
+    /**
+     * Add a Subscription whose images are to be merged.
+     *
+     * @param subscription to add.
+     */
+    void add(std::shared_ptr<Subscription> subscription)
+    {
+        m_subscriptions.push_back(std::move(subscription));
+    }
+
+    /**
+     * Remove a Subscription so its images are no longer merged.
+     *
+     * @param subscription to remove.
+     * @return true if the Subscription was in the merger.
+     */
+    bool remove(const Subscription& subscription)
+    {
+        for (std::size_t i = 0; i < m_subscriptions.size(); i++)
+        {
+            if (m_subscriptions[i].get() == &subscription)
+            {
+                m_subscriptions.erase(m_subscriptions.begin() + static_cast<std::ptrdiff_t>(i));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Poll the images of the Subscriptions in key order.
+     *
+     * @param fragmentHandler to which fragments are delivered.
+     * @param fragmentLimit   for the number of fragments delivered.
+     * @return the number of fragments delivered.
+     */
+    template<typename F>
+    inline int poll(F&& fragmentHandler, int fragmentLimit)
+    {
+        m_images.clear();
+        for (const std::shared_ptr<Subscription>& subscription : m_subscriptions)
+        {
+            subscription->forEachImage([&](Image& image) { m_images.push_back(&image); });
+        }
+
+        return poll(m_images, fragmentHandler, fragmentLimit);
+    }
+
+    /**
+     * Poll images in key order.
+     *
+     * @param images          to merge.
+     * @param fragmentHandler to which fragments are delivered.
+     * @param fragmentLimit   for the number of fragments delivered.
+     * @return the number of fragments delivered.
+     */
+    template<typename F>
+    inline int poll(const std::vector<Image*>& images, F&& fragmentHandler, int fragmentLimit)
+    {
+        updateLanes(images);
+
+        std::size_t emptyLanes = 0;
+        m_heap.clear();
+        for (std::size_t i = 0; i < m_lanes.size(); i++)
+        {
+            std::int64_t key;
+            if (peek(m_lanes[i], key))
+            {
+                m_heap.emplace_back(key, i);
+            }
+            else
+            {
+                emptyLanes++;
+            }
+        }
+        std::make_heap(m_heap.begin(), m_heap.end(), HeadComparator());
+
+        int fragmentsRead = 0;
+        while (fragmentsRead < fragmentLimit && !m_heap.empty())
+        {
+            if (0 != emptyLanes && isHeldBack(m_heap.front().first))
+            {
+                scanLanes();
+
+                if (isHeldBack(m_heap.front().first))
+                {
+                    break;
+                }
+            }
+
+            std::pop_heap(m_heap.begin(), m_heap.end(), HeadComparator());
+            const std::size_t index = m_heap.back().second;
+            m_heap.pop_back();
+
+            Lane& lane = m_lanes[index];
+            const std::int64_t bound = m_heap.empty() ? std::numeric_limits<std::int64_t>::max() : m_heap.front().first;
+            bool hasNext = false;
+            std::int64_t next = 0;
+
+            fragmentsRead += lane.image->controlledPoll(
+                [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+                {
+                    if (header.flags() & FrameDescriptor::BEGIN_FRAG)
+                    {
+                        const std::int64_t key = m_keyFunction(buffer, offset, length, header);
+
+                        if (key > bound || (0 != emptyLanes && isHeldBack(key)))
+                        {
+                            hasNext = true;
+                            next = key;
+                            return ControlledPollAction::ABORT;
+                        }
+
+                        lane.messageKey = key;
+                        m_maxKey = std::max(m_maxKey, key);
+                    }
+
+                    fragmentHandler(buffer, offset, length, header);
+
+                    return ControlledPollAction::CONTINUE;
+                },
+                fragmentLimit - fragmentsRead);
+
+            if (hasNext)
+            {
+                m_heap.emplace_back(next, index);
+                std::push_heap(m_heap.begin(), m_heap.end(), HeadComparator());
+            }
+            else
+            {
+                emptyLanes++;
+            }
+        }
+
+        return fragmentsRead;
+    }
+
+private:
+    struct Lane
+    {
+        Image *image;
+        std::int64_t correlationId;
+        std::int64_t messageKey;
+        std::int64_t scanPosition;
+    };
+
+    typedef std::pair<std::int64_t, std::size_t> head_t;
+
+    struct HeadComparator
+    {
+        inline bool operator()(const head_t& lhs, const head_t& rhs) const
+        {
+            return lhs.first > rhs.first;
+        }
+    };
+
+    key_function_t m_keyFunction;
+    std::int64_t m_lookahead;
+    std::int64_t m_maxKey = std::numeric_limits<std::int64_t>::min();
+    std::vector<std::shared_ptr<Subscription>> m_subscriptions;
+    std::vector<Image*> m_images;
+    std::vector<Lane> m_lanes;
+    std::vector<Lane> m_previousLanes;
+    std::vector<head_t> m_heap;
+
+    inline bool isHeldBack(std::int64_t key) const
+    {
+        return 0 != m_lookahead && (m_maxKey < key || m_maxKey - key < m_lookahead);
+    }
+
+    inline void updateLanes(const std::vector<Image*>& images)
+    {
+        m_previousLanes.swap(m_lanes);
+        m_lanes.clear();
+
+        for (std::size_t i = 0; i < images.size(); i++)
+        {
+            Image *image = images[i];
+            const std::int64_t correlationId = image->correlationId();
+            Lane lane{ image, correlationId, std::numeric_limits<std::int64_t>::min(), 0 };
+
+            if (i < m_previousLanes.size() && m_previousLanes[i].correlationId == correlationId)
+            {
+                lane = m_previousLanes[i];
+            }
+            else
+            {
+                for (const Lane& previous : m_previousLanes)
+                {
+                    if (previous.correlationId == correlationId)
+                    {
+                        lane = previous;
+                        break;
+                    }
+                }
+            }
+
+            lane.image = image;
+            m_lanes.push_back(lane);
+        }
+    }
+
+    inline bool peek(Lane& lane, std::int64_t& key)
+    {
+        bool found = false;
+        auto handler =
+            [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+            {
+                key = (header.flags() & FrameDescriptor::BEGIN_FRAG) ?
+                    m_keyFunction(buffer, offset, length, header) : lane.messageKey;
+                found = true;
+
+                return ControlledPollAction::ABORT;
+            };
+
+        lane.image->controlledPeek(lane.image->position(), handler, std::numeric_limits<std::int64_t>::max());
+
+        if (!found)
+        {
+            // a peek stops at the padding that ends a term, which only a poll moves past into the next term
+            lane.image->controlledPoll(handler, 1);
+        }
+
+        if (found)
+        {
+            m_maxKey = std::max(m_maxKey, key);
+        }
+
+        return found;
+    }
+
+    /*
+     * Raise the max key seen with the keys of the messages waiting behind the heads, so fragments held back for an
+     * empty image are released once enough has arrived on the others. Each lane resumes from where its last scan
+     * ended, so each message is scanned once, and a scan goes no further than a term beyond the head.
+     */
+    inline void scanLanes()
+    {
+        for (Lane& lane : m_lanes)
+        {
+            Image& image = *lane.image;
+            const std::int64_t termLength = image.termBufferLength();
+            const std::int64_t limit = image.position() + termLength;
+            std::int64_t from = std::max(lane.scanPosition, image.position());
+
+            while (from < limit)
+            {
+                const std::int64_t termEnd = (from | (termLength - 1)) + 1;
+                bool found = false;
+
+                const std::int64_t resultingPosition = image.controlledPeek(
+                    from,
+                    [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+                    {
+                        // frames left from an earlier pass over the term are not yet written to
+                        if (header.position() <= from || header.position() > termEnd)
+                        {
+                            return ControlledPollAction::ABORT;
+                        }
+
+                        found = true;
+                        if (header.flags() & FrameDescriptor::BEGIN_FRAG)
+                        {
+                            m_maxKey = std::max(m_maxKey, m_keyFunction(buffer, offset, length, header));
+                        }
+
+                        return ControlledPollAction::CONTINUE;
+                    },
+                    limit);
+
+                if (found)
+                {
+                    if (resultingPosition == from)
+                    {
+                        break;
+                    }
+
+                    lane.scanPosition = resultingPosition;
+                    from = resultingPosition;
+                }
+                else if (0 == (from & (termLength - 1)))
+                {
+                    break;
+                }
+                else
+                {
+                    // nothing ahead of a position within a term may be the padding at its end
+                    from = termEnd;
+                }
+            }
+        }
+    }
+};
+
+}
+
+#endif
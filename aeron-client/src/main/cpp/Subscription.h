@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <iostream>
 #include <atomic>
+#include <vector>
 #include <concurrent/logbuffer/TermReader.h>
 #include "concurrent/status/StatusIndicatorReader.h"
 #include "Image.h"
@@ -109,15 +110,15 @@ public:
     {
         const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
         const std::size_t length = imageList->m_length;
-        Image *images = imageList->m_images;
+        Image *const *images = imageList->m_images;
         int numEndOfStreams = 0;
 
         for (std::size_t i = 0; i < length; i++)
         {
-            if (images[i].isEndOfStream())
+            if (images[i]->isEndOfStream())
             {
                 numEndOfStreams++;
-                endOfStreamHandler(images[i]);
+                endOfStreamHandler(*images[i]);
             }
         }
 
@@ -137,11 +138,11 @@ public:
      * @see fragment_handler_t
      */
     template <typename F>
-    inline int poll(F&& fragmentHandler, int fragmentLimit)
+    inline int poll(F&& fragmentHandler, int fragmentLimit) AERON_HOT_PATH_NOEXCEPT
     {
         const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
         const std::size_t length = imageList->m_length;
-        Image *images = imageList->m_images;
+        Image *const *images = imageList->m_images;
         int fragmentsRead = 0;
 
         std::size_t startingIndex = m_roundRobinIndex++;
@@ -152,17 +153,246 @@ public:
 
         for (std::size_t i = startingIndex; i < length && fragmentsRead < fragmentLimit; i++)
         {
-            fragmentsRead += images[i].poll(fragmentHandler, fragmentLimit - fragmentsRead);
+            fragmentsRead += images[i]->poll(fragmentHandler, fragmentLimit - fragmentsRead);
         }
 
         for (std::size_t i = 0; i < startingIndex && fragmentsRead < fragmentLimit; i++)
         {
-            fragmentsRead += images[i].poll(fragmentHandler, fragmentLimit - fragmentsRead);
+            fragmentsRead += images[i]->poll(fragmentHandler, fragmentLimit - fragmentsRead);
         }
 
         return fragmentsRead;
     }
 
+    /**
+     * Poll the Image s under the subscription as for poll using Image::rawPoll on each Image, so the handler takes a
+     * pointer to the payload, its length and a pointer to the frame header rather than a buffer and Header.
+     *
+     * @param fragmentHandler callback for handling each message fragment as it is read.
+     * @param fragmentLimit   number of message fragments to limit for the poll across multiple Image s.
+     * @return the number of fragments received
+     */
+    template <typename F>
+    inline int rawPoll(F&& fragmentHandler, int fragmentLimit) AERON_HOT_PATH_NOEXCEPT
+    {
+        const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
+        const std::size_t length = imageList->m_length;
+        Image *const *images = imageList->m_images;
+        int fragmentsRead = 0;
+
+        std::size_t startingIndex = m_roundRobinIndex++;
+        if (startingIndex >= length)
+        {
+            m_roundRobinIndex = startingIndex = 0;
+        }
+
+        for (std::size_t i = startingIndex; i < length && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += images[i]->rawPoll(fragmentHandler, fragmentLimit - fragmentsRead);
+        }
+
+        for (std::size_t i = 0; i < startingIndex && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += images[i]->rawPoll(fragmentHandler, fragmentLimit - fragmentsRead);
+        }
+
+        return fragmentsRead;
+    }
+
+    /**
+     * Poll the Image s under the subscription as for poll using Image::filteredPoll on each Image, so only the
+     * messages the filter matches are delivered and counted against fragmentLimit.
+     *
+     * @param fragmentHandler callback for handling each matching message fragment as it is read.
+     * @param filter          with a matches(AtomicBuffer&, index_t, index_t, Header&) method, such as MessageFilter.
+     * @param fragmentLimit   number of message fragments to limit for the poll across multiple Image s.
+     * @return the number of fragments received
+     *
+     * @see fragment_handler_t
+     */
+    template <typename F, typename M>
+    inline int filteredPoll(F&& fragmentHandler, M&& filter, int fragmentLimit) AERON_HOT_PATH_NOEXCEPT
+    {
+        const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
+        const std::size_t length = imageList->m_length;
+        Image *const *images = imageList->m_images;
+        int fragmentsRead = 0;
+
+        std::size_t startingIndex = m_roundRobinIndex++;
+        if (startingIndex >= length)
+        {
+            m_roundRobinIndex = startingIndex = 0;
+        }
+
+        for (std::size_t i = startingIndex; i < length && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += images[i]->filteredPoll(fragmentHandler, filter, fragmentLimit - fragmentsRead);
+        }
+
+        for (std::size_t i = 0; i < startingIndex && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += images[i]->filteredPoll(fragmentHandler, filter, fragmentLimit - fragmentsRead);
+        }
+
+        return fragmentsRead;
+    }
+
+    /**
+     * Poll the Image s under the subscription as for poll using Image::prefetchingPoll on each Image.
+     *
+     * @tparam PrefetchLines          number of cache lines to keep prefetched ahead of the frame being read.
+     * @param fragmentHandler         callback for handling each message fragment as it is read.
+     * @param fragmentLimit           number of message fragments to limit for the poll across multiple Image s.
+     * @param positionUpdateFragments number of fragments after which an Image position is stored within the poll.
+     * @return the number of fragments received
+     *
+     * @see fragment_handler_t
+     */
+    template <int PrefetchLines, typename F>
+    inline int prefetchingPoll(
+        F&& fragmentHandler, int fragmentLimit, int positionUpdateFragments = INT32_MAX) AERON_HOT_PATH_NOEXCEPT
+    {
+        const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
+        const std::size_t length = imageList->m_length;
+        Image *const *images = imageList->m_images;
+        int fragmentsRead = 0;
+
+        std::size_t startingIndex = m_roundRobinIndex++;
+        if (startingIndex >= length)
+        {
+            m_roundRobinIndex = startingIndex = 0;
+        }
+
+        for (std::size_t i = startingIndex; i < length && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += images[i]->template prefetchingPoll<PrefetchLines>(
+                fragmentHandler, fragmentLimit - fragmentsRead, positionUpdateFragments);
+        }
+
+        for (std::size_t i = 0; i < startingIndex && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += images[i]->template prefetchingPoll<PrefetchLines>(
+                fragmentHandler, fragmentLimit - fragmentsRead, positionUpdateFragments);
+        }
+
+        return fragmentsRead;
+    }
+
+    /**
+     * Poll the Image s under the subscription giving each its own budget so one busy Image cannot starve the others.
+     * Images are visited round robin from where the previous fairPoll stopped, each reading up to
+     * fragmentLimitPerImage fragments and about byteLimitPerImage bytes, until fragmentLimit fragments are read in
+     * total or every Image has been visited once.
+     *
+     * @param fragmentHandler       callback for handling each message fragment as it is read.
+     * @param fragmentLimitPerImage number of message fragments to limit for each Image.
+     * @param byteLimitPerImage     number of bytes after which no further fragment is read from an Image.
+     * @param fragmentLimit         number of message fragments to limit for the poll across multiple Image s.
+     * @return the number of fragments received
+     *
+     * @see fragment_handler_t
+     */
+    template <typename F>
+    inline int fairPoll(F&& fragmentHandler, int fragmentLimitPerImage, int byteLimitPerImage, int fragmentLimit)
+    {
+        return fairPoll(
+            fragmentHandler, fragmentLimitPerImage, byteLimitPerImage, fragmentLimit, [](const Image&) { return 1; });
+    }
+
+    /**
+     * Poll the Image s under the subscription as for fairPoll with the budgets of each Image scaled by a priority
+     * weight. An Image with a weight of 0 or less is skipped.
+     *
+     * @param fragmentHandler       callback for handling each message fragment as it is read.
+     * @param fragmentLimitPerImage number of message fragments to limit for an Image of weight 1.
+     * @param byteLimitPerImage     number of bytes after which no further fragment is read from an Image of weight 1.
+     * @param fragmentLimit         number of message fragments to limit for the poll across multiple Image s.
+     * @param weightOf              callback returning the weight of an Image.
+     * @return the number of fragments received
+     */
+    template <typename F, typename W>
+    inline int fairPoll(
+        F&& fragmentHandler, int fragmentLimitPerImage, int byteLimitPerImage, int fragmentLimit, W&& weightOf)
+    {
+        const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
+        const std::size_t length = imageList->m_length;
+        Image *const *images = imageList->m_images;
+        int fragmentsRead = 0;
+
+        std::size_t index = m_roundRobinIndex;
+        if (index >= length)
+        {
+            index = 0;
+        }
+
+        for (std::size_t i = 0; i < length && fragmentsRead < fragmentLimit; i++)
+        {
+            Image& image = *images[index];
+            const std::int64_t weight = weightOf(image);
+
+            if (weight > 0)
+            {
+                const int imageFragmentLimit = static_cast<int>(std::min(
+                    fragmentLimitPerImage * weight, static_cast<std::int64_t>(fragmentLimit - fragmentsRead)));
+                const std::int64_t maxPosition = image.position() + (byteLimitPerImage * weight);
+
+                fragmentsRead += image.boundedPoll(fragmentHandler, maxPosition, imageFragmentLimit);
+            }
+
+            if (++index == length)
+            {
+                index = 0;
+            }
+        }
+
+        m_roundRobinIndex = index;
+
+        return fragmentsRead;
+    }
+
+    /**
+     * Scan a block of available fragments from each Image under the subscription and hand them all to one call of
+     * the batchHandler, then consume them. If the handler throws then none of the blocks are consumed.
+     *
+     * @param batchHandler     to receive the blocks, at most one from each Image.
+     * @param blockLengthLimit for each individual block.
+     * @return the number of bytes consumed.
+     *
+     * @see batch_block_handler_t
+     */
+    template <typename F>
+    inline long pollBatch(F&& batchHandler, int blockLengthLimit)
+    {
+        const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
+        const std::size_t length = imageList->m_length;
+        Image *const *images = imageList->m_images;
+        long bytesConsumed = 0;
+        ImageBlock block;
+
+        m_batch.clear();
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            if (images[i]->scanBlock(block, blockLengthLimit) > 0)
+            {
+                m_batch.push_back(block);
+                bytesConsumed += block.length;
+            }
+        }
+
+        if (!m_batch.empty())
+        {
+            batchHandler(static_cast<const std::vector<ImageBlock>&>(m_batch));
+
+            for (const ImageBlock& scanned : m_batch)
+            {
+                scanned.image->consumeBlock(scanned);
+            }
+        }
+
+        return bytesConsumed;
+    }
+
     /**
      * Poll in a controlled manner the Image s under the subscription for available message fragments.
      * Control is applied to fragments in the stream. If more fragments can be read on another stream
@@ -183,7 +413,7 @@ public:
     {
         const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
         const std::size_t length = imageList->m_length;
-        Image *images = imageList->m_images;
+        Image *const *images = imageList->m_images;
         int fragmentsRead = 0;
 
         std::size_t startingIndex = m_roundRobinIndex++;
@@ -194,12 +424,12 @@ public:
 
         for (std::size_t i = startingIndex; i < length && fragmentsRead < fragmentLimit; i++)
         {
-            fragmentsRead += images[i].controlledPoll(fragmentHandler, fragmentLimit - fragmentsRead);
+            fragmentsRead += images[i]->controlledPoll(fragmentHandler, fragmentLimit - fragmentsRead);
         }
 
         for (std::size_t i = 0; i < startingIndex && fragmentsRead < fragmentLimit; i++)
         {
-            fragmentsRead += images[i].controlledPoll(fragmentHandler, fragmentLimit - fragmentsRead);
+            fragmentsRead += images[i]->controlledPoll(fragmentHandler, fragmentLimit - fragmentsRead);
         }
 
         return fragmentsRead;
@@ -217,12 +447,37 @@ public:
     {
         const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
         const std::size_t length = imageList->m_length;
-        Image *images = imageList->m_images;
+        Image *const *images = imageList->m_images;
         long bytesConsumed = 0;
 
         for (std::size_t i = 0; i < length; i++)
         {
-            bytesConsumed += images[i].blockPoll(blockHandler, blockLengthLimit);
+            bytesConsumed += images[i]->blockPoll(blockHandler, blockLengthLimit);
+        }
+
+        return bytesConsumed;
+    }
+
+    /**
+     * Poll the Image s under the subscription for available message fragments in blocks, also handing over the
+     * frames of each block as Image::blockPoll(F&&, int, std::vector<BlockFrame>&) does.
+     *
+     * @param blockHandler     to receive a block of fragments from each Image.
+     * @param blockLengthLimit for each individual block.
+     * @param frames           filled with the frames of each block before the blockHandler is called for it.
+     * @return the number of bytes consumed.
+     */
+    template <typename F>
+    inline long blockPoll(F&& blockHandler, int blockLengthLimit, std::vector<BlockFrame>& frames)
+    {
+        const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
+        const std::size_t length = imageList->m_length;
+        Image *const *images = imageList->m_images;
+        long bytesConsumed = 0;
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            bytesConsumed += images[i]->blockPoll(blockHandler, blockLengthLimit, frames);
         }
 
         return bytesConsumed;
@@ -261,19 +516,19 @@ public:
     {
         const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
         const std::size_t length = imageList->m_length;
-        Image* images = imageList->m_images;
+        Image *const *images = imageList->m_images;
         int index = -1;
 
         for (int i = 0; i < static_cast<int>(length); i++)
         {
-            if (images[i].sessionId() == sessionId)
+            if (images[i]->sessionId() == sessionId)
             {
                 index = i;
                 break;
             }
         }
 
-        return (index != -1) ? std::shared_ptr<Image>(new Image(images[index])) : std::shared_ptr<Image>();
+        return (index != -1) ? std::shared_ptr<Image>(new Image(*images[index])) : std::shared_ptr<Image>();
     }
 
     /**
@@ -287,14 +542,14 @@ public:
     inline Image& imageAtIndex(size_t index) const
     {
         const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
-        Image *images = imageList->m_images;
+        Image *const *images = imageList->m_images;
 
         if (index >= imageList->m_length)
         {
             throw std::out_of_range("image index out of range");
         }
 
-        return images[index];
+        return *images[index];
     }
 
     /**
@@ -325,11 +580,11 @@ public:
     {
         const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
         const std::size_t length = imageList->m_length;
-        Image* images = imageList->m_images;
+        Image *const *images = imageList->m_images;
 
         for (std::size_t i = 0; i < length; i++)
         {
-            func(images[i]);
+            func(*images[i]);
         }
 
         return static_cast<int>(length);
@@ -346,16 +601,21 @@ public:
     }
 
     /// @cond HIDDEN_SYMBOLS
+    inline const struct ImageList *imageList() const
+    {
+        return std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
+    }
+
     bool hasImage(std::int64_t correlationId) const
     {
         const struct ImageList *imageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
         const std::size_t length = imageList->m_length;
-        Image *images = imageList->m_images;
+        Image *const *images = imageList->m_images;
         bool isConnected = false;
 
         for (std::size_t i = 0; i < length; i++)
         {
-            if (images[i].correlationId() == correlationId)
+            if (images[i]->correlationId() == correlationId)
             {
                 isConnected = true;
                 break;
@@ -365,37 +625,26 @@ public:
         return isConnected;
     }
 
-    struct ImageList *addImage(Image &image)
+    struct ImageList *addImage(ImageListPool& pool, Image *image)
     {
         struct ImageList *oldImageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
-        Image *oldArray = oldImageList->m_images;
-        std::size_t length = oldImageList->m_length;
-        auto newArray = new Image[length + 1];
-
-        for (std::size_t i = 0; i < length; i++)
-        {
-            newArray[i] = oldArray[i];
-        }
-
-        newArray[length] = image; // copy-assign
-
-        auto newImageList = new struct ImageList(newArray, length + 1);
+        struct ImageList *newImageList = pool.copyWith(*oldImageList, image);
 
         std::atomic_store_explicit(&m_imageList, newImageList, std::memory_order_release);
 
         return oldImageList;
     }
 
-    std::pair<struct ImageList *, int> removeImage(std::int64_t correlationId)
+    std::pair<struct ImageList *, int> removeImage(ImageListPool& pool, std::int64_t correlationId)
     {
         struct ImageList *oldImageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
-        Image * oldArray = oldImageList->m_images;
+        Image *const *oldArray = oldImageList->m_images;
         auto length = static_cast<int>(oldImageList->m_length);
         int index = -1;
 
         for (int i = 0; i < length; i++)
         {
-            if (oldArray[i].correlationId() == correlationId)
+            if (oldArray[i]->correlationId() == correlationId)
             {
                 index = i;
                 break;
@@ -404,17 +653,7 @@ public:
 
         if (-1 != index)
         {
-            auto newArray = new Image[length - 1];
-
-            for (int i = 0, j = 0; i < length; i++)
-            {
-                if (i != index)
-                {
-                    newArray[j++] = oldArray[i];
-                }
-            }
-
-            auto newImageList = new struct ImageList(newArray, length - 1);
+            struct ImageList *newImageList = pool.copyWithout(*oldImageList, static_cast<std::size_t>(index));
 
             std::atomic_store_explicit(&m_imageList, newImageList, std::memory_order_release);
         }
@@ -424,18 +663,19 @@ public:
                 index);
     }
 
-    struct ImageList *removeAndCloseAllImages()
+    struct ImageList *removeAndCloseAllImages(ImageListPool& pool)
     {
         struct ImageList *oldImageList = std::atomic_load_explicit(&m_imageList, std::memory_order_acquire);
-        Image *oldArray = oldImageList->m_images;
+        Image *const *oldArray = oldImageList->m_images;
         std::size_t length = oldImageList->m_length;
 
         for (std::size_t i = 0; i < length; i++)
         {
-            oldArray[i].close();
+            oldArray[i]->close();
         }
 
-        auto newImageList = new struct ImageList(new Image[0], 0);
+        struct ImageList *newImageList = pool.acquire(0);
+        newImageList->m_version = oldImageList->m_version + 1;
 
         std::atomic_store_explicit(&m_imageList, newImageList, std::memory_order_release);
         std::atomic_store_explicit(&m_isClosed, true, std::memory_order_release);
@@ -456,6 +696,7 @@ private:
     const std::string m_channel;
     std::int32_t m_channelStatusId;
     std::size_t m_roundRobinIndex = 0;
+    std::vector<ImageBlock> m_batch;
     std::int64_t m_registrationId;
     std::int32_t m_streamId;
 
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ZLIBMESSAGECODEC_H
+#define AERON_ZLIBMESSAGECODEC_H
+
+#include <zlib.h>
+#include "MessageCompression.h"
+
+namespace aeron {
+
+/**
+ * MessageCodec which deflates messages with zlib. Applications using it link with zlib, the client library does not.
+ * <p>
+ * Messages are raw deflate streams without the zlib header and checksum as the frames already carry a length and the
+ * transport a checksum. Short messages repeat field names and symbols more than they repeat within themselves, so a
+ * preset dictionary of typical content improves the ratio considerably; both ends must use the same dictionary.
+ */
+class ZlibMessageCodec : public MessageCodec
+{
+public:
+    /**
+     * @param level      of compression from Z_BEST_SPEED to Z_BEST_COMPRESSION.
+     * @param dictionary preset for every message, or empty for none.
+     */
+    explicit ZlibMessageCodec(int level = Z_BEST_SPEED, std::vector<std::uint8_t> dictionary = {}) :
+        m_dictionary(std::move(dictionary))
+    {
+        std::memset(&m_deflate, 0, sizeof(m_deflate));
+        std::memset(&m_inflate, 0, sizeof(m_inflate));
+
+        if (Z_OK != deflateInit2(&m_deflate, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY))
+        {
+            throw util::IllegalArgumentException(util::strPrintf("invalid zlib level: %d", level), SOURCEINFO);
+        }
+
+        if (Z_OK != inflateInit2(&m_inflate, -MAX_WBITS))
+        {
+            deflateEnd(&m_deflate);
+            throw util::IllegalStateException("could not initialise zlib inflate", SOURCEINFO);
+        }
+    }
+
+    ~ZlibMessageCodec() override
+    {
+        deflateEnd(&m_deflate);
+        inflateEnd(&m_inflate);
+    }
+
+    ZlibMessageCodec(const ZlibMessageCodec&) = delete;
+    ZlibMessageCodec& operator=(const ZlibMessageCodec&) = delete;
+
+    util::index_t maxCompressedLength(util::index_t length) override
+    {
+        return static_cast<util::index_t>(deflateBound(&m_deflate, static_cast<uLong>(length)));
+    }
+
+    util::index_t compress(
+        const std::uint8_t *src, util::index_t length, std::uint8_t *dst, util::index_t capacity) override
+    {
+        deflateReset(&m_deflate);
+        if (!m_dictionary.empty())
+        {
+            deflateSetDictionary(&m_deflate, m_dictionary.data(), static_cast<uInt>(m_dictionary.size()));
+        }
+
+        m_deflate.next_in = const_cast<Bytef *>(src);
+        m_deflate.avail_in = static_cast<uInt>(length);
+        m_deflate.next_out = dst;
+        m_deflate.avail_out = static_cast<uInt>(capacity);
+
+        if (Z_STREAM_END != deflate(&m_deflate, Z_FINISH))
+        {
+            return -1;
+        }
+
+        return static_cast<util::index_t>(m_deflate.total_out);
+    }
+
+    bool decompress(
+        const std::uint8_t *src, util::index_t length, std::uint8_t *dst, util::index_t decodedLength) override
+    {
+        inflateReset(&m_inflate);
+        if (!m_dictionary.empty())
+        {
+            inflateSetDictionary(&m_inflate, m_dictionary.data(), static_cast<uInt>(m_dictionary.size()));
+        }
+
+        m_inflate.next_in = const_cast<Bytef *>(src);
+        m_inflate.avail_in = static_cast<uInt>(length);
+        m_inflate.next_out = dst;
+        m_inflate.avail_out = static_cast<uInt>(decodedLength);
+
+        return Z_STREAM_END == inflate(&m_inflate, Z_FINISH) &&
+            static_cast<util::index_t>(m_inflate.total_out) == decodedLength;
+    }
+
+private:
+    std::vector<std::uint8_t> m_dictionary;
+    z_stream m_deflate;
+    z_stream m_inflate;
+};
+
+}
+
+#endif
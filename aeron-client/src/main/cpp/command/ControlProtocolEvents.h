@@ -72,6 +72,8 @@ struct ControlProtocolEvents
     static const std::int32_t ON_COUNTER_READY = 0x0F08;
     /** inform clients of removal of counter */
     static const std::int32_t ON_UNAVAILABLE_COUNTER = 0x0F09;
+    /** New image Buffer Notification for many subscriptions at once */
+    static const std::int32_t ON_AVAILABLE_IMAGES = 0x0F0A;
 };
 
 }}
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef INCLUDED_AERON_COMMAND_IMAGEBUFFERSREADYBATCHFLYWEIGHT__
+#define INCLUDED_AERON_COMMAND_IMAGEBUFFERSREADYBATCHFLYWEIGHT__
+
+#include <cstdint>
+#include <stddef.h>
+#include <util/Exceptions.h>
+#include <util/StringUtil.h>
+#include "Flyweight.h"
+
+namespace aeron { namespace command {
+
+/**
+* Message to denote that new buffers have been added for an image linked to many subscriptions at once, carrying
+* the image once followed by each subscriber rather than repeating the image for each. The subscriber count is set
+* before the names as they follow the subscribers.
+*
+* NOTE: Layout should be SBE compliant
+*
+* @see ControlProtocolEvents
+*
+* 0                   1                   2                   3
+* 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+* +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+* |                       Correlation ID                          |
+* |                                                               |
+* +---------------------------------------------------------------+
+* |                         Session ID                            |
+* +---------------------------------------------------------------+
+* |                         Stream ID                             |
+* +---------------------------------------------------------------+
+* |                       Subscriber Count                        |
+* +---------------------------------------------------------------+
+* |                  Subscriber Registration Id                   |
+* |                                                               |
+* +---------------------------------------------------------------+
+* |                    Subscriber Position Id                     |
+* +---------------------------------------------------------------+
+* |          Subscriber Registration and Position Ids            ...
+*...                                                              |
+* +---------------------------------------------------------------+
+* |                       Log File Length                         |
+* +---------------------------------------------------------------+
+* |                        Log File Name                         ...
+*...                                                              |
+* +---------------------------------------------------------------+
+* |                    Source identity Length                     |
+* +---------------------------------------------------------------+
+* |                    Source identity Name                      ...
+*...                                                              |
+* +---------------------------------------------------------------+
+*/
+
+#pragma pack(push)
+#pragma pack(4)
+struct ImageBuffersReadyBatchDefn
+{
+    std::int64_t correlationId;
+    std::int32_t sessionId;
+    std::int32_t streamId;
+    std::int32_t subscriberCount;
+};
+
+struct ImageBuffersReadySubscriberDefn
+{
+    std::int64_t subscriberRegistrationId;
+    std::int32_t subscriberPositionId;
+};
+#pragma pack(pop)
+
+class ImageBuffersReadyBatchFlyweight : public Flyweight<ImageBuffersReadyBatchDefn>
+{
+public:
+    typedef ImageBuffersReadyBatchFlyweight this_t;
+
+    inline ImageBuffersReadyBatchFlyweight(concurrent::AtomicBuffer& buffer, util::index_t offset)
+        : Flyweight<ImageBuffersReadyBatchDefn>(buffer, offset)
+    {
+    }
+
+    inline std::int64_t correlationId() const
+    {
+        return m_struct.correlationId;
+    }
+
+    inline this_t& correlationId(std::int64_t value)
+    {
+        m_struct.correlationId = value;
+        return *this;
+    }
+
+    inline std::int32_t sessionId() const
+    {
+        return m_struct.sessionId;
+    }
+
+    inline this_t& sessionId(std::int32_t value)
+    {
+        m_struct.sessionId = value;
+        return *this;
+    }
+
+    inline std::int32_t streamId() const
+    {
+        return m_struct.streamId;
+    }
+
+    inline this_t& streamId(std::int32_t value)
+    {
+        m_struct.streamId = value;
+        return *this;
+    }
+
+    inline std::int32_t subscriberCount() const
+    {
+        return m_struct.subscriberCount;
+    }
+
+    inline this_t& subscriberCount(std::int32_t value)
+    {
+        m_struct.subscriberCount = value;
+        return *this;
+    }
+
+    inline std::int64_t subscriberRegistrationId(std::int32_t index) const
+    {
+        return overlayStruct<ImageBuffersReadySubscriberDefn>(subscriberOffset(index)).subscriberRegistrationId;
+    }
+
+    inline std::int32_t subscriberPositionId(std::int32_t index) const
+    {
+        return overlayStruct<ImageBuffersReadySubscriberDefn>(subscriberOffset(index)).subscriberPositionId;
+    }
+
+    inline this_t& subscriber(std::int32_t index, std::int64_t registrationId, std::int32_t positionId)
+    {
+        ImageBuffersReadySubscriberDefn& subscriber =
+            overlayStruct<ImageBuffersReadySubscriberDefn>(subscriberOffset(index));
+
+        subscriber.subscriberRegistrationId = registrationId;
+        subscriber.subscriberPositionId = positionId;
+        return *this;
+    }
+
+    inline std::string logFileName() const
+    {
+        return stringGet(logFileNameOffset());
+    }
+
+    inline this_t& logFileName(const std::string& value)
+    {
+        stringPut(logFileNameOffset(), value);
+        return *this;
+    }
+
+    inline std::string sourceIdentity() const
+    {
+        return stringGet(sourceIdentityOffset());
+    }
+
+    inline this_t& sourceIdentity(const std::string &value)
+    {
+        stringPut(sourceIdentityOffset(), value);
+        return *this;
+    }
+
+    inline std::int32_t length()
+    {
+        const util::index_t startOfSourceIdentity = sourceIdentityOffset();
+
+        return startOfSourceIdentity + stringGetLength(startOfSourceIdentity) + (util::index_t)sizeof(std::int32_t);
+    }
+
+private:
+
+    inline util::index_t subscriberOffset(std::int32_t index) const
+    {
+        return (util::index_t)(sizeof(ImageBuffersReadyBatchDefn) + (index * sizeof(ImageBuffersReadySubscriberDefn)));
+    }
+
+    inline util::index_t logFileNameOffset() const
+    {
+        return subscriberOffset(m_struct.subscriberCount);
+    }
+
+    inline util::index_t sourceIdentityOffset() const
+    {
+        const util::index_t startOfLogFileName = logFileNameOffset();
+        return startOfLogFileName + stringGetLength(startOfLogFileName) + (util::index_t)sizeof(std::int32_t);
+    }
+};
+
+}}
+
+#endif
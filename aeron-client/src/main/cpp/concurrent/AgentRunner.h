@@ -23,6 +23,10 @@
 #include <atomic>
 #include <concurrent/logbuffer/TermReader.h>
 
+#if !defined(_MSC_VER)
+#include <pthread.h>
+#endif
+
 namespace aeron {
 
 namespace concurrent {
@@ -31,10 +35,17 @@ template <typename Agent, typename IdleStrategy>
 class AgentRunner
 {
 public:
-    AgentRunner(Agent& agent, IdleStrategy& idleStrategy, logbuffer::exception_handler_t& exceptionHandler) :
+    AgentRunner(
+        Agent& agent,
+        IdleStrategy& idleStrategy,
+        logbuffer::exception_handler_t& exceptionHandler,
+        const std::string& name = "aeron-agent",
+        int cpuAffinity = -1) :
         m_agent(agent),
         m_idleStrategy(idleStrategy),
         m_exceptionHandler(exceptionHandler),
+        m_name(name),
+        m_cpuAffinity(cpuAffinity),
         m_running(true)
     {
     }
@@ -42,12 +53,13 @@ public:
     /**
      * Start the Agent running
      *
-     * Will spawn a std::thread.
+     * Will spawn a std::thread which is named and, if a CPU affinity was given, pinned before the first duty cycle.
      */
     inline void start()
     {
         m_thread = std::thread([&]()
         {
+            configureThread();
             run();
         });
     }
@@ -97,9 +109,35 @@ public:
     }
 
 private:
+    inline void configureThread()
+    {
+#if defined(__linux__)
+        // thread names are limited to 15 characters plus the terminator
+        pthread_setname_np(pthread_self(), m_name.substr(0, 15).c_str());
+
+        if (m_cpuAffinity >= 0)
+        {
+            cpu_set_t cpuSet;
+
+            CPU_ZERO(&cpuSet);
+            CPU_SET(m_cpuAffinity, &cpuSet);
+
+            if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) != 0)
+            {
+                m_exceptionHandler(util::IllegalStateException(
+                    "could not set CPU affinity of " + m_name + " to " + std::to_string(m_cpuAffinity), SOURCEINFO));
+            }
+        }
+#elif defined(__APPLE__)
+        pthread_setname_np(m_name.substr(0, 15).c_str());
+#endif
+    }
+
     Agent& m_agent;
     IdleStrategy& m_idleStrategy;
     logbuffer::exception_handler_t& m_exceptionHandler;
+    std::string m_name;
+    int m_cpuAffinity;
     std::atomic<bool> m_running;
     std::thread m_thread;
 };
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_BACKOFF_IDLE_STRATEGY_H
+#define AERON_BACKOFF_IDLE_STRATEGY_H
+
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+
+#include "Atomic64.h"
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Idle strategy that spins with a CPU pause, then yields, then parks for a period that doubles on each idle call up
+ * to a maximum. Any work resets it back to spinning.
+ */
+class BackoffIdleStrategy
+{
+public:
+    static const std::int64_t DEFAULT_MAX_SPINS = 10;
+    static const std::int64_t DEFAULT_MAX_YIELDS = 5;
+    static const std::int64_t DEFAULT_MIN_PARK_PERIOD_NS = 1000;
+    static const std::int64_t DEFAULT_MAX_PARK_PERIOD_NS = 1000 * 1000;
+
+    BackoffIdleStrategy(
+        std::int64_t maxSpins = DEFAULT_MAX_SPINS,
+        std::int64_t maxYields = DEFAULT_MAX_YIELDS,
+        std::int64_t minParkPeriodNs = DEFAULT_MIN_PARK_PERIOD_NS,
+        std::int64_t maxParkPeriodNs = DEFAULT_MAX_PARK_PERIOD_NS) :
+        m_maxSpins(maxSpins),
+        m_maxYields(maxYields),
+        m_minParkPeriodNs(minParkPeriodNs),
+        m_maxParkPeriodNs(maxParkPeriodNs)
+    {
+        reset();
+    }
+
+    inline void idle(int workCount)
+    {
+        if (workCount > 0)
+        {
+            reset();
+        }
+        else
+        {
+            idle();
+        }
+    }
+
+    inline void idle()
+    {
+        switch (m_state)
+        {
+            case State::NOT_IDLE:
+                m_state = State::SPINNING;
+                m_spins++;
+                break;
+
+            case State::SPINNING:
+                atomic::cpu_pause();
+                if (++m_spins > m_maxSpins)
+                {
+                    m_state = State::YIELDING;
+                    m_yields = 0;
+                }
+                break;
+
+            case State::YIELDING:
+                if (++m_yields > m_maxYields)
+                {
+                    m_state = State::PARKING;
+                    m_parkPeriodNs = m_minParkPeriodNs;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+                break;
+
+            case State::PARKING:
+                std::this_thread::sleep_for(std::chrono::nanoseconds(m_parkPeriodNs));
+                m_parkPeriodNs = std::min(m_parkPeriodNs * 2, m_maxParkPeriodNs);
+                break;
+        }
+    }
+
+    inline void reset()
+    {
+        m_spins = 0;
+        m_yields = 0;
+        m_parkPeriodNs = m_minParkPeriodNs;
+        m_state = State::NOT_IDLE;
+    }
+
+protected:
+    enum class State : std::uint8_t
+    {
+        NOT_IDLE, SPINNING, YIELDING, PARKING
+    };
+
+    std::int64_t m_maxSpins;
+    std::int64_t m_maxYields;
+    std::int64_t m_minParkPeriodNs;
+    std::int64_t m_maxParkPeriodNs;
+    std::int64_t m_spins;
+    std::int64_t m_yields;
+    std::int64_t m_parkPeriodNs;
+    State m_state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,213 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_CONCURRENT_COMPOSITEAGENT_H
+#define AERON_CONCURRENT_COMPOSITEAGENT_H
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <vector>
+
+namespace aeron {
+
+namespace concurrent {
+
+/**
+ * Duty cycle timing of an Agent within a composite, measured on the thread running the composite.
+ */
+struct AgentDutyCycleStats
+{
+    std::int64_t dutyCycles = 0;
+    std::int64_t workCount = 0;
+    std::int64_t totalNs = 0;
+    std::int64_t maxNs = 0;
+};
+
+/**
+ * An Agent of any type held by a composite, with the timing of its duty cycles.
+ */
+class CompositeAgentMember
+{
+public:
+    template<typename Agent>
+    explicit CompositeAgentMember(Agent& agent) :
+        m_agent(&agent),
+        m_onStart([&agent]() { agent.onStart(); }),
+        m_doWork([&agent]() { return agent.doWork(); }),
+        m_onClose([&agent]() { agent.onClose(); })
+    {
+    }
+
+    inline const void *agent() const
+    {
+        return m_agent;
+    }
+
+    inline const AgentDutyCycleStats& stats() const
+    {
+        return m_stats;
+    }
+
+    inline void onStart()
+    {
+        m_onStart();
+    }
+
+    inline int doWork()
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const int workCount = m_doWork();
+        const std::int64_t durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+        m_stats.dutyCycles++;
+        m_stats.workCount += workCount;
+        m_stats.totalNs += durationNs;
+        if (durationNs > m_stats.maxNs)
+        {
+            m_stats.maxNs = durationNs;
+        }
+
+        return workCount;
+    }
+
+    inline void onClose()
+    {
+        m_onClose();
+    }
+
+private:
+    const void *m_agent;
+    std::function<void()> m_onStart;
+    std::function<int()> m_doWork;
+    std::function<void()> m_onClose;
+    AgentDutyCycleStats m_stats;
+};
+
+/**
+ * Runs several Agents as one on a single AgentRunner or AgentInvoker, so low rate Agents can share a thread rather
+ * than each taking one.
+ * <p>
+ * Each duty cycle calls doWork on the Agents in the order they were added and returns the sum of their work counts.
+ * If an Agent throws then the next duty cycle carries on from the Agent after it, so one failing Agent does not
+ * starve those behind it. Every Agent is started and closed even if an earlier one throws, with the first exception
+ * rethrown once all have been called.
+ * <p>
+ * Agents are to be added before the composite is started. Use DynamicCompositeAgent to add and remove them while
+ * it is running.
+ */
+class CompositeAgent
+{
+public:
+    CompositeAgent() = default;
+
+    CompositeAgent(const CompositeAgent&) = delete;
+    CompositeAgent& operator=(const CompositeAgent&) = delete;
+
+    /**
+     * Add an Agent, which must outlive the composite.
+     *
+     * @param agent to add.
+     * @return this for a fluent API.
+     */
+    template<typename Agent>
+    inline CompositeAgent& add(Agent& agent)
+    {
+        m_agents.emplace_back(agent);
+        return *this;
+    }
+
+    inline void onStart()
+    {
+        forEachAgent([](CompositeAgentMember& member) { member.onStart(); });
+    }
+
+    inline int doWork()
+    {
+        int workCount = 0;
+        const std::size_t length = m_agents.size();
+
+        while (m_agentIndex < length)
+        {
+            workCount += m_agents[m_agentIndex++].doWork();
+        }
+        m_agentIndex = 0;
+
+        return workCount;
+    }
+
+    inline void onClose()
+    {
+        forEachAgent([](CompositeAgentMember& member) { member.onClose(); });
+    }
+
+    /**
+     * The number of Agents in the composite.
+     *
+     * @return the number of Agents in the composite.
+     */
+    inline std::size_t agentCount() const
+    {
+        return m_agents.size();
+    }
+
+    /**
+     * Duty cycle timing of an Agent, only to be read on the thread running the composite or once it has stopped.
+     *
+     * @param index of the Agent in the order added.
+     * @return duty cycle timing of the Agent.
+     */
+    inline const AgentDutyCycleStats& stats(std::size_t index) const
+    {
+        return m_agents[index].stats();
+    }
+
+private:
+    std::vector<CompositeAgentMember> m_agents;
+    std::size_t m_agentIndex = 0;
+
+    template<typename F>
+    inline void forEachAgent(F&& func)
+    {
+        std::exception_ptr exception;
+
+        for (CompositeAgentMember& member : m_agents)
+        {
+            try
+            {
+                func(member);
+            }
+            catch (...)
+            {
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+};
+
+}}
+
+#endif
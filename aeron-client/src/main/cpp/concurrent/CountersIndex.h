@@ -0,0 +1,226 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_COUNTERSINDEX_H
+#define AERON_COUNTERSINDEX_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+
+#include "CountersReader.h"
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Index of the allocated counters by type id and key bytes, so a counter such as a publisher limit or channel status
+ * can be resolved without a scan of the metadata buffer.
+ *
+ * The index is brought up to date by update, which walks the record states and only decodes the records whose state
+ * or key has changed since the previous update. Records are indexed on becoming allocated and dropped on being
+ * reclaimed, with an id freed and reused between updates picked up by its key no longer matching. findCounterId
+ * updates the index on a miss and always checks a found counter against its record so a stale entry is never
+ * returned.
+ *
+ * Keys are compared over the whole key field with a shorter key taken as padded with zeros, as the counters managers
+ * zero the unused part of the key on allocation.
+ *
+ * This class is not threadsafe.
+ */
+class CountersIndex
+{
+public:
+    static const std::int32_t NULL_COUNTER_ID = -1;
+
+    explicit CountersIndex(const CountersReader& countersReader) :
+        m_countersReader(countersReader),
+        m_maxRecords(std::min(
+            countersReader.maxCounterId(),
+            countersReader.metaDataBuffer().capacity() / CountersReader::METADATA_LENGTH))
+    {
+    }
+
+    /**
+     * Index records allocated and drop records reclaimed since the last update.
+     *
+     * @return the number of records whose state changed.
+     */
+    int update()
+    {
+        const AtomicBuffer metadataBuffer = m_countersReader.metaDataBuffer();
+        int changes = 0;
+
+        for (std::int32_t counterId = 0; counterId < m_maxRecords; counterId++)
+        {
+            const std::int32_t state = metadataBuffer.getInt32Volatile(CountersReader::metadataOffset(counterId));
+
+            if (CountersReader::RECORD_UNUSED == state)
+            {
+                break;
+            }
+
+            if (static_cast<std::size_t>(counterId) >= m_records.size())
+            {
+                m_records.resize(static_cast<std::size_t>(counterId) + 1);
+            }
+
+            IndexedRecord& record = m_records[counterId];
+            if (record.m_state != state || (CountersReader::RECORD_ALLOCATED == state && !hasKey(counterId, record.m_key)))
+            {
+                if (CountersReader::RECORD_ALLOCATED == record.m_state)
+                {
+                    removeEntry(record.m_key, counterId);
+                }
+
+                if (CountersReader::RECORD_ALLOCATED == state)
+                {
+                    record.m_key = recordKey(counterId);
+                    m_counterIdsByKey.emplace(record.m_key, counterId);
+                }
+
+                record.m_state = state;
+                changes++;
+            }
+        }
+
+        return changes;
+    }
+
+    /**
+     * Find an allocated counter by type id and key, updating the index if it is not found.
+     *
+     * @param typeId    of the counter.
+     * @param key       bytes of the counter, may be shorter than the key field.
+     * @param keyLength of the key bytes.
+     * @return the counter id or NULL_COUNTER_ID if no allocated counter has the type id and key.
+     */
+    std::int32_t findCounterId(std::int32_t typeId, const std::uint8_t *key, std::size_t keyLength)
+    {
+        const std::string searchKey = makeKey(typeId, key, keyLength);
+        std::int32_t counterId = findIndexed(searchKey);
+
+        if (NULL_COUNTER_ID == counterId && update() > 0)
+        {
+            counterId = findIndexed(searchKey);
+        }
+
+        return counterId;
+    }
+
+    /**
+     * @return the number of allocated counters in the index.
+     */
+    inline std::size_t size() const
+    {
+        return m_counterIdsByKey.size();
+    }
+
+private:
+    struct IndexedRecord
+    {
+        std::int32_t m_state = CountersReader::RECORD_UNUSED;
+        std::string m_key;
+    };
+
+    CountersReader m_countersReader;
+    const std::int32_t m_maxRecords;
+    std::vector<IndexedRecord> m_records;
+    std::unordered_multimap<std::string, std::int32_t> m_counterIdsByKey;
+
+    static std::string makeKey(std::int32_t typeId, const std::uint8_t *key, std::size_t keyLength)
+    {
+        std::string result(sizeof(std::int32_t) + CountersReader::MAX_KEY_LENGTH, '\0');
+        const std::size_t length = std::min(keyLength, static_cast<std::size_t>(CountersReader::MAX_KEY_LENGTH));
+
+        std::memcpy(&result[0], &typeId, sizeof(std::int32_t));
+        if (nullptr != key && length > 0)
+        {
+            std::memcpy(&result[sizeof(std::int32_t)], key, length);
+        }
+
+        return result;
+    }
+
+    std::string recordKey(std::int32_t counterId) const
+    {
+        const AtomicBuffer metadataBuffer = m_countersReader.metaDataBuffer();
+        const util::index_t offset = CountersReader::metadataOffset(counterId);
+
+        return makeKey(
+            metadataBuffer.getInt32(offset + CountersReader::TYPE_ID_OFFSET),
+            metadataBuffer.buffer() + offset + CountersReader::KEY_OFFSET,
+            CountersReader::MAX_KEY_LENGTH);
+    }
+
+    bool hasKey(std::int32_t counterId, const std::string& key) const
+    {
+        const AtomicBuffer metadataBuffer = m_countersReader.metaDataBuffer();
+        const util::index_t offset = CountersReader::metadataOffset(counterId);
+
+        const std::int32_t typeId = metadataBuffer.getInt32(offset + CountersReader::TYPE_ID_OFFSET);
+
+        return 0 == std::memcmp(key.data(), &typeId, sizeof(std::int32_t)) &&
+            0 == std::memcmp(
+                metadataBuffer.buffer() + offset + CountersReader::KEY_OFFSET,
+                key.data() + sizeof(std::int32_t),
+                CountersReader::MAX_KEY_LENGTH);
+    }
+
+    bool isCurrent(std::int32_t counterId, const std::string& key) const
+    {
+        const AtomicBuffer metadataBuffer = m_countersReader.metaDataBuffer();
+
+        return CountersReader::RECORD_ALLOCATED ==
+            metadataBuffer.getInt32Volatile(CountersReader::metadataOffset(counterId)) &&
+            hasKey(counterId, key);
+    }
+
+    std::int32_t findIndexed(const std::string& key) const
+    {
+        auto range = m_counterIdsByKey.equal_range(key);
+
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (isCurrent(it->second, key))
+            {
+                return it->second;
+            }
+        }
+
+        return NULL_COUNTER_ID;
+    }
+
+    void removeEntry(const std::string& key, std::int32_t counterId)
+    {
+        auto range = m_counterIdsByKey.equal_range(key);
+
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == counterId)
+            {
+                m_counterIdsByKey.erase(it);
+                return;
+            }
+        }
+    }
+};
+
+}}
+
+#endif //AERON_COUNTERSINDEX_H
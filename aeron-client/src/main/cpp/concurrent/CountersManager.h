@@ -78,6 +78,7 @@ public:
         record.typeId = typeId;
 
         AtomicBuffer keyBuffer(m_metadataBuffer.buffer() + recordOffset + KEY_OFFSET, sizeof(CounterMetaDataDefn::key));
+        keyBuffer.setMemory(0, keyBuffer.capacity(), 0);
         keyFunc(keyBuffer);
 
         record.freeToReuseDeadline = NOT_FREE_TO_REUSE;
@@ -111,6 +112,7 @@ public:
 
         record.typeId = typeId;
         record.freeToReuseDeadline = NOT_FREE_TO_REUSE;
+        m_metadataBuffer.setMemory(recordOffset + KEY_OFFSET, MAX_KEY_LENGTH, 0);
 
         if (nullptr != key && keyLength > 0)
         {
@@ -196,8 +196,15 @@ public:
     static const std::int64_t NOT_FREE_TO_REUSE = INT64_MAX;
 
     static const util::index_t COUNTER_LENGTH = sizeof(CounterValueDefn);
+    static_assert (
+        sizeof(CounterValueDefn) == (2 * util::BitUtil::CACHE_LINE_LENGTH),
+        "each counter value must own a cache line pair to avoid adjacent-line false sharing");
+    /// Waiter count and wake sequence, in the padding of a counter value, used to park threads until it advances.
+    static const util::index_t WAITERS_OFFSET = sizeof(std::int64_t);
+    static const util::index_t WAKE_SEQUENCE_OFFSET = sizeof(std::int64_t) + sizeof(std::int32_t);
     static const util::index_t METADATA_LENGTH = sizeof(CounterMetaDataDefn);
     static const util::index_t FREE_TO_REUSE_DEADLINE_OFFSET = offsetof(CounterMetaDataDefn, freeToReuseDeadline);
+    static const util::index_t TYPE_ID_OFFSET = offsetof(CounterMetaDataDefn, typeId);
     static const util::index_t KEY_OFFSET = offsetof(CounterMetaDataDefn, key);
     static const util::index_t LABEL_LENGTH_OFFSET = offsetof(CounterMetaDataDefn, labelLength);
 
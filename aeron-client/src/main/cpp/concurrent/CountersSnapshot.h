@@ -0,0 +1,225 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_COUNTERSSNAPSHOT_H
+#define AERON_COUNTERSSNAPSHOT_H
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <util/Exceptions.h>
+
+#include "CountersReader.h"
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Columnar copy of the allocated counters taken from a CountersReader, in counter id order, laid out in a caller
+ * provided buffer so repeated scrapes do not allocate.
+ *
+ * Each counter is consistent with its own metadata: the record state is re-read after the value is copied and a
+ * counter freed in the meantime is left out. Counters are not captured at a single instant relative to each other.
+ */
+class CountersSnapshot
+{
+public:
+    inline CountersSnapshot(std::uint8_t *buffer, util::index_t length, std::int32_t capacity, bool withLabels) :
+        m_capacity(capacity)
+    {
+        if (capacity < 0 || length < bufferLength(capacity, withLabels))
+        {
+            throw util::IllegalArgumentException(
+                util::strPrintf("buffer length %d too small for capacity %d", length, capacity), SOURCEINFO);
+        }
+
+        m_values = reinterpret_cast<std::int64_t *>(buffer);
+        m_rates = reinterpret_cast<double *>(m_values + capacity);
+        m_counterIds = reinterpret_cast<std::int32_t *>(m_rates + capacity);
+        m_typeIds = m_counterIds + capacity;
+        m_labelLengths = withLabels ? m_typeIds + capacity : nullptr;
+        m_labels = withLabels ? reinterpret_cast<char *>(m_labelLengths + capacity) : nullptr;
+    }
+
+    inline static util::index_t bufferLength(std::int32_t capacity, bool withLabels)
+    {
+        util::index_t length = capacity * static_cast<util::index_t>((2 * sizeof(std::int64_t)) + (2 * sizeof(std::int32_t)));
+
+        if (withLabels)
+        {
+            length += capacity * static_cast<util::index_t>(sizeof(std::int32_t) + CountersReader::MAX_LABEL_LENGTH);
+        }
+
+        return length;
+    }
+
+    /**
+     * Copy the allocated counters without writing to the counters buffers.
+     *
+     * @param reader      for the counters.
+     * @param timestampNs at which the snapshot is taken, used to compute rates.
+     * @return the number of counters captured, at most the capacity.
+     */
+    std::int32_t take(const CountersReader& reader, std::int64_t timestampNs)
+    {
+        const AtomicBuffer metadataBuffer = reader.metaDataBuffer();
+        const AtomicBuffer valuesBuffer = reader.valuesBuffer();
+        const std::int32_t maxCounters = std::min(
+            metadataBuffer.capacity() / CountersReader::METADATA_LENGTH,
+            valuesBuffer.capacity() / CountersReader::COUNTER_LENGTH);
+        std::int32_t length = 0;
+
+        for (std::int32_t id = 0; id < maxCounters && length < m_capacity; id++)
+        {
+            const util::index_t offset = CountersReader::metadataOffset(id);
+            std::int32_t recordState = metadataBuffer.getInt32Volatile(offset);
+
+            if (CountersReader::RECORD_UNUSED == recordState)
+            {
+                break;
+            }
+            else if (CountersReader::RECORD_ALLOCATED != recordState)
+            {
+                continue;
+            }
+
+            const CountersReader::CounterMetaDataDefn& record =
+                metadataBuffer.overlayStruct<CountersReader::CounterMetaDataDefn>(offset);
+
+            m_counterIds[length] = id;
+            m_typeIds[length] = record.typeId;
+            m_values[length] = valuesBuffer.getInt64Volatile(CountersReader::counterOffset(id));
+            m_rates[length] = 0.0;
+
+            if (nullptr != m_labels)
+            {
+                const std::int32_t maxLabelLength = CountersReader::MAX_LABEL_LENGTH;
+                std::int32_t labelLength = std::max(0, std::min(record.labelLength, maxLabelLength));
+
+                m_labelLengths[length] = labelLength;
+                std::memcpy(m_labels + (length * CountersReader::MAX_LABEL_LENGTH), record.label, labelLength);
+            }
+
+            if (CountersReader::RECORD_ALLOCATED == metadataBuffer.getInt32Volatile(offset))
+            {
+                length++;
+            }
+        }
+
+        m_length = length;
+        m_timestampNs = timestampNs;
+
+        return length;
+    }
+
+    /**
+     * Compute the change per second of each counter since a previous snapshot. Counters not in the previous snapshot,
+     * or whose type changed, get a rate of 0.
+     *
+     * @param previous snapshot taken earlier from the same counters.
+     */
+    void computeRates(const CountersSnapshot& previous)
+    {
+        const std::int64_t intervalNs = m_timestampNs - previous.m_timestampNs;
+        std::int32_t j = 0;
+
+        for (std::int32_t i = 0; i < m_length; i++)
+        {
+            while (j < previous.m_length && previous.m_counterIds[j] < m_counterIds[i])
+            {
+                j++;
+            }
+
+            if (intervalNs > 0 &&
+                j < previous.m_length &&
+                previous.m_counterIds[j] == m_counterIds[i] &&
+                previous.m_typeIds[j] == m_typeIds[i])
+            {
+                m_rates[i] = (static_cast<double>(m_values[i] - previous.m_values[j]) * 1000000000.0) /
+                    static_cast<double>(intervalNs);
+            }
+            else
+            {
+                m_rates[i] = 0.0;
+            }
+        }
+    }
+
+    inline std::int32_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    inline std::int32_t length() const
+    {
+        return m_length;
+    }
+
+    inline std::int64_t timestampNs() const
+    {
+        return m_timestampNs;
+    }
+
+    inline std::int32_t counterId(std::int32_t index) const
+    {
+        return m_counterIds[index];
+    }
+
+    inline std::int32_t typeId(std::int32_t index) const
+    {
+        return m_typeIds[index];
+    }
+
+    inline std::int64_t value(std::int32_t index) const
+    {
+        return m_values[index];
+    }
+
+    inline double rate(std::int32_t index) const
+    {
+        return m_rates[index];
+    }
+
+    inline bool hasLabels() const
+    {
+        return nullptr != m_labels;
+    }
+
+    inline std::string label(std::int32_t index) const
+    {
+        if (nullptr == m_labels)
+        {
+            return std::string();
+        }
+
+        return std::string(m_labels + (index * CountersReader::MAX_LABEL_LENGTH), m_labelLengths[index]);
+    }
+
+private:
+    std::int64_t *m_values;
+    double *m_rates;
+    std::int32_t *m_counterIds;
+    std::int32_t *m_typeIds;
+    std::int32_t *m_labelLengths;
+    char *m_labels;
+    std::int32_t m_capacity;
+    std::int32_t m_length = 0;
+    std::int64_t m_timestampNs = 0;
+};
+
+}}
+
+#endif
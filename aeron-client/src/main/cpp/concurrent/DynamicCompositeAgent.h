@@ -0,0 +1,274 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_CONCURRENT_DYNAMICCOMPOSITEAGENT_H
+#define AERON_CONCURRENT_DYNAMICCOMPOSITEAGENT_H
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <vector>
+
+#include "concurrent/CompositeAgent.h"
+
+namespace aeron {
+
+namespace concurrent {
+
+/**
+ * A CompositeAgent that Agents can be added to and removed from from any thread while it is running.
+ * <p>
+ * Adds and removes are pushed onto a lock free stack, which the thread running the composite takes whole at the
+ * start of each duty cycle and applies in the order they were made before doing any work. An added Agent is started
+ * on that thread before its first doWork and a removed Agent is closed there after its last, so an Agent only ever
+ * sees the one thread. If starting or closing an Agent throws then the remaining changes are still applied and the
+ * first exception is rethrown, an Agent whose onStart throws is not added.
+ * <p>
+ * Agents still in the composite when it is closed are closed with it.
+ */
+class DynamicCompositeAgent
+{
+public:
+    DynamicCompositeAgent() = default;
+
+    DynamicCompositeAgent(const DynamicCompositeAgent&) = delete;
+    DynamicCompositeAgent& operator=(const DynamicCompositeAgent&) = delete;
+
+    ~DynamicCompositeAgent()
+    {
+        Change *change = m_changes.exchange(nullptr, std::memory_order_acquire);
+
+        while (nullptr != change)
+        {
+            Change *next = change->next;
+            delete change;
+            change = next;
+        }
+    }
+
+    /**
+     * Add an Agent, which must outlive its membership of the composite. Thread safe.
+     *
+     * @param agent to add.
+     */
+    template<typename Agent>
+    inline void add(Agent& agent)
+    {
+        push(new Change(CompositeAgentMember(agent)));
+    }
+
+    /**
+     * Remove an Agent that has been added. Thread safe.
+     *
+     * @param agent to remove.
+     */
+    template<typename Agent>
+    inline void remove(Agent& agent)
+    {
+        push(new Change(static_cast<const void *>(&agent)));
+    }
+
+    /**
+     * Have all adds and removes made so far been applied by the thread running the composite? Once a remove has been
+     * applied the Agent has been closed and may be destroyed.
+     *
+     * @return true if there are no adds or removes waiting to be applied.
+     */
+    inline bool hasAppliedChanges() const
+    {
+        return 0 == m_pendingChangeCount.load(std::memory_order_acquire);
+    }
+
+    inline void onStart()
+    {
+    }
+
+    inline int doWork()
+    {
+        if (0 == m_agentIndex)
+        {
+            applyChanges();
+        }
+
+        int workCount = 0;
+        const std::size_t length = m_agents.size();
+
+        while (m_agentIndex < length)
+        {
+            workCount += m_agents[m_agentIndex++].doWork();
+        }
+        m_agentIndex = 0;
+
+        return workCount;
+    }
+
+    inline void onClose()
+    {
+        std::exception_ptr exception;
+
+        for (CompositeAgentMember& member : m_agents)
+        {
+            try
+            {
+                member.onClose();
+            }
+            catch (...)
+            {
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+        m_agents.clear();
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    /**
+     * The number of Agents in the composite, only to be read on the thread running it.
+     *
+     * @return the number of Agents in the composite.
+     */
+    inline std::size_t agentCount() const
+    {
+        return m_agents.size();
+    }
+
+    /**
+     * Duty cycle timing of an Agent, only to be read on the thread running the composite.
+     *
+     * @param index of the Agent, which changes as Agents are removed before it.
+     * @return duty cycle timing of the Agent.
+     */
+    inline const AgentDutyCycleStats& stats(std::size_t index) const
+    {
+        return m_agents[index].stats();
+    }
+
+private:
+    struct Change
+    {
+        explicit Change(CompositeAgentMember&& member) :
+            added(new CompositeAgentMember(std::move(member))), removed(nullptr)
+        {
+        }
+
+        explicit Change(const void *agent) : added(nullptr), removed(agent)
+        {
+        }
+
+        ~Change()
+        {
+            delete added;
+        }
+
+        CompositeAgentMember *added;
+        const void *removed;
+        Change *next = nullptr;
+    };
+
+    std::vector<CompositeAgentMember> m_agents;
+    std::size_t m_agentIndex = 0;
+    std::atomic<Change*> m_changes { nullptr };
+    std::atomic<std::int64_t> m_pendingChangeCount { 0 };
+
+    inline void push(Change *change)
+    {
+        m_pendingChangeCount.fetch_add(1, std::memory_order_release);
+
+        Change *head = m_changes.load(std::memory_order_relaxed);
+        do
+        {
+            change->next = head;
+        }
+        while (!m_changes.compare_exchange_weak(head, change, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    inline void applyChanges()
+    {
+        Change *change = m_changes.exchange(nullptr, std::memory_order_acquire);
+
+        if (nullptr == change)
+        {
+            return;
+        }
+
+        Change *reversed = nullptr;
+        while (nullptr != change)
+        {
+            Change *next = change->next;
+            change->next = reversed;
+            reversed = change;
+            change = next;
+        }
+
+        std::exception_ptr exception;
+        while (nullptr != reversed)
+        {
+            Change *next = reversed->next;
+
+            try
+            {
+                apply(*reversed);
+            }
+            catch (...)
+            {
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+
+            delete reversed;
+            m_pendingChangeCount.fetch_sub(1, std::memory_order_release);
+            reversed = next;
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    inline void apply(Change& change)
+    {
+        if (nullptr != change.added)
+        {
+            change.added->onStart();
+            m_agents.push_back(std::move(*change.added));
+            return;
+        }
+
+        for (auto it = m_agents.begin(); it != m_agents.end(); ++it)
+        {
+            if (it->agent() == change.removed)
+            {
+                CompositeAgentMember member = std::move(*it);
+                m_agents.erase(it);
+                member.onClose();
+                return;
+            }
+        }
+    }
+};
+
+}}
+
+#endif
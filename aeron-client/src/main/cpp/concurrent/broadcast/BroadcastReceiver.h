@@ -113,6 +113,15 @@ public:
         return isAvailable;
     }
 
+    /**
+     * Is the current record at least margin bytes away from being overwritten by the transmitter, so it can be
+     * safely read in place rather than copied out first.
+     */
+    inline bool hasHeadroom(util::index_t margin)
+    {
+        return (m_cursor + m_capacity - margin) > m_buffer.getInt64Volatile(m_tailIntentCounterIndex);
+    }
+
     inline bool validate()
     {
         // load fence = acquire()
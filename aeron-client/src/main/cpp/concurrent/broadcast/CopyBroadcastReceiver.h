@@ -57,21 +57,35 @@ public:
             }
 
             const std::int32_t length = m_receiver.length();
-            if (length > m_scratchBuffer.capacity())
-            {
-                throw util::IllegalStateException(
-                    util::strPrintf("Buffer required size %d but only has %d", length, m_scratchBuffer.capacity()), SOURCEINFO);
-            }
-
             const std::int32_t msgTypeId = m_receiver.typeId();
-            m_scratchBuffer.putBytes(0, m_receiver.buffer(), m_receiver.offset(), length);
 
-            if (!m_receiver.validate())
+            // dispatch in place while well clear of the transmitter, copy first when falling behind
+            if (m_receiver.hasHeadroom(m_receiver.capacity() / 2))
             {
-                throw util::IllegalStateException("Unable to keep up with broadcast buffer", SOURCEINFO);
+                handler(msgTypeId, m_receiver.buffer(), m_receiver.offset(), length);
+
+                if (!m_receiver.validate())
+                {
+                    throw util::IllegalStateException("Unable to keep up with broadcast buffer", SOURCEINFO);
+                }
             }
+            else
+            {
+                if (length > m_scratchBuffer.capacity())
+                {
+                    throw util::IllegalStateException(
+                        util::strPrintf("Buffer required size %d but only has %d", length, m_scratchBuffer.capacity()), SOURCEINFO);
+                }
+
+                m_scratchBuffer.putBytes(0, m_receiver.buffer(), m_receiver.offset(), length);
 
-            handler(msgTypeId, m_scratchBuffer, 0, length);
+                if (!m_receiver.validate())
+                {
+                    throw util::IllegalStateException("Unable to keep up with broadcast buffer", SOURCEINFO);
+                }
+
+                handler(msgTypeId, m_scratchBuffer, 0, length);
+            }
 
             messagesReceived = 1;
         }
@@ -54,10 +54,10 @@ public:
         return *m_tailAddr;
     }
 
-    inline std::int32_t claim(
+    template <typename HeaderWriterType> inline std::int32_t claim(
         std::int32_t termId,
         std::int32_t termOffset,
-        const HeaderWriter& header,
+        const HeaderWriterType& header,
         util::index_t length,
         BufferClaim& bufferClaim)
     {
@@ -81,14 +81,41 @@ public:
         return resultingOffset;
     }
 
-    inline std::int32_t appendUnfragmentedMessage(
+    template <typename HeaderWriterType> std::int32_t claimFragmented(
         std::int32_t termId,
         std::int32_t termOffset,
-        const HeaderWriter& header,
+        const HeaderWriterType& header,
+        util::index_t length,
+        util::index_t maxPayloadLength,
+        FragmentedBufferClaim& bufferClaim)
+    {
+        const util::index_t requiredLength = computeFragmentedLength(length, maxPayloadLength);
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+        std::int32_t resultingOffset = termOffset + requiredLength;
+        putRawTailOrdered(termId, resultingOffset);
+
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termId, termOffset, header, termLength);
+        }
+        else
+        {
+            writeFragmentHeaders(m_termBuffer, header, termOffset, length, maxPayloadLength, termId);
+            bufferClaim.wrap(m_termBuffer, termOffset, requiredLength, length, maxPayloadLength);
+        }
+
+        return resultingOffset;
+    }
+
+    template <typename HeaderWriterType, typename ReservedValueSupplier> inline std::int32_t appendUnfragmentedMessage(
+        std::int32_t termId,
+        std::int32_t termOffset,
+        const HeaderWriterType& header,
         AtomicBuffer& srcBuffer,
         util::index_t srcOffset,
         util::index_t length,
-        const on_reserved_value_supplier_t& reservedValueSupplier)
+        const ReservedValueSupplier& reservedValueSupplier)
     {
         const util::index_t frameLength = length + DataFrameHeader::LENGTH;
         const util::index_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
@@ -107,7 +134,8 @@ public:
             header.write(m_termBuffer, termOffset, frameLength, termId);
             m_termBuffer.putBytes(termOffset + DataFrameHeader::LENGTH, srcBuffer, srcOffset, length);
 
-            const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, termOffset, frameLength);
+            const std::int64_t reservedValue =
+                supplyReservedValue(reservedValueSupplier, m_termBuffer, termOffset, frameLength);
             m_termBuffer.putInt64(termOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
             FrameDescriptor::frameLengthOrdered(m_termBuffer, termOffset, frameLength);
@@ -116,13 +144,14 @@ public:
         return resultingOffset;
     }
 
-    template <class BufferIterator> inline std::int32_t appendUnfragmentedMessage(
+    template <class BufferIterator, typename HeaderWriterType, typename ReservedValueSupplier>
+    inline std::int32_t appendUnfragmentedMessage(
         std::int32_t termId,
         std::int32_t termOffset,
-        const HeaderWriter& header,
+        const HeaderWriterType& header,
         BufferIterator bufferIt,
         util::index_t length,
-        const on_reserved_value_supplier_t& reservedValueSupplier)
+        const ReservedValueSupplier& reservedValueSupplier)
     {
         const util::index_t frameLength = length + DataFrameHeader::LENGTH;
         const util::index_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
@@ -149,7 +178,8 @@ public:
                 m_termBuffer.putBytes(offset, *bufferIt, 0, bufferIt->capacity());
             }
 
-            const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, termOffset, frameLength);
+            const std::int64_t reservedValue =
+                supplyReservedValue(reservedValueSupplier, m_termBuffer, termOffset, frameLength);
             m_termBuffer.putInt64(termOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
             FrameDescriptor::frameLengthOrdered(m_termBuffer, termOffset, frameLength);
@@ -158,15 +188,64 @@ public:
         return resultingOffset;
     }
 
-    std::int32_t appendFragmentedMessage(
+    /**
+     * Append a batch of messages, one unfragmented frame per buffer, advancing the tail once for all of them.
+     *
+     * @param batchLength sum of the aligned frame lengths of the messages in the batch.
+     */
+    template <class BufferIterator, typename HeaderWriterType, typename ReservedValueSupplier>
+    std::int32_t appendUnfragmentedBatch(
+        std::int32_t termId,
+        std::int32_t termOffset,
+        const HeaderWriterType& header,
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        util::index_t batchLength,
+        const ReservedValueSupplier& reservedValueSupplier)
+    {
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        std::int32_t resultingOffset = termOffset + batchLength;
+        putRawTailOrdered(termId, resultingOffset);
+
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termId, termOffset, header, termLength);
+        }
+        else
+        {
+            std::int32_t frameOffset = termOffset;
+
+            for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+            {
+                const util::index_t length = it->capacity();
+                const util::index_t frameLength = length + DataFrameHeader::LENGTH;
+
+                header.write(m_termBuffer, frameOffset, frameLength, termId);
+                m_termBuffer.putBytes(frameOffset + DataFrameHeader::LENGTH, *it, 0, length);
+
+                const std::int64_t reservedValue =
+                    supplyReservedValue(reservedValueSupplier, m_termBuffer, frameOffset, frameLength);
+                m_termBuffer.putInt64(frameOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+                FrameDescriptor::frameLengthOrdered(m_termBuffer, frameOffset, frameLength);
+
+                frameOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+        }
+
+        return resultingOffset;
+    }
+
+    template <typename HeaderWriterType, typename ReservedValueSupplier> std::int32_t appendFragmentedMessage(
         std::int32_t termId,
         std::int32_t termOffset,
-        const HeaderWriter& header,
+        const HeaderWriterType& header,
         AtomicBuffer& srcBuffer,
         util::index_t srcOffset,
         util::index_t length,
         util::index_t maxPayloadLength,
-        const on_reserved_value_supplier_t& reservedValueSupplier)
+        const ReservedValueSupplier& reservedValueSupplier)
     {
         const int numMaxPayloads = length / maxPayloadLength;
         const util::index_t remainingPayload = length % maxPayloadLength;
@@ -210,7 +289,8 @@ public:
 
                 FrameDescriptor::frameFlags(m_termBuffer, offset, flags);
 
-                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, offset, frameLength);
+                const std::int64_t reservedValue =
+                    supplyReservedValue(reservedValueSupplier, m_termBuffer, offset, frameLength);
                 m_termBuffer.putInt64(offset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
                 FrameDescriptor::frameLengthOrdered(m_termBuffer, offset, frameLength);
@@ -225,14 +305,15 @@ public:
         return resultingOffset;
     }
 
-    template <class BufferIterator> std::int32_t appendFragmentedMessage(
+    template <class BufferIterator, typename HeaderWriterType, typename ReservedValueSupplier>
+    std::int32_t appendFragmentedMessage(
         std::int32_t termId,
         std::int32_t termOffset,
-        const HeaderWriter& header,
+        const HeaderWriterType& header,
         BufferIterator bufferIt,
         util::index_t length,
         util::index_t maxPayloadLength,
-        const on_reserved_value_supplier_t& reservedValueSupplier)
+        const ReservedValueSupplier& reservedValueSupplier)
     {
         const int numMaxPayloads = length / maxPayloadLength;
         const util::index_t remainingPayload = length % maxPayloadLength;
@@ -293,7 +374,8 @@ public:
 
                 FrameDescriptor::frameFlags(m_termBuffer, offset, flags);
 
-                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, offset, frameLength);
+                const std::int64_t reservedValue =
+                    supplyReservedValue(reservedValueSupplier, m_termBuffer, offset, frameLength);
                 m_termBuffer.putInt64(offset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
                 FrameDescriptor::frameLengthOrdered(m_termBuffer, offset, frameLength);
@@ -312,11 +394,11 @@ private:
     AtomicBuffer& m_termBuffer;
     std::int64_t *const m_tailAddr;
 
-    inline static std::int32_t handleEndOfLogCondition(
+    template <typename HeaderWriterType> inline static std::int32_t handleEndOfLogCondition(
         AtomicBuffer& termBuffer,
         std::int32_t termId,
         std::int32_t termOffset,
-        const HeaderWriter& header,
+        const HeaderWriterType& header,
         util::index_t termLength)
     {
         if (termOffset < termLength)
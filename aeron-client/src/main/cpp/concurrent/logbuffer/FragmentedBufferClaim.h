@@ -0,0 +1,186 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_CONCURRENT_LOGBUFFER_FRAGMENTED_BUFFER_CLAIM__
+#define INCLUDED_AERON_CONCURRENT_LOGBUFFER_FRAGMENTED_BUFFER_CLAIM__
+
+#include <algorithm>
+#include <util/Index.h>
+#include <concurrent/AtomicBuffer.h>
+#include <concurrent/logbuffer/DataFrameHeader.h>
+
+namespace aeron { namespace concurrent { namespace logbuffer {
+
+/**
+ * Represents a claimed range in a term buffer, split across as many fragments as a message longer than the max payload
+ * length needs, to be used for encoding the message in place for later commit.
+ * <p>
+ * Each fragment is a writable view from {@link #fragment(int)}, or the message can be written by message offset with
+ * {@link #putBytes()} which spans fragment boundaries. Use {@link #commit()} to make all fragments available to
+ * subscribers once the message is complete or {@link #abort()} to leave the range as padding.
+ */
+class FragmentedBufferClaim
+{
+public:
+    typedef FragmentedBufferClaim this_t;
+
+    inline FragmentedBufferClaim()
+    {
+    }
+
+    /// @cond HIDDEN_SYMBOLS
+    inline void wrap(
+        AtomicBuffer& termBuffer,
+        util::index_t termOffset,
+        util::index_t claimLength,
+        util::index_t length,
+        util::index_t maxPayloadLength)
+    {
+        m_buffer.wrap(termBuffer.buffer() + termOffset, claimLength);
+        m_length = length;
+        m_maxPayloadLength = maxPayloadLength;
+        m_fragmentCount = (length + maxPayloadLength - 1) / maxPayloadLength;
+    }
+    /// @endcond
+
+    /**
+     * The length of the message claimed, across all fragments.
+     *
+     * @return length of the message in bytes.
+     */
+    inline util::index_t length() const
+    {
+        return m_length;
+    }
+
+    /**
+     * The number of fragments the message is split into.
+     *
+     * @return number of fragments.
+     */
+    inline int fragmentCount() const
+    {
+        return m_fragmentCount;
+    }
+
+    /**
+     * The payload length of a fragment, all but the last are the max payload length.
+     *
+     * @param index of the fragment.
+     * @return length in bytes of the payload of the fragment.
+     */
+    inline util::index_t fragmentLength(int index) const
+    {
+        return std::min(m_maxPayloadLength, m_length - (index * m_maxPayloadLength));
+    }
+
+    /**
+     * Writable view over the payload of a fragment.
+     *
+     * @param index of the fragment.
+     * @return buffer over the payload of the fragment.
+     */
+    inline AtomicBuffer fragment(int index)
+    {
+        return AtomicBuffer(
+            m_buffer.buffer() + frameOffset(index) + DataFrameHeader::LENGTH, fragmentLength(index));
+    }
+
+    /**
+     * Copy bytes into the message at an offset from its start, spanning fragments as required.
+     *
+     * @param messageOffset at which to write in the message.
+     * @param srcBuffer     containing the bytes.
+     * @param srcOffset     in the source buffer.
+     * @param length        of bytes to copy.
+     * @return this for fluent API semantics.
+     */
+    inline this_t& putBytes(
+        util::index_t messageOffset, const AtomicBuffer& srcBuffer, util::index_t srcOffset, util::index_t length)
+    {
+        while (length > 0)
+        {
+            const int index = messageOffset / m_maxPayloadLength;
+            const util::index_t fragmentOffset = messageOffset - (index * m_maxPayloadLength);
+            const util::index_t bytesToWrite = std::min(length, fragmentLength(index) - fragmentOffset);
+
+            m_buffer.putBytes(
+                frameOffset(index) + DataFrameHeader::LENGTH + fragmentOffset, srcBuffer, srcOffset, bytesToWrite);
+
+            messageOffset += bytesToWrite;
+            srcOffset += bytesToWrite;
+            length -= bytesToWrite;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Write the provided value into the reserved space of the header of every fragment.
+     *
+     * @param value to be stored in the reserve space at the end of each data frame header.
+     * @return this for fluent API semantics.
+     */
+    inline this_t& reservedValue(const std::int64_t value)
+    {
+        for (int i = 0; i < m_fragmentCount; i++)
+        {
+            m_buffer.putInt64(frameOffset(i) + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, value);
+        }
+
+        return *this;
+    }
+
+    /**
+     * Commit the fragments of the message, in order, to the log buffer so that it is available to subscribers.
+     */
+    inline void commit()
+    {
+        for (int i = 0; i < m_fragmentCount; i++)
+        {
+            m_buffer.putInt32Ordered(frameOffset(i), fragmentLength(i) + DataFrameHeader::LENGTH);
+        }
+    }
+
+    /**
+     * Abort a claim of the message space to the log buffer so that log can progress ignoring this claim.
+     */
+    inline void abort()
+    {
+        for (int i = 0; i < m_fragmentCount; i++)
+        {
+            const util::index_t offset = frameOffset(i);
+
+            m_buffer.putUInt16(offset + DataFrameHeader::TYPE_FIELD_OFFSET, DataFrameHeader::HDR_TYPE_PAD);
+            m_buffer.putInt32Ordered(offset, fragmentLength(i) + DataFrameHeader::LENGTH);
+        }
+    }
+
+private:
+    AtomicBuffer m_buffer;
+    util::index_t m_length = 0;
+    util::index_t m_maxPayloadLength = 0;
+    int m_fragmentCount = 0;
+
+    inline util::index_t frameOffset(int index) const
+    {
+        return index * (m_maxPayloadLength + DataFrameHeader::LENGTH);
+    }
+};
+
+}}}
+
+#endif
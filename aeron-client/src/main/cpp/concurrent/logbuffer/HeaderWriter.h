@@ -58,6 +58,49 @@ private:
     const std::int32_t m_streamId;
 };
 
+/**
+ * Header writer for a single publisher that precomputes the constant parts of the default frame header so each frame
+ * is written with three 64-bit stores, the first ordered and carrying the negative frame length, instead of a store per
+ * field. Produces the same bytes as HeaderWriter on a LITTLE_ENDIAN host.
+ */
+class PrecomputedHeaderWriter
+{
+public:
+    PrecomputedHeaderWriter(AtomicBuffer defaultHdr) :
+        m_versionFlagsType(
+            (static_cast<std::uint64_t>(DataFrameHeader::CURRENT_VERSION) << 32) |
+            (static_cast<std::uint64_t>(FrameDescriptor::BEGIN_FRAG | FrameDescriptor::END_FRAG) << 40) |
+            (static_cast<std::uint64_t>(DataFrameHeader::HDR_TYPE_DATA) << 48)),
+        m_sessionId(static_cast<std::uint64_t>(static_cast<std::uint32_t>(
+            defaultHdr.getInt32(DataFrameHeader::SESSION_ID_FIELD_OFFSET))) << 32),
+        m_streamId(static_cast<std::uint32_t>(defaultHdr.getInt32(DataFrameHeader::STREAM_ID_FIELD_OFFSET)))
+    {
+    }
+
+    /**
+     * Write header in LITTLE_ENDIAN order
+     */
+    inline void write(AtomicBuffer& termBuffer, util::index_t offset, util::index_t length, std::int32_t termId) const
+    {
+        termBuffer.putInt64Ordered(
+            offset, static_cast<std::int64_t>(m_versionFlagsType | static_cast<std::uint32_t>(-length)));
+        atomic::release();
+
+        termBuffer.putInt64(
+            offset + DataFrameHeader::TERM_OFFSET_FIELD_OFFSET,
+            static_cast<std::int64_t>(m_sessionId | static_cast<std::uint32_t>(offset)));
+        termBuffer.putInt64(
+            offset + DataFrameHeader::STREAM_ID_FIELD_OFFSET,
+            static_cast<std::int64_t>(
+                m_streamId | (static_cast<std::uint64_t>(static_cast<std::uint32_t>(termId)) << 32)));
+    }
+
+private:
+    const std::uint64_t m_versionFlagsType;
+    const std::uint64_t m_sessionId;
+    const std::uint64_t m_streamId;
+};
+
 }}}
 
 #endif
@@ -22,9 +22,21 @@
 #include <util/BitUtil.h>
 #include <util/Exceptions.h>
 #include <concurrent/AtomicBuffer.h>
+#include <concurrent/CountersReader.h>
 #include "FrameDescriptor.h"
 #include "DataFrameHeader.h"
 
+#if defined(__linux__)
+#include <climits>
+#include <ctime>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
 namespace aeron { namespace concurrent { namespace logbuffer {
 
 namespace LogBufferDescriptor {
@@ -33,16 +45,24 @@ static const std::int32_t TERM_MIN_LENGTH = 64 * 1024;
 static const std::int32_t TERM_MAX_LENGTH = 1024 * 1024 * 1024;
 static const std::int32_t PAGE_MIN_SIZE = 4 * 1024;
 static const std::int32_t PAGE_MAX_SIZE = 1024 * 1024 * 1024;
+static const std::int32_t HUGE_PAGE_MIN_SIZE = 2 * 1024 * 1024;
+
+// Set for the whole build with the AERON_LOGBUFFER_PARTITION_COUNT CMake variable so the driver agrees
+#ifndef AERON_LOGBUFFER_PARTITION_COUNT
+#define AERON_LOGBUFFER_PARTITION_COUNT (3)
+#endif
 
 #if defined(__GNUC__) || _MSC_VER >= 1900
-constexpr static const int PARTITION_COUNT = 3;
+constexpr static const int PARTITION_COUNT = AERON_LOGBUFFER_PARTITION_COUNT;
 #else
 // Visual Studio 2013 doesn't like constexpr without an update
 // https://msdn.microsoft.com/en-us/library/vstudio/hh567368.aspx
 // https://www.microsoft.com/en-us/download/details.aspx?id=41151
-static const int PARTITION_COUNT = 3;
+static const int PARTITION_COUNT = AERON_LOGBUFFER_PARTITION_COUNT;
 #endif
 
+static_assert(PARTITION_COUNT >= 3 && PARTITION_COUNT <= 16, "PARTITION_COUNT must be from 3 to 16");
+
 /*
  * Layout description for log buffers which contains partitions of terms with associated term meta data,
  * plus ending with overall log meta data.
@@ -78,6 +98,12 @@ static const util::index_t LOG_META_DATA_SECTION_INDEX = PARTITION_COUNT;
  *  +---------------------------------------------------------------+
  *  |                      Active Term Count                        |
  *  +---------------------------------------------------------------+
+ *  |                    Is Subscriber Wakeup                       |
+ *  +---------------------------------------------------------------+
+ *  |                     Subscriber Waiters                        |
+ *  +---------------------------------------------------------------+
+ *  |                  Subscriber Wake Sequence                     |
+ *  +---------------------------------------------------------------+
  *  |                      Cache Line Padding                      ...
  * ...                                                              |
  *  +---------------------------------------------------------------+
@@ -86,6 +112,18 @@ static const util::index_t LOG_META_DATA_SECTION_INDEX = PARTITION_COUNT;
  *  +---------------------------------------------------------------+
  *  |                        Is Connected                           |
  *  +---------------------------------------------------------------+
+ *  |             Subscriber Positions Change Number                |
+ *  +---------------------------------------------------------------+
+ *  |                         Clean Limit                           |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                  Publisher Window Length                      |
+ *  +---------------------------------------------------------------+
+ *  |                 Subscriber Position Count                     |
+ *  +---------------------------------------------------------------+
+ *  |                 Subscriber Position Ids                      ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
  *  |                      Cache Line Padding                      ...
  * ...                                                              |
  *  +---------------------------------------------------------------+
@@ -112,6 +150,12 @@ static const util::index_t LOG_META_DATA_SECTION_INDEX = PARTITION_COUNT;
  */
 
 static const util::index_t LOG_DEFAULT_FRAME_HEADER_MAX_LENGTH = util::BitUtil::CACHE_LINE_LENGTH * 2;
+static const std::int32_t MAX_SUBSCRIBER_POSITIONS = 16;
+
+static const std::size_t TAIL_SECTION_LENGTH = (PARTITION_COUNT * sizeof(std::int64_t)) + (4 * sizeof(std::int32_t));
+static const std::size_t TAIL_SECTION_PADDING =
+    (2 * util::BitUtil::CACHE_LINE_LENGTH * ((TAIL_SECTION_LENGTH / (2 * util::BitUtil::CACHE_LINE_LENGTH)) + 1)) -
+    TAIL_SECTION_LENGTH;
 
 #pragma pack(push)
 #pragma pack(4)
@@ -119,10 +163,19 @@ struct LogMetaDataDefn
 {
     std::int64_t termTailCounters[PARTITION_COUNT];
     std::int32_t activeTermCount;
-    std::int8_t pad1[(2 * util::BitUtil::CACHE_LINE_LENGTH) - ((PARTITION_COUNT * sizeof(std::int64_t)) + sizeof(std::int32_t))];
+    std::int32_t isSubscriberWakeup;
+    std::int32_t subscriberWaiters;
+    std::int32_t subscriberWakeSequence;
+    std::int8_t pad1[TAIL_SECTION_PADDING];
     std::int64_t endOfStreamPosition;
     std::int32_t isConnected;
-    std::int8_t pad2[(2 * util::BitUtil::CACHE_LINE_LENGTH) - (sizeof(std::int64_t) + sizeof(std::int32_t))];
+    std::int32_t subscriberPositionsChangeNumber;
+    std::int64_t cleanLimit;
+    std::int32_t publisherWindowLength;
+    std::int32_t subscriberPositionCount;
+    std::int32_t subscriberPositionIds[MAX_SUBSCRIBER_POSITIONS];
+    std::int8_t pad2[(2 * util::BitUtil::CACHE_LINE_LENGTH) -
+        ((2 * sizeof(std::int64_t)) + ((4 + MAX_SUBSCRIBER_POSITIONS) * sizeof(std::int32_t)))];
     std::int64_t correlationId;
     std::int32_t initialTermId;
     std::int32_t defaultFrameHeaderLength;
@@ -136,8 +189,20 @@ struct LogMetaDataDefn
 static const util::index_t TERM_TAIL_COUNTER_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, termTailCounters);
 
 static const util::index_t LOG_ACTIVE_TERM_COUNT_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, activeTermCount);
+static const util::index_t LOG_IS_SUBSCRIBER_WAKEUP_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, isSubscriberWakeup);
+static const util::index_t LOG_SUBSCRIBER_WAITERS_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, subscriberWaiters);
+static const util::index_t LOG_SUBSCRIBER_WAKE_SEQUENCE_OFFSET =
+    (util::index_t)offsetof(LogMetaDataDefn, subscriberWakeSequence);
 static const util::index_t LOG_END_OF_STREAM_POSITION_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, endOfStreamPosition);
 static const util::index_t LOG_IS_CONNECTED_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, isConnected);
+static const util::index_t LOG_SUBSCRIBER_POSITIONS_CHANGE_NUMBER_OFFSET =
+    (util::index_t)offsetof(LogMetaDataDefn, subscriberPositionsChangeNumber);
+static const util::index_t LOG_CLEAN_LIMIT_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, cleanLimit);
+static const util::index_t LOG_PUBLISHER_WINDOW_LENGTH_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, publisherWindowLength);
+static const util::index_t LOG_SUBSCRIBER_POSITION_COUNT_OFFSET =
+    (util::index_t)offsetof(LogMetaDataDefn, subscriberPositionCount);
+static const util::index_t LOG_SUBSCRIBER_POSITION_IDS_OFFSET =
+    (util::index_t)offsetof(LogMetaDataDefn, subscriberPositionIds);
 static const util::index_t LOG_INITIAL_TERM_ID_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, initialTermId);
 static const util::index_t LOG_DEFAULT_FRAME_HEADER_LENGTH_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, defaultFrameHeaderLength);
 static const util::index_t LOG_MTU_LENGTH_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, mtuLength);
@@ -258,6 +323,55 @@ inline static void endOfStreamPosition(AtomicBuffer &logMetaDataBuffer, std::int
     logMetaDataBuffer.putInt64Ordered(LOG_END_OF_STREAM_POSITION_OFFSET, position);
 }
 
+/**
+ * Compute the publisher limit of an IPC publication from the subscriber positions the driver lists in the log meta
+ * data, so consumption relieves back pressure without waiting on the driver conductor.
+ *
+ * @param logMetaDataBuffer of the publication.
+ * @param countersReader    in which the subscriber positions are found.
+ * @param limit             from the publisher limit counter, which is never lowered.
+ * @return the greater of limit and the computed limit, or limit if the driver does not list subscriber positions or
+ * the list changed while being read.
+ */
+inline static std::int64_t clientPublisherLimit(
+    AtomicBuffer &logMetaDataBuffer, const CountersReader &countersReader, std::int64_t limit) AERON_NOEXCEPT
+{
+    const std::int32_t windowLength = logMetaDataBuffer.getInt32(LOG_PUBLISHER_WINDOW_LENGTH_OFFSET);
+    if (windowLength <= 0)
+    {
+        return limit;
+    }
+
+    const std::int32_t changeNumber = logMetaDataBuffer.getInt32Volatile(LOG_SUBSCRIBER_POSITIONS_CHANGE_NUMBER_OFFSET);
+    const std::int32_t count = logMetaDataBuffer.getInt32(LOG_SUBSCRIBER_POSITION_COUNT_OFFSET);
+    if ((changeNumber & 1) || count <= 0 || count > MAX_SUBSCRIBER_POSITIONS)
+    {
+        return limit;
+    }
+
+    std::int64_t minPosition = INT64_MAX;
+    for (std::int32_t i = 0; i < count; i++)
+    {
+        const std::int32_t counterId = logMetaDataBuffer.getInt32(
+            LOG_SUBSCRIBER_POSITION_IDS_OFFSET + (i * static_cast<util::index_t>(sizeof(std::int32_t))));
+        if (counterId < 0 || counterId >= countersReader.maxCounterId())
+        {
+            return limit;
+        }
+
+        minPosition = std::min(minPosition, countersReader.getCounterValue(counterId));
+    }
+
+    const std::int64_t cleanLimit = logMetaDataBuffer.getInt64Volatile(LOG_CLEAN_LIMIT_OFFSET);
+    atomic::acquire();
+    if (logMetaDataBuffer.getInt32Volatile(LOG_SUBSCRIBER_POSITIONS_CHANGE_NUMBER_OFFSET) != changeNumber)
+    {
+        return limit;
+    }
+
+    return std::max(limit, std::min(minPosition + windowLength, cleanLimit));
+}
+
 inline static int indexByTerm(std::int32_t initialTermId, std::int32_t activeTermId) AERON_NOEXCEPT
 {
     return (activeTermId - initialTermId) % PARTITION_COUNT;
@@ -325,6 +439,101 @@ inline static bool casRawTail(
         TERM_TAIL_COUNTER_OFFSET + (partitionIndex * sizeof(std::int64_t)), expectedRawTail, updateRawTail);
 }
 
+inline static bool isSubscriberWakeup(AtomicBuffer& logMetaDataBuffer)
+{
+    return 1 == logMetaDataBuffer.getInt32(LOG_IS_SUBSCRIBER_WAKEUP_OFFSET);
+}
+
+/**
+ * Wake subscribers parked in {@link #awaitTailAbove()} after a publisher has advanced the tail. The waiter count is
+ * read with a locked add so it is ordered after the tail update and a parked subscriber either sees the new tail or is
+ * woken. No system call is made when nothing is waiting.
+ *
+ * @param logMetaDataBuffer of the log.
+ */
+inline static void signalSubscribers(AtomicBuffer& logMetaDataBuffer)
+{
+    if (logMetaDataBuffer.getAndAddInt32(LOG_SUBSCRIBER_WAITERS_OFFSET, 0) > 0)
+    {
+        logMetaDataBuffer.getAndAddInt32(LOG_SUBSCRIBER_WAKE_SEQUENCE_OFFSET, 1);
+#if defined(__linux__)
+        ::syscall(
+            SYS_futex,
+            logMetaDataBuffer.buffer() + LOG_SUBSCRIBER_WAKE_SEQUENCE_OFFSET,
+            FUTEX_WAKE,
+            INT_MAX,
+            nullptr,
+            nullptr,
+            0);
+#endif
+    }
+}
+
+/**
+ * Park the calling thread until a publisher advances the tail of the log beyond a position or the timeout expires.
+ * Publishers only wake parked subscribers when the driver enabled it for the log, otherwise this returns at once. On
+ * platforms without futexes the tail is polled at most once a millisecond.
+ *
+ * @param logMetaDataBuffer   of the log.
+ * @param position            the tail must exceed.
+ * @param positionBitsToShift for the term length of the log.
+ * @param initialTermId       of the log.
+ * @param timeoutNs           to wait at most.
+ * @return true if the tail is beyond the position, or the log does not wake subscribers.
+ */
+inline static bool awaitTailAbove(
+    AtomicBuffer& logMetaDataBuffer,
+    std::int64_t position,
+    std::int32_t positionBitsToShift,
+    std::int32_t initialTermId,
+    std::int64_t timeoutNs)
+{
+    const std::int64_t termLength = 1L << positionBitsToShift;
+    auto tailPosition =
+        [&]()
+        {
+            const std::int64_t rawTail = rawTailVolatile(logMetaDataBuffer);
+
+            return computeTermBeginPosition(termId(rawTail), positionBitsToShift, initialTermId) +
+                termOffset(rawTail, termLength);
+        };
+
+    if (!isSubscriberWakeup(logMetaDataBuffer) || tailPosition() > position)
+    {
+        return true;
+    }
+
+    logMetaDataBuffer.getAndAddInt32(LOG_SUBSCRIBER_WAITERS_OFFSET, 1);
+
+    const std::int32_t sequence = logMetaDataBuffer.getInt32Volatile(LOG_SUBSCRIBER_WAKE_SEQUENCE_OFFSET);
+    bool isAbove = tailPosition() > position;
+
+    if (!isAbove)
+    {
+#if defined(__linux__)
+        struct timespec timeout;
+        timeout.tv_sec = static_cast<time_t>(timeoutNs / 1000000000);
+        timeout.tv_nsec = static_cast<long>(timeoutNs % 1000000000);
+
+        ::syscall(
+            SYS_futex,
+            logMetaDataBuffer.buffer() + LOG_SUBSCRIBER_WAKE_SEQUENCE_OFFSET,
+            FUTEX_WAIT,
+            sequence,
+            &timeout,
+            nullptr,
+            0);
+#else
+        std::this_thread::sleep_for(std::chrono::nanoseconds(std::min<std::int64_t>(timeoutNs, 1000000)));
+#endif
+        isAbove = tailPosition() > position;
+    }
+
+    logMetaDataBuffer.getAndAddInt32(LOG_SUBSCRIBER_WAITERS_OFFSET, -1);
+
+    return isAbove;
+}
+
 inline static AtomicBuffer defaultFrameHeader(AtomicBuffer& logMetaDataBuffer)
 {
     std::uint8_t *header =
@@ -23,6 +23,7 @@
 #include "HeaderWriter.h"
 #include "LogBufferDescriptor.h"
 #include "BufferClaim.h"
+#include "FragmentedBufferClaim.h"
 #include "DataFrameHeader.h"
 
 namespace aeron { namespace concurrent { namespace logbuffer {
@@ -48,6 +49,78 @@ typedef std::function<std::int64_t(
 static const on_reserved_value_supplier_t DEFAULT_RESERVED_VALUE_SUPPLIER =
     [](AtomicBuffer&, util::index_t, util::index_t) -> std::int64_t { return 0; };
 
+/**
+ * Tag for appending without a reserved value supplier. The reserved value is set to 0 without a call being made, so the
+ * default offer path has no indirect dispatch per frame. Any other callable with the signature of
+ * on_reserved_value_supplier_t can be passed by type to the appenders and inlined.
+ */
+struct NoReservedValueSupplier
+{
+};
+
+template <typename ReservedValueSupplier> inline std::int64_t supplyReservedValue(
+    const ReservedValueSupplier& reservedValueSupplier,
+    AtomicBuffer& termBuffer,
+    util::index_t termOffset,
+    util::index_t length)
+{
+    return reservedValueSupplier(termBuffer, termOffset, length);
+}
+
+inline std::int64_t supplyReservedValue(const NoReservedValueSupplier&, AtomicBuffer&, util::index_t, util::index_t)
+{
+    return 0;
+}
+
+/**
+ * Length in the term of a message split into fragments of at most maxPayloadLength, including the frame headers.
+ */
+inline util::index_t computeFragmentedLength(util::index_t length, util::index_t maxPayloadLength)
+{
+    const int numMaxPayloads = length / maxPayloadLength;
+    const util::index_t remainingPayload = length % maxPayloadLength;
+    const util::index_t lastFrameLength = (remainingPayload > 0) ?
+        util::BitUtil::align(remainingPayload + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT) : 0;
+
+    return (numMaxPayloads * (maxPayloadLength + DataFrameHeader::LENGTH)) + lastFrameLength;
+}
+
+/**
+ * Write the uncommitted headers, with fragment flags, for a claimed fragmented message.
+ */
+template <typename HeaderWriterType> inline void writeFragmentHeaders(
+    AtomicBuffer& termBuffer,
+    const HeaderWriterType& header,
+    std::int32_t termOffset,
+    util::index_t length,
+    util::index_t maxPayloadLength,
+    std::int32_t termId)
+{
+    std::uint8_t flags = FrameDescriptor::BEGIN_FRAG;
+    util::index_t remaining = length;
+    std::int32_t frameOffset = termOffset;
+
+    do
+    {
+        const util::index_t bytesToWrite = std::min(remaining, maxPayloadLength);
+        const util::index_t frameLength = bytesToWrite + DataFrameHeader::LENGTH;
+
+        header.write(termBuffer, frameOffset, frameLength, termId);
+
+        if (remaining <= maxPayloadLength)
+        {
+            flags |= FrameDescriptor::END_FRAG;
+        }
+
+        FrameDescriptor::frameFlags(termBuffer, frameOffset, flags);
+
+        flags = 0;
+        frameOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+        remaining -= bytesToWrite;
+    }
+    while (remaining > 0);
+}
+
 class TermAppender
 {
 public:
@@ -105,12 +178,69 @@ public:
         return static_cast<std::int32_t>(resultingOffset);
     }
 
-    inline std::int32_t appendUnfragmentedMessage(
+    /**
+     * Reserve an aligned range of the term with a single increment of the tail, to be filled with frames later by one
+     * thread without atomics and released with padding.
+     *
+     * @return the resulting offset of the term after the range, the range begins alignedLength before it.
+     */
+    inline std::int32_t reserve(const HeaderWriter& header, util::index_t alignedLength, std::int32_t activeTermId)
+    {
+        const std::int64_t rawTail = getAndAddRawTail(alignedLength);
+        const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+        const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        checkTerm(activeTermId, termId);
+
+        std::int64_t resultingOffset = termOffset + alignedLength;
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termOffset, header, termLength, termId);
+        }
+
+        return static_cast<std::int32_t>(resultingOffset);
+    }
+
+    std::int32_t claimFragmented(
+        const HeaderWriter& header,
+        util::index_t length,
+        util::index_t maxPayloadLength,
+        FragmentedBufferClaim& bufferClaim,
+        std::int32_t activeTermId)
+    {
+        const util::index_t requiredLength = computeFragmentedLength(length, maxPayloadLength);
+        const std::int64_t rawTail = getAndAddRawTail(requiredLength);
+        const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+        const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        checkTerm(activeTermId, termId);
+
+        std::int64_t resultingOffset = termOffset + requiredLength;
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termOffset, header, termLength, termId);
+        }
+        else
+        {
+            writeFragmentHeaders(
+                m_termBuffer, header, static_cast<std::int32_t>(termOffset), length, maxPayloadLength, termId);
+            bufferClaim.wrap(
+                m_termBuffer, static_cast<std::int32_t>(termOffset), requiredLength, length, maxPayloadLength);
+        }
+
+        return static_cast<std::int32_t>(resultingOffset);
+    }
+
+    template <typename ReservedValueSupplier> inline std::int32_t appendUnfragmentedMessage(
         const HeaderWriter& header,
         AtomicBuffer& srcBuffer,
         util::index_t srcOffset,
         util::index_t length,
-        const on_reserved_value_supplier_t& reservedValueSupplier,
+        const ReservedValueSupplier& reservedValueSupplier,
         std::int32_t activeTermId)
     {
         const util::index_t frameLength = length + DataFrameHeader::LENGTH;
@@ -134,7 +264,8 @@ public:
             header.write(m_termBuffer, frameOffset, frameLength, termId);
             m_termBuffer.putBytes(frameOffset + DataFrameHeader::LENGTH, srcBuffer, srcOffset, length);
 
-            const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, frameOffset, frameLength);
+            const std::int64_t reservedValue =
+                supplyReservedValue(reservedValueSupplier, m_termBuffer, frameOffset, frameLength);
             m_termBuffer.putInt64(frameOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
             FrameDescriptor::frameLengthOrdered(m_termBuffer, frameOffset, frameLength);
@@ -143,11 +274,11 @@ public:
         return static_cast<std::int32_t>(resultingOffset);
     }
 
-    template <class BufferIterator> std::int32_t appendUnfragmentedMessage(
+    template <class BufferIterator, typename ReservedValueSupplier> std::int32_t appendUnfragmentedMessage(
         const HeaderWriter& header,
         BufferIterator bufferIt,
         util::index_t length,
-        const on_reserved_value_supplier_t& reservedValueSupplier,
+        const ReservedValueSupplier& reservedValueSupplier,
         std::int32_t activeTermId)
     {
         const util::index_t frameLength = length + DataFrameHeader::LENGTH;
@@ -179,7 +310,8 @@ public:
                 m_termBuffer.putBytes(offset, *bufferIt, 0, bufferIt->capacity());
             }
 
-            const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, frameOffset, frameLength);
+            const std::int64_t reservedValue =
+                supplyReservedValue(reservedValueSupplier, m_termBuffer, frameOffset, frameLength);
             m_termBuffer.putInt64(frameOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
             FrameDescriptor::frameLengthOrdered(m_termBuffer, frameOffset, frameLength);
@@ -188,13 +320,65 @@ public:
         return static_cast<std::int32_t>(resultingOffset);
     }
 
-    std::int32_t appendFragmentedMessage(
+    /**
+     * Append a batch of messages, one unfragmented frame per buffer, reserving the space for all of them with a single
+     * increment of the tail.
+     *
+     * @param batchLength sum of the aligned frame lengths of the messages in the batch.
+     */
+    template <class BufferIterator, typename ReservedValueSupplier> std::int32_t appendUnfragmentedBatch(
+        const HeaderWriter& header,
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        util::index_t batchLength,
+        const ReservedValueSupplier& reservedValueSupplier,
+        std::int32_t activeTermId)
+    {
+        const std::int64_t rawTail = getAndAddRawTail(batchLength);
+        const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+        const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        checkTerm(activeTermId, termId);
+
+        std::int64_t resultingOffset = termOffset + batchLength;
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termOffset, header, termLength, termId);
+        }
+        else
+        {
+            std::int32_t frameOffset = static_cast<std::int32_t>(termOffset);
+
+            for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+            {
+                const util::index_t length = it->capacity();
+                const util::index_t frameLength = length + DataFrameHeader::LENGTH;
+
+                header.write(m_termBuffer, frameOffset, frameLength, termId);
+                m_termBuffer.putBytes(frameOffset + DataFrameHeader::LENGTH, *it, 0, length);
+
+                const std::int64_t reservedValue =
+                    supplyReservedValue(reservedValueSupplier, m_termBuffer, frameOffset, frameLength);
+                m_termBuffer.putInt64(frameOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+                FrameDescriptor::frameLengthOrdered(m_termBuffer, frameOffset, frameLength);
+
+                frameOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+        }
+
+        return static_cast<std::int32_t>(resultingOffset);
+    }
+
+    template <typename ReservedValueSupplier> std::int32_t appendFragmentedMessage(
         const HeaderWriter& header,
         AtomicBuffer& srcBuffer,
         util::index_t srcOffset,
         util::index_t length,
         util::index_t maxPayloadLength,
-        const on_reserved_value_supplier_t& reservedValueSupplier,
+        const ReservedValueSupplier& reservedValueSupplier,
         std::int32_t activeTermId)
     {
         const int numMaxPayloads = length / maxPayloadLength;
@@ -243,7 +427,8 @@ public:
 
                 FrameDescriptor::frameFlags(m_termBuffer, frameOffset, flags);
 
-                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, frameOffset, frameLength);
+                const std::int64_t reservedValue =
+                    supplyReservedValue(reservedValueSupplier, m_termBuffer, frameOffset, frameLength);
                 m_termBuffer.putInt64(frameOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
                 FrameDescriptor::frameLengthOrdered(m_termBuffer, frameOffset, frameLength);
@@ -258,12 +443,12 @@ public:
         return static_cast<std::int32_t>(resultingOffset);
     }
 
-    template <class BufferIterator> std::int32_t appendFragmentedMessage(
+    template <class BufferIterator, typename ReservedValueSupplier> std::int32_t appendFragmentedMessage(
         const HeaderWriter& header,
         BufferIterator bufferIt,
         util::index_t length,
         util::index_t maxPayloadLength,
-        const on_reserved_value_supplier_t& reservedValueSupplier,
+        const ReservedValueSupplier& reservedValueSupplier,
         std::int32_t activeTermId)
     {
         const int numMaxPayloads = length / maxPayloadLength;
@@ -328,7 +513,8 @@ public:
 
                 FrameDescriptor::frameFlags(m_termBuffer, frameOffset, flags);
 
-                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, frameOffset, frameLength);
+                const std::int64_t reservedValue =
+                    supplyReservedValue(reservedValueSupplier, m_termBuffer, frameOffset, frameLength);
                 m_termBuffer.putInt64(frameOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
                 FrameDescriptor::frameLengthOrdered(m_termBuffer, frameOffset, frameLength);
@@ -18,6 +18,7 @@
 #define AERON_TERMBLOCKSCANNER_H
 
 #include <functional>
+#include <vector>
 #include <util/Index.h>
 #include <concurrent/AtomicBuffer.h>
 #include "LogBufferDescriptor.h"
@@ -41,6 +42,16 @@ typedef std::function<void(
     std::int32_t sessionId,
     std::int32_t termId)> block_handler_t;
 
+/**
+ * A frame of a block as found by TermBlockScanner::scan while walking to the end of the block, so a handler can
+ * forward or index the frames of a block without walking it again.
+ */
+struct BlockFrame
+{
+    std::int32_t termOffset;
+    std::int32_t frameLength;
+};
+
 namespace TermBlockScanner {
 
 inline std::int32_t scan(AtomicBuffer& termBuffer, std::int32_t offset, std::int32_t limit)
@@ -71,6 +82,40 @@ inline std::int32_t scan(AtomicBuffer& termBuffer, std::int32_t offset, std::int
     return offset;
 }
 
+/**
+ * Scan a block as scan(AtomicBuffer&, std::int32_t, std::int32_t) does and record each of its frames, including
+ * padding frames, in frames which is cleared first.
+ * <p>
+ * Finding the end of a block is a chain of dependent loads, each frame length giving the offset of the next, so it
+ * does not vectorise; recording the frames as they are passed makes the walk the only parse of the block.
+ */
+inline std::int32_t scan(
+    AtomicBuffer& termBuffer, std::int32_t offset, std::int32_t limit, std::vector<BlockFrame>& frames)
+{
+    frames.clear();
+
+    do
+    {
+        const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+        if (frameLength <= 0)
+        {
+            break;
+        }
+
+        const std::int32_t alignedFrameLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+        if (offset + alignedFrameLength > limit)
+        {
+            break;
+        }
+
+        frames.push_back({ offset, frameLength });
+        offset += alignedFrameLength;
+    }
+    while (offset < limit);
+
+    return offset;
+}
+
 }
 
 }}}
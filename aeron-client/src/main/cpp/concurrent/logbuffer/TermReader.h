@@ -18,7 +18,9 @@
 #define INCLUDED_AERON_CONCURRENT_LOGBUFFER_TERM_READER__
 
 #include <functional>
+#include <algorithm>
 #include <util/Index.h>
+#include <util/MacroUtil.h>
 #include <concurrent/AtomicBuffer.h>
 #include "LogBufferDescriptor.h"
 #include "Header.h"
@@ -64,24 +66,50 @@ struct ReadOutcome
     int fragmentsRead;
 };
 
-template <typename F>
+/**
+ * Read fragments from termOffset until fragmentsLimit fragments have been read or a fragment would start at or beyond
+ * limitOffset. A frame starting before limitOffset is always read whole.
+ *
+ * With PrefetchLines greater than 0 the cache lines up to PrefetchLines ahead of the frame being read are prefetched
+ * so frame headers and payloads arriving at a high rate are already in cache when the handler reaches them.
+ *
+ * Exceptions thrown by the handler are passed to exceptionHandler, unless built with AERON_NOEXCEPT_HOT_PATH in which
+ * case no exception handling code is emitted on the read path and the handler must not throw.
+ */
+template <int PrefetchLines = 0, typename F>
 inline void read(
     ReadOutcome& outcome,
     AtomicBuffer& termBuffer,
     std::int32_t termOffset,
     F&& handler,
     int fragmentsLimit,
+    std::int32_t limitOffset,
     Header& header,
-    const exception_handler_t & exceptionHandler)
+    const exception_handler_t & exceptionHandler) AERON_HOT_PATH_NOEXCEPT
 {
     outcome.fragmentsRead = 0;
     outcome.offset = termOffset;
-    const util::index_t capacity = termBuffer.capacity();
+    const util::index_t limit = std::min(limitOffset, termBuffer.capacity());
+    const util::index_t prefetchDistance = PrefetchLines * static_cast<util::index_t>(util::BitUtil::CACHE_LINE_LENGTH);
+    util::index_t prefetchOffset = termOffset;
 
+#if !defined(AERON_NOEXCEPT_HOT_PATH)
     try
     {
+#endif
         do
         {
+            if (PrefetchLines > 0)
+            {
+                const util::index_t prefetchLimit = std::min(termOffset + prefetchDistance, limit);
+
+                for (; prefetchOffset < prefetchLimit;
+                    prefetchOffset += static_cast<util::index_t>(util::BitUtil::CACHE_LINE_LENGTH))
+                {
+                    AERON_PREFETCH(termBuffer.buffer() + prefetchOffset);
+                }
+            }
+
             const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, termOffset);
             if (frameLength <= 0)
             {
@@ -101,16 +129,266 @@ inline void read(
                 ++outcome.fragmentsRead;
             }
         }
+        while (outcome.fragmentsRead < fragmentsLimit && termOffset < limit);
+#if !defined(AERON_NOEXCEPT_HOT_PATH)
+    }
+    catch (const std::exception& ex)
+    {
+        exceptionHandler(ex);
+    }
+#endif
+
+    outcome.offset = termOffset;
+}
+
+/**
+ * Read fragments from termOffset as for read, handing each to the handler as a pointer to its payload, the payload
+ * length and a pointer to its frame header in the term, with no Header to rebind per fragment. Fields such as the
+ * position are only computed if the handler reads them from the frame header.
+ */
+template <typename F>
+inline void rawRead(
+    ReadOutcome& outcome,
+    AtomicBuffer& termBuffer,
+    std::int32_t termOffset,
+    F&& handler,
+    int fragmentsLimit,
+    const exception_handler_t & exceptionHandler) AERON_HOT_PATH_NOEXCEPT
+{
+    outcome.fragmentsRead = 0;
+    outcome.offset = termOffset;
+    const util::index_t capacity = termBuffer.capacity();
+    std::uint8_t *const term = termBuffer.buffer();
+
+#if !defined(AERON_NOEXCEPT_HOT_PATH)
+    try
+    {
+#endif
+        do
+        {
+            const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, termOffset);
+            if (frameLength <= 0)
+            {
+                break;
+            }
+
+            const std::int32_t fragmentOffset = termOffset;
+            termOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+            const DataFrameHeader::DataFrameHeaderDefn *frameHeader =
+                reinterpret_cast<const DataFrameHeader::DataFrameHeaderDefn *>(term + fragmentOffset);
+
+            if (DataFrameHeader::HDR_TYPE_PAD != frameHeader->type)
+            {
+                handler(term + fragmentOffset + DataFrameHeader::LENGTH, frameLength - DataFrameHeader::LENGTH,
+                    frameHeader);
+
+                ++outcome.fragmentsRead;
+            }
+        }
+        while (outcome.fragmentsRead < fragmentsLimit && termOffset < capacity);
+#if !defined(AERON_NOEXCEPT_HOT_PATH)
+    }
+    catch (const std::exception& ex)
+    {
+        exceptionHandler(ex);
+    }
+#endif
+
+    outcome.offset = termOffset;
+}
+
+/**
+ * Read fragments from termOffset as for read while passing over the messages the filter rejects without calling the
+ * handler or counting them against fragmentsLimit, so only the frame header and the bytes the filter tests are read
+ * for a rejected message. The filter is tested on the first fragment of a message and the other fragments follow it,
+ * with isSkippingMessage carrying the decision for a message whose fragments span reads.
+ */
+template <typename F, typename M>
+inline void filteredRead(
+    ReadOutcome& outcome,
+    AtomicBuffer& termBuffer,
+    std::int32_t termOffset,
+    M&& filter,
+    F&& handler,
+    int fragmentsLimit,
+    bool& isSkippingMessage,
+    Header& header,
+    const exception_handler_t & exceptionHandler) AERON_HOT_PATH_NOEXCEPT
+{
+    outcome.fragmentsRead = 0;
+    outcome.offset = termOffset;
+    const util::index_t capacity = termBuffer.capacity();
+
+#if !defined(AERON_NOEXCEPT_HOT_PATH)
+    try
+    {
+#endif
+        do
+        {
+            const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, termOffset);
+            if (frameLength <= 0)
+            {
+                break;
+            }
+
+            const std::int32_t fragmentOffset = termOffset;
+            termOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+            if (!FrameDescriptor::isPaddingFrame(termBuffer, fragmentOffset))
+            {
+                header.buffer(termBuffer);
+                header.offset(fragmentOffset);
+
+                const util::index_t offset = fragmentOffset + DataFrameHeader::LENGTH;
+                const util::index_t length = frameLength - DataFrameHeader::LENGTH;
+
+                if (header.flags() & FrameDescriptor::BEGIN_FRAG)
+                {
+                    isSkippingMessage = !filter.matches(termBuffer, offset, length, header);
+                }
+
+                if (!isSkippingMessage)
+                {
+                    handler(termBuffer, offset, length, header);
+                    ++outcome.fragmentsRead;
+                }
+            }
+        }
         while (outcome.fragmentsRead < fragmentsLimit && termOffset < capacity);
+#if !defined(AERON_NOEXCEPT_HOT_PATH)
+    }
+    catch (const std::exception& ex)
+    {
+        exceptionHandler(ex);
+    }
+#endif
+
+    outcome.offset = termOffset;
+}
+
+/**
+ * Read fragments from termOffset as for read from a term whose length is known at compile time, so the loop is bound
+ * by a constant rather than by the capacity of the buffer, which must be TermLength.
+ */
+template <std::int32_t TermLength, typename F>
+inline void fixedLengthRead(
+    ReadOutcome& outcome,
+    AtomicBuffer& termBuffer,
+    std::int32_t termOffset,
+    F&& handler,
+    int fragmentsLimit,
+    Header& header,
+    const exception_handler_t & exceptionHandler) AERON_HOT_PATH_NOEXCEPT
+{
+    outcome.fragmentsRead = 0;
+    outcome.offset = termOffset;
+
+#if !defined(AERON_NOEXCEPT_HOT_PATH)
+    try
+    {
+#endif
+        do
+        {
+            const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, termOffset);
+            if (frameLength <= 0)
+            {
+                break;
+            }
+
+            const std::int32_t fragmentOffset = termOffset;
+            termOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+            if (!FrameDescriptor::isPaddingFrame(termBuffer, fragmentOffset))
+            {
+                header.buffer(termBuffer);
+                header.offset(fragmentOffset);
+                handler(termBuffer, fragmentOffset + DataFrameHeader::LENGTH, frameLength - DataFrameHeader::LENGTH,
+                    header);
+
+                ++outcome.fragmentsRead;
+            }
+        }
+        while (outcome.fragmentsRead < fragmentsLimit && termOffset < TermLength);
+#if !defined(AERON_NOEXCEPT_HOT_PATH)
+    }
+    catch (const std::exception& ex)
+    {
+        exceptionHandler(ex);
+    }
+#endif
+
+    outcome.offset = termOffset;
+}
+
+/**
+ * Read fragments from termOffset as for rawRead from a term whose length is known at compile time, so the loop is
+ * bound by a constant rather than by the capacity of the buffer, which must be TermLength.
+ */
+template <std::int32_t TermLength, typename F>
+inline void fixedLengthRawRead(
+    ReadOutcome& outcome,
+    AtomicBuffer& termBuffer,
+    std::int32_t termOffset,
+    F&& handler,
+    int fragmentsLimit,
+    const exception_handler_t & exceptionHandler) AERON_HOT_PATH_NOEXCEPT
+{
+    outcome.fragmentsRead = 0;
+    outcome.offset = termOffset;
+    std::uint8_t *const term = termBuffer.buffer();
+
+#if !defined(AERON_NOEXCEPT_HOT_PATH)
+    try
+    {
+#endif
+        do
+        {
+            const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, termOffset);
+            if (frameLength <= 0)
+            {
+                break;
+            }
+
+            const std::int32_t fragmentOffset = termOffset;
+            termOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+            const DataFrameHeader::DataFrameHeaderDefn *frameHeader =
+                reinterpret_cast<const DataFrameHeader::DataFrameHeaderDefn *>(term + fragmentOffset);
+
+            if (DataFrameHeader::HDR_TYPE_PAD != frameHeader->type)
+            {
+                handler(term + fragmentOffset + DataFrameHeader::LENGTH, frameLength - DataFrameHeader::LENGTH,
+                    frameHeader);
+
+                ++outcome.fragmentsRead;
+            }
+        }
+        while (outcome.fragmentsRead < fragmentsLimit && termOffset < TermLength);
+#if !defined(AERON_NOEXCEPT_HOT_PATH)
     }
     catch (const std::exception& ex)
     {
         exceptionHandler(ex);
     }
+#endif
 
     outcome.offset = termOffset;
 }
 
+template <typename F>
+inline void read(
+    ReadOutcome& outcome,
+    AtomicBuffer& termBuffer,
+    std::int32_t termOffset,
+    F&& handler,
+    int fragmentsLimit,
+    Header& header,
+    const exception_handler_t & exceptionHandler) AERON_HOT_PATH_NOEXCEPT
+{
+    read(outcome, termBuffer, termOffset, handler, fragmentsLimit, termBuffer.capacity(), header, exceptionHandler);
+}
+
 }
 
 }}}
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_CONCURRENT_LOGBUFFER_TERM_RESERVATION__
+#define INCLUDED_AERON_CONCURRENT_LOGBUFFER_TERM_RESERVATION__
+
+#include <util/Index.h>
+#include <util/Exceptions.h>
+#include <concurrent/AtomicBuffer.h>
+#include "TermAppender.h"
+
+namespace aeron { namespace concurrent { namespace logbuffer {
+
+/**
+ * A range of a term reserved by one publishing thread with a single increment of the shared tail. Messages are then
+ * appended into it as unfragmented frames without atomic operations on the tail, and {@link #release()} fills what is
+ * left with padding.
+ * <p>
+ * Subscribers cannot read past a frame that has not been written yet, so a reservation should be released as soon as
+ * the thread has nothing more to send. A reservation left unreleased eventually gets unblocked by the driver. Each
+ * thread must use its own reservation, they are not threadsafe.
+ */
+class TermReservation
+{
+public:
+    typedef TermReservation this_t;
+
+    inline TermReservation()
+    {
+    }
+
+    /// @cond HIDDEN_SYMBOLS
+    inline void wrap(
+        AtomicBuffer& termBuffer,
+        const HeaderWriter& header,
+        std::int32_t termId,
+        std::int32_t termOffset,
+        std::int32_t limitOffset,
+        util::index_t maxPayloadLength,
+        std::int64_t termBeginPosition)
+    {
+        m_termBuffer.wrap(termBuffer);
+        m_header = &header;
+        m_termId = termId;
+        m_offset = termOffset;
+        m_limit = limitOffset;
+        m_maxPayloadLength = maxPayloadLength;
+        m_termBeginPosition = termBeginPosition;
+    }
+    /// @endcond
+
+    /**
+     * Is the reservation holding unreleased space in the term.
+     *
+     * @return true if the reservation has been made and not yet released.
+     */
+    inline bool isActive() const
+    {
+        return nullptr != m_header;
+    }
+
+    /**
+     * Space left in the reservation, including frame headers.
+     *
+     * @return bytes left in the reservation.
+     */
+    inline util::index_t remaining() const
+    {
+        return m_limit - m_offset;
+    }
+
+    /**
+     * The stream position after the last frame appended to the reservation.
+     *
+     * @return position after the last frame appended.
+     */
+    inline std::int64_t position() const
+    {
+        return m_termBeginPosition + m_offset;
+    }
+
+    /**
+     * Append a message as an unfragmented frame at the next offset of the reservation.
+     *
+     * @param srcBuffer             containing the message.
+     * @param srcOffset             at which the message begins.
+     * @param length                of the message, at most the max payload length of the publication.
+     * @param reservedValueSupplier for the frame.
+     * @return true if the message was appended or false if the reservation does not have room for it.
+     */
+    template <typename ReservedValueSupplier = NoReservedValueSupplier> inline bool append(
+        AtomicBuffer& srcBuffer,
+        util::index_t srcOffset,
+        util::index_t length,
+        const ReservedValueSupplier& reservedValueSupplier = ReservedValueSupplier())
+    {
+        if (length > m_maxPayloadLength)
+        {
+            throw util::IllegalStateException(
+                util::strPrintf("Encoded message exceeds maxPayloadLength of %d, length=%d",
+                    m_maxPayloadLength, length), SOURCEINFO);
+        }
+
+        const util::index_t frameLength = length + DataFrameHeader::LENGTH;
+        const util::index_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+        if (!isActive() || alignedLength > remaining())
+        {
+            return false;
+        }
+
+        m_header->write(m_termBuffer, m_offset, frameLength, m_termId);
+        m_termBuffer.putBytes(m_offset + DataFrameHeader::LENGTH, srcBuffer, srcOffset, length);
+
+        const std::int64_t reservedValue =
+            supplyReservedValue(reservedValueSupplier, m_termBuffer, m_offset, frameLength);
+        m_termBuffer.putInt64(m_offset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+        FrameDescriptor::frameLengthOrdered(m_termBuffer, m_offset, frameLength);
+
+        m_offset += alignedLength;
+
+        return true;
+    }
+
+    /**
+     * Release the reservation, writing a padding frame over the space not used so subscribers can move past it.
+     */
+    inline void release()
+    {
+        if (isActive() && m_offset < m_limit)
+        {
+            const util::index_t paddingLength = m_limit - m_offset;
+
+            m_header->write(m_termBuffer, m_offset, paddingLength, m_termId);
+            FrameDescriptor::frameType(m_termBuffer, m_offset, DataFrameHeader::HDR_TYPE_PAD);
+            FrameDescriptor::frameLengthOrdered(m_termBuffer, m_offset, paddingLength);
+        }
+
+        m_offset = m_limit;
+        m_header = nullptr;
+    }
+
+private:
+    AtomicBuffer m_termBuffer;
+    const HeaderWriter *m_header = nullptr;
+    std::int32_t m_termId = 0;
+    std::int32_t m_offset = 0;
+    std::int32_t m_limit = 0;
+    util::index_t m_maxPayloadLength = 0;
+    std::int64_t m_termBeginPosition = 0;
+};
+
+}}}
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_FLOWCONTROLTRACEDESCRIPTOR_H
+#define AERON_FLOWCONTROLTRACEDESCRIPTOR_H
+
+#include <cstddef>
+#include <util/Index.h>
+#include <util/BitUtil.h>
+
+namespace aeron {
+
+namespace concurrent {
+
+namespace reports {
+
+/**
+ * Layout of the ring of sender and publication limit changes the media driver traces to flow-control-trace.dat when
+ * its flow control trace buffer length is set. A header holding the record capacity and the count of records claimed
+ * so far is followed by a power of two number of fixed length records, each complete when its sequence is its index
+ * in the ring plus one.
+ */
+namespace FlowControlTraceDescriptor {
+
+#pragma pack(push)
+#pragma pack(4)
+struct RecordDefn
+{
+    std::int64_t sequence;
+    std::int64_t timestampNs;
+    std::int64_t registrationId;
+    std::int64_t limit;
+    std::int64_t position;
+    std::int64_t causeId;
+    std::int32_t sessionId;
+    std::int32_t streamId;
+    std::int32_t eventType;
+    std::int32_t cause;
+};
+#pragma pack(pop)
+
+static const util::index_t RECORD_CAPACITY_OFFSET = 0;
+static const util::index_t TAIL_OFFSET = util::BitUtil::CACHE_LINE_LENGTH;
+static const util::index_t HEADER_LENGTH = 2 * util::BitUtil::CACHE_LINE_LENGTH;
+static const util::index_t RECORD_LENGTH = sizeof(RecordDefn);
+static const util::index_t SEQUENCE_OFFSET = offsetof(RecordDefn, sequence);
+
+static const std::int32_t EVENT_SND_LMT = 1;
+static const std::int32_t EVENT_PUB_LMT = 2;
+
+static const std::int32_t CAUSE_RECEIVER = 1;
+static const std::int32_t CAUSE_SENDER = 2;
+static const std::int32_t CAUSE_SUBSCRIBER = 3;
+static const std::int32_t CAUSE_CLEANING = 4;
+
+}
+
+}}}
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_FLOWCONTROLTRACEREADER_H
+#define AERON_FLOWCONTROLTRACEREADER_H
+
+#include <functional>
+#include <util/Index.h>
+#include <concurrent/AtomicBuffer.h>
+#include "FlowControlTraceDescriptor.h"
+
+namespace aeron {
+
+namespace concurrent {
+
+namespace reports {
+
+namespace FlowControlTraceReader {
+
+typedef std::function<void(const FlowControlTraceDescriptor::RecordDefn& record)> record_consumer_t;
+
+/**
+ * Read the complete records still in the ring from oldest to newest. A record overwritten while it is read is
+ * skipped.
+ *
+ * @return the number of records read.
+ */
+inline static int read(AtomicBuffer& buffer, const record_consumer_t &consumer)
+{
+    using namespace FlowControlTraceDescriptor;
+
+    if (buffer.capacity() < HEADER_LENGTH)
+    {
+        return 0;
+    }
+
+    const std::int64_t recordCapacity = buffer.getInt64Volatile(RECORD_CAPACITY_OFFSET);
+    const std::int64_t tail = buffer.getInt64Volatile(TAIL_OFFSET);
+
+    if (recordCapacity <= 0 || buffer.capacity() < HEADER_LENGTH + (recordCapacity * RECORD_LENGTH))
+    {
+        return 0;
+    }
+
+    int records = 0;
+
+    for (std::int64_t index = tail > recordCapacity ? tail - recordCapacity : 0; index < tail; index++)
+    {
+        const util::index_t offset =
+            HEADER_LENGTH + static_cast<util::index_t>(index & (recordCapacity - 1)) * RECORD_LENGTH;
+
+        if (buffer.getInt64Volatile(offset + SEQUENCE_OFFSET) != index + 1)
+        {
+            continue;
+        }
+
+        const RecordDefn record = buffer.overlayStruct<RecordDefn>(offset);
+
+        if (buffer.getInt64Volatile(offset + SEQUENCE_OFFSET) != index + 1)
+        {
+            continue;
+        }
+
+        ++records;
+        consumer(record);
+    }
+
+    return records;
+}
+
+}
+
+}}}
+
+#endif
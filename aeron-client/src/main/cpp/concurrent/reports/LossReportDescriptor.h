@@ -0,0 +1,122 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AERON_LOSSREPORTDESCRIPTOR_H
+#define AERON_LOSSREPORTDESCRIPTOR_H
+
+#include <cstddef>
+#include <util/Index.h>
+#include <util/BitUtil.h>
+
+namespace aeron {
+
+namespace concurrent {
+
+namespace reports {
+
+/**
+ * Layout of the loss report written by the media driver to loss-report.dat. Each entry is a cumulative record of
+ * loss for an image followed by a ring of fixed interval loss and retransmit request samples written by the receiver.
+ *
+ * <pre>
+ *   0                   1                   2                   3
+ *   0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ *  +---------------------------------------------------------------+
+ *  |                    Observation Count                          |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                     Total Bytes Lost                          |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |               Last Observation Timestamp                      |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |              First Observation Timestamp                      |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                         Session ID                            |
+ *  +---------------------------------------------------------------+
+ *  |                         Stream ID                             |
+ *  +---------------------------------------------------------------+
+ *  |                 Channel encoded in US-ASCII                  ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
+ *  |                  Source encoded in US-ASCII                  ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
+ *  |        Rate samples, aligned to RATE_SERIES_ALIGNMENT        ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
+ * </pre>
+ */
+namespace LossReportDescriptor {
+
+#pragma pack(push)
+#pragma pack(4)
+struct LossReportEntryDefn
+{
+    std::int64_t observationCount;
+    std::int64_t totalBytesLost;
+    std::int64_t lastObservationTimestamp;
+    std::int64_t firstObservationTimestamp;
+    std::int32_t sessionId;
+    std::int32_t streamId;
+};
+
+struct RateSampleDefn
+{
+    std::int64_t timestamp;
+    std::int64_t lossObservations;
+    std::int64_t bytesLost;
+    std::int64_t naksSent;
+};
+
+struct RateSeriesHeaderDefn
+{
+    std::int64_t sampleIntervalMs;
+    std::int64_t sampleCapacity;
+};
+#pragma pack(pop)
+
+static const util::index_t OBSERVATION_COUNT_OFFSET = offsetof(LossReportEntryDefn, observationCount);
+static const util::index_t CHANNEL_OFFSET = sizeof(LossReportEntryDefn);
+
+static const util::index_t ENTRY_ALIGNMENT = util::BitUtil::CACHE_LINE_LENGTH;
+static const util::index_t RATE_SERIES_ALIGNMENT = sizeof(std::int64_t);
+static const util::index_t RATE_SAMPLE_CAPACITY = 128;
+
+static const util::index_t RATE_SAMPLE_TIMESTAMP_OFFSET = offsetof(RateSampleDefn, timestamp);
+static const util::index_t RATE_SAMPLE_LOSS_OBSERVATIONS_OFFSET = offsetof(RateSampleDefn, lossObservations);
+static const util::index_t RATE_SAMPLE_BYTES_LOST_OFFSET = offsetof(RateSampleDefn, bytesLost);
+static const util::index_t RATE_SAMPLE_NAKS_SENT_OFFSET = offsetof(RateSampleDefn, naksSent);
+
+inline static util::index_t rateSeriesOffset(std::int32_t channelLength, std::int32_t sourceLength)
+{
+    return util::BitUtil::align(
+        static_cast<util::index_t>(sizeof(LossReportEntryDefn) + (2 * sizeof(std::int32_t)) + channelLength + sourceLength),
+        RATE_SERIES_ALIGNMENT);
+}
+
+inline static util::index_t recordLength(std::int32_t channelLength, std::int32_t sourceLength)
+{
+    return rateSeriesOffset(channelLength, sourceLength) +
+        static_cast<util::index_t>(sizeof(RateSeriesHeaderDefn) + (RATE_SAMPLE_CAPACITY * sizeof(RateSampleDefn)));
+}
+
+}
+
+}}}
+
+#endif
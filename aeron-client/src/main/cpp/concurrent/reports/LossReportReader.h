@@ -0,0 +1,171 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AERON_LOSSREPORTREADER_H
+#define AERON_LOSSREPORTREADER_H
+
+#include <functional>
+#include <util/Index.h>
+#include <concurrent/AtomicBuffer.h>
+#include <util/BitUtil.h>
+#include "LossReportDescriptor.h"
+
+namespace aeron {
+
+namespace concurrent {
+
+namespace reports {
+
+namespace LossReportReader {
+
+typedef std::function<void(
+    std::int64_t observationCount,
+    std::int64_t totalBytesLost,
+    std::int64_t firstObservationTimestamp,
+    std::int64_t lastObservationTimestamp,
+    std::int32_t sessionId,
+    std::int32_t streamId,
+    const std::string &channel,
+    const std::string &source)> entry_consumer_t;
+
+typedef std::function<void(
+    std::int32_t sessionId,
+    std::int32_t streamId,
+    std::int64_t sampleIntervalMs,
+    std::int64_t timestamp,
+    std::int64_t lossObservations,
+    std::int64_t bytesLost,
+    std::int64_t naksSent)> rate_sample_consumer_t;
+
+template <typename F>
+inline static int forEachEntry(AtomicBuffer& buffer, F&& func)
+{
+    int entries = 0;
+    util::index_t offset = 0;
+    const util::index_t capacity = buffer.capacity();
+
+    while (offset < capacity)
+    {
+        const std::int64_t observationCount =
+            buffer.getInt64Volatile(offset + LossReportDescriptor::OBSERVATION_COUNT_OFFSET);
+        if (observationCount <= 0)
+        {
+            break;
+        }
+
+        ++entries;
+
+        const util::index_t channelOffset = offset + LossReportDescriptor::CHANNEL_OFFSET;
+        const std::int32_t channelLength = buffer.getInt32(channelOffset);
+        const util::index_t sourceOffset = channelOffset + static_cast<util::index_t>(sizeof(std::int32_t)) + channelLength;
+        const std::int32_t sourceLength = buffer.getInt32(sourceOffset);
+
+        func(offset, channelOffset, channelLength, sourceOffset, sourceLength);
+
+        offset += util::BitUtil::align(
+            LossReportDescriptor::recordLength(channelLength, sourceLength), LossReportDescriptor::ENTRY_ALIGNMENT);
+    }
+
+    return entries;
+}
+
+inline static int read(AtomicBuffer& buffer, const entry_consumer_t &consumer)
+{
+    return forEachEntry(
+        buffer,
+        [&](
+            util::index_t offset,
+            util::index_t channelOffset,
+            std::int32_t channelLength,
+            util::index_t sourceOffset,
+            std::int32_t sourceLength)
+        {
+            LossReportDescriptor::LossReportEntryDefn& entry =
+                buffer.overlayStruct<LossReportDescriptor::LossReportEntryDefn>(offset);
+
+            consumer(
+                entry.observationCount,
+                entry.totalBytesLost,
+                entry.firstObservationTimestamp,
+                entry.lastObservationTimestamp,
+                entry.sessionId,
+                entry.streamId,
+                buffer.getString(channelOffset),
+                buffer.getString(sourceOffset));
+        });
+}
+
+/**
+ * Read the complete rate samples of every entry, in slot order. Samples are only present for intervals with loss.
+ *
+ * @return the number of samples read.
+ */
+inline static int readRateSamples(AtomicBuffer& buffer, const rate_sample_consumer_t &consumer)
+{
+    int samples = 0;
+
+    forEachEntry(
+        buffer,
+        [&](
+            util::index_t offset,
+            util::index_t channelOffset,
+            std::int32_t channelLength,
+            util::index_t sourceOffset,
+            std::int32_t sourceLength)
+        {
+            LossReportDescriptor::LossReportEntryDefn& entry =
+                buffer.overlayStruct<LossReportDescriptor::LossReportEntryDefn>(offset);
+            const util::index_t seriesOffset = offset + LossReportDescriptor::rateSeriesOffset(channelLength, sourceLength);
+            LossReportDescriptor::RateSeriesHeaderDefn& series =
+                buffer.overlayStruct<LossReportDescriptor::RateSeriesHeaderDefn>(seriesOffset);
+            const util::index_t samplesOffset =
+                seriesOffset + static_cast<util::index_t>(sizeof(LossReportDescriptor::RateSeriesHeaderDefn));
+
+            for (util::index_t i = 0; i < LossReportDescriptor::RATE_SAMPLE_CAPACITY; i++)
+            {
+                const util::index_t sampleOffset =
+                    samplesOffset + (i * static_cast<util::index_t>(sizeof(LossReportDescriptor::RateSampleDefn)));
+
+                const std::int64_t timestamp =
+                    buffer.getInt64Volatile(sampleOffset + LossReportDescriptor::RATE_SAMPLE_TIMESTAMP_OFFSET);
+                const std::int64_t lossObservations =
+                    buffer.getInt64Volatile(sampleOffset + LossReportDescriptor::RATE_SAMPLE_LOSS_OBSERVATIONS_OFFSET);
+                const std::int64_t bytesLost =
+                    buffer.getInt64Volatile(sampleOffset + LossReportDescriptor::RATE_SAMPLE_BYTES_LOST_OFFSET);
+                const std::int64_t naksSent =
+                    buffer.getInt64Volatile(sampleOffset + LossReportDescriptor::RATE_SAMPLE_NAKS_SENT_OFFSET);
+
+                if (0 != timestamp &&
+                    timestamp == buffer.getInt64Volatile(sampleOffset + LossReportDescriptor::RATE_SAMPLE_TIMESTAMP_OFFSET))
+                {
+                    ++samples;
+                    consumer(
+                        entry.sessionId,
+                        entry.streamId,
+                        series.sampleIntervalMs,
+                        timestamp,
+                        lossObservations,
+                        bytesLost,
+                        naksSent);
+                }
+            }
+        });
+
+    return samples;
+}
+
+}}}}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_POSITIONSNAPSHOTDESCRIPTOR_H
+#define AERON_POSITIONSNAPSHOTDESCRIPTOR_H
+
+#include <cstdint>
+#include <util/Index.h>
+#include <util/BitUtil.h>
+
+namespace aeron {
+
+namespace concurrent {
+
+namespace reports {
+
+/**
+ * Layout of position-snapshot.dat, written by the media driver when its position snapshot capacity is set. A header
+ * is followed by a section for each sender then each receiver, each a section header and then columns of
+ * SECTION_CAPACITY entries: registration id, position, high water mark and limit as int64 and session id and stream id
+ * as int32. The agent owning a section rewrites it once per duty cycle with the sequence odd while it writes, so a
+ * section read with the same even sequence before and after holds positions from the same moment.
+ */
+namespace PositionSnapshotDescriptor {
+
+static const util::index_t SECTION_COUNT_OFFSET = 0;
+static const util::index_t SECTION_CAPACITY_OFFSET = 4;
+static const util::index_t SENDER_COUNT_OFFSET = 8;
+static const util::index_t HEADER_LENGTH = util::BitUtil::CACHE_LINE_LENGTH;
+
+static const util::index_t SECTION_SEQUENCE_OFFSET = 0;
+static const util::index_t SECTION_TIMESTAMP_OFFSET = 8;
+static const util::index_t SECTION_LENGTH_OFFSET = 16;
+static const util::index_t SECTION_KIND_OFFSET = 20;
+static const util::index_t SECTION_HEADER_LENGTH = util::BitUtil::CACHE_LINE_LENGTH;
+
+/** Section of a sender: sender position, producer position and sender limit of each network publication. */
+static const std::int32_t KIND_SENDER = 1;
+/** Section of a receiver: receiver position, high water mark and window edge last sent of each image. */
+static const std::int32_t KIND_RECEIVER = 2;
+
+inline static util::index_t sectionLength(std::int32_t sectionCapacity)
+{
+    const util::index_t entryLength =
+        static_cast<util::index_t>((4 * sizeof(std::int64_t)) + (2 * sizeof(std::int32_t)));
+
+    return util::BitUtil::align(
+        SECTION_HEADER_LENGTH + (sectionCapacity * entryLength),
+        static_cast<util::index_t>(util::BitUtil::CACHE_LINE_LENGTH));
+}
+
+inline static util::index_t sectionOffset(std::int32_t sectionCapacity, std::int32_t index)
+{
+    return HEADER_LENGTH + index * sectionLength(sectionCapacity);
+}
+
+}
+
+}}}
+
+#endif
@@ -0,0 +1,130 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_POSITIONSNAPSHOTREADER_H
+#define AERON_POSITIONSNAPSHOTREADER_H
+
+#include <cstdint>
+#include <vector>
+#include <util/Index.h>
+#include <concurrent/AtomicBuffer.h>
+#include "PositionSnapshotDescriptor.h"
+
+namespace aeron {
+
+namespace concurrent {
+
+namespace reports {
+
+namespace PositionSnapshotReader {
+
+struct Entry
+{
+    std::int64_t registrationId;
+    std::int64_t position;
+    std::int64_t highWaterMark;
+    std::int64_t limit;
+    std::int32_t sessionId;
+    std::int32_t streamId;
+};
+
+struct Section
+{
+    std::int32_t kind;
+    std::int64_t timestampNs;
+    std::vector<Entry> entries;
+};
+
+static const int MAX_READ_ATTEMPTS = 16;
+
+inline static std::int32_t sectionCount(AtomicBuffer& buffer)
+{
+    return buffer.capacity() < PositionSnapshotDescriptor::HEADER_LENGTH ?
+        0 : buffer.getInt32Volatile(PositionSnapshotDescriptor::SECTION_COUNT_OFFSET);
+}
+
+/**
+ * Read the section at index, senders first, retrying while its agent is writing it.
+ *
+ * @return true when the section was read whole into section, false when it kept changing or is not in the buffer.
+ */
+inline static bool read(AtomicBuffer& buffer, std::int32_t index, Section& section)
+{
+    using namespace PositionSnapshotDescriptor;
+
+    const std::int32_t count = sectionCount(buffer);
+    if (index < 0 || index >= count)
+    {
+        return false;
+    }
+
+    const std::int32_t capacity = buffer.getInt32(SECTION_CAPACITY_OFFSET);
+    if (capacity <= 0 || buffer.capacity() < sectionOffset(capacity, count))
+    {
+        return false;
+    }
+
+    const util::index_t offset = sectionOffset(capacity, index);
+    const util::index_t columnsOffset = offset + SECTION_HEADER_LENGTH;
+    const util::index_t int64ColumnLength = capacity * static_cast<util::index_t>(sizeof(std::int64_t));
+    const util::index_t int32ColumnLength = capacity * static_cast<util::index_t>(sizeof(std::int32_t));
+
+    for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++)
+    {
+        const std::int64_t beginSequence = buffer.getInt64Volatile(offset + SECTION_SEQUENCE_OFFSET);
+        if (0 != (beginSequence & 1))
+        {
+            continue;
+        }
+
+        std::int32_t length = buffer.getInt32(offset + SECTION_LENGTH_OFFSET);
+        length = length < 0 ? 0 : (length > capacity ? capacity : length);
+
+        section.kind = buffer.getInt32(offset + SECTION_KIND_OFFSET);
+        section.timestampNs = buffer.getInt64(offset + SECTION_TIMESTAMP_OFFSET);
+        section.entries.resize(static_cast<std::size_t>(length));
+
+        for (std::int32_t i = 0; i < length; i++)
+        {
+            const util::index_t int64Offset = columnsOffset + i * static_cast<util::index_t>(sizeof(std::int64_t));
+            const util::index_t int32Offset =
+                columnsOffset + (4 * int64ColumnLength) + i * static_cast<util::index_t>(sizeof(std::int32_t));
+            Entry& entry = section.entries[static_cast<std::size_t>(i)];
+
+            entry.registrationId = buffer.getInt64(int64Offset);
+            entry.position = buffer.getInt64(int64Offset + int64ColumnLength);
+            entry.highWaterMark = buffer.getInt64(int64Offset + (2 * int64ColumnLength));
+            entry.limit = buffer.getInt64(int64Offset + (3 * int64ColumnLength));
+            entry.sessionId = buffer.getInt32(int32Offset);
+            entry.streamId = buffer.getInt32(int32Offset + int32ColumnLength);
+        }
+
+        atomic::acquire();
+
+        if (buffer.getInt64Volatile(offset + SECTION_SEQUENCE_OFFSET) == beginSequence)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+}
+
+}}}
+
+#endif
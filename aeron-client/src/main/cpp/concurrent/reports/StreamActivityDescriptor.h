@@ -0,0 +1,56 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_STREAMACTIVITYDESCRIPTOR_H
+#define AERON_STREAMACTIVITYDESCRIPTOR_H
+
+#include <cstdint>
+#include <string>
+#include <util/Index.h>
+#include <util/BitUtil.h>
+
+namespace aeron {
+
+namespace concurrent {
+
+namespace reports {
+
+/**
+ * Layout of the stream-activity.dat file of the driver, a ring of the correlation ids of images and publications
+ * that have had data added, written by the driver conductor once per duty cycle.
+ */
+namespace StreamActivityDescriptor {
+
+static const std::string STREAM_ACTIVITY_FILE = "stream-activity.dat";
+
+static const util::index_t CAPACITY_OFFSET = 0;
+static const util::index_t TAIL_OFFSET = util::BitUtil::CACHE_LINE_LENGTH;
+static const util::index_t HEADER_LENGTH = 2 * util::BitUtil::CACHE_LINE_LENGTH;
+
+static const util::index_t ENTRY_SEQUENCE_OFFSET = 0;
+static const util::index_t ENTRY_CORRELATION_ID_OFFSET = 8;
+static const util::index_t ENTRY_LENGTH = 16;
+
+inline static util::index_t entryOffset(std::int64_t sequence, std::int64_t mask)
+{
+    return HEADER_LENGTH + static_cast<util::index_t>(sequence & mask) * ENTRY_LENGTH;
+}
+
+}
+
+}}}
+
+#endif
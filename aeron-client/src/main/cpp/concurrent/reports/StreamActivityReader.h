@@ -0,0 +1,147 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_STREAMACTIVITYREADER_H
+#define AERON_STREAMACTIVITYREADER_H
+
+#include <cstdint>
+#include <util/Index.h>
+#include <util/Exceptions.h>
+#include <util/StringUtil.h>
+#include <util/BitUtil.h>
+#include <concurrent/AtomicBuffer.h>
+#include "StreamActivityDescriptor.h"
+
+namespace aeron {
+
+namespace concurrent {
+
+namespace reports {
+
+/**
+ * Reads the correlation ids of the images and publications that have had data added from the stream activity ring
+ * of the driver, starting from the entries appended after the reader is constructed.
+ * <p>
+ * An id may be read more than once and an image should then be polled until it has nothing left, as the driver only
+ * appends an id again once more data is added. A reader that falls a full ring behind is lapped and moved on to the
+ * tail, and is then to check all of its images as ids have been missed.
+ * <p>
+ * Not thread safe, each consuming thread is to have its own reader.
+ */
+class StreamActivityReader
+{
+public:
+    static const int LAPPED = -1;
+
+    /**
+     * @param buffer over the stream-activity.dat file of the driver.
+     * @throws util::IllegalStateException if the buffer does not hold a ring set up by the driver.
+     */
+    explicit StreamActivityReader(AtomicBuffer& buffer) :
+        m_buffer(buffer)
+    {
+        using namespace StreamActivityDescriptor;
+
+        const std::int32_t capacity = m_buffer.capacity() < HEADER_LENGTH ?
+            0 : m_buffer.getInt32Volatile(CAPACITY_OFFSET);
+
+        if (!util::BitUtil::isPowerOfTwo(capacity) ||
+            m_buffer.capacity() < HEADER_LENGTH + (static_cast<util::index_t>(capacity) * ENTRY_LENGTH))
+        {
+            throw util::IllegalStateException(
+                util::strPrintf("stream activity ring not set up, capacity=%d", capacity), SOURCEINFO);
+        }
+
+        m_capacity = capacity;
+        m_mask = capacity - 1;
+        m_cursor = m_buffer.getInt64Volatile(TAIL_OFFSET);
+    }
+
+    inline std::int32_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * Number of times the reader has been lapped by the driver.
+     */
+    inline std::int64_t lappedCount() const
+    {
+        return m_lappedCount;
+    }
+
+    /**
+     * Hand the correlation id of each entry appended since the last poll to the handler.
+     *
+     * @param handler called with the correlation id of an image or publication.
+     * @return the number of entries read, or LAPPED if entries were missed and the reader moved on to the tail.
+     */
+    template <typename F>
+    inline int poll(F&& handler)
+    {
+        using namespace StreamActivityDescriptor;
+
+        const std::int64_t tail = m_buffer.getInt64Volatile(TAIL_OFFSET);
+        if (tail - m_cursor > m_capacity)
+        {
+            return lapped(tail);
+        }
+
+        int count = 0;
+        while (m_cursor < tail)
+        {
+            const util::index_t offset = entryOffset(m_cursor, m_mask);
+
+            if (m_buffer.getInt64Volatile(offset + ENTRY_SEQUENCE_OFFSET) != m_cursor)
+            {
+                return lapped(tail);
+            }
+
+            const std::int64_t correlationId = m_buffer.getInt64(offset + ENTRY_CORRELATION_ID_OFFSET);
+            atomic::acquire();
+
+            if (m_buffer.getInt64Volatile(offset + ENTRY_SEQUENCE_OFFSET) != m_cursor)
+            {
+                return lapped(tail);
+            }
+
+            m_cursor++;
+            count++;
+            handler(correlationId);
+        }
+
+        return count;
+    }
+
+private:
+    AtomicBuffer m_buffer;
+    std::int64_t m_cursor = 0;
+    std::int64_t m_mask = 0;
+    std::int64_t m_lappedCount = 0;
+    std::int32_t m_capacity = 0;
+
+    inline int lapped(std::int64_t tail)
+    {
+        m_cursor = tail;
+        m_lappedCount++;
+
+        return LAPPED;
+    }
+};
+
+}}}
+
+#endif
@@ -32,6 +32,18 @@ namespace aeron { namespace concurrent { namespace ringbuffer {
 class ManyToOneRingBuffer
 {
 public:
+    static const util::index_t INSUFFICIENT_CAPACITY = -2;
+
+    /**
+     * Space claimed in the ring buffer for a batch of records with a single update of the tail.
+     */
+    struct Batch
+    {
+        util::index_t index = 0;
+        util::index_t length = 0;
+        util::index_t offset = 0;
+    };
+
     ManyToOneRingBuffer(concurrent::AtomicBuffer& buffer)
         : m_buffer(buffer)
     {
@@ -79,6 +91,178 @@ public:
         return isSuccessful;
     }
 
+    /**
+     * Claim space for a batch of records with a single CAS of the tail. length is the sum of the aligned record
+     * lengths, see batchRecordLength. The batch must always be completed with commitBatch.
+     *
+     * @return true if the space was claimed otherwise false if the buffer is full.
+     */
+    bool tryClaimBatch(Batch& batch, util::index_t length)
+    {
+        const util::index_t requiredCapacity = util::BitUtil::align(length, RecordDescriptor::ALIGNMENT);
+        checkMsgLength(requiredCapacity);
+
+        const util::index_t index = claimCapacity(requiredCapacity);
+        if (INSUFFICIENT_CAPACITY == index)
+        {
+            return false;
+        }
+
+        batch.index = index;
+        batch.length = requiredCapacity;
+        batch.offset = 0;
+
+        return true;
+    }
+
+    /**
+     * Write a record into a claimed batch so it is immediately available to the consumer.
+     *
+     * @return true if the record was written otherwise false if the batch does not have sufficient remaining space.
+     */
+    bool writeBatch(
+        Batch& batch,
+        std::int32_t msgTypeId,
+        concurrent::AtomicBuffer& srcBuffer,
+        util::index_t srcIndex,
+        util::index_t length)
+    {
+        RecordDescriptor::checkMsgTypeId(msgTypeId);
+
+        const util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+        const util::index_t requiredCapacity = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+
+        if (requiredCapacity > (batch.length - batch.offset))
+        {
+            return false;
+        }
+
+        const util::index_t recordIndex = batch.index + batch.offset;
+
+        m_buffer.putInt64Ordered(recordIndex, RecordDescriptor::makeHeader(-recordLength, msgTypeId));
+        m_buffer.putBytes(RecordDescriptor::encodedMsgOffset(recordIndex), srcBuffer, srcIndex, length);
+        m_buffer.putInt32Ordered(RecordDescriptor::lengthOffset(recordIndex), recordLength);
+
+        batch.offset += requiredCapacity;
+
+        return true;
+    }
+
+    /**
+     * Complete a batch by padding out any unused space so the consumer can move past it.
+     */
+    void commitBatch(Batch& batch)
+    {
+        const util::index_t remaining = batch.length - batch.offset;
+
+        if (0 != remaining)
+        {
+            m_buffer.putInt64Ordered(
+                batch.index + batch.offset,
+                RecordDescriptor::makeHeader(remaining, RecordDescriptor::PADDING_MSG_TYPE_ID));
+            batch.offset = batch.length;
+        }
+    }
+
+    inline static util::index_t batchRecordLength(util::index_t length)
+    {
+        return util::BitUtil::align(length + RecordDescriptor::HEADER_LENGTH, RecordDescriptor::ALIGNMENT);
+    }
+
+    /**
+     * Claim space for a message of length to be encoded in place in buffer() and then published with commit or
+     * discarded with abort. The consumer stops at the claim until it is completed, so complete it promptly.
+     *
+     * @return the index in buffer() at which to encode the message, otherwise INSUFFICIENT_CAPACITY if full.
+     */
+    util::index_t tryClaim(std::int32_t msgTypeId, util::index_t length)
+    {
+        RecordDescriptor::checkMsgTypeId(msgTypeId);
+        checkMsgLength(length);
+
+        const util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+        const util::index_t requiredCapacity = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+        const util::index_t recordIndex = claimCapacity(requiredCapacity);
+
+        if (INSUFFICIENT_CAPACITY == recordIndex)
+        {
+            return INSUFFICIENT_CAPACITY;
+        }
+
+        m_buffer.putInt64Ordered(recordIndex, RecordDescriptor::makeHeader(-recordLength, msgTypeId));
+
+        return RecordDescriptor::encodedMsgOffset(recordIndex);
+    }
+
+    /**
+     * Publish a message claimed with tryClaim to the consumer.
+     */
+    void commit(util::index_t index)
+    {
+        const util::index_t recordIndex = index - RecordDescriptor::HEADER_LENGTH;
+        const std::int32_t recordLength = m_buffer.getInt32(RecordDescriptor::lengthOffset(recordIndex));
+
+        m_buffer.putInt32Ordered(RecordDescriptor::lengthOffset(recordIndex), -recordLength);
+    }
+
+    /**
+     * Discard a message claimed with tryClaim so the consumer skips it.
+     */
+    void abort(util::index_t index)
+    {
+        const util::index_t recordIndex = index - RecordDescriptor::HEADER_LENGTH;
+        const std::int32_t recordLength = m_buffer.getInt32(RecordDescriptor::lengthOffset(recordIndex));
+
+        m_buffer.putInt64Ordered(
+            recordIndex, RecordDescriptor::makeHeader(-recordLength, RecordDescriptor::PADDING_MSG_TYPE_ID));
+    }
+
+    inline concurrent::AtomicBuffer& buffer()
+    {
+        return m_buffer;
+    }
+
+    /**
+     * Hand the contiguous block of committed records from the head to the handler in one call, padding records
+     * included, and consume it.
+     *
+     * @return the number of bytes consumed.
+     */
+    util::index_t readBlock(const block_handler_t& handler, util::index_t lengthLimit)
+    {
+        const std::int64_t head = m_buffer.getInt64(m_headPositionIndex);
+        const std::int32_t headIndex = (std::int32_t)head & (m_capacity - 1);
+        const util::index_t blockLimit = std::min(lengthLimit, m_capacity - headIndex);
+        util::index_t blockLength = 0;
+
+        while (blockLength < blockLimit)
+        {
+            const std::int32_t recordLength = m_buffer.getInt32Volatile(headIndex + blockLength);
+            const util::index_t alignedLength = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+
+            if (recordLength <= 0 || (blockLength + alignedLength) > blockLimit)
+            {
+                break;
+            }
+
+            blockLength += alignedLength;
+        }
+
+        if (0 != blockLength)
+        {
+            auto cleanup = util::InvokeOnScopeExit {
+                [&]()
+                {
+                    m_buffer.setMemory(headIndex, blockLength, 0);
+                    m_buffer.putInt64Ordered(m_headPositionIndex, head + blockLength);
+                }};
+
+            handler(m_buffer, headIndex, blockLength);
+        }
+
+        return blockLength;
+    }
+
     int read(const handler_t& handler, int messageCountLimit)
     {
         const std::int64_t head = m_buffer.getInt64(m_headPositionIndex);
@@ -223,9 +407,6 @@ public:
     }
 
 private:
-
-    static const util::index_t INSUFFICIENT_CAPACITY = -2;
-
     concurrent::AtomicBuffer &m_buffer;
     util::index_t m_capacity;
     util::index_t m_maxMsgLength;
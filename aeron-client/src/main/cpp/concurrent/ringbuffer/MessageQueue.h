@@ -0,0 +1,243 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_MESSAGEQUEUE_H
+#define AERON_MESSAGEQUEUE_H
+
+#include <cstdint>
+#include <limits.h>
+#include <vector>
+#include <util/Index.h>
+#include <util/BitUtil.h>
+#include <concurrent/AtomicBuffer.h>
+#include "OneToOneRingBuffer.h"
+#include "ManyToOneRingBuffer.h"
+
+namespace aeron { namespace concurrent { namespace ringbuffer {
+
+/**
+ * Queue of variable length messages between threads of one process, such as from a thread polling an Image to the
+ * threads processing what it receives, backed by a ring buffer it allocates itself.
+ * <p>
+ * Producers either offer a copy of a message or claim space with tryClaim, encode the message in place in buffer()
+ * and commit it. The consumer drains a contiguous block of messages at a time, handing each to the handler from the
+ * buffer in place without a copy, and consumes the whole block once the handler has seen it, so if the handler throws
+ * the rest of the block is lost. The put and take variants wait with an idle strategy rather than failing.
+ *
+ * @tparam RingBuffer OneToOneRingBuffer for a single producer or ManyToOneRingBuffer for many.
+ */
+template<typename RingBuffer>
+class MessageQueue
+{
+public:
+    static const util::index_t INSUFFICIENT_CAPACITY = RingBuffer::INSUFFICIENT_CAPACITY;
+
+    /**
+     * @param capacity of the ring buffer in bytes, a power of two.
+     */
+    explicit MessageQueue(util::index_t capacity) :
+        m_memory(static_cast<std::size_t>(capacity + RingBufferDescriptor::TRAILER_LENGTH) +
+            util::BitUtil::CACHE_LINE_LENGTH),
+        m_buffer(alignedMemory(m_memory), static_cast<std::size_t>(capacity + RingBufferDescriptor::TRAILER_LENGTH)),
+        m_ringBuffer(m_buffer)
+    {
+    }
+
+    MessageQueue(const MessageQueue&) = delete;
+    MessageQueue& operator=(const MessageQueue&) = delete;
+
+    inline util::index_t capacity() const
+    {
+        return m_ringBuffer.capacity();
+    }
+
+    inline util::index_t maxMsgLength()
+    {
+        return m_ringBuffer.maxMsgLength();
+    }
+
+    /**
+     * Number of bytes of messages, and their headers and padding, waiting to be consumed.
+     *
+     * @return the number of bytes waiting to be consumed.
+     */
+    inline std::int32_t size() const
+    {
+        return m_ringBuffer.size();
+    }
+
+    /**
+     * Copy a message into the queue.
+     *
+     * @return true if the message was queued otherwise false if the queue is full.
+     */
+    inline bool offer(std::int32_t msgTypeId, AtomicBuffer& srcBuffer, util::index_t srcIndex, util::index_t length)
+    {
+        return m_ringBuffer.write(msgTypeId, srcBuffer, srcIndex, length);
+    }
+
+    /**
+     * Copy a message into the queue, idling while the queue is full.
+     */
+    template<typename IdleStrategy>
+    inline void put(
+        std::int32_t msgTypeId,
+        AtomicBuffer& srcBuffer,
+        util::index_t srcIndex,
+        util::index_t length,
+        IdleStrategy& idleStrategy)
+    {
+        while (!m_ringBuffer.write(msgTypeId, srcBuffer, srcIndex, length))
+        {
+            idleStrategy.idle(0);
+        }
+    }
+
+    /**
+     * Claim space to encode a message in place in buffer().
+     *
+     * @return the index at which to encode the message, otherwise INSUFFICIENT_CAPACITY if the queue is full.
+     */
+    inline util::index_t tryClaim(std::int32_t msgTypeId, util::index_t length)
+    {
+        return m_ringBuffer.tryClaim(msgTypeId, length);
+    }
+
+    /**
+     * Claim space to encode a message in place in buffer(), idling while the queue is full.
+     *
+     * @return the index at which to encode the message.
+     */
+    template<typename IdleStrategy>
+    inline util::index_t claim(std::int32_t msgTypeId, util::index_t length, IdleStrategy& idleStrategy)
+    {
+        util::index_t index;
+
+        while (INSUFFICIENT_CAPACITY == (index = m_ringBuffer.tryClaim(msgTypeId, length)))
+        {
+            idleStrategy.idle(0);
+        }
+
+        return index;
+    }
+
+    inline void commit(util::index_t index)
+    {
+        m_ringBuffer.commit(index);
+    }
+
+    inline void abort(util::index_t index)
+    {
+        m_ringBuffer.abort(index);
+    }
+
+    /**
+     * The buffer claimed messages are encoded in.
+     *
+     * @return the buffer claimed messages are encoded in.
+     */
+    inline AtomicBuffer& buffer()
+    {
+        return m_buffer;
+    }
+
+    /**
+     * Hand the messages in the contiguous block at the head of the queue to the handler and consume them.
+     *
+     * @param handler     called with the msgTypeId, buffer, offset and length of each message.
+     * @param lengthLimit on the bytes of the block, at least the record length of one message for progress.
+     * @return the number of messages handled.
+     */
+    template<typename F>
+    inline int drain(F&& handler, util::index_t lengthLimit = INT_MAX)
+    {
+        int messagesRead = 0;
+
+        m_ringBuffer.readBlock(
+            [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+            {
+                const util::index_t limit = offset + length;
+
+                while (offset < limit)
+                {
+                    const std::int64_t header = buffer.getInt64(offset);
+                    const std::int32_t recordLength = RecordDescriptor::recordLength(header);
+                    const std::int32_t msgTypeId = RecordDescriptor::messageTypeId(header);
+
+                    if (RecordDescriptor::PADDING_MSG_TYPE_ID != msgTypeId)
+                    {
+                        ++messagesRead;
+                        handler(
+                            msgTypeId,
+                            buffer,
+                            RecordDescriptor::encodedMsgOffset(offset),
+                            recordLength - RecordDescriptor::HEADER_LENGTH);
+                    }
+
+                    offset += util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+                }
+            },
+            lengthLimit);
+
+        return messagesRead;
+    }
+
+    /**
+     * Drain the queue as for drain, idling until at least one message has been handled.
+     *
+     * @return the number of messages handled.
+     */
+    template<typename F, typename IdleStrategy>
+    inline int take(F&& handler, IdleStrategy& idleStrategy, util::index_t lengthLimit = INT_MAX)
+    {
+        int messagesRead;
+
+        while (0 == (messagesRead = drain(handler, lengthLimit)))
+        {
+            idleStrategy.idle(0);
+        }
+
+        return messagesRead;
+    }
+
+    inline RingBuffer& ringBuffer()
+    {
+        return m_ringBuffer;
+    }
+
+private:
+    std::vector<std::uint8_t> m_memory;
+    AtomicBuffer m_buffer;
+    RingBuffer m_ringBuffer;
+
+    static std::uint8_t *alignedMemory(std::vector<std::uint8_t>& memory)
+    {
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(memory.data());
+        const std::uintptr_t alignment = util::BitUtil::CACHE_LINE_LENGTH;
+
+        return memory.data() + (((address + alignment - 1) & ~(alignment - 1)) - address);
+    }
+};
+
+/** Queue of messages from a single producer thread to a single consumer thread. */
+typedef MessageQueue<OneToOneRingBuffer> OneToOneMessageQueue;
+
+/** Queue of messages from many producer threads to a single consumer thread. */
+typedef MessageQueue<ManyToOneRingBuffer> ManyToOneMessageQueue;
+
+}}}
+
+#endif //AERON_MESSAGEQUEUE_H
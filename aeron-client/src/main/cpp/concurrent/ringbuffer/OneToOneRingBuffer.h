@@ -32,6 +32,8 @@ namespace aeron { namespace concurrent { namespace ringbuffer {
 class OneToOneRingBuffer
 {
 public:
+    static const util::index_t INSUFFICIENT_CAPACITY = -2;
+
     OneToOneRingBuffer(concurrent::AtomicBuffer &buffer)
         : m_buffer(buffer)
     {
@@ -64,60 +66,111 @@ public:
 
         const util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
         const util::index_t requiredCapacity = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
-        const util::index_t mask = m_capacity - 1;
-
-        std::int64_t head = m_buffer.getInt64(m_headCachePositionIndex);
-        std::int64_t tail = m_buffer.getInt64(m_tailPositionIndex);
-        const util::index_t availableCapacity = m_capacity - (util::index_t)(tail - head);
+        const util::index_t recordIndex = claimCapacity(requiredCapacity);
 
-        if (requiredCapacity > availableCapacity)
+        if (INSUFFICIENT_CAPACITY == recordIndex)
         {
-            head = m_buffer.getInt64Volatile(m_headPositionIndex);
+            return false;
+        }
 
-            if (requiredCapacity > (m_capacity - (util::index_t)(tail - head)))
-            {
-                return false;
-            }
+        m_buffer.putBytes(RecordDescriptor::encodedMsgOffset(recordIndex), srcBuffer, srcIndex, length);
+        m_buffer.putInt64Ordered(recordIndex, RecordDescriptor::makeHeader(recordLength, msgTypeId));
 
-            m_buffer.putInt64(m_headCachePositionIndex, head);
-        }
+        return true;
+    }
 
-        util::index_t padding = 0;
-        util::index_t recordIndex = (util::index_t) tail & mask;
-        const util::index_t toBufferEndLength = m_capacity - recordIndex;
+    /**
+     * Claim space for a message of length to be encoded in place in buffer() and then published with commit or
+     * discarded with abort. The consumer stops at the claim until it is completed, so complete it promptly.
+     *
+     * @return the index in buffer() at which to encode the message, otherwise INSUFFICIENT_CAPACITY if full.
+     */
+    util::index_t tryClaim(std::int32_t msgTypeId, util::index_t length)
+    {
+        RecordDescriptor::checkMsgTypeId(msgTypeId);
+        checkMsgLength(length);
 
-        if (requiredCapacity > toBufferEndLength)
+        const util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+        const util::index_t requiredCapacity = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+        const util::index_t recordIndex = claimCapacity(requiredCapacity);
+
+        if (INSUFFICIENT_CAPACITY == recordIndex)
         {
-            std::int32_t headIndex = (std::int32_t) head & mask;
+            return INSUFFICIENT_CAPACITY;
+        }
 
-            if (requiredCapacity > headIndex)
-            {
-                head = m_buffer.getInt64Volatile(m_headPositionIndex);
-                headIndex = (std::int32_t) head & mask;
+        m_buffer.putInt64Ordered(recordIndex, RecordDescriptor::makeHeader(-recordLength, msgTypeId));
 
-                if (requiredCapacity > headIndex)
-                {
-                    return false;
-                }
+        return RecordDescriptor::encodedMsgOffset(recordIndex);
+    }
 
-                m_buffer.putInt64Ordered(m_headCachePositionIndex, head);
+    /**
+     * Publish a message claimed with tryClaim to the consumer.
+     */
+    void commit(util::index_t index)
+    {
+        const util::index_t recordIndex = index - RecordDescriptor::HEADER_LENGTH;
+        const std::int32_t recordLength = m_buffer.getInt32(RecordDescriptor::lengthOffset(recordIndex));
+
+        m_buffer.putInt32Ordered(RecordDescriptor::lengthOffset(recordIndex), -recordLength);
+    }
+
+    /**
+     * Discard a message claimed with tryClaim so the consumer skips it.
+     */
+    void abort(util::index_t index)
+    {
+        const util::index_t recordIndex = index - RecordDescriptor::HEADER_LENGTH;
+        const std::int32_t recordLength = m_buffer.getInt32(RecordDescriptor::lengthOffset(recordIndex));
+
+        m_buffer.putInt64Ordered(
+            recordIndex, RecordDescriptor::makeHeader(-recordLength, RecordDescriptor::PADDING_MSG_TYPE_ID));
+    }
+
+    inline concurrent::AtomicBuffer& buffer()
+    {
+        return m_buffer;
+    }
+
+    /**
+     * Hand the contiguous block of committed records from the head to the handler in one call, padding records
+     * included, and consume it.
+     *
+     * @return the number of bytes consumed.
+     */
+    util::index_t readBlock(const block_handler_t &handler, util::index_t lengthLimit)
+    {
+        const std::int64_t head = m_buffer.getInt64(m_headPositionIndex);
+        const std::int32_t headIndex = (std::int32_t) head & (m_capacity - 1);
+        const util::index_t blockLimit = std::min(lengthLimit, m_capacity - headIndex);
+        util::index_t blockLength = 0;
+
+        while (blockLength < blockLimit)
+        {
+            const std::int32_t recordLength = m_buffer.getInt32Volatile(headIndex + blockLength);
+            const util::index_t alignedLength = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+
+            if (recordLength <= 0 || (blockLength + alignedLength) > blockLimit)
+            {
+                break;
             }
 
-            padding = toBufferEndLength;
+            blockLength += alignedLength;
         }
 
-        if (0 != padding)
+        if (0 != blockLength)
         {
-            m_buffer.putInt64Ordered(recordIndex,
-                RecordDescriptor::makeHeader(padding, RecordDescriptor::PADDING_MSG_TYPE_ID));
-            recordIndex = 0;
-        }
+            auto cleanup = util::InvokeOnScopeExit {
+                [&]()
+                {
+                    m_buffer.setMemory(headIndex, blockLength, 0);
+                    m_buffer.putInt64Ordered(m_headPositionIndex, head + blockLength);
+                }};
 
-        m_buffer.putBytes(RecordDescriptor::encodedMsgOffset(recordIndex), srcBuffer, srcIndex, length);
-        m_buffer.putInt64Ordered(recordIndex, RecordDescriptor::makeHeader(recordLength, msgTypeId));
-        m_buffer.putInt64Ordered(m_tailPositionIndex, tail + requiredCapacity + padding);
+            handler(m_buffer, headIndex, blockLength);
+        }
 
-        return true;
+        return blockLength;
     }
 
     int read(const handler_t &handler, int messageCountLimit)
@@ -233,6 +286,62 @@ private:
     util::index_t m_correlationIdCounterIndex;
     util::index_t m_consumerHeartbeatIndex;
 
+    util::index_t claimCapacity(util::index_t requiredCapacity)
+    {
+        const util::index_t mask = m_capacity - 1;
+
+        std::int64_t head = m_buffer.getInt64(m_headCachePositionIndex);
+        const std::int64_t tail = m_buffer.getInt64(m_tailPositionIndex);
+        const util::index_t availableCapacity = m_capacity - (util::index_t)(tail - head);
+
+        if (requiredCapacity > availableCapacity)
+        {
+            head = m_buffer.getInt64Volatile(m_headPositionIndex);
+
+            if (requiredCapacity > (m_capacity - (util::index_t)(tail - head)))
+            {
+                return INSUFFICIENT_CAPACITY;
+            }
+
+            m_buffer.putInt64(m_headCachePositionIndex, head);
+        }
+
+        util::index_t padding = 0;
+        util::index_t recordIndex = (util::index_t) tail & mask;
+        const util::index_t toBufferEndLength = m_capacity - recordIndex;
+
+        if (requiredCapacity > toBufferEndLength)
+        {
+            std::int32_t headIndex = (std::int32_t) head & mask;
+
+            if (requiredCapacity > headIndex)
+            {
+                head = m_buffer.getInt64Volatile(m_headPositionIndex);
+                headIndex = (std::int32_t) head & mask;
+
+                if (requiredCapacity > headIndex)
+                {
+                    return INSUFFICIENT_CAPACITY;
+                }
+
+                m_buffer.putInt64Ordered(m_headCachePositionIndex, head);
+            }
+
+            padding = toBufferEndLength;
+        }
+
+        if (0 != padding)
+        {
+            m_buffer.putInt64Ordered(recordIndex,
+                RecordDescriptor::makeHeader(padding, RecordDescriptor::PADDING_MSG_TYPE_ID));
+            recordIndex = 0;
+        }
+
+        m_buffer.putInt64Ordered(m_tailPositionIndex, tail + requiredCapacity + padding);
+
+        return recordIndex;
+    }
+
     inline void checkMsgLength(util::index_t length) const
     {
         if (length > m_maxMsgLength)
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_HEARTBEATTIMESTAMP_H
+#define AERON_HEARTBEATTIMESTAMP_H
+
+#include <algorithm>
+#include "concurrent/AtomicBuffer.h"
+#include "concurrent/CountersReader.h"
+
+namespace aeron { namespace concurrent { namespace status {
+
+/**
+ * Counters holding the epoch time in ms of the last heartbeat from an agent, keyed by its registration id. The media
+ * driver allocates one per client so a client can show liveness by storing to it rather than sending keepalives.
+ */
+namespace HeartbeatTimestamp
+{
+static const std::int32_t CLIENT_HEARTBEAT_TYPE_ID = 13;
+static const std::int32_t NULL_COUNTER_ID = -1;
+static const util::index_t REGISTRATION_ID_OFFSET = 0;
+
+inline bool isActive(
+    const CountersReader& countersReader, std::int32_t counterId, std::int32_t typeId, std::int64_t registrationId)
+{
+    const AtomicBuffer metadataBuffer = countersReader.metaDataBuffer();
+    const util::index_t offset = CountersReader::metadataOffset(counterId);
+
+    return CountersReader::RECORD_ALLOCATED == metadataBuffer.getInt32Volatile(offset) &&
+        typeId == metadataBuffer.getInt32(offset + offsetof(CountersReader::CounterMetaDataDefn, typeId)) &&
+        registrationId == metadataBuffer.getInt64(offset + CountersReader::KEY_OFFSET + REGISTRATION_ID_OFFSET);
+}
+
+/**
+ * Find the active counter of a type for a registration id.
+ *
+ * @return the counter id or NULL_COUNTER_ID if not found.
+ */
+inline std::int32_t findCounterIdByRegistrationId(
+    const CountersReader& countersReader, std::int32_t typeId, std::int64_t registrationId)
+{
+    const AtomicBuffer metadataBuffer = countersReader.metaDataBuffer();
+    const std::int32_t maxCounterId = std::min(
+        countersReader.maxCounterId(), metadataBuffer.capacity() / CountersReader::METADATA_LENGTH);
+
+    for (std::int32_t counterId = 0; counterId < maxCounterId; counterId++)
+    {
+        const std::int32_t recordState = metadataBuffer.getInt32Volatile(CountersReader::metadataOffset(counterId));
+
+        if (CountersReader::RECORD_UNUSED == recordState)
+        {
+            break;
+        }
+        else if (isActive(countersReader, counterId, typeId, registrationId))
+        {
+            return counterId;
+        }
+    }
+
+    return NULL_COUNTER_ID;
+}
+
+}
+
+}}}
+
+#endif //AERON_HEARTBEATTIMESTAMP_H
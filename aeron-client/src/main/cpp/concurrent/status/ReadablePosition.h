@@ -47,6 +47,16 @@ public:
         return m_impl.getVolatile();
     }
 
+    inline std::int64_t *address()
+    {
+        return m_impl.address();
+    }
+
+    inline bool awaitAbove(std::int64_t threshold, std::int64_t timeoutNs)
+    {
+        return m_impl.awaitAbove(threshold, timeoutNs);
+    }
+
     inline void close()
     {
         m_impl.close();
@@ -17,10 +17,21 @@
 #ifndef AERON_UNSAFEBUFFERPOSITION_H
 #define AERON_UNSAFEBUFFERPOSITION_H
 
+#include <chrono>
+#include <thread>
+#include <climits>
+#include <algorithm>
 #include <concurrent/AtomicBuffer.h>
 #include <concurrent/CountersManager.h>
 #include "Position.h"
 
+#if defined(__linux__)
+#include <ctime>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
 namespace aeron { namespace concurrent { namespace status {
 
 class UnsafeBufferPosition
@@ -63,6 +74,11 @@ public:
         return m_buffer.getInt64(m_offset);
     }
 
+    inline std::int64_t *address()
+    {
+        return reinterpret_cast<std::int64_t *>(m_buffer.buffer() + m_offset);
+    }
+
     inline std::int64_t getVolatile()
     {
         return m_buffer.getInt64Volatile(m_offset);
@@ -78,6 +94,53 @@ public:
         m_buffer.putInt64Ordered(m_offset, value);
     }
 
+    /**
+     * Park the calling thread until the value is above a threshold or the timeout expires. The thread sleeps on the
+     * wake sequence of the counter and is woken by whoever advances the value calling {@link #signalWaiters()}. On
+     * platforms without futexes the value is polled at most once a millisecond.
+     *
+     * @param threshold the value must exceed.
+     * @param timeoutNs to wait at most.
+     * @return true if the value is above the threshold.
+     */
+    inline bool awaitAbove(std::int64_t threshold, std::int64_t timeoutNs)
+    {
+        if (getVolatile() > threshold)
+        {
+            return true;
+        }
+
+        m_buffer.getAndAddInt32(m_offset + CountersReader::WAITERS_OFFSET, 1);
+
+        const std::int32_t sequence = m_buffer.getInt32Volatile(m_offset + CountersReader::WAKE_SEQUENCE_OFFSET);
+        bool isAbove = getVolatile() > threshold;
+
+        if (!isAbove)
+        {
+            waitOnSequence(sequence, timeoutNs);
+            isAbove = getVolatile() > threshold;
+        }
+
+        m_buffer.getAndAddInt32(m_offset + CountersReader::WAITERS_OFFSET, -1);
+
+        return isAbove;
+    }
+
+    /**
+     * Wake threads parked in {@link #awaitAbove()} after the value has been advanced. No system call is made when
+     * nothing is waiting.
+     */
+    inline void signalWaiters()
+    {
+        if (m_buffer.getAndAddInt32(m_offset + CountersReader::WAITERS_OFFSET, 0) > 0)
+        {
+            m_buffer.getAndAddInt32(m_offset + CountersReader::WAKE_SEQUENCE_OFFSET, 1);
+#if defined(__linux__)
+            ::syscall(SYS_futex, sequenceAddress(), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+        }
+    }
+
     inline void close()
     {
     }
@@ -86,6 +149,24 @@ private:
     AtomicBuffer m_buffer;
     std::int32_t m_id;
     std::int32_t m_offset;
+
+    inline std::int32_t *sequenceAddress()
+    {
+        return reinterpret_cast<std::int32_t *>(m_buffer.buffer() + m_offset + CountersReader::WAKE_SEQUENCE_OFFSET);
+    }
+
+    inline void waitOnSequence(std::int32_t sequence, std::int64_t timeoutNs)
+    {
+#if defined(__linux__)
+        struct timespec timeout;
+        timeout.tv_sec = static_cast<time_t>(timeoutNs / 1000000000);
+        timeout.tv_nsec = static_cast<long>(timeoutNs % 1000000000);
+
+        ::syscall(SYS_futex, sequenceAddress(), FUTEX_WAIT, sequence, &timeout, nullptr, 0);
+#else
+        std::this_thread::sleep_for(std::chrono::nanoseconds(std::min<std::int64_t>(timeoutNs, 1000000)));
+#endif
+    }
 };
 
 }}}
@@ -0,0 +1,267 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_UTIL_FLAT_MAP__
+#define INCLUDED_AERON_UTIL_FLAT_MAP__
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "BitUtil.h"
+
+namespace aeron { namespace util {
+
+/**
+ * Open addressed map, with linear probing, from integral keys to heap allocated values. Keys and value pointers
+ * are held in flat arrays so a lookup costs no node dereference, and the last key found is cached so repeated lookups
+ * for the same key, such as the fragments of one session, skip hashing. Values do not move when the map grows so
+ * references to them stay valid until the key is removed. Not thread safe.
+ */
+template <typename K, typename V>
+class FlatMap
+{
+public:
+    static_assert(std::is_integral<K>::value, "FlatMap keys must be integral");
+
+    explicit FlatMap(std::size_t initialCapacity = 16) :
+        m_keys(BitUtil::findNextPowerOfTwo(initialCapacity < 2 ? 2 : initialCapacity)),
+        m_values(m_keys.size())
+    {
+    }
+
+    inline std::size_t size() const
+    {
+        return m_size;
+    }
+
+    inline std::size_t capacity() const
+    {
+        return m_keys.size();
+    }
+
+    /**
+     * Get the value for a key.
+     *
+     * @param key to lookup.
+     * @return the value or nullptr if the key is not present.
+     */
+    inline V *get(K key)
+    {
+        if (nullptr != m_lastValue && key == m_lastKey)
+        {
+            return m_lastValue;
+        }
+
+        const std::size_t mask = m_keys.size() - 1;
+
+        for (std::size_t index = hash(key) & mask; nullptr != m_values[index]; index = (index + 1) & mask)
+        {
+            if (key == m_keys[index])
+            {
+                m_lastKey = key;
+                m_lastValue = m_values[index].get();
+                return m_lastValue;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * Get the value for a key, inserting the value supplied if the key is not present.
+     *
+     * @param key      to lookup.
+     * @param supplier called to create the value if the key is not present, returns std::unique_ptr<V>.
+     * @return the value for the key.
+     */
+    template <typename F>
+    inline V& getOrInsert(K key, F&& supplier)
+    {
+        V *value = get(key);
+
+        if (nullptr == value)
+        {
+            if ((m_size + 1) * 2 > m_keys.size())
+            {
+                rehash(m_keys.size() * 2);
+            }
+
+            std::unique_ptr<V> newValue = supplier();
+            value = newValue.get();
+            insert(key, std::move(newValue));
+            ++m_size;
+
+            m_lastKey = key;
+            m_lastValue = value;
+        }
+
+        return *value;
+    }
+
+    /**
+     * Construct a value for a key not already present in the map.
+     *
+     * @param key  for the value.
+     * @param args to construct the value with.
+     * @return the value inserted.
+     */
+    template <typename... Args>
+    inline V& emplace(K key, Args&&... args)
+    {
+        return getOrInsert(
+            key, [&]() { return std::unique_ptr<V>(new V(std::forward<Args>(args)...)); });
+    }
+
+    /**
+     * Call func(key, value) for each entry in the map. The map must not be modified during the iteration.
+     */
+    template <typename F>
+    inline void forEach(F&& func)
+    {
+        for (std::size_t i = 0, length = m_keys.size(); i < length; i++)
+        {
+            if (nullptr != m_values[i])
+            {
+                func(m_keys[i], *m_values[i]);
+            }
+        }
+    }
+
+    inline void clear()
+    {
+        for (auto& value : m_values)
+        {
+            value.reset();
+        }
+
+        m_size = 0;
+        m_lastValue = nullptr;
+    }
+
+    /**
+     * Remove a key from the map handing back ownership of its value.
+     *
+     * @param key to be removed.
+     * @return the value removed or an empty pointer if the key is not present.
+     */
+    inline std::unique_ptr<V> remove(K key)
+    {
+        const std::size_t mask = m_keys.size() - 1;
+        std::unique_ptr<V> result;
+
+        for (std::size_t index = hash(key) & mask; nullptr != m_values[index]; index = (index + 1) & mask)
+        {
+            if (key == m_keys[index])
+            {
+                result = std::move(m_values[index]);
+                --m_size;
+                compactChain(index);
+                break;
+            }
+        }
+
+        if (result.get() == m_lastValue)
+        {
+            m_lastValue = nullptr;
+        }
+
+        return result;
+    }
+
+private:
+    std::vector<K> m_keys;
+    std::vector<std::unique_ptr<V>> m_values;
+    std::size_t m_size = 0;
+    K m_lastKey = 0;
+    V *m_lastValue = nullptr;
+
+    inline static std::size_t hash(K key)
+    {
+        std::uint64_t h = static_cast<std::uint64_t>(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+
+        return static_cast<std::size_t>(h);
+    }
+
+    inline void insert(K key, std::unique_ptr<V> value)
+    {
+        const std::size_t mask = m_keys.size() - 1;
+        std::size_t index = hash(key) & mask;
+
+        while (nullptr != m_values[index])
+        {
+            index = (index + 1) & mask;
+        }
+
+        m_keys[index] = key;
+        m_values[index] = std::move(value);
+    }
+
+    void rehash(std::size_t newCapacity)
+    {
+        std::vector<K> oldKeys(newCapacity);
+        std::vector<std::unique_ptr<V>> oldValues(newCapacity);
+
+        m_keys.swap(oldKeys);
+        m_values.swap(oldValues);
+
+        for (std::size_t i = 0; i < oldKeys.size(); i++)
+        {
+            if (nullptr != oldValues[i])
+            {
+                insert(oldKeys[i], std::move(oldValues[i]));
+            }
+        }
+    }
+
+    /*
+     * Shift back entries following a removed slot, whose probe chain passes through it, so lookups need no tombstones.
+     */
+    void compactChain(std::size_t deleteIndex)
+    {
+        const std::size_t mask = m_keys.size() - 1;
+        std::size_t index = deleteIndex;
+
+        while (true)
+        {
+            index = (index + 1) & mask;
+            if (nullptr == m_values[index])
+            {
+                break;
+            }
+
+            const std::size_t hashIndex = hash(m_keys[index]) & mask;
+
+            if ((index < hashIndex && (hashIndex <= deleteIndex || deleteIndex <= index)) ||
+                (hashIndex <= deleteIndex && deleteIndex <= index))
+            {
+                m_keys[deleteIndex] = m_keys[index];
+                m_values[deleteIndex] = std::move(m_values[index]);
+                deleteIndex = index;
+            }
+        }
+    }
+};
+
+template <typename V>
+using Int32FlatMap = FlatMap<std::int32_t, V>;
+
+}}
+
+#endif
@@ -30,8 +30,20 @@
 
 #if defined(__GNUC__)
     #define AERON_COND_EXPECT(exp,c) (__builtin_expect((exp),c))
+    #define AERON_PREFETCH(addr) (__builtin_prefetch((addr), 0, 3))
 #else
     #define AERON_COND_EXPECT(exp,c) (exp)
+    #define AERON_PREFETCH(addr) ((void)(addr))
+#endif
+
+/*
+ * With AERON_NOEXCEPT_HOT_PATH defined the poll and offer paths are declared noexcept and report errors as codes
+ * rather than exceptions. An exception escaping a user handler on those paths then terminates the process.
+ */
+#if defined(AERON_NOEXCEPT_HOT_PATH)
+    #define AERON_HOT_PATH_NOEXCEPT noexcept
+#else
+    #define AERON_HOT_PATH_NOEXCEPT
 #endif
 
 #endif
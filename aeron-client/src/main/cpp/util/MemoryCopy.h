@@ -0,0 +1,173 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_UTIL_MEMORYCOPY__
+#define INCLUDED_AERON_UTIL_MEMORYCOPY__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <util/Exceptions.h>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+/*
+ * GCC range checks the branches for lengths a call site can never have once a copy is inlined and warns about them.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#if __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wstringop-overread"
+#endif
+#endif
+
+namespace aeron { namespace util {
+
+/**
+ * Copies of message payloads inlined at the call site, for the small and mid sized copies the appenders make on
+ * every publication where a call into the dispatch of the C library memcpy costs as much as the copy itself.
+ * <p>
+ * Copies up to 32 bytes are a pair of possibly overlapping fixed size moves and copies up to MID_COPY_LIMIT are a
+ * loop of 32 byte moves, AVX2 when the target has it and otherwise two 16 byte moves, which compilers emit as SSE2
+ * or NEON registers, ending on a move overlapping the previous one. Copies of NON_TEMPORAL_COPY_THRESHOLD or more on
+ * x86-64 are streamed past the cache so a large message does not evict the working set of the publisher, and all
+ * other copies go to memcpy. Source and destination must not overlap.
+ */
+namespace MemoryCopy
+{
+    /** Copies up to this length are inlined. */
+    static const std::size_t MID_COPY_LIMIT = 256;
+
+    /** Copies of this length or more bypass the cache on x86-64. */
+    static const std::size_t NON_TEMPORAL_COPY_THRESHOLD = 1024 * 1024;
+
+    /**
+     * Copy a length known at compile time, which compilers emit as register moves rather than a call.
+     */
+    template<std::size_t N>
+    inline void copyFixed(std::uint8_t *dst, const std::uint8_t *src) AERON_NOEXCEPT
+    {
+        std::memcpy(dst, src, N);
+    }
+
+    inline void copy32(std::uint8_t *dst, const std::uint8_t *src) AERON_NOEXCEPT
+    {
+#if defined(__AVX2__)
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(dst), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src)));
+#else
+        copyFixed<16>(dst, src);
+        copyFixed<16>(dst + 16, src + 16);
+#endif
+    }
+
+    inline void copySmall(std::uint8_t *dst, const std::uint8_t *src, std::size_t length) AERON_NOEXCEPT
+    {
+        if (length >= 16)
+        {
+            copyFixed<16>(dst, src);
+            copyFixed<16>(dst + length - 16, src + length - 16);
+        }
+        else if (length >= 8)
+        {
+            copyFixed<8>(dst, src);
+            copyFixed<8>(dst + length - 8, src + length - 8);
+        }
+        else if (length >= 4)
+        {
+            copyFixed<4>(dst, src);
+            copyFixed<4>(dst + length - 4, src + length - 4);
+        }
+        else if (length > 0)
+        {
+            dst[0] = src[0];
+            dst[length >> 1] = src[length >> 1];
+            dst[length - 1] = src[length - 1];
+        }
+    }
+
+    inline void copyMid(std::uint8_t *dst, const std::uint8_t *src, std::size_t length) AERON_NOEXCEPT
+    {
+        const std::size_t last = length - 32;
+
+        for (std::size_t i = 0; i < last; i += 32)
+        {
+            copy32(dst + i, src + i);
+        }
+        copy32(dst + last, src + last);
+    }
+
+#if defined(__SSE2__) || defined(_M_X64)
+    inline void copyNonTemporal(std::uint8_t *dst, const std::uint8_t *src, std::size_t length) AERON_NOEXCEPT
+    {
+        const std::size_t head = (16 - (reinterpret_cast<std::uintptr_t>(dst) & 15)) & 15;
+        std::memcpy(dst, src, head);
+
+        std::size_t i = head;
+        for (; i + 64 <= length; i += 64)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 16));
+            const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 32));
+            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 48));
+
+            _mm_stream_si128(reinterpret_cast<__m128i *>(dst + i), a);
+            _mm_stream_si128(reinterpret_cast<__m128i *>(dst + i + 16), b);
+            _mm_stream_si128(reinterpret_cast<__m128i *>(dst + i + 32), c);
+            _mm_stream_si128(reinterpret_cast<__m128i *>(dst + i + 48), d);
+        }
+        _mm_sfence();
+
+        std::memcpy(dst + i, src + i, length - i);
+    }
+#endif
+
+    /**
+     * Copy length bytes from src to dst.
+     */
+    inline void copy(std::uint8_t *dst, const std::uint8_t *src, std::size_t length) AERON_NOEXCEPT
+    {
+        if (length <= 32)
+        {
+            copySmall(dst, src, length);
+        }
+        else if (length <= MID_COPY_LIMIT)
+        {
+            copyMid(dst, src, length);
+        }
+#if defined(__SSE2__) || defined(_M_X64)
+        else if (length >= NON_TEMPORAL_COPY_THRESHOLD)
+        {
+            copyNonTemporal(dst, src, length);
+        }
+#endif
+        else
+        {
+            std::memcpy(dst, src, length);
+        }
+    }
+}
+
+}}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
@@ -231,6 +231,31 @@ uint8_t* MemoryMappedFile::doMapping(size_t size, FileHandle fd, size_t offset)
     return static_cast<uint8_t*>(memory);
 }
 
+bool MemoryMappedFile::adviseHugePages()
+{
+    return false;
+}
+
+bool MemoryMappedFile::preTouch()
+{
+    return false;
+}
+
+bool MemoryMappedFile::lock()
+{
+    return false;
+}
+
+bool MemoryMappedFile::adviseRandom()
+{
+    return false;
+}
+
+bool MemoryMappedFile::release(size_t offset, size_t length)
+{
+    return false;
+}
+
 size_t MemoryMappedFile::getPageSize()
 {
     SYSTEM_INFO sinfo;
@@ -285,6 +310,65 @@ uint8_t* MemoryMappedFile::doMapping(size_t length, FileHandle fd, size_t offset
     return static_cast<uint8_t*>(memory);
 }
 
+bool MemoryMappedFile::adviseHugePages()
+{
+#if defined(MADV_HUGEPAGE)
+    return 0 == ::madvise(m_memory, m_memorySize, MADV_HUGEPAGE);
+#else
+    return false;
+#endif
+}
+
+bool MemoryMappedFile::preTouch()
+{
+#if defined(MADV_POPULATE_WRITE)
+    if (0 == ::madvise(m_memory, m_memorySize, MADV_POPULATE_WRITE))
+    {
+        return true;
+    }
+#endif
+
+#if defined(MADV_WILLNEED)
+    ::madvise(m_memory, m_memorySize, MADV_WILLNEED);
+#endif
+
+    // a racing writer may own these pages so only read them
+    const volatile std::uint8_t *memory = m_memory;
+    std::uint8_t sum = 0;
+
+    for (size_t offset = 0; offset < m_memorySize; offset += m_page_size)
+    {
+        sum += memory[offset];
+    }
+
+    (void)sum;
+
+    return false;
+}
+
+bool MemoryMappedFile::lock()
+{
+    return 0 == ::mlock(m_memory, m_memorySize);
+}
+
+bool MemoryMappedFile::adviseRandom()
+{
+#if defined(MADV_RANDOM)
+    return 0 == ::madvise(m_memory, m_memorySize, MADV_RANDOM);
+#else
+    return false;
+#endif
+}
+
+bool MemoryMappedFile::release(size_t offset, size_t length)
+{
+#if defined(MADV_DONTNEED)
+    return 0 == ::madvise(m_memory + offset, length, MADV_DONTNEED);
+#else
+    return false;
+#endif
+}
+
 size_t MemoryMappedFile::getPageSize()
 {
     return static_cast<size_t>(::getpagesize());
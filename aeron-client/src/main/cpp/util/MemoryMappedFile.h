@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <sys/types.h>
 
 #ifdef _WIN32
 #ifndef NOMINMAX
@@ -50,6 +51,49 @@ public:
     uint8_t* getMemoryPtr() const;
     size_t getMemorySize() const;
 
+    /**
+     * Advise the OS to back the mapping with huge pages. This is best effort and a no-op where unsupported.
+     *
+     * @return true if the advice was accepted.
+     */
+    bool adviseHugePages();
+
+    /**
+     * Fault in the pages of the mapping now rather than on first touch. Populates writable page table entries where the
+     * OS supports it, otherwise the pages are read once, which leaves the first write to each page cheaper but not
+     * free. The contents of the mapping are not changed.
+     *
+     * @return true if the pages were populated for writing.
+     */
+    bool preTouch();
+
+    /**
+     * Lock the pages of the mapping in memory so they are not paged out. Needs a memlock limit covering the mapping
+     * and is a no-op where unsupported. The lock is released when the mapping is unmapped.
+     *
+     * @return true if the pages were locked.
+     */
+    bool lock();
+
+    /**
+     * Advise the OS that the mapping is read at random, so a fault maps only the page touched rather than reading
+     * around it. Best effort and a no-op where unsupported.
+     *
+     * @return true if the advice was accepted.
+     */
+    bool adviseRandom();
+
+    /**
+     * Drop the pages of a range from this mapping so they no longer count to the resident set of the process. As the
+     * mapping is shared the contents are kept and the pages are faulted in again from the file when next touched.
+     * A no-op where unsupported.
+     *
+     * @param offset of the range in the mapping, a multiple of the page size.
+     * @param length of the range.
+     * @return true if the pages were dropped.
+     */
+    bool release(size_t offset, size_t length);
+
     MemoryMappedFile(MemoryMappedFile const&) = delete;
     MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
 
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef INCLUDED_AERON_UTIL_PROBES_FILE__
+#define INCLUDED_AERON_UTIL_PROBES_FILE__
+
+/*
+ * Static tracepoints for bpftrace, perf and systemtap, in the aeron_client provider, built in with the AERON_PROBES
+ * CMake option as for the driver. Without it the probes and their arguments compile away.
+ */
+#if defined(AERON_PROBES)
+
+#include <sys/sdt.h>
+
+#define AERON_CLIENT_PROBE3(name, a1, a2, a3) DTRACE_PROBE3(aeron_client, name, a1, a2, a3)
+
+#else
+
+#define AERON_CLIENT_PROBE3(name, a1, a2, a3)
+
+#endif
+
+#endif
@@ -0,0 +1,200 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AsyncScheduler.h"
+#include "concurrent/AgentInvoker.h"
+#include "concurrent/BusySpinIdleStrategy.h"
+
+using namespace aeron::concurrent;
+using namespace aeron;
+
+class FakeSubscription
+{
+public:
+    FakeSubscription() : m_buffer(m_data.data(), static_cast<util::index_t>(m_data.size())), m_header(0, 1024)
+    {
+        m_data.fill(0);
+    }
+
+    void append(std::int32_t value)
+    {
+        m_values.push_back(value);
+    }
+
+    template<typename F>
+    int poll(F&& fragmentHandler, int fragmentLimit)
+    {
+        int fragmentsRead = 0;
+
+        m_pollCount++;
+        while (fragmentsRead < fragmentLimit && !m_values.empty())
+        {
+            m_buffer.putInt32(0, m_values.front());
+            m_values.pop_front();
+            fragmentHandler(m_buffer, 0, static_cast<util::index_t>(sizeof(std::int32_t)), m_header);
+            fragmentsRead++;
+        }
+
+        return fragmentsRead;
+    }
+
+    int m_pollCount = 0;
+
+private:
+    std::array<std::uint8_t, 64> m_data;
+    AtomicBuffer m_buffer;
+    logbuffer::Header m_header;
+    std::deque<std::int32_t> m_values;
+};
+
+class FakePublication
+{
+public:
+    std::int64_t offer(AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        m_offerCount++;
+        if (!m_results.empty())
+        {
+            const std::int64_t result = m_results.front();
+            m_results.pop_front();
+
+            return result;
+        }
+
+        m_values.push_back(buffer.getInt32(offset));
+        m_position += length;
+
+        return m_position;
+    }
+
+    std::deque<std::int64_t> m_results;
+    std::vector<std::int32_t> m_values;
+    std::int64_t m_position = 0;
+    int m_offerCount = 0;
+};
+
+static AsyncTask relay(
+    AsyncScheduler& scheduler, FakeSubscription& subscription, FakePublication& publication, int count,
+    std::vector<std::int64_t>& results)
+{
+    std::array<std::uint8_t, 4> data;
+    AtomicBuffer buffer(data.data(), static_cast<util::index_t>(data.size()));
+
+    for (int i = 0; i < count; i++)
+    {
+        AsyncFragment fragment = co_await scheduler.nextFragment(subscription);
+
+        buffer.putInt32(0, fragment.buffer->getInt32(fragment.offset) * 10);
+        results.push_back(co_await scheduler.offerAsync(publication, buffer));
+    }
+}
+
+static AsyncTask failAfterFragment(AsyncScheduler& scheduler, FakeSubscription& subscription)
+{
+    co_await scheduler.nextFragment(subscription);
+    throw std::runtime_error("handler failed");
+}
+
+TEST(AsyncSchedulerTest, shouldSuspendUntilFragmentArrives)
+{
+    AsyncScheduler scheduler;
+    FakeSubscription subscription;
+    FakePublication publication;
+    std::vector<std::int64_t> results;
+
+    scheduler.spawn(relay(scheduler, subscription, publication, 2, results));
+    EXPECT_EQ(scheduler.taskCount(), 1u);
+    EXPECT_EQ(scheduler.doWork(), 0);
+
+    subscription.append(1);
+    EXPECT_EQ(scheduler.doWork(), 1);
+    EXPECT_EQ(publication.m_values, std::vector<std::int32_t>({ 10 }));
+    EXPECT_EQ(results, std::vector<std::int64_t>({ 4 }));
+
+    subscription.append(2);
+    EXPECT_EQ(scheduler.doWork(), 1);
+    EXPECT_EQ(publication.m_values, std::vector<std::int32_t>({ 10, 20 }));
+    EXPECT_EQ(scheduler.taskCount(), 0u);
+}
+
+TEST(AsyncSchedulerTest, shouldRetryOfferOnlyForBackPressure)
+{
+    AsyncScheduler scheduler;
+    FakeSubscription subscription;
+    FakePublication publication;
+    std::vector<std::int64_t> results;
+
+    publication.m_results = { BACK_PRESSURED, NOT_CONNECTED, ADMIN_ACTION, PUBLICATION_CLOSED };
+    subscription.append(1);
+    subscription.append(2);
+    scheduler.spawn(relay(scheduler, subscription, publication, 2, results));
+    EXPECT_EQ(scheduler.doWork(), 1);
+    EXPECT_EQ(publication.m_offerCount, 1);
+
+    EXPECT_EQ(scheduler.doWork(), 0);
+    EXPECT_EQ(scheduler.doWork(), 0);
+    EXPECT_EQ(scheduler.doWork(), 1);
+    EXPECT_EQ(publication.m_offerCount, 4);
+    EXPECT_EQ(results, std::vector<std::int64_t>({ PUBLICATION_CLOSED }));
+
+    EXPECT_EQ(scheduler.doWork(), 1);
+    EXPECT_EQ(results, std::vector<std::int64_t>({ PUBLICATION_CLOSED, 4 }));
+    EXPECT_EQ(scheduler.taskCount(), 0u);
+}
+
+TEST(AsyncSchedulerTest, shouldPollOncePerWaiterAndRunUnderInvoker)
+{
+    AsyncScheduler scheduler;
+    FakeSubscription subscription;
+    FakePublication publication;
+    std::vector<std::int64_t> results;
+
+    scheduler.spawn(relay(scheduler, subscription, publication, 1, results));
+    scheduler.spawn(relay(scheduler, subscription, publication, 1, results));
+
+    logbuffer::exception_handler_t exceptionHandler = [](const std::exception&) {};
+    AgentInvoker<AsyncScheduler> invoker(scheduler, exceptionHandler);
+    invoker.start();
+    EXPECT_EQ(invoker.invoke(), 0);
+    EXPECT_EQ(subscription.m_pollCount, 2);
+
+    subscription.append(1);
+    subscription.append(2);
+    BusySpinIdleStrategy idleStrategy;
+    scheduler.run(idleStrategy);
+
+    EXPECT_EQ(publication.m_values, std::vector<std::int32_t>({ 10, 20 }));
+    EXPECT_EQ(subscription.m_pollCount, 4);
+}
+
+TEST(AsyncSchedulerTest, shouldRethrowFromTaskAfterDestroyingIt)
+{
+    AsyncScheduler scheduler;
+    FakeSubscription subscription;
+
+    scheduler.spawn(failAfterFragment(scheduler, subscription));
+    subscription.append(1);
+
+    EXPECT_THROW(scheduler.doWork(), std::runtime_error);
+    EXPECT_EQ(scheduler.taskCount(), 0u);
+}
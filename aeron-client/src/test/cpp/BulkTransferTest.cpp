@@ -0,0 +1,177 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BulkTransfer.h"
+#include "util/TestUtils.h"
+
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::logbuffer;
+using namespace aeron;
+
+static const util::index_t MAX_PAYLOAD_LENGTH = 1024;
+
+struct ClaimingPublication
+{
+    std::vector<std::vector<std::uint8_t>> frames;
+    std::size_t claimLimit = SIZE_MAX;
+
+    util::index_t maxPayloadLength() const
+    {
+        return MAX_PAYLOAD_LENGTH;
+    }
+
+    std::int64_t tryClaim(util::index_t length, BufferClaim& bufferClaim)
+    {
+        EXPECT_LE(length, MAX_PAYLOAD_LENGTH);
+
+        if (frames.size() >= claimLimit)
+        {
+            return BACK_PRESSURED;
+        }
+
+        frames.emplace_back(static_cast<std::size_t>(DataFrameHeader::LENGTH + length));
+        bufferClaim.wrap(frames.back().data(), static_cast<util::index_t>(frames.back().size()));
+
+        return static_cast<std::int64_t>(frames.size());
+    }
+};
+
+class BulkTransferTest : public testing::Test
+{
+public:
+    BulkTransferTest() :
+        m_header(0, 64 * 1024),
+        m_filename(test::makeTempFileName())
+    {
+        m_source.resize((5 * MAX_PAYLOAD_LENGTH) + 17);
+        for (std::size_t i = 0; i < m_source.size(); i++)
+        {
+            m_source[i] = static_cast<std::uint8_t>(i * 31);
+        }
+    }
+
+    ~BulkTransferTest() override
+    {
+        ::unlink(m_filename.c_str());
+    }
+
+    void deliver(BulkTransferReceiver& receiver)
+    {
+        fragment_handler_t handler = receiver.handler();
+
+        for (auto& frame : m_publication.frames)
+        {
+            AtomicBuffer buffer(frame.data(), static_cast<util::index_t>(frame.size()));
+            handler(buffer, DataFrameHeader::LENGTH, buffer.capacity() - DataFrameHeader::LENGTH, m_header);
+        }
+
+        m_publication.frames.clear();
+    }
+
+    std::vector<std::uint8_t> readOutput()
+    {
+        util::MemoryMappedFile::ptr_t file = util::MemoryMappedFile::mapExisting(m_filename.c_str());
+
+        return std::vector<std::uint8_t>(file->getMemoryPtr(), file->getMemoryPtr() + file->getMemorySize());
+    }
+
+protected:
+    ClaimingPublication m_publication;
+    Header m_header;
+    std::string m_filename;
+    std::vector<std::uint8_t> m_source;
+};
+
+TEST_F(BulkTransferTest, shouldTransferBufferInChunksThatFillMaxPayloadLength)
+{
+    BulkTransferSender sender(7, m_source.data(), static_cast<std::int64_t>(m_source.size()));
+    BulkTransferReceiver receiver(7, m_filename);
+
+    EXPECT_EQ(sender.send(m_publication), 6);
+    EXPECT_TRUE(sender.isComplete());
+
+    for (std::size_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(
+            m_publication.frames[i].size(), static_cast<std::size_t>(DataFrameHeader::LENGTH + MAX_PAYLOAD_LENGTH));
+    }
+
+    deliver(receiver);
+
+    EXPECT_TRUE(receiver.isComplete());
+    EXPECT_EQ(receiver.length(), static_cast<std::int64_t>(m_source.size()));
+    EXPECT_EQ(readOutput(), m_source);
+}
+
+TEST_F(BulkTransferTest, shouldResumeAfterBackPressure)
+{
+    BulkTransferSender sender(7, m_source.data(), static_cast<std::int64_t>(m_source.size()));
+    BulkTransferReceiver receiver(7, m_filename);
+
+    m_publication.claimLimit = 2;
+    EXPECT_EQ(sender.send(m_publication), 2);
+    EXPECT_EQ(sender.send(m_publication), BACK_PRESSURED);
+    EXPECT_FALSE(sender.isComplete());
+
+    deliver(receiver);
+    EXPECT_FALSE(receiver.isComplete());
+
+    m_publication.claimLimit = SIZE_MAX;
+    EXPECT_EQ(sender.send(m_publication, 3), 3);
+    EXPECT_EQ(sender.send(m_publication), 1);
+    EXPECT_TRUE(sender.isComplete());
+
+    deliver(receiver);
+    EXPECT_TRUE(receiver.isComplete());
+    EXPECT_EQ(readOutput(), m_source);
+}
+
+TEST_F(BulkTransferTest, shouldTransferFileAndIgnoreOtherTransfers)
+{
+    const std::string sourceFilename = test::makeTempFileName();
+    {
+        util::MemoryMappedFile::ptr_t file = util::MemoryMappedFile::createNew(
+            sourceFilename.c_str(), 0, m_source.size());
+        std::memcpy(file->getMemoryPtr(), m_source.data(), m_source.size());
+    }
+
+    BulkTransferSender other(8, m_source.data(), 100);
+    BulkTransferSender sender(7, sourceFilename);
+    BulkTransferReceiver receiver(7, m_filename);
+
+    EXPECT_EQ(other.send(m_publication), 1);
+    while (!sender.isComplete())
+    {
+        ASSERT_GT(sender.send(m_publication, 1), 0);
+    }
+
+    deliver(receiver);
+    ::unlink(sourceFilename.c_str());
+
+    EXPECT_TRUE(receiver.isComplete());
+    EXPECT_EQ(receiver.bytesReceived(), static_cast<std::int64_t>(m_source.size()));
+    EXPECT_EQ(readOutput(), m_source);
+}
+
+TEST_F(BulkTransferTest, shouldRejectEmptyTransfer)
+{
+    EXPECT_THROW(BulkTransferSender(7, m_source.data(), 0), util::IllegalArgumentException);
+}
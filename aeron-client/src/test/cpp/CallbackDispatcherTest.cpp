@@ -0,0 +1,118 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "CallbackDispatcher.h"
+
+using namespace aeron;
+
+TEST(CallbackDispatcherTest, shouldRunCallbacksInOrderEnqueued)
+{
+    CallbackDispatcher dispatcher;
+    std::vector<int> ran;
+
+    EXPECT_EQ(dispatcher.doWork(), 0);
+
+    for (int i = 0; i < 5; i++)
+    {
+        dispatcher.enqueue([&ran, i]() { ran.push_back(i); });
+    }
+
+    EXPECT_EQ(dispatcher.doWork(), 5);
+    EXPECT_EQ(dispatcher.doWork(), 0);
+    EXPECT_EQ(ran, std::vector<int>({ 0, 1, 2, 3, 4 }));
+}
+
+TEST(CallbackDispatcherTest, shouldCarryOnAfterCallbackThrows)
+{
+    CallbackDispatcher dispatcher;
+    std::vector<int> ran;
+
+    dispatcher.enqueue([&ran]() { ran.push_back(0); });
+    dispatcher.enqueue([]() { throw std::runtime_error("callback failed"); });
+    dispatcher.enqueue([&ran]() { ran.push_back(2); });
+
+    EXPECT_THROW(dispatcher.doWork(), std::runtime_error);
+    EXPECT_EQ(dispatcher.doWork(), 1);
+    EXPECT_EQ(ran, std::vector<int>({ 0, 2 }));
+}
+
+TEST(CallbackDispatcherTest, shouldRunCallbacksEnqueuedFromManyThreads)
+{
+    const int threadCount = 4;
+    const int callbackCount = 10000;
+    CallbackDispatcher dispatcher;
+    std::vector<int> lastByThread(threadCount, -1);
+    bool isInOrder = true;
+    int ran = 0;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back(
+            [&, t]()
+            {
+                for (int i = 0; i < callbackCount; i++)
+                {
+                    dispatcher.enqueue(
+                        [&, t, i]()
+                        {
+                            isInOrder = isInOrder && lastByThread[t] == i - 1;
+                            lastByThread[t] = i;
+                            ran++;
+                        });
+                }
+            });
+    }
+
+    while (ran < threadCount * callbackCount)
+    {
+        dispatcher.doWork();
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(dispatcher.doWork(), 0);
+    EXPECT_TRUE(isInOrder);
+}
+
+TEST(CallbackDispatcherTest, shouldCopyExceptionKeepingClientType)
+{
+    std::exception_ptr copy;
+    {
+        util::IllegalStateException exception("bad state", SOURCEINFO);
+        copy = CallbackDispatcher::copyException(exception);
+    }
+
+    EXPECT_THROW(std::rethrow_exception(copy), util::IllegalStateException);
+
+    try
+    {
+        std::rethrow_exception(CallbackDispatcher::copyException(std::logic_error("other")));
+    }
+    catch (const std::runtime_error& ex)
+    {
+        EXPECT_STREQ(ex.what(), "other");
+    }
+}
@@ -69,7 +69,7 @@ public:
 class ClientConductorFixture
 {
 public:
-    ClientConductorFixture() :
+    explicit ClientConductorFixture(bool mapLogBuffersInBackground = false) :
         m_toDriverBuffer(m_toDriver, 0),
         m_toClientsBuffer(m_toClients, 0),
         m_counterMetadataBuffer(m_counterMetadata, 0),
@@ -92,7 +92,11 @@ public:
             std::bind(&testing::NiceMock<MockClientConductorHandlers>::onUnavailableCounter, &m_handlers, _1, _2, _3),
             DRIVER_TIMEOUT_MS,
             RESOURCE_LINGER_TIMEOUT_MS,
-            INTER_SERVICE_TIMEOUT_NS),
+            INTER_SERVICE_TIMEOUT_NS,
+            false,
+            false,
+            false,
+            mapLogBuffersInBackground),
         m_errorHandler(defaultErrorHandler),
         m_onAvailableImageHandler(std::bind(&testing::NiceMock<MockClientConductorHandlers>::onNewImage, &m_handlers, _1)),
         m_onUnavailableImageHandler(std::bind(&testing::NiceMock<MockClientConductorHandlers>::onInactive, &m_handlers, _1)),
@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <thread>
+#include <chrono>
+
 #include <gtest/gtest.h>
 
 #include "ClientConductorFixture.h"
@@ -31,14 +34,16 @@ static const std::int32_t COUNTER_ID = 3;
 static const std::int32_t TERM_LENGTH = LogBufferDescriptor::TERM_MIN_LENGTH;
 static const std::int32_t PAGE_SIZE = LogBufferDescriptor::PAGE_MIN_SIZE;
 static const std::int32_t COUNTER_TYPE_ID = 102;
-static const std::int64_t LOG_FILE_LENGTH = (TERM_LENGTH * 3) + LogBufferDescriptor::LOG_META_DATA_LENGTH;
+static const std::int64_t LOG_FILE_LENGTH =
+    (TERM_LENGTH * LogBufferDescriptor::PARTITION_COUNT) + LogBufferDescriptor::LOG_META_DATA_LENGTH;
 static const std::string SOURCE_IDENTITY = "127.0.0.1:43567";
 static const std::string COUNTER_LABEL = "counter label";
 
 class ClientConductorTest : public testing::Test, public ClientConductorFixture
 {
 public:
-    ClientConductorTest() :
+    explicit ClientConductorTest(bool mapLogBuffersInBackground = false) :
+        ClientConductorFixture(mapLogBuffersInBackground),
         m_logFileName(makeTempFileName()),
         m_logFileName2(makeTempFileName())
     {
@@ -225,6 +230,124 @@ TEST_F(ClientConductorTest, shouldExceptionOnFindWhenReceivingErrorResponseOnAdd
     }, util::RegistrationException);
 }
 
+TEST_F(ClientConductorTest, shouldReturnNullOnFindWhileAwaitingMediaDriver)
+{
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID);
+
+    EXPECT_TRUE(m_conductor.isAwaitingMediaDriver(id));
+    EXPECT_TRUE(m_conductor.findPublication(id) == nullptr);
+
+    m_currentTime += DRIVER_TIMEOUT_MS;
+
+    EXPECT_TRUE(m_conductor.isAwaitingMediaDriver(id));
+    EXPECT_TRUE(m_conductor.findPublication(id) == nullptr);
+}
+
+TEST_F(ClientConductorTest, shouldNoLongerBeAwaitingMediaDriverPastDriverTimeout)
+{
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID);
+
+    m_currentTime += DRIVER_TIMEOUT_MS + 1;
+
+    EXPECT_FALSE(m_conductor.isAwaitingMediaDriver(id));
+    EXPECT_THROW(
+    {
+        std::shared_ptr<Publication> pub = m_conductor.findPublication(id);
+    }, util::DriverTimeoutException);
+}
+
+TEST_F(ClientConductorTest, shouldFindPublicationOnceNoLongerAwaitingMediaDriver)
+{
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID);
+    std::int64_t otherId = m_conductor.addPublication(CHANNEL, STREAM_ID + 1);
+
+    m_conductor.onNewPublication(
+        STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID, m_logFileName, id, id);
+
+    EXPECT_FALSE(m_conductor.isAwaitingMediaDriver(id));
+    EXPECT_TRUE(m_conductor.isAwaitingMediaDriver(otherId));
+
+    std::shared_ptr<Publication> pub = m_conductor.findPublication(id);
+
+    ASSERT_TRUE(pub != nullptr);
+    EXPECT_EQ(pub->registrationId(), id);
+    EXPECT_TRUE(m_conductor.findPublication(otherId) == nullptr);
+}
+
+TEST_F(ClientConductorTest, shouldNoLongerBeAwaitingMediaDriverOnErrorResponse)
+{
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID);
+    std::int64_t subId = m_conductor.addSubscription(
+        CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+
+    m_conductor.onErrorResponse(id, ERROR_CODE_INVALID_CHANNEL, "invalid channel");
+
+    EXPECT_FALSE(m_conductor.isAwaitingMediaDriver(id));
+    EXPECT_TRUE(m_conductor.isAwaitingMediaDriver(subId));
+    EXPECT_THROW(
+    {
+        std::shared_ptr<Publication> pub = m_conductor.findPublication(id);
+    }, util::RegistrationException);
+}
+
+TEST_F(ClientConductorTest, shouldNoLongerBeAwaitingMediaDriverOnInterServiceTimeout)
+{
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID);
+    std::int64_t subId = m_conductor.addSubscription(
+        CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+
+    ASSERT_TRUE(m_conductor.isAwaitingMediaDriver(id));
+    ASSERT_TRUE(m_conductor.isAwaitingMediaDriver(subId));
+
+    m_conductor.onInterServiceTimeout(m_currentTime);
+
+    EXPECT_FALSE(m_conductor.isAwaitingMediaDriver(id));
+    EXPECT_FALSE(m_conductor.isAwaitingMediaDriver(subId));
+    EXPECT_TRUE(m_conductor.findPublication(id) == nullptr);
+    EXPECT_TRUE(m_conductor.findSubscription(subId) == nullptr);
+}
+
+TEST_F(ClientConductorTest, shouldCallAddPublicationHandlerAfterLogBuffersCreated)
+{
+    std::shared_ptr<Publication> added;
+    int calls = 0;
+
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID,
+        [&](std::shared_ptr<Publication> pub, std::exception_ptr error)
+        {
+            EXPECT_FALSE(error);
+            added = pub;
+            ++calls;
+        });
+
+    EXPECT_EQ(calls, 0);
+
+    m_conductor.onNewPublication(
+        STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID, m_logFileName, id, id);
+
+    ASSERT_EQ(calls, 1);
+    ASSERT_TRUE(added != nullptr);
+    EXPECT_EQ(added->registrationId(), id);
+    EXPECT_TRUE(added == m_conductor.findPublication(id));
+}
+
+TEST_F(ClientConductorTest, shouldCallAddPublicationHandlerWhenReceivingErrorResponse)
+{
+    std::exception_ptr received;
+
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID,
+        [&](std::shared_ptr<Publication> pub, std::exception_ptr error)
+        {
+            EXPECT_TRUE(pub == nullptr);
+            received = error;
+        });
+
+    m_conductor.onErrorResponse(id, ERROR_CODE_INVALID_CHANNEL, "invalid channel");
+
+    ASSERT_TRUE(received != nullptr);
+    EXPECT_THROW(std::rethrow_exception(received), util::RegistrationException);
+}
+
 TEST_F(ClientConductorTest, shouldReturnNullForUnknownExclusivePublication)
 {
     std::shared_ptr<ExclusivePublication> pub = m_conductor.findExclusivePublication(100);
@@ -419,6 +542,30 @@ TEST_F(ClientConductorTest, shouldReturnSubscriptionAfterOperationSuccess)
     EXPECT_EQ(sub->streamId(), STREAM_ID);
 }
 
+TEST_F(ClientConductorTest, shouldCallAddSubscriptionHandlerForEachOfBatch)
+{
+    std::vector<std::int64_t> added;
+    std::vector<std::pair<std::string, std::int32_t>> channelsAndStreamIds =
+        { { CHANNEL, STREAM_ID }, { CHANNEL, STREAM_ID + 1 } };
+
+    std::vector<std::int64_t> ids = m_conductor.addSubscriptions(
+        channelsAndStreamIds, m_onAvailableImageHandler, m_onUnavailableImageHandler,
+        [&](std::shared_ptr<Subscription> sub, std::exception_ptr error)
+        {
+            ASSERT_TRUE(sub != nullptr);
+            added.push_back(sub->registrationId());
+        });
+
+    ASSERT_EQ(ids.size(), 2u);
+
+    m_conductor.onSubscriptionReady(ids[1], CHANNEL_STATUS_INDICATOR_ID);
+    m_conductor.onSubscriptionReady(ids[0], CHANNEL_STATUS_INDICATOR_ID);
+
+    ASSERT_EQ(added.size(), 2u);
+    EXPECT_EQ(added[0], ids[1]);
+    EXPECT_EQ(added[1], ids[0]);
+}
+
 TEST_F(ClientConductorTest, shouldReleaseSubscriptionAfterGoingOutOfScope)
 {
     std::int64_t id = m_conductor.addSubscription(CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
@@ -658,6 +805,32 @@ TEST_F(ClientConductorTest, shouldCallNewConnectionAfterOnNewConnection)
     ASSERT_TRUE(sub->hasImage(correlationId));
 }
 
+TEST_F(ClientConductorTest, shouldShareLogBuffersOfImagesMappingTheSameLog)
+{
+    std::int64_t id1 = m_conductor.addSubscription(CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+    std::int64_t id2 = m_conductor.addSubscription(CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+
+    EXPECT_CALL(m_handlers, onNewSub(CHANNEL, STREAM_ID, testing::_))
+        .Times(2);
+    EXPECT_CALL(m_handlers, onNewImage(testing::_))
+        .Times(3);
+
+    m_conductor.onSubscriptionReady(id1, CHANNEL_STATUS_INDICATOR_ID);
+    m_conductor.onSubscriptionReady(id2, CHANNEL_STATUS_INDICATOR_ID);
+    m_conductor.onAvailableImage(STREAM_ID, SESSION_ID, m_logFileName, SOURCE_IDENTITY, 1, id1, id2 + 1);
+    m_conductor.onAvailableImage(STREAM_ID, SESSION_ID, m_logFileName, SOURCE_IDENTITY, 1, id2, id2 + 2);
+    m_conductor.onAvailableImage(STREAM_ID, SESSION_ID, m_logFileName2, SOURCE_IDENTITY, 1, id2, id2 + 3);
+
+    std::shared_ptr<Subscription> sub1 = m_conductor.findSubscription(id1);
+    std::shared_ptr<Subscription> sub2 = m_conductor.findSubscription(id2);
+    ASSERT_TRUE(sub1 != nullptr);
+    ASSERT_TRUE(sub2 != nullptr);
+    ASSERT_EQ(sub2->imageCount(), 2);
+
+    EXPECT_TRUE(sub1->imageAtIndex(0).logBuffers() == sub2->imageAtIndex(0).logBuffers());
+    EXPECT_FALSE(sub2->imageAtIndex(0).logBuffers() == sub2->imageAtIndex(1).logBuffers());
+}
+
 TEST_F(ClientConductorTest, shouldNotCallNewConnectionIfNoOperationSuccess)
 {
     std::int64_t id = m_conductor.addSubscription(CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
@@ -832,7 +1005,8 @@ TEST_F(ClientConductorTest, shouldCloseAllPublicationsAndSubscriptionsOnInterSer
 {
     std::int64_t pubId = m_conductor.addPublication(CHANNEL, STREAM_ID);
     std::int64_t exPubId = m_conductor.addExclusivePublication(CHANNEL, STREAM_ID);
-    std::int64_t subId = m_conductor.addSubscription(CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+    std::int64_t subId = m_conductor.addSubscription(
+        CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
 
     m_conductor.onNewPublication(
         STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID, m_logFileName, pubId, pubId);
@@ -1058,3 +1232,184 @@ TEST_F(ClientConductorTest, shouldCallOnUnavailableCounter)
 
     m_conductor.onUnavailableCounter(id, COUNTER_ID);
 }
+
+TEST_F(ClientConductorTest, shouldSendKeepaliveWhenNoHeartbeatTimestampAllocated)
+{
+    static std::int32_t CLIENT_KEEPALIVE = ControlProtocolEvents::CLIENT_KEEPALIVE;
+
+    m_currentTime += KEEPALIVE_TIMEOUT_MS + 1;
+    m_conductor.doWork();
+
+    int count = m_manyToOneRingBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            EXPECT_EQ(msgTypeId, CLIENT_KEEPALIVE);
+        });
+
+    EXPECT_EQ(count, 1);
+}
+
+TEST_F(ClientConductorTest, shouldUpdateHeartbeatTimestampInsteadOfSendingKeepalive)
+{
+    CountersManager countersManager(m_counterMetadataBuffer, m_counterValuesBuffer);
+    const std::int64_t clientId = m_driverProxy.clientId();
+    const std::int32_t counterId = countersManager.allocate(
+        "client-heartbeat",
+        HeartbeatTimestamp::CLIENT_HEARTBEAT_TYPE_ID,
+        [&](AtomicBuffer& keyBuffer)
+        {
+            keyBuffer.putInt64(HeartbeatTimestamp::REGISTRATION_ID_OFFSET, clientId);
+        });
+
+    m_currentTime += KEEPALIVE_TIMEOUT_MS + 1;
+    m_conductor.doWork();
+
+    int count = m_manyToOneRingBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+        });
+
+    EXPECT_EQ(count, 0);
+    EXPECT_EQ(countersManager.getCounterValue(counterId), m_currentTime);
+}
+
+TEST_F(ClientConductorTest, shouldWriteBatchedCommandsToDriverOnlyWhenBatchCompletes)
+{
+    static std::int32_t ADD_PUBLICATION = ControlProtocolEvents::ADD_PUBLICATION;
+    static std::int32_t REMOVE_PUBLICATION = ControlProtocolEvents::REMOVE_PUBLICATION;
+    std::int64_t pubId = 0;
+
+    m_conductor.batchCommands(
+        [&]()
+        {
+            pubId = m_conductor.addPublication(CHANNEL, STREAM_ID);
+            m_conductor.releasePublication(pubId);
+
+            EXPECT_EQ(m_manyToOneRingBuffer.producerPosition(), 0);
+        });
+
+    std::vector<std::int32_t> msgTypeIds;
+
+    int count = m_manyToOneRingBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            msgTypeIds.push_back(msgTypeId);
+
+            if (ADD_PUBLICATION == msgTypeId)
+            {
+                EXPECT_EQ(PublicationMessageFlyweight(buffer, offset).correlationId(), pubId);
+            }
+            else
+            {
+                EXPECT_EQ(RemoveMessageFlyweight(buffer, offset).registrationId(), pubId);
+            }
+        });
+
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(msgTypeIds[0], ADD_PUBLICATION);
+    EXPECT_EQ(msgTypeIds[1], REMOVE_PUBLICATION);
+}
+
+TEST_F(ClientConductorTest, shouldSplitCommandBatchLongerThanMaxMessageLength)
+{
+    const int numPublications = 4;
+    std::vector<std::int64_t> pubIds;
+
+    m_conductor.batchCommands(
+        [&]()
+        {
+            for (int i = 0; i < numPublications; i++)
+            {
+                pubIds.push_back(m_conductor.addPublication(CHANNEL, STREAM_ID + i));
+            }
+        });
+
+    std::vector<std::int64_t> correlationIds;
+
+    int count = m_manyToOneRingBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            correlationIds.push_back(PublicationMessageFlyweight(buffer, offset).correlationId());
+        });
+
+    EXPECT_EQ(count, numPublications);
+    EXPECT_EQ(correlationIds, pubIds);
+}
+
+class ClientConductorBackgroundMappingTest : public ClientConductorTest
+{
+public:
+    ClientConductorBackgroundMappingTest() : ClientConductorTest(true)
+    {
+    }
+
+    template <typename F>
+    void doWorkUntil(F&& condition)
+    {
+        for (int i = 0; i < 5000 && !condition(); i++)
+        {
+            m_conductor.doWork();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+TEST_F(ClientConductorBackgroundMappingTest, shouldReturnPublicationOnceLogBuffersMapped)
+{
+    std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID);
+
+    m_conductor.onNewPublication(
+        STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID, m_logFileName, id, id);
+
+    EXPECT_TRUE(m_conductor.findPublication(id) == nullptr);
+
+    std::shared_ptr<Publication> pub;
+    doWorkUntil([&]() { pub = m_conductor.findPublication(id); return pub != nullptr; });
+
+    ASSERT_TRUE(pub != nullptr);
+    EXPECT_EQ(pub->sessionId(), SESSION_ID);
+}
+
+TEST_F(ClientConductorBackgroundMappingTest, shouldMakeImageAvailableOnceLogBuffersMapped)
+{
+    std::int64_t id = m_conductor.addSubscription(
+        CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+    std::int64_t correlationId = id + 1;
+
+    EXPECT_CALL(m_handlers, onNewImage(testing::_))
+        .Times(1);
+
+    m_conductor.onSubscriptionReady(id, CHANNEL_STATUS_INDICATOR_ID);
+    std::shared_ptr<Subscription> sub = m_conductor.findSubscription(id);
+    ASSERT_TRUE(sub != nullptr);
+
+    m_conductor.onAvailableImage(STREAM_ID, SESSION_ID, m_logFileName, SOURCE_IDENTITY, 1, id, correlationId);
+    EXPECT_FALSE(sub->hasImage(correlationId));
+
+    doWorkUntil([&]() { return sub->hasImage(correlationId); });
+    EXPECT_TRUE(sub->hasImage(correlationId));
+}
+
+TEST_F(ClientConductorBackgroundMappingTest, shouldDropImageGoneUnavailableBeforeLogBuffersMapped)
+{
+    std::int64_t id = m_conductor.addSubscription(
+        CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+    std::int64_t correlationId = id + 1;
+    std::int64_t correlationId2 = id + 2;
+
+    EXPECT_CALL(m_handlers, onNewImage(testing::_))
+        .Times(1);
+
+    m_conductor.onSubscriptionReady(id, CHANNEL_STATUS_INDICATOR_ID);
+    std::shared_ptr<Subscription> sub = m_conductor.findSubscription(id);
+    ASSERT_TRUE(sub != nullptr);
+
+    m_conductor.onAvailableImage(STREAM_ID, SESSION_ID, m_logFileName, SOURCE_IDENTITY, 1, id, correlationId);
+    m_conductor.onUnavailableImage(STREAM_ID, correlationId, id);
+    // logs are mapped in order so the first is done once the second is
+    m_conductor.onAvailableImage(STREAM_ID, SESSION_ID, m_logFileName2, SOURCE_IDENTITY, 1, id, correlationId2);
+
+    doWorkUntil([&]() { return sub->hasImage(correlationId2); });
+    EXPECT_TRUE(sub->hasImage(correlationId2));
+    EXPECT_FALSE(sub->hasImage(correlationId));
+}
@@ -0,0 +1,377 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+#include <cstring>
+#include <limits>
+
+#include <benchmark/benchmark.h>
+
+#include <concurrent/ringbuffer/ManyToOneRingBuffer.h>
+#include <concurrent/broadcast/CopyBroadcastReceiver.h>
+#include <concurrent/logbuffer/LogBufferDescriptor.h>
+#include <concurrent/logbuffer/TermReader.h>
+#include "ClientConductor.h"
+#include "Publication.h"
+#include "ExclusivePublication.h"
+#include "Image.h"
+#include "FragmentAssembler.h"
+
+using namespace aeron::concurrent::ringbuffer;
+using namespace aeron::concurrent::broadcast;
+using namespace aeron::concurrent::logbuffer;
+using namespace aeron::concurrent;
+using namespace aeron;
+
+#define TERM_LENGTH (1024 * 1024)
+#define MTU_LENGTH (1408)
+#define RING_BUFFER_LENGTH (64 * 1024)
+#define COUNTERS_BUFFER_LENGTH (64 * 1024)
+
+static const std::string CHANNEL = "aeron:udp?endpoint=localhost:40123";
+static const std::int32_t STREAM_ID = 10;
+static const std::int32_t SESSION_ID = 200;
+static const std::int64_t REGISTRATION_ID = 100;
+static const std::int32_t INITIAL_TERM_ID = 1;
+static const std::int32_t PUBLICATION_LIMIT_COUNTER_ID = 0;
+static const std::int32_t SUBSCRIBER_POSITION_COUNTER_ID = 1;
+
+/*
+ * A client conductor and a log held in process memory, standing in for the driver so publications and images can be
+ * driven directly. Nothing ever reads the to-driver buffer so the conductor is only there to satisfy the constructors.
+ */
+class InProcessLog
+{
+public:
+    InProcessLog() :
+        m_toDriver(new std::uint8_t[RING_BUFFER_LENGTH + RingBufferDescriptor::TRAILER_LENGTH]()),
+        m_toClients(new std::uint8_t[RING_BUFFER_LENGTH + BroadcastBufferDescriptor::TRAILER_LENGTH]()),
+        m_counterMetadata(new std::uint8_t[COUNTERS_BUFFER_LENGTH * 2]()),
+        m_counterValues(new std::uint8_t[COUNTERS_BUFFER_LENGTH]()),
+        m_log(new std::uint8_t[(TERM_LENGTH * LogBufferDescriptor::PARTITION_COUNT) +
+            LogBufferDescriptor::LOG_META_DATA_LENGTH]()),
+        m_toDriverBuffer(m_toDriver.get(), RING_BUFFER_LENGTH + RingBufferDescriptor::TRAILER_LENGTH),
+        m_toClientsBuffer(m_toClients.get(), RING_BUFFER_LENGTH + BroadcastBufferDescriptor::TRAILER_LENGTH),
+        m_counterMetadataBuffer(m_counterMetadata.get(), COUNTERS_BUFFER_LENGTH * 2),
+        m_counterValuesBuffer(m_counterValues.get(), COUNTERS_BUFFER_LENGTH),
+        m_ringBuffer(m_toDriverBuffer),
+        m_broadcastReceiver(m_toClientsBuffer),
+        m_driverProxy(m_ringBuffer),
+        m_copyBroadcastReceiver(m_broadcastReceiver),
+        m_conductor(
+            []() { return 0L; },
+            m_driverProxy,
+            m_copyBroadcastReceiver,
+            m_counterMetadataBuffer,
+            m_counterValuesBuffer,
+            [](const std::string&, std::int32_t, std::int32_t, std::int64_t) {},
+            [](const std::string&, std::int32_t, std::int64_t) {},
+            [](const std::exception&) {},
+            [](CountersReader&, std::int64_t, std::int32_t) {},
+            [](CountersReader&, std::int64_t, std::int32_t) {},
+            std::numeric_limits<long>::max() / 2,
+            5000,
+            std::numeric_limits<long long>::max() / 2),
+        m_logBuffers(std::make_shared<LogBuffers>(
+            m_log.get(),
+            static_cast<std::int64_t>((TERM_LENGTH * LogBufferDescriptor::PARTITION_COUNT) +
+                LogBufferDescriptor::LOG_META_DATA_LENGTH),
+            TERM_LENGTH)),
+        m_publicationLimit(m_counterValuesBuffer, PUBLICATION_LIMIT_COUNTER_ID),
+        m_subscriberPosition(m_counterValuesBuffer, SUBSCRIBER_POSITION_COUNTER_ID)
+    {
+        AtomicBuffer logMetaDataBuffer = m_logBuffers->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX);
+
+        logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_MTU_LENGTH_OFFSET, MTU_LENGTH);
+        logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_TERM_LENGTH_OFFSET, TERM_LENGTH);
+        logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_PAGE_SIZE_OFFSET, LogBufferDescriptor::PAGE_MIN_SIZE);
+        logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_INITIAL_TERM_ID_OFFSET, INITIAL_TERM_ID);
+        LogBufferDescriptor::initializeTailWithTermId(logMetaDataBuffer, 0, INITIAL_TERM_ID);
+        for (int i = 1; i < LogBufferDescriptor::PARTITION_COUNT; i++)
+        {
+            LogBufferDescriptor::initializeTailWithTermId(
+                logMetaDataBuffer, i, (INITIAL_TERM_ID + i) - LogBufferDescriptor::PARTITION_COUNT);
+        }
+
+        AtomicBuffer defaultHeader = LogBufferDescriptor::defaultFrameHeader(logMetaDataBuffer);
+        defaultHeader.putInt32(DataFrameHeader::SESSION_ID_FIELD_OFFSET, SESSION_ID);
+        defaultHeader.putInt32(DataFrameHeader::STREAM_ID_FIELD_OFFSET, STREAM_ID);
+
+        /* there is no consumer to apply back pressure, the log just wraps */
+        m_publicationLimit.set(std::numeric_limits<std::int64_t>::max());
+        m_subscriberPosition.set(0);
+    }
+
+    std::unique_ptr<Publication> publication()
+    {
+        return std::unique_ptr<Publication>(new Publication(
+            m_conductor, CHANNEL, REGISTRATION_ID, REGISTRATION_ID, STREAM_ID, SESSION_ID, m_publicationLimit,
+            ChannelEndpointStatus::NO_ID_ALLOCATED, m_logBuffers));
+    }
+
+    std::unique_ptr<ExclusivePublication> exclusivePublication()
+    {
+        return std::unique_ptr<ExclusivePublication>(new ExclusivePublication(
+            m_conductor, CHANNEL, REGISTRATION_ID, REGISTRATION_ID, STREAM_ID, SESSION_ID, m_publicationLimit,
+            ChannelEndpointStatus::NO_ID_ALLOCATED, m_logBuffers));
+    }
+
+    std::unique_ptr<Image> image()
+    {
+        return std::unique_ptr<Image>(new Image(
+            SESSION_ID, REGISTRATION_ID, REGISTRATION_ID, "127.0.0.1:40123", m_subscriberPosition, m_logBuffers,
+            [](const std::exception&) {}));
+    }
+
+    /*
+     * Publish messages of the given length until every partition is full. Each term then has the same layout so a
+     * reader can go round the partitions indefinitely without the log having to be rewritten.
+     */
+    void fill(util::index_t messageLength)
+    {
+        std::unique_ptr<ExclusivePublication> publication = exclusivePublication();
+        std::vector<std::uint8_t> message(static_cast<size_t>(messageLength), 0x5A);
+        AtomicBuffer buffer(message.data(), messageLength);
+
+        while (publication->position() < static_cast<std::int64_t>(TERM_LENGTH) * LogBufferDescriptor::PARTITION_COUNT)
+        {
+            publication->offer(buffer, 0, messageLength);
+        }
+    }
+
+    AtomicBuffer termBuffer(int index)
+    {
+        return m_logBuffers->atomicBuffer(index);
+    }
+
+private:
+    std::unique_ptr<std::uint8_t[]> m_toDriver;
+    std::unique_ptr<std::uint8_t[]> m_toClients;
+    std::unique_ptr<std::uint8_t[]> m_counterMetadata;
+    std::unique_ptr<std::uint8_t[]> m_counterValues;
+    std::unique_ptr<std::uint8_t[]> m_log;
+
+    AtomicBuffer m_toDriverBuffer;
+    AtomicBuffer m_toClientsBuffer;
+    AtomicBuffer m_counterMetadataBuffer;
+    AtomicBuffer m_counterValuesBuffer;
+
+    ManyToOneRingBuffer m_ringBuffer;
+    BroadcastReceiver m_broadcastReceiver;
+    DriverProxy m_driverProxy;
+    CopyBroadcastReceiver m_copyBroadcastReceiver;
+    ClientConductor m_conductor;
+
+    std::shared_ptr<LogBuffers> m_logBuffers;
+    UnsafeBufferPosition m_publicationLimit;
+    UnsafeBufferPosition m_subscriberPosition;
+};
+
+static void BM_PublicationOffer(benchmark::State &state)
+{
+    const util::index_t length = static_cast<util::index_t>(state.range(0));
+    std::unique_ptr<InProcessLog> log(new InProcessLog());
+    std::unique_ptr<Publication> publication = log->publication();
+    std::vector<std::uint8_t> message(static_cast<size_t>(length), 0x5A);
+    AtomicBuffer buffer(message.data(), length);
+
+    while (state.KeepRunning())
+    {
+        /* an offer that rotates the term returns ADMIN_ACTION and is retried like an application would */
+        while (publication->offer(buffer, 0, length) < 0)
+        {
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * length);
+}
+
+static void BM_ExclusivePublicationOffer(benchmark::State &state)
+{
+    const util::index_t length = static_cast<util::index_t>(state.range(0));
+    std::unique_ptr<InProcessLog> log(new InProcessLog());
+    std::unique_ptr<ExclusivePublication> publication = log->exclusivePublication();
+    std::vector<std::uint8_t> message(static_cast<size_t>(length), 0x5A);
+    AtomicBuffer buffer(message.data(), length);
+
+    while (state.KeepRunning())
+    {
+        while (publication->offer(buffer, 0, length) < 0)
+        {
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * length);
+}
+
+static void BM_ExclusivePublicationTryClaim(benchmark::State &state)
+{
+    const util::index_t length = static_cast<util::index_t>(state.range(0));
+    std::unique_ptr<InProcessLog> log(new InProcessLog());
+    std::unique_ptr<ExclusivePublication> publication = log->exclusivePublication();
+    BufferClaim bufferClaim;
+
+    while (state.KeepRunning())
+    {
+        while (publication->tryClaim(length, bufferClaim) < 0)
+        {
+        }
+
+        bufferClaim.buffer().putInt64(bufferClaim.offset(), state.iterations());
+        bufferClaim.commit();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * length);
+}
+
+static void BM_ExclusivePublicationTryClaimFragmented(benchmark::State &state)
+{
+    const util::index_t length = static_cast<util::index_t>(state.range(0));
+    std::unique_ptr<InProcessLog> log(new InProcessLog());
+    std::unique_ptr<ExclusivePublication> publication = log->exclusivePublication();
+    FragmentedBufferClaim bufferClaim;
+
+    while (state.KeepRunning())
+    {
+        while (publication->tryClaimFragmented(length, bufferClaim) < 0)
+        {
+        }
+
+        bufferClaim.fragment(0).putInt64(0, state.iterations());
+        bufferClaim.commit();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * length);
+}
+
+/* Poll benchmarks take the message length and the fragment limit; items are fragments, or messages once assembled. */
+static void BM_ImagePoll(benchmark::State &state)
+{
+    const util::index_t length = static_cast<util::index_t>(state.range(0));
+    const int fragmentLimit = static_cast<int>(state.range(1));
+    std::unique_ptr<InProcessLog> log(new InProcessLog());
+    log->fill(length);
+    std::unique_ptr<Image> image = log->image();
+    std::int64_t sum = 0;
+    std::int64_t fragments = 0;
+
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t, Header&)
+    {
+        sum += buffer.getInt64(offset);
+    };
+
+    while (state.KeepRunning())
+    {
+        fragments += image->poll(handler, fragmentLimit);
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(fragments);
+    state.SetBytesProcessed(fragments * length);
+}
+
+static void BM_FragmentAssemblerPoll(benchmark::State &state)
+{
+    const util::index_t length = static_cast<util::index_t>(state.range(0));
+    const int fragmentLimit = static_cast<int>(state.range(1));
+    std::unique_ptr<InProcessLog> log(new InProcessLog());
+    log->fill(length);
+    std::unique_ptr<Image> image = log->image();
+    std::int64_t messages = 0;
+
+    FragmentAssembler assembler(
+        [&](AtomicBuffer&, util::index_t, util::index_t, Header&)
+        {
+            messages++;
+        });
+    fragment_handler_t handler = assembler.handler();
+
+    while (state.KeepRunning())
+    {
+        image->poll(handler, fragmentLimit);
+    }
+
+    state.SetItemsProcessed(messages);
+    state.SetBytesProcessed(messages * length);
+}
+
+static void BM_TermReaderRead(benchmark::State &state)
+{
+    const util::index_t length = static_cast<util::index_t>(state.range(0));
+    const int fragmentLimit = static_cast<int>(state.range(1));
+    std::unique_ptr<InProcessLog> log(new InProcessLog());
+    log->fill(length);
+    AtomicBuffer termBuffer = log->termBuffer(0);
+    Header header(INITIAL_TERM_ID, TERM_LENGTH);
+    exception_handler_t exceptionHandler = [](const std::exception&) {};
+    TermReader::ReadOutcome outcome = { 0, 0 };
+    std::int32_t termOffset = 0;
+    std::int64_t sum = 0;
+    std::int64_t fragments = 0;
+
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t, Header&)
+    {
+        sum += buffer.getInt64(offset);
+    };
+
+    while (state.KeepRunning())
+    {
+        TermReader::read(outcome, termBuffer, termOffset, handler, fragmentLimit, header, exceptionHandler);
+        fragments += outcome.fragmentsRead;
+        termOffset = outcome.offset < TERM_LENGTH ? outcome.offset : 0;
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(fragments);
+    state.SetBytesProcessed(fragments * length);
+}
+
+static void pollArguments(benchmark::internal::Benchmark *benchmark, const std::vector<int>& lengths)
+{
+    for (int length : lengths)
+    {
+        for (int fragmentLimit : { 1, 10, 100 })
+        {
+            benchmark->Args({ length, fragmentLimit });
+        }
+    }
+}
+
+static void unfragmentedPollArguments(benchmark::internal::Benchmark *benchmark)
+{
+    pollArguments(benchmark, { 32, 256, MTU_LENGTH - DataFrameHeader::LENGTH });
+}
+
+static void fragmentedPollArguments(benchmark::internal::Benchmark *benchmark)
+{
+    pollArguments(benchmark, { 4 * 1024, 64 * 1024 });
+}
+
+/* tryClaim is limited to a single frame, larger messages go through tryClaimFragmented */
+BENCHMARK(BM_PublicationOffer)->RangeMultiplier(8)->Range(32, 64 * 1024);
+BENCHMARK(BM_ExclusivePublicationOffer)->RangeMultiplier(8)->Range(32, 64 * 1024);
+BENCHMARK(BM_ExclusivePublicationTryClaim)->Arg(32)->Arg(256)->Arg(MTU_LENGTH - DataFrameHeader::LENGTH);
+BENCHMARK(BM_ExclusivePublicationTryClaimFragmented)->Arg(4 * 1024)->Arg(64 * 1024);
+BENCHMARK(BM_ImagePoll)->Apply(unfragmentedPollArguments);
+BENCHMARK(BM_FragmentAssemblerPoll)->Apply(fragmentedPollArguments);
+BENCHMARK(BM_TermReaderRead)->Apply(unfragmentedPollArguments);
+
+BENCHMARK_MAIN();
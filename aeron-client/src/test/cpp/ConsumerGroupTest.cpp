@@ -0,0 +1,160 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsumerGroup.h"
+
+using namespace aeron::util;
+using namespace aeron;
+
+static const std::int32_t STREAM_ID = 10;
+static const std::int32_t SESSION_ID = 200;
+static const std::int32_t TERM_LENGTH = LogBufferDescriptor::TERM_MIN_LENGTH;
+static const std::int32_t INITIAL_TERM_ID = -1234;
+static const int MEMBER_COUNT = 3;
+
+class ConsumerGroupTest : public testing::Test
+{
+public:
+    ConsumerGroupTest() :
+        m_buffer(m_term.data(), static_cast<util::index_t>(m_term.size())),
+        m_header(INITIAL_TERM_ID, TERM_LENGTH)
+    {
+        m_header.buffer(m_buffer);
+        m_term.fill(0);
+    }
+
+    /* writes a frame and delivers it to every member, returning the index of the member it was delivered to */
+    int deliver(
+        std::vector<std::unique_ptr<ConsumerGroupMember>>& members,
+        std::int32_t termId,
+        std::int32_t termOffset,
+        std::uint8_t flags)
+    {
+        DataFrameHeader::DataFrameHeaderDefn& frame =
+            m_buffer.overlayStruct<DataFrameHeader::DataFrameHeaderDefn>(termOffset);
+
+        frame.frameLength = DataFrameHeader::LENGTH + 32;
+        frame.version = DataFrameHeader::CURRENT_VERSION;
+        frame.flags = flags;
+        frame.type = DataFrameHeader::HDR_TYPE_DATA;
+        frame.termOffset = termOffset;
+        frame.sessionId = SESSION_ID;
+        frame.streamId = STREAM_ID;
+        frame.termId = termId;
+
+        m_header.offset(termOffset);
+        m_delivered = -1;
+        int deliveries = 0;
+
+        for (int i = 0; i < MEMBER_COUNT; i++)
+        {
+            m_receiving = i;
+            const int before = m_deliveries;
+            members[i]->handler()(m_buffer, termOffset + DataFrameHeader::LENGTH, 32, m_header);
+            deliveries += m_deliveries - before;
+        }
+
+        EXPECT_LE(deliveries, 1);
+
+        return m_delivered;
+    }
+
+    std::vector<std::unique_ptr<ConsumerGroupMember>> members(ConsumerGroupPartitioning partitioning)
+    {
+        std::vector<std::unique_ptr<ConsumerGroupMember>> result;
+
+        for (int i = 0; i < MEMBER_COUNT; i++)
+        {
+            result.emplace_back(new ConsumerGroupMember(
+                i,
+                MEMBER_COUNT,
+                [this](AtomicBuffer&, util::index_t, util::index_t, Header&)
+                {
+                    m_delivered = m_receiving;
+                    m_deliveries++;
+                },
+                partitioning));
+        }
+
+        return result;
+    }
+
+protected:
+    std::array<std::uint8_t, TERM_LENGTH> m_term;
+    AtomicBuffer m_buffer;
+    Header m_header;
+    int m_receiving = -1;
+    int m_delivered = -1;
+    int m_deliveries = 0;
+};
+
+TEST_F(ConsumerGroupTest, shouldDeliverEachMessageToExactlyOneMember)
+{
+    auto group = members(ConsumerGroupPartitioning::MESSAGE);
+    std::array<int, MEMBER_COUNT> counts = {};
+    const int messageCount = 300;
+
+    for (int i = 0; i < messageCount; i++)
+    {
+        const int member = deliver(group, INITIAL_TERM_ID, i * 64, FrameDescriptor::UNFRAGMENTED);
+        ASSERT_GE(member, 0);
+        counts[member]++;
+    }
+
+    for (int count : counts)
+    {
+        EXPECT_GT(count, messageCount / (2 * MEMBER_COUNT));
+    }
+}
+
+TEST_F(ConsumerGroupTest, shouldKeepFragmentsOfMessageWithOwnerOfFirstFragment)
+{
+    auto group = members(ConsumerGroupPartitioning::MESSAGE);
+
+    for (int i = 0; i < 30; i++)
+    {
+        const std::int32_t termOffset = i * 3 * 64;
+        const int owner = deliver(group, INITIAL_TERM_ID, termOffset, FrameDescriptor::BEGIN_FRAG);
+
+        EXPECT_EQ(deliver(group, INITIAL_TERM_ID, termOffset + 64, 0), owner);
+        EXPECT_EQ(deliver(group, INITIAL_TERM_ID, termOffset + 128, FrameDescriptor::END_FRAG), owner);
+    }
+}
+
+TEST_F(ConsumerGroupTest, shouldDeliverTermsToMembersInTurn)
+{
+    auto group = members(ConsumerGroupPartitioning::TERM);
+
+    for (int i = 0; i < 2 * MEMBER_COUNT; i++)
+    {
+        EXPECT_EQ(deliver(group, INITIAL_TERM_ID + i, 0, FrameDescriptor::UNFRAGMENTED), i % MEMBER_COUNT);
+        EXPECT_EQ(deliver(group, INITIAL_TERM_ID + i, 64, FrameDescriptor::BEGIN_FRAG), i % MEMBER_COUNT);
+    }
+}
+
+TEST_F(ConsumerGroupTest, shouldRejectInvalidMember)
+{
+    const fragment_handler_t handler = [](AtomicBuffer&, util::index_t, util::index_t, Header&) {};
+
+    EXPECT_THROW(ConsumerGroupMember(0, 0, handler), util::IllegalArgumentException);
+    EXPECT_THROW(ConsumerGroupMember(3, 3, handler), util::IllegalArgumentException);
+    EXPECT_THROW(ConsumerGroupMember(-1, 3, handler), util::IllegalArgumentException);
+}
@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <vector>
+#include <cstring>
+
 #include <gtest/gtest.h>
 
 #include "ClientConductorFixture.h"
@@ -167,6 +170,130 @@ TEST_F(ExclusivePublicationTest, shouldOfferAMessageUponConstruction)
     EXPECT_EQ(m_publication->position(), expectedPosition);
 }
 
+TEST_F(ExclusivePublicationTest, shouldOfferBatchOfMessagesAsSeparateFrames)
+{
+    createPub();
+    const util::index_t lengths[] = { 20, 44, 60 };
+    const AtomicBuffer batch[] =
+        {
+            AtomicBuffer(&m_src[0], lengths[0]),
+            AtomicBuffer(&m_src[100], lengths[1]),
+            AtomicBuffer(&m_src[200], lengths[2])
+        };
+    m_publicationLimit.set(2 * m_srcBuffer.capacity());
+
+    std::int64_t expectedPosition = 0;
+    for (util::index_t length : lengths)
+    {
+        expectedPosition += util::BitUtil::align(length + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    }
+
+    EXPECT_EQ(m_publication->offerBatch(batch, 3), expectedPosition);
+    EXPECT_EQ(m_publication->position(), expectedPosition);
+
+    util::index_t frameOffset = 0;
+    for (util::index_t length : lengths)
+    {
+        EXPECT_EQ(m_termBuffers[0].getInt32(frameOffset), length + DataFrameHeader::LENGTH);
+        frameOffset += util::BitUtil::align(length + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    }
+}
+
+TEST_F(ExclusivePublicationTest, shouldRejectEmptyBatch)
+{
+    createPub();
+    m_publicationLimit.set(2 * m_srcBuffer.capacity());
+
+    EXPECT_THROW(m_publication->offerBatch(&m_srcBuffer, 0), util::IllegalArgumentException);
+}
+
+TEST_F(ExclusivePublicationTest, shouldOfferPartOfBatchUpToPublicationLimit)
+{
+    createPub();
+    const util::index_t alignedLength =
+        util::BitUtil::align(100 + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    AtomicBuffer batch[3] =
+        { AtomicBuffer(m_src.data(), 100), AtomicBuffer(m_src.data(), 100), AtomicBuffer(m_src.data(), 100) };
+    std::size_t messagesOffered = 99;
+    m_publicationLimit.set(alignedLength + 1);
+
+    EXPECT_EQ(m_publication->offerPartialBatch(batch, batch + 3, messagesOffered), 2 * alignedLength);
+    EXPECT_EQ(messagesOffered, 2u);
+    EXPECT_EQ(m_publication->position(), 2 * alignedLength);
+
+    EXPECT_EQ(m_publication->offerPartialBatch(batch + 2, batch + 3, messagesOffered), NOT_CONNECTED);
+    EXPECT_EQ(messagesOffered, 0u);
+    EXPECT_EQ(m_publication->position(), 2 * alignedLength);
+}
+
+TEST_F(ExclusivePublicationTest, shouldOfferPartialBatchPaddingAndRotatingAtEndOfTerm)
+{
+    const util::index_t alignedLength =
+        util::BitUtil::align(100 + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    const int activeIndex = LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1);
+    const std::int32_t initialOffset = TERM_LENGTH - alignedLength - FrameDescriptor::FRAME_ALIGNMENT;
+    m_logMetaDataBuffer.putInt64(termTailCounterOffset(activeIndex), rawTailValue(TERM_ID_1, initialOffset));
+    m_publicationLimit.set(LONG_MAX);
+
+    createPub();
+
+    AtomicBuffer batch[3] =
+        { AtomicBuffer(m_src.data(), 100), AtomicBuffer(m_src.data(), 100), AtomicBuffer(m_src.data(), 100) };
+    std::size_t messagesOffered = 0;
+
+    EXPECT_EQ(m_publication->offerPartialBatch(batch, batch + 3, messagesOffered), TERM_LENGTH + (2 * alignedLength));
+    EXPECT_EQ(messagesOffered, 3u);
+
+    const std::int32_t paddingOffset = initialOffset + alignedLength;
+    EXPECT_EQ(m_termBuffers[activeIndex].getInt32(paddingOffset), FrameDescriptor::FRAME_ALIGNMENT);
+    EXPECT_EQ(
+        m_termBuffers[activeIndex].getUInt16(paddingOffset + DataFrameHeader::TYPE_FIELD_OFFSET),
+        DataFrameHeader::HDR_TYPE_PAD);
+
+    const int nextIndex = LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1 + 1);
+    EXPECT_EQ(m_logMetaDataBuffer.getInt32(LogBufferDescriptor::LOG_ACTIVE_TERM_COUNT_OFFSET), 1);
+    EXPECT_EQ(m_termBuffers[nextIndex].getInt32(alignedLength), 100 + DataFrameHeader::LENGTH);
+}
+
+TEST_F(ExclusivePublicationTest, shouldClaimFragmentedMessageAndCommitAllFragments)
+{
+    createPub();
+    const util::index_t length = (2 * m_publication->maxPayloadLength()) + 100;
+    std::vector<std::uint8_t> message(static_cast<std::size_t>(length));
+    for (std::size_t i = 0; i < message.size(); i++)
+    {
+        message[i] = static_cast<std::uint8_t>(i);
+    }
+    AtomicBuffer messageBuffer(message.data(), length);
+    FragmentedBufferClaim bufferClaim;
+    m_publicationLimit.set(LONG_MAX);
+
+    const std::int64_t position = m_publication->tryClaimFragmented(length, bufferClaim);
+    ASSERT_GT(position, length);
+    ASSERT_EQ(bufferClaim.fragmentCount(), 3);
+
+    const util::index_t frameStride = m_publication->maxPayloadLength() + DataFrameHeader::LENGTH;
+    EXPECT_EQ(m_termBuffers[0].getInt32(0), -frameStride);
+
+    bufferClaim.putBytes(0, messageBuffer, 0, length);
+    bufferClaim.commit();
+
+    const std::uint8_t expectedFlags[] =
+        { FrameDescriptor::BEGIN_FRAG, 0, FrameDescriptor::END_FRAG };
+    for (int i = 0; i < bufferClaim.fragmentCount(); i++)
+    {
+        const util::index_t frameOffset = i * frameStride;
+        EXPECT_EQ(m_termBuffers[0].getInt32(frameOffset), bufferClaim.fragmentLength(i) + DataFrameHeader::LENGTH);
+        EXPECT_EQ(m_termBuffers[0].getUInt8(frameOffset + DataFrameHeader::FLAGS_FIELD_OFFSET), expectedFlags[i]);
+        EXPECT_EQ(
+            std::memcmp(
+                m_termBuffers[0].buffer() + frameOffset + DataFrameHeader::LENGTH,
+                message.data() + (i * m_publication->maxPayloadLength()),
+                static_cast<std::size_t>(bufferClaim.fragmentLength(i))), 0);
+    }
+    EXPECT_EQ(m_publication->position(), position);
+}
+
 TEST_F(ExclusivePublicationTest, shouldFailToOfferAMessageWhenLimited)
 {
     createPub();
@@ -235,3 +235,36 @@ TEST_F(FragmentAssemblerTest, shouldNotReassembleIfMissingBegin)
     adapter.handler()(m_buffer, (MTU_LENGTH * 2) + DataFrameHeader::LENGTH, msgLength, m_header);
     ASSERT_FALSE(called);
 }
+
+TEST_F(FragmentAssemblerTest, shouldReassembleFragmentsAlreadyInTermWithPooledBuffer)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int called = 0;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        ++called;
+        EXPECT_EQ(offset, DataFrameHeader::LENGTH);
+        EXPECT_EQ(length, msgLength * 3);
+        verifyPayload(buffer, offset, length);
+    };
+
+    FragmentAssembler adapter(handler, 16);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    fillFrame(0, MTU_LENGTH, msgLength, msgLength % 256);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH * 2, msgLength, (msgLength * 2) % 256);
+
+    for (int i = 0; i < 2; i++)
+    {
+        m_header.offset(0);
+        adapter.handler()(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+        m_header.offset(MTU_LENGTH);
+        adapter.handler()(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+        m_header.offset(MTU_LENGTH * 2);
+        adapter.handler()(m_buffer, (MTU_LENGTH * 2) + DataFrameHeader::LENGTH, msgLength, m_header);
+
+        adapter.deleteSessionBuffer(SESSION_ID);
+    }
+
+    EXPECT_EQ(called, 2);
+}
@@ -15,11 +15,14 @@
  */
 
 #include <array>
+#include <thread>
 
 #include <gtest/gtest.h>
 
 #include <concurrent/logbuffer/DataFrameHeader.h>
 #include "ClientConductorFixture.h"
+#include "MessageFilter.h"
+#include "FixedTermImage.h"
 
 using namespace aeron::concurrent;
 using namespace aeron;
@@ -584,3 +587,387 @@ TEST_F(ImageTest, shouldPollFragmentsToBoundedControlledFragmentHandlerWithMaxPo
     EXPECT_EQ(m_subscriberPosition.get(), TERM_LENGTH);
     EXPECT_EQ(image.position(), TERM_LENGTH);
 }
+
+TEST_F(ImageTest, shouldPollFragmentsToBoundedFragmentHandlerWithMaxPositionBeforeNextMessage)
+{
+    const std::int32_t messageIndex = 0;
+    const std::int32_t initialTermOffset = offsetOfFrame(messageIndex);
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, initialTermOffset, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+    const std::int64_t maxPosition = initialPosition + 1;
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(messageIndex));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(messageIndex + 1));
+
+    EXPECT_CALL(m_fragmentHandler, onFragment(
+        testing::_, testing::_, static_cast<index_t>(DATA.size()), testing::_))
+        .Times(1);
+
+    const int fragments = image.boundedPoll(m_handler, maxPosition, INT_MAX);
+    EXPECT_EQ(fragments, 1);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(image.boundedPoll(m_handler, maxPosition, INT_MAX), 0);
+}
+
+TEST_F(ImageTest, shouldScanBlockWithoutConsumingUntilConsumed)
+{
+    const std::int32_t messageIndex = 0;
+    const std::int32_t initialTermOffset = offsetOfFrame(messageIndex);
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, initialTermOffset, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    ImageBlock block;
+    EXPECT_EQ(image.scanBlock(block, TERM_LENGTH), 0);
+
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(messageIndex));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(messageIndex + 1));
+
+    EXPECT_EQ(image.scanBlock(block, TERM_LENGTH), 2 * ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(block.image, &image);
+    EXPECT_EQ(block.termOffset, initialTermOffset);
+    EXPECT_EQ(block.sessionId, SESSION_ID);
+    EXPECT_EQ(block.termId, INITIAL_TERM_ID);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition);
+
+    image.consumeBlock(block);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (2 * ALIGNED_FRAME_LENGTH));
+
+    image.consumeBlock(block);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (2 * ALIGNED_FRAME_LENGTH));
+}
+
+TEST_F(ImageTest, shouldPrefetchingPollFragmentsStoringPositionEveryBatch)
+{
+    const std::int32_t messageIndex = 0;
+    const std::int32_t initialTermOffset = offsetOfFrame(messageIndex);
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, initialTermOffset, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    for (int i = 0; i < 5; i++)
+    {
+        insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(messageIndex + i));
+    }
+
+    std::vector<std::int64_t> positionsSeen;
+    auto handler = [&](AtomicBuffer&, util::index_t, util::index_t length, Header&)
+    {
+        EXPECT_EQ(length, static_cast<index_t>(DATA.size()));
+        positionsSeen.push_back(m_subscriberPosition.get());
+    };
+
+    EXPECT_EQ(image.prefetchingPoll<4>(handler, 4, 2), 4);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (4 * ALIGNED_FRAME_LENGTH));
+
+    ASSERT_EQ(positionsSeen.size(), 4u);
+    EXPECT_EQ(positionsSeen[0], initialPosition);
+    EXPECT_EQ(positionsSeen[1], initialPosition);
+    EXPECT_EQ(positionsSeen[2], initialPosition + (2 * ALIGNED_FRAME_LENGTH));
+    EXPECT_EQ(positionsSeen[3], initialPosition + (2 * ALIGNED_FRAME_LENGTH));
+
+    EXPECT_EQ(image.prefetchingPoll<4>(handler, INT_MAX), 1);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (5 * ALIGNED_FRAME_LENGTH));
+}
+
+TEST_F(ImageTest, shouldRawPollFragmentsWithPayloadAndFrameHeaderPointers)
+{
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(0));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(1));
+
+    std::vector<std::int32_t> termOffsets;
+    auto handler =
+        [&](const std::uint8_t *payload, util::index_t length, const DataFrameHeader::DataFrameHeaderDefn *frame)
+    {
+        EXPECT_EQ(length, static_cast<index_t>(DATA.size()));
+        EXPECT_EQ(std::memcmp(payload, DATA.data(), DATA.size()), 0);
+        EXPECT_EQ(frame->sessionId, SESSION_ID);
+        termOffsets.push_back(frame->termOffset);
+    };
+
+    EXPECT_EQ(image.rawPoll(handler, INT_MAX), 2);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (2 * ALIGNED_FRAME_LENGTH));
+    EXPECT_EQ(termOffsets, std::vector<std::int32_t>({ offsetOfFrame(0), offsetOfFrame(1) }));
+}
+
+TEST_F(ImageTest, shouldFilteredPollCountingOnlyMatchingFragments)
+{
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+    const std::uint16_t typeIds[] = { 1, 2, 1, 3, 2 };
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    for (int i = 0; i < 5; i++)
+    {
+        insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(i));
+        m_termBuffers[0].putUInt16(offsetOfFrame(i) + DataFrameHeader::LENGTH, typeIds[i]);
+    }
+
+    std::vector<std::uint16_t> typeIdsSeen;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t, Header&)
+    {
+        typeIdsSeen.push_back(buffer.getUInt16(offset));
+    };
+    const MessageFilter filter = MessageFilter::typeIds(0, { 1, 3 });
+
+    EXPECT_EQ(image.filteredPoll(handler, filter, 2), 2);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (3 * ALIGNED_FRAME_LENGTH));
+
+    EXPECT_EQ(image.filteredPoll(handler, filter, INT_MAX), 1);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (5 * ALIGNED_FRAME_LENGTH));
+
+    EXPECT_EQ(typeIdsSeen, std::vector<std::uint16_t>({ 1, 1, 3 }));
+}
+
+TEST_F(ImageTest, shouldFilteredPollSkippingAllFragmentsOfRejectedMessage)
+{
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+    const std::uint8_t flags[] =
+        { FrameDescriptor::BEGIN_FRAG, 0, FrameDescriptor::END_FRAG, FrameDescriptor::UNFRAGMENTED };
+    const std::uint8_t marks[] = { 7, 9, 9, 9 };
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    for (int i = 0; i < 4; i++)
+    {
+        insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(i));
+        m_termBuffers[0].putUInt8(offsetOfFrame(i) + DataFrameHeader::FLAGS_FIELD_OFFSET, flags[i]);
+        m_termBuffers[0].putUInt8(offsetOfFrame(i) + DataFrameHeader::LENGTH, marks[i]);
+    }
+
+    int fragments = 0;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t, Header&)
+    {
+        EXPECT_EQ(buffer.getUInt8(offset), 9);
+        fragments++;
+    };
+    const std::uint8_t mark = 9;
+
+    EXPECT_EQ(image.filteredPoll(handler, MessageFilter::bytes(0, &mark, 1), INT_MAX), 1);
+    EXPECT_EQ(fragments, 1);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (4 * ALIGNED_FRAME_LENGTH));
+}
+
+TEST_F(ImageTest, shouldReadConsumedFragmentsAgainWithoutMovingPosition)
+{
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    for (int i = 0; i < 4; i++)
+    {
+        insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(i));
+    }
+
+    int fragments = 0;
+    auto handler = [&](AtomicBuffer&, util::index_t, util::index_t length, Header&)
+    {
+        EXPECT_EQ(length, static_cast<index_t>(DATA.size()));
+        fragments++;
+    };
+
+    EXPECT_EQ(image.poll(handler, 3), 3);
+    const std::int64_t consumedPosition = initialPosition + (3 * ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(image.lowestConsumedPosition(), initialPosition);
+
+    fragments = 0;
+    EXPECT_EQ(image.readConsumed(initialPosition + ALIGNED_FRAME_LENGTH, handler, INT_MAX), consumedPosition);
+    EXPECT_EQ(fragments, 2);
+    EXPECT_EQ(image.readConsumed(initialPosition, handler, 1), initialPosition + ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(fragments, 3);
+    EXPECT_EQ(m_subscriberPosition.get(), consumedPosition);
+
+    EXPECT_EQ(image.readConsumed(initialPosition + FrameDescriptor::FRAME_ALIGNMENT, handler, INT_MAX),
+        initialPosition + FrameDescriptor::FRAME_ALIGNMENT);
+    EXPECT_EQ(fragments, 3);
+
+    EXPECT_THROW(
+        image.readConsumed(consumedPosition + ALIGNED_FRAME_LENGTH, handler, INT_MAX), util::IllegalArgumentException);
+}
+
+TEST_F(ImageTest, shouldReadConsumedFragmentsAcrossTermBoundary)
+{
+    const std::int32_t messageIndex = (TERM_LENGTH / ALIGNED_FRAME_LENGTH) - 1;
+    const std::int32_t initialTermOffset = offsetOfFrame(messageIndex);
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, initialTermOffset, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    insertDataFrame(INITIAL_TERM_ID, initialTermOffset);
+    insertDataFrame(INITIAL_TERM_ID + 1, 0);
+
+    int fragments = 0;
+    auto handler = [&](AtomicBuffer&, util::index_t, util::index_t, Header&)
+    {
+        fragments++;
+    };
+
+    EXPECT_EQ(image.poll(handler, INT_MAX), 1);
+    EXPECT_EQ(image.poll(handler, INT_MAX), 1);
+
+    const std::int64_t consumedPosition = initialPosition + (2 * ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(m_subscriberPosition.get(), consumedPosition);
+
+    fragments = 0;
+    EXPECT_EQ(image.readConsumed(initialPosition, handler, INT_MAX), consumedPosition);
+    EXPECT_EQ(fragments, 2);
+}
+
+TEST_F(ImageTest, shouldTimeOutAwaitingAvailableWhenNothingAppended)
+{
+    m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_IS_SUBSCRIBER_WAKEUP_OFFSET, 1);
+    LogBufferDescriptor::initializeTailWithTermId(m_logMetaDataBuffer, 0, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(0);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    EXPECT_FALSE(image.awaitAvailable(1000 * 1000));
+    EXPECT_EQ(m_logMetaDataBuffer.getInt32(LogBufferDescriptor::LOG_SUBSCRIBER_WAITERS_OFFSET), 0);
+}
+
+TEST_F(ImageTest, shouldWakeSubscriberAwaitingAvailableWhenAppended)
+{
+    m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_IS_SUBSCRIBER_WAKEUP_OFFSET, 1);
+    LogBufferDescriptor::initializeTailWithTermId(m_logMetaDataBuffer, 0, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(0);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    std::thread publisher([&]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        insertDataFrame(INITIAL_TERM_ID, 0);
+        m_logMetaDataBuffer.getAndAddInt64(LogBufferDescriptor::TERM_TAIL_COUNTER_OFFSET, ALIGNED_FRAME_LENGTH);
+        LogBufferDescriptor::signalSubscribers(m_logMetaDataBuffer);
+    });
+
+    const bool isAvailable = image.awaitAvailable(10LL * 1000 * 1000 * 1000);
+    publisher.join();
+
+    EXPECT_TRUE(isAvailable);
+}
+
+TEST_F(ImageTest, shouldPollThroughFixedTermImage)
+{
+    const std::int32_t initialTermOffset = offsetOfFrame(1);
+    const std::int64_t initialPosition = LogBufferDescriptor::computePosition(
+        INITIAL_TERM_ID + 1, initialTermOffset, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+    FixedTermImage<TERM_LENGTH> fixedTermImage(image);
+
+    insertDataFrame(INITIAL_TERM_ID + 1, initialTermOffset);
+
+    EXPECT_CALL(m_fragmentHandler, onFragment(
+        testing::_, initialTermOffset + DataFrameHeader::LENGTH, static_cast<index_t>(DATA.size()), testing::_))
+        .Times(1);
+
+    EXPECT_EQ(fixedTermImage.poll(m_handler, INT_MAX), 1);
+    EXPECT_EQ(image.position(), initialPosition + ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(fixedTermImage.poll(m_handler, INT_MAX), 0);
+}
+
+TEST_F(ImageTest, shouldRawPollThroughFixedTermImage)
+{
+    m_subscriberPosition.set(0);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+    FixedTermImage<TERM_LENGTH> fixedTermImage(image);
+
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(0));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(1));
+
+    util::index_t totalLength = 0;
+    const int fragments = fixedTermImage.rawPoll(
+        [&](const std::uint8_t *, util::index_t length, const DataFrameHeader::DataFrameHeaderDefn *)
+        {
+            totalLength += length;
+        },
+        INT_MAX);
+
+    EXPECT_EQ(fragments, 2);
+    EXPECT_EQ(totalLength, static_cast<util::index_t>(2 * DATA.size()));
+    EXPECT_EQ(image.position(), 2 * ALIGNED_FRAME_LENGTH);
+}
+
+TEST_F(ImageTest, shouldRejectFixedTermImageOfOtherTermLength)
+{
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    EXPECT_THROW(FixedTermImage<TERM_LENGTH * 2> fixedTermImage(image), util::IllegalArgumentException);
+}
+
+TEST(ImageListPoolTest, shouldShareImagesBetweenListsAndReuseReleasedLists)
+{
+    ImageListPool pool;
+    Image *first = new Image();
+    Image *second = new Image();
+
+    ImageList *empty = pool.acquire(0);
+    ImageList *withFirst = pool.copyWith(*empty, first);
+    ImageList *withBoth = pool.copyWith(*withFirst, second);
+
+    ASSERT_EQ(withBoth->m_length, 2u);
+    EXPECT_EQ(withBoth->m_images[0], first);
+    EXPECT_EQ(withBoth->m_images[1], second);
+
+    pool.release(empty);
+    pool.release(withFirst);
+    EXPECT_EQ(pool.pooledLists(), 2u);
+
+    ImageList *withSecond = pool.copyWithout(*withBoth, 0);
+    EXPECT_EQ(pool.pooledLists(), 1u);
+    ASSERT_EQ(withSecond->m_length, 1u);
+    EXPECT_EQ(withSecond->m_images[0], second);
+
+    pool.release(withBoth);
+    pool.release(withSecond);
+    EXPECT_EQ(pool.pooledLists(), 3u);
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <concurrent/logbuffer/DataFrameHeader.h>
+#include <concurrent/CountersManager.h>
+#include "LaneMerger.h"
+
+using namespace aeron::concurrent;
+using namespace aeron;
+
+#define TERM_LENGTH (LogBufferDescriptor::TERM_MIN_LENGTH)
+#define LOG_META_DATA_LENGTH (LogBufferDescriptor::LOG_META_DATA_LENGTH)
+#define LANE_COUNT (3)
+
+typedef std::array<std::uint8_t,
+    ((TERM_LENGTH * LogBufferDescriptor::PARTITION_COUNT) + LOG_META_DATA_LENGTH)> term_buffer_t;
+typedef std::array<std::uint8_t, LANE_COUNT * CountersReader::COUNTER_LENGTH> counter_values_t;
+
+static const std::int32_t STREAM_ID = 10;
+static const std::int32_t INITIAL_TERM_ID = 7;
+static const util::index_t MESSAGE_LENGTH = 8;
+static const util::index_t ALIGNED_FRAME_LENGTH =
+    BitUtil::align(DataFrameHeader::LENGTH + MESSAGE_LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+
+static void exceptionHandler(const std::exception&)
+{
+}
+
+class LaneMergerTest : public testing::Test
+{
+public:
+    LaneMergerTest() :
+        m_counterValuesBuffer(m_counterValues, 0)
+    {
+        m_counterValues.fill(0);
+
+        for (int lane = 0; lane < LANE_COUNT; lane++)
+        {
+            m_logs[lane].fill(0);
+            m_logBuffers[lane] = std::make_shared<LogBuffers>(
+                m_logs[lane].data(), static_cast<std::int64_t>(m_logs[lane].size()), TERM_LENGTH);
+
+            AtomicBuffer metaData = m_logBuffers[lane]->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX);
+            metaData.putInt32(LogBufferDescriptor::LOG_INITIAL_TERM_ID_OFFSET, INITIAL_TERM_ID);
+            metaData.putInt32(LogBufferDescriptor::LOG_MTU_LENGTH_OFFSET, 1408);
+            metaData.putInt32(LogBufferDescriptor::LOG_TERM_LENGTH_OFFSET, TERM_LENGTH);
+            metaData.putInt32(LogBufferDescriptor::LOG_PAGE_SIZE_OFFSET, LogBufferDescriptor::PAGE_MIN_SIZE);
+
+            UnsafeBufferPosition position(m_counterValuesBuffer, lane);
+            m_images.emplace_back(new Image(lane, lane, 1, "test", position, m_logBuffers[lane], exceptionHandler));
+            m_lanes.push_back(m_images.back().get());
+        }
+    }
+
+    void appendFrame(int lane, std::int64_t reservedValue)
+    {
+        AtomicBuffer termBuffer = m_logBuffers[lane]->atomicBuffer(0);
+        const util::index_t offset = m_tailOffsets[lane];
+        DataFrameHeader::DataFrameHeaderDefn& frame =
+            termBuffer.overlayStruct<DataFrameHeader::DataFrameHeaderDefn>(offset);
+
+        frame.version = DataFrameHeader::CURRENT_VERSION;
+        frame.flags = FrameDescriptor::UNFRAGMENTED;
+        frame.type = DataFrameHeader::HDR_TYPE_DATA;
+        frame.termOffset = offset;
+        frame.sessionId = lane;
+        frame.streamId = STREAM_ID;
+        frame.termId = INITIAL_TERM_ID;
+        frame.reservedValue = reservedValue;
+        termBuffer.putInt64(offset + DataFrameHeader::LENGTH, reservedValue);
+        termBuffer.putInt32Ordered(offset, DataFrameHeader::LENGTH + MESSAGE_LENGTH);
+
+        m_tailOffsets[lane] += ALIGNED_FRAME_LENGTH;
+    }
+
+    int poll(LaneMerger& merger, int fragmentLimit)
+    {
+        return merger.poll(
+            m_lanes,
+            [&](AtomicBuffer& buffer, util::index_t offset, util::index_t, Header& header)
+            {
+                m_received.emplace_back(header.sessionId(), buffer.getInt64(offset));
+            },
+            fragmentLimit);
+    }
+
+protected:
+    AERON_DECL_ALIGNED(term_buffer_t m_logs[LANE_COUNT], 16);
+    AERON_DECL_ALIGNED(counter_values_t m_counterValues, 16);
+    AtomicBuffer m_counterValuesBuffer;
+    std::shared_ptr<LogBuffers> m_logBuffers[LANE_COUNT];
+    util::index_t m_tailOffsets[LANE_COUNT] = {};
+    std::vector<std::unique_ptr<Image>> m_images;
+    std::vector<Image*> m_lanes;
+    std::vector<std::pair<std::int32_t, std::int64_t>> m_received;
+};
+
+TEST_F(LaneMergerTest, shouldMergeLanesInTimestampOrder)
+{
+    LaneMerger merger;
+
+    appendFrame(0, 10);
+    appendFrame(0, 40);
+    appendFrame(0, 41);
+    appendFrame(1, 20);
+    appendFrame(1, 50);
+    appendFrame(2, 5);
+    appendFrame(2, 30);
+
+    EXPECT_EQ(poll(merger, 10), 7);
+
+    const std::vector<std::pair<std::int32_t, std::int64_t>> expected =
+        { { 2, 5 }, { 0, 10 }, { 1, 20 }, { 2, 30 }, { 0, 40 }, { 0, 41 }, { 1, 50 } };
+    EXPECT_EQ(m_received, expected);
+
+    for (int lane = 0; lane < LANE_COUNT; lane++)
+    {
+        EXPECT_EQ(m_lanes[lane]->position(), m_tailOffsets[lane]);
+    }
+}
+
+TEST_F(LaneMergerTest, shouldResumeInOrderAfterFragmentLimit)
+{
+    LaneMerger merger;
+
+    appendFrame(0, 1);
+    appendFrame(0, 3);
+    appendFrame(1, 2);
+    appendFrame(1, 4);
+
+    EXPECT_EQ(poll(merger, 3), 3);
+    EXPECT_EQ(poll(merger, 3), 1);
+
+    const std::vector<std::pair<std::int32_t, std::int64_t>> expected = { { 0, 1 }, { 1, 2 }, { 0, 3 }, { 1, 4 } };
+    EXPECT_EQ(m_received, expected);
+    EXPECT_EQ(poll(merger, 3), 0);
+}
+
+TEST_F(LaneMergerTest, shouldMergeLanesInPositionOrder)
+{
+    LaneMerger merger(LaneMerger::positionKey);
+
+    appendFrame(0, 0);
+    appendFrame(0, 0);
+    appendFrame(0, 0);
+    appendFrame(1, 0);
+
+    EXPECT_EQ(poll(merger, 10), 4);
+
+    ASSERT_EQ(m_received.size(), 4u);
+    EXPECT_EQ(m_received[0].first, 0);
+    EXPECT_EQ(m_received[1].first, 1);
+    EXPECT_EQ(m_received[2].first, 0);
+    EXPECT_EQ(m_received[3].first, 0);
+}
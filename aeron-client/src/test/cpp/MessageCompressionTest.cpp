@@ -0,0 +1,146 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ZlibMessageCodec.h"
+
+using namespace aeron::concurrent;
+using namespace aeron;
+
+static const std::string QUOTE =
+    "{\"symbol\":\"EURUSD\",\"venue\":\"LMAX\",\"bidPrice\":1.13245,\"bidSize\":1000000,"
+    "\"askPrice\":1.13251,\"askSize\":2000000,\"timestamp\":1536234512123456789}";
+
+struct CapturingPublication
+{
+    std::vector<std::uint8_t> message;
+
+    std::int64_t offer(AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        message.assign(buffer.buffer() + offset, buffer.buffer() + offset + length);
+        return static_cast<std::int64_t>(length);
+    }
+};
+
+class MessageCompressionTest : public testing::Test
+{
+public:
+    MessageCompressionTest() :
+        m_header(0, 64 * 1024)
+    {
+    }
+
+    std::int64_t offer(MessageCompressor& compressor, const std::string& text)
+    {
+        m_src.assign(text.begin(), text.end());
+        AtomicBuffer buffer(m_src.data(), static_cast<util::index_t>(m_src.size()));
+
+        return compressor.offer(m_publication, buffer, 0, buffer.capacity());
+    }
+
+    void receive(MessageDecompressor& decompressor)
+    {
+        AtomicBuffer buffer(m_publication.message.data(), static_cast<util::index_t>(m_publication.message.size()));
+        decompressor.handler()(buffer, 0, buffer.capacity(), m_header);
+    }
+
+    fragment_handler_t recordingHandler()
+    {
+        return [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header&)
+        {
+            m_received.assign(reinterpret_cast<char *>(buffer.buffer()) + offset, static_cast<std::size_t>(length));
+            m_receivedBuffer = buffer.buffer();
+        };
+    }
+
+protected:
+    std::vector<std::uint8_t> m_src;
+    CapturingPublication m_publication;
+    Header m_header;
+    std::string m_received;
+    std::uint8_t *m_receivedBuffer = nullptr;
+};
+
+TEST_F(MessageCompressionTest, shouldRoundTripCompressibleMessage)
+{
+    std::shared_ptr<MessageCodec> codec = std::make_shared<ZlibMessageCodec>();
+    MessageCompressor compressor(codec);
+    MessageDecompressor decompressor(codec, recordingHandler());
+
+    std::string message;
+    for (int i = 0; i < 8; i++)
+    {
+        message += QUOTE;
+    }
+
+    const std::int64_t encodedLength = offer(compressor, message);
+    EXPECT_LT(encodedLength, static_cast<std::int64_t>(message.size() / 2));
+
+    receive(decompressor);
+    EXPECT_EQ(m_received, message);
+}
+
+TEST_F(MessageCompressionTest, shouldSendShortMessageAsIsAndDelegateWithoutCopy)
+{
+    std::shared_ptr<MessageCodec> codec = std::make_shared<ZlibMessageCodec>();
+    MessageCompressor compressor(codec);
+    MessageDecompressor decompressor(codec, recordingHandler());
+
+    const std::string message = "short message";
+
+    const std::int64_t expectedLength = MessageCompression::HEADER_LENGTH + static_cast<std::int64_t>(message.size());
+    EXPECT_EQ(offer(compressor, message), expectedLength);
+
+    receive(decompressor);
+    EXPECT_EQ(m_received, message);
+    EXPECT_EQ(m_receivedBuffer, m_publication.message.data());
+}
+
+TEST_F(MessageCompressionTest, shouldCompressShortMessagesBetterWithDictionary)
+{
+    const std::vector<std::uint8_t> dictionary(QUOTE.begin(), QUOTE.end());
+    std::shared_ptr<MessageCodec> plainCodec = std::make_shared<ZlibMessageCodec>();
+    std::shared_ptr<MessageCodec> dictionaryCodec = std::make_shared<ZlibMessageCodec>(Z_BEST_SPEED, dictionary);
+    MessageCompressor plainCompressor(plainCodec);
+    MessageCompressor dictionaryCompressor(dictionaryCodec);
+    MessageDecompressor decompressor(dictionaryCodec, recordingHandler());
+
+    std::string message = QUOTE;
+    message.replace(message.find("1.13245"), 7, "1.13247");
+
+    const std::int64_t plainLength = offer(plainCompressor, message);
+    const std::int64_t dictionaryLength = offer(dictionaryCompressor, message);
+    EXPECT_LT(dictionaryLength * 2, plainLength);
+
+    receive(decompressor);
+    EXPECT_EQ(m_received, message);
+}
+
+TEST_F(MessageCompressionTest, shouldThrowOnCorruptMessage)
+{
+    std::shared_ptr<MessageCodec> codec = std::make_shared<ZlibMessageCodec>();
+    MessageCompressor compressor(codec);
+    MessageDecompressor decompressor(codec, recordingHandler());
+
+    offer(compressor, QUOTE + QUOTE);
+    m_publication.message.resize(m_publication.message.size() / 2);
+
+    EXPECT_THROW(receive(decompressor), util::IllegalStateException);
+}
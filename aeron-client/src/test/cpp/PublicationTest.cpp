@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 
+#include <vector>
+#include <cstring>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "ClientConductorFixture.h"
@@ -159,6 +163,231 @@ TEST_F(PublicationTest, shouldOfferAMessageUponConstruction)
     EXPECT_EQ(m_publication->position(), expectedPosition);
 }
 
+TEST_F(PublicationTest, shouldOfferBeyondLimitCounterFromSubscriberPositions)
+{
+    const std::int32_t subscriberPositionId = 1;
+    UnsafeBufferPosition subscriberPosition(m_counterValuesBuffer, subscriberPositionId);
+
+    m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_PUBLISHER_WINDOW_LENGTH_OFFSET, TERM_LENGTH / 2);
+    m_logMetaDataBuffer.putInt64(LogBufferDescriptor::LOG_CLEAN_LIMIT_OFFSET, 2 * TERM_LENGTH);
+    m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_SUBSCRIBER_POSITION_COUNT_OFFSET, 1);
+    m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_SUBSCRIBER_POSITION_IDS_OFFSET, subscriberPositionId);
+    LogBufferDescriptor::isConnected(m_logMetaDataBuffer, true);
+    LogBufferDescriptor::isConnected(m_logMetaDataBuffer, true);
+    m_publicationLimit.set(0);
+    subscriberPosition.set(0);
+
+    const std::int64_t expectedPosition = m_srcBuffer.capacity() + DataFrameHeader::LENGTH;
+    EXPECT_EQ(m_publication->offer(m_srcBuffer), expectedPosition);
+
+    m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_SUBSCRIBER_POSITIONS_CHANGE_NUMBER_OFFSET, 1);
+    EXPECT_EQ(m_publication->offer(m_srcBuffer), BACK_PRESSURED);
+
+    m_logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_SUBSCRIBER_POSITIONS_CHANGE_NUMBER_OFFSET, 2);
+    m_logMetaDataBuffer.putInt64(LogBufferDescriptor::LOG_CLEAN_LIMIT_OFFSET, expectedPosition);
+    EXPECT_EQ(m_publication->offer(m_srcBuffer), BACK_PRESSURED);
+}
+
+TEST_F(PublicationTest, shouldOfferBatchOfMessagesAsSeparateFrames)
+{
+    const util::index_t lengths[] = { 20, 44, 60 };
+    const AtomicBuffer batch[] =
+        {
+            AtomicBuffer(&m_src[0], lengths[0]),
+            AtomicBuffer(&m_src[100], lengths[1]),
+            AtomicBuffer(&m_src[200], lengths[2])
+        };
+    m_publicationLimit.set(2 * m_srcBuffer.capacity());
+
+    std::int64_t expectedPosition = 0;
+    for (util::index_t length : lengths)
+    {
+        expectedPosition += util::BitUtil::align(length + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    }
+
+    EXPECT_EQ(m_publication->offerBatch(batch, 3), expectedPosition);
+    EXPECT_EQ(m_publication->position(), expectedPosition);
+
+    util::index_t frameOffset = 0;
+    for (util::index_t length : lengths)
+    {
+        EXPECT_EQ(m_termBuffers[0].getInt32(frameOffset), length + DataFrameHeader::LENGTH);
+        frameOffset += util::BitUtil::align(length + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    }
+}
+
+TEST_F(PublicationTest, shouldRejectMessageLongerThanMaxMessageLength)
+{
+    std::vector<std::uint8_t> message(static_cast<std::size_t>(m_publication->maxMessageLength() + 1));
+    AtomicBuffer messageBuffer(message.data(), message.size());
+    m_publicationLimit.set(TERM_LENGTH);
+
+#if defined(AERON_NOEXCEPT_HOT_PATH)
+    EXPECT_EQ(m_publication->offer(messageBuffer), MAX_MESSAGE_LENGTH_EXCEEDED);
+#else
+    EXPECT_THROW(m_publication->offer(messageBuffer), util::IllegalStateException);
+#endif
+    EXPECT_EQ(m_publication->position(), 0);
+}
+
+TEST_F(PublicationTest, shouldRejectEmptyBatch)
+{
+    m_publicationLimit.set(2 * m_srcBuffer.capacity());
+
+    EXPECT_THROW(m_publication->offerBatch(&m_srcBuffer, 0), util::IllegalArgumentException);
+}
+
+TEST_F(PublicationTest, shouldWriteReservedValueFromCallableOrZeroWithoutSupplier)
+{
+    const util::index_t length = 64;
+    const util::index_t alignedFrameLength =
+        util::BitUtil::align(length + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    m_publicationLimit.set(2 * m_srcBuffer.capacity());
+    m_termBuffers[0].putInt64(DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, -1);
+
+    EXPECT_EQ(m_publication->offer(m_srcBuffer, 0, length), alignedFrameLength);
+    EXPECT_EQ(m_termBuffers[0].getInt64(DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET), 0);
+
+    auto supplier = [](AtomicBuffer&, util::index_t termOffset, util::index_t) -> std::int64_t
+    {
+        return termOffset + 42;
+    };
+
+    EXPECT_EQ(m_publication->offer(m_srcBuffer, 0, length, supplier), 2 * alignedFrameLength);
+    EXPECT_EQ(
+        m_termBuffers[0].getInt64(alignedFrameLength + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET),
+        alignedFrameLength + 42);
+}
+
+TEST_F(PublicationTest, shouldClaimFragmentedMessageAndCommitAllFragments)
+{
+    const util::index_t length = (2 * m_publication->maxPayloadLength()) + 100;
+    std::vector<std::uint8_t> message(static_cast<std::size_t>(length));
+    for (std::size_t i = 0; i < message.size(); i++)
+    {
+        message[i] = static_cast<std::uint8_t>(i);
+    }
+    AtomicBuffer messageBuffer(message.data(), length);
+    FragmentedBufferClaim bufferClaim;
+    m_publicationLimit.set(LONG_MAX);
+
+    const std::int64_t position = m_publication->tryClaimFragmented(length, bufferClaim);
+    ASSERT_GT(position, length);
+    ASSERT_EQ(bufferClaim.fragmentCount(), 3);
+
+    const util::index_t frameStride = m_publication->maxPayloadLength() + DataFrameHeader::LENGTH;
+    EXPECT_EQ(m_termBuffers[0].getInt32(0), -frameStride);
+
+    bufferClaim.putBytes(0, messageBuffer, 0, length);
+    bufferClaim.commit();
+
+    const std::uint8_t expectedFlags[] =
+        { FrameDescriptor::BEGIN_FRAG, 0, FrameDescriptor::END_FRAG };
+    for (int i = 0; i < bufferClaim.fragmentCount(); i++)
+    {
+        const util::index_t frameOffset = i * frameStride;
+        EXPECT_EQ(m_termBuffers[0].getInt32(frameOffset), bufferClaim.fragmentLength(i) + DataFrameHeader::LENGTH);
+        EXPECT_EQ(m_termBuffers[0].getUInt8(frameOffset + DataFrameHeader::FLAGS_FIELD_OFFSET), expectedFlags[i]);
+        EXPECT_EQ(
+            std::memcmp(
+                m_termBuffers[0].buffer() + frameOffset + DataFrameHeader::LENGTH,
+                message.data() + (i * m_publication->maxPayloadLength()),
+                static_cast<std::size_t>(bufferClaim.fragmentLength(i))), 0);
+    }
+    EXPECT_EQ(m_publication->position(), position);
+}
+
+TEST_F(PublicationTest, shouldAbortFragmentedClaimAsPadding)
+{
+    FragmentedBufferClaim bufferClaim;
+    m_publicationLimit.set(LONG_MAX);
+
+    ASSERT_GT(m_publication->tryClaimFragmented(m_publication->maxPayloadLength() + 1, bufferClaim), 0);
+    ASSERT_EQ(bufferClaim.fragmentCount(), 2);
+
+    bufferClaim.abort();
+
+    const util::index_t frameStride = m_publication->maxPayloadLength() + DataFrameHeader::LENGTH;
+    EXPECT_EQ(m_termBuffers[0].getUInt16(DataFrameHeader::TYPE_FIELD_OFFSET), DataFrameHeader::HDR_TYPE_PAD);
+    EXPECT_EQ(m_termBuffers[0].getUInt16(frameStride + DataFrameHeader::TYPE_FIELD_OFFSET), DataFrameHeader::HDR_TYPE_PAD);
+    EXPECT_EQ(m_termBuffers[0].getInt32(frameStride), 1 + DataFrameHeader::LENGTH);
+}
+
+TEST_F(PublicationTest, shouldRejectFragmentedClaimAboveMaxMessageLength)
+{
+    FragmentedBufferClaim bufferClaim;
+
+    EXPECT_THROW(
+        m_publication->tryClaimFragmented(m_publication->maxMessageLength() + 1, bufferClaim),
+        util::IllegalStateException);
+}
+
+TEST_F(PublicationTest, shouldTimeOutAwaitingPublicationLimitWhenNotAdvanced)
+{
+    m_publicationLimit.set(0);
+
+    EXPECT_FALSE(m_publication->awaitPublicationLimit(1000 * 1000));
+}
+
+TEST_F(PublicationTest, shouldWakePublisherAwaitingPublicationLimitWhenAdvanced)
+{
+    m_publicationLimit.set(0);
+
+    std::thread driver([&]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        m_publicationLimit.setOrdered(TERM_LENGTH);
+        m_publicationLimit.signalWaiters();
+    });
+
+    const bool isAdvanced = m_publication->awaitPublicationLimit(10LL * 1000 * 1000 * 1000);
+    driver.join();
+
+    EXPECT_TRUE(isAdvanced);
+}
+
+TEST_F(PublicationTest, shouldAppendIntoReservationAndPadRemainderOnRelease)
+{
+    const util::index_t reservationLength = 1024;
+    const util::index_t length = 100;
+    const util::index_t alignedFrameLength =
+        util::BitUtil::align(length + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    TermReservation reservation;
+    m_publicationLimit.set(LONG_MAX);
+
+    ASSERT_EQ(m_publication->tryReserve(reservationLength, reservation), reservationLength);
+    EXPECT_EQ(m_publication->position(), reservationLength);
+    ASSERT_TRUE(reservation.isActive());
+
+    EXPECT_TRUE(reservation.append(m_srcBuffer, 0, length));
+    EXPECT_TRUE(reservation.append(m_srcBuffer, 0, length));
+    EXPECT_EQ(reservation.position(), 2 * alignedFrameLength);
+    EXPECT_EQ(m_termBuffers[0].getInt32(alignedFrameLength), length + DataFrameHeader::LENGTH);
+
+    reservation.release();
+    EXPECT_FALSE(reservation.isActive());
+
+    const util::index_t paddingOffset = 2 * alignedFrameLength;
+    EXPECT_EQ(m_termBuffers[0].getInt32(paddingOffset), reservationLength - paddingOffset);
+    EXPECT_EQ(
+        m_termBuffers[0].getUInt16(paddingOffset + DataFrameHeader::TYPE_FIELD_OFFSET), DataFrameHeader::HDR_TYPE_PAD);
+    EXPECT_FALSE(reservation.append(m_srcBuffer, 0, length));
+}
+
+TEST_F(PublicationTest, shouldRejectAppendBeyondReservation)
+{
+    TermReservation reservation;
+    m_publicationLimit.set(LONG_MAX);
+
+    ASSERT_GT(m_publication->tryReserve(3 * FrameDescriptor::FRAME_ALIGNMENT, reservation), 0);
+
+    EXPECT_TRUE(reservation.append(m_srcBuffer, 0, FrameDescriptor::FRAME_ALIGNMENT - DataFrameHeader::LENGTH));
+    EXPECT_FALSE(reservation.append(m_srcBuffer, 0, (2 * FrameDescriptor::FRAME_ALIGNMENT) + 1));
+    EXPECT_EQ(reservation.remaining(), 2 * FrameDescriptor::FRAME_ALIGNMENT);
+
+    reservation.release();
+}
+
 TEST_F(PublicationTest, shouldFailToOfferAMessageWhenLimited)
 {
     m_publicationLimit.set(0);
@@ -0,0 +1,297 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <concurrent/logbuffer/DataFrameHeader.h>
+#include "ClientConductorFixture.h"
+#include "ReadinessSet.h"
+
+using namespace aeron::concurrent;
+using namespace aeron;
+
+#define TERM_LENGTH (LogBufferDescriptor::TERM_MIN_LENGTH)
+#define LOG_META_DATA_LENGTH (LogBufferDescriptor::LOG_META_DATA_LENGTH)
+#define IMAGE_COUNT (4)
+#define ACTIVITY_CAPACITY (4)
+
+typedef std::array<std::uint8_t,
+    ((TERM_LENGTH * LogBufferDescriptor::PARTITION_COUNT) + LOG_META_DATA_LENGTH)> term_buffer_t;
+typedef std::array<std::uint8_t,
+    (reports::StreamActivityDescriptor::HEADER_LENGTH +
+        (ACTIVITY_CAPACITY * reports::StreamActivityDescriptor::ENTRY_LENGTH))> activity_buffer_t;
+
+static const std::int32_t STREAM_ID = 10;
+static const std::int32_t INITIAL_TERM_ID = 7;
+static const util::index_t MESSAGE_LENGTH = 8;
+static const util::index_t ALIGNED_FRAME_LENGTH =
+    BitUtil::align(DataFrameHeader::LENGTH + MESSAGE_LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+
+static void exceptionHandler(const std::exception&)
+{
+}
+
+class ReadinessSetTest : public testing::Test, public ClientConductorFixture
+{
+public:
+    ReadinessSetTest()
+    {
+        m_activity.fill(0);
+        m_activityBuffer.wrap(m_activity.data(), m_activity.size());
+        m_activityBuffer.putInt32(reports::StreamActivityDescriptor::CAPACITY_OFFSET, ACTIVITY_CAPACITY);
+
+        for (int i = 0; i < IMAGE_COUNT; i++)
+        {
+            m_logs[i].fill(0);
+            m_logBuffers[i] = std::make_shared<LogBuffers>(
+                m_logs[i].data(), static_cast<std::int64_t>(m_logs[i].size()), TERM_LENGTH);
+
+            AtomicBuffer metaData = m_logBuffers[i]->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX);
+            metaData.putInt32(LogBufferDescriptor::LOG_INITIAL_TERM_ID_OFFSET, INITIAL_TERM_ID);
+            metaData.putInt32(LogBufferDescriptor::LOG_MTU_LENGTH_OFFSET, 1408);
+            metaData.putInt32(LogBufferDescriptor::LOG_TERM_LENGTH_OFFSET, TERM_LENGTH);
+            metaData.putInt32(LogBufferDescriptor::LOG_PAGE_SIZE_OFFSET, LogBufferDescriptor::PAGE_MIN_SIZE);
+        }
+
+        for (int i = 0; i < 2; i++)
+        {
+            m_subscriptions[i] = std::make_shared<Subscription>(m_conductor, 100 + i, "aeron:ipc", STREAM_ID, -1);
+        }
+    }
+
+    Image *addImage(int subscriptionIndex, int imageIndex)
+    {
+        UnsafeBufferPosition position(m_counterValuesBuffer, imageIndex);
+        auto *image = new Image(
+            imageIndex, imageIndex, 100 + subscriptionIndex, "test", position, m_logBuffers[imageIndex],
+            exceptionHandler);
+
+        m_pool.release(m_subscriptions[subscriptionIndex]->addImage(m_pool, image));
+
+        return image;
+    }
+
+    void appendFrame(int imageIndex, util::index_t offset)
+    {
+        AtomicBuffer termBuffer = m_logBuffers[imageIndex]->atomicBuffer(0);
+        DataFrameHeader::DataFrameHeaderDefn& frame =
+            termBuffer.overlayStruct<DataFrameHeader::DataFrameHeaderDefn>(offset);
+
+        frame.version = DataFrameHeader::CURRENT_VERSION;
+        frame.flags = FrameDescriptor::UNFRAGMENTED;
+        frame.type = DataFrameHeader::HDR_TYPE_DATA;
+        frame.termOffset = offset;
+        frame.sessionId = imageIndex;
+        frame.streamId = STREAM_ID;
+        frame.termId = INITIAL_TERM_ID;
+        termBuffer.putInt32Ordered(offset, DataFrameHeader::LENGTH + MESSAGE_LENGTH);
+    }
+
+    std::vector<std::int32_t> readySessionIds(ReadinessSet& readinessSet)
+    {
+        std::vector<std::int32_t> sessionIds;
+
+        readinessSet.forEachReadyImage([&](Image& image) { sessionIds.push_back(image.sessionId()); });
+
+        return sessionIds;
+    }
+
+    void flagActivity(std::int64_t correlationId)
+    {
+        using namespace reports::StreamActivityDescriptor;
+
+        const std::int64_t sequence = m_activityBuffer.getInt64(TAIL_OFFSET);
+        const util::index_t offset = entryOffset(sequence, ACTIVITY_CAPACITY - 1);
+
+        m_activityBuffer.putInt64(offset + ENTRY_CORRELATION_ID_OFFSET, correlationId);
+        m_activityBuffer.putInt64Ordered(offset + ENTRY_SEQUENCE_OFFSET, sequence);
+        m_activityBuffer.putInt64Ordered(TAIL_OFFSET, sequence + 1);
+    }
+
+    std::vector<std::int32_t> activeSessionIds(ReadinessSet& readinessSet, reports::StreamActivityReader& reader)
+    {
+        std::vector<std::int32_t> sessionIds;
+
+        readinessSet.forEachActiveImage(reader, [&](Image& image) { sessionIds.push_back(image.sessionId()); });
+
+        return sessionIds;
+    }
+
+protected:
+    AERON_DECL_ALIGNED(term_buffer_t m_logs[IMAGE_COUNT], 16);
+    AERON_DECL_ALIGNED(activity_buffer_t m_activity, 16);
+    AtomicBuffer m_activityBuffer;
+    std::shared_ptr<LogBuffers> m_logBuffers[IMAGE_COUNT];
+    ImageListPool m_pool;
+    std::shared_ptr<Subscription> m_subscriptions[2];
+};
+
+TEST_F(ReadinessSetTest, shouldFindNoReadyImagesWhenNothingAppended)
+{
+    ReadinessSet readinessSet;
+    readinessSet.add(m_subscriptions[0]);
+    readinessSet.add(m_subscriptions[1]);
+    addImage(0, 0);
+    addImage(1, 1);
+
+    EXPECT_TRUE(readySessionIds(readinessSet).empty());
+}
+
+TEST_F(ReadinessSetTest, shouldFindOnlyImagesWithFrameAtPositionAcrossSubscriptions)
+{
+    ReadinessSet readinessSet;
+    readinessSet.add(m_subscriptions[0]);
+    readinessSet.add(m_subscriptions[1]);
+    addImage(0, 0);
+    addImage(0, 1);
+    addImage(1, 2);
+    addImage(1, 3);
+
+    appendFrame(1, 0);
+    appendFrame(3, 0);
+
+    EXPECT_EQ(readySessionIds(readinessSet), std::vector<std::int32_t>({ 1, 3 }));
+}
+
+TEST_F(ReadinessSetTest, shouldNotFindImageOnceConsumedToEndOfAppendedFrames)
+{
+    ReadinessSet readinessSet;
+    readinessSet.add(m_subscriptions[0]);
+    Image *image = addImage(0, 0);
+
+    appendFrame(0, 0);
+    EXPECT_EQ(readySessionIds(readinessSet), std::vector<std::int32_t>({ 0 }));
+
+    const int fragments = image->poll([](AtomicBuffer&, util::index_t, util::index_t, Header&) {}, 10);
+    EXPECT_EQ(fragments, 1);
+    EXPECT_TRUE(readySessionIds(readinessSet).empty());
+
+    appendFrame(0, ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(readySessionIds(readinessSet), std::vector<std::int32_t>({ 0 }));
+}
+
+TEST_F(ReadinessSetTest, shouldPickUpImagesAddedAfterSubscriptionAdded)
+{
+    ReadinessSet readinessSet;
+    readinessSet.add(m_subscriptions[0]);
+    addImage(0, 0);
+    appendFrame(0, 0);
+    appendFrame(2, 0);
+
+    EXPECT_EQ(readySessionIds(readinessSet), std::vector<std::int32_t>({ 0 }));
+
+    addImage(0, 2);
+
+    EXPECT_EQ(readySessionIds(readinessSet), std::vector<std::int32_t>({ 0, 2 }));
+}
+
+TEST_F(ReadinessSetTest, shouldStopCheckingRemovedSubscription)
+{
+    ReadinessSet readinessSet;
+    readinessSet.add(m_subscriptions[0]);
+    readinessSet.add(m_subscriptions[1]);
+    addImage(0, 0);
+    addImage(1, 1);
+    appendFrame(0, 0);
+    appendFrame(1, 0);
+
+    EXPECT_TRUE(readinessSet.remove(*m_subscriptions[0]));
+    EXPECT_FALSE(readinessSet.remove(*m_subscriptions[0]));
+
+    EXPECT_EQ(readinessSet.subscriptionCount(), 1u);
+    EXPECT_EQ(readySessionIds(readinessSet), std::vector<std::int32_t>({ 1 }));
+}
+
+TEST_F(ReadinessSetTest, shouldCheckAllImagesOnFirstActivePass)
+{
+    ReadinessSet readinessSet;
+    reports::StreamActivityReader reader(m_activityBuffer);
+    readinessSet.add(m_subscriptions[0]);
+    readinessSet.add(m_subscriptions[1]);
+    addImage(0, 0);
+    addImage(1, 1);
+    appendFrame(1, 0);
+
+    EXPECT_EQ(activeSessionIds(readinessSet, reader), std::vector<std::int32_t>({ 1 }));
+}
+
+TEST_F(ReadinessSetTest, shouldOnlyCheckImagesFlaggedOrStillReadyOnActivePass)
+{
+    ReadinessSet readinessSet;
+    reports::StreamActivityReader reader(m_activityBuffer);
+    readinessSet.add(m_subscriptions[0]);
+    addImage(0, 0);
+    addImage(0, 1);
+    addImage(0, 2);
+
+    EXPECT_TRUE(activeSessionIds(readinessSet, reader).empty());
+
+    appendFrame(0, 0);
+    appendFrame(2, 0);
+    EXPECT_TRUE(activeSessionIds(readinessSet, reader).empty());
+
+    flagActivity(2);
+    flagActivity(2);
+    EXPECT_EQ(activeSessionIds(readinessSet, reader), std::vector<std::int32_t>({ 2 }));
+    EXPECT_EQ(activeSessionIds(readinessSet, reader), std::vector<std::int32_t>({ 2 }));
+
+    flagActivity(0);
+    flagActivity(99);
+    EXPECT_EQ(activeSessionIds(readinessSet, reader), std::vector<std::int32_t>({ 2, 0 }));
+}
+
+TEST_F(ReadinessSetTest, shouldDropImageFromActivePassOnceConsumed)
+{
+    ReadinessSet readinessSet;
+    reports::StreamActivityReader reader(m_activityBuffer);
+    readinessSet.add(m_subscriptions[0]);
+    Image *image = addImage(0, 0);
+
+    EXPECT_TRUE(activeSessionIds(readinessSet, reader).empty());
+
+    appendFrame(0, 0);
+    flagActivity(0);
+    EXPECT_EQ(activeSessionIds(readinessSet, reader), std::vector<std::int32_t>({ 0 }));
+
+    image->poll([](AtomicBuffer&, util::index_t, util::index_t, Header&) {}, 10);
+    EXPECT_TRUE(activeSessionIds(readinessSet, reader).empty());
+
+    appendFrame(0, ALIGNED_FRAME_LENGTH);
+    EXPECT_TRUE(activeSessionIds(readinessSet, reader).empty());
+}
+
+TEST_F(ReadinessSetTest, shouldCheckAllImagesWhenReaderLapped)
+{
+    ReadinessSet readinessSet;
+    reports::StreamActivityReader reader(m_activityBuffer);
+    readinessSet.add(m_subscriptions[0]);
+    addImage(0, 0);
+    addImage(0, 1);
+
+    EXPECT_TRUE(activeSessionIds(readinessSet, reader).empty());
+
+    appendFrame(1, 0);
+    for (int i = 0; i < ACTIVITY_CAPACITY + 1; i++)
+    {
+        flagActivity(0);
+    }
+
+    EXPECT_EQ(activeSessionIds(readinessSet, reader), std::vector<std::int32_t>({ 1 }));
+    EXPECT_EQ(reader.lappedCount(), 1);
+}
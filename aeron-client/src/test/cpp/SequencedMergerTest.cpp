@@ -0,0 +1,188 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <concurrent/logbuffer/DataFrameHeader.h>
+#include <concurrent/CountersManager.h>
+#include "SequencedMerger.h"
+
+using namespace aeron::concurrent;
+using namespace aeron;
+
+#define TERM_LENGTH (LogBufferDescriptor::TERM_MIN_LENGTH)
+#define LOG_META_DATA_LENGTH (LogBufferDescriptor::LOG_META_DATA_LENGTH)
+#define FEED_COUNT (3)
+
+typedef std::array<std::uint8_t,
+    ((TERM_LENGTH * LogBufferDescriptor::PARTITION_COUNT) + LOG_META_DATA_LENGTH)> term_buffer_t;
+typedef std::array<std::uint8_t, FEED_COUNT * CountersReader::COUNTER_LENGTH> counter_values_t;
+
+static const std::int32_t STREAM_ID = 10;
+static const std::int32_t INITIAL_TERM_ID = 7;
+static const util::index_t MESSAGE_LENGTH = 8;
+static const util::index_t ALIGNED_FRAME_LENGTH =
+    BitUtil::align(DataFrameHeader::LENGTH + MESSAGE_LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+
+static void exceptionHandler(const std::exception&)
+{
+}
+
+class SequencedMergerTest : public testing::Test
+{
+public:
+    SequencedMergerTest() :
+        m_counterValuesBuffer(m_counterValues, 0)
+    {
+        m_counterValues.fill(0);
+
+        for (int feed = 0; feed < FEED_COUNT; feed++)
+        {
+            m_logs[feed].fill(0);
+            m_logBuffers[feed] = std::make_shared<LogBuffers>(
+                m_logs[feed].data(), static_cast<std::int64_t>(m_logs[feed].size()), TERM_LENGTH);
+
+            AtomicBuffer metaData = m_logBuffers[feed]->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX);
+            metaData.putInt32(LogBufferDescriptor::LOG_INITIAL_TERM_ID_OFFSET, INITIAL_TERM_ID);
+            metaData.putInt32(LogBufferDescriptor::LOG_MTU_LENGTH_OFFSET, 1408);
+            metaData.putInt32(LogBufferDescriptor::LOG_TERM_LENGTH_OFFSET, TERM_LENGTH);
+            metaData.putInt32(LogBufferDescriptor::LOG_PAGE_SIZE_OFFSET, LogBufferDescriptor::PAGE_MIN_SIZE);
+
+            UnsafeBufferPosition position(m_counterValuesBuffer, feed);
+            m_images.emplace_back(new Image(feed, feed, 1, "test", position, m_logBuffers[feed], exceptionHandler));
+            m_feeds.push_back(m_images.back().get());
+        }
+    }
+
+    void appendFrame(int feed, std::int64_t key, std::uint8_t flags = FrameDescriptor::UNFRAGMENTED)
+    {
+        AtomicBuffer termBuffer = m_logBuffers[feed]->atomicBuffer(0);
+        const util::index_t offset = m_tailOffsets[feed];
+        DataFrameHeader::DataFrameHeaderDefn& frame =
+            termBuffer.overlayStruct<DataFrameHeader::DataFrameHeaderDefn>(offset);
+
+        frame.version = DataFrameHeader::CURRENT_VERSION;
+        frame.flags = flags;
+        frame.type = DataFrameHeader::HDR_TYPE_DATA;
+        frame.termOffset = offset;
+        frame.sessionId = feed;
+        frame.streamId = STREAM_ID;
+        frame.termId = INITIAL_TERM_ID;
+        frame.reservedValue = key;
+        termBuffer.putInt64(offset + DataFrameHeader::LENGTH, key);
+        termBuffer.putInt32Ordered(offset, DataFrameHeader::LENGTH + MESSAGE_LENGTH);
+
+        m_tailOffsets[feed] += ALIGNED_FRAME_LENGTH;
+    }
+
+    int poll(SequencedMerger& merger, int fragmentLimit)
+    {
+        return merger.poll(
+            m_feeds,
+            [&](AtomicBuffer& buffer, util::index_t offset, util::index_t, Header& header)
+            {
+                m_received.emplace_back(header.sessionId(), buffer.getInt64(offset));
+            },
+            fragmentLimit);
+    }
+
+protected:
+    AERON_DECL_ALIGNED(term_buffer_t m_logs[FEED_COUNT], 16);
+    AERON_DECL_ALIGNED(counter_values_t m_counterValues, 16);
+    AtomicBuffer m_counterValuesBuffer;
+    std::shared_ptr<LogBuffers> m_logBuffers[FEED_COUNT];
+    util::index_t m_tailOffsets[FEED_COUNT] = {};
+    std::vector<std::unique_ptr<Image>> m_images;
+    std::vector<Image*> m_feeds;
+    std::vector<std::pair<std::int32_t, std::int64_t>> m_received;
+};
+
+TEST_F(SequencedMergerTest, shouldMergeFeedsInKeyOrder)
+{
+    SequencedMerger merger;
+
+    appendFrame(0, 10);
+    appendFrame(0, 40);
+    appendFrame(0, 41);
+    appendFrame(1, 20);
+    appendFrame(1, 50);
+    appendFrame(2, 5);
+    appendFrame(2, 30);
+
+    EXPECT_EQ(poll(merger, 10), 7);
+
+    const std::vector<std::pair<std::int32_t, std::int64_t>> expected =
+        { { 2, 5 }, { 0, 10 }, { 1, 20 }, { 2, 30 }, { 0, 40 }, { 0, 41 }, { 1, 50 } };
+    EXPECT_EQ(m_received, expected);
+}
+
+TEST_F(SequencedMergerTest, shouldMergeOnKeyInPayload)
+{
+    SequencedMerger merger(SequencedMerger::payloadKey<0>);
+
+    appendFrame(0, 2);
+    appendFrame(1, 1);
+    appendFrame(2, 3);
+
+    EXPECT_EQ(poll(merger, 10), 3);
+
+    const std::vector<std::pair<std::int32_t, std::int64_t>> expected = { { 1, 1 }, { 0, 2 }, { 2, 3 } };
+    EXPECT_EQ(m_received, expected);
+}
+
+TEST_F(SequencedMergerTest, shouldKeepFragmentsOfMessageTogetherUnderKeyOfFirst)
+{
+    SequencedMerger merger;
+
+    appendFrame(0, 10, FrameDescriptor::BEGIN_FRAG);
+    appendFrame(0, 99, 0);
+    appendFrame(0, 99, FrameDescriptor::END_FRAG);
+    appendFrame(1, 11);
+
+    EXPECT_EQ(poll(merger, 2), 2);
+    EXPECT_EQ(poll(merger, 10), 2);
+
+    const std::vector<std::pair<std::int32_t, std::int64_t>> expected =
+        { { 0, 10 }, { 0, 99 }, { 0, 99 }, { 1, 11 } };
+    EXPECT_EQ(m_received, expected);
+}
+
+TEST_F(SequencedMergerTest, shouldHoldBackWithinLookaheadWhileFeedIsEmpty)
+{
+    SequencedMerger merger(SequencedMerger::reservedValueKey, 100);
+
+    appendFrame(0, 10);
+    appendFrame(1, 20);
+    EXPECT_EQ(poll(merger, 10), 0);
+
+    appendFrame(1, 115);
+    EXPECT_EQ(poll(merger, 10), 1);
+
+    appendFrame(2, 12);
+    EXPECT_EQ(poll(merger, 10), 1);
+
+    appendFrame(0, 125);
+    appendFrame(2, 130);
+    EXPECT_EQ(poll(merger, 10), 2);
+
+    const std::vector<std::pair<std::int32_t, std::int64_t>> expected =
+        { { 0, 10 }, { 2, 12 }, { 1, 20 }, { 1, 115 } };
+    EXPECT_EQ(m_received, expected);
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <concurrent/BackoffIdleStrategy.h>
+
+using namespace aeron::concurrent;
+
+#define MAX_SPINS (2)
+#define MAX_YIELDS (3)
+#define MIN_PARK_PERIOD_NS (1)
+#define MAX_PARK_PERIOD_NS (8)
+
+class InspectableBackoffIdleStrategy : public BackoffIdleStrategy
+{
+public:
+    InspectableBackoffIdleStrategy() :
+        BackoffIdleStrategy(MAX_SPINS, MAX_YIELDS, MIN_PARK_PERIOD_NS, MAX_PARK_PERIOD_NS)
+    {
+    }
+
+    using BackoffIdleStrategy::State;
+
+    State state() const
+    {
+        return m_state;
+    }
+
+    std::int64_t spins() const
+    {
+        return m_spins;
+    }
+
+    std::int64_t yields() const
+    {
+        return m_yields;
+    }
+
+    std::int64_t parkPeriodNs() const
+    {
+        return m_parkPeriodNs;
+    }
+};
+
+typedef InspectableBackoffIdleStrategy::State State;
+
+class BackoffIdleStrategyTest : public testing::Test
+{
+protected:
+    void idleUntilParking()
+    {
+        for (int i = 0; i < 1 + MAX_SPINS + MAX_YIELDS + 1; i++)
+        {
+            m_idleStrategy.idle(0);
+        }
+
+        ASSERT_EQ(m_idleStrategy.state(), State::PARKING);
+    }
+
+    InspectableBackoffIdleStrategy m_idleStrategy;
+};
+
+TEST_F(BackoffIdleStrategyTest, shouldStartNotIdle)
+{
+    EXPECT_EQ(m_idleStrategy.state(), State::NOT_IDLE);
+    EXPECT_EQ(m_idleStrategy.parkPeriodNs(), MIN_PARK_PERIOD_NS);
+}
+
+TEST_F(BackoffIdleStrategyTest, shouldSpinThenYieldThenPark)
+{
+    m_idleStrategy.idle(0);
+    EXPECT_EQ(m_idleStrategy.state(), State::SPINNING);
+    EXPECT_EQ(m_idleStrategy.spins(), 1);
+
+    for (int i = 0; i < MAX_SPINS - 1; i++)
+    {
+        m_idleStrategy.idle(0);
+        EXPECT_EQ(m_idleStrategy.state(), State::SPINNING);
+    }
+
+    m_idleStrategy.idle(0);
+    EXPECT_EQ(m_idleStrategy.state(), State::YIELDING);
+    EXPECT_EQ(m_idleStrategy.yields(), 0);
+
+    for (int i = 0; i < MAX_YIELDS; i++)
+    {
+        m_idleStrategy.idle(0);
+        EXPECT_EQ(m_idleStrategy.state(), State::YIELDING);
+    }
+
+    m_idleStrategy.idle(0);
+    EXPECT_EQ(m_idleStrategy.state(), State::PARKING);
+    EXPECT_EQ(m_idleStrategy.parkPeriodNs(), MIN_PARK_PERIOD_NS);
+}
+
+TEST_F(BackoffIdleStrategyTest, shouldDoubleParkPeriodUpToMax)
+{
+    idleUntilParking();
+
+    std::int64_t expected = MIN_PARK_PERIOD_NS;
+    for (int i = 0; i < 6; i++)
+    {
+        m_idleStrategy.idle();
+        expected = std::min<std::int64_t>(expected * 2, MAX_PARK_PERIOD_NS);
+
+        EXPECT_EQ(m_idleStrategy.parkPeriodNs(), expected);
+        EXPECT_EQ(m_idleStrategy.state(), State::PARKING);
+    }
+
+    EXPECT_EQ(m_idleStrategy.parkPeriodNs(), MAX_PARK_PERIOD_NS);
+}
+
+TEST_F(BackoffIdleStrategyTest, shouldResetWhenWorkDone)
+{
+    idleUntilParking();
+    m_idleStrategy.idle(0);
+    ASSERT_GT(m_idleStrategy.parkPeriodNs(), MIN_PARK_PERIOD_NS);
+
+    m_idleStrategy.idle(1);
+
+    EXPECT_EQ(m_idleStrategy.state(), State::NOT_IDLE);
+    EXPECT_EQ(m_idleStrategy.spins(), 0);
+    EXPECT_EQ(m_idleStrategy.yields(), 0);
+    EXPECT_EQ(m_idleStrategy.parkPeriodNs(), MIN_PARK_PERIOD_NS);
+
+    m_idleStrategy.idle(0);
+    EXPECT_EQ(m_idleStrategy.state(), State::SPINNING);
+}
+
+TEST_F(BackoffIdleStrategyTest, shouldResetExplicitly)
+{
+    idleUntilParking();
+
+    m_idleStrategy.reset();
+
+    EXPECT_EQ(m_idleStrategy.state(), State::NOT_IDLE);
+    EXPECT_EQ(m_idleStrategy.parkPeriodNs(), MIN_PARK_PERIOD_NS);
+}
@@ -22,6 +22,8 @@
 #include "MockAtomicBuffer.h"
 #include <concurrent/broadcast/BroadcastBufferDescriptor.h>
 #include <concurrent/broadcast/BroadcastReceiver.h>
+#include <concurrent/broadcast/BroadcastTransmitter.h>
+#include <concurrent/broadcast/CopyBroadcastReceiver.h>
 
 using namespace aeron::concurrent::broadcast;
 using namespace aeron::concurrent::mock;
@@ -36,6 +38,7 @@ using namespace aeron;
 #define LATEST_COUNTER_INDEX (CAPACITY + BroadcastBufferDescriptor::LATEST_COUNTER_OFFSET)
 
 typedef std::array<std::uint8_t, TOTAL_BUFFER_LENGTH> buffer_t;
+typedef std::array<std::uint8_t, 64> src_buffer_t;
 
 class BroadcastReceiverTest : public testing::Test
 {
@@ -299,3 +302,67 @@ TEST_F(BroadcastReceiverTest, shouldDealWithRecordBecomingInvalidDueToOverwrite)
     EXPECT_EQ(m_broadcastReceiver.length(), length);
     EXPECT_FALSE(m_broadcastReceiver.validate());
 }
+
+TEST(CopyBroadcastReceiverTest, shouldReceiveInPlaceWhenWellAheadOfTransmitter)
+{
+    AERON_DECL_ALIGNED(buffer_t buffer, 16);
+    AERON_DECL_ALIGNED(src_buffer_t src, 16);
+    buffer.fill(0);
+    src.fill(0);
+    AtomicBuffer atomicBuffer(&buffer[0], buffer.size());
+    AtomicBuffer srcBuffer(&src[0], src.size());
+    BroadcastTransmitter transmitter(atomicBuffer);
+    BroadcastReceiver receiver(atomicBuffer);
+    CopyBroadcastReceiver copyReceiver(receiver);
+
+    srcBuffer.putInt32(0, 42);
+    transmitter.transmit(MSG_TYPE_ID, srcBuffer, 0, 8);
+
+    int timesCalled = 0;
+    const int messagesReceived = copyReceiver.receive(
+        [&](std::int32_t msgTypeId, AtomicBuffer& msgBuffer, util::index_t offset, util::index_t length)
+        {
+            EXPECT_EQ(msgTypeId, MSG_TYPE_ID);
+            EXPECT_EQ(length, 8);
+            EXPECT_EQ(msgBuffer.buffer(), atomicBuffer.buffer());
+            EXPECT_EQ(msgBuffer.getInt32(offset), 42);
+            timesCalled++;
+        });
+
+    EXPECT_EQ(messagesReceived, 1);
+    EXPECT_EQ(timesCalled, 1);
+}
+
+TEST(CopyBroadcastReceiverTest, shouldCopyWhenFallingBehindTransmitter)
+{
+    AERON_DECL_ALIGNED(buffer_t buffer, 16);
+    AERON_DECL_ALIGNED(src_buffer_t src, 16);
+    buffer.fill(0);
+    src.fill(0);
+    AtomicBuffer atomicBuffer(&buffer[0], buffer.size());
+    AtomicBuffer srcBuffer(&src[0], src.size());
+    BroadcastTransmitter transmitter(atomicBuffer);
+    BroadcastReceiver receiver(atomicBuffer);
+    CopyBroadcastReceiver copyReceiver(receiver);
+
+    const util::index_t length = 56;
+    const int messageCount = (CAPACITY * 3 / 4) / (length + RecordDescriptor::HEADER_LENGTH);
+    for (int i = 0; i < messageCount; i++)
+    {
+        srcBuffer.putInt32(0, i);
+        transmitter.transmit(MSG_TYPE_ID, srcBuffer, 0, length);
+    }
+
+    int timesCalled = 0;
+    const int messagesReceived = copyReceiver.receive(
+        [&](std::int32_t msgTypeId, AtomicBuffer& msgBuffer, util::index_t offset, util::index_t msgLength)
+        {
+            EXPECT_EQ(msgLength, length);
+            EXPECT_NE(msgBuffer.buffer(), atomicBuffer.buffer());
+            EXPECT_EQ(msgBuffer.getInt32(offset), 0);
+            timesCalled++;
+        });
+
+    EXPECT_EQ(messagesReceived, 1);
+    EXPECT_EQ(timesCalled, 1);
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <concurrent/AgentRunner.h>
+#include <concurrent/BusySpinIdleStrategy.h>
+#include <concurrent/CompositeAgent.h>
+#include <concurrent/DynamicCompositeAgent.h>
+
+using namespace aeron::concurrent;
+
+class RecordingAgent
+{
+public:
+    RecordingAgent(std::vector<std::string>& events, const std::string& name, int workCount = 1) :
+        m_events(events), m_name(name), m_workCount(workCount)
+    {
+    }
+
+    void onStart()
+    {
+        m_events.push_back(m_name + ":start");
+    }
+
+    int doWork()
+    {
+        m_events.push_back(m_name + ":work");
+        if (m_failNext)
+        {
+            m_failNext = false;
+            throw std::runtime_error(m_name);
+        }
+
+        return m_workCount;
+    }
+
+    void onClose()
+    {
+        m_events.push_back(m_name + ":close");
+    }
+
+    bool m_failNext = false;
+
+private:
+    std::vector<std::string>& m_events;
+    std::string m_name;
+    int m_workCount;
+};
+
+class CountingAgent
+{
+public:
+    void onStart()
+    {
+        m_started = true;
+    }
+
+    int doWork()
+    {
+        m_dutyCycles.fetch_add(1);
+        return 0;
+    }
+
+    void onClose()
+    {
+        m_closed = true;
+    }
+
+    std::atomic<long> m_dutyCycles { 0 };
+    bool m_started = false;
+    bool m_closed = false;
+};
+
+TEST(CompositeAgentTest, shouldRunAgentsInOrderAndSumWork)
+{
+    std::vector<std::string> events;
+    RecordingAgent a(events, "a", 1);
+    RecordingAgent b(events, "b", 2);
+    CompositeAgent composite;
+
+    composite.add(a).add(b);
+    composite.onStart();
+    EXPECT_EQ(composite.doWork(), 3);
+    composite.onClose();
+
+    EXPECT_EQ(events, std::vector<std::string>({ "a:start", "b:start", "a:work", "b:work", "a:close", "b:close" }));
+    EXPECT_EQ(composite.agentCount(), 2u);
+    EXPECT_EQ(composite.stats(1).dutyCycles, 1);
+    EXPECT_EQ(composite.stats(1).workCount, 2);
+    EXPECT_GE(composite.stats(1).maxNs, 0);
+    EXPECT_LE(composite.stats(1).maxNs, composite.stats(1).totalNs);
+}
+
+TEST(CompositeAgentTest, shouldContinueAfterFailingAgentOnNextDutyCycle)
+{
+    std::vector<std::string> events;
+    RecordingAgent a(events, "a");
+    RecordingAgent b(events, "b");
+    RecordingAgent c(events, "c");
+    CompositeAgent composite;
+
+    composite.add(a).add(b).add(c);
+    b.m_failNext = true;
+
+    EXPECT_THROW(composite.doWork(), std::runtime_error);
+    EXPECT_EQ(composite.doWork(), 1);
+    EXPECT_EQ(composite.doWork(), 3);
+
+    EXPECT_EQ(events, std::vector<std::string>({ "a:work", "b:work", "c:work", "a:work", "b:work", "c:work" }));
+}
+
+TEST(CompositeAgentTest, shouldApplyChangesInOrderOnAgentThread)
+{
+    std::vector<std::string> events;
+    RecordingAgent a(events, "a");
+    RecordingAgent b(events, "b");
+    DynamicCompositeAgent composite;
+
+    composite.add(a);
+    composite.add(b);
+    composite.remove(a);
+    EXPECT_FALSE(composite.hasAppliedChanges());
+    EXPECT_EQ(events.size(), 0u);
+
+    EXPECT_EQ(composite.doWork(), 1);
+    EXPECT_TRUE(composite.hasAppliedChanges());
+    EXPECT_EQ(composite.agentCount(), 1u);
+    EXPECT_EQ(events, std::vector<std::string>({ "a:start", "b:start", "a:close", "b:work" }));
+
+    composite.onClose();
+    EXPECT_EQ(events.back(), "b:close");
+    EXPECT_EQ(composite.agentCount(), 0u);
+}
+
+TEST(CompositeAgentTest, shouldAddAndRemoveAgentsWhileRunning)
+{
+    CountingAgent first;
+    CountingAgent second;
+    DynamicCompositeAgent composite;
+    BusySpinIdleStrategy idleStrategy;
+    logbuffer::exception_handler_t exceptionHandler = [](const std::exception&) {};
+    AgentRunner<DynamicCompositeAgent, BusySpinIdleStrategy> runner(composite, idleStrategy, exceptionHandler);
+
+    composite.add(first);
+    runner.start();
+
+    while (first.m_dutyCycles.load() == 0)
+    {
+        std::this_thread::yield();
+    }
+
+    composite.add(second);
+    composite.remove(first);
+    while (!composite.hasAppliedChanges())
+    {
+        std::this_thread::yield();
+    }
+
+    const long firstDutyCycles = first.m_dutyCycles.load();
+    while (second.m_dutyCycles.load() == 0)
+    {
+        std::this_thread::yield();
+    }
+
+    runner.close();
+
+    EXPECT_TRUE(first.m_started);
+    EXPECT_TRUE(first.m_closed);
+    EXPECT_EQ(first.m_dutyCycles.load(), firstDutyCycles);
+    EXPECT_TRUE(second.m_started);
+    EXPECT_TRUE(second.m_closed);
+}
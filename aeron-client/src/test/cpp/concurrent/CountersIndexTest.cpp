@@ -0,0 +1,123 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdint>
+#include <array>
+
+#include <gtest/gtest.h>
+
+#include <concurrent/AtomicBuffer.h>
+#include <concurrent/CountersManager.h>
+#include <concurrent/CountersIndex.h>
+
+#define FREE_TO_REUSE_TIMEOUT (1000L)
+
+static const std::int32_t NULL_COUNTER_ID = aeron::concurrent::CountersIndex::NULL_COUNTER_ID;
+
+using namespace aeron::concurrent;
+
+class CountersIndexTest : public testing::Test
+{
+public:
+    CountersIndexTest() :
+        m_countersManager(
+            AtomicBuffer(&m_metadataBuffer[0], m_metadataBuffer.size()),
+            AtomicBuffer(&m_valuesBuffer[0], m_valuesBuffer.size()),
+            [&]() { return m_currentTimestamp; },
+            FREE_TO_REUSE_TIMEOUT)
+    {
+        m_metadataBuffer.fill(0);
+        m_valuesBuffer.fill(0);
+    }
+
+    std::int32_t allocate(std::int32_t typeId, std::int64_t registrationId)
+    {
+        return m_countersManager.allocate(
+            typeId, reinterpret_cast<const std::uint8_t *>(&registrationId), sizeof(registrationId), "counter");
+    }
+
+    std::int32_t find(CountersIndex& index, std::int32_t typeId, std::int64_t registrationId)
+    {
+        return index.findCounterId(
+            typeId, reinterpret_cast<const std::uint8_t *>(&registrationId), sizeof(registrationId));
+    }
+
+    static const std::int32_t NUM_COUNTERS = 4;
+
+    std::int64_t m_currentTimestamp = 0;
+    std::array<std::uint8_t, NUM_COUNTERS * CountersReader::METADATA_LENGTH> m_metadataBuffer;
+    std::array<std::uint8_t, NUM_COUNTERS * CountersReader::COUNTER_LENGTH> m_valuesBuffer;
+    CountersManager m_countersManager;
+};
+
+TEST_F(CountersIndexTest, shouldFindCountersByTypeIdAndKey)
+{
+    const std::int32_t first = allocate(1, 100);
+    const std::int32_t second = allocate(2, 100);
+    const std::int32_t third = allocate(1, 200);
+    CountersIndex index(m_countersManager);
+
+    EXPECT_EQ(index.update(), 3);
+    EXPECT_EQ(index.size(), 3u);
+    EXPECT_EQ(find(index, 1, 100), first);
+    EXPECT_EQ(find(index, 2, 100), second);
+    EXPECT_EQ(find(index, 1, 200), third);
+    EXPECT_EQ(find(index, 2, 200), NULL_COUNTER_ID);
+}
+
+TEST_F(CountersIndexTest, shouldIndexCounterAllocatedAfterLastUpdateOnLookup)
+{
+    CountersIndex index(m_countersManager);
+    EXPECT_EQ(index.update(), 0);
+
+    const std::int32_t counterId = allocate(1, 100);
+
+    EXPECT_EQ(find(index, 1, 100), counterId);
+    EXPECT_EQ(index.size(), 1u);
+}
+
+TEST_F(CountersIndexTest, shouldNotFindReclaimedCounterAndIndexItsReplacement)
+{
+    const std::int32_t counterId = allocate(1, 100);
+    CountersIndex index(m_countersManager);
+
+    EXPECT_EQ(find(index, 1, 100), counterId);
+
+    m_countersManager.free(counterId);
+    EXPECT_EQ(find(index, 1, 100), NULL_COUNTER_ID);
+    EXPECT_EQ(index.size(), 0u);
+
+    m_currentTimestamp = FREE_TO_REUSE_TIMEOUT;
+    const std::int32_t reusedId = allocate(3, 300);
+
+    EXPECT_EQ(reusedId, counterId);
+    EXPECT_EQ(find(index, 1, 100), NULL_COUNTER_ID);
+    EXPECT_EQ(find(index, 3, 300), reusedId);
+}
+
+TEST_F(CountersIndexTest, shouldNotReturnStaleEntryWhenIdReusedBetweenUpdates)
+{
+    const std::int32_t counterId = allocate(1, 100);
+    CountersIndex index(m_countersManager);
+
+    EXPECT_EQ(find(index, 1, 100), counterId);
+
+    m_countersManager.free(counterId);
+    m_currentTimestamp = FREE_TO_REUSE_TIMEOUT;
+    EXPECT_EQ(allocate(1, 200), counterId);
+
+    EXPECT_EQ(find(index, 1, 100), NULL_COUNTER_ID);
+    EXPECT_EQ(find(index, 1, 200), counterId);
+}
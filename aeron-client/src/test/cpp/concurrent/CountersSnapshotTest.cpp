@@ -0,0 +1,104 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <concurrent/AtomicBuffer.h>
+#include <concurrent/CountersManager.h>
+#include <concurrent/CountersSnapshot.h>
+#include <util/Exceptions.h>
+
+using namespace aeron::concurrent;
+using namespace aeron::util;
+
+class CountersSnapshotTest : public testing::Test
+{
+public:
+    CountersSnapshotTest() :
+        m_countersManager(
+            AtomicBuffer(&m_metadataBuffer[0], m_metadataBuffer.size()),
+            AtomicBuffer(&m_valuesBuffer[0], m_valuesBuffer.size()))
+    {
+        m_metadataBuffer.fill(0);
+        m_valuesBuffer.fill(0);
+    }
+
+    static const std::int32_t NUM_COUNTERS = 4;
+
+    std::array<std::uint8_t, NUM_COUNTERS * CountersReader::METADATA_LENGTH> m_metadataBuffer;
+    std::array<std::uint8_t, NUM_COUNTERS * CountersReader::COUNTER_LENGTH> m_valuesBuffer;
+    CountersManager m_countersManager;
+};
+
+TEST_F(CountersSnapshotTest, shouldThrowWhenBufferTooSmall)
+{
+    std::vector<std::uint8_t> buffer(CountersSnapshot::bufferLength(NUM_COUNTERS, true) - 1);
+
+    ASSERT_THROW(
+    {
+        CountersSnapshot snapshot(buffer.data(), static_cast<index_t>(buffer.size()), NUM_COUNTERS, true);
+    }, IllegalArgumentException);
+}
+
+TEST_F(CountersSnapshotTest, shouldSnapshotValuesAndLabelsOfAllocatedCounters)
+{
+    const std::int32_t id0 = m_countersManager.allocate("lab0");
+    const std::int32_t id1 = m_countersManager.allocate("lab1");
+    const std::int32_t id2 = m_countersManager.allocate("lab2");
+    m_countersManager.free(id1);
+    m_countersManager.setCounterValue(id0, 11);
+    m_countersManager.setCounterValue(id2, 22);
+
+    std::vector<std::uint8_t> buffer(CountersSnapshot::bufferLength(NUM_COUNTERS, true));
+    CountersSnapshot snapshot(buffer.data(), static_cast<index_t>(buffer.size()), NUM_COUNTERS, true);
+
+    ASSERT_EQ(snapshot.take(m_countersManager, 5), 2);
+    EXPECT_EQ(snapshot.counterId(0), id0);
+    EXPECT_EQ(snapshot.value(0), 11);
+    EXPECT_EQ(snapshot.label(0), "lab0");
+    EXPECT_EQ(snapshot.counterId(1), id2);
+    EXPECT_EQ(snapshot.value(1), 22);
+    EXPECT_EQ(snapshot.label(1), "lab2");
+    EXPECT_EQ(snapshot.timestampNs(), 5);
+}
+
+TEST_F(CountersSnapshotTest, shouldComputeRatesBetweenSnapshots)
+{
+    const std::int32_t id0 = m_countersManager.allocate("lab0");
+
+    std::vector<std::uint8_t> previousBuffer(CountersSnapshot::bufferLength(NUM_COUNTERS, false));
+    std::vector<std::uint8_t> currentBuffer(CountersSnapshot::bufferLength(NUM_COUNTERS, false));
+    CountersSnapshot previous(previousBuffer.data(), static_cast<index_t>(previousBuffer.size()), NUM_COUNTERS, false);
+    CountersSnapshot current(currentBuffer.data(), static_cast<index_t>(currentBuffer.size()), NUM_COUNTERS, false);
+
+    m_countersManager.setCounterValue(id0, 1000);
+    previous.take(m_countersManager, 0);
+
+    m_countersManager.setCounterValue(id0, 3000);
+    const std::int32_t id1 = m_countersManager.allocate("lab1");
+    m_countersManager.setCounterValue(id1, 500);
+    ASSERT_EQ(current.take(m_countersManager, 2000000000L), 2);
+
+    current.computeRates(previous);
+
+    EXPECT_DOUBLE_EQ(current.rate(0), 1000.0);
+    EXPECT_DOUBLE_EQ(current.rate(1), 0.0);
+    EXPECT_FALSE(current.hasLabels());
+}
@@ -377,6 +377,72 @@ TEST_F(ManyToOneRingBufferTest, shouldCopeWithExceptionFromHandler)
     }
 }
 
+TEST_F(ManyToOneRingBufferTest, shouldWriteBatchWithSingleClaimAndPadRemainder)
+{
+    util::index_t length = 8;
+    util::index_t alignedRecordLength = ManyToOneRingBuffer::batchRecordLength(length);
+    ManyToOneRingBuffer::Batch batch;
+
+    ASSERT_TRUE(m_ringBuffer.tryClaimBatch(batch, alignedRecordLength * 3));
+    EXPECT_EQ(m_ab.getInt64(TAIL_COUNTER_INDEX), alignedRecordLength * 3);
+
+    ASSERT_TRUE(m_ringBuffer.writeBatch(batch, MSG_TYPE_ID, m_srcAb, 0, length));
+    ASSERT_TRUE(m_ringBuffer.writeBatch(batch, MSG_TYPE_ID, m_srcAb, 0, length));
+    m_ringBuffer.commitBatch(batch);
+
+    EXPECT_FALSE(m_ringBuffer.writeBatch(batch, MSG_TYPE_ID, m_srcAb, 0, length));
+    EXPECT_EQ(m_ab.getInt32(RecordDescriptor::typeOffset(alignedRecordLength * 2)), RecordDescriptor::PADDING_MSG_TYPE_ID);
+    EXPECT_EQ(m_ab.getInt32(RecordDescriptor::lengthOffset(alignedRecordLength * 2)), alignedRecordLength);
+
+    int timesCalled = 0;
+    const int messagesRead = m_ringBuffer.read([&](std::int32_t msgTypeId, concurrent::AtomicBuffer&, util::index_t, util::index_t)
+    {
+        EXPECT_EQ(msgTypeId, MSG_TYPE_ID);
+        timesCalled++;
+    });
+
+    EXPECT_EQ(messagesRead, 2);
+    EXPECT_EQ(timesCalled, 2);
+    EXPECT_EQ(m_ab.getInt64(HEAD_COUNTER_INDEX), alignedRecordLength * 3);
+}
+
+TEST_F(ManyToOneRingBufferTest, shouldRejectBatchClaimWhenInsufficientSpace)
+{
+    ManyToOneRingBuffer::Batch batch;
+    util::index_t length = 64;
+    util::index_t tail = CAPACITY - 32;
+
+    m_ab.putInt64(HEAD_COUNTER_INDEX, 0);
+    m_ab.putInt64(TAIL_COUNTER_INDEX, tail);
+
+    EXPECT_FALSE(m_ringBuffer.tryClaimBatch(batch, length));
+    EXPECT_EQ(m_ab.getInt64(TAIL_COUNTER_INDEX), tail);
+}
+
+TEST_F(ManyToOneRingBufferTest, shouldReadContiguousBlockOfCommittedRecords)
+{
+    util::index_t length = 8;
+    util::index_t alignedRecordLength = ManyToOneRingBuffer::batchRecordLength(length);
+
+    ASSERT_TRUE(m_ringBuffer.write(MSG_TYPE_ID, m_srcAb, 0, length));
+    ASSERT_TRUE(m_ringBuffer.write(MSG_TYPE_ID, m_srcAb, 0, length));
+
+    int timesCalled = 0;
+    const util::index_t bytesRead = m_ringBuffer.readBlock(
+        [&](concurrent::AtomicBuffer&, util::index_t index, util::index_t blockLength)
+        {
+            EXPECT_EQ(index, 0);
+            EXPECT_EQ(blockLength, alignedRecordLength * 2);
+            timesCalled++;
+        },
+        CAPACITY);
+
+    EXPECT_EQ(bytesRead, alignedRecordLength * 2);
+    EXPECT_EQ(timesCalled, 1);
+    EXPECT_EQ(m_ab.getInt64(HEAD_COUNTER_INDEX), alignedRecordLength * 2);
+    EXPECT_EQ(m_ab.getInt32(0), 0);
+}
+
 TEST_F(ManyToOneRingBufferTest, shouldNotUnblockWhenEmpty)
 {
     util::index_t tail = RecordDescriptor::ALIGNMENT * 4;
@@ -486,6 +552,34 @@ TEST_F(ManyToOneRingBufferTest, shouldNotUnblockGapWithMessageRaceWhenScanForwar
 #define NUM_IDS_PER_THREAD (10 * 1000 * 1000)
 #define NUM_PUBLISHERS (2)
 
+TEST_F(ManyToOneRingBufferTest, shouldPublishClaimedMessageOnlyOnCommit)
+{
+    const util::index_t length = 8;
+    const util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+    const util::index_t alignedRecordLength = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+
+    const util::index_t first = m_ringBuffer.tryClaim(MSG_TYPE_ID, length);
+    const util::index_t second = m_ringBuffer.tryClaim(MSG_TYPE_ID, length);
+    ASSERT_EQ(first, RecordDescriptor::HEADER_LENGTH);
+    ASSERT_EQ(second, alignedRecordLength + RecordDescriptor::HEADER_LENGTH);
+
+    int timesCalled = 0;
+    auto handler = [&](std::int32_t, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t)
+    {
+        EXPECT_EQ(buffer.getInt64(offset), 7);
+        timesCalled++;
+    };
+
+    m_ringBuffer.buffer().putInt64(second, 7);
+    m_ringBuffer.commit(second);
+    EXPECT_EQ(m_ringBuffer.read(handler), 0);
+
+    m_ringBuffer.abort(first);
+    EXPECT_EQ(m_ringBuffer.read(handler), 1);
+    EXPECT_EQ(timesCalled, 1);
+    EXPECT_EQ(m_ab.getInt64(HEAD_COUNTER_INDEX), alignedRecordLength * 2);
+}
+
 TEST(ManyToOneRingBufferConcurrentTest, shouldProvideCcorrelationIds)
 {
     AERON_DECL_ALIGNED(buffer_t mpscBuffer, 16);
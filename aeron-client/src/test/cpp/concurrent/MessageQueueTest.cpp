@@ -0,0 +1,176 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <array>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <concurrent/BusySpinIdleStrategy.h>
+#include <concurrent/YieldingIdleStrategy.h>
+#include <concurrent/ringbuffer/MessageQueue.h>
+
+using namespace aeron;
+using namespace aeron::concurrent::ringbuffer;
+using namespace aeron::concurrent;
+
+#define CAPACITY (1024)
+#define NUM_MESSAGES (100 * 1000)
+
+const static std::int32_t MSG_TYPE_ID = 7;
+
+TEST(MessageQueueTest, shouldDrainOfferedAndCommittedMessagesInOrder)
+{
+    OneToOneMessageQueue queue(CAPACITY);
+    std::array<std::uint8_t, 8> src;
+    AtomicBuffer srcBuffer(src);
+    std::vector<std::int32_t> values;
+
+    srcBuffer.putInt32(0, 1);
+    ASSERT_TRUE(queue.offer(MSG_TYPE_ID, srcBuffer, 0, sizeof(std::int32_t)));
+
+    const util::index_t index = queue.tryClaim(MSG_TYPE_ID + 1, sizeof(std::int32_t));
+    ASSERT_GE(index, 0);
+    queue.buffer().putInt32(index, 2);
+    queue.commit(index);
+
+    queue.abort(queue.tryClaim(MSG_TYPE_ID, sizeof(std::int32_t)));
+
+    const int messagesRead = queue.drain(
+        [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            EXPECT_EQ(length, static_cast<util::index_t>(sizeof(std::int32_t)));
+            values.push_back(msgTypeId * 10 + buffer.getInt32(offset));
+        });
+
+    EXPECT_EQ(messagesRead, 2);
+    EXPECT_EQ(values, std::vector<std::int32_t>({ 71, 82 }));
+    EXPECT_EQ(queue.size(), 0);
+}
+
+TEST(MessageQueueTest, shouldAlignRingBufferToCacheLine)
+{
+    ManyToOneMessageQueue queue(CAPACITY);
+
+    EXPECT_EQ(queue.capacity(), CAPACITY);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(queue.buffer().buffer()) % util::BitUtil::CACHE_LINE_LENGTH, 0u);
+}
+
+TEST(MessageQueueTest, shouldDrainNoMoreThanLengthLimit)
+{
+    OneToOneMessageQueue queue(CAPACITY);
+    std::array<std::uint8_t, 8> src;
+    AtomicBuffer srcBuffer(src, 0);
+    const util::index_t recordLength = ManyToOneRingBuffer::batchRecordLength(sizeof(std::int64_t));
+
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(queue.offer(MSG_TYPE_ID, srcBuffer, 0, sizeof(std::int64_t)));
+    }
+
+    auto handler = [](std::int32_t, AtomicBuffer&, util::index_t, util::index_t) {};
+
+    EXPECT_EQ(queue.drain(handler, recordLength * 2), 2);
+    EXPECT_EQ(queue.drain(handler, recordLength * 2), 1);
+}
+
+TEST(MessageQueueConcurrentTest, shouldHandOffClaimedMessagesBetweenThreads)
+{
+    OneToOneMessageQueue queue(CAPACITY);
+
+    std::thread producer(
+        [&]()
+        {
+            YieldingIdleStrategy idleStrategy;
+
+            for (std::int32_t i = 0; i < NUM_MESSAGES; i++)
+            {
+                const util::index_t index = queue.claim(MSG_TYPE_ID, sizeof(std::int32_t), idleStrategy);
+                queue.buffer().putInt32(index, i);
+                queue.commit(index);
+            }
+        });
+
+    YieldingIdleStrategy idleStrategy;
+    std::int32_t expected = 0;
+
+    while (expected < NUM_MESSAGES)
+    {
+        queue.take(
+            [&](std::int32_t, AtomicBuffer& buffer, util::index_t offset, util::index_t)
+            {
+                ASSERT_EQ(buffer.getInt32(offset), expected);
+                expected++;
+            },
+            idleStrategy);
+    }
+
+    producer.join();
+    EXPECT_EQ(expected, NUM_MESSAGES);
+}
+
+TEST(MessageQueueConcurrentTest, shouldMergeMessagesFromManyProducers)
+{
+    const int numProducers = 4;
+    ManyToOneMessageQueue queue(CAPACITY);
+    std::vector<std::thread> producers;
+
+    for (int id = 0; id < numProducers; id++)
+    {
+        producers.emplace_back(
+            [&queue, id]()
+            {
+                std::array<std::uint8_t, 8> src;
+                AtomicBuffer srcBuffer(src);
+                BusySpinIdleStrategy idleStrategy;
+
+                srcBuffer.putInt32(0, id);
+                for (std::int32_t i = 0; i < NUM_MESSAGES; i++)
+                {
+                    srcBuffer.putInt32(4, i);
+                    queue.put(MSG_TYPE_ID, srcBuffer, 0, 8, idleStrategy);
+                }
+            });
+    }
+
+    std::array<std::int32_t, numProducers> counts;
+    counts.fill(0);
+    YieldingIdleStrategy idleStrategy;
+    int messagesRead = 0;
+
+    while (messagesRead < NUM_MESSAGES * numProducers)
+    {
+        messagesRead += queue.take(
+            [&](std::int32_t, AtomicBuffer& buffer, util::index_t offset, util::index_t)
+            {
+                const std::int32_t id = buffer.getInt32(offset);
+
+                ASSERT_EQ(buffer.getInt32(offset + 4), counts[id]);
+                counts[id]++;
+            },
+            idleStrategy);
+    }
+
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    for (int id = 0; id < numProducers; id++)
+    {
+        EXPECT_EQ(counts[id], NUM_MESSAGES);
+    }
+}
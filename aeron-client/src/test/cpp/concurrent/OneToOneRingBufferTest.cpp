@@ -378,6 +378,87 @@ TEST_F(OneToOneRingBufferTest, shouldCopeWithExceptionFromHandler)
     }
 }
 
+TEST_F(OneToOneRingBufferTest, shouldPublishClaimedMessageOnlyOnCommit)
+{
+    const util::index_t length = 8;
+    const util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+    const util::index_t alignedRecordLength = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+
+    const util::index_t index = m_ringBuffer.tryClaim(MSG_TYPE_ID, length);
+    ASSERT_EQ(index, RecordDescriptor::HEADER_LENGTH);
+    EXPECT_EQ(m_ab.getInt64(TAIL_COUNTER_INDEX), alignedRecordLength);
+    EXPECT_EQ(m_ab.getInt32(RecordDescriptor::lengthOffset(0)), -recordLength);
+
+    int timesCalled = 0;
+    auto handler = [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t)
+    {
+        EXPECT_EQ(msgTypeId, MSG_TYPE_ID);
+        EXPECT_EQ(buffer.getInt64(offset), 42);
+        timesCalled++;
+    };
+
+    EXPECT_EQ(m_ringBuffer.read(handler), 0);
+
+    m_ringBuffer.buffer().putInt64(index, 42);
+    m_ringBuffer.commit(index);
+
+    EXPECT_EQ(m_ringBuffer.read(handler), 1);
+    EXPECT_EQ(timesCalled, 1);
+    EXPECT_EQ(m_ab.getInt64(HEAD_COUNTER_INDEX), alignedRecordLength);
+}
+
+TEST_F(OneToOneRingBufferTest, shouldSkipAbortedClaim)
+{
+    const util::index_t length = 8;
+
+    const util::index_t aborted = m_ringBuffer.tryClaim(MSG_TYPE_ID, length);
+    m_ringBuffer.abort(aborted);
+    ASSERT_TRUE(m_ringBuffer.write(MSG_TYPE_ID, m_srcAb, 0, length));
+
+    int timesCalled = 0;
+    const int messagesRead = m_ringBuffer.read(
+        [&](std::int32_t, concurrent::AtomicBuffer&, util::index_t offset, util::index_t)
+        {
+            EXPECT_NE(offset, aborted);
+            timesCalled++;
+        });
+
+    EXPECT_EQ(messagesRead, 1);
+    EXPECT_EQ(timesCalled, 1);
+}
+
+TEST_F(OneToOneRingBufferTest, shouldNotClaimWhenInsufficientCapacity)
+{
+    const util::index_t insufficientCapacity = OneToOneRingBuffer::INSUFFICIENT_CAPACITY;
+
+    m_ab.putInt64(HEAD_COUNTER_INDEX, 0);
+    m_ab.putInt64(TAIL_COUNTER_INDEX, CAPACITY);
+
+    EXPECT_EQ(m_ringBuffer.tryClaim(MSG_TYPE_ID, 8), insufficientCapacity);
+}
+
+TEST_F(OneToOneRingBufferTest, shouldReadContiguousBlockOfCommittedRecords)
+{
+    const util::index_t length = 8;
+    const util::index_t alignedRecordLength =
+        util::BitUtil::align(length + RecordDescriptor::HEADER_LENGTH, RecordDescriptor::ALIGNMENT);
+
+    ASSERT_TRUE(m_ringBuffer.write(MSG_TYPE_ID, m_srcAb, 0, length));
+    ASSERT_TRUE(m_ringBuffer.write(MSG_TYPE_ID, m_srcAb, 0, length));
+    m_ringBuffer.tryClaim(MSG_TYPE_ID, length);
+
+    const util::index_t bytesRead = m_ringBuffer.readBlock(
+        [&](concurrent::AtomicBuffer&, util::index_t offset, util::index_t blockLength)
+        {
+            EXPECT_EQ(offset, 0);
+            EXPECT_EQ(blockLength, alignedRecordLength * 2);
+        },
+        CAPACITY);
+
+    EXPECT_EQ(bytesRead, alignedRecordLength * 2);
+    EXPECT_EQ(m_ab.getInt64(HEAD_COUNTER_INDEX), alignedRecordLength * 2);
+}
+
 #define NUM_MESSAGES (10 * 1000 * 1000)
 #define NUM_IDS_PER_THREAD (10 * 1000 * 1000)
 
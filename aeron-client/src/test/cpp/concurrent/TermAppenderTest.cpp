@@ -15,6 +15,7 @@
  */
 
 #include <array>
+#include <cstring>
 
 #include <gtest/gtest.h>
 
@@ -285,3 +286,30 @@ TEST_F(TermAppenderTest, shouldClaimRegionForZeroCopyEncoding)
 
     bufferClaim.commit();
 }
+
+TEST_F(TermAppenderTest, shouldWritePrecomputedHeaderIdenticalToHeaderWriter)
+{
+    AERON_DECL_ALIGNED(hdr_t defaultHdrBuffer, 16);
+    AERON_DECL_ALIGNED(src_buffer_t expectedBuffer, 16);
+    AERON_DECL_ALIGNED(src_buffer_t actualBuffer, 16);
+    defaultHdrBuffer.fill(0);
+    expectedBuffer.fill(0);
+    actualBuffer.fill(0);
+
+    AtomicBuffer defaultHdr(defaultHdrBuffer, 0);
+    defaultHdr.putInt32(DataFrameHeader::SESSION_ID_FIELD_OFFSET, -7);
+    defaultHdr.putInt32(DataFrameHeader::STREAM_ID_FIELD_OFFSET, 1001);
+
+    AtomicBuffer expected(expectedBuffer, 0);
+    AtomicBuffer actual(actualBuffer, 0);
+    const HeaderWriter headerWriter(defaultHdr);
+    const PrecomputedHeaderWriter precomputedHeaderWriter(defaultHdr);
+    const util::index_t offset = 256;
+    const util::index_t frameLength = DataFrameHeader::LENGTH + 100;
+
+    headerWriter.write(expected, offset, frameLength, -TERM_ID);
+    precomputedHeaderWriter.write(actual, offset, frameLength, -TERM_ID);
+
+    EXPECT_EQ(actual.getInt32(offset), -frameLength);
+    EXPECT_EQ(std::memcmp(expected.buffer(), actual.buffer(), expected.capacity()), 0);
+}
@@ -178,3 +178,52 @@ TEST_F(TermBlockScannerTest, shouldReadOneMessageOnLimit)
 
     EXPECT_EQ(newOffset, alignedMessagelength);
 }
+
+TEST_F(TermBlockScannerTest, shouldRecordFramesOfBlock)
+{
+    const std::int32_t offset = 0;
+    const std::int32_t firstMessageLength = 50;
+    const std::int32_t secondMessageLength = 100;
+    const std::int32_t firstAlignedLength = util::BitUtil::align(firstMessageLength, FrameDescriptor::FRAME_ALIGNMENT);
+    const std::int32_t secondAlignedLength =
+        util::BitUtil::align(secondMessageLength, FrameDescriptor::FRAME_ALIGNMENT);
+    const std::int32_t limit = m_log.capacity();
+    std::vector<BlockFrame> frames = { { 999, 999 } };
+
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(offset)))
+        .WillOnce(testing::Return(firstMessageLength));
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(firstAlignedLength)))
+        .WillOnce(testing::Return(secondMessageLength));
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(firstAlignedLength + secondAlignedLength)))
+        .WillOnce(testing::Return(0));
+
+    const std::int32_t newOffset = TermBlockScanner::scan(m_log, offset, limit, frames);
+
+    EXPECT_EQ(newOffset, firstAlignedLength + secondAlignedLength);
+    ASSERT_EQ(frames.size(), 2u);
+    EXPECT_EQ(frames[0].termOffset, offset);
+    EXPECT_EQ(frames[0].frameLength, firstMessageLength);
+    EXPECT_EQ(frames[1].termOffset, firstAlignedLength);
+    EXPECT_EQ(frames[1].frameLength, secondMessageLength);
+}
+
+TEST_F(TermBlockScannerTest, shouldNotRecordFrameBeyondLimit)
+{
+    const std::int32_t offset = 0;
+    const std::int32_t messageLength = 50;
+    const std::int32_t alignedMessagelength = util::BitUtil::align(messageLength, FrameDescriptor::FRAME_ALIGNMENT);
+    const std::int32_t limit = (2 * alignedMessagelength) - 1;
+    std::vector<BlockFrame> frames;
+
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(offset)))
+        .WillOnce(testing::Return(messageLength));
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(alignedMessagelength)))
+        .WillOnce(testing::Return(messageLength));
+
+    const std::int32_t newOffset = TermBlockScanner::scan(m_log, offset, limit, frames);
+
+    EXPECT_EQ(newOffset, alignedMessagelength);
+    ASSERT_EQ(frames.size(), 1u);
+    EXPECT_EQ(frames[0].termOffset, offset);
+    EXPECT_EQ(frames[0].frameLength, messageLength);
+}
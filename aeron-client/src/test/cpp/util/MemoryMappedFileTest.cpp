@@ -18,8 +18,10 @@
 #include <string>
 
 #include <util/MemoryMappedFile.h>
+#include <LogBuffers.h>
 #include "TestUtils.h"
 
+using namespace aeron;
 using namespace aeron::util;
 using namespace aeron::test;
 
@@ -84,3 +86,70 @@ TEST(mmfileTest, writeReadCheck)
 
     ::unlink(name.c_str());
 }
+
+TEST(mmfileTest, releaseKeepsContents)
+{
+    MemoryMappedFile::ptr_t m;
+
+    const size_t size = 4 * MemoryMappedFile::getPageSize();
+    std::string name = makeTempFileName();
+
+    ASSERT_NO_THROW({
+        m = MemoryMappedFile::createNew(name.c_str(), 0, size);
+    });
+
+    for (size_t n = 0; n < size; n++)
+    {
+        m->getMemoryPtr()[n] = static_cast<uint8_t>(n & 0xff);
+    }
+
+    EXPECT_TRUE(m->adviseRandom());
+    EXPECT_TRUE(m->release(MemoryMappedFile::getPageSize(), 2 * MemoryMappedFile::getPageSize()));
+
+    for (size_t n = 0; n < size; n++)
+    {
+        ASSERT_EQ(m->getMemoryPtr()[n], static_cast<uint8_t>(n & 0xff));
+    }
+
+    ::unlink(name.c_str());
+}
+
+TEST(mmfileTest, lazyLogBuffersReleaseTermsOutsideWindowOnceActiveTermMoves)
+{
+    const std::int32_t termLength = LogBufferDescriptor::TERM_MIN_LENGTH;
+    const std::int32_t pageSize = static_cast<std::int32_t>(MemoryMappedFile::getPageSize());
+    const size_t logLength = static_cast<size_t>(util::BitUtil::align(
+        (static_cast<std::int64_t>(termLength) * LogBufferDescriptor::PARTITION_COUNT) +
+            LogBufferDescriptor::LOG_META_DATA_LENGTH,
+        static_cast<std::int64_t>(pageSize)));
+    std::string name = makeTempFileName();
+
+    {
+        MemoryMappedFile::ptr_t m = MemoryMappedFile::createNew(name.c_str(), 0, logLength);
+        AtomicBuffer logMetaDataBuffer(
+            m->getMemoryPtr() + (logLength - LogBufferDescriptor::LOG_META_DATA_LENGTH),
+            LogBufferDescriptor::LOG_META_DATA_LENGTH);
+
+        logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_TERM_LENGTH_OFFSET, termLength);
+        logMetaDataBuffer.putInt32(LogBufferDescriptor::LOG_PAGE_SIZE_OFFSET, pageSize);
+        m->getMemoryPtr()[0] = 42;
+    }
+
+    LogBuffers eager(name.c_str());
+    LogBuffers lazy(name.c_str(), true, true, true);
+    AtomicBuffer& logMetaDataBuffer = lazy.atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX);
+
+    EXPECT_FALSE(eager.isLazy());
+    EXPECT_EQ(eager.releaseInactiveTerms(), 0);
+
+    EXPECT_TRUE(lazy.isLazy());
+    EXPECT_EQ(lazy.releaseInactiveTerms(), LogBufferDescriptor::PARTITION_COUNT - 2);
+    EXPECT_EQ(lazy.releaseInactiveTerms(), 0);
+
+    LogBufferDescriptor::activeTermCountOrdered(logMetaDataBuffer, 1);
+    EXPECT_EQ(lazy.releaseInactiveTerms(), LogBufferDescriptor::PARTITION_COUNT - 2);
+    EXPECT_EQ(lazy.atomicBuffer(0).getUInt8(0), 42);
+    EXPECT_EQ(eager.atomicBuffer(0).getUInt8(0), 42);
+
+    ::unlink(name.c_str());
+}
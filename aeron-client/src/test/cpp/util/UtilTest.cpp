@@ -15,10 +15,14 @@
  */
 
 #include <cstdint>
+#include <map>
+#include <vector>
 
 #include <util/ScopeUtils.h>
 #include <util/StringUtil.h>
 #include <util/BitUtil.h>
+#include <util/FlatMap.h>
+#include <util/MemoryCopy.h>
 
 #include <gtest/gtest.h>
 
@@ -103,3 +107,108 @@ TEST(utilTests, numberOfTrailingZeroes)
     EXPECT_EQ(BitUtil::numberOfTrailingZeroes<std::uint32_t>(0xFFFF0000), 16);
     EXPECT_EQ(BitUtil::numberOfTrailingZeroes<std::uint32_t>(0x00000001), 0);
 }
+
+TEST(utilTests, int32FlatMapShouldInsertGetAndRemove)
+{
+    Int32FlatMap<int> map(2);
+    auto supply = [](int value) { return [value]() { return std::unique_ptr<int>(new int(value)); }; };
+
+    EXPECT_EQ(map.get(7), nullptr);
+    EXPECT_EQ(map.getOrInsert(7, supply(70)), 70);
+    EXPECT_EQ(map.getOrInsert(7, supply(71)), 70);
+
+    int *value = map.get(7);
+    for (std::int32_t key = 100; key < 200; key++)
+    {
+        map.getOrInsert(key, supply(key * 10));
+    }
+
+    EXPECT_EQ(map.size(), 101u);
+    EXPECT_EQ(map.get(7), value);
+
+    std::unique_ptr<int> removed = map.remove(7);
+    ASSERT_NE(removed, nullptr);
+    EXPECT_EQ(*removed, 70);
+    EXPECT_EQ(map.get(7), nullptr);
+    EXPECT_EQ(map.remove(7), nullptr);
+    EXPECT_EQ(map.size(), 100u);
+}
+
+TEST(utilTests, int32FlatMapShouldMatchStdMapOverRandomChurn)
+{
+    Int32FlatMap<std::int32_t> map;
+    std::map<std::int32_t, std::int32_t> expected;
+    std::uint32_t seed = 12345;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        const std::int32_t key = static_cast<std::int32_t>((seed >> 8) % 512) - 256;
+
+        if ((seed >> 4) & 1)
+        {
+            map.getOrInsert(key, [key]() { return std::unique_ptr<std::int32_t>(new std::int32_t(key)); });
+            expected.emplace(key, key);
+        }
+        else
+        {
+            map.remove(key);
+            expected.erase(key);
+        }
+    }
+
+    EXPECT_EQ(map.size(), expected.size());
+
+    for (std::int32_t key = -256; key < 256; key++)
+    {
+        std::int32_t *value = map.get(key);
+        if (expected.count(key) > 0)
+        {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(*value, key);
+        }
+        else
+        {
+            EXPECT_EQ(value, nullptr);
+        }
+    }
+}
+
+static void verifyCopy(std::size_t length, std::size_t dstOffset, std::size_t srcOffset)
+{
+    std::vector<std::uint8_t> src(length + srcOffset + 64);
+    std::vector<std::uint8_t> dst(length + dstOffset + 64, 0xAA);
+
+    for (std::size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = static_cast<std::uint8_t>(i * 7 + 1);
+    }
+
+    MemoryCopy::copy(&dst[dstOffset], &src[srcOffset], length);
+
+    for (std::size_t i = 0; i < dst.size(); i++)
+    {
+        const bool isCopied = i >= dstOffset && i < dstOffset + length;
+        const std::uint8_t expected = isCopied ? src[srcOffset + i - dstOffset] : static_cast<std::uint8_t>(0xAA);
+
+        ASSERT_EQ(dst[i], expected) << "length=" << length << " dstOffset=" << dstOffset << " index=" << i;
+    }
+}
+
+TEST(utilTests, memoryCopyShouldCopyEveryInlinedLengthAtAnyAlignment)
+{
+    for (std::size_t length = 0; length <= MemoryCopy::MID_COPY_LIMIT + 1; length++)
+    {
+        for (std::size_t offset = 0; offset < 4; offset++)
+        {
+            verifyCopy(length, offset, 3 - offset);
+        }
+    }
+}
+
+TEST(utilTests, memoryCopyShouldCopyLargeLengthsExactly)
+{
+    verifyCopy(4096 + 5, 1, 0);
+    verifyCopy(MemoryCopy::NON_TEMPORAL_COPY_THRESHOLD, 0, 0);
+    verifyCopy(MemoryCopy::NON_TEMPORAL_COPY_THRESHOLD + 37, 3, 1);
+}
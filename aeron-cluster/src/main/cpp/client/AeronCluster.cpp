@@ -0,0 +1,507 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <vector>
+#include <ChannelUri.h>
+#include "AeronCluster.h"
+
+using namespace aeron;
+using namespace aeron::cluster::client;
+using namespace aeron::cluster::codecs;
+
+const util::index_t AeronCluster::SESSION_HEADER_LENGTH;
+
+static std::int64_t nanoTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void checkResult(std::int64_t result)
+{
+    if (NOT_CONNECTED == result || PUBLICATION_CLOSED == result || MAX_POSITION_EXCEEDED == result)
+    {
+        throw ClusterException("unexpected publication state: " + std::to_string(result), SOURCEINFO);
+    }
+}
+
+AeronCluster::AeronCluster(const Context& context) :
+    m_ctx(context)
+{
+    m_ctx.conclude();
+    m_aeron = m_ctx.aeron();
+    m_messageTimeoutNs = m_ctx.messageTimeoutNs();
+    m_isUnicast = !m_ctx.clusterMemberEndpoints().empty();
+
+    const std::int64_t deadlineNs = nanoTime() + m_messageTimeoutNs;
+
+    m_subscription = awaitResource<Subscription>(
+        m_aeron->addSubscription(m_ctx.egressChannel(), m_ctx.egressStreamId()),
+        deadlineNs,
+        [this](std::int64_t id) { return m_aeron->findSubscription(id); });
+
+    connectToCluster(deadlineNs);
+    m_clusterSessionId = openSession(deadlineNs);
+
+    m_egressAdapter.reset(new EgressAdapter(
+        m_subscription,
+        m_clusterSessionId,
+        m_ctx.onMessage(),
+        m_ctx.onSessionEvent(),
+        [this](
+            std::int64_t clusterSessionId,
+            std::int64_t leadershipTermId,
+            std::int32_t leaderMemberId,
+            const std::string& memberEndpoints)
+        {
+            this->onNewLeader(clusterSessionId, leadershipTermId, leaderMemberId, memberEndpoints);
+        }));
+
+    m_sessionHeaderStorage.fill(0);
+    m_sessionHeaderBuffers[0].wrap(m_sessionHeaderStorage);
+    m_sessionHeaderEncoder.wrapAndApplyHeader(m_sessionHeaderBuffers[0], 0);
+    m_sessionHeaderEncoder.block().clusterSessionId = m_clusterSessionId;
+}
+
+AeronCluster::~AeronCluster()
+{
+    try
+    {
+        if (m_publication->isConnected())
+        {
+            sendCloseSession();
+        }
+    }
+    catch (const std::exception&)
+    {
+        // the cluster may already be gone, the session then times out on its side
+    }
+}
+
+int AeronCluster::pollEgress()
+{
+    if (-1 != m_pendingIngressRegistrationId)
+    {
+        checkPendingIngress();
+    }
+
+    return m_egressAdapter->poll();
+}
+
+bool AeronCluster::sendKeepAlive()
+{
+    const util::index_t length = SessionKeepAliveRequest::computeLength(0, 0);
+    int attempts = SEND_ATTEMPTS;
+
+    m_idleStrategy.reset();
+    while (true)
+    {
+        const std::int64_t result = m_publication->tryClaim(length, m_bufferClaim);
+        if (result > 0)
+        {
+            SessionKeepAliveRequest request;
+            request.wrapAndApplyHeader(m_bufferClaim.buffer(), m_bufferClaim.offset());
+            request.block().correlationId = 0;
+            request.block().clusterSessionId = m_clusterSessionId;
+            m_bufferClaim.commit();
+
+            return true;
+        }
+
+        checkResult(result);
+
+        if (--attempts <= 0)
+        {
+            return false;
+        }
+
+        m_idleStrategy.idle();
+    }
+}
+
+std::string AeronCluster::leaderEndpoint(const std::string& memberEndpoints)
+{
+    return memberEndpoints.substr(0, memberEndpoints.find(','));
+}
+
+void AeronCluster::idle()
+{
+    m_idleStrategy.idle();
+    invokeAeronClient();
+}
+
+void AeronCluster::invokeAeronClient()
+{
+    AgentInvoker<ClientConductor>& invoker = m_aeron->conductorAgentInvoker();
+
+    if (invoker.isStarted())
+    {
+        invoker.invoke();
+    }
+}
+
+std::string AeronCluster::ingressChannel(const std::string& endpoint) const
+{
+    return archive::client::ChannelUri::putParam(
+        m_ctx.ingressChannel(), archive::client::ChannelUri::ENDPOINT_PARAM_NAME, endpoint);
+}
+
+void AeronCluster::connectToCluster(std::int64_t deadlineNs)
+{
+    if (!m_isUnicast)
+    {
+        m_publication = awaitResource<ExclusivePublication>(
+            m_aeron->addExclusivePublication(m_ctx.ingressChannel(), m_ctx.ingressStreamId()),
+            deadlineNs,
+            [this](std::int64_t id) { return m_aeron->findExclusivePublication(id); });
+
+        m_idleStrategy.reset();
+        while (!m_publication->isConnected())
+        {
+            if (nanoTime() > deadlineNs)
+            {
+                throw TimeoutException("awaiting connection to cluster", SOURCEINFO);
+            }
+
+            idle();
+        }
+
+        return;
+    }
+
+    std::vector<std::string> endpoints;
+    const std::string& memberEndpoints = m_ctx.clusterMemberEndpoints();
+    std::string::size_type start = 0;
+
+    while (start <= memberEndpoints.length())
+    {
+        std::string::size_type end = memberEndpoints.find(',', start);
+        if (std::string::npos == end)
+        {
+            end = memberEndpoints.length();
+        }
+
+        if (end > start)
+        {
+            endpoints.push_back(memberEndpoints.substr(start, end - start));
+        }
+
+        start = end + 1;
+    }
+
+    std::vector<std::shared_ptr<ExclusivePublication>> publications;
+    for (const std::string& endpoint : endpoints)
+    {
+        publications.push_back(awaitResource<ExclusivePublication>(
+            m_aeron->addExclusivePublication(ingressChannel(endpoint), m_ctx.ingressStreamId()),
+            deadlineNs,
+            [this](std::int64_t id) { return m_aeron->findExclusivePublication(id); }));
+    }
+
+    m_idleStrategy.reset();
+    while (true)
+    {
+        for (std::size_t i = 0; i < publications.size(); i++)
+        {
+            if (publications[i]->isConnected())
+            {
+                // the others are closed as the vector goes out of scope
+                m_publication = publications[i];
+                m_ingressEndpoint = endpoints[i];
+                return;
+            }
+        }
+
+        if (nanoTime() > deadlineNs)
+        {
+            throw TimeoutException("awaiting connection to cluster", SOURCEINFO);
+        }
+
+        idle();
+    }
+}
+
+void AeronCluster::connectToMember(const std::string& endpoint, std::int64_t deadlineNs)
+{
+    m_publication = awaitResource<ExclusivePublication>(
+        m_aeron->addExclusivePublication(ingressChannel(endpoint), m_ctx.ingressStreamId()),
+        deadlineNs,
+        [this](std::int64_t id) { return m_aeron->findExclusivePublication(id); });
+    m_ingressEndpoint = endpoint;
+
+    m_idleStrategy.reset();
+    while (!m_publication->isConnected())
+    {
+        if (nanoTime() > deadlineNs)
+        {
+            throw TimeoutException("awaiting connection to cluster leader: " + endpoint, SOURCEINFO);
+        }
+
+        idle();
+    }
+}
+
+std::int64_t AeronCluster::openSession(std::int64_t deadlineNs)
+{
+    EgressPoller poller(m_subscription);
+    std::int64_t correlationId = sendConnectRequest(deadlineNs);
+
+    while (true)
+    {
+        pollNextResponse(correlationId, deadlineNs, poller);
+
+        if (poller.correlationId() != correlationId)
+        {
+            invokeAeronClient();
+            continue;
+        }
+
+        if (poller.isChallenged())
+        {
+            if (!m_ctx.onChallenge())
+            {
+                throw AuthenticationException("challenged by the cluster without a challenge handler", SOURCEINFO);
+            }
+
+            correlationId = sendChallengeResponse(
+                poller.clusterSessionId(), m_ctx.onChallenge()(poller.encodedChallenge()), deadlineNs);
+            continue;
+        }
+
+        if (!poller.isSessionEvent())
+        {
+            continue;
+        }
+
+        switch (poller.eventCode())
+        {
+            case EventCode::OK:
+                return poller.clusterSessionId();
+
+            case EventCode::REDIRECT:
+                // with multicast ingress the leader has the request too, so only unicast needs to follow it
+                if (m_isUnicast)
+                {
+                    const std::string endpoint = leaderEndpoint(poller.detail());
+                    if (endpoint != m_ingressEndpoint)
+                    {
+                        connectToMember(endpoint, deadlineNs);
+                        correlationId = sendConnectRequest(deadlineNs);
+                    }
+                }
+                break;
+
+            case EventCode::ERROR:
+                throw ClusterException(poller.detail(), SOURCEINFO);
+
+            case EventCode::AUTHENTICATION_REJECTED:
+                throw AuthenticationException(poller.detail(), SOURCEINFO);
+        }
+    }
+}
+
+void AeronCluster::pollNextResponse(std::int64_t correlationId, std::int64_t deadlineNs, EgressPoller& poller)
+{
+    m_idleStrategy.reset();
+    while (true)
+    {
+        const int fragments = poller.poll();
+        if (poller.isPollComplete())
+        {
+            break;
+        }
+
+        if (fragments > 0)
+        {
+            continue;
+        }
+
+        if (nanoTime() > deadlineNs)
+        {
+            throw TimeoutException(
+                "awaiting response for correlationId=" + std::to_string(correlationId), SOURCEINFO);
+        }
+
+        idle();
+    }
+}
+
+std::int64_t AeronCluster::sendConnectRequest(std::int64_t deadlineNs)
+{
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    const std::string& egressChannel = m_ctx.egressChannel();
+    const std::string& encodedCredentials = m_ctx.encodedCredentials();
+    const util::index_t length = SessionConnectRequest::computeLength(
+        static_cast<util::index_t>(egressChannel.length() + encodedCredentials.length()), 2);
+
+    m_idleStrategy.reset();
+    while (true)
+    {
+        const std::int64_t result = m_publication->tryClaim(length, m_bufferClaim);
+        if (result > 0)
+        {
+            SessionConnectRequest request;
+            request
+                .wrapAndApplyHeader(m_bufferClaim.buffer(), m_bufferClaim.offset())
+                .putVarData(egressChannel)
+                .putVarData(encodedCredentials);
+            request.block().correlationId = correlationId;
+            request.block().clusterSessionId = -1;
+            request.block().responseStreamId = m_ctx.egressStreamId();
+            m_bufferClaim.commit();
+
+            return correlationId;
+        }
+
+        if (PUBLICATION_CLOSED == result)
+        {
+            throw ClusterException("unexpected close of ingress to the cluster", SOURCEINFO);
+        }
+
+        if (nanoTime() > deadlineNs)
+        {
+            throw TimeoutException("failed to connect to cluster", SOURCEINFO);
+        }
+
+        idle();
+    }
+}
+
+std::int64_t AeronCluster::sendChallengeResponse(
+    std::int64_t clusterSessionId, const std::string& encodedCredentials, std::int64_t deadlineNs)
+{
+    const std::int64_t correlationId = m_aeron->nextCorrelationId();
+    const util::index_t length = ChallengeResponse::computeLength(
+        static_cast<util::index_t>(encodedCredentials.length()), 1);
+
+    m_idleStrategy.reset();
+    while (true)
+    {
+        const std::int64_t result = m_publication->tryClaim(length, m_bufferClaim);
+        if (result > 0)
+        {
+            ChallengeResponse response;
+            response
+                .wrapAndApplyHeader(m_bufferClaim.buffer(), m_bufferClaim.offset())
+                .putVarData(encodedCredentials);
+            response.block().correlationId = correlationId;
+            response.block().clusterSessionId = clusterSessionId;
+            m_bufferClaim.commit();
+
+            return correlationId;
+        }
+
+        checkResult(result);
+
+        if (nanoTime() > deadlineNs)
+        {
+            throw TimeoutException("failed to send challenge response", SOURCEINFO);
+        }
+
+        idle();
+    }
+}
+
+void AeronCluster::sendCloseSession()
+{
+    const util::index_t length = SessionCloseRequest::computeLength(0, 0);
+    int attempts = SEND_ATTEMPTS;
+
+    m_idleStrategy.reset();
+    while (true)
+    {
+        const std::int64_t result = m_publication->tryClaim(length, m_bufferClaim);
+        if (result > 0)
+        {
+            SessionCloseRequest request;
+            request.wrapAndApplyHeader(m_bufferClaim.buffer(), m_bufferClaim.offset());
+            request.block().clusterSessionId = m_clusterSessionId;
+            m_bufferClaim.commit();
+            return;
+        }
+
+        checkResult(result);
+
+        if (--attempts <= 0)
+        {
+            return;
+        }
+
+        m_idleStrategy.idle();
+    }
+}
+
+void AeronCluster::onNewLeader(
+    std::int64_t clusterSessionId,
+    std::int64_t leadershipTermId,
+    std::int32_t leaderMemberId,
+    const std::string& memberEndpoints)
+{
+    if (m_isUnicast)
+    {
+        const std::string endpoint = leaderEndpoint(memberEndpoints);
+        if (!endpoint.empty() && endpoint != m_ingressEndpoint && endpoint != m_pendingIngressEndpoint)
+        {
+            m_pendingIngressRegistrationId = m_aeron->addExclusivePublication(
+                ingressChannel(endpoint), m_ctx.ingressStreamId());
+            m_pendingIngressEndpoint = endpoint;
+        }
+    }
+
+    if (m_ctx.onNewLeader())
+    {
+        m_ctx.onNewLeader()(clusterSessionId, leadershipTermId, leaderMemberId, memberEndpoints);
+    }
+}
+
+void AeronCluster::checkPendingIngress()
+{
+    std::shared_ptr<ExclusivePublication> publication =
+        m_aeron->findExclusivePublication(m_pendingIngressRegistrationId);
+
+    if (nullptr != publication)
+    {
+        m_publication = publication;
+        m_ingressEndpoint = m_pendingIngressEndpoint;
+        m_pendingIngressRegistrationId = -1;
+        m_pendingIngressEndpoint.clear();
+    }
+}
+
+template<typename Resource, typename Find>
+std::shared_ptr<Resource> AeronCluster::awaitResource(
+    std::int64_t registrationId, std::int64_t deadlineNs, Find&& find)
+{
+    m_idleStrategy.reset();
+
+    while (true)
+    {
+        std::shared_ptr<Resource> resource = find(registrationId);
+        if (nullptr != resource)
+        {
+            return resource;
+        }
+
+        if (nanoTime() > deadlineNs)
+        {
+            throw TimeoutException(
+                "media driver did not add resource: registrationId=" + std::to_string(registrationId), SOURCEINFO);
+        }
+
+        idle();
+    }
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_CLUSTER_CLIENT_AERON_CLUSTER__
+#define INCLUDED_AERON_CLUSTER_CLIENT_AERON_CLUSTER__
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <array>
+#include <memory>
+#include <Aeron.h>
+#include <concurrent/BackoffIdleStrategy.h>
+#include "ClusterConfiguration.h"
+#include "ClusterException.h"
+#include "EgressPoller.h"
+#include "EgressAdapter.h"
+
+/// Client for Aeron Cluster
+namespace aeron { namespace cluster { namespace client {
+
+/**
+ * Client for sending messages to, and receiving them from, an Aeron Cluster, a port of the Java AeronCluster.
+ * <p>
+ * Connecting opens a session with the cluster, blocking until the cluster responds, and follows a REDIRECT to the
+ * leader when the ingress is unicast. Once open, messages are offered on an exclusive ingress publication prefixed
+ * with a session header and egress is dispatched to the handlers of the context by {@link #pollEgress()}. Neither
+ * allocates, so one thread may drive both on a latency sensitive path. When a new leader is elected the unicast
+ * ingress is moved to it in the background: offers return NOT_CONNECTED, or BACK_PRESSURED, until it connects.
+ * <p>
+ * Not thread safe. When the Aeron client uses an AgentInvoker for its conductor it is invoked while waiting and by
+ * {@link #pollEgress()}.
+ */
+class AeronCluster
+{
+public:
+    static const int SEND_ATTEMPTS = 3;
+
+    /// Length of the session header which precedes each message in a claim.
+    static const util::index_t SESSION_HEADER_LENGTH = codecs::SESSION_HEADER_LENGTH;
+
+    /**
+     * Connect to a cluster, blocking until the session is open.
+     *
+     * @param context for configuration of the client.
+     * @return the connected cluster client.
+     */
+    inline static std::shared_ptr<AeronCluster> connect(const Context& context)
+    {
+        return std::make_shared<AeronCluster>(context);
+    }
+
+    inline static std::shared_ptr<AeronCluster> connect()
+    {
+        return connect(Context());
+    }
+
+    explicit AeronCluster(const Context& context);
+
+    /**
+     * Close the session and release the publication and subscription.
+     */
+    ~AeronCluster();
+
+    AeronCluster(const AeronCluster&) = delete;
+    AeronCluster& operator=(const AeronCluster&) = delete;
+
+    inline const Context& context() const
+    {
+        return m_ctx;
+    }
+
+    inline std::int64_t clusterSessionId() const
+    {
+        return m_clusterSessionId;
+    }
+
+    inline std::shared_ptr<ExclusivePublication> ingressPublication() const
+    {
+        return m_publication;
+    }
+
+    inline std::shared_ptr<Subscription> egressSubscription() const
+    {
+        return m_subscription;
+    }
+
+    /**
+     * Claim space for a message to the clustered service and write the session header. The message is encoded from
+     * bufferClaim.offset() + SESSION_HEADER_LENGTH and the claim must then be committed, or aborted.
+     *
+     * @param correlationId for the message, returned with any response from the service.
+     * @param length        of the message, excluding the session header.
+     * @param bufferClaim   to be wrapped around the claimed space.
+     * @return the new stream position, otherwise NOT_CONNECTED, BACK_PRESSURED, ADMIN_ACTION or PUBLICATION_CLOSED.
+     */
+    inline std::int64_t tryClaim(
+        std::int64_t correlationId, util::index_t length, concurrent::logbuffer::BufferClaim& bufferClaim)
+    {
+        const std::int64_t result = m_publication->tryClaim(length + SESSION_HEADER_LENGTH, bufferClaim);
+
+        if (result > 0)
+        {
+            m_sessionHeaderEncoder.wrapAndApplyHeader(bufferClaim.buffer(), bufferClaim.offset());
+            codecs::SessionHeaderDefn& sessionHeader = m_sessionHeaderEncoder.block();
+            sessionHeader.correlationId = correlationId;
+            sessionHeader.clusterSessionId = m_clusterSessionId;
+        }
+
+        return result;
+    }
+
+    /**
+     * Offer a message to the clustered service, prefixed with the session header.
+     *
+     * @param correlationId for the message, returned with any response from the service.
+     * @param buffer        containing the message.
+     * @param offset        of the message in the buffer.
+     * @param length        of the message.
+     * @return the new stream position, otherwise NOT_CONNECTED, BACK_PRESSURED, ADMIN_ACTION or PUBLICATION_CLOSED.
+     */
+    inline std::int64_t offer(
+        std::int64_t correlationId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        m_sessionHeaderBuffers[0].putInt64(
+            codecs::MESSAGE_HEADER_LENGTH + offsetof(codecs::SessionHeaderDefn, correlationId), correlationId);
+        m_sessionHeaderBuffers[1].wrap(buffer.buffer() + offset, static_cast<size_t>(length));
+
+        return m_publication->offer(m_sessionHeaderBuffers);
+    }
+
+    /**
+     * Poll the egress subscription and dispatch messages and events for this session to the handlers of the context.
+     *
+     * @return the number of fragments read.
+     */
+    int pollEgress();
+
+    /**
+     * Send a keep alive to the cluster so this session is not timed out.
+     *
+     * @return true if sent, false if back pressured after SEND_ATTEMPTS.
+     */
+    bool sendKeepAlive();
+
+    /**
+     * The endpoint of the leader in a list of member endpoints from the cluster, which has the leader first.
+     */
+    static std::string leaderEndpoint(const std::string& memberEndpoints);
+
+private:
+    Context m_ctx;
+    std::shared_ptr<Aeron> m_aeron;
+    std::int64_t m_messageTimeoutNs;
+    bool m_isUnicast;
+    concurrent::BackoffIdleStrategy m_idleStrategy;
+    std::shared_ptr<Subscription> m_subscription;
+    std::shared_ptr<ExclusivePublication> m_publication;
+    std::string m_ingressEndpoint;
+    std::int64_t m_pendingIngressRegistrationId = -1;
+    std::string m_pendingIngressEndpoint;
+    std::unique_ptr<EgressAdapter> m_egressAdapter;
+    std::int64_t m_clusterSessionId = -1;
+
+    concurrent::logbuffer::BufferClaim m_bufferClaim;
+    codecs::SessionHeader m_sessionHeaderEncoder;
+    std::array<std::uint8_t, codecs::SESSION_HEADER_LENGTH> m_sessionHeaderStorage;
+    std::array<concurrent::AtomicBuffer, 2> m_sessionHeaderBuffers;
+
+    void idle();
+    void invokeAeronClient();
+    std::string ingressChannel(const std::string& endpoint) const;
+    void connectToCluster(std::int64_t deadlineNs);
+    void connectToMember(const std::string& endpoint, std::int64_t deadlineNs);
+    std::int64_t openSession(std::int64_t deadlineNs);
+    void pollNextResponse(std::int64_t correlationId, std::int64_t deadlineNs, EgressPoller& poller);
+    std::int64_t sendConnectRequest(std::int64_t deadlineNs);
+    std::int64_t sendChallengeResponse(
+        std::int64_t clusterSessionId, const std::string& encodedCredentials, std::int64_t deadlineNs);
+    void sendCloseSession();
+    void onNewLeader(
+        std::int64_t clusterSessionId,
+        std::int64_t leadershipTermId,
+        std::int32_t leaderMemberId,
+        const std::string& memberEndpoints);
+    void checkPendingIngress();
+
+    template<typename Resource, typename Find>
+    std::shared_ptr<Resource> awaitResource(std::int64_t registrationId, std::int64_t deadlineNs, Find&& find);
+};
+
+}}}
+
+#endif
@@ -0,0 +1,305 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_CLUSTER_CLIENT_CLUSTER_CONFIGURATION__
+#define INCLUDED_AERON_CLUSTER_CLIENT_CLUSTER_CONFIGURATION__
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <functional>
+#include <Aeron.h>
+#include "EgressListener.h"
+
+namespace aeron { namespace cluster { namespace client {
+
+/**
+ * Defaults for the cluster client, matching the Java AeronCluster.Configuration.
+ */
+namespace Configuration {
+
+static const std::int64_t MESSAGE_TIMEOUT_DEFAULT_NS = 5 * 1000 * 1000 * 1000LL;
+
+static const char *const INGRESS_CHANNEL_DEFAULT = "aeron:udp?endpoint=localhost:9010";
+static const std::int32_t INGRESS_STREAM_ID_DEFAULT = 1;
+
+static const char *const EGRESS_CHANNEL_DEFAULT = "aeron:udp?endpoint=localhost:9020";
+static const std::int32_t EGRESS_STREAM_ID_DEFAULT = 2;
+
+}
+
+/**
+ * Supplies the response to a challenge from the cluster when opening a session.
+ *
+ * @param encodedChallenge from the cluster.
+ * @return the encoded credentials in response.
+ */
+typedef std::function<std::string(const std::string& encodedChallenge)> on_challenge_t;
+
+/**
+ * Configuration for an {@link AeronCluster} client.
+ * <p>
+ * If no Aeron client is supplied one is connected, using the aeron directory, when the cluster client connects and
+ * is closed with it. A supplied Aeron client is shared and left open.
+ */
+class Context
+{
+public:
+    using this_t = Context;
+
+    /// @cond HIDDEN_SYMBOLS
+    this_t& conclude()
+    {
+        if (nullptr == m_aeron)
+        {
+            m_aeronContext.aeronDir(m_aeronDirectoryName);
+            m_aeron = Aeron::connect(m_aeronContext);
+            m_ownsAeronClient = true;
+        }
+
+        return *this;
+    }
+    /// @endcond
+
+    /**
+     * Set the timeout to wait for the cluster to connect and respond to a request.
+     *
+     * @param timeoutNs to wait for a response.
+     * @return reference to this Context instance
+     */
+    inline this_t& messageTimeoutNs(std::int64_t timeoutNs)
+    {
+        m_messageTimeoutNs = timeoutNs;
+        return *this;
+    }
+
+    inline std::int64_t messageTimeoutNs() const
+    {
+        return m_messageTimeoutNs;
+    }
+
+    /**
+     * Set the ingress endpoints of the cluster members, separated by commas, for when the ingress channel is unicast.
+     * Each is substituted for the endpoint of the ingress channel and the first member to connect is used. Leave empty
+     * when the ingress channel is multicast.
+     *
+     * @param endpoints of the members, e.g. localhost:9010,localhost:9011,localhost:9012
+     * @return reference to this Context instance
+     */
+    inline this_t& clusterMemberEndpoints(const std::string& endpoints)
+    {
+        m_clusterMemberEndpoints = endpoints;
+        return *this;
+    }
+
+    inline const std::string& clusterMemberEndpoints() const
+    {
+        return m_clusterMemberEndpoints;
+    }
+
+    /**
+     * Set the channel on which messages are sent to the cluster.
+     *
+     * @param channel for ingress.
+     * @return reference to this Context instance
+     */
+    inline this_t& ingressChannel(const std::string& channel)
+    {
+        m_ingressChannel = channel;
+        return *this;
+    }
+
+    inline const std::string& ingressChannel() const
+    {
+        return m_ingressChannel;
+    }
+
+    inline this_t& ingressStreamId(std::int32_t streamId)
+    {
+        m_ingressStreamId = streamId;
+        return *this;
+    }
+
+    inline std::int32_t ingressStreamId() const
+    {
+        return m_ingressStreamId;
+    }
+
+    /**
+     * Set the channel on which the cluster sends messages to this client. It must be reachable from every member.
+     *
+     * @param channel for egress.
+     * @return reference to this Context instance
+     */
+    inline this_t& egressChannel(const std::string& channel)
+    {
+        m_egressChannel = channel;
+        return *this;
+    }
+
+    inline const std::string& egressChannel() const
+    {
+        return m_egressChannel;
+    }
+
+    inline this_t& egressStreamId(std::int32_t streamId)
+    {
+        m_egressStreamId = streamId;
+        return *this;
+    }
+
+    inline std::int32_t egressStreamId() const
+    {
+        return m_egressStreamId;
+    }
+
+    /**
+     * Set the credentials sent with the request to open a session.
+     *
+     * @param encodedCredentials for the authenticator of the cluster.
+     * @return reference to this Context instance
+     */
+    inline this_t& encodedCredentials(const std::string& encodedCredentials)
+    {
+        m_encodedCredentials = encodedCredentials;
+        return *this;
+    }
+
+    inline const std::string& encodedCredentials() const
+    {
+        return m_encodedCredentials;
+    }
+
+    /**
+     * Set the handler for a challenge from the cluster when opening a session. A challenge without a handler fails
+     * the connect with an AuthenticationException.
+     *
+     * @param handler for a challenge.
+     * @return reference to this Context instance
+     */
+    inline this_t& onChallenge(const on_challenge_t& handler)
+    {
+        m_onChallenge = handler;
+        return *this;
+    }
+
+    inline const on_challenge_t& onChallenge() const
+    {
+        return m_onChallenge;
+    }
+
+    /**
+     * Set the handler for messages from the clustered service to this session.
+     *
+     * @param handler for messages.
+     * @return reference to this Context instance
+     */
+    inline this_t& onMessage(const on_egress_message_t& handler)
+    {
+        m_onMessage = handler;
+        return *this;
+    }
+
+    inline const on_egress_message_t& onMessage() const
+    {
+        return m_onMessage;
+    }
+
+    inline this_t& onSessionEvent(const on_session_event_t& handler)
+    {
+        m_onSessionEvent = handler;
+        return *this;
+    }
+
+    inline const on_session_event_t& onSessionEvent() const
+    {
+        return m_onSessionEvent;
+    }
+
+    inline this_t& onNewLeader(const on_new_leader_t& handler)
+    {
+        m_onNewLeader = handler;
+        return *this;
+    }
+
+    inline const on_new_leader_t& onNewLeader() const
+    {
+        return m_onNewLeader;
+    }
+
+    /**
+     * Set the directory of the media driver used when no Aeron client is supplied.
+     *
+     * @param directory of the media driver.
+     * @return reference to this Context instance
+     */
+    inline this_t& aeronDirectoryName(const std::string& directory)
+    {
+        m_aeronDirectoryName = directory;
+        return *this;
+    }
+
+    inline const std::string& aeronDirectoryName() const
+    {
+        return m_aeronDirectoryName;
+    }
+
+    /**
+     * Supply the Aeron client to use. It is not closed when the cluster client is closed.
+     *
+     * @param aeron client to use.
+     * @return reference to this Context instance
+     */
+    inline this_t& aeron(std::shared_ptr<Aeron> aeron)
+    {
+        m_aeron = std::move(aeron);
+        m_ownsAeronClient = false;
+        return *this;
+    }
+
+    inline std::shared_ptr<Aeron> aeron() const
+    {
+        return m_aeron;
+    }
+
+    inline bool ownsAeronClient() const
+    {
+        return m_ownsAeronClient;
+    }
+
+private:
+    std::int64_t m_messageTimeoutNs = Configuration::MESSAGE_TIMEOUT_DEFAULT_NS;
+    std::string m_clusterMemberEndpoints;
+    std::string m_ingressChannel = Configuration::INGRESS_CHANNEL_DEFAULT;
+    std::int32_t m_ingressStreamId = Configuration::INGRESS_STREAM_ID_DEFAULT;
+    std::string m_egressChannel = Configuration::EGRESS_CHANNEL_DEFAULT;
+    std::int32_t m_egressStreamId = Configuration::EGRESS_STREAM_ID_DEFAULT;
+    std::string m_encodedCredentials;
+    on_challenge_t m_onChallenge;
+    on_egress_message_t m_onMessage;
+    on_session_event_t m_onSessionEvent;
+    on_new_leader_t m_onNewLeader;
+    std::string m_aeronDirectoryName = aeron::Context::defaultAeronPath();
+
+    /* an Aeron client keeps a reference to its context so this must outlive m_aeron, which is declared after it */
+    aeron::Context m_aeronContext;
+    std::shared_ptr<Aeron> m_aeron;
+    bool m_ownsAeronClient = false;
+};
+
+}}}
+
+#endif
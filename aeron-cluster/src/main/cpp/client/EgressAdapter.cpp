@@ -0,0 +1,111 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EgressAdapter.h"
+
+using namespace aeron;
+using namespace aeron::cluster::client;
+using namespace aeron::cluster::codecs;
+
+EgressAdapter::EgressAdapter(
+    std::shared_ptr<Subscription> subscription,
+    std::int64_t clusterSessionId,
+    const on_egress_message_t& onMessage,
+    const on_session_event_t& onSessionEvent,
+    const on_new_leader_t& onNewLeader,
+    int fragmentLimit) :
+    m_subscription(std::move(subscription)),
+    m_clusterSessionId(clusterSessionId),
+    m_onMessage(onMessage),
+    m_onSessionEvent(onSessionEvent),
+    m_onNewLeader(onNewLeader),
+    m_fragmentLimit(fragmentLimit),
+    m_fragmentAssembler(
+        [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            this->onFragment(buffer, offset, length, header);
+        }),
+    m_fragmentHandler(m_fragmentAssembler.handler())
+{
+}
+
+void EgressAdapter::onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+{
+    if (length < MESSAGE_HEADER_LENGTH || SCHEMA_ID != codecs::schemaId(buffer, offset))
+    {
+        return;
+    }
+
+    switch (codecs::templateId(buffer, offset))
+    {
+        case SessionHeader::TEMPLATE_ID:
+        {
+            m_sessionHeader.wrapForDecode(buffer, offset);
+            const SessionHeaderDefn& sessionHeader = m_sessionHeader.block();
+
+            if (sessionHeader.clusterSessionId == m_clusterSessionId && m_onMessage)
+            {
+                const util::index_t headerLength = m_sessionHeader.encodedLength();
+                m_onMessage(
+                    sessionHeader.correlationId,
+                    sessionHeader.clusterSessionId,
+                    sessionHeader.timestamp,
+                    buffer,
+                    offset + headerLength,
+                    length - headerLength,
+                    header);
+            }
+            break;
+        }
+
+        case SessionEvent::TEMPLATE_ID:
+        {
+            m_sessionEvent.wrapForDecode(buffer, offset);
+            const SessionEventDefn& sessionEvent = m_sessionEvent.block();
+
+            if (sessionEvent.clusterSessionId == m_clusterSessionId && m_onSessionEvent)
+            {
+                m_sessionEvent.nextVarData(m_detail);
+                m_onSessionEvent(
+                    sessionEvent.correlationId,
+                    sessionEvent.clusterSessionId,
+                    static_cast<EventCode>(sessionEvent.code),
+                    m_detail);
+            }
+            break;
+        }
+
+        case NewLeaderEvent::TEMPLATE_ID:
+        {
+            m_newLeaderEvent.wrapForDecode(buffer, offset);
+            const NewLeaderEventDefn& newLeaderEvent = m_newLeaderEvent.block();
+
+            if (newLeaderEvent.clusterSessionId == m_clusterSessionId && m_onNewLeader)
+            {
+                m_newLeaderEvent.nextVarData(m_detail);
+                m_onNewLeader(
+                    newLeaderEvent.clusterSessionId,
+                    newLeaderEvent.leadershipTermId,
+                    newLeaderEvent.leaderMemberId,
+                    m_detail);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
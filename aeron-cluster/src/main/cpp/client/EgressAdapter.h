@@ -0,0 +1,87 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_CLUSTER_CLIENT_EGRESS_ADAPTER__
+#define INCLUDED_AERON_CLUSTER_CLIENT_EGRESS_ADAPTER__
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <Subscription.h>
+#include <FragmentAssembler.h>
+#include "codecs/ClusterCodecs.h"
+#include "EgressListener.h"
+
+namespace aeron { namespace cluster { namespace client {
+
+/**
+ * Dispatches the egress of a cluster session to its handlers.
+ * <p>
+ * Messages are decoded in place and handed on without copying. Events for other sessions sharing the egress stream,
+ * from other schemas or of unknown templates are skipped. The handlers and detail storage are set up once, so polling
+ * does not allocate once the detail has grown to the longest seen.
+ */
+class EgressAdapter
+{
+public:
+    EgressAdapter(
+        std::shared_ptr<Subscription> subscription,
+        std::int64_t clusterSessionId,
+        const on_egress_message_t& onMessage,
+        const on_session_event_t& onSessionEvent = on_session_event_t(),
+        const on_new_leader_t& onNewLeader = on_new_leader_t(),
+        int fragmentLimit = DEFAULT_FRAGMENT_LIMIT);
+
+    EgressAdapter(const EgressAdapter&) = delete;
+    EgressAdapter& operator=(const EgressAdapter&) = delete;
+
+    static const int DEFAULT_FRAGMENT_LIMIT = 10;
+
+    /**
+     * Poll the egress subscription and dispatch what was read.
+     *
+     * @return the number of fragments read.
+     */
+    inline int poll()
+    {
+        return m_subscription->poll(m_fragmentHandler, m_fragmentLimit);
+    }
+
+    inline std::shared_ptr<Subscription> subscription() const
+    {
+        return m_subscription;
+    }
+
+    void onFragment(concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header);
+
+private:
+    std::shared_ptr<Subscription> m_subscription;
+    std::int64_t m_clusterSessionId;
+    on_egress_message_t m_onMessage;
+    on_session_event_t m_onSessionEvent;
+    on_new_leader_t m_onNewLeader;
+    int m_fragmentLimit;
+    FragmentAssembler m_fragmentAssembler;
+    fragment_handler_t m_fragmentHandler;
+    codecs::SessionHeader m_sessionHeader;
+    codecs::SessionEvent m_sessionEvent;
+    codecs::NewLeaderEvent m_newLeaderEvent;
+    std::string m_detail;
+};
+
+}}}
+
+#endif
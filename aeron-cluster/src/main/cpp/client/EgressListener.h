@@ -0,0 +1,69 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_CLUSTER_CLIENT_EGRESS_LISTENER__
+#define INCLUDED_AERON_CLUSTER_CLIENT_EGRESS_LISTENER__
+
+#include <cstdint>
+#include <string>
+#include <functional>
+#include <concurrent/logbuffer/Header.h>
+#include "codecs/ClusterCodecs.h"
+
+namespace aeron { namespace cluster { namespace client {
+
+/**
+ * Called for each message from the clustered service to this session.
+ *
+ * @param correlationId    of the message, as set by the service.
+ * @param clusterSessionId to which the message was sent.
+ * @param timestamp        of the message in cluster time.
+ * @param buffer           containing the message.
+ * @param offset           of the message in the buffer, after the session header.
+ * @param length           of the message, excluding the session header.
+ * @param header           of the frame in which the message was received.
+ */
+typedef std::function<void(
+    std::int64_t correlationId,
+    std::int64_t clusterSessionId,
+    std::int64_t timestamp,
+    concurrent::AtomicBuffer& buffer,
+    util::index_t offset,
+    util::index_t length,
+    concurrent::logbuffer::Header& header)> on_egress_message_t;
+
+/**
+ * Called for a session event, e.g. an error in response to a request. The detail is only valid during the call.
+ */
+typedef std::function<void(
+    std::int64_t correlationId,
+    std::int64_t clusterSessionId,
+    codecs::EventCode code,
+    const std::string& detail)> on_session_event_t;
+
+/**
+ * Called when a new leader has been elected for the cluster. The member endpoints have the ingress endpoint of the
+ * leader first, separated by commas, and are only valid during the call.
+ */
+typedef std::function<void(
+    std::int64_t clusterSessionId,
+    std::int64_t leadershipTermId,
+    std::int32_t leaderMemberId,
+    const std::string& memberEndpoints)> on_new_leader_t;
+
+}}}
+
+#endif
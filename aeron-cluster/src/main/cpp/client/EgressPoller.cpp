@@ -0,0 +1,102 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EgressPoller.h"
+
+using namespace aeron;
+using namespace aeron::cluster::client;
+using namespace aeron::cluster::codecs;
+
+EgressPoller::EgressPoller(std::shared_ptr<Subscription> subscription, int fragmentLimit) :
+    m_subscription(std::move(subscription)),
+    m_fragmentLimit(fragmentLimit),
+    m_fragmentAssembler(
+        [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            return this->onFragment(buffer, offset, length, header);
+        }),
+    m_fragmentHandler(m_fragmentAssembler.handler())
+{
+}
+
+int EgressPoller::poll()
+{
+    m_clusterSessionId = -1;
+    m_correlationId = -1;
+    m_templateId = -1;
+    m_eventCode = EventCode::OK;
+    m_detail.clear();
+    m_encodedChallenge.clear();
+    m_pollComplete = false;
+
+    return m_subscription->controlledPoll(m_fragmentHandler, m_fragmentLimit);
+}
+
+ControlledPollAction EgressPoller::onFragment(
+    AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+{
+    if (length < MESSAGE_HEADER_LENGTH || SCHEMA_ID != codecs::schemaId(buffer, offset))
+    {
+        return ControlledPollAction::CONTINUE;
+    }
+
+    const std::uint16_t messageTemplateId = codecs::templateId(buffer, offset);
+    switch (messageTemplateId)
+    {
+        case SessionEvent::TEMPLATE_ID:
+        {
+            m_sessionEvent.wrapForDecode(buffer, offset);
+            m_clusterSessionId = m_sessionEvent.block().clusterSessionId;
+            m_correlationId = m_sessionEvent.block().correlationId;
+            m_eventCode = static_cast<EventCode>(m_sessionEvent.block().code);
+            m_sessionEvent.nextVarData(m_detail);
+            break;
+        }
+
+        case NewLeaderEvent::TEMPLATE_ID:
+        {
+            m_newLeaderEvent.wrapForDecode(buffer, offset);
+            m_clusterSessionId = m_newLeaderEvent.block().clusterSessionId;
+            m_newLeaderEvent.nextVarData(m_detail);
+            break;
+        }
+
+        case SessionHeader::TEMPLATE_ID:
+        {
+            m_sessionHeader.wrapForDecode(buffer, offset);
+            m_clusterSessionId = m_sessionHeader.block().clusterSessionId;
+            m_correlationId = m_sessionHeader.block().correlationId;
+            break;
+        }
+
+        case Challenge::TEMPLATE_ID:
+        {
+            m_challenge.wrapForDecode(buffer, offset);
+            m_clusterSessionId = m_challenge.block().clusterSessionId;
+            m_correlationId = m_challenge.block().correlationId;
+            m_challenge.nextVarData(m_encodedChallenge);
+            break;
+        }
+
+        default:
+            return ControlledPollAction::CONTINUE;
+    }
+
+    m_templateId = messageTemplateId;
+    m_pollComplete = true;
+
+    return ControlledPollAction::BREAK;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INCLUDED_AERON_CLUSTER_CLIENT_EGRESS_POLLER__
+#define INCLUDED_AERON_CLUSTER_CLIENT_EGRESS_POLLER__
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <Subscription.h>
+#include <ControlledFragmentAssembler.h>
+#include "codecs/ClusterCodecs.h"
+
+namespace aeron { namespace cluster { namespace client {
+
+/**
+ * Polls the egress subscription for one event at a time, for use while waiting on a response such as when opening a
+ * session.
+ * <p>
+ * Each poll stops after the first whole message so its fields can be checked before the next is read. The detail and
+ * challenge storage is reused so polling does not allocate once it has grown to the longest seen. Messages from other
+ * schemas or of unknown templates are skipped rather than thrown from the poll.
+ */
+class EgressPoller
+{
+public:
+    static const int FRAGMENT_LIMIT = 1;
+
+    explicit EgressPoller(std::shared_ptr<Subscription> subscription, int fragmentLimit = FRAGMENT_LIMIT);
+
+    EgressPoller(const EgressPoller&) = delete;
+    EgressPoller& operator=(const EgressPoller&) = delete;
+
+    /**
+     * Poll for the next event, resetting the fields of the previous one.
+     *
+     * @return the number of fragments read.
+     */
+    int poll();
+
+    inline std::shared_ptr<Subscription> subscription() const
+    {
+        return m_subscription;
+    }
+
+    inline std::int64_t clusterSessionId() const
+    {
+        return m_clusterSessionId;
+    }
+
+    inline std::int64_t correlationId() const
+    {
+        return m_correlationId;
+    }
+
+    inline std::int32_t templateId() const
+    {
+        return m_templateId;
+    }
+
+    /**
+     * The code of the last session event, only valid when isSessionEvent() is true.
+     */
+    inline codecs::EventCode eventCode() const
+    {
+        return m_eventCode;
+    }
+
+    /**
+     * The detail of the last session event, or the member endpoints of the last new leader event.
+     */
+    inline const std::string& detail() const
+    {
+        return m_detail;
+    }
+
+    inline const std::string& encodedChallenge() const
+    {
+        return m_encodedChallenge;
+    }
+
+    inline bool isPollComplete() const
+    {
+        return m_pollComplete;
+    }
+
+    inline bool isSessionEvent() const
+    {
+        return codecs::SessionEvent::TEMPLATE_ID == m_templateId;
+    }
+
+    inline bool isChallenged() const
+    {
+        return codecs::Challenge::TEMPLATE_ID == m_templateId;
+    }
+
+    ControlledPollAction onFragment(
+        concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header);
+
+private:
+    std::shared_ptr<Subscription> m_subscription;
+    int m_fragmentLimit;
+    ControlledFragmentAssembler m_fragmentAssembler;
+    controlled_poll_fragment_handler_t m_fragmentHandler;
+    codecs::SessionEvent m_sessionEvent;
+    codecs::NewLeaderEvent m_newLeaderEvent;
+    codecs::SessionHeader m_sessionHeader;
+    codecs::Challenge m_challenge;
+
+    std::int64_t m_clusterSessionId = -1;
+    std::int64_t m_correlationId = -1;
+    std::int32_t m_templateId = -1;
+    codecs::EventCode m_eventCode = codecs::EventCode::OK;
+    std::string m_detail;
+    std::string m_encodedChallenge;
+    bool m_pollComplete = false;
+};
+
+}}}
+
+#endif
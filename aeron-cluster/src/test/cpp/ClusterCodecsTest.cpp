@@ -0,0 +1,111 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "AeronCluster.h"
+
+using namespace aeron::concurrent;
+using namespace aeron::cluster::codecs;
+using namespace aeron::cluster::client;
+
+class ClusterCodecsTest : public testing::Test
+{
+public:
+    ClusterCodecsTest() : m_buffer(m_storage)
+    {
+        m_storage.fill(0);
+    }
+
+protected:
+    std::array<std::uint8_t, 1024> m_storage;
+    AtomicBuffer m_buffer;
+};
+
+TEST_F(ClusterCodecsTest, shouldHaveBlockLengthsOfTheSchema)
+{
+    EXPECT_EQ(MESSAGE_HEADER_LENGTH, 8);
+    EXPECT_EQ(SessionEvent::BLOCK_LENGTH, 20);
+    EXPECT_EQ(SessionConnectRequest::BLOCK_LENGTH, 20);
+    EXPECT_EQ(SessionHeader::BLOCK_LENGTH, 24);
+    EXPECT_EQ(SessionCloseRequest::BLOCK_LENGTH, 8);
+    EXPECT_EQ(SessionKeepAliveRequest::BLOCK_LENGTH, 16);
+    EXPECT_EQ(NewLeaderEvent::BLOCK_LENGTH, 44);
+    EXPECT_EQ(Challenge::BLOCK_LENGTH, 16);
+    EXPECT_EQ(ChallengeResponse::BLOCK_LENGTH, 16);
+    EXPECT_EQ(AeronCluster::SESSION_HEADER_LENGTH, 32);
+}
+
+TEST_F(ClusterCodecsTest, shouldEncodeConnectRequestWithChannelAndCredentials)
+{
+    const std::string channel = "aeron:udp?endpoint=localhost:9020";
+    const std::string credentials = "admin:admin";
+    SessionConnectRequest request;
+
+    request.wrapAndApplyHeader(m_buffer, 16).putVarData(channel).putVarData(credentials);
+    request.block().correlationId = 9;
+    request.block().clusterSessionId = -1;
+    request.block().responseStreamId = 2;
+
+    EXPECT_EQ(
+        request.encodedLength(),
+        SessionConnectRequest::computeLength(static_cast<int>(channel.length() + credentials.length()), 2));
+    EXPECT_EQ(m_buffer.getUInt16(16), SessionConnectRequest::BLOCK_LENGTH);
+    EXPECT_EQ(m_buffer.getUInt16(18), 2);
+    EXPECT_EQ(m_buffer.getUInt16(20), SCHEMA_ID);
+    EXPECT_EQ(m_buffer.getUInt16(22), SCHEMA_VERSION);
+    EXPECT_EQ(m_buffer.getInt64(24), 9);
+    EXPECT_EQ(m_buffer.getInt64(32), -1);
+    EXPECT_EQ(m_buffer.getInt32(40), 2);
+    EXPECT_EQ(m_buffer.getInt32(44), static_cast<std::int32_t>(channel.length()));
+    EXPECT_EQ(std::memcmp(m_buffer.buffer() + 48, channel.c_str(), channel.length()), 0);
+
+    const int credentialsOffset = 48 + static_cast<int>(channel.length());
+    EXPECT_EQ(m_buffer.getInt32(credentialsOffset), static_cast<std::int32_t>(credentials.length()));
+    EXPECT_EQ(std::memcmp(m_buffer.buffer() + credentialsOffset + 4, credentials.c_str(), credentials.length()), 0);
+}
+
+TEST_F(ClusterCodecsTest, shouldDecodeVarDataAfterLongerBlockFromNewerVersion)
+{
+    const std::uint16_t newerBlockLength = SessionEvent::BLOCK_LENGTH + 8;
+
+    m_buffer.putUInt16(0, newerBlockLength);
+    m_buffer.putUInt16(2, SessionEvent::TEMPLATE_ID);
+    m_buffer.putUInt16(4, SCHEMA_ID);
+    m_buffer.putUInt16(6, SCHEMA_VERSION + 1);
+    m_buffer.putInt64(8, 3);
+    m_buffer.putInt32(MESSAGE_HEADER_LENGTH + newerBlockLength, 5);
+    m_buffer.putBytes(MESSAGE_HEADER_LENGTH + newerBlockLength + 4, reinterpret_cast<const std::uint8_t *>("oops!"), 5);
+
+    SessionEvent event;
+    std::string detail;
+    event.wrapForDecode(m_buffer, 0).nextVarData(detail);
+
+    EXPECT_EQ(templateId(m_buffer, 0), SessionEvent::TEMPLATE_ID);
+    EXPECT_EQ(event.block().clusterSessionId, 3);
+    EXPECT_EQ(detail, "oops!");
+    EXPECT_EQ(event.encodedLength(), MESSAGE_HEADER_LENGTH + newerBlockLength + 9);
+}
+
+TEST_F(ClusterCodecsTest, shouldFindLeaderEndpointFirstInMemberEndpoints)
+{
+    EXPECT_EQ(AeronCluster::leaderEndpoint("localhost:9011,localhost:9010,localhost:9012"), "localhost:9011");
+    EXPECT_EQ(AeronCluster::leaderEndpoint("localhost:9010"), "localhost:9010");
+    EXPECT_EQ(AeronCluster::leaderEndpoint(""), "");
+}
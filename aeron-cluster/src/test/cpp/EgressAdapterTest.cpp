@@ -0,0 +1,145 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+#include "EgressAdapter.h"
+
+using namespace aeron;
+using namespace aeron::concurrent;
+using namespace aeron::cluster::codecs;
+using namespace aeron::cluster::client;
+
+static const std::int64_t CLUSTER_SESSION_ID = 7;
+
+class EgressAdapterTest : public testing::Test
+{
+public:
+    EgressAdapterTest() :
+        m_buffer(m_storage),
+        m_header(0, 64 * 1024),
+        m_adapter(
+            std::shared_ptr<Subscription>(),
+            CLUSTER_SESSION_ID,
+            [this](
+                std::int64_t correlationId,
+                std::int64_t clusterSessionId,
+                std::int64_t timestamp,
+                AtomicBuffer& buffer,
+                util::index_t offset,
+                util::index_t length,
+                Header&)
+            {
+                m_correlationId = correlationId;
+                m_timestamp = timestamp;
+                m_message.assign(reinterpret_cast<const char *>(buffer.buffer() + offset), length);
+                m_messages++;
+            },
+            [this](std::int64_t correlationId, std::int64_t, EventCode code, const std::string& detail)
+            {
+                m_correlationId = correlationId;
+                m_code = code;
+                m_detail = detail;
+            },
+            [this](std::int64_t, std::int64_t leadershipTermId, std::int32_t leaderMemberId, const std::string& endpoints)
+            {
+                m_leadershipTermId = leadershipTermId;
+                m_leaderMemberId = leaderMemberId;
+                m_detail = endpoints;
+            })
+    {
+        m_storage.fill(0);
+    }
+
+    util::index_t encodeMessage(std::int64_t clusterSessionId, const std::string& message)
+    {
+        SessionHeader header;
+        header.wrapAndApplyHeader(m_buffer, 0);
+        header.block().correlationId = 11;
+        header.block().clusterSessionId = clusterSessionId;
+        header.block().timestamp = 13;
+        m_buffer.putBytes(
+            SESSION_HEADER_LENGTH,
+            reinterpret_cast<const std::uint8_t *>(message.c_str()),
+            static_cast<util::index_t>(message.length()));
+
+        return SESSION_HEADER_LENGTH + static_cast<util::index_t>(message.length());
+    }
+
+protected:
+    std::array<std::uint8_t, 1024> m_storage;
+    AtomicBuffer m_buffer;
+    Header m_header;
+    EgressAdapter m_adapter;
+
+    std::int64_t m_correlationId = -1;
+    std::int64_t m_timestamp = -1;
+    std::int64_t m_leadershipTermId = -1;
+    std::int32_t m_leaderMemberId = -1;
+    EventCode m_code = EventCode::OK;
+    std::string m_message;
+    std::string m_detail;
+    int m_messages = 0;
+};
+
+TEST_F(EgressAdapterTest, shouldDispatchMessageAfterSessionHeader)
+{
+    m_adapter.onFragment(m_buffer, 0, encodeMessage(CLUSTER_SESSION_ID, "fill 100@42"), m_header);
+
+    EXPECT_EQ(m_messages, 1);
+    EXPECT_EQ(m_correlationId, 11);
+    EXPECT_EQ(m_timestamp, 13);
+    EXPECT_EQ(m_message, "fill 100@42");
+}
+
+TEST_F(EgressAdapterTest, shouldSkipMessagesForOtherSessions)
+{
+    m_adapter.onFragment(m_buffer, 0, encodeMessage(CLUSTER_SESSION_ID + 1, "not ours"), m_header);
+
+    EXPECT_EQ(m_messages, 0);
+}
+
+TEST_F(EgressAdapterTest, shouldDispatchSessionEvent)
+{
+    SessionEvent event;
+    event.wrapAndApplyHeader(m_buffer, 0).putVarData("rejected");
+    event.block().clusterSessionId = CLUSTER_SESSION_ID;
+    event.block().correlationId = 5;
+    event.block().code = static_cast<std::int32_t>(EventCode::ERROR);
+
+    m_adapter.onFragment(m_buffer, 0, event.encodedLength(), m_header);
+
+    EXPECT_EQ(m_correlationId, 5);
+    EXPECT_EQ(m_code, EventCode::ERROR);
+    EXPECT_EQ(m_detail, "rejected");
+}
+
+TEST_F(EgressAdapterTest, shouldDispatchNewLeader)
+{
+    NewLeaderEvent event;
+    event.wrapAndApplyHeader(m_buffer, 0).putVarData("localhost:9011,localhost:9010");
+    event.block().clusterSessionId = CLUSTER_SESSION_ID;
+    event.block().leadershipTermId = 3;
+    event.block().leaderMemberId = 1;
+
+    m_adapter.onFragment(m_buffer, 0, event.encodedLength(), m_header);
+
+    EXPECT_EQ(m_leadershipTermId, 3);
+    EXPECT_EQ(m_leaderMemberId, 1);
+    EXPECT_EQ(m_detail, "localhost:9011,localhost:9010");
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+#include "EgressPoller.h"
+
+using namespace aeron;
+using namespace aeron::concurrent;
+using namespace aeron::cluster::codecs;
+using namespace aeron::cluster::client;
+
+static const std::int64_t CLUSTER_SESSION_ID = 7;
+static const std::int64_t CORRELATION_ID = 9;
+
+class EgressPollerTest : public testing::Test
+{
+public:
+    EgressPollerTest() :
+        m_buffer(m_storage),
+        m_header(0, 64 * 1024),
+        m_poller(std::shared_ptr<Subscription>())
+    {
+        m_storage.fill(0);
+    }
+
+    util::index_t encodeSessionEvent(EventCode code, const std::string& detail)
+    {
+        SessionEvent event;
+        event.wrapAndApplyHeader(m_buffer, 0).putVarData(detail);
+        event.block().clusterSessionId = CLUSTER_SESSION_ID;
+        event.block().correlationId = CORRELATION_ID;
+        event.block().code = static_cast<std::int32_t>(code);
+
+        return event.encodedLength();
+    }
+
+protected:
+    std::array<std::uint8_t, 1024> m_storage;
+    AtomicBuffer m_buffer;
+    Header m_header;
+    EgressPoller m_poller;
+};
+
+TEST_F(EgressPollerTest, shouldDecodeOkSessionEventAndBreak)
+{
+    const util::index_t length = encodeSessionEvent(EventCode::OK, "localhost:9010,localhost:9011");
+
+    EXPECT_EQ(m_poller.onFragment(m_buffer, 0, length, m_header), ControlledPollAction::BREAK);
+    EXPECT_TRUE(m_poller.isPollComplete());
+    EXPECT_TRUE(m_poller.isSessionEvent());
+    EXPECT_EQ(m_poller.clusterSessionId(), CLUSTER_SESSION_ID);
+    EXPECT_EQ(m_poller.correlationId(), CORRELATION_ID);
+    EXPECT_EQ(m_poller.eventCode(), EventCode::OK);
+    EXPECT_EQ(m_poller.detail(), "localhost:9010,localhost:9011");
+}
+
+TEST_F(EgressPollerTest, shouldDecodeRedirect)
+{
+    const util::index_t length = encodeSessionEvent(EventCode::REDIRECT, "localhost:9012,localhost:9010");
+
+    EXPECT_EQ(m_poller.onFragment(m_buffer, 0, length, m_header), ControlledPollAction::BREAK);
+    EXPECT_EQ(m_poller.eventCode(), EventCode::REDIRECT);
+    EXPECT_EQ(m_poller.detail(), "localhost:9012,localhost:9010");
+}
+
+TEST_F(EgressPollerTest, shouldDecodeChallenge)
+{
+    Challenge challenge;
+    challenge.wrapAndApplyHeader(m_buffer, 0).putVarData("nonce");
+    challenge.block().correlationId = CORRELATION_ID;
+    challenge.block().clusterSessionId = CLUSTER_SESSION_ID;
+
+    EXPECT_EQ(m_poller.onFragment(m_buffer, 0, challenge.encodedLength(), m_header), ControlledPollAction::BREAK);
+    EXPECT_TRUE(m_poller.isChallenged());
+    EXPECT_FALSE(m_poller.isSessionEvent());
+    EXPECT_EQ(m_poller.correlationId(), CORRELATION_ID);
+    EXPECT_EQ(m_poller.encodedChallenge(), "nonce");
+}
+
+TEST_F(EgressPollerTest, shouldSkipOtherSchemasAndUnknownTemplates)
+{
+    const util::index_t length = encodeSessionEvent(EventCode::OK, "");
+
+    m_buffer.putUInt16(4, SCHEMA_ID + 100);
+    EXPECT_EQ(m_poller.onFragment(m_buffer, 0, length, m_header), ControlledPollAction::CONTINUE);
+    EXPECT_FALSE(m_poller.isPollComplete());
+
+    m_buffer.putUInt16(4, SCHEMA_ID);
+    m_buffer.putUInt16(2, 201);
+    EXPECT_EQ(m_poller.onFragment(m_buffer, 0, length, m_header), ControlledPollAction::CONTINUE);
+    EXPECT_FALSE(m_poller.isPollComplete());
+}
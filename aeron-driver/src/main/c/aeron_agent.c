@@ -24,9 +24,12 @@
 #include <dlfcn.h>
 #include <sched.h>
 #include <errno.h>
+#include <stdlib.h>
+#include <time.h>
 #include "aeron_agent.h"
 #include "aeron_alloc.h"
 #include "aeron_driver_context.h"
+#include "aeronmd.h"
 #include "util/aeron_error.h"
 
 static void aeron_idle_strategy_sleeping_idle(void *state, int work_count)
@@ -59,12 +62,111 @@ static void aeron_idle_strategy_noop_idle(void *state, int work_count)
     __asm__ volatile("pause\n": : :"memory");
 }
 
+static void aeron_idle_strategy_backoff_reset(aeron_idle_strategy_backoff_state_t *backoff)
+{
+    backoff->spins = 0;
+    backoff->yields = 0;
+    backoff->park_period_ns = backoff->min_park_period_ns;
+    backoff->state = AERON_IDLE_STRATEGY_BACKOFF_STATE_NOT_IDLE;
+}
+
+static void aeron_idle_strategy_backoff_idle(void *state, int work_count)
+{
+    aeron_idle_strategy_backoff_state_t *backoff = (aeron_idle_strategy_backoff_state_t *)state;
+
+    if (work_count > 0)
+    {
+        aeron_idle_strategy_backoff_reset(backoff);
+        return;
+    }
+
+    switch (backoff->state)
+    {
+        case AERON_IDLE_STRATEGY_BACKOFF_STATE_NOT_IDLE:
+            backoff->state = AERON_IDLE_STRATEGY_BACKOFF_STATE_SPINNING;
+            backoff->spins++;
+            break;
+
+        case AERON_IDLE_STRATEGY_BACKOFF_STATE_SPINNING:
+            __asm__ volatile("pause\n": : :"memory");
+            if (++backoff->spins > backoff->max_spins)
+            {
+                backoff->state = AERON_IDLE_STRATEGY_BACKOFF_STATE_YIELDING;
+                backoff->yields = 0;
+            }
+            break;
+
+        case AERON_IDLE_STRATEGY_BACKOFF_STATE_YIELDING:
+            if (++backoff->yields > backoff->max_yields)
+            {
+                backoff->state = AERON_IDLE_STRATEGY_BACKOFF_STATE_PARKING;
+                backoff->park_period_ns = backoff->min_park_period_ns;
+            }
+            else
+            {
+                sched_yield();
+            }
+            break;
+
+        case AERON_IDLE_STRATEGY_BACKOFF_STATE_PARKING:
+        default:
+        {
+            struct timespec ts =
+                {
+                    .tv_sec = (time_t)(backoff->park_period_ns / (1000 * 1000 * 1000)),
+                    .tv_nsec = (long)(backoff->park_period_ns % (1000 * 1000 * 1000))
+                };
+
+            nanosleep(&ts, NULL);
+            backoff->park_period_ns = backoff->park_period_ns * 2 > backoff->max_park_period_ns ?
+                backoff->max_park_period_ns : backoff->park_period_ns * 2;
+            break;
+        }
+    }
+}
+
 static int aeron_idle_strategy_init_null(void **state)
 {
     *state = NULL;
     return 0;
 }
 
+static int aeron_idle_strategy_backoff_init(void **state)
+{
+    aeron_idle_strategy_backoff_state_t *backoff = NULL;
+
+    if (aeron_alloc((void **)&backoff, sizeof(aeron_idle_strategy_backoff_state_t)) < 0)
+    {
+        return -1;
+    }
+
+    backoff->max_spins = aeron_config_parse_uint64(
+        getenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS_ENV_VAR),
+        AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS_DEFAULT,
+        0,
+        INT64_MAX);
+    backoff->max_yields = aeron_config_parse_uint64(
+        getenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS_ENV_VAR),
+        AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS_DEFAULT,
+        0,
+        INT64_MAX);
+    backoff->min_park_period_ns = aeron_config_parse_uint64(
+        getenv(AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD_ENV_VAR),
+        AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD_NS_DEFAULT,
+        1,
+        INT64_MAX);
+    backoff->max_park_period_ns = aeron_config_parse_uint64(
+        getenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD_ENV_VAR),
+        AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD_NS_DEFAULT,
+        backoff->min_park_period_ns,
+        INT64_MAX);
+
+    aeron_idle_strategy_backoff_reset(backoff);
+
+    *state = backoff;
+    return 0;
+}
+
 aeron_idle_strategy_t aeron_idle_strategy_sleeping =
     {
         aeron_idle_strategy_sleeping_idle,
@@ -83,6 +185,12 @@ aeron_idle_strategy_t aeron_idle_strategy_noop =
         aeron_idle_strategy_init_null
     };
 
+aeron_idle_strategy_t aeron_idle_strategy_backoff =
+    {
+        aeron_idle_strategy_backoff_idle,
+        aeron_idle_strategy_backoff_init
+    };
+
 aeron_idle_strategy_func_t aeron_idle_strategy_load(
     const char *idle_strategy_name,
     void **idle_strategy_state)
@@ -112,6 +220,16 @@ aeron_idle_strategy_func_t aeron_idle_strategy_load(
     {
         idle_func = aeron_idle_strategy_noop_idle;
     }
+    else if (strncmp(idle_strategy_name, "backoff", sizeof("backoff")) == 0)
+    {
+        if (aeron_idle_strategy_backoff_init(&idle_state) < 0)
+        {
+            return NULL;
+        }
+
+        idle_func = aeron_idle_strategy_backoff_idle;
+        *idle_strategy_state = idle_state;
+    }
     else
     {
         aeron_idle_strategy_t *idle_strat = NULL;
@@ -137,6 +255,28 @@ aeron_idle_strategy_func_t aeron_idle_strategy_load(
     return idle_func;
 }
 
+int aeron_idle_strategy_clone_state(
+    aeron_idle_strategy_func_t idle_strategy_func, void *idle_strategy_state, void **cloned_state)
+{
+    *cloned_state = idle_strategy_state;
+
+    if (aeron_idle_strategy_backoff_idle == idle_strategy_func && NULL != idle_strategy_state)
+    {
+        aeron_idle_strategy_backoff_state_t *backoff = NULL;
+
+        if (aeron_alloc((void **)&backoff, sizeof(aeron_idle_strategy_backoff_state_t)) < 0)
+        {
+            return -1;
+        }
+
+        memcpy(backoff, idle_strategy_state, sizeof(aeron_idle_strategy_backoff_state_t));
+        aeron_idle_strategy_backoff_reset(backoff);
+        *cloned_state = backoff;
+    }
+
+    return 0;
+}
+
 aeron_agent_on_start_func_t aeron_agent_on_start_load(const char *name)
 {
     aeron_agent_on_start_func_t func = NULL;
@@ -186,14 +326,44 @@ int aeron_agent_init(
     runner->idle_strategy = idle_strategy_func;
     runner->running = true;
     runner->state = AERON_AGENT_STATE_INITED;
+    runner->cpu_affinity = -1;
+    runner->duty_cycle_tracker = NULL;
 
     return 0;
 }
 
+/*
+ * Thread names are limited to 15 characters so drop the brackets and spaces of composite roles such as
+ * "[sender, receiver]" before truncating.
+ */
+static void aeron_agent_set_thread_name(const char *role_name)
+{
+    char name[AERON_AGENT_THREAD_NAME_MAX_LENGTH + 1];
+    size_t length = 0;
+
+    for (const char *c = role_name; '\0' != *c && length < AERON_AGENT_THREAD_NAME_MAX_LENGTH; c++)
+    {
+        if ('[' != *c && ']' != *c && ' ' != *c)
+        {
+            name[length++] = *c;
+        }
+    }
+
+    name[length] = '\0';
+
+#if defined(__linux__)
+    pthread_setname_np(pthread_self(), name);
+#elif defined(__APPLE__)
+    pthread_setname_np(name);
+#endif
+}
+
 static void *agent_main(void *arg)
 {
     aeron_agent_runner_t *runner = (aeron_agent_runner_t *)arg;
 
+    aeron_agent_set_thread_name(runner->role_name);
+
     if (NULL != runner->on_start)
     {
         runner->on_start(runner->on_start_state, runner->role_name);
@@ -201,7 +371,7 @@ static void *agent_main(void *arg)
 
     while (aeron_agent_is_running(runner))
     {
-        runner->idle_strategy(runner->idle_strategy_state, runner->do_work(runner->agent_state));
+        runner->idle_strategy(runner->idle_strategy_state, aeron_agent_do_work(runner));
     }
 
     return NULL;
@@ -224,6 +394,27 @@ int aeron_agent_start(aeron_agent_runner_t *runner)
         return -1;
     }
 
+    if (runner->cpu_affinity >= 0)
+    {
+#if defined(__linux__)
+        cpu_set_t cpu_set;
+
+        CPU_ZERO(&cpu_set);
+        CPU_SET(runner->cpu_affinity, &cpu_set);
+
+        if ((pthread_result = pthread_attr_setaffinity_np(&attr, sizeof(cpu_set), &cpu_set)) != 0)
+        {
+            aeron_set_err(pthread_result, "pthread_attr_setaffinity_np: %s", strerror(pthread_result));
+            pthread_attr_destroy(&attr);
+            return -1;
+        }
+#else
+        aeron_set_err(ENOTSUP, "%s", "CPU affinity not supported");
+        pthread_attr_destroy(&attr);
+        return -1;
+#endif
+    }
+
     if ((pthread_result = pthread_create(&runner->thread, &attr, agent_main, runner)) != 0)
     {
         aeron_set_err(pthread_result, "pthread_create: %s", strerror(pthread_result));
@@ -235,6 +426,55 @@ int aeron_agent_start(aeron_agent_runner_t *runner)
     return 0;
 }
 
+int aeron_thread_set_affinity(aeron_thread_t thread, int32_t cpu)
+{
+#if defined(__linux__)
+    cpu_set_t cpu_set;
+    int pthread_result = 0;
+
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+
+    if ((pthread_result = pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set)) != 0)
+    {
+        aeron_set_err(pthread_result, "pthread_setaffinity_np: %s", strerror(pthread_result));
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "%s", "CPU affinity not supported");
+    return -1;
+#endif
+}
+
+int aeron_agent_track_duty_cycle(
+    aeron_agent_runner_t *runner,
+    aeron_counters_manager_t *counters_manager,
+    int64_t threshold_ns,
+    aeron_clock_func_t nano_clock)
+{
+    aeron_duty_cycle_tracker_t *tracker = NULL;
+
+    if (aeron_alloc((void **)&tracker, sizeof(aeron_duty_cycle_tracker_t)) < 0)
+    {
+        int err_code = errno;
+
+        aeron_set_err(err_code, "%s:%d: %s", __FILE__, __LINE__, strerror(err_code));
+        return -1;
+    }
+
+    if (aeron_duty_cycle_tracker_init(tracker, counters_manager, runner->role_name, threshold_ns, nano_clock) < 0)
+    {
+        aeron_free(tracker);
+        return -1;
+    }
+
+    runner->duty_cycle_tracker = tracker;
+
+    return 0;
+}
+
 extern int aeron_agent_do_work(aeron_agent_runner_t *runner);
 extern bool aeron_agent_is_running(aeron_agent_runner_t *runner);
 extern void aeron_agent_idle(aeron_agent_runner_t *runner, int work_count);
@@ -282,6 +522,8 @@ int aeron_agent_close(aeron_agent_runner_t *runner)
     }
 
     aeron_free((char *)runner->role_name);
+    aeron_free(runner->duty_cycle_tracker);
+    runner->duty_cycle_tracker = NULL;
 
     if (NULL != runner->on_close)
     {
@@ -30,6 +30,7 @@ typedef HANDLE aeron_thread_t;
 
 #include "aeron_driver_common.h"
 #include "concurrent/aeron_atomic.h"
+#include "aeron_duty_cycle_tracker.h"
 
 typedef int (*aeron_agent_do_work_func_t)(void *);
 typedef void (*aeron_agent_on_close_func_t)(void *);
@@ -62,13 +63,48 @@ typedef struct aeron_agent_runner_stct
     aeron_thread_t thread;
     volatile bool running;
     uint8_t state;
+    int32_t cpu_affinity;
+    aeron_duty_cycle_tracker_t *duty_cycle_tracker;
 }
 aeron_agent_runner_t;
 
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS_DEFAULT (10)
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS_DEFAULT (5)
+#define AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD_NS_DEFAULT (1000)
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD_NS_DEFAULT (1000 * 1000)
+
+#define AERON_IDLE_STRATEGY_BACKOFF_STATE_NOT_IDLE 0
+#define AERON_IDLE_STRATEGY_BACKOFF_STATE_SPINNING 1
+#define AERON_IDLE_STRATEGY_BACKOFF_STATE_YIELDING 2
+#define AERON_IDLE_STRATEGY_BACKOFF_STATE_PARKING 3
+
+/*
+ * "backoff" spins with a CPU pause, then yields, then sleeps for a period that doubles on each idle call up to a
+ * maximum. Any work resets it back to spinning.
+ */
+typedef struct aeron_idle_strategy_backoff_state_stct
+{
+    uint64_t max_spins;
+    uint64_t max_yields;
+    uint64_t min_park_period_ns;
+    uint64_t max_park_period_ns;
+    uint64_t spins;
+    uint64_t yields;
+    uint64_t park_period_ns;
+    uint8_t state;
+}
+aeron_idle_strategy_backoff_state_t;
+
 aeron_idle_strategy_func_t aeron_idle_strategy_load(
     const char *idle_strategy_name,
     void **idle_strategy_state);
 
+/*
+ * State for another agent using the same idle strategy. Stateful strategies get their own copy, others share.
+ */
+int aeron_idle_strategy_clone_state(
+    aeron_idle_strategy_func_t idle_strategy_func, void *idle_strategy_state, void **cloned_state);
+
 aeron_agent_on_start_func_t aeron_agent_on_start_load(const char *name);
 
 int aeron_agent_init(
@@ -82,10 +118,21 @@ int aeron_agent_init(
     aeron_idle_strategy_func_t idle_strategy_func,
     void *idle_strategy_state);
 
+#define AERON_AGENT_THREAD_NAME_MAX_LENGTH (15)
+
+/*
+ * Start the agent on its own thread, pinned to runner->cpu_affinity when that is set to a CPU rather than -1. The
+ * thread is named after the role so tools such as perf and top can attribute it.
+ */
 int aeron_agent_start(aeron_agent_runner_t *runner);
 
 inline int aeron_agent_do_work(aeron_agent_runner_t *runner)
 {
+    if (NULL != runner->duty_cycle_tracker)
+    {
+        aeron_duty_cycle_tracker_measure(runner->duty_cycle_tracker);
+    }
+
     return runner->do_work(runner->agent_state);
 }
 
@@ -101,6 +148,21 @@ inline void aeron_agent_idle(aeron_agent_runner_t *runner, int work_count)
     runner->idle_strategy(runner->idle_strategy_state, work_count);
 }
 
+/*
+ * Pin an already running thread, such as the one driving a manual main loop, to a CPU.
+ */
+int aeron_thread_set_affinity(aeron_thread_t thread, int32_t cpu);
+
+/*
+ * Time the duty cycles of the agent into counters, see aeron_duty_cycle_tracker_t. Must be called before the agent is
+ * started and the tracker is freed when the agent is closed.
+ */
+int aeron_agent_track_duty_cycle(
+    aeron_agent_runner_t *runner,
+    aeron_counters_manager_t *counters_manager,
+    int64_t threshold_ns,
+    aeron_clock_func_t nano_clock);
+
 int aeron_agent_stop(aeron_agent_runner_t *runner);
 int aeron_agent_close(aeron_agent_runner_t *runner);
 
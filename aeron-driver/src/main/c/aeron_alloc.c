@@ -102,3 +102,52 @@ void aeron_free(void *ptr)
     free(ptr);
 }
 
+
+size_t aeron_arena_length(size_t length)
+{
+    return AERON_ALIGN(length, AERON_CACHE_LINE_LENGTH);
+}
+
+int aeron_arena_init(aeron_arena_t *arena, size_t length)
+{
+    size_t offset = 0;
+
+    if (aeron_alloc_aligned(&arena->memory, &offset, length, AERON_CACHE_LINE_LENGTH) < 0)
+    {
+        arena->memory = NULL;
+        arena->next = NULL;
+        arena->limit = NULL;
+        return -1;
+    }
+
+    arena->next = (uint8_t *)arena->memory + offset;
+    arena->limit = arena->next + length;
+
+    return 0;
+}
+
+void *aeron_arena_allocate(aeron_arena_t *arena, size_t length)
+{
+    const size_t aligned_length = aeron_arena_length(length);
+
+    if (NULL == arena->next || aligned_length > (size_t)(arena->limit - arena->next))
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    void *ptr = arena->next;
+    arena->next += aligned_length;
+
+    return ptr;
+}
+
+void aeron_arena_close(aeron_arena_t *arena)
+{
+    void *memory = arena->memory;
+
+    arena->memory = NULL;
+    arena->next = NULL;
+    arena->limit = NULL;
+    aeron_free(memory);
+}
@@ -18,6 +18,7 @@
 #define AERON_AERON_ALLOC_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 int aeron_alloc_no_err(void **ptr, size_t size);
 int aeron_alloc(void **ptr, size_t size);
@@ -25,4 +26,21 @@ int aeron_alloc_aligned(void **ptr, size_t *offset, size_t size, size_t alignmen
 int aeron_reallocf(void **ptr, size_t size);
 void aeron_free(void *ptr);
 
+/*
+ * One zeroed allocation carved into cache line aligned pieces, so a resource and the buffers it owns sit together
+ * and are freed together. The length to init with is the sum of aeron_arena_length for each piece.
+ */
+typedef struct aeron_arena_stct
+{
+    void *memory;
+    uint8_t *next;
+    uint8_t *limit;
+}
+aeron_arena_t;
+
+size_t aeron_arena_length(size_t length);
+int aeron_arena_init(aeron_arena_t *arena, size_t length);
+void *aeron_arena_allocate(aeron_arena_t *arena, size_t length);
+void aeron_arena_close(aeron_arena_t *arena);
+
 #endif //AERON_AERON_ALLOC_H
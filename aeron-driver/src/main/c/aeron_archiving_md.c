@@ -0,0 +1,144 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "aeronmd.h"
+#include "aeron_driver.h"
+#include "aeron_driver_context.h"
+#include "aeron_agent.h"
+#include "aeron_alloc.h"
+#include "concurrent/aeron_atomic.h"
+#include "archive/aeron_archive_recorder.h"
+
+/*
+ * A media driver with a recorder in the same process. The driver runs as aeronmd does while the recorder has its own
+ * agent thread and client, recording the streams of AERON_ARCHIVE_RECORDINGS into AERON_ARCHIVE_DIR.
+ */
+
+volatile bool running = true;
+
+void sigint_handler(int signal)
+{
+    AERON_PUT_ORDERED(running, false);
+}
+
+inline bool is_running()
+{
+    bool result;
+    AERON_GET_VOLATILE(result, running);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    int status = EXIT_FAILURE;
+    aeron_driver_context_t *context = NULL;
+    aeron_driver_t *driver = NULL;
+    aeron_context_t *client_context = NULL;
+    aeron_t *client = NULL;
+    aeron_archive_recorder_context_t recorder_context;
+    aeron_archive_recorder_t *recorder = NULL;
+    aeron_agent_runner_t recorder_runner = { 0 };
+    void *idle_strategy_state = NULL;
+
+    signal(SIGINT, sigint_handler);
+
+    if (aeron_driver_context_init(&context) < 0)
+    {
+        fprintf(stderr, "ERROR: context init (%d) %s\n", aeron_errcode(), aeron_errmsg());
+        goto cleanup;
+    }
+
+    if (aeron_driver_init(&driver, context) < 0)
+    {
+        fprintf(stderr, "ERROR: driver init (%d) %s\n", aeron_errcode(), aeron_errmsg());
+        goto cleanup;
+    }
+
+    if (aeron_driver_start(driver, true) < 0)
+    {
+        fprintf(stderr, "ERROR: driver start (%d) %s\n", aeron_errcode(), aeron_errmsg());
+        goto cleanup;
+    }
+
+    if (aeron_context_init(&client_context) < 0 ||
+        aeron_context_set_dir(client_context, context->aeron_dir) < 0 ||
+        aeron_init(&client, client_context) < 0)
+    {
+        fprintf(stderr, "ERROR: client init (%d) %s\n", aeron_errcode(), aeron_errmsg());
+        goto cleanup;
+    }
+
+    aeron_archive_recorder_context_init(&recorder_context);
+
+    if (aeron_archive_recorder_init(
+        &recorder, &recorder_context, client, &driver->conductor.error_log, driver->conductor.errors_counter) < 0)
+    {
+        fprintf(stderr, "ERROR: recorder init (%d) %s\n", aeron_errcode(), aeron_errmsg());
+        aeron_close(client);
+        goto cleanup;
+    }
+
+    aeron_idle_strategy_func_t idle_strategy_func = aeron_idle_strategy_load("backoff", &idle_strategy_state);
+
+    if (NULL == idle_strategy_func ||
+        aeron_agent_init(
+            &recorder_runner,
+            "archive-recorder",
+            recorder,
+            NULL,
+            NULL,
+            aeron_archive_recorder_do_work,
+            aeron_archive_recorder_on_close,
+            idle_strategy_func,
+            idle_strategy_state) < 0 ||
+        aeron_agent_start(&recorder_runner) < 0)
+    {
+        fprintf(stderr, "ERROR: recorder start (%d) %s\n", aeron_errcode(), aeron_errmsg());
+        aeron_archive_recorder_on_close(recorder);
+        goto cleanup;
+    }
+
+    while (is_running())
+    {
+        aeron_driver_main_idle_strategy(driver, aeron_driver_main_do_work(driver));
+    }
+
+    printf("Shutting down archiving driver...\n");
+
+    aeron_agent_stop(&recorder_runner);
+    aeron_agent_close(&recorder_runner);
+    status = EXIT_SUCCESS;
+
+    cleanup:
+
+    aeron_free(idle_strategy_state);
+    aeron_context_close(client_context);
+    aeron_driver_close(driver);
+    aeron_driver_context_close(context);
+
+    return status;
+}
+
+extern bool is_running();
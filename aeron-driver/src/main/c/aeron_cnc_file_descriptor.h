@@ -0,0 +1,103 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_CNC_FILE_DESCRIPTOR_H
+#define AERON_AERON_CNC_FILE_DESCRIPTOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "util/aeron_bitutil.h"
+#include "concurrent/aeron_atomic.h"
+
+/*
+ * Layout of the command and control file shared by the driver and its clients: a metadata header followed by the
+ * to driver ring buffer, the to clients broadcast buffer, the counters metadata and values buffers and the error log.
+ */
+#define AERON_CNC_FILE "cnc.dat"
+#define AERON_CNC_VERSION (13)
+
+#pragma pack(push)
+#pragma pack(4)
+typedef struct aeron_cnc_metadata_stct
+{
+    int32_t cnc_version;
+    int32_t to_driver_buffer_length;
+    int32_t to_clients_buffer_length;
+    int32_t counter_metadata_buffer_length;
+    int32_t counter_values_buffer_length;
+    int32_t error_log_buffer_length;
+    int64_t client_liveness_timeout;
+    int64_t start_timestamp;
+    int64_t pid;
+}
+aeron_cnc_metadata_t;
+#pragma pack(pop)
+
+#define AERON_CNC_VERSION_AND_META_DATA_LENGTH (AERON_ALIGN(sizeof(aeron_cnc_metadata_t), AERON_CACHE_LINE_LENGTH * 2))
+
+inline int32_t aeron_cnc_version_volatile(aeron_cnc_metadata_t *metadata)
+{
+    int32_t cnc_version;
+    AERON_GET_VOLATILE(cnc_version, metadata->cnc_version);
+    return cnc_version;
+}
+
+inline void aeron_cnc_version_signal_cnc_ready(aeron_cnc_metadata_t *metadata, int32_t cnc_version)
+{
+    AERON_PUT_VOLATILE(metadata->cnc_version, cnc_version);
+}
+
+inline uint8_t *aeron_cnc_to_driver_buffer(aeron_cnc_metadata_t *metadata)
+{
+    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH;
+}
+
+inline uint8_t *aeron_cnc_to_clients_buffer(aeron_cnc_metadata_t *metadata)
+{
+    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH +
+        metadata->to_driver_buffer_length;
+}
+
+inline uint8_t *aeron_cnc_counters_metadata_buffer(aeron_cnc_metadata_t *metadata)
+{
+    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH +
+        metadata->to_driver_buffer_length +
+        metadata->to_clients_buffer_length;
+}
+
+inline uint8_t *aeron_cnc_counters_values_buffer(aeron_cnc_metadata_t *metadata)
+{
+    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH +
+        metadata->to_driver_buffer_length +
+        metadata->to_clients_buffer_length +
+        metadata->counter_metadata_buffer_length;
+}
+
+inline uint8_t *aeron_cnc_error_log_buffer(aeron_cnc_metadata_t *metadata)
+{
+    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH +
+        metadata->to_driver_buffer_length +
+        metadata->to_clients_buffer_length +
+        metadata->counter_metadata_buffer_length +
+        metadata->counter_values_buffer_length;
+}
+
+inline size_t aeron_cnc_computed_length(size_t total_length_of_buffers, size_t alignment)
+{
+    return AERON_ALIGN(AERON_CNC_VERSION_AND_META_DATA_LENGTH + total_length_of_buffers, alignment);
+}
+
+#endif //AERON_AERON_CNC_FILE_DESCRIPTOR_H
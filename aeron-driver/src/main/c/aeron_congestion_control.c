@@ -21,12 +21,14 @@
 
 #include <dlfcn.h>
 #include <errno.h>
+#include <math.h>
 #include "protocol/aeron_udp_protocol.h"
 #include "concurrent/aeron_logbuffer_descriptor.h"
 #include "util/aeron_error.h"
 #include "aeron_congestion_control.h"
 #include "aeron_alloc.h"
 #include "aeron_driver_context.h"
+#include "aeron_position.h"
 
 aeron_congestion_control_strategy_supplier_func_t aeron_congestion_control_strategy_supplier_load(
     const char *strategy_name)
@@ -53,6 +55,10 @@ bool aeron_static_window_congestion_control_strategy_should_measure_rtt(void *st
     return false;
 }
 
+void aeron_static_window_congestion_control_strategy_on_rttm_sent(void *state, int64_t now_ns)
+{
+}
+
 void aeron_static_window_congestion_control_strategy_on_rttm(
     void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address)
 {
@@ -105,6 +111,7 @@ int aeron_static_window_congestion_control_strategy_supplier(
     }
 
     _strategy->should_measure_rtt = aeron_static_window_congestion_control_strategy_should_measure_rtt;
+    _strategy->on_rttm_sent = aeron_static_window_congestion_control_strategy_on_rttm_sent;
     _strategy->on_rttm = aeron_static_window_congestion_control_strategy_on_rttm;
     _strategy->on_track_rebuild = aeron_static_window_congestion_control_strategy_on_track_rebuild;
     _strategy->initial_window_length = aeron_static_window_congestion_control_strategy_initial_window_length;
@@ -112,10 +119,251 @@ int aeron_static_window_congestion_control_strategy_supplier(
 
     aeron_static_window_congestion_control_strategy_state_t *state = _strategy->state;
     const int32_t initial_window_length = (int32_t)context->initial_window_length;
-    const int32_t max_window_for_term = term_length / 2;
+    const int64_t max_window_for_log = aeron_logbuffer_max_window_length(term_length);
+    const int32_t max_window_for_term = max_window_for_log < INT32_MAX ? (int32_t)max_window_for_log : INT32_MAX;
 
     state->window_length = max_window_for_term < initial_window_length ? max_window_for_term : initial_window_length;
 
     *strategy = _strategy;
     return 0;
 }
+
+typedef struct aeron_cubic_congestion_control_strategy_state_stct
+{
+    bool measure_rtt;
+    bool tcp_mode;
+    int32_t mtu;
+    int32_t min_window;
+    int64_t max_cwnd;
+    int64_t cwnd;
+    int64_t w_max;
+    double k;
+    int64_t last_loss_timestamp_ns;
+    int64_t last_update_timestamp_ns;
+    int64_t last_rtt_timestamp_ns;
+    int64_t window_update_timeout_ns;
+    int64_t rtt_ns;
+    int32_t outstanding_rtt_measurements;
+
+    aeron_position_t rtt_indicator;
+    aeron_position_t window_indicator;
+    aeron_counters_manager_t *counters_manager;
+}
+aeron_cubic_congestion_control_strategy_state_t;
+
+bool aeron_cubic_congestion_control_strategy_should_measure_rtt(void *state, int64_t now_ns)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = state;
+
+    return cubic_state->measure_rtt &&
+        cubic_state->outstanding_rtt_measurements < AERON_CUBICCONGESTIONCONTROL_MAX_OUTSTANDING_RTT_MEASUREMENTS &&
+        ((cubic_state->last_rtt_timestamp_ns + AERON_CUBICCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS) - now_ns < 0 ||
+        (cubic_state->last_rtt_timestamp_ns + AERON_CUBICCONGESTIONCONTROL_RTT_MEASUREMENT_TIMEOUT_NS) - now_ns < 0);
+}
+
+void aeron_cubic_congestion_control_strategy_on_rttm_sent(void *state, int64_t now_ns)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = state;
+
+    cubic_state->last_rtt_timestamp_ns = now_ns;
+    cubic_state->outstanding_rtt_measurements++;
+}
+
+void aeron_cubic_congestion_control_strategy_on_rttm(
+    void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = state;
+
+    /* unsolicited replies must not drive the count negative and block further measurements */
+    if (cubic_state->outstanding_rtt_measurements > 0)
+    {
+        cubic_state->outstanding_rtt_measurements--;
+    }
+
+    cubic_state->last_rtt_timestamp_ns = now_ns;
+    cubic_state->rtt_ns = rtt_ns;
+    aeron_counter_set_ordered(cubic_state->rtt_indicator.value_addr, rtt_ns);
+}
+
+int32_t aeron_cubic_congestion_control_strategy_on_track_rebuild(
+    void *state,
+    bool *should_force_sm,
+    int64_t now_ns,
+    int64_t new_consumption_position,
+    int64_t last_sm_position,
+    int64_t hwm_position,
+    int64_t starting_rebuild_position,
+    int64_t ending_rebuild_position,
+    bool loss_occurred)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = state;
+    const double b = AERON_CUBICCONGESTIONCONTROL_B;
+    const double c = AERON_CUBICCONGESTIONCONTROL_C;
+
+    *should_force_sm = false;
+
+    if (loss_occurred)
+    {
+        cubic_state->w_max = cubic_state->cwnd;
+        cubic_state->k = cbrt((double)cubic_state->w_max * b / c);
+
+        const int64_t cwnd = (int64_t)((double)cubic_state->cwnd * (1.0 - b));
+        cubic_state->cwnd = cwnd > 1 ? cwnd : 1;
+        cubic_state->last_loss_timestamp_ns = now_ns;
+        *should_force_sm = true;
+    }
+    else if (cubic_state->cwnd < cubic_state->max_cwnd &&
+        (cubic_state->last_update_timestamp_ns + cubic_state->window_update_timeout_ns) - now_ns < 0)
+    {
+        /* W_cubic(t) = C(t - K)^3 + W_max */
+        const double duration_since_decrease_s = (double)(now_ns - cubic_state->last_loss_timestamp_ns) / 1.0e9;
+        const double diff_to_k = duration_since_decrease_s - cubic_state->k;
+        const double increment = c * diff_to_k * diff_to_k * diff_to_k;
+        const int64_t cwnd = cubic_state->w_max + (int64_t)increment;
+
+        cubic_state->cwnd = cwnd < cubic_state->max_cwnd ? cwnd : cubic_state->max_cwnd;
+        if (cubic_state->cwnd < 1)
+        {
+            cubic_state->cwnd = 1;
+        }
+
+        /* TCP friendly region, W_tcp(t) = W_max * (1 - B) + 3B / (2 - B) * t / RTT */
+        if (cubic_state->tcp_mode && cubic_state->cwnd < cubic_state->w_max)
+        {
+            const double rtt_s = (double)cubic_state->rtt_ns / 1.0e9;
+            const int64_t w_tcp = (int64_t)(
+                (double)cubic_state->w_max * (1.0 - b) + ((3.0 * b / (2.0 - b)) * (duration_since_decrease_s / rtt_s)));
+
+            if (w_tcp > cubic_state->cwnd)
+            {
+                cubic_state->cwnd = w_tcp < cubic_state->max_cwnd ? w_tcp : cubic_state->max_cwnd;
+            }
+        }
+
+        cubic_state->last_update_timestamp_ns = now_ns;
+        cubic_state->window_update_timeout_ns = cubic_state->rtt_ns;
+        *should_force_sm = true;
+    }
+
+    const int32_t window = (int32_t)(cubic_state->cwnd * cubic_state->mtu);
+    aeron_counter_set_ordered(cubic_state->window_indicator.value_addr, window);
+
+    return window;
+}
+
+int32_t aeron_cubic_congestion_control_strategy_initial_window_length(void *state)
+{
+    return ((aeron_cubic_congestion_control_strategy_state_t *)state)->min_window;
+}
+
+int aeron_cubic_congestion_control_strategy_fini(aeron_congestion_control_strategy_t *strategy)
+{
+    aeron_cubic_congestion_control_strategy_state_t *state = strategy->state;
+
+    if (NULL != state)
+    {
+        if (state->rtt_indicator.counter_id >= 0)
+        {
+            aeron_counters_manager_free(state->counters_manager, (int32_t)state->rtt_indicator.counter_id);
+        }
+
+        if (state->window_indicator.counter_id >= 0)
+        {
+            aeron_counters_manager_free(state->counters_manager, (int32_t)state->window_indicator.counter_id);
+        }
+    }
+
+    aeron_free(strategy->state);
+    aeron_free(strategy);
+    return 0;
+}
+
+int aeron_cubic_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager)
+{
+    aeron_congestion_control_strategy_t *_strategy;
+
+    if (aeron_alloc((void **)&_strategy, sizeof(aeron_congestion_control_strategy_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_strategy->state, sizeof(aeron_cubic_congestion_control_strategy_state_t)) < 0)
+    {
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    _strategy->should_measure_rtt = aeron_cubic_congestion_control_strategy_should_measure_rtt;
+    _strategy->on_rttm_sent = aeron_cubic_congestion_control_strategy_on_rttm_sent;
+    _strategy->on_rttm = aeron_cubic_congestion_control_strategy_on_rttm;
+    _strategy->on_track_rebuild = aeron_cubic_congestion_control_strategy_on_track_rebuild;
+    _strategy->initial_window_length = aeron_cubic_congestion_control_strategy_initial_window_length;
+    _strategy->fini = aeron_cubic_congestion_control_strategy_fini;
+
+    aeron_cubic_congestion_control_strategy_state_t *state = _strategy->state;
+    const int32_t initial_window_length = (int32_t)context->initial_window_length;
+    const int64_t max_window_for_log = aeron_logbuffer_max_window_length(term_length);
+    const int32_t max_window_for_term = max_window_for_log < INT32_MAX ? (int32_t)max_window_for_log : INT32_MAX;
+    const int32_t max_window =
+        max_window_for_term < initial_window_length ? max_window_for_term : initial_window_length;
+
+    state->measure_rtt = context->cubic_cc_measure_rtt;
+    state->tcp_mode = context->cubic_cc_tcp_mode;
+    state->mtu = sender_mtu_length;
+    state->min_window = sender_mtu_length;
+    state->max_cwnd = max_window / sender_mtu_length;
+    state->cwnd = 1;
+    state->w_max = state->max_cwnd;
+    state->k = 0.0;
+    state->rtt_ns = (int64_t)context->cubic_cc_initial_rtt_ns;
+    state->window_update_timeout_ns = state->rtt_ns;
+    state->outstanding_rtt_measurements = 0;
+    state->last_rtt_timestamp_ns = 0;
+    state->last_loss_timestamp_ns = context->nano_clock();
+    state->last_update_timestamp_ns = state->last_loss_timestamp_ns;
+    state->counters_manager = counters_manager;
+
+    state->rtt_indicator.counter_id = aeron_stream_position_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_CUBICCONGESTIONCONTROL_RTT_NAME,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel,
+        "");
+    state->window_indicator.counter_id = aeron_stream_position_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_CUBICCONGESTIONCONTROL_WINDOW_NAME,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel,
+        "");
+
+    if (state->rtt_indicator.counter_id < 0 || state->window_indicator.counter_id < 0)
+    {
+        aeron_cubic_congestion_control_strategy_fini(_strategy);
+        return -1;
+    }
+
+    state->rtt_indicator.value_addr = aeron_counter_addr(counters_manager, (int32_t)state->rtt_indicator.counter_id);
+    state->window_indicator.value_addr =
+        aeron_counter_addr(counters_manager, (int32_t)state->window_indicator.counter_id);
+
+    aeron_counter_set_ordered(state->rtt_indicator.value_addr, 0);
+    aeron_counter_set_ordered(state->window_indicator.value_addr, state->min_window);
+
+    *strategy = _strategy;
+    return 0;
+}
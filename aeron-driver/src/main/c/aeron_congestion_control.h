@@ -27,6 +27,8 @@ typedef struct aeron_counters_manager_stct aeron_counters_manager_t;
 
 typedef bool (*aeron_congestion_control_strategy_should_measure_rtt_func_t)(void *state, int64_t now_ns);
 
+typedef void (*aeron_congestion_control_strategy_on_rttm_sent_func_t)(void *state, int64_t now_ns);
+
 typedef void (*aeron_congestion_control_strategy_on_rttm_func_t)(
     void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address);
 
@@ -49,6 +51,7 @@ typedef int (*aeron_congestion_control_strategy_fini_func_t)(
 typedef struct aeron_congestion_control_strategy_stct
 {
     aeron_congestion_control_strategy_should_measure_rtt_func_t should_measure_rtt;
+    aeron_congestion_control_strategy_on_rttm_sent_func_t on_rttm_sent;
     aeron_congestion_control_strategy_on_rttm_func_t on_rttm;
     aeron_congestion_control_strategy_on_track_rebuild_func_t on_track_rebuild;
     aeron_congestion_control_strategy_initial_window_length_func_t initial_window_length;
@@ -71,4 +74,30 @@ typedef int (*aeron_congestion_control_strategy_supplier_func_t)(
 aeron_congestion_control_strategy_supplier_func_t aeron_congestion_control_strategy_supplier_load(
     const char *strategy_name);
 
+#define AERON_CUBICCONGESTIONCONTROL_B (0.2)
+#define AERON_CUBICCONGESTIONCONTROL_C (0.4)
+#define AERON_CUBICCONGESTIONCONTROL_RTT_MEASUREMENT_TIMEOUT_NS (10 * 1000 * 1000L)
+#define AERON_CUBICCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS (1000 * 1000 * 1000L)
+#define AERON_CUBICCONGESTIONCONTROL_MAX_OUTSTANDING_RTT_MEASUREMENTS (1)
+
+#define AERON_COUNTER_PER_IMAGE_TYPE_ID (10)
+#define AERON_COUNTER_CUBICCONGESTIONCONTROL_RTT_NAME "rcv-cc-cubic-rtt"
+#define AERON_COUNTER_CUBICCONGESTIONCONTROL_WINDOW_NAME "rcv-cc-cubic-wnd"
+
+/*
+ * CUBIC (RFC 8312) congestion control for Images. The window is counted in MTUs and grows along the cubic curve
+ * anchored at the window at the last loss, so it probes back up quickly over long fat links rather than sitting at
+ * a static receiver window. Loss shrinks the window by a factor of B and forces a status message.
+ */
+int aeron_cubic_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager);
+
 #endif //AERON_AERON_CONGESTION_CONTROL_H
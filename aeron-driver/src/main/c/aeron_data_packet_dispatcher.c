@@ -16,6 +16,8 @@
 
 #include <string.h>
 #include "util/aeron_error.h"
+#include "util/aeron_arrayutil.h"
+#include "aeron_alloc.h"
 #include "aeron_publication_image.h"
 #include "aeron_driver_receiver.h"
 
@@ -25,54 +27,121 @@ int aeron_data_packet_dispatcher_init(
     aeron_driver_receiver_t *receiver)
 {
     if (aeron_int64_to_ptr_hash_map_init(
-        &dispatcher->ignored_sessions_map, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+        &dispatcher->session_map, 64, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         int errcode = errno;
 
-        aeron_set_err(errcode, "could not init ignored_session_map: %s", strerror(errcode));
+        aeron_set_err(errcode, "could not init session_map: %s", strerror(errcode));
         return -1;
     }
 
     if (aeron_int64_to_ptr_hash_map_init(
-        &dispatcher->session_by_stream_id_map, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+        &dispatcher->subscribed_streams_map, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         int errcode = errno;
 
-        aeron_set_err(errcode, "could not init session_by_stream_id_map: %s", strerror(errcode));
+        aeron_set_err(errcode, "could not init subscribed_streams_map: %s", strerror(errcode));
         return -1;
     }
 
+    dispatcher->subscribed_stream_ranges.array = NULL;
+    dispatcher->subscribed_stream_ranges.length = 0;
+    dispatcher->subscribed_stream_ranges.capacity = 0;
+    dispatcher->last_image_key = 0;
+    dispatcher->last_image = NULL;
     dispatcher->conductor_proxy = conductor_proxy;
     dispatcher->receiver = receiver;
     return 0;
 }
 
-void aeron_data_packet_dispatcher_delete_session_maps(void *clientd, int64_t key, void *value)
+int aeron_data_packet_dispatcher_close(aeron_data_packet_dispatcher_t *dispatcher)
 {
-    aeron_int64_to_ptr_hash_map_t *session_map = value;
+    aeron_int64_to_ptr_hash_map_delete(&dispatcher->session_map);
+    aeron_int64_to_ptr_hash_map_delete(&dispatcher->subscribed_streams_map);
+    aeron_free(dispatcher->subscribed_stream_ranges.array);
 
-    aeron_int64_to_ptr_hash_map_delete(session_map);
-    aeron_free(session_map);
+    return 0;
 }
 
-int aeron_data_packet_dispatcher_close(aeron_data_packet_dispatcher_t *dispatcher)
+inline static aeron_publication_image_t *aeron_data_packet_dispatcher_find_image(
+    aeron_data_packet_dispatcher_t *dispatcher, int32_t session_id, int32_t stream_id, void **status)
 {
-    aeron_int64_to_ptr_hash_map_for_each(&dispatcher->session_by_stream_id_map, aeron_data_packet_dispatcher_delete_session_maps, dispatcher);
-    aeron_int64_to_ptr_hash_map_delete(&dispatcher->ignored_sessions_map);
-    aeron_int64_to_ptr_hash_map_delete(&dispatcher->session_by_stream_id_map);
+    const int64_t key = aeron_int64_to_ptr_hash_map_compound_key(session_id, stream_id);
 
-    return 0;
+    if (NULL != dispatcher->last_image && key == dispatcher->last_image_key)
+    {
+        *status = dispatcher->last_image;
+        return dispatcher->last_image;
+    }
+
+    void *value = aeron_int64_to_ptr_hash_map_get(&dispatcher->session_map, key);
+    *status = value;
+
+    if (NULL == value || aeron_data_packet_dispatcher_is_token(dispatcher, value))
+    {
+        return NULL;
+    }
+
+    dispatcher->last_image_key = key;
+    dispatcher->last_image = value;
+
+    return value;
 }
 
-int aeron_data_packet_dispatcher_add_subscription(aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id)
+inline static bool aeron_data_packet_dispatcher_is_subscribed(
+    aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id)
+{
+    if (NULL != aeron_int64_to_ptr_hash_map_get(&dispatcher->subscribed_streams_map, stream_id))
+    {
+        return true;
+    }
+
+    for (size_t i = 0, length = dispatcher->subscribed_stream_ranges.length; i < length; i++)
+    {
+        aeron_data_packet_stream_range_t *range = &dispatcher->subscribed_stream_ranges.array[i];
+
+        if (stream_id >= range->low && stream_id <= range->high)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Drop the images of streams no longer subscribed to, so their data is no longer inserted. Removal compacts the chain
+ * into the freed slot, so it is checked again before moving on.
+ */
+static void aeron_data_packet_dispatcher_remove_unsubscribed_images(aeron_data_packet_dispatcher_t *dispatcher)
 {
-    aeron_int64_to_ptr_hash_map_t *session_map;
+    aeron_int64_to_ptr_hash_map_t *map = &dispatcher->session_map;
+    size_t i = 0;
+
+    while (i < map->capacity)
+    {
+        void *value = map->values[i];
+
+        if (NULL != value &&
+            !aeron_data_packet_dispatcher_is_token(dispatcher, value) &&
+            !aeron_data_packet_dispatcher_is_subscribed(dispatcher, (int32_t)map->keys[i]))
+        {
+            aeron_int64_to_ptr_hash_map_remove(map, map->keys[i]);
+            continue;
+        }
+
+        i++;
+    }
 
-    if ((session_map = aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, stream_id)) == NULL)
+    dispatcher->last_image = NULL;
+}
+
+int aeron_data_packet_dispatcher_add_subscription(aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id)
+{
+    /* recorded even when a range covers it, so it outlives the range being removed */
+    if (NULL == aeron_int64_to_ptr_hash_map_get(&dispatcher->subscribed_streams_map, stream_id))
     {
-        if (aeron_alloc((void **)&session_map, sizeof(aeron_int64_to_ptr_hash_map_t)) < 0 ||
-            aeron_int64_to_ptr_hash_map_init(session_map, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0 ||
-            aeron_int64_to_ptr_hash_map_put(&dispatcher->session_by_stream_id_map, stream_id, session_map) < 0)
+        if (aeron_int64_to_ptr_hash_map_put(&dispatcher->subscribed_streams_map, stream_id, dispatcher) < 0)
         {
             int errcode = errno;
 
@@ -86,12 +155,55 @@ int aeron_data_packet_dispatcher_add_subscription(aeron_data_packet_dispatcher_t
 
 int aeron_data_packet_dispatcher_remove_subscription(aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id)
 {
-    aeron_int64_to_ptr_hash_map_t *session_map;
+    if (NULL == aeron_int64_to_ptr_hash_map_remove(&dispatcher->subscribed_streams_map, stream_id))
+    {
+        return 0;
+    }
+
+    aeron_data_packet_dispatcher_remove_unsubscribed_images(dispatcher);
+
+    return 0;
+}
+
+int aeron_data_packet_dispatcher_add_subscription_range(
+    aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id_low, int32_t stream_id_high)
+{
+    int ensure_capacity_result = 0;
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result, dispatcher->subscribed_stream_ranges, aeron_data_packet_stream_range_t);
 
-    if ((session_map = aeron_int64_to_ptr_hash_map_remove(&dispatcher->session_by_stream_id_map, stream_id)) != NULL)
+    if (ensure_capacity_result < 0)
     {
-        aeron_int64_to_ptr_hash_map_delete(session_map);
-        aeron_free(session_map);
+        return -1;
+    }
+
+    aeron_data_packet_stream_range_t *range =
+        &dispatcher->subscribed_stream_ranges.array[dispatcher->subscribed_stream_ranges.length++];
+    range->low = stream_id_low;
+    range->high = stream_id_high;
+
+    return 0;
+}
+
+int aeron_data_packet_dispatcher_remove_subscription_range(
+    aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id_low, int32_t stream_id_high)
+{
+    for (size_t i = 0, length = dispatcher->subscribed_stream_ranges.length; i < length; i++)
+    {
+        aeron_data_packet_stream_range_t *range = &dispatcher->subscribed_stream_ranges.array[i];
+
+        if (stream_id_low == range->low && stream_id_high == range->high)
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)dispatcher->subscribed_stream_ranges.array,
+                sizeof(aeron_data_packet_stream_range_t),
+                i,
+                length - 1);
+            dispatcher->subscribed_stream_ranges.length--;
+
+            aeron_data_packet_dispatcher_remove_unsubscribed_images(dispatcher);
+            break;
+        }
     }
 
     return 0;
@@ -100,12 +212,12 @@ int aeron_data_packet_dispatcher_remove_subscription(aeron_data_packet_dispatche
 int aeron_data_packet_dispatcher_add_publication_image(
     aeron_data_packet_dispatcher_t *dispatcher, aeron_publication_image_t *image)
 {
-    aeron_int64_to_ptr_hash_map_t *session_map =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, image->stream_id);
-
-    if (NULL != session_map)
+    if (aeron_data_packet_dispatcher_is_subscribed(dispatcher, image->stream_id))
     {
-        if (aeron_int64_to_ptr_hash_map_put(session_map, image->session_id, image) < 0)
+        if (aeron_int64_to_ptr_hash_map_put(
+            &dispatcher->session_map,
+            aeron_int64_to_ptr_hash_map_compound_key(image->session_id, image->stream_id),
+            image) < 0)
         {
             int errcode = errno;
 
@@ -113,9 +225,7 @@ int aeron_data_packet_dispatcher_add_publication_image(
             return -1;
         }
 
-        aeron_int64_to_ptr_hash_map_remove(
-            &dispatcher->ignored_sessions_map,
-            aeron_int64_to_ptr_hash_map_compound_key(image->session_id, image->stream_id));
+        dispatcher->last_image = NULL;
     }
 
     return 0;
@@ -124,27 +234,24 @@ int aeron_data_packet_dispatcher_add_publication_image(
 int aeron_data_packet_dispatcher_remove_publication_image(
     aeron_data_packet_dispatcher_t *dispatcher, aeron_publication_image_t *image)
 {
-    aeron_int64_to_ptr_hash_map_t *session_map =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, image->stream_id);
+    const int64_t key = aeron_int64_to_ptr_hash_map_compound_key(image->session_id, image->stream_id);
+    void *value = aeron_int64_to_ptr_hash_map_get(&dispatcher->session_map, key);
 
-    if (NULL != session_map)
+    /* a newer image for the same session keeps its entry, there is nothing to cool down */
+    if (NULL != value && !aeron_data_packet_dispatcher_is_token(dispatcher, value))
     {
-        aeron_publication_image_t *mapped_image = aeron_int64_to_ptr_hash_map_get(session_map, image->session_id);
+        aeron_publication_image_t *mapped_image = value;
 
-        if (NULL != mapped_image &&
-            image->conductor_fields.managed_resource.registration_id == mapped_image->conductor_fields.managed_resource.registration_id)
+        if (image->conductor_fields.managed_resource.registration_id !=
+            mapped_image->conductor_fields.managed_resource.registration_id)
         {
-            aeron_int64_to_ptr_hash_map_remove(session_map, image->session_id);
-            aeron_int64_to_ptr_hash_map_remove(
-                &dispatcher->ignored_sessions_map,
-                aeron_int64_to_ptr_hash_map_compound_key(image->session_id, image->stream_id));
+            return 0;
         }
     }
 
-    if (aeron_int64_to_ptr_hash_map_put(
-        &dispatcher->ignored_sessions_map,
-        aeron_int64_to_ptr_hash_map_compound_key(image->session_id, image->stream_id),
-        &dispatcher->tokens.on_cooldown) < 0)
+    dispatcher->last_image = NULL;
+
+    if (aeron_int64_to_ptr_hash_map_put(&dispatcher->session_map, key, &dispatcher->tokens.on_cooldown) < 0)
     {
         int errcode = errno;
 
@@ -163,117 +270,170 @@ int aeron_data_packet_dispatcher_on_data(
     size_t length,
     struct sockaddr_storage *addr)
 {
-    aeron_int64_to_ptr_hash_map_t *session_map =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
+    void *status;
+    aeron_publication_image_t *image =
+        aeron_data_packet_dispatcher_find_image(dispatcher, header->session_id, header->stream_id, &status);
+
+    if (NULL != image)
+    {
+        return aeron_publication_image_insert_packet(image, header->term_id, header->term_offset, buffer, length);
+    }
+    else if (NULL == status &&
+        (((aeron_frame_header_t *)buffer)->flags & AERON_DATA_HEADER_EOS_FLAG) == 0 &&
+        aeron_data_packet_dispatcher_is_subscribed(dispatcher, header->stream_id))
+    {
+        return aeron_data_packet_dispatcher_elicit_setup_from_source(
+            dispatcher, endpoint, addr, header->stream_id, header->session_id);
+    }
+
+    return 0;
+}
+
+int aeron_data_packet_dispatcher_on_data_batched(
+    aeron_data_packet_dispatcher_t *dispatcher,
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_data_header_t *header,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    void *status;
+    aeron_publication_image_t *image =
+        aeron_data_packet_dispatcher_find_image(dispatcher, header->session_id, header->stream_id, &status);
 
-    if (NULL != session_map)
+    if (NULL != image)
     {
-        aeron_publication_image_t *image = aeron_int64_to_ptr_hash_map_get(session_map, header->session_id);
+        aeron_publication_image_prefetch_packet(image, header->term_id, header->term_offset);
+        aeron_driver_receiver_defer_packet(
+            dispatcher->receiver, image, buffer, length, endpoint->transport.recv_timestamp_ns);
+
+        return (int)length;
+    }
 
-        if (NULL != image)
+    return aeron_data_packet_dispatcher_on_data(dispatcher, endpoint, header, buffer, length, addr);
+}
+
+int aeron_data_packet_dispatcher_on_setup(
+    aeron_data_packet_dispatcher_t *dispatcher,
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_setup_header_t *header,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    void *status;
+    aeron_publication_image_t *image =
+        aeron_data_packet_dispatcher_find_image(dispatcher, header->session_id, header->stream_id, &status);
+
+    if (NULL == image &&
+        &dispatcher->tokens.init_in_progress != status &&
+        &dispatcher->tokens.on_cooldown != status &&
+        aeron_data_packet_dispatcher_is_subscribed(dispatcher, header->stream_id))
+    {
+        if (endpoint->conductor_fields.udp_channel->multicast &&
+            endpoint->conductor_fields.udp_channel->multicast_ttl < header->ttl)
         {
-            return aeron_publication_image_insert_packet(image, header->term_id, header->term_offset, buffer, length);
+            aeron_counter_increment(endpoint->possible_ttl_asymmetry_counter, 1);
         }
-        else if (NULL == aeron_int64_to_ptr_hash_map_get(
-            &dispatcher->ignored_sessions_map,
-            aeron_int64_to_ptr_hash_map_compound_key(header->session_id, header->stream_id)) &&
-            (((aeron_frame_header_t *)buffer)->flags & AERON_DATA_HEADER_EOS_FLAG) == 0)
+
+        if (aeron_int64_to_ptr_hash_map_put(
+            &dispatcher->session_map,
+            aeron_int64_to_ptr_hash_map_compound_key(header->session_id, header->stream_id),
+            &dispatcher->tokens.init_in_progress) < 0)
         {
-            return aeron_data_packet_dispatcher_elicit_setup_from_source(
-                dispatcher, endpoint, addr, header->stream_id, header->session_id);
+            int errcode = errno;
+
+            aeron_set_err(errcode, "could not aeron_data_packet_dispatcher_on_setup: %s", strerror(errcode));
+            return -1;
         }
+
+        struct sockaddr_storage *control_addr =
+            endpoint->conductor_fields.udp_channel->multicast ? &endpoint->conductor_fields.udp_channel->remote_control : addr;
+
+        aeron_driver_conductor_proxy_on_create_publication_image_cmd(
+            dispatcher->conductor_proxy,
+            NULL != dispatcher->receiver ? &dispatcher->receiver->conductor_command_pool : NULL,
+            header->session_id,
+            header->stream_id,
+            header->initial_term_id,
+            header->active_term_id,
+            header->term_offset,
+            header->term_length,
+            header->mtu,
+            control_addr,
+            addr,
+            endpoint);
     }
 
     return 0;
 }
 
-int aeron_data_packet_dispatcher_on_setup(
+int aeron_data_packet_dispatcher_on_nak(
     aeron_data_packet_dispatcher_t *dispatcher,
     aeron_receive_channel_endpoint_t *endpoint,
-    aeron_setup_header_t *header,
+    aeron_nak_header_t *header,
     uint8_t *buffer,
     size_t length,
     struct sockaddr_storage *addr)
 {
-    aeron_int64_to_ptr_hash_map_t *session_map =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
+    void *status;
+    aeron_publication_image_t *image =
+        aeron_data_packet_dispatcher_find_image(dispatcher, header->session_id, header->stream_id, &status);
 
-    if (NULL != session_map)
+    if (NULL != image)
     {
-        aeron_publication_image_t *image = aeron_int64_to_ptr_hash_map_get(session_map, header->session_id);
+        aeron_publication_image_on_peer_nak(image, header->term_id, header->term_offset, header->length);
+    }
 
-        if (NULL == image &&
-            aeron_data_packet_dispatcher_is_not_already_in_progress_or_on_cooldown(
-                dispatcher, header->stream_id, header->session_id))
-        {
-            if (endpoint->conductor_fields.udp_channel->multicast &&
-                endpoint->conductor_fields.udp_channel->multicast_ttl < header->ttl)
-            {
-                aeron_counter_ordered_increment(endpoint->possible_ttl_asymmetry_counter, 1);
-            }
-
-            if (aeron_int64_to_ptr_hash_map_put(
-                &dispatcher->ignored_sessions_map,
-                aeron_int64_to_ptr_hash_map_compound_key(header->session_id, header->stream_id),
-                &dispatcher->tokens.init_in_progress) < 0)
-            {
-                int errcode = errno;
-
-                aeron_set_err(errcode, "could not aeron_data_packet_dispatcher_on_setup: %s", strerror(errcode));
-                return -1;
-            }
+    return 0;
+}
 
+int aeron_data_packet_dispatcher_on_rttm(
+    aeron_data_packet_dispatcher_t *dispatcher,
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_rttm_header_t *header,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    void *status;
+    aeron_publication_image_t *image =
+        aeron_data_packet_dispatcher_find_image(dispatcher, header->session_id, header->stream_id, &status);
+
+    if (NULL != image)
+    {
+        if (header->frame_header.flags & AERON_RTTM_HEADER_REPLY_FLAG)
+        {
             struct sockaddr_storage *control_addr =
                 endpoint->conductor_fields.udp_channel->multicast ? &endpoint->conductor_fields.udp_channel->remote_control : addr;
 
-            aeron_driver_conductor_proxy_on_create_publication_image_cmd(
-                dispatcher->conductor_proxy,
-                header->session_id,
-                header->stream_id,
-                header->initial_term_id,
-                header->active_term_id,
-                header->term_offset,
-                header->term_length,
-                header->mtu,
-                control_addr,
-                addr,
-                endpoint);
+            return aeron_receive_channel_endpoint_send_rttm(
+                endpoint, control_addr, header->stream_id, header->session_id, header->echo_timestamp, 0, false);
+        }
+        else
+        {
+            return aeron_publication_image_on_rttm(image, header, addr);
         }
     }
 
     return 0;
 }
 
-int aeron_data_packet_dispatcher_on_rttm(
+int aeron_data_packet_dispatcher_on_fec(
     aeron_data_packet_dispatcher_t *dispatcher,
     aeron_receive_channel_endpoint_t *endpoint,
-    aeron_rttm_header_t *header,
+    aeron_fec_header_t *header,
     uint8_t *buffer,
     size_t length,
     struct sockaddr_storage *addr)
 {
-    aeron_int64_to_ptr_hash_map_t *session_map =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
+    void *status;
+    aeron_publication_image_t *image =
+        aeron_data_packet_dispatcher_find_image(dispatcher, header->session_id, header->stream_id, &status);
 
-    if (NULL != session_map)
+    if (NULL != image)
     {
-        aeron_publication_image_t *image = aeron_int64_to_ptr_hash_map_get(session_map, header->session_id);
-
-        if (NULL != image)
-        {
-            if (header->frame_header.flags & AERON_RTTM_HEADER_REPLY_FLAG)
-            {
-                struct sockaddr_storage *control_addr =
-                    endpoint->conductor_fields.udp_channel->multicast ? &endpoint->conductor_fields.udp_channel->remote_control : addr;
-
-                return aeron_receive_channel_endpoint_send_rttm(
-                    endpoint, control_addr, header->stream_id, header->session_id, header->echo_timestamp, 0, false);
-            }
-            else
-            {
-                return aeron_publication_image_on_rttm(image, header, addr);
-            }
-        }
+        return aeron_publication_image_on_fec(image, buffer, length);
     }
 
     return 0;
@@ -290,7 +450,7 @@ int aeron_data_packet_dispatcher_elicit_setup_from_source(
         endpoint->conductor_fields.udp_channel->multicast ? &endpoint->conductor_fields.udp_channel->remote_control : addr;
 
     if (aeron_int64_to_ptr_hash_map_put(
-        &dispatcher->ignored_sessions_map,
+        &dispatcher->session_map,
         aeron_int64_to_ptr_hash_map_compound_key(session_id, stream_id),
         &dispatcher->tokens.pending_setup_frame) < 0)
     {
@@ -309,6 +469,7 @@ int aeron_data_packet_dispatcher_elicit_setup_from_source(
     return aeron_driver_receiver_add_pending_setup(dispatcher->receiver, endpoint, session_id, stream_id, NULL);
 }
 
+extern bool aeron_data_packet_dispatcher_is_token(aeron_data_packet_dispatcher_t *dispatcher, const void *value);
 extern bool aeron_data_packet_dispatcher_is_not_already_in_progress_or_on_cooldown(
     aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id, int32_t session_id);
 extern int aeron_data_packet_dispatcher_remove_pending_setup(
@@ -25,10 +25,30 @@ typedef struct aeron_publication_image_stct aeron_publication_image_t;
 typedef struct aeron_receive_channel_endpoint_stct aeron_receive_channel_endpoint_t;
 typedef struct aeron_driver_receiver_stct aeron_driver_receiver_t;
 
+typedef struct aeron_data_packet_stream_range_stct
+{
+    int32_t low;
+    int32_t high;
+}
+aeron_data_packet_stream_range_t;
+
 typedef struct aeron_data_packet_dispatcher_stct
 {
-    aeron_int64_to_ptr_hash_map_t ignored_sessions_map;
-    aeron_int64_to_ptr_hash_map_t session_by_stream_id_map;
+    /* images and tombstones keyed by aeron_int64_to_ptr_hash_map_compound_key(session_id, stream_id) */
+    aeron_int64_to_ptr_hash_map_t session_map;
+    aeron_int64_to_ptr_hash_map_t subscribed_streams_map;
+
+    /* inclusive ranges of stream ids subscribed to with a streams param, checked when a stream is not in the map */
+    struct aeron_data_packet_dispatcher_stream_ranges_stct
+    {
+        aeron_data_packet_stream_range_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    subscribed_stream_ranges;
+
+    int64_t last_image_key;
+    aeron_publication_image_t *last_image;
 
     /* tombstones for PENDING_SETUP_FRAME, INIT_IN_PROGRESS, and ON_COOL_DOWN */
     struct aeron_data_packet_dispatcher_tokens_stct
@@ -52,6 +72,10 @@ int aeron_data_packet_dispatcher_close(aeron_data_packet_dispatcher_t *dispatche
 
 int aeron_data_packet_dispatcher_add_subscription(aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id);
 int aeron_data_packet_dispatcher_remove_subscription(aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id);
+int aeron_data_packet_dispatcher_add_subscription_range(
+    aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id_low, int32_t stream_id_high);
+int aeron_data_packet_dispatcher_remove_subscription_range(
+    aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id_low, int32_t stream_id_high);
 
 int aeron_data_packet_dispatcher_add_publication_image(
     aeron_data_packet_dispatcher_t *dispatcher, aeron_publication_image_t *image);
@@ -66,6 +90,18 @@ int aeron_data_packet_dispatcher_on_data(
     size_t length,
     struct sockaddr_storage *addr);
 
+/*
+ * As aeron_data_packet_dispatcher_on_data except that a frame for an image is classified and its destination in the
+ * log prefetched, with the insert deferred to the receiver to run with the rest of the recvmmsg vector.
+ */
+int aeron_data_packet_dispatcher_on_data_batched(
+    aeron_data_packet_dispatcher_t *dispatcher,
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_data_header_t *header,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
+
 int aeron_data_packet_dispatcher_on_setup(
     aeron_data_packet_dispatcher_t *dispatcher,
     aeron_receive_channel_endpoint_t *endpoint,
@@ -74,6 +110,14 @@ int aeron_data_packet_dispatcher_on_setup(
     size_t length,
     struct sockaddr_storage *addr);
 
+int aeron_data_packet_dispatcher_on_nak(
+    aeron_data_packet_dispatcher_t *dispatcher,
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_nak_header_t *header,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
+
 int aeron_data_packet_dispatcher_on_rttm(
     aeron_data_packet_dispatcher_t *dispatcher,
     aeron_receive_channel_endpoint_t *endpoint,
@@ -82,6 +126,14 @@ int aeron_data_packet_dispatcher_on_rttm(
     size_t length,
     struct sockaddr_storage *addr);
 
+int aeron_data_packet_dispatcher_on_fec(
+    aeron_data_packet_dispatcher_t *dispatcher,
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_fec_header_t *header,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
+
 int aeron_data_packet_dispatcher_elicit_setup_from_source(
     aeron_data_packet_dispatcher_t *dispatcher,
     aeron_receive_channel_endpoint_t *endpoint,
@@ -89,10 +141,18 @@ int aeron_data_packet_dispatcher_elicit_setup_from_source(
     int32_t stream_id,
     int32_t session_id);
 
+inline bool aeron_data_packet_dispatcher_is_token(aeron_data_packet_dispatcher_t *dispatcher, const void *value)
+{
+    const uint8_t *ptr = (const uint8_t *)value;
+    const uint8_t *tokens = (const uint8_t *)&dispatcher->tokens;
+
+    return ptr >= tokens && ptr < tokens + sizeof(dispatcher->tokens);
+}
+
 inline bool aeron_data_packet_dispatcher_is_not_already_in_progress_or_on_cooldown(
     aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id, int32_t session_id)
 {
-    void *status = aeron_int64_to_ptr_hash_map_get(&dispatcher->ignored_sessions_map,
+    void *status = aeron_int64_to_ptr_hash_map_get(&dispatcher->session_map,
         aeron_int64_to_ptr_hash_map_compound_key(session_id, stream_id));
 
     return (&dispatcher->tokens.init_in_progress != status && &dispatcher->tokens.on_cooldown != status);
@@ -101,12 +161,12 @@ inline bool aeron_data_packet_dispatcher_is_not_already_in_progress_or_on_cooldo
 inline int aeron_data_packet_dispatcher_remove_pending_setup(
     aeron_data_packet_dispatcher_t *dispatcher, int32_t session_id, int32_t stream_id)
 {
-    const void *status = aeron_int64_to_ptr_hash_map_get(&dispatcher->ignored_sessions_map,
+    const void *status = aeron_int64_to_ptr_hash_map_get(&dispatcher->session_map,
         aeron_int64_to_ptr_hash_map_compound_key(session_id, stream_id));
 
     if (status == &dispatcher->tokens.pending_setup_frame)
     {
-        aeron_int64_to_ptr_hash_map_remove(&dispatcher->ignored_sessions_map,
+        aeron_int64_to_ptr_hash_map_remove(&dispatcher->session_map,
             aeron_int64_to_ptr_hash_map_compound_key(session_id, stream_id));
     }
 
@@ -116,12 +176,12 @@ inline int aeron_data_packet_dispatcher_remove_pending_setup(
 inline int aeron_data_packet_dispatcher_remove_cooldown(
     aeron_data_packet_dispatcher_t *dispatcher, int32_t session_id, int32_t stream_id)
 {
-    const void *status = aeron_int64_to_ptr_hash_map_get(&dispatcher->ignored_sessions_map,
+    const void *status = aeron_int64_to_ptr_hash_map_get(&dispatcher->session_map,
         aeron_int64_to_ptr_hash_map_compound_key(session_id, stream_id));
 
     if (status == &dispatcher->tokens.on_cooldown)
     {
-        aeron_int64_to_ptr_hash_map_remove(&dispatcher->ignored_sessions_map,
+        aeron_int64_to_ptr_hash_map_remove(&dispatcher->session_map,
             aeron_int64_to_ptr_hash_map_compound_key(session_id, stream_id));
     }
 
@@ -130,7 +190,7 @@ inline int aeron_data_packet_dispatcher_remove_cooldown(
 
 inline bool aeron_data_packet_dispatcher_should_elicit_setup_message(aeron_data_packet_dispatcher_t *dispatcher)
 {
-    return (0 != dispatcher->session_by_stream_id_map.size);
+    return (0 != dispatcher->subscribed_streams_map.size || 0 != dispatcher->subscribed_stream_ranges.length);
 }
 
 #endif //AERON_AERON_DATA_PACKET_DISPATCHER_H
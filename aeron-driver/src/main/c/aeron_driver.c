@@ -23,6 +23,9 @@
 #endif
 
 #include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
 #include <sys/stat.h>
 #include <stdio.h>
 #include <time.h>
@@ -35,6 +38,7 @@
 #include "aeron_alloc.h"
 #include "util/aeron_strutil.h"
 #include "util/aeron_fileutil.h"
+#include "util/aeron_numautil.h"
 #include "aeron_driver.h"
 
 void aeron_log_func_stderr(const char *str)
@@ -178,6 +182,102 @@ int aeron_report_existing_errors(aeron_mapped_file_t *cnc_map, const char *aeron
     return result;
 }
 
+static int aeron_driver_recycle_log_files(const char *dirname, const char *subdir, const char *recycled_dir)
+{
+    char path[AERON_MAX_PATH];
+    char recycled_path[AERON_MAX_PATH];
+    struct dirent *dir_entry;
+    struct stat sb;
+    static uint64_t recycled_id = 0;
+    DIR *dir;
+
+    snprintf(path, sizeof(path) - 1, "%s/%s", dirname, subdir);
+    if (NULL == (dir = opendir(path)))
+    {
+        return 0;
+    }
+
+    while (NULL != (dir_entry = readdir(dir)))
+    {
+        /* a log whose path does not fit is not recycled and goes when the dir is deleted */
+        const int path_length = snprintf(path, sizeof(path), "%s/%s/%s", dirname, subdir, dir_entry->d_name);
+
+        if (path_length < 0 || (size_t)path_length >= sizeof(path) || stat(path, &sb) != 0 || !S_ISREG(sb.st_mode))
+        {
+            continue;
+        }
+
+        do
+        {
+            const int recycled_path_length = snprintf(
+                recycled_path, sizeof(recycled_path), "%s/%" PRIu64 ".logbuffer", recycled_dir, recycled_id++);
+
+            if (recycled_path_length < 0 || (size_t)recycled_path_length >= sizeof(recycled_path))
+            {
+                aeron_set_err(ENAMETOOLONG, "recycled log path too long: %s", recycled_dir);
+                closedir(dir);
+                return -1;
+            }
+        }
+        while (stat(recycled_path, &sb) == 0);
+
+        if (rename(path, recycled_path) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "rename %s: %s", path, strerror(errcode));
+            closedir(dir);
+            return -1;
+        }
+    }
+
+    closedir(dir);
+    snprintf(path, sizeof(path) - 1, "%s/%s", dirname, subdir);
+
+    return aeron_dir_delete(path);
+}
+
+/*
+ * Keeps the CnC and loss report files and moves the log buffers into the recycled dir for the raw log pool to take.
+ * Everything else in the dir is removed as a cold start would.
+ */
+static int aeron_driver_recycle_dir(aeron_driver_t *driver)
+{
+    char recycled_dir[AERON_MAX_PATH];
+    const char *dirname = driver->context->aeron_dir;
+    const char *subdirs[] = { AERON_PUBLICATIONS_DIR, AERON_IMAGES_DIR, AERON_RAW_LOG_POOL_DIR };
+
+    snprintf(recycled_dir, sizeof(recycled_dir) - 1, "%s/%s", dirname, AERON_RAW_LOG_POOL_RECYCLED_DIR);
+    if (mkdir(recycled_dir, S_IRWXU) != 0 && EEXIST != errno)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "mkdir %s: %s", recycled_dir, strerror(errcode));
+        return -1;
+    }
+
+    for (size_t i = 0; i < sizeof(subdirs) / sizeof(subdirs[0]); i++)
+    {
+        if (aeron_driver_recycle_log_files(dirname, subdirs[i], recycled_dir) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int aeron_driver_clear_dir(aeron_driver_t *driver)
+{
+    if (driver->context->dirs_warm_restart)
+    {
+        return aeron_driver_recycle_dir(driver);
+    }
+
+    aeron_dir_delete(driver->context->aeron_dir);
+    return 0;
+}
+
 int aeron_driver_ensure_dir_is_recreated(aeron_driver_t *driver)
 {
     struct stat sb;
@@ -196,7 +296,10 @@ int aeron_driver_ensure_dir_is_recreated(aeron_driver_t *driver)
 
         if (driver->context->dirs_delete_on_start)
         {
-            aeron_dir_delete(driver->context->aeron_dir);
+            if (aeron_driver_clear_dir(driver) < 0)
+            {
+                return -1;
+            }
         }
         else
         {
@@ -228,11 +331,14 @@ int aeron_driver_ensure_dir_is_recreated(aeron_driver_t *driver)
 
             aeron_unmap(&cnc_mmap);
 
-            aeron_dir_delete(driver->context->aeron_dir);
+            if (aeron_driver_clear_dir(driver) < 0)
+            {
+                return -1;
+            }
         }
     }
 
-    if (mkdir(driver->context->aeron_dir, S_IRWXU) != 0)
+    if (mkdir(driver->context->aeron_dir, S_IRWXU) != 0 && !(EEXIST == errno && driver->context->dirs_warm_restart))
     {
         int errcode = errno;
         aeron_set_err(errcode, "mkdir %s: %s", driver->context->aeron_dir, strerror(errcode));
@@ -277,6 +383,67 @@ void aeron_driver_fill_cnc_metadata(aeron_driver_context_t *context)
     context->error_buffer = aeron_cnc_error_log_buffer(metadata);
 }
 
+/*
+ * CPU the thread running sender (or receiver) index will be pinned to for the threading mode, or -1 when unpinned.
+ */
+static int32_t aeron_driver_sender_cpu_affinity(aeron_driver_context_t *context, size_t index)
+{
+    switch (context->threading_mode)
+    {
+        case AERON_THREADING_MODE_SHARED:
+            return context->shared_cpu_affinity;
+
+        case AERON_THREADING_MODE_SHARED_NETWORK:
+            return context->shared_network_cpu_affinity;
+
+        case AERON_THREADING_MODE_DEDICATED:
+        default:
+            return context->sender_cpu_affinity < 0 ? -1 : context->sender_cpu_affinity + (int32_t)index;
+    }
+}
+
+static int32_t aeron_driver_receiver_cpu_affinity(aeron_driver_context_t *context, size_t index)
+{
+    switch (context->threading_mode)
+    {
+        case AERON_THREADING_MODE_SHARED:
+            return context->shared_cpu_affinity;
+
+        case AERON_THREADING_MODE_SHARED_NETWORK:
+            return context->shared_network_cpu_affinity;
+
+        case AERON_THREADING_MODE_DEDICATED:
+        default:
+            return context->receiver_cpu_affinity < 0 ? -1 : context->receiver_cpu_affinity + (int32_t)index;
+    }
+}
+
+/*
+ * On a warm restart a file of the same length is mapped and zeroed in place, the CnC version stays zero until the
+ * driver is ready so clients do not attach to it in the meantime. Any other file is replaced by a new one.
+ */
+static int aeron_driver_map_reused_file(aeron_driver_t *driver, aeron_mapped_file_t *mapped_file, const char *path)
+{
+    struct stat sb;
+    size_t length = mapped_file->length;
+
+    if (driver->context->dirs_warm_restart && stat(path, &sb) == 0 && (size_t)sb.st_size == length)
+    {
+        if (aeron_map_existing_file(mapped_file, path) == 0)
+        {
+            memset(mapped_file->addr, 0, mapped_file->length);
+            return 0;
+        }
+
+        mapped_file->addr = NULL;
+        mapped_file->length = length;
+    }
+
+    unlink(path);
+
+    return aeron_map_new_file(mapped_file, path, true, driver->context->file_page_size);
+}
+
 int aeron_driver_create_cnc_file(aeron_driver_t *driver)
 {
     char buffer[AERON_MAX_PATH];
@@ -287,7 +454,7 @@ int aeron_driver_create_cnc_file(aeron_driver_t *driver)
 
     snprintf(buffer, sizeof(buffer) - 1, "%s/%s", driver->context->aeron_dir, AERON_CNC_FILE);
 
-    if (aeron_map_new_file(&driver->context->cnc_map, buffer, true) < 0)
+    if (aeron_driver_map_reused_file(driver, &driver->context->cnc_map, buffer) < 0)
     {
         aeron_set_err(aeron_errcode(), "could not map CnC file: %s", aeron_errmsg());
         return -1;
@@ -307,7 +474,7 @@ int aeron_driver_create_loss_report_file(aeron_driver_t *driver)
 
     snprintf(buffer, sizeof(buffer) - 1, "%s/%s", driver->context->aeron_dir, AERON_LOSS_REPORT_FILE);
 
-    if (aeron_map_new_file(&driver->context->loss_report, buffer, true) < 0)
+    if (aeron_driver_map_reused_file(driver, &driver->context->loss_report, buffer) < 0)
     {
         aeron_set_err(aeron_errcode(), "could not map loss report file: %s", aeron_errmsg());
         return -1;
@@ -316,6 +483,75 @@ int aeron_driver_create_loss_report_file(aeron_driver_t *driver)
     return 0;
 }
 
+int aeron_driver_create_flow_control_trace_file(aeron_driver_t *driver)
+{
+    char buffer[AERON_MAX_PATH];
+
+    driver->context->flow_control_trace_file.addr = NULL;
+    driver->context->flow_control_trace_file.length =
+        AERON_ALIGN(driver->context->flow_control_trace_length, driver->context->file_page_size);
+
+    snprintf(buffer, sizeof(buffer) - 1, "%s/%s", driver->context->aeron_dir, AERON_FLOW_CONTROL_TRACE_FILE);
+
+    if (aeron_driver_map_reused_file(driver, &driver->context->flow_control_trace_file, buffer) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not map flow control trace file: %s", aeron_errmsg());
+        return -1;
+    }
+
+    return aeron_flow_control_trace_init(
+        &driver->context->flow_control_trace,
+        driver->context->flow_control_trace_file.addr,
+        driver->context->flow_control_trace_file.length);
+}
+
+int aeron_driver_create_position_snapshot_file(aeron_driver_t *driver)
+{
+    char buffer[AERON_MAX_PATH];
+    aeron_driver_context_t *context = driver->context;
+
+    context->position_snapshot_file.addr = NULL;
+    context->position_snapshot_file.length = AERON_ALIGN(
+        aeron_position_snapshot_length(
+            context->sender_count + context->receiver_count, context->position_snapshot_capacity),
+        context->file_page_size);
+
+    snprintf(buffer, sizeof(buffer) - 1, "%s/%s", context->aeron_dir, AERON_POSITION_SNAPSHOT_FILE);
+
+    if (aeron_driver_map_reused_file(driver, &context->position_snapshot_file, buffer) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not map position snapshot file: %s", aeron_errmsg());
+        return -1;
+    }
+
+    return aeron_position_snapshot_init(
+        context->position_snapshot_file.addr,
+        context->position_snapshot_file.length,
+        (int32_t)context->sender_count,
+        (int32_t)context->receiver_count,
+        (int32_t)context->position_snapshot_capacity);
+}
+
+int aeron_driver_create_stream_activity_file(aeron_driver_t *driver)
+{
+    char buffer[AERON_MAX_PATH];
+    aeron_driver_context_t *context = driver->context;
+
+    context->stream_activity_file.addr = NULL;
+    context->stream_activity_file.length = AERON_ALIGN(
+        aeron_stream_activity_length(context->stream_activity_capacity), context->file_page_size);
+
+    snprintf(buffer, sizeof(buffer) - 1, "%s/%s", context->aeron_dir, AERON_STREAM_ACTIVITY_FILE);
+
+    if (aeron_driver_map_reused_file(driver, &context->stream_activity_file, buffer) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not map stream activity file: %s", aeron_errmsg());
+        return -1;
+    }
+
+    return 0;
+}
+
 int aeron_driver_validate_sufficient_socket_buffer_lengths(aeron_driver_t *driver)
 {
     int result = -1, probe_fd;
@@ -487,8 +723,15 @@ int aeron_driver_shared_do_work(void *clientd)
     int sum = 0;
 
     sum += aeron_driver_conductor_do_work(&driver->conductor);
-    sum += aeron_driver_sender_do_work(&driver->sender);
-    sum += aeron_driver_receiver_do_work(&driver->receiver);
+    for (size_t i = 0; i < driver->context->sender_count; i++)
+    {
+        sum += aeron_driver_sender_do_work(&driver->senders[i]);
+    }
+
+    for (size_t i = 0; i < driver->context->receiver_count; i++)
+    {
+        sum += aeron_driver_receiver_do_work(&driver->receivers[i]);
+    }
 
     return sum;
 }
@@ -498,8 +741,15 @@ void aeron_driver_shared_on_close(void *clientd)
     aeron_driver_t *driver = (aeron_driver_t *)clientd;
 
     aeron_driver_conductor_on_close(&driver->conductor);
-    aeron_driver_sender_on_close(&driver->sender);
-    aeron_driver_receiver_on_close(&driver->receiver);
+    for (size_t i = 0; i < driver->context->sender_count; i++)
+    {
+        aeron_driver_sender_on_close(&driver->senders[i]);
+    }
+
+    for (size_t i = 0; i < driver->context->receiver_count; i++)
+    {
+        aeron_driver_receiver_on_close(&driver->receivers[i]);
+    }
 }
 
 int aeron_driver_shared_network_do_work(void *clientd)
@@ -507,8 +757,15 @@ int aeron_driver_shared_network_do_work(void *clientd)
     aeron_driver_t *driver = (aeron_driver_t *)clientd;
     int sum = 0;
 
-    sum += aeron_driver_sender_do_work(&driver->sender);
-    sum += aeron_driver_receiver_do_work(&driver->receiver);
+    for (size_t i = 0; i < driver->context->sender_count; i++)
+    {
+        sum += aeron_driver_sender_do_work(&driver->senders[i]);
+    }
+
+    for (size_t i = 0; i < driver->context->receiver_count; i++)
+    {
+        sum += aeron_driver_receiver_do_work(&driver->receivers[i]);
+    }
 
     return sum;
 }
@@ -517,8 +774,15 @@ void aeron_driver_shared_network_on_close(void *clientd)
 {
     aeron_driver_t *driver = (aeron_driver_t *)clientd;
 
-    aeron_driver_sender_on_close(&driver->sender);
-    aeron_driver_receiver_on_close(&driver->receiver);
+    for (size_t i = 0; i < driver->context->sender_count; i++)
+    {
+        aeron_driver_sender_on_close(&driver->senders[i]);
+    }
+
+    for (size_t i = 0; i < driver->context->receiver_count; i++)
+    {
+        aeron_driver_receiver_on_close(&driver->receivers[i]);
+    }
 }
 
 int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
@@ -588,28 +852,106 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
         goto error;
     }
 
-    if (aeron_driver_conductor_init(&_driver->conductor, context) < 0)
+    if (_driver->context->flow_control_trace_length > 0 && aeron_driver_create_flow_control_trace_file(_driver) < 0)
     {
         goto error;
     }
 
-    _driver->context->conductor_proxy = &_driver->conductor.conductor_proxy;
+    if (_driver->context->position_snapshot_capacity > 0 && aeron_driver_create_position_snapshot_file(_driver) < 0)
+    {
+        goto error;
+    }
 
-    if (aeron_driver_sender_init(
-        &_driver->sender, context, &_driver->conductor.system_counters, &_driver->conductor.error_log) < 0)
+    if (_driver->context->stream_activity_capacity > 0 && aeron_driver_create_stream_activity_file(_driver) < 0)
     {
         goto error;
     }
 
-    _driver->context->sender_proxy = &_driver->sender.sender_proxy;
+    if (_driver->context->raw_log_pool_size > 0)
+    {
+        if (aeron_raw_log_pool_init(&_driver->raw_log_pool, context) < 0)
+        {
+            goto error;
+        }
 
-    if (aeron_driver_receiver_init(
-        &_driver->receiver, context, &_driver->conductor.system_counters, &_driver->conductor.error_log) < 0)
+        _driver->context->raw_log_pool = &_driver->raw_log_pool;
+    }
+    else if (_driver->context->dirs_warm_restart)
+    {
+        char recycled_dir[AERON_MAX_PATH];
+
+        snprintf(
+            recycled_dir, sizeof(recycled_dir) - 1, "%s/%s", context->aeron_dir, AERON_RAW_LOG_POOL_RECYCLED_DIR);
+        aeron_dir_delete(recycled_dir);
+    }
+
+    if (_driver->context->async_name_resolution && _driver->context->udp_channel_cache_ttl_ns > 0)
+    {
+        if (aeron_name_resolver_init(&_driver->name_resolver) < 0)
+        {
+            goto error;
+        }
+
+        _driver->context->name_resolver = &_driver->name_resolver;
+    }
+
+    if (NULL != _driver->context->durable_dir)
+    {
+        if (aeron_durable_log_syncer_init(
+            &_driver->durable_log_syncer,
+            _driver->context->durable_dir,
+            (int64_t)_driver->context->durable_sync_interval_ns,
+            _driver->context->nano_clock,
+            _driver->context->epoch_clock()) < 0)
+        {
+            goto error;
+        }
+
+        _driver->context->durable_log_syncer = &_driver->durable_log_syncer;
+    }
+
+    if (aeron_driver_conductor_init(&_driver->conductor, context) < 0)
     {
         goto error;
     }
 
-    _driver->context->receiver_proxy = &_driver->receiver.receiver_proxy;
+    _driver->context->conductor_proxy = &_driver->conductor.conductor_proxy;
+
+    for (size_t i = 0; i < context->sender_count; i++)
+    {
+        if (aeron_driver_sender_init(
+            &_driver->senders[i], context, &_driver->conductor.system_counters, &_driver->conductor.error_log) < 0)
+        {
+            goto error;
+        }
+
+        _driver->context->sender_proxies[i] = &_driver->senders[i].sender_proxy;
+        _driver->senders[i].sender_proxy.numa_node =
+            aeron_numa_node_of_cpu(aeron_driver_sender_cpu_affinity(context, i));
+        aeron_position_snapshot_writer_init(
+            &_driver->senders[i].position_snapshot, context->position_snapshot_file.addr, (int32_t)i);
+    }
+
+    _driver->context->sender_proxy = &_driver->senders[0].sender_proxy;
+
+    for (size_t i = 0; i < context->receiver_count; i++)
+    {
+        if (aeron_driver_receiver_init(
+            &_driver->receivers[i], context, &_driver->conductor.system_counters, &_driver->conductor.error_log) < 0)
+        {
+            goto error;
+        }
+
+        _driver->context->receiver_proxies[i] = &_driver->receivers[i].receiver_proxy;
+        _driver->receivers[i].receiver_proxy.numa_node =
+            aeron_numa_node_of_cpu(aeron_driver_receiver_cpu_affinity(context, i));
+        aeron_position_snapshot_writer_init(
+            &_driver->receivers[i].position_snapshot,
+            context->position_snapshot_file.addr,
+            (int32_t)(context->sender_count + i));
+    }
+
+    _driver->context->receiver_proxy = &_driver->receivers[0].receiver_proxy;
 
     aeron_mpsc_rb_consumer_heartbeat_time(&_driver->conductor.to_driver_commands, aeron_epochclock());
     aeron_cnc_version_signal_cnc_ready((aeron_cnc_metadata_t *)context->cnc_map.addr, AERON_CNC_VERSION);
@@ -630,6 +972,8 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
             {
                 goto error;
             }
+
+            _driver->runners[AERON_AGENT_RUNNER_SHARED].cpu_affinity = context->shared_cpu_affinity;
             break;
 
         case AERON_THREADING_MODE_SHARED_NETWORK:
@@ -650,7 +994,7 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
             if (aeron_agent_init(
                 &_driver->runners[AERON_AGENT_RUNNER_SHARED_NETWORK],
                 "[sender, receiver]",
-                &_driver,
+                _driver,
                 _driver->context->agent_on_start_func,
                 _driver->context->agent_on_start_state,
                 aeron_driver_shared_network_do_work,
@@ -660,6 +1004,9 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
             {
                 goto error;
             }
+
+            _driver->runners[AERON_AGENT_RUNNER_CONDUCTOR].cpu_affinity = context->conductor_cpu_affinity;
+            _driver->runners[AERON_AGENT_RUNNER_SHARED_NETWORK].cpu_affinity = context->shared_network_cpu_affinity;
             break;
 
         case AERON_THREADING_MODE_DEDICATED:
@@ -678,36 +1025,167 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
                 goto error;
             }
 
-            if (aeron_agent_init(
-                &_driver->runners[AERON_AGENT_RUNNER_SENDER],
-                "sender",
-                &_driver->sender,
-                _driver->context->agent_on_start_func,
-                _driver->context->agent_on_start_state,
-                aeron_driver_sender_do_work,
-                aeron_driver_sender_on_close,
-                _driver->context->sender_idle_strategy_func,
-                _driver->context->sender_idle_strategy_state) < 0)
+            _driver->runners[AERON_AGENT_RUNNER_CONDUCTOR].cpu_affinity = context->conductor_cpu_affinity;
+
+            for (size_t i = 0; i < _driver->context->sender_count; i++)
             {
-                goto error;
+                char role_name[AERON_MAX_PATH];
+
+                if (0 == i)
+                {
+                    snprintf(role_name, sizeof(role_name), "sender");
+                }
+                else
+                {
+                    snprintf(role_name, sizeof(role_name), "sender-%" PRIu64, (uint64_t)i);
+                }
+
+                void *idle_strategy_state = _driver->context->sender_idle_strategy_state;
+
+                if (i > 0 && aeron_idle_strategy_clone_state(
+                    _driver->context->sender_idle_strategy_func,
+                    _driver->context->sender_idle_strategy_state,
+                    &idle_strategy_state) < 0)
+                {
+                    goto error;
+                }
+
+                if (aeron_agent_init(
+                    &_driver->runners[AERON_AGENT_RUNNER_SENDER + i],
+                    role_name,
+                    &_driver->senders[i],
+                    _driver->context->agent_on_start_func,
+                    _driver->context->agent_on_start_state,
+                    aeron_driver_sender_do_work,
+                    aeron_driver_sender_on_close,
+                    _driver->context->sender_idle_strategy_func,
+                    idle_strategy_state) < 0)
+                {
+                    goto error;
+                }
+
+                _driver->runners[AERON_AGENT_RUNNER_SENDER + i].cpu_affinity =
+                    aeron_driver_sender_cpu_affinity(context, i);
             }
 
-            if (aeron_agent_init(
-                &_driver->runners[AERON_AGENT_RUNNER_RECEIVER],
-                "receiver",
-                &_driver->receiver,
-                _driver->context->agent_on_start_func,
-                _driver->context->agent_on_start_state,
-                aeron_driver_receiver_do_work,
-                aeron_driver_receiver_on_close,
-                _driver->context->receiver_idle_strategy_func,
-                _driver->context->receiver_idle_strategy_state) < 0)
+            for (size_t i = 0; i < _driver->context->receiver_count; i++)
             {
-                goto error;
+                char role_name[AERON_MAX_PATH];
+
+                if (0 == i)
+                {
+                    snprintf(role_name, sizeof(role_name), "receiver");
+                }
+                else
+                {
+                    snprintf(role_name, sizeof(role_name), "receiver-%" PRIu64, (uint64_t)i);
+                }
+
+                void *idle_strategy_state = _driver->context->receiver_idle_strategy_state;
+
+                if (i > 0 && aeron_idle_strategy_clone_state(
+                    _driver->context->receiver_idle_strategy_func,
+                    _driver->context->receiver_idle_strategy_state,
+                    &idle_strategy_state) < 0)
+                {
+                    goto error;
+                }
+
+                if (aeron_agent_init(
+                    &_driver->runners[AERON_AGENT_RUNNER_RECEIVER + i],
+                    role_name,
+                    &_driver->receivers[i],
+                    _driver->context->agent_on_start_func,
+                    _driver->context->agent_on_start_state,
+                    aeron_driver_receiver_do_work,
+                    aeron_driver_receiver_on_close,
+                    _driver->context->receiver_idle_strategy_func,
+                    idle_strategy_state) < 0)
+                {
+                    goto error;
+                }
+
+                _driver->runners[AERON_AGENT_RUNNER_RECEIVER + i].cpu_affinity =
+                    aeron_driver_receiver_cpu_affinity(context, i);
             }
             break;
     }
 
+    if (NULL != _driver->context->raw_log_pool)
+    {
+        void *idle_strategy_state = NULL;
+        aeron_idle_strategy_func_t idle_strategy_func = aeron_idle_strategy_load("sleeping", &idle_strategy_state);
+
+        if (NULL == idle_strategy_func || aeron_agent_init(
+            &_driver->runners[AERON_AGENT_RUNNER_RAW_LOG_POOL],
+            "raw-log-pool",
+            &_driver->raw_log_pool,
+            _driver->context->agent_on_start_func,
+            _driver->context->agent_on_start_state,
+            aeron_raw_log_pool_do_work,
+            aeron_raw_log_pool_on_close,
+            idle_strategy_func,
+            idle_strategy_state) < 0)
+        {
+            goto error;
+        }
+    }
+
+    if (NULL != _driver->context->name_resolver)
+    {
+        void *idle_strategy_state = NULL;
+        aeron_idle_strategy_func_t idle_strategy_func = aeron_idle_strategy_load("sleeping", &idle_strategy_state);
+
+        if (NULL == idle_strategy_func || aeron_agent_init(
+            &_driver->runners[AERON_AGENT_RUNNER_NAME_RESOLVER],
+            "name-resolver",
+            &_driver->name_resolver,
+            _driver->context->agent_on_start_func,
+            _driver->context->agent_on_start_state,
+            aeron_name_resolver_do_work,
+            aeron_name_resolver_on_close,
+            idle_strategy_func,
+            idle_strategy_state) < 0)
+        {
+            goto error;
+        }
+    }
+
+    if (NULL != _driver->context->durable_log_syncer)
+    {
+        void *idle_strategy_state = NULL;
+        aeron_idle_strategy_func_t idle_strategy_func = aeron_idle_strategy_load("sleeping", &idle_strategy_state);
+
+        if (NULL == idle_strategy_func || aeron_agent_init(
+            &_driver->runners[AERON_AGENT_RUNNER_DURABLE_LOG_SYNCER],
+            "durable-log-syncer",
+            &_driver->durable_log_syncer,
+            _driver->context->agent_on_start_func,
+            _driver->context->agent_on_start_state,
+            aeron_durable_log_syncer_do_work,
+            aeron_durable_log_syncer_on_close,
+            idle_strategy_func,
+            idle_strategy_state) < 0)
+        {
+            goto error;
+        }
+    }
+
+    if (_driver->context->duty_cycle_tracking)
+    {
+        for (int i = 0; i < AERON_AGENT_RUNNER_RAW_LOG_POOL; i++)
+        {
+            if (_driver->runners[i].state == AERON_AGENT_STATE_INITED && aeron_agent_track_duty_cycle(
+                &_driver->runners[i],
+                &_driver->conductor.counters_manager,
+                (int64_t)_driver->context->duty_cycle_threshold_ns,
+                _driver->context->nano_clock) < 0)
+            {
+                goto error;
+            }
+        }
+    }
+
     *driver = _driver;
     return 0;
 
@@ -721,6 +1199,23 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
     return -1;
 }
 
+static int aeron_driver_start_manual_runner(aeron_agent_runner_t *runner)
+{
+    if (runner->cpu_affinity >= 0 && aeron_thread_set_affinity(pthread_self(), runner->cpu_affinity) < 0)
+    {
+        return -1;
+    }
+
+    if (NULL != runner->on_start)
+    {
+        runner->on_start(runner->on_start_state, runner->role_name);
+    }
+
+    runner->state = AERON_AGENT_STATE_MANUAL;
+
+    return 0;
+}
+
 int aeron_driver_start(aeron_driver_t *driver, bool manual_main_loop)
 {
     if (NULL == driver)
@@ -739,12 +1234,10 @@ int aeron_driver_start(aeron_driver_t *driver, bool manual_main_loop)
     }
     else
     {
-        if (NULL != driver->runners[0].on_start)
+        if (aeron_driver_start_manual_runner(&driver->runners[0]) < 0)
         {
-            driver->runners[0].on_start(driver->runners[0].on_start_state, driver->runners[0].role_name);
+            return -1;
         }
-
-        driver->runners[0].state = AERON_AGENT_STATE_MANUAL;
     }
 
     for (int i = 1; i < AERON_AGENT_RUNNER_MAX; i++)
@@ -774,6 +1267,58 @@ int aeron_driver_main_do_work(aeron_driver_t *driver)
     return aeron_agent_do_work(&driver->runners[AERON_AGENT_RUNNER_CONDUCTOR]);
 }
 
+int aeron_driver_invoker_start(aeron_driver_t *driver)
+{
+    if (NULL == driver)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_driver_invoker_start: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    /* the raw log pool, name resolver and durable log syncer block off the hot path so they keep their own threads */
+    for (int i = 0; i < AERON_AGENT_RUNNER_RAW_LOG_POOL; i++)
+    {
+        if (driver->runners[i].state == AERON_AGENT_STATE_INITED &&
+            aeron_driver_start_manual_runner(&driver->runners[i]) < 0)
+        {
+            return -1;
+        }
+    }
+
+    for (int i = AERON_AGENT_RUNNER_RAW_LOG_POOL; i < AERON_AGENT_RUNNER_MAX; i++)
+    {
+        if (driver->runners[i].state == AERON_AGENT_STATE_INITED && aeron_agent_start(&driver->runners[i]) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_driver_invoker_do_work(aeron_driver_t *driver)
+{
+    int work_count = 0;
+
+    if (NULL == driver)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_driver_invoker_do_work: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    for (int i = 0; i < AERON_AGENT_RUNNER_RAW_LOG_POOL; i++)
+    {
+        if (driver->runners[i].state == AERON_AGENT_STATE_MANUAL)
+        {
+            work_count += aeron_agent_do_work(&driver->runners[i]);
+        }
+    }
+
+    return work_count;
+}
+
 void aeron_driver_main_idle_strategy(aeron_driver_t *driver, int work_count)
 {
     if (NULL == driver)
@@ -812,6 +1357,202 @@ int aeron_driver_close(aeron_driver_t *driver)
         }
     }
 
+    /* states cloned for the extra senders and receivers, the first of each uses the one owned by the context */
+    for (size_t i = 1; i < driver->context->sender_count; i++)
+    {
+        void *state = driver->runners[AERON_AGENT_RUNNER_SENDER + i].idle_strategy_state;
+
+        if (state != driver->context->sender_idle_strategy_state)
+        {
+            aeron_free(state);
+        }
+    }
+
+    for (size_t i = 1; i < driver->context->receiver_count; i++)
+    {
+        void *state = driver->runners[AERON_AGENT_RUNNER_RECEIVER + i].idle_strategy_state;
+
+        if (state != driver->context->receiver_idle_strategy_state)
+        {
+            aeron_free(state);
+        }
+    }
+
     aeron_free(driver);
     return 0;
 }
+
+static int aeron_driver_host_senders_do_work(void *clientd)
+{
+    aeron_driver_host_t *host = (aeron_driver_host_t *)clientd;
+    int sum = 0;
+
+    for (size_t t = 0; t < host->tenant_count; t++)
+    {
+        aeron_driver_t *driver = host->tenants[t];
+
+        for (size_t i = 0; i < driver->context->sender_count; i++)
+        {
+            sum += aeron_agent_do_work(&driver->runners[AERON_AGENT_RUNNER_SENDER + i]);
+        }
+    }
+
+    return sum;
+}
+
+static int aeron_driver_host_receivers_do_work(void *clientd)
+{
+    aeron_driver_host_t *host = (aeron_driver_host_t *)clientd;
+    int sum = 0;
+
+    for (size_t t = 0; t < host->tenant_count; t++)
+    {
+        aeron_driver_t *driver = host->tenants[t];
+
+        for (size_t i = 0; i < driver->context->receiver_count; i++)
+        {
+            sum += aeron_agent_do_work(&driver->runners[AERON_AGENT_RUNNER_RECEIVER + i]);
+        }
+    }
+
+    return sum;
+}
+
+int aeron_driver_host_init(aeron_driver_host_t **host, aeron_driver_t **drivers, size_t driver_count)
+{
+    aeron_driver_host_t *_host = NULL;
+
+    if (NULL == host || NULL == drivers || 0 == driver_count || driver_count > AERON_DRIVER_HOST_MAX_TENANTS)
+    {
+        aeron_set_err(EINVAL, "aeron_driver_host_init: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    for (size_t t = 0; t < driver_count; t++)
+    {
+        if (NULL == drivers[t] || AERON_THREADING_MODE_DEDICATED != drivers[t]->context->threading_mode)
+        {
+            aeron_set_err(EINVAL, "aeron_driver_host_init: driver %" PRIu64 " not DEDICATED", (uint64_t)t);
+            return -1;
+        }
+    }
+
+    if (aeron_alloc((void **)&_host, sizeof(aeron_driver_host_t)) < 0)
+    {
+        return -1;
+    }
+
+    for (size_t t = 0; t < driver_count; t++)
+    {
+        _host->tenants[t] = drivers[t];
+    }
+    _host->tenant_count = driver_count;
+
+    aeron_driver_context_t *context = drivers[0]->context;
+
+    if (aeron_agent_init(
+        &_host->sender_runner,
+        "sender",
+        _host,
+        context->agent_on_start_func,
+        context->agent_on_start_state,
+        aeron_driver_host_senders_do_work,
+        NULL,
+        context->sender_idle_strategy_func,
+        context->sender_idle_strategy_state) < 0)
+    {
+        aeron_free(_host);
+        return -1;
+    }
+
+    if (aeron_agent_init(
+        &_host->receiver_runner,
+        "receiver",
+        _host,
+        context->agent_on_start_func,
+        context->agent_on_start_state,
+        aeron_driver_host_receivers_do_work,
+        NULL,
+        context->receiver_idle_strategy_func,
+        context->receiver_idle_strategy_state) < 0)
+    {
+        aeron_agent_close(&_host->sender_runner);
+        aeron_free(_host);
+        return -1;
+    }
+
+    _host->sender_runner.cpu_affinity = aeron_driver_sender_cpu_affinity(context, 0);
+    _host->receiver_runner.cpu_affinity = aeron_driver_receiver_cpu_affinity(context, 0);
+
+    *host = _host;
+    return 0;
+}
+
+int aeron_driver_host_start(aeron_driver_host_t *host)
+{
+    if (NULL == host)
+    {
+        aeron_set_err(EINVAL, "aeron_driver_host_start: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    for (size_t t = 0; t < host->tenant_count; t++)
+    {
+        aeron_driver_t *driver = host->tenants[t];
+
+        /* senders and receivers are driven by the shared runners, on whose threads they stay for their lifetime */
+        for (int i = AERON_AGENT_RUNNER_SENDER; i < AERON_AGENT_RUNNER_RAW_LOG_POOL; i++)
+        {
+            if (AERON_AGENT_STATE_INITED == driver->runners[i].state)
+            {
+                driver->runners[i].state = AERON_AGENT_STATE_MANUAL;
+            }
+        }
+
+        for (int i = 0; i < AERON_AGENT_RUNNER_MAX; i++)
+        {
+            if (AERON_AGENT_STATE_INITED == driver->runners[i].state && aeron_agent_start(&driver->runners[i]) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    if (aeron_agent_start(&host->sender_runner) < 0 || aeron_agent_start(&host->receiver_runner) < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_driver_host_close(aeron_driver_host_t *host)
+{
+    int result = 0;
+
+    if (NULL == host)
+    {
+        aeron_set_err(EINVAL, "aeron_driver_host_close: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    /* the shared threads stop first so no sender or receiver is running when its driver closes it */
+    if (aeron_agent_stop(&host->sender_runner) < 0 || aeron_agent_stop(&host->receiver_runner) < 0)
+    {
+        return -1;
+    }
+
+    aeron_agent_close(&host->sender_runner);
+    aeron_agent_close(&host->receiver_runner);
+
+    for (size_t t = 0; t < host->tenant_count; t++)
+    {
+        if (aeron_driver_close(host->tenants[t]) < 0)
+        {
+            result = -1;
+        }
+    }
+
+    aeron_free(host);
+    return result;
+}
@@ -22,24 +22,50 @@
 #include "aeron_driver_conductor.h"
 #include "aeron_driver_sender.h"
 #include "aeron_driver_receiver.h"
+#include "aeron_raw_log_pool.h"
+#include "aeron_name_resolver.h"
+#include "aeron_durable_log_syncer.h"
 
 #define AERON_AGENT_RUNNER_CONDUCTOR 0
 #define AERON_AGENT_RUNNER_SENDER 1
-#define AERON_AGENT_RUNNER_RECEIVER 2
+#define AERON_AGENT_RUNNER_RECEIVER (AERON_AGENT_RUNNER_SENDER + AERON_DRIVER_SENDER_MAX_COUNT)
 #define AERON_AGENT_RUNNER_SHARED_NETWORK 1
 #define AERON_AGENT_RUNNER_SHARED 0
-#define AERON_AGENT_RUNNER_MAX 3
+#define AERON_AGENT_RUNNER_RAW_LOG_POOL (AERON_AGENT_RUNNER_RECEIVER + AERON_DRIVER_RECEIVER_MAX_COUNT)
+#define AERON_AGENT_RUNNER_NAME_RESOLVER (AERON_AGENT_RUNNER_RAW_LOG_POOL + 1)
+#define AERON_AGENT_RUNNER_DURABLE_LOG_SYNCER (AERON_AGENT_RUNNER_NAME_RESOLVER + 1)
+#define AERON_AGENT_RUNNER_MAX (AERON_AGENT_RUNNER_DURABLE_LOG_SYNCER + 1)
 
 typedef struct aeron_driver_stct
 {
     aeron_driver_context_t *context;
     aeron_driver_conductor_t conductor;
-    aeron_driver_sender_t sender;
-    aeron_driver_receiver_t receiver;
+    aeron_driver_sender_t senders[AERON_DRIVER_SENDER_MAX_COUNT];
+    aeron_driver_receiver_t receivers[AERON_DRIVER_RECEIVER_MAX_COUNT];
+    aeron_raw_log_pool_t raw_log_pool;
+    aeron_name_resolver_t name_resolver;
+    aeron_durable_log_syncer_t durable_log_syncer;
     aeron_agent_runner_t runners[AERON_AGENT_RUNNER_MAX];
 }
 aeron_driver_t;
 
+#define AERON_DRIVER_HOST_MAX_TENANTS (16)
+
+/*
+ * Drivers for several aeron dirs in one process, each with its own context, CnC and conductor thread, whose senders
+ * all run on one shared thread and whose receivers all run on another.
+ */
+typedef struct aeron_driver_host_stct
+{
+    aeron_driver_t *tenants[AERON_DRIVER_HOST_MAX_TENANTS];
+    size_t tenant_count;
+    aeron_agent_runner_t sender_runner;
+    aeron_agent_runner_t receiver_runner;
+}
+aeron_driver_host_t;
+
+#define AERON_DRIVER_MAX_SHARDS (64)
+
 bool aeron_is_driver_active_with_cnc(
     aeron_mapped_file_t *cnc_map, int64_t timeout, int64_t now, aeron_log_func_t log_func);
 
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include "util/aeron_bitutil.h"
+#include "aeron_alloc.h"
+#include "aeron_driver_command_pool.h"
+
+#define AERON_DRIVER_COMMAND_POOL_ALIGNMENT (16)
+
+int aeron_driver_command_pool_init(aeron_driver_command_pool_t *pool, size_t command_length, size_t capacity)
+{
+    pool->slot_length = AERON_ALIGN(
+        sizeof(aeron_driver_command_pool_slot_t) + command_length, AERON_DRIVER_COMMAND_POOL_ALIGNMENT);
+    pool->capacity = capacity;
+    pool->free_list = NULL;
+    pool->slots = NULL;
+
+    if (aeron_alloc((void **)&pool->slots, pool->slot_length * capacity) < 0)
+    {
+        return -1;
+    }
+
+    for (size_t i = capacity; i > 0; i--)
+    {
+        aeron_driver_command_pool_slot_t *slot =
+            (aeron_driver_command_pool_slot_t *)(pool->slots + ((i - 1) * pool->slot_length));
+
+        slot->pool = pool;
+        slot->next_free = pool->free_list;
+        pool->free_list = slot;
+    }
+
+    return 0;
+}
+
+void aeron_driver_command_pool_close(aeron_driver_command_pool_t *pool)
+{
+    aeron_free(pool->slots);
+    pool->slots = NULL;
+    pool->free_list = NULL;
+}
+
+void *aeron_driver_command_pool_acquire(aeron_driver_command_pool_t *pool, size_t length)
+{
+    aeron_driver_command_pool_slot_t *slot;
+
+    if (NULL != pool && NULL != pool->free_list &&
+        sizeof(aeron_driver_command_pool_slot_t) + length <= pool->slot_length)
+    {
+        slot = pool->free_list;
+        pool->free_list = slot->next_free;
+        slot->next_free = NULL;
+        memset((uint8_t *)slot + sizeof(aeron_driver_command_pool_slot_t), 0, length);
+    }
+    else
+    {
+        if (aeron_alloc((void **)&slot, sizeof(aeron_driver_command_pool_slot_t) + length) < 0)
+        {
+            return NULL;
+        }
+
+        slot->pool = NULL;
+    }
+
+    return (uint8_t *)slot + sizeof(aeron_driver_command_pool_slot_t);
+}
+
+void aeron_driver_command_pool_release(void *command)
+{
+    if (NULL == command)
+    {
+        return;
+    }
+
+    aeron_driver_command_pool_slot_t *slot =
+        (aeron_driver_command_pool_slot_t *)((uint8_t *)command - sizeof(aeron_driver_command_pool_slot_t));
+    aeron_driver_command_pool_t *pool = slot->pool;
+
+    if (NULL == pool)
+    {
+        aeron_free(slot);
+    }
+    else
+    {
+        slot->next_free = pool->free_list;
+        pool->free_list = slot;
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_DRIVER_COMMAND_POOL_H
+#define AERON_AERON_DRIVER_COMMAND_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define AERON_DRIVER_COMMAND_POOL_CAPACITY (256)
+
+typedef struct aeron_driver_command_pool_stct aeron_driver_command_pool_t;
+
+typedef struct aeron_driver_command_pool_slot_stct
+{
+    aeron_driver_command_pool_t *pool;
+    struct aeron_driver_command_pool_slot_stct *next_free;
+}
+aeron_driver_command_pool_slot_t;
+
+/*
+ * Fixed size slots for the commands an agent passes to another through a proxy. A command goes back to the agent
+ * that sent it to be deleted, so a pool is only ever touched by the one thread and needs no synchronisation. When
+ * the pool is empty, or the command does not fit a slot, the command is taken from the heap instead.
+ */
+struct aeron_driver_command_pool_stct
+{
+    uint8_t *slots;
+    aeron_driver_command_pool_slot_t *free_list;
+    size_t slot_length;
+    size_t capacity;
+};
+
+int aeron_driver_command_pool_init(aeron_driver_command_pool_t *pool, size_t command_length, size_t capacity);
+
+void aeron_driver_command_pool_close(aeron_driver_command_pool_t *pool);
+
+/*
+ * Zeroed command of length bytes, or NULL with the error set. A NULL pool always takes the command from the heap.
+ */
+void *aeron_driver_command_pool_acquire(aeron_driver_command_pool_t *pool, size_t length);
+
+/*
+ * Return a command from aeron_driver_command_pool_acquire to the pool it came from, on the thread that acquired it.
+ */
+void aeron_driver_command_pool_release(void *command);
+
+#endif //AERON_AERON_DRIVER_COMMAND_POOL_H
@@ -20,9 +20,11 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
+#include "concurrent/aeron_atomic.h"
 
 #define AERON_MAX_PATH (256)
 #define AERON_CHANNEL_STATUS_INDICATOR_NOT_ALLOCATED (-1)
+#define AERON_DRIVER_UNBLOCK_STALL_MULTIPLE (4)
 
 typedef void (*aeron_idle_strategy_func_t)(void *, int);
 typedef int (*aeron_idle_strategy_init_func_t)(void **);
@@ -56,6 +58,9 @@ typedef struct aeron_subscribable_stct
     void (*add_position_hook_func)(void *clientd, int64_t *value_addr);
     void (*remove_position_hook_func)(void *clientd, int64_t *value_addr);
     void *clientd;
+    /* slowest position found by the last scan of the array and where it was read, NULL when there is no scan */
+    int64_t *min_position_addr;
+    int64_t min_position;
 }
 aeron_subscribable_t;
 
@@ -70,6 +75,64 @@ int aeron_driver_subscribable_add_position(
     aeron_subscribable_t *subscribable, int64_t counter_id, int64_t *value_addr);
 void aeron_driver_subscribable_remove_position(aeron_subscribable_t *subscribable, int64_t counter_id);
 
+/*
+ * Time a publication may look blocked before it is unblocked. Until fast_unblock_deadline_ns, which follows the
+ * timeout of a client that had it, the claim of the dead client is unblocked as soon as it is seen holding up the log.
+ * Otherwise with a minimum set the timeout adapts to a multiple of the longest stall that cleared by itself, capped by
+ * the unblock timeout.
+ */
+inline int64_t aeron_driver_unblock_timeout_ns(
+    int64_t now_ns,
+    int64_t unblock_timeout_ns,
+    int64_t unblock_timeout_min_ns,
+    int64_t longest_stall_ns,
+    int64_t fast_unblock_deadline_ns)
+{
+    if (now_ns < fast_unblock_deadline_ns)
+    {
+        return 0;
+    }
+
+    if (unblock_timeout_min_ns <= 0)
+    {
+        return unblock_timeout_ns;
+    }
+
+    int64_t timeout_ns = AERON_DRIVER_UNBLOCK_STALL_MULTIPLE * longest_stall_ns;
+    timeout_ns = timeout_ns < unblock_timeout_min_ns ? unblock_timeout_min_ns : timeout_ns;
+
+    return timeout_ns < unblock_timeout_ns ? timeout_ns : unblock_timeout_ns;
+}
+
+/*
+ * Keep the slowest position found by a scan of the array so later duty cycles can check it alone.
+ */
+inline void aeron_driver_subscribable_track_min_position(
+    aeron_subscribable_t *subscribable, int64_t *value_addr, int64_t min_position)
+{
+    subscribable->min_position_addr = value_addr;
+    subscribable->min_position = min_position;
+}
+
+/*
+ * Positions only advance, so while the subscriber that was slowest at the last scan has not moved the minimum is
+ * still min_position, and while it is no further than threshold neither is the minimum and min_position stays a lower
+ * bound for it. Either way a scan of every position can be skipped when nothing is done with a minimum up to
+ * threshold that could not be done with min_position.
+ */
+inline bool aeron_driver_subscribable_is_min_position_settled(aeron_subscribable_t *subscribable, int64_t threshold)
+{
+    if (NULL == subscribable->min_position_addr)
+    {
+        return false;
+    }
+
+    int64_t position;
+    AERON_GET_VOLATILE(position, *subscribable->min_position_addr);
+
+    return position == subscribable->min_position || position <= threshold;
+}
+
 inline void aeron_driver_subscribable_null_hook(void *clientd, int64_t *value_addr)
 {
 }
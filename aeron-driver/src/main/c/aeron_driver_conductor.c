@@ -23,12 +23,15 @@
 #include "util/aeron_error.h"
 #include "media/aeron_send_channel_endpoint.h"
 #include "util/aeron_arrayutil.h"
+#include "util/aeron_numautil.h"
+#include "util/aeron_probes.h"
 #include "aeron_driver_conductor.h"
 #include "aeron_position.h"
 #include "aeron_driver_sender.h"
 #include "aeron_driver_receiver.h"
 #include "aeron_publication_image.h"
 #include "concurrent/aeron_logbuffer_unblocker.h"
+#include "aeron_name_resolver.h"
 
 static void aeron_error_log_resource_linger(void *clientd, uint8_t *resource)
 {
@@ -106,17 +109,71 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
         return -1;
     }
 
+    if (aeron_udp_channel_cache_init(&conductor->udp_channel_cache, (int64_t)context->udp_channel_cache_ttl_ns) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->client_index_by_id_map, 64, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->shared_ipc_publication_by_stream_id_map, 64, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->shared_network_publication_by_endpoint_stream_map,
+        64,
+        AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->network_publication_by_registration_id_map, 64, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->send_channel_endpoint_by_tag_map, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0 ||
+        aeron_int64_to_ptr_hash_map_init(
+        &conductor->receive_channel_endpoint_by_tag_map, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_loss_reporter_init(&conductor->loss_reporter, context->loss_report.addr, context->loss_report.length) < 0)
     {
         return -1;
     }
 
+    if (aeron_stream_activity_init(
+        &conductor->stream_activity,
+        context->stream_activity_file.addr,
+        context->stream_activity_file.length,
+        (int32_t)context->stream_activity_capacity) < 0)
+    {
+        return -1;
+    }
+
     conductor->conductor_proxy.command_queue = &context->conductor_command_queue;
     conductor->conductor_proxy.fail_counter =
         aeron_counter_addr(&conductor->counters_manager, AERON_SYSTEM_COUNTER_CONDUCTOR_PROXY_FAILS);
     conductor->conductor_proxy.threading_mode = context->threading_mode;
     conductor->conductor_proxy.conductor = conductor;
 
+    if (aeron_driver_command_pool_init(
+        &conductor->conductor_proxy.command_pool, sizeof(aeron_command_base_t), AERON_DRIVER_COMMAND_POOL_CAPACITY) < 0)
+    {
+        return -1;
+    }
+
     conductor->clients.array = NULL;
     conductor->clients.capacity = 0;
     conductor->clients.length = 0;
@@ -159,13 +216,6 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
     conductor->publication_images.has_reached_end_of_life = aeron_publication_image_entry_has_reached_end_of_life;
     conductor->publication_images.delete_func = aeron_publication_image_entry_delete;
 
-    conductor->lingering_resources.array = NULL;
-    conductor->lingering_resources.length = 0;
-    conductor->lingering_resources.capacity = 0;
-    conductor->lingering_resources.on_time_event = aeron_linger_resource_entry_on_time_event;
-    conductor->lingering_resources.has_reached_end_of_life = aeron_linger_resource_entry_has_reached_end_of_life;
-    conductor->lingering_resources.delete_func = aeron_linger_resource_entry_delete;
-
     conductor->ipc_subscriptions.array = NULL;
     conductor->ipc_subscriptions.length = 0;
     conductor->ipc_subscriptions.capacity = 0;
@@ -178,18 +228,69 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
     conductor->spy_subscriptions.length = 0;
     conductor->spy_subscriptions.capacity = 0;
 
+    conductor->deferred_commands.array = NULL;
+    conductor->deferred_commands.length = 0;
+    conductor->deferred_commands.capacity = 0;
+
+    conductor->command_backlog.capacity = 2 * AERON_DRIVER_CONDUCTOR_COMMAND_BLOCK_LENGTH_LIMIT;
+    if (aeron_alloc((void **)&conductor->command_backlog.buffer, conductor->command_backlog.capacity) < 0)
+    {
+        return -1;
+    }
+    conductor->command_backlog.head = 0;
+    conductor->command_backlog.tail = 0;
+    conductor->command_backlog.count = 0;
+    conductor->command_backlog.budget = 0;
+
     conductor->errors_counter = aeron_counter_addr(&conductor->counters_manager, AERON_SYSTEM_COUNTER_ERRORS);
     conductor->client_keep_alives_counter =
         aeron_counter_addr(&conductor->counters_manager, AERON_SYSTEM_COUNTER_CLIENT_KEEP_ALIVES);
     conductor->unblocked_commands_counter =
         aeron_counter_addr(&conductor->counters_manager, AERON_SYSTEM_COUNTER_UNBLOCKED_COMMANDS);
+    conductor->commands_waiting_counter =
+        aeron_counter_addr(&conductor->counters_manager, AERON_SYSTEM_COUNTER_CONDUCTOR_COMMANDS_WAITING);
+    conductor->command_max_wait_ns_counter =
+        aeron_counter_addr(&conductor->counters_manager, AERON_SYSTEM_COUNTER_CONDUCTOR_COMMAND_MAX_WAIT_NS);
+    conductor->log_buffer_resident_bytes_counter =
+        aeron_counter_addr(&conductor->counters_manager, AERON_SYSTEM_COUNTER_LOG_BUFFER_RESIDENT_BYTES);
 
     int64_t now_ns = context->nano_clock();
 
+    if (aeron_deadline_timer_wheel_init(
+        &conductor->client_timer_wheel,
+        now_ns,
+        AERON_DRIVER_CONDUCTOR_TIMER_WHEEL_TICK_RESOLUTION_NS,
+        AERON_DRIVER_CONDUCTOR_TIMER_WHEEL_TICKS_PER_WHEEL) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_deadline_timer_wheel_init(
+        &conductor->linger_resource_timer_wheel,
+        now_ns,
+        AERON_DRIVER_CONDUCTOR_TIMER_WHEEL_TICK_RESOLUTION_NS,
+        AERON_DRIVER_CONDUCTOR_TIMER_WHEEL_TICKS_PER_WHEEL) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_term_length_advisor_init(
+        &conductor->term_length_advisor,
+        &conductor->counters_manager,
+        (int64_t)context->term_buffer_auto_size_target_ns,
+        now_ns) < 0)
+    {
+        return -1;
+    }
+
     conductor->nano_clock = context->nano_clock;
     conductor->epoch_clock = context->epoch_clock;
     conductor->next_session_id = aeron_randomised_int32();
     conductor->time_of_last_timeout_check_ns = now_ns;
+    conductor->available_images.is_batching = false;
+    conductor->available_images.length = 0;
+    conductor->residency_sweep_index = 0;
+    conductor->residency_sweep_length = 0;
     conductor->time_of_last_to_driver_position_change_ns = now_ns;
     conductor->last_consumer_command_position = aeron_mpsc_rb_consumer_position(&conductor->to_driver_commands);
 
@@ -199,18 +300,58 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
 
 int aeron_driver_conductor_find_client(aeron_driver_conductor_t *conductor, int64_t client_id)
 {
-    int index = -1;
+    uintptr_t index_plus_one = (uintptr_t)aeron_int64_to_ptr_hash_map_get(&conductor->client_index_by_id_map, client_id);
+
+    return (int)index_plus_one - 1;
+}
+
+static int aeron_driver_conductor_index_client(aeron_driver_conductor_t *conductor, size_t index)
+{
+    return aeron_int64_to_ptr_hash_map_put(
+        &conductor->client_index_by_id_map,
+        conductor->clients.array[index].client_id,
+        (void *)(uintptr_t)(index + 1));
+}
+
+static int aeron_driver_conductor_schedule_client_timer(
+    aeron_driver_conductor_t *conductor, aeron_client_t *client, int64_t deadline_ns)
+{
+    aeron_deadline_timer_wheel_cancel(&conductor->client_timer_wheel, client->timer_id);
 
-    for (int i = (int)conductor->clients.length - 1; i >= 0; i--)
+    client->timer_id = aeron_deadline_timer_wheel_schedule(
+        &conductor->client_timer_wheel, deadline_ns, client->client_id);
+
+    return AERON_DEADLINE_TIMER_WHEEL_NULL_TIMER_ID == client->timer_id ? -1 : 0;
+}
+
+static int64_t aeron_client_heartbeat_timestamp_ms(aeron_client_t *client)
+{
+    return NULL == client->heartbeat_timestamp ? 0 : aeron_counter_get_volatile(client->heartbeat_timestamp);
+}
+
+/*
+ * A client is live until both its last keepalive command and its heartbeat timestamp counter are older than the
+ * liveness timeout. The counter holds epoch ms so its deadline is carried over to the nano clock relative to now.
+ */
+static int64_t aeron_client_liveness_deadline_ns(aeron_client_t *client, int64_t now_ns, int64_t now_ms)
+{
+    const int64_t keepalive_deadline_ns = client->time_of_last_keepalive + client->client_liveness_timeout_ns;
+    const int64_t heartbeat_deadline_ms =
+        aeron_client_heartbeat_timestamp_ms(client) + (client->client_liveness_timeout_ns / 1000000);
+
+    if (NULL != client->heartbeat_timestamp && heartbeat_deadline_ms >= now_ms)
     {
-        if (client_id == conductor->clients.array[i].client_id)
-        {
-            index = i;
-            break;
-        }
+        const int64_t heartbeat_deadline_ns = now_ns + ((heartbeat_deadline_ms - now_ms) * 1000000);
+
+        return heartbeat_deadline_ns > keepalive_deadline_ns ? heartbeat_deadline_ns : keepalive_deadline_ns;
     }
 
-    return index;
+    return keepalive_deadline_ns;
+}
+
+static int64_t aeron_driver_conductor_endpoint_stream_key(aeron_send_channel_endpoint_t *endpoint, int32_t stream_id)
+{
+    return aeron_int64_to_ptr_hash_map_compound_key((int32_t)endpoint->channel_status.counter_id, stream_id);
 }
 
 aeron_client_t *aeron_driver_conductor_get_or_add_client(aeron_driver_conductor_t *conductor, int64_t client_id)
@@ -228,11 +369,41 @@ aeron_client_t *aeron_driver_conductor_get_or_add_client(aeron_driver_conductor_
         {
             index = (int) conductor->clients.length;
             client = &conductor->clients.array[index];
-
             client->client_id = client_id;
+
+            if (aeron_driver_conductor_index_client(conductor, (size_t)index) < 0)
+            {
+                aeron_set_err(ENOMEM, "%s", "could not index client");
+                return NULL;
+            }
+
             client->reached_end_of_life = false;
             client->time_of_last_keepalive = conductor->context->nano_clock();
             client->client_liveness_timeout_ns = conductor->context->client_liveness_timeout_ns;
+            client->timer_id = AERON_DEADLINE_TIMER_WHEEL_NULL_TIMER_ID;
+
+            /* without a heartbeat counter the client is kept alive by keepalive commands alone */
+            client->heartbeat_timestamp = NULL;
+            client->heartbeat_timestamp_counter_id = aeron_counter_client_heartbeat_timestamp_allocate(
+                &conductor->counters_manager, client_id);
+            if (client->heartbeat_timestamp_counter_id >= 0)
+            {
+                client->heartbeat_timestamp = aeron_counter_addr(
+                    &conductor->counters_manager, client->heartbeat_timestamp_counter_id);
+                aeron_counter_set_ordered(client->heartbeat_timestamp, conductor->epoch_clock());
+            }
+
+            if (aeron_driver_conductor_schedule_client_timer(
+                conductor, client, client->time_of_last_keepalive + client->client_liveness_timeout_ns + 1) < 0)
+            {
+                aeron_int64_to_ptr_hash_map_remove(&conductor->client_index_by_id_map, client_id);
+                if (client->heartbeat_timestamp_counter_id >= 0)
+                {
+                    aeron_counters_manager_free(&conductor->counters_manager, client->heartbeat_timestamp_counter_id);
+                }
+                return NULL;
+            }
+
             client->publication_links.array = NULL;
             client->publication_links.length = 0;
             client->publication_links.capacity = 0;
@@ -250,12 +421,47 @@ aeron_client_t *aeron_driver_conductor_get_or_add_client(aeron_driver_conductor_
     return client;
 }
 
+/*
+ * A client that stopped being live may have died part way through a claim on a shared publication, so let each of its
+ * publications unblock without waiting out the unblock timeout. The links only hold the managed resource so the
+ * publications are found by it, which is rare enough for a search.
+ */
+static void aeron_client_on_liveness_timeout(
+    aeron_driver_conductor_t *conductor, aeron_client_t *client, int64_t now_ns)
+{
+    for (size_t i = 0; i < client->publication_links.length; i++)
+    {
+        aeron_driver_managed_resource_t *resource = client->publication_links.array[i].resource;
+
+        for (size_t j = 0; j < conductor->ipc_publications.length; j++)
+        {
+            aeron_ipc_publication_t *publication = conductor->ipc_publications.array[j].publication;
+
+            if (&publication->conductor_fields.managed_resource == resource)
+            {
+                aeron_ipc_publication_on_client_timeout(publication, now_ns);
+            }
+        }
+
+        for (size_t j = 0; j < conductor->network_publications.length; j++)
+        {
+            aeron_network_publication_t *publication = conductor->network_publications.array[j].publication;
+
+            if (&publication->conductor_fields.managed_resource == resource)
+            {
+                aeron_network_publication_on_client_timeout(publication, now_ns);
+            }
+        }
+    }
+}
+
 void aeron_client_on_time_event(
     aeron_driver_conductor_t *conductor, aeron_client_t *client, int64_t now_ns, int64_t now_ms)
 {
-    if (now_ns > (client->time_of_last_keepalive + client->client_liveness_timeout_ns))
+    if (now_ns > aeron_client_liveness_deadline_ns(client, now_ns, now_ms))
     {
         client->reached_end_of_life = true;
+        aeron_client_on_liveness_timeout(conductor, client, now_ns);
     }
 }
 
@@ -264,6 +470,72 @@ bool aeron_client_has_reached_end_of_life(aeron_driver_conductor_t *conductor, a
     return client->reached_end_of_life;
 }
 
+/*
+ * Match a channel carrying a tag against the channel of the endpoint found with it. A channel referring to the tag
+ * takes the addresses of the endpoint and a channel with addresses of its own must have the same ones.
+ */
+static int aeron_driver_conductor_match_tagged_channel(
+    aeron_udp_channel_t *channel, aeron_udp_channel_t *tagged_channel)
+{
+    if (channel->is_tag_reference)
+    {
+        aeron_udp_channel_adopt_addresses(channel, tagged_channel);
+        return 0;
+    }
+
+    if (channel->canonical_length != tagged_channel->canonical_length ||
+        0 != strncmp(channel->canonical_form, tagged_channel->canonical_form, channel->canonical_length))
+    {
+        aeron_set_err(
+            EINVAL,
+            "%s=%" PRId64 " already names channel %s: %s",
+            AERON_URI_TAGS_KEY,
+            channel->tag,
+            tagged_channel->original_uri,
+            channel->original_uri);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_driver_conductor_tag_endpoint(
+    aeron_int64_to_ptr_hash_map_t *endpoint_by_tag_map,
+    aeron_udp_channel_t *channel,
+    aeron_udp_channel_t *endpoint_channel,
+    void *endpoint)
+{
+    if (endpoint_channel->has_tag && endpoint_channel->tag != channel->tag)
+    {
+        aeron_set_err(
+            EINVAL,
+            "channel %s already has %s=%" PRId64,
+            endpoint_channel->original_uri,
+            AERON_URI_TAGS_KEY,
+            endpoint_channel->tag);
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_put(endpoint_by_tag_map, channel->tag, endpoint) < 0)
+    {
+        return -1;
+    }
+
+    endpoint_channel->has_tag = true;
+    endpoint_channel->tag = channel->tag;
+
+    return 0;
+}
+
+static void aeron_driver_conductor_untag_endpoint(
+    aeron_int64_to_ptr_hash_map_t *endpoint_by_tag_map, aeron_udp_channel_t *endpoint_channel)
+{
+    if (endpoint_channel->has_tag)
+    {
+        aeron_int64_to_ptr_hash_map_remove(endpoint_by_tag_map, endpoint_channel->tag);
+    }
+}
+
 void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *client)
 {
     for (size_t i = 0; i < client->publication_links.length; i++)
@@ -280,6 +552,12 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
         aeron_counters_manager_free(&conductor->counters_manager, link->counter_id);
     }
 
+    if (client->heartbeat_timestamp_counter_id >= 0)
+    {
+        aeron_counters_manager_free(&conductor->counters_manager, client->heartbeat_timestamp_counter_id);
+        client->heartbeat_timestamp = NULL;
+    }
+
     for (int last_index = (int)conductor->ipc_subscriptions.length - 1, i = last_index; i >= 0; i--)
     {
         aeron_subscription_link_t *link = &conductor->ipc_subscriptions.array[i];
@@ -304,7 +582,7 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
             aeron_receive_channel_endpoint_t *endpoint = link->endpoint;
 
             link->endpoint = NULL;
-            aeron_receive_channel_endpoint_decref_to_stream(endpoint, link->stream_id);
+            aeron_receive_channel_endpoint_decref_to_stream_range(endpoint, link->stream_id, link->stream_id_high);
             if (AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_CLOSING == endpoint->conductor_fields.status)
             {
                 aeron_udp_channel_t *udp_channel = endpoint->conductor_fields.udp_channel;
@@ -313,6 +591,7 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
                     &conductor->receive_channel_endpoint_by_channel_map,
                     udp_channel->canonical_form,
                     udp_channel->canonical_length);
+                aeron_driver_conductor_untag_endpoint(&conductor->receive_channel_endpoint_by_tag_map, udp_channel);
             }
 
             aeron_driver_conductor_unlink_all_subscribable(conductor, link);
@@ -351,6 +630,7 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
     client->counter_links.length = 0;
     client->counter_links.capacity = 0;
 
+    aeron_int64_to_ptr_hash_map_remove(&conductor->client_index_by_id_map, client->client_id);
     client->client_id = -1;
 }
 
@@ -423,6 +703,13 @@ void aeron_ipc_publication_entry_delete(
         aeron_driver_conductor_unlink_subscribable(link, &entry->publication->conductor_fields.subscribable);
     }
 
+    if (aeron_int64_to_ptr_hash_map_get(
+        &conductor->shared_ipc_publication_by_stream_id_map, entry->publication->stream_id) == entry->publication)
+    {
+        aeron_int64_to_ptr_hash_map_remove(
+            &conductor->shared_ipc_publication_by_stream_id_map, entry->publication->stream_id);
+    }
+
     aeron_ipc_publication_close(&conductor->counters_manager, entry->publication);
     entry->publication = NULL;
 }
@@ -451,6 +738,18 @@ void aeron_network_publication_entry_delete(
         aeron_driver_conductor_unlink_subscribable(link, &entry->publication->conductor_fields.subscribable);
     }
 
+    const int64_t endpoint_stream_key = aeron_driver_conductor_endpoint_stream_key(endpoint, entry->publication->stream_id);
+    if (aeron_int64_to_ptr_hash_map_get(
+        &conductor->shared_network_publication_by_endpoint_stream_map, endpoint_stream_key) == entry->publication)
+    {
+        aeron_int64_to_ptr_hash_map_remove(
+            &conductor->shared_network_publication_by_endpoint_stream_map, endpoint_stream_key);
+    }
+
+    aeron_int64_to_ptr_hash_map_remove(
+        &conductor->network_publication_by_registration_id_map,
+        entry->publication->conductor_fields.managed_resource.registration_id);
+
     aeron_network_publication_close(&conductor->counters_manager, entry->publication);
     entry->publication = NULL;
 
@@ -462,6 +761,8 @@ void aeron_network_publication_entry_delete(
             &conductor->send_channel_endpoint_by_channel_map,
             endpoint->conductor_fields.udp_channel->canonical_form,
             endpoint->conductor_fields.udp_channel->canonical_length);
+        aeron_driver_conductor_untag_endpoint(
+            &conductor->send_channel_endpoint_by_tag_map, endpoint->conductor_fields.udp_channel);
     }
 }
 
@@ -489,7 +790,7 @@ void aeron_driver_conductor_cleanup_spies(aeron_driver_conductor_t *conductor, a
 void aeron_driver_conductor_cleanup_network_publication(
     aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication)
 {
-    aeron_driver_sender_proxy_on_remove_publication(conductor->context->sender_proxy, publication);
+    aeron_driver_sender_proxy_on_remove_publication(publication->endpoint->sender_proxy, publication);
 }
 
 void aeron_send_channel_endpoint_entry_on_time_event(
@@ -529,7 +830,7 @@ void aeron_receive_channel_endpoint_entry_delete(
     {
         aeron_publication_image_t *image = conductor->publication_images.array[i].image;
 
-        if (entry->endpoint == image->endpoint)
+        if (entry->endpoint == aeron_receive_channel_endpoint_parent(image->endpoint))
         {
             aeron_publication_image_disconnect_endpoint(image);
         }
@@ -564,26 +865,6 @@ void aeron_publication_image_entry_delete(
     entry->image = NULL;
 }
 
-void aeron_linger_resource_entry_on_time_event(
-    aeron_driver_conductor_t *conductor, aeron_linger_resource_entry_t *entry, int64_t now_ns, int64_t now_ms)
-{
-    if (now_ns > entry->timeout)
-    {
-        entry->has_reached_end_of_life = true;
-    }
-}
-
-bool aeron_linger_resource_entry_has_reached_end_of_life(
-    aeron_driver_conductor_t *conductor, aeron_linger_resource_entry_t *entry)
-{
-    return entry->has_reached_end_of_life;
-}
-
-void aeron_linger_resource_entry_delete(aeron_driver_conductor_t *conductor, aeron_linger_resource_entry_t *entry)
-{
-    aeron_free(entry->buffer);
-}
-
 void aeron_driver_conductor_image_transition_to_linger(
     aeron_driver_conductor_t *conductor, aeron_publication_image_t *image)
 {
@@ -606,7 +887,7 @@ void aeron_driver_conductor_image_transition_to_linger(
         }
 
         aeron_driver_receiver_proxy_on_remove_cooldown(
-            conductor->context->receiver_proxy, image->endpoint, image->session_id, image->stream_id);
+            image->endpoint->receiver_proxy, image->endpoint, image->session_id, image->stream_id);
     }
 }
 
@@ -624,11 +905,213 @@ for (int last_index = (int)l.length - 1, i = last_index; i >= 0; i--) \
     } \
 }
 
+static void aeron_driver_conductor_remove_client(aeron_driver_conductor_t *conductor, size_t index)
+{
+    size_t last_index = conductor->clients.length - 1;
+
+    conductor->clients.delete_func(conductor, &conductor->clients.array[index]);
+    aeron_array_fast_unordered_remove(
+        (uint8_t *)conductor->clients.array, sizeof(aeron_client_t), index, last_index);
+    conductor->clients.length--;
+
+    /* the last client was moved into this slot so its index entry needs updating */
+    if (index < last_index && aeron_driver_conductor_index_client(conductor, index) < 0)
+    {
+        aeron_driver_conductor_error(conductor, ENOMEM, "could not re-index client", aeron_errmsg());
+    }
+}
+
+static bool aeron_driver_conductor_on_client_timer_expiry(
+    void *clientd, int64_t now_ns, int64_t timer_id, int64_t client_id)
+{
+    aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
+    int index = aeron_driver_conductor_find_client(conductor, client_id);
+
+    if (index < 0 || conductor->clients.array[index].timer_id != timer_id)
+    {
+        return true;
+    }
+
+    aeron_client_t *client = &conductor->clients.array[index];
+    const int64_t now_ms = conductor->epoch_clock();
+
+    client->timer_id = AERON_DEADLINE_TIMER_WHEEL_NULL_TIMER_ID;
+    conductor->clients.on_time_event(conductor, client, now_ns, now_ms);
+
+    if (conductor->clients.has_reached_end_of_life(conductor, client))
+    {
+        aeron_driver_conductor_remove_client(conductor, (size_t)index);
+    }
+    else if (aeron_driver_conductor_schedule_client_timer(
+        conductor, client, aeron_client_liveness_deadline_ns(client, now_ns, now_ms) + 1) < 0)
+    {
+        /* keep the expired timer so the client is looked at again on the next poll */
+        client->timer_id = timer_id;
+        return false;
+    }
+
+    return true;
+}
+
+static bool aeron_driver_conductor_on_linger_resource_timer_expiry(
+    void *clientd, int64_t now_ns, int64_t timer_id, int64_t buffer)
+{
+    aeron_free((void *)(intptr_t)buffer);
+    return true;
+}
+
+static void aeron_driver_conductor_free_linger_resource(
+    void *clientd, int64_t deadline_ns, int64_t timer_id, int64_t buffer)
+{
+    aeron_free((void *)(intptr_t)buffer);
+}
+
+static void aeron_driver_conductor_sample_stream_rates(aeron_driver_conductor_t *conductor, int64_t now_ns)
+{
+    aeron_term_length_advisor_t *advisor = &conductor->term_length_advisor;
+
+    for (size_t i = 0, length = conductor->ipc_publications.length; i < length; i++)
+    {
+        aeron_ipc_publication_t *publication = conductor->ipc_publications.array[i].publication;
+        const int64_t position = aeron_ipc_publication_producer_position(publication);
+        const int64_t last_position = publication->conductor_fields.rate_sample_position;
+
+        publication->conductor_fields.rate_sample_position = position;
+        if (last_position >= 0 && position > last_position &&
+            aeron_term_length_advisor_on_bytes_appended(
+                advisor, publication->stream_id, true, position - last_position) < 0)
+        {
+            aeron_driver_conductor_error(conductor, aeron_errcode(), "could not sample stream rate", aeron_errmsg());
+        }
+    }
+
+    for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
+    {
+        aeron_network_publication_t *publication = conductor->network_publications.array[i].publication;
+        const int64_t position = aeron_network_publication_producer_position(publication);
+        const int64_t last_position = publication->conductor_fields.rate_sample_position;
+
+        publication->conductor_fields.rate_sample_position = position;
+        if (last_position >= 0 && position > last_position &&
+            aeron_term_length_advisor_on_bytes_appended(
+                advisor, publication->stream_id, false, position - last_position) < 0)
+        {
+            aeron_driver_conductor_error(conductor, aeron_errcode(), "could not sample stream rate", aeron_errmsg());
+        }
+    }
+
+    aeron_term_length_advisor_on_sample(advisor, now_ns);
+}
+
+static void aeron_driver_conductor_sample_stream_stats(aeron_driver_conductor_t *conductor, int64_t now_ns)
+{
+    for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
+    {
+        aeron_network_publication_t *publication = conductor->network_publications.array[i].publication;
+        const int64_t position = aeron_network_publication_producer_position(publication);
+        const int64_t snd_pos = aeron_counter_get_volatile(publication->snd_pos_position.value_addr);
+
+        aeron_stream_stats_sample(&publication->stats, position, position - snd_pos, now_ns);
+    }
+
+    for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
+    {
+        aeron_publication_image_t *image = conductor->publication_images.array[i].image;
+        const int64_t hwm_position = aeron_counter_get_volatile(image->rcv_hwm_position.value_addr);
+        int64_t min_sub_pos = hwm_position;
+
+        for (size_t j = 0, sub_length = image->conductor_fields.subscribable.length; j < sub_length; j++)
+        {
+            const int64_t sub_pos =
+                aeron_counter_get_volatile(image->conductor_fields.subscribable.array[j].value_addr);
+            min_sub_pos = sub_pos < min_sub_pos ? sub_pos : min_sub_pos;
+        }
+
+        aeron_stream_stats_sample(&image->stats, hwm_position, hwm_position - min_sub_pos, now_ns);
+    }
+}
+
+/*
+ * Term length for a new session of the stream when the channel did not set one, sized to the stream rate when the
+ * driver sizes terms automatically and otherwise the configured length.
+ */
+static size_t aeron_driver_conductor_term_length(
+    aeron_driver_conductor_t *conductor, int32_t stream_id, bool is_ipc, size_t configured_term_length)
+{
+    if (conductor->context->term_buffer_auto_size_target_ns > 0)
+    {
+        return aeron_term_length_advisor_term_length(
+            &conductor->term_length_advisor, stream_id, is_ipc, configured_term_length);
+    }
+
+    return configured_term_length;
+}
+
+static aeron_mapped_raw_log_t *aeron_driver_conductor_swept_log(aeron_driver_conductor_t *conductor, size_t index)
+{
+    if (index < conductor->ipc_publications.length)
+    {
+        return &conductor->ipc_publications.array[index].publication->mapped_raw_log;
+    }
+    index -= conductor->ipc_publications.length;
+
+    if (index < conductor->network_publications.length)
+    {
+        return &conductor->network_publications.array[index].publication->mapped_raw_log;
+    }
+    index -= conductor->network_publications.length;
+
+    if (index < conductor->publication_images.length)
+    {
+        return &conductor->publication_images.array[index].image->mapped_raw_log;
+    }
+
+    return NULL;
+}
+
+/*
+ * Resources come and go between checks so a sweep may count a log twice or miss one, which is fine for a gauge.
+ */
+static void aeron_driver_conductor_sweep_log_residency(aeron_driver_conductor_t *conductor)
+{
+    for (size_t i = 0; i < AERON_DRIVER_CONDUCTOR_RESIDENCY_LOGS_PER_CHECK; i++)
+    {
+        aeron_mapped_raw_log_t *mapped_raw_log =
+            aeron_driver_conductor_swept_log(conductor, conductor->residency_sweep_index);
+
+        if (NULL == mapped_raw_log)
+        {
+            aeron_counter_set_ordered(
+                conductor->log_buffer_resident_bytes_counter, conductor->residency_sweep_length);
+            conductor->residency_sweep_index = 0;
+            conductor->residency_sweep_length = 0;
+            break;
+        }
+
+        conductor->residency_sweep_length += (int64_t)aeron_mapped_buffer_resident_length(
+            mapped_raw_log->mapped_file.addr, mapped_raw_log->mapped_file.length);
+        conductor->residency_sweep_index++;
+    }
+}
+
 void aeron_driver_conductor_on_check_managed_resources(
     aeron_driver_conductor_t *conductor, int64_t now_ns, int64_t now_ms)
 {
-    AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
-        conductor, conductor->clients, aeron_client_t, now_ns, now_ms);
+    if (conductor->context->term_buffer_release_pages)
+    {
+        aeron_driver_conductor_sweep_log_residency(conductor);
+    }
+
+    if (conductor->context->term_buffer_auto_size_target_ns > 0)
+    {
+        aeron_driver_conductor_sample_stream_rates(conductor, now_ns);
+    }
+
+    if (conductor->context->stream_stats)
+    {
+        aeron_driver_conductor_sample_stream_stats(conductor, now_ns);
+    }
+
     AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
         conductor, conductor->ipc_publications, aeron_ipc_publication_entry_t, now_ns, now_ms);
     AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
@@ -639,8 +1122,17 @@ void aeron_driver_conductor_on_check_managed_resources(
         conductor, conductor->receive_channel_endpoints, aeron_receive_channel_endpoint_entry_t, now_ns, now_ms);
     AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
         conductor, conductor->publication_images, aeron_publication_image_entry_t, now_ns, now_ms);
-    AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
-        conductor, conductor->lingering_resources, aeron_linger_resource_entry_t, now_ns, now_ms);
+}
+
+static void aeron_driver_conductor_bind_log_buffer(
+    aeron_driver_conductor_t *conductor, aeron_mapped_raw_log_t *mapped_raw_log, int32_t numa_node)
+{
+    /* the log is still usable wherever its pages landed so a failed bind is reported rather than fatal */
+    if (numa_node >= 0 &&
+        aeron_numa_bind(mapped_raw_log->mapped_file.addr, mapped_raw_log->mapped_file.length, numa_node) < 0)
+    {
+        aeron_driver_conductor_error(conductor, aeron_errcode(), "could not bind log buffer", aeron_errmsg());
+    }
 }
 
 aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
@@ -648,24 +1140,29 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
     aeron_client_t *client,
     int64_t registration_id,
     int32_t stream_id,
-    bool is_exclusive)
+    aeron_uri_publication_params_t *params,
+    bool is_exclusive,
+    int32_t numa_node)
 {
     aeron_ipc_publication_t *publication = NULL;
     int ensure_capacity_result = 0;
 
     if (!is_exclusive)
     {
-        for (size_t i = 0; i < conductor->ipc_publications.length; i++)
-        {
-            aeron_ipc_publication_t *pub_entry = conductor->ipc_publications.array[i].publication;
+        aeron_ipc_publication_t *pub_entry =
+            aeron_int64_to_ptr_hash_map_get(&conductor->shared_ipc_publication_by_stream_id_map, stream_id);
 
-            if (stream_id == pub_entry->stream_id &&
-                !pub_entry->is_exclusive &&
-                pub_entry->conductor_fields.status == AERON_IPC_PUBLICATION_STATUS_ACTIVE)
+        if (NULL != pub_entry && pub_entry->conductor_fields.status == AERON_IPC_PUBLICATION_STATUS_ACTIVE)
+        {
+            if (params->is_durable != (NULL != pub_entry->durable_log))
             {
-                publication = pub_entry;
-                break;
+                aeron_set_err(
+                    EINVAL, "existing publication has clashing %s=%s", AERON_URI_DURABLE_KEY,
+                    NULL != pub_entry->durable_log ? "true" : "false");
+                return NULL;
             }
+
+            publication = pub_entry;
         }
     }
 
@@ -680,8 +1177,10 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
             if (ensure_capacity_result >= 0)
             {
                 int32_t session_id = conductor->next_session_id++;
-                int32_t initial_term_id = aeron_randomised_int32();
+                int32_t initial_term_id = params->is_replay ?
+                    (int32_t)params->initial_term_id : aeron_randomised_int32();
                 aeron_position_t pub_lmt_position;
+                aeron_position_t pub_dur_position = { .counter_id = -1, .value_addr = NULL };
 
                 pub_lmt_position.counter_id =
                     aeron_counter_publisher_limit_allocate(
@@ -689,7 +1188,16 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
                 pub_lmt_position.value_addr =
                     aeron_counter_addr(&conductor->counters_manager, (int32_t)pub_lmt_position.counter_id);
 
+                if (params->is_durable)
+                {
+                    pub_dur_position.counter_id = aeron_counter_publisher_durable_position_allocate(
+                        &conductor->counters_manager, registration_id, session_id, stream_id, AERON_IPC_CHANNEL);
+                    pub_dur_position.value_addr =
+                        aeron_counter_addr(&conductor->counters_manager, (int32_t)pub_dur_position.counter_id);
+                }
+
                 if (pub_lmt_position.counter_id >= 0 &&
+                    (!params->is_durable || pub_dur_position.counter_id >= 0) &&
                     aeron_ipc_publication_create(
                         &publication,
                         conductor->context,
@@ -697,12 +1205,14 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
                         stream_id,
                         registration_id,
                         &pub_lmt_position,
+                        &pub_dur_position,
                         initial_term_id,
-                        conductor->context->ipc_term_buffer_length,
-                        conductor->context->ipc_mtu_length,
+                        params,
                         is_exclusive,
                         &conductor->system_counters) >= 0)
                 {
+                    aeron_driver_conductor_bind_log_buffer(conductor, &publication->mapped_raw_log, numa_node);
+
                     aeron_publication_link_t *link = &client->publication_links.array[client->publication_links.length];
 
                     link->resource = &publication->conductor_fields.managed_resource;
@@ -711,9 +1221,20 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
 
                     conductor->ipc_publications.array[conductor->ipc_publications.length++].publication = publication;
 
+                    if (!is_exclusive && aeron_int64_to_ptr_hash_map_put(
+                        &conductor->shared_ipc_publication_by_stream_id_map, stream_id, publication) < 0)
+                    {
+                        aeron_driver_conductor_error(
+                            conductor, ENOMEM, "could not index IPC publication", aeron_errmsg());
+                    }
+
                     publication->conductor_fields.managed_resource.time_of_last_status_change =
                         conductor->nano_clock();
                 }
+                else if (pub_dur_position.counter_id >= 0)
+                {
+                    aeron_counters_manager_free(&conductor->counters_manager, (int32_t)pub_dur_position.counter_id);
+                }
             }
         }
         else
@@ -737,30 +1258,69 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
     aeron_send_channel_endpoint_t *endpoint,
     int64_t registration_id,
     int32_t stream_id,
-    bool is_exclusive)
+    bool is_exclusive,
+    int32_t numa_node,
+    size_t fec_group_size,
+    int32_t send_priority,
+    int32_t send_weight,
+    bool has_resume_token,
+    int64_t resume_token)
 {
     aeron_network_publication_t *publication = NULL;
     aeron_udp_channel_t *udp_channel = endpoint->conductor_fields.udp_channel;
     const char *channel = udp_channel->original_uri;
     int ensure_capacity_result = 0;
 
-    if (!is_exclusive)
+    if (has_resume_token)
     {
-        for (size_t i = 0; i < conductor->network_publications.length; i++)
+        if (!is_exclusive)
         {
-            aeron_network_publication_t *pub_entry = conductor->network_publications.array[i].publication;
+            aeron_set_err(EINVAL, "%s requires an exclusive publication", AERON_UDP_CHANNEL_RESUME_TOKEN_KEY);
+            return NULL;
+        }
 
-            if (endpoint == pub_entry->endpoint &&
-                stream_id == pub_entry->stream_id &&
-                !pub_entry->is_exclusive &&
-                pub_entry->conductor_fields.status == AERON_NETWORK_PUBLICATION_STATUS_ACTIVE)
+        for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
+        {
+            aeron_network_publication_t *held = conductor->network_publications.array[i].publication;
+
+            if (held->is_resumable && resume_token == held->resume_token)
             {
-                publication = pub_entry;
+                if (AERON_NETWORK_PUBLICATION_STATUS_RESUMABLE != held->conductor_fields.status)
+                {
+                    aeron_set_err(
+                        EINVAL, "%s=%" PRId64 " in use by an active publication",
+                        AERON_UDP_CHANNEL_RESUME_TOKEN_KEY, resume_token);
+                    return NULL;
+                }
+
+                if (endpoint != held->endpoint || stream_id != held->stream_id)
+                {
+                    aeron_set_err(
+                        EINVAL, "%s=%" PRId64 " held for another channel or stream",
+                        AERON_UDP_CHANNEL_RESUME_TOKEN_KEY, resume_token);
+                    return NULL;
+                }
+
+                publication = held;
                 break;
             }
         }
     }
 
+    if (!is_exclusive)
+    {
+        aeron_network_publication_t *pub_entry = aeron_int64_to_ptr_hash_map_get(
+            &conductor->shared_network_publication_by_endpoint_stream_map,
+            aeron_driver_conductor_endpoint_stream_key(endpoint, stream_id));
+
+        if (NULL != pub_entry &&
+            endpoint == pub_entry->endpoint &&
+            pub_entry->conductor_fields.status == AERON_NETWORK_PUBLICATION_STATUS_ACTIVE)
+        {
+            publication = pub_entry;
+        }
+    }
+
     AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, client->publication_links, aeron_publication_link_t);
 
     if (ensure_capacity_result >= 0)
@@ -773,14 +1333,23 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
             {
                 int32_t session_id = conductor->next_session_id++;
                 int32_t initial_term_id = aeron_randomised_int32();
+                size_t term_length = aeron_driver_conductor_term_length(
+                    conductor, stream_id, false, conductor->context->term_buffer_length);
                 aeron_position_t pub_lmt_position;
                 aeron_position_t snd_pos_position;
                 aeron_position_t snd_lmt_position;
-                aeron_flow_control_strategy_supplier_func_t flow_control_strategy_supplier_func =
+                aeron_flow_control_strategy_supplier_func_t flow_control_strategy_supplier_func;
+                aeron_flow_control_strategy_t *flow_control_strategy;
+
+                if (aeron_flow_control_strategy_supplier_for_uri(
+                    &udp_channel->uri,
                     (udp_channel->explicit_control || udp_channel->multicast) ?
                         conductor->context->multicast_flow_control_supplier_func :
-                        conductor->context->unicast_flow_control_supplier_func;
-                aeron_flow_control_strategy_t *flow_control_strategy;
+                        conductor->context->unicast_flow_control_supplier_func,
+                    &flow_control_strategy_supplier_func) < 0)
+                {
+                    return NULL;
+                }
 
                 pub_lmt_position.counter_id =
                     aeron_counter_publisher_limit_allocate(
@@ -812,7 +1381,7 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                     stream_id,
                     registration_id,
                     initial_term_id,
-                    conductor->context->term_buffer_length) < 0)
+                    term_length) < 0)
                 {
                     return NULL;
                 }
@@ -831,13 +1400,40 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                         &snd_pos_position,
                         &snd_lmt_position,
                         flow_control_strategy,
-                        conductor->context->term_buffer_length,
+                        term_length,
+                        fec_group_size,
                         is_exclusive,
                         conductor->context->spies_simulate_connection,
                         &conductor->system_counters) >= 0)
                 {
+                    publication->send_priority = send_priority;
+                    publication->send_weight = send_weight;
+                    publication->is_resumable = has_resume_token;
+                    publication->resume_token = resume_token;
+
+                    if (conductor->context->stream_stats &&
+                        aeron_stream_stats_allocate(
+                            &publication->stats,
+                            &conductor->counters_manager,
+                            false,
+                            registration_id,
+                            session_id,
+                            stream_id,
+                            channel) < 0)
+                    {
+                        aeron_driver_conductor_error(
+                            conductor, aeron_errcode(), "could not allocate stream stats", aeron_errmsg());
+                    }
+
+                    if (numa_node < 0 && conductor->context->numa_bind_log_buffers)
+                    {
+                        numa_node = endpoint->sender_proxy->numa_node;
+                    }
+
+                    aeron_driver_conductor_bind_log_buffer(conductor, &publication->mapped_raw_log, numa_node);
+
                     endpoint->conductor_fields.managed_resource.incref(endpoint->conductor_fields.managed_resource.clientd);
-                    aeron_driver_sender_proxy_on_add_publication(conductor->context->sender_proxy, publication);
+                    aeron_driver_sender_proxy_on_add_publication(endpoint->sender_proxy, publication);
 
                     aeron_publication_link_t *link = &client->publication_links.array[client->publication_links.length];
 
@@ -847,6 +1443,17 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
 
                     conductor->network_publications.array[conductor->network_publications.length++].publication = publication;
 
+                    if (aeron_int64_to_ptr_hash_map_put(
+                        &conductor->network_publication_by_registration_id_map, registration_id, publication) < 0 ||
+                        (!is_exclusive && aeron_int64_to_ptr_hash_map_put(
+                            &conductor->shared_network_publication_by_endpoint_stream_map,
+                            aeron_driver_conductor_endpoint_stream_key(endpoint, stream_id),
+                            publication) < 0))
+                    {
+                        aeron_driver_conductor_error(
+                            conductor, ENOMEM, "could not index network publication", aeron_errmsg());
+                    }
+
                     publication->conductor_fields.managed_resource.time_of_last_status_change =
                         conductor->nano_clock();
                 }
@@ -860,7 +1467,15 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
             link->registration_id = registration_id;
             client->publication_links.length++;
 
-            publication->conductor_fields.managed_resource.incref(publication->conductor_fields.managed_resource.clientd);
+            if (AERON_NETWORK_PUBLICATION_STATUS_RESUMABLE == publication->conductor_fields.status)
+            {
+                aeron_network_publication_resume(publication);
+            }
+            else
+            {
+                publication->conductor_fields.managed_resource.incref(
+                    publication->conductor_fields.managed_resource.clientd);
+            }
         }
     }
 
@@ -870,9 +1485,25 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
 aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_endpoint(
     aeron_driver_conductor_t *conductor, aeron_udp_channel_t *channel)
 {
-    aeron_send_channel_endpoint_t *endpoint =
-        aeron_str_to_ptr_hash_map_get(
-            &conductor->send_channel_endpoint_by_channel_map, channel->canonical_form, channel->canonical_length);
+    aeron_send_channel_endpoint_t *endpoint = NULL;
+
+    if (channel->has_tag &&
+        NULL != (endpoint = aeron_int64_to_ptr_hash_map_get(
+            &conductor->send_channel_endpoint_by_tag_map, channel->tag)))
+    {
+        return aeron_driver_conductor_match_tagged_channel(channel, endpoint->conductor_fields.udp_channel) < 0 ?
+            NULL : endpoint;
+    }
+
+    if (channel->is_tag_reference)
+    {
+        aeron_set_err(
+            EINVAL, "no channel has %s=%" PRId64 ": %s", AERON_URI_TAGS_KEY, channel->tag, channel->original_uri);
+        return NULL;
+    }
+
+    endpoint = aeron_str_to_ptr_hash_map_get(
+        &conductor->send_channel_endpoint_by_channel_map, channel->canonical_form, channel->canonical_length);
 
     if (NULL == endpoint)
     {
@@ -909,22 +1540,44 @@ aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_en
             return NULL;
         }
 
-        aeron_driver_sender_proxy_on_add_endpoint(conductor->context->sender_proxy, endpoint);
+        aeron_driver_sender_proxy_on_add_endpoint(endpoint->sender_proxy, endpoint);
 
         conductor->send_channel_endpoints.array[conductor->send_channel_endpoints.length++].endpoint = endpoint;
 
         *status_indicator.value_addr = AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_ACTIVE;
     }
 
+    if (channel->has_tag && aeron_driver_conductor_tag_endpoint(
+        &conductor->send_channel_endpoint_by_tag_map, channel, endpoint->conductor_fields.udp_channel, endpoint) < 0)
+    {
+        return NULL;
+    }
+
     return endpoint;
 }
 
 aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_channel_endpoint(
     aeron_driver_conductor_t *conductor, aeron_udp_channel_t *channel)
 {
-    aeron_receive_channel_endpoint_t *endpoint =
-        aeron_str_to_ptr_hash_map_get(
-            &conductor->receive_channel_endpoint_by_channel_map, channel->canonical_form, channel->canonical_length);
+    aeron_receive_channel_endpoint_t *endpoint = NULL;
+
+    if (channel->has_tag &&
+        NULL != (endpoint = aeron_int64_to_ptr_hash_map_get(
+            &conductor->receive_channel_endpoint_by_tag_map, channel->tag)))
+    {
+        return aeron_driver_conductor_match_tagged_channel(channel, endpoint->conductor_fields.udp_channel) < 0 ?
+            NULL : endpoint;
+    }
+
+    if (channel->is_tag_reference)
+    {
+        aeron_set_err(
+            EINVAL, "no channel has %s=%" PRId64 ": %s", AERON_URI_TAGS_KEY, channel->tag, channel->original_uri);
+        return NULL;
+    }
+
+    endpoint = aeron_str_to_ptr_hash_map_get(
+        &conductor->receive_channel_endpoint_by_channel_map, channel->canonical_form, channel->canonical_length);
 
     if (NULL == endpoint)
     {
@@ -956,6 +1609,21 @@ aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_chan
             return NULL;
         }
 
+        if (endpoint->drop_monitoring)
+        {
+            endpoint->socket_drops.counter_id =
+                aeron_counter_receive_socket_drops_allocate(&conductor->counters_manager, channel->original_uri);
+
+            if (endpoint->socket_drops.counter_id < 0)
+            {
+                aeron_receive_channel_endpoint_delete(&conductor->counters_manager, endpoint);
+                return NULL;
+            }
+
+            endpoint->socket_drops.value_addr =
+                aeron_counter_addr(&conductor->counters_manager, (int32_t)endpoint->socket_drops.counter_id);
+        }
+
         if (aeron_str_to_ptr_hash_map_put(
             &conductor->receive_channel_endpoint_by_channel_map,
             channel->canonical_form,
@@ -971,6 +1639,12 @@ aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_chan
         *status_indicator.value_addr = AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_ACTIVE;
     }
 
+    if (channel->has_tag && aeron_driver_conductor_tag_endpoint(
+        &conductor->receive_channel_endpoint_by_tag_map, channel, endpoint->conductor_fields.udp_channel, endpoint) < 0)
+    {
+        return NULL;
+    }
+
     return endpoint;
 }
 
@@ -1092,7 +1766,7 @@ void aeron_driver_conductor_on_operation_succeeded(
         conductor, AERON_RESPONSE_ON_OPERATION_SUCCESS, response, sizeof(aeron_operation_succeeded_t));
 }
 
-void aeron_driver_conductor_on_available_image(
+static void aeron_driver_conductor_transmit_available_image(
     aeron_driver_conductor_t *conductor,
     int64_t correlation_id,
     int32_t stream_id,
@@ -1140,6 +1814,128 @@ void aeron_driver_conductor_on_available_image(
         conductor, AERON_RESPONSE_ON_AVAILABLE_IMAGE, response, response_length);
 }
 
+static void aeron_driver_conductor_flush_available_images(aeron_driver_conductor_t *conductor)
+{
+    struct aeron_driver_conductor_available_images_stct *batch = &conductor->available_images;
+
+    if (1 == batch->length)
+    {
+        aeron_driver_conductor_transmit_available_image(
+            conductor,
+            batch->correlation_id,
+            batch->stream_id,
+            batch->session_id,
+            batch->log_file_name,
+            batch->log_file_name_length,
+            batch->subscribers[0].subscriber_position_id,
+            batch->subscribers[0].subscriber_registration_id,
+            batch->source_identity,
+            batch->source_identity_length);
+    }
+    else if (batch->length > 1)
+    {
+        char response_buffer[
+            sizeof(aeron_image_buffers_ready_batch_t) +
+            sizeof(batch->subscribers) +
+            (2 * (sizeof(int32_t) + AERON_MAX_PATH))];
+        aeron_image_buffers_ready_batch_t *response = (aeron_image_buffers_ready_batch_t *)response_buffer;
+        char *ptr = response_buffer + sizeof(aeron_image_buffers_ready_batch_t);
+        const size_t subscribers_length = batch->length * sizeof(aeron_image_buffers_ready_subscriber_t);
+        int32_t length_field;
+
+        response->correlation_id = batch->correlation_id;
+        response->session_id = batch->session_id;
+        response->stream_id = batch->stream_id;
+        response->subscriber_count = (int32_t)batch->length;
+        memcpy(ptr, batch->subscribers, subscribers_length);
+        ptr += subscribers_length;
+
+        length_field = (int32_t)batch->log_file_name_length;
+        memcpy(ptr, &length_field, sizeof(length_field));
+        ptr += sizeof(int32_t);
+        memcpy(ptr, batch->log_file_name, batch->log_file_name_length);
+        ptr += batch->log_file_name_length;
+
+        length_field = (int32_t)batch->source_identity_length;
+        memcpy(ptr, &length_field, sizeof(length_field));
+        ptr += sizeof(int32_t);
+        memcpy(ptr, batch->source_identity, batch->source_identity_length);
+        ptr += batch->source_identity_length;
+
+        aeron_driver_conductor_client_transmit(
+            conductor, AERON_RESPONSE_ON_AVAILABLE_IMAGES, response, (size_t)(ptr - response_buffer));
+    }
+
+    batch->length = 0;
+}
+
+/*
+ * Between begin and end the image ready notices for links to one image are gathered and sent as batches, so an image
+ * joining many subscriptions takes one message in the to-clients buffer rather than one per subscription.
+ */
+static void aeron_driver_conductor_begin_available_images(aeron_driver_conductor_t *conductor)
+{
+    conductor->available_images.is_batching = conductor->context->available_image_batching;
+    conductor->available_images.length = 0;
+}
+
+static void aeron_driver_conductor_end_available_images(aeron_driver_conductor_t *conductor)
+{
+    aeron_driver_conductor_flush_available_images(conductor);
+    conductor->available_images.is_batching = false;
+}
+
+void aeron_driver_conductor_on_available_image(
+    aeron_driver_conductor_t *conductor,
+    int64_t correlation_id,
+    int32_t stream_id,
+    int32_t session_id,
+    const char *log_file_name,
+    size_t log_file_name_length,
+    int32_t subscriber_position_id,
+    int64_t subscriber_registration_id,
+    const char *source_identity,
+    size_t source_identity_length)
+{
+    struct aeron_driver_conductor_available_images_stct *batch = &conductor->available_images;
+
+    if (!batch->is_batching)
+    {
+        aeron_driver_conductor_transmit_available_image(
+            conductor,
+            correlation_id,
+            stream_id,
+            session_id,
+            log_file_name,
+            log_file_name_length,
+            subscriber_position_id,
+            subscriber_registration_id,
+            source_identity,
+            source_identity_length);
+        return;
+    }
+
+    if (batch->length > 0 && correlation_id != batch->correlation_id)
+    {
+        aeron_driver_conductor_flush_available_images(conductor);
+    }
+
+    batch->correlation_id = correlation_id;
+    batch->session_id = session_id;
+    batch->stream_id = stream_id;
+    batch->log_file_name = log_file_name;
+    batch->log_file_name_length = log_file_name_length;
+    batch->source_identity = source_identity;
+    batch->source_identity_length = source_identity_length;
+    batch->subscribers[batch->length].subscriber_registration_id = subscriber_registration_id;
+    batch->subscribers[batch->length].subscriber_position_id = subscriber_position_id;
+
+    if (++batch->length == AERON_DRIVER_CONDUCTOR_AVAILABLE_IMAGES_BATCH_LIMIT)
+    {
+        aeron_driver_conductor_flush_available_images(conductor);
+    }
+}
+
 void aeron_driver_conductor_on_unavailable_image(
     aeron_driver_conductor_t *conductor,
     int64_t correlation_id,
@@ -1169,14 +1965,76 @@ void aeron_driver_conductor_error(
     aeron_set_err(0, "%s", "no error"); /* reset error */
 }
 
-void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message, size_t length, void *clientd)
+/*
+ * Hold back a command adding a UDP channel which is not in the channel cache until the name resolver has resolved the
+ * channel, rather than resolving it here while the commands of other clients wait. Commands on a channel already
+ * being resolved wait on the same resolution. Returns false to handle the command now, as when resolving is off.
+ */
+static bool aeron_driver_conductor_defer_command(
+    aeron_driver_conductor_t *conductor,
+    int32_t msg_type_id,
+    const void *message,
+    size_t length,
+    size_t uri_offset,
+    size_t uri_length)
+{
+    aeron_name_resolver_t *resolver = conductor->context->name_resolver;
+    const char *uri = (const char *)message + uri_offset;
+    bool is_resolving = false;
+    int ensure_capacity_result = 0;
+
+    if (NULL == resolver ||
+        conductor->deferred_commands.length >= AERON_DRIVER_CONDUCTOR_MAX_DEFERRED_COMMANDS ||
+        aeron_udp_channel_cache_contains(&conductor->udp_channel_cache, uri, uri_length, conductor->nano_clock()))
+    {
+        return false;
+    }
+
+    for (size_t i = 0, size = conductor->deferred_commands.length; i < size; i++)
+    {
+        aeron_deferred_command_t *deferred = &conductor->deferred_commands.array[i];
+
+        if (deferred->uri_length == uri_length && strncmp(deferred->uri, uri, uri_length) == 0)
+        {
+            is_resolving = true;
+            break;
+        }
+    }
+
+    if (!is_resolving && aeron_name_resolver_resolve(resolver, uri, uri_length) < 0)
+    {
+        return false;
+    }
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->deferred_commands, aeron_deferred_command_t);
+    if (ensure_capacity_result < 0)
+    {
+        return false;
+    }
+
+    aeron_deferred_command_t *deferred = &conductor->deferred_commands.array[conductor->deferred_commands.length];
+
+    if (aeron_alloc((void **)&deferred->message, length) < 0)
+    {
+        return false;
+    }
+
+    memcpy(deferred->message, message, length);
+    deferred->length = length;
+    deferred->uri = (const char *)deferred->message + uri_offset;
+    deferred->uri_length = uri_length;
+    deferred->msg_type_id = msg_type_id;
+    conductor->deferred_commands.length++;
+
+    return true;
+}
+
+static void aeron_driver_conductor_handle_command(
+    aeron_driver_conductor_t *conductor, int32_t msg_type_id, const void *message, size_t length, bool is_deferrable)
 {
-    aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
     int64_t correlation_id = 0;
     int result = 0;
 
-    conductor->context->to_driver_interceptor_func(msg_type_id, message, length, clientd);
-
     char error_message[AERON_MAX_PATH] = "\0";
     char *error_description = "generic error";
 
@@ -1198,6 +2056,16 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             {
                 result = aeron_driver_conductor_on_add_ipc_publication(conductor, command, false);
             }
+            else if (is_deferrable && aeron_driver_conductor_defer_command(
+                conductor,
+                msg_type_id,
+                message,
+                length,
+                sizeof(aeron_publication_command_t),
+                (size_t)command->channel_length))
+            {
+                /* completed once the name resolver has resolved the channel */
+            }
             else
             {
                 result = aeron_driver_conductor_on_add_network_publication(conductor, command, false);
@@ -1221,6 +2089,16 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             {
                 result = aeron_driver_conductor_on_add_ipc_publication(conductor, command, true);
             }
+            else if (is_deferrable && aeron_driver_conductor_defer_command(
+                conductor,
+                msg_type_id,
+                message,
+                length,
+                sizeof(aeron_publication_command_t),
+                (size_t)command->channel_length))
+            {
+                /* completed once the name resolver has resolved the channel */
+            }
             else
             {
                 result = aeron_driver_conductor_on_add_network_publication(conductor, command, true);
@@ -1262,7 +2140,26 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
             else if (strncmp(channel, AERON_SPY_PREFIX, AERON_IPC_CHANNEL_LEN) == 0)
             {
-                result = aeron_driver_conductor_on_add_spy_subscription(conductor, command);
+                if (!is_deferrable || !aeron_driver_conductor_defer_command(
+                    conductor,
+                    msg_type_id,
+                    message,
+                    length,
+                    sizeof(aeron_subscription_command_t) + strlen(AERON_SPY_PREFIX),
+                    (size_t)command->channel_length - strlen(AERON_SPY_PREFIX)))
+                {
+                    result = aeron_driver_conductor_on_add_spy_subscription(conductor, command);
+                }
+            }
+            else if (is_deferrable && aeron_driver_conductor_defer_command(
+                conductor,
+                msg_type_id,
+                message,
+                length,
+                sizeof(aeron_subscription_command_t),
+                (size_t)command->channel_length))
+            {
+                /* completed once the name resolver has resolved the channel */
             }
             else
             {
@@ -1400,6 +2297,158 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
         return;
 }
 
+void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message, size_t length, void *clientd)
+{
+    aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
+
+    conductor->context->to_driver_interceptor_func(msg_type_id, message, length, clientd);
+
+    AERON_PROBE2(conductor_command_begin, msg_type_id, length);
+    aeron_driver_conductor_handle_command(conductor, msg_type_id, message, length, true);
+    AERON_PROBE2(conductor_command_end, msg_type_id, length);
+}
+
+static void aeron_driver_conductor_on_name_resolved(void *clientd, aeron_name_resolver_request_t *request)
+{
+    aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
+    size_t remaining = 0;
+
+    aeron_udp_channel_cache_put(
+        &conductor->udp_channel_cache,
+        request->uri,
+        request->uri_length,
+        conductor->nano_clock(),
+        request->channel,
+        request->errcode,
+        request->errmsg);
+
+    for (size_t i = 0, size = conductor->deferred_commands.length; i < size; i++)
+    {
+        aeron_deferred_command_t deferred = conductor->deferred_commands.array[i];
+
+        if (deferred.uri_length == request->uri_length && strncmp(deferred.uri, request->uri, deferred.uri_length) == 0)
+        {
+            aeron_driver_conductor_handle_command(
+                conductor, deferred.msg_type_id, deferred.message, deferred.length, false);
+            aeron_free(deferred.message);
+        }
+        else
+        {
+            conductor->deferred_commands.array[remaining++] = deferred;
+        }
+    }
+
+    conductor->deferred_commands.length = remaining;
+}
+
+typedef struct aeron_driver_conductor_backlog_record_stct
+{
+    int64_t time_ns;
+    int32_t msg_type_id;
+    int32_t length;
+}
+aeron_driver_conductor_backlog_record_t;
+
+/*
+ * Keepalives are cheap and keep clients alive, so they are handled as soon as they are read. Other commands, which
+ * may map files or open sockets, are handled up to the budget of the duty cycle and the rest wait in the backlog in
+ * the order they were read, as a remove or close must follow the add before it.
+ */
+static void aeron_driver_conductor_dispatch_command(
+    aeron_driver_conductor_t *conductor, int32_t msg_type_id, const uint8_t *message, size_t length)
+{
+    if (AERON_COMMAND_CLIENT_KEEPALIVE == msg_type_id ||
+        (0 == conductor->command_backlog.count && conductor->command_backlog.budget > 0))
+    {
+        if (AERON_COMMAND_CLIENT_KEEPALIVE != msg_type_id)
+        {
+            conductor->command_backlog.budget--;
+        }
+
+        aeron_driver_conductor_on_command(msg_type_id, message, length, conductor);
+        return;
+    }
+
+    uint8_t *tail = conductor->command_backlog.buffer + conductor->command_backlog.tail;
+    aeron_driver_conductor_backlog_record_t *record = (aeron_driver_conductor_backlog_record_t *)tail;
+
+    record->time_ns = conductor->nano_clock();
+    record->msg_type_id = msg_type_id;
+    record->length = (int32_t)length;
+    memcpy(tail + sizeof(aeron_driver_conductor_backlog_record_t), message, length);
+
+    conductor->command_backlog.tail +=
+        AERON_ALIGN(sizeof(aeron_driver_conductor_backlog_record_t) + length, AERON_RB_ALIGNMENT);
+    conductor->command_backlog.count++;
+}
+
+static int aeron_driver_conductor_drain_command_backlog(aeron_driver_conductor_t *conductor, int64_t now_ns)
+{
+    int work_count = 0;
+
+    while (conductor->command_backlog.count > 0 && conductor->command_backlog.budget > 0)
+    {
+        uint8_t *head = conductor->command_backlog.buffer + conductor->command_backlog.head;
+        aeron_driver_conductor_backlog_record_t *record = (aeron_driver_conductor_backlog_record_t *)head;
+        const size_t length = (size_t)record->length;
+
+        aeron_counter_propose_max_ordered(conductor->command_max_wait_ns_counter, now_ns - record->time_ns);
+
+        conductor->command_backlog.head +=
+            AERON_ALIGN(sizeof(aeron_driver_conductor_backlog_record_t) + length, AERON_RB_ALIGNMENT);
+        conductor->command_backlog.count--;
+        conductor->command_backlog.budget--;
+
+        aeron_driver_conductor_on_command(
+            record->msg_type_id, head + sizeof(aeron_driver_conductor_backlog_record_t), length, conductor);
+        work_count++;
+    }
+
+    if (0 == conductor->command_backlog.count)
+    {
+        conductor->command_backlog.head = 0;
+        conductor->command_backlog.tail = 0;
+    }
+    else if (conductor->command_backlog.head >= conductor->command_backlog.capacity / 2)
+    {
+        memmove(
+            conductor->command_backlog.buffer,
+            conductor->command_backlog.buffer + conductor->command_backlog.head,
+            conductor->command_backlog.tail - conductor->command_backlog.head);
+        conductor->command_backlog.tail -= conductor->command_backlog.head;
+        conductor->command_backlog.head = 0;
+    }
+
+    return work_count;
+}
+
+/*
+ * Commands are consumed from the to-driver ring as a contiguous block so a batch of commands, e.g. those written with
+ * a single claim by a client re-adding its resources, costs one head update and one zeroing of the ring.
+ */
+static void aeron_driver_conductor_on_command_block(const uint8_t *buffer, size_t length, void *clientd)
+{
+    aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
+    size_t offset = 0;
+
+    while (offset < length)
+    {
+        const aeron_rb_record_descriptor_t *record = (const aeron_rb_record_descriptor_t *)(buffer + offset);
+        const size_t record_length = (size_t)record->length;
+
+        if (AERON_RB_PADDING_MSG_TYPE_ID != record->msg_type_id)
+        {
+            aeron_driver_conductor_dispatch_command(
+                conductor,
+                record->msg_type_id,
+                buffer + AERON_RB_MESSAGE_OFFSET(offset),
+                record_length - AERON_RB_RECORD_HEADER_LENGTH);
+        }
+
+        offset += AERON_ALIGN(record_length, AERON_RB_ALIGNMENT);
+    }
+}
+
 void aeron_driver_conductor_on_command_queue(void *clientd, volatile void *item)
 {
     aeron_command_base_t *cmd = (aeron_command_base_t *)item;
@@ -1429,18 +2478,100 @@ void aeron_driver_conductor_on_check_for_blocked_driver_commands(aeron_driver_co
     }
 }
 
+/*
+ * Flag each stream that has had data added since the last duty cycle, so a burst of many frames on a stream is one
+ * entry. Images are flagged as their rebuild position moves on, which is only once frames are in the log without gaps.
+ */
+static int aeron_driver_conductor_track_stream_activity(aeron_driver_conductor_t *conductor)
+{
+    aeron_stream_activity_t *activity = &conductor->stream_activity;
+    int work_count = 0;
+
+    for (size_t i = 0, length = conductor->ipc_publications.length; i < length; i++)
+    {
+        aeron_ipc_publication_t *publication = conductor->ipc_publications.array[i].publication;
+
+        work_count += aeron_stream_activity_track(
+            activity,
+            publication->conductor_fields.managed_resource.registration_id,
+            aeron_ipc_publication_producer_position(publication),
+            &publication->conductor_fields.activity_position) ? 1 : 0;
+    }
+
+    for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
+    {
+        aeron_network_publication_t *publication = conductor->network_publications.array[i].publication;
+
+        if (publication->conductor_fields.has_spies)
+        {
+            work_count += aeron_stream_activity_track(
+                activity,
+                publication->conductor_fields.managed_resource.registration_id,
+                aeron_network_publication_producer_position(publication),
+                &publication->conductor_fields.activity_position) ? 1 : 0;
+        }
+    }
+
+    for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
+    {
+        aeron_publication_image_t *image = conductor->publication_images.array[i].image;
+
+        work_count += aeron_stream_activity_track(
+            activity,
+            image->conductor_fields.managed_resource.registration_id,
+            aeron_counter_get_volatile(image->rcv_pos_position.value_addr),
+            &image->conductor_fields.activity_position) ? 1 : 0;
+    }
+
+    return work_count;
+}
+
 int aeron_driver_conductor_do_work(void *clientd)
 {
     aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
     int work_count = 0;
     int64_t now_ns = conductor->nano_clock();
 
-    work_count +=
-        (int)aeron_mpsc_rb_read(&conductor->to_driver_commands, aeron_driver_conductor_on_command, conductor, 10);
+    conductor->command_backlog.budget = AERON_DRIVER_CONDUCTOR_COMMAND_BUDGET;
+    work_count += aeron_driver_conductor_drain_command_backlog(conductor, now_ns);
+
+    /* a backlog record takes at most twice the ring bytes of its command, so only read what the backlog can hold */
+    size_t backlog_available = conductor->command_backlog.capacity - conductor->command_backlog.tail;
+    size_t read_length_limit = backlog_available / 2;
+    if (read_length_limit > AERON_DRIVER_CONDUCTOR_COMMAND_BLOCK_LENGTH_LIMIT)
+    {
+        read_length_limit = AERON_DRIVER_CONDUCTOR_COMMAND_BLOCK_LENGTH_LIMIT;
+    }
+
+    work_count += aeron_mpsc_rb_read_block(
+        &conductor->to_driver_commands,
+        aeron_driver_conductor_on_command_block,
+        conductor,
+        read_length_limit) > 0 ? 1 : 0;
+    aeron_counter_set_ordered(conductor->commands_waiting_counter, (int64_t)conductor->command_backlog.count);
     work_count +=
         aeron_mpsc_concurrent_array_queue_drain(
             conductor->conductor_proxy.command_queue, aeron_driver_conductor_on_command_queue, conductor, 10);
 
+    if (NULL != conductor->context->name_resolver)
+    {
+        work_count += aeron_name_resolver_poll(
+            conductor->context->name_resolver, aeron_driver_conductor_on_name_resolved, conductor, 10);
+    }
+
+    work_count += aeron_deadline_timer_wheel_poll(
+        &conductor->client_timer_wheel,
+        now_ns,
+        aeron_driver_conductor_on_client_timer_expiry,
+        conductor,
+        AERON_DRIVER_CONDUCTOR_TIMER_EXPIRY_LIMIT);
+    work_count += aeron_deadline_timer_wheel_poll(
+        &conductor->linger_resource_timer_wheel,
+        now_ns,
+        aeron_driver_conductor_on_linger_resource_timer_expiry,
+        conductor,
+        AERON_DRIVER_CONDUCTOR_TIMER_EXPIRY_LIMIT);
+
     if (now_ns > (conductor->time_of_last_timeout_check_ns + (int64_t)conductor->context->timer_interval_ns))
     {
         int64_t now_ms = conductor->epoch_clock();
@@ -1464,10 +2595,15 @@ int aeron_driver_conductor_do_work(void *clientd)
 
     for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
     {
-        aeron_publication_image_track_rebuild(
+        work_count += aeron_publication_image_track_rebuild(
             conductor->publication_images.array[i].image, now_ns, conductor->context->status_message_timeout_ns);
     }
 
+    if (NULL != conductor->stream_activity.header)
+    {
+        work_count += aeron_driver_conductor_track_stream_activity(conductor);
+    }
+
     return work_count;
 }
 
@@ -1494,6 +2630,13 @@ void aeron_driver_conductor_on_close(void *clientd)
     }
     aeron_free(conductor->network_publications.array);
 
+    for (size_t i = 0, length = conductor->deferred_commands.length; i < length; i++)
+    {
+        aeron_free(conductor->deferred_commands.array[i].message);
+    }
+    aeron_free(conductor->deferred_commands.array);
+    aeron_free(conductor->command_backlog.buffer);
+
     for (size_t i = 0, length = conductor->ipc_subscriptions.length; i < length; i++)
     {
         aeron_free(conductor->ipc_subscriptions.array[i].subscribable_list.array);
@@ -1533,12 +2676,26 @@ void aeron_driver_conductor_on_close(void *clientd)
     }
     aeron_free(conductor->publication_images.array);
 
+    aeron_deadline_timer_wheel_for_each(
+        &conductor->linger_resource_timer_wheel, aeron_driver_conductor_free_linger_resource, conductor);
+    aeron_deadline_timer_wheel_close(&conductor->linger_resource_timer_wheel);
+    aeron_deadline_timer_wheel_close(&conductor->client_timer_wheel);
+    aeron_term_length_advisor_close(&conductor->term_length_advisor);
+
     aeron_system_counters_close(&conductor->system_counters);
     aeron_counters_manager_close(&conductor->counters_manager);
     aeron_distinct_error_log_close(&conductor->error_log);
 
     aeron_str_to_ptr_hash_map_delete(&conductor->send_channel_endpoint_by_channel_map);
     aeron_str_to_ptr_hash_map_delete(&conductor->receive_channel_endpoint_by_channel_map);
+    aeron_udp_channel_cache_close(&conductor->udp_channel_cache);
+    aeron_driver_command_pool_close(&conductor->conductor_proxy.command_pool);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->client_index_by_id_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->shared_ipc_publication_by_stream_id_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->shared_network_publication_by_endpoint_stream_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->network_publication_by_registration_id_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->send_channel_endpoint_by_tag_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->receive_channel_endpoint_by_tag_map);
 }
 
 int aeron_driver_subscribable_add_position(
@@ -1555,6 +2712,7 @@ int aeron_driver_subscribable_add_position(
         entry->value_addr = value_addr;
         subscribable->add_position_hook_func(subscribable->clientd, value_addr);
         subscribable->length++;
+        subscribable->min_position_addr = NULL;
         result = 0;
     }
 
@@ -1571,11 +2729,21 @@ void aeron_driver_subscribable_remove_position(aeron_subscribable_t *subscribabl
             aeron_array_fast_unordered_remove(
                 (uint8_t *)subscribable->array, sizeof(aeron_position_t), i, last_index);
             subscribable->length--;
+            subscribable->min_position_addr = NULL;
             break;
         }
     }
 }
 
+extern int64_t aeron_driver_unblock_timeout_ns(
+    int64_t now_ns,
+    int64_t unblock_timeout_ns,
+    int64_t unblock_timeout_min_ns,
+    int64_t longest_stall_ns,
+    int64_t fast_unblock_deadline_ns);
+extern void aeron_driver_subscribable_track_min_position(
+    aeron_subscribable_t *subscribable, int64_t *value_addr, int64_t min_position);
+extern bool aeron_driver_subscribable_is_min_position_settled(aeron_subscribable_t *subscribable, int64_t threshold);
 extern void aeron_driver_subscribable_null_hook(void *clientd, int64_t *value_addr);
 
 int aeron_driver_conductor_link_subscribable(
@@ -1640,6 +2808,20 @@ int aeron_driver_conductor_link_subscribable(
     return result;
 }
 
+int aeron_driver_conductor_track_non_blocking_spy(
+    aeron_subscription_link_t *link, aeron_network_publication_t *publication)
+{
+    if (link->is_blocking_spy)
+    {
+        return 0;
+    }
+
+    aeron_subscribable_t *subscribable = &publication->conductor_fields.subscribable;
+
+    return aeron_network_publication_add_non_blocking_spy(
+        publication, subscribable->array[subscribable->length - 1].value_addr);
+}
+
 void aeron_driver_conductor_unlink_subscribable(aeron_subscription_link_t *link, aeron_subscribable_t *subscribable)
 {
     for (int last_index = link->subscribable_list.length - 1, i = last_index; i >= 0; i--)
@@ -1670,9 +2852,6 @@ void aeron_driver_conductor_unlink_all_subscribable(
     link->subscribable_list.capacity = 0;
 }
 
-/* TODO: add replay params from URIs */
-/* TODO: add params from URIs */
-
 int aeron_driver_conductor_on_add_ipc_publication(
     aeron_driver_conductor_t *conductor,
     aeron_publication_command_t *command,
@@ -1680,10 +2859,49 @@ int aeron_driver_conductor_on_add_ipc_publication(
 {
     aeron_client_t *client = NULL;
     aeron_ipc_publication_t *publication = NULL;
+    const char *uri = (const char *)command + sizeof(aeron_publication_command_t);
+    char uri_buffer[AERON_MAX_PATH];
+    aeron_uri_t uri_params;
+    aeron_uri_publication_params_t params;
+    int32_t numa_node = -1;
+
+    snprintf(uri_buffer, sizeof(uri_buffer), "%.*s", (int)command->channel_length, uri);
+
+    if (aeron_uri_parse(uri_buffer, &uri_params) < 0)
+    {
+        return -1;
+    }
+
+    int params_result = aeron_uri_numa_node(&uri_params, &numa_node) < 0 ||
+        aeron_uri_publication_params(&uri_params, &params, conductor->context, is_exclusive) < 0 ? -1 : 0;
+    aeron_uri_close(&uri_params);
+
+    if (params_result < 0)
+    {
+        return -1;
+    }
+
+    if (params.is_durable && NULL == conductor->context->durable_log_syncer)
+    {
+        aeron_set_err(EINVAL, "%s=true needs %s to be set", AERON_URI_DURABLE_KEY, AERON_DURABLE_DIR_ENV_VAR);
+        return -1;
+    }
+
+    if (!params.has_term_length && !params.is_replay)
+    {
+        params.term_length = aeron_driver_conductor_term_length(
+            conductor, command->stream_id, true, params.term_length);
+    }
 
     if ((client = aeron_driver_conductor_get_or_add_client(conductor, command->correlated.client_id)) == NULL ||
         (publication = aeron_driver_conductor_get_or_add_ipc_publication(
-            conductor, client, command->correlated.correlation_id, command->stream_id, is_exclusive)) == NULL)
+            conductor,
+            client,
+            command->correlated.correlation_id,
+            command->stream_id,
+            &params,
+            is_exclusive,
+            numa_node)) == NULL)
     {
         return -1;
     }
@@ -1702,6 +2920,8 @@ int aeron_driver_conductor_on_add_ipc_publication(
         publication->log_file_name,
         publication->log_file_name_length);
 
+    aeron_driver_conductor_begin_available_images(conductor);
+
     for (size_t i = 0; i < conductor->ipc_subscriptions.length; i++)
     {
         aeron_subscription_link_t *subscription_link = &conductor->ipc_subscriptions.array[i];
@@ -1723,11 +2943,14 @@ int aeron_driver_conductor_on_add_ipc_publication(
                 publication->log_file_name,
                 publication->log_file_name_length) < 0)
             {
+                aeron_driver_conductor_end_available_images(conductor);
                 return -1;
             }
         }
     }
 
+    aeron_driver_conductor_end_available_images(conductor);
+
     return 0;
 }
 
@@ -1742,11 +2965,30 @@ int aeron_driver_conductor_on_add_network_publication(
     aeron_network_publication_t *publication = NULL;
     const char *uri = (const char *)command + sizeof(aeron_publication_command_t);
 
-    if (aeron_udp_channel_parse(uri, (size_t)command->channel_length, &udp_channel) < 0)
+    int32_t numa_node = -1;
+    size_t fec_group_size = 0;
+    int32_t send_priority = 0;
+    int32_t send_weight = 1;
+    bool has_resume_token = false;
+    int64_t resume_token = 0;
+    bool is_durable = false;
+
+    if (aeron_udp_channel_cache_parse(
+        &conductor->udp_channel_cache, uri, (size_t)command->channel_length, conductor->nano_clock(), &udp_channel) < 0)
     {
         return -1;
     }
 
+    if (aeron_uri_numa_node(&udp_channel->uri, &numa_node) < 0 ||
+        aeron_uri_fec_group_size(&udp_channel->uri, &fec_group_size) < 0 ||
+        aeron_uri_send_schedule(&udp_channel->uri, &send_priority, &send_weight) < 0 ||
+        aeron_uri_resume_token(&udp_channel->uri, &has_resume_token, &resume_token) < 0 ||
+        aeron_uri_durable(&udp_channel->uri, &is_durable) < 0)
+    {
+        aeron_udp_channel_delete(udp_channel);
+        return -1;
+    }
+
     if ((client = aeron_driver_conductor_get_or_add_client(conductor, command->correlated.client_id)) == NULL)
     {
         return -1;
@@ -1764,7 +3006,18 @@ int aeron_driver_conductor_on_add_network_publication(
     }
 
     if ((publication = aeron_driver_conductor_get_or_add_network_publication(
-        conductor, client, endpoint, command->correlated.correlation_id, command->stream_id, is_exclusive)) == NULL)
+        conductor,
+        client,
+        endpoint,
+        command->correlated.correlation_id,
+        command->stream_id,
+        is_exclusive,
+        numa_node,
+        fec_group_size,
+        send_priority,
+        send_weight,
+        has_resume_token,
+        resume_token)) == NULL)
     {
         return -1;
     }
@@ -1783,6 +3036,8 @@ int aeron_driver_conductor_on_add_network_publication(
         publication->log_file_name,
         publication->log_file_name_length);
 
+    aeron_driver_conductor_begin_available_images(conductor);
+
     for (size_t i = 0; i < conductor->spy_subscriptions.length; i++)
     {
         aeron_subscription_link_t *subscription_link = &conductor->spy_subscriptions.array[i];
@@ -1807,11 +3062,20 @@ int aeron_driver_conductor_on_add_network_publication(
                 publication->log_file_name,
                 publication->log_file_name_length) < 0)
             {
+                aeron_driver_conductor_end_available_images(conductor);
+                return -1;
+            }
+
+            if (aeron_driver_conductor_track_non_blocking_spy(subscription_link, publication) < 0)
+            {
+                aeron_driver_conductor_end_available_images(conductor);
                 return -1;
             }
         }
     }
 
+    aeron_driver_conductor_end_available_images(conductor);
+
     if (endpoint->conductor_fields.udp_channel != udp_channel)
     {
         aeron_udp_channel_delete(udp_channel);
@@ -1875,7 +3139,10 @@ int aeron_driver_conductor_on_add_ipc_subscription(
 
         link->endpoint = NULL;
         link->spy_channel = NULL;
+        link->is_blocking_spy = true;
+        link->is_reliable = true;
         link->stream_id = command->stream_id;
+        link->stream_id_high = command->stream_id;
         link->client_id = command->correlated.client_id;
         link->registration_id = command->correlated.correlation_id;
         link->subscribable_list.length = 0;
@@ -1925,18 +3192,48 @@ int aeron_driver_conductor_on_add_spy_subscription(
     aeron_udp_channel_t *udp_channel = NULL;
     aeron_send_channel_endpoint_t *endpoint = NULL;
     const char *uri = (const char *)command + sizeof(aeron_subscription_command_t) + strlen(AERON_SPY_PREFIX);
+    aeron_udp_channel_subscription_params_t params;
     int ensure_capacity_result = 0;
 
-    if (aeron_udp_channel_parse(uri, (size_t)command->channel_length - strlen(AERON_SPY_PREFIX), &udp_channel) < 0)
+    if (aeron_udp_channel_cache_parse(
+        &conductor->udp_channel_cache,
+        uri,
+        (size_t)command->channel_length - strlen(AERON_SPY_PREFIX),
+        conductor->nano_clock(),
+        &udp_channel) < 0)
     {
         return -1;
     }
 
+    if (aeron_udp_channel_subscription_params(&udp_channel->uri, &params, conductor->context) < 0)
+    {
+        aeron_udp_channel_delete(udp_channel);
+        return -1;
+    }
+
     if ((client = aeron_driver_conductor_get_or_add_client(conductor, command->correlated.client_id)) == NULL)
     {
         return -1;
     }
 
+    if (udp_channel->is_tag_reference)
+    {
+        if ((endpoint = aeron_int64_to_ptr_hash_map_get(
+            &conductor->send_channel_endpoint_by_tag_map, udp_channel->tag)) == NULL)
+        {
+            aeron_set_err(
+                EINVAL,
+                "no channel has %s=%" PRId64 ": %s",
+                AERON_URI_TAGS_KEY,
+                udp_channel->tag,
+                udp_channel->original_uri);
+            aeron_udp_channel_delete(udp_channel);
+            return -1;
+        }
+
+        aeron_udp_channel_adopt_addresses(udp_channel, endpoint->conductor_fields.udp_channel);
+    }
+
     endpoint = aeron_str_to_ptr_hash_map_get(
             &conductor->send_channel_endpoint_by_channel_map, udp_channel->canonical_form, udp_channel->canonical_length);
 
@@ -1947,7 +3244,10 @@ int aeron_driver_conductor_on_add_spy_subscription(
 
         link->endpoint = NULL;
         link->spy_channel = udp_channel;
+        link->is_blocking_spy = params.is_blocking_spy;
+        link->is_reliable = true;
         link->stream_id = command->stream_id;
+        link->stream_id_high = command->stream_id;
         link->client_id = command->correlated.client_id;
         link->registration_id = command->correlated.correlation_id;
         link->subscribable_list.length = 0;
@@ -1979,6 +3279,11 @@ int aeron_driver_conductor_on_add_spy_subscription(
                 {
                     return -1;
                 }
+
+                if (aeron_driver_conductor_track_non_blocking_spy(link, publication) < 0)
+                {
+                    return -1;
+                }
             }
         }
 
@@ -1996,10 +3301,20 @@ int aeron_driver_conductor_on_add_network_subscription(
     aeron_udp_channel_t *udp_channel = NULL;
     aeron_receive_channel_endpoint_t *endpoint = NULL;
     const char *uri = (const char *)command + sizeof(aeron_subscription_command_t);
+    aeron_udp_channel_subscription_params_t params;
     int ensure_capacity_result = 0;
+    int32_t stream_id_low, stream_id_high;
+
+    if (aeron_udp_channel_cache_parse(
+        &conductor->udp_channel_cache, uri, (size_t)command->channel_length, conductor->nano_clock(), &udp_channel) < 0)
+    {
+        return -1;
+    }
 
-    if (aeron_udp_channel_parse(uri, (size_t)command->channel_length, &udp_channel) < 0)
+    if (aeron_uri_stream_range(&udp_channel->uri, command->stream_id, &stream_id_low, &stream_id_high) < 0 ||
+        aeron_udp_channel_subscription_params(&udp_channel->uri, &params, conductor->context) < 0)
     {
+        aeron_udp_channel_delete(udp_channel);
         return -1;
     }
 
@@ -2019,7 +3334,24 @@ int aeron_driver_conductor_on_add_network_subscription(
         return -1;
     }
 
-    if (aeron_receive_channel_endpoint_incref_to_stream(endpoint, command->stream_id) < 0)
+    /* an image either NAKs or fills its gaps, so all subscriptions to its stream must agree */
+    for (size_t i = 0, length = conductor->network_subscriptions.length; i < length; i++)
+    {
+        aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
+
+        if (endpoint == link->endpoint && stream_id_low <= link->stream_id_high &&
+            link->stream_id <= stream_id_high && params.reliable != link->is_reliable)
+        {
+            aeron_set_err(
+                EINVAL,
+                "option conflicts with existing subscriptions: %s=%s",
+                AERON_UDP_CHANNEL_RELIABLE_STREAM_KEY,
+                params.reliable ? "true" : "false");
+            return -1;
+        }
+    }
+
+    if (aeron_receive_channel_endpoint_incref_to_stream_range(endpoint, stream_id_low, stream_id_high) < 0)
     {
         return -1;
     }
@@ -2031,7 +3363,10 @@ int aeron_driver_conductor_on_add_network_subscription(
 
         link->endpoint = endpoint;
         link->spy_channel = NULL;
-        link->stream_id = command->stream_id;
+        link->is_blocking_spy = true;
+        link->is_reliable = params.reliable;
+        link->stream_id = stream_id_low;
+        link->stream_id_high = stream_id_high;
         link->client_id = command->correlated.client_id;
         link->registration_id = command->correlated.correlation_id;
         link->subscribable_list.length = 0;
@@ -2045,7 +3380,8 @@ int aeron_driver_conductor_on_add_network_subscription(
         {
             aeron_publication_image_t *image = conductor->publication_images.array[i].image;
 
-            if (endpoint == image->endpoint && command->stream_id == image->stream_id &&
+            if (endpoint == aeron_receive_channel_endpoint_parent(image->endpoint) &&
+                aeron_driver_conductor_link_has_stream(link, image->stream_id) &&
                 aeron_publication_image_is_accepting_subscriptions(image))
             {
                 char source_identity[AERON_MAX_PATH];
@@ -2111,7 +3447,7 @@ int aeron_driver_conductor_on_remove_subscription(
             aeron_receive_channel_endpoint_t *endpoint = link->endpoint;
 
             link->endpoint = NULL;
-            aeron_receive_channel_endpoint_decref_to_stream(endpoint, link->stream_id);
+            aeron_receive_channel_endpoint_decref_to_stream_range(endpoint, link->stream_id, link->stream_id_high);
             if (AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_CLOSING == endpoint->conductor_fields.status)
             {
                 aeron_udp_channel_t *udp_channel = endpoint->conductor_fields.udp_channel;
@@ -2120,6 +3456,7 @@ int aeron_driver_conductor_on_remove_subscription(
                     &conductor->receive_channel_endpoint_by_channel_map,
                     udp_channel->canonical_form,
                     udp_channel->canonical_length);
+                aeron_driver_conductor_untag_endpoint(&conductor->receive_channel_endpoint_by_tag_map, udp_channel);
             }
 
             aeron_driver_conductor_unlink_all_subscribable(conductor, link);
@@ -2184,15 +3521,12 @@ int aeron_driver_conductoor_on_add_destination(
     aeron_send_channel_endpoint_t *endpoint = NULL;
     const char *command_uri = (const char *)command + sizeof(aeron_destination_command_t);
 
-    for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
-    {
-        aeron_network_publication_t *publication = conductor->network_publications.array[i].publication;
+    aeron_network_publication_t *publication = aeron_int64_to_ptr_hash_map_get(
+        &conductor->network_publication_by_registration_id_map, command->registration_id);
 
-        if (command->registration_id == publication->conductor_fields.managed_resource.registration_id)
-        {
-            endpoint = publication->endpoint;
-            break;
-        }
+    if (NULL != publication)
+    {
+        endpoint = publication->endpoint;
     }
 
     if (NULL != endpoint)
@@ -2229,7 +3563,7 @@ int aeron_driver_conductoor_on_add_destination(
             return -1;
         }
 
-        aeron_driver_sender_proxy_on_add_destination(conductor->context->sender_proxy, endpoint, &destination_addr);
+        aeron_driver_sender_proxy_on_add_destination(endpoint->sender_proxy, endpoint, &destination_addr);
         aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
 
         return 0;
@@ -2251,15 +3585,12 @@ int aeron_driver_conductoor_on_remove_destination(
     aeron_send_channel_endpoint_t *endpoint = NULL;
     const char *command_uri = (const char *)command + sizeof(aeron_destination_command_t);
 
-    for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
-    {
-        aeron_network_publication_t *publication = conductor->network_publications.array[i].publication;
+    aeron_network_publication_t *publication = aeron_int64_to_ptr_hash_map_get(
+        &conductor->network_publication_by_registration_id_map, command->registration_id);
 
-        if (command->registration_id == publication->conductor_fields.managed_resource.registration_id)
-        {
-            endpoint = publication->endpoint;
-            break;
-        }
+    if (NULL != publication)
+    {
+        endpoint = publication->endpoint;
     }
 
     if (NULL != endpoint)
@@ -2296,7 +3627,7 @@ int aeron_driver_conductoor_on_remove_destination(
             return -1;
         }
 
-        aeron_driver_sender_proxy_on_remove_destination(conductor->context->sender_proxy, endpoint, &destination_addr);
+        aeron_driver_sender_proxy_on_remove_destination(endpoint->sender_proxy, endpoint, &destination_addr);
         aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
 
         return 0;
@@ -2404,6 +3735,15 @@ int aeron_driver_conductor_on_client_close(
         aeron_client_t *client = &conductor->clients.array[index];
 
         client->time_of_last_keepalive = 0;
+        if (NULL != client->heartbeat_timestamp)
+        {
+            aeron_counter_set_ordered(client->heartbeat_timestamp, 0);
+        }
+
+        if (aeron_driver_conductor_schedule_client_timer(conductor, client, conductor->nano_clock()) < 0)
+        {
+            aeron_driver_conductor_error(conductor, ENOMEM, "could not schedule client close", aeron_errmsg());
+        }
     }
     return 0;
 }
@@ -2413,6 +3753,8 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
     aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
     aeron_command_create_publication_image_t *command = (aeron_command_create_publication_image_t *)item;
     aeron_receive_channel_endpoint_t *endpoint = command->endpoint;
+    /* the image belongs to the shard its session is steered to, the subscriptions to the endpoint holding the shards */
+    aeron_receive_channel_endpoint_t *subscribed_endpoint = aeron_receive_channel_endpoint_parent(endpoint);
     const char *channel_str = endpoint->conductor_fields.udp_channel->original_uri;
 
     if (aeron_receiver_channel_endpoint_validate_sender_mtu_length(
@@ -2422,7 +3764,7 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         return;
     }
 
-    if (!aeron_driver_conductor_has_network_subscription_interest(conductor, endpoint, command->stream_id))
+    if (!aeron_driver_conductor_has_network_subscription_interest(conductor, subscribed_endpoint, command->stream_id))
     {
         return;
     }
@@ -2439,6 +3781,17 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         (size_t)aeron_number_of_trailing_zeroes(command->term_length), command->initial_term_id);
 
     bool is_reliable = true;
+    for (size_t i = 0, length = conductor->network_subscriptions.length; i < length; i++)
+    {
+        aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
+
+        if (subscribed_endpoint == link->endpoint && aeron_driver_conductor_link_has_stream(link, command->stream_id))
+        {
+            is_reliable = link->is_reliable;
+            break;
+        }
+    }
+
     aeron_congestion_control_strategy_t *congestion_control = NULL;
     if (conductor->context->congestion_control_supplier_func(
         &congestion_control,
@@ -2474,6 +3827,29 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
     rcv_pos_position.value_addr =
         aeron_counter_addr(&conductor->counters_manager, (int32_t)rcv_pos_position.counter_id);
 
+    aeron_position_t rcv_wire_latency_position = { .value_addr = NULL, .counter_id = -1 };
+    aeron_position_t rcv_driver_latency_position = { .value_addr = NULL, .counter_id = -1 };
+
+    if (conductor->context->socket_rx_timestamping)
+    {
+        rcv_wire_latency_position.counter_id =
+            aeron_counter_receiver_wire_latency_allocate(
+                &conductor->counters_manager, registration_id, command->session_id, command->stream_id, channel_str);
+        rcv_driver_latency_position.counter_id =
+            aeron_counter_receiver_driver_latency_allocate(
+                &conductor->counters_manager, registration_id, command->session_id, command->stream_id, channel_str);
+
+        if (rcv_wire_latency_position.counter_id < 0 || rcv_driver_latency_position.counter_id < 0)
+        {
+            return;
+        }
+
+        rcv_wire_latency_position.value_addr =
+            aeron_counter_addr(&conductor->counters_manager, (int32_t)rcv_wire_latency_position.counter_id);
+        rcv_driver_latency_position.value_addr =
+            aeron_counter_addr(&conductor->counters_manager, (int32_t)rcv_driver_latency_position.counter_id);
+    }
+
     aeron_publication_image_t *image = NULL;
     if (aeron_publication_image_create(
         &image,
@@ -2487,6 +3863,8 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         command->term_offset,
         &rcv_hwm_position,
         &rcv_pos_position,
+        &rcv_wire_latency_position,
+        &rcv_driver_latency_position,
         congestion_control,
         &command->control_address,
         &command->src_address,
@@ -2499,20 +3877,40 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         return;
     }
 
+    if (conductor->context->stream_stats &&
+        aeron_stream_stats_allocate(
+            &image->stats,
+            &conductor->counters_manager,
+            true,
+            registration_id,
+            command->session_id,
+            command->stream_id,
+            channel_str) < 0)
+    {
+        aeron_driver_conductor_error(conductor, aeron_errcode(), "could not allocate stream stats", aeron_errmsg());
+    }
+
+    if (conductor->context->numa_bind_log_buffers)
+    {
+        aeron_driver_conductor_bind_log_buffer(conductor, &image->mapped_raw_log, endpoint->receiver_proxy->numa_node);
+    }
+
     conductor->publication_images.array[conductor->publication_images.length++].image = image;
 
+    char source_identity[AERON_MAX_PATH];
+    aeron_format_source_identity(source_identity, sizeof(source_identity), &command->src_address);
+
+    aeron_driver_conductor_begin_available_images(conductor);
+
     for (size_t i = 0, length = conductor->network_subscriptions.length; i < length; i++)
     {
-        char source_identity[AERON_MAX_PATH];
         aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
 
-        if (endpoint != link->endpoint || command->stream_id != link->stream_id)
+        if (subscribed_endpoint != link->endpoint || !aeron_driver_conductor_link_has_stream(link, command->stream_id))
         {
             continue;
         }
 
-        aeron_format_source_identity(source_identity, sizeof(source_identity), &command->src_address);
-
         if (aeron_driver_conductor_link_subscribable(
             conductor,
             link,
@@ -2526,41 +3924,40 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
             image->log_file_name,
             image->log_file_name_length) < 0)
         {
+            aeron_driver_conductor_end_available_images(conductor);
             return;
         }
     }
 
-    aeron_driver_receiver_proxy_on_add_publication_image(conductor->context->receiver_proxy, endpoint, image);
+    aeron_driver_conductor_end_available_images(conductor);
 
-    aeron_driver_receiver_proxy_on_delete_create_publication_image_cmd(conductor->context->receiver_proxy, item);
+    aeron_driver_receiver_proxy_on_add_publication_image(endpoint->receiver_proxy, endpoint, image);
+
+    aeron_driver_receiver_proxy_on_delete_create_publication_image_cmd(endpoint->receiver_proxy, item);
 }
 
 void aeron_driver_conductor_on_linger_buffer(void *clientd, void *item)
 {
     aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
     aeron_command_base_t *command = (aeron_command_base_t *)item;
-    int ensure_capacity_result = 0;
 
-    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->lingering_resources, aeron_linger_resource_entry_t);
-    if (ensure_capacity_result >= 0)
+    if (aeron_deadline_timer_wheel_schedule(
+        &conductor->linger_resource_timer_wheel,
+        conductor->nano_clock() + AERON_DRIVER_CONDUCTOR_LINGER_RESOURCE_TIMEOUT_NS,
+        (int64_t)(intptr_t)command->item) == AERON_DEADLINE_TIMER_WHEEL_NULL_TIMER_ID)
     {
-        aeron_linger_resource_entry_t *entry =
-            &conductor->lingering_resources.array[conductor->lingering_resources.length++];
-
-        entry->buffer = command->item;
-        entry->has_reached_end_of_life = false;
-        entry->timeout = conductor->nano_clock() + AERON_DRIVER_CONDUCTOR_LINGER_RESOURCE_TIMEOUT_NS;
+        aeron_driver_conductor_error(conductor, ENOMEM, "could not linger resource", aeron_errmsg());
     }
 
     if (conductor->context->threading_mode != AERON_THREADING_MODE_SHARED)
     {
-        aeron_free(command);
-        /* do not know where it came from originally, so just free command on the conductor duty cycle */
+        aeron_driver_command_pool_release(command);
     }
 }
 
 extern bool aeron_driver_conductor_is_subscribable_linked(
     aeron_subscription_link_t *link, aeron_subscribable_t *subscribable);
+extern bool aeron_driver_conductor_link_has_stream(const aeron_subscription_link_t *link, int32_t stream_id);
 extern bool aeron_driver_conductor_has_network_subscription_interest(
     aeron_driver_conductor_t *conductor, const aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id);
 extern size_t aeron_driver_conductor_num_clients(aeron_driver_conductor_t *conductor);
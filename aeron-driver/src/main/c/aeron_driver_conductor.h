@@ -27,13 +27,25 @@
 #include "aeron_system_counters.h"
 #include "aeron_ipc_publication.h"
 #include "collections/aeron_str_to_ptr_hash_map.h"
+#include "collections/aeron_int64_to_ptr_hash_map.h"
+#include "collections/aeron_deadline_timer_wheel.h"
 #include "media/aeron_send_channel_endpoint.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_driver_conductor_proxy.h"
 #include "aeron_publication_image.h"
 #include "reports/aeron_loss_reporter.h"
+#include "reports/aeron_stream_activity.h"
+#include "aeron_term_length_advisor.h"
 
 #define AERON_DRIVER_CONDUCTOR_LINGER_RESOURCE_TIMEOUT_NS (5 * 1000 * 1000 * 1000L)
+#define AERON_DRIVER_CONDUCTOR_TIMER_WHEEL_TICK_RESOLUTION_NS (1024 * 1024L)
+#define AERON_DRIVER_CONDUCTOR_TIMER_WHEEL_TICKS_PER_WHEEL (1024)
+#define AERON_DRIVER_CONDUCTOR_TIMER_EXPIRY_LIMIT (10)
+#define AERON_DRIVER_CONDUCTOR_COMMAND_BLOCK_LENGTH_LIMIT (64 * 1024)
+#define AERON_DRIVER_CONDUCTOR_COMMAND_BUDGET (32)
+#define AERON_DRIVER_CONDUCTOR_MAX_DEFERRED_COMMANDS (1024)
+#define AERON_DRIVER_CONDUCTOR_RESIDENCY_LOGS_PER_CHECK (16)
+#define AERON_DRIVER_CONDUCTOR_AVAILABLE_IMAGES_BATCH_LIMIT (128)
 
 typedef struct aeron_publication_link_stct
 {
@@ -54,6 +66,9 @@ typedef struct aeron_client_stct
     int64_t client_id;
     int64_t client_liveness_timeout_ns;
     int64_t time_of_last_keepalive;
+    int64_t timer_id;
+    int64_t *heartbeat_timestamp;
+    int32_t heartbeat_timestamp_counter_id;
     bool reached_end_of_life;
 
     struct publication_link_stct
@@ -86,8 +101,12 @@ typedef struct aeron_subscription_link_stct
     aeron_receive_channel_endpoint_t *endpoint;
     aeron_udp_channel_t *spy_channel;
     int32_t stream_id;
+    /* last stream id of the range subscribed to with streams, stream_id when it is a single stream */
+    int32_t stream_id_high;
     int64_t client_id;
     int64_t registration_id;
+    bool is_blocking_spy;
+    bool is_reliable;
 
     struct subscribable_list_stct
     {
@@ -105,6 +124,17 @@ typedef struct aeron_ipc_publication_entry_stct
 }
 aeron_ipc_publication_entry_t;
 
+/* a copy of a command adding a UDP channel which waits for the name resolver to resolve its channel */
+typedef struct aeron_deferred_command_stct
+{
+    uint8_t *message;
+    size_t length;
+    const char *uri;
+    size_t uri_length;
+    int32_t msg_type_id;
+}
+aeron_deferred_command_t;
+
 typedef struct aeron_network_publication_entry_stct
 {
     aeron_network_publication_t *publication;
@@ -129,14 +159,6 @@ typedef struct aeron_publication_image_entry_stct
 }
 aeron_publication_image_entry_t;
 
-typedef struct aeron_linger_resource_entry_stct
-{
-    uint8_t *buffer;
-    int64_t timeout;
-    bool has_reached_end_of_life;
-}
-aeron_linger_resource_entry_t;
-
 typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
 
 typedef struct aeron_driver_conductor_stct
@@ -149,9 +171,22 @@ typedef struct aeron_driver_conductor_stct
     aeron_system_counters_t system_counters;
     aeron_driver_conductor_proxy_t conductor_proxy;
     aeron_loss_reporter_t loss_reporter;
+    aeron_stream_activity_t stream_activity;
 
     aeron_str_to_ptr_hash_map_t send_channel_endpoint_by_channel_map;
     aeron_str_to_ptr_hash_map_t receive_channel_endpoint_by_channel_map;
+    /* channel tag -> endpoint, for channels that name an endpoint with tags= rather than its addresses */
+    aeron_int64_to_ptr_hash_map_t send_channel_endpoint_by_tag_map;
+    aeron_int64_to_ptr_hash_map_t receive_channel_endpoint_by_tag_map;
+    aeron_udp_channel_cache_t udp_channel_cache;
+
+    /* client_id -> index + 1 into clients, kept up to date as clients are removed */
+    aeron_int64_to_ptr_hash_map_t client_index_by_id_map;
+    /* stream_id -> shared (non-exclusive) IPC publication, checked for being active on lookup */
+    aeron_int64_to_ptr_hash_map_t shared_ipc_publication_by_stream_id_map;
+    /* (send endpoint status counter id, stream_id) -> shared network publication, checked on lookup */
+    aeron_int64_to_ptr_hash_map_t shared_network_publication_by_endpoint_stream_map;
+    aeron_int64_to_ptr_hash_map_t network_publication_by_registration_id_map;
 
     struct client_stct
     {
@@ -199,6 +234,27 @@ typedef struct aeron_driver_conductor_stct
     }
     spy_subscriptions;
 
+    struct deferred_commands_stct
+    {
+        aeron_deferred_command_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    deferred_commands;
+
+    /* to-driver commands read from the ring beyond the budget of a duty cycle, waiting in order for later cycles
+     * so client keepalives read behind them are not held up */
+    struct aeron_driver_conductor_command_backlog_stct
+    {
+        uint8_t *buffer;
+        size_t head;
+        size_t tail;
+        size_t capacity;
+        size_t count;
+        int budget;
+    }
+    command_backlog;
+
     struct network_publication_stct
     {
         aeron_network_publication_entry_t *array;
@@ -243,20 +299,38 @@ typedef struct aeron_driver_conductor_stct
     }
     publication_images;
 
-    struct aeron_driver_conductor_lingering_resources_stct
+    /* deadline driven resources are only visited when their timer fires rather than on every timer interval */
+    aeron_deadline_timer_wheel_t client_timer_wheel;
+    aeron_deadline_timer_wheel_t linger_resource_timer_wheel;
+
+    aeron_term_length_advisor_t term_length_advisor;
+
+    /* links made while an image is created are notified together, the names outlive the batch */
+    struct aeron_driver_conductor_available_images_stct
     {
-        aeron_linger_resource_entry_t *array;
+        bool is_batching;
+        int64_t correlation_id;
+        int32_t session_id;
+        int32_t stream_id;
+        const char *log_file_name;
+        size_t log_file_name_length;
+        const char *source_identity;
+        size_t source_identity_length;
         size_t length;
-        size_t capacity;
-        void (*on_time_event)(aeron_driver_conductor_t *, aeron_linger_resource_entry_t *, int64_t, int64_t);
-        bool (*has_reached_end_of_life)(aeron_driver_conductor_t *, aeron_linger_resource_entry_t *);
-        void (*delete_func)(aeron_driver_conductor_t *, aeron_linger_resource_entry_t *);
+        aeron_image_buffers_ready_subscriber_t subscribers[AERON_DRIVER_CONDUCTOR_AVAILABLE_IMAGES_BATCH_LIMIT];
     }
-    lingering_resources;
+    available_images;
+
+    /* logs are swept for residency a few per timer check, the counter is set once a sweep covers them all */
+    size_t residency_sweep_index;
+    int64_t residency_sweep_length;
 
     int64_t *errors_counter;
     int64_t *client_keep_alives_counter;
     int64_t *unblocked_commands_counter;
+    int64_t *commands_waiting_counter;
+    int64_t *command_max_wait_ns_counter;
+    int64_t *log_buffer_resident_bytes_counter;
 
     aeron_clock_func_t nano_clock;
     aeron_clock_func_t epoch_clock;
@@ -306,12 +380,6 @@ bool aeron_publication_image_entry_has_reached_end_of_life(
     aeron_driver_conductor_t *conductor, aeron_publication_image_entry_t *entry);
 void aeron_publication_image_entry_delete(aeron_driver_conductor_t *conductor, aeron_publication_image_entry_t *);
 
-void aeron_linger_resource_entry_on_time_event(
-    aeron_driver_conductor_t *conductor, aeron_linger_resource_entry_t *entry, int64_t now_ns, int64_t now_ms);
-bool aeron_linger_resource_entry_has_reached_end_of_life(
-    aeron_driver_conductor_t *conductor, aeron_linger_resource_entry_t *entry);
-void aeron_linger_resource_entry_delete(aeron_driver_conductor_t *conductor, aeron_linger_resource_entry_t *);
-
 void aeron_driver_conductor_image_transition_to_linger(
     aeron_driver_conductor_t *conductor, aeron_publication_image_t *image);
 
@@ -323,6 +391,11 @@ void aeron_driver_conductor_client_transmit(
     const void *message,
     size_t length);
 
+void aeron_driver_conductor_error(
+    aeron_driver_conductor_t *conductor, int error_code, const char *description, const char *message);
+
+int aeron_driver_conductor_find_client(aeron_driver_conductor_t *conductor, int64_t client_id);
+
 void aeron_driver_conductor_on_unavailable_image(
     aeron_driver_conductor_t *conductor,
     int64_t correlation_id,
@@ -358,6 +431,9 @@ int aeron_driver_conductor_link_subscribable(
     const char *log_file_name,
     size_t log_file_name_length);
 
+int aeron_driver_conductor_track_non_blocking_spy(
+    aeron_subscription_link_t *link, aeron_network_publication_t *publication);
+
 void aeron_driver_conductor_unlink_subscribable(aeron_subscription_link_t *link, aeron_subscribable_t *subscribable);
 void aeron_driver_conductor_unlink_all_subscribable(
     aeron_driver_conductor_t *conductor, aeron_subscription_link_t *link);
@@ -439,6 +515,14 @@ inline bool aeron_driver_conductor_is_subscribable_linked(
     return result;
 }
 
+/*
+ * Whether a subscription link is for stream_id, a network subscription with streams covering each stream in range.
+ */
+inline bool aeron_driver_conductor_link_has_stream(const aeron_subscription_link_t *link, int32_t stream_id)
+{
+    return stream_id >= link->stream_id && stream_id <= link->stream_id_high;
+}
+
 inline bool aeron_driver_conductor_has_network_subscription_interest(
     aeron_driver_conductor_t *conductor, const aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id)
 {
@@ -446,7 +530,7 @@ inline bool aeron_driver_conductor_has_network_subscription_interest(
     {
         aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
 
-        if (endpoint == link->endpoint && stream_id == link->stream_id)
+        if (endpoint == link->endpoint && aeron_driver_conductor_link_has_stream(link, stream_id))
         {
             return true;
         }
@@ -608,17 +692,8 @@ inline aeron_ipc_publication_t *aeron_driver_conductor_find_ipc_publication(
 inline aeron_network_publication_t *aeron_driver_conductor_find_network_publication(
     aeron_driver_conductor_t *conductor, int64_t id)
 {
-    for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
-    {
-        aeron_network_publication_t *publication = conductor->network_publications.array[i].publication;
-
-        if (id == publication->conductor_fields.managed_resource.registration_id)
-        {
-            return publication;
-        }
-    }
-
-    return NULL;
+    return (aeron_network_publication_t *)aeron_int64_to_ptr_hash_map_get(
+        &conductor->network_publication_by_registration_id_map, id);
 }
 
 inline aeron_publication_image_t *aeron_driver_conductor_find_publication_image(
@@ -47,6 +47,7 @@ void aeron_driver_conductor_proxy_on_delete_cmd(
 
 void aeron_driver_conductor_proxy_on_create_publication_image_cmd(
     aeron_driver_conductor_proxy_t *conductor_proxy,
+    aeron_driver_command_pool_t *command_pool,
     int32_t session_id,
     int32_t stream_id,
     int32_t initial_term_id,
@@ -81,9 +82,10 @@ void aeron_driver_conductor_proxy_on_create_publication_image_cmd(
     }
     else
     {
-        aeron_command_create_publication_image_t *cmd;
+        aeron_command_create_publication_image_t *cmd = aeron_driver_command_pool_acquire(
+            command_pool, sizeof(aeron_command_create_publication_image_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_create_publication_image_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(conductor_proxy->fail_counter, 1);
             return;
@@ -116,9 +118,10 @@ void aeron_driver_conductor_proxy_on_linger_buffer(
     }
     else
     {
-        aeron_command_base_t *cmd;
+        aeron_command_base_t *cmd = aeron_driver_command_pool_acquire(
+            &conductor_proxy->command_pool, sizeof(aeron_command_base_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_base_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(conductor_proxy->fail_counter, 1);
             return;
@@ -136,5 +139,5 @@ void aeron_command_on_delete_cmd(void *clientd, void *cmd)
     aeron_command_base_t *command = (aeron_command_base_t *)cmd;
 
     aeron_free(command->item);
-    aeron_free(cmd);
+    aeron_driver_command_pool_release(cmd);
 }
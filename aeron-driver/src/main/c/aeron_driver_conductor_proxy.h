@@ -18,6 +18,7 @@
 #define AERON_AERON_DRIVER_CONDUCTOR_PROXY_H
 
 #include "aeron_driver_context.h"
+#include "aeron_driver_command_pool.h"
 
 typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
 
@@ -27,6 +28,8 @@ typedef struct aeron_driver_conductor_proxy_stct
     aeron_threading_mode_t threading_mode;
     aeron_mpsc_concurrent_array_queue_t *command_queue;
     int64_t *fail_counter;
+    /* only used by the conductor, the receivers pass their own pool for the commands they send */
+    aeron_driver_command_pool_t command_pool;
 }
 aeron_driver_conductor_proxy_t;
 
@@ -51,6 +54,7 @@ aeron_command_create_publication_image_t;
 
 void aeron_driver_conductor_proxy_on_create_publication_image_cmd(
     aeron_driver_conductor_proxy_t *conductor_proxy,
+    aeron_driver_command_pool_t *command_pool,
     int32_t session_id,
     int32_t stream_id,
     int32_t initial_term_id,
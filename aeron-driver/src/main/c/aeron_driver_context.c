@@ -38,7 +38,9 @@
 #include "util/aeron_error.h"
 #include "protocol/aeron_udp_protocol.h"
 #include "util/aeron_fileutil.h"
+#include "util/aeron_clock.h"
 #include "aeron_driver_context.h"
+#include "aeron_raw_log_pool.h"
 #include "aeron_alloc.h"
 #include "concurrent/aeron_mpsc_rb.h"
 #include "concurrent/aeron_broadcast_transmitter.h"
@@ -137,6 +139,54 @@ uint64_t aeron_config_parse_uint64(const char *str, uint64_t def, uint64_t min,
     return result;
 }
 
+int32_t aeron_config_parse_int32(const char *str, int32_t def, int32_t min, int32_t max)
+{
+    int32_t result = def;
+
+    if (NULL != str)
+    {
+        char *end_ptr = NULL;
+
+        errno = 0;
+        long long value = strtoll(str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == str)
+        {
+            value = def;
+        }
+
+        value = (value > max) ? max : value;
+        value = (value < min) ? min : value;
+        result = (int32_t)value;
+    }
+
+    return result;
+}
+
+int64_t aeron_config_parse_int64(const char *str, int64_t def, int64_t min, int64_t max)
+{
+    int64_t result = def;
+
+    if (NULL != str)
+    {
+        char *end_ptr = NULL;
+
+        errno = 0;
+        long long value = strtoll(str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == str)
+        {
+            value = def;
+        }
+
+        value = (value > max) ? max : value;
+        value = (value < min) ? min : value;
+        result = (int64_t)value;
+    }
+
+    return result;
+}
+
 #define AERON_CONFIG_GETENV_OR_DEFAULT(e,d) ((NULL == getenv(e)) ? (d) : getenv(e))
 
 static void aeron_driver_conductor_to_driver_interceptor_null(
@@ -167,22 +217,29 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
 
     _context->cnc_map.addr = NULL;
     _context->loss_report.addr = NULL;
+    _context->flow_control_trace_file.addr = NULL;
+    _context->flow_control_trace.header = NULL;
+    _context->flow_control_trace.records = NULL;
+    _context->position_snapshot_file.addr = NULL;
+    _context->stream_activity_file.addr = NULL;
     _context->aeron_dir = NULL;
+    _context->durable_dir = NULL;
     _context->conductor_proxy = NULL;
     _context->sender_proxy = NULL;
     _context->receiver_proxy = NULL;
-
-    if (aeron_alloc((void **)&_context->aeron_dir, AERON_MAX_PATH) < 0)
+    _context->raw_log_pool = NULL;
+    _context->name_resolver = NULL;
+    _context->durable_log_syncer = NULL;
+    for (size_t i = 0; i < AERON_DRIVER_SENDER_MAX_COUNT; i++)
     {
-        return -1;
+        _context->sender_proxies[i] = NULL;
     }
-
-    if (aeron_spsc_concurrent_array_queue_init(&_context->sender_command_queue, AERON_COMMAND_QUEUE_CAPACITY) < 0)
+    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_MAX_COUNT; i++)
     {
-        return -1;
+        _context->receiver_proxies[i] = NULL;
     }
 
-    if (aeron_spsc_concurrent_array_queue_init(&_context->receiver_command_queue, AERON_COMMAND_QUEUE_CAPACITY) < 0)
+    if (aeron_alloc((void **)&_context->aeron_dir, AERON_MAX_PATH) < 0)
     {
         return -1;
     }
@@ -213,6 +270,12 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         return -1;
     }
 
+    if ((_context->udp_channel_transport_bindings =
+        aeron_udp_channel_transport_bindings_load(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_DEFAULT)) == NULL)
+    {
+        return -1;
+    }
+
 #if defined(__linux__)
     snprintf(_context->aeron_dir, AERON_MAX_PATH - 1, "/dev/shm/aeron-%s", username());
 #elif defined(_MSC_VER)
@@ -223,10 +286,29 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
 
     _context->threading_mode = AERON_THREADING_MODE_DEDICATED;
     _context->dirs_delete_on_start = false;
+    _context->dirs_warm_restart = false;
     _context->warn_if_dirs_exist = true;
     _context->term_buffer_sparse_file = false;
+    _context->term_buffer_prefault = false;
+    _context->term_buffer_lock = false;
+    _context->term_buffer_release_pages = false;
+    _context->term_buffer_auto_size_target_ns = 0;
     _context->perform_storage_checks = true;
     _context->spies_simulate_connection = false;
+    _context->socket_io_uring = false;
+    _context->socket_gso = false;
+    _context->socket_gro = false;
+    _context->socket_busy_poll_us = 0;
+    _context->socket_prefer_busy_poll = false;
+    _context->socket_rx_timestamping = false;
+    _context->stream_stats = false;
+    _context->socket_connected_send = false;
+    _context->socket_drop_monitoring = false;
+    _context->send_pacing = false;
+    _context->send_to_sm_poll_adaptive = false;
+    _context->pmtu_discovery = false;
+    _context->pmtu_discovery_max_length = 8960;
+    _context->status_message_adaptive = false;
     _context->driver_timeout_ms = 10 * 1000;
     _context->to_driver_buffer_length = 1024 * 1024 + AERON_RB_TRAILER_LENGTH;
     _context->to_clients_buffer_length = 1024 * 1024 + AERON_BROADCAST_BUFFER_TRAILER_LENGTH;
@@ -239,23 +321,58 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->timer_interval_ns = 1 * 1000 * 1000 * 1000L;
     _context->term_buffer_length = 16 * 1024 * 1024;
     _context->ipc_term_buffer_length = 64 * 1024 * 1024;
+    _context->term_buffer_clean_chunk_length = 64 * 1024;
     _context->mtu_length = 1408;
     _context->ipc_mtu_length = 1408;
     _context->ipc_publication_window_length = 0;
     _context->publication_window_length = 0;
     _context->publication_linger_timeout_ns = 5 * 1000 * 1000 * 1000L;
+    _context->publication_resume_timeout_ns = 30 * 1000 * 1000 * 1000L;
     _context->socket_rcvbuf = 128 * 1024;
+    _context->socket_rcvbuf_max = 0;
     _context->socket_sndbuf = 0;
     _context->multicast_ttl = 0;
     _context->send_to_sm_poll_ratio = 4;
     _context->status_message_timeout_ns = 200 * 1000 * 1000L;
     _context->image_liveness_timeout_ns = 10 * 1000 * 1000 * 1000L;
+    _context->rcv_reorder_window_max_ns = 0;
+    _context->rcv_gap_fill_delay_ns = 0;
     _context->initial_window_length = 128 * 1024;
+    _context->rcv_non_temporal_copy_threshold = 0;
     _context->loss_report_length = 1024 * 1024;
+    _context->flow_control_trace_length = 0;
+    _context->position_snapshot_capacity = 0;
+    _context->stream_activity_capacity = 0;
     _context->file_page_size = 4 * 1024;
+    _context->sender_count = 1;
+    _context->receiver_count = 1;
+    _context->sender_io_vector_capacity = 2;
+    _context->receiver_io_vector_capacity = 2;
+    _context->raw_log_pool_size = 0;
+    _context->receiver_group_tag_is_set = false;
+    _context->receiver_group_tag = 0;
+    _context->cubic_cc_measure_rtt = false;
+    _context->cubic_cc_tcp_mode = false;
+    _context->cubic_cc_initial_rtt_ns = 100 * 1000L;
+    _context->numa_bind_log_buffers = false;
+    _context->conductor_cpu_affinity = -1;
+    _context->sender_cpu_affinity = -1;
+    _context->receiver_cpu_affinity = -1;
+    _context->shared_network_cpu_affinity = -1;
+    _context->shared_cpu_affinity = -1;
     _context->publication_unblock_timeout_ns = 10 * 1000 * 1000 * 1000L;
+    _context->publication_unblock_timeout_min_ns = 0;
     _context->publication_connection_timeout_ns = 5 * 1000 * 1000 * 1000L;
     _context->counter_free_to_reuse_ns = 1 * 1000 * 1000 * 1000L;
+    _context->udp_channel_cache_ttl_ns = 1 * 1000 * 1000 * 1000L;
+    _context->async_name_resolution = false;
+    _context->duty_cycle_tracking = false;
+    _context->duty_cycle_threshold_ns = 1000 * 1000L;
+    _context->ipc_client_publisher_limit = false;
+    _context->ipc_subscriber_wakeup = false;
+    _context->rcv_nak_suppression = false;
+    _context->available_image_batching = false;
+    _context->durable_sync_interval_ns = 1000 * 1000L;
 
     /* set from env */
     char *value = NULL;
@@ -265,6 +382,16 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         snprintf(_context->aeron_dir, AERON_MAX_PATH - 1, "%s", value);
     }
 
+    if ((value = getenv(AERON_DURABLE_DIR_ENV_VAR)))
+    {
+        if (aeron_alloc((void **)&_context->durable_dir, AERON_MAX_PATH) < 0)
+        {
+            return -1;
+        }
+
+        snprintf(_context->durable_dir, AERON_MAX_PATH - 1, "%s", value);
+    }
+
     if ((value = getenv(AERON_AGENT_ON_START_FUNCTION_ENV_VAR)))
     {
         if ((_context->agent_on_start_func = aeron_agent_on_start_load(value)) == NULL)
@@ -297,6 +424,14 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         }
     }
 
+    if ((value = getenv(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA_ENV_VAR)))
+    {
+        if ((_context->udp_channel_transport_bindings = aeron_udp_channel_transport_bindings_load(value)) == NULL)
+        {
+            return -1;
+        }
+    }
+
     if ((value = getenv(AERON_THREADING_MODE_ENV_VAR)))
     {
         if (strncmp(value, "SHARED", sizeof("SHARED")) == 0)
@@ -318,11 +453,31 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             getenv(AERON_DIR_DELETE_ON_START_ENV_VAR),
             _context->dirs_delete_on_start);
 
+    _context->dirs_warm_restart =
+        aeron_config_parse_bool(
+            getenv(AERON_DIR_WARM_RESTART_ENV_VAR),
+            _context->dirs_warm_restart);
+
     _context->term_buffer_sparse_file =
         aeron_config_parse_bool(
             getenv(AERON_TERM_BUFFER_SPARSE_FILE_ENV_VAR),
             _context->term_buffer_sparse_file);
 
+    _context->term_buffer_prefault =
+        aeron_config_parse_bool(
+            getenv(AERON_TERM_BUFFER_PREFAULT_ENV_VAR),
+            _context->term_buffer_prefault);
+
+    _context->term_buffer_lock =
+        aeron_config_parse_bool(
+            getenv(AERON_TERM_BUFFER_LOCK_ENV_VAR),
+            _context->term_buffer_lock);
+
+    _context->term_buffer_release_pages =
+        aeron_config_parse_bool(
+            getenv(AERON_TERM_BUFFER_RELEASE_PAGES_ENV_VAR),
+            _context->term_buffer_release_pages);
+
     _context->perform_storage_checks =
         aeron_config_parse_bool(
             getenv(AERON_PERFORM_STORAGE_CHECKS_ENV_VAR),
@@ -333,6 +488,75 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             getenv(AERON_SPIES_SIMULATE_CONNECTION_ENV_VAR),
             _context->spies_simulate_connection);
 
+    _context->socket_io_uring =
+        aeron_config_parse_bool(
+            getenv(AERON_SOCKET_IO_URING_ENV_VAR),
+            _context->socket_io_uring);
+
+    _context->socket_gso =
+        aeron_config_parse_bool(
+            getenv(AERON_SOCKET_GSO_ENV_VAR),
+            _context->socket_gso);
+
+    _context->socket_gro =
+        aeron_config_parse_bool(
+            getenv(AERON_SOCKET_GRO_ENV_VAR),
+            _context->socket_gro);
+
+    _context->socket_busy_poll_us =
+        (uint32_t)aeron_config_parse_uint64(
+            getenv(AERON_SOCKET_BUSY_POLL_ENV_VAR),
+            _context->socket_busy_poll_us,
+            0,
+            INT32_MAX);
+
+    _context->socket_prefer_busy_poll =
+        aeron_config_parse_bool(
+            getenv(AERON_SOCKET_PREFER_BUSY_POLL_ENV_VAR),
+            _context->socket_prefer_busy_poll);
+
+    _context->socket_rx_timestamping =
+        aeron_config_parse_bool(
+            getenv(AERON_SOCKET_RX_TIMESTAMPING_ENV_VAR),
+            _context->socket_rx_timestamping);
+
+    _context->stream_stats =
+        aeron_config_parse_bool(
+            getenv(AERON_STREAM_STATS_ENV_VAR),
+            _context->stream_stats);
+
+    _context->socket_connected_send =
+        aeron_config_parse_bool(
+            getenv(AERON_SOCKET_CONNECTED_SEND_ENV_VAR),
+            _context->socket_connected_send);
+
+    _context->socket_drop_monitoring =
+        aeron_config_parse_bool(
+            getenv(AERON_SOCKET_DROP_MONITORING_ENV_VAR),
+            _context->socket_drop_monitoring);
+
+    _context->send_pacing =
+        aeron_config_parse_bool(
+            getenv(AERON_SEND_PACING_ENV_VAR),
+            _context->send_pacing);
+
+    _context->send_to_sm_poll_adaptive =
+        aeron_config_parse_bool(
+            getenv(AERON_SEND_TO_STATUS_POLL_ADAPTIVE_ENV_VAR),
+            _context->send_to_sm_poll_adaptive);
+
+    _context->pmtu_discovery =
+        aeron_config_parse_bool(
+            getenv(AERON_PMTU_DISCOVERY_ENV_VAR),
+            _context->pmtu_discovery);
+
+    _context->pmtu_discovery_max_length =
+        aeron_config_parse_uint64(
+            getenv(AERON_PMTU_DISCOVERY_MAX_LENGTH_ENV_VAR),
+            _context->pmtu_discovery_max_length,
+            AERON_DATA_HEADER_LENGTH,
+            AERON_MAX_UDP_PAYLOAD_LENGTH);
+
     _context->to_driver_buffer_length =
         aeron_config_parse_uint64(
             getenv(AERON_TO_CONDUCTOR_BUFFER_LENGTH_ENV_VAR),
@@ -379,6 +603,20 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             1000,
             INT64_MAX);
 
+    _context->publication_resume_timeout_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_PUBLICATION_RESUME_TIMEOUT_ENV_VAR),
+            _context->publication_resume_timeout_ns,
+            1000,
+            INT64_MAX);
+
+    _context->term_buffer_auto_size_target_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_TERM_BUFFER_AUTO_SIZE_TARGET_ENV_VAR),
+            _context->term_buffer_auto_size_target_ns,
+            0,
+            INT64_MAX);
+
     _context->term_buffer_length =
         aeron_config_parse_uint64(
             getenv(AERON_TERM_BUFFER_LENGTH_ENV_VAR),
@@ -393,6 +631,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             1024,
             INT32_MAX);
 
+    _context->term_buffer_clean_chunk_length =
+        aeron_config_parse_uint64(
+            getenv(AERON_TERM_BUFFER_CLEAN_CHUNK_LENGTH_ENV_VAR),
+            _context->term_buffer_clean_chunk_length,
+            0,
+            INT32_MAX);
+
     _context->mtu_length =
         aeron_config_parse_uint64(
             getenv(AERON_MTU_LENGTH_ENV_VAR),
@@ -428,6 +673,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             0,
             INT32_MAX);
 
+    _context->socket_rcvbuf_max =
+        aeron_config_parse_uint64(
+            getenv(AERON_SOCKET_SO_RCVBUF_MAX_ENV_VAR),
+            _context->socket_rcvbuf_max,
+            0,
+            INT32_MAX);
+
     _context->socket_sndbuf =
         aeron_config_parse_uint64(
             getenv(AERON_SOCKET_SO_SNDBUF_ENV_VAR),
@@ -449,6 +701,81 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             1,
             INT32_MAX);
 
+    _context->sender_count =
+        (size_t)aeron_config_parse_uint64(
+            getenv(AERON_SENDER_COUNT_ENV_VAR),
+            _context->sender_count,
+            1,
+            AERON_DRIVER_SENDER_MAX_COUNT);
+
+    _context->receiver_count =
+        (size_t)aeron_config_parse_uint64(
+            getenv(AERON_RECEIVER_COUNT_ENV_VAR),
+            _context->receiver_count,
+            1,
+            AERON_DRIVER_RECEIVER_MAX_COUNT);
+
+    _context->sender_io_vector_capacity =
+        (size_t)aeron_config_parse_uint64(
+            getenv(AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR),
+            _context->sender_io_vector_capacity,
+            1,
+            AERON_DRIVER_MAX_IO_VECTOR_CAPACITY);
+
+    _context->receiver_io_vector_capacity =
+        (size_t)aeron_config_parse_uint64(
+            getenv(AERON_RECEIVER_IO_VECTOR_CAPACITY_ENV_VAR),
+            _context->receiver_io_vector_capacity,
+            1,
+            AERON_DRIVER_MAX_IO_VECTOR_CAPACITY);
+
+    _context->raw_log_pool_size =
+        (size_t)aeron_config_parse_uint64(
+            getenv(AERON_RAW_LOG_POOL_SIZE_ENV_VAR),
+            _context->raw_log_pool_size,
+            0,
+            AERON_RAW_LOG_POOL_MAX_SIZE);
+
+    _context->numa_bind_log_buffers =
+        aeron_config_parse_bool(
+            getenv(AERON_NUMA_BIND_LOG_BUFFERS_ENV_VAR),
+            _context->numa_bind_log_buffers);
+
+    _context->conductor_cpu_affinity =
+        aeron_config_parse_int32(
+            getenv(AERON_CONDUCTOR_CPU_AFFINITY_ENV_VAR),
+            _context->conductor_cpu_affinity,
+            -1,
+            INT32_MAX);
+
+    _context->sender_cpu_affinity =
+        aeron_config_parse_int32(
+            getenv(AERON_SENDER_CPU_AFFINITY_ENV_VAR),
+            _context->sender_cpu_affinity,
+            -1,
+            INT32_MAX);
+
+    _context->receiver_cpu_affinity =
+        aeron_config_parse_int32(
+            getenv(AERON_RECEIVER_CPU_AFFINITY_ENV_VAR),
+            _context->receiver_cpu_affinity,
+            -1,
+            INT32_MAX);
+
+    _context->shared_network_cpu_affinity =
+        aeron_config_parse_int32(
+            getenv(AERON_SHARED_NETWORK_CPU_AFFINITY_ENV_VAR),
+            _context->shared_network_cpu_affinity,
+            -1,
+            INT32_MAX);
+
+    _context->shared_cpu_affinity =
+        aeron_config_parse_int32(
+            getenv(AERON_SHARED_CPU_AFFINITY_ENV_VAR),
+            _context->shared_cpu_affinity,
+            -1,
+            INT32_MAX);
+
     _context->status_message_timeout_ns =
         aeron_config_parse_uint64(
             getenv(AERON_RCV_STATUS_MESSAGE_TIMEOUT_ENV_VAR),
@@ -456,6 +783,11 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             1000,
             INT64_MAX);
 
+    _context->status_message_adaptive =
+        aeron_config_parse_bool(
+            getenv(AERON_RCV_STATUS_MESSAGE_ADAPTIVE_ENV_VAR),
+            _context->status_message_adaptive);
+
     _context->image_liveness_timeout_ns =
         aeron_config_parse_uint64(
             getenv(AERON_IMAGE_LIVENESS_TIMEOUT_ENV_VAR),
@@ -463,6 +795,20 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             1000,
             INT64_MAX);
 
+    _context->rcv_reorder_window_max_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_RCV_REORDER_WINDOW_MAX_ENV_VAR),
+            _context->rcv_reorder_window_max_ns,
+            0,
+            INT64_MAX);
+
+    _context->rcv_gap_fill_delay_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_RCV_GAP_FILL_DELAY_ENV_VAR),
+            _context->rcv_gap_fill_delay_ns,
+            0,
+            INT64_MAX);
+
     _context->initial_window_length =
         aeron_config_parse_uint64(
             getenv(AERON_RCV_INITIAL_WINDOW_LENGTH_ENV_VAR),
@@ -470,6 +816,38 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             256,
             INT32_MAX);
 
+    _context->rcv_non_temporal_copy_threshold =
+        aeron_config_parse_uint64(
+            getenv(AERON_RCV_NON_TEMPORAL_COPY_THRESHOLD_ENV_VAR),
+            _context->rcv_non_temporal_copy_threshold,
+            0,
+            INT32_MAX);
+
+    _context->receiver_group_tag_is_set = NULL != getenv(AERON_RECEIVER_GROUP_TAG_ENV_VAR);
+    _context->receiver_group_tag =
+        aeron_config_parse_int64(
+            getenv(AERON_RECEIVER_GROUP_TAG_ENV_VAR),
+            _context->receiver_group_tag,
+            INT64_MIN,
+            INT64_MAX);
+
+    _context->cubic_cc_measure_rtt =
+        aeron_config_parse_bool(
+            getenv(AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR),
+            _context->cubic_cc_measure_rtt);
+
+    _context->cubic_cc_tcp_mode =
+        aeron_config_parse_bool(
+            getenv(AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR),
+            _context->cubic_cc_tcp_mode);
+
+    _context->cubic_cc_initial_rtt_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR),
+            _context->cubic_cc_initial_rtt_ns,
+            1000,
+            INT64_MAX);
+
     _context->loss_report_length =
         aeron_config_parse_uint64(
             getenv(AERON_LOSS_REPORT_BUFFER_LENGTH_ENV_VAR),
@@ -477,6 +855,27 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             1024,
             INT32_MAX);
 
+    _context->flow_control_trace_length =
+        aeron_config_parse_uint64(
+            getenv(AERON_FLOW_CONTROL_TRACE_BUFFER_LENGTH_ENV_VAR),
+            _context->flow_control_trace_length,
+            0,
+            INT32_MAX);
+
+    _context->position_snapshot_capacity =
+        aeron_config_parse_uint64(
+            getenv(AERON_POSITION_SNAPSHOT_CAPACITY_ENV_VAR),
+            _context->position_snapshot_capacity,
+            0,
+            1024 * 1024);
+
+    _context->stream_activity_capacity =
+        aeron_config_parse_uint64(
+            getenv(AERON_STREAM_ACTIVITY_CAPACITY_ENV_VAR),
+            _context->stream_activity_capacity,
+            0,
+            1024 * 1024);
+
     _context->file_page_size =
         aeron_config_parse_uint64(
             getenv(AERON_FILE_PAGE_SIZE_ENV_VAR),
@@ -491,6 +890,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             1000,
             INT64_MAX);
 
+    _context->publication_unblock_timeout_min_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_PUBLICATION_UNBLOCK_TIMEOUT_MIN_ENV_VAR),
+            _context->publication_unblock_timeout_min_ns,
+            0,
+            INT64_MAX);
+
     _context->publication_connection_timeout_ns =
         aeron_config_parse_uint64(
             getenv(AERON_PUBLICATION_CONNECTION_TIMEOUT_ENV_VAR),
@@ -512,6 +918,57 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             0,
             INT64_MAX);
 
+    _context->udp_channel_cache_ttl_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_UDP_CHANNEL_CACHE_TTL_ENV_VAR),
+            _context->udp_channel_cache_ttl_ns,
+            0,
+            INT64_MAX);
+
+    _context->async_name_resolution =
+        aeron_config_parse_bool(
+            getenv(AERON_ASYNC_NAME_RESOLUTION_ENV_VAR),
+            _context->async_name_resolution);
+
+    _context->duty_cycle_tracking =
+        aeron_config_parse_bool(
+            getenv(AERON_DUTY_CYCLE_TRACKING_ENV_VAR),
+            _context->duty_cycle_tracking);
+
+    _context->duty_cycle_threshold_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_DUTY_CYCLE_THRESHOLD_ENV_VAR),
+            _context->duty_cycle_threshold_ns,
+            1,
+            INT64_MAX);
+
+    _context->ipc_client_publisher_limit =
+        aeron_config_parse_bool(
+            getenv(AERON_IPC_CLIENT_PUBLISHER_LIMIT_ENV_VAR),
+            _context->ipc_client_publisher_limit);
+
+    _context->ipc_subscriber_wakeup =
+        aeron_config_parse_bool(
+            getenv(AERON_IPC_SUBSCRIBER_WAKEUP_ENV_VAR),
+            _context->ipc_subscriber_wakeup);
+
+    _context->rcv_nak_suppression =
+        aeron_config_parse_bool(
+            getenv(AERON_RCV_NAK_SUPPRESSION_ENV_VAR),
+            _context->rcv_nak_suppression);
+
+    _context->available_image_batching =
+        aeron_config_parse_bool(
+            getenv(AERON_AVAILABLE_IMAGE_BATCHING_ENV_VAR),
+            _context->available_image_batching);
+
+    _context->durable_sync_interval_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_DURABLE_SYNC_INTERVAL_ENV_VAR),
+            _context->durable_sync_interval_ns,
+            0,
+            INT64_MAX);
+
     _context->to_driver_buffer = NULL;
     _context->to_clients_buffer = NULL;
     _context->counters_values_buffer = NULL;
@@ -521,6 +978,22 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->nano_clock = aeron_nanoclock;
     _context->epoch_clock = aeron_epochclock;
 
+    if ((value = getenv(AERON_NANO_CLOCK_ENV_VAR)) && strcmp(value, "system") != 0)
+    {
+        if (strcmp(value, "tsc") != 0)
+        {
+            aeron_set_err(EINVAL, "unknown nano clock: %s", value);
+            return -1;
+        }
+
+        if (!aeron_tsc_clock_is_calibrated() && aeron_tsc_clock_calibrate(AERON_TSC_CLOCK_CALIBRATION_NS) < 0)
+        {
+            return -1;
+        }
+
+        _context->nano_clock = aeron_tsc_nanoclock;
+    }
+
     _context->conductor_idle_strategy_func =
         aeron_idle_strategy_load(
             AERON_CONFIG_GETENV_OR_DEFAULT(AERON_CONDUCTOR_IDLE_STRATEGY_ENV_VAR, "yielding"),
@@ -584,15 +1057,20 @@ int aeron_driver_context_close(aeron_driver_context_t *context)
     }
 
     aeron_mpsc_concurrent_array_queue_close(&context->conductor_command_queue);
-    aeron_spsc_concurrent_array_queue_close(&context->sender_command_queue);
-    aeron_spsc_concurrent_array_queue_close(&context->receiver_command_queue);
 
     aeron_unmap(&context->cnc_map);
     aeron_unmap(&context->loss_report);
+    aeron_unmap(&context->flow_control_trace_file);
+    aeron_unmap(&context->position_snapshot_file);
+    aeron_unmap(&context->stream_activity_file);
 
     aeron_free((void *)context->aeron_dir);
+    aeron_free((void *)context->durable_dir);
     aeron_free(context->conductor_idle_strategy_state);
     aeron_free(context->shared_idle_strategy_state);
+    aeron_free(context->shared_network_idle_strategy_state);
+    aeron_free(context->sender_idle_strategy_state);
+    aeron_free(context->receiver_idle_strategy_state);
     aeron_free(context);
     return 0;
 }
@@ -720,14 +1198,6 @@ bool aeron_is_driver_active(const char *dirname, int64_t timeout, int64_t now, a
     return result;
 }
 
-extern int32_t aeron_cnc_version_volatile(aeron_cnc_metadata_t *metadata);
-extern void aeron_cnc_version_signal_cnc_ready(aeron_cnc_metadata_t *metadata, int32_t cnc_version);
-extern uint8_t *aeron_cnc_to_driver_buffer(aeron_cnc_metadata_t *metadata);
-extern uint8_t *aeron_cnc_to_clients_buffer(aeron_cnc_metadata_t *metadata);
-extern uint8_t *aeron_cnc_counters_metadata_buffer(aeron_cnc_metadata_t *metadata);
-extern uint8_t *aeron_cnc_counters_values_buffer(aeron_cnc_metadata_t *metadata);
-extern uint8_t *aeron_cnc_error_log_buffer(aeron_cnc_metadata_t *metadata);
-extern size_t aeron_cnc_computed_length(size_t total_length_of_buffers, size_t alignment);
 extern size_t aeron_cnc_length(aeron_driver_context_t *context);
 
 extern size_t aeron_ipc_publication_term_window_length(aeron_driver_context_t *context, size_t term_length);
@@ -26,32 +26,19 @@
 #include "concurrent/aeron_mpsc_rb.h"
 #include "aeron_flow_control.h"
 #include "aeron_congestion_control.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
 #include "aeron_agent.h"
+#include "aeron_cnc_file_descriptor.h"
+#include "reports/aeron_flow_control_trace.h"
+#include "reports/aeron_position_snapshot.h"
+#include "reports/aeron_stream_activity.h"
 
-#define AERON_CNC_FILE "cnc.dat"
 #define AERON_LOSS_REPORT_FILE "loss-report.dat"
-#define AERON_CNC_VERSION (13)
-
-#pragma pack(push)
-#pragma pack(4)
-typedef struct aeron_cnc_metadata_stct
-{
-    int32_t cnc_version;
-    int32_t to_driver_buffer_length;
-    int32_t to_clients_buffer_length;
-    int32_t counter_metadata_buffer_length;
-    int32_t counter_values_buffer_length;
-    int32_t error_log_buffer_length;
-    int64_t client_liveness_timeout;
-    int64_t start_timestamp;
-    int64_t pid;
-}
-aeron_cnc_metadata_t;
-#pragma pack(pop)
-
-#define AERON_CNC_VERSION_AND_META_DATA_LENGTH (AERON_ALIGN(sizeof(aeron_cnc_metadata_t), AERON_CACHE_LINE_LENGTH * 2))
 
 #define AERON_COMMAND_QUEUE_CAPACITY (256)
+#define AERON_DRIVER_SENDER_MAX_COUNT (16)
+#define AERON_DRIVER_RECEIVER_MAX_COUNT (16)
+#define AERON_DRIVER_MAX_IO_VECTOR_CAPACITY (1024)
 
 typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
 
@@ -74,21 +61,59 @@ aeron_threading_mode_t;
 typedef struct aeron_driver_context_stct
 {
     char *aeron_dir;                            /* aeron.dir */
+    char *durable_dir;                          /* aeron.durable.dir = NULL */
     aeron_threading_mode_t threading_mode;      /* aeron.threading.mode = DEDICATED */
     bool dirs_delete_on_start;                  /* aeron.dir.delete.on.start = false */
+    bool dirs_warm_restart;                     /* aeron.dir.warm.restart = false */
     bool warn_if_dirs_exist;
     bool term_buffer_sparse_file;               /* aeron.term.buffer.sparse.file = false */
+    bool term_buffer_prefault;                  /* aeron.term.buffer.prefault = false */
+    bool term_buffer_lock;                      /* aeron.term.buffer.lock = false */
+    bool term_buffer_release_pages;             /* aeron.term.buffer.release.pages = false */
+    uint64_t term_buffer_auto_size_target_ns;   /* aeron.term.buffer.auto.size.target = 0 */
     bool perform_storage_checks;                /* aeron.perform.storage.checks = true */
     bool spies_simulate_connection;             /* aeron.spies.simulate.connection = false */
+    bool socket_io_uring;                       /* aeron.socket.io_uring = false */
+    bool socket_gso;                            /* aeron.socket.gso = false */
+    bool socket_gro;                            /* aeron.socket.gro = false */
+    uint32_t socket_busy_poll_us;               /* aeron.socket.busy.poll = 0 */
+    bool socket_prefer_busy_poll;               /* aeron.socket.prefer.busy.poll = false */
+    bool socket_rx_timestamping;                /* aeron.socket.rx.timestamping = false */
+    bool stream_stats;                          /* aeron.stream.stats = false */
+    bool socket_connected_send;                 /* aeron.socket.connected.send = false */
+    bool socket_drop_monitoring;                /* aeron.socket.drop.monitoring = false */
+    bool send_pacing;                           /* aeron.send.pacing = false */
+    bool send_to_sm_poll_adaptive;              /* aeron.send.to.status.poll.adaptive = false */
+    bool pmtu_discovery;                        /* aeron.pmtu.discovery = false */
+    bool status_message_adaptive;               /* aeron.rcv.status.message.adaptive = false */
+    bool numa_bind_log_buffers;                 /* aeron.numa.bind.log.buffers = false */
+    int32_t conductor_cpu_affinity;             /* aeron.conductor.cpu.affinity = -1 */
+    int32_t sender_cpu_affinity;                /* aeron.sender.cpu.affinity = -1 */
+    int32_t receiver_cpu_affinity;              /* aeron.receiver.cpu.affinity = -1 */
+    int32_t shared_network_cpu_affinity;        /* aeron.shared.network.cpu.affinity = -1 */
+    int32_t shared_cpu_affinity;                /* aeron.shared.cpu.affinity = -1 */
     uint64_t driver_timeout_ms;
     uint64_t client_liveness_timeout_ns;        /* aeron.client.liveness.timeout = 5s */
     uint64_t publication_linger_timeout_ns;     /* aeron.publication.linger.timeout = 5s */
+    uint64_t publication_resume_timeout_ns;     /* aeron.publication.resume.timeout = 30s */
     uint64_t status_message_timeout_ns;         /* aeron.rcv.status.message.timeout = 200ms */
     uint64_t image_liveness_timeout_ns;         /* aeron.image.liveness.timeout = 10s */
+    uint64_t rcv_reorder_window_max_ns;         /* aeron.rcv.reorder.window.max = 0 */
+    uint64_t rcv_gap_fill_delay_ns;             /* aeron.rcv.gap.fill.delay = 0 */
     uint64_t publication_unblock_timeout_ns;    /* aeron.publication.unblock.timeout = 10s */
+    uint64_t publication_unblock_timeout_min_ns; /* aeron.publication.unblock.timeout.min = 0 */
     uint64_t publication_connection_timeout_ns; /* aeron.publication.connection.timeout = 5s */
     uint64_t timer_interval_ns;                 /* aeron.timer.interval = 1s */
     uint64_t counter_free_to_reuse_ns;          /* aeron.counters.free.to.reuse.timeout = 1s */
+    uint64_t udp_channel_cache_ttl_ns;          /* aeron.udp.channel.cache.ttl = 1s */
+    bool async_name_resolution;                 /* aeron.async.name.resolution = false */
+    bool duty_cycle_tracking;                   /* aeron.duty.cycle.tracking = false */
+    uint64_t duty_cycle_threshold_ns;           /* aeron.duty.cycle.threshold = 1ms */
+    bool ipc_client_publisher_limit;            /* aeron.ipc.client.publisher.limit = false */
+    bool ipc_subscriber_wakeup;                 /* aeron.ipc.subscriber.wakeup = false */
+    bool available_image_batching;              /* aeron.available.image.batching = false */
+    bool rcv_nak_suppression;                   /* aeron.rcv.nak.suppression = false */
+    uint64_t durable_sync_interval_ns;          /* aeron.durable.sync.interval = 1ms */
     size_t to_driver_buffer_length;             /* aeron.conductor.buffer.length = 1MB + trailer*/
     size_t to_clients_buffer_length;            /* aeron.clients.buffer.length = 1MB + trailer */
     size_t counters_values_buffer_length;       /* aeron.counters.buffer.length = 1MB */
@@ -96,20 +121,41 @@ typedef struct aeron_driver_context_stct
     size_t error_buffer_length;                 /* aeron.error.buffer.length = 1MB */
     size_t term_buffer_length;                  /* aeron.term.buffer.length = 16 * 1024 * 1024 */
     size_t ipc_term_buffer_length;              /* aeron.ipc.term.buffer.length = 64 * 1024 * 1024 */
+    size_t term_buffer_clean_chunk_length;      /* aeron.term.buffer.clean.chunk.length = 64KB */
     size_t mtu_length;                          /* aeron.mtu.length = 1408 */
     size_t ipc_mtu_length;                      /* aeron.ipc.mtu.length = 1408 */
     size_t ipc_publication_window_length;       /* aeron.ipc.publication.term.window.length = 0 */
     size_t publication_window_length;           /* aeron.publication.term.window.length = 0 */
     size_t socket_rcvbuf;                       /* aeron.socket.so_rcvbuf = 128 * 1024 */
+    size_t socket_rcvbuf_max;                   /* aeron.socket.so_rcvbuf.max = 0 */
     size_t socket_sndbuf;                       /* aeron.socket.so_sndbuf = 0 */
     size_t send_to_sm_poll_ratio;               /* aeron.send.to.status.poll.ratio = 4 */
     size_t initial_window_length;               /* aeron.rcv.initial.window.length = 128KB */
+    size_t rcv_non_temporal_copy_threshold;     /* aeron.rcv.non.temporal.copy.threshold = 0 */
     size_t loss_report_length;                  /* aeron.loss.report.buffer.length = 1MB */
+    size_t flow_control_trace_length;           /* aeron.flow.control.trace.buffer.length = 0 */
+    size_t position_snapshot_capacity;          /* aeron.position.snapshot.capacity = 0 */
+    size_t stream_activity_capacity;            /* aeron.stream.activity.capacity = 0 */
     size_t file_page_size;                      /* aeron.file.page.size = 4KB */
+    size_t sender_count;                        /* aeron.sender.count = 1 */
+    size_t receiver_count;                      /* aeron.receiver.count = 1 */
+    size_t sender_io_vector_capacity;           /* aeron.sender.io.vector.capacity = 2 */
+    size_t receiver_io_vector_capacity;         /* aeron.receiver.io.vector.capacity = 2 */
+    size_t raw_log_pool_size;                   /* aeron.raw.log.pool.size = 0 */
+    size_t pmtu_discovery_max_length;           /* aeron.pmtu.discovery.max.length = 8960 */
+    bool receiver_group_tag_is_set;
+    int64_t receiver_group_tag;                 /* aeron.receiver.group.tag = unset */
+    bool cubic_cc_measure_rtt;                  /* aeron.CubicCongestionControl.measureRtt = false */
+    bool cubic_cc_tcp_mode;                     /* aeron.CubicCongestionControl.tcpMode = false */
+    uint64_t cubic_cc_initial_rtt_ns;           /* aeron.CubicCongestionControl.initialRtt = 100us */
     uint8_t multicast_ttl;                      /* aeron.socket.multicast.ttl = 0 */
 
     aeron_mapped_file_t cnc_map;
     aeron_mapped_file_t loss_report;
+    aeron_mapped_file_t flow_control_trace_file;
+    aeron_flow_control_trace_t flow_control_trace;
+    aeron_mapped_file_t position_snapshot_file;
+    aeron_mapped_file_t stream_activity_file;
 
     uint8_t *to_driver_buffer;
     uint8_t *to_clients_buffer;
@@ -120,8 +166,6 @@ typedef struct aeron_driver_context_stct
     aeron_clock_func_t nano_clock;
     aeron_clock_func_t epoch_clock;
 
-    aeron_spsc_concurrent_array_queue_t sender_command_queue;
-    aeron_spsc_concurrent_array_queue_t receiver_command_queue;
     aeron_mpsc_concurrent_array_queue_t conductor_command_queue;
 
     aeron_agent_on_start_func_t agent_on_start_func;
@@ -141,15 +185,22 @@ typedef struct aeron_driver_context_stct
     aeron_usable_fs_space_func_t usable_fs_space_func;
     aeron_map_raw_log_func_t map_raw_log_func;
     aeron_map_raw_log_close_func_t map_raw_log_close_func;
+    struct aeron_raw_log_pool_stct *raw_log_pool;
+    struct aeron_name_resolver_stct *name_resolver;
+    struct aeron_durable_log_syncer_stct *durable_log_syncer;
 
     aeron_flow_control_strategy_supplier_func_t unicast_flow_control_supplier_func;
     aeron_flow_control_strategy_supplier_func_t multicast_flow_control_supplier_func;
 
     aeron_congestion_control_strategy_supplier_func_t congestion_control_supplier_func;
 
+    aeron_udp_channel_transport_bindings_t *udp_channel_transport_bindings;
+
     aeron_driver_conductor_proxy_t *conductor_proxy;
     aeron_driver_sender_proxy_t *sender_proxy;
+    aeron_driver_sender_proxy_t *sender_proxies[AERON_DRIVER_SENDER_MAX_COUNT];
     aeron_driver_receiver_proxy_t *receiver_proxy;
+    aeron_driver_receiver_proxy_t *receiver_proxies[AERON_DRIVER_RECEIVER_MAX_COUNT];
 
     aeron_driver_conductor_to_driver_interceptor_func_t to_driver_interceptor_func;
     aeron_driver_conductor_to_client_interceptor_func_t to_client_interceptor_func;
@@ -162,57 +213,10 @@ void aeron_driver_fill_cnc_metadata(aeron_driver_context_t *context);
 
 int aeron_driver_context_validate_mtu_length(uint64_t mtu_length);
 
-inline int32_t aeron_cnc_version_volatile(aeron_cnc_metadata_t *metadata)
-{
-    int32_t cnc_version;
-    AERON_GET_VOLATILE(cnc_version, metadata->cnc_version);
-    return cnc_version;
-}
-
-inline void aeron_cnc_version_signal_cnc_ready(aeron_cnc_metadata_t *metadata, int32_t cnc_version)
-{
-    AERON_PUT_VOLATILE(metadata->cnc_version, cnc_version);
-}
-
-inline uint8_t *aeron_cnc_to_driver_buffer(aeron_cnc_metadata_t *metadata)
-{
-    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH;
-}
-
-inline uint8_t *aeron_cnc_to_clients_buffer(aeron_cnc_metadata_t *metadata)
-{
-    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH +
-        metadata->to_driver_buffer_length;
-}
-
-inline uint8_t *aeron_cnc_counters_metadata_buffer(aeron_cnc_metadata_t *metadata)
-{
-    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH +
-        metadata->to_driver_buffer_length +
-        metadata->to_clients_buffer_length;
-}
-
-inline uint8_t *aeron_cnc_counters_values_buffer(aeron_cnc_metadata_t *metadata)
-{
-    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH +
-        metadata->to_driver_buffer_length +
-        metadata->to_clients_buffer_length +
-        metadata->counter_metadata_buffer_length;
-}
-
-inline uint8_t *aeron_cnc_error_log_buffer(aeron_cnc_metadata_t *metadata)
-{
-    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH +
-        metadata->to_driver_buffer_length +
-        metadata->to_clients_buffer_length +
-        metadata->counter_metadata_buffer_length +
-        metadata->counter_values_buffer_length;
-}
-
-inline size_t aeron_cnc_computed_length(size_t total_length_of_buffers, size_t alignment)
-{
-    return AERON_ALIGN(AERON_CNC_VERSION_AND_META_DATA_LENGTH + total_length_of_buffers, alignment);
-}
+bool aeron_config_parse_bool(const char *str, bool def);
+uint64_t aeron_config_parse_uint64(const char *str, uint64_t def, uint64_t min, uint64_t max);
+int32_t aeron_config_parse_int32(const char *str, int32_t def, int32_t min, int32_t max);
+int64_t aeron_config_parse_int64(const char *str, int64_t def, int64_t min, int64_t max);
 
 inline size_t aeron_cnc_length(aeron_driver_context_t *context)
 {
@@ -227,7 +231,7 @@ inline size_t aeron_cnc_length(aeron_driver_context_t *context)
 
 inline size_t aeron_ipc_publication_term_window_length(aeron_driver_context_t *context, size_t term_length)
 {
-    size_t publication_term_window_length = term_length;
+    size_t publication_term_window_length = (AERON_LOGBUFFER_PARTITION_COUNT - 2) * term_length;
 
     if (0 != context->ipc_publication_window_length)
     {
@@ -241,7 +245,7 @@ inline size_t aeron_ipc_publication_term_window_length(aeron_driver_context_t *c
 
 inline size_t aeron_network_publication_term_window_length(aeron_driver_context_t *context, size_t term_length)
 {
-    size_t publication_term_window_length = term_length / 2;
+    size_t publication_term_window_length = (size_t)aeron_logbuffer_max_window_length((int64_t)term_length);
 
     if (0 != context->publication_window_length)
     {
@@ -21,10 +21,14 @@
 
 #include <sys/socket.h>
 #include <stdio.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
 #include "util/aeron_arrayutil.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_driver_receiver.h"
 #include "aeron_publication_image.h"
+#include "aeron_driver_conductor_proxy.h"
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
@@ -34,36 +38,145 @@ struct mmsghdr
 };
 #endif
 
+/*
+ * Pending setups are kept as a binary min heap on the time of their last status message, so a duty cycle looks at
+ * no more than the setups that are due rather than walking every one of them.
+ */
+static inline bool aeron_driver_receiver_pending_setup_is_before(
+    aeron_driver_receiver_pending_setup_entry_t *array, size_t a, size_t b)
+{
+    return array[a].time_of_status_message_ns < array[b].time_of_status_message_ns;
+}
+
+static inline void aeron_driver_receiver_pending_setup_swap(
+    aeron_driver_receiver_pending_setup_entry_t *array, size_t a, size_t b)
+{
+    aeron_driver_receiver_pending_setup_entry_t entry = array[a];
+    array[a] = array[b];
+    array[b] = entry;
+}
+
+static void aeron_driver_receiver_pending_setups_sift_up(
+    aeron_driver_receiver_pending_setup_entry_t *array, size_t index)
+{
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (!aeron_driver_receiver_pending_setup_is_before(array, index, parent))
+        {
+            break;
+        }
+
+        aeron_driver_receiver_pending_setup_swap(array, index, parent);
+        index = parent;
+    }
+}
+
+static void aeron_driver_receiver_pending_setups_sift_down(
+    aeron_driver_receiver_pending_setup_entry_t *array, size_t index, size_t length)
+{
+    while (true)
+    {
+        size_t least = index;
+        size_t left = (2 * index) + 1;
+        size_t right = left + 1;
+
+        if (left < length && aeron_driver_receiver_pending_setup_is_before(array, left, least))
+        {
+            least = left;
+        }
+
+        if (right < length && aeron_driver_receiver_pending_setup_is_before(array, right, least))
+        {
+            least = right;
+        }
+
+        if (least == index)
+        {
+            break;
+        }
+
+        aeron_driver_receiver_pending_setup_swap(array, index, least);
+        index = least;
+    }
+}
+
 int aeron_driver_receiver_init(
     aeron_driver_receiver_t *receiver,
     aeron_driver_context_t *context,
     aeron_system_counters_t *system_counters,
     aeron_distinct_error_log_t *error_log)
 {
-    if (aeron_udp_transport_poller_init(&receiver->poller) < 0)
+    if (aeron_spsc_concurrent_array_queue_init(&receiver->command_queue, AERON_COMMAND_QUEUE_CAPACITY) < 0 ||
+        aeron_spsc_concurrent_array_queue_init(
+            &receiver->pending_image_queue, AERON_DRIVER_RECEIVER_PENDING_IMAGE_QUEUE_CAPACITY) < 0 ||
+        aeron_driver_command_pool_init(
+            &receiver->receiver_proxy.command_pool,
+            sizeof(aeron_command_remove_cooldown_t),
+            AERON_DRIVER_COMMAND_POOL_CAPACITY) < 0 ||
+        aeron_driver_command_pool_init(
+            &receiver->conductor_command_pool,
+            sizeof(aeron_command_create_publication_image_t),
+            AERON_DRIVER_COMMAND_POOL_CAPACITY) < 0)
     {
         return -1;
     }
 
-    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS; i++)
+    if (aeron_udp_transport_poller_init(
+        &receiver->poller, context->socket_io_uring, AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH) < 0)
     {
-        size_t offset = 0;
-        if (aeron_alloc_aligned(
-            (void **)&receiver->recv_buffers.buffers[i],
-            &offset,
-            AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH,
-            AERON_CACHE_LINE_LENGTH * 2) < 0)
-        {
-            int errcode = errno;
+        return -1;
+    }
 
-            aeron_set_err(errcode, "%s:%d: %s", __FILE__, __LINE__, strerror(errcode));
-            return -1;
-        }
+    size_t vlen = context->receiver_io_vector_capacity;
+    size_t buffer_offset = 0, mmsghdr_offset = 0;
+
+    receiver->recv_buffers.vlen = vlen;
+    if (aeron_alloc_aligned(
+        (void **)&receiver->recv_buffers.buffer_memory,
+        &buffer_offset,
+        vlen * AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH,
+        AERON_CACHE_LINE_LENGTH * 2) < 0 ||
+        aeron_alloc_aligned(
+            (void **)&receiver->recv_buffers.mmsghdr_memory,
+            &mmsghdr_offset,
+            vlen * sizeof(struct mmsghdr),
+            AERON_CACHE_LINE_LENGTH) < 0 ||
+        aeron_alloc((void **)&receiver->recv_buffers.iov, vlen * sizeof(struct iovec)) < 0 ||
+        aeron_alloc((void **)&receiver->recv_buffers.addrs, vlen * sizeof(struct sockaddr_storage)) < 0 ||
+        aeron_alloc(
+            (void **)&receiver->recv_buffers.control, vlen * sizeof(aeron_udp_channel_transport_control_t)) < 0 ||
+        aeron_alloc(
+            (void **)&receiver->pending_packets.images,
+            AERON_DRIVER_RECEIVER_PENDING_PACKETS_CAPACITY * sizeof(aeron_publication_image_t *)) < 0 ||
+        aeron_alloc(
+            (void **)&receiver->pending_packets.packets,
+            AERON_DRIVER_RECEIVER_PENDING_PACKETS_CAPACITY * sizeof(aeron_publication_image_packet_t)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "%s:%d: %s", __FILE__, __LINE__, strerror(errcode));
+        return -1;
+    }
+
+    receiver->recv_buffers.mmsghdrs = (struct mmsghdr *)(receiver->recv_buffers.mmsghdr_memory + mmsghdr_offset);
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        struct msghdr *msg_hdr = &receiver->recv_buffers.mmsghdrs[i].msg_hdr;
 
-        receiver->recv_buffers.iov[i].iov_base = receiver->recv_buffers.buffers[i] + offset;
+        receiver->recv_buffers.iov[i].iov_base =
+            receiver->recv_buffers.buffer_memory + buffer_offset + (i * AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH);
         receiver->recv_buffers.iov[i].iov_len = AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH;
+
+        msg_hdr->msg_name = &receiver->recv_buffers.addrs[i];
+        msg_hdr->msg_iov = &receiver->recv_buffers.iov[i];
+        msg_hdr->msg_iovlen = 1;
+        msg_hdr->msg_control = receiver->recv_buffers.control[i].buffer;
     }
 
+    receiver->pending_packets.length = 0;
+
     receiver->images.array = NULL;
     receiver->images.length = 0;
     receiver->images.capacity = 0;
@@ -74,12 +187,20 @@ int aeron_driver_receiver_init(
 
     receiver->context = context;
     receiver->error_log = error_log;
-
-    receiver->receiver_proxy.command_queue = &context->receiver_command_queue;
+    receiver->incoming_cpu_check_deadline_ns = 0;
+    receiver->socket_drops_check_deadline_ns = 0;
+    receiver->rttm_check_deadline_ns = 0;
+    aeron_position_snapshot_writer_init(&receiver->position_snapshot, NULL, 0);
+    receiver->pending_images_overflowed = false;
+
+    receiver->receiver_proxy.command_queue = &receiver->command_queue;
+    receiver->receiver_proxy.pending_image_queue = &receiver->pending_image_queue;
     receiver->receiver_proxy.fail_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RECEIVER_PROXY_FAILS);
     receiver->receiver_proxy.threading_mode = context->threading_mode;
     receiver->receiver_proxy.receiver = receiver;
+    receiver->receiver_proxy.numa_node = -1;
+    receiver->receiver_proxy.endpoint_count = 0;
 
     receiver->errors_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_ERRORS);
@@ -87,6 +208,8 @@ int aeron_driver_receiver_init(
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS);
     receiver->total_bytes_received_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_BYTES_RECEIVED);
+    receiver->incoming_cpu_misalignments_counter =
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RECEIVER_INCOMING_CPU_MISALIGNMENTS);
     return 0;
 }
 
@@ -97,9 +220,124 @@ void aeron_driver_receiver_on_command(void *clientd, volatile void *item)
     cmd->func(clientd, cmd);
 }
 
+/*
+ * Count transports whose packets the kernel last processed on a different CPU to the one the receiver is running on,
+ * which indicates the NIC queue feeding the socket is not aligned with the receiver core.
+ */
+static void aeron_driver_receiver_check_incoming_cpu(aeron_driver_receiver_t *receiver)
+{
+#if defined(__linux__)
+    int current_cpu = sched_getcpu();
+
+    if (current_cpu < 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0, length = receiver->poller.transports.length; i < length; i++)
+    {
+        aeron_udp_channel_transport_t *transport = receiver->poller.transports.array[i].transport;
+        int incoming_cpu;
+
+        if (aeron_udp_channel_transport_get_incoming_cpu(transport, &incoming_cpu) < 0)
+        {
+            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver incoming cpu: %s", aeron_errmsg());
+            continue;
+        }
+
+        if (incoming_cpu >= 0 && incoming_cpu != current_cpu)
+        {
+            aeron_counter_increment(receiver->incoming_cpu_misalignments_counter, 1);
+        }
+    }
+#endif
+}
+
+static void aeron_driver_receiver_check_socket_drops(aeron_driver_receiver_t *receiver)
+{
+    for (size_t i = 0, length = receiver->poller.transports.length; i < length; i++)
+    {
+        aeron_receive_channel_endpoint_t *endpoint = receiver->poller.transports.array[i].transport->dispatch_clientd;
+
+        if (endpoint->drop_monitoring && aeron_receive_channel_endpoint_check_socket_drops(endpoint) < 0)
+        {
+            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver socket drops: %s", aeron_errmsg());
+        }
+    }
+}
+
+static void aeron_driver_receiver_flush_control_frames(aeron_driver_receiver_t *receiver)
+{
+    for (size_t i = 0, length = receiver->poller.transports.length; i < length; i++)
+    {
+        aeron_receive_channel_endpoint_t *endpoint = receiver->poller.transports.array[i].transport->dispatch_clientd;
+
+        if (endpoint->control_batch.length > 0 && aeron_receive_channel_endpoint_flush(endpoint) < 0)
+        {
+            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send control frames: %s", aeron_errmsg());
+        }
+    }
+}
+
+/*
+ * Send the status message and NAK scheduled for an image. The flag is cleared first, with a full fence, so a change
+ * the conductor publishes from here on queues the image again.
+ */
+static int aeron_driver_receiver_service_image(aeron_driver_receiver_t *receiver, aeron_publication_image_t *image)
+{
+    int work_count = 0;
+
+    aeron_cmpxchg32(&image->receiver_fields.is_service_pending, 1, 0);
+
+    int send_sm_result = aeron_publication_image_send_pending_status_message(image);
+    if (send_sm_result < 0)
+    {
+        AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send SM: %s", aeron_errmsg());
+    }
+
+    work_count += (send_sm_result < 0) ? 0 : send_sm_result;
+
+    int send_nak_result = aeron_publication_image_send_pending_loss(image);
+    if (send_nak_result < 0)
+    {
+        AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send NAK: %s", aeron_errmsg());
+    }
+
+    work_count += (send_nak_result < 0) ? 0 : send_nak_result;
+
+    return work_count;
+}
+
+static void aeron_driver_receiver_on_image_pending(void *clientd, volatile void *item)
+{
+    aeron_driver_receiver_service_image((aeron_driver_receiver_t *)clientd, (aeron_publication_image_t *)item);
+}
+
+static void aeron_driver_receiver_snapshot_positions(aeron_driver_receiver_t *receiver, int64_t now_ns)
+{
+    aeron_position_snapshot_writer_t *writer = &receiver->position_snapshot;
+
+    aeron_position_snapshot_begin(writer);
+
+    for (size_t i = 0, length = receiver->images.length; i < length; i++)
+    {
+        aeron_publication_image_t *image = receiver->images.array[i].image;
+
+        aeron_position_snapshot_put(
+            writer,
+            aeron_publication_image_registration_id(image),
+            image->session_id,
+            image->stream_id,
+            aeron_counter_get_volatile(image->rcv_pos_position.value_addr),
+            aeron_counter_get(image->rcv_hwm_position.value_addr),
+            image->receiver_fields.last_sm_limit);
+    }
+
+    aeron_position_snapshot_end(writer, now_ns);
+}
+
 int aeron_driver_receiver_do_work(void *clientd)
 {
-    struct mmsghdr mmsghdr[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
     aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
     int64_t bytes_received = 0;
     int work_count = 0;
@@ -108,22 +346,22 @@ int aeron_driver_receiver_do_work(void *clientd)
         aeron_spsc_concurrent_array_queue_drain(
             receiver->receiver_proxy.command_queue, aeron_driver_receiver_on_command, receiver, 10);
 
-    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS; i++)
+    struct mmsghdr *mmsghdr = receiver->recv_buffers.mmsghdrs;
+
+    /* only reset what the kernel writes back, the rest is set up once in init */
+    for (size_t i = 0, vlen = receiver->recv_buffers.vlen; i < vlen; i++)
     {
-        mmsghdr[i].msg_hdr.msg_name = &receiver->recv_buffers.addrs[i];
-        mmsghdr[i].msg_hdr.msg_namelen = sizeof(receiver->recv_buffers.addrs[i]);
-        mmsghdr[i].msg_hdr.msg_iov = &receiver->recv_buffers.iov[i];
-        mmsghdr[i].msg_hdr.msg_iovlen = 1;
+        mmsghdr[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
         mmsghdr[i].msg_hdr.msg_flags = 0;
-        mmsghdr[i].msg_hdr.msg_control = NULL;
-        mmsghdr[i].msg_hdr.msg_controllen = 0;
+        mmsghdr[i].msg_hdr.msg_controllen = sizeof(receiver->recv_buffers.control[i].buffer);
         mmsghdr[i].msg_len = 0;
     }
 
     int poll_result = aeron_udp_transport_poller_poll(
         &receiver->poller,
         mmsghdr,
-        AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS,
+        receiver->recv_buffers.vlen,
+        &bytes_received,
         aeron_receive_channel_endpoint_dispatch,
         receiver);
 
@@ -132,102 +370,180 @@ int aeron_driver_receiver_do_work(void *clientd)
         AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver poller_poll: %s", aeron_errmsg());
     }
 
-    for (int i = 0; i < poll_result; i++)
+    work_count += (poll_result < 0) ? 0 : poll_result;
+
+    if (bytes_received > 0)
     {
-        bytes_received += mmsghdr[i].msg_len;
-        work_count++;
+        aeron_counter_increment(receiver->total_bytes_received_counter, bytes_received);
     }
 
-    aeron_counter_add_ordered(receiver->total_bytes_received_counter, bytes_received);
-
     int64_t now_ns = receiver->context->nano_clock();
 
-    for (size_t i = 0, length = receiver->images.length; i < length; i++)
+    if (NULL != receiver->position_snapshot.header)
     {
-        aeron_publication_image_t *image = receiver->images.array[i].image;
+        aeron_driver_receiver_snapshot_positions(receiver, now_ns);
+    }
 
-        int send_sm_result = aeron_publication_image_send_pending_status_message(image);
-        if (send_sm_result < 0)
-        {
-            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send SM: %s", aeron_errmsg());
-        }
+    if (now_ns > receiver->incoming_cpu_check_deadline_ns)
+    {
+        aeron_driver_receiver_check_incoming_cpu(receiver);
+        receiver->incoming_cpu_check_deadline_ns = now_ns + AERON_DRIVER_RECEIVER_INCOMING_CPU_CHECK_INTERVAL_NS;
+    }
+
+    if (now_ns > receiver->socket_drops_check_deadline_ns)
+    {
+        aeron_driver_receiver_check_socket_drops(receiver);
+        receiver->socket_drops_check_deadline_ns = now_ns + AERON_DRIVER_RECEIVER_SOCKET_DROPS_CHECK_INTERVAL_NS;
+    }
 
-        work_count += (send_sm_result < 0) ? 0 : send_sm_result;
+    bool pending_images_overflowed;
+    AERON_GET_VOLATILE(pending_images_overflowed, receiver->pending_images_overflowed);
 
-        int send_nak_result = aeron_publication_image_send_pending_loss(image);
-        if (send_nak_result < 0)
+    if (pending_images_overflowed)
+    {
+        AERON_PUT_ORDERED(receiver->pending_images_overflowed, false);
+
+        for (size_t i = 0, length = receiver->images.length; i < length; i++)
         {
-            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send NAK: %s", aeron_errmsg());
+            work_count += aeron_driver_receiver_service_image(receiver, receiver->images.array[i].image);
         }
+    }
 
-        work_count += (send_nak_result < 0) ? 0 : send_nak_result;
+    work_count += (int)aeron_spsc_concurrent_array_queue_drain_all(
+        &receiver->pending_image_queue, aeron_driver_receiver_on_image_pending, receiver);
 
-        int initiate_rttm_result = aeron_publication_image_initiate_rttm(image, now_ns);
-        if (send_nak_result < 0)
+    if (now_ns > receiver->rttm_check_deadline_ns)
+    {
+        for (size_t i = 0, length = receiver->images.length; i < length; i++)
         {
-            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send RTTM: %s", aeron_errmsg());
+            int initiate_rttm_result = aeron_publication_image_initiate_rttm(receiver->images.array[i].image, now_ns);
+            if (initiate_rttm_result < 0)
+            {
+                AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send RTTM: %s", aeron_errmsg());
+            }
+
+            work_count += (initiate_rttm_result < 0) ? 0 : initiate_rttm_result;
         }
 
-        work_count += (initiate_rttm_result < 0) ? 0 : initiate_rttm_result;
+        receiver->rttm_check_deadline_ns = now_ns + AERON_DRIVER_RECEIVER_RTTM_CHECK_INTERVAL_NS;
     }
 
-    for (int last_index = (int)receiver->pending_setups.length - 1, i = last_index; i >= 0; i--)
+    /*
+     * Due setups are popped off the heap to just past its end, where they wait with those that stay due until an
+     * endpoint elicits setup, and go back on the heap once no more are due.
+     */
+    aeron_driver_receiver_pending_setup_entry_t *pending_setups = receiver->pending_setups.array;
+    size_t heap_length = receiver->pending_setups.length;
+
+    while (heap_length > 0 &&
+        now_ns > (pending_setups[0].time_of_status_message_ns + AERON_DRIVER_RECEIVER_PENDING_SETUP_TIMEOUT_NS))
     {
-        aeron_driver_receiver_pending_setup_entry_t *entry = &receiver->pending_setups.array[i];
+        heap_length--;
+        aeron_driver_receiver_pending_setup_swap(pending_setups, 0, heap_length);
+        aeron_driver_receiver_pending_setups_sift_down(pending_setups, 0, heap_length);
+
+        aeron_driver_receiver_pending_setup_entry_t *entry = &pending_setups[heap_length];
 
-        if (now_ns > (entry->time_of_status_message_ns + AERON_DRIVER_RECEIVER_PENDING_SETUP_TIMEOUT_NS))
+        if (!entry->is_periodic)
         {
-            if (!entry->is_periodic)
+            if (aeron_receive_channel_endpoint_on_remove_pending_setup(
+                entry->endpoint, entry->session_id, entry->stream_id) < 0)
             {
-                if (aeron_receive_channel_endpoint_on_remove_pending_setup(
-                    entry->endpoint, entry->session_id, entry->stream_id) < 0)
-                {
-                    AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver pending setups: %s", aeron_errmsg());
-                }
-
-                aeron_array_fast_unordered_remove(
-                    (uint8_t *) receiver->pending_setups.array,
-                    sizeof(aeron_driver_receiver_pending_setup_entry_t),
-                    (size_t) i,
-                    (size_t) last_index);
-                last_index--;
-                receiver->pending_setups.length--;
+                AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver pending setups: %s", aeron_errmsg());
             }
-            else if (aeron_receive_channel_endpoint_should_elicit_setup_message(entry->endpoint))
+
+            receiver->pending_setups.length--;
+            pending_setups[heap_length] = pending_setups[receiver->pending_setups.length];
+        }
+        else if (aeron_receive_channel_endpoint_should_elicit_setup_message(entry->endpoint))
+        {
+            if (aeron_receive_channel_endpoint_send_sm(
+                entry->endpoint,
+                &entry->control_addr,
+                entry->stream_id,
+                entry->session_id,
+                0,
+                0,
+                0,
+                AERON_STATUS_MESSAGE_HEADER_SEND_SETUP_FLAG) < 0)
             {
-                if (aeron_receive_channel_endpoint_send_sm(
-                    entry->endpoint,
-                    &entry->control_addr,
-                    entry->stream_id,
-                    entry->session_id,
-                    0,
-                    0,
-                    0,
-                    AERON_STATUS_MESSAGE_HEADER_SEND_SETUP_FLAG) < 0)
-                {
-                    AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send periodic SM: %s", aeron_errmsg());
-                }
-                entry->time_of_status_message_ns = now_ns;
+                AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send periodic SM: %s", aeron_errmsg());
             }
+            entry->time_of_status_message_ns = now_ns;
         }
     }
 
+    for (; heap_length < receiver->pending_setups.length; heap_length++)
+    {
+        aeron_driver_receiver_pending_setups_sift_up(pending_setups, heap_length);
+    }
+
+    aeron_driver_receiver_flush_control_frames(receiver);
+
     return work_count;
 }
 
-void aeron_driver_receiver_on_close(void *clientd)
+void aeron_driver_receiver_defer_packet(
+    aeron_driver_receiver_t *receiver,
+    aeron_publication_image_t *image,
+    const uint8_t *buffer,
+    size_t length,
+    int64_t recv_timestamp_ns)
 {
-    aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
+    if (AERON_DRIVER_RECEIVER_PENDING_PACKETS_CAPACITY == receiver->pending_packets.length)
+    {
+        aeron_driver_receiver_insert_pending_packets(receiver);
+    }
 
-    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS; i++)
+    const size_t index = receiver->pending_packets.length++;
+    aeron_publication_image_packet_t *packet = &receiver->pending_packets.packets[index];
+
+    receiver->pending_packets.images[index] = image;
+    packet->buffer = buffer;
+    packet->length = length;
+    packet->recv_timestamp_ns = recv_timestamp_ns;
+}
+
+void aeron_driver_receiver_insert_pending_packets(aeron_driver_receiver_t *receiver)
+{
+    aeron_publication_image_t **images = receiver->pending_packets.images;
+
+    for (size_t i = 0, length = receiver->pending_packets.length; i < length;)
     {
-        aeron_free(receiver->recv_buffers.buffers[i]);
+        size_t end = i + 1;
+
+        while (end < length && images[end] == images[i])
+        {
+            end++;
+        }
+
+        aeron_publication_image_insert_packets(images[i], &receiver->pending_packets.packets[i], end - i);
+        i = end;
     }
 
+    receiver->pending_packets.length = 0;
+}
+
+void aeron_driver_receiver_on_close(void *clientd)
+{
+    aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
+
+    aeron_free(receiver->recv_buffers.buffer_memory);
+    aeron_free(receiver->recv_buffers.mmsghdr_memory);
+    aeron_free(receiver->recv_buffers.iov);
+    aeron_free(receiver->recv_buffers.addrs);
+    aeron_free(receiver->recv_buffers.control);
+
     aeron_free(receiver->images.array);
     aeron_free(receiver->pending_setups.array);
+    aeron_free(receiver->pending_packets.images);
+    aeron_free(receiver->pending_packets.packets);
 
     aeron_udp_transport_poller_close(&receiver->poller);
+    aeron_spsc_concurrent_array_queue_close(&receiver->command_queue);
+    aeron_spsc_concurrent_array_queue_close(&receiver->pending_image_queue);
+    aeron_driver_command_pool_close(&receiver->receiver_proxy.command_pool);
+    aeron_driver_command_pool_close(&receiver->conductor_command_pool);
 }
 
 void aeron_driver_receiver_on_add_endpoint(void *clientd, void *command)
@@ -237,7 +553,9 @@ void aeron_driver_receiver_on_add_endpoint(void *clientd, void *command)
     aeron_receive_channel_endpoint_t *endpoint = (aeron_receive_channel_endpoint_t *)cmd->item;
     aeron_udp_channel_t *udp_channel = endpoint->conductor_fields.udp_channel;
 
-    if (aeron_udp_transport_poller_add(&receiver->poller, &endpoint->transport) < 0)
+    if (aeron_udp_transport_poller_add(&receiver->poller, &endpoint->transport) < 0 ||
+        (-1 != endpoint->control_transport.fd &&
+        aeron_udp_transport_poller_add(&receiver->poller, &endpoint->control_transport) < 0))
     {
         AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_add_endpoint: %s", aeron_errmsg());
     }
@@ -272,7 +590,9 @@ void aeron_driver_receiver_on_remove_endpoint(void *clientd, void *command)
     aeron_command_base_t *cmd = (aeron_command_base_t *)command;
     aeron_receive_channel_endpoint_t *endpoint = (aeron_receive_channel_endpoint_t *)cmd->item;
 
-    if (aeron_udp_transport_poller_remove(&receiver->poller, &endpoint->transport) < 0)
+    if (aeron_udp_transport_poller_remove(&receiver->poller, &endpoint->transport) < 0 ||
+        (-1 != endpoint->control_transport.fd &&
+        aeron_udp_transport_poller_remove(&receiver->poller, &endpoint->control_transport) < 0))
     {
         AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_remove_endpoint: %s", aeron_errmsg());
     }
@@ -293,6 +613,12 @@ void aeron_driver_receiver_on_remove_endpoint(void *clientd, void *command)
         }
     }
 
+    for (size_t i = receiver->pending_setups.length / 2; i > 0; i--)
+    {
+        aeron_driver_receiver_pending_setups_sift_down(
+            receiver->pending_setups.array, i - 1, receiver->pending_setups.length);
+    }
+
     aeron_receive_channel_endpoint_receiver_release(endpoint);
     aeron_driver_conductor_proxy_on_delete_cmd(receiver->context->conductor_proxy, command);
 }
@@ -325,6 +651,34 @@ void aeron_driver_receiver_on_remove_subscription(void *clientd, void *item)
     aeron_driver_conductor_proxy_on_delete_cmd(receiver->context->conductor_proxy, item);
 }
 
+void aeron_driver_receiver_on_add_subscription_range(void *clientd, void *item)
+{
+    aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
+    aeron_command_subscription_t *cmd = (aeron_command_subscription_t *)item;
+    aeron_receive_channel_endpoint_t *endpoint = (aeron_receive_channel_endpoint_t *)cmd->endpoint;
+
+    if (aeron_receive_channel_endpoint_on_add_subscription_range(endpoint, cmd->stream_id, cmd->stream_id_high) < 0)
+    {
+        AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_add_subscription_range: %s", aeron_errmsg());
+    }
+
+    aeron_driver_conductor_proxy_on_delete_cmd(receiver->context->conductor_proxy, item);
+}
+
+void aeron_driver_receiver_on_remove_subscription_range(void *clientd, void *item)
+{
+    aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
+    aeron_command_subscription_t *cmd = (aeron_command_subscription_t *)item;
+    aeron_receive_channel_endpoint_t *endpoint = (aeron_receive_channel_endpoint_t *)cmd->endpoint;
+
+    if (aeron_receive_channel_endpoint_on_remove_subscription_range(endpoint, cmd->stream_id, cmd->stream_id_high) < 0)
+    {
+        AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_remove_subscription_range: %s", aeron_errmsg());
+    }
+
+    aeron_driver_conductor_proxy_on_delete_cmd(receiver->context->conductor_proxy, item);
+}
+
 void aeron_driver_receiver_on_add_publication_image(void *clientd, void *item)
 {
     aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
@@ -415,6 +769,8 @@ int aeron_driver_receiver_add_pending_setup(
         entry->is_periodic = true;
     }
 
+    aeron_driver_receiver_pending_setups_sift_up(receiver->pending_setups.array, receiver->pending_setups.length - 1);
+
     return ensure_capacity_result;
 }
 
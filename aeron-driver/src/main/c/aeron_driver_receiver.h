@@ -23,10 +23,20 @@
 #include "aeron_driver_receiver_proxy.h"
 #include "aeron_system_counters.h"
 
-#define AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS (2)
 #define AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH (64 * 1024)
 
 #define AERON_DRIVER_RECEIVER_PENDING_SETUP_TIMEOUT_NS (1000 * 1000 * 1000L)
+#define AERON_DRIVER_RECEIVER_INCOMING_CPU_CHECK_INTERVAL_NS (1000 * 1000 * 1000L)
+#define AERON_DRIVER_RECEIVER_SOCKET_DROPS_CHECK_INTERVAL_NS (100 * 1000 * 1000L)
+
+/* RTT measurement timeouts are tens of milliseconds so images are only checked for one at this interval */
+#define AERON_DRIVER_RECEIVER_RTTM_CHECK_INTERVAL_NS (1000 * 1000L)
+
+/* when full the conductor flags an overflow and the receiver services every image once */
+#define AERON_DRIVER_RECEIVER_PENDING_IMAGE_QUEUE_CAPACITY (1024)
+
+/* data frames deferred from a recvmmsg vector are inserted early when this many are pending */
+#define AERON_DRIVER_RECEIVER_PENDING_PACKETS_CAPACITY (256)
 
 typedef struct aeron_driver_receiver_image_entry_stct
 {
@@ -48,16 +58,34 @@ aeron_driver_receiver_pending_setup_entry_t;
 typedef struct aeron_driver_receiver_stct
 {
     aeron_driver_receiver_proxy_t receiver_proxy;
+    aeron_spsc_concurrent_array_queue_t command_queue;
+    aeron_spsc_concurrent_array_queue_t pending_image_queue;
+    /* commands this receiver sends to the conductor, which come back here to be released */
+    aeron_driver_command_pool_t conductor_command_pool;
     aeron_udp_transport_poller_t poller;
 
     struct aeron_driver_receiver_buffers_stct
     {
-        uint8_t *buffers[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
-        struct iovec iov[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
-        struct sockaddr_storage addrs[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
+        size_t vlen;
+        uint8_t *buffer_memory;
+        uint8_t *mmsghdr_memory;
+        struct mmsghdr *mmsghdrs;
+        struct iovec *iov;
+        struct sockaddr_storage *addrs;
+        aeron_udp_channel_transport_control_t *control;
     }
     recv_buffers;
 
+    /* data frames of the recvmmsg vector being dispatched along with the images they were classified to, inserted
+     * once the whole vector has been classified so consecutive frames of an image are inserted together */
+    struct aeron_driver_receiver_pending_packets_stct
+    {
+        aeron_publication_image_t **images;
+        struct aeron_publication_image_packet_stct *packets;
+        size_t length;
+    }
+    pending_packets;
+
     struct aeron_driver_receiver_images_stct
     {
         aeron_driver_receiver_image_entry_t *array;
@@ -66,6 +94,7 @@ typedef struct aeron_driver_receiver_stct
     }
     images;
 
+    /* min heap on time_of_status_message_ns */
     struct aeron_driver_receiver_pending_setups_stct
     {
         aeron_driver_receiver_pending_setup_entry_t *array;
@@ -74,22 +103,33 @@ typedef struct aeron_driver_receiver_stct
     }
     pending_setups;
 
+    /* section of the position snapshot this receiver rewrites each duty cycle, header NULL when not enabled */
+    aeron_position_snapshot_writer_t position_snapshot;
+
     aeron_driver_context_t *context;
     aeron_distinct_error_log_t *error_log;
+    int64_t incoming_cpu_check_deadline_ns;
+    int64_t socket_drops_check_deadline_ns;
+    int64_t rttm_check_deadline_ns;
+    volatile bool pending_images_overflowed;
 
     int64_t *errors_counter;
     int64_t *invalid_frames_counter;
     int64_t *total_bytes_received_counter;
+    int64_t *incoming_cpu_misalignments_counter;
 }
 aeron_driver_receiver_t;
 
 #define AERON_DRIVER_RECEIVER_ERROR(receiver, format, ...) \
 do \
 { \
-    char error_buffer[AERON_MAX_PATH]; \
     int err_code = aeron_errcode(); \
-    snprintf(error_buffer, sizeof(error_buffer) - 1, format, __VA_ARGS__); \
-    aeron_distinct_error_log_record(receiver->error_log, err_code, aeron_errmsg(), error_buffer); \
+    if (!aeron_distinct_error_log_try_record_at_site(receiver->error_log, err_code, format)) \
+    { \
+        char error_buffer[AERON_MAX_PATH]; \
+        snprintf(error_buffer, sizeof(error_buffer) - 1, format, __VA_ARGS__); \
+        aeron_distinct_error_log_record_at_site(receiver->error_log, err_code, format, aeron_errmsg(), error_buffer); \
+    } \
     aeron_counter_increment(receiver->errors_counter, 1); \
     aeron_set_err(0, "%s", "no error"); \
 } \
@@ -102,6 +142,19 @@ int aeron_driver_receiver_init(
     aeron_distinct_error_log_t *error_log);
 
 int aeron_driver_receiver_do_work(void *clientd);
+
+/*
+ * Defer inserting a data frame for an image until aeron_driver_receiver_insert_pending_packets, inserting what is
+ * pending first when full. The buffer must stay valid until then.
+ */
+void aeron_driver_receiver_defer_packet(
+    aeron_driver_receiver_t *receiver,
+    aeron_publication_image_t *image,
+    const uint8_t *buffer,
+    size_t length,
+    int64_t recv_timestamp_ns);
+
+void aeron_driver_receiver_insert_pending_packets(aeron_driver_receiver_t *receiver);
 void aeron_driver_receiver_on_close(void *clientd);
 
 void aeron_driver_receiver_on_add_endpoint(void *clientd, void *item);
@@ -109,6 +162,8 @@ void aeron_driver_receiver_on_remove_endpoint(void *clientd, void *item);
 
 void aeron_driver_receiver_on_add_subscription(void *clientd, void *item);
 void aeron_driver_receiver_on_remove_subscription(void *clientd, void *item);
+void aeron_driver_receiver_on_add_subscription_range(void *clientd, void *item);
+void aeron_driver_receiver_on_remove_subscription_range(void *clientd, void *item);
 
 void aeron_driver_receiver_on_add_publication_image(void *clientd, void *item);
 void aeron_driver_receiver_on_remove_publication_image(void *clientd, void *item);
@@ -18,7 +18,7 @@
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_driver_receiver_proxy.h"
 #include "aeron_driver_receiver.h"
-#include "aeron_alloc.h"
+#include "aeron_publication_image.h"
 
 void aeron_driver_receiver_proxy_offer(aeron_driver_receiver_proxy_t *receiver_proxy, void *cmd)
 {
@@ -29,6 +29,23 @@ void aeron_driver_receiver_proxy_offer(aeron_driver_receiver_proxy_t *receiver_p
     }
 }
 
+aeron_driver_receiver_proxy_t *aeron_driver_receiver_proxy_least_loaded(aeron_driver_context_t *context)
+{
+    aeron_driver_receiver_proxy_t *least_loaded = context->receiver_proxy;
+
+    for (size_t i = 0; i < context->receiver_count; i++)
+    {
+        aeron_driver_receiver_proxy_t *receiver_proxy = context->receiver_proxies[i];
+
+        if (NULL != receiver_proxy && receiver_proxy->endpoint_count < least_loaded->endpoint_count)
+        {
+            least_loaded = receiver_proxy;
+        }
+    }
+
+    return least_loaded;
+}
+
 void aeron_driver_receiver_proxy_on_delete_create_publication_image_cmd(
     aeron_driver_receiver_proxy_t *receiver_proxy, aeron_command_base_t *cmd)
 {
@@ -60,9 +77,10 @@ void aeron_driver_receiver_proxy_on_add_endpoint(
     }
     else
     {
-        aeron_command_base_t *cmd;
+        aeron_command_base_t *cmd = aeron_driver_command_pool_acquire(
+            &receiver_proxy->command_pool, sizeof(aeron_command_base_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_base_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(receiver_proxy->fail_counter, 1);
             return;
@@ -90,9 +108,10 @@ void aeron_driver_receiver_proxy_on_remove_endpoint(
     }
     else
     {
-        aeron_command_base_t *cmd;
+        aeron_command_base_t *cmd = aeron_driver_command_pool_acquire(
+            &receiver_proxy->command_pool, sizeof(aeron_command_base_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_base_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(receiver_proxy->fail_counter, 1);
             return;
@@ -105,72 +124,79 @@ void aeron_driver_receiver_proxy_on_remove_endpoint(
     }
 }
 
-void aeron_driver_receiver_proxy_on_add_subscription(
-    aeron_driver_receiver_proxy_t *receiver_proxy, aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id)
+static void aeron_driver_receiver_proxy_subscription_cmd(
+    aeron_driver_receiver_proxy_t *receiver_proxy,
+    void (*func)(void *clientd, void *command),
+    aeron_receive_channel_endpoint_t *endpoint,
+    int32_t stream_id,
+    int32_t stream_id_high)
 {
     if (AERON_THREADING_MODE_SHARED == receiver_proxy->threading_mode)
     {
         aeron_command_subscription_t cmd =
             {
-                .base.func = aeron_driver_receiver_on_add_subscription,
+                .base.func = func,
                 .base.item = NULL,
                 .endpoint = endpoint,
-                .stream_id = stream_id
+                .stream_id = stream_id,
+                .stream_id_high = stream_id_high
             };
 
-        aeron_driver_receiver_on_add_subscription(receiver_proxy->receiver, &cmd);
+        func(receiver_proxy->receiver, &cmd);
     }
     else
     {
-        aeron_command_subscription_t *cmd;
+        aeron_command_subscription_t *cmd = aeron_driver_command_pool_acquire(
+            &receiver_proxy->command_pool, sizeof(aeron_command_subscription_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_subscription_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(receiver_proxy->fail_counter, 1);
             return;
         }
 
-        cmd->base.func = aeron_driver_receiver_on_add_subscription;
+        cmd->base.func = func;
         cmd->base.item = NULL;
         cmd->endpoint = endpoint;
         cmd->stream_id = stream_id;
+        cmd->stream_id_high = stream_id_high;
 
         aeron_driver_receiver_proxy_offer(receiver_proxy, cmd);
     }
 }
 
-void aeron_driver_receiver_proxy_on_remove_subscription(
+void aeron_driver_receiver_proxy_on_add_subscription(
     aeron_driver_receiver_proxy_t *receiver_proxy, aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id)
 {
-    if (AERON_THREADING_MODE_SHARED == receiver_proxy->threading_mode)
-    {
-        aeron_command_subscription_t cmd =
-            {
-                .base.func = aeron_driver_receiver_on_remove_subscription,
-                .base.item = NULL,
-                .endpoint = endpoint,
-                .stream_id = stream_id
-            };
-
-        aeron_driver_receiver_on_remove_subscription(receiver_proxy->receiver, &cmd);
-    }
-    else
-    {
-        aeron_command_subscription_t *cmd;
+    aeron_driver_receiver_proxy_subscription_cmd(
+        receiver_proxy, aeron_driver_receiver_on_add_subscription, endpoint, stream_id, stream_id);
+}
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_subscription_t)) < 0)
-        {
-            aeron_counter_ordered_increment(receiver_proxy->fail_counter, 1);
-            return;
-        }
+void aeron_driver_receiver_proxy_on_remove_subscription(
+    aeron_driver_receiver_proxy_t *receiver_proxy, aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id)
+{
+    aeron_driver_receiver_proxy_subscription_cmd(
+        receiver_proxy, aeron_driver_receiver_on_remove_subscription, endpoint, stream_id, stream_id);
+}
 
-        cmd->base.func = aeron_driver_receiver_on_remove_subscription;
-        cmd->base.item = NULL;
-        cmd->endpoint = endpoint;
-        cmd->stream_id = stream_id;
+void aeron_driver_receiver_proxy_on_add_subscription_range(
+    aeron_driver_receiver_proxy_t *receiver_proxy,
+    aeron_receive_channel_endpoint_t *endpoint,
+    int32_t stream_id_low,
+    int32_t stream_id_high)
+{
+    aeron_driver_receiver_proxy_subscription_cmd(
+        receiver_proxy, aeron_driver_receiver_on_add_subscription_range, endpoint, stream_id_low, stream_id_high);
+}
 
-        aeron_driver_receiver_proxy_offer(receiver_proxy, cmd);
-    }
+void aeron_driver_receiver_proxy_on_remove_subscription_range(
+    aeron_driver_receiver_proxy_t *receiver_proxy,
+    aeron_receive_channel_endpoint_t *endpoint,
+    int32_t stream_id_low,
+    int32_t stream_id_high)
+{
+    aeron_driver_receiver_proxy_subscription_cmd(
+        receiver_proxy, aeron_driver_receiver_on_remove_subscription_range, endpoint, stream_id_low, stream_id_high);
 }
 
 void aeron_driver_receiver_proxy_on_add_publication_image(
@@ -192,9 +218,10 @@ void aeron_driver_receiver_proxy_on_add_publication_image(
     }
     else
     {
-        aeron_command_publication_image_t *cmd;
+        aeron_command_publication_image_t *cmd = aeron_driver_command_pool_acquire(
+            &receiver_proxy->command_pool, sizeof(aeron_command_publication_image_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_publication_image_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(receiver_proxy->fail_counter, 1);
             return;
@@ -228,9 +255,10 @@ void aeron_driver_receiver_proxy_on_remove_publication_image(
     }
     else
     {
-        aeron_command_publication_image_t *cmd;
+        aeron_command_publication_image_t *cmd = aeron_driver_command_pool_acquire(
+            &receiver_proxy->command_pool, sizeof(aeron_command_publication_image_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_publication_image_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(receiver_proxy->fail_counter, 1);
             return;
@@ -266,9 +294,10 @@ void aeron_driver_receiver_proxy_on_remove_cooldown(
     }
     else
     {
-        aeron_command_remove_cooldown_t *cmd;
+        aeron_command_remove_cooldown_t *cmd = aeron_driver_command_pool_acquire(
+            &receiver_proxy->command_pool, sizeof(aeron_command_remove_cooldown_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_remove_cooldown_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(receiver_proxy->fail_counter, 1);
             return;
@@ -283,3 +312,14 @@ void aeron_driver_receiver_proxy_on_remove_cooldown(
         aeron_driver_receiver_proxy_offer(receiver_proxy, cmd);
     }
 }
+
+void aeron_driver_receiver_proxy_on_image_pending(
+    aeron_driver_receiver_proxy_t *receiver_proxy, aeron_publication_image_t *image)
+{
+    /* the exchange is a full fence so the receiver either sees the flag still set or the change published before */
+    if (aeron_cmpxchg32(&image->receiver_fields.is_service_pending, 0, 1) &&
+        aeron_spsc_concurrent_array_queue_offer(receiver_proxy->pending_image_queue, image) != AERON_OFFER_SUCCESS)
+    {
+        AERON_PUT_ORDERED(receiver_proxy->receiver->pending_images_overflowed, true);
+    }
+}
@@ -18,6 +18,7 @@
 #define AERON_AERON_DRIVER_RECEIVER_PROXY_H
 
 #include "aeron_driver_context.h"
+#include "aeron_driver_command_pool.h"
 
 typedef struct aeron_driver_receiver_stct aeron_driver_receiver_t;
 typedef struct aeron_receive_channel_endpoint_stct aeron_receive_channel_endpoint_t;
@@ -28,10 +29,19 @@ typedef struct aeron_driver_receiver_proxy_stct
     aeron_driver_receiver_t *receiver;
     aeron_threading_mode_t threading_mode;
     aeron_spsc_concurrent_array_queue_t *command_queue;
+    aeron_spsc_concurrent_array_queue_t *pending_image_queue;
     int64_t *fail_counter;
+    size_t endpoint_count;
+    int32_t numa_node;
+    aeron_driver_command_pool_t command_pool;
 }
 aeron_driver_receiver_proxy_t;
 
+/*
+ * Receiver proxy with the fewest receive channel endpoints. Endpoint counts are only touched by the conductor.
+ */
+aeron_driver_receiver_proxy_t *aeron_driver_receiver_proxy_least_loaded(aeron_driver_context_t *context);
+
 void aeron_driver_receiver_proxy_on_delete_create_publication_image_cmd(
     aeron_driver_receiver_proxy_t *receiver_proxy, aeron_command_base_t *cmd);
 
@@ -45,6 +55,8 @@ typedef struct aeron_command_subscription_stct
     aeron_command_base_t base;
     void *endpoint;
     int32_t stream_id;
+    /* last stream id of a range subscription, which starts at stream_id */
+    int32_t stream_id_high;
 }
 aeron_command_subscription_t;
 
@@ -52,6 +64,16 @@ void aeron_driver_receiver_proxy_on_add_subscription(
     aeron_driver_receiver_proxy_t *receiver_proxy, aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id);
 void aeron_driver_receiver_proxy_on_remove_subscription(
     aeron_driver_receiver_proxy_t *receiver_proxy, aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id);
+void aeron_driver_receiver_proxy_on_add_subscription_range(
+    aeron_driver_receiver_proxy_t *receiver_proxy,
+    aeron_receive_channel_endpoint_t *endpoint,
+    int32_t stream_id_low,
+    int32_t stream_id_high);
+void aeron_driver_receiver_proxy_on_remove_subscription_range(
+    aeron_driver_receiver_proxy_t *receiver_proxy,
+    aeron_receive_channel_endpoint_t *endpoint,
+    int32_t stream_id_low,
+    int32_t stream_id_high);
 
 typedef struct aeron_command_publication_image_stct
 {
@@ -84,4 +106,11 @@ void aeron_driver_receiver_proxy_on_remove_cooldown(
     int32_t session_id,
     int32_t stream_id);
 
+/*
+ * Hand the receiver an image with a status message or NAK scheduled for it to send, unless it already holds it, so the
+ * receiver only services images with something to send. Called by the conductor after publishing the change.
+ */
+void aeron_driver_receiver_proxy_on_image_pending(
+    aeron_driver_receiver_proxy_t *receiver_proxy, aeron_publication_image_t *image);
+
 #endif //AERON_AERON_DRIVER_RECEIVER_PROXY_H
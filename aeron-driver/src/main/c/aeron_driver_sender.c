@@ -21,6 +21,7 @@
 
 #include <sys/socket.h>
 #include <stdio.h>
+#include <string.h>
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
@@ -41,45 +42,84 @@ int aeron_driver_sender_init(
     aeron_system_counters_t *system_counters,
     aeron_distinct_error_log_t *error_log)
 {
-    if (aeron_udp_transport_poller_init(&sender->poller) < 0)
+    if (aeron_spsc_concurrent_array_queue_init(&sender->command_queue, AERON_COMMAND_QUEUE_CAPACITY) < 0 ||
+        aeron_driver_command_pool_init(
+            &sender->sender_proxy.command_pool,
+            sizeof(aeron_command_destination_t),
+            AERON_DRIVER_COMMAND_POOL_CAPACITY) < 0)
     {
         return -1;
     }
 
-    for (size_t i = 0; i < AERON_DRIVER_SENDER_NUM_RECV_BUFFERS; i++)
+    if (aeron_udp_transport_poller_init(&sender->poller, false, context->mtu_length) < 0)
     {
-        size_t offset = 0;
-        if (aeron_alloc_aligned(
-            (void **)&sender->recv_buffers.buffers[i],
-            &offset,
-            context->mtu_length,
-            AERON_CACHE_LINE_LENGTH * 2) < 0)
-        {
-            int errcode = errno;
+        return -1;
+    }
 
-            aeron_set_err(errcode, "%s:%d: %s", __FILE__, __LINE__, strerror(errcode));
-            return -1;
-        }
+    size_t vlen = context->sender_io_vector_capacity;
+    size_t buffer_length = AERON_ALIGN(context->mtu_length, AERON_CACHE_LINE_LENGTH * 2);
+    size_t buffer_offset = 0, mmsghdr_offset = 0;
+
+    sender->recv_buffers.vlen = vlen;
+    if (aeron_alloc_aligned(
+        (void **)&sender->recv_buffers.buffer_memory,
+        &buffer_offset,
+        vlen * buffer_length,
+        AERON_CACHE_LINE_LENGTH * 2) < 0 ||
+        aeron_alloc_aligned(
+            (void **)&sender->recv_buffers.mmsghdr_memory,
+            &mmsghdr_offset,
+            vlen * sizeof(struct mmsghdr),
+            AERON_CACHE_LINE_LENGTH) < 0 ||
+        aeron_alloc((void **)&sender->recv_buffers.iov, vlen * sizeof(struct iovec)) < 0 ||
+        aeron_alloc((void **)&sender->recv_buffers.addrs, vlen * sizeof(struct sockaddr_storage)) < 0)
+    {
+        int errcode = errno;
 
-        sender->recv_buffers.iov[i].iov_base = sender->recv_buffers.buffers[i] + offset;
+        aeron_set_err(errcode, "%s:%d: %s", __FILE__, __LINE__, strerror(errcode));
+        return -1;
+    }
+
+    sender->recv_buffers.mmsghdrs = (struct mmsghdr *)(sender->recv_buffers.mmsghdr_memory + mmsghdr_offset);
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        struct msghdr *msg_hdr = &sender->recv_buffers.mmsghdrs[i].msg_hdr;
+
+        sender->recv_buffers.iov[i].iov_base = sender->recv_buffers.buffer_memory + buffer_offset + (i * buffer_length);
         sender->recv_buffers.iov[i].iov_len = context->mtu_length;
+
+        msg_hdr->msg_name = &sender->recv_buffers.addrs[i];
+        msg_hdr->msg_iov = &sender->recv_buffers.iov[i];
+        msg_hdr->msg_iovlen = 1;
+        msg_hdr->msg_control = NULL;
     }
 
     sender->context = context;
     sender->error_log = error_log;
     sender->sender_proxy.sender = sender;
-    sender->sender_proxy.command_queue = &context->sender_command_queue;
+    sender->sender_proxy.command_queue = &sender->command_queue;
     sender->sender_proxy.fail_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SENDER_PROXY_FAILS);
     sender->sender_proxy.threading_mode = context->threading_mode;
+    sender->sender_proxy.endpoint_count = 0;
+    sender->sender_proxy.numa_node = -1;
 
     sender->network_publicaitons.array = NULL;
     sender->network_publicaitons.length = 0;
     sender->network_publicaitons.capacity = 0;
 
+    aeron_clock_update_cached_nano_time(&sender->cached_clock, context->nano_clock());
+
+    sender->pending_status_messages.length = 0;
+    sender->pending_status_messages.is_coalescing = false;
+
     sender->round_robin_index = 0;
+    sender->scheduled_publication_count = 0;
     sender->duty_cycle_counter = 0;
+    aeron_position_snapshot_writer_init(&sender->position_snapshot, NULL, 0);
     sender->duty_cycle_ratio = context->send_to_sm_poll_ratio;
+    sender->is_sm_poll_adaptive = context->send_to_sm_poll_adaptive;
     sender->status_message_read_timeout_ns = context->status_message_timeout_ns / 2;
     sender->control_poll_timeout_ns = 0;
     sender->total_bytes_sent_counter =
@@ -106,6 +146,29 @@ void aeron_driver_sender_on_command(void *clientd, volatile void *item)
     aeron_driver_conductor_proxy_on_delete_cmd(sender->context->conductor_proxy, cmd);
 }
 
+static void aeron_driver_sender_snapshot_positions(aeron_driver_sender_t *sender, int64_t now_ns)
+{
+    aeron_position_snapshot_writer_t *writer = &sender->position_snapshot;
+
+    aeron_position_snapshot_begin(writer);
+
+    for (size_t i = 0, length = sender->network_publicaitons.length; i < length; i++)
+    {
+        aeron_network_publication_t *publication = sender->network_publicaitons.array[i].publication;
+
+        aeron_position_snapshot_put(
+            writer,
+            publication->conductor_fields.managed_resource.registration_id,
+            publication->session_id,
+            publication->stream_id,
+            aeron_counter_get(publication->snd_pos_position.value_addr),
+            aeron_network_publication_producer_position(publication),
+            aeron_counter_get(publication->snd_lmt_position.value_addr));
+    }
+
+    aeron_position_snapshot_end(writer, now_ns);
+}
+
 int aeron_driver_sender_do_work(void *clientd)
 {
     aeron_driver_sender_t *sender = (aeron_driver_sender_t *)clientd;
@@ -116,33 +179,43 @@ int aeron_driver_sender_do_work(void *clientd)
             sender->sender_proxy.command_queue, aeron_driver_sender_on_command, sender, 10);
 
     int64_t now_ns = sender->context->nano_clock();
+    aeron_clock_update_cached_nano_time(&sender->cached_clock, now_ns);
+
     int bytes_sent = aeron_driver_sender_do_send(sender, now_ns);
     int poll_result;
 
+    if (NULL != sender->position_snapshot.header)
+    {
+        aeron_driver_sender_snapshot_positions(sender, now_ns);
+    }
+
     if (0 == bytes_sent ||
-        ++sender->duty_cycle_counter == sender->duty_cycle_ratio ||
+        ++sender->duty_cycle_counter >= (sender->is_sm_poll_adaptive ?
+            aeron_driver_sender_adaptive_poll_ratio(sender) : sender->duty_cycle_ratio) ||
         now_ns > sender->control_poll_timeout_ns)
     {
-        struct mmsghdr mmsghdr[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
+        struct mmsghdr *mmsghdr = sender->recv_buffers.mmsghdrs;
+        int64_t bytes_received = 0;
 
-        for (size_t i = 0; i < AERON_DRIVER_SENDER_NUM_RECV_BUFFERS; i++)
+        /* only reset what the kernel writes back, the rest is set up once in init */
+        for (size_t i = 0, vlen = sender->recv_buffers.vlen; i < vlen; i++)
         {
-            mmsghdr[i].msg_hdr.msg_name = &sender->recv_buffers.addrs[i];
-            mmsghdr[i].msg_hdr.msg_namelen = sizeof(sender->recv_buffers.addrs[i]);
-            mmsghdr[i].msg_hdr.msg_iov = &sender->recv_buffers.iov[i];
-            mmsghdr[i].msg_hdr.msg_iovlen = 1;
+            mmsghdr[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
             mmsghdr[i].msg_hdr.msg_flags = 0;
-            mmsghdr[i].msg_hdr.msg_control = NULL;
             mmsghdr[i].msg_hdr.msg_controllen = 0;
             mmsghdr[i].msg_len = 0;
         }
 
+        sender->pending_status_messages.is_coalescing = true;
         poll_result = aeron_udp_transport_poller_poll(
             &sender->poller,
             mmsghdr,
-            AERON_DRIVER_SENDER_NUM_RECV_BUFFERS,
+            sender->recv_buffers.vlen,
+            &bytes_received,
             aeron_send_channel_endpoint_dispatch,
             sender);
+        aeron_driver_sender_flush_status_messages(sender);
+        sender->pending_status_messages.is_coalescing = false;
 
         if (poll_result < 0)
         {
@@ -162,13 +235,15 @@ void aeron_driver_sender_on_close(void *clientd)
 {
     aeron_driver_sender_t *sender = (aeron_driver_sender_t *)clientd;
 
-    for (size_t i = 0; i < AERON_DRIVER_SENDER_NUM_RECV_BUFFERS; i++)
-    {
-        aeron_free(sender->recv_buffers.buffers[i]);
-    }
+    aeron_free(sender->recv_buffers.buffer_memory);
+    aeron_free(sender->recv_buffers.mmsghdr_memory);
+    aeron_free(sender->recv_buffers.iov);
+    aeron_free(sender->recv_buffers.addrs);
 
     aeron_udp_transport_poller_close(&sender->poller);
     aeron_free(sender->network_publicaitons.array);
+    aeron_spsc_concurrent_array_queue_close(&sender->command_queue);
+    aeron_driver_command_pool_close(&sender->sender_proxy.command_pool);
 }
 
 void aeron_driver_sender_on_add_endpoint(void *clientd, void *command)
@@ -181,6 +256,19 @@ void aeron_driver_sender_on_add_endpoint(void *clientd, void *command)
     {
         AERON_DRIVER_SENDER_ERROR(sender, "sender on_add_endpoint: %s", aeron_errmsg());
     }
+
+    for (size_t i = 0; i < endpoint->path_transports_length; i++)
+    {
+        if (aeron_udp_transport_poller_add(&sender->poller, &endpoint->path_transports[i]) < 0)
+        {
+            AERON_DRIVER_SENDER_ERROR(sender, "sender on_add_endpoint: %s", aeron_errmsg());
+        }
+    }
+
+    if (NULL != endpoint->destination_tracker)
+    {
+        endpoint->destination_tracker->cached_clock = &sender->cached_clock;
+    }
 }
 
 void aeron_driver_sender_on_remove_endpoint(void *clientd, void *command)
@@ -194,9 +282,22 @@ void aeron_driver_sender_on_remove_endpoint(void *clientd, void *command)
         AERON_DRIVER_SENDER_ERROR(sender, "sender on_remove_endpoint: %s", aeron_errmsg());
     }
 
+    for (size_t i = 0; i < endpoint->path_transports_length; i++)
+    {
+        if (aeron_udp_transport_poller_remove(&sender->poller, &endpoint->path_transports[i]) < 0)
+        {
+            AERON_DRIVER_SENDER_ERROR(sender, "sender on_remove_endpoint: %s", aeron_errmsg());
+        }
+    }
+
     aeron_send_channel_endpoint_sender_release(endpoint);
 }
 
+inline static bool aeron_driver_sender_is_scheduled(aeron_network_publication_t *publication)
+{
+    return 0 != publication->send_priority || 1 != publication->send_weight;
+}
+
 void aeron_driver_sender_on_add_publication(void *clientd, void *command)
 {
     aeron_driver_sender_t *sender = (aeron_driver_sender_t *)clientd;
@@ -213,7 +314,16 @@ void aeron_driver_sender_on_add_publication(void *clientd, void *command)
         return;
     }
 
-    sender->network_publicaitons.array[sender->network_publicaitons.length++].publication = publication;
+    aeron_driver_sender_network_publication_entry_t *entry =
+        &sender->network_publicaitons.array[sender->network_publicaitons.length++];
+    entry->publication = publication;
+    entry->deficit = 0;
+
+    if (aeron_driver_sender_is_scheduled(publication))
+    {
+        sender->scheduled_publication_count++;
+    }
+
     if (aeron_send_channel_endpoint_add_publication(publication->endpoint, publication) < 0)
     {
         AERON_DRIVER_SENDER_ERROR(sender, "sender on_add_publication add_publication: %s", aeron_errmsg());
@@ -236,6 +346,11 @@ void aeron_driver_sender_on_remove_publication(void *clientd, void *command)
                 i,
                 last_index);
             sender->network_publicaitons.length--;
+
+            if (aeron_driver_sender_is_scheduled(publication))
+            {
+                sender->scheduled_publication_count--;
+            }
             break;
         }
     }
@@ -270,8 +385,189 @@ void aeron_driver_sender_on_remove_destination(void *clientd, void *command)
     }
 }
 
+/*
+ * Deficit round robin within a priority class. Each duty cycle a publication earns its weight in quanta of what one
+ * send call sends without GSO, and sends until the credit is spent or it has nothing more to send. Credit is only
+ * carried over while the publication has more to send, so an idle publication cannot save up for a burst.
+ */
+static int aeron_driver_sender_do_send_class(aeron_driver_sender_t *sender, int64_t now_ns, int32_t send_priority)
+{
+    int bytes_sent = 0;
+    aeron_driver_sender_network_publication_entry_t *publications = sender->network_publicaitons.array;
+    const size_t length = sender->network_publicaitons.length;
+    const size_t starting_index = sender->round_robin_index;
+
+    for (size_t n = 0; n < length; n++)
+    {
+        const size_t i = (starting_index + n) % length;
+        aeron_driver_sender_network_publication_entry_t *entry = &publications[i];
+        aeron_network_publication_t *publication = entry->publication;
+
+        if (send_priority != publication->send_priority)
+        {
+            continue;
+        }
+
+        const int64_t quantum =
+            (int64_t)publication->sender_fields.datagram_length * AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND;
+        int result;
+
+        entry->deficit += publication->send_weight * quantum;
+
+        do
+        {
+            publication->sender_fields.send_quota = entry->deficit < INT32_MAX ? (int32_t)entry->deficit : INT32_MAX;
+            result = aeron_network_publication_send(publication, now_ns);
+
+            if (result < 0)
+            {
+                AERON_DRIVER_SENDER_ERROR(sender, "sender do_send: %s", aeron_errmsg());
+                break;
+            }
+
+            bytes_sent += result;
+            entry->deficit -= result;
+        }
+        while (result > 0 && entry->deficit >= quantum);
+
+        if (result <= 0 || entry->deficit < 0)
+        {
+            entry->deficit = 0;
+        }
+
+        publication->sender_fields.send_quota = INT32_MAX;
+    }
+
+    return bytes_sent;
+}
+
+/*
+ * Publications are served class by class from the highest priority so latency sensitive streams are sent before bulk
+ * streams sharing the sender in every duty cycle, and by weight within a class.
+ */
+static int aeron_driver_sender_do_send_scheduled(aeron_driver_sender_t *sender, int64_t now_ns)
+{
+    int bytes_sent = 0;
+
+    if (++sender->round_robin_index >= sender->network_publicaitons.length)
+    {
+        sender->round_robin_index = 0;
+    }
+
+    for (int32_t send_priority = AERON_UDP_CHANNEL_SEND_PRIORITY_CLASSES - 1; send_priority >= 0; send_priority--)
+    {
+        bytes_sent += aeron_driver_sender_do_send_class(sender, now_ns, send_priority);
+    }
+
+    if (bytes_sent > 0)
+    {
+        aeron_counter_increment(sender->total_bytes_sent_counter, bytes_sent);
+    }
+
+    return bytes_sent;
+}
+
+size_t aeron_driver_sender_adaptive_poll_ratio(aeron_driver_sender_t *sender)
+{
+    bool is_window_ample = true;
+
+    for (size_t i = 0, length = sender->network_publicaitons.length; i < length; i++)
+    {
+        aeron_network_publication_t *publication = sender->network_publicaitons.array[i].publication;
+        const int64_t receiver_window_length = publication->sender_fields.receiver_window_length;
+
+        if (!publication->sender_fields.has_receivers || receiver_window_length <= 0)
+        {
+            continue;
+        }
+
+        const int64_t window_left =
+            aeron_counter_get(publication->snd_lmt_position.value_addr) -
+            aeron_counter_get(publication->snd_pos_position.value_addr);
+
+        if (window_left * 4 < receiver_window_length)
+        {
+            return 1;
+        }
+
+        if (window_left * 4 < receiver_window_length * 3)
+        {
+            is_window_ample = false;
+        }
+    }
+
+    return is_window_ample ? sender->duty_cycle_ratio * 2 : sender->duty_cycle_ratio;
+}
+
+void aeron_driver_sender_on_status_message(
+    aeron_driver_sender_t *sender,
+    aeron_network_publication_t *publication,
+    const uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    if (!sender->pending_status_messages.is_coalescing)
+    {
+        aeron_network_publication_on_status_message(publication, buffer, length, addr);
+        return;
+    }
+
+    aeron_driver_sender_pending_status_message_t *pending = sender->pending_status_messages.array;
+    const int64_t receiver_id = ((aeron_status_message_header_t *)buffer)->receiver_id;
+    size_t i = 0;
+
+    for (size_t size = sender->pending_status_messages.length; i < size; i++)
+    {
+        if (pending[i].publication == publication && pending[i].receiver_id == receiver_id)
+        {
+            break;
+        }
+    }
+
+    if (length > AERON_DRIVER_SENDER_PENDING_STATUS_MESSAGE_MAX_LENGTH ||
+        i == AERON_DRIVER_SENDER_MAX_PENDING_STATUS_MESSAGES)
+    {
+        if (i < sender->pending_status_messages.length)
+        {
+            pending[i] = pending[--sender->pending_status_messages.length];
+        }
+
+        aeron_network_publication_on_status_message(publication, buffer, length, addr);
+        return;
+    }
+
+    if (i == sender->pending_status_messages.length)
+    {
+        sender->pending_status_messages.length++;
+    }
+
+    pending[i].publication = publication;
+    pending[i].receiver_id = receiver_id;
+    pending[i].length = length;
+    memcpy(&pending[i].addr, addr, sizeof(pending[i].addr));
+    memcpy(pending[i].buffer, buffer, length);
+}
+
+void aeron_driver_sender_flush_status_messages(aeron_driver_sender_t *sender)
+{
+    aeron_driver_sender_pending_status_message_t *pending = sender->pending_status_messages.array;
+
+    for (size_t i = 0, size = sender->pending_status_messages.length; i < size; i++)
+    {
+        aeron_network_publication_on_status_message(
+            pending[i].publication, pending[i].buffer, pending[i].length, &pending[i].addr);
+    }
+
+    sender->pending_status_messages.length = 0;
+}
+
 int aeron_driver_sender_do_send(aeron_driver_sender_t *sender, int64_t now_ns)
 {
+    if (sender->scheduled_publication_count > 0)
+    {
+        return aeron_driver_sender_do_send_scheduled(sender, now_ns);
+    }
+
     int bytes_sent = 0;
     aeron_driver_sender_network_publication_entry_t *publications = sender->network_publicaitons.array;
     size_t length = sender->network_publicaitons.length;
@@ -308,7 +604,10 @@ int aeron_driver_sender_do_send(aeron_driver_sender_t *sender, int64_t now_ns)
         }
     }
 
-    aeron_counter_add_ordered(sender->total_bytes_sent_counter, bytes_sent);
+    if (bytes_sent > 0)
+    {
+        aeron_counter_increment(sender->total_bytes_sent_counter, bytes_sent);
+    }
 
     return bytes_sent;
 }
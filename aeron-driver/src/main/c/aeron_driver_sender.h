@@ -23,18 +23,33 @@
 #include "media/aeron_udp_transport_poller.h"
 #include "aeron_network_publication.h"
 #include "concurrent/aeron_distinct_error_log.h"
+#include "util/aeron_clock.h"
 
 typedef struct aeron_driver_sender_network_publication_entry_stct
 {
     aeron_network_publication_t *publication;
+    int64_t deficit;
 }
 aeron_driver_sender_network_publication_entry_t;
 
-#define AERON_DRIVER_SENDER_NUM_RECV_BUFFERS (2)
+#define AERON_DRIVER_SENDER_MAX_PENDING_STATUS_MESSAGES (64)
+#define AERON_DRIVER_SENDER_PENDING_STATUS_MESSAGE_MAX_LENGTH \
+    (sizeof(aeron_status_message_header_t) + sizeof(int64_t))
+
+typedef struct aeron_driver_sender_pending_status_message_stct
+{
+    aeron_network_publication_t *publication;
+    int64_t receiver_id;
+    size_t length;
+    struct sockaddr_storage addr;
+    uint8_t buffer[AERON_DRIVER_SENDER_PENDING_STATUS_MESSAGE_MAX_LENGTH];
+}
+aeron_driver_sender_pending_status_message_t;
 
 typedef struct aeron_driver_sender_stct
 {
     aeron_driver_sender_proxy_t sender_proxy;
+    aeron_spsc_concurrent_array_queue_t command_queue;
     aeron_udp_transport_poller_t poller;
 
     struct aeron_driver_sender_network_publications_stct
@@ -47,19 +62,39 @@ typedef struct aeron_driver_sender_stct
 
     struct aeron_driver_sender_buffers_stct
     {
-        uint8_t *buffers[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
-        struct iovec iov[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
-        struct sockaddr_storage addrs[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
+        size_t vlen;
+        uint8_t *buffer_memory;
+        uint8_t *mmsghdr_memory;
+        struct mmsghdr *mmsghdrs;
+        struct iovec *iov;
+        struct sockaddr_storage *addrs;
     }
     recv_buffers;
 
+    /* status messages held during a poll so only the latest from each receiver of a publication is applied */
+    struct aeron_driver_sender_pending_status_messages_stct
+    {
+        aeron_driver_sender_pending_status_message_t array[AERON_DRIVER_SENDER_MAX_PENDING_STATUS_MESSAGES];
+        size_t length;
+        bool is_coalescing;
+    }
+    pending_status_messages;
+
+    /* time of the current duty cycle for work done within it, e.g. by destination trackers on each send */
+    aeron_clock_cache_t cached_clock;
+
+    /* section of the position snapshot this sender rewrites each duty cycle, header NULL when not enabled */
+    aeron_position_snapshot_writer_t position_snapshot;
+
     aeron_driver_context_t *context;
     aeron_distinct_error_log_t *error_log;
     int64_t status_message_read_timeout_ns;
     int64_t control_poll_timeout_ns;
     size_t round_robin_index;
+    size_t scheduled_publication_count;
     size_t duty_cycle_counter;
     size_t duty_cycle_ratio;
+    bool is_sm_poll_adaptive;
 
     int64_t *total_bytes_sent_counter;
     int64_t *errors_counter;
@@ -72,10 +107,13 @@ aeron_driver_sender_t;
 #define AERON_DRIVER_SENDER_ERROR(sender, format, ...) \
 do \
 { \
-    char error_buffer[AERON_MAX_PATH]; \
     int err_code = aeron_errcode(); \
-    snprintf(error_buffer, sizeof(error_buffer) - 1, format, __VA_ARGS__); \
-    aeron_distinct_error_log_record(sender->error_log, err_code, aeron_errmsg(), error_buffer); \
+    if (!aeron_distinct_error_log_try_record_at_site(sender->error_log, err_code, format)) \
+    { \
+        char error_buffer[AERON_MAX_PATH]; \
+        snprintf(error_buffer, sizeof(error_buffer) - 1, format, __VA_ARGS__); \
+        aeron_distinct_error_log_record_at_site(sender->error_log, err_code, format, aeron_errmsg(), error_buffer); \
+    } \
     aeron_counter_increment(sender->errors_counter, 1); \
     aeron_set_err(0, "%s", "no error"); \
 } \
@@ -99,4 +137,19 @@ void aeron_driver_sender_on_remove_destination(void *clientd, void *command);
 
 int aeron_driver_sender_do_send(aeron_driver_sender_t *sender, int64_t now_ns);
 
+void aeron_driver_sender_on_status_message(
+    aeron_driver_sender_t *sender,
+    aeron_network_publication_t *publication,
+    const uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
+void aeron_driver_sender_flush_status_messages(aeron_driver_sender_t *sender);
+
+/*
+ * Duty cycles with data sent between polls for status messages when polling adaptively: 1 once a publication with
+ * receivers has less than a quarter of its last receiver window left to send into, twice duty_cycle_ratio when all
+ * have more than three quarters left, and duty_cycle_ratio otherwise.
+ */
+size_t aeron_driver_sender_adaptive_poll_ratio(aeron_driver_sender_t *sender);
+
 #endif //AERON_AERON_DRIVER_SENDER_H
@@ -16,7 +16,6 @@
 
 #include <sched.h>
 #include "aeron_driver_sender.h"
-#include "aeron_alloc.h"
 
 void aeron_driver_sender_proxy_offer(aeron_driver_sender_proxy_t *sender_proxy, void *cmd)
 {
@@ -27,6 +26,31 @@ void aeron_driver_sender_proxy_offer(aeron_driver_sender_proxy_t *sender_proxy,
     }
 }
 
+aeron_driver_sender_proxy_t *aeron_driver_sender_proxy_select(aeron_driver_context_t *context, int32_t sender_affinity)
+{
+    aeron_driver_sender_proxy_t *selected = context->sender_proxy;
+
+    if (sender_affinity >= 0 && context->sender_count > 0)
+    {
+        aeron_driver_sender_proxy_t *sender_proxy =
+            context->sender_proxies[(size_t)sender_affinity % context->sender_count];
+
+        return NULL != sender_proxy ? sender_proxy : selected;
+    }
+
+    for (size_t i = 0; i < context->sender_count; i++)
+    {
+        aeron_driver_sender_proxy_t *sender_proxy = context->sender_proxies[i];
+
+        if (NULL != sender_proxy && sender_proxy->endpoint_count < selected->endpoint_count)
+        {
+            selected = sender_proxy;
+        }
+    }
+
+    return selected;
+}
+
 void aeron_driver_sender_proxy_on_add_endpoint(
     aeron_driver_sender_proxy_t *sender_proxy, aeron_send_channel_endpoint_t *endpoint)
 {
@@ -42,9 +66,10 @@ void aeron_driver_sender_proxy_on_add_endpoint(
     }
     else
     {
-        aeron_command_base_t *cmd;
+        aeron_command_base_t *cmd = aeron_driver_command_pool_acquire(
+            &sender_proxy->command_pool, sizeof(aeron_command_base_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_base_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(sender_proxy->fail_counter, 1);
             return;
@@ -72,9 +97,10 @@ void aeron_driver_sender_proxy_on_remove_endpoint(
     }
     else
     {
-        aeron_command_base_t *cmd;
+        aeron_command_base_t *cmd = aeron_driver_command_pool_acquire(
+            &sender_proxy->command_pool, sizeof(aeron_command_base_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_base_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(sender_proxy->fail_counter, 1);
             return;
@@ -102,9 +128,10 @@ void aeron_driver_sender_proxy_on_add_publication(
     }
     else
     {
-        aeron_command_base_t *cmd;
+        aeron_command_base_t *cmd = aeron_driver_command_pool_acquire(
+            &sender_proxy->command_pool, sizeof(aeron_command_base_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_base_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(sender_proxy->fail_counter, 1);
             return;
@@ -132,9 +159,10 @@ void aeron_driver_sender_proxy_on_remove_publication(
     }
     else
     {
-        aeron_command_base_t *cmd;
+        aeron_command_base_t *cmd = aeron_driver_command_pool_acquire(
+            &sender_proxy->command_pool, sizeof(aeron_command_base_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_base_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(sender_proxy->fail_counter, 1);
             return;
@@ -164,9 +192,10 @@ void aeron_driver_sender_proxy_on_add_destination(
     }
     else
     {
-        aeron_command_destination_t *cmd;
+        aeron_command_destination_t *cmd = aeron_driver_command_pool_acquire(
+            &sender_proxy->command_pool, sizeof(aeron_command_destination_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_destination_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(sender_proxy->fail_counter, 1);
             return;
@@ -198,9 +227,10 @@ void aeron_driver_sender_proxy_on_remove_destination(
     }
     else
     {
-        aeron_command_destination_t *cmd;
+        aeron_command_destination_t *cmd = aeron_driver_command_pool_acquire(
+            &sender_proxy->command_pool, sizeof(aeron_command_destination_t));
 
-        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_destination_t)) < 0)
+        if (NULL == cmd)
         {
             aeron_counter_ordered_increment(sender_proxy->fail_counter, 1);
             return;
@@ -18,6 +18,7 @@
 #define AERON_AERON_DRIVER_SENDER_PROXY_H
 
 #include "aeron_driver_context.h"
+#include "aeron_driver_command_pool.h"
 
 typedef struct aeron_driver_sender_stct aeron_driver_sender_t;
 typedef struct aeron_send_channel_endpoint_stct aeron_send_channel_endpoint_t;
@@ -29,9 +30,19 @@ typedef struct aeron_driver_sender_proxy_stct
     aeron_threading_mode_t threading_mode;
     aeron_spsc_concurrent_array_queue_t *command_queue;
     int64_t *fail_counter;
+    size_t endpoint_count;
+    int32_t numa_node;
+    aeron_driver_command_pool_t command_pool;
 }
 aeron_driver_sender_proxy_t;
 
+/*
+ * Sender proxy for a new send channel endpoint. A non-negative sender_affinity picks a sender by index, modulo the
+ * sender count, otherwise the sender with the fewest endpoints is used. Endpoint counts are only touched by the
+ * conductor.
+ */
+aeron_driver_sender_proxy_t *aeron_driver_sender_proxy_select(aeron_driver_context_t *context, int32_t sender_affinity);
+
 void aeron_driver_sender_proxy_on_add_endpoint(
     aeron_driver_sender_proxy_t *sender_proxy, aeron_send_channel_endpoint_t *endpoint);
 
@@ -0,0 +1,285 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "util/aeron_error.h"
+#include "util/aeron_arrayutil.h"
+#include "aeron_alloc.h"
+#include "aeron_durable_log_syncer.h"
+
+static int aeron_durable_log_syncer_mkdir(const char *dir)
+{
+    if (mkdir(dir, S_IRWXU) != 0 && EEXIST != errno)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "mkdir %s: %s", dir, strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_durable_log_syncer_init(
+    aeron_durable_log_syncer_t *syncer,
+    const char *base_dir,
+    int64_t sync_interval_ns,
+    aeron_clock_func_t nano_clock,
+    int64_t epoch_ms)
+{
+    char publications_dir[AERON_MAX_PATH + sizeof(AERON_DURABLE_LOG_SYNCER_PUBLICATIONS_DIR) + 1];
+
+    syncer->logs.array = NULL;
+    syncer->logs.length = 0;
+    syncer->logs.capacity = 0;
+    syncer->nano_clock = nano_clock;
+    syncer->sync_interval_ns = sync_interval_ns;
+    syncer->time_of_last_sync_ns = nano_clock();
+    syncer->sync_failures = 0;
+
+    const int dir_length = snprintf(syncer->dir, sizeof(syncer->dir), "%s/%" PRIx64, base_dir, (uint64_t)epoch_ms);
+    const int publications_dir_length = snprintf(
+        publications_dir, sizeof(publications_dir), "%s/%s", syncer->dir, AERON_DURABLE_LOG_SYNCER_PUBLICATIONS_DIR);
+
+    /* logs are named within the publications dir, so it must fit with room to spare rather than be truncated */
+    if (dir_length < 0 || (size_t)dir_length >= sizeof(syncer->dir) ||
+        publications_dir_length < 0 || (size_t)publications_dir_length >= AERON_MAX_PATH)
+    {
+        aeron_set_err(ENAMETOOLONG, "durable log dir too long: %s", base_dir);
+        return -1;
+    }
+
+    if (aeron_durable_log_syncer_mkdir(base_dir) < 0 ||
+        aeron_durable_log_syncer_mkdir(syncer->dir) < 0 ||
+        aeron_durable_log_syncer_mkdir(publications_dir) < 0)
+    {
+        return -1;
+    }
+
+    return aeron_spsc_concurrent_array_queue_init(&syncer->added, AERON_DURABLE_LOG_SYNCER_MAX_PENDING);
+}
+
+static void aeron_durable_log_delete(aeron_durable_log_t *log)
+{
+    aeron_unmap(&log->mapped_file);
+    aeron_free(log);
+}
+
+static void aeron_durable_log_syncer_on_added_func(void *clientd, volatile void *item)
+{
+    aeron_durable_log_syncer_t *syncer = (aeron_durable_log_syncer_t *)clientd;
+
+    syncer->logs.array[syncer->logs.length++] = (aeron_durable_log_t *)item;
+}
+
+/*
+ * Flush the pages of the terms holding [from, to), which spans at most two terms as the publication is held within a
+ * term window of the durable position.
+ */
+static int aeron_durable_log_msync(aeron_durable_log_t *log, int64_t from, int64_t to)
+{
+    const int64_t term_length = (int64_t)log->term_length;
+
+    while (from < to)
+    {
+        const int64_t term_end = (from | (term_length - 1)) + 1;
+        const int64_t end = to < term_end ? to : term_end;
+        const size_t term_offset =
+            aeron_logbuffer_index_by_position(from, log->position_bits_to_shift) * log->term_length;
+        const size_t begin_offset = (term_offset + (size_t)(from & (term_length - 1))) & ~(log->page_size - 1);
+        const size_t end_offset = term_offset + (size_t)((end - 1) & (term_length - 1)) + 1;
+
+        if (msync((uint8_t *)log->mapped_file.addr + begin_offset, end_offset - begin_offset, MS_SYNC) < 0)
+        {
+            return -1;
+        }
+
+        from = end;
+    }
+
+    return 0;
+}
+
+static int aeron_durable_log_sync(aeron_durable_log_syncer_t *syncer, aeron_durable_log_t *log)
+{
+    int64_t raw_tail;
+
+    AERON_LOGBUFFER_RAWTAIL_VOLATILE(raw_tail, log->log_meta_data);
+    const int64_t producer_position = aeron_logbuffer_compute_position(
+        aeron_logbuffer_term_id(raw_tail),
+        aeron_logbuffer_term_offset(raw_tail, (int32_t)log->term_length),
+        log->position_bits_to_shift,
+        log->initial_term_id);
+
+    /* the tail is moved on by claims, so only frames that have been committed up to it can be made durable */
+    int64_t position = log->scan_position;
+    while (position < producer_position)
+    {
+        uint8_t *term = (uint8_t *)log->mapped_file.addr +
+            (aeron_logbuffer_index_by_position(position, log->position_bits_to_shift) * log->term_length);
+        aeron_frame_header_t *frame_header =
+            (aeron_frame_header_t *)(term + (position & ((int64_t)log->term_length - 1)));
+        int32_t frame_length;
+
+        AERON_GET_VOLATILE(frame_length, frame_header->frame_length);
+        if (frame_length <= 0)
+        {
+            break;
+        }
+
+        position += AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+    if (position <= log->scan_position)
+    {
+        return 0;
+    }
+
+    if (aeron_durable_log_msync(log, log->scan_position, position) < 0)
+    {
+        syncer->sync_failures++;
+        return 0;
+    }
+
+    log->scan_position = position;
+    AERON_PUT_ORDERED(log->durable_position, position);
+
+    return 1;
+}
+
+int aeron_durable_log_syncer_do_work(void *clientd)
+{
+    aeron_durable_log_syncer_t *syncer = (aeron_durable_log_syncer_t *)clientd;
+    int work_count = 0;
+
+    /* make room for a full queue up front so no log is taken that cannot be kept */
+    if (syncer->logs.length + AERON_DURABLE_LOG_SYNCER_MAX_PENDING > syncer->logs.capacity)
+    {
+        const size_t new_capacity = syncer->logs.capacity + AERON_DURABLE_LOG_SYNCER_MAX_PENDING;
+
+        if (aeron_array_ensure_capacity(
+            (uint8_t **)&syncer->logs.array, sizeof(aeron_durable_log_t *), syncer->logs.capacity, new_capacity) == 0)
+        {
+            syncer->logs.capacity = new_capacity;
+        }
+    }
+
+    if (syncer->logs.length + AERON_DURABLE_LOG_SYNCER_MAX_PENDING <= syncer->logs.capacity)
+    {
+        work_count += (int)aeron_spsc_concurrent_array_queue_drain_all(
+            &syncer->added, aeron_durable_log_syncer_on_added_func, syncer);
+    }
+
+    const int64_t now_ns = syncer->nano_clock();
+    if (now_ns - syncer->time_of_last_sync_ns < syncer->sync_interval_ns)
+    {
+        return work_count;
+    }
+
+    syncer->time_of_last_sync_ns = now_ns;
+
+    for (int last_index = (int)syncer->logs.length - 1, i = last_index; i >= 0; i--)
+    {
+        aeron_durable_log_t *log = syncer->logs.array[i];
+        bool is_closed;
+
+        AERON_GET_VOLATILE(is_closed, log->is_closed);
+        if (is_closed)
+        {
+            aeron_durable_log_delete(log);
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)syncer->logs.array, sizeof(aeron_durable_log_t *), (size_t)i, (size_t)last_index);
+            last_index--;
+            syncer->logs.length--;
+            work_count++;
+            continue;
+        }
+
+        work_count += aeron_durable_log_sync(syncer, log);
+    }
+
+    return work_count;
+}
+
+static void aeron_durable_log_syncer_delete_func(void *clientd, volatile void *item)
+{
+    aeron_durable_log_delete((aeron_durable_log_t *)item);
+}
+
+void aeron_durable_log_syncer_on_close(void *clientd)
+{
+    aeron_durable_log_syncer_t *syncer = (aeron_durable_log_syncer_t *)clientd;
+
+    for (size_t i = 0; i < syncer->logs.length; i++)
+    {
+        aeron_durable_log_delete(syncer->logs.array[i]);
+    }
+
+    aeron_free(syncer->logs.array);
+    syncer->logs.array = NULL;
+    syncer->logs.length = 0;
+    syncer->logs.capacity = 0;
+
+    aeron_spsc_concurrent_array_queue_drain_all(&syncer->added, aeron_durable_log_syncer_delete_func, NULL);
+    aeron_spsc_concurrent_array_queue_close(&syncer->added);
+}
+
+int aeron_durable_log_syncer_add(
+    aeron_durable_log_syncer_t *syncer, const char *path, int64_t position, aeron_durable_log_t **log)
+{
+    aeron_durable_log_t *_log = NULL;
+
+    if (aeron_alloc((void **)&_log, sizeof(aeron_durable_log_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_map_existing_file(&_log->mapped_file, path) < 0)
+    {
+        aeron_free(_log);
+        aeron_set_err(aeron_errcode(), "could not map durable log %s: %s", path, aeron_errmsg());
+        return -1;
+    }
+
+    _log->log_meta_data = (aeron_logbuffer_metadata_t *)(
+        (uint8_t *)_log->mapped_file.addr + (_log->mapped_file.length - AERON_LOGBUFFER_META_DATA_LENGTH));
+    _log->term_length = (size_t)_log->log_meta_data->term_length;
+    _log->page_size = (size_t)_log->log_meta_data->page_size;
+    _log->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)_log->term_length);
+    _log->initial_term_id = _log->log_meta_data->initial_term_id;
+    _log->scan_position = position;
+    _log->durable_position = position;
+    _log->is_closed = false;
+
+    if (AERON_OFFER_SUCCESS != aeron_spsc_concurrent_array_queue_offer(&syncer->added, _log))
+    {
+        aeron_durable_log_delete(_log);
+        aeron_set_err(EAGAIN, "%s", "durable log syncer is full");
+        return -1;
+    }
+
+    *log = _log;
+
+    return 0;
+}
+
+extern void aeron_durable_log_syncer_remove(aeron_durable_log_t *log);
+extern int64_t aeron_durable_log_position(aeron_durable_log_t *log);
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_DURABLE_LOG_SYNCER_H
+#define AERON_AERON_DURABLE_LOG_SYNCER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "aeron_driver_common.h"
+#include "aeronmd.h"
+#include "util/aeron_fileutil.h"
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "concurrent/aeron_spsc_concurrent_array_queue.h"
+
+#define AERON_DURABLE_LOG_SYNCER_MAX_PENDING (64)
+#define AERON_DURABLE_LOG_SYNCER_PUBLICATIONS_DIR "publications"
+
+/*
+ * A log on persistent storage the syncer flushes. The syncer has its own mapping of the file so the log outlives the
+ * publication that wrote it until the syncer sees it closed.
+ */
+typedef struct aeron_durable_log_stct
+{
+    aeron_mapped_file_t mapped_file;
+    aeron_logbuffer_metadata_t *log_meta_data;
+    int64_t scan_position;
+    int64_t durable_position;
+    size_t term_length;
+    size_t page_size;
+    size_t position_bits_to_shift;
+    int32_t initial_term_id;
+    bool is_closed;
+}
+aeron_durable_log_t;
+
+/*
+ * Flushes the logs of durable publications to storage off the conductor. On each sync interval it scans each log for
+ * the frames committed since the last flush, syncs all of them with one msync and only then publishes the position
+ * after them as durable, so writes from many publishers are committed as a group. Logs are handed over by the
+ * conductor through a queue and closed by flag, after which only the syncer touches them.
+ */
+typedef struct aeron_durable_log_syncer_stct
+{
+    aeron_spsc_concurrent_array_queue_t added;
+    struct aeron_durable_log_syncer_logs_stct
+    {
+        aeron_durable_log_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    logs;
+    aeron_clock_func_t nano_clock;
+    int64_t sync_interval_ns;
+    int64_t time_of_last_sync_ns;
+    int64_t sync_failures;
+    char dir[AERON_MAX_PATH];
+}
+aeron_durable_log_syncer_t;
+
+/*
+ * Creates a directory for the logs of this run of the driver under base_dir, as log file names are only unique
+ * within a run and the logs of earlier runs are kept.
+ */
+int aeron_durable_log_syncer_init(
+    aeron_durable_log_syncer_t *syncer,
+    const char *base_dir,
+    int64_t sync_interval_ns,
+    aeron_clock_func_t nano_clock,
+    int64_t epoch_ms);
+
+int aeron_durable_log_syncer_do_work(void *clientd);
+void aeron_durable_log_syncer_on_close(void *clientd);
+
+/*
+ * Called by the conductor to have the log at path synced from position on. The log meta data must be initialised.
+ */
+int aeron_durable_log_syncer_add(
+    aeron_durable_log_syncer_t *syncer, const char *path, int64_t position, aeron_durable_log_t **log);
+
+/*
+ * Called by the conductor once it is done with a log, which is then no longer synced and is freed by the syncer.
+ */
+inline void aeron_durable_log_syncer_remove(aeron_durable_log_t *log)
+{
+    AERON_PUT_ORDERED(log->is_closed, true);
+}
+
+inline int64_t aeron_durable_log_position(aeron_durable_log_t *log)
+{
+    int64_t position;
+    AERON_GET_VOLATILE(position, log->durable_position);
+
+    return position;
+}
+
+#endif //AERON_AERON_DURABLE_LOG_SYNCER_H
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "aeron_duty_cycle_tracker.h"
+#include "util/aeron_error.h"
+
+static int64_t *aeron_duty_cycle_tracker_counter_allocate(
+    aeron_counters_manager_t *counters_manager, int32_t type_id, int64_t key, const char *label)
+{
+    const int32_t counter_id = aeron_counters_manager_allocate(
+        counters_manager, type_id, (const uint8_t *)&key, sizeof(key), label, strlen(label));
+
+    if (counter_id < 0)
+    {
+        return NULL;
+    }
+
+    int64_t *addr = aeron_counter_addr(counters_manager, counter_id);
+    aeron_counter_set_ordered(addr, 0);
+
+    return addr;
+}
+
+int aeron_duty_cycle_tracker_init(
+    aeron_duty_cycle_tracker_t *tracker,
+    aeron_counters_manager_t *counters_manager,
+    const char *role_name,
+    int64_t threshold_ns,
+    aeron_clock_func_t nano_clock)
+{
+    char label[AERON_COUNTERS_SNAPSHOT_LABEL_LENGTH];
+    int64_t bound_ns = AERON_DUTY_CYCLE_HISTOGRAM_FIRST_BOUND_NS;
+
+    tracker->time_of_last_cycle_ns = 0;
+    tracker->threshold_ns = threshold_ns;
+    tracker->nano_clock = nano_clock;
+
+    snprintf(label, sizeof(label), "%s duty cycle timestamp in ns", role_name);
+    tracker->cycle_timestamp = aeron_duty_cycle_tracker_counter_allocate(
+        counters_manager, AERON_COUNTER_DUTY_CYCLE_TIMESTAMP_TYPE_ID, 0, label);
+
+    snprintf(label, sizeof(label), "%s max duty cycle time in ns", role_name);
+    tracker->max_cycle_time = aeron_duty_cycle_tracker_counter_allocate(
+        counters_manager, AERON_COUNTER_DUTY_CYCLE_MAX_TYPE_ID, 0, label);
+
+    snprintf(
+        label, sizeof(label), "%s duty cycle time exceeded count: threshold=%" PRId64 "ns", role_name, threshold_ns);
+    tracker->threshold_exceeded = aeron_duty_cycle_tracker_counter_allocate(
+        counters_manager, AERON_COUNTER_DUTY_CYCLE_THRESHOLD_EXCEEDED_TYPE_ID, threshold_ns, label);
+
+    if (NULL == tracker->cycle_timestamp || NULL == tracker->max_cycle_time || NULL == tracker->threshold_exceeded)
+    {
+        return -1;
+    }
+
+    for (size_t i = 0; i < AERON_DUTY_CYCLE_HISTOGRAM_BUCKET_COUNT; i++)
+    {
+        const bool is_last = AERON_DUTY_CYCLE_HISTOGRAM_BUCKET_COUNT - 1 == i;
+
+        snprintf(
+            label, sizeof(label), "%s duty cycles %s %" PRId64 "ns",
+            role_name, is_last ? ">" : "<=", is_last ? bound_ns / 10 : bound_ns);
+
+        if (NULL == (tracker->histogram[i] = aeron_duty_cycle_tracker_counter_allocate(
+            counters_manager, AERON_COUNTER_DUTY_CYCLE_HISTOGRAM_TYPE_ID, is_last ? INT64_MAX : bound_ns, label)))
+        {
+            return -1;
+        }
+
+        bound_ns *= 10;
+    }
+
+    return 0;
+}
+
+extern void aeron_duty_cycle_tracker_update(aeron_duty_cycle_tracker_t *tracker, int64_t now_ns);
+extern void aeron_duty_cycle_tracker_measure(aeron_duty_cycle_tracker_t *tracker);
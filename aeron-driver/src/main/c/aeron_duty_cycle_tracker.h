@@ -0,0 +1,92 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_DUTY_CYCLE_TRACKER_H
+#define AERON_AERON_DUTY_CYCLE_TRACKER_H
+
+#include <stdint.h>
+#include "aeronmd.h"
+#include "concurrent/aeron_counters_manager.h"
+
+#define AERON_COUNTER_DUTY_CYCLE_MAX_TYPE_ID (14)
+#define AERON_COUNTER_DUTY_CYCLE_THRESHOLD_EXCEEDED_TYPE_ID (15)
+#define AERON_COUNTER_DUTY_CYCLE_HISTOGRAM_TYPE_ID (16)
+#define AERON_COUNTER_DUTY_CYCLE_TIMESTAMP_TYPE_ID (17)
+
+/* buckets of 1us, 10us, 100us, 1ms, 10ms, 100ms and 1s upper bounds plus one for longer cycles */
+#define AERON_DUTY_CYCLE_HISTOGRAM_BUCKET_COUNT (8)
+#define AERON_DUTY_CYCLE_HISTOGRAM_FIRST_BOUND_NS (1000)
+
+/*
+ * Times the cycles of an agent, from the start of one call to do work to the start of the next, so time spent idle
+ * or descheduled is included and a thread that stopped being run shows up as a long cycle. The counters are only
+ * written by the agent thread. The timestamp of the start of the latest cycle is published as well so a thread that
+ * is stalled right now can be spotted by how old it is, in the driver nano clock.
+ */
+typedef struct aeron_duty_cycle_tracker_stct
+{
+    int64_t time_of_last_cycle_ns;
+    int64_t threshold_ns;
+    aeron_clock_func_t nano_clock;
+    int64_t *cycle_timestamp;
+    int64_t *max_cycle_time;
+    int64_t *threshold_exceeded;
+    int64_t *histogram[AERON_DUTY_CYCLE_HISTOGRAM_BUCKET_COUNT];
+}
+aeron_duty_cycle_tracker_t;
+
+int aeron_duty_cycle_tracker_init(
+    aeron_duty_cycle_tracker_t *tracker,
+    aeron_counters_manager_t *counters_manager,
+    const char *role_name,
+    int64_t threshold_ns,
+    aeron_clock_func_t nano_clock);
+
+inline void aeron_duty_cycle_tracker_update(aeron_duty_cycle_tracker_t *tracker, int64_t now_ns)
+{
+    const int64_t cycle_time_ns = now_ns - tracker->time_of_last_cycle_ns;
+
+    aeron_counter_set_ordered(tracker->cycle_timestamp, now_ns);
+
+    if (0 != tracker->time_of_last_cycle_ns)
+    {
+        int64_t bound_ns = AERON_DUTY_CYCLE_HISTOGRAM_FIRST_BOUND_NS;
+        size_t bucket = 0;
+
+        while (cycle_time_ns > bound_ns && bucket < AERON_DUTY_CYCLE_HISTOGRAM_BUCKET_COUNT - 1)
+        {
+            bound_ns *= 10;
+            bucket++;
+        }
+
+        aeron_counter_add_ordered(tracker->histogram[bucket], 1);
+        aeron_counter_propose_max_ordered(tracker->max_cycle_time, cycle_time_ns);
+
+        if (cycle_time_ns > tracker->threshold_ns)
+        {
+            aeron_counter_add_ordered(tracker->threshold_exceeded, 1);
+        }
+    }
+
+    tracker->time_of_last_cycle_ns = now_ns;
+}
+
+inline void aeron_duty_cycle_tracker_measure(aeron_duty_cycle_tracker_t *tracker)
+{
+    aeron_duty_cycle_tracker_update(tracker, tracker->nano_clock());
+}
+
+#endif //AERON_AERON_DUTY_CYCLE_TRACKER_H
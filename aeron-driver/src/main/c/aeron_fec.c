@@ -0,0 +1,225 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include "aeron_fec.h"
+#include "aeron_alloc.h"
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_error.h"
+
+int aeron_fec_encoder_init(aeron_fec_encoder_t *encoder, size_t group_size, size_t mtu_length)
+{
+    if (group_size < 1 || group_size > AERON_FEC_MAX_GROUP_SIZE)
+    {
+        aeron_set_err(EINVAL, "FEC group size must be 1 to %d: %d", AERON_FEC_MAX_GROUP_SIZE, (int)group_size);
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&encoder->parity, mtu_length) < 0)
+    {
+        return -1;
+    }
+
+    encoder->max_parity_length = mtu_length;
+    encoder->group_size = group_size;
+    encoder->datagram_count = 0;
+    encoder->parity_length = 0;
+    encoder->term_id = 0;
+    encoder->term_offset = 0;
+    encoder->next_term_offset = 0;
+    encoder->group_start_ns = 0;
+
+    return 0;
+}
+
+void aeron_fec_encoder_close(aeron_fec_encoder_t *encoder)
+{
+    aeron_free(encoder->parity);
+    encoder->parity = NULL;
+}
+
+inline static void aeron_fec_xor(uint8_t *dst, const uint8_t *src, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        dst[i] ^= src[i];
+    }
+}
+
+bool aeron_fec_encoder_add(
+    aeron_fec_encoder_t *encoder,
+    int32_t term_id,
+    int32_t term_offset,
+    const uint8_t *datagram,
+    size_t length,
+    int64_t now_ns)
+{
+    if (length > encoder->max_parity_length)
+    {
+        encoder->datagram_count = 0;
+        return false;
+    }
+
+    if (0 == encoder->datagram_count)
+    {
+        encoder->term_id = term_id;
+        encoder->term_offset = term_offset;
+        encoder->group_start_ns = now_ns;
+        encoder->parity_length = 0;
+    }
+
+    if (length > encoder->parity_length)
+    {
+        memset(encoder->parity + encoder->parity_length, 0, length - encoder->parity_length);
+        encoder->parity_length = length;
+    }
+
+    aeron_fec_xor(encoder->parity, datagram, length);
+    encoder->datagram_lengths[encoder->datagram_count++] = (int32_t)length;
+    encoder->next_term_offset = term_offset + (int32_t)length;
+
+    return encoder->datagram_count >= encoder->group_size;
+}
+
+size_t aeron_fec_encoder_encode(
+    aeron_fec_encoder_t *encoder, int32_t session_id, int32_t stream_id, uint8_t *frame, size_t capacity)
+{
+    const size_t lengths_length = encoder->datagram_count * sizeof(int32_t);
+    const size_t frame_length = sizeof(aeron_fec_header_t) + lengths_length + encoder->parity_length;
+    aeron_fec_header_t *header = (aeron_fec_header_t *)frame;
+
+    if (0 == encoder->datagram_count || frame_length > capacity)
+    {
+        encoder->datagram_count = 0;
+        return 0;
+    }
+
+    header->frame_header.frame_length = (int32_t)frame_length;
+    header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    header->frame_header.flags = 0;
+    header->frame_header.type = AERON_HDR_TYPE_FEC;
+    header->term_offset = encoder->term_offset;
+    header->session_id = session_id;
+    header->stream_id = stream_id;
+    header->term_id = encoder->term_id;
+    header->datagram_count = (int32_t)encoder->datagram_count;
+    header->parity_length = (int32_t)encoder->parity_length;
+
+    memcpy(frame + sizeof(aeron_fec_header_t), encoder->datagram_lengths, lengths_length);
+    memcpy(frame + sizeof(aeron_fec_header_t) + lengths_length, encoder->parity, encoder->parity_length);
+
+    encoder->datagram_count = 0;
+
+    return frame_length;
+}
+
+int aeron_fec_decode(
+    const uint8_t *frame,
+    size_t frame_length,
+    const uint8_t *term_buffer,
+    size_t term_length,
+    uint8_t *dst,
+    size_t dst_capacity,
+    int32_t *term_offset)
+{
+    const aeron_fec_header_t *header = (const aeron_fec_header_t *)frame;
+    int32_t datagram_lengths[AERON_FEC_MAX_GROUP_SIZE];
+    int32_t datagram_offsets[AERON_FEC_MAX_GROUP_SIZE];
+    int32_t missing_index = -1;
+
+    if (frame_length < sizeof(aeron_fec_header_t) ||
+        header->datagram_count < 1 ||
+        header->datagram_count > AERON_FEC_MAX_GROUP_SIZE ||
+        header->parity_length <= 0 ||
+        header->term_offset < 0 ||
+        frame_length < sizeof(aeron_fec_header_t) +
+            ((size_t)header->datagram_count * sizeof(int32_t)) + (size_t)header->parity_length)
+    {
+        return -1;
+    }
+
+    const size_t count = (size_t)header->datagram_count;
+    const uint8_t *parity = frame + sizeof(aeron_fec_header_t) + (count * sizeof(int32_t));
+    int64_t offset = header->term_offset;
+
+    memcpy(datagram_lengths, frame + sizeof(aeron_fec_header_t), count * sizeof(int32_t));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (datagram_lengths[i] < (int32_t)AERON_DATA_HEADER_LENGTH ||
+            datagram_lengths[i] > header->parity_length ||
+            offset + datagram_lengths[i] > (int64_t)term_length)
+        {
+            return -1;
+        }
+
+        int32_t frame_length_at_offset;
+        AERON_GET_VOLATILE(frame_length_at_offset, *(int32_t *)(term_buffer + offset));
+
+        if (0 == frame_length_at_offset)
+        {
+            if (missing_index >= 0)
+            {
+                return 0;
+            }
+
+            missing_index = (int32_t)i;
+        }
+
+        datagram_offsets[i] = (int32_t)offset;
+        offset += datagram_lengths[i];
+    }
+
+    if (missing_index < 0)
+    {
+        return 0;
+    }
+
+    const size_t length = (size_t)datagram_lengths[missing_index];
+    if (length > dst_capacity)
+    {
+        return -1;
+    }
+
+    memcpy(dst, parity, length);
+    for (size_t i = 0; i < count; i++)
+    {
+        if ((int32_t)i != missing_index)
+        {
+            const size_t xor_length = (size_t)datagram_lengths[i] < length ? (size_t)datagram_lengths[i] : length;
+            aeron_fec_xor(dst, term_buffer + datagram_offsets[i], xor_length);
+        }
+    }
+
+    const aeron_data_header_t *data_header = (const aeron_data_header_t *)dst;
+    if ((AERON_HDR_TYPE_DATA != data_header->frame_header.type && AERON_HDR_TYPE_PAD != data_header->frame_header.type) ||
+        data_header->frame_header.frame_length <= 0 ||
+        data_header->term_offset != datagram_offsets[missing_index] ||
+        data_header->term_id != header->term_id ||
+        data_header->session_id != header->session_id ||
+        data_header->stream_id != header->stream_id)
+    {
+        return -1;
+    }
+
+    *term_offset = datagram_offsets[missing_index];
+
+    return (int)length;
+}
+
+extern bool aeron_fec_encoder_is_discontiguous(aeron_fec_encoder_t *encoder, int32_t term_id, int32_t term_offset);
+extern bool aeron_fec_encoder_has_lingered(aeron_fec_encoder_t *encoder, int64_t now_ns);
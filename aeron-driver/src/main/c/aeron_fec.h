@@ -0,0 +1,105 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_FEC_H
+#define AERON_AERON_FEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "protocol/aeron_udp_protocol.h"
+
+/*
+ * Forward error correction by XOR parity. The sender sends a FEC frame after every group of datagrams it sends from
+ * a term. The frame carries the XOR of the datagrams, each aligned to the start of the parity, and their lengths.
+ * A receiver missing exactly one datagram of the group rebuilds it from the parity and the datagrams it has, without
+ * waiting a NAK and retransmit round trip. Losing more than one datagram of a group is left to NAKs.
+ */
+#define AERON_FEC_MAX_GROUP_SIZE (16)
+
+/* a partial group is sent once its first datagram is this old so loss at the tail of a burst is still covered */
+#define AERON_FEC_GROUP_LINGER_NS (1000 * 1000LL)
+
+#define AERON_FEC_FRAME_MAX_LENGTH(mtu) \
+    (sizeof(aeron_fec_header_t) + (AERON_FEC_MAX_GROUP_SIZE * sizeof(int32_t)) + (mtu))
+
+typedef struct aeron_fec_encoder_stct
+{
+    uint8_t *parity;
+    size_t max_parity_length;
+    size_t group_size;
+    size_t datagram_count;
+    size_t parity_length;
+    int32_t term_id;
+    int32_t term_offset;
+    int32_t next_term_offset;
+    int64_t group_start_ns;
+    int32_t datagram_lengths[AERON_FEC_MAX_GROUP_SIZE];
+}
+aeron_fec_encoder_t;
+
+int aeron_fec_encoder_init(aeron_fec_encoder_t *encoder, size_t group_size, size_t mtu_length);
+
+void aeron_fec_encoder_close(aeron_fec_encoder_t *encoder);
+
+/*
+ * Whether the pending group must be sent before the datagram at term_id and term_offset is added, because it is not
+ * contiguous with the group.
+ */
+inline bool aeron_fec_encoder_is_discontiguous(aeron_fec_encoder_t *encoder, int32_t term_id, int32_t term_offset)
+{
+    return encoder->datagram_count > 0 &&
+        (term_id != encoder->term_id || term_offset != encoder->next_term_offset);
+}
+
+/*
+ * Add a sent datagram to the pending group. Returns true when the group is full and should be sent.
+ */
+bool aeron_fec_encoder_add(
+    aeron_fec_encoder_t *encoder,
+    int32_t term_id,
+    int32_t term_offset,
+    const uint8_t *datagram,
+    size_t length,
+    int64_t now_ns);
+
+inline bool aeron_fec_encoder_has_lingered(aeron_fec_encoder_t *encoder, int64_t now_ns)
+{
+    return encoder->datagram_count > 0 && now_ns - encoder->group_start_ns >= AERON_FEC_GROUP_LINGER_NS;
+}
+
+/*
+ * Write the FEC frame of the pending group to frame and start a new group. Returns the frame length, or 0 when there
+ * is no pending group.
+ */
+size_t aeron_fec_encoder_encode(
+    aeron_fec_encoder_t *encoder, int32_t session_id, int32_t stream_id, uint8_t *frame, size_t capacity);
+
+/*
+ * Rebuild the datagram of a group that is missing from the term, frames being present when their length is set.
+ * Returns the length of the rebuilt datagram written to dst with its term offset, 0 when no datagram or more than
+ * one is missing, or -1 when the frame is malformed.
+ */
+int aeron_fec_decode(
+    const uint8_t *frame,
+    size_t frame_length,
+    const uint8_t *term_buffer,
+    size_t term_length,
+    uint8_t *dst,
+    size_t dst_capacity,
+    int32_t *term_offset);
+
+#endif //AERON_AERON_FEC_H
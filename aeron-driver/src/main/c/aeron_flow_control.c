@@ -21,9 +21,12 @@
 
 #include <dlfcn.h>
 #include <errno.h>
+#include <stdlib.h>
+#include <string.h>
 #include "protocol/aeron_udp_protocol.h"
 #include "concurrent/aeron_logbuffer_descriptor.h"
 #include "util/aeron_error.h"
+#include "util/aeron_arrayutil.h"
 #include "aeron_flow_control.h"
 #include "aeron_alloc.h"
 
@@ -44,6 +47,7 @@ typedef struct aeron_max_flow_control_strategy_state_stct
 {
     int64_t last_position;
     int64_t time_of_last_status_message;
+    int64_t limiting_receiver_id;
     bool should_linger;
 }
 aeron_max_flow_control_strategy_state_t;
@@ -92,7 +96,18 @@ int64_t aeron_max_flow_control_strategy_on_sm(
     strategy_state->last_position = position > strategy_state->last_position ? position : strategy_state->last_position;
     strategy_state->time_of_last_status_message = now_ns;
 
-    return (snd_lmt > window_edge) ? snd_lmt : window_edge;
+    if (window_edge > snd_lmt)
+    {
+        strategy_state->limiting_receiver_id = status_message_header->receiver_id;
+        return window_edge;
+    }
+
+    return snd_lmt;
+}
+
+int64_t aeron_max_flow_control_strategy_limiting_receiver_id(void *state)
+{
+    return ((aeron_max_flow_control_strategy_state_t *)state)->limiting_receiver_id;
 }
 
 bool aeron_max_flow_control_strategy_should_linger(
@@ -109,7 +124,6 @@ bool aeron_max_flow_control_strategy_should_linger(
 
 int aeron_max_flow_control_strategy_fini(aeron_flow_control_strategy_t *strategy)
 {
-    aeron_free(strategy->state);
     aeron_free(strategy);
     return 0;
 }
@@ -124,20 +138,25 @@ int aeron_max_multicast_flow_control_strategy_supplier(
 {
     aeron_flow_control_strategy_t *_strategy;
 
-    if (aeron_alloc((void **)&_strategy, sizeof(aeron_flow_control_strategy_t)) < 0 ||
-        aeron_alloc((void **)&_strategy->state, sizeof(aeron_max_flow_control_strategy_state_t)) < 0)
+    /* state follows the strategy in the same allocation, as the sender reads both on every status message */
+    if (aeron_alloc(
+        (void **)&_strategy, sizeof(aeron_flow_control_strategy_t) + sizeof(aeron_max_flow_control_strategy_state_t)) < 0)
     {
         return -1;
     }
 
+    _strategy->state = (uint8_t *)_strategy + sizeof(aeron_flow_control_strategy_t);
+
     _strategy->on_idle = aeron_max_flow_control_strategy_on_idle;
     _strategy->on_status_message = aeron_max_flow_control_strategy_on_sm;
     _strategy->should_linger = aeron_max_flow_control_strategy_should_linger;
     _strategy->fini = aeron_max_flow_control_strategy_fini;
+    _strategy->limiting_receiver_id = aeron_max_flow_control_strategy_limiting_receiver_id;
 
     aeron_max_flow_control_strategy_state_t *state = (aeron_max_flow_control_strategy_state_t *)_strategy->state;
     state->last_position = 0;
     state->time_of_last_status_message = 0;
+    state->limiting_receiver_id = 0;
     state->should_linger = true;
 
     *strategy = _strategy;
@@ -155,3 +174,432 @@ int aeron_unicast_flow_control_strategy_supplier(
     return aeron_max_multicast_flow_control_strategy_supplier(
         strategy, channel, stream_id, registration_id, initial_term_id, term_buffer_capacity);
 }
+
+static bool aeron_flow_control_strategy_name_equals(
+    const aeron_flow_control_strategy_options_t *options, const char *name)
+{
+    return strlen(name) == options->strategy_name_length &&
+        0 == strncmp(options->strategy_name, name, options->strategy_name_length);
+}
+
+static int aeron_flow_control_strategy_parse_timeout_ns(
+    const char *option, const char *option_end, int64_t *timeout_ns)
+{
+    char *end_ptr = NULL;
+    int64_t multiplier = 1;
+
+    errno = 0;
+    long long value = strtoll(option, &end_ptr, 10);
+    const size_t suffix_length = (size_t)(option_end - end_ptr);
+
+    if (0 != errno || end_ptr == option || value < 0)
+    {
+        return -1;
+    }
+
+    if (0 == suffix_length || (2 == suffix_length && 0 == strncmp(end_ptr, "ns", 2)))
+    {
+        multiplier = 1;
+    }
+    else if (2 == suffix_length && 0 == strncmp(end_ptr, "us", 2))
+    {
+        multiplier = 1000;
+    }
+    else if (2 == suffix_length && 0 == strncmp(end_ptr, "ms", 2))
+    {
+        multiplier = 1000 * 1000;
+    }
+    else if (1 == suffix_length && 's' == *end_ptr)
+    {
+        multiplier = 1000 * 1000 * 1000;
+    }
+    else
+    {
+        return -1;
+    }
+
+    if (value > (INT64_MAX / multiplier))
+    {
+        return -1;
+    }
+
+    *timeout_ns = (int64_t)value * multiplier;
+    return 0;
+}
+
+int aeron_flow_control_strategy_parse_options(const char *fc_value, aeron_flow_control_strategy_options_t *options)
+{
+    const char *separator = strchr(fc_value, ',');
+
+    options->strategy_name = fc_value;
+    options->strategy_name_length = (NULL == separator) ? strlen(fc_value) : (size_t)(separator - fc_value);
+    options->receiver_timeout_ns = AERON_MIN_FLOW_CONTROL_STRATEGY_RECEIVER_TIMEOUT_NS;
+    options->group_tag = 0;
+    options->has_group_tag = false;
+
+    while (NULL != separator)
+    {
+        const char *option = separator + 1;
+        separator = strchr(option, ',');
+        const char *option_end = (NULL == separator) ? option + strlen(option) : separator;
+
+        if (option_end - option < 3 || ':' != option[1])
+        {
+            aeron_set_err(EINVAL, "could not parse flow control option: %s", fc_value);
+            return -1;
+        }
+
+        switch (option[0])
+        {
+            case 'g':
+            {
+                char *end_ptr = NULL;
+
+                errno = 0;
+                long long value = strtoll(option + 2, &end_ptr, 0);
+
+                if (0 != errno || end_ptr != option_end)
+                {
+                    aeron_set_err(EINVAL, "could not parse flow control group tag: %s", fc_value);
+                    return -1;
+                }
+
+                options->group_tag = (int64_t)value;
+                options->has_group_tag = true;
+                break;
+            }
+
+            case 't':
+                if (aeron_flow_control_strategy_parse_timeout_ns(
+                    option + 2, option_end, &options->receiver_timeout_ns) < 0)
+                {
+                    aeron_set_err(EINVAL, "could not parse flow control receiver timeout: %s", fc_value);
+                    return -1;
+                }
+                break;
+
+            default:
+                aeron_set_err(EINVAL, "unknown flow control option: %s", fc_value);
+                return -1;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_flow_control_strategy_supplier_for_uri(
+    aeron_uri_t *uri,
+    aeron_flow_control_strategy_supplier_func_t default_supplier,
+    aeron_flow_control_strategy_supplier_func_t *supplier)
+{
+    const char *fc_value;
+    aeron_flow_control_strategy_options_t options;
+
+    *supplier = default_supplier;
+
+    if (AERON_URI_UDP != uri->type ||
+        (fc_value = aeron_uri_find_param_value(
+            &uri->params.udp.additional_params, AERON_UDP_CHANNEL_FLOW_CONTROL_KEY)) == NULL)
+    {
+        return 0;
+    }
+
+    if (aeron_flow_control_strategy_parse_options(fc_value, &options) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_flow_control_strategy_name_equals(&options, AERON_FLOW_CONTROL_STRATEGY_NAME_MAX))
+    {
+        *supplier = aeron_max_multicast_flow_control_strategy_supplier;
+    }
+    else if (aeron_flow_control_strategy_name_equals(&options, AERON_FLOW_CONTROL_STRATEGY_NAME_MIN))
+    {
+        *supplier = aeron_min_multicast_flow_control_strategy_supplier;
+    }
+    else if (aeron_flow_control_strategy_name_equals(&options, AERON_FLOW_CONTROL_STRATEGY_NAME_TAGGED))
+    {
+        *supplier = aeron_tagged_multicast_flow_control_strategy_supplier;
+    }
+    else
+    {
+        aeron_set_err(EINVAL, "unknown flow control strategy: %s", fc_value);
+        return -1;
+    }
+
+    return 0;
+}
+
+typedef struct aeron_min_flow_control_strategy_receiver_stct
+{
+    int64_t last_position;
+    int64_t last_position_plus_window;
+    int64_t time_of_last_status_message;
+    int64_t receiver_id;
+}
+aeron_min_flow_control_strategy_receiver_t;
+
+typedef struct aeron_min_flow_control_strategy_state_stct
+{
+    struct aeron_min_flow_control_strategy_receivers_stct
+    {
+        aeron_min_flow_control_strategy_receiver_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    receivers;
+
+    int64_t receiver_timeout_ns;
+    int64_t group_tag;
+    int64_t limiting_receiver_id;
+    bool is_tagged;
+    bool should_linger;
+}
+aeron_min_flow_control_strategy_state_t;
+
+int64_t aeron_min_flow_control_strategy_on_idle(
+    void *state,
+    int64_t now_ns,
+    int64_t snd_lmt,
+    int64_t snd_pos,
+    bool is_end_of_stream)
+{
+    aeron_min_flow_control_strategy_state_t *strategy_state = (aeron_min_flow_control_strategy_state_t *)state;
+    int64_t min_limit_position = INT64_MAX;
+    int64_t min_last_position = INT64_MAX;
+
+    for (int last_index = (int)strategy_state->receivers.length - 1, i = last_index; i >= 0; i--)
+    {
+        aeron_min_flow_control_strategy_receiver_t *receiver = &strategy_state->receivers.array[i];
+
+        if (now_ns > (receiver->time_of_last_status_message + strategy_state->receiver_timeout_ns))
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)strategy_state->receivers.array,
+                sizeof(aeron_min_flow_control_strategy_receiver_t),
+                (size_t)i,
+                (size_t)last_index);
+            last_index--;
+            strategy_state->receivers.length--;
+        }
+        else
+        {
+            if (receiver->last_position_plus_window < min_limit_position)
+            {
+                min_limit_position = receiver->last_position_plus_window;
+                strategy_state->limiting_receiver_id = receiver->receiver_id;
+            }
+            min_last_position = receiver->last_position < min_last_position ?
+                receiver->last_position : min_last_position;
+        }
+    }
+
+    if (is_end_of_stream && strategy_state->should_linger)
+    {
+        if (0 == strategy_state->receivers.length || min_last_position >= snd_pos)
+        {
+            AERON_PUT_ORDERED(strategy_state->should_linger, false);
+        }
+    }
+
+    return strategy_state->receivers.length > 0 ? min_limit_position : snd_lmt;
+}
+
+inline static bool aeron_min_flow_control_strategy_has_group_tag(
+    const uint8_t *sm, size_t length, int64_t group_tag)
+{
+    int64_t sm_group_tag;
+
+    if (length < AERON_STATUS_MESSAGE_GROUP_TAG_OFFSET + sizeof(int64_t))
+    {
+        return false;
+    }
+
+    memcpy(&sm_group_tag, sm + AERON_STATUS_MESSAGE_GROUP_TAG_OFFSET, sizeof(int64_t));
+
+    return group_tag == sm_group_tag;
+}
+
+int64_t aeron_min_flow_control_strategy_on_sm(
+    void *state,
+    const uint8_t *sm,
+    size_t length,
+    struct sockaddr_storage *recv_addr,
+    int64_t snd_lmt,
+    int32_t initial_term_id,
+    size_t position_bits_to_shift,
+    int64_t now_ns)
+{
+    aeron_status_message_header_t *status_message_header = (aeron_status_message_header_t *)sm;
+    aeron_min_flow_control_strategy_state_t *strategy_state = (aeron_min_flow_control_strategy_state_t *)state;
+
+    if (strategy_state->is_tagged &&
+        !aeron_min_flow_control_strategy_has_group_tag(sm, length, strategy_state->group_tag))
+    {
+        return snd_lmt;
+    }
+
+    int64_t position = aeron_logbuffer_compute_position(
+        status_message_header->consumption_term_id,
+        status_message_header->consumption_term_offset,
+        position_bits_to_shift,
+        initial_term_id);
+    int64_t window_edge = position + status_message_header->receiver_window;
+    int64_t min_limit_position = window_edge;
+    int64_t limiting_receiver_id = status_message_header->receiver_id;
+    bool is_existing = false;
+
+    for (size_t i = 0, size = strategy_state->receivers.length; i < size; i++)
+    {
+        aeron_min_flow_control_strategy_receiver_t *receiver = &strategy_state->receivers.array[i];
+
+        if (status_message_header->receiver_id == receiver->receiver_id)
+        {
+            receiver->last_position = position > receiver->last_position ? position : receiver->last_position;
+            receiver->last_position_plus_window = window_edge;
+            receiver->time_of_last_status_message = now_ns;
+            is_existing = true;
+        }
+
+        if (receiver->last_position_plus_window < min_limit_position)
+        {
+            min_limit_position = receiver->last_position_plus_window;
+            limiting_receiver_id = receiver->receiver_id;
+        }
+    }
+
+    if (!is_existing)
+    {
+        int ensure_capacity_result = 0;
+
+        AERON_ARRAY_ENSURE_CAPACITY(
+            ensure_capacity_result, strategy_state->receivers, aeron_min_flow_control_strategy_receiver_t);
+
+        if (ensure_capacity_result < 0)
+        {
+            return strategy_state->receivers.length > 0 ? min_limit_position : snd_lmt;
+        }
+
+        aeron_min_flow_control_strategy_receiver_t *receiver =
+            &strategy_state->receivers.array[strategy_state->receivers.length++];
+
+        receiver->last_position = position;
+        receiver->last_position_plus_window = window_edge;
+        receiver->time_of_last_status_message = now_ns;
+        receiver->receiver_id = status_message_header->receiver_id;
+    }
+
+    strategy_state->limiting_receiver_id = limiting_receiver_id;
+
+    return min_limit_position;
+}
+
+int64_t aeron_min_flow_control_strategy_limiting_receiver_id(void *state)
+{
+    return ((aeron_min_flow_control_strategy_state_t *)state)->limiting_receiver_id;
+}
+
+bool aeron_min_flow_control_strategy_should_linger(
+    void *state,
+    int64_t now_ns)
+{
+    aeron_min_flow_control_strategy_state_t *strategy_state = (aeron_min_flow_control_strategy_state_t *)state;
+
+    bool should_linger;
+    AERON_GET_VOLATILE(should_linger, strategy_state->should_linger);
+
+    return should_linger;
+}
+
+int aeron_min_flow_control_strategy_fini(aeron_flow_control_strategy_t *strategy)
+{
+    aeron_min_flow_control_strategy_state_t *strategy_state =
+        (aeron_min_flow_control_strategy_state_t *)strategy->state;
+
+    aeron_free(strategy_state->receivers.array);
+    aeron_free(strategy);
+    return 0;
+}
+
+static int aeron_min_flow_control_strategy_allocate(
+    aeron_flow_control_strategy_t **strategy, const char *channel, bool is_tagged)
+{
+    aeron_flow_control_strategy_options_t options;
+    aeron_uri_t uri;
+    const char *fc_value = NULL;
+
+    if (aeron_uri_parse(channel, &uri) < 0)
+    {
+        return -1;
+    }
+
+    if (AERON_URI_UDP == uri.type)
+    {
+        fc_value = aeron_uri_find_param_value(&uri.params.udp.additional_params, AERON_UDP_CHANNEL_FLOW_CONTROL_KEY);
+    }
+
+    int result = aeron_flow_control_strategy_parse_options(NULL == fc_value ? "" : fc_value, &options);
+    aeron_uri_close(&uri);
+
+    if (result < 0)
+    {
+        return -1;
+    }
+
+    if (is_tagged && !options.has_group_tag)
+    {
+        aeron_set_err(EINVAL, "tagged flow control requires a group tag, e.g. fc=tagged,g:<tag>: %s", channel);
+        return -1;
+    }
+
+    aeron_flow_control_strategy_t *_strategy;
+
+    if (aeron_alloc(
+        (void **)&_strategy, sizeof(aeron_flow_control_strategy_t) + sizeof(aeron_min_flow_control_strategy_state_t)) < 0)
+    {
+        return -1;
+    }
+
+    _strategy->state = (uint8_t *)_strategy + sizeof(aeron_flow_control_strategy_t);
+
+    _strategy->on_idle = aeron_min_flow_control_strategy_on_idle;
+    _strategy->on_status_message = aeron_min_flow_control_strategy_on_sm;
+    _strategy->should_linger = aeron_min_flow_control_strategy_should_linger;
+    _strategy->fini = aeron_min_flow_control_strategy_fini;
+    _strategy->limiting_receiver_id = aeron_min_flow_control_strategy_limiting_receiver_id;
+
+    aeron_min_flow_control_strategy_state_t *state = (aeron_min_flow_control_strategy_state_t *)_strategy->state;
+    state->receivers.array = NULL;
+    state->receivers.length = 0;
+    state->receivers.capacity = 0;
+    state->receiver_timeout_ns = options.receiver_timeout_ns;
+    state->group_tag = options.group_tag;
+    state->limiting_receiver_id = 0;
+    state->is_tagged = is_tagged;
+    state->should_linger = true;
+
+    *strategy = _strategy;
+    return 0;
+}
+
+int aeron_min_multicast_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity)
+{
+    return aeron_min_flow_control_strategy_allocate(strategy, channel, false);
+}
+
+int aeron_tagged_multicast_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity)
+{
+    return aeron_min_flow_control_strategy_allocate(strategy, channel, true);
+}
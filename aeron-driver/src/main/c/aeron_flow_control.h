@@ -19,10 +19,16 @@
 
 #include <netinet/in.h>
 #include "aeron_driver_common.h"
+#include "uri/aeron_uri.h"
 
 typedef struct aeron_flow_control_strategy_stct aeron_flow_control_strategy_t;
 
 #define AERON_MAX_FLOW_CONTROL_STRATEGY_RECEIVER_TIMEOUT_NS (2 * 1000 * 1000 * 1000L)
+#define AERON_MIN_FLOW_CONTROL_STRATEGY_RECEIVER_TIMEOUT_NS (2 * 1000 * 1000 * 1000L)
+
+#define AERON_FLOW_CONTROL_STRATEGY_NAME_MAX "max"
+#define AERON_FLOW_CONTROL_STRATEGY_NAME_MIN "min"
+#define AERON_FLOW_CONTROL_STRATEGY_NAME_TAGGED "tagged"
 
 typedef int64_t (*aeron_flow_control_strategy_on_idle_func_t)(
     void *state,
@@ -48,12 +54,16 @@ typedef bool (*aeron_flow_control_strategy_should_linger_func_t)(
 typedef int (*aeron_flow_control_strategy_fini_func_t)(
     aeron_flow_control_strategy_t *strategy);
 
+typedef int64_t (*aeron_flow_control_strategy_limiting_receiver_id_func_t)(void *state);
+
 typedef struct aeron_flow_control_strategy_stct
 {
     aeron_flow_control_strategy_on_sm_func_t on_status_message;
     aeron_flow_control_strategy_on_idle_func_t on_idle;
     aeron_flow_control_strategy_should_linger_func_t should_linger;
     aeron_flow_control_strategy_fini_func_t fini;
+    /* receiver id whose window set the last limit returned, for the flow control trace, may be NULL */
+    aeron_flow_control_strategy_limiting_receiver_id_func_t limiting_receiver_id;
     void *state;
 }
 aeron_flow_control_strategy_t;
@@ -68,4 +78,66 @@ typedef int (*aeron_flow_control_strategy_supplier_func_t)(
 
 aeron_flow_control_strategy_supplier_func_t aeron_flow_control_strategy_supplier_load(const char *strategy_name);
 
+/*
+ * Options carried by the fc channel parameter, e.g. fc=min,t:5s or fc=tagged,g:100,t:500ms. The receiver timeout is
+ * in ns with an optional ns, us, ms or s suffix.
+ */
+typedef struct aeron_flow_control_strategy_options_stct
+{
+    const char *strategy_name;
+    size_t strategy_name_length;
+    int64_t receiver_timeout_ns;
+    int64_t group_tag;
+    bool has_group_tag;
+}
+aeron_flow_control_strategy_options_t;
+
+int aeron_flow_control_strategy_parse_options(const char *fc_value, aeron_flow_control_strategy_options_t *options);
+
+/*
+ * The supplier named by the channel's fc parameter, or default_supplier when the channel does not have one.
+ */
+int aeron_flow_control_strategy_supplier_for_uri(
+    aeron_uri_t *uri,
+    aeron_flow_control_strategy_supplier_func_t default_supplier,
+    aeron_flow_control_strategy_supplier_func_t *supplier);
+
+int aeron_max_multicast_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity);
+
+int aeron_unicast_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity);
+
+/*
+ * Limits the sender to the slowest receiver that has sent a status message within the receiver timeout.
+ */
+int aeron_min_multicast_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity);
+
+/*
+ * As min but only receivers whose status messages carry the group tag given by the channel's fc parameter count.
+ */
+int aeron_tagged_multicast_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity);
+
 #endif //AERON_AERON_FLOW_CONTROL_H
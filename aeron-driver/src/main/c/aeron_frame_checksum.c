@@ -0,0 +1,99 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_crc32c.h"
+#include "aeron_frame_checksum.h"
+
+static uint32_t aeron_frame_checksum_compute(const uint8_t *frame, size_t payload_length)
+{
+    const uint32_t crc = aeron_crc32c(0, frame, AERON_FRAME_CHECKSUM_HEADER_LENGTH);
+
+    return aeron_crc32c(crc, frame + sizeof(aeron_data_header_t), payload_length);
+}
+
+/*
+ * Payload of the frame at offset that is in the datagram: that of a data frame, as padding goes out as its header.
+ * Returns the length of the frame in the datagram, or 0 if it runs past the end of it.
+ */
+static size_t aeron_frame_checksum_frame_length(
+    const uint8_t *buffer, size_t offset, size_t length, size_t *payload_length)
+{
+    const aeron_frame_header_t *frame_header = (const aeron_frame_header_t *)(buffer + offset);
+    const size_t frame_length = frame_header->frame_length > 0 ? (size_t)frame_header->frame_length : 0;
+
+    *payload_length = 0;
+    if (AERON_HDR_TYPE_DATA == frame_header->type && frame_length > sizeof(aeron_data_header_t))
+    {
+        *payload_length = frame_length - sizeof(aeron_data_header_t);
+    }
+
+    if (*payload_length > length - offset - sizeof(aeron_data_header_t))
+    {
+        return 0;
+    }
+
+    return frame_length > sizeof(aeron_data_header_t) ?
+        AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT) : sizeof(aeron_data_header_t);
+}
+
+void aeron_frame_checksum_stamp(uint8_t *buffer, size_t length)
+{
+    size_t offset = 0;
+
+    while (offset < length && length - offset >= sizeof(aeron_data_header_t))
+    {
+        aeron_data_header_t *data_header = (aeron_data_header_t *)(buffer + offset);
+        size_t payload_length;
+        const size_t aligned_length = aeron_frame_checksum_frame_length(buffer, offset, length, &payload_length);
+
+        if (0 == aligned_length)
+        {
+            break;
+        }
+
+        data_header->reserved_value = (int64_t)aeron_frame_checksum_compute(buffer + offset, payload_length);
+        offset += aligned_length;
+    }
+}
+
+bool aeron_frame_checksum_verify(const uint8_t *buffer, size_t length)
+{
+    size_t offset = 0;
+
+    while (offset < length)
+    {
+        if (length - offset < sizeof(aeron_data_header_t))
+        {
+            return false;
+        }
+
+        const aeron_data_header_t *data_header = (const aeron_data_header_t *)(buffer + offset);
+        size_t payload_length;
+        const size_t aligned_length = aeron_frame_checksum_frame_length(buffer, offset, length, &payload_length);
+
+        if (0 == aligned_length ||
+            (int64_t)aeron_frame_checksum_compute(buffer + offset, payload_length) != data_header->reserved_value)
+        {
+            return false;
+        }
+
+        offset += aligned_length;
+    }
+
+    return true;
+}
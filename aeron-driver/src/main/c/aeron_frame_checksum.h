@@ -0,0 +1,44 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_FRAME_CHECKSUM_H
+#define AERON_AERON_FRAME_CHECKSUM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "protocol/aeron_udp_protocol.h"
+
+/*
+ * End to end integrity of data frames on channels with checksum=crc32c, for paths where UDP checksums are turned off.
+ * The sender stamps the CRC32C of each data frame into its reserved value, which covers the header up to the reserved
+ * value and the payload, or only the header for padding and heartbeats. Receivers on a checksummed channel drop a
+ * datagram holding any frame that does not match, for it to be NAKed and sent again. The reserved value a publisher
+ * gives a frame on such a channel is lost.
+ */
+#define AERON_FRAME_CHECKSUM_HEADER_LENGTH (offsetof(aeron_data_header_t, reserved_value))
+
+/*
+ * Stamp the checksum into each of the frames of a datagram of length bytes as the sender sends it from the term.
+ */
+void aeron_frame_checksum_stamp(uint8_t *buffer, size_t length);
+
+/*
+ * Whether each of the frames of a datagram of length bytes has the checksum stamped by the sender.
+ */
+bool aeron_frame_checksum_verify(const uint8_t *buffer, size_t length);
+
+#endif //AERON_AERON_FRAME_CHECKSUM_H
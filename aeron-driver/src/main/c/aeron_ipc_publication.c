@@ -23,6 +23,7 @@
 #include "aeron_alloc.h"
 #include "protocol/aeron_udp_protocol.h"
 #include "aeron_driver_conductor.h"
+#include "aeron_raw_log_pool.h"
 #include "util/aeron_error.h"
 
 int aeron_ipc_publication_create(
@@ -32,17 +33,20 @@ int aeron_ipc_publication_create(
     int32_t stream_id,
     int64_t registration_id,
     aeron_position_t *pub_lmt_position,
+    aeron_position_t *pub_dur_position,
     int32_t initial_term_id,
-    size_t term_buffer_length,
-    size_t mtu_length,
+    aeron_uri_publication_params_t *params,
     bool is_exclusive,
     aeron_system_counters_t *system_counters)
 {
+    const size_t term_buffer_length = params->term_length;
+    /* durable logs live on the storage of the syncer and are never pooled, as the pool is kept in the aeron dir */
+    const char *log_dir = params->is_durable ? context->durable_log_syncer->dir : context->aeron_dir;
     char path[AERON_MAX_PATH];
     int path_length =
-        aeron_ipc_publication_location(path, sizeof(path), context->aeron_dir, session_id, stream_id, registration_id);
+        aeron_ipc_publication_location(path, sizeof(path), log_dir, session_id, stream_id, registration_id);
     aeron_ipc_publication_t *_pub = NULL;
-    const uint64_t usable_fs_space = context->usable_fs_space_func(context->aeron_dir);
+    const uint64_t usable_fs_space = context->usable_fs_space_func(log_dir);
     const uint64_t log_length = aeron_logbuffer_compute_log_length(term_buffer_length, context->file_page_size);
     const int64_t now_ns = context->nano_clock();
 
@@ -50,7 +54,7 @@ int aeron_ipc_publication_create(
 
     if (usable_fs_space < log_length)
     {
-        aeron_set_err(ENOSPC, "Insufficient usable storage for new log of length=%d in %s", log_length, context->aeron_dir);
+        aeron_set_err(ENOSPC, "Insufficient usable storage for new log of length=%d in %s", log_length, log_dir);
         return -1;
     }
 
@@ -68,8 +72,16 @@ int aeron_ipc_publication_create(
         return -1;
     }
 
-    if (context->map_raw_log_func(
-        &_pub->mapped_raw_log, path, context->term_buffer_sparse_file, term_buffer_length, context->file_page_size) < 0)
+    if (aeron_raw_log_pool_map_raw_log(
+        params->is_durable ? NULL : context->raw_log_pool,
+        context->map_raw_log_func,
+        &_pub->mapped_raw_log,
+        path,
+        context->term_buffer_sparse_file,
+        term_buffer_length,
+        context->file_page_size,
+        context->term_buffer_prefault,
+        context->term_buffer_lock) < 0)
     {
         aeron_free(_pub->log_file_name);
         aeron_free(_pub);
@@ -83,16 +95,38 @@ int aeron_ipc_publication_create(
     _pub->log_file_name_length = (size_t)path_length;
     _pub->log_meta_data = (aeron_logbuffer_metadata_t *)(_pub->mapped_raw_log.log_meta_data.addr);
 
-    _pub->log_meta_data->term_tail_counters[0] = (int64_t)initial_term_id << 32;
-    for (int i = 1; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    if (params->is_replay)
     {
-        const int64_t expected_term_id = (initial_term_id + i) - AERON_LOGBUFFER_PARTITION_COUNT;
-        _pub->log_meta_data->term_tail_counters[i] = expected_term_id << 32;
+        const int32_t term_id = (int32_t)params->term_id;
+        const int32_t term_count = term_id - initial_term_id;
+        size_t active_index = aeron_logbuffer_index_by_term_count(term_count);
+
+        _pub->log_meta_data->term_tail_counters[active_index] =
+            ((int64_t)term_id << 32) | (int64_t)params->term_offset;
+        for (int i = 1; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+        {
+            const int64_t expected_term_id = (term_id + i) - AERON_LOGBUFFER_PARTITION_COUNT;
+
+            active_index = (active_index + 1) % AERON_LOGBUFFER_PARTITION_COUNT;
+            _pub->log_meta_data->term_tail_counters[active_index] = expected_term_id << 32;
+        }
+
+        _pub->log_meta_data->active_term_count = term_count;
+    }
+    else
+    {
+        _pub->log_meta_data->term_tail_counters[0] = (int64_t)initial_term_id << 32;
+        for (int i = 1; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+        {
+            const int64_t expected_term_id = (initial_term_id + i) - AERON_LOGBUFFER_PARTITION_COUNT;
+            _pub->log_meta_data->term_tail_counters[i] = expected_term_id << 32;
+        }
+
+        _pub->log_meta_data->active_term_count = 0;
     }
 
-    _pub->log_meta_data->active_term_count = 0;
     _pub->log_meta_data->initial_term_id = initial_term_id;
-    _pub->log_meta_data->mtu_length = (int32_t)mtu_length;
+    _pub->log_meta_data->mtu_length = (int32_t)params->mtu_length;
     _pub->log_meta_data->term_length = (int32_t)term_buffer_length;
     _pub->log_meta_data->page_size = (int32_t)context->file_page_size;
     _pub->log_meta_data->correlation_id = registration_id;
@@ -108,16 +142,23 @@ int aeron_ipc_publication_create(
     _pub->conductor_fields.subscribable.add_position_hook_func = aeron_ipc_publication_add_subscriber_hook;
     _pub->conductor_fields.subscribable.remove_position_hook_func = aeron_ipc_publication_remove_subscriber_hook;
     _pub->conductor_fields.subscribable.clientd = _pub;
+    _pub->conductor_fields.subscribable.min_position_addr = NULL;
+    _pub->conductor_fields.subscribable.min_position = 0;
     _pub->conductor_fields.managed_resource.registration_id = registration_id;
     _pub->conductor_fields.managed_resource.clientd = _pub;
     _pub->conductor_fields.managed_resource.incref = aeron_ipc_publication_incref;
     _pub->conductor_fields.managed_resource.decref = aeron_ipc_publication_decref;
     _pub->conductor_fields.has_reached_end_of_life = false;
+    _pub->conductor_fields.subscriber_positions_changed = false;
     _pub->conductor_fields.cleaning_position = 0;
     _pub->conductor_fields.trip_limit = 0;
     _pub->conductor_fields.consumer_position = 0;
     _pub->conductor_fields.last_consumer_position = 0;
+    _pub->conductor_fields.rate_sample_position = -1;
     _pub->conductor_fields.time_of_last_consumer_position_change = now_ns;
+    _pub->conductor_fields.longest_stall_ns = 0;
+    _pub->conductor_fields.fast_unblock_deadline_ns = 0;
+    _pub->conductor_fields.is_stalled = false;
     _pub->conductor_fields.status = AERON_IPC_PUBLICATION_STATUS_ACTIVE;
     _pub->conductor_fields.refcnt = 1;
     _pub->session_id = session_id;
@@ -128,15 +169,53 @@ int aeron_ipc_publication_create(
     _pub->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)term_buffer_length);
     _pub->term_window_length = (int64_t)aeron_ipc_publication_term_window_length(context, term_buffer_length);
     _pub->trip_gain = _pub->term_window_length / 8;
+    _pub->term_clean_chunk_length = (int64_t)context->term_buffer_clean_chunk_length;
+    _pub->file_page_size = context->file_page_size;
+    _pub->release_cleaned_pages = context->term_buffer_sparse_file || context->term_buffer_release_pages;
     _pub->linger_timeout_ns = (int64_t)context->publication_linger_timeout_ns;
     _pub->unblock_timeout_ns = (int64_t)context->publication_unblock_timeout_ns;
+    _pub->unblock_timeout_min_ns = (int64_t)context->publication_unblock_timeout_min_ns;
     _pub->is_exclusive = is_exclusive;
 
     _pub->conductor_fields.consumer_position = aeron_ipc_publication_producer_position(_pub);
     _pub->conductor_fields.last_consumer_position = _pub->conductor_fields.consumer_position;
+    _pub->conductor_fields.cleaning_position = _pub->conductor_fields.consumer_position;
+    _pub->conductor_fields.activity_position = _pub->conductor_fields.consumer_position;
+
+    _pub->log_meta_data->subscriber_positions_change_number = 0;
+    _pub->log_meta_data->subscriber_position_count = 0;
+    _pub->log_meta_data->clean_limit =
+        _pub->conductor_fields.cleaning_position +
+        ((AERON_LOGBUFFER_PARTITION_COUNT - 1) * (int64_t)_pub->mapped_raw_log.term_length);
+    /* clients computing their own limit would not be held to the durable position */
+    _pub->log_meta_data->publisher_window_length =
+        context->ipc_client_publisher_limit && !params->is_durable ? (int32_t)_pub->term_window_length : 0;
+    _pub->log_meta_data->is_subscriber_wakeup = context->ipc_subscriber_wakeup ? 1 : 0;
+    _pub->log_meta_data->subscriber_waiters = 0;
+    _pub->log_meta_data->subscriber_wake_sequence = 0;
 
     _pub->unblocked_publications_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_UNBLOCKED_PUBLICATIONS);
+    _pub->log_buffer_released_bytes_counter =
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_LOG_BUFFER_RELEASED_BYTES);
+
+    _pub->pub_dur_position.counter_id = pub_dur_position->counter_id;
+    _pub->pub_dur_position.value_addr = pub_dur_position->value_addr;
+    _pub->durable_log = NULL;
+
+    if (params->is_durable)
+    {
+        aeron_counter_set_ordered(_pub->pub_dur_position.value_addr, _pub->conductor_fields.consumer_position);
+
+        if (aeron_durable_log_syncer_add(
+            context->durable_log_syncer, path, _pub->conductor_fields.consumer_position, &_pub->durable_log) < 0)
+        {
+            _pub->map_raw_log_close_func(&_pub->mapped_raw_log);
+            aeron_free(_pub->log_file_name);
+            aeron_free(_pub);
+            return -1;
+        }
+    }
 
     *publication = _pub;
     return 0;
@@ -148,6 +227,12 @@ void aeron_ipc_publication_close(aeron_counters_manager_t *counters_manager, aer
 
     aeron_counters_manager_free(counters_manager, (int32_t)publication->pub_lmt_position.counter_id);
 
+    if (NULL != publication->durable_log)
+    {
+        aeron_counters_manager_free(counters_manager, (int32_t)publication->pub_dur_position.counter_id);
+        aeron_durable_log_syncer_remove(publication->durable_log);
+    }
+
     for (size_t i = 0, length = subscribable->length; i < length; i++)
     {
         aeron_counters_manager_free(counters_manager, (int32_t)subscribable->array[i].counter_id);
@@ -163,34 +248,138 @@ void aeron_ipc_publication_close(aeron_counters_manager_t *counters_manager, aer
     aeron_free(publication);
 }
 
-int aeron_ipc_publication_update_pub_lmt(aeron_ipc_publication_t *publication)
+/*
+ * List the subscriber position counters in the log meta data for clients computing their own publisher limit. The
+ * change number is odd while the list is rewritten so a client reading it concurrently discards what it read. When
+ * there are more subscribers than fit the list is left empty and clients use the publisher limit counter.
+ */
+static void aeron_ipc_publication_publish_subscriber_positions(aeron_ipc_publication_t *publication)
+{
+    aeron_logbuffer_metadata_t *log_meta_data = publication->log_meta_data;
+    aeron_subscribable_t *subscribable = &publication->conductor_fields.subscribable;
+    const int32_t change_number = log_meta_data->subscriber_positions_change_number;
+    const int32_t count = subscribable->length <= AERON_LOGBUFFER_MAX_SUBSCRIBER_POSITIONS ?
+        (int32_t)subscribable->length : 0;
+
+    AERON_PUT_ORDERED(log_meta_data->subscriber_positions_change_number, change_number + 1);
+    aeron_release();
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        log_meta_data->subscriber_position_ids[i] = (int32_t)subscribable->array[i].counter_id;
+    }
+    log_meta_data->subscriber_position_count = count;
+
+    AERON_PUT_ORDERED(log_meta_data->subscriber_positions_change_number, change_number + 2);
+    publication->conductor_fields.subscriber_positions_changed = false;
+}
+
+static int64_t aeron_ipc_publication_max_sub_pos(aeron_ipc_publication_t *publication)
 {
-    int work_count = 0;
-    int64_t min_sub_pos = INT64_MAX;
     int64_t max_sub_pos = publication->conductor_fields.consumer_position;
 
     for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
     {
         int64_t position = aeron_counter_get_volatile(publication->conductor_fields.subscribable.array[i].value_addr);
 
-        min_sub_pos = (position < min_sub_pos) ? (position) : (min_sub_pos);
         max_sub_pos = (position > max_sub_pos) ? (position) : (max_sub_pos);
     }
 
-    if (0 == publication->conductor_fields.subscribable.length)
+    return max_sub_pos;
+}
+
+int aeron_ipc_publication_update_pub_lmt(aeron_ipc_publication_t *publication)
+{
+    int work_count = 0;
+    aeron_subscribable_t *subscribable = &publication->conductor_fields.subscribable;
+    int64_t min_sub_pos = INT64_MAX;
+    int64_t max_sub_pos = publication->conductor_fields.consumer_position;
+    const bool is_client_publisher_limit = publication->log_meta_data->publisher_window_length > 0;
+
+    if (is_client_publisher_limit && publication->conductor_fields.subscriber_positions_changed)
+    {
+        aeron_ipc_publication_publish_subscriber_positions(publication);
+    }
+
+    /*
+     * Scanning every subscriber each duty cycle is what costs with many of them, so skip it while the slowest has not
+     * moved or could not have moved far enough to raise the limit. The consumer position is then brought up to date
+     * on the time event instead.
+     */
+    const bool is_min_settled = aeron_driver_subscribable_is_min_position_settled(
+        subscribable, publication->conductor_fields.trip_limit - publication->term_window_length);
+
+    if (is_min_settled)
     {
+        min_sub_pos = subscribable->min_position;
+    }
+    else
+    {
+        int64_t *min_sub_pos_addr = NULL;
+
+        for (size_t i = 0, length = subscribable->length; i < length; i++)
+        {
+            int64_t *value_addr = subscribable->array[i].value_addr;
+            int64_t position = aeron_counter_get_volatile(value_addr);
+
+            if (position < min_sub_pos)
+            {
+                min_sub_pos = position;
+                min_sub_pos_addr = value_addr;
+            }
+            max_sub_pos = (position > max_sub_pos) ? (position) : (max_sub_pos);
+        }
+
+        aeron_driver_subscribable_track_min_position(subscribable, min_sub_pos_addr, min_sub_pos);
+    }
+
+    /* neither the publisher nor cleaning may get more than a window ahead of what has been synced to storage */
+    if (NULL != publication->durable_log)
+    {
+        const int64_t durable_position = aeron_durable_log_position(publication->durable_log);
+
+        if (durable_position > *publication->pub_dur_position.value_addr)
+        {
+            aeron_counter_set_ordered(publication->pub_dur_position.value_addr, durable_position);
+            aeron_counter_signal_waiters(publication->pub_dur_position.value_addr);
+            work_count = 1;
+        }
+
+        min_sub_pos = durable_position < min_sub_pos ? durable_position : min_sub_pos;
+    }
+
+    if (0 == subscribable->length)
+    {
+        const bool advanced = max_sub_pos > *publication->pub_lmt_position.value_addr;
+
         aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, max_sub_pos);
+        if (advanced)
+        {
+            aeron_counter_signal_waiters(publication->pub_lmt_position.value_addr);
+        }
         publication->conductor_fields.trip_limit = max_sub_pos;
     }
     else
     {
+        work_count += aeron_ipc_publication_clean_buffer(publication, min_sub_pos);
+
+        /* cleaning is done in chunks so keep the limit out of the partition that is still being cleaned */
+        const int64_t clean_limit =
+            publication->conductor_fields.cleaning_position +
+            ((AERON_LOGBUFFER_PARTITION_COUNT - 1) * (int64_t)publication->mapped_raw_log.term_length);
+        if (is_client_publisher_limit)
+        {
+            AERON_PUT_ORDERED(publication->log_meta_data->clean_limit, clean_limit);
+        }
+
         int64_t proposed_limit = min_sub_pos + publication->term_window_length;
+        proposed_limit = proposed_limit < clean_limit ? proposed_limit : clean_limit;
+
         if (proposed_limit > publication->conductor_fields.trip_limit)
         {
             aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, proposed_limit);
+            aeron_counter_signal_waiters(publication->pub_lmt_position.value_addr);
             publication->conductor_fields.trip_limit = proposed_limit + publication->trip_gain;
-
-            aeron_ipc_publication_clean_buffer(publication, min_sub_pos);
             work_count = 1;
         }
 
@@ -200,7 +389,7 @@ int aeron_ipc_publication_update_pub_lmt(aeron_ipc_publication_t *publication)
     return work_count;
 }
 
-void aeron_ipc_publication_clean_buffer(aeron_ipc_publication_t *publication, int64_t min_sub_pos)
+int aeron_ipc_publication_clean_buffer(aeron_ipc_publication_t *publication, int64_t min_sub_pos)
 {
     int64_t cleaning_position = publication->conductor_fields.cleaning_position;
     size_t dirty_index = aeron_logbuffer_index_by_position(cleaning_position, publication->position_bits_to_shift);
@@ -210,15 +399,34 @@ void aeron_ipc_publication_clean_buffer(aeron_ipc_publication_t *publication, in
     int32_t bytes_left_in_term = term_length - term_offset;
     int32_t length = bytes_to_clean < bytes_left_in_term ? bytes_to_clean : bytes_left_in_term;
 
+    if (publication->term_clean_chunk_length > 0 && length > publication->term_clean_chunk_length)
+    {
+        length = (int32_t)publication->term_clean_chunk_length;
+    }
+
     if (0 < length)
     {
-        memset(publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset, 0, length);
+        const size_t released_length = aeron_mapped_buffer_clean(
+            publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset,
+            (size_t)length,
+            publication->file_page_size,
+            publication->release_cleaned_pages);
+        if (released_length > 0)
+        {
+            aeron_counter_add_ordered(publication->log_buffer_released_bytes_counter, (int64_t)released_length);
+        }
         publication->conductor_fields.cleaning_position = cleaning_position + length;
+
+        return 1;
     }
+
+    return 0;
 }
 
 void aeron_ipc_publication_on_time_event(aeron_ipc_publication_t *publication, int64_t now_ns, int64_t now_ms)
 {
+    publication->conductor_fields.consumer_position = aeron_ipc_publication_max_sub_pos(publication);
+
     switch (publication->conductor_fields.status)
     {
         case AERON_IPC_PUBLICATION_STATUS_ACTIVE:
@@ -259,7 +467,15 @@ void aeron_ipc_publication_check_for_blocked_publisher(aeron_ipc_publication_t *
     if (consumer_position == publication->conductor_fields.last_consumer_position &&
         aeron_ipc_publication_is_possibly_blocked(publication, consumer_position))
     {
-        if (now_ns > (publication->conductor_fields.time_of_last_consumer_position_change + publication->unblock_timeout_ns))
+        const int64_t unblock_timeout_ns = aeron_driver_unblock_timeout_ns(
+            now_ns,
+            publication->unblock_timeout_ns,
+            publication->unblock_timeout_min_ns,
+            publication->conductor_fields.longest_stall_ns,
+            publication->conductor_fields.fast_unblock_deadline_ns);
+
+        publication->conductor_fields.is_stalled = true;
+        if (now_ns > (publication->conductor_fields.time_of_last_consumer_position_change + unblock_timeout_ns))
         {
             if (aeron_logbuffer_unblocker_unblock(
                 publication->mapped_raw_log.term_buffers,
@@ -267,16 +483,37 @@ void aeron_ipc_publication_check_for_blocked_publisher(aeron_ipc_publication_t *
                 publication->conductor_fields.consumer_position))
             {
                 aeron_counter_ordered_increment(publication->unblocked_publications_counter, 1);
+                publication->conductor_fields.is_stalled = false;
             }
         }
     }
     else
     {
+        if (publication->conductor_fields.is_stalled)
+        {
+            const int64_t stall_ns = now_ns - publication->conductor_fields.time_of_last_consumer_position_change;
+
+            publication->conductor_fields.longest_stall_ns = stall_ns > publication->conductor_fields.longest_stall_ns ?
+                stall_ns : publication->conductor_fields.longest_stall_ns;
+            publication->conductor_fields.is_stalled = false;
+        }
+
         publication->conductor_fields.time_of_last_consumer_position_change = now_ns;
         publication->conductor_fields.last_consumer_position = publication->conductor_fields.consumer_position;
     }
 }
 
+void aeron_ipc_publication_on_client_timeout(aeron_ipc_publication_t *publication, int64_t now_ns)
+{
+    publication->conductor_fields.fast_unblock_deadline_ns = now_ns + publication->unblock_timeout_ns;
+
+    if (AERON_IPC_PUBLICATION_STATUS_ACTIVE == publication->conductor_fields.status && !publication->is_exclusive)
+    {
+        publication->conductor_fields.consumer_position = aeron_ipc_publication_max_sub_pos(publication);
+        aeron_ipc_publication_check_for_blocked_publisher(publication, now_ns);
+    }
+}
+
 extern void aeron_ipc_publication_add_subscriber_hook(void *clientd, int64_t *value_addr);
 extern void aeron_ipc_publication_remove_subscriber_hook(void *clientd, int64_t *value_addr);
 extern bool aeron_ipc_publication_is_possibly_blocked(
@@ -23,6 +23,8 @@
 #include "util/aeron_fileutil.h"
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_system_counters.h"
+#include "uri/aeron_uri.h"
+#include "aeron_durable_log_syncer.h"
 
 typedef enum aeron_ipc_publication_status_enum
 {
@@ -43,8 +45,17 @@ typedef struct aeron_ipc_publication_stct
         int64_t consumer_position;
         int64_t last_consumer_position;
         int64_t time_of_last_consumer_position_change;
+        /* longest the publication looked blocked before it moved on without an unblock */
+        int64_t longest_stall_ns;
+        int64_t fast_unblock_deadline_ns;
+        /* producer position when the stream rate was last sampled, -1 until the first sample */
+        int64_t rate_sample_position;
+        /* producer position when the publication was last flagged in the stream activity ring */
+        int64_t activity_position;
         int32_t refcnt;
         bool has_reached_end_of_life;
+        bool subscriber_positions_changed;
+        bool is_stalled;
         aeron_ipc_publication_status_t status;
     }
     conductor_fields;
@@ -53,23 +64,31 @@ typedef struct aeron_ipc_publication_stct
 
     aeron_mapped_raw_log_t mapped_raw_log;
     aeron_position_t pub_lmt_position;
+    /* counter_id is -1 unless the log is durable */
+    aeron_position_t pub_dur_position;
+    aeron_durable_log_t *durable_log;
     aeron_logbuffer_metadata_t *log_meta_data;
     aeron_clock_func_t nano_clock;
 
     char *log_file_name;
     int64_t term_window_length;
+    int64_t term_clean_chunk_length;
     int64_t trip_gain;
     int64_t linger_timeout_ns;
     int64_t unblock_timeout_ns;
+    int64_t unblock_timeout_min_ns;
     int32_t session_id;
     int32_t stream_id;
     int32_t initial_term_id;
     size_t log_file_name_length;
     size_t position_bits_to_shift;
+    size_t file_page_size;
     bool is_exclusive;
+    bool release_cleaned_pages;
     aeron_map_raw_log_close_func_t map_raw_log_close_func;
 
     int64_t *unblocked_publications_counter;
+    int64_t *log_buffer_released_bytes_counter;
 }
 aeron_ipc_publication_t;
 
@@ -80,9 +99,9 @@ int aeron_ipc_publication_create(
     int32_t stream_id,
     int64_t registration_id,
     aeron_position_t *pub_lmt_position,
+    aeron_position_t *pub_dur_position,
     int32_t initial_term_id,
-    size_t term_buffer_length,
-    size_t mtu_length,
+    aeron_uri_publication_params_t *params,
     bool is_exclusive,
     aeron_system_counters_t *system_counters);
 
@@ -90,7 +109,7 @@ void aeron_ipc_publication_close(aeron_counters_manager_t *counters_manager, aer
 
 int aeron_ipc_publication_update_pub_lmt(aeron_ipc_publication_t *publication);
 
-void aeron_ipc_publication_clean_buffer(aeron_ipc_publication_t *publication, int64_t min_sub_pos);
+int aeron_ipc_publication_clean_buffer(aeron_ipc_publication_t *publication, int64_t min_sub_pos);
 
 void aeron_ipc_publication_on_time_event(aeron_ipc_publication_t *publication, int64_t now_ns, int64_t now_ms);
 
@@ -99,10 +118,17 @@ void aeron_ipc_publication_decref(void *clientd);
 
 void aeron_ipc_publication_check_for_blocked_publisher(aeron_ipc_publication_t *publication, int64_t now_ns);
 
+/*
+ * A client that had the publication timed out, so it may have died mid claim. Unblock the log now if it is held up and
+ * has been since the last check, otherwise as soon as it is seen held up until the unblock timeout has passed.
+ */
+void aeron_ipc_publication_on_client_timeout(aeron_ipc_publication_t *publication, int64_t now_ns);
+
 inline void aeron_ipc_publication_add_subscriber_hook(void *clientd, int64_t *value_addr)
 {
     aeron_ipc_publication_t *publication = (aeron_ipc_publication_t *)clientd;
 
+    publication->conductor_fields.subscriber_positions_changed = true;
     AERON_PUT_ORDERED(publication->log_meta_data->is_connected, 1);
 }
 
@@ -114,6 +140,7 @@ inline void aeron_ipc_publication_remove_subscriber_hook(void *clientd, int64_t
     publication->conductor_fields.consumer_position =
         position > publication->conductor_fields.consumer_position ?
             position : publication->conductor_fields.consumer_position;
+    publication->conductor_fields.subscriber_positions_changed = true;
 
     if (1 == publication->conductor_fields.subscribable.length)
     {
@@ -163,7 +190,17 @@ inline int64_t aeron_ipc_publication_producer_position(aeron_ipc_publication_t *
 
 inline int64_t aeron_ipc_publication_joining_position(aeron_ipc_publication_t *publication)
 {
-    return publication->conductor_fields.consumer_position;
+    /* the consumer position can lag between time events so take the most advanced subscriber now */
+    int64_t joining_position = publication->conductor_fields.consumer_position;
+
+    for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
+    {
+        int64_t sub_pos = aeron_counter_get_volatile(publication->conductor_fields.subscribable.array[i].value_addr);
+
+        joining_position = sub_pos > joining_position ? sub_pos : joining_position;
+    }
+
+    return joining_position;
 }
 
 inline bool aeron_ipc_publication_has_reached_end_of_life(aeron_ipc_publication_t *publication)
@@ -33,14 +33,69 @@ int aeron_loss_detector_init(
     detector->delay_generator = delay_generator;
     detector->on_gap_detected = on_gap_detected;
     detector->on_gap_detected_clientd = on_gap_detected_clientd;
-    detector->expiry = AERON_LOSS_DETECTOR_TIMER_INACTIVE;
-    detector->active_gap.term_offset = -1;
+    detector->active_gaps_length = 0;
     detector->scanned_gap.term_offset = -1;
+    detector->reorder_window_ns = 0;
+    detector->reorder_window_max_ns = 0;
+    detector->fixed_delay_ns = -1;
     detector->should_feedback_immediately = should_immediate_feedback;
 
     return 0;
 }
 
+void aeron_loss_detector_reorder_window(aeron_loss_detector_t *detector, int64_t reorder_window_max_ns)
+{
+    detector->reorder_window_ns = reorder_window_max_ns;
+    detector->reorder_window_max_ns = reorder_window_max_ns;
+}
+
+void aeron_loss_detector_fixed_delay(aeron_loss_detector_t *detector, int64_t fixed_delay_ns)
+{
+    detector->fixed_delay_ns = fixed_delay_ns;
+    detector->should_feedback_immediately = false;
+}
+
+void aeron_loss_detector_on_peer_nak(
+    aeron_loss_detector_t *detector, int32_t term_id, int32_t term_offset, size_t length, int64_t now_ns)
+{
+    const int64_t nak_end = (int64_t)term_offset + (int64_t)length;
+
+    for (size_t i = 0; i < detector->active_gaps_length; i++)
+    {
+        aeron_loss_detector_active_gap_t *active_gap = &detector->active_gaps[i];
+
+        if (term_id == active_gap->gap.term_id && term_offset <= active_gap->gap.term_offset &&
+            (int64_t)active_gap->gap.term_offset + (int64_t)active_gap->gap.length <= nak_end)
+        {
+            active_gap->expiry = now_ns + aeron_loss_detector_delay(detector);
+            active_gap->is_nak_sent = true;
+        }
+    }
+}
+
+/*
+ * A gap filled before it was NAKed was reordered rather than lost. The window moves straight up to twice the age of
+ * the gap, leaving margin for the next reordering to be a little deeper, and decays slowly towards it otherwise.
+ */
+static void aeron_loss_detector_on_reordered_gap(aeron_loss_detector_t *detector, int64_t age_ns)
+{
+    int64_t sample_ns = 2 * age_ns;
+
+    if (sample_ns > detector->reorder_window_max_ns)
+    {
+        sample_ns = detector->reorder_window_max_ns;
+    }
+
+    if (sample_ns > detector->reorder_window_ns)
+    {
+        detector->reorder_window_ns = sample_ns;
+    }
+    else
+    {
+        detector->reorder_window_ns -= (detector->reorder_window_ns - sample_ns) >> 3;
+    }
+}
+
 int32_t aeron_loss_detector_scan(
     aeron_loss_detector_t *detector,
     bool *loss_found,
@@ -54,6 +109,8 @@ int32_t aeron_loss_detector_scan(
 {
     *loss_found = false;
     int32_t rebuild_offset = (int32_t)(rebuild_position & term_length_mask);
+    aeron_loss_detector_active_gap_t active_gaps[AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS];
+    size_t active_gaps_length = 0;
 
     if (rebuild_position < hwm_position)
     {
@@ -72,18 +129,92 @@ int32_t aeron_loss_detector_scan(
                 limit_offset,
                 aeron_loss_detector_on_gap,
                 detector);
-        if (rebuild_offset < limit_offset)
+
+        int32_t offset = rebuild_offset;
+        while (offset < limit_offset && active_gaps_length < AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS)
         {
-            if (!aeron_loss_detector_gaps_match(detector))
+            aeron_loss_detector_active_gap_t *active_gap = &active_gaps[active_gaps_length++];
+
+            active_gap->gap = detector->scanned_gap;
+            active_gap->expiry = AERON_LOSS_DETECTOR_TIMER_INACTIVE;
+
+            for (size_t i = 0; i < detector->active_gaps_length; i++)
+            {
+                if (aeron_loss_detector_gaps_match(&detector->active_gaps[i].gap, &active_gap->gap))
+                {
+                    active_gap->expiry = detector->active_gaps[i].expiry;
+                    active_gap->first_seen_ns = detector->active_gaps[i].first_seen_ns;
+                    active_gap->is_nak_sent = detector->active_gaps[i].is_nak_sent;
+                    break;
+                }
+            }
+
+            if (AERON_LOSS_DETECTOR_TIMER_INACTIVE == active_gap->expiry)
             {
-                aeron_loss_detector_activate_gap(detector, now_ns);
+                active_gap->expiry =
+                    detector->should_feedback_immediately ? now_ns : now_ns + aeron_loss_detector_delay(detector);
+                active_gap->first_seen_ns = now_ns;
+                active_gap->is_nak_sent = false;
                 *loss_found = true;
             }
 
-            aeron_loss_detector_check_timer_expiry(detector, now_ns);
+            offset = active_gap->gap.term_offset + (int32_t)active_gap->gap.length;
+            if (offset < limit_offset)
+            {
+                offset = aeron_term_gap_scanner_scan_for_gap(
+                    buffer, rebuild_term_id, offset, limit_offset, aeron_loss_detector_on_gap, detector);
+            }
         }
     }
 
+    /*
+     * gaps no longer found were filled, before any NAK if they were reordered. Those beyond the last gap of a scan
+     * that stopped at the limit of active gaps were not looked for.
+     */
+    if (detector->reorder_window_max_ns > 0)
+    {
+        const bool is_scan_truncated = AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS == active_gaps_length;
+
+        for (size_t i = 0; i < detector->active_gaps_length; i++)
+        {
+            aeron_loss_detector_active_gap_t *old_gap = &detector->active_gaps[i];
+            bool is_filled = !old_gap->is_nak_sent;
+
+            for (size_t j = 0; is_filled && j < active_gaps_length; j++)
+            {
+                is_filled = !aeron_loss_detector_gaps_match(&old_gap->gap, &active_gaps[j].gap);
+            }
+
+            if (is_filled && is_scan_truncated &&
+                old_gap->gap.term_id == active_gaps[active_gaps_length - 1].gap.term_id &&
+                old_gap->gap.term_offset > active_gaps[active_gaps_length - 1].gap.term_offset)
+            {
+                is_filled = false;
+            }
+
+            if (is_filled)
+            {
+                aeron_loss_detector_on_reordered_gap(detector, now_ns - old_gap->first_seen_ns);
+            }
+        }
+    }
+
+    /* gaps no longer found have been filled so their timers are dropped, and new gaps are held for the window */
+    for (size_t i = 0; i < active_gaps_length; i++)
+    {
+        const int64_t reorder_expiry = now_ns + detector->reorder_window_ns;
+
+        if (active_gaps[i].first_seen_ns == now_ns && active_gaps[i].expiry < reorder_expiry)
+        {
+            active_gaps[i].expiry = reorder_expiry;
+        }
+
+        detector->active_gaps[i] = active_gaps[i];
+        aeron_loss_detector_check_timer_expiry(detector, &detector->active_gaps[i], now_ns);
+    }
+
+    detector->active_gaps_length = active_gaps_length;
+
     return rebuild_offset;
 }
 
@@ -114,6 +245,7 @@ int64_t aeron_loss_detector_nak_multicast_delay_generator()
 
 extern int64_t aeron_loss_detector_nak_unicast_delay_generator();
 extern void aeron_loss_detector_on_gap(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
-extern bool aeron_loss_detector_gaps_match(aeron_loss_detector_t *detector);
-extern void aeron_loss_detector_activate_gap(aeron_loss_detector_t *detector, int64_t now_ns);
-extern void aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detector, int64_t now_ns);
+extern bool aeron_loss_detector_gaps_match(aeron_loss_detector_gap_t *lhs, aeron_loss_detector_gap_t *rhs);
+extern int64_t aeron_loss_detector_delay(aeron_loss_detector_t *detector);
+extern void aeron_loss_detector_check_timer_expiry(
+    aeron_loss_detector_t *detector, aeron_loss_detector_active_gap_t *active_gap, int64_t now_ns);
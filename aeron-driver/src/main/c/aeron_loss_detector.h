@@ -32,16 +32,31 @@ typedef struct aeron_loss_detector_gap_stct
 }
 aeron_loss_detector_gap_t;
 
+typedef struct aeron_loss_detector_active_gap_stct
+{
+    aeron_loss_detector_gap_t gap;
+    int64_t expiry;
+    int64_t first_seen_ns;
+    bool is_nak_sent;
+}
+aeron_loss_detector_active_gap_t;
+
 #define AERON_LOSS_DETECTOR_TIMER_INACTIVE (-1)
 
+/* matches the sender's pool of concurrent retransmit actions so a full batch of NAKs can be acted on */
+#define AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS (16)
+
 typedef struct aeron_loss_detector_stct
 {
     aeron_feedback_delay_generator_func_t delay_generator;
     aeron_term_gap_scanner_on_gap_detected_func_t on_gap_detected;
     void *on_gap_detected_clientd;
     aeron_loss_detector_gap_t scanned_gap;
-    aeron_loss_detector_gap_t active_gap;
-    int64_t expiry;
+    aeron_loss_detector_active_gap_t active_gaps[AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS];
+    size_t active_gaps_length;
+    int64_t reorder_window_ns;
+    int64_t reorder_window_max_ns;
+    int64_t fixed_delay_ns;
     bool should_feedback_immediately;
 }
 aeron_loss_detector_t;
@@ -53,6 +68,32 @@ int aeron_loss_detector_init(
     aeron_term_gap_scanner_on_gap_detected_func_t on_gap_detected,
     void *on_gap_detected_clientd);
 
+/*
+ * Hold the first NAK for each gap until it has outlived a reorder window learned from gaps that were filled before
+ * they were NAKed, so packets that arrive out of order over multiple paths are not retransmitted. The window starts
+ * at, and never exceeds, reorder_window_max_ns. 0 disables it.
+ */
+void aeron_loss_detector_reorder_window(aeron_loss_detector_t *detector, int64_t reorder_window_max_ns);
+
+/*
+ * Report each gap once it is fixed_delay_ns old, and again each fixed_delay_ns it remains, in place of the delay
+ * generator. Used when gaps are filled rather than NAKed, as there is no feedback to spread over receivers.
+ */
+void aeron_loss_detector_fixed_delay(aeron_loss_detector_t *detector, int64_t fixed_delay_ns);
+
+/*
+ * Another receiver has NAKed the range, so the retransmit it brings will fill any active gap inside the range too.
+ * Such gaps are treated as if NAKed by this receiver, deferring their NAK by the feedback delay in case the
+ * retransmit is lost as well, which suppresses duplicate NAKs from a group of receivers that lost the same data.
+ */
+void aeron_loss_detector_on_peer_nak(
+    aeron_loss_detector_t *detector, int32_t term_id, int32_t term_offset, size_t length, int64_t now_ns);
+
+/*
+ * Scan from the rebuild position for up to AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS gaps in the term. Each gap has its
+ * own feedback timer, so gaps found together are all reported once their delay expires rather than one per round
+ * of NAK and retransmit. Returns the offset of the first gap, or the limit when there is none.
+ */
 int32_t aeron_loss_detector_scan(
     aeron_loss_detector_t *detector,
     bool *loss_found,
@@ -86,38 +127,28 @@ inline void aeron_loss_detector_on_gap(void *clientd, int32_t term_id, int32_t t
     detector->scanned_gap.length = length;
 }
 
-inline bool aeron_loss_detector_gaps_match(aeron_loss_detector_t *detector)
+inline bool aeron_loss_detector_gaps_match(aeron_loss_detector_gap_t *lhs, aeron_loss_detector_gap_t *rhs)
 {
-    return detector->active_gap.term_id == detector->scanned_gap.term_id &&
-        detector->active_gap.term_offset == detector->scanned_gap.term_offset;
+    return lhs->term_id == rhs->term_id && lhs->term_offset == rhs->term_offset;
 }
 
-inline void aeron_loss_detector_activate_gap(aeron_loss_detector_t *detector, int64_t now_ns)
+inline int64_t aeron_loss_detector_delay(aeron_loss_detector_t *detector)
 {
-    detector->active_gap.term_id = detector->scanned_gap.term_id;
-    detector->active_gap.term_offset = detector->scanned_gap.term_offset;
-    detector->active_gap.length = detector->scanned_gap.length;
-
-    if (detector->should_feedback_immediately)
-    {
-        detector->expiry = now_ns;
-    }
-    else
-    {
-        detector->expiry = now_ns + detector->delay_generator();
-    }
+    return detector->fixed_delay_ns >= 0 ? detector->fixed_delay_ns : detector->delay_generator();
 }
 
-inline void aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detector, int64_t now_ns)
+inline void aeron_loss_detector_check_timer_expiry(
+    aeron_loss_detector_t *detector, aeron_loss_detector_active_gap_t *active_gap, int64_t now_ns)
 {
-    if (now_ns >= detector->expiry)
+    if (now_ns >= active_gap->expiry)
     {
         detector->on_gap_detected(
             detector->on_gap_detected_clientd,
-            detector->active_gap.term_id,
-            detector->active_gap.term_offset,
-            detector->active_gap.length);
-        detector->expiry = now_ns + detector->delay_generator();
+            active_gap->gap.term_id,
+            active_gap->gap.term_offset,
+            active_gap->gap.length);
+        active_gap->expiry = now_ns + aeron_loss_detector_delay(detector);
+        active_gap->is_nak_sent = true;
     }
 }
 
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include "util/aeron_error.h"
+#include "aeron_alloc.h"
+#include "aeron_name_resolver.h"
+
+int aeron_name_resolver_init(aeron_name_resolver_t *resolver)
+{
+    resolver->unsent_response = NULL;
+    resolver->in_flight = 0;
+
+    if (aeron_spsc_concurrent_array_queue_init(&resolver->requests, AERON_NAME_RESOLVER_MAX_IN_FLIGHT) < 0 ||
+        aeron_spsc_concurrent_array_queue_init(&resolver->responses, AERON_NAME_RESOLVER_MAX_IN_FLIGHT) < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+static void aeron_name_resolver_request_delete(aeron_name_resolver_request_t *request)
+{
+    aeron_udp_channel_delete(request->channel);
+    aeron_free(request);
+}
+
+static void aeron_name_resolver_take_request_func(void *clientd, volatile void *item)
+{
+    *(aeron_name_resolver_request_t **)clientd = (aeron_name_resolver_request_t *)item;
+}
+
+int aeron_name_resolver_do_work(void *clientd)
+{
+    aeron_name_resolver_t *resolver = (aeron_name_resolver_t *)clientd;
+    aeron_name_resolver_request_t *request = resolver->unsent_response;
+
+    /* one channel per duty cycle keeps the agent responsive to close while lookups block */
+    if (NULL == request &&
+        0 == aeron_spsc_concurrent_array_queue_drain(
+            &resolver->requests, aeron_name_resolver_take_request_func, &request, 1))
+    {
+        return 0;
+    }
+
+    if (NULL == resolver->unsent_response &&
+        aeron_udp_channel_parse(request->uri, request->uri_length, &request->channel) < 0)
+    {
+        request->channel = NULL;
+        request->errcode = aeron_errcode();
+        strncpy(request->errmsg, aeron_errmsg(), sizeof(request->errmsg) - 1);
+    }
+
+    /* the conductor keeps no more in flight than the queue holds, so this only fails if it is misused */
+    resolver->unsent_response =
+        AERON_OFFER_SUCCESS == aeron_spsc_concurrent_array_queue_offer(&resolver->responses, request) ? NULL : request;
+
+    return 1;
+}
+
+static void aeron_name_resolver_delete_request_func(void *clientd, volatile void *item)
+{
+    aeron_name_resolver_request_delete((aeron_name_resolver_request_t *)item);
+}
+
+void aeron_name_resolver_on_close(void *clientd)
+{
+    aeron_name_resolver_t *resolver = (aeron_name_resolver_t *)clientd;
+
+    if (NULL != resolver->unsent_response)
+    {
+        aeron_name_resolver_request_delete(resolver->unsent_response);
+        resolver->unsent_response = NULL;
+    }
+
+    aeron_spsc_concurrent_array_queue_drain_all(&resolver->requests, aeron_name_resolver_delete_request_func, NULL);
+    aeron_spsc_concurrent_array_queue_drain_all(&resolver->responses, aeron_name_resolver_delete_request_func, NULL);
+    aeron_spsc_concurrent_array_queue_close(&resolver->requests);
+    aeron_spsc_concurrent_array_queue_close(&resolver->responses);
+}
+
+int aeron_name_resolver_resolve(aeron_name_resolver_t *resolver, const char *uri, size_t uri_length)
+{
+    aeron_name_resolver_request_t *request = NULL;
+
+    if (resolver->in_flight >= AERON_NAME_RESOLVER_MAX_IN_FLIGHT || uri_length >= sizeof(request->uri))
+    {
+        aeron_set_err(EAGAIN, "%s", "name resolver is full");
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&request, sizeof(aeron_name_resolver_request_t)) < 0)
+    {
+        return -1;
+    }
+
+    request->channel = NULL;
+    request->errcode = 0;
+    request->uri_length = uri_length;
+    memcpy(request->uri, uri, uri_length);
+    request->uri[uri_length] = '\0';
+
+    if (AERON_OFFER_SUCCESS != aeron_spsc_concurrent_array_queue_offer(&resolver->requests, request))
+    {
+        aeron_free(request);
+        aeron_set_err(EAGAIN, "%s", "name resolver is full");
+        return -1;
+    }
+
+    resolver->in_flight++;
+
+    return 0;
+}
+
+typedef struct aeron_name_resolver_poll_stct
+{
+    aeron_name_resolver_t *resolver;
+    aeron_name_resolver_on_resolved_func_t on_resolved;
+    void *clientd;
+}
+aeron_name_resolver_poll_t;
+
+static void aeron_name_resolver_on_response_func(void *clientd, volatile void *item)
+{
+    aeron_name_resolver_poll_t *poll = (aeron_name_resolver_poll_t *)clientd;
+    aeron_name_resolver_request_t *request = (aeron_name_resolver_request_t *)item;
+
+    poll->resolver->in_flight--;
+    poll->on_resolved(poll->clientd, request);
+    aeron_free(request);
+}
+
+int aeron_name_resolver_poll(
+    aeron_name_resolver_t *resolver, aeron_name_resolver_on_resolved_func_t on_resolved, void *clientd, size_t limit)
+{
+    aeron_name_resolver_poll_t poll = { resolver, on_resolved, clientd };
+
+    return (int)aeron_spsc_concurrent_array_queue_drain(
+        &resolver->responses, aeron_name_resolver_on_response_func, &poll, limit);
+}
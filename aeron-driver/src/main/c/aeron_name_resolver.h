@@ -0,0 +1,72 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_NAME_RESOLVER_H
+#define AERON_AERON_NAME_RESOLVER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "aeron_driver_common.h"
+#include "media/aeron_udp_channel.h"
+#include "concurrent/aeron_spsc_concurrent_array_queue.h"
+
+#define AERON_NAME_RESOLVER_MAX_IN_FLIGHT (64)
+
+typedef struct aeron_name_resolver_request_stct
+{
+    aeron_udp_channel_t *channel;
+    int errcode;
+    char errmsg[AERON_MAX_PATH];
+    size_t uri_length;
+    char uri[AERON_MAX_PATH];
+}
+aeron_name_resolver_request_t;
+
+/*
+ * Parses UDP channels on a background agent so the conductor is not held up by DNS lookups and interface searches
+ * while it has commands from other clients to serve. The conductor hands a URI over and carries on; the channel, or
+ * the error parsing it gave, comes back for the conductor to cache before it completes the commands waiting on it.
+ */
+typedef struct aeron_name_resolver_stct
+{
+    aeron_spsc_concurrent_array_queue_t requests;
+    aeron_spsc_concurrent_array_queue_t responses;
+    aeron_name_resolver_request_t *unsent_response;
+    size_t in_flight;
+}
+aeron_name_resolver_t;
+
+typedef void (*aeron_name_resolver_on_resolved_func_t)(void *clientd, aeron_name_resolver_request_t *request);
+
+int aeron_name_resolver_init(aeron_name_resolver_t *resolver);
+
+int aeron_name_resolver_do_work(void *clientd);
+void aeron_name_resolver_on_close(void *clientd);
+
+/*
+ * Hand a channel over to be parsed by the resolver agent. Called by the conductor, returns -1 when
+ * AERON_NAME_RESOLVER_MAX_IN_FLIGHT channels are already being resolved.
+ */
+int aeron_name_resolver_resolve(aeron_name_resolver_t *resolver, const char *uri, size_t uri_length);
+
+/*
+ * Called by the conductor to take the resolved channels. The handler owns the channel of each request, if any, and the
+ * request is freed after it returns.
+ */
+int aeron_name_resolver_poll(
+    aeron_name_resolver_t *resolver, aeron_name_resolver_on_resolved_func_t on_resolved, void *clientd, size_t limit);
+
+#endif //AERON_AERON_NAME_RESOLVER_H
@@ -22,14 +22,21 @@
 #include <errno.h>
 #include <string.h>
 #include <sys/socket.h>
+#if defined(__linux__)
+#include <netinet/udp.h>
+#endif
 #include "concurrent/aeron_term_scanner.h"
 #include "util/aeron_netutil.h"
 #include "util/aeron_error.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_probes.h"
 #include "aeron_network_publication.h"
 #include "aeron_alloc.h"
 #include "media/aeron_send_channel_endpoint.h"
 #include "aeron_driver_conductor.h"
+#include "aeron_raw_log_pool.h"
 #include "concurrent/aeron_logbuffer_unblocker.h"
+#include "aeron_frame_checksum.h"
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
@@ -53,6 +60,7 @@ int aeron_network_publication_create(
     aeron_position_t *snd_lmt_position,
     aeron_flow_control_strategy_t *flow_control_strategy,
     size_t term_buffer_length,
+    size_t fec_group_size,
     bool is_exclusive,
     bool spies_simulate_connection,
     aeron_system_counters_t *system_counters)
@@ -80,36 +88,78 @@ int aeron_network_publication_create(
         return -1;
     }
 
-    if (aeron_alloc((void **)&_pub, sizeof(aeron_network_publication_t)) < 0)
+    const bool fec_enabled = fec_group_size > 0;
+    const size_t fec_frame_length = fec_enabled ? AERON_FEC_FRAME_MAX_LENGTH(mtu_length) : 0;
+    /* FEC parity covers datagrams of at most the MTU so datagrams are not coalesced beyond it */
+    const bool pmtu_discovery_enabled =
+        endpoint->pmtu_discovery && !fec_enabled && context->pmtu_discovery_max_length > mtu_length;
+    const size_t pmtu_probe_length = pmtu_discovery_enabled ? context->pmtu_discovery_max_length : 0;
+    aeron_arena_t arena;
+
+    /* the sender reads the struct, name, FEC frame and probe together so they share one cache aligned allocation */
+    if (aeron_arena_init(
+        &arena,
+        aeron_arena_length(sizeof(aeron_network_publication_t)) +
+        aeron_arena_length((size_t)path_length + 1) +
+        aeron_arena_length(fec_frame_length) +
+        aeron_arena_length(pmtu_probe_length)) < 0)
     {
         aeron_set_err(ENOMEM, "%s", "Could not allocate network publication");
         return -1;
     }
 
-    _pub->log_file_name = NULL;
-    if (aeron_alloc((void **)(&_pub->log_file_name), (size_t)path_length + 1) < 0)
-    {
-        aeron_free(_pub);
-        aeron_set_err(ENOMEM, "%s", "Could not allocate network publication log_file_name");
-        return -1;
-    }
+    _pub = aeron_arena_allocate(&arena, sizeof(aeron_network_publication_t));
+    _pub->log_file_name = aeron_arena_allocate(&arena, (size_t)path_length + 1);
+    _pub->fec_enabled = fec_enabled;
+    _pub->fec_frame = fec_enabled ? aeron_arena_allocate(&arena, fec_frame_length) : NULL;
+    _pub->pmtu_discovery_enabled = pmtu_discovery_enabled;
+    _pub->pmtu_probe = pmtu_discovery_enabled ? aeron_arena_allocate(&arena, pmtu_probe_length) : NULL;
+    _pub->sender_fields.fec_encoder.parity = NULL;
+    _pub->arena = arena;
 
     if (aeron_retransmit_handler_init(
-        &_pub->retransmit_handler,
+        &_pub->sender_fields.retransmit_handler,
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS),
         AERON_RETRANSMIT_HANDLER_DEFAULT_LINGER_TIMEOUT_NS) < 0)
     {
-        aeron_free(_pub->log_file_name);
-        aeron_free(_pub);
+        aeron_arena_close(&arena);
         aeron_set_err(aeron_errcode(), "Could not init network publication retransmit handler: %s", aeron_errmsg());
         return -1;
     }
 
-    if (context->map_raw_log_func(
-        &_pub->mapped_raw_log, path, context->term_buffer_sparse_file, term_buffer_length, context->file_page_size) < 0)
+    /* a paced send is never more than one batch */
+    if (context->send_pacing && aeron_send_pacer_init(
+        &_pub->sender_fields.pacer,
+        context->socket_gso ?
+            AERON_NETWORK_PUBLICATION_MAX_GSO_LENGTH : mtu_length * AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND,
+        now_ns) < 0)
+    {
+        aeron_arena_close(&arena);
+        aeron_set_err(aeron_errcode(), "Could not init network publication send pacer: %s", aeron_errmsg());
+        return -1;
+    }
+
+    if (_pub->fec_enabled && aeron_fec_encoder_init(&_pub->sender_fields.fec_encoder, fec_group_size, mtu_length) < 0)
     {
-        aeron_free(_pub->log_file_name);
-        aeron_free(_pub);
+        aeron_fec_encoder_close(&_pub->sender_fields.fec_encoder);
+        aeron_arena_close(&arena);
+        aeron_set_err(aeron_errcode(), "Could not init network publication FEC: %s", aeron_errmsg());
+        return -1;
+    }
+
+    if (aeron_raw_log_pool_map_raw_log(
+        context->raw_log_pool,
+        context->map_raw_log_func,
+        &_pub->mapped_raw_log,
+        path,
+        context->term_buffer_sparse_file,
+        term_buffer_length,
+        context->file_page_size,
+        context->term_buffer_prefault,
+        context->term_buffer_lock) < 0)
+    {
+        aeron_fec_encoder_close(&_pub->sender_fields.fec_encoder);
+        aeron_arena_close(&arena);
         aeron_set_err(aeron_errcode(), "error mapping network raw log %s: %s", path, aeron_errmsg());
         return -1;
     }
@@ -140,6 +190,7 @@ int aeron_network_publication_create(
 
     _pub->endpoint = endpoint;
     _pub->flow_control = flow_control_strategy;
+    _pub->flow_control_trace = NULL != context->flow_control_trace.records ? &context->flow_control_trace : NULL;
     _pub->nano_clock = context->nano_clock;
     _pub->conductor_fields.subscribable.array = NULL;
     _pub->conductor_fields.subscribable.length = 0;
@@ -147,6 +198,11 @@ int aeron_network_publication_create(
     _pub->conductor_fields.subscribable.add_position_hook_func = aeron_network_publication_add_subscriber_hook;
     _pub->conductor_fields.subscribable.remove_position_hook_func = aeron_network_publication_remove_subscriber_hook;
     _pub->conductor_fields.subscribable.clientd = _pub;
+    _pub->conductor_fields.subscribable.min_position_addr = NULL;
+    _pub->conductor_fields.subscribable.min_position = 0;
+    _pub->conductor_fields.non_blocking_spy_positions.array = NULL;
+    _pub->conductor_fields.non_blocking_spy_positions.length = 0;
+    _pub->conductor_fields.non_blocking_spy_positions.capacity = 0;
     _pub->conductor_fields.managed_resource.registration_id = registration_id;
     _pub->conductor_fields.managed_resource.clientd = _pub;
     _pub->conductor_fields.managed_resource.incref = aeron_network_publication_incref;
@@ -157,6 +213,13 @@ int aeron_network_publication_create(
     _pub->conductor_fields.refcnt = 1;
     _pub->conductor_fields.time_of_last_activity_ns = now_ns;
     _pub->conductor_fields.last_snd_pos = 0;
+    _pub->conductor_fields.longest_stall_ns = 0;
+    _pub->conductor_fields.fast_unblock_deadline_ns = 0;
+    _pub->conductor_fields.is_stalled = false;
+    _pub->conductor_fields.max_spy_position = 0;
+    _pub->conductor_fields.limiting_spy_counter_id = -1;
+    _pub->conductor_fields.rate_sample_position = -1;
+    _pub->conductor_fields.activity_position = 0;
     _pub->session_id = session_id;
     _pub->stream_id = stream_id;
     _pub->pub_lmt_position.counter_id = pub_lmt_position->counter_id;
@@ -165,27 +228,47 @@ int aeron_network_publication_create(
     _pub->snd_pos_position.value_addr = snd_pos_position->value_addr;
     _pub->snd_lmt_position.counter_id = snd_lmt_position->counter_id;
     _pub->snd_lmt_position.value_addr = snd_lmt_position->value_addr;
+    aeron_stream_stats_init(&_pub->stats);
     _pub->initial_term_id = initial_term_id;
     _pub->term_length_mask = (int32_t)term_buffer_length - 1;
     _pub->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)term_buffer_length);
     _pub->mtu_length = mtu_length;
+    _pub->sender_fields.datagram_length = mtu_length;
+    aeron_pmtu_discovery_init(&_pub->sender_fields.pmtu_discovery, mtu_length, pmtu_probe_length);
     _pub->term_window_length = (int64_t)aeron_network_publication_term_window_length(context, term_buffer_length);
+    _pub->term_clean_chunk_length = (int64_t)context->term_buffer_clean_chunk_length;
+    _pub->file_page_size = context->file_page_size;
+    _pub->release_cleaned_pages = context->term_buffer_sparse_file || context->term_buffer_release_pages;
     _pub->linger_timeout_ns = (int64_t)context->publication_linger_timeout_ns;
+    _pub->resume_timeout_ns = (int64_t)context->publication_resume_timeout_ns;
+    _pub->resume_token = 0;
+    _pub->is_resumable = false;
     _pub->unblock_timeout_ns = (int64_t)context->publication_unblock_timeout_ns;
+    _pub->unblock_timeout_min_ns = (int64_t)context->publication_unblock_timeout_min_ns;
     _pub->connection_timeout_ns = (int64_t)context->publication_connection_timeout_ns;
-    _pub->time_of_last_send_or_heartbeat_ns = now_ns - AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS - 1;
-    _pub->time_of_last_setup_ns = now_ns - AERON_NETWORK_PUBLICATION_SETUP_TIMEOUT_NS - 1;
-    _pub->status_message_deadline_ns =
+    _pub->sender_fields.time_of_last_send_or_heartbeat_ns = now_ns - AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS - 1;
+    _pub->sender_fields.time_of_last_setup_ns = now_ns - AERON_NETWORK_PUBLICATION_SETUP_TIMEOUT_NS - 1;
+    _pub->sender_fields.status_message_deadline_ns =
         spies_simulate_connection ? now_ns : (now_ns + (int64_t)context->publication_connection_timeout_ns);
     _pub->is_exclusive = is_exclusive;
     _pub->spies_simulate_connection = spies_simulate_connection;
-    _pub->should_send_setup_frame = true;
-    _pub->has_receivers = false;
-    _pub->has_spies = false;
-    _pub->is_connected = false;
-    _pub->is_end_of_stream = false;
-    _pub->track_sender_limits = true;
-    _pub->has_sender_released = false;
+    _pub->sender_fields.should_send_setup_frame = true;
+    _pub->sender_fields.has_receivers = false;
+    _pub->conductor_fields.has_spies = false;
+    _pub->sender_fields.is_connected = false;
+    _pub->conductor_fields.is_end_of_stream = false;
+    _pub->sender_fields.track_sender_limits = true;
+    _pub->sender_fields.has_sender_released = false;
+    _pub->sender_fields.gso_enabled = context->socket_gso && !_pub->fec_enabled;
+    _pub->pacing_enabled = context->send_pacing;
+    _pub->send_priority = 0;
+    _pub->send_weight = 1;
+    _pub->sender_fields.send_quota = INT32_MAX;
+    _pub->sender_fields.idle_deadline_ns = now_ns;
+    _pub->sender_fields.idle_snd_lmt = 0;
+    _pub->sender_fields.coalesce_deadline_ns = 0;
+    _pub->sender_fields.coalesce_position = -1;
+    _pub->sender_fields.receiver_window_length = 0;
 
     _pub->short_sends_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS);
     _pub->heartbeats_sent_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_HEARTBEATS_SENT);
@@ -194,6 +277,9 @@ int aeron_network_publication_create(
     _pub->retransmits_sent_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RETRANSMITS_SENT);
     _pub->unblocked_publications_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_UNBLOCKED_PUBLICATIONS);
+    _pub->fec_frames_sent_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_FEC_FRAMES_SENT);
+    _pub->log_buffer_released_bytes_counter =
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_LOG_BUFFER_RELEASED_BYTES);
 
     *publication = _pub;
     return 0;
@@ -208,6 +294,7 @@ void aeron_network_publication_close(aeron_counters_manager_t *counters_manager,
         aeron_counters_manager_free(counters_manager, (int32_t)publication->pub_lmt_position.counter_id);
         aeron_counters_manager_free(counters_manager, (int32_t)publication->snd_pos_position.counter_id);
         aeron_counters_manager_free(counters_manager, (int32_t)publication->snd_lmt_position.counter_id);
+        aeron_stream_stats_free(&publication->stats, counters_manager);
 
         for (size_t i = 0, length = subscribable->length; i < length; i++)
         {
@@ -215,15 +302,15 @@ void aeron_network_publication_close(aeron_counters_manager_t *counters_manager,
         }
 
         aeron_free(subscribable->array);
+        aeron_free(publication->conductor_fields.non_blocking_spy_positions.array);
         publication->conductor_fields.managed_resource.clientd = NULL;
 
-        aeron_retransmit_handler_close(&publication->retransmit_handler);
+        aeron_retransmit_handler_close(&publication->sender_fields.retransmit_handler);
+        aeron_fec_encoder_close(&publication->sender_fields.fec_encoder);
         publication->map_raw_log_close_func(&publication->mapped_raw_log);
         publication->flow_control->fini(publication->flow_control);
-        aeron_free(publication->log_file_name);
+        aeron_arena_close(&publication->arena);
     }
-
-    aeron_free(publication);
 }
 
 int aeron_network_publication_setup_message_check(
@@ -231,7 +318,7 @@ int aeron_network_publication_setup_message_check(
 {
     int result = 0;
 
-    if (now_ns > (publication->time_of_last_setup_ns + AERON_NETWORK_PUBLICATION_SETUP_TIMEOUT_NS))
+    if (now_ns > (publication->sender_fields.time_of_last_setup_ns + AERON_NETWORK_PUBLICATION_SETUP_TIMEOUT_NS))
     {
         uint8_t setup_buffer[sizeof(aeron_setup_header_t)];
         aeron_setup_header_t *setup_header = (aeron_setup_header_t *)setup_buffer;
@@ -267,18 +354,57 @@ int aeron_network_publication_setup_message_check(
             }
         }
 
-        publication->time_of_last_setup_ns = now_ns;
-        publication->time_of_last_send_or_heartbeat_ns = now_ns;
+        publication->sender_fields.time_of_last_setup_ns = now_ns;
+        publication->sender_fields.time_of_last_send_or_heartbeat_ns = now_ns;
 
-        if (publication->has_receivers)
+        if (publication->sender_fields.has_receivers)
         {
-            publication->should_send_setup_frame = false;
+            publication->sender_fields.should_send_setup_frame = false;
         }
     }
 
     return result;
 }
 
+void aeron_network_publication_pmtu_probe_check(aeron_network_publication_t *publication, int64_t now_ns)
+{
+    const size_t probe_length = aeron_pmtu_discovery_next_probe(&publication->sender_fields.pmtu_discovery, now_ns);
+
+    if (0 == probe_length)
+    {
+        return;
+    }
+
+    /* an RTTM padded to the probe length that asks for a reply, which the receiver echoes with the timestamp */
+    aeron_rttm_header_t *rttm_header = (aeron_rttm_header_t *)publication->pmtu_probe;
+    struct iovec iov[1];
+    struct msghdr msghdr;
+
+    rttm_header->frame_header.frame_length = (int32_t)probe_length;
+    rttm_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    rttm_header->frame_header.flags = AERON_RTTM_HEADER_REPLY_FLAG;
+    rttm_header->frame_header.type = AERON_HDR_TYPE_RTTM;
+    rttm_header->session_id = publication->session_id;
+    rttm_header->stream_id = publication->stream_id;
+    rttm_header->echo_timestamp = now_ns;
+    rttm_header->reception_delta = 0;
+    rttm_header->receiver_id = 0;
+
+    iov[0].iov_base = publication->pmtu_probe;
+    iov[0].iov_len = probe_length;
+    msghdr.msg_iov = iov;
+    msghdr.msg_iovlen = 1;
+    msghdr.msg_flags = 0;
+    msghdr.msg_control = NULL;
+    msghdr.msg_controllen = 0;
+
+    /* a probe too long for the local interface fails to send, which only bounds the search */
+    if (aeron_send_channel_sendmsg(publication->endpoint, &msghdr) != (int)probe_length)
+    {
+        aeron_pmtu_discovery_on_send_failure(&publication->sender_fields.pmtu_discovery);
+    }
+}
+
 int aeron_network_publication_heartbeat_message_check(
     aeron_network_publication_t *publication,
     int64_t now_ns,
@@ -288,7 +414,7 @@ int aeron_network_publication_heartbeat_message_check(
 {
     int bytes_sent = 0;
 
-    if (now_ns > (publication->time_of_last_send_or_heartbeat_ns + AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS))
+    if (now_ns > (publication->sender_fields.time_of_last_send_or_heartbeat_ns + AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS))
     {
         uint8_t heartbeat_buffer[sizeof(aeron_data_header_t)];
         aeron_data_header_t *data_header = (aeron_data_header_t *)heartbeat_buffer;
@@ -311,6 +437,11 @@ int aeron_network_publication_heartbeat_message_check(
                 AERON_DATA_HEADER_BEGIN_FLAG | AERON_DATA_HEADER_END_FLAG | AERON_DATA_HEADER_EOS_FLAG;
         }
 
+        if (publication->endpoint->checksum)
+        {
+            aeron_frame_checksum_stamp(heartbeat_buffer, sizeof(aeron_data_header_t));
+        }
+
         iov[0].iov_base = heartbeat_buffer;
         iov[0].iov_len = sizeof(aeron_data_header_t);
         msghdr.msg_iov = iov;
@@ -327,37 +458,376 @@ int aeron_network_publication_heartbeat_message_check(
             }
         }
 
-        aeron_counter_ordered_increment(publication->heartbeats_sent_counter, 1);
-        publication->time_of_last_send_or_heartbeat_ns = now_ns;
+        aeron_counter_increment(publication->heartbeats_sent_counter, 1);
+        publication->sender_fields.time_of_last_send_or_heartbeat_ns = now_ns;
+    }
+
+    return bytes_sent;
+}
+
+static int aeron_network_publication_send_fec(aeron_network_publication_t *publication)
+{
+    const size_t frame_length = aeron_fec_encoder_encode(
+        &publication->sender_fields.fec_encoder,
+        publication->session_id,
+        publication->stream_id,
+        publication->fec_frame,
+        AERON_FEC_FRAME_MAX_LENGTH(publication->mtu_length));
+    struct iovec iov[1];
+    struct msghdr msghdr;
+    int bytes_sent;
+
+    if (0 == frame_length)
+    {
+        return 0;
+    }
+
+    iov[0].iov_base = publication->fec_frame;
+    iov[0].iov_len = frame_length;
+    msghdr.msg_iov = iov;
+    msghdr.msg_iovlen = 1;
+    msghdr.msg_flags = 0;
+    msghdr.msg_control = NULL;
+    msghdr.msg_controllen = 0;
+
+    if ((bytes_sent = aeron_send_channel_sendmsg(publication->endpoint, &msghdr)) != (int)frame_length)
+    {
+        if (bytes_sent >= 0)
+        {
+            aeron_counter_increment(publication->short_sends_counter, 1);
+        }
+    }
+    else
+    {
+        aeron_counter_increment(publication->fec_frames_sent_counter, 1);
     }
 
     return bytes_sent;
 }
 
+/*
+ * Add the datagrams just sent to the FEC group, sending its parity after them once it is full, when a datagram does
+ * not follow on from it, or when it has lingered.
+ */
+static int aeron_network_publication_fec_on_send(
+    aeron_network_publication_t *publication,
+    int64_t now_ns,
+    int32_t term_id,
+    const uint8_t *term_buffer,
+    struct iovec *iov,
+    int vlen)
+{
+    aeron_fec_encoder_t *encoder = &publication->sender_fields.fec_encoder;
+
+    for (int i = 0; i < vlen; i++)
+    {
+        const int32_t term_offset = (int32_t)((const uint8_t *)iov[i].iov_base - term_buffer);
+
+        if (aeron_fec_encoder_is_discontiguous(encoder, term_id, term_offset) &&
+            aeron_network_publication_send_fec(publication) < 0)
+        {
+            return -1;
+        }
+
+        if (aeron_fec_encoder_add(encoder, term_id, term_offset, iov[i].iov_base, iov[i].iov_len, now_ns) &&
+            aeron_network_publication_send_fec(publication) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (aeron_fec_encoder_has_lingered(encoder, now_ns) && aeron_network_publication_send_fec(publication) < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+#if defined(UDP_SEGMENT)
+/*
+ * Send runs of equal length datagrams as single buffers with a UDP_SEGMENT control message so the kernel segments
+ * them. A run is cut when a datagram is longer than the first so that every segment starts on a frame boundary.
+ */
+int aeron_network_publication_send_data_gso(
+    aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, int32_t term_offset)
+{
+    const size_t term_length = (size_t)publication->term_length_mask + 1;
+    int result = 0, vlen = 0, bytes_sent = 0;
+    const int32_t flow_control_window =
+        (int32_t)(aeron_counter_get(publication->snd_lmt_position.value_addr) - snd_pos);
+    int32_t available_window = flow_control_window;
+    bool is_app_limited = false;
+    int64_t highest_pos = snd_pos;
+    struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    struct mmsghdr mmsghdr[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    union aeron_network_publication_gso_control_un
+    {
+        size_t align;
+        uint8_t buffer[CMSG_SPACE(sizeof(uint16_t))];
+    }
+    control[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    size_t active_index = aeron_logbuffer_index_by_position(snd_pos, publication->position_bits_to_shift);
+    uint8_t *term_buffer = publication->mapped_raw_log.term_buffers[active_index].addr;
+    bool is_scan_complete = false;
+    bool has_next_term = false;
+
+    if (publication->pacing_enabled)
+    {
+        const int32_t pacing_window = aeron_send_pacer_available(&publication->sender_fields.pacer, now_ns);
+        available_window = pacing_window < available_window ? pacing_window : available_window;
+    }
+
+    available_window = publication->sender_fields.send_quota < available_window ? publication->sender_fields.send_quota : available_window;
+
+    for (size_t i = 0; i < AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND && available_window > 0; i++)
+    {
+        uint8_t *ptr = term_buffer + term_offset;
+        size_t batch_length = 0, segment_length = 0, num_segments = 0;
+        bool is_term_end = false;
+
+        while (num_segments < AERON_NETWORK_PUBLICATION_MAX_GSO_SEGMENTS && available_window > 0)
+        {
+            const size_t datagram_length = publication->sender_fields.datagram_length;
+            size_t scan_limit = (size_t)available_window < datagram_length ? (size_t)available_window : datagram_length;
+            size_t padding = 0;
+            const size_t term_length_left = term_length - (size_t)term_offset;
+            const size_t available = aeron_term_scanner_scan_for_availability(
+                term_buffer + term_offset, term_length_left, scan_limit, &padding);
+
+            if (0 == available)
+            {
+                is_scan_complete = true;
+                is_app_limited = true;
+                break;
+            }
+
+            if ((num_segments > 0 && available > segment_length) ||
+                (batch_length + available) > AERON_NETWORK_PUBLICATION_MAX_GSO_LENGTH)
+            {
+                break;
+            }
+
+            if (0 == num_segments)
+            {
+                segment_length = available;
+            }
+
+            num_segments++;
+            batch_length += available;
+            bytes_sent += available;
+            available_window -= available + padding;
+            term_offset += available + padding;
+            highest_pos += available + padding;
+
+            if (term_length == (size_t)term_offset)
+            {
+                is_term_end = true;
+                break;
+            }
+
+            if (padding > 0 || available < segment_length)
+            {
+                break;
+            }
+        }
+
+        if (batch_length > 0)
+        {
+            if (publication->endpoint->checksum)
+            {
+                aeron_frame_checksum_stamp(ptr, batch_length);
+            }
+
+            iov[vlen].iov_base = ptr;
+            iov[vlen].iov_len = batch_length;
+            mmsghdr[vlen].msg_hdr.msg_iov = &iov[vlen];
+            mmsghdr[vlen].msg_hdr.msg_iovlen = 1;
+            mmsghdr[vlen].msg_hdr.msg_flags = 0;
+            mmsghdr[vlen].msg_len = 0;
+            mmsghdr[vlen].msg_hdr.msg_control = NULL;
+            mmsghdr[vlen].msg_hdr.msg_controllen = 0;
+
+            if (num_segments > 1)
+            {
+                struct cmsghdr *cmsg;
+
+                memset(&control[vlen], 0, sizeof(control[vlen]));
+                mmsghdr[vlen].msg_hdr.msg_control = control[vlen].buffer;
+                mmsghdr[vlen].msg_hdr.msg_controllen = sizeof(control[vlen].buffer);
+
+                cmsg = CMSG_FIRSTHDR(&mmsghdr[vlen].msg_hdr);
+                cmsg->cmsg_level = SOL_UDP;
+                cmsg->cmsg_type = UDP_SEGMENT;
+                cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                *((uint16_t *)CMSG_DATA(cmsg)) = (uint16_t)segment_length;
+            }
+
+            vlen++;
+        }
+
+        if (is_scan_complete || 0 == batch_length)
+        {
+            break;
+        }
+
+        if (is_term_end)
+        {
+            /* carry on into the next term as aeron_network_publication_send_data does, relying on the same clean
+             * limit to find it clean or already written, a batch never spans both */
+            if (has_next_term)
+            {
+                break;
+            }
+
+            has_next_term = true;
+            active_index = aeron_logbuffer_index_by_position(highest_pos, publication->position_bits_to_shift);
+            term_buffer = publication->mapped_raw_log.term_buffers[active_index].addr;
+            term_offset = 0;
+        }
+    }
+
+    if (vlen > 0)
+    {
+        if ((result = aeron_send_channel_sendmmsg(publication->endpoint, mmsghdr, (size_t)vlen)) != vlen)
+        {
+            if (result >= 0)
+            {
+                aeron_counter_increment(publication->short_sends_counter, 1);
+            }
+            else if (EIO == aeron_errcode())
+            {
+                /* device can not offload segmentation, revert to sending datagrams individually */
+                publication->sender_fields.gso_enabled = false;
+            }
+        }
+
+        publication->sender_fields.time_of_last_send_or_heartbeat_ns = now_ns;
+        publication->sender_fields.track_sender_limits = true;
+        aeron_counter_set_ordered(publication->snd_pos_position.value_addr, highest_pos);
+
+        if (publication->pacing_enabled)
+        {
+            aeron_send_pacer_on_send(&publication->sender_fields.pacer, now_ns, highest_pos, bytes_sent, is_app_limited);
+        }
+    }
+    else if (publication->sender_fields.track_sender_limits && flow_control_window <= 0)
+    {
+        aeron_counter_increment(publication->sender_flow_control_limits_counter, 1);
+        publication->sender_fields.track_sender_limits = false;
+    }
+
+    return result < 0 ? result : bytes_sent;
+}
+#endif
+
+/*
+ * Whether to hold back the frames at the sender position when the channel coalesces, as they fill less than a batch
+ * and nothing more has been committed behind them yet. They are held for no longer than the coalesce window from when
+ * the sender first found them, and never when the term ends after them or the receivers would not take a full batch.
+ */
+static bool aeron_network_publication_should_coalesce(
+    aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, int32_t term_offset)
+{
+    const size_t term_length = (size_t)publication->term_length_mask + 1;
+    const size_t datagram_length = publication->sender_fields.datagram_length;
+    size_t batch_length = publication->endpoint->coalesce_batch_length;
+
+    if (0 == batch_length || batch_length > datagram_length)
+    {
+        batch_length = datagram_length;
+    }
+
+    if (aeron_counter_get(publication->snd_lmt_position.value_addr) - snd_pos < (int64_t)batch_length)
+    {
+        return false;
+    }
+
+    const size_t index = aeron_logbuffer_index_by_position(snd_pos, publication->position_bits_to_shift);
+    uint8_t *term_buffer = publication->mapped_raw_log.term_buffers[index].addr;
+    size_t padding = 0;
+    const size_t available = aeron_term_scanner_scan_for_availability(
+        term_buffer + term_offset, term_length - (size_t)term_offset, batch_length, &padding);
+    const size_t next_offset = (size_t)term_offset + available;
+
+    if (0 == available || available >= batch_length || padding > 0 || next_offset >= term_length)
+    {
+        return false;
+    }
+
+    /* a frame committed behind them that does not fit the batch leaves nothing to wait for */
+    int32_t next_frame_length;
+    AERON_GET_VOLATILE(next_frame_length, *(int32_t *)(term_buffer + next_offset));
+    if (next_frame_length > 0)
+    {
+        return false;
+    }
+
+    if (publication->sender_fields.coalesce_position != snd_pos)
+    {
+        publication->sender_fields.coalesce_position = snd_pos;
+        publication->sender_fields.coalesce_deadline_ns = now_ns + publication->endpoint->coalesce_window_ns;
+    }
+
+    return now_ns < publication->sender_fields.coalesce_deadline_ns;
+}
+
 int aeron_network_publication_send_data(
     aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, int32_t term_offset)
 {
+    if (publication->endpoint->coalesce_window_ns > 0 &&
+        aeron_network_publication_should_coalesce(publication, now_ns, snd_pos, term_offset))
+    {
+        return 0;
+    }
+
+#if defined(UDP_SEGMENT)
+    if (publication->sender_fields.gso_enabled)
+    {
+        return aeron_network_publication_send_data_gso(publication, now_ns, snd_pos, term_offset);
+    }
+#endif
+
     const size_t term_length = (size_t)publication->term_length_mask + 1;
     int result = 0, vlen = 0, bytes_sent = 0;
-    int32_t available_window = (int32_t)(aeron_counter_get(publication->snd_lmt_position.value_addr) - snd_pos);
+    const int32_t flow_control_window =
+        (int32_t)(aeron_counter_get(publication->snd_lmt_position.value_addr) - snd_pos);
+    int32_t available_window = flow_control_window;
+    bool is_app_limited = false;
     int64_t highest_pos = snd_pos;
     struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
     struct mmsghdr mmsghdr[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    size_t active_index = aeron_logbuffer_index_by_position(snd_pos, publication->position_bits_to_shift);
+    uint8_t *term_buffer = publication->mapped_raw_log.term_buffers[active_index].addr;
+    const uint8_t *first_term_buffer = term_buffer;
+    int next_term_vlen = -1;
+
+    if (publication->pacing_enabled)
+    {
+        const int32_t pacing_window = aeron_send_pacer_available(&publication->sender_fields.pacer, now_ns);
+        available_window = pacing_window < available_window ? pacing_window : available_window;
+    }
+
+    available_window = publication->sender_fields.send_quota < available_window ? publication->sender_fields.send_quota : available_window;
 
     for (size_t i = 0; i < AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND && available_window > 0; i++)
     {
-        size_t scan_limit =
-            (size_t)available_window < publication->mtu_length ? (size_t)available_window : publication->mtu_length;
-        size_t active_index = aeron_logbuffer_index_by_position(snd_pos, publication->position_bits_to_shift);
+        const size_t datagram_length = publication->sender_fields.datagram_length;
+        size_t scan_limit = (size_t)available_window < datagram_length ? (size_t)available_window : datagram_length;
         size_t padding = 0;
 
-        uint8_t *ptr = publication->mapped_raw_log.term_buffers[active_index].addr + term_offset;
+        uint8_t *ptr = term_buffer + term_offset;
         const size_t term_length_left = term_length - (size_t)term_offset;
 
         const size_t available = aeron_term_scanner_scan_for_availability(ptr, term_length_left, scan_limit, &padding);
 
         if (available > 0)
         {
+            if (publication->endpoint->checksum)
+            {
+                aeron_frame_checksum_stamp(ptr, available);
+            }
+
             iov[i].iov_base = ptr;
             iov[i].iov_len = available;
             mmsghdr[i].msg_hdr.msg_iov = &iov[i];
@@ -374,10 +844,28 @@ int aeron_network_publication_send_data(
             highest_pos += available + padding;
         }
 
-        if (available == 0 || term_length == (size_t)term_offset)
+        if (available == 0)
         {
+            is_app_limited = true;
             break;
         }
+
+        if (term_length == (size_t)term_offset)
+        {
+            /* carry on into the next term in this pass rather than a full round of the other publications later. The
+             * clean limit keeps the publication limit within (partition count - 1) terms of the clean position, so the
+             * next partition has been cleaned of its previous term and holds only frames already written to this
+             * one, and the scan stops at the first zero. Only one term end is crossed in a pass. */
+            if (next_term_vlen >= 0)
+            {
+                break;
+            }
+
+            next_term_vlen = vlen;
+            active_index = aeron_logbuffer_index_by_position(highest_pos, publication->position_bits_to_shift);
+            term_buffer = publication->mapped_raw_log.term_buffers[active_index].addr;
+            term_offset = 0;
+        }
     }
 
     if (vlen > 0)
@@ -390,28 +878,108 @@ int aeron_network_publication_send_data(
             }
         }
 
-        publication->time_of_last_send_or_heartbeat_ns = now_ns;
-        publication->track_sender_limits = true;
+        publication->sender_fields.time_of_last_send_or_heartbeat_ns = now_ns;
+        publication->sender_fields.track_sender_limits = true;
         aeron_counter_set_ordered(publication->snd_pos_position.value_addr, highest_pos);
+
+        if (publication->pacing_enabled)
+        {
+            aeron_send_pacer_on_send(&publication->sender_fields.pacer, now_ns, highest_pos, bytes_sent, is_app_limited);
+        }
+    }
+    else if (publication->sender_fields.track_sender_limits && flow_control_window <= 0)
+    {
+        aeron_counter_increment(publication->sender_flow_control_limits_counter, 1);
+        publication->sender_fields.track_sender_limits = false;
     }
-    else if (publication->track_sender_limits && available_window <= 0)
+
+    if (result >= 0 && publication->fec_enabled)
     {
-        aeron_counter_ordered_increment(publication->sender_flow_control_limits_counter, 1);
-        publication->track_sender_limits = false;
+        const int32_t term_id = aeron_logbuffer_compute_term_id_from_position(
+            snd_pos, publication->position_bits_to_shift, publication->initial_term_id);
+
+        const int first_term_vlen = next_term_vlen >= 0 ? next_term_vlen : vlen;
+
+        if (aeron_network_publication_fec_on_send(
+            publication, now_ns, term_id, first_term_buffer, iov, first_term_vlen) < 0)
+        {
+            return -1;
+        }
+
+        if (first_term_vlen < vlen && aeron_network_publication_fec_on_send(
+            publication, now_ns, term_id + 1, term_buffer, iov + first_term_vlen, vlen - first_term_vlen) < 0)
+        {
+            return -1;
+        }
     }
 
     return result < 0 ? result : bytes_sent;
 }
 
+inline static void aeron_network_publication_trace_snd_lmt(
+    aeron_network_publication_t *publication, int64_t old_snd_lmt, int64_t snd_lmt, int64_t now_ns)
+{
+    if (NULL != publication->flow_control_trace && snd_lmt != old_snd_lmt)
+    {
+        aeron_flow_control_strategy_t *flow_control = publication->flow_control;
+
+        aeron_flow_control_trace_record(
+            publication->flow_control_trace,
+            AERON_FLOW_CONTROL_TRACE_EVENT_SND_LMT,
+            AERON_FLOW_CONTROL_TRACE_CAUSE_RECEIVER,
+            NULL != flow_control->limiting_receiver_id ? flow_control->limiting_receiver_id(flow_control->state) : -1,
+            publication->conductor_fields.managed_resource.registration_id,
+            publication->session_id,
+            publication->stream_id,
+            snd_lmt,
+            aeron_counter_get(publication->snd_pos_position.value_addr),
+            now_ns);
+    }
+}
+
+/*
+ * Idle when the last pass sent nothing and nothing it acts on has changed since: no frame at the sender position, or
+ * no window to send it in, under the same sender limit, with no setup, retransmit, or FEC group pending and no timer
+ * due. Heartbeats bound the idle deadline so an idle publication still sends them on time.
+ */
+inline static bool aeron_network_publication_is_idle(
+    aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos)
+{
+    if (now_ns >= publication->sender_fields.idle_deadline_ns ||
+        publication->sender_fields.should_send_setup_frame ||
+        publication->spies_simulate_connection ||
+        publication->sender_fields.retransmit_handler.active_actions_length > 0 ||
+        (publication->fec_enabled && publication->sender_fields.fec_encoder.datagram_count > 0) ||
+        aeron_counter_get(publication->snd_lmt_position.value_addr) != publication->sender_fields.idle_snd_lmt)
+    {
+        return false;
+    }
+
+    const size_t index = aeron_logbuffer_index_by_position(snd_pos, publication->position_bits_to_shift);
+    const int32_t term_offset = (int32_t)snd_pos & publication->term_length_mask;
+    int32_t frame_length;
+
+    AERON_GET_VOLATILE(
+        frame_length, *(int32_t *)(publication->mapped_raw_log.term_buffers[index].addr + term_offset));
+
+    return 0 == frame_length || publication->sender_fields.idle_snd_lmt <= snd_pos;
+}
+
 int aeron_network_publication_send(aeron_network_publication_t *publication, int64_t now_ns)
 {
     int64_t snd_pos = aeron_counter_get(publication->snd_pos_position.value_addr);
+
+    if (aeron_network_publication_is_idle(publication, now_ns, snd_pos))
+    {
+        return 0;
+    }
+
     int32_t active_term_id =
         aeron_logbuffer_compute_term_id_from_position(
             snd_pos, publication->position_bits_to_shift, publication->initial_term_id);
     int32_t term_offset = (int32_t)snd_pos & publication->term_length_mask;
 
-    if (publication->should_send_setup_frame)
+    if (publication->sender_fields.should_send_setup_frame)
     {
         if (aeron_network_publication_setup_message_check(publication, now_ns, active_term_id, term_offset) < 0)
         {
@@ -419,16 +987,22 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
         }
     }
 
+    if (publication->pmtu_discovery_enabled && publication->sender_fields.is_connected)
+    {
+        aeron_network_publication_pmtu_probe_check(publication, now_ns);
+    }
+
     int bytes_sent = aeron_network_publication_send_data(publication, now_ns, snd_pos, term_offset);
     if (bytes_sent < 0)
     {
         return -1;
     }
+    AERON_PROBE4(publication_send_data, publication->session_id, publication->stream_id, snd_pos, bytes_sent);
 
     if (0 == bytes_sent)
     {
         bool is_end_of_stream;
-        AERON_GET_VOLATILE(is_end_of_stream, publication->is_end_of_stream);
+        AERON_GET_VOLATILE(is_end_of_stream, publication->conductor_fields.is_end_of_stream);
 
         bytes_sent =
             aeron_network_publication_heartbeat_message_check(
@@ -439,17 +1013,19 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
         }
 
         bool has_spies;
-        AERON_GET_VOLATILE(has_spies, publication->has_spies);
+        AERON_GET_VOLATILE(has_spies, publication->conductor_fields.has_spies);
 
-        if (publication->spies_simulate_connection && now_ns > publication->status_message_deadline_ns && has_spies)
+        if (publication->spies_simulate_connection && now_ns > publication->sender_fields.status_message_deadline_ns && has_spies)
         {
             const int64_t new_snd_pos = aeron_network_publication_max_spy_position(publication, snd_pos);
             aeron_counter_set_ordered(publication->snd_pos_position.value_addr, new_snd_pos);
 
+            int64_t snd_lmt = aeron_counter_get(publication->snd_lmt_position.value_addr);
             int64_t flow_control_position =
                 publication->flow_control->on_idle(
                     publication->flow_control->state, now_ns, new_snd_pos, new_snd_pos, is_end_of_stream);
             aeron_counter_set_ordered(publication->snd_lmt_position.value_addr, flow_control_position);
+            aeron_network_publication_trace_snd_lmt(publication, snd_lmt, flow_control_position, now_ns);
         }
         else
         {
@@ -458,15 +1034,31 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
                 publication->flow_control->on_idle(
                     publication->flow_control->state, now_ns, snd_lmt, snd_pos, is_end_of_stream);
             aeron_counter_set_ordered(publication->snd_lmt_position.value_addr, flow_control_position);
+            aeron_network_publication_trace_snd_lmt(publication, snd_lmt, flow_control_position, now_ns);
         }
     }
 
-    if (now_ns > publication->status_message_deadline_ns && publication->has_receivers)
+    if (now_ns > publication->sender_fields.status_message_deadline_ns && publication->sender_fields.has_receivers)
     {
-        AERON_PUT_ORDERED(publication->has_receivers, false);
+        AERON_PUT_ORDERED(publication->sender_fields.has_receivers, false);
     }
 
-    aeron_retransmit_handler_process_timeouts(&publication->retransmit_handler, now_ns);
+    aeron_retransmit_handler_process_timeouts(&publication->sender_fields.retransmit_handler, now_ns);
+
+    if (0 == bytes_sent)
+    {
+        const int64_t heartbeat_deadline_ns =
+            publication->sender_fields.time_of_last_send_or_heartbeat_ns + AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS + 1;
+        const int64_t check_deadline_ns = now_ns + AERON_NETWORK_PUBLICATION_IDLE_CHECK_INTERVAL_NS;
+
+        publication->sender_fields.idle_deadline_ns =
+            heartbeat_deadline_ns < check_deadline_ns ? heartbeat_deadline_ns : check_deadline_ns;
+        publication->sender_fields.idle_snd_lmt = aeron_counter_get(publication->snd_lmt_position.value_addr);
+    }
+    else
+    {
+        publication->sender_fields.idle_deadline_ns = now_ns;
+    }
 
     return bytes_sent;
 }
@@ -481,62 +1073,88 @@ int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t ter
     const size_t term_length = (size_t)(publication->term_length_mask + 1);
     int result = 0;
 
+    AERON_PROBE5(
+        publication_retransmit, publication->session_id, publication->stream_id, term_id, term_offset, length);
+
     if (resend_position < sender_position && resend_position >= (sender_position - (int32_t)term_length))
     {
         const size_t index = aeron_logbuffer_index_by_position(resend_position, publication->position_bits_to_shift);
 
+        uint8_t *term_buffer = publication->mapped_raw_log.term_buffers[index].addr;
+        struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_RESEND];
+        struct mmsghdr mmsghdr[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_RESEND];
         size_t remaining_bytes = length;
-        int32_t bytes_sent = 0;
         int32_t offset = term_offset;
+        bool is_scan_complete = false;
 
-        do
+        /* the whole range goes out as one sendmmsg batch, split only when it exceeds the batch vector */
+        while (!is_scan_complete && result >= 0)
         {
-            offset += bytes_sent;
+            int vlen = 0;
 
-            uint8_t *ptr = publication->mapped_raw_log.term_buffers[index].addr + offset;
-            const size_t term_length_left = term_length - (size_t)offset;
-            size_t padding = 0;
-            size_t max_length = remaining_bytes < publication->mtu_length ? remaining_bytes : publication->mtu_length;
-
-            size_t available =
-                aeron_term_scanner_scan_for_availability(ptr, term_length_left, max_length, &padding);
-            if (available <= 0)
+            while (vlen < AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_RESEND && remaining_bytes > 0)
             {
-                break;
-            }
-
-            struct iovec iov[1];
-            struct msghdr msghdr;
-
-            iov[0].iov_base = ptr;
-            iov[0].iov_len = available;
-            msghdr.msg_iov = iov;
-            msghdr.msg_iovlen = 1;
-            msghdr.msg_control = NULL;
-            msghdr.msg_controllen = 0;
-            msghdr.msg_flags = 0;
-
-            int sendmsg_result;
-            if ((sendmsg_result = aeron_send_channel_sendmsg(publication->endpoint, &msghdr)) != (int)iov[0].iov_len)
-            {
-                if (sendmsg_result >= 0)
+                uint8_t *ptr = term_buffer + offset;
+                const size_t term_length_left = term_length - (size_t)offset;
+                size_t padding = 0;
+                const size_t datagram_length = publication->sender_fields.datagram_length;
+                size_t max_length = remaining_bytes < datagram_length ? remaining_bytes : datagram_length;
+
+                size_t available =
+                    aeron_term_scanner_scan_for_availability(ptr, term_length_left, max_length, &padding);
+                if (available <= 0)
                 {
-                    aeron_counter_increment(publication->short_sends_counter, 1);
+                    is_scan_complete = true;
                     break;
                 }
-                else
+
+                /* stamped again as frames may have been passed over unsent while spies simulated a connection */
+                if (publication->endpoint->checksum)
                 {
-                    result = -1;
-                    break;
+                    aeron_frame_checksum_stamp(ptr, available);
                 }
+
+                iov[vlen].iov_base = ptr;
+                iov[vlen].iov_len = available;
+                mmsghdr[vlen].msg_hdr.msg_iov = &iov[vlen];
+                mmsghdr[vlen].msg_hdr.msg_iovlen = 1;
+                mmsghdr[vlen].msg_hdr.msg_flags = 0;
+                mmsghdr[vlen].msg_len = 0;
+                mmsghdr[vlen].msg_hdr.msg_control = NULL;
+                mmsghdr[vlen].msg_hdr.msg_controllen = 0;
+                vlen++;
+
+                const size_t bytes_scanned = available + padding;
+                offset += (int32_t)bytes_scanned;
+                remaining_bytes = bytes_scanned < remaining_bytes ? remaining_bytes - bytes_scanned : 0;
             }
 
-            bytes_sent = (int32_t)(available + padding);
-            remaining_bytes -= bytes_sent;
+            if (0 == remaining_bytes)
+            {
+                is_scan_complete = true;
+            }
+
+            if (vlen > 0)
+            {
+                const int sendmmsg_result =
+                    aeron_send_channel_sendmmsg(publication->endpoint, mmsghdr, (size_t)vlen);
+
+                if (sendmmsg_result != vlen)
+                {
+                    if (sendmmsg_result >= 0)
+                    {
+                        aeron_counter_increment(publication->short_sends_counter, 1);
+                        break;
+                    }
+                    else
+                    {
+                        result = -1;
+                    }
+                }
+            }
         }
-        while (remaining_bytes > 0);
 
-        aeron_counter_ordered_increment(publication->retransmits_sent_counter, 1);
+        aeron_counter_increment(publication->retransmits_sent_counter, 1);
     }
 
     return result;
@@ -545,8 +1163,11 @@ int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t ter
 void aeron_network_publication_on_nak(
     aeron_network_publication_t *publication, int32_t term_id, int32_t term_offset, int32_t length)
 {
+    AERON_PROBE5(
+        publication_nak_received, publication->session_id, publication->stream_id, term_id, term_offset, length);
+
     aeron_retransmit_handler_on_nak(
-        &publication->retransmit_handler,
+        &publication->sender_fields.retransmit_handler,
         term_id,
         term_offset,
         (size_t)length,
@@ -561,33 +1182,59 @@ void aeron_network_publication_on_status_message(
 {
     const int64_t time_ns = publication->nano_clock();
 
-    publication->status_message_deadline_ns = time_ns + publication->connection_timeout_ns;
+    AERON_PROBE5(
+        publication_status_message,
+        publication->session_id,
+        publication->stream_id,
+        ((aeron_status_message_header_t *)buffer)->consumption_term_id,
+        ((aeron_status_message_header_t *)buffer)->consumption_term_offset,
+        ((aeron_status_message_header_t *)buffer)->receiver_window);
 
-    if (!publication->has_receivers)
+    publication->sender_fields.status_message_deadline_ns = time_ns + publication->connection_timeout_ns;
+
+    if (!publication->sender_fields.has_receivers)
     {
-        AERON_PUT_ORDERED(publication->has_receivers, true);
+        AERON_PUT_ORDERED(publication->sender_fields.has_receivers, true);
     }
 
     bool is_connected;
-    AERON_GET_VOLATILE(is_connected, publication->is_connected);
+    AERON_GET_VOLATILE(is_connected, publication->sender_fields.is_connected);
 
     if (!is_connected)
     {
         AERON_PUT_ORDERED(publication->log_meta_data->is_connected, true);
-        AERON_PUT_ORDERED(publication->is_connected, true);
-    }
-
-    aeron_counter_set_ordered(
-        publication->snd_lmt_position.value_addr,
-        publication->flow_control->on_status_message(
-            publication->flow_control->state,
-            buffer,
-            length,
-            addr,
-            *publication->snd_lmt_position.value_addr,
-            publication->initial_term_id,
-            publication->position_bits_to_shift,
-            time_ns));
+        AERON_PUT_ORDERED(publication->sender_fields.is_connected, true);
+    }
+
+    if (publication->pacing_enabled)
+    {
+        aeron_status_message_header_t *sm = (aeron_status_message_header_t *)buffer;
+
+        aeron_send_pacer_on_status_message(
+            &publication->sender_fields.pacer,
+            time_ns,
+            aeron_logbuffer_compute_position(
+                sm->consumption_term_id,
+                sm->consumption_term_offset,
+                publication->position_bits_to_shift,
+                publication->initial_term_id));
+    }
+
+    publication->sender_fields.receiver_window_length = ((aeron_status_message_header_t *)buffer)->receiver_window;
+
+    const int64_t snd_lmt = *publication->snd_lmt_position.value_addr;
+    const int64_t new_snd_lmt = publication->flow_control->on_status_message(
+        publication->flow_control->state,
+        buffer,
+        length,
+        addr,
+        snd_lmt,
+        publication->initial_term_id,
+        publication->position_bits_to_shift,
+        time_ns);
+
+    aeron_counter_set_ordered(publication->snd_lmt_position.value_addr, new_snd_lmt);
+    aeron_network_publication_trace_snd_lmt(publication, snd_lmt, new_snd_lmt, time_ns);
 }
 
 void aeron_network_publication_on_rttm(
@@ -629,14 +1276,20 @@ void aeron_network_publication_on_rttm(
             }
         }
     }
+    else if (publication->pmtu_discovery_enabled &&
+        aeron_pmtu_discovery_on_echo(&publication->sender_fields.pmtu_discovery, rttm_in_header->echo_timestamp))
+    {
+        publication->sender_fields.datagram_length =
+            aeron_pmtu_discovery_confirmed_length(&publication->sender_fields.pmtu_discovery);
+    }
 }
 
-void aeron_network_publication_clean_buffer(aeron_network_publication_t *publication, int64_t pub_lmt)
+int aeron_network_publication_clean_buffer(aeron_network_publication_t *publication, int64_t pub_lmt)
 {
     const int64_t clean_position = publication->conductor_fields.clean_position;
     const int64_t dirty_range = pub_lmt  - clean_position;
     const int32_t buffer_capacity = publication->term_length_mask + 1;
-    const int32_t reserved_range = buffer_capacity * 2;
+    const int64_t reserved_range = (int64_t)buffer_capacity * (AERON_LOGBUFFER_PARTITION_COUNT - 1);
 
     if (dirty_range > reserved_range)
     {
@@ -646,9 +1299,44 @@ void aeron_network_publication_clean_buffer(aeron_network_publication_t *publica
         int32_t bytes_for_cleaning = (int32_t)(dirty_range - reserved_range);
         int32_t length = bytes_for_cleaning < bytes_left_in_term ? bytes_for_cleaning : bytes_left_in_term;
 
-        memset(publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset, 0, length);
+        if (publication->term_clean_chunk_length > 0 && length > publication->term_clean_chunk_length)
+        {
+            length = (int32_t)publication->term_clean_chunk_length;
+        }
+
+        const size_t released_length = aeron_mapped_buffer_clean(
+            publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset,
+            (size_t)length,
+            publication->file_page_size,
+            publication->release_cleaned_pages);
+        if (released_length > 0)
+        {
+            aeron_counter_add_ordered(publication->log_buffer_released_bytes_counter, (int64_t)released_length);
+        }
         publication->conductor_fields.clean_position = clean_position + length;
+
+        return 1;
     }
+
+    return 0;
+}
+
+int aeron_network_publication_add_non_blocking_spy(aeron_network_publication_t *publication, int64_t *value_addr)
+{
+    int ensure_capacity_result = 0;
+
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result, publication->conductor_fields.non_blocking_spy_positions, int64_t *);
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    publication->conductor_fields.non_blocking_spy_positions.array[
+        publication->conductor_fields.non_blocking_spy_positions.length++] = value_addr;
+    publication->conductor_fields.subscribable.min_position_addr = NULL;
+
+    return 0;
 }
 
 int aeron_network_publication_update_pub_lmt(aeron_network_publication_t *publication)
@@ -662,27 +1350,94 @@ int aeron_network_publication_update_pub_lmt(aeron_network_publication_t *public
     int64_t snd_pos = aeron_counter_get_volatile(publication->snd_pos_position.value_addr);
 
     bool has_receivers;
-    AERON_GET_VOLATILE(has_receivers, publication->has_receivers);
+    AERON_GET_VOLATILE(has_receivers, publication->sender_fields.has_receivers);
     if (has_receivers ||
         (publication->spies_simulate_connection && publication->conductor_fields.subscribable.length > 0))
     {
+        aeron_subscribable_t *subscribable = &publication->conductor_fields.subscribable;
         int64_t min_consumer_position = snd_pos;
-        if (publication->conductor_fields.subscribable.length > 0)
+        int64_t limiting_counter_id = -1;
+
+        /*
+         * As for IPC the scan of the spies is skipped while the slowest could not raise the limit, unless spies
+         * simulate a connection as then the sender follows the most advanced spy.
+         */
+        if (!publication->spies_simulate_connection && subscribable->length > 0 &&
+            aeron_driver_subscribable_is_min_position_settled(
+                subscribable,
+                aeron_counter_get(publication->pub_lmt_position.value_addr) - publication->term_window_length))
         {
-            for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
+            if (subscribable->min_position < min_consumer_position)
             {
-                int64_t position =
-                    aeron_counter_get_volatile(publication->conductor_fields.subscribable.array[i].value_addr);
+                min_consumer_position = subscribable->min_position;
+                limiting_counter_id = publication->conductor_fields.limiting_spy_counter_id;
+            }
+        }
+        else if (subscribable->length > 0)
+        {
+            const bool has_non_blocking_spies = publication->conductor_fields.non_blocking_spy_positions.length > 0;
+            int64_t max_spy_position = snd_pos;
+            int64_t min_spy_position = INT64_MAX;
+            int64_t *min_spy_position_addr = NULL;
 
-                min_consumer_position = (position < min_consumer_position) ? (position) : (min_consumer_position);
+            for (size_t i = 0, length = subscribable->length; i < length; i++)
+            {
+                int64_t *value_addr = subscribable->array[i].value_addr;
+                int64_t position = aeron_counter_get_volatile(value_addr);
+
+                max_spy_position = (position > max_spy_position) ? (position) : (max_spy_position);
+
+                if (position < min_spy_position &&
+                    (!has_non_blocking_spies ||
+                    !aeron_network_publication_is_non_blocking_spy(publication, value_addr)))
+                {
+                    min_spy_position = position;
+                    min_spy_position_addr = value_addr;
+                    publication->conductor_fields.limiting_spy_counter_id = subscribable->array[i].counter_id;
+                }
+            }
+
+            aeron_driver_subscribable_track_min_position(subscribable, min_spy_position_addr, min_spy_position);
+            AERON_PUT_ORDERED(publication->conductor_fields.max_spy_position, max_spy_position);
+
+            if (min_spy_position < min_consumer_position)
+            {
+                min_consumer_position = min_spy_position;
+                limiting_counter_id = publication->conductor_fields.limiting_spy_counter_id;
             }
         }
 
-        const int64_t proposed_pub_lmt = min_consumer_position + publication->term_window_length;
+        int64_t proposed_pub_lmt = min_consumer_position + publication->term_window_length;
+        work_count += aeron_network_publication_clean_buffer(publication, proposed_pub_lmt);
+
+        /* cleaning is done in chunks so the limit must not get more than the reserved range ahead of it */
+        const int64_t clean_limit =
+            publication->conductor_fields.clean_position +
+            ((AERON_LOGBUFFER_PARTITION_COUNT - 1) * ((int64_t)publication->term_length_mask + 1));
+        const bool is_cleaning_limited = clean_limit < proposed_pub_lmt;
+        proposed_pub_lmt = is_cleaning_limited ? clean_limit : proposed_pub_lmt;
+
         if (aeron_counter_propose_max_ordered(publication->pub_lmt_position.value_addr, proposed_pub_lmt))
         {
-            aeron_network_publication_clean_buffer(publication, proposed_pub_lmt);
+            aeron_counter_signal_waiters(publication->pub_lmt_position.value_addr);
             work_count = 1;
+
+            if (NULL != publication->flow_control_trace)
+            {
+                aeron_flow_control_trace_record(
+                    publication->flow_control_trace,
+                    AERON_FLOW_CONTROL_TRACE_EVENT_PUB_LMT,
+                    is_cleaning_limited ? AERON_FLOW_CONTROL_TRACE_CAUSE_CLEANING :
+                        (limiting_counter_id >= 0 ?
+                            AERON_FLOW_CONTROL_TRACE_CAUSE_SUBSCRIBER : AERON_FLOW_CONTROL_TRACE_CAUSE_SENDER),
+                    is_cleaning_limited ? -1 : limiting_counter_id,
+                    publication->conductor_fields.managed_resource.registration_id,
+                    publication->session_id,
+                    publication->stream_id,
+                    proposed_pub_lmt,
+                    min_consumer_position,
+                    publication->nano_clock());
+            }
         }
     }
     else if (*publication->pub_lmt_position.value_addr > snd_pos)
@@ -699,7 +1454,15 @@ void aeron_network_publication_check_for_blocked_publisher(
     if (snd_pos == publication->conductor_fields.last_snd_pos &&
         aeron_network_publication_is_possibly_blocked(publication, snd_pos))
     {
-        if (now_ns > (publication->conductor_fields.time_of_last_activity_ns + publication->unblock_timeout_ns))
+        const int64_t unblock_timeout_ns = aeron_driver_unblock_timeout_ns(
+            now_ns,
+            publication->unblock_timeout_ns,
+            publication->unblock_timeout_min_ns,
+            publication->conductor_fields.longest_stall_ns,
+            publication->conductor_fields.fast_unblock_deadline_ns);
+
+        publication->conductor_fields.is_stalled = true;
+        if (now_ns > (publication->conductor_fields.time_of_last_activity_ns + unblock_timeout_ns))
         {
             if (aeron_logbuffer_unblocker_unblock(
                 publication->mapped_raw_log.term_buffers,
@@ -707,16 +1470,37 @@ void aeron_network_publication_check_for_blocked_publisher(
                 snd_pos))
             {
                 aeron_counter_ordered_increment(publication->unblocked_publications_counter, 1);
+                publication->conductor_fields.is_stalled = false;
             }
         }
     }
     else
     {
+        if (publication->conductor_fields.is_stalled)
+        {
+            const int64_t stall_ns = now_ns - publication->conductor_fields.time_of_last_activity_ns;
+
+            publication->conductor_fields.longest_stall_ns = stall_ns > publication->conductor_fields.longest_stall_ns ?
+                stall_ns : publication->conductor_fields.longest_stall_ns;
+            publication->conductor_fields.is_stalled = false;
+        }
+
         publication->conductor_fields.time_of_last_activity_ns = now_ns;
         publication->conductor_fields.last_snd_pos = snd_pos;
     }
 }
 
+void aeron_network_publication_on_client_timeout(aeron_network_publication_t *publication, int64_t now_ns)
+{
+    publication->conductor_fields.fast_unblock_deadline_ns = now_ns + publication->unblock_timeout_ns;
+
+    if (AERON_NETWORK_PUBLICATION_STATUS_ACTIVE == publication->conductor_fields.status && !publication->is_exclusive)
+    {
+        aeron_network_publication_check_for_blocked_publisher(
+            publication, now_ns, aeron_counter_get_volatile(publication->snd_pos_position.value_addr));
+    }
+}
+
 void aeron_network_publication_incref(void *clientd)
 {
     aeron_network_publication_t *publication = (aeron_network_publication_t *)clientd;
@@ -733,17 +1517,31 @@ void aeron_network_publication_decref(void *clientd)
     {
         const int64_t producer_position = aeron_network_publication_producer_position(publication);
 
-        publication->conductor_fields.status = AERON_NETWORK_PUBLICATION_STATUS_DRAINING;
         publication->conductor_fields.time_of_last_activity_ns = publication->nano_clock();
+
+        if (publication->is_resumable)
+        {
+            publication->conductor_fields.status = AERON_NETWORK_PUBLICATION_STATUS_RESUMABLE;
+            return;
+        }
+
+        publication->conductor_fields.status = AERON_NETWORK_PUBLICATION_STATUS_DRAINING;
         AERON_PUT_ORDERED(publication->log_meta_data->end_of_stream_position, producer_position);
 
         if (aeron_counter_get_volatile(publication->snd_pos_position.value_addr) >= producer_position)
         {
-            AERON_PUT_ORDERED(publication->is_end_of_stream, true);
+            AERON_PUT_ORDERED(publication->conductor_fields.is_end_of_stream, true);
         }
     }
 }
 
+void aeron_network_publication_resume(aeron_network_publication_t *publication)
+{
+    publication->conductor_fields.status = AERON_NETWORK_PUBLICATION_STATUS_ACTIVE;
+    publication->conductor_fields.time_of_last_activity_ns = publication->nano_clock();
+    publication->conductor_fields.refcnt++;
+}
+
 bool aeron_network_publication_spies_finished_consuming(
     aeron_network_publication_t *publication, aeron_driver_conductor_t *conductor, int64_t eos_pos)
 {
@@ -751,13 +1549,16 @@ bool aeron_network_publication_spies_finished_consuming(
     {
         for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
         {
-            if (aeron_counter_get_volatile(publication->conductor_fields.subscribable.array[i].value_addr) < eos_pos)
+            int64_t *value_addr = publication->conductor_fields.subscribable.array[i].value_addr;
+
+            if (aeron_counter_get_volatile(value_addr) < eos_pos &&
+                !aeron_network_publication_is_non_blocking_spy(publication, value_addr))
             {
                 return false;
             }
         }
 
-        AERON_PUT_ORDERED(publication->has_spies, false);
+        AERON_PUT_ORDERED(publication->conductor_fields.has_spies, false);
         aeron_driver_conductor_cleanup_spies(conductor, publication);
 
         for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
@@ -770,6 +1571,8 @@ bool aeron_network_publication_spies_finished_consuming(
         publication->conductor_fields.subscribable.array = NULL;
         publication->conductor_fields.subscribable.length = 0;
         publication->conductor_fields.subscribable.capacity = 0;
+        publication->conductor_fields.subscribable.min_position_addr = NULL;
+        publication->conductor_fields.non_blocking_spy_positions.length = 0;
     }
 
     return true;
@@ -779,18 +1582,18 @@ void aeron_network_publication_on_time_event(
     aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication, int64_t now_ns, int64_t now_ms)
 {
     bool has_receivers;
-    AERON_GET_VOLATILE(has_receivers, publication->has_receivers);
+    AERON_GET_VOLATILE(has_receivers, publication->sender_fields.has_receivers);
 
     const bool current_connected_status =
         has_receivers || (publication->spies_simulate_connection && publication->conductor_fields.subscribable.length > 0);
 
     bool is_connected;
-    AERON_GET_VOLATILE(is_connected, publication->is_connected);
+    AERON_GET_VOLATILE(is_connected, publication->sender_fields.is_connected);
 
     if (current_connected_status != is_connected)
     {
         AERON_PUT_ORDERED(publication->log_meta_data->is_connected, current_connected_status);
-        AERON_PUT_ORDERED(publication->is_connected, current_connected_status);
+        AERON_PUT_ORDERED(publication->sender_fields.is_connected, current_connected_status);
     }
 
     switch (publication->conductor_fields.status)
@@ -805,6 +1608,30 @@ void aeron_network_publication_on_time_event(
             break;
         }
 
+        case AERON_NETWORK_PUBLICATION_STATUS_RESUMABLE:
+        {
+            const int64_t sender_position = aeron_counter_get_volatile(publication->snd_pos_position.value_addr);
+
+            /* a publisher that died mid claim would otherwise leave the log blocked for the one that resumes it */
+            if (aeron_network_publication_producer_position(publication) > sender_position &&
+                aeron_logbuffer_unblocker_unblock(
+                    publication->mapped_raw_log.term_buffers, publication->log_meta_data, sender_position))
+            {
+                aeron_counter_ordered_increment(publication->unblocked_publications_counter, 1);
+            }
+
+            if (now_ns > (publication->conductor_fields.time_of_last_activity_ns + publication->resume_timeout_ns))
+            {
+                const int64_t producer_position = aeron_network_publication_producer_position(publication);
+
+                publication->is_resumable = false;
+                publication->conductor_fields.status = AERON_NETWORK_PUBLICATION_STATUS_DRAINING;
+                publication->conductor_fields.time_of_last_activity_ns = now_ns;
+                AERON_PUT_ORDERED(publication->log_meta_data->end_of_stream_position, producer_position);
+            }
+            break;
+        }
+
         case AERON_NETWORK_PUBLICATION_STATUS_DRAINING:
         {
             const int64_t sender_position = aeron_counter_get_volatile(publication->snd_pos_position.value_addr);
@@ -826,7 +1653,7 @@ void aeron_network_publication_on_time_event(
             }
             else
             {
-                AERON_PUT_ORDERED(publication->is_end_of_stream, true);
+                AERON_PUT_ORDERED(publication->conductor_fields.is_end_of_stream, true);
             }
 
             if (aeron_network_publication_spies_finished_consuming(publication, conductor, producer_position))
@@ -863,3 +1690,6 @@ extern void aeron_network_publication_sender_release(aeron_network_publication_t
 extern bool aeron_network_publication_has_sender_released(aeron_network_publication_t *publication);
 extern int64_t aeron_network_publication_max_spy_position(aeron_network_publication_t *publication, int64_t snd_pos);
 extern size_t aeron_network_publication_num_spy_subscribers(aeron_network_publication_t *publication);
+extern bool aeron_network_publication_is_non_blocking_spy(
+    aeron_network_publication_t *publication, int64_t *value_addr);
+extern size_t aeron_network_publication_num_non_blocking_spy_subscribers(aeron_network_publication_t *publication);
@@ -20,14 +20,21 @@
 #include "util/aeron_bitutil.h"
 #include "util/aeron_fileutil.h"
 #include "aeron_driver_common.h"
+#include "aeron_alloc.h"
 #include "aeron_driver_context.h"
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_system_counters.h"
 #include "aeron_retransmit_handler.h"
+#include "aeron_send_pacer.h"
+#include "aeron_fec.h"
+#include "aeron_pmtu_discovery.h"
+#include "aeron_position.h"
 
 typedef enum aeron_network_publication_status_enum
 {
     AERON_NETWORK_PUBLICATION_STATUS_ACTIVE,
+    /* no clients, held without end of stream until resume_timeout_ns for a publisher with the same resume token */
+    AERON_NETWORK_PUBLICATION_STATUS_RESUMABLE,
     AERON_NETWORK_PUBLICATION_STATUS_DRAINING,
     AERON_NETWORK_PUBLICATION_STATUS_LINGER,
     AERON_NETWORK_PUBLICATION_STATUS_CLOSING
@@ -37,23 +44,48 @@ aeron_network_publication_status_t;
 #define AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS (100 * 1000 * 1000L)
 #define AERON_NETWORK_PUBLICATION_SETUP_TIMEOUT_NS (100 * 1000 * 1000L)
 #define AERON_NETWORK_PUBLICATION_CONNECTION_TIMEOUT_MS (5 * 1000L)
+#define AERON_NETWORK_PUBLICATION_IDLE_CHECK_INTERVAL_NS (1000 * 1000L)
 
 #define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND (2)
+#define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_RESEND (16)
+#define AERON_NETWORK_PUBLICATION_MAX_GSO_SEGMENTS (64)
+#define AERON_NETWORK_PUBLICATION_MAX_GSO_LENGTH (63 * 1024)
 
 typedef struct aeron_send_channel_endpoint_stct aeron_send_channel_endpoint_t;
 typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
 
 typedef struct aeron_network_publication_stct
 {
+    /* written by the conductor, including the few flags the sender reads */
     struct aeron_network_publication_conductor_fields_stct
     {
         aeron_driver_managed_resource_t managed_resource;
         aeron_subscribable_t subscribable;
+        struct aeron_network_publication_non_blocking_spies_stct
+        {
+            int64_t **array;
+            size_t length;
+            size_t capacity;
+        }
+        non_blocking_spy_positions;
         int64_t clean_position;
         int64_t time_of_last_activity_ns;
         int64_t last_snd_pos;
+        /* longest the publication looked blocked before it moved on without an unblock */
+        int64_t longest_stall_ns;
+        int64_t fast_unblock_deadline_ns;
+        int64_t max_spy_position;
+        /* counter id of the subscriber position of the slowest blocking spy at the last scan */
+        int64_t limiting_spy_counter_id;
+        /* producer position when the stream rate was last sampled, -1 until the first sample */
+        int64_t rate_sample_position;
+        /* producer position when the publication was last flagged in the stream activity ring */
+        int64_t activity_position;
         int32_t refcnt;
         bool has_reached_end_of_life;
+        bool has_spies;
+        bool is_end_of_stream;
+        bool is_stalled;
         aeron_network_publication_status_t status;
     }
     conductor_fields;
@@ -61,41 +93,84 @@ typedef struct aeron_network_publication_stct
     uint8_t conductor_fields_pad[
         (4 * AERON_CACHE_LINE_LENGTH) - sizeof(struct aeron_network_publication_conductor_fields_stct)];
 
+    /* written by the sender on the data path, the conductor only reads the flags */
+    struct aeron_network_publication_sender_fields_stct
+    {
+        int64_t time_of_last_send_or_heartbeat_ns;
+        int64_t time_of_last_setup_ns;
+        int64_t status_message_deadline_ns;
+        /* until which, with no new data and the same sender limit, a publication that last sent nothing stays idle */
+        int64_t idle_deadline_ns;
+        int64_t idle_snd_lmt;
+        /* until which frames at the coalesce position that fill less than a batch are held back for more */
+        int64_t coalesce_deadline_ns;
+        int64_t coalesce_position;
+        /* receiver window of the last status message, which the sender polls for sooner as it runs out */
+        int32_t receiver_window_length;
+        /* longest datagram frames are coalesced into, the MTU until path MTU discovery confirms more */
+        size_t datagram_length;
+        /* bytes the sender lets the next send call send, set by the sender when it schedules by weight */
+        int32_t send_quota;
+        bool should_send_setup_frame;
+        bool has_receivers;
+        bool is_connected;
+        bool has_sender_released;
+        bool track_sender_limits;
+        bool gso_enabled;
+        aeron_retransmit_handler_t retransmit_handler;
+        aeron_send_pacer_t pacer;
+        aeron_fec_encoder_t fec_encoder;
+        aeron_pmtu_discovery_t pmtu_discovery;
+    }
+    sender_fields;
+
+    uint8_t sender_fields_pad[
+        (2 * AERON_CACHE_LINE_LENGTH) -
+        (sizeof(struct aeron_network_publication_sender_fields_stct) % AERON_CACHE_LINE_LENGTH)];
+
+    /* set when created and only read after */
     aeron_mapped_raw_log_t mapped_raw_log;
     aeron_position_t pub_lmt_position;
     aeron_position_t snd_pos_position;
     aeron_position_t snd_lmt_position;
-    aeron_retransmit_handler_t retransmit_handler;
+    aeron_stream_stats_t stats;
+    uint8_t *fec_frame;
+    uint8_t *pmtu_probe;
     aeron_logbuffer_metadata_t *log_meta_data;
     aeron_send_channel_endpoint_t *endpoint;
     aeron_flow_control_strategy_t *flow_control;
+    /* NULL unless limit changes are traced */
+    aeron_flow_control_trace_t *flow_control_trace;
     aeron_clock_func_t nano_clock;
 
     char *log_file_name;
     int64_t term_window_length;
+    int64_t term_clean_chunk_length;
     int64_t trip_gain;
     int64_t linger_timeout_ns;
+    int64_t resume_timeout_ns;
+    /* set by the conductor when the channel has a resume-token */
+    int64_t resume_token;
     int64_t unblock_timeout_ns;
+    int64_t unblock_timeout_min_ns;
     int64_t connection_timeout_ns;
-    int64_t time_of_last_send_or_heartbeat_ns;
-    int64_t time_of_last_setup_ns;
-    int64_t status_message_deadline_ns;
     int32_t session_id;
     int32_t stream_id;
     int32_t initial_term_id;
     int32_t term_length_mask;
+    int32_t send_priority;
+    int32_t send_weight;
     size_t log_file_name_length;
     size_t position_bits_to_shift;
+    size_t file_page_size;
     size_t mtu_length;
     bool is_exclusive;
+    bool is_resumable;
+    bool release_cleaned_pages;
     bool spies_simulate_connection;
-    bool should_send_setup_frame;
-    bool has_receivers;
-    bool has_spies;
-    bool is_connected;
-    bool is_end_of_stream;
-    bool track_sender_limits;
-    bool has_sender_released;
+    bool pacing_enabled;
+    bool fec_enabled;
+    bool pmtu_discovery_enabled;
     aeron_map_raw_log_close_func_t map_raw_log_close_func;
 
     int64_t *short_sends_counter;
@@ -103,6 +178,11 @@ typedef struct aeron_network_publication_stct
     int64_t *sender_flow_control_limits_counter;
     int64_t *retransmits_sent_counter;
     int64_t *unblocked_publications_counter;
+    int64_t *fec_frames_sent_counter;
+    int64_t *log_buffer_released_bytes_counter;
+
+    /* holds this struct, the log file name and the FEC frame, freed last on close */
+    aeron_arena_t arena;
 }
 aeron_network_publication_t;
 
@@ -120,6 +200,7 @@ int aeron_network_publication_create(
     aeron_position_t *snd_lmt_position,
     aeron_flow_control_strategy_t *flow_control_strategy,
     size_t term_buffer_length,
+    size_t fec_group_size,
     bool is_exclusive,
     bool spies_simulate_connection,
     aeron_system_counters_t *system_counters);
@@ -128,6 +209,11 @@ void aeron_network_publication_close(aeron_counters_manager_t *counters_manager,
 
 void aeron_network_publication_incref(void *clientd);
 void aeron_network_publication_decref(void *clientd);
+
+/*
+ * Take a publication held as resumable back to active for a publisher that added it again with its resume token.
+ */
+void aeron_network_publication_resume(aeron_network_publication_t *publication);
 void aeron_network_publication_on_time_event(
     aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication, int64_t now_ns, int64_t now_ms);
 
@@ -145,32 +231,65 @@ void aeron_network_publication_on_status_message(
 void aeron_network_publication_on_rttm(
     aeron_network_publication_t *publication, const uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
 
-void aeron_network_publication_clean_buffer(aeron_network_publication_t *publication, int64_t pub_lmt);
+int aeron_network_publication_clean_buffer(aeron_network_publication_t *publication, int64_t pub_lmt);
+
+int aeron_network_publication_add_non_blocking_spy(aeron_network_publication_t *publication, int64_t *value_addr);
 
 int aeron_network_publication_update_pub_lmt(aeron_network_publication_t *publication);
 
 void aeron_network_publication_check_for_blocked_publisher(
     aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos);
 
+/*
+ * A client that had the publication timed out, so it may have died mid claim. Unblock the log now if it is held up and
+ * has been since the last check, otherwise as soon as it is seen held up until the unblock timeout has passed.
+ */
+void aeron_network_publication_on_client_timeout(aeron_network_publication_t *publication, int64_t now_ns);
+
 inline void aeron_network_publication_add_subscriber_hook(void *clientd, int64_t *value_addr)
 {
     aeron_network_publication_t *publication = (aeron_network_publication_t *)clientd;
 
-    AERON_PUT_ORDERED(publication->has_spies, true);
+    AERON_PUT_ORDERED(publication->conductor_fields.has_spies, true);
     if (publication->spies_simulate_connection)
     {
         AERON_PUT_ORDERED(publication->log_meta_data->is_connected, 1);
-        AERON_PUT_ORDERED(publication->is_connected, true);
+        AERON_PUT_ORDERED(publication->sender_fields.is_connected, true);
+    }
+}
+
+inline bool aeron_network_publication_is_non_blocking_spy(
+    aeron_network_publication_t *publication, int64_t *value_addr)
+{
+    for (size_t i = 0, length = publication->conductor_fields.non_blocking_spy_positions.length; i < length; i++)
+    {
+        if (value_addr == publication->conductor_fields.non_blocking_spy_positions.array[i])
+        {
+            return true;
+        }
     }
+
+    return false;
 }
 
 inline void aeron_network_publication_remove_subscriber_hook(void *clientd, int64_t *value_addr)
 {
     aeron_network_publication_t *publication = (aeron_network_publication_t *)clientd;
 
+    for (size_t i = 0, length = publication->conductor_fields.non_blocking_spy_positions.length; i < length; i++)
+    {
+        if (value_addr == publication->conductor_fields.non_blocking_spy_positions.array[i])
+        {
+            publication->conductor_fields.non_blocking_spy_positions.array[i] =
+                publication->conductor_fields.non_blocking_spy_positions.array[length - 1];
+            publication->conductor_fields.non_blocking_spy_positions.length--;
+            break;
+        }
+    }
+
     if (1 == publication->conductor_fields.subscribable.length)
     {
-        AERON_PUT_ORDERED(publication->has_spies, false);
+        AERON_PUT_ORDERED(publication->conductor_fields.has_spies, false);
     }
 }
 
@@ -222,40 +341,34 @@ inline int64_t aeron_network_publication_consumer_position(aeron_network_publica
 inline void aeron_network_publication_trigger_send_setup_frame(aeron_network_publication_t *publication)
 {
     bool is_end_of_stream;
-    AERON_GET_VOLATILE(is_end_of_stream, publication->is_end_of_stream);
+    AERON_GET_VOLATILE(is_end_of_stream, publication->conductor_fields.is_end_of_stream);
 
     if (!is_end_of_stream)
     {
-        publication->should_send_setup_frame = true;
+        publication->sender_fields.should_send_setup_frame = true;
     }
 }
 
 inline void aeron_network_publication_sender_release(aeron_network_publication_t *publication)
 {
-    AERON_PUT_ORDERED(publication->has_sender_released, true);
+    AERON_PUT_ORDERED(publication->sender_fields.has_sender_released, true);
 }
 
 inline bool aeron_network_publication_has_sender_released(aeron_network_publication_t *publication)
 {
     bool has_sender_released;
-    AERON_GET_VOLATILE(has_sender_released, publication->has_sender_released);
+    AERON_GET_VOLATILE(has_sender_released, publication->sender_fields.has_sender_released);
 
     return has_sender_released;
 }
 
+/* summary of spy positions maintained by the conductor so the sender does not walk the subscribable list */
 inline int64_t aeron_network_publication_max_spy_position(aeron_network_publication_t *publication, int64_t snd_pos)
 {
-    int64_t position = snd_pos;
+    int64_t max_spy_position;
+    AERON_GET_VOLATILE(max_spy_position, publication->conductor_fields.max_spy_position);
 
-    for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
-    {
-        int64_t spy_position =
-            aeron_counter_get_volatile(publication->conductor_fields.subscribable.array[i].value_addr);
-
-        position = (spy_position > position) ? spy_position : position;
-    }
-
-    return position;
+    return max_spy_position > snd_pos ? max_spy_position : snd_pos;
 }
 
 inline size_t aeron_network_publication_num_spy_subscribers(aeron_network_publication_t *publication)
@@ -263,4 +376,9 @@ inline size_t aeron_network_publication_num_spy_subscribers(aeron_network_public
     return publication->conductor_fields.subscribable.length;
 }
 
+inline size_t aeron_network_publication_num_non_blocking_spy_subscribers(aeron_network_publication_t *publication)
+{
+    return publication->conductor_fields.non_blocking_spy_positions.length;
+}
+
 #endif //AERON_AERON_NETWORK_PUBLICATION_H
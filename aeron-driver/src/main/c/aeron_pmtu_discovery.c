@@ -0,0 +1,103 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <string.h>
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "aeron_pmtu_discovery.h"
+
+void aeron_pmtu_discovery_init(aeron_pmtu_discovery_t *discovery, size_t mtu_length, size_t max_length)
+{
+    memset(discovery, 0, sizeof(aeron_pmtu_discovery_t));
+    discovery->max_length = max_length & ~((size_t)AERON_LOGBUFFER_FRAME_ALIGNMENT - 1);
+    discovery->confirmed_length = mtu_length;
+    discovery->failed_length = discovery->max_length > mtu_length ?
+        discovery->max_length + AERON_LOGBUFFER_FRAME_ALIGNMENT : mtu_length;
+}
+
+static void aeron_pmtu_discovery_fail_probe(aeron_pmtu_discovery_t *discovery)
+{
+    discovery->failed_length = discovery->probe_length;
+    discovery->probe_attempts = 0;
+    discovery->is_probe_in_flight = false;
+}
+
+size_t aeron_pmtu_discovery_next_probe(aeron_pmtu_discovery_t *discovery, int64_t now_ns)
+{
+    if (discovery->is_probe_in_flight)
+    {
+        if (now_ns < discovery->probe_deadline_ns)
+        {
+            return 0;
+        }
+
+        if (discovery->probe_attempts >= AERON_PMTU_DISCOVERY_PROBE_ATTEMPTS)
+        {
+            aeron_pmtu_discovery_fail_probe(discovery);
+        }
+    }
+
+    if (aeron_pmtu_discovery_is_complete(discovery))
+    {
+        return 0;
+    }
+
+    if (!discovery->is_probe_in_flight)
+    {
+        if (discovery->failed_length > discovery->max_length)
+        {
+            discovery->probe_length = discovery->max_length;
+        }
+        else
+        {
+            discovery->probe_length = ((discovery->confirmed_length + discovery->failed_length) / 2) &
+                ~((size_t)AERON_LOGBUFFER_FRAME_ALIGNMENT - 1);
+        }
+
+        discovery->is_probe_in_flight = true;
+    }
+
+    discovery->probe_attempts++;
+    discovery->probe_timestamp_ns = now_ns;
+    discovery->probe_deadline_ns = now_ns + AERON_PMTU_DISCOVERY_PROBE_TIMEOUT_NS;
+
+    return discovery->probe_length;
+}
+
+void aeron_pmtu_discovery_on_send_failure(aeron_pmtu_discovery_t *discovery)
+{
+    if (discovery->is_probe_in_flight)
+    {
+        aeron_pmtu_discovery_fail_probe(discovery);
+    }
+}
+
+bool aeron_pmtu_discovery_on_echo(aeron_pmtu_discovery_t *discovery, int64_t echo_timestamp_ns)
+{
+    if (!discovery->is_probe_in_flight || echo_timestamp_ns != discovery->probe_timestamp_ns)
+    {
+        return false;
+    }
+
+    discovery->confirmed_length = discovery->probe_length;
+    discovery->probe_attempts = 0;
+    discovery->is_probe_in_flight = false;
+
+    return true;
+}
+
+extern bool aeron_pmtu_discovery_is_complete(aeron_pmtu_discovery_t *discovery);
+extern size_t aeron_pmtu_discovery_confirmed_length(aeron_pmtu_discovery_t *discovery);
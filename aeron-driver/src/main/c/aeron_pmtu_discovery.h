@@ -0,0 +1,79 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_AERON_PMTU_DISCOVERY_H
+#define AERON_AERON_PMTU_DISCOVERY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define AERON_PMTU_DISCOVERY_PROBE_TIMEOUT_NS (100 * 1000 * 1000L)
+#define AERON_PMTU_DISCOVERY_PROBE_ATTEMPTS (3)
+#define AERON_PMTU_DISCOVERY_RESOLUTION (256)
+
+/*
+ * Search for the largest datagram that reaches the receivers of a publication, from the MTU of its frames up to a
+ * configured maximum. Each probe is sent with fragmentation disallowed and confirmed when echoed. A probe that is not
+ * echoed after a few attempts, or that fails to send, bounds the search from above, so the search is a bisection that
+ * starts with the maximum, as jumbo frames either work end to end or are commonly not there at all.
+ */
+typedef struct aeron_pmtu_discovery_stct
+{
+    int64_t probe_timestamp_ns;
+    int64_t probe_deadline_ns;
+    size_t confirmed_length;
+    size_t failed_length;
+    size_t max_length;
+    size_t probe_length;
+    int probe_attempts;
+    bool is_probe_in_flight;
+}
+aeron_pmtu_discovery_t;
+
+void aeron_pmtu_discovery_init(aeron_pmtu_discovery_t *discovery, size_t mtu_length, size_t max_length);
+
+/*
+ * Length of the probe to send now, timestamped with now_ns for the echo to be matched against, or 0 when there is
+ * nothing to send.
+ */
+size_t aeron_pmtu_discovery_next_probe(aeron_pmtu_discovery_t *discovery, int64_t now_ns);
+
+/*
+ * The probe in flight could not be sent, e.g. as it is larger than the MTU of the local interface.
+ */
+void aeron_pmtu_discovery_on_send_failure(aeron_pmtu_discovery_t *discovery);
+
+/*
+ * Returns true if echo_timestamp_ns confirms the probe in flight, which raises the confirmed length.
+ */
+bool aeron_pmtu_discovery_on_echo(aeron_pmtu_discovery_t *discovery, int64_t echo_timestamp_ns);
+
+inline bool aeron_pmtu_discovery_is_complete(aeron_pmtu_discovery_t *discovery)
+{
+    return (discovery->failed_length - discovery->confirmed_length) <= AERON_PMTU_DISCOVERY_RESOLUTION;
+}
+
+/*
+ * Largest datagram known to reach the receivers.
+ */
+inline size_t aeron_pmtu_discovery_confirmed_length(aeron_pmtu_discovery_t *discovery)
+{
+    return discovery->confirmed_length;
+}
+
+#endif //AERON_AERON_PMTU_DISCOVERY_H
@@ -39,6 +39,12 @@ typedef struct aeron_channel_endpoint_status_key_layout_stct
     char channel[sizeof(((aeron_counter_metadata_descriptor_t *)0)->key)];
 }
 aeron_channel_endpoint_status_key_layout_t;
+
+typedef struct aeron_heartbeat_timestamp_key_layout_stct
+{
+    int64_t registration_id;
+}
+aeron_heartbeat_timestamp_key_layout_t;
 #pragma pack(pop)
 
 int32_t aeron_stream_position_counter_allocate(
@@ -88,6 +94,24 @@ int32_t aeron_counter_publisher_limit_allocate(
         "");
 }
 
+int32_t aeron_counter_publisher_durable_position_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel)
+{
+    return aeron_stream_position_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_PUBLISHER_DURABLE_POSITION_NAME,
+        AERON_COUNTER_PUBLISHER_DURABLE_POSITION_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel,
+        "");
+}
+
 int32_t aeron_counter_subscription_position_allocate(
     aeron_counters_manager_t *counters_manager,
     int64_t registration_id,
@@ -183,6 +207,169 @@ int32_t aeron_counter_receiver_position_allocate(
         "");
 }
 
+int32_t aeron_counter_receiver_wire_latency_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel)
+{
+    return aeron_stream_position_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_RECEIVER_WIRE_LATENCY_NAME,
+        AERON_COUNTER_RECEIVER_WIRE_LATENCY_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel,
+        "");
+}
+
+int32_t aeron_counter_receiver_driver_latency_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel)
+{
+    return aeron_stream_position_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_RECEIVER_DRIVER_LATENCY_NAME,
+        AERON_COUNTER_RECEIVER_DRIVER_LATENCY_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel,
+        "");
+}
+
+void aeron_stream_stats_init(aeron_stream_stats_t *stats)
+{
+    stats->bytes_rate.counter_id = -1;
+    stats->bytes_rate.value_addr = NULL;
+    stats->depth.counter_id = -1;
+    stats->depth.value_addr = NULL;
+    stats->rtt.counter_id = -1;
+    stats->rtt.value_addr = NULL;
+    stats->sample_position = -1;
+    stats->sample_time_ns = 0;
+}
+
+static int aeron_stream_stats_position_allocate(
+    aeron_position_t *position,
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t type_id,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel)
+{
+    position->counter_id = aeron_stream_position_counter_allocate(
+        counters_manager, name, type_id, registration_id, session_id, stream_id, channel, "");
+
+    if (position->counter_id < 0)
+    {
+        return -1;
+    }
+
+    position->value_addr = aeron_counter_addr(counters_manager, (int32_t)position->counter_id);
+
+    return 0;
+}
+
+int aeron_stream_stats_allocate(
+    aeron_stream_stats_t *stats,
+    aeron_counters_manager_t *counters_manager,
+    bool is_image,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel)
+{
+    aeron_stream_stats_init(stats);
+
+    if (aeron_stream_stats_position_allocate(
+        &stats->bytes_rate,
+        counters_manager,
+        is_image ? AERON_COUNTER_RECEIVER_BYTES_RATE_NAME : AERON_COUNTER_SENDER_BYTES_RATE_NAME,
+        is_image ? AERON_COUNTER_RECEIVER_BYTES_RATE_TYPE_ID : AERON_COUNTER_SENDER_BYTES_RATE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel) < 0 ||
+        aeron_stream_stats_position_allocate(
+        &stats->depth,
+        counters_manager,
+        is_image ? AERON_COUNTER_RECEIVER_LAG_NAME : AERON_COUNTER_SENDER_QUEUE_NAME,
+        is_image ? AERON_COUNTER_RECEIVER_LAG_TYPE_ID : AERON_COUNTER_SENDER_QUEUE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel) < 0 ||
+        (is_image && aeron_stream_stats_position_allocate(
+        &stats->rtt,
+        counters_manager,
+        AERON_COUNTER_RECEIVER_RTT_NAME,
+        AERON_COUNTER_RECEIVER_RTT_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel) < 0))
+    {
+        aeron_stream_stats_free(stats, counters_manager);
+        return -1;
+    }
+
+    if (is_image)
+    {
+        aeron_counter_set_ordered(stats->rtt.value_addr, -1);
+    }
+
+    return 0;
+}
+
+void aeron_stream_stats_free(aeron_stream_stats_t *stats, aeron_counters_manager_t *counters_manager)
+{
+    if (stats->bytes_rate.counter_id >= 0)
+    {
+        aeron_counters_manager_free(counters_manager, (int32_t)stats->bytes_rate.counter_id);
+    }
+
+    if (stats->depth.counter_id >= 0)
+    {
+        aeron_counters_manager_free(counters_manager, (int32_t)stats->depth.counter_id);
+    }
+
+    if (stats->rtt.counter_id >= 0)
+    {
+        aeron_counters_manager_free(counters_manager, (int32_t)stats->rtt.counter_id);
+    }
+
+    aeron_stream_stats_init(stats);
+}
+
+void aeron_stream_stats_sample(aeron_stream_stats_t *stats, int64_t position, int64_t depth, int64_t now_ns)
+{
+    if (stats->bytes_rate.counter_id < 0)
+    {
+        return;
+    }
+
+    const int64_t elapsed_ns = now_ns - stats->sample_time_ns;
+
+    if (stats->sample_position >= 0 && elapsed_ns > 0)
+    {
+        /* in double as bytes by ns per second overflows an int64_t beyond a few GB between samples */
+        const double bytes_rate = (double)(position - stats->sample_position) * 1000000000.0 / (double)elapsed_ns;
+        aeron_counter_set_ordered(stats->bytes_rate.value_addr, (int64_t)bytes_rate);
+    }
+
+    aeron_counter_set_ordered(stats->depth.value_addr, depth > 0 ? depth : 0);
+    stats->sample_position = position;
+    stats->sample_time_ns = now_ns;
+}
+
 int32_t aeron_channel_endpoint_status_allocate(
     aeron_counters_manager_t *counters_manager,
     const char *name,
@@ -223,3 +410,35 @@ int32_t aeron_counter_receive_channel_status_allocate(
         AERON_COUNTER_RECEIVE_CHANNEL_STATUS_TYPE_ID,
         channel);
 }
+
+int32_t aeron_counter_receive_socket_drops_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *channel)
+{
+    return aeron_channel_endpoint_status_allocate(
+        counters_manager,
+        AERON_COUNTER_RECEIVE_SOCKET_DROPS_NAME,
+        AERON_COUNTER_RECEIVE_SOCKET_DROPS_TYPE_ID,
+        channel);
+}
+
+int32_t aeron_counter_client_heartbeat_timestamp_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t client_id)
+{
+    char label[sizeof(((aeron_counter_metadata_descriptor_t *)0)->label)];
+    int label_length = snprintf(
+        label, sizeof(label), "%s: %" PRId64, AERON_COUNTER_CLIENT_HEARTBEAT_TIMESTAMP_NAME, client_id);
+    aeron_heartbeat_timestamp_key_layout_t layout =
+        {
+            .registration_id = client_id
+        };
+
+    return aeron_counters_manager_allocate(
+        counters_manager,
+        AERON_COUNTER_CLIENT_HEARTBEAT_TIMESTAMP_TYPE_ID,
+        (const uint8_t *)&layout,
+        sizeof(layout),
+        label,
+        (size_t)label_length);
+}
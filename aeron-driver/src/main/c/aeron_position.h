@@ -18,6 +18,7 @@
 #define AERON_AERON_POSITION_H
 
 #include "concurrent/aeron_counters_manager.h"
+#include "aeron_driver_common.h"
 
 int32_t aeron_stream_position_counter_allocate(
     aeron_counters_manager_t *counters_manager,
@@ -65,6 +66,20 @@ int32_t aeron_counter_sender_limit_allocate(
     int32_t stream_id,
     const char *channel);
 
+#define AERON_COUNTER_PUBLISHER_DURABLE_POSITION_NAME "pub-dur"
+#define AERON_COUNTER_PUBLISHER_DURABLE_POSITION_TYPE_ID (25)
+
+/*
+ * Position up to which the log of a durable publication has been synced to storage, for consumers that must not act
+ * on a message before it would survive a crash.
+ */
+int32_t aeron_counter_publisher_durable_position_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel);
+
 #define AERON_COUNTER_SUBSCRIPTION_POSITION_NAME "sub-pos"
 #define AERON_COUNTER_SUBSCRIPTION_POSITION_TYPE_ID (4)
 
@@ -96,6 +111,76 @@ int32_t aeron_counter_receiver_position_allocate(
     int32_t stream_id,
     const char *channel);
 
+#define AERON_COUNTER_RECEIVER_WIRE_LATENCY_NAME "rcv-wire-lat"
+#define AERON_COUNTER_RECEIVER_WIRE_LATENCY_TYPE_ID (11)
+
+#define AERON_COUNTER_RECEIVER_DRIVER_LATENCY_NAME "rcv-drv-lat"
+#define AERON_COUNTER_RECEIVER_DRIVER_LATENCY_TYPE_ID (12)
+
+/*
+ * Smoothed latency in nanoseconds from the socket receive timestamp to the receiver handling the packet (wire) and
+ * from there to the packet being in the log (driver). Only allocated when receive timestamping is enabled.
+ */
+int32_t aeron_counter_receiver_wire_latency_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel);
+
+int32_t aeron_counter_receiver_driver_latency_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel);
+
+#define AERON_COUNTER_SENDER_BYTES_RATE_NAME "snd-bps"
+#define AERON_COUNTER_SENDER_BYTES_RATE_TYPE_ID (20)
+
+#define AERON_COUNTER_SENDER_QUEUE_NAME "snd-queue"
+#define AERON_COUNTER_SENDER_QUEUE_TYPE_ID (21)
+
+#define AERON_COUNTER_RECEIVER_BYTES_RATE_NAME "rcv-bps"
+#define AERON_COUNTER_RECEIVER_BYTES_RATE_TYPE_ID (22)
+
+#define AERON_COUNTER_RECEIVER_LAG_NAME "rcv-lag"
+#define AERON_COUNTER_RECEIVER_LAG_TYPE_ID (23)
+
+#define AERON_COUNTER_RECEIVER_RTT_NAME "rcv-rtt"
+#define AERON_COUNTER_RECEIVER_RTT_TYPE_ID (24)
+
+/*
+ * Counters of a network publication or image kept when stream stats are enabled. The bytes per second and the depth,
+ * bytes the sender has yet to send for a publication and bytes the slowest subscriber is behind the high water mark
+ * for an image, are sampled by the conductor and the round trip time in ns of an image is set by the receiver. The
+ * counter ids are -1 when stats are not kept and rtt is -1 for a publication.
+ */
+typedef struct aeron_stream_stats_stct
+{
+    aeron_position_t bytes_rate;
+    aeron_position_t depth;
+    aeron_position_t rtt;
+    int64_t sample_position;
+    int64_t sample_time_ns;
+}
+aeron_stream_stats_t;
+
+void aeron_stream_stats_init(aeron_stream_stats_t *stats);
+
+int aeron_stream_stats_allocate(
+    aeron_stream_stats_t *stats,
+    aeron_counters_manager_t *counters_manager,
+    bool is_image,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel);
+
+void aeron_stream_stats_free(aeron_stream_stats_t *stats, aeron_counters_manager_t *counters_manager);
+
+void aeron_stream_stats_sample(aeron_stream_stats_t *stats, int64_t position, int64_t depth, int64_t now_ns);
+
 #define AERON_COUNTER_SEND_CHANNEL_STATUS_NAME "snd-channel"
 #define AERON_COUNTER_SEND_CHANNEL_STATUS_TYPE_ID (6)
 
@@ -115,4 +200,26 @@ int32_t aeron_counter_receive_channel_status_allocate(
     aeron_counters_manager_t *counters_manager,
     const char *channel);
 
+#define AERON_COUNTER_RECEIVE_SOCKET_DROPS_NAME "rcv-socket-drops"
+#define AERON_COUNTER_RECEIVE_SOCKET_DROPS_TYPE_ID (19)
+
+/*
+ * Datagrams the kernel dropped for a full receive buffer on the socket of a receive channel endpoint. Only allocated
+ * when drop monitoring is enabled.
+ */
+int32_t aeron_counter_receive_socket_drops_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *channel);
+
+#define AERON_COUNTER_CLIENT_HEARTBEAT_TIMESTAMP_NAME "client-heartbeat"
+#define AERON_COUNTER_CLIENT_HEARTBEAT_TIMESTAMP_TYPE_ID (13)
+
+/*
+ * Epoch time in ms of the last heartbeat from a client, keyed by the client id. Clients that find their counter store
+ * to it instead of sending keepalive commands and the conductor reads it when the client liveness timer expires.
+ */
+int32_t aeron_counter_client_heartbeat_timestamp_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t client_id);
+
 #endif //AERON_AERON_POSITION_H
@@ -14,13 +14,17 @@
  * limitations under the License.
  */
 
+#include <time.h>
 #include "util/aeron_netutil.h"
 #include "concurrent/aeron_term_rebuilder.h"
 #include "util/aeron_error.h"
+#include "util/aeron_probes.h"
 #include "aeron_publication_image.h"
 #include "aeron_driver_receiver_proxy.h"
 #include "aeron_driver_conductor.h"
+#include "aeron_raw_log_pool.h"
 #include "concurrent/aeron_term_gap_filler.h"
+#include "aeron_fec.h"
 
 int aeron_publication_image_create(
     aeron_publication_image_t **image,
@@ -34,6 +38,8 @@ int aeron_publication_image_create(
     int32_t initial_term_offset,
     aeron_position_t *rcv_hwm_position,
     aeron_position_t *rcv_pos_position,
+    aeron_position_t *rcv_wire_latency_position,
+    aeron_position_t *rcv_driver_latency_position,
     aeron_congestion_control_strategy_t *congestion_control,
     struct sockaddr_storage *control_address,
     struct sockaddr_storage *source_address,
@@ -67,40 +73,52 @@ int aeron_publication_image_create(
         return -1;
     }
 
-    if (aeron_alloc((void **)&_image, sizeof(aeron_publication_image_t)) < 0)
+    aeron_arena_t arena;
+
+    if (aeron_arena_init(
+        &arena,
+        aeron_arena_length(sizeof(aeron_publication_image_t)) + aeron_arena_length((size_t)path_length + 1)) < 0)
     {
         aeron_set_err(ENOMEM, "%s", "Could not allocate publication image");
         return -1;
     }
 
-    _image->log_file_name = NULL;
-    if (aeron_alloc((void **)(&_image->log_file_name), (size_t)path_length + 1) < 0)
-    {
-        aeron_free(_image);
-        aeron_set_err(ENOMEM, "%s", "Could not allocate publication image log_file_name");
-        return -1;
-    }
+    _image = aeron_arena_allocate(&arena, sizeof(aeron_publication_image_t));
+    _image->log_file_name = aeron_arena_allocate(&arena, (size_t)path_length + 1);
+    _image->arena = arena;
 
     if (aeron_loss_detector_init(
-        &_image->loss_detector,
+        &_image->conductor_fields.loss_detector,
         is_multicast ? false : true,
         is_multicast ? aeron_loss_detector_nak_multicast_delay_generator : aeron_loss_detector_nak_unicast_delay_generator,
         aeron_publication_image_on_gap_detected, _image) < 0)
     {
-        aeron_free(_image);
+        aeron_arena_close(&arena);
         aeron_set_err(ENOMEM, "%s", "Could not init publication image loss detector");
         return -1;
     }
 
-    if (context->map_raw_log_func(
+    aeron_loss_detector_reorder_window(
+        &_image->conductor_fields.loss_detector, (int64_t)context->rcv_reorder_window_max_ns);
+
+    if (!is_reliable)
+    {
+        aeron_loss_detector_fixed_delay(
+            &_image->conductor_fields.loss_detector, (int64_t)context->rcv_gap_fill_delay_ns);
+    }
+
+    if (aeron_raw_log_pool_map_raw_log(
+        context->raw_log_pool,
+        context->map_raw_log_func,
         &_image->mapped_raw_log,
         path,
         context->term_buffer_sparse_file,
         (uint64_t)term_buffer_length,
-        context->file_page_size) < 0)
+        context->file_page_size,
+        context->term_buffer_prefault,
+        context->term_buffer_lock) < 0)
     {
-        aeron_free(_image->log_file_name);
-        aeron_free(_image);
+        aeron_arena_close(&arena);
         aeron_set_err(aeron_errcode(), "error mapping network raw log %s: %s", path, aeron_errmsg());
         return -1;
     }
@@ -133,11 +151,15 @@ int aeron_publication_image_create(
     _image->conductor_fields.subscribable.add_position_hook_func = aeron_driver_subscribable_null_hook;
     _image->conductor_fields.subscribable.remove_position_hook_func = aeron_driver_subscribable_null_hook;
     _image->conductor_fields.subscribable.clientd = NULL;
+    _image->conductor_fields.subscribable.min_position_addr = NULL;
+    _image->conductor_fields.subscribable.min_position = 0;
     _image->conductor_fields.managed_resource.registration_id = correlation_id;
     _image->conductor_fields.managed_resource.clientd = _image;
     _image->conductor_fields.managed_resource.incref = NULL;
     _image->conductor_fields.managed_resource.decref = NULL;
     _image->conductor_fields.is_reliable = is_reliable;
+    _image->conductor_fields.last_peer_nak_count = 0;
+    _image->peer_naks.count = 0;
     _image->conductor_fields.status = AERON_PUBLICATION_IMAGE_STATUS_ACTIVE;
     _image->conductor_fields.liveness_timeout_ns = context->image_liveness_timeout_ns;
     _image->session_id = session_id;
@@ -146,13 +168,25 @@ int aeron_publication_image_create(
     _image->rcv_hwm_position.value_addr = rcv_hwm_position->value_addr;
     _image->rcv_pos_position.counter_id = rcv_pos_position->counter_id;
     _image->rcv_pos_position.value_addr = rcv_pos_position->value_addr;
+    _image->rcv_wire_latency_position.counter_id = rcv_wire_latency_position->counter_id;
+    _image->rcv_wire_latency_position.value_addr = rcv_wire_latency_position->value_addr;
+    _image->rcv_driver_latency_position.counter_id = rcv_driver_latency_position->counter_id;
+    _image->rcv_driver_latency_position.value_addr = rcv_driver_latency_position->value_addr;
+    aeron_stream_stats_init(&_image->stats);
     _image->initial_term_id = initial_term_id;
     _image->term_length_mask = (int32_t)term_buffer_length - 1;
     _image->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)term_buffer_length);
     _image->mtu_length = sender_mtu_length;
-    _image->last_sm_change_number = -1;
-    _image->last_loss_change_number = -1;
-    _image->is_end_of_stream = false;
+    _image->non_temporal_copy_threshold = context->rcv_non_temporal_copy_threshold;
+    _image->receive_timestamp = endpoint->receive_timestamp;
+    _image->term_clean_chunk_length = (int64_t)context->term_buffer_clean_chunk_length;
+    _image->file_page_size = context->file_page_size;
+    _image->release_cleaned_pages = context->term_buffer_sparse_file || context->term_buffer_release_pages;
+    _image->adaptive_status_messages = context->status_message_adaptive;
+    _image->receiver_fields.last_sm_change_number = -1;
+    _image->receiver_fields.last_loss_change_number = -1;
+    _image->receiver_fields.is_end_of_stream = false;
+    _image->receiver_fields.last_sm_limit = 0;
 
     memcpy(&_image->control_address, control_address, sizeof(_image->control_address));
     memcpy(&_image->source_address, source_address, sizeof(_image->source_address));
@@ -169,25 +203,34 @@ int aeron_publication_image_create(
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_NAK_MESSAGES_SENT);
     _image->loss_gap_fills_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS);
+    _image->fec_repairs_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_FEC_REPAIRS);
+    _image->invalid_packets_counter =
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS);
+    _image->log_buffer_released_bytes_counter =
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_LOG_BUFFER_RELEASED_BYTES);
+    _image->duplicate_frames_received_counter =
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_DUPLICATE_FRAMES_RECEIVED);
 
     const int64_t initial_position =
         aeron_logbuffer_compute_position(
             active_term_id, initial_term_offset, _image->position_bits_to_shift, initial_term_id);
 
-    _image->begin_loss_change = -1;
-    _image->end_loss_change = -1;
-    _image->loss_term_id = active_term_id;
-    _image->loss_term_offset = initial_term_offset;
-    _image->loss_length = 0;
+    _image->conductor_fields.begin_loss_change = -1;
+    _image->conductor_fields.end_loss_change = -1;
+    _image->conductor_fields.loss_gaps_length = 0;
+    _image->conductor_fields.pending_loss_gaps_length = 0;
 
-    _image->begin_sm_change = -1;
-    _image->end_sm_change = -1;
-    _image->next_sm_position = initial_position;
-    _image->next_sm_receiver_window_length =
+    _image->conductor_fields.begin_sm_change = -1;
+    _image->conductor_fields.end_sm_change = -1;
+    _image->conductor_fields.next_sm_position = initial_position;
+    _image->conductor_fields.next_sm_receiver_window_length =
         _image->congestion_control->initial_window_length(_image->congestion_control->state);
-    _image->last_packet_timestamp_ns = now_ns;
-    _image->last_status_mesage_timestamp = 0;
+    _image->receiver_fields.last_packet_timestamp_ns = now_ns;
+    _image->conductor_fields.last_status_mesage_timestamp = 0;
+    _image->conductor_fields.last_sm_hwm_position = initial_position;
+    _image->conductor_fields.sm_idle_backoff_shift = 0;
     _image->conductor_fields.clean_position = initial_position;
+    _image->conductor_fields.activity_position = initial_position;
     _image->conductor_fields.time_of_last_status_change_ns = now_ns;
 
     aeron_counter_set_ordered(_image->rcv_hwm_position.value_addr, initial_position);
@@ -206,6 +249,14 @@ int aeron_publication_image_close(aeron_counters_manager_t *counters_manager, ae
         aeron_counters_manager_free(counters_manager, (int32_t)image->rcv_hwm_position.counter_id);
         aeron_counters_manager_free(counters_manager, (int32_t)image->rcv_pos_position.counter_id);
 
+        if (image->rcv_wire_latency_position.counter_id >= 0)
+        {
+            aeron_counters_manager_free(counters_manager, (int32_t)image->rcv_wire_latency_position.counter_id);
+            aeron_counters_manager_free(counters_manager, (int32_t)image->rcv_driver_latency_position.counter_id);
+        }
+
+        aeron_stream_stats_free(&image->stats, counters_manager);
+
         for (size_t i = 0, length = subscribable->length; i < length; i++)
         {
             aeron_counters_manager_free(counters_manager, (int32_t)subscribable->array[i].counter_id);
@@ -215,42 +266,60 @@ int aeron_publication_image_close(aeron_counters_manager_t *counters_manager, ae
 
         image->map_raw_log_close_func(&image->mapped_raw_log);
         image->congestion_control->fini(image->congestion_control);
-        aeron_free(image->log_file_name);
+        aeron_free(image->receiver_fields.fec_buffer);
+        aeron_arena_close(&image->arena);
     }
 
-    aeron_free(image);
     return 0;
 }
 
-void aeron_publication_image_clean_buffer_to(aeron_publication_image_t *image, int64_t new_clean_position)
+int aeron_publication_image_clean_buffer_to(aeron_publication_image_t *image, int64_t new_clean_position)
 {
     const int64_t clean_position = image->conductor_fields.clean_position;
     const int32_t bytes_for_cleaning = (int32_t)(new_clean_position - clean_position);
     const size_t dirty_term_index = aeron_logbuffer_index_by_position(clean_position, image->position_bits_to_shift);
     const int32_t term_offset = (int32_t)(clean_position & image->term_length_mask);
     const int32_t bytes_left_in_term = (int32_t)image->term_length_mask + 1 - term_offset;
-    const int32_t length = bytes_for_cleaning < bytes_left_in_term ? bytes_for_cleaning : bytes_left_in_term;
+    int32_t length = bytes_for_cleaning < bytes_left_in_term ? bytes_for_cleaning : bytes_left_in_term;
+
+    if (image->term_clean_chunk_length > 0 && length > image->term_clean_chunk_length)
+    {
+        length = (int32_t)image->term_clean_chunk_length;
+    }
 
     if (length > 0)
     {
-        memset(image->mapped_raw_log.term_buffers[dirty_term_index].addr + term_offset, 0, length);
+        const size_t released_length = aeron_mapped_buffer_clean(
+            image->mapped_raw_log.term_buffers[dirty_term_index].addr + term_offset,
+            (size_t)length,
+            image->file_page_size,
+            image->release_cleaned_pages);
+        if (released_length > 0)
+        {
+            aeron_counter_add_ordered(image->log_buffer_released_bytes_counter, (int64_t)released_length);
+        }
         image->conductor_fields.clean_position = clean_position + (int64_t)length;
+
+        return 1;
     }
+
+    return 0;
 }
 
 void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
 {
     aeron_publication_image_t *image = (aeron_publication_image_t *)clientd;
 
-    const int64_t change_number = image->begin_loss_change + 1;
+    AERON_PROBE5(image_loss_detected, image->session_id, image->stream_id, term_id, term_offset, length);
 
-    AERON_PUT_ORDERED(image->begin_loss_change, change_number);
-
-    image->loss_term_id = term_id;
-    image->loss_term_offset = term_offset;
-    image->loss_length = length;
+    if (image->conductor_fields.pending_loss_gaps_length < AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS)
+    {
+        aeron_loss_detector_gap_t *gap = &image->conductor_fields.pending_loss_gaps[image->conductor_fields.pending_loss_gaps_length++];
 
-    AERON_PUT_ORDERED(image->end_loss_change, change_number);
+        gap->term_id = term_id;
+        gap->term_offset = term_offset;
+        gap->length = length;
+    }
 
     if (image->loss_reporter_offset >= 0)
     {
@@ -285,7 +354,48 @@ void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int
     }
 }
 
-void aeron_publication_image_track_rebuild(
+/*
+ * Take the NAKs overheard since the last check, skipping any the receiver has overwritten since as it is not held
+ * up for the conductor.
+ */
+static void aeron_publication_image_check_peer_naks(aeron_publication_image_t *image, int64_t now_ns)
+{
+    aeron_loss_detector_gap_t naks[AERON_PUBLICATION_IMAGE_PEER_NAKS_LENGTH];
+    int64_t count;
+
+    AERON_GET_VOLATILE(count, image->peer_naks.count);
+    if (count == image->conductor_fields.last_peer_nak_count)
+    {
+        return;
+    }
+
+    const int64_t oldest = count - AERON_PUBLICATION_IMAGE_PEER_NAKS_LENGTH;
+    const int64_t from = image->conductor_fields.last_peer_nak_count < oldest ?
+        oldest : image->conductor_fields.last_peer_nak_count;
+
+    for (int64_t i = from; i < count; i++)
+    {
+        naks[i - from] = image->peer_naks.naks[i & (AERON_PUBLICATION_IMAGE_PEER_NAKS_LENGTH - 1)];
+    }
+
+    aeron_acquire();
+
+    int64_t latest_count;
+    AERON_GET_VOLATILE(latest_count, image->peer_naks.count);
+    const int64_t valid_from = latest_count - AERON_PUBLICATION_IMAGE_PEER_NAKS_LENGTH;
+
+    for (int64_t i = from < valid_from ? valid_from : from; i < count; i++)
+    {
+        aeron_loss_detector_gap_t *nak = &naks[i - from];
+
+        aeron_loss_detector_on_peer_nak(
+            &image->conductor_fields.loss_detector, nak->term_id, nak->term_offset, nak->length, now_ns);
+    }
+
+    image->conductor_fields.last_peer_nak_count = count;
+}
+
+int aeron_publication_image_track_rebuild(
     aeron_publication_image_t *image, int64_t now_ns, int64_t status_message_timeout)
 {
     int64_t hwm_position = aeron_counter_get_volatile(image->rcv_hwm_position.value_addr);
@@ -303,11 +413,16 @@ void aeron_publication_image_track_rebuild(
     const int64_t rebuild_position =
         *image->rcv_pos_position.value_addr > max_sub_pos ? *image->rcv_pos_position.value_addr : max_sub_pos;
 
+    if (image->conductor_fields.is_reliable)
+    {
+        aeron_publication_image_check_peer_naks(image, now_ns);
+    }
+
     bool loss_found = false;
     const size_t index = aeron_logbuffer_index_by_position(rebuild_position, image->position_bits_to_shift);
     const int32_t rebuild_offset =
         aeron_loss_detector_scan(
-            &image->loss_detector,
+            &image->conductor_fields.loss_detector,
             &loss_found,
             image->mapped_raw_log.term_buffers[index].addr,
             rebuild_position,
@@ -317,6 +432,25 @@ void aeron_publication_image_track_rebuild(
             image->position_bits_to_shift,
             image->initial_term_id);
 
+    if (image->conductor_fields.pending_loss_gaps_length > 0)
+    {
+        const int64_t change_number = image->conductor_fields.begin_loss_change + 1;
+
+        AERON_PUT_ORDERED(image->conductor_fields.begin_loss_change, change_number);
+
+        memcpy(
+            image->conductor_fields.loss_gaps,
+            image->conductor_fields.pending_loss_gaps,
+            image->conductor_fields.pending_loss_gaps_length * sizeof(aeron_loss_detector_gap_t));
+        image->conductor_fields.loss_gaps_length = image->conductor_fields.pending_loss_gaps_length;
+
+        AERON_PUT_ORDERED(image->conductor_fields.end_loss_change, change_number);
+
+        image->conductor_fields.pending_loss_gaps_length = 0;
+
+        aeron_publication_image_signal_pending(image);
+    }
+
     const int32_t rebuild_term_offset = (int32_t)(rebuild_position & image->term_length_mask);
     const int64_t new_rebuild_position = (rebuild_position - rebuild_term_offset) + rebuild_offset;
 
@@ -328,60 +462,242 @@ void aeron_publication_image_track_rebuild(
         &should_force_send_sm,
         now_ns,
         min_sub_pos,
-        image->next_sm_position,
+        image->conductor_fields.next_sm_position,
         hwm_position,
         rebuild_position,
         new_rebuild_position,
         loss_found);
 
-    const int32_t threshold = window_length / 4;
+    int32_t threshold = window_length / 4;
+    int64_t sm_timeout = status_message_timeout;
+    bool is_idle = false;
 
-    if (should_force_send_sm ||
-        (now_ns > (image->last_status_mesage_timestamp + status_message_timeout)) ||
-        (min_sub_pos > (image->next_sm_position + threshold)))
+    if (image->adaptive_status_messages)
     {
-        aeron_publication_image_schedule_status_message(image, now_ns, min_sub_pos, window_length);
-        aeron_publication_image_clean_buffer_to(image, min_sub_pos - (image->term_length_mask + 1));
+        const int64_t window_edge = image->conductor_fields.next_sm_position + image->conductor_fields.next_sm_receiver_window_length;
+
+        if ((window_edge - hwm_position) <= (image->conductor_fields.next_sm_receiver_window_length / 4))
+        {
+            /* the sender is about to stall on the window so hand back consumed space in smaller steps */
+            threshold = window_length / 16;
+        }
+        else if (hwm_position == image->conductor_fields.last_sm_hwm_position && min_sub_pos == image->conductor_fields.next_sm_position)
+        {
+            is_idle = true;
+            sm_timeout = status_message_timeout << image->conductor_fields.sm_idle_backoff_shift;
+        }
     }
+
+    const int64_t term_length = (int64_t)image->term_length_mask + 1;
+    const int work_count = aeron_publication_image_clean_buffer_to(image, min_sub_pos - term_length);
+
+    /* cleaning is done in chunks so only offer a window that stays out of the partition still being cleaned */
+    const int64_t clean_limit =
+        image->conductor_fields.clean_position + ((AERON_LOGBUFFER_PARTITION_COUNT - 1) * term_length);
+    const int32_t sm_window_length =
+        (min_sub_pos + window_length) > clean_limit ? (int32_t)(clean_limit - min_sub_pos) : window_length;
+
+    if (sm_window_length > 0 &&
+        (should_force_send_sm ||
+        (now_ns > (image->conductor_fields.last_status_mesage_timestamp + sm_timeout)) ||
+        (min_sub_pos > (image->conductor_fields.next_sm_position + threshold))))
+    {
+        aeron_publication_image_schedule_status_message(image, now_ns, min_sub_pos, sm_window_length);
+
+        if (!is_idle)
+        {
+            image->conductor_fields.sm_idle_backoff_shift = 0;
+        }
+        else if (image->conductor_fields.sm_idle_backoff_shift < AERON_PUBLICATION_IMAGE_MAX_SM_IDLE_BACKOFF_SHIFT)
+        {
+            image->conductor_fields.sm_idle_backoff_shift++;
+        }
+
+        image->conductor_fields.last_sm_hwm_position = hwm_position;
+    }
+
+    return work_count;
 }
 
-int aeron_publication_image_insert_packet(
-    aeron_publication_image_t *image, int32_t term_id, int32_t term_offset, const uint8_t *buffer, size_t length)
+static int64_t aeron_publication_image_realtime_ns()
 {
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_REALTIME, &ts) < 0)
+    {
+        return 0;
+    }
+
+    return ((int64_t)ts.tv_sec * 1000 * 1000 * 1000) + ts.tv_nsec;
+}
+
+static void aeron_publication_image_smooth_latency(int64_t *addr, int64_t latency_ns)
+{
+    int64_t current = *addr;
+    int64_t smoothed = current + ((latency_ns - current) >> AERON_PUBLICATION_IMAGE_LATENCY_SMOOTHING_SHIFT);
+
+    /* seed with the first sample rather than ramping up from zero */
+    aeron_counter_set_ordered(addr, 0 == current ? latency_ns : smoothed);
+}
+
+/*
+ * Rebuild a frame into the log, leaving the last packet time and hwm to the caller. False when the frame is outside
+ * the flow control window, otherwise true with the position to propose for the hwm, or -1 if it was a duplicate.
+ */
+static bool aeron_publication_image_rebuild_packet(
+    aeron_publication_image_t *image,
+    int32_t term_id,
+    int32_t term_offset,
+    const uint8_t *buffer,
+    size_t length,
+    int64_t recv_timestamp_ns,
+    int64_t *proposed_position)
+{
+    AERON_PROBE5(image_insert_packet, image->session_id, image->stream_id, term_id, term_offset, length);
+
     const bool is_heartbeat = aeron_publication_image_is_heartbeat(buffer, length);
     const int64_t packet_position =
         aeron_logbuffer_compute_position(term_id, term_offset, image->position_bits_to_shift, image->initial_term_id);
-    const int64_t proposed_position = is_heartbeat ? packet_position : packet_position + (int64_t)length;
-    const int64_t window_position = image->next_sm_position;
+    const int64_t window_position = image->conductor_fields.next_sm_position;
 
-    if (!aeron_publication_image_is_flow_control_under_run(image, window_position, packet_position) &&
-        !aeron_publication_image_is_flow_control_over_run(image, window_position, proposed_position))
+    *proposed_position = is_heartbeat ? packet_position : packet_position + (int64_t)length;
+
+    if (aeron_publication_image_is_flow_control_under_run(image, window_position, packet_position) ||
+        aeron_publication_image_is_flow_control_over_run(image, window_position, *proposed_position))
+    {
+        return false;
+    }
+
+    if (is_heartbeat)
     {
-        if (is_heartbeat)
+        if (!image->receiver_fields.is_end_of_stream && aeron_publication_image_is_end_of_stream(buffer, length))
         {
-            if (!image->is_end_of_stream && aeron_publication_image_is_end_of_stream(buffer, length))
-            {
-                AERON_PUT_ORDERED(image->is_end_of_stream, true);
-                AERON_PUT_ORDERED(image->log_meta_data->end_of_stream_position, packet_position);
-            }
+            AERON_PUT_ORDERED(image->receiver_fields.is_end_of_stream, true);
+            AERON_PUT_ORDERED(image->log_meta_data->end_of_stream_position, packet_position);
+        }
+
+        aeron_counter_increment(image->heartbeats_received_counter, 1);
+    }
+    else
+    {
+        const size_t index = aeron_logbuffer_index_by_position(packet_position, image->position_bits_to_shift);
+        uint8_t *term_buffer = image->mapped_raw_log.term_buffers[index].addr;
+
+        /* already rebuilt, e.g. from the copy sent down another path of a multi-path publication */
+        if (0 != ((aeron_frame_header_t *)(term_buffer + term_offset))->frame_length)
+        {
+            aeron_counter_increment(image->duplicate_frames_received_counter, 1);
+            *proposed_position = -1;
 
-            aeron_counter_ordered_increment(image->heartbeats_received_counter, 1);
+            return true;
         }
-        else
+
+        if (NULL == image->rcv_wire_latency_position.value_addr && !image->receive_timestamp)
         {
-            const size_t index = aeron_logbuffer_index_by_position(packet_position, image->position_bits_to_shift);
-            uint8_t *term_buffer = image->mapped_raw_log.term_buffers[index].addr;
+            recv_timestamp_ns = 0;
+        }
+
+        const int64_t dispatch_ns =
+            recv_timestamp_ns > 0 || image->receive_timestamp ? aeron_publication_image_realtime_ns() : 0;
 
+        if (image->receive_timestamp)
+        {
+            /* the kernel receive time when timestamping is on, otherwise when the receiver read it */
+            aeron_term_rebuilder_insert_with_reserved_value(
+                term_buffer + term_offset, buffer, length, recv_timestamp_ns > 0 ? recv_timestamp_ns : dispatch_ns);
+        }
+        else if (image->non_temporal_copy_threshold > 0 && length >= image->non_temporal_copy_threshold)
+        {
+            aeron_term_rebuilder_insert_non_temporal(term_buffer + term_offset, buffer, length);
+        }
+        else
+        {
             aeron_term_rebuilder_insert(term_buffer + term_offset, buffer, length);
         }
 
-        AERON_PUT_ORDERED(image->last_packet_timestamp_ns, image->nano_clock());
-        aeron_counter_propose_max_ordered(image->rcv_hwm_position.value_addr, proposed_position);
+        if (recv_timestamp_ns > 0 && NULL != image->rcv_wire_latency_position.value_addr)
+        {
+            aeron_publication_image_smooth_latency(
+                image->rcv_wire_latency_position.value_addr, dispatch_ns - recv_timestamp_ns);
+            aeron_publication_image_smooth_latency(
+                image->rcv_driver_latency_position.value_addr, aeron_publication_image_realtime_ns() - dispatch_ns);
+        }
+    }
+
+    return true;
+}
+
+int aeron_publication_image_insert_packet(
+    aeron_publication_image_t *image, int32_t term_id, int32_t term_offset, const uint8_t *buffer, size_t length)
+{
+    int64_t proposed_position;
+
+    if (aeron_publication_image_rebuild_packet(
+        image, term_id, term_offset, buffer, length, image->endpoint->transport.recv_timestamp_ns, &proposed_position))
+    {
+        AERON_PUT_ORDERED(image->receiver_fields.last_packet_timestamp_ns, image->nano_clock());
+        if (proposed_position >= 0)
+        {
+            aeron_counter_propose_max_ordered(image->rcv_hwm_position.value_addr, proposed_position);
+        }
     }
 
     return (int)length;
 }
 
+int aeron_publication_image_insert_packets(
+    aeron_publication_image_t *image, const aeron_publication_image_packet_t *packets, size_t count)
+{
+    int64_t hwm_position = -1;
+    bool is_heard = false;
+    int bytes = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const aeron_data_header_t *header = (const aeron_data_header_t *)packets[i].buffer;
+        int64_t proposed_position;
+
+        if (aeron_publication_image_rebuild_packet(
+            image,
+            header->term_id,
+            header->term_offset,
+            packets[i].buffer,
+            packets[i].length,
+            packets[i].recv_timestamp_ns,
+            &proposed_position))
+        {
+            is_heard = true;
+            hwm_position = proposed_position > hwm_position ? proposed_position : hwm_position;
+        }
+
+        bytes += (int)packets[i].length;
+    }
+
+    if (is_heard)
+    {
+        AERON_PUT_ORDERED(image->receiver_fields.last_packet_timestamp_ns, image->nano_clock());
+        if (hwm_position >= 0)
+        {
+            aeron_counter_propose_max_ordered(image->rcv_hwm_position.value_addr, hwm_position);
+        }
+    }
+
+    return bytes;
+}
+
+void aeron_publication_image_on_peer_nak(
+    aeron_publication_image_t *image, int32_t term_id, int32_t term_offset, int32_t length)
+{
+    const int64_t count = image->peer_naks.count;
+    aeron_loss_detector_gap_t *nak = &image->peer_naks.naks[count & (AERON_PUBLICATION_IMAGE_PEER_NAKS_LENGTH - 1)];
+
+    nak->term_id = term_id;
+    nak->term_offset = term_offset;
+    nak->length = length < 0 ? 0 : (size_t)length;
+
+    AERON_PUT_ORDERED(image->peer_naks.count, count + 1);
+}
+
 int aeron_publication_image_on_rttm(
     aeron_publication_image_t *image, aeron_rttm_header_t *header, struct sockaddr_storage *addr)
 {
@@ -389,9 +705,61 @@ int aeron_publication_image_on_rttm(
     const int64_t rtt_in_ns = now_ns - header->echo_timestamp - header->reception_delta;
 
     image->congestion_control->on_rttm(image->congestion_control->state, now_ns, rtt_in_ns, addr);
+
+    if (NULL != image->stats.rtt.value_addr)
+    {
+        aeron_counter_set_ordered(image->stats.rtt.value_addr, rtt_in_ns);
+    }
+
     return 1;
 }
 
+int aeron_publication_image_on_fec(aeron_publication_image_t *image, const uint8_t *buffer, size_t length)
+{
+    const aeron_fec_header_t *header = (const aeron_fec_header_t *)buffer;
+    const int64_t group_position = aeron_logbuffer_compute_position(
+        header->term_id, header->term_offset, image->position_bits_to_shift, image->initial_term_id);
+    const int64_t window_position = image->conductor_fields.next_sm_position;
+
+    /* only a group within the window maps to its own term in the log */
+    if (group_position < window_position ||
+        group_position >= window_position + image->conductor_fields.next_sm_receiver_window_length)
+    {
+        return 0;
+    }
+
+    if (NULL == image->receiver_fields.fec_buffer && aeron_alloc((void **)&image->receiver_fields.fec_buffer, (size_t)image->mtu_length) < 0)
+    {
+        return -1;
+    }
+
+    const size_t index = aeron_logbuffer_index_by_position(group_position, image->position_bits_to_shift);
+    int32_t term_offset = 0;
+    const int rebuilt_length = aeron_fec_decode(
+        buffer,
+        length,
+        image->mapped_raw_log.term_buffers[index].addr,
+        (size_t)image->term_length_mask + 1,
+        image->receiver_fields.fec_buffer,
+        (size_t)image->mtu_length,
+        &term_offset);
+
+    if (rebuilt_length < 0)
+    {
+        aeron_counter_increment(image->invalid_packets_counter, 1);
+        return 0;
+    }
+
+    if (rebuilt_length > 0)
+    {
+        aeron_publication_image_insert_packet(
+            image, header->term_id, term_offset, image->receiver_fields.fec_buffer, (size_t)rebuilt_length);
+        aeron_counter_increment(image->fec_repairs_counter, 1);
+    }
+
+    return rebuilt_length;
+}
+
 int aeron_publication_image_send_pending_status_message(aeron_publication_image_t *image)
 {
     int work_count = 0;
@@ -399,16 +767,16 @@ int aeron_publication_image_send_pending_status_message(aeron_publication_image_
     if (NULL != image->endpoint && AERON_PUBLICATION_IMAGE_STATUS_ACTIVE == image->conductor_fields.status)
     {
         int64_t change_number;
-        AERON_GET_VOLATILE(change_number, image->end_sm_change);
+        AERON_GET_VOLATILE(change_number, image->conductor_fields.end_sm_change);
 
-        if (change_number != image->last_sm_change_number)
+        if (change_number != image->receiver_fields.last_sm_change_number)
         {
-            const int64_t sm_position = image->next_sm_position;
-            const int32_t receiver_window_length = image->next_sm_receiver_window_length;
+            const int64_t sm_position = image->conductor_fields.next_sm_position;
+            const int32_t receiver_window_length = image->conductor_fields.next_sm_receiver_window_length;
 
             aeron_acquire(); /* loadFence */
 
-            if (change_number == image->begin_sm_change)
+            if (change_number == image->conductor_fields.begin_sm_change)
             {
                 const int32_t term_id =
                     aeron_logbuffer_compute_term_id_from_position(
@@ -425,9 +793,10 @@ int aeron_publication_image_send_pending_status_message(aeron_publication_image_
                     receiver_window_length,
                     0);
 
-                aeron_counter_ordered_increment(image->status_messages_sent_counter, 1);
+                aeron_counter_increment(image->status_messages_sent_counter, 1);
 
-                image->last_sm_change_number = change_number;
+                image->receiver_fields.last_sm_change_number = change_number;
+                image->receiver_fields.last_sm_limit = sm_position + receiver_window_length;
                 work_count = send_sm_result < 0 ? send_sm_result : 1;
             }
         }
@@ -444,46 +813,73 @@ int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image)
     {
 
         int64_t change_number;
-        AERON_GET_VOLATILE(change_number, image->end_loss_change);
+        AERON_GET_VOLATILE(change_number, image->conductor_fields.end_loss_change);
 
-        if (change_number != image->last_loss_change_number)
+        if (change_number != image->receiver_fields.last_loss_change_number)
         {
-            const int32_t term_id = image->loss_term_id;
-            const int32_t term_offset = image->loss_term_offset;
-            const int32_t length = (int32_t) image->loss_length;
+            aeron_loss_detector_gap_t gaps[AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS];
+            size_t gaps_length = image->conductor_fields.loss_gaps_length;
+
+            gaps_length = gaps_length < AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS ?
+                gaps_length : AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS;
+            memcpy(gaps, image->conductor_fields.loss_gaps, gaps_length * sizeof(aeron_loss_detector_gap_t));
 
             aeron_acquire(); /* loadFence */
 
-            if (change_number == image->begin_loss_change)
+            if (change_number == image->conductor_fields.begin_loss_change)
             {
-                if (image->conductor_fields.is_reliable)
-                {
-                    int send_nak_result = aeron_receive_channel_endpoint_send_nak(
-                        image->endpoint,
-                        &image->control_address,
-                        image->stream_id,
-                        image->session_id,
-                        term_id,
-                        term_offset,
-                        length);
-
-                    aeron_counter_ordered_increment(image->nak_messages_sent_counter, 1);
-                    work_count = send_nak_result < 0 ? send_nak_result : 1;
-                }
-                else
+                /* entry is created by the conductor before it publishes the gaps */
+                const aeron_loss_reporter_entry_offset_t loss_reporter_offset = image->loss_reporter_offset;
+                const int64_t now_ms = loss_reporter_offset >= 0 ? image->epoch_clock() : 0;
+
+                for (size_t i = 0; i < gaps_length; i++)
                 {
-                    const size_t index = aeron_logbuffer_index_by_term(image->initial_term_id, term_id);
-                    uint8_t *buffer = image->mapped_raw_log.term_buffers[index].addr;
+                    const int32_t term_id = gaps[i].term_id;
+                    const int32_t term_offset = gaps[i].term_offset;
+                    const int32_t length = (int32_t)gaps[i].length;
 
-                    if (aeron_term_gap_filler_try_fill_gap(image->log_meta_data, buffer, term_id, term_offset, length))
+                    if (image->conductor_fields.is_reliable)
                     {
-                        aeron_counter_ordered_increment(image->loss_gap_fills_counter, 1);
+                        AERON_PROBE5(image_send_nak, image->session_id, image->stream_id, term_id, term_offset, length);
+
+                        int send_nak_result = aeron_receive_channel_endpoint_send_nak(
+                            image->endpoint,
+                            &image->control_address,
+                            image->stream_id,
+                            image->session_id,
+                            term_id,
+                            term_offset,
+                            length);
+
+                        aeron_counter_increment(image->nak_messages_sent_counter, 1);
+                        aeron_loss_reporter_record_rate_sample(
+                            image->loss_reporter, loss_reporter_offset, length, send_nak_result < 0 ? 0 : 1, now_ms);
+
+                        if (send_nak_result < 0)
+                        {
+                            work_count = send_nak_result;
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        const size_t index = aeron_logbuffer_index_by_term(image->initial_term_id, term_id);
+                        uint8_t *buffer = image->mapped_raw_log.term_buffers[index].addr;
+
+                        if (aeron_term_gap_filler_try_fill_gap(
+                            image->log_meta_data, buffer, term_id, term_offset, length))
+                        {
+                            aeron_counter_increment(image->loss_gap_fills_counter, 1);
+                        }
+
+                        aeron_loss_reporter_record_rate_sample(
+                            image->loss_reporter, loss_reporter_offset, length, 0, now_ms);
                     }
 
-                    work_count = 1;
+                    work_count++;
                 }
 
-                image->last_loss_change_number = change_number;
+                image->receiver_fields.last_loss_change_number = change_number;
             }
         }
     }
@@ -497,7 +893,11 @@ int aeron_publication_image_initiate_rttm(aeron_publication_image_t *image, int6
 
     if (NULL != image->endpoint && AERON_PUBLICATION_IMAGE_STATUS_ACTIVE == image->conductor_fields.status)
     {
-        if (image->congestion_control->should_measure_rtt(image->congestion_control->state, now_ns))
+        const bool is_stats_rttm_due =
+            NULL != image->stats.rtt.value_addr && now_ns >= image->receiver_fields.stats_rttm_deadline_ns;
+
+        if (image->congestion_control->should_measure_rtt(image->congestion_control->state, now_ns) ||
+            is_stats_rttm_due)
         {
             int send_rttm_result = aeron_receive_channel_endpoint_send_rttm(
                 image->endpoint,
@@ -508,6 +908,12 @@ int aeron_publication_image_initiate_rttm(aeron_publication_image_t *image, int6
                 0,
                 true);
 
+            if (send_rttm_result >= 0)
+            {
+                image->congestion_control->on_rttm_sent(image->congestion_control->state, now_ns);
+                image->receiver_fields.stats_rttm_deadline_ns = now_ns + AERON_PUBLICATION_IMAGE_STATS_RTTM_INTERVAL_NS;
+            }
+
             work_count = send_rttm_result < 0 ? send_rttm_result : 1;
         }
     }
@@ -523,9 +929,9 @@ void aeron_publication_image_on_time_event(
         case AERON_PUBLICATION_IMAGE_STATUS_ACTIVE:
         {
             int64_t last_packet_timestamp_ns;
-            AERON_GET_VOLATILE(last_packet_timestamp_ns, image->last_packet_timestamp_ns);
+            AERON_GET_VOLATILE(last_packet_timestamp_ns, image->receiver_fields.last_packet_timestamp_ns);
             bool is_end_of_stream;
-            AERON_GET_VOLATILE(is_end_of_stream, image->is_end_of_stream);
+            AERON_GET_VOLATILE(is_end_of_stream, image->receiver_fields.is_end_of_stream);
 
             if (0 == image->conductor_fields.subscribable.length ||
                 now_ns > (last_packet_timestamp_ns + image->conductor_fields.liveness_timeout_ns) ||
@@ -537,7 +943,7 @@ void aeron_publication_image_on_time_event(
                 image->conductor_fields.time_of_last_status_change_ns = now_ns;
 
                 aeron_driver_receiver_proxy_on_remove_publication_image(
-                    conductor->context->receiver_proxy, image->endpoint, image);
+                    image->endpoint->receiver_proxy, image->endpoint, image);
             }
             break;
         }
@@ -569,12 +975,15 @@ void aeron_publication_image_on_time_event(
     }
 }
 
+extern void aeron_publication_image_prefetch_packet(
+    aeron_publication_image_t *image, int32_t term_id, int32_t term_offset);
 extern bool aeron_publication_image_is_heartbeat(const uint8_t *buffer, size_t length);
 extern bool aeron_publication_image_is_end_of_stream(const uint8_t *buffer, size_t length);
 extern bool aeron_publication_image_is_flow_control_under_run(
     aeron_publication_image_t *image, int64_t window_position, int64_t packet_position);
 extern bool aeron_publication_image_is_flow_control_over_run(
     aeron_publication_image_t *image, int64_t window_position, int64_t proposed_position);
+extern void aeron_publication_image_signal_pending(aeron_publication_image_t *image);
 extern void aeron_publication_image_schedule_status_message(
     aeron_publication_image_t *image, int64_t now_ns, int64_t sm_position, int32_t window_length);
 extern bool aeron_publication_image_is_drained(aeron_publication_image_t *image);
@@ -18,10 +18,24 @@
 #define AERON_AERON_PUBLICATION_IMAGE_H
 
 #include "aeron_driver_common.h"
+#include "aeron_alloc.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_congestion_control.h"
 #include "aeron_loss_detector.h"
 #include "reports/aeron_loss_reporter.h"
+#include "aeron_driver_receiver_proxy.h"
+#include "aeron_position.h"
+
+#define AERON_PUBLICATION_IMAGE_LATENCY_SMOOTHING_SHIFT (4)
+
+/* idle backoff stays well inside the receiver timeouts flow control strategies apply to status messages */
+#define AERON_PUBLICATION_IMAGE_MAX_SM_IDLE_BACKOFF_SHIFT (2)
+
+/* interval between the RTT measurements an image makes for its stream stats when congestion control makes none */
+#define AERON_PUBLICATION_IMAGE_STATS_RTTM_INTERVAL_NS (1000 * 1000 * 1000LL)
+
+/* power of 2 so the count of NAKs overheard indexes the ring of them */
+#define AERON_PUBLICATION_IMAGE_PEER_NAKS_LENGTH (16)
 
 typedef enum aeron_publication_image_status_enum
 {
@@ -34,6 +48,7 @@ aeron_publication_image_status_t;
 
 typedef struct aeron_publication_image_stct
 {
+    /* written by the conductor, which scans for loss and schedules status messages and NAKs for the receiver */
     struct aeron_publication_image_conductor_fields_stct
     {
         aeron_driver_managed_resource_t managed_resource;
@@ -43,19 +58,80 @@ typedef struct aeron_publication_image_stct
         int64_t liveness_timeout_ns;
         bool is_reliable;
         aeron_publication_image_status_t status;
+
+        aeron_loss_detector_t loss_detector;
+        int64_t last_status_mesage_timestamp;
+        int64_t last_sm_hwm_position;
+        int32_t sm_idle_backoff_shift;
+
+        volatile int64_t begin_sm_change;
+        volatile int64_t end_sm_change;
+        int64_t next_sm_position;
+        int32_t next_sm_receiver_window_length;
+
+        volatile int64_t begin_loss_change;
+        volatile int64_t end_loss_change;
+        aeron_loss_detector_gap_t loss_gaps[AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS];
+        size_t loss_gaps_length;
+
+        /* gaps reported by the current scan, published to the receiver together once it completes */
+        aeron_loss_detector_gap_t pending_loss_gaps[AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS];
+        size_t pending_loss_gaps_length;
+
+        int64_t last_peer_nak_count;
+        /* rebuild position when the image was last flagged in the stream activity ring */
+        int64_t activity_position;
     }
     conductor_fields;
 
     uint8_t conductor_fields_pad[
-        (2 * AERON_CACHE_LINE_LENGTH) - sizeof(struct aeron_publication_image_conductor_fields_stct)];
+        (2 * AERON_CACHE_LINE_LENGTH) -
+        (sizeof(struct aeron_publication_image_conductor_fields_stct) % AERON_CACHE_LINE_LENGTH)];
+
+    /* written by the receiver on the data path, the conductor only reads the timestamp and end of stream */
+    struct aeron_publication_image_receiver_fields_stct
+    {
+        int64_t last_packet_timestamp_ns;
+        int64_t last_sm_change_number;
+        int64_t last_loss_change_number;
+
+        /* set while the image is queued for the receiver to send its scheduled status message or NAK */
+        volatile int32_t is_service_pending;
+        bool is_end_of_stream;
+
+        /* position plus receiver window of the last status message sent, the edge the sender may send up to */
+        int64_t last_sm_limit;
 
+        /* when the next RTT measurement is due for the stream stats regardless of congestion control */
+        int64_t stats_rttm_deadline_ns;
+
+        /* datagram rebuilt from a FEC frame, allocated on the first FEC frame received */
+        uint8_t *fec_buffer;
+    }
+    receiver_fields;
+
+    uint8_t receiver_fields_pad[
+        (2 * AERON_CACHE_LINE_LENGTH) - sizeof(struct aeron_publication_image_receiver_fields_stct)];
+
+    /* NAKs of other receivers of a multicast stream, written by the receiver as it overhears them and read by the
+     * conductor to back off its own NAKs for the same gaps */
+    struct aeron_publication_image_peer_naks_stct
+    {
+        aeron_loss_detector_gap_t naks[AERON_PUBLICATION_IMAGE_PEER_NAKS_LENGTH];
+        volatile int64_t count;
+    }
+    peer_naks;
+
+    /* set when created and only read after */
     struct sockaddr_storage control_address;
     struct sockaddr_storage source_address;
-    aeron_loss_detector_t loss_detector;
 
     aeron_mapped_raw_log_t mapped_raw_log;
     aeron_position_t rcv_hwm_position;
     aeron_position_t rcv_pos_position;
+    aeron_position_t rcv_wire_latency_position;
+    aeron_position_t rcv_driver_latency_position;
+    aeron_stream_stats_t stats;
     aeron_logbuffer_metadata_t *log_meta_data;
 
     aeron_receive_channel_endpoint_t *endpoint;
@@ -75,28 +151,16 @@ typedef struct aeron_publication_image_stct
     int32_t term_length;
     int32_t mtu_length;
     int32_t term_length_mask;
+    size_t non_temporal_copy_threshold;
+    bool receive_timestamp;
+    int64_t term_clean_chunk_length;
     size_t log_file_name_length;
     size_t position_bits_to_shift;
+    size_t file_page_size;
     aeron_map_raw_log_close_func_t map_raw_log_close_func;
 
-    int64_t last_packet_timestamp_ns;
-    int64_t last_status_mesage_timestamp;
-
-    int64_t last_sm_change_number;
-    int64_t last_loss_change_number;
-
-    volatile int64_t begin_sm_change;
-    volatile int64_t end_sm_change;
-    int64_t next_sm_position;
-    int32_t next_sm_receiver_window_length;
-
-    volatile int64_t begin_loss_change;
-    volatile int64_t end_loss_change;
-    int32_t loss_term_id;
-    int32_t loss_term_offset;
-    size_t loss_length;
-
-    bool is_end_of_stream;
+    bool release_cleaned_pages;
+    bool adaptive_status_messages;
 
     int64_t *heartbeats_received_counter;
     int64_t *flow_control_under_runs_counter;
@@ -104,6 +168,13 @@ typedef struct aeron_publication_image_stct
     int64_t *status_messages_sent_counter;
     int64_t *nak_messages_sent_counter;
     int64_t *loss_gap_fills_counter;
+    int64_t *fec_repairs_counter;
+    int64_t *invalid_packets_counter;
+    int64_t *log_buffer_released_bytes_counter;
+    int64_t *duplicate_frames_received_counter;
+
+    /* holds this struct and the log file name, freed last on close */
+    aeron_arena_t arena;
 }
 aeron_publication_image_t;
 
@@ -119,6 +190,8 @@ int aeron_publication_image_create(
     int32_t initial_term_offset,
     aeron_position_t *rcv_hwm_position,
     aeron_position_t *rcv_pos_position,
+    aeron_position_t *rcv_wire_latency_position,
+    aeron_position_t *rcv_driver_latency_position,
     aeron_congestion_control_strategy_t *congestion_control,
     struct sockaddr_storage *control_address,
     struct sockaddr_storage *source_address,
@@ -130,19 +203,60 @@ int aeron_publication_image_create(
 
 int aeron_publication_image_close(aeron_counters_manager_t *counters_manager, aeron_publication_image_t *image);
 
-void aeron_publication_image_clean_buffer_to(aeron_publication_image_t *image, int64_t new_clean_position);
+int aeron_publication_image_clean_buffer_to(aeron_publication_image_t *image, int64_t new_clean_position);
 
 void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 
-void aeron_publication_image_track_rebuild(
+int aeron_publication_image_track_rebuild(
     aeron_publication_image_t *image, int64_t now_ns, int64_t status_message_timeout);
 
+typedef struct aeron_publication_image_packet_stct
+{
+    const uint8_t *buffer;
+    size_t length;
+    /* see aeron_udp_channel_transport_t, as it was when the datagram holding the frame was dispatched */
+    int64_t recv_timestamp_ns;
+}
+aeron_publication_image_packet_t;
+
 int aeron_publication_image_insert_packet(
     aeron_publication_image_t *image, int32_t term_id, int32_t term_offset, const uint8_t *buffer, size_t length);
 
+/*
+ * Insert data frames received for the image in a batch, stamping the last packet time and proposing the highest of
+ * their positions for the hwm once for all of them. Returns the bytes of the frames.
+ */
+int aeron_publication_image_insert_packets(
+    aeron_publication_image_t *image, const aeron_publication_image_packet_t *packets, size_t count);
+
+/*
+ * Prefetch the place in the log a data frame will be rebuilt to ahead of inserting it.
+ */
+inline void aeron_publication_image_prefetch_packet(
+    aeron_publication_image_t *image, int32_t term_id, int32_t term_offset)
+{
+    const int64_t packet_position =
+        aeron_logbuffer_compute_position(term_id, term_offset, image->position_bits_to_shift, image->initial_term_id);
+    const size_t index = aeron_logbuffer_index_by_position(packet_position, image->position_bits_to_shift);
+
+    __builtin_prefetch(image->mapped_raw_log.term_buffers[index].addr + (term_offset & image->term_length_mask), 1);
+}
+
+/*
+ * Called by the receiver for a NAK overheard from another receiver of the stream. The NAK is only recorded, the
+ * conductor applies it to the loss detector before its next scan.
+ */
+void aeron_publication_image_on_peer_nak(
+    aeron_publication_image_t *image, int32_t term_id, int32_t term_offset, int32_t length);
+
 int aeron_publication_image_on_rttm(
     aeron_publication_image_t *image, aeron_rttm_header_t *header, struct sockaddr_storage *addr);
 
+/*
+ * Rebuild the datagram a FEC frame covers when it is the only one of its group missing from the term.
+ */
+int aeron_publication_image_on_fec(aeron_publication_image_t *image, const uint8_t *buffer, size_t length);
+
 int aeron_publication_image_send_pending_status_message(aeron_publication_image_t *image);
 
 int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image);
@@ -178,7 +292,7 @@ inline bool aeron_publication_image_is_flow_control_under_run(
 inline bool aeron_publication_image_is_flow_control_over_run(
     aeron_publication_image_t *image, int64_t window_position, int64_t proposed_position)
 {
-    const bool is_flow_control_over_run = proposed_position > (window_position + image->next_sm_receiver_window_length);
+    const bool is_flow_control_over_run = proposed_position > (window_position + image->conductor_fields.next_sm_receiver_window_length);
 
     if (is_flow_control_over_run)
     {
@@ -188,18 +302,28 @@ inline bool aeron_publication_image_is_flow_control_over_run(
     return is_flow_control_over_run;
 }
 
+inline void aeron_publication_image_signal_pending(aeron_publication_image_t *image)
+{
+    if (NULL != image->endpoint && NULL != image->endpoint->receiver_proxy)
+    {
+        aeron_driver_receiver_proxy_on_image_pending(image->endpoint->receiver_proxy, image);
+    }
+}
+
 inline void aeron_publication_image_schedule_status_message(
     aeron_publication_image_t *image, int64_t now_ns, int64_t sm_position, int32_t window_length)
 {
-    const int64_t change_number = image->begin_sm_change + 1;
+    const int64_t change_number = image->conductor_fields.begin_sm_change + 1;
+
+    AERON_PUT_ORDERED(image->conductor_fields.begin_sm_change, change_number);
 
-    AERON_PUT_ORDERED(image->begin_sm_change, change_number);
+    image->conductor_fields.next_sm_position = sm_position;
+    image->conductor_fields.next_sm_receiver_window_length = window_length;
+    image->conductor_fields.last_status_mesage_timestamp = now_ns;
 
-    image->next_sm_position = sm_position;
-    image->next_sm_receiver_window_length = window_length;
-    image->last_status_mesage_timestamp = now_ns;
+    AERON_PUT_ORDERED(image->conductor_fields.end_sm_change, change_number);
 
-    AERON_PUT_ORDERED(image->end_sm_change, change_number);
+    aeron_publication_image_signal_pending(image);
 }
 
 inline bool aeron_publication_image_is_drained(aeron_publication_image_t *image)
@@ -0,0 +1,380 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "util/aeron_error.h"
+#include "aeron_alloc.h"
+#include "aeron_raw_log_pool.h"
+
+/*
+ * A path that does not fit is an error rather than truncated, as the pool would then recycle or create the wrong file.
+ */
+static int aeron_raw_log_pool_check_path_length(int length, size_t capacity, const char *path)
+{
+    if (length < 0 || (size_t)length >= capacity)
+    {
+        aeron_set_err(ENAMETOOLONG, "raw log pool path too long: %s", path);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_raw_log_pool_adopt(aeron_raw_log_pool_t *pool, const char *path, size_t log_length)
+{
+    for (size_t i = 0; i < pool->num_term_lengths; i++)
+    {
+        struct aeron_raw_log_pool_term_length_stct *ready = &pool->term_lengths[i];
+        aeron_raw_log_pool_entry_t *entry = NULL;
+
+        if (aeron_logbuffer_compute_log_length(ready->term_length, pool->page_size) != log_length ||
+            aeron_spsc_concurrent_array_queue_size(&ready->ready) >= pool->pool_size)
+        {
+            continue;
+        }
+
+        if (aeron_alloc((void **)&entry, sizeof(aeron_raw_log_pool_entry_t)) < 0)
+        {
+            return -1;
+        }
+
+        const size_t path_length = strlen(path);
+        if (aeron_raw_log_pool_check_path_length((int)path_length, sizeof(entry->path), path) < 0)
+        {
+            aeron_free(entry);
+            return -1;
+        }
+
+        memcpy(entry->path, path, path_length + 1);
+
+        if (aeron_map_existing_raw_log(&entry->mapped_raw_log, entry->path, ready->term_length, pool->page_size) < 0)
+        {
+            aeron_free(entry);
+            return -1;
+        }
+
+        if (AERON_OFFER_SUCCESS != aeron_spsc_concurrent_array_queue_offer(&ready->ready, entry))
+        {
+            pool->map_raw_log_close_func(&entry->mapped_raw_log);
+            aeron_free(entry);
+            return -1;
+        }
+
+        return 0;
+    }
+
+    return -1;
+}
+
+/*
+ * Logs from an earlier run that do not fit the pool are removed, so the recycled dir only ever holds pooled logs.
+ */
+static int aeron_raw_log_pool_adopt_recycled(aeron_raw_log_pool_t *pool)
+{
+    char path[AERON_MAX_PATH];
+    struct dirent *dir_entry;
+    struct stat sb;
+    DIR *dir = opendir(pool->recycled_dir);
+
+    if (NULL == dir)
+    {
+        return 0;
+    }
+
+    while (NULL != (dir_entry = readdir(dir)))
+    {
+        if (aeron_raw_log_pool_check_path_length(
+            snprintf(path, sizeof(path), "%s/%s", pool->recycled_dir, dir_entry->d_name), sizeof(path), path) < 0)
+        {
+            closedir(dir);
+            return -1;
+        }
+
+        if (stat(path, &sb) != 0 || !S_ISREG(sb.st_mode))
+        {
+            continue;
+        }
+
+        if (aeron_raw_log_pool_adopt(pool, path, (size_t)sb.st_size) < 0)
+        {
+            unlink(path);
+        }
+    }
+
+    closedir(dir);
+
+    return 0;
+}
+
+int aeron_raw_log_pool_init(aeron_raw_log_pool_t *pool, aeron_driver_context_t *context)
+{
+    const uint64_t term_lengths[AERON_RAW_LOG_POOL_MAX_TERM_LENGTHS] =
+        {
+            context->term_buffer_length,
+            context->ipc_term_buffer_length
+        };
+
+    pool->num_term_lengths = 0;
+    pool->pool_size = context->raw_log_pool_size;
+    pool->use_sparse_files = context->term_buffer_sparse_file;
+    pool->prefault = context->term_buffer_prefault;
+    pool->page_size = context->file_page_size;
+    pool->next_file_id = 0;
+    pool->map_raw_log_func = context->map_raw_log_func;
+    pool->map_raw_log_close_func = context->map_raw_log_close_func;
+
+    if (aeron_raw_log_pool_check_path_length(
+        snprintf(pool->dir, sizeof(pool->dir), "%s/%s", context->aeron_dir, AERON_RAW_LOG_POOL_DIR),
+        sizeof(pool->dir),
+        pool->dir) < 0)
+    {
+        return -1;
+    }
+
+    if (mkdir(pool->dir, S_IRWXU) != 0 && EEXIST != errno)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "mkdir %s: %s", pool->dir, strerror(errcode));
+        return -1;
+    }
+
+    for (size_t i = 0; i < AERON_RAW_LOG_POOL_MAX_TERM_LENGTHS; i++)
+    {
+        bool is_duplicate = false;
+
+        for (size_t j = 0; j < pool->num_term_lengths; j++)
+        {
+            if (pool->term_lengths[j].term_length == term_lengths[i])
+            {
+                is_duplicate = true;
+            }
+        }
+
+        if (is_duplicate)
+        {
+            continue;
+        }
+
+        if (aeron_spsc_concurrent_array_queue_init(
+            &pool->term_lengths[pool->num_term_lengths].ready, (uint64_t)pool->pool_size) < 0)
+        {
+            return -1;
+        }
+
+        pool->term_lengths[pool->num_term_lengths].term_length = term_lengths[i];
+        pool->num_term_lengths++;
+    }
+
+    if (aeron_raw_log_pool_check_path_length(
+        snprintf(
+            pool->recycled_dir, sizeof(pool->recycled_dir), "%s/%s", context->aeron_dir, AERON_RAW_LOG_POOL_RECYCLED_DIR),
+        sizeof(pool->recycled_dir),
+        pool->recycled_dir) < 0)
+    {
+        return -1;
+    }
+
+    if (context->dirs_warm_restart && aeron_raw_log_pool_adopt_recycled(pool) < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_raw_log_pool_fill(aeron_raw_log_pool_t *pool, uint64_t term_length, aeron_raw_log_pool_entry_t **entry)
+{
+    aeron_raw_log_pool_entry_t *_entry = NULL;
+
+    if (aeron_alloc((void **)&_entry, sizeof(aeron_raw_log_pool_entry_t)) < 0)
+    {
+        return -1;
+    }
+
+    const int path_length = snprintf(
+        _entry->path,
+        sizeof(_entry->path),
+        "%s/%" PRIu64 "-%" PRId64 ".logbuffer",
+        pool->dir,
+        term_length,
+        pool->next_file_id++);
+
+    if (aeron_raw_log_pool_check_path_length(path_length, sizeof(_entry->path), _entry->path) < 0)
+    {
+        aeron_free(_entry);
+        return -1;
+    }
+
+    if (pool->map_raw_log_func(
+        &_entry->mapped_raw_log, _entry->path, pool->use_sparse_files, term_length, pool->page_size) < 0)
+    {
+        aeron_free(_entry);
+        return -1;
+    }
+
+    if (pool->prefault)
+    {
+        aeron_mapped_raw_log_prefault(&_entry->mapped_raw_log, pool->page_size);
+    }
+
+    *entry = _entry;
+    return 0;
+}
+
+static void aeron_raw_log_pool_entry_delete(aeron_raw_log_pool_t *pool, aeron_raw_log_pool_entry_t *entry)
+{
+    pool->map_raw_log_close_func(&entry->mapped_raw_log);
+    unlink(entry->path);
+    aeron_free(entry);
+}
+
+int aeron_raw_log_pool_do_work(void *clientd)
+{
+    aeron_raw_log_pool_t *pool = (aeron_raw_log_pool_t *)clientd;
+
+    for (size_t i = 0; i < pool->num_term_lengths; i++)
+    {
+        struct aeron_raw_log_pool_term_length_stct *ready = &pool->term_lengths[i];
+        aeron_raw_log_pool_entry_t *entry = NULL;
+
+        if (aeron_spsc_concurrent_array_queue_size(&ready->ready) >= pool->pool_size)
+        {
+            continue;
+        }
+
+        /* one file per duty cycle keeps the agent responsive to close */
+        if (aeron_raw_log_pool_fill(pool, ready->term_length, &entry) < 0)
+        {
+            return 0;
+        }
+
+        if (AERON_OFFER_SUCCESS != aeron_spsc_concurrent_array_queue_offer(&ready->ready, entry))
+        {
+            aeron_raw_log_pool_entry_delete(pool, entry);
+            return 0;
+        }
+
+        return 1;
+    }
+
+    return 0;
+}
+
+static void aeron_raw_log_pool_delete_entry_func(void *clientd, volatile void *item)
+{
+    aeron_raw_log_pool_entry_delete((aeron_raw_log_pool_t *)clientd, (aeron_raw_log_pool_entry_t *)item);
+}
+
+void aeron_raw_log_pool_on_close(void *clientd)
+{
+    aeron_raw_log_pool_t *pool = (aeron_raw_log_pool_t *)clientd;
+
+    for (size_t i = 0; i < pool->num_term_lengths; i++)
+    {
+        aeron_spsc_concurrent_array_queue_drain_all(
+            &pool->term_lengths[i].ready, aeron_raw_log_pool_delete_entry_func, pool);
+        aeron_spsc_concurrent_array_queue_close(&pool->term_lengths[i].ready);
+    }
+
+    pool->num_term_lengths = 0;
+    rmdir(pool->dir);
+    rmdir(pool->recycled_dir);
+}
+
+static void aeron_raw_log_pool_claim_entry_func(void *clientd, volatile void *item)
+{
+    *(aeron_raw_log_pool_entry_t **)clientd = (aeron_raw_log_pool_entry_t *)item;
+}
+
+static aeron_raw_log_pool_entry_t *aeron_raw_log_pool_claim(
+    aeron_raw_log_pool_t *pool, bool use_sparse_files, uint64_t term_length, uint64_t page_size)
+{
+    aeron_raw_log_pool_entry_t *entry = NULL;
+
+    if (NULL == pool || use_sparse_files != pool->use_sparse_files || page_size != pool->page_size)
+    {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < pool->num_term_lengths; i++)
+    {
+        if (term_length == pool->term_lengths[i].term_length)
+        {
+            aeron_spsc_concurrent_array_queue_drain(
+                &pool->term_lengths[i].ready, aeron_raw_log_pool_claim_entry_func, &entry, 1);
+            break;
+        }
+    }
+
+    return entry;
+}
+
+int aeron_raw_log_pool_map_raw_log(
+    aeron_raw_log_pool_t *pool,
+    aeron_map_raw_log_func_t map_raw_log_func,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    bool use_sparse_files,
+    uint64_t term_length,
+    uint64_t page_size,
+    bool prefault,
+    bool lock)
+{
+    aeron_raw_log_pool_entry_t *entry = aeron_raw_log_pool_claim(pool, use_sparse_files, term_length, page_size);
+    bool is_mapped = false;
+
+    if (NULL != entry)
+    {
+        /* the pooled file is never visible to clients before it is renamed so there is nothing to clear */
+        if (rename(entry->path, path) == 0)
+        {
+            memcpy(mapped_raw_log, &entry->mapped_raw_log, sizeof(aeron_mapped_raw_log_t));
+            aeron_free(entry);
+            is_mapped = true;
+            prefault = prefault && !pool->prefault;
+        }
+        else
+        {
+            aeron_raw_log_pool_entry_delete(pool, entry);
+        }
+    }
+
+    if (!is_mapped && map_raw_log_func(mapped_raw_log, path, use_sparse_files, term_length, page_size) < 0)
+    {
+        return -1;
+    }
+
+    if (prefault)
+    {
+        aeron_mapped_raw_log_prefault(mapped_raw_log, page_size);
+    }
+
+    if (lock && aeron_mapped_raw_log_lock(mapped_raw_log) < 0)
+    {
+        aeron_map_raw_log_close(mapped_raw_log);
+        unlink(path);
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_RAW_LOG_POOL_H
+#define AERON_AERON_RAW_LOG_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "aeron_driver_common.h"
+#include "aeron_driver_context.h"
+#include "util/aeron_fileutil.h"
+#include "concurrent/aeron_spsc_concurrent_array_queue.h"
+
+#define AERON_RAW_LOG_POOL_DIR "pool"
+#define AERON_RAW_LOG_POOL_RECYCLED_DIR "recycled"
+#define AERON_RAW_LOG_POOL_MAX_TERM_LENGTHS (2)
+#define AERON_RAW_LOG_POOL_MAX_SIZE (64)
+
+typedef struct aeron_raw_log_pool_entry_stct
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    char path[AERON_MAX_PATH];
+}
+aeron_raw_log_pool_entry_t;
+
+/*
+ * Raw logs created ahead of time on a background agent so the conductor only has to rename a ready file into place
+ * when adding a publication or image. There is one queue of ready logs for each of the configured default term
+ * lengths; logs with other term lengths, page sizes or sparseness are mapped on demand as before. On a warm restart
+ * the logs an earlier run left in the recycled dir are zeroed and put in the pool first, so they are reused rather than
+ * new files being created. Pooled logs are also faulted in here when prefaulting is on, keeping that off the conductor.
+ */
+typedef struct aeron_raw_log_pool_stct
+{
+    struct aeron_raw_log_pool_term_length_stct
+    {
+        aeron_spsc_concurrent_array_queue_t ready;
+        uint64_t term_length;
+    }
+    term_lengths[AERON_RAW_LOG_POOL_MAX_TERM_LENGTHS];
+
+    size_t num_term_lengths;
+    size_t pool_size;
+    bool use_sparse_files;
+    bool prefault;
+    uint64_t page_size;
+    int64_t next_file_id;
+    char dir[AERON_MAX_PATH];
+    char recycled_dir[AERON_MAX_PATH];
+    aeron_map_raw_log_func_t map_raw_log_func;
+    aeron_map_raw_log_close_func_t map_raw_log_close_func;
+}
+aeron_raw_log_pool_t;
+
+int aeron_raw_log_pool_init(aeron_raw_log_pool_t *pool, aeron_driver_context_t *context);
+
+int aeron_raw_log_pool_do_work(void *clientd);
+void aeron_raw_log_pool_on_close(void *clientd);
+
+/*
+ * Claim a ready log from the pool and move it to path, falling back to map_raw_log_func when pool is NULL, the pool
+ * does not hold logs of this shape, or it has run dry. A log that did not come from the pool is faulted in here when
+ * prefault is set, and either is locked in memory when lock is set.
+ */
+int aeron_raw_log_pool_map_raw_log(
+    aeron_raw_log_pool_t *pool,
+    aeron_map_raw_log_func_t map_raw_log_func,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    bool use_sparse_files,
+    uint64_t term_length,
+    uint64_t page_size,
+    bool prefault,
+    bool lock);
+
+#endif //AERON_AERON_RAW_LOG_POOL_H
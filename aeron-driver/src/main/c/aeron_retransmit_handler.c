@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <errno.h>
 #include <string.h>
 #include "concurrent/aeron_counters_manager.h"
 #include "protocol/aeron_udp_protocol.h"
@@ -25,17 +26,9 @@ int aeron_retransmit_handler_init(
     int64_t *invalid_packets_counter,
     int64_t linger_timeout_ns)
 {
-    if (aeron_int64_to_ptr_hash_map_init(
-        &handler->active_retransmits_map, 8, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
-    {
-        int errcode = errno;
-
-        aeron_set_err(errcode, "could not init retransmit handler map: %s", strerror(errcode));
-        return -1;
-    }
-
     handler->invalid_packets_counter = invalid_packets_counter;
     handler->linger_timeout_ns = linger_timeout_ns;
+    handler->active_actions_length = 0;
 
     for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
     {
@@ -47,7 +40,7 @@ int aeron_retransmit_handler_init(
 
 int aeron_retransmit_handler_close(aeron_retransmit_handler_t *handler)
 {
-    aeron_int64_to_ptr_hash_map_delete(&handler->active_retransmits_map);
+    handler->active_actions_length = 0;
     return 0;
 }
 
@@ -76,6 +69,39 @@ aeron_retransmit_action_t *aeron_retransmit_handler_assign_action(aeron_retransm
     return NULL;
 }
 
+inline static int32_t aeron_retransmit_action_end(aeron_retransmit_action_t *action)
+{
+    return action->term_offset + (int32_t)action->length;
+}
+
+/*
+ * Index of the first active action that overlaps or touches [term_offset, ...) in the given term, or of where
+ * one would be inserted.
+ */
+static size_t aeron_retransmit_handler_lower_bound(
+    aeron_retransmit_handler_t *handler, int32_t term_id, int32_t term_offset)
+{
+    size_t low = 0, high = handler->active_actions_length;
+
+    while (low < high)
+    {
+        const size_t mid = (low + high) >> 1;
+        aeron_retransmit_action_t *action = handler->active_actions[mid];
+
+        if (action->term_id < term_id ||
+            (action->term_id == term_id && aeron_retransmit_action_end(action) < term_offset))
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
 int aeron_retransmit_handler_on_nak(
     aeron_retransmit_handler_t *handler,
     int32_t term_id,
@@ -88,41 +114,105 @@ int aeron_retransmit_handler_on_nak(
 {
     int result = 0;
 
-    if (!aeron_retransmit_handler_is_invalid(handler, term_offset, term_length))
+    if (aeron_retransmit_handler_is_invalid(handler, term_offset, term_length))
     {
-        const int64_t key = aeron_int64_to_ptr_hash_map_compound_key(term_id, term_offset);
+        return result;
+    }
+
+    const size_t term_length_left = term_length - term_offset;
+    const int32_t nak_end = term_offset + (int32_t)(length < term_length_left ? length : term_length_left);
+    const size_t first = aeron_retransmit_handler_lower_bound(handler, term_id, term_offset);
+    size_t last = first;
+    int32_t cursor = term_offset;
+    bool has_resent = false;
+    aeron_retransmit_action_t *action;
 
-        if (NULL == aeron_int64_to_ptr_hash_map_get(&handler->active_retransmits_map, key) &&
-            handler->active_retransmits_map.size < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS)
+    /* resend only the parts of the range no lingering action already covers, up to one gap per neighbour */
+    while (last < handler->active_actions_length)
+    {
+        aeron_retransmit_action_t *active = handler->active_actions[last];
+
+        if (active->term_id != term_id || active->term_offset > nak_end)
         {
-            aeron_retransmit_action_t *action = aeron_retransmit_handler_assign_action(handler);
+            break;
+        }
 
-            if (NULL == action)
+        if (active->term_offset > cursor)
+        {
+            has_resent = true;
+            if (resend(resend_clientd, term_id, cursor, (size_t)(active->term_offset - cursor)) < 0)
             {
-                aeron_set_err(EINVAL, "%s", "could not assign retransmit action");
-                return -1;
+                result = -1;
             }
+        }
 
-            const size_t term_length_left = term_length - term_offset;
+        const int32_t active_end = aeron_retransmit_action_end(active);
+        cursor = active_end > cursor ? active_end : cursor;
+        last++;
+    }
 
-            action->term_id = term_id;
-            action->term_offset = term_offset;
-            action->length = length < term_length_left ? length : term_length_left;
+    if (cursor < nak_end)
+    {
+        if (first == last && handler->active_actions_length >= AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS)
+        {
+            return result;
+        }
 
-            result = resend(resend_clientd, term_id, term_offset, action->length);
-            action->state = AERON_RETRANSMIT_ACTION_STATE_LINGERING;
-            action->expire_ns = now_ns + handler->linger_timeout_ns;
+        if (resend(resend_clientd, term_id, cursor, (size_t)(nak_end - cursor)) < 0)
+        {
+            result = -1;
+        }
+    }
+    else if (!has_resent)
+    {
+        return result;
+    }
 
-            if (aeron_int64_to_ptr_hash_map_put(&handler->active_retransmits_map, key, action) < 0)
-            {
-                int errcode = errno;
+    if (first == last)
+    {
+        if (NULL == (action = aeron_retransmit_handler_assign_action(handler)))
+        {
+            aeron_set_err(EINVAL, "%s", "could not assign retransmit action");
+            return -1;
+        }
 
-                aeron_set_err(errcode, "could not put retransmit handler map: %s", strerror(errcode));
-                return -1;
-            }
+        memmove(
+            &handler->active_actions[first + 1],
+            &handler->active_actions[first],
+            (handler->active_actions_length - first) * sizeof(aeron_retransmit_action_t *));
+        handler->active_actions_length++;
+
+        action->term_id = term_id;
+        action->term_offset = term_offset;
+        action->length = (size_t)(nak_end - term_offset);
+    }
+    else
+    {
+        /* merge the new range and every action it overlaps or touches into the first of them */
+        aeron_retransmit_action_t *merged = handler->active_actions[first];
+        const int32_t merged_offset = term_offset < merged->term_offset ? term_offset : merged->term_offset;
+        const int32_t merged_end = cursor > nak_end ? cursor : nak_end;
+
+        for (size_t i = first + 1; i < last; i++)
+        {
+            handler->active_actions[i]->state = AERON_RETRANSMIT_ACTION_STATE_INACTIVE;
         }
+
+        memmove(
+            &handler->active_actions[first + 1],
+            &handler->active_actions[last],
+            (handler->active_actions_length - last) * sizeof(aeron_retransmit_action_t *));
+        handler->active_actions_length -= (last - first - 1);
+
+        action = merged;
+        action->term_offset = merged_offset;
+        action->length = (size_t)(merged_end - merged_offset);
     }
 
+    handler->active_actions[first] = action;
+    action->state = AERON_RETRANSMIT_ACTION_STATE_LINGERING;
+    action->expire_ns = now_ns + handler->linger_timeout_ns;
+
     return result;
 }
 
@@ -131,29 +221,24 @@ int aeron_retransmit_handler_process_timeouts(
     int64_t now_ns)
 {
     int result = 0;
-    size_t num_active_actions = handler->active_retransmits_map.size;
+    size_t length = 0;
 
-    if (num_active_actions > 0)
+    for (size_t i = 0; i < handler->active_actions_length; i++)
     {
-        for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS && num_active_actions > 0; i++)
-        {
-            aeron_retransmit_action_t *action = &handler->retransmit_action_pool[i];
-
-            if (AERON_RETRANSMIT_ACTION_STATE_LINGERING == action->state)
-            {
-                if (now_ns > action->expire_ns)
-                {
-                    const int64_t key = aeron_int64_to_ptr_hash_map_compound_key(action->term_id, action->term_offset);
-
-                    action->state = AERON_RETRANSMIT_ACTION_STATE_INACTIVE;
-                    aeron_int64_to_ptr_hash_map_remove(&handler->active_retransmits_map, key);
-                    result++;
-                }
+        aeron_retransmit_action_t *action = handler->active_actions[i];
 
-                num_active_actions--;
-            }
+        if (now_ns > action->expire_ns)
+        {
+            action->state = AERON_RETRANSMIT_ACTION_STATE_INACTIVE;
+            result++;
+        }
+        else
+        {
+            handler->active_actions[length++] = action;
         }
     }
 
+    handler->active_actions_length = length;
+
     return result;
 }
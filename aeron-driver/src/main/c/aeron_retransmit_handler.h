@@ -19,7 +19,6 @@
 
 #include <stdint.h>
 #include <stddef.h>
-#include "collections/aeron_int64_to_ptr_hash_map.h"
 #include "aeron_driver_common.h"
 #include "aeronmd.h"
 
@@ -49,7 +48,9 @@ typedef int (*aeron_retransmit_handler_resend_func_t)(
 typedef struct aeron_retransmit_handler_stct
 {
     aeron_retransmit_action_t retransmit_action_pool[AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS];
-    aeron_int64_to_ptr_hash_map_t active_retransmits_map;
+    /* lingering actions sorted by (term_id, term_offset), ranges never overlap or touch within a term */
+    aeron_retransmit_action_t *active_actions[AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS];
+    size_t active_actions_length;
     int64_t linger_timeout_ns;
 
     int64_t *invalid_packets_counter;
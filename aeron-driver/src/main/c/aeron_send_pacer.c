@@ -0,0 +1,235 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include "util/aeron_error.h"
+#include "aeron_send_pacer.h"
+
+static const double aeron_send_pacer_gain_cycle[AERON_SEND_PACER_GAIN_CYCLE_LENGTH] =
+    { 1.25, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+
+int aeron_send_pacer_init(aeron_send_pacer_t *pacer, size_t max_burst_length, int64_t now_ns)
+{
+    if (NULL == pacer || 0 == max_burst_length)
+    {
+        aeron_set_err(EINVAL, "%s", "invalid argument");
+        return -1;
+    }
+
+    memset(pacer, 0, sizeof(aeron_send_pacer_t));
+    pacer->min_rtt_ns = INT64_MAX;
+    pacer->min_rtt_timestamp_ns = now_ns;
+    pacer->last_sm_time_ns = now_ns;
+    pacer->last_sm_send_time_ns = -1;
+    pacer->app_limited_position = -1;
+    pacer->mode = AERON_SEND_PACER_MODE_STARTUP;
+    pacer->pacing_gain = AERON_SEND_PACER_STARTUP_GAIN;
+    pacer->cycle_start_ns = now_ns;
+    pacer->last_refill_ns = now_ns;
+    pacer->max_burst_length = max_burst_length;
+    pacer->tokens = (double)max_burst_length;
+
+    return 0;
+}
+
+int32_t aeron_send_pacer_available(aeron_send_pacer_t *pacer, int64_t now_ns)
+{
+    if (0.0 == pacer->btl_bw)
+    {
+        return INT32_MAX;
+    }
+
+    const double max_tokens = (double)pacer->max_burst_length;
+
+    pacer->tokens += pacer->pacing_gain * pacer->btl_bw * (double)(now_ns - pacer->last_refill_ns);
+    pacer->last_refill_ns = now_ns;
+
+    /* tokens lost to the cap mean the duty cycle, not the path, limited the rate, much like being app limited */
+    if (pacer->tokens > max_tokens)
+    {
+        pacer->tokens = max_tokens;
+        pacer->is_burst_limited = true;
+    }
+
+    return (int32_t)pacer->tokens;
+}
+
+void aeron_send_pacer_on_send(
+    aeron_send_pacer_t *pacer, int64_t now_ns, int64_t position, int32_t bytes_sent, bool is_app_limited)
+{
+    aeron_send_pacer_send_time_t *entry = &pacer->send_times[pacer->send_times_head];
+
+    entry->position = position;
+    entry->time_ns = now_ns;
+    pacer->send_times_head = (pacer->send_times_head + 1) % AERON_SEND_PACER_SEND_TIMES_LENGTH;
+    if (pacer->send_times_count < AERON_SEND_PACER_SEND_TIMES_LENGTH)
+    {
+        pacer->send_times_count++;
+    }
+
+    pacer->last_sent_position = position;
+    pacer->tokens -= (double)bytes_sent;
+    if (pacer->tokens < 0.0)
+    {
+        pacer->tokens = 0.0;
+    }
+
+    if (is_app_limited || pacer->is_burst_limited)
+    {
+        pacer->app_limited_position = position;
+    }
+
+    pacer->is_burst_limited = false;
+}
+
+static int64_t aeron_send_pacer_on_rtt_sample(aeron_send_pacer_t *pacer, int64_t now_ns, int64_t consumption_position)
+{
+    int64_t send_time_ns = -1;
+    size_t tail = (pacer->send_times_head + AERON_SEND_PACER_SEND_TIMES_LENGTH - pacer->send_times_count) %
+        AERON_SEND_PACER_SEND_TIMES_LENGTH;
+
+    /* the oldest send reaching the acknowledged position carried its last byte, those before are now acknowledged */
+    while (pacer->send_times_count > 0)
+    {
+        aeron_send_pacer_send_time_t *entry = &pacer->send_times[tail];
+
+        if (entry->position >= consumption_position)
+        {
+            const int64_t rtt_ns = now_ns - entry->time_ns;
+
+            send_time_ns = entry->time_ns;
+            if (rtt_ns <= pacer->min_rtt_ns ||
+                now_ns - pacer->min_rtt_timestamp_ns > AERON_SEND_PACER_MIN_RTT_WINDOW_NS)
+            {
+                pacer->min_rtt_ns = rtt_ns;
+                pacer->min_rtt_timestamp_ns = now_ns;
+            }
+
+            if (entry->position == consumption_position)
+            {
+                pacer->send_times_count--;
+            }
+
+            break;
+        }
+
+        tail = (tail + 1) % AERON_SEND_PACER_SEND_TIMES_LENGTH;
+        pacer->send_times_count--;
+    }
+
+    return send_time_ns;
+}
+
+static void aeron_send_pacer_on_round_end(aeron_send_pacer_t *pacer)
+{
+    double btl_bw = 0.0;
+
+    /* rounds without a sample, such as app limited ones, must not age out the estimate */
+    if (0.0 == pacer->round_max_delivery_rate)
+    {
+        return;
+    }
+
+    pacer->btl_bw_filter[pacer->round_count % AERON_SEND_PACER_BTL_BW_FILTER_LENGTH] = pacer->round_max_delivery_rate;
+    pacer->round_count++;
+    pacer->round_max_delivery_rate = 0.0;
+
+    for (size_t i = 0; i < AERON_SEND_PACER_BTL_BW_FILTER_LENGTH; i++)
+    {
+        btl_bw = pacer->btl_bw_filter[i] > btl_bw ? pacer->btl_bw_filter[i] : btl_bw;
+    }
+
+    pacer->btl_bw = btl_bw;
+
+    if (AERON_SEND_PACER_MODE_STARTUP == pacer->mode)
+    {
+        if (btl_bw >= pacer->full_bw * AERON_SEND_PACER_FULL_BW_THRESHOLD)
+        {
+            pacer->full_bw = btl_bw;
+            pacer->full_bw_rounds = 0;
+        }
+        else if (++pacer->full_bw_rounds >= AERON_SEND_PACER_FULL_BW_ROUNDS)
+        {
+            pacer->mode = AERON_SEND_PACER_MODE_DRAIN;
+            pacer->pacing_gain = 1.0 / AERON_SEND_PACER_STARTUP_GAIN;
+        }
+    }
+}
+
+void aeron_send_pacer_on_status_message(aeron_send_pacer_t *pacer, int64_t now_ns, int64_t consumption_position)
+{
+    if (consumption_position <= pacer->last_sm_position)
+    {
+        return;
+    }
+
+    const int64_t send_time_ns = aeron_send_pacer_on_rtt_sample(pacer, now_ns, consumption_position);
+    int64_t interval_ns = now_ns - pacer->last_sm_time_ns;
+
+    /* taking the longer of the send and ack intervals stops compressed status messages inflating the rate */
+    if (send_time_ns >= 0 && pacer->last_sm_send_time_ns >= 0 &&
+        send_time_ns - pacer->last_sm_send_time_ns > interval_ns)
+    {
+        interval_ns = send_time_ns - pacer->last_sm_send_time_ns;
+    }
+
+    if (interval_ns > 0 && pacer->last_sm_position > 0)
+    {
+        const double delivery_rate = (double)(consumption_position - pacer->last_sm_position) / (double)interval_ns;
+        const bool is_app_limited = consumption_position <= pacer->app_limited_position;
+
+        if (!is_app_limited || delivery_rate > pacer->btl_bw)
+        {
+            if (delivery_rate > pacer->round_max_delivery_rate)
+            {
+                pacer->round_max_delivery_rate = delivery_rate;
+            }
+        }
+    }
+
+    pacer->last_sm_position = consumption_position;
+    pacer->last_sm_time_ns = now_ns;
+    pacer->last_sm_send_time_ns = send_time_ns;
+
+    if (consumption_position >= pacer->round_end_position)
+    {
+        pacer->round_end_position = pacer->last_sent_position;
+        aeron_send_pacer_on_round_end(pacer);
+    }
+
+    const double bdp = pacer->btl_bw * (double)pacer->min_rtt_ns;
+
+    if (AERON_SEND_PACER_MODE_DRAIN == pacer->mode &&
+        INT64_MAX != pacer->min_rtt_ns &&
+        (double)(pacer->last_sent_position - consumption_position) <= bdp)
+    {
+        pacer->mode = AERON_SEND_PACER_MODE_PROBE_BW;
+        pacer->cycle_index = 0;
+        pacer->cycle_start_ns = now_ns;
+        pacer->pacing_gain = aeron_send_pacer_gain_cycle[0];
+    }
+    else if (AERON_SEND_PACER_MODE_PROBE_BW == pacer->mode &&
+        INT64_MAX != pacer->min_rtt_ns &&
+        now_ns - pacer->cycle_start_ns > pacer->min_rtt_ns)
+    {
+        pacer->cycle_index = (pacer->cycle_index + 1) % AERON_SEND_PACER_GAIN_CYCLE_LENGTH;
+        pacer->cycle_start_ns = now_ns;
+        pacer->pacing_gain = aeron_send_pacer_gain_cycle[pacer->cycle_index];
+    }
+}
+
+extern int64_t aeron_send_pacer_rate(aeron_send_pacer_t *pacer);
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_SEND_PACER_H
+#define AERON_AERON_SEND_PACER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define AERON_SEND_PACER_SEND_TIMES_LENGTH (64)
+#define AERON_SEND_PACER_BTL_BW_FILTER_LENGTH (10)
+#define AERON_SEND_PACER_MIN_RTT_WINDOW_NS (10 * 1000 * 1000 * 1000L)
+#define AERON_SEND_PACER_STARTUP_GAIN (2.885)
+#define AERON_SEND_PACER_FULL_BW_THRESHOLD (1.25)
+#define AERON_SEND_PACER_FULL_BW_ROUNDS (3)
+#define AERON_SEND_PACER_GAIN_CYCLE_LENGTH (8)
+
+typedef enum aeron_send_pacer_mode_enum
+{
+    AERON_SEND_PACER_MODE_STARTUP,
+    AERON_SEND_PACER_MODE_DRAIN,
+    AERON_SEND_PACER_MODE_PROBE_BW
+}
+aeron_send_pacer_mode_t;
+
+typedef struct aeron_send_pacer_send_time_stct
+{
+    int64_t position;
+    int64_t time_ns;
+}
+aeron_send_pacer_send_time_t;
+
+/*
+ * BBR style model of the path to the receiver, built only from status messages. Consumption advancing between
+ * status messages gives delivery rate samples and the time since the acknowledged position was sent gives RTT
+ * samples. Bottleneck bandwidth is the max delivery rate over the last few rounds, a round ending when the data
+ * sent at its start is acknowledged, and propagation RTT is the min over a 10s window. Sending is paced by a token
+ * bucket refilled at gain * bottleneck bandwidth so data is spread out rather than sent up to the window at once.
+ */
+typedef struct aeron_send_pacer_stct
+{
+    aeron_send_pacer_send_time_t send_times[AERON_SEND_PACER_SEND_TIMES_LENGTH];
+    size_t send_times_head;
+    size_t send_times_count;
+    double btl_bw_filter[AERON_SEND_PACER_BTL_BW_FILTER_LENGTH];
+    size_t round_count;
+    int64_t round_end_position;
+    double round_max_delivery_rate;
+    double btl_bw;
+    double full_bw;
+    size_t full_bw_rounds;
+    int64_t min_rtt_ns;
+    int64_t min_rtt_timestamp_ns;
+    int64_t last_sent_position;
+    int64_t last_sm_position;
+    int64_t last_sm_time_ns;
+    int64_t last_sm_send_time_ns;
+    int64_t app_limited_position;
+    aeron_send_pacer_mode_t mode;
+    double pacing_gain;
+    size_t cycle_index;
+    int64_t cycle_start_ns;
+    double tokens;
+    int64_t last_refill_ns;
+    size_t max_burst_length;
+    bool is_burst_limited;
+}
+aeron_send_pacer_t;
+
+int aeron_send_pacer_init(aeron_send_pacer_t *pacer, size_t max_burst_length, int64_t now_ns);
+
+/*
+ * Bytes that may be sent now, INT32_MAX until there is a bandwidth estimate to pace against.
+ */
+int32_t aeron_send_pacer_available(aeron_send_pacer_t *pacer, int64_t now_ns);
+
+/*
+ * Record bytes sent up to position. When is_app_limited the sender ran out of data rather than tokens, so delivery
+ * rate samples covering it are only taken when they raise the estimate.
+ */
+void aeron_send_pacer_on_send(
+    aeron_send_pacer_t *pacer, int64_t now_ns, int64_t position, int32_t bytes_sent, bool is_app_limited);
+
+void aeron_send_pacer_on_status_message(aeron_send_pacer_t *pacer, int64_t now_ns, int64_t consumption_position);
+
+/*
+ * Current pacing rate in bytes per second, 0 while unpaced.
+ */
+inline int64_t aeron_send_pacer_rate(aeron_send_pacer_t *pacer)
+{
+    return (int64_t)(pacer->pacing_gain * pacer->btl_bw * 1.0e9);
+}
+
+#endif //AERON_AERON_SEND_PACER_H
@@ -45,7 +45,16 @@ static aeron_system_counter_t system_counters[] =
         { "Unblocked Control Commands", AERON_SYSTEM_COUNTER_UNBLOCKED_COMMANDS },
         { "Possible TTL Asymmetry", AERON_SYSTEM_COUNTER_POSSIBLE_TTL_ASYMMETRY },
         { "ControllableIdleStrategy status", AERON_SYSTEM_COUNTER_CONTROLLABLE_IDLE_STRATEGY },
-        { "Loss gap fills", AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS}
+        { "Loss gap fills", AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS},
+        { "Receiver incoming CPU misalignments", AERON_SYSTEM_COUNTER_RECEIVER_INCOMING_CPU_MISALIGNMENTS },
+        { "FEC frames sent", AERON_SYSTEM_COUNTER_FEC_FRAMES_SENT },
+        { "FEC repairs", AERON_SYSTEM_COUNTER_FEC_REPAIRS },
+        { "Log buffer bytes resident", AERON_SYSTEM_COUNTER_LOG_BUFFER_RESIDENT_BYTES },
+        { "Log buffer bytes released", AERON_SYSTEM_COUNTER_LOG_BUFFER_RELEASED_BYTES },
+        { "Duplicate frames received", AERON_SYSTEM_COUNTER_DUPLICATE_FRAMES_RECEIVED },
+        { "Conductor commands waiting", AERON_SYSTEM_COUNTER_CONDUCTOR_COMMANDS_WAITING },
+        { "Conductor command max wait ns", AERON_SYSTEM_COUNTER_CONDUCTOR_COMMAND_MAX_WAIT_NS },
+        { "Checksum failures", AERON_SYSTEM_COUNTER_CHECKSUM_FAILURES }
     };
 
 static size_t num_system_counters = sizeof(system_counters)/sizeof(aeron_system_counter_t);
@@ -45,7 +45,16 @@ typedef enum aeron_system_counter_enum_stct
     AERON_SYSTEM_COUNTER_UNBLOCKED_COMMANDS = 20,
     AERON_SYSTEM_COUNTER_POSSIBLE_TTL_ASYMMETRY = 21,
     AERON_SYSTEM_COUNTER_CONTROLLABLE_IDLE_STRATEGY = 22,
-    AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS = 23
+    AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS = 23,
+    AERON_SYSTEM_COUNTER_RECEIVER_INCOMING_CPU_MISALIGNMENTS = 24,
+    AERON_SYSTEM_COUNTER_FEC_FRAMES_SENT = 25,
+    AERON_SYSTEM_COUNTER_FEC_REPAIRS = 26,
+    AERON_SYSTEM_COUNTER_LOG_BUFFER_RESIDENT_BYTES = 27,
+    AERON_SYSTEM_COUNTER_LOG_BUFFER_RELEASED_BYTES = 28,
+    AERON_SYSTEM_COUNTER_DUPLICATE_FRAMES_RECEIVED = 29,
+    AERON_SYSTEM_COUNTER_CONDUCTOR_COMMANDS_WAITING = 30,
+    AERON_SYSTEM_COUNTER_CONDUCTOR_COMMAND_MAX_WAIT_NS = 31,
+    AERON_SYSTEM_COUNTER_CHECKSUM_FAILURES = 32
 }
 aeron_system_counter_enum_t;
 
@@ -0,0 +1,176 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "util/aeron_arrayutil.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "aeron_alloc.h"
+#include "aeron_term_length_advisor.h"
+
+inline static int64_t aeron_term_length_advisor_stream_key(int32_t stream_id, bool is_ipc)
+{
+    return ((int64_t)(is_ipc ? 1 : 0) << 32) | (int64_t)(uint32_t)stream_id;
+}
+
+int aeron_term_length_advisor_init(
+    aeron_term_length_advisor_t *advisor,
+    aeron_counters_manager_t *counters_manager,
+    int64_t target_buffering_ns,
+    int64_t now_ns)
+{
+    advisor->streams.array = NULL;
+    advisor->streams.length = 0;
+    advisor->streams.capacity = 0;
+    advisor->counters_manager = counters_manager;
+    advisor->target_buffering_ns = target_buffering_ns;
+    advisor->time_of_last_sample_ns = now_ns;
+
+    return aeron_int64_to_ptr_hash_map_init(
+        &advisor->stream_by_key_map, 64, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR);
+}
+
+void aeron_term_length_advisor_close(aeron_term_length_advisor_t *advisor)
+{
+    for (size_t i = 0; i < advisor->streams.length; i++)
+    {
+        aeron_free(advisor->streams.array[i]);
+    }
+
+    aeron_free(advisor->streams.array);
+    aeron_int64_to_ptr_hash_map_delete(&advisor->stream_by_key_map);
+}
+
+static aeron_term_length_advisor_stream_t *aeron_term_length_advisor_get_or_add_stream(
+    aeron_term_length_advisor_t *advisor, int32_t stream_id, bool is_ipc)
+{
+    const int64_t key = aeron_term_length_advisor_stream_key(stream_id, is_ipc);
+    aeron_term_length_advisor_stream_t *stream = aeron_int64_to_ptr_hash_map_get(&advisor->stream_by_key_map, key);
+    int ensure_capacity_result = 0;
+
+    if (NULL != stream)
+    {
+        return stream;
+    }
+
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result, advisor->streams, aeron_term_length_advisor_stream_t *);
+    if (ensure_capacity_result < 0 || aeron_alloc((void **)&stream, sizeof(aeron_term_length_advisor_stream_t)) < 0)
+    {
+        return NULL;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_put(&advisor->stream_by_key_map, key, stream) < 0)
+    {
+        aeron_free(stream);
+        return NULL;
+    }
+
+    char label[sizeof(((aeron_counter_metadata_descriptor_t *)0)->label)];
+    int label_length = snprintf(
+        label, sizeof(label), "%s: %s %d", AERON_COUNTER_STREAM_RATE_NAME, is_ipc ? "ipc" : "udp", stream_id);
+    int32_t counter_id = aeron_counters_manager_allocate(
+        advisor->counters_manager,
+        AERON_COUNTER_STREAM_RATE_TYPE_ID,
+        (const uint8_t *)&key,
+        sizeof(key),
+        label,
+        (size_t)label_length);
+
+    stream->stream_id = stream_id;
+    stream->is_ipc = is_ipc;
+    stream->bytes_since_sample = 0;
+    stream->bytes_per_sec = 0;
+    stream->num_samples = 0;
+    /* the rate still drives term lengths when the counters are full, it just is not visible */
+    stream->rate_counter = counter_id >= 0 ? aeron_counter_addr(advisor->counters_manager, counter_id) : NULL;
+
+    advisor->streams.array[advisor->streams.length++] = stream;
+
+    return stream;
+}
+
+int aeron_term_length_advisor_on_bytes_appended(
+    aeron_term_length_advisor_t *advisor, int32_t stream_id, bool is_ipc, int64_t bytes)
+{
+    aeron_term_length_advisor_stream_t *stream = aeron_term_length_advisor_get_or_add_stream(
+        advisor, stream_id, is_ipc);
+
+    if (NULL == stream)
+    {
+        return -1;
+    }
+
+    stream->bytes_since_sample += bytes;
+
+    return 0;
+}
+
+void aeron_term_length_advisor_on_sample(aeron_term_length_advisor_t *advisor, int64_t now_ns)
+{
+    const int64_t interval_ns = now_ns - advisor->time_of_last_sample_ns;
+
+    if (interval_ns <= 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < advisor->streams.length; i++)
+    {
+        aeron_term_length_advisor_stream_t *stream = advisor->streams.array[i];
+        const int64_t sample = (int64_t)(((double)stream->bytes_since_sample * 1e9) / (double)interval_ns);
+
+        stream->bytes_per_sec += (sample - stream->bytes_per_sec) >> AERON_TERM_LENGTH_ADVISOR_RATE_SMOOTHING_SHIFT;
+        stream->bytes_since_sample = 0;
+        stream->num_samples++;
+
+        if (NULL != stream->rate_counter)
+        {
+            aeron_counter_set_ordered(stream->rate_counter, stream->bytes_per_sec);
+        }
+    }
+
+    advisor->time_of_last_sample_ns = now_ns;
+}
+
+size_t aeron_term_length_advisor_term_length(
+    aeron_term_length_advisor_t *advisor, int32_t stream_id, bool is_ipc, size_t max_term_length)
+{
+    aeron_term_length_advisor_stream_t *stream = aeron_int64_to_ptr_hash_map_get(
+        &advisor->stream_by_key_map, aeron_term_length_advisor_stream_key(stream_id, is_ipc));
+
+    if (NULL == stream || stream->num_samples < AERON_TERM_LENGTH_ADVISOR_MIN_SAMPLES ||
+        advisor->target_buffering_ns <= 0)
+    {
+        return max_term_length;
+    }
+
+    /* the publication window is half a term, so the term holds twice what is to be buffered */
+    const double buffered_bytes = 2.0 * (double)stream->bytes_per_sec * (double)advisor->target_buffering_ns / 1e9;
+
+    if (buffered_bytes >= (double)max_term_length)
+    {
+        return max_term_length;
+    }
+
+    size_t term_length = AERON_LOGBUFFER_TERM_MIN_LENGTH;
+    while (term_length < (size_t)buffered_bytes && term_length < max_term_length)
+    {
+        term_length <<= 1;
+    }
+
+    return term_length < max_term_length ? term_length : max_term_length;
+}
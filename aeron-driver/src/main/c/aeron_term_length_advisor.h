@@ -0,0 +1,89 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_TERM_LENGTH_ADVISOR_H
+#define AERON_AERON_TERM_LENGTH_ADVISOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "concurrent/aeron_counters_manager.h"
+#include "collections/aeron_int64_to_ptr_hash_map.h"
+
+#define AERON_COUNTER_STREAM_RATE_NAME "stream-rate"
+#define AERON_COUNTER_STREAM_RATE_TYPE_ID (18)
+
+/* each sample moves the rate an eighth of the way, so a burst has to last several intervals to count */
+#define AERON_TERM_LENGTH_ADVISOR_RATE_SMOOTHING_SHIFT (3)
+#define AERON_TERM_LENGTH_ADVISOR_MIN_SAMPLES (1 << AERON_TERM_LENGTH_ADVISOR_RATE_SMOOTHING_SHIFT)
+
+typedef struct aeron_term_length_advisor_stream_stct
+{
+    int32_t stream_id;
+    bool is_ipc;
+    int64_t bytes_since_sample;
+    int64_t bytes_per_sec;
+    int64_t num_samples;
+    int64_t *rate_counter;
+}
+aeron_term_length_advisor_stream_t;
+
+/*
+ * Tracks the sustained rate publishers append at for each stream, across all its sessions, and publishes it in a
+ * stream-rate counter in bytes per second. New sessions of a stream take the term length that holds the target time
+ * of buffering at that rate, rounded up to a power of two, instead of the configured term length which becomes the
+ * upper bound. Streams not yet seen for long enough for the rate to settle keep the configured length.
+ */
+typedef struct aeron_term_length_advisor_stct
+{
+    struct aeron_term_length_advisor_streams_stct
+    {
+        aeron_term_length_advisor_stream_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    streams;
+
+    /* stream key -> stream */
+    aeron_int64_to_ptr_hash_map_t stream_by_key_map;
+    aeron_counters_manager_t *counters_manager;
+    int64_t target_buffering_ns;
+    int64_t time_of_last_sample_ns;
+}
+aeron_term_length_advisor_t;
+
+int aeron_term_length_advisor_init(
+    aeron_term_length_advisor_t *advisor,
+    aeron_counters_manager_t *counters_manager,
+    int64_t target_buffering_ns,
+    int64_t now_ns);
+
+void aeron_term_length_advisor_close(aeron_term_length_advisor_t *advisor);
+
+/*
+ * Count bytes appended to a publication of the stream since the last call for it.
+ */
+int aeron_term_length_advisor_on_bytes_appended(
+    aeron_term_length_advisor_t *advisor, int32_t stream_id, bool is_ipc, int64_t bytes);
+
+/*
+ * Fold the bytes counted since the last sample into each stream rate.
+ */
+void aeron_term_length_advisor_on_sample(aeron_term_length_advisor_t *advisor, int64_t now_ns);
+
+size_t aeron_term_length_advisor_term_length(
+    aeron_term_length_advisor_t *advisor, int32_t stream_id, bool is_ipc, size_t max_term_length);
+
+#endif //AERON_AERON_TERM_LENGTH_ADVISOR_H
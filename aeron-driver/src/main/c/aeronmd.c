@@ -24,7 +24,9 @@
 #include <time.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include "aeronmd.h"
+#include "aeron_driver.h"
 #include "concurrent/aeron_atomic.h"
 
 volatile bool running = true;
@@ -41,6 +43,170 @@ inline bool is_running()
     return result;
 }
 
+static int host_tenants(const char *tenant_dirs)
+{
+    int status = EXIT_FAILURE;
+    aeron_driver_context_t *contexts[AERON_DRIVER_HOST_MAX_TENANTS] = { NULL };
+    aeron_driver_t *drivers[AERON_DRIVER_HOST_MAX_TENANTS] = { NULL };
+    aeron_driver_host_t *host = NULL;
+    char dirs[AERON_MAX_PATH * 4];
+    char *saveptr = NULL;
+    size_t count = 0;
+
+    if (strlen(tenant_dirs) >= sizeof(dirs))
+    {
+        fprintf(stderr, "ERROR: tenant dirs longer than %d\n", (int)sizeof(dirs) - 1);
+        return EXIT_FAILURE;
+    }
+
+    snprintf(dirs, sizeof(dirs), "%s", tenant_dirs);
+
+    for (char *dir = strtok_r(dirs, ",", &saveptr); NULL != dir; dir = strtok_r(NULL, ",", &saveptr))
+    {
+        if (AERON_DRIVER_HOST_MAX_TENANTS == count)
+        {
+            fprintf(stderr, "ERROR: more than %d tenant dirs\n", AERON_DRIVER_HOST_MAX_TENANTS);
+            goto cleanup;
+        }
+
+        /* counted before it is set up so the cleanup closes whatever of it was initialised */
+        const size_t tenant = count++;
+
+        if (aeron_driver_context_init(&contexts[tenant]) < 0)
+        {
+            fprintf(stderr, "ERROR: context init %s (%d) %s\n", dir, aeron_errcode(), aeron_errmsg());
+            goto cleanup;
+        }
+
+        if (strlen(dir) >= AERON_MAX_PATH - 1)
+        {
+            fprintf(stderr, "ERROR: tenant dir longer than %d: %s\n", AERON_MAX_PATH - 2, dir);
+            goto cleanup;
+        }
+
+        snprintf(contexts[tenant]->aeron_dir, AERON_MAX_PATH - 1, "%s", dir);
+
+        if (aeron_driver_init(&drivers[tenant], contexts[tenant]) < 0)
+        {
+            fprintf(stderr, "ERROR: driver init %s (%d) %s\n", dir, aeron_errcode(), aeron_errmsg());
+            goto cleanup;
+        }
+    }
+
+    if (aeron_driver_host_init(&host, drivers, count) < 0)
+    {
+        fprintf(stderr, "ERROR: driver host init (%d) %s\n", aeron_errcode(), aeron_errmsg());
+        goto cleanup;
+    }
+
+    if (aeron_driver_host_start(host) < 0)
+    {
+        fprintf(stderr, "ERROR: driver host start (%d) %s\n", aeron_errcode(), aeron_errmsg());
+        goto cleanup;
+    }
+
+    while (is_running())
+    {
+        struct timespec ts = { .tv_sec = 0, .tv_nsec = 1000 * 1000 };
+        nanosleep(&ts, NULL);
+    }
+
+    printf("Shutting down drivers...\n");
+    status = EXIT_SUCCESS;
+
+    cleanup:
+
+    /* the host closes the drivers it was given, otherwise each tenant closes its own as main does */
+    if (NULL != host && aeron_driver_host_close(host) < 0)
+    {
+        fprintf(stderr, "ERROR: driver host close (%d) %s\n", aeron_errcode(), aeron_errmsg());
+        status = EXIT_FAILURE;
+    }
+
+    for (size_t i = count; i > 0; i--)
+    {
+        if (NULL == host && NULL != drivers[i - 1])
+        {
+            aeron_driver_close(drivers[i - 1]);
+        }
+
+        if (NULL != contexts[i - 1])
+        {
+            aeron_driver_context_close(contexts[i - 1]);
+        }
+    }
+
+    return status;
+}
+
+static int run_shards(size_t shard_count)
+{
+    int status = EXIT_FAILURE;
+    aeron_driver_context_t *contexts[AERON_DRIVER_MAX_SHARDS];
+    aeron_driver_t *drivers[AERON_DRIVER_MAX_SHARDS];
+    size_t count = 0;
+
+    for (; count < shard_count; count++)
+    {
+        contexts[count] = NULL;
+        drivers[count] = NULL;
+
+        if (aeron_driver_context_init(&contexts[count]) < 0)
+        {
+            fprintf(stderr, "ERROR: context init (%d) %s\n", aeron_errcode(), aeron_errmsg());
+            goto cleanup;
+        }
+
+        aeron_driver_context_t *context = contexts[count];
+        const size_t dir_length = strlen(context->aeron_dir);
+
+        snprintf(context->aeron_dir + dir_length, AERON_MAX_PATH - 1 - dir_length, "-%d", (int)count);
+        context->threading_mode = AERON_THREADING_MODE_SHARED;
+        context->shared_cpu_affinity =
+            context->shared_cpu_affinity < 0 ? -1 : context->shared_cpu_affinity + (int32_t)count;
+
+        if (aeron_driver_init(&drivers[count], context) < 0)
+        {
+            fprintf(stderr, "ERROR: driver init %s (%d) %s\n", context->aeron_dir, aeron_errcode(), aeron_errmsg());
+            count++;
+            goto cleanup;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (aeron_driver_start(drivers[i], false) < 0)
+        {
+            fprintf(
+                stderr, "ERROR: driver start %s (%d) %s\n", contexts[i]->aeron_dir, aeron_errcode(), aeron_errmsg());
+            goto cleanup;
+        }
+    }
+
+    while (is_running())
+    {
+        struct timespec ts = { .tv_sec = 0, .tv_nsec = 1000 * 1000 };
+        nanosleep(&ts, NULL);
+    }
+
+    printf("Shutting down drivers...\n");
+    status = EXIT_SUCCESS;
+
+    cleanup:
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (NULL != drivers[i])
+        {
+            aeron_driver_close(drivers[i]);
+        }
+
+        aeron_driver_context_close(contexts[i]);
+    }
+
+    return status;
+}
+
 int main(int argc, char **argv)
 {
     int status = EXIT_FAILURE;
@@ -49,6 +215,29 @@ int main(int argc, char **argv)
 
     signal(SIGINT, sigint_handler);
 
+    const char *tenant_dirs = getenv(AERON_DRIVER_TENANT_DIRS_ENV_VAR);
+    if (NULL != tenant_dirs && '\0' != *tenant_dirs)
+    {
+        return host_tenants(tenant_dirs);
+    }
+
+    const char *shards = getenv(AERON_DRIVER_SHARDS_ENV_VAR);
+    if (NULL != shards && '\0' != *shards)
+    {
+        const unsigned long shard_count = strtoul(shards, NULL, 10);
+
+        if (shard_count < 1 || shard_count > AERON_DRIVER_MAX_SHARDS)
+        {
+            fprintf(stderr, "ERROR: %s must be 1 to %d\n", AERON_DRIVER_SHARDS_ENV_VAR, AERON_DRIVER_MAX_SHARDS);
+            return EXIT_FAILURE;
+        }
+
+        if (shard_count > 1)
+        {
+            return run_shards((size_t)shard_count);
+        }
+    }
+
     if (aeron_driver_context_init(&context) < 0)
     {
         fprintf(stderr, "ERROR: context init (%d) %s\n", aeron_errcode(), aeron_errmsg());
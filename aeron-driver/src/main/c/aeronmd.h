@@ -27,6 +27,7 @@ extern "C"
 
 typedef struct aeron_driver_context_stct aeron_driver_context_t;
 typedef struct aeron_driver_stct aeron_driver_t;
+typedef struct aeron_driver_host_stct aeron_driver_host_t;
 
 /**
  * Environment variables used for setting values of an aeron_driver_context_t.
@@ -37,6 +38,20 @@ typedef struct aeron_driver_stct aeron_driver_t;
  */
 #define AERON_DIR_ENV_VAR "AERON_DIR"
 
+/**
+ * Comma separated aeron directories for aeronmd to host in one process, one driver per directory with its own CnC and
+ * conductor thread, and the senders and receivers of them all sharing a sender thread and a receiver thread.
+ */
+#define AERON_DRIVER_TENANT_DIRS_ENV_VAR "AERON_DRIVER_TENANT_DIRS"
+
+/**
+ * Number of shards for aeronmd to run in one process, each a driver sharing nothing with the others: its own aeron
+ * directory of AERON_DIR suffixed with -<shard index>, with its own CnC for clients of the shard to connect to, and
+ * its conductor, sender and receiver on one thread. Shard threads are pinned to consecutive CPUs from
+ * AERON_SHARED_CPU_AFFINITY when it is set. Unset or 1 runs a single driver as configured.
+ */
+#define AERON_DRIVER_SHARDS_ENV_VAR "AERON_DRIVER_SHARDS"
+
 /**
  * Threading Mode to be used by the driver.
  */
@@ -47,6 +62,12 @@ typedef struct aeron_driver_stct aeron_driver_t;
  */
 #define AERON_DIR_DELETE_ON_START_ENV_VAR "AERON_DIR_DELETE_ON_START"
 
+/**
+ * Reuse the CnC, loss report and log buffer files left by an earlier driver rather than recreating them, only their
+ * contents are reset. Saves the file creation and page faults of a restart that would otherwise delete the directory.
+ */
+#define AERON_DIR_WARM_RESTART_ENV_VAR "AERON_DIR_WARM_RESTART"
+
 /**
  * Length (in bytes) of the conductor buffer for control commands from the clients to the media driver conductor.
  */
@@ -82,11 +103,41 @@ typedef struct aeron_driver_stct aeron_driver_t;
  */
 #define AERON_IPC_TERM_BUFFER_LENGTH_ENV_VAR "AERON_IPC_TERM_BUFFER_LENGTH"
 
+/**
+ * Maximum length (in bytes) of a used term region the conductor zeroes in one duty cycle, so cleaning large terms is
+ * spread over several cycles rather than stalling one. 0 cleans the remainder of a term in one go.
+ */
+#define AERON_TERM_BUFFER_CLEAN_CHUNK_LENGTH_ENV_VAR "AERON_TERM_BUFFER_CLEAN_CHUNK_LENGTH"
+
 /**
  * Should term buffers be created sparse.
  */
 #define AERON_TERM_BUFFER_SPARSE_FILE_ENV_VAR "AERON_TERM_BUFFER_SPARSE_FILE"
 
+/**
+ * Should term buffers be faulted in when mapped so the first messages do not page fault. Pooled logs are faulted in
+ * by the raw log pool agent ahead of use, others by the conductor as they are mapped.
+ */
+#define AERON_TERM_BUFFER_PREFAULT_ENV_VAR "AERON_TERM_BUFFER_PREFAULT"
+
+/**
+ * Should term buffers be locked in memory with mlock. Needs a memlock limit that covers all the logs in use.
+ */
+#define AERON_TERM_BUFFER_LOCK_ENV_VAR "AERON_TERM_BUFFER_LOCK"
+
+/**
+ * Should pages of log buffers be released back to the file system once every consumer has passed them, as is always
+ * done for sparse files, and the resident bytes of log buffers be tracked in a system counter.
+ */
+#define AERON_TERM_BUFFER_RELEASE_PAGES_ENV_VAR "AERON_TERM_BUFFER_RELEASE_PAGES"
+
+/**
+ * Time in nanoseconds of buffering a term should hold at the sustained rate of its stream. When set, new sessions of
+ * a stream without a term length on the channel get the smallest power of two term length that holds it, capped at
+ * the configured term length. The rates are published in stream-rate counters. 0 keeps terms at the configured length.
+ */
+#define AERON_TERM_BUFFER_AUTO_SIZE_TARGET_ENV_VAR "AERON_TERM_BUFFER_AUTO_SIZE_TARGET"
+
 /**
  * Should storage checks should be performed when allocating files.
  */
@@ -98,7 +149,8 @@ typedef struct aeron_driver_stct aeron_driver_t;
 #define AERON_SPIES_SIMULATE_CONNECTION_ENV_VAR "AERON_SPIES_SIMULATE_CONNECTION"
 
 /**
- * Page size for alignment of all files.
+ * Page size for alignment of all files. A huge page size (2MB or more) also advises the kernel to back term buffers
+ * and the CnC file with huge pages, and should be used when the aeron dir is on hugetlbfs.
  */
 #define AERON_FILE_PAGE_SIZE_ENV_VAR "AERON_FILE_PAGE_SIZE"
 
@@ -127,11 +179,29 @@ typedef struct aeron_driver_stct aeron_driver_t;
  */
 #define AERON_PUBLICATION_LINGER_TIMEOUT_ENV_VAR "AERON_PUBLICATION_LINGER_TIMEOUT"
 
+/**
+ * Timeout in nanoseconds for which a publication with a resume-token is held, without end of stream, after its last
+ * client has gone so a restarted publisher adding it with the same token can carry on with its session and position.
+ */
+#define AERON_PUBLICATION_RESUME_TIMEOUT_ENV_VAR "AERON_PUBLICATION_RESUME_TIMEOUT"
+
 /**
  * SO_RCVBUF setting on UDP sockets which must be sufficient for Bandwidth Delay Product (BDP).
  */
 #define AERON_SOCKET_SO_RCVBUF_ENV_VAR "AERON_SOCKET_SO_RCVBUF"
 
+/**
+ * Track datagrams the kernel drops for a full receive buffer on each receive channel endpoint, using SO_RXQ_OVFL, in
+ * a rcv-socket-drops counter per endpoint. Such drops otherwise look like loss on the network.
+ */
+#define AERON_SOCKET_DROP_MONITORING_ENV_VAR "AERON_SOCKET_DROP_MONITORING"
+
+/**
+ * Largest SO_RCVBUF a receive channel endpoint with drop monitoring grows its socket buffer to, doubling it each time
+ * drops are seen. 0, the default, never grows it. The kernel still caps it at net.core.rmem_max.
+ */
+#define AERON_SOCKET_SO_RCVBUF_MAX_ENV_VAR "AERON_SOCKET_SO_RCVBUF_MAX"
+
 /**
  * SO_SNDBUF setting on UDP sockets which must be sufficient for Bandwidth Delay Product (BDP).
  */
@@ -142,18 +212,154 @@ typedef struct aeron_driver_stct aeron_driver_t;
  */
 #define AERON_SOCKET_MULTICAST_TTL_ENV_VAR "AERON_SOCKET_MULTICAST_TTL"
 
+/**
+ * Use io_uring for receiving on UDP sockets when supported by the kernel, otherwise recvmmsg is used.
+ */
+#define AERON_SOCKET_IO_URING_ENV_VAR "AERON_SOCKET_IO_URING"
+
+/**
+ * Use UDP generic segmentation offload (UDP_SEGMENT) to send runs of equal length datagrams with a single buffer.
+ */
+#define AERON_SOCKET_GSO_ENV_VAR "AERON_SOCKET_GSO"
+
+/**
+ * Enable UDP generic receive offload (UDP_GRO) on receive sockets. Coalesced datagrams are split before dispatch.
+ */
+#define AERON_SOCKET_GRO_ENV_VAR "AERON_SOCKET_GRO"
+
+/**
+ * SO_BUSY_POLL time in microseconds for receive sockets, 0 leaves kernel busy polling off.
+ */
+#define AERON_SOCKET_BUSY_POLL_ENV_VAR "AERON_SOCKET_BUSY_POLL"
+
+/**
+ * Set SO_PREFER_BUSY_POLL on receive sockets so busy polling is preferred over interrupt driven processing.
+ */
+#define AERON_SOCKET_PREFER_BUSY_POLL_ENV_VAR "AERON_SOCKET_PREFER_BUSY_POLL"
+
+/**
+ * Enable SO_TIMESTAMPING receive timestamps on receive sockets and track per image wire and driver latency counters.
+ */
+#define AERON_SOCKET_RX_TIMESTAMPING_ENV_VAR "AERON_SOCKET_RX_TIMESTAMPING"
+
+/**
+ * Keep bytes per second and queue depth counters for each network publication, and bytes per second, subscriber lag
+ * and round trip time counters for each image.
+ */
+#define AERON_STREAM_STATS_ENV_VAR "AERON_STREAM_STATS"
+
+/**
+ * Connect the socket of a unicast send channel without control to its single destination so messages are sent
+ * without an address. Saves a route lookup per message in the kernel. Only status messages and NAKs from the
+ * destination address are then received, so receivers must reply from the endpoint they are sent to.
+ */
+#define AERON_SOCKET_CONNECTED_SEND_ENV_VAR "AERON_SOCKET_CONNECTED_SEND"
+
+/**
+ * Pace network publications at a rate estimated BBR style from status messages rather than sending up to the flow
+ * control window as fast as possible. Intended for unicast over links with shallow switch buffers.
+ */
+#define AERON_SEND_PACING_ENV_VAR "AERON_SEND_PACING"
+
+/**
+ * Discover the largest datagram that reaches the receivers of each unicast publication, by probing with fragmentation
+ * disallowed once connected, and coalesce frames into datagrams of up to that length. Frames keep the MTU length
+ * clients fragment to. Overridden per channel with pmtu-discovery.
+ */
+#define AERON_PMTU_DISCOVERY_ENV_VAR "AERON_PMTU_DISCOVERY"
+
+/**
+ * Largest datagram path MTU discovery probes for. Defaults to the largest aligned UDP payload of a 9000 byte jumbo
+ * frame.
+ */
+#define AERON_PMTU_DISCOVERY_MAX_LENGTH_ENV_VAR "AERON_PMTU_DISCOVERY_MAX_LENGTH"
+
+/**
+ * Number of sender agents. Send channel endpoints, and so their publications, are assigned to the least loaded sender
+ * when created unless the channel names one with sender-affinity.
+ */
+#define AERON_SENDER_COUNT_ENV_VAR "AERON_SENDER_COUNT"
+
+/**
+ * Number of receiver agents. Receive channel endpoints are assigned to the least loaded receiver when created.
+ */
+#define AERON_RECEIVER_COUNT_ENV_VAR "AERON_RECEIVER_COUNT"
+
+/**
+ * Number of datagrams a sender reads for status and NAK messages with a single recvmmsg.
+ */
+#define AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR "AERON_SENDER_IO_VECTOR_CAPACITY"
+
+/**
+ * Number of datagrams a receiver reads with a single recvmmsg. Each one is backed by a 64KB buffer.
+ */
+#define AERON_RECEIVER_IO_VECTOR_CAPACITY_ENV_VAR "AERON_RECEIVER_IO_VECTOR_CAPACITY"
+
+/**
+ * Number of raw logs to keep created ahead of time for each of the default term lengths. A background agent
+ * replenishes the pool so adding a publication or image does not wait on file creation. 0 disables the pool.
+ */
+#define AERON_RAW_LOG_POOL_SIZE_ENV_VAR "AERON_RAW_LOG_POOL_SIZE"
+
+/**
+ * CPU to pin the conductor thread to in DEDICATED and SHARED_NETWORK modes. -1 leaves it unpinned.
+ */
+#define AERON_CONDUCTOR_CPU_AFFINITY_ENV_VAR "AERON_CONDUCTOR_CPU_AFFINITY"
+
+/**
+ * CPU to pin the first sender thread to, further senders take the following CPUs. -1 leaves them unpinned.
+ */
+#define AERON_SENDER_CPU_AFFINITY_ENV_VAR "AERON_SENDER_CPU_AFFINITY"
+
+/**
+ * CPU to pin the first receiver thread to, further receivers take the following CPUs. -1 leaves them unpinned.
+ */
+#define AERON_RECEIVER_CPU_AFFINITY_ENV_VAR "AERON_RECEIVER_CPU_AFFINITY"
+
+/**
+ * CPU to pin the combined sender and receiver thread to in SHARED_NETWORK mode. -1 leaves it unpinned.
+ */
+#define AERON_SHARED_NETWORK_CPU_AFFINITY_ENV_VAR "AERON_SHARED_NETWORK_CPU_AFFINITY"
+
+/**
+ * CPU to pin the single driver thread to in SHARED mode. -1 leaves it unpinned.
+ */
+#define AERON_SHARED_CPU_AFFINITY_ENV_VAR "AERON_SHARED_CPU_AFFINITY"
+
+/**
+ * Bind network publication log buffers to the NUMA node of their pinned sender, and images to that of their pinned
+ * receiver. A publication channel can name a node with numa-node, which is how IPC publications are bound.
+ */
+#define AERON_NUMA_BIND_LOG_BUFFERS_ENV_VAR "AERON_NUMA_BIND_LOG_BUFFERS"
+
 /**
  * Ratio of sending data to polling status messages in the Sender.
  */
 #define AERON_SEND_TO_STATUS_POLL_RATIO_ENV_VAR "AERON_SEND_TO_STATUS_POLL_RATIO"
 
+/**
+ * Adapt the ratio of sending data to polling status messages in the Sender to the flow control window left: poll each
+ * duty cycle while a publication has less than a quarter of its receiver window left and at half the rate while all
+ * have more than three quarters left.
+ */
+#define AERON_SEND_TO_STATUS_POLL_ADAPTIVE_ENV_VAR "AERON_SEND_TO_STATUS_POLL_ADAPTIVE"
+
 /**
  * Status Message timeout in nanoseconds.
  */
 #define AERON_RCV_STATUS_MESSAGE_TIMEOUT_ENV_VAR "AERON_RCV_STATUS_MESSAGE_TIMEOUT"
 
 /**
- * Supplier for flow control structure to be employed for multicast channels.
+ * Should images adapt when they send Status Messages: sooner as consumption frees window the sender is about to run
+ * out of, and progressively less often, up to 4x the timeout, while the sender is idle and the subscribers caught up.
+ */
+#define AERON_RCV_STATUS_MESSAGE_ADAPTIVE_ENV_VAR "AERON_RCV_STATUS_MESSAGE_ADAPTIVE"
+
+/**
+ * Supplier for flow control structure to be employed for multicast channels. Besides the default
+ * aeron_max_multicast_flow_control_strategy_supplier there are aeron_min_multicast_flow_control_strategy_supplier and
+ * aeron_tagged_multicast_flow_control_strategy_supplier. A channel can pick one of these with its fc parameter,
+ * e.g. fc=min,t:5s or fc=tagged,g:100, where t is the receiver timeout and g the group tag, which tagged requires.
  */
 #define AERON_MULTICAST_FLOWCONTROL_SUPPLIER_ENV_VAR "AERON_MULTICAST_FLOWCONTROL_SUPPLIER"
 
@@ -162,31 +368,107 @@ typedef struct aeron_driver_stct aeron_driver_t;
  */
 #define AERON_UNICAST_FLOWCONTROL_SUPPLIER_ENV_VAR "AERON_UNICAST_FLOWCONTROL_SUPPLIER"
 
+/**
+ * Group tag receivers put on their status messages so tagged flow control can tell which receivers to wait for.
+ * Unset by default and can be overridden for a subscription with the channel's gtag parameter.
+ */
+#define AERON_RECEIVER_GROUP_TAG_ENV_VAR "AERON_RECEIVER_GROUP_TAG"
+
 /**
  * Image liveness timeout in nanoseconds
  */
 #define AERON_IMAGE_LIVENESS_TIMEOUT_ENV_VAR "AERON_IMAGE_LIVENESS_TIMEOUT"
 
+/**
+ * Longest time in nanoseconds a receiver holds back the NAK for a gap in an image in case the gap is filled by data
+ * that was reordered on the way, e.g. over bonded links. Each image learns its window up to this from the gaps it
+ * sees filled without a NAK. 0 disables, and gaps are NAKed after the usual feedback delay.
+ */
+#define AERON_RCV_REORDER_WINDOW_MAX_ENV_VAR "AERON_RCV_REORDER_WINDOW_MAX"
+
+/**
+ * Time in nanoseconds a gap in an image subscribed to with reliable=false is left before it is filled with padding
+ * so subscribers move past the loss. Such images never NAK. 0 fills gaps as soon as they are seen.
+ */
+#define AERON_RCV_GAP_FILL_DELAY_ENV_VAR "AERON_RCV_GAP_FILL_DELAY"
+
+/**
+ * Have receivers of multicast channels join the control group to overhear the NAKs of other receivers, and hold back
+ * their own NAKs for gaps already NAKed, so a loss shared by a large group brings one NAK rather than one from each.
+ */
+#define AERON_RCV_NAK_SUPPRESSION_ENV_VAR "AERON_RCV_NAK_SUPPRESSION"
+
 /**
  * Length of the initial window which must be sufficient for Bandwidth Delay Product (BDP).
  */
 #define AERON_RCV_INITIAL_WINDOW_LENGTH_ENV_VAR "AERON_RCV_INITIAL_WINDOW_LENGTH"
 
+/**
+ * Frame length (in bytes) at or above which received frames are copied into images with non-temporal stores so they
+ * do not pollute the receiver's caches. 0 disables, which suits subscribers that read from the same cache.
+ */
+#define AERON_RCV_NON_TEMPORAL_COPY_THRESHOLD_ENV_VAR "AERON_RCV_NON_TEMPORAL_COPY_THRESHOLD"
+
 /**
  * Supplier for congestion control structure to be employed for Images.
  */
 #define AERON_CONGESTIONCONTROL_SUPPLIER_ENV_VAR "AERON_CONGESTIONCONTROL_SUPPLIER"
 
+/**
+ * Should the CUBIC congestion control (aeron_cubic_congestion_control_strategy_supplier) measure RTT with RTTM
+ * frames to pace window growth. If not the initial RTT is used throughout.
+ */
+#define AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_MEASURERTT"
+
+/**
+ * Initial RTT in nanoseconds assumed by the CUBIC congestion control before any measurement.
+ */
+#define AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_INITIALRTT"
+
+/**
+ * Should the CUBIC congestion control grow the window no slower than TCP Reno would in the same conditions.
+ */
+#define AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_TCPMODE"
+
+/**
+ * Bindings for the media used by UDP channel endpoints. Can be overridden per channel with media-bindings.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA"
+
 /**
  * Length (in bytes) of the buffer for the loss report log.
  */
 #define AERON_LOSS_REPORT_BUFFER_LENGTH_ENV_VAR "AERON_LOSS_REPORT_BUFFER_LENGTH"
 
+/**
+ * Length (in bytes) of the ring of sender and publication limit changes traced to flow-control-trace.dat, 0 for none.
+ */
+#define AERON_FLOW_CONTROL_TRACE_BUFFER_LENGTH_ENV_VAR "AERON_FLOW_CONTROL_TRACE_BUFFER_LENGTH"
+
+/**
+ * Number of publications each sender, and images each receiver, writes the positions of to position-snapshot.dat once
+ * per duty cycle so monitoring tools can read them all from the same moment, 0 for none.
+ */
+#define AERON_POSITION_SNAPSHOT_CAPACITY_ENV_VAR "AERON_POSITION_SNAPSHOT_CAPACITY"
+
+/**
+ * Number of entries, a power of two, in the ring of streams with new data the conductor writes to stream-activity.dat
+ * so consumers of many streams can poll only those that moved on, 0 for none.
+ */
+#define AERON_STREAM_ACTIVITY_CAPACITY_ENV_VAR "AERON_STREAM_ACTIVITY_CAPACITY"
+
 /**
  * Timeout for publication unblock in nanoseconds.
  */
 #define AERON_PUBLICATION_UNBLOCK_TIMEOUT_ENV_VAR "AERON_PUBLICATION_UNBLOCK_TIMEOUT"
 
+/**
+ * Shortest timeout for publication unblock in nanoseconds, 0 to always wait the unblock timeout. When set the timeout
+ * adapts to a multiple of the longest stall of a publication that cleared without being unblocked, so a dead publisher
+ * on a stream where claims are committed promptly is unblocked sooner.
+ */
+#define AERON_PUBLICATION_UNBLOCK_TIMEOUT_MIN_ENV_VAR "AERON_PUBLICATION_UNBLOCK_TIMEOUT_MIN"
+
 /**
  * Timeout for publication connection in nanoseconds.
  */
@@ -217,11 +499,37 @@ typedef struct aeron_driver_stct aeron_driver_t;
  */
 #define AERON_SHAREDNETWORK_IDLE_STRATEGY_ENV_VAR "AERON_SHAREDNETWORK_IDLE_STRATEGY"
 
+/**
+ * Nano clock used by the driver: "system" for CLOCK_MONOTONIC_RAW, or "tsc" for the TSC calibrated against it at
+ * startup, which needs an invariant TSC and is cheaper to read where clock_gettime is slow such as on virtual machines.
+ */
+#define AERON_NANO_CLOCK_ENV_VAR "AERON_NANO_CLOCK"
+
 /**
  * Idle strategy to be employed by Conductor, Sender, and Receiver for SHARED Threading Mode.
  */
 #define AERON_SHARED_IDLE_STRATEGY_ENV_VAR "AERON_SHARED_IDLE_STRATEGY"
 
+/**
+ * Number of pause spins the backoff idle strategy makes before it starts yielding.
+ */
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS_ENV_VAR "AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS"
+
+/**
+ * Number of yields the backoff idle strategy makes before it starts sleeping.
+ */
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS_ENV_VAR "AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS"
+
+/**
+ * First sleep period in nanoseconds of the backoff idle strategy, doubled on each idle call after that.
+ */
+#define AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD_ENV_VAR "AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD"
+
+/**
+ * Longest sleep period in nanoseconds of the backoff idle strategy.
+ */
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD_ENV_VAR "AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD"
+
 /**
  * Function name to call on start of each agent.
  */
@@ -232,6 +540,61 @@ typedef struct aeron_driver_stct aeron_driver_t;
  */
 #define AERON_COUNTERS_FREE_TO_REUSE_TIMEOUT_ENV_VAR "AERON_COUNTERS_FREE_TO_REUSE_TIMEOUT"
 
+/**
+ * Time in nanoseconds for which the conductor reuses the resolved addresses of a UDP channel when the same channel is
+ * added again before resolving its endpoint, control and interface afresh. 0 resolves on every add.
+ */
+#define AERON_UDP_CHANNEL_CACHE_TTL_ENV_VAR "AERON_UDP_CHANNEL_CACHE_TTL"
+
+/**
+ * Resolve the channels of added publications and subscriptions on a background agent, completing the command once the
+ * channel is resolved, so one slow DNS lookup does not hold up the commands of other clients. Failed resolutions are
+ * cached for the UDP channel cache TTL as well. Needs the UDP channel cache, so has no effect when its TTL is 0.
+ */
+#define AERON_ASYNC_NAME_RESOLUTION_ENV_VAR "AERON_ASYNC_NAME_RESOLUTION"
+
+/**
+ * Time the duty cycles of the conductor, sender and receiver agents into counters: the max cycle time, a histogram,
+ * how often a threshold was exceeded and the timestamp of the latest cycle.
+ */
+#define AERON_DUTY_CYCLE_TRACKING_ENV_VAR "AERON_DUTY_CYCLE_TRACKING"
+
+/**
+ * Duty cycle time in nanoseconds above which a cycle is counted as exceeding the threshold.
+ */
+#define AERON_DUTY_CYCLE_THRESHOLD_ENV_VAR "AERON_DUTY_CYCLE_THRESHOLD"
+
+/**
+ * Let clients compute the publisher limit of IPC publications from the subscriber positions the driver lists in the
+ * log meta data, so back pressure is relieved as soon as subscribers consume rather than on the next conductor cycle.
+ */
+#define AERON_IPC_CLIENT_PUBLISHER_LIMIT_ENV_VAR "AERON_IPC_CLIENT_PUBLISHER_LIMIT"
+
+/**
+ * Have publishers to IPC streams wake subscribers parked on the log waiting for data, at the cost of a locked add per
+ * append to check for them.
+ */
+#define AERON_IPC_SUBSCRIBER_WAKEUP_ENV_VAR "AERON_IPC_SUBSCRIBER_WAKEUP"
+
+/**
+ * Notify clients of a new image linked to many subscriptions with one message carrying the image once, rather than
+ * one message per subscription. Clients must understand the batched message.
+ */
+#define AERON_AVAILABLE_IMAGE_BATCHING_ENV_VAR "AERON_AVAILABLE_IMAGE_BATCHING"
+
+/**
+ * Directory on persistent storage for the logs of IPC publications added with durable=true. Each run of the driver
+ * keeps its logs in a directory of its own under it, named for the start time, and leaves them there when it stops.
+ * Durable publications are refused when it is not set.
+ */
+#define AERON_DURABLE_DIR_ENV_VAR "AERON_DURABLE_DIR"
+
+/**
+ * Interval in nanoseconds at which the frames committed to durable logs are flushed to storage as a group. Longer
+ * intervals flush more frames per sync at the cost of the time publishers wait for the durable position to move on.
+ */
+#define AERON_DURABLE_SYNC_INTERVAL_ENV_VAR "AERON_DURABLE_SYNC_INTERVAL"
+
 #define AERON_IPC_CHANNEL "aeron:ipc"
 #define AERON_IPC_CHANNEL_LEN strlen(AERON_IPC_CHANNEL)
 #define AERON_SPY_PREFIX "aeron-spy:"
@@ -283,6 +646,27 @@ int aeron_driver_start(aeron_driver_t *driver, bool manual_main_loop);
  */
 int aeron_driver_main_do_work(aeron_driver_t *driver);
 
+/**
+ * Start an aeron_driver_t without spawning threads for the Conductor, Sender, or Receiver regardless of threading
+ * mode. Every agent is instead driven from the caller's thread by aeron_driver_invoker_do_work, so the command
+ * queues between them never cross cores. The agents' on_start hook is called on the caller's thread.
+ *
+ * Use in place of aeron_driver_start. The raw log pool, when enabled, still runs on its own thread.
+ *
+ * @param driver to start.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_driver_invoker_start(aeron_driver_t *driver);
+
+/**
+ * Call the do_work duty cycle of every agent of a driver started with aeron_driver_invoker_start once, in the order
+ * Conductor, Senders, Receivers.
+ *
+ * @param driver to call do_work duty cycles on.
+ * @return the amount of work done or -1 for error.
+ */
+int aeron_driver_invoker_do_work(aeron_driver_t *driver);
+
 /**
  * Call the Conductor (or Shared) Idle Strategy.
  *
@@ -299,6 +683,38 @@ void aeron_driver_main_idle_strategy(aeron_driver_t *driver, int work_count);
  */
 int aeron_driver_close(aeron_driver_t *driver);
 
+/**
+ * Host drivers, each initialised with aeron_driver_init from a context of its own with its own aeron directory and the
+ * DEDICATED threading mode, in one process. Each keeps its CnC, counters, log buffers and conductor thread to itself
+ * while the senders of all of them run on one shared thread and the receivers on another, so N tenants take N + 2
+ * threads rather than 3 N. The shared threads take their idle strategies and CPU affinities from the first driver.
+ *
+ * Use in place of aeron_driver_start for the hosted drivers, which are closed by aeron_driver_host_close.
+ *
+ * @param host to create.
+ * @param drivers to host.
+ * @param driver_count number of drivers, at most 16.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_driver_host_init(aeron_driver_host_t **host, aeron_driver_t **drivers, size_t driver_count);
+
+/**
+ * Start the conductor thread of each hosted driver and the shared sender and receiver threads.
+ *
+ * @param host to start.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_driver_host_start(aeron_driver_host_t *host);
+
+/**
+ * Stop the shared threads, close the hosted drivers and delete the host. The contexts of the drivers are left to be
+ * closed by the caller.
+ *
+ * @param host to close and delete.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_driver_host_close(aeron_driver_host_t *host);
+
 /**
  * Delete the given aeron directory.
  *
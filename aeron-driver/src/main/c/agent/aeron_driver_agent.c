@@ -38,6 +38,8 @@ static pthread_once_t agent_is_initialized = PTHREAD_ONCE_INIT;
 #include "agent/aeron_driver_agent.h"
 #include "aeron_driver_context.h"
 #include "aeron_driver_agent.h"
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_error.h"
 
 static aeron_mpsc_rb_t logging_mpsc_rb;
 static uint8_t *rb_buffer = NULL;
@@ -45,6 +47,12 @@ static uint64_t mask = 0;
 static double receive_data_loss_rate = 0.0;
 static unsigned short receive_data_loss_xsubi[3];
 static pthread_t log_reader_thread;
+static aeron_driver_agent_binary_log_t binary_log;
+static bool binary_log_enabled = false;
+static int64_t sample_rate = 1;
+static int64_t event_counts[AERON_AGENT_MAX_EVENT_TYPES];
+static aeron_driver_agent_pcap_writer_t pcap_writer;
+static bool pcap_enabled = false;
 
 int64_t aeron_agent_epochclock()
 {
@@ -69,6 +77,17 @@ bool aeron_agent_should_drop_frame(struct msghdr *message)
     return false;
 }
 
+/* counts every event of a type and selects 1-in-sample_rate of them for logging */
+static bool aeron_driver_agent_sample_event(int32_t event_type, int64_t *event_count)
+{
+    int64_t count = 0;
+
+    AERON_GET_AND_ADD_INT64(count, event_counts[event_type & (AERON_AGENT_MAX_EVENT_TYPES - 1)], 1);
+    *event_count = count + 1;
+
+    return 1 == sample_rate || 0 == (count % sample_rate);
+}
+
 static void *aeron_driver_agent_log_reader(void *arg)
 {
     while (true)
@@ -82,17 +101,64 @@ static void *aeron_driver_agent_log_reader(void *arg)
     return NULL;
 }
 
+static void aeron_driver_agent_pcap_close()
+{
+    aeron_driver_agent_pcap_writer_close(&pcap_writer);
+}
+
 static void initialize_agent_logging()
 {
     char *mask_str = getenv(AERON_AGENT_MASK_ENV_VAR);
     char *receive_loss_rate_str = getenv(AERON_AGENT_RECEIVE_DATA_LOSS_RATE_ENV_VAR);
+    char *binary_log_file_str = getenv(AERON_AGENT_BINARY_LOG_FILE_ENV_VAR);
+    char *sample_rate_str = getenv(AERON_AGENT_SAMPLE_RATE_ENV_VAR);
+    char *pcap_file_str = getenv(AERON_AGENT_PCAP_FILE_ENV_VAR);
 
     if (mask_str)
     {
         mask = strtoull(mask_str, NULL, 0);
     }
 
-    if (mask != 0)
+    if (pcap_file_str)
+    {
+        char *snap_length_str = getenv(AERON_AGENT_PCAP_SNAP_LENGTH_ENV_VAR);
+        size_t snap_length = snap_length_str ?
+            (size_t)strtoull(snap_length_str, NULL, 0) : AERON_AGENT_PCAP_DEFAULT_SNAP_LENGTH;
+
+        if (aeron_driver_agent_pcap_writer_init(
+            &pcap_writer, pcap_file_str, snap_length, AERON_AGENT_PCAP_DEFAULT_QUEUE_LENGTH) < 0 ||
+            aeron_driver_agent_pcap_writer_start(&pcap_writer) < 0)
+        {
+            fprintf(stderr, "could not start pcap capture to %s: %s. exiting.\n", pcap_file_str, aeron_errmsg());
+            exit(EXIT_FAILURE);
+        }
+
+        atexit(aeron_driver_agent_pcap_close);
+        pcap_enabled = true;
+        mask |= AERON_FRAME_IN | AERON_FRAME_OUT;
+    }
+
+    if (sample_rate_str)
+    {
+        sample_rate = strtoll(sample_rate_str, NULL, 0);
+        sample_rate = sample_rate < 1 ? 1 : sample_rate;
+    }
+
+    if (mask != 0 && binary_log_file_str)
+    {
+        char *capacity_str = getenv(AERON_AGENT_BINARY_LOG_CAPACITY_ENV_VAR);
+        size_t capacity = capacity_str ?
+            (size_t)strtoull(capacity_str, NULL, 0) : AERON_AGENT_BINARY_LOG_DEFAULT_CAPACITY;
+
+        if (aeron_driver_agent_binary_log_create(&binary_log, binary_log_file_str, capacity) < 0)
+        {
+            fprintf(stderr, "could not create binary event log %s: %s. exiting.\n", binary_log_file_str, aeron_errmsg());
+            exit(EXIT_FAILURE);
+        }
+
+        binary_log_enabled = true;
+    }
+    else if (mask != 0)
     {
         size_t rb_length = RING_BUFFER_LENGTH + AERON_RB_TRAILER_LENGTH;
         if ((rb_buffer = (uint8_t *) malloc(rb_length)) == NULL)
@@ -143,6 +209,15 @@ static void initialize_agent_logging()
 void aeron_driver_agent_conductor_to_driver_interceptor(
     int32_t msg_type_id, const void *message, size_t length, void *clientd)
 {
+    if (binary_log_enabled)
+    {
+        int64_t event_count;
+        aeron_driver_agent_sample_event(AERON_CMD_IN, &event_count);
+        aeron_driver_agent_binary_log_append(
+            &binary_log, AERON_CMD_IN, event_count, msg_type_id, (int32_t)length, message, length);
+        return;
+    }
+
     uint8_t buffer[MAX_CMD_LENGTH + sizeof(aeron_driver_agent_cmd_log_header_t)];
     aeron_driver_agent_cmd_log_header_t *hdr = (aeron_driver_agent_cmd_log_header_t *)buffer;
     hdr->time_ms = aeron_agent_epochclock();
@@ -155,6 +230,15 @@ void aeron_driver_agent_conductor_to_driver_interceptor(
 void aeron_driver_agent_conductor_to_client_interceptor(
     aeron_driver_conductor_t *conductor, int32_t msg_type_id, const void *message, size_t length)
 {
+    if (binary_log_enabled)
+    {
+        int64_t event_count;
+        aeron_driver_agent_sample_event(AERON_CMD_OUT, &event_count);
+        aeron_driver_agent_binary_log_append(
+            &binary_log, AERON_CMD_OUT, event_count, msg_type_id, (int32_t)length, message, length);
+        return;
+    }
+
     uint8_t buffer[MAX_CMD_LENGTH + sizeof(aeron_driver_agent_cmd_log_header_t)];
     aeron_driver_agent_cmd_log_header_t *hdr = (aeron_driver_agent_cmd_log_header_t *)buffer;
     hdr->time_ms = aeron_agent_epochclock();
@@ -173,6 +257,15 @@ int aeron_driver_agent_map_raw_log_interceptor(
 {
     int result = aeron_map_raw_log(mapped_raw_log, path, use_sparse_files, term_length, page_size);
 
+    if (binary_log_enabled)
+    {
+        int64_t event_count;
+        aeron_driver_agent_sample_event(AERON_MAP_RAW_LOG_OP, &event_count);
+        aeron_driver_agent_binary_log_append(
+            &binary_log, AERON_MAP_RAW_LOG_OP, event_count, result, (int32_t)strlen(path), path, strlen(path));
+        return result;
+    }
+
     uint8_t buffer[AERON_MAX_PATH + sizeof(aeron_driver_agent_map_raw_log_op_header_t)];
     aeron_driver_agent_map_raw_log_op_header_t *hdr = (aeron_driver_agent_map_raw_log_op_header_t *)buffer;
     size_t path_len = strlen(path);
@@ -191,6 +284,17 @@ int aeron_driver_agent_map_raw_log_interceptor(
 
 int aeron_driver_agent_map_raw_log_close_interceptor(aeron_mapped_raw_log_t *mapped_raw_log)
 {
+    if (binary_log_enabled)
+    {
+        int64_t event_count;
+        int result = aeron_map_raw_log_close(mapped_raw_log);
+
+        aeron_driver_agent_sample_event(AERON_MAP_RAW_LOG_OP_CLOSE, &event_count);
+        aeron_driver_agent_binary_log_append(
+            &binary_log, AERON_MAP_RAW_LOG_OP_CLOSE, event_count, result, 0, NULL, 0);
+        return result;
+    }
+
     uint8_t buffer[AERON_MAX_PATH + sizeof(aeron_driver_agent_map_raw_log_op_header_t)];
     aeron_driver_agent_map_raw_log_op_header_t *hdr = (aeron_driver_agent_map_raw_log_op_header_t *)buffer;
 
@@ -258,6 +362,36 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
 void aeron_driver_agent_log_frame(
     int32_t msg_type_id, int sockfd, const struct msghdr *msghdr, int flags, int result, int32_t message_len)
 {
+    if (pcap_enabled)
+    {
+        aeron_driver_agent_pcap_capture(
+            &pcap_writer,
+            AERON_FRAME_OUT == msg_type_id ? AERON_AGENT_PCAP_FRAME_OUT : AERON_AGENT_PCAP_FRAME_IN,
+            sockfd,
+            msghdr,
+            result);
+        return;
+    }
+
+    int64_t event_count;
+    if (!aeron_driver_agent_sample_event(msg_type_id, &event_count))
+    {
+        return;
+    }
+
+    if (binary_log_enabled)
+    {
+        aeron_driver_agent_binary_log_append(
+            &binary_log,
+            msg_type_id,
+            event_count,
+            result,
+            message_len,
+            msghdr->msg_iov[0].iov_base,
+            message_len < 0 ? 0 : AERON_MIN((size_t)message_len, msghdr->msg_iov[0].iov_len));
+        return;
+    }
+
     uint8_t buffer[MAX_FRAME_LENGTH + sizeof(aeron_driver_agent_frame_log_header_t) + sizeof(struct sockaddr_in6)];
     aeron_driver_agent_frame_log_header_t *hdr = (aeron_driver_agent_frame_log_header_t *)buffer;
     size_t length = sizeof(aeron_driver_agent_frame_log_header_t);
@@ -710,6 +844,25 @@ static const char *dissect_cmd_out(int64_t cmd_id, const void *message, size_t l
             break;
         }
 
+        case AERON_RESPONSE_ON_AVAILABLE_IMAGES:
+        {
+            aeron_image_buffers_ready_batch_t *command = (aeron_image_buffers_ready_batch_t *)message;
+
+            char *log_file_name_ptr = (char *)message + sizeof(aeron_image_buffers_ready_batch_t) +
+                (command->subscriber_count * sizeof(aeron_image_buffers_ready_subscriber_t));
+            int32_t *log_file_name_length = (int32_t *)log_file_name_ptr;
+            const char *log_file_name = log_file_name_ptr + sizeof(int32_t);
+
+            snprintf(buffer, sizeof(buffer) - 1, "ON_AVAILABLE_IMAGES %d:%d x%" PRId32 " [%" PRId64 "]\n    \"%*s\"",
+                command->session_id,
+                command->stream_id,
+                command->subscriber_count,
+                command->correlation_id,
+                *log_file_name_length,
+                log_file_name);
+            break;
+        }
+
         case AERON_RESPONSE_ON_COUNTER_READY:
         {
             aeron_counter_update_t *command = (aeron_counter_update_t *)message;
@@ -19,8 +19,15 @@
 
 #include "aeron_driver_conductor.h"
 #include "command/aeron_control_protocol.h"
+#include "agent/aeron_driver_agent_binary_log.h"
+#include "agent/aeron_driver_agent_pcap.h"
 
 #define AERON_AGENT_MASK_ENV_VAR "AERON_EVENT_LOG"
+#define AERON_AGENT_BINARY_LOG_FILE_ENV_VAR "AERON_EVENT_LOG_BINARY_FILE"
+#define AERON_AGENT_BINARY_LOG_CAPACITY_ENV_VAR "AERON_EVENT_LOG_BINARY_CAPACITY"
+#define AERON_AGENT_SAMPLE_RATE_ENV_VAR "AERON_EVENT_LOG_SAMPLE_RATE"
+#define AERON_AGENT_PCAP_FILE_ENV_VAR "AERON_EVENT_LOG_PCAP_FILE"
+#define AERON_AGENT_PCAP_SNAP_LENGTH_ENV_VAR "AERON_EVENT_LOG_PCAP_SNAP_LENGTH"
 #define RING_BUFFER_LENGTH (2 * 1024 * 1024)
 #define MAX_CMD_LENGTH (512)
 #define MAX_FRAME_LENGTH (512)
@@ -34,6 +41,8 @@
 
 #define AERON_MAP_RAW_LOG_OP_CLOSE (0x11)
 
+#define AERON_AGENT_MAX_EVENT_TYPES (32)
+
 #define AERON_AGENT_RECEIVE_DATA_LOSS_RATE_ENV_VAR "AERON_DEBUG_RECEIVE_DATA_LOSS_RATE"
 #define AERON_AGENT_RECEIVE_DATA_LOSS_SEED_ENV_VAR "AERON_DEBUG_RECEIVE_DATA_LOSS_SEED"
 
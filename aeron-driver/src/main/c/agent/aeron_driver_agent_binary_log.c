@@ -0,0 +1,147 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "agent/aeron_driver_agent_binary_log.h"
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_error.h"
+
+int aeron_driver_agent_binary_log_create(aeron_driver_agent_binary_log_t *log, const char *path, size_t capacity)
+{
+    if (!AERON_IS_POWER_OF_TWO(capacity))
+    {
+        aeron_set_err(EINVAL, "binary event log capacity must be a power of 2: %" PRIu64, (uint64_t)capacity);
+        return -1;
+    }
+
+    unlink(path);
+    log->mapped_file.length = aeron_driver_agent_binary_log_file_length(capacity);
+    if (aeron_map_new_file(&log->mapped_file, path, true, 4096) < 0)
+    {
+        return -1;
+    }
+
+    aeron_driver_agent_binary_log_header_t *header =
+        (aeron_driver_agent_binary_log_header_t *)log->mapped_file.addr;
+
+    header->version = AERON_AGENT_BINARY_LOG_VERSION;
+    header->record_length = AERON_AGENT_BINARY_LOG_RECORD_LENGTH;
+    header->capacity = (int32_t)capacity;
+    header->next_sequence = 0;
+    AERON_PUT_ORDERED(header->magic, AERON_AGENT_BINARY_LOG_MAGIC);
+
+    return aeron_driver_agent_binary_log_wrap(log, log->mapped_file.addr, log->mapped_file.length);
+}
+
+int aeron_driver_agent_binary_log_wrap(aeron_driver_agent_binary_log_t *log, void *buffer, size_t length)
+{
+    aeron_driver_agent_binary_log_header_t *header = (aeron_driver_agent_binary_log_header_t *)buffer;
+
+    if (length < sizeof(aeron_driver_agent_binary_log_header_t) ||
+        AERON_AGENT_BINARY_LOG_MAGIC != header->magic ||
+        AERON_AGENT_BINARY_LOG_VERSION != header->version ||
+        AERON_AGENT_BINARY_LOG_RECORD_LENGTH != header->record_length ||
+        !AERON_IS_POWER_OF_TWO(header->capacity) ||
+        length < aeron_driver_agent_binary_log_file_length((size_t)header->capacity))
+    {
+        aeron_set_err(EINVAL, "%s", "not a valid binary event log");
+        return -1;
+    }
+
+    log->header = header;
+    log->records = (aeron_driver_agent_binary_log_record_t *)
+        ((uint8_t *)buffer + sizeof(aeron_driver_agent_binary_log_header_t));
+    log->mask = (uint64_t)header->capacity - 1;
+
+    return 0;
+}
+
+void aeron_driver_agent_binary_log_append(
+    aeron_driver_agent_binary_log_t *log,
+    int32_t event_type,
+    int64_t event_count,
+    int32_t result,
+    int32_t length,
+    const void *sample,
+    size_t sample_length)
+{
+    struct timespec ts;
+    int64_t sequence = 0;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    AERON_GET_AND_ADD_INT64(sequence, log->header->next_sequence, 1);
+
+    aeron_driver_agent_binary_log_record_t *record = &log->records[(uint64_t)sequence & log->mask];
+    const size_t copy_length =
+        sample_length < AERON_AGENT_BINARY_LOG_SAMPLE_LENGTH ? sample_length : AERON_AGENT_BINARY_LOG_SAMPLE_LENGTH;
+
+    AERON_PUT_ORDERED(record->sequence, 0);
+    record->timestamp_ns = ((int64_t)ts.tv_sec * 1000 * 1000 * 1000) + ts.tv_nsec;
+    record->event_count = event_count;
+    record->event_type = event_type;
+    record->result = result;
+    record->length = length;
+    record->sample_length = (int32_t)copy_length;
+    if (copy_length > 0)
+    {
+        memcpy(record->sample, sample, copy_length);
+    }
+    AERON_PUT_ORDERED(record->sequence, sequence + 1);
+}
+
+size_t aeron_driver_agent_binary_log_decode(
+    aeron_driver_agent_binary_log_t *log, aeron_driver_agent_binary_log_record_func_t func, void *clientd)
+{
+    const int64_t capacity = (int64_t)log->mask + 1;
+    int64_t next_sequence;
+    size_t records_decoded = 0;
+
+    AERON_GET_VOLATILE(next_sequence, log->header->next_sequence);
+
+    for (int64_t sequence = next_sequence > capacity ? next_sequence - capacity : 0;
+        sequence < next_sequence;
+        sequence++)
+    {
+        aeron_driver_agent_binary_log_record_t *record = &log->records[(uint64_t)sequence & log->mask];
+        aeron_driver_agent_binary_log_record_t copy;
+        int64_t record_sequence;
+
+        AERON_GET_VOLATILE(record_sequence, record->sequence);
+        if (sequence + 1 != record_sequence)
+        {
+            continue;
+        }
+
+        memcpy(&copy, record, sizeof(copy));
+
+        AERON_GET_VOLATILE(record_sequence, record->sequence);
+        if (sequence + 1 != record_sequence)
+        {
+            continue;
+        }
+
+        func(&copy, clientd);
+        records_decoded++;
+    }
+
+    return records_decoded;
+}
+
+extern size_t aeron_driver_agent_binary_log_file_length(size_t capacity);
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_DRIVER_AGENT_BINARY_LOG_H
+#define AERON_AERON_DRIVER_AGENT_BINARY_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "util/aeron_bitutil.h"
+#include "util/aeron_fileutil.h"
+
+#define AERON_AGENT_BINARY_LOG_MAGIC (0x4145424c)
+#define AERON_AGENT_BINARY_LOG_VERSION (1)
+#define AERON_AGENT_BINARY_LOG_RECORD_LENGTH (128)
+#define AERON_AGENT_BINARY_LOG_SAMPLE_LENGTH (88)
+#define AERON_AGENT_BINARY_LOG_DEFAULT_CAPACITY (64 * 1024)
+
+#pragma pack(push)
+#pragma pack(4)
+typedef struct aeron_driver_agent_binary_log_header_stct
+{
+    int32_t magic;
+    int32_t version;
+    int32_t record_length;
+    int32_t capacity;
+    uint8_t pad1[(2 * AERON_CACHE_LINE_LENGTH) - (4 * sizeof(int32_t))];
+    int64_t next_sequence;
+    uint8_t pad2[(2 * AERON_CACHE_LINE_LENGTH) - sizeof(int64_t)];
+}
+aeron_driver_agent_binary_log_header_t;
+
+/*
+ * Fixed size record. sequence is written last with an ordered store and holds the record's position in the log
+ * plus one, so a zero sequence is an empty slot and a mismatched one is a slot being overwritten.
+ */
+typedef struct aeron_driver_agent_binary_log_record_stct
+{
+    int64_t sequence;
+    int64_t timestamp_ns;
+    int64_t event_count;
+    int32_t event_type;
+    int32_t result;
+    int32_t length;
+    int32_t sample_length;
+    uint8_t sample[AERON_AGENT_BINARY_LOG_SAMPLE_LENGTH];
+}
+aeron_driver_agent_binary_log_record_t;
+#pragma pack(pop)
+
+typedef struct aeron_driver_agent_binary_log_stct
+{
+    aeron_mapped_file_t mapped_file;
+    aeron_driver_agent_binary_log_header_t *header;
+    aeron_driver_agent_binary_log_record_t *records;
+    uint64_t mask;
+}
+aeron_driver_agent_binary_log_t;
+
+typedef void (*aeron_driver_agent_binary_log_record_func_t)(
+    const aeron_driver_agent_binary_log_record_t *record, void *clientd);
+
+inline size_t aeron_driver_agent_binary_log_file_length(size_t capacity)
+{
+    return sizeof(aeron_driver_agent_binary_log_header_t) + (capacity * sizeof(aeron_driver_agent_binary_log_record_t));
+}
+
+int aeron_driver_agent_binary_log_create(aeron_driver_agent_binary_log_t *log, const char *path, size_t capacity);
+
+int aeron_driver_agent_binary_log_wrap(aeron_driver_agent_binary_log_t *log, void *buffer, size_t length);
+
+void aeron_driver_agent_binary_log_append(
+    aeron_driver_agent_binary_log_t *log,
+    int32_t event_type,
+    int64_t event_count,
+    int32_t result,
+    int32_t length,
+    const void *sample,
+    size_t sample_length);
+
+/*
+ * Visit the complete records in the log in the order they were appended. Returns the number of records visited.
+ */
+size_t aeron_driver_agent_binary_log_decode(
+    aeron_driver_agent_binary_log_t *log, aeron_driver_agent_binary_log_record_func_t func, void *clientd);
+
+#endif //AERON_AERON_DRIVER_AGENT_BINARY_LOG_H
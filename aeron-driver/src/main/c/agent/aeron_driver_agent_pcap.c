@@ -0,0 +1,442 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <netinet/in.h>
+#include "agent/aeron_driver_agent_pcap.h"
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_error.h"
+
+#define AERON_AGENT_PCAP_BLOCK_TYPE_SHB (0x0A0D0D0A)
+#define AERON_AGENT_PCAP_BLOCK_TYPE_IDB (0x00000001)
+#define AERON_AGENT_PCAP_BLOCK_TYPE_EPB (0x00000006)
+#define AERON_AGENT_PCAP_BYTE_ORDER_MAGIC (0x1A2B3C4D)
+#define AERON_AGENT_PCAP_OPTION_END (0)
+#define AERON_AGENT_PCAP_OPTION_IF_TSRESOL (9)
+#define AERON_AGENT_PCAP_OPTION_EPB_FLAGS (2)
+#define AERON_AGENT_PCAP_TSRESOL_NANOS (9)
+
+#define AERON_AGENT_PCAP_IPV4_HEADER_LENGTH (20)
+#define AERON_AGENT_PCAP_IPV6_HEADER_LENGTH (40)
+#define AERON_AGENT_PCAP_UDP_HEADER_LENGTH (8)
+#define AERON_AGENT_PCAP_MAX_HEADERS_LENGTH (AERON_AGENT_PCAP_IPV6_HEADER_LENGTH + AERON_AGENT_PCAP_UDP_HEADER_LENGTH)
+
+#pragma pack(push)
+#pragma pack(4)
+typedef struct aeron_driver_agent_pcap_shb_stct
+{
+    uint32_t block_type;
+    uint32_t block_total_length;
+    uint32_t byte_order_magic;
+    uint16_t major_version;
+    uint16_t minor_version;
+    int64_t section_length;
+    uint32_t block_total_length_trailer;
+}
+aeron_driver_agent_pcap_shb_t;
+
+typedef struct aeron_driver_agent_pcap_idb_stct
+{
+    uint32_t block_type;
+    uint32_t block_total_length;
+    uint16_t link_type;
+    uint16_t reserved;
+    uint32_t snap_length;
+    uint16_t tsresol_code;
+    uint16_t tsresol_length;
+    uint8_t tsresol_value;
+    uint8_t tsresol_pad[3];
+    uint16_t end_code;
+    uint16_t end_length;
+    uint32_t block_total_length_trailer;
+}
+aeron_driver_agent_pcap_idb_t;
+
+typedef struct aeron_driver_agent_pcap_epb_header_stct
+{
+    uint32_t block_type;
+    uint32_t block_total_length;
+    uint32_t interface_id;
+    uint32_t timestamp_high;
+    uint32_t timestamp_low;
+    uint32_t captured_length;
+    uint32_t original_length;
+}
+aeron_driver_agent_pcap_epb_header_t;
+
+typedef struct aeron_driver_agent_pcap_epb_trailer_stct
+{
+    uint16_t flags_code;
+    uint16_t flags_length;
+    uint32_t flags;
+    uint16_t end_code;
+    uint16_t end_length;
+    uint32_t block_total_length;
+}
+aeron_driver_agent_pcap_epb_trailer_t;
+#pragma pack(pop)
+
+static void *aeron_driver_agent_pcap_writer_run(void *arg)
+{
+    aeron_driver_agent_pcap_writer_t *writer = (aeron_driver_agent_pcap_writer_t *)arg;
+    bool running;
+
+    AERON_GET_VOLATILE(running, writer->running);
+    while (running)
+    {
+        if (0 == aeron_driver_agent_pcap_writer_poll(writer))
+        {
+            struct timespec ts = { .tv_sec = 0, .tv_nsec = 1000 * 1000 };
+
+            fflush(writer->file);
+            nanosleep(&ts, NULL);
+        }
+
+        AERON_GET_VOLATILE(running, writer->running);
+    }
+
+    while (aeron_driver_agent_pcap_writer_poll(writer) > 0)
+    {
+    }
+
+    return NULL;
+}
+
+int aeron_driver_agent_pcap_writer_init(
+    aeron_driver_agent_pcap_writer_t *writer, const char *path, size_t snap_length, size_t queue_length)
+{
+    if (0 == snap_length || snap_length > AERON_AGENT_PCAP_MAX_SNAP_LENGTH)
+    {
+        aeron_set_err(EINVAL, "pcap snap length must be between 1 and %d: %d",
+            AERON_AGENT_PCAP_MAX_SNAP_LENGTH, (int)snap_length);
+        return -1;
+    }
+
+    if (!AERON_IS_POWER_OF_TWO(queue_length))
+    {
+        aeron_set_err(EINVAL, "pcap queue length must be a power of 2: %d", (int)queue_length);
+        return -1;
+    }
+
+    memset(writer, 0, sizeof(aeron_driver_agent_pcap_writer_t));
+    writer->snap_length = snap_length;
+
+    size_t rb_length = queue_length + AERON_RB_TRAILER_LENGTH;
+    if ((writer->queue_buffer = (uint8_t *)malloc(rb_length)) == NULL)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not allocate pcap queue");
+        return -1;
+    }
+    memset(writer->queue_buffer, 0, rb_length);
+
+    if (aeron_mpsc_rb_init(&writer->queue, writer->queue_buffer, rb_length) < 0)
+    {
+        free(writer->queue_buffer);
+        return -1;
+    }
+
+    if ((writer->file = fopen(path, "wb")) == NULL)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "could not open pcap file %s: %s", path, strerror(errcode));
+        free(writer->queue_buffer);
+        return -1;
+    }
+
+    aeron_driver_agent_pcap_shb_t shb;
+    shb.block_type = AERON_AGENT_PCAP_BLOCK_TYPE_SHB;
+    shb.block_total_length = sizeof(shb);
+    shb.byte_order_magic = AERON_AGENT_PCAP_BYTE_ORDER_MAGIC;
+    shb.major_version = 1;
+    shb.minor_version = 0;
+    shb.section_length = -1;
+    shb.block_total_length_trailer = sizeof(shb);
+
+    aeron_driver_agent_pcap_idb_t idb;
+    memset(&idb, 0, sizeof(idb));
+    idb.block_type = AERON_AGENT_PCAP_BLOCK_TYPE_IDB;
+    idb.block_total_length = sizeof(idb);
+    idb.link_type = AERON_AGENT_PCAP_LINKTYPE_RAW;
+    idb.snap_length = (uint32_t)(snap_length + AERON_AGENT_PCAP_MAX_HEADERS_LENGTH);
+    idb.tsresol_code = AERON_AGENT_PCAP_OPTION_IF_TSRESOL;
+    idb.tsresol_length = 1;
+    idb.tsresol_value = AERON_AGENT_PCAP_TSRESOL_NANOS;
+    idb.end_code = AERON_AGENT_PCAP_OPTION_END;
+    idb.block_total_length_trailer = sizeof(idb);
+
+    if (fwrite(&shb, sizeof(shb), 1, writer->file) != 1 || fwrite(&idb, sizeof(idb), 1, writer->file) != 1)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "could not write pcap file %s: %s", path, strerror(errcode));
+        fclose(writer->file);
+        free(writer->queue_buffer);
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_driver_agent_pcap_writer_start(aeron_driver_agent_pcap_writer_t *writer)
+{
+    AERON_PUT_ORDERED(writer->running, true);
+
+    if (pthread_create(&writer->thread, NULL, aeron_driver_agent_pcap_writer_run, writer) != 0)
+    {
+        aeron_set_err(errno, "%s", "could not start pcap writer thread");
+        return -1;
+    }
+
+    writer->thread_started = true;
+
+    return 0;
+}
+
+void aeron_driver_agent_pcap_capture(
+    aeron_driver_agent_pcap_writer_t *writer,
+    int32_t direction,
+    int sockfd,
+    const struct msghdr *msghdr,
+    int32_t frame_length)
+{
+    uint8_t buffer[sizeof(aeron_driver_agent_pcap_frame_header_t) + AERON_AGENT_PCAP_MAX_SNAP_LENGTH];
+    aeron_driver_agent_pcap_frame_header_t *hdr = (aeron_driver_agent_pcap_frame_header_t *)buffer;
+    struct timespec ts;
+
+    if (frame_length <= 0)
+    {
+        return;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    hdr->timestamp_ns = ((int64_t)ts.tv_sec * 1000 * 1000 * 1000) + ts.tv_nsec;
+    hdr->sockfd = sockfd;
+    hdr->frame_length = frame_length;
+    hdr->peer_address_length = 0;
+
+    if (NULL != msghdr->msg_name && msghdr->msg_namelen > 0 &&
+        msghdr->msg_namelen <= sizeof(struct sockaddr_storage))
+    {
+        memcpy(&hdr->peer_address, msghdr->msg_name, msghdr->msg_namelen);
+        hdr->peer_address_length = (int32_t)msghdr->msg_namelen;
+    }
+
+    uint8_t *ptr = buffer + sizeof(aeron_driver_agent_pcap_frame_header_t);
+    size_t remaining = AERON_MIN(writer->snap_length, (size_t)frame_length);
+    size_t captured_length = 0;
+
+    for (size_t i = 0; i < (size_t)msghdr->msg_iovlen && remaining > 0; i++)
+    {
+        size_t copy_length = AERON_MIN(remaining, msghdr->msg_iov[i].iov_len);
+
+        memcpy(ptr + captured_length, msghdr->msg_iov[i].iov_base, copy_length);
+        captured_length += copy_length;
+        remaining -= copy_length;
+    }
+
+    hdr->captured_length = (int32_t)captured_length;
+
+    if (AERON_RB_SUCCESS != aeron_mpsc_rb_write(
+        &writer->queue, direction, buffer, sizeof(aeron_driver_agent_pcap_frame_header_t) + captured_length))
+    {
+        int64_t dropped_frames;
+        AERON_GET_AND_ADD_INT64(dropped_frames, writer->dropped_frames, 1);
+        (void)dropped_frames;
+    }
+}
+
+static uint16_t aeron_driver_agent_pcap_ipv4_checksum(const uint8_t *header)
+{
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < AERON_AGENT_PCAP_IPV4_HEADER_LENGTH; i += 2)
+    {
+        sum += (uint32_t)((header[i] << 8) | header[i + 1]);
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+
+    return htons((uint16_t)~sum);
+}
+
+/*
+ * Build the IP and UDP headers around the datagram from the queued peer address and the local address of the socket.
+ * Returns the length of the headers written.
+ */
+static size_t aeron_driver_agent_pcap_encode_headers(
+    uint8_t *packet, int32_t direction, const aeron_driver_agent_pcap_frame_header_t *hdr)
+{
+    struct sockaddr_storage peer;
+    struct sockaddr_storage local;
+    socklen_t peer_length = sizeof(peer);
+    socklen_t local_length = sizeof(local);
+
+    memset(&peer, 0, sizeof(peer));
+    memset(&local, 0, sizeof(local));
+
+    if (hdr->peer_address_length > 0)
+    {
+        memcpy(&peer, &hdr->peer_address, (size_t)hdr->peer_address_length);
+    }
+    else if (getpeername(hdr->sockfd, (struct sockaddr *)&peer, &peer_length) < 0)
+    {
+        peer.ss_family = AF_INET;
+    }
+
+    if (getsockname(hdr->sockfd, (struct sockaddr *)&local, &local_length) < 0 || local.ss_family != peer.ss_family)
+    {
+        memset(&local, 0, sizeof(local));
+        local.ss_family = peer.ss_family;
+    }
+
+    const bool outbound = AERON_AGENT_PCAP_FRAME_OUT == direction;
+    struct sockaddr_storage *src = outbound ? &local : &peer;
+    struct sockaddr_storage *dst = outbound ? &peer : &local;
+    const uint16_t udp_length = (uint16_t)(hdr->frame_length + AERON_AGENT_PCAP_UDP_HEADER_LENGTH);
+    uint8_t *udp;
+    size_t length;
+
+    if (AF_INET6 == peer.ss_family)
+    {
+        struct sockaddr_in6 *src_in6 = (struct sockaddr_in6 *)src;
+        struct sockaddr_in6 *dst_in6 = (struct sockaddr_in6 *)dst;
+        uint16_t payload_length = htons(udp_length);
+
+        memset(packet, 0, AERON_AGENT_PCAP_IPV6_HEADER_LENGTH);
+        packet[0] = 0x60;
+        memcpy(packet + 4, &payload_length, sizeof(payload_length));
+        packet[6] = IPPROTO_UDP;
+        packet[7] = 64;
+        memcpy(packet + 8, &src_in6->sin6_addr, 16);
+        memcpy(packet + 24, &dst_in6->sin6_addr, 16);
+
+        udp = packet + AERON_AGENT_PCAP_IPV6_HEADER_LENGTH;
+        memcpy(udp, &src_in6->sin6_port, sizeof(uint16_t));
+        memcpy(udp + 2, &dst_in6->sin6_port, sizeof(uint16_t));
+        length = AERON_AGENT_PCAP_IPV6_HEADER_LENGTH;
+    }
+    else
+    {
+        struct sockaddr_in *src_in = (struct sockaddr_in *)src;
+        struct sockaddr_in *dst_in = (struct sockaddr_in *)dst;
+        uint16_t total_length = htons((uint16_t)(udp_length + AERON_AGENT_PCAP_IPV4_HEADER_LENGTH));
+        uint16_t checksum;
+
+        memset(packet, 0, AERON_AGENT_PCAP_IPV4_HEADER_LENGTH);
+        packet[0] = 0x45;
+        memcpy(packet + 2, &total_length, sizeof(total_length));
+        packet[6] = 0x40;
+        packet[8] = 64;
+        packet[9] = IPPROTO_UDP;
+        memcpy(packet + 12, &src_in->sin_addr, 4);
+        memcpy(packet + 16, &dst_in->sin_addr, 4);
+        checksum = aeron_driver_agent_pcap_ipv4_checksum(packet);
+        memcpy(packet + 10, &checksum, sizeof(checksum));
+
+        udp = packet + AERON_AGENT_PCAP_IPV4_HEADER_LENGTH;
+        memcpy(udp, &src_in->sin_port, sizeof(uint16_t));
+        memcpy(udp + 2, &dst_in->sin_port, sizeof(uint16_t));
+        length = AERON_AGENT_PCAP_IPV4_HEADER_LENGTH;
+    }
+
+    /* checksum of 0 means not computed, payload may be truncated anyway */
+    uint16_t udp_length_be = htons(udp_length);
+    memcpy(udp + 4, &udp_length_be, sizeof(udp_length_be));
+    memset(udp + 6, 0, sizeof(uint16_t));
+
+    return length + AERON_AGENT_PCAP_UDP_HEADER_LENGTH;
+}
+
+static void aeron_driver_agent_pcap_write_frame(int32_t msg_type_id, const void *message, size_t length, void *clientd)
+{
+    aeron_driver_agent_pcap_writer_t *writer = (aeron_driver_agent_pcap_writer_t *)clientd;
+    const aeron_driver_agent_pcap_frame_header_t *hdr = (const aeron_driver_agent_pcap_frame_header_t *)message;
+    const uint8_t *data = (const uint8_t *)message + sizeof(aeron_driver_agent_pcap_frame_header_t);
+    uint8_t headers[AERON_AGENT_PCAP_MAX_HEADERS_LENGTH];
+    static const uint8_t padding[4] = { 0, 0, 0, 0 };
+
+    size_t headers_length = aeron_driver_agent_pcap_encode_headers(headers, msg_type_id, hdr);
+    size_t captured_length = headers_length + (size_t)hdr->captured_length;
+    size_t padded_length = AERON_ALIGN(captured_length, 4);
+    uint32_t block_total_length = (uint32_t)(sizeof(aeron_driver_agent_pcap_epb_header_t) + padded_length +
+        sizeof(aeron_driver_agent_pcap_epb_trailer_t));
+    const uint64_t timestamp = (uint64_t)hdr->timestamp_ns;
+
+    aeron_driver_agent_pcap_epb_header_t epb;
+    epb.block_type = AERON_AGENT_PCAP_BLOCK_TYPE_EPB;
+    epb.block_total_length = block_total_length;
+    epb.interface_id = 0;
+    epb.timestamp_high = (uint32_t)(timestamp >> 32);
+    epb.timestamp_low = (uint32_t)timestamp;
+    epb.captured_length = (uint32_t)captured_length;
+    epb.original_length = (uint32_t)(headers_length + (size_t)hdr->frame_length);
+
+    aeron_driver_agent_pcap_epb_trailer_t trailer;
+    trailer.flags_code = AERON_AGENT_PCAP_OPTION_EPB_FLAGS;
+    trailer.flags_length = sizeof(uint32_t);
+    trailer.flags = AERON_AGENT_PCAP_FRAME_OUT == msg_type_id ? 0x2 : 0x1;
+    trailer.end_code = AERON_AGENT_PCAP_OPTION_END;
+    trailer.end_length = 0;
+    trailer.block_total_length = block_total_length;
+
+    fwrite(&epb, sizeof(epb), 1, writer->file);
+    fwrite(headers, headers_length, 1, writer->file);
+    fwrite(data, (size_t)hdr->captured_length, 1, writer->file);
+    fwrite(padding, padded_length - captured_length, 1, writer->file);
+    fwrite(&trailer, sizeof(trailer), 1, writer->file);
+}
+
+int aeron_driver_agent_pcap_writer_poll(aeron_driver_agent_pcap_writer_t *writer)
+{
+    return (int)aeron_mpsc_rb_read(&writer->queue, aeron_driver_agent_pcap_write_frame, writer, 64);
+}
+
+int aeron_driver_agent_pcap_writer_close(aeron_driver_agent_pcap_writer_t *writer)
+{
+    int result = 0;
+
+    if (writer->thread_started)
+    {
+        AERON_PUT_ORDERED(writer->running, false);
+        pthread_join(writer->thread, NULL);
+        writer->thread_started = false;
+    }
+    else
+    {
+        while (aeron_driver_agent_pcap_writer_poll(writer) > 0)
+        {
+        }
+    }
+
+    if (NULL != writer->file)
+    {
+        result = fclose(writer->file);
+        writer->file = NULL;
+    }
+
+    free(writer->queue_buffer);
+    writer->queue_buffer = NULL;
+
+    return result;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_DRIVER_AGENT_PCAP_H
+#define AERON_AERON_DRIVER_AGENT_PCAP_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include "concurrent/aeron_mpsc_rb.h"
+
+#define AERON_AGENT_PCAP_DEFAULT_SNAP_LENGTH (8 * 1024)
+#define AERON_AGENT_PCAP_MAX_SNAP_LENGTH (8 * 1024)
+#define AERON_AGENT_PCAP_DEFAULT_QUEUE_LENGTH (8 * 1024 * 1024)
+
+#define AERON_AGENT_PCAP_FRAME_IN (0x01)
+#define AERON_AGENT_PCAP_FRAME_OUT (0x02)
+
+/* pcapng LINKTYPE_RAW, packets start with an IPv4 or IPv6 header */
+#define AERON_AGENT_PCAP_LINKTYPE_RAW (101)
+
+/* Queued ahead of the captured bytes for each datagram, the capturing thread does no formatting or I/O. */
+typedef struct aeron_driver_agent_pcap_frame_header_stct
+{
+    int64_t timestamp_ns;
+    int32_t sockfd;
+    int32_t frame_length;
+    int32_t captured_length;
+    int32_t peer_address_length;
+    struct sockaddr_storage peer_address;
+}
+aeron_driver_agent_pcap_frame_header_t;
+
+typedef struct aeron_driver_agent_pcap_writer_stct
+{
+    FILE *file;
+    uint8_t *queue_buffer;
+    aeron_mpsc_rb_t queue;
+    size_t snap_length;
+    pthread_t thread;
+    bool thread_started;
+    volatile bool running;
+    volatile int64_t dropped_frames;
+}
+aeron_driver_agent_pcap_writer_t;
+
+/*
+ * Open the pcapng file and write its section header and interface description. snap_length is the number of datagram
+ * bytes kept for each frame and queue_length, a power of 2, bounds the memory used for frames not yet written.
+ */
+int aeron_driver_agent_pcap_writer_init(
+    aeron_driver_agent_pcap_writer_t *writer, const char *path, size_t snap_length, size_t queue_length);
+
+int aeron_driver_agent_pcap_writer_start(aeron_driver_agent_pcap_writer_t *writer);
+
+/*
+ * Queue a sent or received datagram, never blocks. When the queue is full the frame is counted as dropped.
+ */
+void aeron_driver_agent_pcap_capture(
+    aeron_driver_agent_pcap_writer_t *writer,
+    int32_t direction,
+    int sockfd,
+    const struct msghdr *msghdr,
+    int32_t frame_length);
+
+/*
+ * Write queued frames to the file. Called by the writer thread, returns the number of frames written.
+ */
+int aeron_driver_agent_pcap_writer_poll(aeron_driver_agent_pcap_writer_t *writer);
+
+/*
+ * Stop the writer thread, write any remaining frames and close the file.
+ */
+int aeron_driver_agent_pcap_writer_close(aeron_driver_agent_pcap_writer_t *writer);
+
+#endif //AERON_AERON_DRIVER_AGENT_PCAP_H
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <time.h>
+#include "agent/aeron_driver_agent.h"
+#include "agent/aeron_driver_agent_binary_log.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_error.h"
+
+static const char *dump_event_type(int32_t event_type)
+{
+    switch (event_type)
+    {
+        case AERON_CMD_IN:
+            return "CMD_IN";
+        case AERON_CMD_OUT:
+            return "CMD_OUT";
+        case AERON_FRAME_IN:
+            return "FRAME_IN";
+        case AERON_FRAME_IN_DROPPED:
+            return "FRAME_IN_DROPPED";
+        case AERON_FRAME_OUT:
+            return "FRAME_OUT";
+        case AERON_MAP_RAW_LOG_OP:
+            return "MAP_RAW_LOG";
+        case AERON_MAP_RAW_LOG_OP_CLOSE:
+            return "MAP_RAW_LOG_CLOSE";
+        default:
+            return "unknown";
+    }
+}
+
+static void dump_record(const aeron_driver_agent_binary_log_record_t *record, void *clientd)
+{
+    time_t seconds = (time_t)(record->timestamp_ns / (1000 * 1000 * 1000));
+    struct tm tm;
+    char time_str[32];
+
+    localtime_r(&seconds, &tm);
+    strftime(time_str, sizeof(time_str) - 1, "%H:%M:%S", &tm);
+
+    printf(
+        "[%s.%09" PRId64 "] %s: count=%" PRId64 " result=%" PRId32 " length=%" PRId32,
+        time_str,
+        record->timestamp_ns % (1000 * 1000 * 1000),
+        dump_event_type(record->event_type),
+        record->event_count,
+        record->result,
+        record->length);
+
+    switch (record->event_type)
+    {
+        case AERON_FRAME_IN:
+        case AERON_FRAME_IN_DROPPED:
+        case AERON_FRAME_OUT:
+        {
+            if ((size_t)record->sample_length >= sizeof(aeron_data_header_t))
+            {
+                aeron_data_header_t *data_header = (aeron_data_header_t *)record->sample;
+
+                printf(
+                    " type=0x%x flags=0x%x frame_length=%" PRId32 " session=%" PRId32 " stream=%" PRId32
+                    " term_id=%" PRId32 " term_offset=%" PRId32,
+                    data_header->frame_header.type,
+                    data_header->frame_header.flags,
+                    data_header->frame_header.frame_length,
+                    data_header->session_id,
+                    data_header->stream_id,
+                    data_header->term_id,
+                    data_header->term_offset);
+            }
+            else if ((size_t)record->sample_length >= sizeof(aeron_frame_header_t))
+            {
+                aeron_frame_header_t *frame_header = (aeron_frame_header_t *)record->sample;
+
+                printf(" type=0x%x frame_length=%" PRId32, frame_header->type, frame_header->frame_length);
+            }
+            break;
+        }
+
+        case AERON_CMD_IN:
+        case AERON_CMD_OUT:
+            printf(" cmd=0x%" PRIx32, (uint32_t)record->result);
+            break;
+
+        case AERON_MAP_RAW_LOG_OP:
+            printf(" path=%.*s", (int)record->sample_length, (const char *)record->sample);
+            break;
+
+        default:
+            break;
+    }
+
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    aeron_mapped_file_t mapped_file = { NULL, 0 };
+    aeron_driver_agent_binary_log_t log;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <binary event log file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (aeron_map_existing_file(&mapped_file, argv[1]) < 0)
+    {
+        fprintf(stderr, "ERROR: could not map %s (%d) %s\n", argv[1], aeron_errcode(), aeron_errmsg());
+        return EXIT_FAILURE;
+    }
+
+    if (aeron_driver_agent_binary_log_wrap(&log, mapped_file.addr, mapped_file.length) < 0)
+    {
+        fprintf(stderr, "ERROR: %s (%d) %s\n", argv[1], aeron_errcode(), aeron_errmsg());
+        aeron_unmap(&mapped_file);
+        return EXIT_FAILURE;
+    }
+
+    size_t records = aeron_driver_agent_binary_log_decode(&log, dump_record, NULL);
+    printf("%" PRIu64 " records\n", (uint64_t)records);
+
+    aeron_unmap(&mapped_file);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,324 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "util/aeron_error.h"
+#include "util/aeron_bitutil.h"
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "aeron_driver_common.h"
+#include "archive/aeron_archive_catalog.h"
+#include "archive/aeron_archive_recording_writer.h"
+
+#define AERON_ARCHIVE_CATALOG_STRING_COUNT (3)
+
+static uint8_t *aeron_archive_catalog_record(aeron_archive_catalog_t *catalog, int64_t recording_id)
+{
+    return (uint8_t *)catalog->mapped_file.addr + ((recording_id + 1) * (int64_t)catalog->record_length);
+}
+
+static size_t aeron_archive_catalog_max_strings_length(aeron_archive_catalog_t *catalog)
+{
+    return catalog->record_length - (sizeof(aeron_archive_recording_descriptor_header_t) +
+        sizeof(aeron_archive_recording_descriptor_t) + (AERON_ARCHIVE_CATALOG_STRING_COUNT * sizeof(int32_t)));
+}
+
+/*
+ * The position after the last whole frame in the last segment file of a recording, or the start position if no
+ * segment has been written.
+ */
+static int64_t aeron_archive_catalog_recover_stop_position(
+    aeron_archive_catalog_t *catalog, aeron_archive_recording_descriptor_t *descriptor)
+{
+    const int64_t base_position = aeron_archive_segment_base_position(
+        descriptor->start_position, descriptor->term_buffer_length);
+    char path[AERON_MAX_PATH];
+    int32_t segment_index = 0;
+
+    while (true)
+    {
+        aeron_archive_segment_file_name(
+            path, sizeof(path), catalog->archive_dir, descriptor->recording_id, segment_index + 1);
+        if (access(path, F_OK) != 0)
+        {
+            break;
+        }
+        segment_index++;
+    }
+
+    aeron_archive_segment_file_name(path, sizeof(path), catalog->archive_dir, descriptor->recording_id, segment_index);
+
+    aeron_mapped_file_t segment = { NULL, 0 };
+    if (aeron_map_existing_file(&segment, path) < 0)
+    {
+        return descriptor->start_position;
+    }
+
+    const int64_t segment_position = base_position + ((int64_t)segment_index * descriptor->segment_file_length);
+    int64_t offset = 0 == segment_index ? descriptor->start_position - base_position : 0;
+
+    while (offset + (int64_t)AERON_DATA_HEADER_LENGTH <= (int64_t)segment.length)
+    {
+        aeron_frame_header_t *frame = (aeron_frame_header_t *)((uint8_t *)segment.addr + offset);
+        if (frame->frame_length <= 0)
+        {
+            break;
+        }
+
+        offset += AERON_ALIGN(frame->frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+    aeron_unmap(&segment);
+
+    return segment_position + offset;
+}
+
+static int aeron_archive_catalog_refresh(aeron_archive_catalog_t *catalog)
+{
+    int64_t recording_id = 0;
+
+    for (; recording_id < catalog->max_entries; recording_id++)
+    {
+        uint8_t *record = aeron_archive_catalog_record(catalog, recording_id);
+        aeron_archive_recording_descriptor_header_t *header = (aeron_archive_recording_descriptor_header_t *)record;
+
+        if (header->length <= 0)
+        {
+            break;
+        }
+
+        aeron_archive_recording_descriptor_t *descriptor =
+            (aeron_archive_recording_descriptor_t *)(record + sizeof(aeron_archive_recording_descriptor_header_t));
+
+        if (AERON_ARCHIVE_DESCRIPTOR_VALID == header->valid && AERON_ARCHIVE_NULL_POSITION == descriptor->stop_position)
+        {
+            descriptor->stop_position = aeron_archive_catalog_recover_stop_position(catalog, descriptor);
+        }
+    }
+
+    catalog->next_recording_id = recording_id;
+
+    return 0;
+}
+
+int aeron_archive_catalog_open(
+    aeron_archive_catalog_t *catalog, const char *archive_dir, int64_t max_entries, int file_sync_level)
+{
+    char path[AERON_MAX_PATH];
+
+    snprintf(path, sizeof(path), "%s/%s", archive_dir, AERON_ARCHIVE_CATALOG_FILE_NAME);
+
+    catalog->archive_dir = archive_dir;
+    catalog->file_sync_level = file_sync_level;
+    catalog->next_recording_id = 0;
+
+    if (access(path, F_OK) == 0)
+    {
+        if (aeron_map_existing_file(&catalog->mapped_file, path) < 0)
+        {
+            return -1;
+        }
+
+        aeron_archive_catalog_header_t *header = (aeron_archive_catalog_header_t *)catalog->mapped_file.addr;
+
+        if (catalog->mapped_file.length < AERON_ARCHIVE_CATALOG_RECORD_LENGTH ||
+            AERON_ARCHIVE_CATALOG_VERSION != header->version ||
+            header->entry_length < (int32_t)AERON_ARCHIVE_CATALOG_RECORD_LENGTH / 2)
+        {
+            aeron_set_err(EINVAL, "invalid catalog %s: version=%" PRId32, path, header->version);
+            aeron_unmap(&catalog->mapped_file);
+            return -1;
+        }
+
+        catalog->record_length = (size_t)header->entry_length;
+    }
+    else
+    {
+        if (max_entries < 1)
+        {
+            aeron_set_err(EINVAL, "catalog max entries must be positive: %" PRId64, max_entries);
+            return -1;
+        }
+
+        catalog->mapped_file.length = (size_t)(max_entries + 1) * AERON_ARCHIVE_CATALOG_RECORD_LENGTH;
+        if (aeron_map_new_file(&catalog->mapped_file, path, false, AERON_PAGE_MIN_SIZE) < 0)
+        {
+            return -1;
+        }
+
+        aeron_archive_catalog_header_t *header = (aeron_archive_catalog_header_t *)catalog->mapped_file.addr;
+
+        header->entry_length = AERON_ARCHIVE_CATALOG_RECORD_LENGTH;
+        header->version = AERON_ARCHIVE_CATALOG_VERSION;
+        catalog->record_length = AERON_ARCHIVE_CATALOG_RECORD_LENGTH;
+    }
+
+    catalog->max_entries = (int64_t)(catalog->mapped_file.length / catalog->record_length) - 1;
+
+    return aeron_archive_catalog_refresh(catalog);
+}
+
+int aeron_archive_catalog_close(aeron_archive_catalog_t *catalog)
+{
+    if (NULL == catalog->mapped_file.addr)
+    {
+        return 0;
+    }
+
+    int result = aeron_unmap(&catalog->mapped_file);
+    catalog->mapped_file.addr = NULL;
+
+    return result;
+}
+
+static void aeron_archive_catalog_sync(aeron_archive_catalog_t *catalog)
+{
+    if (catalog->file_sync_level > 0)
+    {
+        msync(catalog->mapped_file.addr, catalog->mapped_file.length, MS_SYNC);
+    }
+}
+
+static uint8_t *aeron_archive_catalog_put_string(uint8_t *ptr, const char *value)
+{
+    const int32_t length = (int32_t)strlen(value);
+
+    memcpy(ptr, &length, sizeof(length));
+    memcpy(ptr + sizeof(length), value, (size_t)length);
+
+    return ptr + sizeof(length) + length;
+}
+
+int64_t aeron_archive_catalog_add_recording(
+    aeron_archive_catalog_t *catalog,
+    int64_t start_position,
+    int64_t start_timestamp,
+    int32_t initial_term_id,
+    int32_t segment_file_length,
+    int32_t term_buffer_length,
+    int32_t mtu_length,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *stripped_channel,
+    const char *original_channel,
+    const char *source_identity)
+{
+    if (catalog->next_recording_id >= catalog->max_entries)
+    {
+        aeron_set_err(ENOSPC, "catalog is full, max recordings reached: %" PRId64, catalog->max_entries);
+        return -1;
+    }
+
+    const size_t strings_length = strlen(stripped_channel) + strlen(original_channel) + strlen(source_identity);
+    if (strings_length > aeron_archive_catalog_max_strings_length(catalog))
+    {
+        aeron_set_err(
+            EINVAL, "combined length of channel and source identity exceeds max allowed: %s", original_channel);
+        return -1;
+    }
+
+    const int64_t recording_id = catalog->next_recording_id;
+    uint8_t *record = aeron_archive_catalog_record(catalog, recording_id);
+    aeron_archive_recording_descriptor_header_t *header = (aeron_archive_recording_descriptor_header_t *)record;
+    aeron_archive_recording_descriptor_t *descriptor =
+        (aeron_archive_recording_descriptor_t *)(record + sizeof(aeron_archive_recording_descriptor_header_t));
+
+    descriptor->control_session_id = 0;
+    descriptor->correlation_id = 0;
+    descriptor->recording_id = recording_id;
+    descriptor->start_timestamp = start_timestamp;
+    descriptor->stop_timestamp = AERON_ARCHIVE_NULL_TIMESTAMP;
+    descriptor->start_position = start_position;
+    descriptor->stop_position = AERON_ARCHIVE_NULL_POSITION;
+    descriptor->initial_term_id = initial_term_id;
+    descriptor->segment_file_length = segment_file_length;
+    descriptor->term_buffer_length = term_buffer_length;
+    descriptor->mtu_length = mtu_length;
+    descriptor->session_id = session_id;
+    descriptor->stream_id = stream_id;
+
+    uint8_t *ptr = (uint8_t *)(descriptor + 1);
+    ptr = aeron_archive_catalog_put_string(ptr, stripped_channel);
+    ptr = aeron_archive_catalog_put_string(ptr, original_channel);
+    ptr = aeron_archive_catalog_put_string(ptr, source_identity);
+
+    header->valid = AERON_ARCHIVE_DESCRIPTOR_VALID;
+    AERON_PUT_ORDERED(header->length, (int32_t)(ptr - (uint8_t *)descriptor));
+
+    catalog->next_recording_id++;
+    aeron_archive_catalog_sync(catalog);
+
+    return recording_id;
+}
+
+void aeron_archive_catalog_recording_stopped(
+    aeron_archive_catalog_t *catalog, int64_t recording_id, int64_t position, int64_t timestamp)
+{
+    aeron_archive_recording_descriptor_t *descriptor = aeron_archive_catalog_descriptor(catalog, recording_id);
+
+    if (NULL != descriptor)
+    {
+        descriptor->stop_timestamp = timestamp;
+        AERON_PUT_ORDERED(descriptor->stop_position, position);
+        aeron_archive_catalog_sync(catalog);
+    }
+}
+
+aeron_archive_recording_descriptor_t *aeron_archive_catalog_descriptor(
+    aeron_archive_catalog_t *catalog, int64_t recording_id)
+{
+    if (recording_id < 0 || recording_id >= catalog->next_recording_id)
+    {
+        return NULL;
+    }
+
+    return (aeron_archive_recording_descriptor_t *)(
+        aeron_archive_catalog_record(catalog, recording_id) + sizeof(aeron_archive_recording_descriptor_header_t));
+}
+
+const char *aeron_archive_catalog_descriptor_string(
+    aeron_archive_catalog_t *catalog, int64_t recording_id, int index, int32_t *length)
+{
+    aeron_archive_recording_descriptor_t *descriptor = aeron_archive_catalog_descriptor(catalog, recording_id);
+
+    if (NULL == descriptor || index < 0 || index >= AERON_ARCHIVE_CATALOG_STRING_COUNT)
+    {
+        *length = 0;
+        return NULL;
+    }
+
+    const uint8_t *ptr = (const uint8_t *)(descriptor + 1);
+
+    for (int i = 0; i < index; i++)
+    {
+        int32_t skip;
+
+        memcpy(&skip, ptr, sizeof(skip));
+        ptr += sizeof(skip) + skip;
+    }
+
+    memcpy(length, ptr, sizeof(*length));
+
+    return (const char *)(ptr + sizeof(*length));
+}
+
+extern int64_t aeron_archive_catalog_recording_count(aeron_archive_catalog_t *catalog);
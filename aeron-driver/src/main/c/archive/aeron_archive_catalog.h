@@ -0,0 +1,141 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_ARCHIVE_CATALOG_H
+#define AERON_AERON_ARCHIVE_CATALOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "util/aeron_fileutil.h"
+
+#define AERON_ARCHIVE_CATALOG_FILE_NAME "archive.catalog"
+#define AERON_ARCHIVE_CATALOG_VERSION (0)
+#define AERON_ARCHIVE_CATALOG_RECORD_LENGTH (1024)
+#define AERON_ARCHIVE_CATALOG_MAX_ENTRIES_DEFAULT (8 * 1024)
+
+#define AERON_ARCHIVE_NULL_POSITION (-1)
+#define AERON_ARCHIVE_NULL_TIMESTAMP (-1)
+
+#define AERON_ARCHIVE_DESCRIPTOR_VALID (1)
+#define AERON_ARCHIVE_DESCRIPTOR_INVALID (0)
+
+/*
+ * The catalog file has the layout of the Java archive.catalog so either archive can read the recordings of the other:
+ * a record holding the catalog header, then one fixed length record per recording id of a descriptor header and an SBE
+ * RecordingDescriptor body without message header, whose channels and source identity follow as length prefixed
+ * strings.
+ */
+#pragma pack(push)
+#pragma pack(1)
+typedef struct aeron_archive_catalog_header_stct
+{
+    int32_t version;
+    int32_t entry_length;
+}
+aeron_archive_catalog_header_t;
+
+typedef struct aeron_archive_recording_descriptor_header_stct
+{
+    int32_t length;
+    int8_t valid;
+    uint8_t pad[26];
+    int8_t reserved;
+}
+aeron_archive_recording_descriptor_header_t;
+
+typedef struct aeron_archive_recording_descriptor_stct
+{
+    int64_t control_session_id;
+    int64_t correlation_id;
+    int64_t recording_id;
+    int64_t start_timestamp;
+    int64_t stop_timestamp;
+    int64_t start_position;
+    int64_t stop_position;
+    int32_t initial_term_id;
+    int32_t segment_file_length;
+    int32_t term_buffer_length;
+    int32_t mtu_length;
+    int32_t session_id;
+    int32_t stream_id;
+}
+aeron_archive_recording_descriptor_t;
+#pragma pack(pop)
+
+typedef struct aeron_archive_catalog_stct
+{
+    aeron_mapped_file_t mapped_file;
+    const char *archive_dir;
+    size_t record_length;
+    int64_t max_entries;
+    int64_t next_recording_id;
+    int file_sync_level;
+}
+aeron_archive_catalog_t;
+
+/*
+ * Open the catalog in archive_dir, creating it with room for max_entries recordings if it does not exist. Recordings
+ * of an existing catalog that were never stopped, e.g. because the recorder crashed, have their stop position
+ * recovered from the last frame written to their segment files.
+ */
+int aeron_archive_catalog_open(
+    aeron_archive_catalog_t *catalog, const char *archive_dir, int64_t max_entries, int file_sync_level);
+
+int aeron_archive_catalog_close(aeron_archive_catalog_t *catalog);
+
+/*
+ * Add a descriptor for a new recording with a NULL stop position.
+ *
+ * @return the recording id or -1 if the catalog is full or the strings do not fit in a record.
+ */
+int64_t aeron_archive_catalog_add_recording(
+    aeron_archive_catalog_t *catalog,
+    int64_t start_position,
+    int64_t start_timestamp,
+    int32_t initial_term_id,
+    int32_t segment_file_length,
+    int32_t term_buffer_length,
+    int32_t mtu_length,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *stripped_channel,
+    const char *original_channel,
+    const char *source_identity);
+
+void aeron_archive_catalog_recording_stopped(
+    aeron_archive_catalog_t *catalog, int64_t recording_id, int64_t position, int64_t timestamp);
+
+/*
+ * The descriptor of a recording, or NULL if the id has not been added. Fields may be read while the recording is
+ * written; the stop position is published with an ordered store once the recording stops.
+ */
+aeron_archive_recording_descriptor_t *aeron_archive_catalog_descriptor(
+    aeron_archive_catalog_t *catalog, int64_t recording_id);
+
+/*
+ * The string at index 0 (stripped channel), 1 (original channel) or 2 (source identity) of a descriptor. The string is
+ * not NUL terminated.
+ */
+const char *aeron_archive_catalog_descriptor_string(
+    aeron_archive_catalog_t *catalog, int64_t recording_id, int index, int32_t *length);
+
+inline int64_t aeron_archive_catalog_recording_count(aeron_archive_catalog_t *catalog)
+{
+    return catalog->next_recording_id;
+}
+
+#endif //AERON_AERON_ARCHIVE_CATALOG_H
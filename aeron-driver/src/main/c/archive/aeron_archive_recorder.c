@@ -0,0 +1,460 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <sys/stat.h>
+#include "aeron_alloc.h"
+#include "aeron_driver_context.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_error.h"
+#include "archive/aeron_archive_recorder.h"
+
+#define AERON_CONFIG_GETENV_OR_DEFAULT(e,d) ((NULL == getenv(e)) ? (d) : getenv(e))
+
+void aeron_archive_recorder_context_init(aeron_archive_recorder_context_t *context)
+{
+    context->archive_dir = AERON_CONFIG_GETENV_OR_DEFAULT(AERON_ARCHIVE_DIR_ENV_VAR, AERON_ARCHIVE_DIR_DEFAULT);
+    context->recordings = getenv(AERON_ARCHIVE_RECORDINGS_ENV_VAR);
+    context->segment_file_length = aeron_config_parse_int32(
+        getenv(AERON_ARCHIVE_SEGMENT_FILE_LENGTH_ENV_VAR),
+        AERON_ARCHIVE_SEGMENT_FILE_LENGTH_DEFAULT,
+        64 * 1024,
+        1024 * 1024 * 1024);
+    context->file_sync_level = aeron_config_parse_int32(
+        getenv(AERON_ARCHIVE_FILE_SYNC_LEVEL_ENV_VAR),
+        AERON_ARCHIVE_FILE_SYNC_LEVEL_DEFAULT,
+        0,
+        2);
+    context->max_catalog_entries = aeron_config_parse_int64(
+        getenv(AERON_ARCHIVE_MAX_CATALOG_ENTRIES_ENV_VAR),
+        AERON_ARCHIVE_CATALOG_MAX_ENTRIES_DEFAULT,
+        1,
+        INT32_MAX);
+    context->batch_length = (size_t)aeron_config_parse_uint64(
+        getenv(AERON_ARCHIVE_RECORDING_BATCH_LENGTH_ENV_VAR),
+        AERON_ARCHIVE_RECORDING_BATCH_LENGTH_DEFAULT,
+        4096,
+        INT32_MAX);
+}
+
+static int aeron_archive_recorder_add_recordings(aeron_archive_recorder_t *recorder, const char *recordings)
+{
+    char *spec = strdup(recordings);
+    char *save_ptr = NULL;
+    int result = 0;
+
+    if (NULL == spec)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not copy recordings");
+        return -1;
+    }
+
+    for (char *entry = strtok_r(spec, ";", &save_ptr); NULL != entry; entry = strtok_r(NULL, ";", &save_ptr))
+    {
+        char *separator = strchr(entry, ':');
+        char *end_ptr = NULL;
+
+        if (NULL == separator)
+        {
+            aeron_set_err(EINVAL, "recording must be <stream id>:<channel>: %s", entry);
+            result = -1;
+            break;
+        }
+
+        *separator = '\0';
+        errno = 0;
+        long stream_id = strtol(entry, &end_ptr, 10);
+        if (0 != errno || end_ptr == entry || '\0' != *end_ptr || stream_id < INT32_MIN || stream_id > INT32_MAX)
+        {
+            aeron_set_err(EINVAL, "invalid recording stream id: %s", entry);
+            result = -1;
+            break;
+        }
+
+        if (aeron_archive_recorder_add_recording(recorder, separator + 1, (int32_t)stream_id) < 0)
+        {
+            result = -1;
+            break;
+        }
+    }
+
+    free(spec);
+
+    return result;
+}
+
+int aeron_archive_recorder_init(
+    aeron_archive_recorder_t **recorder,
+    aeron_archive_recorder_context_t *context,
+    aeron_t *aeron,
+    aeron_distinct_error_log_t *error_log,
+    int64_t *errors_counter)
+{
+    aeron_archive_recorder_t *_recorder = NULL;
+
+    if (mkdir(context->archive_dir, S_IRWXU) != 0 && EEXIST != errno)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "mkdir %s: %s", context->archive_dir, strerror(errcode));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_recorder, sizeof(aeron_archive_recorder_t)) < 0)
+    {
+        return -1;
+    }
+
+    _recorder->context = *context;
+    _recorder->aeron = aeron;
+    _recorder->error_log = error_log;
+    _recorder->errors_counter = errors_counter;
+    _recorder->subscriptions.array = NULL;
+    _recorder->subscriptions.length = 0;
+    _recorder->subscriptions.capacity = 0;
+    _recorder->sessions.array = NULL;
+    _recorder->sessions.length = 0;
+    _recorder->sessions.capacity = 0;
+    _recorder->replays.array = NULL;
+    _recorder->replays.length = 0;
+    _recorder->replays.capacity = 0;
+
+    if (aeron_archive_catalog_open(
+        &_recorder->catalog, context->archive_dir, context->max_catalog_entries, context->file_sync_level) < 0)
+    {
+        aeron_free(_recorder);
+        return -1;
+    }
+
+    *recorder = _recorder;
+
+    if (NULL != context->recordings && aeron_archive_recorder_add_recordings(_recorder, context->recordings) < 0)
+    {
+        *recorder = NULL;
+        _recorder->aeron = NULL;
+        aeron_archive_recorder_on_close(_recorder);
+        return -1;
+    }
+
+    return 0;
+}
+
+static void aeron_archive_recorder_on_available_image(
+    void *clientd, aeron_subscription_t *subscription, aeron_image_t *image)
+{
+    aeron_archive_recorded_subscription_t *recorded = (aeron_archive_recorded_subscription_t *)clientd;
+    aeron_archive_recorder_t *recorder = recorded->recorder;
+    int ensure_capacity_result = 0;
+
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result, recorder->sessions, aeron_archive_recording_session_t *);
+    if (ensure_capacity_result < 0 ||
+        aeron_archive_recording_session_create(
+            &recorder->sessions.array[recorder->sessions.length],
+            image,
+            &recorder->catalog,
+            recorder->context.archive_dir,
+            recorded->channel,
+            recorded->stream_id,
+            recorder->context.segment_file_length,
+            recorder->context.batch_length,
+            recorder->context.file_sync_level) < 0)
+    {
+        AERON_ARCHIVE_RECORDER_ERROR(
+            recorder,
+            "could not record image %" PRId64 " of %s stream %" PRId32,
+            aeron_image_correlation_id(image),
+            recorded->channel,
+            recorded->stream_id);
+        return;
+    }
+
+    recorder->sessions.length++;
+}
+
+int aeron_archive_recorder_add_recording(aeron_archive_recorder_t *recorder, const char *channel, int32_t stream_id)
+{
+    aeron_archive_recorded_subscription_t *recorded = NULL;
+    int ensure_capacity_result = 0;
+
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result, recorder->subscriptions, aeron_archive_recorded_subscription_t *);
+    if (ensure_capacity_result < 0 ||
+        aeron_alloc((void **)&recorded, sizeof(aeron_archive_recorded_subscription_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (NULL == (recorded->channel = strdup(channel)))
+    {
+        aeron_set_err(ENOMEM, "%s", "could not copy recording channel");
+        aeron_free(recorded);
+        return -1;
+    }
+
+    recorded->recorder = recorder;
+    recorded->stream_id = stream_id;
+    recorded->subscription = NULL;
+
+    if (aeron_async_add_subscription(
+        &recorded->async,
+        recorder->aeron,
+        channel,
+        stream_id,
+        aeron_archive_recorder_on_available_image,
+        recorded,
+        NULL,
+        NULL) < 0)
+    {
+        free(recorded->channel);
+        aeron_free(recorded);
+        return -1;
+    }
+
+    recorder->subscriptions.array[recorder->subscriptions.length++] = recorded;
+
+    return 0;
+}
+
+int aeron_archive_recorder_start_replay(
+    aeron_archive_recorder_t *recorder,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    const char *replay_channel,
+    int32_t replay_stream_id)
+{
+    aeron_archive_recording_descriptor_t *descriptor = aeron_archive_catalog_descriptor(&recorder->catalog, recording_id);
+    char channel[AERON_MAX_PATH];
+    int ensure_capacity_result = 0;
+
+    if (NULL == descriptor)
+    {
+        aeron_set_err(EINVAL, "unknown recording id: %" PRId64, recording_id);
+        return -1;
+    }
+
+    if (AERON_ARCHIVE_NULL_POSITION == position)
+    {
+        position = descriptor->start_position;
+    }
+
+    if (aeron_archive_replay_channel(channel, sizeof(channel), replay_channel, descriptor, position) < 0)
+    {
+        return -1;
+    }
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, recorder->replays, aeron_archive_replay_t);
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    aeron_archive_replay_t *replay = &recorder->replays.array[recorder->replays.length];
+
+    replay->recording_id = recording_id;
+    replay->position = position;
+    replay->length = length;
+    replay->publication = NULL;
+    replay->session = NULL;
+
+    if (aeron_async_add_exclusive_publication(&replay->async, recorder->aeron, channel, replay_stream_id) < 0)
+    {
+        return -1;
+    }
+
+    recorder->replays.length++;
+
+    return 0;
+}
+
+static int aeron_archive_recorder_replay_do_work(aeron_archive_recorder_t *recorder, aeron_archive_replay_t *replay)
+{
+    if (NULL != replay->async)
+    {
+        int result = aeron_async_add_exclusive_publication_poll(&replay->publication, replay->async);
+        if (0 == result)
+        {
+            return 0;
+        }
+
+        replay->async = NULL;
+        if (result < 0 ||
+            aeron_archive_replay_session_create(
+                &replay->session,
+                &recorder->catalog,
+                recorder->context.archive_dir,
+                replay->recording_id,
+                replay->position,
+                replay->length,
+                replay->publication,
+                recorder->context.batch_length) < 0)
+        {
+            AERON_ARCHIVE_RECORDER_ERROR(
+                recorder, "could not start replay of recording %" PRId64, replay->recording_id);
+            return -1;
+        }
+
+        return 1;
+    }
+
+    int bytes_replayed = aeron_archive_replay_session_do_work(replay->session);
+    if (bytes_replayed < 0)
+    {
+        AERON_ARCHIVE_RECORDER_ERROR(recorder, "could not replay recording %" PRId64, replay->recording_id);
+    }
+
+    return bytes_replayed;
+}
+
+static void aeron_archive_recorder_replay_close(aeron_archive_replay_t *replay)
+{
+    aeron_archive_replay_session_close(replay->session);
+
+    if (NULL != replay->publication)
+    {
+        aeron_publication_close(replay->publication);
+    }
+}
+
+static int aeron_archive_recorder_poll_subscriptions(aeron_archive_recorder_t *recorder)
+{
+    int work_count = 0;
+
+    for (size_t i = 0; i < recorder->subscriptions.length; i++)
+    {
+        aeron_archive_recorded_subscription_t *recorded = recorder->subscriptions.array[i];
+
+        if (NULL != recorded->async)
+        {
+            int result = aeron_async_add_subscription_poll(&recorded->subscription, recorded->async);
+            if (0 != result)
+            {
+                recorded->async = NULL;
+                work_count++;
+
+                if (result < 0)
+                {
+                    AERON_ARCHIVE_RECORDER_ERROR(
+                        recorder, "could not subscribe to %s stream %" PRId32, recorded->channel, recorded->stream_id);
+                }
+            }
+        }
+    }
+
+    return work_count;
+}
+
+int aeron_archive_recorder_do_work(void *clientd)
+{
+    aeron_archive_recorder_t *recorder = (aeron_archive_recorder_t *)clientd;
+    int work_count = aeron_main_do_work(recorder->aeron);
+
+    if (work_count < 0)
+    {
+        return -1;
+    }
+
+    work_count += aeron_archive_recorder_poll_subscriptions(recorder);
+
+    for (int last_index = (int)recorder->sessions.length - 1, i = last_index; i >= 0; i--)
+    {
+        aeron_archive_recording_session_t *session = recorder->sessions.array[i];
+        int bytes_written = aeron_archive_recording_session_do_work(session);
+
+        if (bytes_written > 0)
+        {
+            work_count += bytes_written;
+        }
+        else if (bytes_written < 0)
+        {
+            AERON_ARCHIVE_RECORDER_ERROR(recorder, "could not write recording %" PRId64, session->recording_id);
+        }
+
+        if (AERON_ARCHIVE_RECORDING_SESSION_STATE_RECORDING != session->state)
+        {
+            aeron_archive_recording_session_close(session);
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)recorder->sessions.array,
+                sizeof(aeron_archive_recording_session_t *),
+                (size_t)i,
+                (size_t)last_index);
+            last_index--;
+            recorder->sessions.length--;
+            work_count++;
+        }
+    }
+
+    for (int last_index = (int)recorder->replays.length - 1, i = last_index; i >= 0; i--)
+    {
+        aeron_archive_replay_t *replay = &recorder->replays.array[i];
+        int result = aeron_archive_recorder_replay_do_work(recorder, replay);
+
+        if (result > 0)
+        {
+            work_count += result;
+        }
+
+        if (result < 0 || (NULL != replay->session &&
+            AERON_ARCHIVE_REPLAY_SESSION_STATE_DONE == replay->session->state))
+        {
+            aeron_archive_recorder_replay_close(replay);
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)recorder->replays.array, sizeof(aeron_archive_replay_t), (size_t)i, (size_t)last_index);
+            last_index--;
+            recorder->replays.length--;
+            work_count++;
+        }
+    }
+
+    return work_count;
+}
+
+void aeron_archive_recorder_on_close(void *clientd)
+{
+    aeron_archive_recorder_t *recorder = (aeron_archive_recorder_t *)clientd;
+
+    for (size_t i = 0; i < recorder->sessions.length; i++)
+    {
+        aeron_archive_recording_session_close(recorder->sessions.array[i]);
+    }
+
+    for (size_t i = 0; i < recorder->replays.length; i++)
+    {
+        aeron_archive_replay_session_close(recorder->replays.array[i].session);
+    }
+
+    for (size_t i = 0; i < recorder->subscriptions.length; i++)
+    {
+        free(recorder->subscriptions.array[i]->channel);
+        aeron_free(recorder->subscriptions.array[i]);
+    }
+
+    if (NULL != recorder->aeron)
+    {
+        aeron_close(recorder->aeron);
+    }
+
+    aeron_archive_catalog_close(&recorder->catalog);
+    aeron_free(recorder->sessions.array);
+    aeron_free(recorder->replays.array);
+    aeron_free(recorder->subscriptions.array);
+    aeron_free(recorder);
+}
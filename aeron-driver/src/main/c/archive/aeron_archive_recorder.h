@@ -0,0 +1,200 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_ARCHIVE_RECORDER_H
+#define AERON_AERON_ARCHIVE_RECORDER_H
+
+#include "client/aeronc.h"
+#include "concurrent/aeron_counters_manager.h"
+#include "concurrent/aeron_distinct_error_log.h"
+#include "archive/aeron_archive_catalog.h"
+#include "archive/aeron_archive_recording_session.h"
+#include "archive/aeron_archive_replay_session.h"
+
+/**
+ * Directory holding the catalog and segment files of the recordings.
+ */
+#define AERON_ARCHIVE_DIR_ENV_VAR "AERON_ARCHIVE_DIR"
+
+/**
+ * Length of each segment file of a recording, a power of two of at least the term length.
+ */
+#define AERON_ARCHIVE_SEGMENT_FILE_LENGTH_ENV_VAR "AERON_ARCHIVE_SEGMENT_FILE_LENGTH"
+
+/**
+ * 0 leaves recorded data to the page cache, 1 syncs data after each write and 2 also syncs file metadata.
+ */
+#define AERON_ARCHIVE_FILE_SYNC_LEVEL_ENV_VAR "AERON_ARCHIVE_FILE_SYNC_LEVEL"
+
+/**
+ * Number of recordings a new catalog has room for.
+ */
+#define AERON_ARCHIVE_MAX_CATALOG_ENTRIES_ENV_VAR "AERON_ARCHIVE_MAX_CATALOG_ENTRIES"
+
+/**
+ * Maximum bytes of an image written per duty cycle, capped at half the term length.
+ */
+#define AERON_ARCHIVE_RECORDING_BATCH_LENGTH_ENV_VAR "AERON_ARCHIVE_RECORDING_BATCH_LENGTH"
+
+/**
+ * Streams to record, separated by ';', each given as <stream id>:<channel>. Use an aeron-spy: channel to record a
+ * network publication of this driver without a subscriber on the wire.
+ */
+#define AERON_ARCHIVE_RECORDINGS_ENV_VAR "AERON_ARCHIVE_RECORDINGS"
+
+#define AERON_ARCHIVE_DIR_DEFAULT "archive"
+#define AERON_ARCHIVE_SEGMENT_FILE_LENGTH_DEFAULT (128 * 1024 * 1024)
+#define AERON_ARCHIVE_FILE_SYNC_LEVEL_DEFAULT (0)
+#define AERON_ARCHIVE_RECORDING_BATCH_LENGTH_DEFAULT (1024 * 1024)
+
+typedef struct aeron_archive_recorder_context_stct
+{
+    const char *archive_dir;
+    const char *recordings;
+    int32_t segment_file_length;
+    int file_sync_level;
+    int64_t max_catalog_entries;
+    size_t batch_length;
+}
+aeron_archive_recorder_context_t;
+
+typedef struct aeron_archive_recorded_subscription_stct
+{
+    struct aeron_archive_recorder_stct *recorder;
+    char *channel;
+    int32_t stream_id;
+    aeron_async_add_subscription_t *async;
+    aeron_subscription_t *subscription;
+}
+aeron_archive_recorded_subscription_t;
+
+typedef struct aeron_archive_replay_stct
+{
+    int64_t recording_id;
+    int64_t position;
+    int64_t length;
+    aeron_async_add_exclusive_publication_t *async;
+    aeron_publication_t *publication;
+    aeron_archive_replay_session_t *session;
+}
+aeron_archive_replay_t;
+
+/*
+ * Records images of subscriptions on the client conductor thread of its own aeron_t, so new and closed images are seen
+ * in the same duty cycle that services the recording sessions and an image can never be freed beneath a session.
+ * A session is started from the available image handler of the subscription, so each image is offered to the recorder
+ * once and an image whose session could not be started is not retried.
+ */
+typedef struct aeron_archive_recorder_stct
+{
+    aeron_archive_recorder_context_t context;
+    aeron_t *aeron;
+    aeron_archive_catalog_t catalog;
+    aeron_distinct_error_log_t *error_log;
+    int64_t *errors_counter;
+
+    struct recorded_subscriptions_stct
+    {
+        aeron_archive_recorded_subscription_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    subscriptions;
+
+    struct recording_sessions_stct
+    {
+        aeron_archive_recording_session_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    sessions;
+
+    struct replays_stct
+    {
+        aeron_archive_replay_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    replays;
+}
+aeron_archive_recorder_t;
+
+#define AERON_ARCHIVE_RECORDER_ERROR(recorder, format, ...) \
+do \
+{ \
+    int err_code = aeron_errcode(); \
+    if (!aeron_distinct_error_log_try_record_at_site(recorder->error_log, err_code, format)) \
+    { \
+        char error_buffer[AERON_MAX_PATH]; \
+        snprintf(error_buffer, sizeof(error_buffer) - 1, format, __VA_ARGS__); \
+        aeron_distinct_error_log_record_at_site(recorder->error_log, err_code, format, aeron_errmsg(), error_buffer); \
+    } \
+    aeron_counter_increment(recorder->errors_counter, 1); \
+    aeron_set_err(0, "%s", "no error"); \
+} \
+while(0)
+
+/*
+ * Read the context from the AERON_ARCHIVE_* environment variables.
+ */
+void aeron_archive_recorder_context_init(aeron_archive_recorder_context_t *context);
+
+/*
+ * Create the archive directory, open its catalog and ask for the subscriptions of context->recordings.
+ *
+ * @param aeron client used exclusively by the recorder, and closed with it.
+ * @param error_log of the driver, which errors met in the duty cycle are recorded to.
+ * @param errors_counter of the driver, counting each error recorded.
+ */
+int aeron_archive_recorder_init(
+    aeron_archive_recorder_t **recorder,
+    aeron_archive_recorder_context_t *context,
+    aeron_t *aeron,
+    aeron_distinct_error_log_t *error_log,
+    int64_t *errors_counter);
+
+/*
+ * Ask for a subscription whose images are all recorded once they appear.
+ */
+int aeron_archive_recorder_add_recording(aeron_archive_recorder_t *recorder, const char *channel, int32_t stream_id);
+
+/*
+ * Replay a stopped recording on an exclusive publication of replay_channel started at the replay position, so the
+ * replayed stream has the positions of the recording. The publication is closed once the replay is done.
+ *
+ * @param position to replay from, or AERON_ARCHIVE_NULL_POSITION for the start of the recording.
+ * @param length to replay, or AERON_ARCHIVE_NULL_LENGTH to replay up to the stop position.
+ */
+int aeron_archive_recorder_start_replay(
+    aeron_archive_recorder_t *recorder,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    const char *replay_channel,
+    int32_t replay_stream_id);
+
+/*
+ * Run the client conductor, which starts sessions for new images, write what the sessions have and stop those whose
+ * image closed or that failed, then service the replays.
+ */
+int aeron_archive_recorder_do_work(void *clientd);
+
+/*
+ * Stop every session, recording its stop position, abandon the replays, close the client and delete the recorder.
+ */
+void aeron_archive_recorder_on_close(void *clientd);
+
+#endif //AERON_AERON_ARCHIVE_RECORDER_H
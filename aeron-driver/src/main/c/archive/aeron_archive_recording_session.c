@@ -0,0 +1,157 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include "aeronmd.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+#include "archive/aeron_archive_recording_session.h"
+
+int aeron_archive_recording_session_create(
+    aeron_archive_recording_session_t **session,
+    aeron_image_t *image,
+    aeron_archive_catalog_t *catalog,
+    const char *archive_dir,
+    const char *channel,
+    int32_t stream_id,
+    int32_t segment_file_length,
+    size_t batch_length,
+    int file_sync_level)
+{
+    aeron_archive_recording_session_t *_session = NULL;
+    const int64_t start_position = aeron_image_position(image);
+    const int32_t term_buffer_length = aeron_image_term_buffer_length(image);
+    const size_t max_batch_length = (size_t)term_buffer_length / 2;
+    const bool is_ipc = 0 == strncmp(channel, AERON_IPC_CHANNEL, AERON_IPC_CHANNEL_LEN);
+
+    if (segment_file_length < term_buffer_length)
+    {
+        segment_file_length = term_buffer_length;
+    }
+
+    if (aeron_alloc((void **)&_session, sizeof(aeron_archive_recording_session_t)) < 0)
+    {
+        return -1;
+    }
+
+    int64_t recording_id = aeron_archive_catalog_add_recording(
+        catalog,
+        start_position,
+        aeron_epochclock(),
+        aeron_image_initial_term_id(image),
+        segment_file_length,
+        term_buffer_length,
+        aeron_image_mtu_length(image),
+        aeron_image_session_id(image),
+        stream_id,
+        channel,
+        channel,
+        is_ipc ? AERON_IPC_CHANNEL : "");
+
+    if (recording_id < 0 ||
+        aeron_archive_recording_writer_init(
+            &_session->writer,
+            archive_dir,
+            recording_id,
+            start_position,
+            term_buffer_length,
+            segment_file_length,
+            file_sync_level) < 0)
+    {
+        aeron_free(_session);
+        return -1;
+    }
+
+    _session->image = image;
+    _session->catalog = catalog;
+    _session->recording_id = recording_id;
+    _session->image_correlation_id = aeron_image_correlation_id(image);
+    _session->batch_length = 0 == batch_length || batch_length > max_batch_length ? max_batch_length : batch_length;
+    _session->state = AERON_ARCHIVE_RECORDING_SESSION_STATE_RECORDING;
+
+    *session = _session;
+
+    return 0;
+}
+
+static void aeron_archive_recording_session_on_block(
+    void *clientd, const uint8_t *buffer, int32_t term_offset, size_t length, int32_t session_id, int32_t term_id)
+{
+    aeron_archive_recording_session_t *session = (aeron_archive_recording_session_t *)clientd;
+
+    if (aeron_archive_recording_writer_on_block(&session->writer, buffer, length) < 0)
+    {
+        session->state = AERON_ARCHIVE_RECORDING_SESSION_STATE_FAILED;
+    }
+}
+
+int aeron_archive_recording_session_do_work(aeron_archive_recording_session_t *session)
+{
+    if (AERON_ARCHIVE_RECORDING_SESSION_STATE_RECORDING != session->state)
+    {
+        return 0;
+    }
+
+    if (aeron_image_is_closed(session->image))
+    {
+        session->state = AERON_ARCHIVE_RECORDING_SESSION_STATE_DONE;
+        return 0;
+    }
+
+    size_t remaining = session->batch_length;
+
+    while (remaining > 0 && AERON_ARCHIVE_RECORDING_SESSION_STATE_RECORDING == session->state)
+    {
+        int bytes = aeron_image_block_poll(
+            session->image, aeron_archive_recording_session_on_block, session, remaining);
+        if (0 == bytes)
+        {
+            break;
+        }
+
+        remaining -= (size_t)bytes;
+    }
+
+    int64_t bytes_written = aeron_archive_recording_writer_flush(&session->writer);
+    if (AERON_ARCHIVE_RECORDING_SESSION_STATE_FAILED == session->state || bytes_written < 0)
+    {
+        session->state = AERON_ARCHIVE_RECORDING_SESSION_STATE_FAILED;
+        return -1;
+    }
+
+    return (int)bytes_written;
+}
+
+int aeron_archive_recording_session_close(aeron_archive_recording_session_t *session)
+{
+    if (NULL == session)
+    {
+        return 0;
+    }
+
+    int result = aeron_archive_recording_writer_close(&session->writer);
+
+    aeron_archive_catalog_recording_stopped(
+        session->catalog,
+        session->recording_id,
+        aeron_archive_recording_writer_position(&session->writer),
+        aeron_epochclock());
+
+    aeron_free(session);
+
+    return result;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_ARCHIVE_RECORDING_SESSION_H
+#define AERON_AERON_ARCHIVE_RECORDING_SESSION_H
+
+#include "client/aeronc.h"
+#include "archive/aeron_archive_catalog.h"
+#include "archive/aeron_archive_recording_writer.h"
+
+typedef enum aeron_archive_recording_session_state_enum
+{
+    AERON_ARCHIVE_RECORDING_SESSION_STATE_RECORDING,
+    AERON_ARCHIVE_RECORDING_SESSION_STATE_FAILED,
+    AERON_ARCHIVE_RECORDING_SESSION_STATE_DONE
+}
+aeron_archive_recording_session_state_t;
+
+/*
+ * Records one image into the segment files of one recording. The image is polled in blocks so whole frames, headers
+ * included, go to disk exactly as they are in the term buffers.
+ */
+typedef struct aeron_archive_recording_session_stct
+{
+    aeron_image_t *image;
+    aeron_archive_catalog_t *catalog;
+    aeron_archive_recording_writer_t writer;
+    int64_t recording_id;
+    int64_t image_correlation_id;
+    size_t batch_length;
+    aeron_archive_recording_session_state_t state;
+}
+aeron_archive_recording_session_t;
+
+/*
+ * Add the image to the catalog and create a session recording it from its current position.
+ *
+ * @param batch_length maximum bytes polled per duty cycle, capped at half a term so the queued blocks are written well
+ * before the image can be cleaned beneath them.
+ */
+int aeron_archive_recording_session_create(
+    aeron_archive_recording_session_t **session,
+    aeron_image_t *image,
+    aeron_archive_catalog_t *catalog,
+    const char *archive_dir,
+    const char *channel,
+    int32_t stream_id,
+    int32_t segment_file_length,
+    size_t batch_length,
+    int file_sync_level);
+
+/*
+ * Poll the image and write what was read. The session is done once the image closes and failed if a write fails.
+ *
+ * @return the number of bytes written or -1 for error.
+ */
+int aeron_archive_recording_session_do_work(aeron_archive_recording_session_t *session);
+
+/*
+ * Close the writer, record the stop position in the catalog and delete the session.
+ */
+int aeron_archive_recording_session_close(aeron_archive_recording_session_t *session);
+
+#endif //AERON_AERON_ARCHIVE_RECORDING_SESSION_H
@@ -0,0 +1,243 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "util/aeron_error.h"
+#include "util/aeron_bitutil.h"
+#include "aeron_driver_common.h"
+#include "archive/aeron_archive_recording_writer.h"
+
+int aeron_archive_segment_file_name(
+    char *buffer, size_t length, const char *archive_dir, int64_t recording_id, int32_t segment_index)
+{
+    return snprintf(
+        buffer, length, "%s/%" PRId64 "-%" PRId32 AERON_ARCHIVE_SEGMENT_FILE_SUFFIX,
+        archive_dir, recording_id, segment_index);
+}
+
+int aeron_archive_recording_writer_init(
+    aeron_archive_recording_writer_t *writer,
+    const char *archive_dir,
+    int64_t recording_id,
+    int64_t start_position,
+    int32_t term_buffer_length,
+    int32_t segment_file_length,
+    int file_sync_level)
+{
+    if (segment_file_length < term_buffer_length)
+    {
+        segment_file_length = term_buffer_length;
+    }
+
+    if (!AERON_IS_POWER_OF_TWO(segment_file_length))
+    {
+        aeron_set_err(EINVAL, "segment file length not a power of two: %" PRId32, segment_file_length);
+        return -1;
+    }
+
+    writer->archive_dir = archive_dir;
+    writer->recording_id = recording_id;
+    writer->segment_base_position = aeron_archive_segment_base_position(start_position, term_buffer_length);
+    writer->position = start_position;
+    writer->pending_length = 0;
+    writer->iov_count = 0;
+    writer->segment_file_length = segment_file_length;
+    writer->segment_index = -1;
+    writer->fd = -1;
+    writer->file_sync_level = file_sync_level;
+
+    return 0;
+}
+
+static int aeron_archive_recording_writer_open_segment(
+    aeron_archive_recording_writer_t *writer, int32_t segment_index)
+{
+    char path[AERON_MAX_PATH];
+
+    if (writer->fd >= 0)
+    {
+        close(writer->fd);
+        writer->fd = -1;
+    }
+
+    aeron_archive_segment_file_name(path, sizeof(path), writer->archive_dir, writer->recording_id, segment_index);
+
+    int fd = open(path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "open %s: %s", path, strerror(errcode));
+        return -1;
+    }
+
+#if defined(HAVE_FALLOCATE)
+    int result = fallocate(fd, 0, 0, (off_t)writer->segment_file_length);
+    if (result < 0 && EOPNOTSUPP == errno)
+    {
+        result = ftruncate(fd, (off_t)writer->segment_file_length);
+    }
+#else
+    int result = ftruncate(fd, (off_t)writer->segment_file_length);
+#endif
+    if (result < 0)
+    {
+        int errcode = errno;
+
+        close(fd);
+        aeron_set_err(errcode, "allocate %s: %s", path, strerror(errcode));
+        return -1;
+    }
+
+    writer->fd = fd;
+    writer->segment_index = segment_index;
+
+    return 0;
+}
+
+int aeron_archive_recording_writer_on_block(
+    aeron_archive_recording_writer_t *writer, const uint8_t *buffer, size_t length)
+{
+    const int64_t segment_offset = (writer->position - writer->segment_base_position) &
+        (writer->segment_file_length - 1);
+
+    if (writer->iov_count > 0 &&
+        (AERON_ARCHIVE_RECORDING_WRITER_MAX_IOV == writer->iov_count || 0 == segment_offset))
+    {
+        if (aeron_archive_recording_writer_flush(writer) < 0)
+        {
+            return -1;
+        }
+    }
+
+    struct iovec *iov = &writer->iov[writer->iov_count];
+
+    if (writer->iov_count > 0 && (uint8_t *)iov[-1].iov_base + iov[-1].iov_len == buffer)
+    {
+        iov[-1].iov_len += length;
+    }
+    else
+    {
+        iov->iov_base = (void *)buffer;
+        iov->iov_len = length;
+        writer->iov_count++;
+    }
+
+    writer->pending_length += length;
+    writer->position += (int64_t)length;
+
+    return 0;
+}
+
+int64_t aeron_archive_recording_writer_flush(aeron_archive_recording_writer_t *writer)
+{
+    if (0 == writer->pending_length)
+    {
+        return 0;
+    }
+
+    const int64_t flush_position = writer->position - (int64_t)writer->pending_length;
+    const int32_t segment_index = (int32_t)(
+        (flush_position - writer->segment_base_position) / writer->segment_file_length);
+    off_t offset = (off_t)((flush_position - writer->segment_base_position) & (writer->segment_file_length - 1));
+
+    if (segment_index != writer->segment_index || writer->fd < 0)
+    {
+        if (aeron_archive_recording_writer_open_segment(writer, segment_index) < 0)
+        {
+            return -1;
+        }
+    }
+
+    struct iovec *iov = writer->iov;
+    int iov_count = (int)writer->iov_count;
+
+    while (iov_count > 0)
+    {
+        ssize_t written = pwritev(writer->fd, iov, iov_count, offset);
+        if (written < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            int errcode = errno;
+
+            aeron_set_err(errcode, "pwritev recording %" PRId64 ": %s", writer->recording_id, strerror(errcode));
+            return -1;
+        }
+
+        offset += written;
+        while (iov_count > 0 && (size_t)written >= iov->iov_len)
+        {
+            written -= iov->iov_len;
+            iov++;
+            iov_count--;
+        }
+
+        if (iov_count > 0)
+        {
+            iov->iov_base = (uint8_t *)iov->iov_base + written;
+            iov->iov_len -= (size_t)written;
+        }
+    }
+
+    if (writer->file_sync_level > 0)
+    {
+        int result = writer->file_sync_level > 1 ? fsync(writer->fd) : fdatasync(writer->fd);
+        if (result < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "sync recording %" PRId64 ": %s", writer->recording_id, strerror(errcode));
+            return -1;
+        }
+    }
+
+    const int64_t flushed_length = (int64_t)writer->pending_length;
+
+    writer->pending_length = 0;
+    writer->iov_count = 0;
+
+    return flushed_length;
+}
+
+int aeron_archive_recording_writer_close(aeron_archive_recording_writer_t *writer)
+{
+    int result = aeron_archive_recording_writer_flush(writer) < 0 ? -1 : 0;
+
+    if (writer->fd >= 0)
+    {
+        close(writer->fd);
+        writer->fd = -1;
+    }
+
+    return result;
+}
+
+extern int64_t aeron_archive_segment_base_position(int64_t start_position, int32_t term_buffer_length);
+extern int64_t aeron_archive_recording_writer_position(aeron_archive_recording_writer_t *writer);
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_ARCHIVE_RECORDING_WRITER_H
+#define AERON_AERON_ARCHIVE_RECORDING_WRITER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/uio.h>
+
+#define AERON_ARCHIVE_SEGMENT_FILE_SUFFIX ".rec"
+#define AERON_ARCHIVE_RECORDING_WRITER_MAX_IOV (16)
+
+/*
+ * Segment files are named as by the Java archive, <recording id>-<segment index>.rec. Segment 0 starts at the
+ * beginning of the term holding the start position, so the file offset of a position is its distance from there
+ * modulo the segment file length, which is a multiple of the term length.
+ */
+int aeron_archive_segment_file_name(
+    char *buffer, size_t length, const char *archive_dir, int64_t recording_id, int32_t segment_index);
+
+inline int64_t aeron_archive_segment_base_position(int64_t start_position, int32_t term_buffer_length)
+{
+    return start_position - (start_position & (term_buffer_length - 1));
+}
+
+/*
+ * Appends the blocks of an image to the segment files of a recording.
+ *
+ * Blocks are queued as iovecs pointing into the term buffers and written with a single pwritev per flush, so a batch
+ * that wraps from one term into the next, or several small blocks, costs one system call and no copy. The caller must
+ * flush before the image can be cleaned beneath the queued blocks, i.e. well within a term of them.
+ */
+typedef struct aeron_archive_recording_writer_stct
+{
+    const char *archive_dir;
+    int64_t recording_id;
+    int64_t segment_base_position;
+    int64_t position;
+    size_t pending_length;
+    struct iovec iov[AERON_ARCHIVE_RECORDING_WRITER_MAX_IOV];
+    size_t iov_count;
+    int32_t segment_file_length;
+    int32_t segment_index;
+    int fd;
+    int file_sync_level;
+}
+aeron_archive_recording_writer_t;
+
+/*
+ * @param segment_file_length a power of two, raised to the term length if shorter.
+ * @param file_sync_level 0 leaves writes to the page cache, 1 syncs data on each flush and 2 also syncs metadata.
+ */
+int aeron_archive_recording_writer_init(
+    aeron_archive_recording_writer_t *writer,
+    const char *archive_dir,
+    int64_t recording_id,
+    int64_t start_position,
+    int32_t term_buffer_length,
+    int32_t segment_file_length,
+    int file_sync_level);
+
+/*
+ * Queue a block for writing at the current position, flushing first if the queue is full or the block starts a new
+ * segment.
+ */
+int aeron_archive_recording_writer_on_block(
+    aeron_archive_recording_writer_t *writer, const uint8_t *buffer, size_t length);
+
+/*
+ * Write the queued blocks.
+ *
+ * @return the number of bytes written or -1 for error.
+ */
+int64_t aeron_archive_recording_writer_flush(aeron_archive_recording_writer_t *writer);
+
+/*
+ * Flush and close the current segment file.
+ */
+int aeron_archive_recording_writer_close(aeron_archive_recording_writer_t *writer);
+
+/*
+ * The position up to which blocks have been written to the segment files.
+ */
+inline int64_t aeron_archive_recording_writer_position(aeron_archive_recording_writer_t *writer)
+{
+    return writer->position - (int64_t)writer->pending_length;
+}
+
+#endif //AERON_AERON_ARCHIVE_RECORDING_WRITER_H
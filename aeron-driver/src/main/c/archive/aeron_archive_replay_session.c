@@ -0,0 +1,295 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "aeron_alloc.h"
+#include "aeron_driver_common.h"
+#include "util/aeron_error.h"
+#include "util/aeron_bitutil.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "uri/aeron_uri.h"
+#include "archive/aeron_archive_recording_writer.h"
+#include "archive/aeron_archive_replay_session.h"
+
+int aeron_archive_replay_channel(
+    char *buffer,
+    size_t length,
+    const char *channel,
+    aeron_archive_recording_descriptor_t *descriptor,
+    int64_t position)
+{
+    const size_t position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes(descriptor->term_buffer_length);
+    const int32_t term_id = aeron_logbuffer_compute_term_id_from_position(
+        position, position_bits_to_shift, descriptor->initial_term_id);
+    const int32_t term_offset = (int32_t)(position & (descriptor->term_buffer_length - 1));
+
+    int result = snprintf(
+        buffer,
+        length,
+        "%s%c%s=%" PRId32 "|%s=%" PRId32 "|%s=%" PRId32 "|%s=%" PRId32 "|%s=%" PRId32,
+        channel,
+        NULL == strchr(channel, '?') ? '?' : '|',
+        AERON_URI_INITIAL_TERM_ID_KEY, descriptor->initial_term_id,
+        AERON_URI_TERM_ID_KEY, term_id,
+        AERON_URI_TERM_OFFSET_KEY, term_offset,
+        AERON_URI_TERM_LENGTH_KEY, descriptor->term_buffer_length,
+        AERON_URI_MTU_LENGTH_KEY, descriptor->mtu_length);
+
+    if (result < 0 || (size_t)result >= length)
+    {
+        aeron_set_err(EINVAL, "replay channel too long: %s", channel);
+        return -1;
+    }
+
+    return result;
+}
+
+int aeron_archive_replay_session_create(
+    aeron_archive_replay_session_t **session,
+    aeron_archive_catalog_t *catalog,
+    const char *archive_dir,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    aeron_publication_t *publication,
+    size_t batch_length)
+{
+    aeron_archive_recording_descriptor_t *descriptor = aeron_archive_catalog_descriptor(catalog, recording_id);
+    aeron_archive_replay_session_t *_session = NULL;
+
+    if (NULL == descriptor)
+    {
+        aeron_set_err(EINVAL, "unknown recording id: %" PRId64, recording_id);
+        return -1;
+    }
+
+    const int64_t stop_position = descriptor->stop_position;
+    if (AERON_ARCHIVE_NULL_POSITION == stop_position)
+    {
+        aeron_set_err(EINVAL, "recording %" PRId64 " is still active", recording_id);
+        return -1;
+    }
+
+    if (AERON_ARCHIVE_NULL_POSITION == position)
+    {
+        position = descriptor->start_position;
+    }
+
+    if (position < descriptor->start_position || position > stop_position ||
+        0 != (position & (AERON_LOGBUFFER_FRAME_ALIGNMENT - 1)))
+    {
+        aeron_set_err(
+            EINVAL,
+            "replay position %" PRId64 " not a frame of recording %" PRId64 " [%" PRId64 ", %" PRId64 "]",
+            position, recording_id, descriptor->start_position, stop_position);
+        return -1;
+    }
+
+    if (aeron_publication_position(publication) != position)
+    {
+        aeron_set_err(
+            EINVAL,
+            "replay publication at %" PRId64 " not at replay position %" PRId64,
+            aeron_publication_position(publication), position);
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_session, sizeof(aeron_archive_replay_session_t)) < 0)
+    {
+        return -1;
+    }
+
+    _session->publication = publication;
+    _session->archive_dir = archive_dir;
+    _session->recording_id = recording_id;
+    _session->segment_base_position = aeron_archive_segment_base_position(
+        descriptor->start_position, descriptor->term_buffer_length);
+    _session->replay_position = position;
+    _session->replay_limit = AERON_ARCHIVE_NULL_LENGTH == length || position + length > stop_position ?
+        stop_position : position + length;
+    _session->segment_file_length = descriptor->segment_file_length;
+    _session->term_buffer_length = descriptor->term_buffer_length;
+    _session->segment_index = -1;
+    _session->segment_addr = NULL;
+    _session->segment_length = 0;
+    _session->batch_length = batch_length;
+    _session->state = AERON_ARCHIVE_REPLAY_SESSION_STATE_REPLAYING;
+
+    *session = _session;
+
+    return 0;
+}
+
+static void aeron_archive_replay_session_unmap_segment(aeron_archive_replay_session_t *session)
+{
+    if (NULL != session->segment_addr)
+    {
+        munmap(session->segment_addr, session->segment_length);
+        session->segment_addr = NULL;
+        session->segment_length = 0;
+    }
+}
+
+static int aeron_archive_replay_session_map_segment(aeron_archive_replay_session_t *session, int32_t segment_index)
+{
+    char path[AERON_MAX_PATH];
+    struct stat sb;
+
+    aeron_archive_replay_session_unmap_segment(session);
+    aeron_archive_segment_file_name(path, sizeof(path), session->archive_dir, session->recording_id, segment_index);
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0 || fstat(fd, &sb) < 0)
+    {
+        int errcode = errno;
+
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+
+        aeron_set_err(errcode, "open %s: %s", path, strerror(errcode));
+        return -1;
+    }
+
+    void *addr = mmap(NULL, (size_t)sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    int errcode = errno;
+
+    close(fd);
+
+    if (MAP_FAILED == addr)
+    {
+        aeron_set_err(errcode, "mmap %s: %s", path, strerror(errcode));
+        return -1;
+    }
+
+#if defined(MADV_SEQUENTIAL)
+    madvise(addr, (size_t)sb.st_size, MADV_SEQUENTIAL);
+#endif
+
+    session->segment_addr = (uint8_t *)addr;
+    session->segment_length = (size_t)sb.st_size;
+    session->segment_index = segment_index;
+
+    return 0;
+}
+
+int aeron_archive_replay_session_do_work(aeron_archive_replay_session_t *session)
+{
+    if (AERON_ARCHIVE_REPLAY_SESSION_STATE_REPLAYING != session->state)
+    {
+        return 0;
+    }
+
+    const int64_t position = session->replay_position;
+    if (position >= session->replay_limit)
+    {
+        session->state = AERON_ARCHIVE_REPLAY_SESSION_STATE_DONE;
+        return 0;
+    }
+
+    const int64_t recording_offset = position - session->segment_base_position;
+    const int32_t segment_index = (int32_t)(recording_offset / session->segment_file_length);
+    const int64_t segment_offset = recording_offset & (session->segment_file_length - 1);
+
+    if (segment_index != session->segment_index &&
+        aeron_archive_replay_session_map_segment(session, segment_index) < 0)
+    {
+        session->state = AERON_ARCHIVE_REPLAY_SESSION_STATE_FAILED;
+        return -1;
+    }
+
+    const int32_t term_offset = (int32_t)(position & (session->term_buffer_length - 1));
+    int64_t available = session->replay_limit - position;
+
+    if (available > session->term_buffer_length - term_offset)
+    {
+        available = session->term_buffer_length - term_offset;
+    }
+
+    if (available > (int64_t)session->batch_length)
+    {
+        available = (int64_t)session->batch_length;
+    }
+
+    if (segment_offset + available > (int64_t)session->segment_length)
+    {
+        aeron_set_err(EINVAL, "segment %" PRId32 " of recording %" PRId64 " is truncated",
+            segment_index, session->recording_id);
+        session->state = AERON_ARCHIVE_REPLAY_SESSION_STATE_FAILED;
+        return -1;
+    }
+
+    const uint8_t *block = session->segment_addr + segment_offset;
+    int64_t block_length = 0;
+
+    while (block_length < available)
+    {
+        const aeron_frame_header_t *frame = (const aeron_frame_header_t *)(block + block_length);
+        const int64_t aligned_length = AERON_ALIGN(frame->frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+        if (frame->frame_length <= 0 || block_length + aligned_length > available)
+        {
+            break;
+        }
+
+        block_length += aligned_length;
+    }
+
+    if (0 == block_length)
+    {
+        /* a length that ends within a frame replays up to the frame before it */
+        session->state = AERON_ARCHIVE_REPLAY_SESSION_STATE_DONE;
+        return 0;
+    }
+
+    const int64_t result = aeron_publication_offer_block(session->publication, block, (size_t)block_length);
+
+    if (result > 0)
+    {
+        session->replay_position = position + block_length;
+        return (int)block_length;
+    }
+
+    if (AERON_PUBLICATION_CLOSED == result ||
+        AERON_PUBLICATION_MAX_POSITION_EXCEEDED == result ||
+        AERON_PUBLICATION_ERROR == result)
+    {
+        session->state = AERON_ARCHIVE_REPLAY_SESSION_STATE_FAILED;
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_archive_replay_session_close(aeron_archive_replay_session_t *session)
+{
+    if (NULL != session)
+    {
+        aeron_archive_replay_session_unmap_segment(session);
+        aeron_free(session);
+    }
+
+    return 0;
+}
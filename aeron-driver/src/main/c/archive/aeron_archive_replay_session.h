@@ -0,0 +1,99 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_ARCHIVE_REPLAY_SESSION_H
+#define AERON_AERON_ARCHIVE_REPLAY_SESSION_H
+
+#include "client/aeronc.h"
+#include "archive/aeron_archive_catalog.h"
+
+#define AERON_ARCHIVE_NULL_LENGTH (-1)
+
+typedef enum aeron_archive_replay_session_state_enum
+{
+    AERON_ARCHIVE_REPLAY_SESSION_STATE_REPLAYING,
+    AERON_ARCHIVE_REPLAY_SESSION_STATE_FAILED,
+    AERON_ARCHIVE_REPLAY_SESSION_STATE_DONE
+}
+aeron_archive_replay_session_state_t;
+
+/*
+ * Replays a stopped recording into an exclusive publication started at the replay position, so each block read from
+ * a segment keeps the term id and offset it was recorded at.
+ *
+ * Segments are mapped read only and blocks are offered straight from the mapping, so the only copy is from the page
+ * cache into the term buffer rather than a read into a staging buffer followed by a copy per fragment.
+ */
+typedef struct aeron_archive_replay_session_stct
+{
+    aeron_publication_t *publication;
+    const char *archive_dir;
+    int64_t recording_id;
+    int64_t segment_base_position;
+    int64_t replay_position;
+    int64_t replay_limit;
+    int32_t segment_file_length;
+    int32_t term_buffer_length;
+    int32_t segment_index;
+    uint8_t *segment_addr;
+    size_t segment_length;
+    size_t batch_length;
+    aeron_archive_replay_session_state_t state;
+}
+aeron_archive_replay_session_t;
+
+/*
+ * Write the channel for a replay publication starting at position, i.e. channel with the initial term id, term id,
+ * term offset, term length and MTU of the recording added.
+ *
+ * @return the length of the channel or -1 if it does not fit.
+ */
+int aeron_archive_replay_channel(
+    char *buffer,
+    size_t length,
+    const char *channel,
+    aeron_archive_recording_descriptor_t *descriptor,
+    int64_t position);
+
+/*
+ * @param position to replay from, or AERON_ARCHIVE_NULL_POSITION for the start of the recording.
+ * @param length to replay, or AERON_ARCHIVE_NULL_LENGTH to replay up to the stop position.
+ * @param publication started at position with a channel from aeron_archive_replay_channel.
+ */
+int aeron_archive_replay_session_create(
+    aeron_archive_replay_session_t **session,
+    aeron_archive_catalog_t *catalog,
+    const char *archive_dir,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    aeron_publication_t *publication,
+    size_t batch_length);
+
+/*
+ * Offer the next block of the current term. The session is done once the replay limit is reached and failed if the
+ * publication closes or a segment cannot be mapped.
+ *
+ * @return the number of bytes replayed or -1 for error.
+ */
+int aeron_archive_replay_session_do_work(aeron_archive_replay_session_t *session);
+
+/*
+ * Unmap the current segment and delete the session. The publication is left to the caller.
+ */
+int aeron_archive_replay_session_close(aeron_archive_replay_session_t *session);
+
+#endif //AERON_AERON_ARCHIVE_REPLAY_SESSION_H
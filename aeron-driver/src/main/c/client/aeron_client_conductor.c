@@ -0,0 +1,870 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <time.h>
+#include "aeron_client_conductor.h"
+#include "aeron_publication.h"
+#include "aeron_subscription.h"
+#include "aeron_alloc.h"
+#include "concurrent/aeron_counters_manager.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_error.h"
+
+int64_t aeron_client_nanoclock()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000 * 1000 * 1000) + ts.tv_nsec;
+}
+
+int64_t aeron_client_epochclock()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (ts.tv_sec * 1000) + (ts.tv_nsec / (1000 * 1000));
+}
+
+int aeron_client_map_log(aeron_mapped_raw_log_t *log, const char *log_file)
+{
+    if (aeron_map_existing_file(&log->mapped_file, log_file) < 0)
+    {
+        return -1;
+    }
+
+    uint8_t *base = (uint8_t *)log->mapped_file.addr;
+    aeron_logbuffer_metadata_t *log_meta_data =
+        (aeron_logbuffer_metadata_t *)(base + (log->mapped_file.length - AERON_LOGBUFFER_META_DATA_LENGTH));
+
+    log->term_length = (size_t)log_meta_data->term_length;
+    if (aeron_logbuffer_compute_log_length(log->term_length, (uint64_t)log_meta_data->page_size) !=
+        log->mapped_file.length)
+    {
+        aeron_set_err(
+            EINVAL, "%s does not have %d partitions of term length %" PRIu64,
+            log_file, AERON_LOGBUFFER_PARTITION_COUNT, (uint64_t)log->term_length);
+        aeron_unmap(&log->mapped_file);
+        return -1;
+    }
+
+    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        log->term_buffers[i].addr = base + (i * log->term_length);
+        log->term_buffers[i].length = log->term_length;
+    }
+
+    log->log_meta_data.addr = (uint8_t *)log_meta_data;
+    log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
+
+    return 0;
+}
+
+int aeron_client_conductor_init(aeron_client_conductor_t *conductor, aeron_context_t *context)
+{
+    char filename[AERON_MAX_PATH];
+
+    snprintf(filename, sizeof(filename) - 1, "%s/%s", context->aeron_dir, AERON_CNC_FILE);
+
+    if (aeron_map_existing_file(&conductor->cnc_map, filename) < 0)
+    {
+        return -1;
+    }
+
+    aeron_cnc_metadata_t *metadata = (aeron_cnc_metadata_t *)conductor->cnc_map.addr;
+    int32_t cnc_version = aeron_cnc_version_volatile(metadata);
+
+    if (AERON_CNC_VERSION != cnc_version)
+    {
+        aeron_set_err(
+            EINVAL, "CnC version not supported: file version=%d, client version=%d", cnc_version, AERON_CNC_VERSION);
+        aeron_unmap(&conductor->cnc_map);
+        return -1;
+    }
+
+    if (aeron_mpsc_rb_init(
+        &conductor->to_driver_buffer,
+        aeron_cnc_to_driver_buffer(metadata),
+        (size_t)metadata->to_driver_buffer_length) < 0)
+    {
+        aeron_unmap(&conductor->cnc_map);
+        return -1;
+    }
+
+    if (aeron_broadcast_receiver_init(
+        &conductor->to_client_buffer,
+        aeron_cnc_to_clients_buffer(metadata),
+        (size_t)metadata->to_clients_buffer_length) < 0)
+    {
+        aeron_unmap(&conductor->cnc_map);
+        return -1;
+    }
+
+    conductor->counters_values_buffer = aeron_cnc_counters_values_buffer(metadata);
+    conductor->counters_values_length = (size_t)metadata->counter_values_buffer_length;
+
+    conductor->registering_resources.array = NULL;
+    conductor->registering_resources.length = 0;
+    conductor->registering_resources.capacity = 0;
+    conductor->active_publications.array = NULL;
+    conductor->active_publications.length = 0;
+    conductor->active_publications.capacity = 0;
+    conductor->active_subscriptions.array = NULL;
+    conductor->active_subscriptions.length = 0;
+    conductor->active_subscriptions.capacity = 0;
+    conductor->lingering_resources.array = NULL;
+    conductor->lingering_resources.length = 0;
+    conductor->lingering_resources.capacity = 0;
+
+    conductor->aeron_dir = context->aeron_dir;
+    conductor->client_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
+    conductor->driver_timeout_ms = (int64_t)context->driver_timeout_ms;
+    conductor->driver_timeout_ns = (int64_t)context->driver_timeout_ms * 1000 * 1000;
+    conductor->keepalive_interval_ns = (int64_t)context->keepalive_interval_ns;
+    conductor->resource_linger_duration_ns = (int64_t)context->resource_linger_duration_ns;
+    conductor->time_of_last_keepalive_ns = 0;
+    conductor->is_driver_timed_out = false;
+
+    if (aeron_client_epochclock() > (aeron_mpsc_rb_consumer_heartbeat_time_value(&conductor->to_driver_buffer) +
+        conductor->driver_timeout_ms))
+    {
+        aeron_set_err(ETIMEDOUT, "no driver heartbeat detected in %s", context->aeron_dir);
+        aeron_broadcast_receiver_close(&conductor->to_client_buffer);
+        aeron_unmap(&conductor->cnc_map);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_client_conductor_send_client_command(aeron_client_conductor_t *conductor, int32_t msg_type_id)
+{
+    aeron_correlated_command_t command;
+
+    command.client_id = conductor->client_id;
+    command.correlation_id = 0;
+
+    if (AERON_RB_SUCCESS != aeron_mpsc_rb_write(&conductor->to_driver_buffer, msg_type_id, &command, sizeof(command)))
+    {
+        aeron_set_err(EAGAIN, "%s", "could not write to driver ring buffer");
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_client_conductor_send_remove(
+    aeron_client_conductor_t *conductor, int32_t msg_type_id, int64_t registration_id)
+{
+    aeron_remove_command_t command;
+
+    command.correlated.client_id = conductor->client_id;
+    command.correlated.correlation_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
+    command.registration_id = registration_id;
+
+    if (AERON_RB_SUCCESS != aeron_mpsc_rb_write(&conductor->to_driver_buffer, msg_type_id, &command, sizeof(command)))
+    {
+        aeron_set_err(EAGAIN, "%s", "could not write to driver ring buffer");
+        return -1;
+    }
+
+    return 0;
+}
+
+static void aeron_client_conductor_on_driver_response(int32_t type_id, uint8_t *buffer, size_t length, void *clientd)
+{
+    aeron_client_conductor_t *conductor = (aeron_client_conductor_t *)clientd;
+
+    switch (type_id)
+    {
+        case AERON_RESPONSE_ON_PUBLICATION_READY:
+        case AERON_RESPONSE_ON_EXCLUSIVE_PUBLICATION_READY:
+        {
+            aeron_publication_buffers_ready_t *response = (aeron_publication_buffers_ready_t *)buffer;
+            char log_file[AERON_MAX_PATH];
+
+            if (length < sizeof(aeron_publication_buffers_ready_t) ||
+                length < sizeof(aeron_publication_buffers_ready_t) + (size_t)response->log_file_length ||
+                response->log_file_length >= AERON_MAX_PATH)
+            {
+                break;
+            }
+
+            memcpy(log_file, buffer + sizeof(aeron_publication_buffers_ready_t), (size_t)response->log_file_length);
+            log_file[response->log_file_length] = '\0';
+
+            aeron_client_conductor_on_publication_ready(conductor, response, log_file);
+            break;
+        }
+
+        case AERON_RESPONSE_ON_SUBSCRIPTION_READY:
+        {
+            if (length < sizeof(aeron_subscription_ready_t))
+            {
+                break;
+            }
+
+            aeron_client_conductor_on_subscription_ready(conductor, (aeron_subscription_ready_t *)buffer);
+            break;
+        }
+
+        case AERON_RESPONSE_ON_AVAILABLE_IMAGE:
+        {
+            aeron_image_buffers_ready_t *response = (aeron_image_buffers_ready_t *)buffer;
+            char log_file[AERON_MAX_PATH];
+            int32_t log_file_length;
+
+            if (length < sizeof(aeron_image_buffers_ready_t) + sizeof(int32_t))
+            {
+                break;
+            }
+
+            memcpy(&log_file_length, buffer + sizeof(aeron_image_buffers_ready_t), sizeof(int32_t));
+            if (log_file_length < 0 || log_file_length >= AERON_MAX_PATH ||
+                length < sizeof(aeron_image_buffers_ready_t) + sizeof(int32_t) + (size_t)log_file_length)
+            {
+                break;
+            }
+
+            memcpy(
+                log_file,
+                buffer + sizeof(aeron_image_buffers_ready_t) + sizeof(int32_t),
+                (size_t)log_file_length);
+            log_file[log_file_length] = '\0';
+
+            aeron_client_conductor_on_available_image(conductor, response, log_file);
+            break;
+        }
+
+        case AERON_RESPONSE_ON_AVAILABLE_IMAGES:
+        {
+            aeron_image_buffers_ready_batch_t *response = (aeron_image_buffers_ready_batch_t *)buffer;
+            aeron_image_buffers_ready_t image_ready;
+            char log_file[AERON_MAX_PATH];
+            size_t subscribers_length;
+            int32_t log_file_length;
+
+            if (length < sizeof(aeron_image_buffers_ready_batch_t) || response->subscriber_count < 0)
+            {
+                break;
+            }
+
+            subscribers_length = (size_t)response->subscriber_count * sizeof(aeron_image_buffers_ready_subscriber_t);
+            if (length < sizeof(aeron_image_buffers_ready_batch_t) + subscribers_length + sizeof(int32_t))
+            {
+                break;
+            }
+
+            const uint8_t *log_file_ptr = buffer + sizeof(aeron_image_buffers_ready_batch_t) + subscribers_length;
+            memcpy(&log_file_length, log_file_ptr, sizeof(int32_t));
+            if (log_file_length < 0 || log_file_length >= AERON_MAX_PATH ||
+                length < (size_t)(log_file_ptr - buffer) + sizeof(int32_t) + (size_t)log_file_length)
+            {
+                break;
+            }
+
+            memcpy(log_file, log_file_ptr + sizeof(int32_t), (size_t)log_file_length);
+            log_file[log_file_length] = '\0';
+
+            image_ready.correlation_id = response->correlation_id;
+            image_ready.session_id = response->session_id;
+            image_ready.stream_id = response->stream_id;
+
+            for (int32_t i = 0; i < response->subscriber_count; i++)
+            {
+                aeron_image_buffers_ready_subscriber_t subscriber;
+
+                memcpy(
+                    &subscriber,
+                    buffer + sizeof(aeron_image_buffers_ready_batch_t) + (i * sizeof(subscriber)),
+                    sizeof(subscriber));
+                image_ready.subscriber_registration_id = subscriber.subscriber_registration_id;
+                image_ready.subscriber_position_id = subscriber.subscriber_position_id;
+
+                aeron_client_conductor_on_available_image(conductor, &image_ready, log_file);
+            }
+            break;
+        }
+
+        case AERON_RESPONSE_ON_UNAVAILABLE_IMAGE:
+        {
+            if (length < sizeof(aeron_image_message_t))
+            {
+                break;
+            }
+
+            aeron_client_conductor_on_unavailable_image(conductor, (aeron_image_message_t *)buffer);
+            break;
+        }
+
+        case AERON_RESPONSE_ON_ERROR:
+        {
+            aeron_error_response_t *response = (aeron_error_response_t *)buffer;
+            char error_message[AERON_MAX_PATH];
+            size_t error_message_length;
+
+            if (length < sizeof(aeron_error_response_t) || response->error_message_length < 0)
+            {
+                break;
+            }
+
+            error_message_length = (size_t)response->error_message_length;
+            if (error_message_length > length - sizeof(aeron_error_response_t))
+            {
+                error_message_length = length - sizeof(aeron_error_response_t);
+            }
+
+            if (error_message_length >= sizeof(error_message))
+            {
+                error_message_length = sizeof(error_message) - 1;
+            }
+
+            memcpy(error_message, buffer + sizeof(aeron_error_response_t), error_message_length);
+            error_message[error_message_length] = '\0';
+
+            aeron_client_conductor_on_error(conductor, response, error_message);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+static int aeron_client_conductor_check_timeouts(aeron_client_conductor_t *conductor, int64_t now_ns)
+{
+    int work_count = 0;
+
+    if ((conductor->time_of_last_keepalive_ns + conductor->keepalive_interval_ns) < now_ns)
+    {
+        int64_t last_driver_keepalive = aeron_mpsc_rb_consumer_heartbeat_time_value(&conductor->to_driver_buffer);
+
+        if (aeron_client_epochclock() > (last_driver_keepalive + conductor->driver_timeout_ms))
+        {
+            conductor->is_driver_timed_out = true;
+            aeron_set_err(
+                ETIMEDOUT, "driver has been inactive for over %" PRId64 "ms", conductor->driver_timeout_ms);
+            return -1;
+        }
+
+        if (aeron_client_conductor_send_client_command(conductor, AERON_COMMAND_CLIENT_KEEPALIVE) < 0)
+        {
+            return -1;
+        }
+
+        conductor->time_of_last_keepalive_ns = now_ns;
+        work_count++;
+    }
+
+    for (size_t i = conductor->registering_resources.length; i > 0; i--)
+    {
+        aeron_client_registering_resource_t *resource = conductor->registering_resources.array[i - 1];
+
+        if (now_ns > resource->registration_deadline_ns)
+        {
+            resource->registration_status = AERON_CLIENT_TIMEOUT_MEDIA_DRIVER;
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)conductor->registering_resources.array,
+                sizeof(aeron_client_registering_resource_t *),
+                i - 1,
+                conductor->registering_resources.length - 1);
+            conductor->registering_resources.length--;
+            work_count++;
+        }
+    }
+
+    for (size_t i = conductor->lingering_resources.length; i > 0; i--)
+    {
+        aeron_client_lingering_resource_t *resource = &conductor->lingering_resources.array[i - 1];
+
+        if (now_ns > resource->deadline_ns)
+        {
+            resource->delete_func(resource->resource);
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)conductor->lingering_resources.array,
+                sizeof(aeron_client_lingering_resource_t),
+                i - 1,
+                conductor->lingering_resources.length - 1);
+            conductor->lingering_resources.length--;
+            work_count++;
+        }
+    }
+
+    return work_count;
+}
+
+int aeron_client_conductor_do_work(aeron_client_conductor_t *conductor)
+{
+    if (conductor->is_driver_timed_out)
+    {
+        aeron_set_err(ETIMEDOUT, "%s", "driver has timed out");
+        return -1;
+    }
+
+    int work_count = 0;
+    int result;
+
+    if ((result = aeron_broadcast_receiver_receive(
+        &conductor->to_client_buffer, aeron_client_conductor_on_driver_response, conductor)) < 0)
+    {
+        return -1;
+    }
+
+    work_count += result;
+
+    if ((result = aeron_client_conductor_check_timeouts(conductor, aeron_client_nanoclock())) < 0)
+    {
+        return -1;
+    }
+
+    return work_count + result;
+}
+
+void aeron_client_conductor_on_close(aeron_client_conductor_t *conductor)
+{
+    for (size_t i = 0; i < conductor->active_publications.length; i++)
+    {
+        aeron_publication_delete(conductor->active_publications.array[i]);
+    }
+
+    for (size_t i = 0; i < conductor->active_subscriptions.length; i++)
+    {
+        aeron_subscription_delete(conductor->active_subscriptions.array[i]);
+    }
+
+    for (size_t i = 0; i < conductor->lingering_resources.length; i++)
+    {
+        aeron_client_lingering_resource_t *resource = &conductor->lingering_resources.array[i];
+
+        resource->delete_func(resource->resource);
+    }
+
+    for (size_t i = 0; i < conductor->registering_resources.length; i++)
+    {
+        aeron_client_registering_resource_t *resource = conductor->registering_resources.array[i];
+
+        aeron_free(resource->uri);
+        aeron_free(resource);
+    }
+
+    if (!conductor->is_driver_timed_out)
+    {
+        aeron_client_conductor_send_client_command(conductor, AERON_COMMAND_CLIENT_CLOSE);
+    }
+
+    aeron_free(conductor->active_publications.array);
+    aeron_free(conductor->active_subscriptions.array);
+    aeron_free(conductor->lingering_resources.array);
+    aeron_free(conductor->registering_resources.array);
+
+    aeron_broadcast_receiver_close(&conductor->to_client_buffer);
+    aeron_unmap(&conductor->cnc_map);
+}
+
+int aeron_client_conductor_async_add(
+    aeron_client_registering_resource_t **async,
+    aeron_client_conductor_t *conductor,
+    aeron_client_managed_resource_type_t type,
+    const char *uri,
+    int32_t stream_id)
+{
+    aeron_client_registering_resource_t *resource = NULL;
+    const size_t uri_length = strlen(uri);
+    char buffer[sizeof(aeron_subscription_command_t) + AERON_MAX_PATH];
+    size_t command_length;
+    int32_t msg_type_id;
+    int ensure_capacity_result = 0;
+
+    *async = NULL;
+    if (uri_length >= AERON_MAX_PATH)
+    {
+        aeron_set_err(EINVAL, "uri too long: %d", (int)uri_length);
+        return -1;
+    }
+
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result, conductor->registering_resources, aeron_client_registering_resource_t *);
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&resource, sizeof(aeron_client_registering_resource_t)) < 0 ||
+        aeron_alloc((void **)&resource->uri, uri_length + 1) < 0)
+    {
+        aeron_free(resource);
+        return -1;
+    }
+
+    memcpy(resource->uri, uri, uri_length);
+    resource->uri[uri_length] = '\0';
+    resource->stream_id = stream_id;
+    resource->type = type;
+    resource->registration_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
+    resource->registration_deadline_ns = aeron_client_nanoclock() + conductor->driver_timeout_ns;
+    resource->registration_status = AERON_CLIENT_AWAITING_MEDIA_DRIVER;
+
+    if (AERON_CLIENT_TYPE_PUBLICATION == type || AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION == type)
+    {
+        aeron_publication_command_t *command = (aeron_publication_command_t *)buffer;
+
+        command->correlated.client_id = conductor->client_id;
+        command->correlated.correlation_id = resource->registration_id;
+        command->stream_id = stream_id;
+        command->channel_length = (int32_t)uri_length;
+        memcpy(buffer + sizeof(aeron_publication_command_t), uri, uri_length);
+        command_length = sizeof(aeron_publication_command_t) + uri_length;
+        msg_type_id = AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION == type ?
+            AERON_COMMAND_ADD_EXCLUSIVE_PUBLICATION : AERON_COMMAND_ADD_PUBLICATION;
+    }
+    else
+    {
+        aeron_subscription_command_t *command = (aeron_subscription_command_t *)buffer;
+
+        command->correlated.client_id = conductor->client_id;
+        command->correlated.correlation_id = resource->registration_id;
+        command->registration_correlation_id = -1;
+        command->stream_id = stream_id;
+        command->channel_length = (int32_t)uri_length;
+        memcpy(buffer + sizeof(aeron_subscription_command_t), uri, uri_length);
+        command_length = sizeof(aeron_subscription_command_t) + uri_length;
+        msg_type_id = AERON_COMMAND_ADD_SUBSCRIPTION;
+    }
+
+    if (AERON_RB_SUCCESS != aeron_mpsc_rb_write(&conductor->to_driver_buffer, msg_type_id, buffer, command_length))
+    {
+        aeron_set_err(EAGAIN, "%s", "could not write to driver ring buffer");
+        aeron_free(resource->uri);
+        aeron_free(resource);
+        return -1;
+    }
+
+    conductor->registering_resources.array[conductor->registering_resources.length++] = resource;
+
+    *async = resource;
+    return 0;
+}
+
+int aeron_client_conductor_async_poll(aeron_client_registering_resource_t *async)
+{
+    int result = 0;
+
+    switch (async->registration_status)
+    {
+        case AERON_CLIENT_AWAITING_MEDIA_DRIVER:
+            return 0;
+
+        case AERON_CLIENT_REGISTERED_MEDIA_DRIVER:
+            result = 1;
+            break;
+
+        case AERON_CLIENT_ERRORED_MEDIA_DRIVER:
+            aeron_set_err(EINVAL, "async add error code=%d: %s", async->error_code, async->error_message);
+            result = -1;
+            break;
+
+        case AERON_CLIENT_TIMEOUT_MEDIA_DRIVER:
+            aeron_set_err(ETIMEDOUT, "async add no response from driver: %s", async->uri);
+            result = -1;
+            break;
+    }
+
+    aeron_free(async->uri);
+    aeron_free(async);
+
+    return result;
+}
+
+static aeron_client_registering_resource_t *aeron_client_conductor_take_registering_resource(
+    aeron_client_conductor_t *conductor, int64_t registration_id)
+{
+    for (size_t i = 0; i < conductor->registering_resources.length; i++)
+    {
+        aeron_client_registering_resource_t *resource = conductor->registering_resources.array[i];
+
+        if (registration_id == resource->registration_id)
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)conductor->registering_resources.array,
+                sizeof(aeron_client_registering_resource_t *),
+                i,
+                conductor->registering_resources.length - 1);
+            conductor->registering_resources.length--;
+
+            return resource;
+        }
+    }
+
+    return NULL;
+}
+
+static void aeron_client_conductor_registration_failed(aeron_client_registering_resource_t *resource)
+{
+    resource->registration_status = AERON_CLIENT_ERRORED_MEDIA_DRIVER;
+    resource->error_code = aeron_errcode();
+    snprintf(resource->error_message, sizeof(resource->error_message), "%s", aeron_errmsg());
+}
+
+void aeron_client_conductor_on_publication_ready(
+    aeron_client_conductor_t *conductor, aeron_publication_buffers_ready_t *response, const char *log_file)
+{
+    aeron_client_registering_resource_t *resource =
+        aeron_client_conductor_take_registering_resource(conductor, response->correlation_id);
+    aeron_publication_t *publication = NULL;
+    int ensure_capacity_result = 0;
+
+    if (NULL == resource)
+    {
+        return;
+    }
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->active_publications, aeron_publication_t *);
+    if (ensure_capacity_result < 0 ||
+        (size_t)response->position_limit_counter_id >=
+            conductor->counters_values_length / AERON_COUNTERS_MANAGER_VALUE_LENGTH)
+    {
+        aeron_client_conductor_registration_failed(resource);
+        return;
+    }
+
+    int64_t *position_limit =
+        (int64_t *)(conductor->counters_values_buffer + AERON_COUNTER_OFFSET(response->position_limit_counter_id));
+
+    if (aeron_publication_create(
+        &publication,
+        conductor,
+        log_file,
+        response->correlation_id,
+        response->registration_id,
+        response->stream_id,
+        response->session_id,
+        position_limit,
+        AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION == resource->type) < 0)
+    {
+        aeron_client_conductor_registration_failed(resource);
+        return;
+    }
+
+    conductor->active_publications.array[conductor->active_publications.length++] = publication;
+
+    resource->resource.publication = publication;
+    resource->registration_status = AERON_CLIENT_REGISTERED_MEDIA_DRIVER;
+}
+
+void aeron_client_conductor_on_subscription_ready(
+    aeron_client_conductor_t *conductor, aeron_subscription_ready_t *response)
+{
+    aeron_client_registering_resource_t *resource =
+        aeron_client_conductor_take_registering_resource(conductor, response->correlation_id);
+    aeron_subscription_t *subscription = NULL;
+    int ensure_capacity_result = 0;
+
+    if (NULL == resource)
+    {
+        return;
+    }
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->active_subscriptions, aeron_subscription_t *);
+    if (ensure_capacity_result < 0 ||
+        aeron_subscription_create(&subscription, conductor, resource->registration_id, resource->stream_id) < 0)
+    {
+        aeron_client_conductor_registration_failed(resource);
+        return;
+    }
+
+    subscription->on_available_image = resource->on_available_image;
+    subscription->on_available_image_clientd = resource->on_available_image_clientd;
+    subscription->on_unavailable_image = resource->on_unavailable_image;
+    subscription->on_unavailable_image_clientd = resource->on_unavailable_image_clientd;
+    conductor->active_subscriptions.array[conductor->active_subscriptions.length++] = subscription;
+
+    resource->resource.subscription = subscription;
+    resource->registration_status = AERON_CLIENT_REGISTERED_MEDIA_DRIVER;
+}
+
+void aeron_client_conductor_on_available_image(
+    aeron_client_conductor_t *conductor, aeron_image_buffers_ready_t *response, const char *log_file)
+{
+    for (size_t i = 0; i < conductor->active_subscriptions.length; i++)
+    {
+        aeron_subscription_t *subscription = conductor->active_subscriptions.array[i];
+
+        if (response->subscriber_registration_id != subscription->registration_id)
+        {
+            continue;
+        }
+
+        aeron_image_t *image = NULL;
+
+        if ((size_t)response->subscriber_position_id >=
+            conductor->counters_values_length / AERON_COUNTERS_MANAGER_VALUE_LENGTH)
+        {
+            return;
+        }
+
+        int64_t *subscriber_position =
+            (int64_t *)(conductor->counters_values_buffer + AERON_COUNTER_OFFSET(response->subscriber_position_id));
+
+        if (aeron_image_create(
+            &image,
+            log_file,
+            response->correlation_id,
+            response->subscriber_registration_id,
+            response->session_id,
+            subscriber_position) < 0)
+        {
+            return;
+        }
+
+        if (aeron_subscription_add_image(subscription, image) < 0)
+        {
+            aeron_image_delete(image);
+            return;
+        }
+
+        if (NULL != subscription->on_available_image)
+        {
+            subscription->on_available_image(subscription->on_available_image_clientd, subscription, image);
+        }
+
+        return;
+    }
+}
+
+static void aeron_client_conductor_delete_image(void *image)
+{
+    aeron_image_delete((aeron_image_t *)image);
+}
+
+void aeron_client_conductor_on_unavailable_image(aeron_client_conductor_t *conductor, aeron_image_message_t *response)
+{
+    for (size_t i = 0; i < conductor->active_subscriptions.length; i++)
+    {
+        aeron_subscription_t *subscription = conductor->active_subscriptions.array[i];
+
+        if (response->subscription_registration_id != subscription->registration_id)
+        {
+            continue;
+        }
+
+        aeron_image_t *image = aeron_subscription_remove_image(subscription, response->correlation_id);
+
+        if (NULL != image)
+        {
+            if (NULL != subscription->on_unavailable_image)
+            {
+                subscription->on_unavailable_image(subscription->on_unavailable_image_clientd, subscription, image);
+            }
+
+            aeron_client_conductor_linger_resource(conductor, image, aeron_client_conductor_delete_image);
+        }
+
+        return;
+    }
+}
+
+void aeron_client_conductor_on_error(
+    aeron_client_conductor_t *conductor, aeron_error_response_t *response, const char *error_message)
+{
+    aeron_client_registering_resource_t *resource =
+        aeron_client_conductor_take_registering_resource(conductor, response->offending_command_correlation_id);
+
+    if (NULL == resource)
+    {
+        return;
+    }
+
+    resource->registration_status = AERON_CLIENT_ERRORED_MEDIA_DRIVER;
+    resource->error_code = response->error_code;
+    snprintf(resource->error_message, sizeof(resource->error_message), "%s", error_message);
+}
+
+int aeron_client_conductor_release_publication(aeron_client_conductor_t *conductor, aeron_publication_t *publication)
+{
+    for (size_t i = 0; i < conductor->active_publications.length; i++)
+    {
+        if (publication == conductor->active_publications.array[i])
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)conductor->active_publications.array,
+                sizeof(aeron_publication_t *),
+                i,
+                conductor->active_publications.length - 1);
+            conductor->active_publications.length--;
+            break;
+        }
+    }
+
+    int result = aeron_client_conductor_send_remove(
+        conductor, AERON_COMMAND_REMOVE_PUBLICATION, publication->registration_id);
+
+    aeron_publication_delete(publication);
+
+    return result;
+}
+
+int aeron_client_conductor_release_subscription(
+    aeron_client_conductor_t *conductor, aeron_subscription_t *subscription)
+{
+    for (size_t i = 0; i < conductor->active_subscriptions.length; i++)
+    {
+        if (subscription == conductor->active_subscriptions.array[i])
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)conductor->active_subscriptions.array,
+                sizeof(aeron_subscription_t *),
+                i,
+                conductor->active_subscriptions.length - 1);
+            conductor->active_subscriptions.length--;
+            break;
+        }
+    }
+
+    int result = aeron_client_conductor_send_remove(
+        conductor, AERON_COMMAND_REMOVE_SUBSCRIPTION, subscription->registration_id);
+
+    aeron_subscription_delete(subscription);
+
+    return result;
+}
+
+int aeron_client_conductor_linger_resource(
+    aeron_client_conductor_t *conductor, void *resource, aeron_client_lingering_delete_func_t delete_func)
+{
+    int ensure_capacity_result = 0;
+
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result, conductor->lingering_resources, aeron_client_lingering_resource_t);
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    aeron_client_lingering_resource_t *lingering =
+        &conductor->lingering_resources.array[conductor->lingering_resources.length++];
+
+    lingering->resource = resource;
+    lingering->delete_func = delete_func;
+    lingering->deadline_ns = aeron_client_nanoclock() + conductor->resource_linger_duration_ns;
+
+    return 0;
+}
+
+extern int aeron_number_of_trailing_zeroes(int32_t value);
@@ -0,0 +1,194 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_CLIENT_CONDUCTOR_H
+#define AERON_AERON_CLIENT_CONDUCTOR_H
+
+#include "aeronc.h"
+#include "aeron_driver_common.h"
+#include "aeron_cnc_file_descriptor.h"
+#include "command/aeron_control_protocol.h"
+#include "concurrent/aeron_mpsc_rb.h"
+#include "concurrent/aeron_broadcast_receiver.h"
+#include "util/aeron_fileutil.h"
+
+#define AERON_CLIENT_DRIVER_TIMEOUT_MS_DEFAULT (10 * 1000L)
+#define AERON_CLIENT_KEEPALIVE_INTERVAL_NS_DEFAULT (500 * 1000 * 1000L)
+#define AERON_CLIENT_RESOURCE_LINGER_DURATION_NS_DEFAULT (3 * 1000 * 1000 * 1000L)
+
+struct aeron_context_stct
+{
+    char *aeron_dir;
+    uint64_t driver_timeout_ms;
+    uint64_t keepalive_interval_ns;
+    uint64_t resource_linger_duration_ns;
+};
+
+typedef struct aeron_client_conductor_stct aeron_client_conductor_t;
+
+typedef enum aeron_client_registration_status_en
+{
+    AERON_CLIENT_AWAITING_MEDIA_DRIVER,
+    AERON_CLIENT_REGISTERED_MEDIA_DRIVER,
+    AERON_CLIENT_ERRORED_MEDIA_DRIVER,
+    AERON_CLIENT_TIMEOUT_MEDIA_DRIVER
+}
+aeron_client_registration_status_t;
+
+typedef enum aeron_client_managed_resource_type_en
+{
+    AERON_CLIENT_TYPE_PUBLICATION,
+    AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION,
+    AERON_CLIENT_TYPE_SUBSCRIPTION
+}
+aeron_client_managed_resource_type_t;
+
+/*
+ * An add sent to the driver but not yet answered. The conductor drops it from its list once answered or timed out,
+ * after which it belongs to the application until polled.
+ */
+struct aeron_client_registering_resource_stct
+{
+    union aeron_client_registering_resource_un
+    {
+        aeron_publication_t *publication;
+        aeron_subscription_t *subscription;
+    }
+    resource;
+    char *uri;
+    aeron_on_available_image_t on_available_image;
+    void *on_available_image_clientd;
+    aeron_on_unavailable_image_t on_unavailable_image;
+    void *on_unavailable_image_clientd;
+    int32_t stream_id;
+    int32_t error_code;
+    char error_message[AERON_MAX_PATH];
+    int64_t registration_id;
+    int64_t registration_deadline_ns;
+    aeron_client_managed_resource_type_t type;
+    aeron_client_registration_status_t registration_status;
+};
+
+typedef struct aeron_client_registering_resource_stct aeron_client_registering_resource_t;
+
+typedef void (*aeron_client_lingering_delete_func_t)(void *);
+
+typedef struct aeron_client_lingering_resource_stct
+{
+    void *resource;
+    aeron_client_lingering_delete_func_t delete_func;
+    int64_t deadline_ns;
+}
+aeron_client_lingering_resource_t;
+
+struct aeron_client_conductor_stct
+{
+    aeron_mapped_file_t cnc_map;
+    aeron_mpsc_rb_t to_driver_buffer;
+    aeron_broadcast_receiver_t to_client_buffer;
+    uint8_t *counters_values_buffer;
+    size_t counters_values_length;
+
+    struct aeron_client_registering_resources_stct
+    {
+        aeron_client_registering_resource_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    registering_resources;
+
+    struct aeron_client_active_publications_stct
+    {
+        aeron_publication_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    active_publications;
+
+    struct aeron_client_active_subscriptions_stct
+    {
+        aeron_subscription_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    active_subscriptions;
+
+    struct aeron_client_lingering_resources_stct
+    {
+        aeron_client_lingering_resource_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    lingering_resources;
+
+    const char *aeron_dir;
+    int64_t client_id;
+    int64_t driver_timeout_ms;
+    int64_t driver_timeout_ns;
+    int64_t keepalive_interval_ns;
+    int64_t resource_linger_duration_ns;
+    int64_t time_of_last_keepalive_ns;
+    bool is_driver_timed_out;
+};
+
+int aeron_client_conductor_init(aeron_client_conductor_t *conductor, aeron_context_t *context);
+
+int aeron_client_conductor_do_work(aeron_client_conductor_t *conductor);
+
+void aeron_client_conductor_on_close(aeron_client_conductor_t *conductor);
+
+int aeron_client_conductor_async_add(
+    aeron_client_registering_resource_t **async,
+    aeron_client_conductor_t *conductor,
+    aeron_client_managed_resource_type_t type,
+    const char *uri,
+    int32_t stream_id);
+
+int aeron_client_conductor_async_poll(aeron_client_registering_resource_t *async);
+
+int aeron_client_conductor_release_publication(aeron_client_conductor_t *conductor, aeron_publication_t *publication);
+
+int aeron_client_conductor_release_subscription(
+    aeron_client_conductor_t *conductor, aeron_subscription_t *subscription);
+
+/*
+ * Delete the resource once the linger duration has passed, so readers that picked it up before it was swapped out
+ * can finish with it first.
+ */
+int aeron_client_conductor_linger_resource(
+    aeron_client_conductor_t *conductor, void *resource, aeron_client_lingering_delete_func_t delete_func);
+
+void aeron_client_conductor_on_publication_ready(
+    aeron_client_conductor_t *conductor, aeron_publication_buffers_ready_t *response, const char *log_file);
+
+void aeron_client_conductor_on_subscription_ready(
+    aeron_client_conductor_t *conductor, aeron_subscription_ready_t *response);
+
+void aeron_client_conductor_on_available_image(
+    aeron_client_conductor_t *conductor, aeron_image_buffers_ready_t *response, const char *log_file);
+
+void aeron_client_conductor_on_unavailable_image(aeron_client_conductor_t *conductor, aeron_image_message_t *response);
+
+void aeron_client_conductor_on_error(
+    aeron_client_conductor_t *conductor, aeron_error_response_t *response, const char *error_message);
+
+int aeron_client_map_log(aeron_mapped_raw_log_t *log, const char *log_file);
+
+int64_t aeron_client_nanoclock();
+
+int64_t aeron_client_epochclock();
+
+#endif //AERON_AERON_CLIENT_CONDUCTOR_H
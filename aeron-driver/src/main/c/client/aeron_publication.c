@@ -0,0 +1,491 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include "aeron_publication.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+#include "concurrent/aeron_counters_manager.h"
+
+#define AERON_PUBLICATION_MAX_MESSAGE_LENGTH_LIMIT (16 * 1024 * 1024)
+
+int aeron_publication_create(
+    aeron_publication_t **publication,
+    aeron_client_conductor_t *conductor,
+    const char *log_file,
+    int64_t registration_id,
+    int64_t original_registration_id,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t *position_limit,
+    bool is_exclusive)
+{
+    aeron_publication_t *_publication = NULL;
+
+    *publication = NULL;
+    if (aeron_alloc((void **)&_publication, sizeof(aeron_publication_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_client_map_log(&_publication->mapped_raw_log, log_file) < 0)
+    {
+        aeron_free(_publication);
+        return -1;
+    }
+
+    _publication->log_meta_data = (aeron_logbuffer_metadata_t *)_publication->mapped_raw_log.log_meta_data.addr;
+    _publication->default_header = _publication->mapped_raw_log.log_meta_data.addr + sizeof(aeron_logbuffer_metadata_t);
+    _publication->conductor = conductor;
+    _publication->position_limit = position_limit;
+    _publication->registration_id = registration_id;
+    _publication->original_registration_id = original_registration_id;
+    _publication->stream_id = stream_id;
+    _publication->session_id = session_id;
+    _publication->initial_term_id = _publication->log_meta_data->initial_term_id;
+    _publication->term_length = _publication->log_meta_data->term_length;
+    _publication->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes(_publication->term_length);
+    _publication->max_payload_length = (size_t)(_publication->log_meta_data->mtu_length - AERON_DATA_HEADER_LENGTH);
+    _publication->max_message_length = (size_t)(_publication->term_length / 8);
+    if (_publication->max_message_length > AERON_PUBLICATION_MAX_MESSAGE_LENGTH_LIMIT)
+    {
+        _publication->max_message_length = AERON_PUBLICATION_MAX_MESSAGE_LENGTH_LIMIT;
+    }
+    _publication->max_possible_position = ((int64_t)_publication->term_length << 31);
+    _publication->is_exclusive = is_exclusive;
+    _publication->is_closed = false;
+    _publication->is_subscriber_wakeup = 1 == _publication->log_meta_data->is_subscriber_wakeup;
+
+    *publication = _publication;
+    return 0;
+}
+
+void aeron_publication_delete(aeron_publication_t *publication)
+{
+    aeron_unmap(&publication->mapped_raw_log.mapped_file);
+    aeron_free(publication);
+}
+
+inline static void aeron_publication_header_write(
+    aeron_publication_t *publication, uint8_t *term_buffer, int32_t term_offset, int32_t length, int32_t term_id)
+{
+    aeron_data_header_t *header = (aeron_data_header_t *)(term_buffer + term_offset);
+
+    AERON_PUT_ORDERED(header->frame_header.frame_length, -length);
+    aeron_release();
+
+    memcpy(
+        term_buffer + term_offset + sizeof(int32_t),
+        publication->default_header + sizeof(int32_t),
+        AERON_DATA_HEADER_LENGTH - sizeof(int32_t));
+    header->term_offset = term_offset;
+    header->term_id = term_id;
+}
+
+inline static int32_t aeron_publication_handle_end_of_log(
+    aeron_publication_t *publication, uint8_t *term_buffer, int32_t term_offset, int32_t term_id)
+{
+    if (term_offset < publication->term_length)
+    {
+        const int32_t padding_length = publication->term_length - term_offset;
+        aeron_data_header_t *header = (aeron_data_header_t *)(term_buffer + term_offset);
+
+        aeron_publication_header_write(publication, term_buffer, term_offset, padding_length, term_id);
+        header->frame_header.type = AERON_HDR_TYPE_PAD;
+        AERON_PUT_ORDERED(header->frame_header.frame_length, padding_length);
+    }
+
+    return -1;
+}
+
+inline static int32_t aeron_publication_append_unfragmented_message(
+    aeron_publication_t *publication, size_t index, const uint8_t *buffer, size_t length)
+{
+    const int32_t frame_length = (int32_t)length + (int32_t)AERON_DATA_HEADER_LENGTH;
+    const int32_t aligned_length = (int32_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    uint8_t *term_buffer = publication->mapped_raw_log.term_buffers[index].addr;
+    int64_t raw_tail;
+
+    AERON_GET_AND_ADD_INT64(raw_tail, publication->log_meta_data->term_tail_counters[index], aligned_length);
+
+    const int32_t term_offset = (int32_t)(raw_tail & 0xFFFFFFFF);
+    const int32_t term_id = aeron_logbuffer_term_id(raw_tail);
+    const int64_t resulting_offset = (int64_t)term_offset + aligned_length;
+
+    if (resulting_offset > publication->term_length)
+    {
+        return aeron_publication_handle_end_of_log(publication, term_buffer, term_offset, term_id);
+    }
+
+    aeron_data_header_t *header = (aeron_data_header_t *)(term_buffer + term_offset);
+
+    aeron_publication_header_write(publication, term_buffer, term_offset, frame_length, term_id);
+    memcpy(term_buffer + term_offset + AERON_DATA_HEADER_LENGTH, buffer, length);
+    AERON_PUT_ORDERED(header->frame_header.frame_length, frame_length);
+
+    return (int32_t)resulting_offset;
+}
+
+inline static int32_t aeron_publication_append_fragmented_message(
+    aeron_publication_t *publication, size_t index, const uint8_t *buffer, size_t length)
+{
+    const size_t max_payload_length = publication->max_payload_length;
+    const size_t num_max_payloads = length / max_payload_length;
+    const size_t remaining_payload = length % max_payload_length;
+    const size_t last_frame_length = remaining_payload > 0 ?
+        AERON_ALIGN(remaining_payload + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT) : 0;
+    const size_t required_length =
+        (num_max_payloads * (max_payload_length + AERON_DATA_HEADER_LENGTH)) + last_frame_length;
+    uint8_t *term_buffer = publication->mapped_raw_log.term_buffers[index].addr;
+    int64_t raw_tail;
+
+    AERON_GET_AND_ADD_INT64(raw_tail, publication->log_meta_data->term_tail_counters[index], (int64_t)required_length);
+
+    const int32_t term_offset = (int32_t)(raw_tail & 0xFFFFFFFF);
+    const int32_t term_id = aeron_logbuffer_term_id(raw_tail);
+    const int64_t resulting_offset = (int64_t)term_offset + (int64_t)required_length;
+
+    if (resulting_offset > publication->term_length)
+    {
+        return aeron_publication_handle_end_of_log(publication, term_buffer, term_offset, term_id);
+    }
+
+    uint8_t flags = AERON_DATA_HEADER_BEGIN_FLAG;
+    size_t remaining = length;
+    int32_t frame_offset = term_offset;
+
+    do
+    {
+        const size_t bytes_to_write = remaining < max_payload_length ? remaining : max_payload_length;
+        const int32_t frame_length = (int32_t)(bytes_to_write + AERON_DATA_HEADER_LENGTH);
+        const int32_t aligned_length = (int32_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        aeron_data_header_t *header = (aeron_data_header_t *)(term_buffer + frame_offset);
+
+        aeron_publication_header_write(publication, term_buffer, frame_offset, frame_length, term_id);
+        memcpy(term_buffer + frame_offset + AERON_DATA_HEADER_LENGTH, buffer + (length - remaining), bytes_to_write);
+
+        if (remaining <= max_payload_length)
+        {
+            flags |= AERON_DATA_HEADER_END_FLAG;
+        }
+
+        header->frame_header.flags = flags;
+        AERON_PUT_ORDERED(header->frame_header.frame_length, frame_length);
+
+        flags = 0;
+        frame_offset += aligned_length;
+        remaining -= bytes_to_write;
+    }
+    while (remaining > 0);
+
+    return (int32_t)resulting_offset;
+}
+
+inline static int64_t aeron_publication_new_position(
+    aeron_publication_t *publication,
+    int32_t term_count,
+    int32_t term_offset,
+    int32_t term_id,
+    int64_t position,
+    int32_t resulting_offset)
+{
+    if (resulting_offset > 0)
+    {
+        if (publication->is_subscriber_wakeup)
+        {
+            aeron_logbuffer_signal_subscribers(publication->log_meta_data);
+        }
+
+        return (position - term_offset) + resulting_offset;
+    }
+
+    if ((position + term_offset) > publication->max_possible_position)
+    {
+        return AERON_PUBLICATION_MAX_POSITION_EXCEEDED;
+    }
+
+    aeron_logbuffer_rotate_log(publication->log_meta_data, term_count, term_id);
+
+    return AERON_PUBLICATION_ADMIN_ACTION;
+}
+
+/*
+ * Compute the publisher limit of an IPC publication from the subscriber positions the driver lists in the log meta data,
+ * so consumption relieves back pressure without waiting on the driver conductor. The limit is never lowered and is
+ * kept as it is when the list is not published or changes while being read.
+ */
+static int64_t aeron_publication_client_limit(aeron_publication_t *publication, int64_t limit)
+{
+    aeron_logbuffer_metadata_t *log_meta_data = publication->log_meta_data;
+    int32_t window_length = log_meta_data->publisher_window_length;
+    int32_t change_number;
+    int32_t end_change_number;
+    int64_t clean_limit;
+
+    if (window_length <= 0)
+    {
+        return limit;
+    }
+
+    AERON_GET_VOLATILE(change_number, log_meta_data->subscriber_positions_change_number);
+    const int32_t count = log_meta_data->subscriber_position_count;
+
+    if ((change_number & 1) || count <= 0 || count > AERON_LOGBUFFER_MAX_SUBSCRIBER_POSITIONS)
+    {
+        return limit;
+    }
+
+    uint8_t *counters_values = publication->conductor->counters_values_buffer;
+    const size_t counters_values_length = publication->conductor->counters_values_length;
+    int64_t min_position = INT64_MAX;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        const int32_t counter_id = log_meta_data->subscriber_position_ids[i];
+        int64_t position;
+
+        if (counter_id < 0 || (size_t)AERON_COUNTER_OFFSET(counter_id) >= counters_values_length)
+        {
+            return limit;
+        }
+
+        AERON_GET_VOLATILE(position, *(int64_t *)(counters_values + AERON_COUNTER_OFFSET(counter_id)));
+        min_position = position < min_position ? position : min_position;
+    }
+
+    AERON_GET_VOLATILE(clean_limit, log_meta_data->clean_limit);
+    aeron_acquire();
+    AERON_GET_VOLATILE(end_change_number, log_meta_data->subscriber_positions_change_number);
+
+    if (end_change_number != change_number)
+    {
+        return limit;
+    }
+
+    int64_t proposed_limit = min_position + window_length;
+    proposed_limit = proposed_limit < clean_limit ? proposed_limit : clean_limit;
+
+    return proposed_limit > limit ? proposed_limit : limit;
+}
+
+int64_t aeron_publication_offer(aeron_publication_t *publication, const uint8_t *buffer, size_t length)
+{
+    bool is_closed;
+
+    AERON_GET_VOLATILE(is_closed, publication->is_closed);
+    if (is_closed)
+    {
+        return AERON_PUBLICATION_CLOSED;
+    }
+
+    if (length > publication->max_message_length)
+    {
+        aeron_set_err(
+            EINVAL,
+            "message exceeds max_message_length of %d, length=%d",
+            (int)publication->max_message_length,
+            (int)length);
+        return AERON_PUBLICATION_ERROR;
+    }
+
+    int64_t limit;
+    int32_t term_count;
+    int64_t raw_tail;
+
+    AERON_GET_VOLATILE(limit, *publication->position_limit);
+    AERON_GET_VOLATILE(term_count, publication->log_meta_data->active_term_count);
+
+    const size_t index = aeron_logbuffer_index_by_term_count(term_count);
+
+    AERON_GET_VOLATILE(raw_tail, publication->log_meta_data->term_tail_counters[index]);
+
+    const int32_t term_offset = (int32_t)(raw_tail & 0xFFFFFFFF);
+    const int32_t term_id = aeron_logbuffer_term_id(raw_tail);
+
+    if (term_count != (term_id - publication->initial_term_id))
+    {
+        return AERON_PUBLICATION_ADMIN_ACTION;
+    }
+
+    const int64_t position = aeron_logbuffer_compute_position(
+        term_id, term_offset, publication->position_bits_to_shift, publication->initial_term_id);
+
+    if (position < limit || position < aeron_publication_client_limit(publication, limit))
+    {
+        const int32_t resulting_offset = length <= publication->max_payload_length ?
+            aeron_publication_append_unfragmented_message(publication, index, buffer, length) :
+            aeron_publication_append_fragmented_message(publication, index, buffer, length);
+
+        return aeron_publication_new_position(
+            publication, term_count, term_offset, term_id, position, resulting_offset);
+    }
+
+    return aeron_publication_is_connected(publication) ?
+        AERON_PUBLICATION_BACK_PRESSURED : AERON_PUBLICATION_NOT_CONNECTED;
+}
+
+/*
+ * Copy the frames into the term after the first so the rewritten headers are in place before the ordered store of the
+ * first frame length makes the block visible, as the term is clean beneath the tail.
+ */
+inline static void aeron_publication_append_block(
+    aeron_publication_t *publication, uint8_t *term_buffer, int32_t term_offset, const uint8_t *buffer, size_t length)
+{
+    const int32_t first_frame_length = ((aeron_frame_header_t *)buffer)->frame_length;
+    int32_t offset = 0;
+
+    memcpy(term_buffer + term_offset + sizeof(int32_t), buffer + sizeof(int32_t), length - sizeof(int32_t));
+
+    while (offset < (int32_t)length)
+    {
+        aeron_data_header_t *header = (aeron_data_header_t *)(term_buffer + term_offset + offset);
+        const int32_t frame_length = 0 == offset ? first_frame_length : header->frame_header.frame_length;
+
+        header->session_id = publication->session_id;
+        header->stream_id = publication->stream_id;
+        offset += (int32_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+    AERON_PUT_ORDERED(((aeron_frame_header_t *)(term_buffer + term_offset))->frame_length, first_frame_length);
+}
+
+int64_t aeron_publication_offer_block(aeron_publication_t *publication, const uint8_t *buffer, size_t length)
+{
+    bool is_closed;
+
+    AERON_GET_VOLATILE(is_closed, publication->is_closed);
+    if (is_closed)
+    {
+        return AERON_PUBLICATION_CLOSED;
+    }
+
+    if (!publication->is_exclusive)
+    {
+        aeron_set_err(EINVAL, "%s", "block offer requires an exclusive publication");
+        return AERON_PUBLICATION_ERROR;
+    }
+
+    int64_t limit;
+    int32_t term_count;
+    int64_t raw_tail;
+
+    AERON_GET_VOLATILE(limit, *publication->position_limit);
+    AERON_GET_VOLATILE(term_count, publication->log_meta_data->active_term_count);
+
+    const size_t index = aeron_logbuffer_index_by_term_count(term_count);
+
+    AERON_GET_VOLATILE(raw_tail, publication->log_meta_data->term_tail_counters[index]);
+
+    const int32_t term_offset = (int32_t)(raw_tail & 0xFFFFFFFF);
+    const int32_t term_id = aeron_logbuffer_term_id(raw_tail);
+
+    if (term_count != (term_id - publication->initial_term_id))
+    {
+        return AERON_PUBLICATION_ADMIN_ACTION;
+    }
+
+    const int64_t position = aeron_logbuffer_compute_position(
+        term_id, term_offset, publication->position_bits_to_shift, publication->initial_term_id);
+
+    if (term_offset >= publication->term_length)
+    {
+        return aeron_publication_new_position(publication, term_count, term_offset, term_id, position, -1);
+    }
+
+    const aeron_data_header_t *first_frame = (const aeron_data_header_t *)buffer;
+
+    if (length < AERON_DATA_HEADER_LENGTH ||
+        0 != (length & (AERON_LOGBUFFER_FRAME_ALIGNMENT - 1)) ||
+        term_offset + (int64_t)length > publication->term_length ||
+        first_frame->frame_header.frame_length <= 0 ||
+        first_frame->term_offset != term_offset ||
+        first_frame->term_id != term_id)
+    {
+        aeron_set_err(
+            EINVAL,
+            "block of length=%d at term_offset=%d term_id=%d does not continue the publication at %d:%d",
+            (int)length,
+            length < AERON_DATA_HEADER_LENGTH ? -1 : (int)first_frame->term_offset,
+            length < AERON_DATA_HEADER_LENGTH ? -1 : (int)first_frame->term_id,
+            (int)term_id,
+            (int)term_offset);
+        return AERON_PUBLICATION_ERROR;
+    }
+
+    if (position < limit || position < aeron_publication_client_limit(publication, limit))
+    {
+        uint8_t *term_buffer = publication->mapped_raw_log.term_buffers[index].addr;
+
+        aeron_publication_append_block(publication, term_buffer, term_offset, buffer, length);
+        AERON_PUT_ORDERED(
+            publication->log_meta_data->term_tail_counters[index], raw_tail + (int64_t)length);
+
+        return position + (int64_t)length;
+    }
+
+    return aeron_publication_is_connected(publication) ?
+        AERON_PUBLICATION_BACK_PRESSURED : AERON_PUBLICATION_NOT_CONNECTED;
+}
+
+int64_t aeron_publication_position(aeron_publication_t *publication)
+{
+    int32_t term_count;
+    int64_t raw_tail;
+
+    AERON_GET_VOLATILE(term_count, publication->log_meta_data->active_term_count);
+    AERON_GET_VOLATILE(
+        raw_tail, publication->log_meta_data->term_tail_counters[aeron_logbuffer_index_by_term_count(term_count)]);
+
+    int32_t term_offset = (int32_t)(raw_tail & 0xFFFFFFFF);
+
+    return aeron_logbuffer_compute_position(
+        aeron_logbuffer_term_id(raw_tail),
+        term_offset < publication->term_length ? term_offset : publication->term_length,
+        publication->position_bits_to_shift,
+        publication->initial_term_id);
+}
+
+bool aeron_publication_is_connected(aeron_publication_t *publication)
+{
+    int32_t is_connected;
+
+    AERON_GET_VOLATILE(is_connected, publication->log_meta_data->is_connected);
+
+    return 1 == is_connected;
+}
+
+int32_t aeron_publication_session_id(aeron_publication_t *publication)
+{
+    return publication->session_id;
+}
+
+int32_t aeron_publication_stream_id(aeron_publication_t *publication)
+{
+    return publication->stream_id;
+}
+
+size_t aeron_publication_max_message_length(aeron_publication_t *publication)
+{
+    return publication->max_message_length;
+}
+
+int aeron_publication_close(aeron_publication_t *publication)
+{
+    AERON_PUT_ORDERED(publication->is_closed, true);
+
+    return aeron_client_conductor_release_publication(publication->conductor, publication);
+}
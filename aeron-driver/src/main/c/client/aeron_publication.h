@@ -0,0 +1,60 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_PUBLICATION_H
+#define AERON_AERON_PUBLICATION_H
+
+#include "aeron_client_conductor.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+
+struct aeron_publication_stct
+{
+    aeron_client_conductor_t *conductor;
+    aeron_mapped_raw_log_t mapped_raw_log;
+    aeron_logbuffer_metadata_t *log_meta_data;
+    uint8_t *default_header;
+    int64_t *position_limit;
+
+    int64_t registration_id;
+    int64_t original_registration_id;
+    int32_t stream_id;
+    int32_t session_id;
+    int32_t initial_term_id;
+    int32_t term_length;
+    size_t position_bits_to_shift;
+    size_t max_payload_length;
+    size_t max_message_length;
+    int64_t max_possible_position;
+
+    bool is_exclusive;
+    bool is_closed;
+    bool is_subscriber_wakeup;
+};
+
+int aeron_publication_create(
+    aeron_publication_t **publication,
+    aeron_client_conductor_t *conductor,
+    const char *log_file,
+    int64_t registration_id,
+    int64_t original_registration_id,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t *position_limit,
+    bool is_exclusive);
+
+void aeron_publication_delete(aeron_publication_t *publication);
+
+#endif //AERON_AERON_PUBLICATION_H
@@ -0,0 +1,429 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include "aeron_subscription.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+
+int aeron_subscription_create(
+    aeron_subscription_t **subscription, aeron_client_conductor_t *conductor, int64_t registration_id, int32_t stream_id)
+{
+    aeron_subscription_t *_subscription = NULL;
+
+    *subscription = NULL;
+    if (aeron_alloc((void **)&_subscription, sizeof(aeron_subscription_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_subscription->image_list, sizeof(aeron_image_list_t)) < 0)
+    {
+        aeron_free(_subscription);
+        return -1;
+    }
+
+    _subscription->image_list->length = 0;
+    _subscription->conductor = conductor;
+    _subscription->round_robin_index = 0;
+    _subscription->registration_id = registration_id;
+    _subscription->stream_id = stream_id;
+
+    *subscription = _subscription;
+    return 0;
+}
+
+void aeron_subscription_delete(aeron_subscription_t *subscription)
+{
+    for (size_t i = 0; i < subscription->image_list->length; i++)
+    {
+        aeron_image_delete(subscription->image_list->images[i]);
+    }
+
+    aeron_free(subscription->image_list);
+    aeron_free(subscription);
+}
+
+int aeron_subscription_add_image(aeron_subscription_t *subscription, aeron_image_t *image)
+{
+    aeron_image_list_t *old_list = subscription->image_list;
+    aeron_image_list_t *new_list = NULL;
+    const size_t new_length = old_list->length + 1;
+
+    if (aeron_alloc((void **)&new_list, sizeof(aeron_image_list_t) + (new_length * sizeof(aeron_image_t *))) < 0)
+    {
+        return -1;
+    }
+
+    memcpy(new_list->images, old_list->images, old_list->length * sizeof(aeron_image_t *));
+    new_list->images[old_list->length] = image;
+    new_list->length = new_length;
+
+    AERON_PUT_ORDERED(subscription->image_list, new_list);
+
+    return aeron_client_conductor_linger_resource(subscription->conductor, old_list, aeron_free);
+}
+
+aeron_image_t *aeron_subscription_remove_image(aeron_subscription_t *subscription, int64_t correlation_id)
+{
+    aeron_image_list_t *old_list = subscription->image_list;
+    aeron_image_list_t *new_list = NULL;
+    aeron_image_t *removed_image = NULL;
+    size_t index = 0;
+
+    for (; index < old_list->length; index++)
+    {
+        if (old_list->images[index]->correlation_id == correlation_id)
+        {
+            removed_image = old_list->images[index];
+            break;
+        }
+    }
+
+    if (NULL == removed_image)
+    {
+        return NULL;
+    }
+
+    const size_t new_length = old_list->length - 1;
+
+    if (aeron_alloc((void **)&new_list, sizeof(aeron_image_list_t) + (new_length * sizeof(aeron_image_t *))) < 0)
+    {
+        return NULL;
+    }
+
+    memcpy(new_list->images, old_list->images, index * sizeof(aeron_image_t *));
+    memcpy(
+        new_list->images + index,
+        old_list->images + index + 1,
+        (new_length - index) * sizeof(aeron_image_t *));
+    new_list->length = new_length;
+
+    AERON_PUT_ORDERED(removed_image->is_closed, true);
+    AERON_PUT_ORDERED(subscription->image_list, new_list);
+
+    if (aeron_client_conductor_linger_resource(subscription->conductor, old_list, aeron_free) < 0)
+    {
+        return NULL;
+    }
+
+    return removed_image;
+}
+
+int aeron_subscription_poll(
+    aeron_subscription_t *subscription, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit)
+{
+    aeron_image_list_t *image_list;
+
+    AERON_GET_VOLATILE(image_list, subscription->image_list);
+
+    const size_t length = image_list->length;
+    size_t fragments_read = 0;
+    size_t starting_index = subscription->round_robin_index++;
+
+    if (starting_index >= length)
+    {
+        subscription->round_robin_index = starting_index = 0;
+    }
+
+    for (size_t i = starting_index; i < length && fragments_read < fragment_limit; i++)
+    {
+        fragments_read += (size_t)aeron_image_poll(
+            image_list->images[i], handler, clientd, fragment_limit - fragments_read);
+    }
+
+    for (size_t i = 0; i < starting_index && fragments_read < fragment_limit; i++)
+    {
+        fragments_read += (size_t)aeron_image_poll(
+            image_list->images[i], handler, clientd, fragment_limit - fragments_read);
+    }
+
+    return (int)fragments_read;
+}
+
+int aeron_subscription_image_count(aeron_subscription_t *subscription)
+{
+    aeron_image_list_t *image_list;
+
+    AERON_GET_VOLATILE(image_list, subscription->image_list);
+
+    return (int)image_list->length;
+}
+
+bool aeron_subscription_is_connected(aeron_subscription_t *subscription)
+{
+    return aeron_subscription_image_count(subscription) > 0;
+}
+
+int32_t aeron_subscription_stream_id(aeron_subscription_t *subscription)
+{
+    return subscription->stream_id;
+}
+
+void aeron_subscription_for_each_image(aeron_subscription_t *subscription, aeron_image_func_t func, void *clientd)
+{
+    aeron_image_list_t *image_list;
+
+    AERON_GET_VOLATILE(image_list, subscription->image_list);
+
+    for (size_t i = 0; i < image_list->length; i++)
+    {
+        func(clientd, image_list->images[i]);
+    }
+}
+
+int aeron_subscription_close(aeron_subscription_t *subscription)
+{
+    return aeron_client_conductor_release_subscription(subscription->conductor, subscription);
+}
+
+int aeron_image_create(
+    aeron_image_t **image,
+    const char *log_file,
+    int64_t correlation_id,
+    int64_t subscription_registration_id,
+    int32_t session_id,
+    int64_t *subscriber_position)
+{
+    aeron_image_t *_image = NULL;
+
+    *image = NULL;
+    if (aeron_alloc((void **)&_image, sizeof(aeron_image_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_client_map_log(&_image->mapped_raw_log, log_file) < 0)
+    {
+        aeron_free(_image);
+        return -1;
+    }
+
+    _image->log_meta_data = (aeron_logbuffer_metadata_t *)_image->mapped_raw_log.log_meta_data.addr;
+    _image->subscriber_position = subscriber_position;
+    _image->correlation_id = correlation_id;
+    _image->subscription_registration_id = subscription_registration_id;
+    _image->session_id = session_id;
+    _image->initial_term_id = _image->log_meta_data->initial_term_id;
+    _image->term_length_mask = _image->log_meta_data->term_length - 1;
+    _image->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes(_image->log_meta_data->term_length);
+    _image->is_closed = false;
+
+    *image = _image;
+    return 0;
+}
+
+void aeron_image_delete(aeron_image_t *image)
+{
+    aeron_unmap(&image->mapped_raw_log.mapped_file);
+    aeron_free(image);
+}
+
+int aeron_image_poll(aeron_image_t *image, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit)
+{
+    bool is_closed;
+
+    AERON_GET_VOLATILE(is_closed, image->is_closed);
+    if (is_closed)
+    {
+        return 0;
+    }
+
+    const int64_t position = *image->subscriber_position;
+    const int32_t term_offset = (int32_t)position & image->term_length_mask;
+    const int32_t capacity = image->term_length_mask + 1;
+    const size_t index = aeron_logbuffer_index_by_position(position, image->position_bits_to_shift);
+    uint8_t *term_buffer = image->mapped_raw_log.term_buffers[index].addr;
+    aeron_header_t header = { NULL, image->initial_term_id, image->position_bits_to_shift };
+    int32_t offset = term_offset;
+    size_t fragments_read = 0;
+
+    while (fragments_read < fragment_limit && offset < capacity)
+    {
+        aeron_data_header_t *frame = (aeron_data_header_t *)(term_buffer + offset);
+        int32_t frame_length;
+
+        AERON_GET_VOLATILE(frame_length, frame->frame_header.frame_length);
+        if (frame_length <= 0)
+        {
+            break;
+        }
+
+        const int32_t frame_offset = offset;
+        offset += (int32_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+        if (AERON_HDR_TYPE_PAD != frame->frame_header.type)
+        {
+            header.frame = frame;
+            handler(
+                clientd,
+                term_buffer + frame_offset + AERON_DATA_HEADER_LENGTH,
+                (size_t)frame_length - AERON_DATA_HEADER_LENGTH,
+                &header);
+            fragments_read++;
+        }
+    }
+
+    if (offset > term_offset)
+    {
+        AERON_PUT_ORDERED(*image->subscriber_position, position + (offset - term_offset));
+    }
+
+    return (int)fragments_read;
+}
+
+/*
+ * Scan whole frames from offset up to limit_offset, stopping at the first gap. Padding is only included when it is
+ * the first frame so it is handed over as a block of its own and never merged with the data before it.
+ */
+static int32_t aeron_image_scan_block(const uint8_t *term_buffer, int32_t offset, int32_t limit_offset)
+{
+    const int32_t block_offset = offset;
+
+    while (offset < limit_offset)
+    {
+        aeron_frame_header_t *frame = (aeron_frame_header_t *)(term_buffer + offset);
+        int32_t frame_length;
+
+        AERON_GET_VOLATILE(frame_length, frame->frame_length);
+        if (frame_length <= 0)
+        {
+            break;
+        }
+
+        const int32_t aligned_frame_length = (int32_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+        if (AERON_HDR_TYPE_PAD == frame->type)
+        {
+            if (block_offset == offset)
+            {
+                offset += aligned_frame_length;
+            }
+            break;
+        }
+
+        if (offset + aligned_frame_length > limit_offset)
+        {
+            break;
+        }
+
+        offset += aligned_frame_length;
+    }
+
+    return offset;
+}
+
+int aeron_image_block_poll(
+    aeron_image_t *image, aeron_block_handler_t handler, void *clientd, size_t block_length_limit)
+{
+    bool is_closed;
+
+    AERON_GET_VOLATILE(is_closed, image->is_closed);
+    if (is_closed)
+    {
+        return 0;
+    }
+
+    const int64_t position = *image->subscriber_position;
+    const int32_t term_offset = (int32_t)position & image->term_length_mask;
+    const int32_t capacity = image->term_length_mask + 1;
+    const size_t index = aeron_logbuffer_index_by_position(position, image->position_bits_to_shift);
+    const uint8_t *term_buffer = image->mapped_raw_log.term_buffers[index].addr;
+    const int64_t limit_offset = (int64_t)term_offset + (int64_t)block_length_limit;
+    const int32_t resulting_offset = aeron_image_scan_block(
+        term_buffer, term_offset, limit_offset < capacity ? (int32_t)limit_offset : capacity);
+    const int32_t length = resulting_offset - term_offset;
+
+    if (length > 0)
+    {
+        const int32_t term_id = aeron_logbuffer_compute_term_id_from_position(
+            position, image->position_bits_to_shift, image->initial_term_id);
+
+        handler(clientd, term_buffer + term_offset, term_offset, (size_t)length, image->session_id, term_id);
+
+        AERON_PUT_ORDERED(*image->subscriber_position, position + length);
+    }
+
+    return length;
+}
+
+int64_t aeron_image_correlation_id(aeron_image_t *image)
+{
+    return image->correlation_id;
+}
+
+int32_t aeron_image_session_id(aeron_image_t *image)
+{
+    return image->session_id;
+}
+
+int64_t aeron_image_position(aeron_image_t *image)
+{
+    int64_t position;
+
+    AERON_GET_VOLATILE(position, *image->subscriber_position);
+
+    return position;
+}
+
+int32_t aeron_image_initial_term_id(aeron_image_t *image)
+{
+    return image->initial_term_id;
+}
+
+int32_t aeron_image_term_buffer_length(aeron_image_t *image)
+{
+    return image->term_length_mask + 1;
+}
+
+int32_t aeron_image_mtu_length(aeron_image_t *image)
+{
+    return image->log_meta_data->mtu_length;
+}
+
+bool aeron_image_is_closed(aeron_image_t *image)
+{
+    bool is_closed;
+
+    AERON_GET_VOLATILE(is_closed, image->is_closed);
+
+    return is_closed;
+}
+
+int32_t aeron_header_session_id(aeron_header_t *header)
+{
+    return header->frame->session_id;
+}
+
+int32_t aeron_header_stream_id(aeron_header_t *header)
+{
+    return header->frame->stream_id;
+}
+
+uint8_t aeron_header_flags(aeron_header_t *header)
+{
+    return header->frame->frame_header.flags;
+}
+
+int64_t aeron_header_position(aeron_header_t *header)
+{
+    const int32_t next_term_offset = (int32_t)AERON_ALIGN(
+        header->frame->term_offset + header->frame->frame_header.frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    return aeron_logbuffer_compute_position(
+        header->frame->term_id, next_term_offset, header->position_bits_to_shift, header->initial_term_id);
+}
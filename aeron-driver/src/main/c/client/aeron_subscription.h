@@ -0,0 +1,98 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_SUBSCRIPTION_H
+#define AERON_AERON_SUBSCRIPTION_H
+
+#include "aeron_client_conductor.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+
+struct aeron_header_stct
+{
+    aeron_data_header_t *frame;
+    int32_t initial_term_id;
+    size_t position_bits_to_shift;
+};
+
+struct aeron_image_stct
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    aeron_logbuffer_metadata_t *log_meta_data;
+    int64_t *subscriber_position;
+
+    int64_t correlation_id;
+    int64_t subscription_registration_id;
+    int32_t session_id;
+    int32_t initial_term_id;
+    int32_t term_length_mask;
+    size_t position_bits_to_shift;
+
+    bool is_closed;
+};
+
+/*
+ * Images are never added to or removed from a list in place. The conductor builds a new list and publishes it with an
+ * ordered store so a poll on another thread always iterates a complete list; the old list lingers until no poll can
+ * still be reading it.
+ */
+typedef struct aeron_image_list_stct
+{
+    size_t length;
+    aeron_image_t *images[];
+}
+aeron_image_list_t;
+
+struct aeron_subscription_stct
+{
+    aeron_client_conductor_t *conductor;
+    aeron_image_list_t *image_list;
+    size_t round_robin_index;
+
+    aeron_on_available_image_t on_available_image;
+    void *on_available_image_clientd;
+    aeron_on_unavailable_image_t on_unavailable_image;
+    void *on_unavailable_image_clientd;
+
+    int64_t registration_id;
+    int32_t stream_id;
+};
+
+int aeron_subscription_create(
+    aeron_subscription_t **subscription, aeron_client_conductor_t *conductor, int64_t registration_id, int32_t stream_id);
+
+void aeron_subscription_delete(aeron_subscription_t *subscription);
+
+int aeron_subscription_add_image(aeron_subscription_t *subscription, aeron_image_t *image);
+
+/*
+ * Swap the image out of the list of the subscription. Returns the image, which the caller must release, or NULL if
+ * the subscription has no image with the correlation id.
+ */
+aeron_image_t *aeron_subscription_remove_image(aeron_subscription_t *subscription, int64_t correlation_id);
+
+int aeron_image_create(
+    aeron_image_t **image,
+    const char *log_file,
+    int64_t correlation_id,
+    int64_t subscription_registration_id,
+    int32_t session_id,
+    int64_t *subscriber_position);
+
+void aeron_image_delete(aeron_image_t *image);
+
+int aeron_image_poll(aeron_image_t *image, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit);
+
+#endif //AERON_AERON_SUBSCRIPTION_H
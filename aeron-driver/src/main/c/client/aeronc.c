@@ -0,0 +1,312 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include "aeronc.h"
+#include "aeron_client_conductor.h"
+#include "aeron_publication.h"
+#include "aeron_subscription.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+
+struct aeron_stct
+{
+    aeron_context_t *context;
+    aeron_client_conductor_t conductor;
+};
+
+inline static const char *tmp_dir()
+{
+    const char *dir = "/tmp";
+
+    if (getenv("TMPDIR"))
+    {
+        dir = getenv("TMPDIR");
+    }
+
+    return dir;
+}
+
+inline static bool has_file_separator_at_end(const char *path)
+{
+    return path[strlen(path) - 1] == '/';
+}
+
+inline static const char *username()
+{
+    const char *username = getenv("USER");
+
+    if (NULL == username)
+    {
+        username = "default";
+    }
+
+    return username;
+}
+
+inline static uint64_t parse_uint64(const char *str, uint64_t def)
+{
+    if (NULL == str)
+    {
+        return def;
+    }
+
+    errno = 0;
+    char *end_ptr = NULL;
+    uint64_t value = strtoull(str, &end_ptr, 0);
+
+    if ((0 == value && 0 != errno) || end_ptr == str)
+    {
+        return def;
+    }
+
+    return value;
+}
+
+int aeron_context_init(aeron_context_t **context)
+{
+    aeron_context_t *_context = NULL;
+
+    if (NULL == context)
+    {
+        aeron_set_err(EINVAL, "aeron_context_init(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_context, sizeof(aeron_context_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_context->aeron_dir, AERON_MAX_PATH) < 0)
+    {
+        aeron_free(_context);
+        return -1;
+    }
+
+#if defined(__linux__)
+    snprintf(_context->aeron_dir, AERON_MAX_PATH - 1, "/dev/shm/aeron-%s", username());
+#else
+    snprintf(
+        _context->aeron_dir,
+        AERON_MAX_PATH - 1,
+        "%s%saeron-%s",
+        tmp_dir(),
+        has_file_separator_at_end(tmp_dir()) ? "" : "/",
+        username());
+#endif
+
+    char *value = NULL;
+
+    if ((value = getenv(AERON_DIR_ENV_VAR)))
+    {
+        snprintf(_context->aeron_dir, AERON_MAX_PATH - 1, "%s", value);
+    }
+
+    _context->driver_timeout_ms = parse_uint64(
+        getenv(AERON_DRIVER_TIMEOUT_ENV_VAR), AERON_CLIENT_DRIVER_TIMEOUT_MS_DEFAULT);
+    _context->keepalive_interval_ns = AERON_CLIENT_KEEPALIVE_INTERVAL_NS_DEFAULT;
+    _context->resource_linger_duration_ns = parse_uint64(
+        getenv(AERON_CLIENT_RESOURCE_LINGER_DURATION_ENV_VAR), AERON_CLIENT_RESOURCE_LINGER_DURATION_NS_DEFAULT);
+
+    *context = _context;
+    return 0;
+}
+
+int aeron_context_close(aeron_context_t *context)
+{
+    if (NULL == context)
+    {
+        aeron_set_err(EINVAL, "aeron_context_close(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    aeron_free(context->aeron_dir);
+    aeron_free(context);
+    return 0;
+}
+
+int aeron_context_set_dir(aeron_context_t *context, const char *value)
+{
+    if (NULL == value || strlen(value) >= AERON_MAX_PATH)
+    {
+        aeron_set_err(EINVAL, "aeron_context_set_dir: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    snprintf(context->aeron_dir, AERON_MAX_PATH, "%s", value);
+    return 0;
+}
+
+const char *aeron_context_get_dir(aeron_context_t *context)
+{
+    return context->aeron_dir;
+}
+
+int aeron_context_set_driver_timeout_ms(aeron_context_t *context, uint64_t value)
+{
+    context->driver_timeout_ms = value;
+    return 0;
+}
+
+uint64_t aeron_context_get_driver_timeout_ms(aeron_context_t *context)
+{
+    return context->driver_timeout_ms;
+}
+
+int aeron_context_set_keepalive_interval_ns(aeron_context_t *context, uint64_t value)
+{
+    context->keepalive_interval_ns = value;
+    return 0;
+}
+
+uint64_t aeron_context_get_keepalive_interval_ns(aeron_context_t *context)
+{
+    return context->keepalive_interval_ns;
+}
+
+int aeron_context_set_resource_linger_duration_ns(aeron_context_t *context, uint64_t value)
+{
+    context->resource_linger_duration_ns = value;
+    return 0;
+}
+
+uint64_t aeron_context_get_resource_linger_duration_ns(aeron_context_t *context)
+{
+    return context->resource_linger_duration_ns;
+}
+
+int aeron_init(aeron_t **client, aeron_context_t *context)
+{
+    aeron_t *_client = NULL;
+
+    if (NULL == client || NULL == context)
+    {
+        aeron_set_err(EINVAL, "aeron_init(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_client, sizeof(aeron_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_client_conductor_init(&_client->conductor, context) < 0)
+    {
+        aeron_free(_client);
+        return -1;
+    }
+
+    _client->context = context;
+
+    *client = _client;
+    return 0;
+}
+
+int aeron_main_do_work(aeron_t *client)
+{
+    return aeron_client_conductor_do_work(&client->conductor);
+}
+
+int aeron_close(aeron_t *client)
+{
+    if (NULL == client)
+    {
+        aeron_set_err(EINVAL, "aeron_close(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    aeron_client_conductor_on_close(&client->conductor);
+    aeron_free(client);
+    return 0;
+}
+
+int aeron_async_add_publication(
+    aeron_async_add_publication_t **async, aeron_t *client, const char *uri, int32_t stream_id)
+{
+    return aeron_client_conductor_async_add(
+        async, &client->conductor, AERON_CLIENT_TYPE_PUBLICATION, uri, stream_id);
+}
+
+int aeron_async_add_publication_poll(aeron_publication_t **publication, aeron_async_add_publication_t *async)
+{
+    *publication = NULL;
+
+    aeron_publication_t *resource = async->resource.publication;
+    int result = aeron_client_conductor_async_poll(async);
+
+    if (result > 0)
+    {
+        *publication = resource;
+    }
+
+    return result;
+}
+
+int aeron_async_add_exclusive_publication(
+    aeron_async_add_exclusive_publication_t **async, aeron_t *client, const char *uri, int32_t stream_id)
+{
+    return aeron_client_conductor_async_add(
+        async, &client->conductor, AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION, uri, stream_id);
+}
+
+int aeron_async_add_exclusive_publication_poll(
+    aeron_publication_t **publication, aeron_async_add_exclusive_publication_t *async)
+{
+    return aeron_async_add_publication_poll(publication, async);
+}
+
+int aeron_async_add_subscription(
+    aeron_async_add_subscription_t **async,
+    aeron_t *client,
+    const char *uri,
+    int32_t stream_id,
+    aeron_on_available_image_t on_available_image,
+    void *on_available_image_clientd,
+    aeron_on_unavailable_image_t on_unavailable_image,
+    void *on_unavailable_image_clientd)
+{
+    if (aeron_client_conductor_async_add(
+        async, &client->conductor, AERON_CLIENT_TYPE_SUBSCRIPTION, uri, stream_id) < 0)
+    {
+        return -1;
+    }
+
+    (*async)->on_available_image = on_available_image;
+    (*async)->on_available_image_clientd = on_available_image_clientd;
+    (*async)->on_unavailable_image = on_unavailable_image;
+    (*async)->on_unavailable_image_clientd = on_unavailable_image_clientd;
+
+    return 0;
+}
+
+int aeron_async_add_subscription_poll(aeron_subscription_t **subscription, aeron_async_add_subscription_t *async)
+{
+    *subscription = NULL;
+
+    aeron_subscription_t *resource = async->resource.subscription;
+    int result = aeron_client_conductor_async_poll(async);
+
+    if (result > 0)
+    {
+        *subscription = resource;
+    }
+
+    return result;
+}
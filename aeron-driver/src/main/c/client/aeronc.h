@@ -0,0 +1,394 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERONC_H
+#define AERON_AERONC_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct aeron_context_stct aeron_context_t;
+typedef struct aeron_stct aeron_t;
+typedef struct aeron_publication_stct aeron_publication_t;
+typedef struct aeron_subscription_stct aeron_subscription_t;
+typedef struct aeron_image_stct aeron_image_t;
+typedef struct aeron_header_stct aeron_header_t;
+typedef struct aeron_client_registering_resource_stct aeron_async_add_publication_t;
+typedef struct aeron_client_registering_resource_stct aeron_async_add_exclusive_publication_t;
+typedef struct aeron_client_registering_resource_stct aeron_async_add_subscription_t;
+
+/**
+ * The top level Aeron directory used for communication between a Media Driver and client.
+ */
+#define AERON_DIR_ENV_VAR "AERON_DIR"
+
+/**
+ * Timeout in milliseconds after which the driver is considered dead if it has not heartbeated, and after which an
+ * add that the driver has not answered fails.
+ */
+#define AERON_DRIVER_TIMEOUT_ENV_VAR "AERON_DRIVER_TIMEOUT"
+
+/**
+ * Time in nanoseconds that closed images are kept mapped so a poll racing the close never reads unmapped memory.
+ */
+#define AERON_CLIENT_RESOURCE_LINGER_DURATION_ENV_VAR "AERON_CLIENT_RESOURCE_LINGER_DURATION"
+
+/**
+ * Create an aeron_context_t struct and initialize with default values.
+ *
+ * @param context to create and initialize.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_context_init(aeron_context_t **context);
+
+/**
+ * Close and delete aeron_context_t struct.
+ *
+ * @param context to close and delete.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_context_close(aeron_context_t *context);
+
+int aeron_context_set_dir(aeron_context_t *context, const char *value);
+const char *aeron_context_get_dir(aeron_context_t *context);
+
+int aeron_context_set_driver_timeout_ms(aeron_context_t *context, uint64_t value);
+uint64_t aeron_context_get_driver_timeout_ms(aeron_context_t *context);
+
+int aeron_context_set_keepalive_interval_ns(aeron_context_t *context, uint64_t value);
+uint64_t aeron_context_get_keepalive_interval_ns(aeron_context_t *context);
+
+int aeron_context_set_resource_linger_duration_ns(aeron_context_t *context, uint64_t value);
+uint64_t aeron_context_get_resource_linger_duration_ns(aeron_context_t *context);
+
+/**
+ * Create an aeron_t client struct and connect to the driver using the aeron directory of the context.
+ *
+ * The given aeron_context_t struct will be used exclusively by the client. Do not reuse between clients.
+ *
+ * @param client to create and initialize.
+ * @param context to use for initialization.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_init(aeron_t **client, aeron_context_t *context);
+
+/**
+ * Call the client conductor duty cycle once: send keepalives, process responses from the driver, time out pending
+ * adds and release lingering resources. The client runs no threads of its own so this must be called regularly by
+ * the application.
+ *
+ * Conductor calls, i.e. this, the adds and their polls and the closes, must all be made from the same thread.
+ * aeron_publication_offer and aeron_subscription_poll may be called from other threads.
+ *
+ * @param client to call the duty cycle on.
+ * @return the amount of work done or -1 for error, e.g. when the driver has timed out.
+ */
+int aeron_main_do_work(aeron_t *client);
+
+/**
+ * Close the client, releasing all of its publications and subscriptions, and delete the aeron_t struct.
+ *
+ * @param client to close and delete.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_close(aeron_t *client);
+
+/**
+ * Ask the driver for a concurrent publication. The result is collected with aeron_async_add_publication_poll.
+ *
+ * @param async to hold the pending add.
+ * @param client to add the publication to.
+ * @param uri of the channel to publish to.
+ * @param stream_id to publish on.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_async_add_publication(
+    aeron_async_add_publication_t **async, aeron_t *client, const char *uri, int32_t stream_id);
+
+/**
+ * Poll a pending publication add. On completion or error the async struct is deleted.
+ *
+ * @param publication set to the publication once the driver has created it.
+ * @param async pending add to poll.
+ * @return 1 when the publication is ready, 0 while still pending and -1 for error.
+ */
+int aeron_async_add_publication_poll(aeron_publication_t **publication, aeron_async_add_publication_t *async);
+
+/**
+ * Ask the driver for an exclusive publication, which has a session of its own and may only be offered to from one
+ * thread at a time. An IPC channel may give init-term-id, term-id and term-offset to start the publication at a
+ * position, e.g. to replay a recording at the positions it was recorded at.
+ *
+ * @param async to hold the pending add.
+ * @param client to add the publication to.
+ * @param uri of the channel to publish to.
+ * @param stream_id to publish on.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_async_add_exclusive_publication(
+    aeron_async_add_exclusive_publication_t **async, aeron_t *client, const char *uri, int32_t stream_id);
+
+/**
+ * Poll a pending exclusive publication add. On completion or error the async struct is deleted.
+ *
+ * @param publication set to the publication once the driver has created it.
+ * @param async pending add to poll.
+ * @return 1 when the publication is ready, 0 while still pending and -1 for error.
+ */
+int aeron_async_add_exclusive_publication_poll(
+    aeron_publication_t **publication, aeron_async_add_exclusive_publication_t *async);
+
+/**
+ * Called on the conductor thread once an image has been added to the subscription.
+ */
+typedef void (*aeron_on_available_image_t)(void *clientd, aeron_subscription_t *subscription, aeron_image_t *image);
+
+/**
+ * Called on the conductor thread once an image has been removed from the subscription. The image is closed but stays
+ * mapped until the linger duration has passed.
+ */
+typedef void (*aeron_on_unavailable_image_t)(void *clientd, aeron_subscription_t *subscription, aeron_image_t *image);
+
+/**
+ * Ask the driver for a subscription. The result is collected with aeron_async_add_subscription_poll.
+ *
+ * The image handlers are called for every image of the subscription, including those that arrive before the add has
+ * been polled to completion.
+ *
+ * @param async to hold the pending add.
+ * @param client to add the subscription to.
+ * @param uri of the channel to subscribe to.
+ * @param stream_id to subscribe to.
+ * @param on_available_image called as each image is added, or NULL.
+ * @param on_available_image_clientd to pass to on_available_image.
+ * @param on_unavailable_image called as each image is removed, or NULL.
+ * @param on_unavailable_image_clientd to pass to on_unavailable_image.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_async_add_subscription(
+    aeron_async_add_subscription_t **async,
+    aeron_t *client,
+    const char *uri,
+    int32_t stream_id,
+    aeron_on_available_image_t on_available_image,
+    void *on_available_image_clientd,
+    aeron_on_unavailable_image_t on_unavailable_image,
+    void *on_unavailable_image_clientd);
+
+/**
+ * Poll a pending subscription add. On completion or error the async struct is deleted.
+ *
+ * @param subscription set to the subscription once the driver has created it.
+ * @param async pending add to poll.
+ * @return 1 when the subscription is ready, 0 while still pending and -1 for error.
+ */
+int aeron_async_add_subscription_poll(aeron_subscription_t **subscription, aeron_async_add_subscription_t *async);
+
+/**
+ * The publication is not yet connected to a subscriber.
+ */
+#define AERON_PUBLICATION_NOT_CONNECTED (-1L)
+
+/**
+ * The offer failed due to back pressure from the subscribers preventing further transmission.
+ */
+#define AERON_PUBLICATION_BACK_PRESSURED (-2L)
+
+/**
+ * The offer failed due to an administration action and should be retried, e.g. the log rotated to a new term.
+ */
+#define AERON_PUBLICATION_ADMIN_ACTION (-3L)
+
+/**
+ * The publication has been closed and should no longer be used.
+ */
+#define AERON_PUBLICATION_CLOSED (-4L)
+
+/**
+ * The offer failed due to reaching the maximum position of the stream given term length times the total possible
+ * number of terms.
+ */
+#define AERON_PUBLICATION_MAX_POSITION_EXCEEDED (-5L)
+
+/**
+ * An error has occurred, e.g. the message is longer than the maximum message length of the publication.
+ */
+#define AERON_PUBLICATION_ERROR (-6L)
+
+/**
+ * Non-blocking publish of a buffer containing a message. Fragments the message if it is longer than the MTU allows.
+ * Allocates nothing and is safe to call from several threads at once.
+ *
+ * @param publication to publish on.
+ * @param buffer containing the message.
+ * @param length of the message.
+ * @return the new stream position on success, otherwise one of the AERON_PUBLICATION_* codes.
+ */
+int64_t aeron_publication_offer(aeron_publication_t *publication, const uint8_t *buffer, size_t length);
+
+/**
+ * Non-blocking publish of a block of whole frames, headers included, e.g. as recorded from an image. The first frame
+ * must carry the term id and term offset of the current position and the block must not cross the end of the term.
+ * Session and stream ids are rewritten to those of the publication. Only for exclusive publications.
+ *
+ * @param publication to publish on.
+ * @param buffer containing the frames.
+ * @param length of the block, a multiple of the frame alignment.
+ * @return the new stream position on success, otherwise one of the AERON_PUBLICATION_* codes.
+ */
+int64_t aeron_publication_offer_block(aeron_publication_t *publication, const uint8_t *buffer, size_t length);
+
+/**
+ * The position the publication has been appended up to.
+ *
+ * @param publication to get the position of.
+ * @return position of the tail of the publication.
+ */
+int64_t aeron_publication_position(aeron_publication_t *publication);
+
+bool aeron_publication_is_connected(aeron_publication_t *publication);
+int32_t aeron_publication_session_id(aeron_publication_t *publication);
+int32_t aeron_publication_stream_id(aeron_publication_t *publication);
+size_t aeron_publication_max_message_length(aeron_publication_t *publication);
+
+/**
+ * Close the publication and release it to the driver. The publication must not be used afterwards.
+ *
+ * @param publication to close.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_publication_close(aeron_publication_t *publication);
+
+/**
+ * Callback for handling fragments of data being read from a log.
+ *
+ * @param clientd passed to the poll.
+ * @param buffer containing the data.
+ * @param length of the data in bytes.
+ * @param header representing the meta data for the data.
+ */
+typedef void (*aeron_fragment_handler_t)(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
+
+int32_t aeron_header_session_id(aeron_header_t *header);
+int32_t aeron_header_stream_id(aeron_header_t *header);
+uint8_t aeron_header_flags(aeron_header_t *header);
+
+/**
+ * The position the stream will have reached once the fragment of this header has been consumed.
+ *
+ * @param header of the fragment.
+ * @return position after the fragment.
+ */
+int64_t aeron_header_position(aeron_header_t *header);
+
+/**
+ * Poll the images of the subscription for new fragments, starting from a different image each call so that one busy
+ * image does not starve the others. Allocates nothing and may be called from a thread other than the conductor, but
+ * only from one thread at a time.
+ *
+ * @param subscription to poll.
+ * @param handler to call for each fragment.
+ * @param clientd to pass to the handler.
+ * @param fragment_limit maximum number of fragments to hand to the handler.
+ * @return the number of fragments read.
+ */
+int aeron_subscription_poll(
+    aeron_subscription_t *subscription, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit);
+
+int aeron_subscription_image_count(aeron_subscription_t *subscription);
+bool aeron_subscription_is_connected(aeron_subscription_t *subscription);
+int32_t aeron_subscription_stream_id(aeron_subscription_t *subscription);
+
+typedef void (*aeron_image_func_t)(void *clientd, aeron_image_t *image);
+
+/**
+ * Call func for each image of the subscription. Images handed out this way remain mapped until the linger duration
+ * after they are closed, so they may be kept while aeron_image_is_closed returns false. Must be called from the
+ * conductor thread.
+ *
+ * @param subscription whose images to iterate.
+ * @param func to call for each image.
+ * @param clientd to pass to func.
+ */
+void aeron_subscription_for_each_image(aeron_subscription_t *subscription, aeron_image_func_t func, void *clientd);
+
+/**
+ * Callback for handling a block of whole frames, headers included, read from the term of an image.
+ *
+ * @param clientd passed to the poll.
+ * @param buffer pointing to the first frame of the block in the term buffer.
+ * @param term_offset of the block within the term.
+ * @param length of the block in bytes.
+ * @param session_id of the image.
+ * @param term_id of the term the block was read from.
+ */
+typedef void (*aeron_block_handler_t)(
+    void *clientd, const uint8_t *buffer, int32_t term_offset, size_t length, int32_t session_id, int32_t term_id);
+
+/**
+ * Poll for the next contiguous block of frames in the current term of the image, up to a length limit, and advance
+ * the position past it once the handler returns. Padding at the end of a term is handed over as a block of its own.
+ *
+ * @param image to poll.
+ * @param handler to call with the block.
+ * @param clientd to pass to the handler.
+ * @param block_length_limit maximum length of the block.
+ * @return the number of bytes consumed.
+ */
+int aeron_image_block_poll(
+    aeron_image_t *image, aeron_block_handler_t handler, void *clientd, size_t block_length_limit);
+
+int64_t aeron_image_correlation_id(aeron_image_t *image);
+int32_t aeron_image_session_id(aeron_image_t *image);
+int64_t aeron_image_position(aeron_image_t *image);
+int32_t aeron_image_initial_term_id(aeron_image_t *image);
+int32_t aeron_image_term_buffer_length(aeron_image_t *image);
+int32_t aeron_image_mtu_length(aeron_image_t *image);
+bool aeron_image_is_closed(aeron_image_t *image);
+
+/**
+ * Close the subscription and release it to the driver. The subscription must not be used afterwards.
+ *
+ * @param subscription to close.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_subscription_close(aeron_subscription_t *subscription);
+
+/**
+ * Return current aeron error code (errno) for calling thread.
+ *
+ * @return aeron error code for calling thread.
+ */
+int aeron_errcode();
+
+/**
+ * Return the current aeron error message for calling thread.
+ *
+ * @return aeron error message for calling thread.
+ */
+const char *aeron_errmsg();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //AERON_AERONC_H
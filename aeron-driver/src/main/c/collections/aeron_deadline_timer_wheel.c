@@ -0,0 +1,302 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include "collections/aeron_deadline_timer_wheel.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_error.h"
+#include "aeron_alloc.h"
+
+static inline int64_t aeron_deadline_timer_wheel_timer_id(size_t spoke_index, size_t slot_index)
+{
+    return ((int64_t)spoke_index << 32) | (int64_t)slot_index;
+}
+
+static inline size_t aeron_deadline_timer_wheel_spoke_index(int64_t timer_id)
+{
+    return (size_t)(timer_id >> 32);
+}
+
+static inline size_t aeron_deadline_timer_wheel_slot_index(int64_t timer_id)
+{
+    return (size_t)(timer_id & 0xFFFFFFFFL);
+}
+
+static void aeron_deadline_timer_wheel_clear(aeron_deadline_timer_wheel_timer_t *timers, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        timers[i].deadline_ns = AERON_DEADLINE_TIMER_WHEEL_NULL_DEADLINE;
+        timers[i].value = 0;
+    }
+}
+
+int aeron_deadline_timer_wheel_init(
+    aeron_deadline_timer_wheel_t *wheel, int64_t start_time_ns, int64_t tick_resolution_ns, size_t ticks_per_wheel)
+{
+    wheel->timers = NULL;
+
+    if (!AERON_IS_POWER_OF_TWO(tick_resolution_ns) || !AERON_IS_POWER_OF_TWO(ticks_per_wheel))
+    {
+        aeron_set_err(EINVAL, "%s", "tick resolution and ticks per wheel must be powers of two");
+        return -1;
+    }
+
+    const size_t length = ticks_per_wheel * AERON_DEADLINE_TIMER_WHEEL_INITIAL_TICK_ALLOCATION;
+
+    if (aeron_alloc((void **)&wheel->timers, length * sizeof(aeron_deadline_timer_wheel_timer_t)) < 0)
+    {
+        return -1;
+    }
+
+    aeron_deadline_timer_wheel_clear(wheel->timers, length);
+
+    wheel->start_time_ns = start_time_ns;
+    wheel->current_tick = 0;
+    wheel->tick_resolution_ns = tick_resolution_ns;
+    wheel->ticks_per_wheel = ticks_per_wheel;
+    wheel->tick_mask = ticks_per_wheel - 1;
+    wheel->tick_allocation = AERON_DEADLINE_TIMER_WHEEL_INITIAL_TICK_ALLOCATION;
+    wheel->allocation_bits_to_shift =
+        (size_t)aeron_number_of_trailing_zeroes(AERON_DEADLINE_TIMER_WHEEL_INITIAL_TICK_ALLOCATION);
+    wheel->resolution_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)tick_resolution_ns);
+    wheel->poll_index = 0;
+    wheel->timer_count = 0;
+
+    return 0;
+}
+
+void aeron_deadline_timer_wheel_close(aeron_deadline_timer_wheel_t *wheel)
+{
+    aeron_free(wheel->timers);
+    wheel->timers = NULL;
+    wheel->timer_count = 0;
+}
+
+static int64_t aeron_deadline_timer_wheel_increase_capacity(
+    aeron_deadline_timer_wheel_t *wheel, int64_t deadline_ns, int64_t value, size_t spoke_index)
+{
+    const size_t old_tick_allocation = wheel->tick_allocation;
+    const size_t new_tick_allocation = old_tick_allocation * 2;
+    const size_t new_allocation_bits_to_shift = wheel->allocation_bits_to_shift + 1;
+    const size_t new_length = wheel->ticks_per_wheel * new_tick_allocation;
+    aeron_deadline_timer_wheel_timer_t *new_timers = NULL;
+
+    if (new_tick_allocation > UINT32_MAX ||
+        aeron_alloc((void **)&new_timers, new_length * sizeof(aeron_deadline_timer_wheel_timer_t)) < 0)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not grow deadline timer wheel");
+        return AERON_DEADLINE_TIMER_WHEEL_NULL_TIMER_ID;
+    }
+
+    aeron_deadline_timer_wheel_clear(new_timers, new_length);
+
+    for (size_t j = 0; j < wheel->ticks_per_wheel; j++)
+    {
+        const size_t old_index = j << wheel->allocation_bits_to_shift;
+        const size_t new_index = j << new_allocation_bits_to_shift;
+
+        for (size_t i = 0; i < old_tick_allocation; i++)
+        {
+            new_timers[new_index + i] = wheel->timers[old_index + i];
+        }
+    }
+
+    aeron_deadline_timer_wheel_timer_t *timer =
+        &new_timers[(spoke_index << new_allocation_bits_to_shift) + old_tick_allocation];
+    timer->deadline_ns = deadline_ns;
+    timer->value = value;
+
+    aeron_free(wheel->timers);
+    wheel->timers = new_timers;
+    wheel->tick_allocation = new_tick_allocation;
+    wheel->allocation_bits_to_shift = new_allocation_bits_to_shift;
+    wheel->timer_count++;
+
+    return aeron_deadline_timer_wheel_timer_id(spoke_index, old_tick_allocation);
+}
+
+int64_t aeron_deadline_timer_wheel_schedule(aeron_deadline_timer_wheel_t *wheel, int64_t deadline_ns, int64_t value)
+{
+    int64_t deadline_tick = (deadline_ns - wheel->start_time_ns) >> wheel->resolution_bits_to_shift;
+
+    if (deadline_tick < wheel->current_tick)
+    {
+        deadline_tick = wheel->current_tick;
+    }
+
+    const size_t spoke_index = (size_t)deadline_tick & wheel->tick_mask;
+    const size_t tick_start_index = spoke_index << wheel->allocation_bits_to_shift;
+
+    for (size_t i = 0; i < wheel->tick_allocation; i++)
+    {
+        aeron_deadline_timer_wheel_timer_t *timer = &wheel->timers[tick_start_index + i];
+
+        if (AERON_DEADLINE_TIMER_WHEEL_NULL_DEADLINE == timer->deadline_ns)
+        {
+            timer->deadline_ns = deadline_ns;
+            timer->value = value;
+            wheel->timer_count++;
+
+            return aeron_deadline_timer_wheel_timer_id(spoke_index, i);
+        }
+    }
+
+    return aeron_deadline_timer_wheel_increase_capacity(wheel, deadline_ns, value, spoke_index);
+}
+
+static aeron_deadline_timer_wheel_timer_t *aeron_deadline_timer_wheel_find(
+    aeron_deadline_timer_wheel_t *wheel, int64_t timer_id)
+{
+    if (timer_id < 0)
+    {
+        return NULL;
+    }
+
+    const size_t spoke_index = aeron_deadline_timer_wheel_spoke_index(timer_id);
+    const size_t slot_index = aeron_deadline_timer_wheel_slot_index(timer_id);
+
+    if (spoke_index >= wheel->ticks_per_wheel || slot_index >= wheel->tick_allocation)
+    {
+        return NULL;
+    }
+
+    return &wheel->timers[(spoke_index << wheel->allocation_bits_to_shift) + slot_index];
+}
+
+bool aeron_deadline_timer_wheel_cancel(aeron_deadline_timer_wheel_t *wheel, int64_t timer_id)
+{
+    aeron_deadline_timer_wheel_timer_t *timer = aeron_deadline_timer_wheel_find(wheel, timer_id);
+
+    if (NULL == timer || AERON_DEADLINE_TIMER_WHEEL_NULL_DEADLINE == timer->deadline_ns)
+    {
+        return false;
+    }
+
+    timer->deadline_ns = AERON_DEADLINE_TIMER_WHEEL_NULL_DEADLINE;
+    timer->value = 0;
+    wheel->timer_count--;
+
+    return true;
+}
+
+int64_t aeron_deadline_timer_wheel_deadline(aeron_deadline_timer_wheel_t *wheel, int64_t timer_id)
+{
+    aeron_deadline_timer_wheel_timer_t *timer = aeron_deadline_timer_wheel_find(wheel, timer_id);
+
+    return NULL == timer ? AERON_DEADLINE_TIMER_WHEEL_NULL_DEADLINE : timer->deadline_ns;
+}
+
+int aeron_deadline_timer_wheel_poll(
+    aeron_deadline_timer_wheel_t *wheel,
+    int64_t now_ns,
+    aeron_deadline_timer_wheel_expiry_func_t handler,
+    void *clientd,
+    size_t expiry_limit)
+{
+    size_t timers_expired = 0;
+    const int64_t now_tick = (now_ns - wheel->start_time_ns) >> wheel->resolution_bits_to_shift;
+
+    /* one revolution visits every spoke so there is nothing to gain from stepping through older ticks */
+    if (now_tick - wheel->current_tick >= (int64_t)wheel->ticks_per_wheel)
+    {
+        wheel->current_tick = now_tick - (int64_t)wheel->ticks_per_wheel + 1;
+        wheel->poll_index = 0;
+    }
+
+    while (wheel->timer_count > 0)
+    {
+        const size_t spoke_index = (size_t)wheel->current_tick & wheel->tick_mask;
+
+        for (size_t i = 0, length = wheel->tick_allocation; i < length && expiry_limit > timers_expired; i++)
+        {
+            const size_t poll_index = wheel->poll_index;
+            aeron_deadline_timer_wheel_timer_t *timer =
+                &wheel->timers[(spoke_index << wheel->allocation_bits_to_shift) + poll_index];
+            const int64_t deadline_ns = timer->deadline_ns;
+
+            if (now_ns >= deadline_ns)
+            {
+                const int64_t value = timer->value;
+
+                timer->deadline_ns = AERON_DEADLINE_TIMER_WHEEL_NULL_DEADLINE;
+                timer->value = 0;
+                wheel->timer_count--;
+
+                if (!handler(clientd, now_ns, aeron_deadline_timer_wheel_timer_id(spoke_index, poll_index), value))
+                {
+                    /* the handler may have grown the wheel so look the slot up again */
+                    timer = &wheel->timers[(spoke_index << wheel->allocation_bits_to_shift) + poll_index];
+                    timer->deadline_ns = deadline_ns;
+                    timer->value = value;
+                    wheel->timer_count++;
+
+                    return (int)timers_expired;
+                }
+
+                timers_expired++;
+            }
+
+            wheel->poll_index = (poll_index + 1) >= length ? 0 : poll_index + 1;
+        }
+
+        if (expiry_limit > timers_expired && now_ns >= aeron_deadline_timer_wheel_current_tick_time_ns(wheel))
+        {
+            wheel->current_tick++;
+            wheel->poll_index = 0;
+        }
+        else
+        {
+            if (wheel->poll_index >= wheel->tick_allocation)
+            {
+                wheel->poll_index = 0;
+            }
+
+            return (int)timers_expired;
+        }
+    }
+
+    /* nothing left to expire so move straight to the tick containing now */
+    if (now_ns >= aeron_deadline_timer_wheel_current_tick_time_ns(wheel))
+    {
+        wheel->current_tick = (now_ns - wheel->start_time_ns) >> wheel->resolution_bits_to_shift;
+        wheel->poll_index = 0;
+    }
+
+    return (int)timers_expired;
+}
+
+void aeron_deadline_timer_wheel_for_each(
+    aeron_deadline_timer_wheel_t *wheel, aeron_deadline_timer_wheel_for_each_func_t func, void *clientd)
+{
+    for (size_t j = 0; j < wheel->ticks_per_wheel; j++)
+    {
+        const size_t tick_start_index = j << wheel->allocation_bits_to_shift;
+
+        for (size_t i = 0; i < wheel->tick_allocation; i++)
+        {
+            aeron_deadline_timer_wheel_timer_t *timer = &wheel->timers[tick_start_index + i];
+
+            if (AERON_DEADLINE_TIMER_WHEEL_NULL_DEADLINE != timer->deadline_ns)
+            {
+                func(clientd, timer->deadline_ns, aeron_deadline_timer_wheel_timer_id(j, i), timer->value);
+            }
+        }
+    }
+}
+
+extern int64_t aeron_deadline_timer_wheel_current_tick_time_ns(aeron_deadline_timer_wheel_t *wheel);
+extern size_t aeron_deadline_timer_wheel_timer_count(aeron_deadline_timer_wheel_t *wheel);
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_DEADLINE_TIMER_WHEEL_H
+#define AERON_AERON_DEADLINE_TIMER_WHEEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define AERON_DEADLINE_TIMER_WHEEL_NULL_DEADLINE (INT64_MAX)
+#define AERON_DEADLINE_TIMER_WHEEL_NULL_TIMER_ID (-1)
+#define AERON_DEADLINE_TIMER_WHEEL_INITIAL_TICK_ALLOCATION (16)
+
+typedef struct aeron_deadline_timer_wheel_timer_stct
+{
+    int64_t deadline_ns;
+    int64_t value;
+}
+aeron_deadline_timer_wheel_timer_t;
+
+/*
+ * Hashed wheel of deadline timers. Each spoke of the wheel covers one tick and holds a growable block of timer
+ * slots, so scheduling and cancelling are O(1) and polling only visits the timers in the current spoke.
+ * Timer ids encode the spoke and slot and stay stable when the wheel grows.
+ */
+typedef struct aeron_deadline_timer_wheel_stct
+{
+    aeron_deadline_timer_wheel_timer_t *timers;
+    int64_t start_time_ns;
+    int64_t current_tick;
+    int64_t tick_resolution_ns;
+    size_t ticks_per_wheel;
+    size_t tick_mask;
+    size_t tick_allocation;
+    size_t allocation_bits_to_shift;
+    size_t resolution_bits_to_shift;
+    size_t poll_index;
+    size_t timer_count;
+}
+aeron_deadline_timer_wheel_t;
+
+/*
+ * Called for each expired timer. Return false to keep the timer and stop the current poll.
+ */
+typedef bool (*aeron_deadline_timer_wheel_expiry_func_t)(
+    void *clientd, int64_t now_ns, int64_t timer_id, int64_t value);
+
+typedef void (*aeron_deadline_timer_wheel_for_each_func_t)(
+    void *clientd, int64_t deadline_ns, int64_t timer_id, int64_t value);
+
+/*
+ * tick_resolution_ns and ticks_per_wheel must both be powers of two.
+ */
+int aeron_deadline_timer_wheel_init(
+    aeron_deadline_timer_wheel_t *wheel, int64_t start_time_ns, int64_t tick_resolution_ns, size_t ticks_per_wheel);
+
+void aeron_deadline_timer_wheel_close(aeron_deadline_timer_wheel_t *wheel);
+
+/*
+ * Returns the id of the scheduled timer or AERON_DEADLINE_TIMER_WHEEL_NULL_TIMER_ID if the wheel could not grow.
+ */
+int64_t aeron_deadline_timer_wheel_schedule(aeron_deadline_timer_wheel_t *wheel, int64_t deadline_ns, int64_t value);
+
+bool aeron_deadline_timer_wheel_cancel(aeron_deadline_timer_wheel_t *wheel, int64_t timer_id);
+
+int64_t aeron_deadline_timer_wheel_deadline(aeron_deadline_timer_wheel_t *wheel, int64_t timer_id);
+
+/*
+ * Expire timers whose deadline has passed, catching the wheel up to now_ns one tick at a time. Returns the number
+ * of timers expired.
+ */
+int aeron_deadline_timer_wheel_poll(
+    aeron_deadline_timer_wheel_t *wheel,
+    int64_t now_ns,
+    aeron_deadline_timer_wheel_expiry_func_t handler,
+    void *clientd,
+    size_t expiry_limit);
+
+void aeron_deadline_timer_wheel_for_each(
+    aeron_deadline_timer_wheel_t *wheel, aeron_deadline_timer_wheel_for_each_func_t func, void *clientd);
+
+inline int64_t aeron_deadline_timer_wheel_current_tick_time_ns(aeron_deadline_timer_wheel_t *wheel)
+{
+    return ((wheel->current_tick + 1) << wheel->resolution_bits_to_shift) + wheel->start_time_ns;
+}
+
+inline size_t aeron_deadline_timer_wheel_timer_count(aeron_deadline_timer_wheel_t *wheel)
+{
+    return wheel->timer_count;
+}
+
+#endif //AERON_AERON_DEADLINE_TIMER_WHEEL_H
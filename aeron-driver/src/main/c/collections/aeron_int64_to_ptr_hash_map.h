@@ -39,12 +39,16 @@ aeron_int64_to_ptr_hash_map_t;
 
 inline size_t aeron_int64_to_ptr_hash_map_hash_key(int64_t key, size_t mask)
 {
-    return (key * 31) & mask;
+    /* fold the high half in so compound keys sharing their low half do not all land in one chain */
+    uint64_t hash = (uint64_t)key * 31;
+    hash = (uint32_t)hash ^ (uint32_t)(hash >> 32);
+
+    return (size_t)hash & mask;
 }
 
 inline int64_t aeron_int64_to_ptr_hash_map_compound_key(int32_t high, int32_t low)
 {
-    return ((int64_t)high << 32) | (low);
+    return (int64_t)(((uint64_t)(uint32_t)high << 32) | (uint32_t)low);
 }
 
 inline int aeron_int64_to_ptr_hash_map_init(aeron_int64_to_ptr_hash_map_t *map, size_t initial_capacity, float load_factor)
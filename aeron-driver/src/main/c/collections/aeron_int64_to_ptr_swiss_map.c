@@ -0,0 +1,39 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
+
+extern uint64_t aeron_int64_to_ptr_swiss_map_hash_key(int64_t key);
+
+#if defined(AERON_SWISS_MAP_NEON)
+extern uint32_t aeron_int64_to_ptr_swiss_map_neon_movemask(uint8x16_t lanes);
+#endif
+
+extern uint32_t aeron_int64_to_ptr_swiss_map_group_match(const int8_t *group, int8_t value);
+extern uint32_t aeron_int64_to_ptr_swiss_map_group_match_free(const int8_t *group);
+
+extern int aeron_int64_to_ptr_swiss_map_alloc(size_t capacity, int8_t **ctrl, int64_t **keys, void ***values);
+extern int aeron_int64_to_ptr_swiss_map_init(
+    aeron_int64_to_ptr_swiss_map_t *map, size_t initial_capacity, float load_factor);
+extern void aeron_int64_to_ptr_swiss_map_delete(aeron_int64_to_ptr_swiss_map_t *map);
+extern int64_t aeron_int64_to_ptr_swiss_map_find(aeron_int64_to_ptr_swiss_map_t *map, const int64_t key);
+extern size_t aeron_int64_to_ptr_swiss_map_find_free(const int8_t *ctrl, size_t capacity, const uint64_t hash);
+extern int aeron_int64_to_ptr_swiss_map_rehash(aeron_int64_to_ptr_swiss_map_t *map, size_t new_capacity);
+extern int aeron_int64_to_ptr_swiss_map_put(aeron_int64_to_ptr_swiss_map_t *map, const int64_t key, void *value);
+extern void *aeron_int64_to_ptr_swiss_map_get(aeron_int64_to_ptr_swiss_map_t *map, const int64_t key);
+extern void *aeron_int64_to_ptr_swiss_map_remove(aeron_int64_to_ptr_swiss_map_t *map, int64_t key);
+extern void aeron_int64_to_ptr_swiss_map_for_each(
+    aeron_int64_to_ptr_swiss_map_t *map, aeron_int64_to_ptr_swiss_map_for_each_func_t func, void *clientd);
@@ -0,0 +1,370 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_INT64_TO_PTR_SWISS_MAP_H
+#define AERON_AERON_INT64_TO_PTR_SWISS_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include "util/aeron_bitutil.h"
+#include "aeron_alloc.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AERON_SWISS_MAP_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define AERON_SWISS_MAP_NEON
+#endif
+
+/*
+ * Open addressing map with one control byte per slot, probed a group of slots at a time. A control byte holds the
+ * low 7 bits of the hash for a full slot, or one of the EMPTY and DELETED markers which both have the top bit set.
+ * Groups are aligned so the control bytes of a group are compared with a single SIMD instruction where available.
+ */
+#define AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH (16)
+#define AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY ((int8_t)-128)
+#define AERON_INT64_TO_PTR_SWISS_MAP_CTRL_DELETED ((int8_t)-2)
+#define AERON_INT64_TO_PTR_SWISS_MAP_DEFAULT_LOAD_FACTOR (0.875f)
+
+typedef struct aeron_int64_to_ptr_swiss_map_stct
+{
+    int8_t *ctrl;
+    int64_t *keys;
+    void **values;
+    float load_factor;
+    size_t capacity;
+    size_t size;
+    size_t tombstones;
+    size_t resize_threshold;
+}
+aeron_int64_to_ptr_swiss_map_t;
+
+inline uint64_t aeron_int64_to_ptr_swiss_map_hash_key(int64_t key)
+{
+    uint64_t hash = (uint64_t)key * UINT64_C(0x9E3779B97F4A7C15);
+
+    return hash ^ (hash >> 32);
+}
+
+#if defined(AERON_SWISS_MAP_NEON)
+inline uint32_t aeron_int64_to_ptr_swiss_map_neon_movemask(uint8x16_t lanes)
+{
+    const uint8x16_t bits = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t masked = vandq_u8(lanes, bits);
+
+    return (uint32_t)vaddv_u8(vget_low_u8(masked)) | ((uint32_t)vaddv_u8(vget_high_u8(masked)) << 8);
+}
+#endif
+
+/* bit i of the result is set when control byte i of the group equals value */
+inline uint32_t aeron_int64_to_ptr_swiss_map_group_match(const int8_t *group, int8_t value)
+{
+#if defined(AERON_SWISS_MAP_SSE2)
+    const __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), ctrl));
+#elif defined(AERON_SWISS_MAP_NEON)
+    return aeron_int64_to_ptr_swiss_map_neon_movemask(vceqq_s8(vld1q_s8(group), vdupq_n_s8(value)));
+#else
+    uint32_t mask = 0;
+
+    for (size_t i = 0; i < AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH; i++)
+    {
+        mask |= (uint32_t)(group[i] == value) << i;
+    }
+
+    return mask;
+#endif
+}
+
+/* bit i of the result is set when slot i of the group is EMPTY or DELETED */
+inline uint32_t aeron_int64_to_ptr_swiss_map_group_match_free(const int8_t *group)
+{
+#if defined(AERON_SWISS_MAP_SSE2)
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#elif defined(AERON_SWISS_MAP_NEON)
+    return aeron_int64_to_ptr_swiss_map_neon_movemask(vcltzq_s8(vld1q_s8(group)));
+#else
+    uint32_t mask = 0;
+
+    for (size_t i = 0; i < AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH; i++)
+    {
+        mask |= (uint32_t)(group[i] < 0) << i;
+    }
+
+    return mask;
+#endif
+}
+
+inline int aeron_int64_to_ptr_swiss_map_alloc(size_t capacity, int8_t **ctrl, int64_t **keys, void ***values)
+{
+    if (aeron_alloc((void **)ctrl, capacity) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)keys, capacity * sizeof(int64_t)) < 0)
+    {
+        aeron_free(*ctrl);
+        return -1;
+    }
+
+    if (aeron_alloc((void **)values, capacity * sizeof(void *)) < 0)
+    {
+        aeron_free(*ctrl);
+        aeron_free(*keys);
+        return -1;
+    }
+
+    memset(*ctrl, (uint8_t)AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY, capacity);
+
+    return 0;
+}
+
+inline int aeron_int64_to_ptr_swiss_map_init(
+    aeron_int64_to_ptr_swiss_map_t *map, size_t initial_capacity, float load_factor)
+{
+    size_t capacity = (size_t)aeron_find_next_power_of_two((int32_t)initial_capacity);
+
+    if (capacity < AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH)
+    {
+        capacity = AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH;
+    }
+
+    map->load_factor = load_factor;
+    map->resize_threshold = (size_t)(load_factor * capacity);
+    map->ctrl = NULL;
+    map->keys = NULL;
+    map->values = NULL;
+    map->capacity = capacity;
+    map->size = 0;
+    map->tombstones = 0;
+
+    return aeron_int64_to_ptr_swiss_map_alloc(capacity, &map->ctrl, &map->keys, &map->values);
+}
+
+inline void aeron_int64_to_ptr_swiss_map_delete(aeron_int64_to_ptr_swiss_map_t *map)
+{
+    if (NULL != map->ctrl)
+    {
+        aeron_free(map->ctrl);
+    }
+
+    if (NULL != map->keys)
+    {
+        aeron_free(map->keys);
+    }
+
+    if (NULL != map->values)
+    {
+        aeron_free(map->values);
+    }
+}
+
+/* slot holding key, or -1 */
+inline int64_t aeron_int64_to_ptr_swiss_map_find(aeron_int64_to_ptr_swiss_map_t *map, const int64_t key)
+{
+    const uint64_t hash = aeron_int64_to_ptr_swiss_map_hash_key(key);
+    const int8_t h2 = (int8_t)(hash & 0x7F);
+    const size_t group_mask = (map->capacity / AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH) - 1;
+    size_t group_index = (size_t)(hash >> 7) & group_mask;
+
+    for (size_t probe = 1; probe <= group_mask + 1; probe++)
+    {
+        const size_t base = group_index * AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH;
+        const int8_t *group = map->ctrl + base;
+        uint32_t match = aeron_int64_to_ptr_swiss_map_group_match(group, h2);
+
+        while (0 != match)
+        {
+            const size_t index = base + (size_t)aeron_number_of_trailing_zeroes((int32_t)match);
+
+            if (key == map->keys[index])
+            {
+                return (int64_t)index;
+            }
+
+            match &= match - 1;
+        }
+
+        if (0 != aeron_int64_to_ptr_swiss_map_group_match(group, AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY))
+        {
+            break;
+        }
+
+        group_index = (group_index + probe) & group_mask;
+    }
+
+    return -1;
+}
+
+/* first EMPTY or DELETED slot on the probe sequence of hash, there is always one as the load factor is below 1 */
+inline size_t aeron_int64_to_ptr_swiss_map_find_free(
+    const int8_t *ctrl, size_t capacity, const uint64_t hash)
+{
+    const size_t group_mask = (capacity / AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH) - 1;
+    size_t group_index = (size_t)(hash >> 7) & group_mask;
+    size_t probe = 1;
+    uint32_t match;
+
+    while (0 == (match = aeron_int64_to_ptr_swiss_map_group_match_free(
+        ctrl + (group_index * AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH))))
+    {
+        group_index = (group_index + probe) & group_mask;
+        probe++;
+    }
+
+    return (group_index * AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH) +
+        (size_t)aeron_number_of_trailing_zeroes((int32_t)match);
+}
+
+inline int aeron_int64_to_ptr_swiss_map_rehash(aeron_int64_to_ptr_swiss_map_t *map, size_t new_capacity)
+{
+    int8_t *tmp_ctrl;
+    int64_t *tmp_keys;
+    void **tmp_values;
+
+    if (aeron_int64_to_ptr_swiss_map_alloc(new_capacity, &tmp_ctrl, &tmp_keys, &tmp_values) < 0)
+    {
+        return -1;
+    }
+
+    for (size_t i = 0, size = map->capacity; i < size; i++)
+    {
+        if (map->ctrl[i] >= 0)
+        {
+            const int64_t key = map->keys[i];
+            const uint64_t hash = aeron_int64_to_ptr_swiss_map_hash_key(key);
+            const size_t index = aeron_int64_to_ptr_swiss_map_find_free(tmp_ctrl, new_capacity, hash);
+
+            tmp_ctrl[index] = (int8_t)(hash & 0x7F);
+            tmp_keys[index] = key;
+            tmp_values[index] = map->values[i];
+        }
+    }
+
+    aeron_free(map->ctrl);
+    aeron_free(map->keys);
+    aeron_free(map->values);
+
+    map->ctrl = tmp_ctrl;
+    map->keys = tmp_keys;
+    map->values = tmp_values;
+    map->capacity = new_capacity;
+    map->tombstones = 0;
+    map->resize_threshold = (size_t)(new_capacity * map->load_factor);
+
+    return 0;
+}
+
+inline int aeron_int64_to_ptr_swiss_map_put(aeron_int64_to_ptr_swiss_map_t *map, const int64_t key, void *value)
+{
+    if (NULL == value)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    const int64_t existing = aeron_int64_to_ptr_swiss_map_find(map, key);
+
+    if (existing >= 0)
+    {
+        map->values[existing] = value;
+        return 0;
+    }
+
+    if (map->size + map->tombstones >= map->resize_threshold)
+    {
+        /* reclaim tombstones in place while they are the bulk of the load, otherwise grow */
+        const size_t new_capacity = map->size >= (map->resize_threshold >> 1) ? map->capacity << 1 : map->capacity;
+
+        if (aeron_int64_to_ptr_swiss_map_rehash(map, new_capacity) < 0)
+        {
+            return -1;
+        }
+    }
+
+    const uint64_t hash = aeron_int64_to_ptr_swiss_map_hash_key(key);
+    const size_t index = aeron_int64_to_ptr_swiss_map_find_free(map->ctrl, map->capacity, hash);
+
+    if (AERON_INT64_TO_PTR_SWISS_MAP_CTRL_DELETED == map->ctrl[index])
+    {
+        map->tombstones--;
+    }
+
+    map->ctrl[index] = (int8_t)(hash & 0x7F);
+    map->keys[index] = key;
+    map->values[index] = value;
+    map->size++;
+
+    return 0;
+}
+
+inline void *aeron_int64_to_ptr_swiss_map_get(aeron_int64_to_ptr_swiss_map_t *map, const int64_t key)
+{
+    const int64_t index = aeron_int64_to_ptr_swiss_map_find(map, key);
+
+    return index >= 0 ? map->values[index] : NULL;
+}
+
+inline void *aeron_int64_to_ptr_swiss_map_remove(aeron_int64_to_ptr_swiss_map_t *map, int64_t key)
+{
+    const int64_t index = aeron_int64_to_ptr_swiss_map_find(map, key);
+
+    if (index < 0)
+    {
+        return NULL;
+    }
+
+    void *value = map->values[index];
+    const int8_t *group = map->ctrl + (index & ~(int64_t)(AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH - 1));
+
+    /* a group that still has an EMPTY slot always ends a probe, so the slot can go straight back to EMPTY */
+    if (0 != aeron_int64_to_ptr_swiss_map_group_match(group, AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY))
+    {
+        map->ctrl[index] = AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY;
+    }
+    else
+    {
+        map->ctrl[index] = AERON_INT64_TO_PTR_SWISS_MAP_CTRL_DELETED;
+        map->tombstones++;
+    }
+
+    map->values[index] = NULL;
+    map->size--;
+
+    return value;
+}
+
+typedef void (*aeron_int64_to_ptr_swiss_map_for_each_func_t)(void *clientd, int64_t key, void *value);
+
+inline void aeron_int64_to_ptr_swiss_map_for_each(
+    aeron_int64_to_ptr_swiss_map_t *map, aeron_int64_to_ptr_swiss_map_for_each_func_t func, void *clientd)
+{
+    for (size_t i = 0; i < map->capacity; i++)
+    {
+        if (map->ctrl[i] >= 0)
+        {
+            func(clientd, map->keys[i], map->values[i]);
+        }
+    }
+}
+
+#endif //AERON_AERON_INT64_TO_PTR_SWISS_MAP_H
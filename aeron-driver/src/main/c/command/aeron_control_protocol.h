@@ -41,6 +41,7 @@
 #define AERON_RESPONSE_ON_SUBSCRIPTION_READY (0x0F07)
 #define AERON_RESPONSE_ON_COUNTER_READY (0x0F08)
 #define AERON_RESPONSE_ON_UNAVAILABLE_COUNTER (0x0F09)
+#define AERON_RESPONSE_ON_AVAILABLE_IMAGES (0x0F0A)
 
 /* error codes */
 #define AERON_ERROR_CODE_GENERIC_ERROR (0)
@@ -108,6 +109,23 @@ typedef struct aeron_image_buffers_ready_stct
 }
 aeron_image_buffers_ready_t;
 
+/* followed by subscriber_count subscribers then the log file name and source identity as for a single image */
+typedef struct aeron_image_buffers_ready_batch_stct
+{
+    int64_t correlation_id;
+    int32_t session_id;
+    int32_t stream_id;
+    int32_t subscriber_count;
+}
+aeron_image_buffers_ready_batch_t;
+
+typedef struct aeron_image_buffers_ready_subscriber_stct
+{
+    int64_t subscriber_registration_id;
+    int32_t subscriber_position_id;
+}
+aeron_image_buffers_ready_subscriber_t;
+
 typedef struct aeron_operation_succeeded_stct
 {
     int64_t correlation_id;
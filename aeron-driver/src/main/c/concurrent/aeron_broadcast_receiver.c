@@ -0,0 +1,150 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include "concurrent/aeron_broadcast_receiver.h"
+#include "util/aeron_error.h"
+#include "aeron_alloc.h"
+
+int aeron_broadcast_receiver_init(volatile aeron_broadcast_receiver_t *receiver, void *buffer, size_t length)
+{
+    const size_t capacity = length - AERON_BROADCAST_BUFFER_TRAILER_LENGTH;
+    int result = -1;
+
+    if (AERON_BROADCAST_IS_CAPACITY_VALID(capacity))
+    {
+        receiver->buffer = buffer;
+        receiver->capacity = capacity;
+        receiver->mask = capacity - 1;
+        receiver->descriptor = (aeron_broadcast_descriptor_t *)(receiver->buffer + receiver->capacity);
+        receiver->scratch_buffer_length = AERON_BROADCAST_MAX_MESSAGE_LENGTH(capacity);
+
+        int64_t latest;
+        AERON_GET_VOLATILE(latest, receiver->descriptor->latest_counter);
+
+        receiver->cursor = latest;
+        receiver->next_record = latest;
+        receiver->record_offset = (size_t)latest & receiver->mask;
+        receiver->lapped_count = 0;
+
+        if (aeron_alloc((void **)&receiver->scratch_buffer, receiver->scratch_buffer_length) < 0)
+        {
+            return -1;
+        }
+
+        result = 0;
+    }
+    else
+    {
+        aeron_set_err(EINVAL, "%s:%d: %s", __FILE__, __LINE__, strerror(EINVAL));
+    }
+
+    return result;
+}
+
+void aeron_broadcast_receiver_close(aeron_broadcast_receiver_t *receiver)
+{
+    aeron_free(receiver->scratch_buffer);
+    receiver->scratch_buffer = NULL;
+}
+
+bool aeron_broadcast_receiver_receive_next(volatile aeron_broadcast_receiver_t *receiver)
+{
+    bool is_available = false;
+    int64_t tail;
+    int64_t cursor = receiver->next_record;
+
+    AERON_GET_VOLATILE(tail, receiver->descriptor->tail_counter);
+
+    if (tail > cursor)
+    {
+        size_t record_offset = (size_t)cursor & receiver->mask;
+
+        if (!aeron_broadcast_receiver_validate_at(receiver, cursor))
+        {
+            receiver->lapped_count++;
+            cursor = receiver->descriptor->latest_counter;
+            record_offset = (size_t)cursor & receiver->mask;
+        }
+
+        aeron_broadcast_record_descriptor_t *record =
+            (aeron_broadcast_record_descriptor_t *)(receiver->buffer + record_offset);
+
+        receiver->cursor = cursor;
+        receiver->next_record = cursor + AERON_ALIGN(record->length, AERON_BROADCAST_RECORD_ALIGNMENT);
+
+        if (AERON_BROADCAST_PADDING_MSG_TYPE_ID == record->msg_type_id)
+        {
+            record_offset = 0;
+            record = (aeron_broadcast_record_descriptor_t *)receiver->buffer;
+            receiver->cursor = receiver->next_record;
+            receiver->next_record += AERON_ALIGN(record->length, AERON_BROADCAST_RECORD_ALIGNMENT);
+        }
+
+        receiver->record_offset = record_offset;
+        is_available = true;
+    }
+
+    return is_available;
+}
+
+int aeron_broadcast_receiver_receive(
+    volatile aeron_broadcast_receiver_t *receiver, aeron_broadcast_receiver_handler_t handler, void *clientd)
+{
+    int messages_received = 0;
+    const int64_t last_seen_lapped_count = receiver->lapped_count;
+
+    while (aeron_broadcast_receiver_receive_next(receiver))
+    {
+        if (last_seen_lapped_count != receiver->lapped_count)
+        {
+            aeron_set_err(EINVAL, "%s", "unable to keep up with broadcast");
+            return -1;
+        }
+
+        aeron_broadcast_record_descriptor_t *record = aeron_broadcast_receiver_record(receiver);
+        const int32_t msg_type_id = record->msg_type_id;
+        const size_t length = (size_t)record->length - AERON_BROADCAST_RECORD_HEADER_LENGTH;
+
+        if (length > receiver->scratch_buffer_length)
+        {
+            aeron_set_err(EINVAL, "scratch buffer too small for broadcast record: %d", (int)length);
+            return -1;
+        }
+
+        memcpy(
+            receiver->scratch_buffer,
+            receiver->buffer + receiver->record_offset + AERON_BROADCAST_RECORD_HEADER_LENGTH,
+            length);
+
+        if (!aeron_broadcast_receiver_validate(receiver))
+        {
+            aeron_set_err(EINVAL, "%s", "unable to keep up with broadcast");
+            return -1;
+        }
+
+        handler(msg_type_id, receiver->scratch_buffer, length, clientd);
+        messages_received++;
+    }
+
+    return messages_received;
+}
+
+extern bool aeron_broadcast_receiver_validate_at(volatile aeron_broadcast_receiver_t *receiver, int64_t cursor);
+extern bool aeron_broadcast_receiver_validate(volatile aeron_broadcast_receiver_t *receiver);
+extern aeron_broadcast_record_descriptor_t *aeron_broadcast_receiver_record(
+    volatile aeron_broadcast_receiver_t *receiver);
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_BROADCAST_RECEIVER_H
+#define AERON_AERON_BROADCAST_RECEIVER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_broadcast_transmitter.h"
+
+typedef struct aeron_broadcast_receiver_stct
+{
+    uint8_t *buffer;
+    aeron_broadcast_descriptor_t *descriptor;
+    size_t capacity;
+    size_t mask;
+
+    size_t record_offset;
+    int64_t cursor;
+    int64_t next_record;
+    int64_t lapped_count;
+
+    uint8_t *scratch_buffer;
+    size_t scratch_buffer_length;
+}
+aeron_broadcast_receiver_t;
+
+typedef void (*aeron_broadcast_receiver_handler_t)(int32_t, uint8_t *, size_t, void *);
+
+/*
+ * The receiver only ever reads the buffer, so any number of receivers can follow one transmitter. Records are copied
+ * into a scratch buffer before being handed on so a handler never sees a record the transmitter is overwriting.
+ */
+int aeron_broadcast_receiver_init(volatile aeron_broadcast_receiver_t *receiver, void *buffer, size_t length);
+
+void aeron_broadcast_receiver_close(aeron_broadcast_receiver_t *receiver);
+
+bool aeron_broadcast_receiver_receive_next(volatile aeron_broadcast_receiver_t *receiver);
+
+/*
+ * Copy out the records available since the last call and hand each to the handler. A receiver that has been lapped
+ * by the transmitter skips ahead to the latest record and -1 is returned, otherwise the number of records handled.
+ */
+int aeron_broadcast_receiver_receive(
+    volatile aeron_broadcast_receiver_t *receiver, aeron_broadcast_receiver_handler_t handler, void *clientd);
+
+inline bool aeron_broadcast_receiver_validate_at(volatile aeron_broadcast_receiver_t *receiver, int64_t cursor)
+{
+    int64_t tail_intent_counter;
+
+    AERON_GET_VOLATILE(tail_intent_counter, receiver->descriptor->tail_intent_counter);
+
+    return (cursor + (int64_t)receiver->capacity) > tail_intent_counter;
+}
+
+inline bool aeron_broadcast_receiver_validate(volatile aeron_broadcast_receiver_t *receiver)
+{
+    aeron_acquire();
+
+    return aeron_broadcast_receiver_validate_at(receiver, receiver->cursor);
+}
+
+inline aeron_broadcast_record_descriptor_t *aeron_broadcast_receiver_record(
+    volatile aeron_broadcast_receiver_t *receiver)
+{
+    return (aeron_broadcast_record_descriptor_t *)(receiver->buffer + receiver->record_offset);
+}
+
+#endif //AERON_AERON_BROADCAST_RECEIVER_H
@@ -15,4 +15,7 @@ aeron_queue_offer_result_t;
 
 typedef void (*aeron_queue_drain_func_t)(void *clientd, volatile void *item);
 
+/* number of slots taken per head update when draining, the head is published before the items are processed */
+#define AERON_QUEUE_DRAIN_BATCH_LENGTH (64)
+
 #endif //AERON_AERON_CONCURRENT_ARRAY_QUEUE_H
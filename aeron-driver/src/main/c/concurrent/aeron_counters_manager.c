@@ -18,6 +18,12 @@
 #include <math.h>
 #include <aeron_alloc.h>
 #include <errno.h>
+#include <limits.h>
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_atomic.h"
 #include "util/aeron_error.h"
@@ -59,16 +65,15 @@ void aeron_counters_manager_close(aeron_counters_manager_t *manager)
     aeron_free(manager->free_list);
 }
 
-int32_t aeron_counters_manager_allocate(
+static int32_t aeron_counters_manager_init_record(
     volatile aeron_counters_manager_t *manager,
+    int32_t counter_id,
     int32_t type_id,
     const uint8_t *key,
     size_t key_length,
     const char *label,
     size_t label_length)
 {
-    const int32_t counter_id = aeron_counters_manager_next_counter_id(manager);
-
     if ((counter_id * AERON_COUNTERS_MANAGER_VALUE_LENGTH) + AERON_COUNTERS_MANAGER_VALUE_LENGTH > manager->values_length)
     {
         aeron_set_err(EINVAL, "%s:%d: %s", __FILE__, __LINE__, strerror(EINVAL));
@@ -86,6 +91,7 @@ int32_t aeron_counters_manager_allocate(
 
     metadata->type_id = type_id;
     metadata->free_to_reuse_deadline = AERON_COUNTER_NOT_FREE_TO_REUSE;
+    memset(metadata->key, 0, sizeof(metadata->key));
 
     if (NULL != key && key_length > 0)
     {
@@ -99,6 +105,34 @@ int32_t aeron_counters_manager_allocate(
     return counter_id;
 }
 
+int32_t aeron_counters_manager_allocate(
+    volatile aeron_counters_manager_t *manager,
+    int32_t type_id,
+    const uint8_t *key,
+    size_t key_length,
+    const char *label,
+    size_t label_length)
+{
+    const int32_t counter_id = aeron_counters_manager_next_counter_id(manager);
+
+    return aeron_counters_manager_init_record(manager, counter_id, type_id, key, key_length, label, label_length);
+}
+
+int32_t aeron_counters_manager_allocate_concurrent(
+    volatile aeron_counters_manager_t *manager,
+    int32_t type_id,
+    const uint8_t *key,
+    size_t key_length,
+    const char *label,
+    size_t label_length)
+{
+    int32_t counter_id = 0;
+
+    AERON_GET_AND_ADD_INT32(counter_id, manager->id_high_water_mark, 1);
+
+    return aeron_counters_manager_init_record(manager, counter_id + 1, type_id, key, key_length, label, label_length);
+}
+
 void aeron_counters_manager_remove_free_list_index(volatile aeron_counters_manager_t *manager, int index)
 {
     for (int i = index; i < manager->free_list_index; i++)
@@ -132,7 +166,10 @@ int32_t aeron_counters_manager_next_counter_id(volatile aeron_counters_manager_t
         }
     }
 
-    return ++manager->id_high_water_mark;
+    int32_t counter_id = 0;
+    AERON_GET_AND_ADD_INT32(counter_id, manager->id_high_water_mark, 1);
+
+    return counter_id + 1;
 }
 
 int aeron_counters_manager_free(volatile aeron_counters_manager_t *manager, int32_t counter_id)
@@ -187,6 +224,156 @@ void aeron_counters_reader_foreach(
     }
 }
 
+size_t aeron_counters_snapshot_buffer_length(size_t capacity, bool with_labels)
+{
+    size_t length = capacity * ((2 * sizeof(int64_t)) + (2 * sizeof(int32_t)));
+
+    if (with_labels)
+    {
+        length += capacity * (sizeof(int32_t) + AERON_COUNTERS_SNAPSHOT_LABEL_LENGTH);
+    }
+
+    return length;
+}
+
+int aeron_counters_snapshot_init(
+    aeron_counters_snapshot_t *snapshot, uint8_t *buffer, size_t length, size_t capacity, bool with_labels)
+{
+    if (NULL == snapshot || NULL == buffer || length < aeron_counters_snapshot_buffer_length(capacity, with_labels))
+    {
+        aeron_set_err(EINVAL, "%s", "counters snapshot buffer too small for capacity");
+        return -1;
+    }
+
+    /* widest columns first so every column stays naturally aligned */
+    snapshot->values = (int64_t *)buffer;
+    snapshot->rates = (double *)(buffer + (capacity * sizeof(int64_t)));
+    snapshot->counter_ids = (int32_t *)(buffer + (capacity * 2 * sizeof(int64_t)));
+    snapshot->type_ids = snapshot->counter_ids + capacity;
+
+    if (with_labels)
+    {
+        snapshot->label_lengths = snapshot->type_ids + capacity;
+        snapshot->labels = (char *)(snapshot->label_lengths + capacity);
+    }
+    else
+    {
+        snapshot->label_lengths = NULL;
+        snapshot->labels = NULL;
+    }
+
+    snapshot->capacity = capacity;
+    snapshot->length = 0;
+    snapshot->timestamp_ns = 0;
+
+    return 0;
+}
+
+size_t aeron_counters_snapshot_take(
+    aeron_counters_snapshot_t *snapshot,
+    const uint8_t *metadata_buffer,
+    size_t metadata_length,
+    const uint8_t *values_buffer,
+    size_t values_length,
+    int64_t timestamp_ns)
+{
+    const size_t max_counters = AERON_MIN(
+        metadata_length / AERON_COUNTERS_MANAGER_METADATA_LENGTH, values_length / AERON_COUNTERS_MANAGER_VALUE_LENGTH);
+    size_t length = 0;
+
+    for (size_t id = 0; id < max_counters && length < snapshot->capacity; id++)
+    {
+        aeron_counter_metadata_descriptor_t *record =
+            (aeron_counter_metadata_descriptor_t *)(metadata_buffer + (id * AERON_COUNTERS_MANAGER_METADATA_LENGTH));
+        aeron_counter_value_descriptor_t *value =
+            (aeron_counter_value_descriptor_t *)(values_buffer + AERON_COUNTER_OFFSET(id));
+        int32_t record_state;
+
+        AERON_GET_VOLATILE(record_state, record->state);
+
+        if (AERON_COUNTER_RECORD_UNUSED == record_state)
+        {
+            break;
+        }
+        else if (AERON_COUNTER_RECORD_ALLOCATED != record_state)
+        {
+            continue;
+        }
+
+        snapshot->counter_ids[length] = (int32_t)id;
+        snapshot->type_ids[length] = record->type_id;
+        AERON_GET_VOLATILE(snapshot->values[length], value->counter_value);
+        snapshot->rates[length] = 0.0;
+
+        if (NULL != snapshot->labels)
+        {
+            int32_t label_length = record->label_length;
+
+            label_length = label_length < 0 ? 0 : label_length;
+            label_length = label_length > (int32_t)AERON_COUNTERS_SNAPSHOT_LABEL_LENGTH ?
+                (int32_t)AERON_COUNTERS_SNAPSHOT_LABEL_LENGTH : label_length;
+            snapshot->label_lengths[length] = label_length;
+            memcpy(snapshot->labels + (length * AERON_COUNTERS_SNAPSHOT_LABEL_LENGTH), record->label, (size_t)label_length);
+        }
+
+        AERON_GET_VOLATILE(record_state, record->state);
+
+        if (AERON_COUNTER_RECORD_ALLOCATED == record_state)
+        {
+            length++;
+        }
+    }
+
+    snapshot->length = length;
+    snapshot->timestamp_ns = timestamp_ns;
+
+    return length;
+}
+
+void aeron_counters_snapshot_compute_rates(
+    aeron_counters_snapshot_t *current, const aeron_counters_snapshot_t *previous)
+{
+    const int64_t interval_ns = current->timestamp_ns - previous->timestamp_ns;
+    size_t j = 0;
+
+    for (size_t i = 0; i < current->length; i++)
+    {
+        const int32_t counter_id = current->counter_ids[i];
+
+        while (j < previous->length && previous->counter_ids[j] < counter_id)
+        {
+            j++;
+        }
+
+        if (interval_ns > 0 &&
+            j < previous->length &&
+            previous->counter_ids[j] == counter_id &&
+            previous->type_ids[j] == current->type_ids[i])
+        {
+            current->rates[i] = ((double)(current->values[i] - previous->values[j]) * 1000000000.0) / (double)interval_ns;
+        }
+        else
+        {
+            current->rates[i] = 0.0;
+        }
+    }
+}
+
+void aeron_counter_wake_waiters(volatile int64_t *addr)
+{
+    volatile int32_t *sequence = (volatile int32_t *)((volatile uint8_t *)addr + AERON_COUNTER_WAKE_SEQUENCE_OFFSET);
+    int32_t original;
+
+    AERON_GET_AND_ADD_INT32(original, *sequence, 1);
+
+#if defined(__linux__)
+    /* not FUTEX_PRIVATE, the waiters are in client processes mapping the same CnC file */
+    syscall(SYS_futex, sequence, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+}
+
+extern void aeron_counter_signal_waiters(volatile int64_t *addr);
+extern const char *aeron_counters_snapshot_label(aeron_counters_snapshot_t *snapshot, size_t index);
 extern int64_t *aeron_counter_addr(aeron_counters_manager_t *manager, int32_t counter_id);
 extern void aeron_counter_set_ordered(volatile int64_t *addr, int64_t value);
 extern int64_t aeron_counter_get(volatile int64_t *addr);
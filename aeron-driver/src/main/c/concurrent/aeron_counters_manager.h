@@ -19,9 +19,14 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include "util/aeron_bitutil.h"
 #include "aeron_atomic.h"
 
+/*
+ * Each counter value owns a full pair of cache lines so values written by different agents never share a line or an
+ * adjacent-line prefetch pair, regardless of which agent allocated them. No placement hints are needed.
+ */
 #pragma pack(push)
 #pragma pack(4)
 typedef struct aeron_counter_value_descriptor_stct
@@ -92,6 +97,19 @@ int32_t aeron_counters_manager_allocate(
     const char *label,
     size_t label_length);
 
+/*
+ * Allocate a counter from a thread other than the conductor, e.g. the sender or receiver. Only ids above the high
+ * water mark are handed out, with a single atomic increment, so the free list stays owned by the conductor and
+ * counters allocated this way must be freed by the conductor.
+ */
+int32_t aeron_counters_manager_allocate_concurrent(
+    volatile aeron_counters_manager_t *manager,
+    int32_t type_id,
+    const uint8_t *key,
+    size_t key_length,
+    const char *label,
+    size_t label_length);
+
 int32_t aeron_counters_manager_next_counter_id(volatile aeron_counters_manager_t *manager);
 
 int aeron_counters_manager_free(volatile aeron_counters_manager_t *manager, int32_t counter_id);
@@ -105,6 +123,57 @@ void aeron_counters_reader_foreach(
     aeron_counters_reader_foreach_func_t func,
     void *clientd);
 
+#define AERON_COUNTERS_SNAPSHOT_LABEL_LENGTH (sizeof(((aeron_counter_metadata_descriptor_t *)0)->label))
+
+/*
+ * Columnar copy of the allocated counters, in counter id order, carved out of a caller provided buffer. Each counter
+ * is consistent with its own metadata: the record state is re-read after the value so a counter freed during the copy
+ * is left out. Reuse of a freed id is held back by the free to reuse timeout so it cannot be mistaken for the old
+ * counter. Counters are not captured at a single instant relative to each other.
+ */
+typedef struct aeron_counters_snapshot_stct
+{
+    int32_t *counter_ids;
+    int32_t *type_ids;
+    int64_t *values;
+    double *rates;
+    int32_t *label_lengths;
+    char *labels;
+    size_t capacity;
+    size_t length;
+    int64_t timestamp_ns;
+}
+aeron_counters_snapshot_t;
+
+size_t aeron_counters_snapshot_buffer_length(size_t capacity, bool with_labels);
+
+int aeron_counters_snapshot_init(
+    aeron_counters_snapshot_t *snapshot, uint8_t *buffer, size_t length, size_t capacity, bool with_labels);
+
+/*
+ * Copy the allocated counters into the snapshot without writing to the counters buffers. Returns the number of
+ * counters captured, at most the capacity of the snapshot.
+ */
+size_t aeron_counters_snapshot_take(
+    aeron_counters_snapshot_t *snapshot,
+    const uint8_t *metadata_buffer,
+    size_t metadata_length,
+    const uint8_t *values_buffer,
+    size_t values_length,
+    int64_t timestamp_ns);
+
+/*
+ * Fill the rates column of current with the change per second of each counter since previous. Counters not in
+ * previous, or whose type changed, get a rate of 0.
+ */
+void aeron_counters_snapshot_compute_rates(
+    aeron_counters_snapshot_t *current, const aeron_counters_snapshot_t *previous);
+
+inline const char *aeron_counters_snapshot_label(aeron_counters_snapshot_t *snapshot, size_t index)
+{
+    return NULL == snapshot->labels ? NULL : snapshot->labels + (index * AERON_COUNTERS_SNAPSHOT_LABEL_LENGTH);
+}
+
 #define AERON_COUNTER_OFFSET(id) ((id) * AERON_COUNTERS_MANAGER_VALUE_LENGTH)
 
 inline int64_t *aeron_counter_addr(aeron_counters_manager_t *manager, int32_t counter_id)
@@ -167,4 +236,30 @@ inline bool aeron_counter_propose_max_ordered(volatile int64_t *addr, int64_t pr
     return updated;
 }
 
+/*
+ * Threads that want to sleep until a counter advances, e.g. publishers waiting on their publication limit, park on a
+ * wake sequence held in the padding of the counter value slot and register in a waiter count next to it.
+ */
+#define AERON_COUNTER_WAITERS_OFFSET (sizeof(int64_t))
+#define AERON_COUNTER_WAKE_SEQUENCE_OFFSET (sizeof(int64_t) + sizeof(int32_t))
+
+void aeron_counter_wake_waiters(volatile int64_t *addr);
+
+/*
+ * Call after advancing a counter. The locked add orders the store of the value before the read of the waiter count so
+ * a waiter either sees the new value or is woken. Costs no system call when nothing is waiting.
+ */
+inline void aeron_counter_signal_waiters(volatile int64_t *addr)
+{
+    volatile int32_t *waiters = (volatile int32_t *)((volatile uint8_t *)addr + AERON_COUNTER_WAITERS_OFFSET);
+    int32_t waiter_count;
+
+    AERON_GET_AND_ADD_INT32(waiter_count, *waiters, 0);
+
+    if (waiter_count > 0)
+    {
+        aeron_counter_wake_waiters(addr);
+    }
+}
+
 #endif //AERON_AERON_COUNTERS_MANAGER_H
@@ -59,6 +59,8 @@ int aeron_distinct_error_log_init(
     log->next_offset = 0;
     log->observation_list->num_observations = 0;
     log->observation_list->observations = NULL;
+    log->site_record_interval = AERON_DISTINCT_ERROR_LOG_SITE_RECORD_INTERVAL_MS;
+    memset(log->sites, 0, sizeof(log->sites));
     pthread_mutex_init(&log->mutex, NULL);
 
     return 0;
@@ -74,6 +76,11 @@ void aeron_distinct_error_log_close(aeron_distinct_error_log_t *log)
     {
         aeron_free((void *)observations[i].description);
     }
+
+    for (size_t i = 0; i < AERON_DISTINCT_ERROR_LOG_SITE_CACHE_LENGTH; i++)
+    {
+        aeron_free(log->sites[i]);
+    }
     
     aeron_free(log->observation_list);
 }
@@ -165,22 +172,14 @@ static aeron_distinct_observation_t *aeron_distinct_error_log_new_observation(
     return observation;
 }
 
-int aeron_distinct_error_log_record(
-    aeron_distinct_error_log_t *log, int error_code, const char *description, const char *message)
+static aeron_distinct_observation_t *aeron_distinct_error_log_observation(
+    aeron_distinct_error_log_t *log, int64_t timestamp, int error_code, const char *description, const char *message)
 {
-    int64_t timestamp = 0;
     aeron_distinct_observation_t *observation = NULL;
-
-    if (NULL == log)
-    {
-        aeron_set_err(EINVAL, "%s", "invalid argument");
-        return -1;
-    }
-
-    timestamp = log->clock();
     aeron_distinct_error_log_observation_list_t *list = aeron_distinct_error_log_observation_list_load(log);
     size_t num_observations = list->num_observations;
     aeron_distinct_observation_t *observations = list->observations;
+
     if ((observation = aeron_distinct_error_log_find_observation(
         observations, num_observations, error_code, description)) == NULL)
     {
@@ -198,16 +197,118 @@ int aeron_distinct_error_log_record(
             aeron_format_date(buffer, sizeof(buffer), timestamp);
             fprintf(stderr, "%s - unrecordable error %d: %s %s\n", buffer, error_code, description, message);
             errno = ENOMEM;
-            return -1;
         }
     }
 
-    aeron_error_log_entry_t *entry = (aeron_error_log_entry_t *)(log->buffer + observation->offset);
+    return observation;
+}
+
+static void aeron_distinct_error_log_observe(aeron_distinct_error_log_t *log, size_t offset, int64_t timestamp)
+{
+    aeron_error_log_entry_t *entry = (aeron_error_log_entry_t *)(log->buffer + offset);
 
     int32_t dest;
 
     AERON_GET_AND_ADD_INT32(dest, entry->observation_count, 1);
     AERON_PUT_ORDERED(entry->last_observation_timestamp, timestamp);
+}
+
+int aeron_distinct_error_log_record(
+    aeron_distinct_error_log_t *log, int error_code, const char *description, const char *message)
+{
+    int64_t timestamp = 0;
+    aeron_distinct_observation_t *observation = NULL;
+
+    if (NULL == log)
+    {
+        aeron_set_err(EINVAL, "%s", "invalid argument");
+        return -1;
+    }
+
+    timestamp = log->clock();
+    if ((observation = aeron_distinct_error_log_observation(log, timestamp, error_code, description, message)) == NULL)
+    {
+        return -1;
+    }
+
+    aeron_distinct_error_log_observe(log, observation->offset, timestamp);
+
+    return 0;
+}
+
+bool aeron_distinct_error_log_try_record_at_site(aeron_distinct_error_log_t *log, int error_code, const void *site)
+{
+    aeron_distinct_error_log_site_t *cached_site;
+
+    if (NULL == log)
+    {
+        return false;
+    }
+
+    AERON_GET_VOLATILE(cached_site, log->sites[aeron_distinct_error_log_site_index(error_code, site)]);
+
+    if (NULL == cached_site || cached_site->site != site || cached_site->error_code != error_code)
+    {
+        return false;
+    }
+
+    int64_t timestamp = log->clock();
+    if (timestamp >= cached_site->next_record_timestamp)
+    {
+        return false;
+    }
+
+    aeron_distinct_error_log_observe(log, cached_site->offset, timestamp);
+
+    return true;
+}
+
+int aeron_distinct_error_log_record_at_site(
+    aeron_distinct_error_log_t *log,
+    int error_code,
+    const void *site,
+    const char *description,
+    const char *message)
+{
+    int64_t timestamp = 0;
+    aeron_distinct_observation_t *observation = NULL;
+    aeron_distinct_error_log_site_t *new_site = NULL;
+
+    if (NULL == log)
+    {
+        aeron_set_err(EINVAL, "%s", "invalid argument");
+        return -1;
+    }
+
+    timestamp = log->clock();
+    if ((observation = aeron_distinct_error_log_observation(log, timestamp, error_code, description, message)) == NULL)
+    {
+        return -1;
+    }
+
+    aeron_distinct_error_log_observe(log, observation->offset, timestamp);
+
+    if (aeron_alloc((void **)&new_site, sizeof(aeron_distinct_error_log_site_t)) >= 0)
+    {
+        size_t index = aeron_distinct_error_log_site_index(error_code, site);
+
+        new_site->site = site;
+        new_site->error_code = error_code;
+        new_site->offset = observation->offset;
+        new_site->next_record_timestamp = timestamp + log->site_record_interval;
+
+        pthread_mutex_lock(&log->mutex);
+
+        aeron_distinct_error_log_site_t *old_site = log->sites[index];
+        AERON_PUT_ORDERED(log->sites[index], new_site);
+
+        pthread_mutex_unlock(&log->mutex);
+
+        if (NULL != old_site && NULL != log->linger_resource)
+        {
+            log->linger_resource(log->linger_resource_clientd, (uint8_t *)old_site);
+        }
+    }
 
     return 0;
 }
@@ -271,6 +372,7 @@ size_t aeron_distinct_error_log_num_observations(aeron_distinct_error_log_t *log
     return list->num_observations;
 }
 
+extern size_t aeron_distinct_error_log_site_index(int error_code, const void *site);
 extern int aeron_distinct_error_log_observation_list_alloc(
     aeron_distinct_error_log_observation_list_t **list, uint64_t num_observations);
 extern aeron_distinct_error_log_observation_list_t *aeron_distinct_error_log_observation_list_load(
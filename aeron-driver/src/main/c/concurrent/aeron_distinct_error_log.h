@@ -59,6 +59,23 @@ typedef struct aeron_distinct_error_log_observation_list_stct
 }
 aeron_distinct_error_log_observation_list_t;
 
+#define AERON_DISTINCT_ERROR_LOG_SITE_CACHE_LENGTH (64)
+#define AERON_DISTINCT_ERROR_LOG_SITE_RECORD_INTERVAL_MS (1000)
+
+/*
+ * Most recent observation recorded for an (error code, site) pair. Immutable once published, it is replaced rather
+ * than updated so readers need no lock. Until next_record_timestamp the site is rate limited and repeats only bump the
+ * observation count of the entry at offset.
+ */
+typedef struct aeron_distinct_error_log_site_stct
+{
+    const void *site;
+    int error_code;
+    size_t offset;
+    int64_t next_record_timestamp;
+}
+aeron_distinct_error_log_site_t;
+
 typedef struct aeron_distinct_error_log_stct
 {
     uint8_t *buffer;
@@ -69,6 +86,8 @@ typedef struct aeron_distinct_error_log_stct
     aeron_resource_linger_func_t linger_resource;
     void *linger_resource_clientd;
     pthread_mutex_t mutex;
+    int64_t site_record_interval;
+    aeron_distinct_error_log_site_t *sites[AERON_DISTINCT_ERROR_LOG_SITE_CACHE_LENGTH];
 }
 aeron_distinct_error_log_t;
 
@@ -85,6 +104,23 @@ void aeron_distinct_error_log_close(aeron_distinct_error_log_t *log);
 int aeron_distinct_error_log_record(
     aeron_distinct_error_log_t *log, int error_code, const char *description, const char *message);
 
+/*
+ * Hot path for errors that can repeat per packet. site identifies the call site, e.g. its format string literal.
+ * Returns true when the error has been counted against the observation last recorded for (error_code, site) within
+ * the rate limit interval, so the caller need not format a message or call aeron_distinct_error_log_record_at_site.
+ */
+bool aeron_distinct_error_log_try_record_at_site(aeron_distinct_error_log_t *log, int error_code, const void *site);
+
+/*
+ * Record as aeron_distinct_error_log_record does and rate limit further errors from (error_code, site).
+ */
+int aeron_distinct_error_log_record_at_site(
+    aeron_distinct_error_log_t *log,
+    int error_code,
+    const void *site,
+    const char *description,
+    const char *message);
+
 typedef void (*aeron_error_log_reader_func_t)(
     int32_t observation_count,
     int64_t first_observation_timestamp,
@@ -104,6 +140,14 @@ size_t aeron_error_log_read(
 
 size_t aeron_distinct_error_log_num_observations(aeron_distinct_error_log_t *log);
 
+inline size_t aeron_distinct_error_log_site_index(int error_code, const void *site)
+{
+    uint64_t hash = ((uint64_t)(uintptr_t)site * 31) ^ (uint64_t)(uint32_t)error_code;
+    hash = (uint32_t)hash ^ (uint32_t)(hash >> 32);
+
+    return (size_t)hash & (AERON_DISTINCT_ERROR_LOG_SITE_CACHE_LENGTH - 1);
+}
+
 inline int aeron_distinct_error_log_observation_list_alloc(
     aeron_distinct_error_log_observation_list_t **list, uint64_t num_observations)
 {
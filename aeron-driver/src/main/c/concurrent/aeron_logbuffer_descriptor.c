@@ -16,6 +16,12 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#if defined(__linux__)
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
 #include "util/aeron_error.h"
 #include "concurrent/aeron_logbuffer_descriptor.h"
 
@@ -51,7 +57,20 @@ int aeron_logbuffer_check_term_length(uint64_t term_length)
     return 0;
 }
 
+void aeron_logbuffer_wake_subscribers(aeron_logbuffer_metadata_t *log_meta_data)
+{
+    int32_t original;
+
+    AERON_GET_AND_ADD_INT32(original, log_meta_data->subscriber_wake_sequence, 1);
+
+#if defined(__linux__)
+    /* not FUTEX_PRIVATE, the subscribers are in other processes mapping the same log */
+    syscall(SYS_futex, &log_meta_data->subscriber_wake_sequence, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+}
+
 extern uint64_t aeron_logbuffer_compute_log_length(uint64_t term_length, uint64_t page_size);
+extern int64_t aeron_logbuffer_max_window_length(int64_t term_length);
 extern int32_t aeron_logbuffer_term_offset(int64_t raw_tail, int32_t term_length);
 extern int32_t aeron_logbuffer_term_id(int64_t raw_tail);
 extern size_t aeron_logbuffer_index_by_position(int64_t position, size_t position_bits_to_shift);
@@ -76,3 +95,4 @@ extern bool aeron_logbuffer_rotate_log(
 extern void aeron_logbuffer_fill_default_header(
     uint8_t *log_meta_data_buffer, int32_t session_id, int32_t stream_id, int32_t initial_term_id);
 extern void aeron_logbuffer_apply_default_header(uint8_t *log_meta_data_buffer, uint8_t *buffer);
+extern void aeron_logbuffer_signal_subscribers(aeron_logbuffer_metadata_t *log_meta_data);
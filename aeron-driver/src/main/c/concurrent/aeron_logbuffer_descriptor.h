@@ -23,7 +23,18 @@
 #include "util/aeron_bitutil.h"
 #include "concurrent/aeron_atomic.h"
 
+/*
+ * Set for the whole build with the AERON_LOGBUFFER_PARTITION_COUNT CMake variable so driver and clients agree. More
+ * partitions allow a window of several terms, so small terms can still buffer deeply. Logs of any other count than 3
+ * have a different meta data layout and cannot be read by clients not built with the same count.
+ */
+#ifndef AERON_LOGBUFFER_PARTITION_COUNT
 #define AERON_LOGBUFFER_PARTITION_COUNT (3)
+#endif
+
+#if AERON_LOGBUFFER_PARTITION_COUNT < 3 || AERON_LOGBUFFER_PARTITION_COUNT > 16
+#error AERON_LOGBUFFER_PARTITION_COUNT must be from 3 to 16
+#endif
 #define AERON_LOGBUFFER_TERM_MIN_LENGTH (64 * 1024)
 #define AERON_LOGBUFFER_TERM_MAX_LENGTH (1024 * 1024 * 1024)
 #define AERON_PAGE_MIN_SIZE (4 * 1024)
@@ -32,16 +43,34 @@
 
 #define AERON_MAX_UDP_PAYLOAD_LENGTH (65504)
 
+#define AERON_LOGBUFFER_MAX_SUBSCRIBER_POSITIONS (16)
+
+#define AERON_LOGBUFFER_TAIL_SECTION_LENGTH \
+    ((AERON_LOGBUFFER_PARTITION_COUNT * sizeof(int64_t)) + (4 * sizeof(int32_t)))
+#define AERON_LOGBUFFER_TAIL_SECTION_PADDING \
+    ((2 * AERON_CACHE_LINE_LENGTH * ((AERON_LOGBUFFER_TAIL_SECTION_LENGTH / (2 * AERON_CACHE_LINE_LENGTH)) + 1)) - \
+    AERON_LOGBUFFER_TAIL_SECTION_LENGTH)
+
 #pragma pack(push)
 #pragma pack(4)
 typedef struct aeron_logbuffer_metadata_stct
 {
     int64_t term_tail_counters[AERON_LOGBUFFER_PARTITION_COUNT];
     int32_t active_term_count;
-    uint8_t pad1[(2 * AERON_CACHE_LINE_LENGTH) - ((AERON_LOGBUFFER_PARTITION_COUNT * sizeof(int64_t)) + sizeof(int32_t))];
+    /* beside the tails so a publisher checking for parked subscribers reads a line it has just written */
+    int32_t is_subscriber_wakeup;
+    int32_t subscriber_waiters;
+    int32_t subscriber_wake_sequence;
+    uint8_t pad1[AERON_LOGBUFFER_TAIL_SECTION_PADDING];
     int64_t end_of_stream_position;
     int32_t is_connected;
-    uint8_t pad2[(2 * AERON_CACHE_LINE_LENGTH) - (sizeof(int64_t) + sizeof(int32_t))];
+    int32_t subscriber_positions_change_number;
+    int64_t clean_limit;
+    int32_t publisher_window_length;
+    int32_t subscriber_position_count;
+    int32_t subscriber_position_ids[AERON_LOGBUFFER_MAX_SUBSCRIBER_POSITIONS];
+    uint8_t pad2[(2 * AERON_CACHE_LINE_LENGTH) -
+        ((2 * sizeof(int64_t)) + ((4 + AERON_LOGBUFFER_MAX_SUBSCRIBER_POSITIONS) * sizeof(int32_t)))];
     int64_t correlation_id;
     int32_t initial_term_id;
     int32_t default_frame_header_length;
@@ -76,6 +105,15 @@ inline uint64_t aeron_logbuffer_compute_log_length(uint64_t term_length, uint64_
     return AERON_ALIGN(((term_length * AERON_LOGBUFFER_PARTITION_COUNT) + AERON_LOGBUFFER_META_DATA_LENGTH), page_size);
 }
 
+/*
+ * How far a producer may run ahead of the slowest consumer of a stream. A term and a half behind the consumer is kept
+ * for retransmits and for the lag in cleaning, which leaves half a term with the usual 3 partitions.
+ */
+inline int64_t aeron_logbuffer_max_window_length(int64_t term_length)
+{
+    return ((AERON_LOGBUFFER_PARTITION_COUNT - 2) * term_length) - (term_length / 2);
+}
+
 inline int32_t aeron_logbuffer_term_offset(int64_t raw_tail, int32_t term_length)
 {
     int32_t offset = (int32_t)(raw_tail & 0xFFFFFFFFL);
@@ -189,4 +227,23 @@ inline void aeron_logbuffer_apply_default_header(uint8_t *log_meta_data_buffer,
     memcpy(buffer, default_header, (size_t)log_meta_data->default_frame_header_length);
 }
 
+void aeron_logbuffer_wake_subscribers(aeron_logbuffer_metadata_t *log_meta_data);
+
+/*
+ * Wake subscribers parked on the log after the tail has been advanced. The waiter count is read with a locked add so
+ * it is ordered after the tail update and a parked subscriber either sees the new tail or is woken. Costs no system
+ * call when nothing is waiting.
+ */
+inline void aeron_logbuffer_signal_subscribers(aeron_logbuffer_metadata_t *log_meta_data)
+{
+    int32_t waiter_count;
+
+    AERON_GET_AND_ADD_INT32(waiter_count, log_meta_data->subscriber_waiters, 0);
+
+    if (waiter_count > 0)
+    {
+        aeron_logbuffer_wake_subscribers(log_meta_data);
+    }
+}
+
 #endif //AERON_AERON_LOGBUFFER_DESCRIPTOR_H
@@ -94,27 +94,53 @@ inline uint64_t aeron_mpsc_concurrent_array_queue_drain(
     void *clientd,
     uint64_t limit)
 {
+    volatile void *batch[AERON_QUEUE_DRAIN_BATCH_LENGTH];
     uint64_t current_head;
     AERON_GET_VOLATILE(current_head, queue->consumer.head);
 
     uint64_t next_sequence = current_head;
-    const uint64_t limit_sequence = next_sequence + limit;
+    uint64_t remaining = limit;
 
-    while (next_sequence < limit_sequence)
+    while (remaining > 0)
     {
-        const uint64_t index = next_sequence & queue->mask;
-        volatile void *item;
-        AERON_GET_VOLATILE(item, queue->buffer[index]);
+        const uint64_t batch_limit = remaining < AERON_QUEUE_DRAIN_BATCH_LENGTH ?
+            remaining : AERON_QUEUE_DRAIN_BATCH_LENGTH;
+        uint64_t batch_length = 0;
 
-        if (NULL == item)
+        while (batch_length < batch_limit)
+        {
+            const uint64_t index = next_sequence & queue->mask;
+            volatile void *item;
+            AERON_GET_VOLATILE(item, queue->buffer[index]);
+
+            if (NULL == item)
+            {
+                break;
+            }
+
+            queue->buffer[index] = NULL;
+            batch[batch_length++] = item;
+            next_sequence++;
+        }
+
+        if (0 == batch_length)
         {
             break;
         }
 
-        AERON_PUT_ORDERED(queue->buffer[index], NULL);
-        next_sequence++;
         AERON_PUT_ORDERED(queue->consumer.head, next_sequence);
-        func(clientd, item);
+
+        for (uint64_t i = 0; i < batch_length; i++)
+        {
+            func(clientd, batch[i]);
+        }
+
+        if (batch_length < batch_limit)
+        {
+            break;
+        }
+
+        remaining -= batch_length;
     }
 
     return next_sequence - current_head;
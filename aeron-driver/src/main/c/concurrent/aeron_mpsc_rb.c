@@ -142,6 +142,78 @@ aeron_rb_write_result_t aeron_mpsc_rb_write(
     return result;
 }
 
+aeron_rb_write_result_t aeron_mpsc_rb_try_claim_batch(
+    volatile aeron_mpsc_rb_t *ring_buffer, aeron_mpsc_rb_batch_t *batch, size_t length)
+{
+    const size_t required_capacity = AERON_ALIGN(length, AERON_RB_ALIGNMENT);
+    int32_t index = 0;
+
+    if (0 == length || required_capacity > ring_buffer->max_message_length)
+    {
+        return AERON_RB_ERROR;
+    }
+
+    if (-1 == (index = aeron_mpsc_rb_claim_capacity(ring_buffer, required_capacity)))
+    {
+        return AERON_RB_FULL;
+    }
+
+    batch->ring_buffer = ring_buffer;
+    batch->index = (size_t)index;
+    batch->length = required_capacity;
+    batch->offset = 0;
+
+    return AERON_RB_SUCCESS;
+}
+
+aeron_rb_write_result_t aeron_mpsc_rb_batch_write(
+    aeron_mpsc_rb_batch_t *batch,
+    int32_t msg_type_id,
+    const void *msg,
+    size_t length)
+{
+    const size_t record_length = length + AERON_RB_RECORD_HEADER_LENGTH;
+    const size_t required_capacity = AERON_ALIGN(record_length, AERON_RB_ALIGNMENT);
+
+    if (AERON_RB_INVALID_MSG_TYPE_ID(msg_type_id))
+    {
+        return AERON_RB_ERROR;
+    }
+
+    if (required_capacity > (batch->length - batch->offset))
+    {
+        return AERON_RB_FULL;
+    }
+
+    const size_t record_index = batch->index + batch->offset;
+    uint8_t *buffer = batch->ring_buffer->buffer;
+    aeron_rb_record_descriptor_t *record_header = (aeron_rb_record_descriptor_t *)(buffer + record_index);
+
+    record_header->msg_type_id = msg_type_id;
+    AERON_PUT_ORDERED(record_header->length, -record_length);
+    memcpy(buffer + AERON_RB_MESSAGE_OFFSET(record_index), msg, length);
+    AERON_PUT_ORDERED(record_header->length, record_length);
+
+    batch->offset += required_capacity;
+
+    return AERON_RB_SUCCESS;
+}
+
+void aeron_mpsc_rb_batch_commit(aeron_mpsc_rb_batch_t *batch)
+{
+    const size_t remaining = batch->length - batch->offset;
+
+    if (0 != remaining)
+    {
+        aeron_rb_record_descriptor_t *record_header =
+            (aeron_rb_record_descriptor_t *)(batch->ring_buffer->buffer + batch->index + batch->offset);
+
+        record_header->msg_type_id = AERON_RB_PADDING_MSG_TYPE_ID;
+        AERON_PUT_ORDERED(record_header->length, remaining);
+        batch->offset = batch->length;
+    }
+}
+
 size_t aeron_mpsc_rb_read(
     volatile aeron_mpsc_rb_t *ring_buffer,
     aeron_rb_handler_t handler,
@@ -195,6 +267,45 @@ size_t aeron_mpsc_rb_read(
     return messages_read;
 }
 
+size_t aeron_mpsc_rb_read_block(
+    volatile aeron_mpsc_rb_t *ring_buffer,
+    aeron_rb_block_handler_t handler,
+    void *clientd,
+    size_t length_limit)
+{
+    const int64_t head = ring_buffer->descriptor->head_position;
+    const size_t head_index = (int32_t)head & (ring_buffer->capacity - 1);
+    const size_t to_buffer_end_length = ring_buffer->capacity - head_index;
+    const size_t block_limit = length_limit < to_buffer_end_length ? length_limit : to_buffer_end_length;
+    size_t block_length = 0;
+
+    while (block_length < block_limit)
+    {
+        aeron_rb_record_descriptor_t *header =
+            (aeron_rb_record_descriptor_t *)(ring_buffer->buffer + head_index + block_length);
+        int32_t record_length = 0;
+        AERON_GET_VOLATILE(record_length, header->length);
+
+        const size_t aligned_length = AERON_ALIGN(record_length, AERON_RB_ALIGNMENT);
+        if (record_length <= 0 || (block_length + aligned_length) > block_limit)
+        {
+            break;
+        }
+
+        block_length += aligned_length;
+    }
+
+    if (0 != block_length)
+    {
+        handler(ring_buffer->buffer + head_index, block_length, clientd);
+
+        memset(ring_buffer->buffer + head_index, 0, block_length);
+        AERON_PUT_ORDERED(ring_buffer->descriptor->head_position, head + block_length);
+    }
+
+    return block_length;
+}
+
 int64_t aeron_mpsc_rb_next_correlation_id(volatile aeron_mpsc_rb_t *ring_buffer)
 {
     int64_t result = 0;
@@ -296,5 +407,6 @@ bool aeron_mpsc_rb_unblock(volatile aeron_mpsc_rb_t *ring_buffer)
     return unblocked;
 }
 
+extern size_t aeron_mpsc_rb_batch_record_length(size_t length);
 extern int64_t aeron_mpsc_rb_consumer_position(volatile aeron_mpsc_rb_t *ring_buffer);
 extern int64_t aeron_mpsc_rb_producer_position(volatile aeron_mpsc_rb_t *ring_buffer);
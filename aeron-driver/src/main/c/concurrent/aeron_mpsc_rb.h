@@ -28,6 +28,17 @@ typedef struct aeron_mpsc_rb_stct
 }
 aeron_mpsc_rb_t;
 
+typedef struct aeron_mpsc_rb_batch_stct
+{
+    volatile aeron_mpsc_rb_t *ring_buffer;
+    size_t index;
+    size_t length;
+    size_t offset;
+}
+aeron_mpsc_rb_batch_t;
+
+typedef void (*aeron_rb_block_handler_t)(const uint8_t *, size_t, void *);
+
 int aeron_mpsc_rb_init(volatile aeron_mpsc_rb_t *ring_buffer, void *buffer, size_t length);
 
 aeron_rb_write_result_t aeron_mpsc_rb_write(
@@ -36,12 +47,38 @@ aeron_rb_write_result_t aeron_mpsc_rb_write(
     const void *msg,
     size_t length);
 
+/*
+ * Claim space for a batch of records with a single update of the tail. length is the sum of the aligned record
+ * lengths, see aeron_mpsc_rb_batch_record_length. Records are then added with aeron_mpsc_rb_batch_write and the
+ * batch must always be completed with aeron_mpsc_rb_batch_commit so unused space is padded out for the consumer.
+ */
+aeron_rb_write_result_t aeron_mpsc_rb_try_claim_batch(
+    volatile aeron_mpsc_rb_t *ring_buffer, aeron_mpsc_rb_batch_t *batch, size_t length);
+
+aeron_rb_write_result_t aeron_mpsc_rb_batch_write(
+    aeron_mpsc_rb_batch_t *batch,
+    int32_t msg_type_id,
+    const void *msg,
+    size_t length);
+
+void aeron_mpsc_rb_batch_commit(aeron_mpsc_rb_batch_t *batch);
+
 size_t aeron_mpsc_rb_read(
     volatile aeron_mpsc_rb_t *ring_buffer,
     aeron_rb_handler_t handler,
     void *clientd,
     size_t message_count_limit);
 
+/*
+ * Hand the contiguous block of committed records from the head to the handler in one call, padding records included,
+ * and consume it. Returns the number of bytes consumed.
+ */
+size_t aeron_mpsc_rb_read_block(
+    volatile aeron_mpsc_rb_t *ring_buffer,
+    aeron_rb_block_handler_t handler,
+    void *clientd,
+    size_t length_limit);
+
 int64_t aeron_mpsc_rb_next_correlation_id(volatile aeron_mpsc_rb_t *ring_buffer);
 
 void aeron_mpsc_rb_consumer_heartbeat_time(volatile aeron_mpsc_rb_t *ring_buffer, int64_t time);
@@ -49,6 +86,11 @@ int64_t aeron_mpsc_rb_consumer_heartbeat_time_value(volatile aeron_mpsc_rb_t *ri
 
 bool aeron_mpsc_rb_unblock(volatile aeron_mpsc_rb_t *ring_buffer);
 
+inline size_t aeron_mpsc_rb_batch_record_length(size_t length)
+{
+    return AERON_ALIGN(length + AERON_RB_RECORD_HEADER_LENGTH, AERON_RB_ALIGNMENT);
+}
+
 inline int64_t aeron_mpsc_rb_consumer_position(volatile aeron_mpsc_rb_t *ring_buffer)
 {
     int64_t position;
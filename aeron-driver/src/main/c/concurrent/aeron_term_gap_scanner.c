@@ -16,6 +16,10 @@
 
 #include "concurrent/aeron_term_gap_scanner.h"
 
+extern int32_t aeron_term_gap_scanner_scan_run(
+    const uint8_t *buffer, int32_t offset, int32_t limit_offset, int32_t frame_length, int32_t aligned_frame_length);
+extern int32_t aeron_term_gap_scanner_scan_empty(const uint8_t *buffer, int32_t offset, int32_t limit);
+
 extern int32_t aeron_term_gap_scanner_scan_for_gap(
     const uint8_t *buffer,
     int32_t term_id,
@@ -27,6 +27,62 @@
 typedef void (*aeron_term_gap_scanner_on_gap_detected_func_t)(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 
 #define AERON_ALIGNED_HEADER_LENGTH (AERON_ALIGN(AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT))
+#define AERON_TERM_GAP_SCANNER_BATCH_FRAMES (4)
+
+/*
+ * Skip whole batches of frames that repeat a known length. The headers are at fixed strides so the loads do not
+ * depend on each other, the scalar loop picks up wherever a batch does not match.
+ */
+inline int32_t aeron_term_gap_scanner_scan_run(
+    const uint8_t *buffer, int32_t offset, int32_t limit_offset, int32_t frame_length, int32_t aligned_frame_length)
+{
+    const int32_t batch_length = aligned_frame_length * AERON_TERM_GAP_SCANNER_BATCH_FRAMES;
+
+    while (offset <= limit_offset - batch_length)
+    {
+        int32_t l0, l1, l2, l3;
+
+        AERON_GET_VOLATILE(l0, ((aeron_frame_header_t *)(buffer + offset))->frame_length);
+        AERON_GET_VOLATILE(l1, ((aeron_frame_header_t *)(buffer + offset + aligned_frame_length))->frame_length);
+        AERON_GET_VOLATILE(l2, ((aeron_frame_header_t *)(buffer + offset + (aligned_frame_length * 2)))->frame_length);
+        AERON_GET_VOLATILE(l3, ((aeron_frame_header_t *)(buffer + offset + (aligned_frame_length * 3)))->frame_length);
+
+        if (0 != ((l0 ^ frame_length) | (l1 ^ frame_length) | (l2 ^ frame_length) | (l3 ^ frame_length)))
+        {
+            break;
+        }
+
+        offset += batch_length;
+    }
+
+    return offset;
+}
+
+/* skip whole batches of empty frame slots inside a gap, returning the last offset known to be empty */
+inline int32_t aeron_term_gap_scanner_scan_empty(const uint8_t *buffer, int32_t offset, int32_t limit)
+{
+    const int32_t batch_length = AERON_LOGBUFFER_FRAME_ALIGNMENT * AERON_TERM_GAP_SCANNER_BATCH_FRAMES;
+
+    while (offset <= limit - batch_length)
+    {
+        const uint8_t *ptr = buffer + offset;
+        int32_t l0, l1, l2, l3;
+
+        AERON_GET_VOLATILE(l0, ((aeron_frame_header_t *)(ptr + AERON_LOGBUFFER_FRAME_ALIGNMENT))->frame_length);
+        AERON_GET_VOLATILE(l1, ((aeron_frame_header_t *)(ptr + (AERON_LOGBUFFER_FRAME_ALIGNMENT * 2)))->frame_length);
+        AERON_GET_VOLATILE(l2, ((aeron_frame_header_t *)(ptr + (AERON_LOGBUFFER_FRAME_ALIGNMENT * 3)))->frame_length);
+        AERON_GET_VOLATILE(l3, ((aeron_frame_header_t *)(ptr + (AERON_LOGBUFFER_FRAME_ALIGNMENT * 4)))->frame_length);
+
+        if (0 != (l0 | l1 | l2 | l3))
+        {
+            break;
+        }
+
+        offset += batch_length;
+    }
+
+    return offset;
+}
 
 inline int32_t aeron_term_gap_scanner_scan_for_gap(
     const uint8_t *buffer,
@@ -49,7 +105,9 @@ inline int32_t aeron_term_gap_scanner_scan_for_gap(
             break;
         }
 
-        offset += AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        offset = aeron_term_gap_scanner_scan_run(
+            buffer, offset + aligned_frame_length, limit_offset, frame_length, aligned_frame_length);
     }
     while (offset < limit_offset);
 
@@ -57,6 +115,8 @@ inline int32_t aeron_term_gap_scanner_scan_for_gap(
     if (offset < limit_offset)
     {
         const int32_t limit = limit_offset - AERON_ALIGNED_HEADER_LENGTH;
+        offset = aeron_term_gap_scanner_scan_empty(buffer, offset, limit);
+
         while (offset < limit)
         {
             offset += AERON_LOGBUFFER_FRAME_ALIGNMENT;
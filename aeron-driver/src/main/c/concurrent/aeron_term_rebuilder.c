@@ -17,3 +17,7 @@
 #include "concurrent/aeron_term_rebuilder.h"
 
 extern void aeron_term_rebuilder_insert(uint8_t *dest, const uint8_t *src, size_t length);
+extern void aeron_term_rebuilder_insert_with_reserved_value(
+    uint8_t *dest, const uint8_t *src, size_t length, int64_t reserved_value);
+extern void aeron_term_rebuilder_copy_non_temporal(uint8_t *dest, const uint8_t *src, size_t length);
+extern void aeron_term_rebuilder_insert_non_temporal(uint8_t *dest, const uint8_t *src, size_t length);
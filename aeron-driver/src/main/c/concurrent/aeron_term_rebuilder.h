@@ -21,8 +21,14 @@
 #include <stddef.h>
 #include <string.h>
 #include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_bitutil.h"
 #include "aeron_atomic.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define AERON_TERM_REBUILDER_NON_TEMPORAL_STORES
+#endif
+
 #pragma pack(push)
 #pragma pack(4)
 typedef struct aeron_data_header_as_longs_stct
@@ -50,4 +56,95 @@ inline void aeron_term_rebuilder_insert(uint8_t *dest, const uint8_t *src, size_
     }
 }
 
+/*
+ * As aeron_term_rebuilder_insert but the reserved value of the frame header is replaced, e.g. with a receive time.
+ */
+inline void aeron_term_rebuilder_insert_with_reserved_value(
+    uint8_t *dest, const uint8_t *src, size_t length, int64_t reserved_value)
+{
+    aeron_data_header_t *hdr_dest = (aeron_data_header_t *)dest;
+    aeron_data_header_as_longs_t *dest_hdr_as_longs = (aeron_data_header_as_longs_t *)dest;
+    aeron_data_header_as_longs_t *src_hdr_as_longs = (aeron_data_header_as_longs_t *)src;
+
+    if (0 == hdr_dest->frame_header.frame_length)
+    {
+        memcpy(dest + AERON_DATA_HEADER_LENGTH, src + AERON_DATA_HEADER_LENGTH, length - AERON_DATA_HEADER_LENGTH);
+
+        hdr_dest->reserved_value = reserved_value;
+        dest_hdr_as_longs->hdr[2] = src_hdr_as_longs->hdr[2];
+        dest_hdr_as_longs->hdr[1] = src_hdr_as_longs->hdr[1];
+
+        AERON_PUT_ORDERED(dest_hdr_as_longs->hdr[0], src_hdr_as_longs->hdr[0]);
+    }
+}
+
+/*
+ * Copy with streaming stores that bypass the cache so a high rate image does not evict the receiver's working set.
+ * Only whole cache lines are streamed, a line partly written with normal stores, such as the one holding the frame
+ * header, would otherwise be flushed from the cache. Ends with a store fence as streaming stores are weakly ordered
+ * and must be visible before the frame is published.
+ */
+inline void aeron_term_rebuilder_copy_non_temporal(uint8_t *dest, const uint8_t *src, size_t length)
+{
+#if defined(AERON_TERM_REBUILDER_NON_TEMPORAL_STORES)
+    const size_t head_length = (AERON_CACHE_LINE_LENGTH - ((uintptr_t)dest & (AERON_CACHE_LINE_LENGTH - 1))) &
+        (AERON_CACHE_LINE_LENGTH - 1);
+    size_t offset = 0;
+
+    if (length < head_length + AERON_CACHE_LINE_LENGTH)
+    {
+        memcpy(dest, src, length);
+        return;
+    }
+
+    memcpy(dest, src, head_length);
+    offset = head_length;
+
+    for (; offset + AERON_CACHE_LINE_LENGTH <= length; offset += AERON_CACHE_LINE_LENGTH)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(src + offset));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src + offset + 16));
+        const __m128i c = _mm_loadu_si128((const __m128i *)(src + offset + 32));
+        const __m128i d = _mm_loadu_si128((const __m128i *)(src + offset + 48));
+
+        _mm_stream_si128((__m128i *)(dest + offset), a);
+        _mm_stream_si128((__m128i *)(dest + offset + 16), b);
+        _mm_stream_si128((__m128i *)(dest + offset + 32), c);
+        _mm_stream_si128((__m128i *)(dest + offset + 48), d);
+    }
+
+    if (offset < length)
+    {
+        memcpy(dest + offset, src + offset, length - offset);
+    }
+
+    _mm_sfence();
+#else
+    memcpy(dest, src, length);
+#endif
+}
+
+/*
+ * As aeron_term_rebuilder_insert but the payload is streamed past the cache. The header stays a normal store, written
+ * last with frame_length ordered, as it is the line the subscriber polls and reads first.
+ */
+inline void aeron_term_rebuilder_insert_non_temporal(uint8_t *dest, const uint8_t *src, size_t length)
+{
+    aeron_data_header_t *hdr_dest = (aeron_data_header_t *)dest;
+    aeron_data_header_as_longs_t *dest_hdr_as_longs = (aeron_data_header_as_longs_t *)dest;
+    aeron_data_header_as_longs_t *src_hdr_as_longs = (aeron_data_header_as_longs_t *)src;
+
+    if (0 == hdr_dest->frame_header.frame_length)
+    {
+        aeron_term_rebuilder_copy_non_temporal(
+            dest + AERON_DATA_HEADER_LENGTH, src + AERON_DATA_HEADER_LENGTH, length - AERON_DATA_HEADER_LENGTH);
+
+        dest_hdr_as_longs->hdr[3] = src_hdr_as_longs->hdr[3];
+        dest_hdr_as_longs->hdr[2] = src_hdr_as_longs->hdr[2];
+        dest_hdr_as_longs->hdr[1] = src_hdr_as_longs->hdr[1];
+
+        AERON_PUT_ORDERED(dest_hdr_as_longs->hdr[0], src_hdr_as_longs->hdr[0]);
+    }
+}
+
 #endif //AERON_AERON_TERM_REBUILDER_H
@@ -16,5 +16,8 @@
 
 #include "concurrent/aeron_term_scanner.h"
 
+extern size_t aeron_term_scanner_scan_run(
+    const uint8_t *buffer, size_t offset, size_t limit, int32_t frame_length, size_t aligned_frame_length);
+
 extern size_t aeron_term_scanner_scan_for_availability(
     const uint8_t *buffer, size_t term_length_left, size_t max_length, size_t *padding);
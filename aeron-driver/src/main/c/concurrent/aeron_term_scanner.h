@@ -24,6 +24,46 @@
 #include "aeron_atomic.h"
 #include "aeron_logbuffer_descriptor.h"
 
+#define AERON_TERM_SCANNER_RUN_BATCH_FRAMES (4)
+
+/*
+ * Small message streams are mostly runs of frames with the same length, so the headers that follow a frame of known
+ * length are at fixed strides. Checking a batch of them together lets the loads issue without each waiting on the
+ * length read by the previous one. Returns the offset after the last whole batch of matching data frames below limit.
+ */
+inline size_t aeron_term_scanner_scan_run(
+    const uint8_t *buffer, size_t offset, size_t limit, int32_t frame_length, size_t aligned_frame_length)
+{
+    const size_t batch_length = aligned_frame_length * AERON_TERM_SCANNER_RUN_BATCH_FRAMES;
+
+    while (offset + batch_length <= limit)
+    {
+        const aeron_frame_header_t *h0 = (aeron_frame_header_t *)(buffer + offset);
+        const aeron_frame_header_t *h1 = (aeron_frame_header_t *)(buffer + offset + aligned_frame_length);
+        const aeron_frame_header_t *h2 = (aeron_frame_header_t *)(buffer + offset + (aligned_frame_length * 2));
+        const aeron_frame_header_t *h3 = (aeron_frame_header_t *)(buffer + offset + (aligned_frame_length * 3));
+        int32_t l0, l1, l2, l3;
+
+        AERON_GET_VOLATILE(l0, h0->frame_length);
+        AERON_GET_VOLATILE(l1, h1->frame_length);
+        AERON_GET_VOLATILE(l2, h2->frame_length);
+        AERON_GET_VOLATILE(l3, h3->frame_length);
+
+        if (0 != ((l0 ^ frame_length) | (l1 ^ frame_length) | (l2 ^ frame_length) | (l3 ^ frame_length)) ||
+            AERON_HDR_TYPE_PAD == h0->type ||
+            AERON_HDR_TYPE_PAD == h1->type ||
+            AERON_HDR_TYPE_PAD == h2->type ||
+            AERON_HDR_TYPE_PAD == h3->type)
+        {
+            break;
+        }
+
+        offset += batch_length;
+    }
+
+    return offset;
+}
+
 inline size_t aeron_term_scanner_scan_for_availability(
     const uint8_t *buffer, size_t term_length_left, size_t max_length, size_t *padding)
 {
@@ -58,6 +98,12 @@ inline size_t aeron_term_scanner_scan_for_availability(
             *padding = 0;
             break;
         }
+
+        if (0 == *padding)
+        {
+            available = aeron_term_scanner_scan_run(
+                buffer, available, limit, frame_length, (size_t)aligned_frame_length);
+        }
     }
     while (0 == *padding && available < limit);
 
@@ -14,23 +14,77 @@
  * limitations under the License.
  */
 
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
 #include <inttypes.h>
+#include <string.h>
+#include <sys/socket.h>
 #include "aeron_system_counters.h"
 #include "util/aeron_netutil.h"
 #include "util/aeron_error.h"
 #include "aeron_driver_context.h"
 #include "aeron_alloc.h"
+#include "util/aeron_arrayutil.h"
 #include "collections/aeron_int64_to_ptr_hash_map.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_driver_receiver.h"
+#include "aeron_frame_checksum.h"
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
 
-int aeron_receive_channel_endpoint_create(
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+static int aeron_receive_channel_endpoint_control_batch_init(aeron_receive_channel_endpoint_t *endpoint)
+{
+    struct aeron_receive_channel_endpoint_control_batch_stct *batch = &endpoint->control_batch;
+    const size_t vlen = AERON_RECEIVE_CHANNEL_ENDPOINT_CONTROL_BATCH_LENGTH;
+
+    if (aeron_alloc((void **)&batch->frames, vlen * AERON_RECEIVE_CHANNEL_ENDPOINT_CONTROL_FRAME_MAX_LENGTH) < 0 ||
+        aeron_alloc((void **)&batch->mmsghdrs, vlen * sizeof(struct mmsghdr)) < 0 ||
+        aeron_alloc((void **)&batch->iov, vlen * sizeof(struct iovec)) < 0 ||
+        aeron_alloc((void **)&batch->addrs, vlen * sizeof(struct sockaddr_storage)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "could not allocate control batch: %s", strerror(errcode));
+        return -1;
+    }
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        struct msghdr *msg_hdr = &batch->mmsghdrs[i].msg_hdr;
+
+        batch->iov[i].iov_base = batch->frames + (i * AERON_RECEIVE_CHANNEL_ENDPOINT_CONTROL_FRAME_MAX_LENGTH);
+        msg_hdr->msg_name = &batch->addrs[i];
+        msg_hdr->msg_iov = &batch->iov[i];
+        msg_hdr->msg_iovlen = 1;
+    }
+
+    batch->length = 0;
+
+    return 0;
+}
+
+static int aeron_receive_channel_endpoint_create_shard(
     aeron_receive_channel_endpoint_t **endpoint,
     aeron_udp_channel_t *channel,
+    struct sockaddr_storage *bind_addr,
     aeron_counter_t *status_indicator,
     aeron_system_counters_t *system_counters,
-    aeron_driver_context_t *context)
+    aeron_driver_context_t *context,
+    aeron_driver_receiver_proxy_t *receiver_proxy,
+    aeron_receive_channel_endpoint_t *parent,
+    bool reuse_port)
 {
     aeron_receive_channel_endpoint_t *_endpoint = NULL;
 
@@ -42,8 +96,12 @@ int aeron_receive_channel_endpoint_create(
         return -1;
     }
 
+    _endpoint->shards[0] = _endpoint;
+    _endpoint->shard_count = 1;
+    _endpoint->parent = parent;
+
     if (aeron_data_packet_dispatcher_init(
-        &_endpoint->dispatcher, context->conductor_proxy, context->receiver_proxy->receiver) < 0)
+        &_endpoint->dispatcher, context->conductor_proxy, receiver_proxy->receiver) < 0)
     {
         return -1;
     }
@@ -62,39 +120,253 @@ int aeron_receive_channel_endpoint_create(
     _endpoint->conductor_fields.managed_resource.registration_id = -1;
     _endpoint->conductor_fields.status = AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_ACTIVE;
     _endpoint->transport.fd = -1;
+    _endpoint->transport.recv_timestamp_ns = 0;
+    _endpoint->control_transport.fd = -1;
+    _endpoint->control_transport.bindings = NULL;
     _endpoint->channel_status.counter_id = -1;
+    _endpoint->socket_drops.counter_id = -1;
+    _endpoint->socket_drops.value_addr = NULL;
 
-    if (aeron_udp_channel_transport_init(
-        &_endpoint->transport,
-        &channel->remote_data,
-        &channel->local_data,
-        channel->interface_index,
-        (0 != channel->multicast_ttl) ? channel->multicast_ttl : context->multicast_ttl,
-        context->socket_rcvbuf,
-        context->socket_sndbuf) < 0)
+    if (aeron_receive_channel_endpoint_control_batch_init(_endpoint) < 0)
     {
         aeron_receive_channel_endpoint_delete(NULL, _endpoint);
         return -1;
     }
 
-    if (aeron_udp_channel_transport_get_so_rcvbuf(&_endpoint->transport, &_endpoint->so_rcvbuf) < 0)
+    if ((_endpoint->transport.bindings = aeron_udp_channel_transport_bindings_for_uri(
+        &channel->uri, context->udp_channel_transport_bindings)) == NULL)
     {
         aeron_receive_channel_endpoint_delete(NULL, _endpoint);
         return -1;
     }
 
+    if (reuse_port && &aeron_udp_channel_transport_bindings_default != _endpoint->transport.bindings)
+    {
+        aeron_set_err(EINVAL, "%s needs the default media bindings", AERON_UDP_CHANNEL_RECEIVER_SHARDS_KEY);
+        _endpoint->transport.bindings = NULL;
+        aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+        return -1;
+    }
+
+    uint32_t busy_poll_us = context->socket_busy_poll_us;
+    bool prefer_busy_poll = context->socket_prefer_busy_poll;
+
+    if (aeron_uri_busy_poll(&channel->uri, &busy_poll_us, &prefer_busy_poll) < 0)
+    {
+        aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+        return -1;
+    }
+
+    if ((reuse_port ?
+        aeron_udp_channel_transport_init_reuse_port(
+            &_endpoint->transport,
+            bind_addr,
+            &channel->local_data,
+            channel->interface_index,
+            context->multicast_ttl,
+            context->socket_rcvbuf,
+            context->socket_sndbuf,
+            context->socket_gro,
+            busy_poll_us,
+            prefer_busy_poll,
+            context->socket_rx_timestamping) :
+        _endpoint->transport.bindings->init_func(
+            &_endpoint->transport,
+            bind_addr,
+            &channel->local_data,
+            channel->interface_index,
+            (0 != channel->multicast_ttl) ? channel->multicast_ttl : context->multicast_ttl,
+            context->socket_rcvbuf,
+            context->socket_sndbuf,
+            context->socket_gro,
+            busy_poll_us,
+            prefer_busy_poll,
+            context->socket_rx_timestamping,
+            NULL)) < 0)
+    {
+        aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+        return -1;
+    }
+
+    if (_endpoint->transport.bindings->get_so_rcvbuf_func(&_endpoint->transport, &_endpoint->so_rcvbuf) < 0)
+    {
+        aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+        return -1;
+    }
+
+    /* other bindings may not have a socket to monitor, in which case drops go unmonitored */
+    _endpoint->drop_monitoring =
+        context->socket_drop_monitoring && NULL == parent &&
+        aeron_udp_channel_transport_set_drop_monitoring(&_endpoint->transport) >= 0;
+    _endpoint->last_socket_drops = 0;
+    _endpoint->so_rcvbuf_requested = 0 != context->socket_rcvbuf ? context->socket_rcvbuf : _endpoint->so_rcvbuf;
+    _endpoint->so_rcvbuf_max = context->socket_rcvbuf_max;
+
     _endpoint->transport.dispatch_clientd = _endpoint;
+    /* other bindings may hand over buffers they release as soon as recv_func returns, so only batch the default */
+    if (&aeron_udp_channel_transport_bindings_default == _endpoint->transport.bindings)
+    {
+        _endpoint->transport.recv_batch_end_func = aeron_receive_channel_endpoint_dispatch_batch_end;
+    }
     _endpoint->has_receiver_released = false;
 
     _endpoint->channel_status.counter_id = status_indicator->counter_id;
     _endpoint->channel_status.value_addr = status_indicator->value_addr;
 
     _endpoint->receiver_id = context->receiver_id;
-    _endpoint->receiver_proxy = context->receiver_proxy;
+    _endpoint->has_group_tag = context->receiver_group_tag_is_set;
+    _endpoint->group_tag = context->receiver_group_tag;
+
+    if (aeron_uri_group_tag(&channel->uri, &_endpoint->has_group_tag, &_endpoint->group_tag) < 0)
+    {
+        aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+        return -1;
+    }
+
+    _endpoint->receive_timestamp = false;
+
+    _endpoint->checksum = false;
+
+    if (aeron_uri_receive_timestamp(&channel->uri, &_endpoint->receive_timestamp) < 0 ||
+        aeron_uri_checksum(&channel->uri, &_endpoint->checksum) < 0)
+    {
+        aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+        return -1;
+    }
+
+    _endpoint->receiver_proxy = receiver_proxy;
+    receiver_proxy->endpoint_count++;
 
     _endpoint->short_sends_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS);
     _endpoint->possible_ttl_asymmetry_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_POSSIBLE_TTL_ASYMMETRY);
+    _endpoint->checksum_failures_counter =
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_CHECKSUM_FAILURES);
+
+    *endpoint = _endpoint;
+    return 0;
+}
+
+int aeron_receive_channel_endpoint_create(
+    aeron_receive_channel_endpoint_t **endpoint,
+    aeron_udp_channel_t *channel,
+    aeron_counter_t *status_indicator,
+    aeron_system_counters_t *system_counters,
+    aeron_driver_context_t *context)
+{
+    aeron_receive_channel_endpoint_t *_endpoint = NULL;
+    aeron_driver_receiver_proxy_t *receiver_proxy = aeron_driver_receiver_proxy_least_loaded(context);
+    struct sockaddr_storage bind_addr;
+    socklen_t bind_addr_len = sizeof(bind_addr);
+    size_t shard_count = 1;
+    size_t first_receiver = 0;
+
+    if (aeron_uri_receiver_shards(&channel->uri, &shard_count) < 0)
+    {
+        return -1;
+    }
+
+    /* more shards than receivers would put two on one receiver, which gains nothing */
+    shard_count = shard_count < context->receiver_count ? shard_count : context->receiver_count;
+
+    if (shard_count > 1 && channel->multicast)
+    {
+        aeron_set_err(EINVAL, "%s needs a unicast channel", AERON_UDP_CHANNEL_RECEIVER_SHARDS_KEY);
+        return -1;
+    }
+
+    if (aeron_receive_channel_endpoint_create_shard(
+        &_endpoint,
+        channel,
+        &channel->remote_data,
+        status_indicator,
+        system_counters,
+        context,
+        receiver_proxy,
+        NULL,
+        shard_count > 1) < 0)
+    {
+        return -1;
+    }
+
+    if (shard_count > 1)
+    {
+        /* the other shards join the group on the address the first was bound to, whose port may have been 0 */
+        if (getsockname(_endpoint->transport.fd, (struct sockaddr *)&bind_addr, &bind_addr_len) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "getsockname: %s", strerror(errcode));
+            aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+            return -1;
+        }
+
+        for (size_t i = 0; i < context->receiver_count; i++)
+        {
+            if (context->receiver_proxies[i] == receiver_proxy)
+            {
+                first_receiver = i;
+            }
+        }
+
+        for (size_t i = 1; i < shard_count; i++)
+        {
+            aeron_receive_channel_endpoint_t *shard = NULL;
+
+            if (aeron_receive_channel_endpoint_create_shard(
+                &shard,
+                channel,
+                &bind_addr,
+                status_indicator,
+                system_counters,
+                context,
+                context->receiver_proxies[(first_receiver + i) % context->receiver_count],
+                _endpoint,
+                true) < 0)
+            {
+                aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+                return -1;
+            }
+
+            _endpoint->shards[_endpoint->shard_count++] = shard;
+        }
+
+        /* steering by session id keeps every frame of a session, from any path it is sent on, on one shard */
+        if (aeron_udp_channel_transport_set_session_steering(&_endpoint->transport, shard_count) < 0)
+        {
+            aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+            return -1;
+        }
+    }
+
+    /* other bindings may encode frames or have no socket to join the group with, so only the default overhears */
+    if (context->rcv_nak_suppression && channel->multicast &&
+        &aeron_udp_channel_transport_bindings_default == _endpoint->transport.bindings)
+    {
+        _endpoint->control_transport.bindings = _endpoint->transport.bindings;
+
+        if (_endpoint->control_transport.bindings->init_func(
+            &_endpoint->control_transport,
+            &channel->remote_control,
+            &channel->local_data,
+            channel->interface_index,
+            (0 != channel->multicast_ttl) ? channel->multicast_ttl : context->multicast_ttl,
+            context->socket_rcvbuf,
+            context->socket_sndbuf,
+            false,
+            0,
+            false,
+            false,
+            NULL) < 0)
+        {
+            _endpoint->control_transport.bindings = NULL;
+            aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+            return -1;
+        }
+
+        _endpoint->control_transport.dispatch_clientd = _endpoint;
+        _endpoint->control_transport.recv_batch_end_func = NULL;
+    }
 
     *endpoint = _endpoint;
     return 0;
@@ -110,24 +382,167 @@ void aeron_receive_channel_endpoint_free_stream_id_refcnt(void *clientd, int64_t
 int aeron_receive_channel_endpoint_delete(
     aeron_counters_manager_t *counters_manager, aeron_receive_channel_endpoint_t *endpoint)
 {
-    if (NULL != counters_manager && -1 != endpoint->channel_status.counter_id)
+    for (size_t i = 1; i < endpoint->shard_count; i++)
+    {
+        aeron_receive_channel_endpoint_delete(counters_manager, endpoint->shards[i]);
+    }
+
+    /* shards share the status counter and channel of the endpoint they belong to */
+    if (NULL != counters_manager && -1 != endpoint->channel_status.counter_id && NULL == endpoint->parent)
     {
         aeron_counters_manager_free(counters_manager, (int32_t)endpoint->channel_status.counter_id);
     }
 
+    if (NULL != counters_manager && -1 != endpoint->socket_drops.counter_id)
+    {
+        aeron_counters_manager_free(counters_manager, (int32_t)endpoint->socket_drops.counter_id);
+    }
+
     aeron_int64_to_ptr_hash_map_for_each(&endpoint->stream_id_to_refcnt_map, aeron_receive_channel_endpoint_free_stream_id_refcnt, endpoint);
 
     aeron_int64_to_ptr_hash_map_delete(&endpoint->stream_id_to_refcnt_map);
+    aeron_free(endpoint->stream_ranges.array);
     aeron_data_packet_dispatcher_close(&endpoint->dispatcher);
-    aeron_udp_channel_delete(endpoint->conductor_fields.udp_channel);
-    aeron_udp_channel_transport_close(&endpoint->transport);
+    if (NULL == endpoint->parent)
+    {
+        aeron_udp_channel_delete(endpoint->conductor_fields.udp_channel);
+    }
+
+    if (NULL != endpoint->receiver_proxy)
+    {
+        endpoint->receiver_proxy->endpoint_count--;
+    }
+
+    if (NULL != endpoint->transport.bindings)
+    {
+        endpoint->transport.bindings->close_func(&endpoint->transport);
+    }
+
+    if (NULL != endpoint->control_transport.bindings)
+    {
+        endpoint->control_transport.bindings->close_func(&endpoint->control_transport);
+    }
+
+    aeron_free(endpoint->control_batch.frames);
+    aeron_free(endpoint->control_batch.mmsghdrs);
+    aeron_free(endpoint->control_batch.iov);
+    aeron_free(endpoint->control_batch.addrs);
     aeron_free(endpoint);
     return 0;
 }
 
+int aeron_receive_channel_endpoint_check_socket_drops(aeron_receive_channel_endpoint_t *endpoint)
+{
+    const uint32_t socket_drops = endpoint->transport.socket_drops;
+    const uint32_t drops = socket_drops - endpoint->last_socket_drops;
+
+    if (0 == drops || NULL == endpoint->socket_drops.value_addr)
+    {
+        return 0;
+    }
+
+    endpoint->last_socket_drops = socket_drops;
+    aeron_counter_add_ordered(endpoint->socket_drops.value_addr, (int64_t)drops);
+
+    if (endpoint->so_rcvbuf_requested < endpoint->so_rcvbuf_max)
+    {
+        const size_t so_rcvbuf_requested = endpoint->so_rcvbuf_requested * 2 < endpoint->so_rcvbuf_max ?
+            endpoint->so_rcvbuf_requested * 2 : endpoint->so_rcvbuf_max;
+        size_t so_rcvbuf;
+
+        if (aeron_udp_channel_transport_set_so_rcvbuf(&endpoint->transport, so_rcvbuf_requested) < 0 ||
+            endpoint->transport.bindings->get_so_rcvbuf_func(&endpoint->transport, &so_rcvbuf) < 0)
+        {
+            return -1;
+        }
+
+        endpoint->so_rcvbuf_requested = so_rcvbuf_requested;
+        AERON_PUT_ORDERED(endpoint->so_rcvbuf, so_rcvbuf);
+    }
+
+    return (int)drops;
+}
+
 int aeron_receive_channel_endpoint_sendmsg(aeron_receive_channel_endpoint_t *endpoint, struct msghdr *msghdr)
 {
-    return aeron_udp_channel_transport_sendmsg(&endpoint->transport, msghdr);
+    return endpoint->transport.bindings->sendmsg_func(&endpoint->transport, msghdr);
+}
+
+int aeron_receive_channel_endpoint_flush(aeron_receive_channel_endpoint_t *endpoint)
+{
+    struct aeron_receive_channel_endpoint_control_batch_stct *batch = &endpoint->control_batch;
+    const size_t vlen = batch->length;
+    size_t sent = 0;
+
+    batch->length = 0;
+
+    while (sent < vlen)
+    {
+        int sendmmsg_result = endpoint->transport.bindings->sendmmsg_func(
+            &endpoint->transport, &batch->mmsghdrs[sent], vlen - sent);
+        if (sendmmsg_result < 0)
+        {
+            return -1;
+        }
+
+        if (0 == sendmmsg_result)
+        {
+            break;
+        }
+
+        for (size_t i = sent, end = sent + (size_t)sendmmsg_result; i < end; i++)
+        {
+            if (batch->mmsghdrs[i].msg_len != batch->iov[i].iov_len)
+            {
+                aeron_counter_increment(endpoint->short_sends_counter, 1);
+            }
+        }
+
+        sent += (size_t)sendmmsg_result;
+    }
+
+    if (sent < vlen)
+    {
+        aeron_counter_increment(endpoint->short_sends_counter, (int64_t)(vlen - sent));
+    }
+
+    return (int)sent;
+}
+
+/*
+ * Slot for the next control frame to addr, flushing the batch first if it is full. NULL if that flush failed.
+ */
+static uint8_t *aeron_receive_channel_endpoint_claim_control_frame(
+    aeron_receive_channel_endpoint_t *endpoint, struct sockaddr_storage *addr)
+{
+    struct aeron_receive_channel_endpoint_control_batch_stct *batch = &endpoint->control_batch;
+
+    if (AERON_RECEIVE_CHANNEL_ENDPOINT_CONTROL_BATCH_LENGTH == batch->length &&
+        aeron_receive_channel_endpoint_flush(endpoint) < 0)
+    {
+        return NULL;
+    }
+
+    memcpy(&batch->addrs[batch->length], addr, AERON_ADDR_LEN(addr));
+
+    return batch->iov[batch->length].iov_base;
+}
+
+static int aeron_receive_channel_endpoint_commit_control_frame(
+    aeron_receive_channel_endpoint_t *endpoint, struct sockaddr_storage *addr, size_t frame_length)
+{
+    struct aeron_receive_channel_endpoint_control_batch_stct *batch = &endpoint->control_batch;
+    struct msghdr *msg_hdr = &batch->mmsghdrs[batch->length].msg_hdr;
+
+    batch->iov[batch->length].iov_len = frame_length;
+    msg_hdr->msg_namelen = AERON_ADDR_LEN(addr);
+    msg_hdr->msg_control = NULL;
+    msg_hdr->msg_controllen = 0;
+    msg_hdr->msg_flags = 0;
+    batch->mmsghdrs[batch->length].msg_len = 0;
+    batch->length++;
+
+    return (int)frame_length;
 }
 
 int aeron_receive_channel_endpoint_send_sm(
@@ -140,12 +555,17 @@ int aeron_receive_channel_endpoint_send_sm(
     int32_t receiver_window,
     uint8_t flags)
 {
-    uint8_t buffer[sizeof(aeron_status_message_header_t)];
+    uint8_t *buffer = aeron_receive_channel_endpoint_claim_control_frame(endpoint, addr);
+    if (NULL == buffer)
+    {
+        return -1;
+    }
+
     aeron_status_message_header_t *sm_header = (aeron_status_message_header_t *) buffer;
-    struct iovec iov[1];
-    struct msghdr msghdr;
+    const size_t frame_length =
+        sizeof(aeron_status_message_header_t) + (endpoint->has_group_tag ? sizeof(int64_t) : 0);
 
-    sm_header->frame_header.frame_length = sizeof(aeron_status_message_header_t);
+    sm_header->frame_header.frame_length = (int32_t)frame_length;
     sm_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
     sm_header->frame_header.flags = flags;
     sm_header->frame_header.type = AERON_HDR_TYPE_SM;
@@ -156,26 +576,12 @@ int aeron_receive_channel_endpoint_send_sm(
     sm_header->receiver_window = receiver_window;
     sm_header->receiver_id = endpoint->receiver_id;
 
-    iov[0].iov_base = buffer;
-    iov[0].iov_len = sizeof(aeron_status_message_header_t);
-    msghdr.msg_iov = iov;
-    msghdr.msg_iovlen = 1;
-    msghdr.msg_flags = 0;
-    msghdr.msg_name = addr;
-    msghdr.msg_namelen = AERON_ADDR_LEN(addr);
-    msghdr.msg_control = NULL;
-    msghdr.msg_controllen = 0;
-
-    int bytes_sent;
-    if ((bytes_sent = aeron_receive_channel_endpoint_sendmsg(endpoint, &msghdr)) != (int) iov[0].iov_len)
+    if (endpoint->has_group_tag)
     {
-        if (bytes_sent >= 0)
-        {
-            aeron_counter_increment(endpoint->short_sends_counter, 1);
-        }
+        memcpy(buffer + AERON_STATUS_MESSAGE_GROUP_TAG_OFFSET, &endpoint->group_tag, sizeof(int64_t));
     }
 
-    return bytes_sent;
+    return aeron_receive_channel_endpoint_commit_control_frame(endpoint, addr, frame_length);
 }
 
 int aeron_receive_channel_endpoint_send_nak(
@@ -187,10 +593,13 @@ int aeron_receive_channel_endpoint_send_nak(
     int32_t term_offset,
     int32_t length)
 {
-    uint8_t buffer[sizeof(aeron_nak_header_t)];
+    uint8_t *buffer = aeron_receive_channel_endpoint_claim_control_frame(endpoint, addr);
+    if (NULL == buffer)
+    {
+        return -1;
+    }
+
     aeron_nak_header_t *nak_header = (aeron_nak_header_t *) buffer;
-    struct iovec iov[1];
-    struct msghdr msghdr;
 
     nak_header->frame_header.frame_length = sizeof(aeron_nak_header_t);
     nak_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
@@ -202,26 +611,7 @@ int aeron_receive_channel_endpoint_send_nak(
     nak_header->term_offset = term_offset;
     nak_header->length = length;
 
-    iov[0].iov_base = buffer;
-    iov[0].iov_len = sizeof(aeron_nak_header_t);
-    msghdr.msg_iov = iov;
-    msghdr.msg_iovlen = 1;
-    msghdr.msg_flags = 0;
-    msghdr.msg_name = addr;
-    msghdr.msg_namelen = AERON_ADDR_LEN(addr);
-    msghdr.msg_control = NULL;
-    msghdr.msg_controllen = 0;
-
-    int bytes_sent;
-    if ((bytes_sent = aeron_receive_channel_endpoint_sendmsg(endpoint, &msghdr)) != (int) iov[0].iov_len)
-    {
-        if (bytes_sent >= 0)
-        {
-            aeron_counter_increment(endpoint->short_sends_counter, 1);
-        }
-    }
-
-    return bytes_sent;
+    return aeron_receive_channel_endpoint_commit_control_frame(endpoint, addr, sizeof(aeron_nak_header_t));
 }
 
 int aeron_receive_channel_endpoint_send_rttm(
@@ -233,10 +623,13 @@ int aeron_receive_channel_endpoint_send_rttm(
     int64_t reception_delta,
     bool is_reply)
 {
-    uint8_t buffer[sizeof(aeron_rttm_header_t)];
+    uint8_t *buffer = aeron_receive_channel_endpoint_claim_control_frame(endpoint, addr);
+    if (NULL == buffer)
+    {
+        return -1;
+    }
+
     aeron_rttm_header_t *rttm_header = (aeron_rttm_header_t *) buffer;
-    struct iovec iov[1];
-    struct msghdr msghdr;
 
     rttm_header->frame_header.frame_length = sizeof(aeron_rttm_header_t);
     rttm_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
@@ -248,26 +641,7 @@ int aeron_receive_channel_endpoint_send_rttm(
     rttm_header->reception_delta = reception_delta;
     rttm_header->receiver_id = endpoint->receiver_id;
 
-    iov[0].iov_base = buffer;
-    iov[0].iov_len = sizeof(aeron_rttm_header_t);
-    msghdr.msg_iov = iov;
-    msghdr.msg_iovlen = 1;
-    msghdr.msg_flags = 0;
-    msghdr.msg_name = addr;
-    msghdr.msg_namelen = AERON_ADDR_LEN(addr);
-    msghdr.msg_control = NULL;
-    msghdr.msg_controllen = 0;
-
-    int bytes_sent;
-    if ((bytes_sent = aeron_receive_channel_endpoint_sendmsg(endpoint, &msghdr)) != (int) iov[0].iov_len)
-    {
-        if (bytes_sent >= 0)
-        {
-            aeron_counter_increment(endpoint->short_sends_counter, 1);
-        }
-    }
-
-    return bytes_sent;
+    return aeron_receive_channel_endpoint_commit_control_frame(endpoint, addr, sizeof(aeron_rttm_header_t));
 }
 
 void aeron_receive_channel_endpoint_dispatch(
@@ -283,13 +657,24 @@ void aeron_receive_channel_endpoint_dispatch(
         return;
     }
 
+    if (endpoint->transport.in_recv_batch &&
+        AERON_HDR_TYPE_DATA != frame_header->type && AERON_HDR_TYPE_PAD != frame_header->type)
+    {
+        /* frames of other types are handled in order with the data frames deferred before them */
+        aeron_driver_receiver_insert_pending_packets(receiver);
+    }
+
     switch (frame_header->type)
     {
         case AERON_HDR_TYPE_PAD:
         case AERON_HDR_TYPE_DATA:
             if (length >= sizeof(aeron_data_header_t))
             {
-                if (aeron_receive_channel_endpoint_on_data(endpoint, buffer, length, addr) < 0)
+                if (endpoint->checksum && !aeron_frame_checksum_verify(buffer, length))
+                {
+                    aeron_counter_increment(endpoint->checksum_failures_counter, 1);
+                }
+                else if (aeron_receive_channel_endpoint_on_data(endpoint, buffer, length, addr) < 0)
                 {
                     AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_data: %s", aeron_errmsg());
                 }
@@ -314,6 +699,20 @@ void aeron_receive_channel_endpoint_dispatch(
             }
             break;
 
+        case AERON_HDR_TYPE_NAK:
+            if (length >= sizeof(aeron_nak_header_t))
+            {
+                if (aeron_receive_channel_endpoint_on_nak(endpoint, buffer, length, addr) < 0)
+                {
+                    AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_nak: %s", aeron_errmsg());
+                }
+            }
+            else
+            {
+                aeron_counter_increment(receiver->invalid_frames_counter, 1);
+            }
+            break;
+
         case AERON_HDR_TYPE_RTTM:
             if (length >= sizeof(aeron_rttm_header_t))
             {
@@ -328,6 +727,20 @@ void aeron_receive_channel_endpoint_dispatch(
             }
             break;
 
+        case AERON_HDR_TYPE_FEC:
+            if (length >= sizeof(aeron_fec_header_t))
+            {
+                if (aeron_receive_channel_endpoint_on_fec(endpoint, buffer, length, addr) < 0)
+                {
+                    AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_fec: %s", aeron_errmsg());
+                }
+            }
+            else
+            {
+                aeron_counter_increment(receiver->invalid_frames_counter, 1);
+            }
+            break;
+
         default:
             break;
     }
@@ -338,9 +751,20 @@ int aeron_receive_channel_endpoint_on_data(
 {
     aeron_data_header_t *data_header = (aeron_data_header_t *)buffer;
 
+    if (endpoint->transport.in_recv_batch)
+    {
+        return aeron_data_packet_dispatcher_on_data_batched(
+            &endpoint->dispatcher, endpoint, data_header, buffer, length, addr);
+    }
+
     return aeron_data_packet_dispatcher_on_data(&endpoint->dispatcher, endpoint, data_header, buffer, length, addr);
 }
 
+void aeron_receive_channel_endpoint_dispatch_batch_end(void *receiver_clientd, void *endpoint_clientd)
+{
+    aeron_driver_receiver_insert_pending_packets((aeron_driver_receiver_t *)receiver_clientd);
+}
+
 int aeron_receive_channel_endpoint_on_setup(
     aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
 {
@@ -349,6 +773,14 @@ int aeron_receive_channel_endpoint_on_setup(
     return aeron_data_packet_dispatcher_on_setup(&endpoint->dispatcher, endpoint, setup_header, buffer, length, addr);
 }
 
+int aeron_receive_channel_endpoint_on_nak(
+    aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+{
+    aeron_nak_header_t *nak_header = (aeron_nak_header_t *)buffer;
+
+    return aeron_data_packet_dispatcher_on_nak(&endpoint->dispatcher, endpoint, nak_header, buffer, length, addr);
+}
+
 int aeron_receive_channel_endpoint_on_rttm(
     aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
 {
@@ -364,6 +796,35 @@ int aeron_receive_channel_endpoint_on_rttm(
     return result;
 }
 
+int aeron_receive_channel_endpoint_on_fec(
+    aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+{
+    aeron_fec_header_t *fec_header = (aeron_fec_header_t *)buffer;
+
+    return aeron_data_packet_dispatcher_on_fec(&endpoint->dispatcher, endpoint, fec_header, buffer, length, addr);
+}
+
+static inline bool aeron_receive_channel_endpoint_has_subscriptions(aeron_receive_channel_endpoint_t *endpoint)
+{
+    return 0 != endpoint->stream_id_to_refcnt_map.size || 0 != endpoint->stream_ranges.length;
+}
+
+static void aeron_receive_channel_endpoint_close_if_unsubscribed(aeron_receive_channel_endpoint_t *endpoint)
+{
+    if (!aeron_receive_channel_endpoint_has_subscriptions(endpoint))
+    {
+        /* mark as CLOSING to be aware not to use again (to be receiver_released and deleted) */
+        endpoint->conductor_fields.status = AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_CLOSING;
+
+        for (size_t i = 0; i < endpoint->shard_count; i++)
+        {
+            aeron_receive_channel_endpoint_t *shard = endpoint->shards[i];
+
+            aeron_driver_receiver_proxy_on_remove_endpoint(shard->receiver_proxy, shard);
+        }
+    }
+}
+
 int32_t aeron_receive_channel_endpoint_incref_to_stream(
     aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id)
 {
@@ -371,7 +832,7 @@ int32_t aeron_receive_channel_endpoint_incref_to_stream(
 
     if (NULL == count)
     {
-        bool is_first_subscription = (0 == endpoint->stream_id_to_refcnt_map.size) ? true : false;
+        bool is_first_subscription = !aeron_receive_channel_endpoint_has_subscriptions(endpoint);
 
         if (aeron_alloc((void **)&count, sizeof(aeron_stream_id_refcnt_t)) < 0)
         {
@@ -390,12 +851,17 @@ int32_t aeron_receive_channel_endpoint_incref_to_stream(
             return -1;
         }
 
-        if (is_first_subscription)
+        for (size_t i = 0; i < endpoint->shard_count; i++)
         {
-            aeron_driver_receiver_proxy_on_add_endpoint(endpoint->receiver_proxy, endpoint);
-        }
+            aeron_receive_channel_endpoint_t *shard = endpoint->shards[i];
 
-        aeron_driver_receiver_proxy_on_add_subscription(endpoint->receiver_proxy, endpoint, stream_id);
+            if (is_first_subscription)
+            {
+                aeron_driver_receiver_proxy_on_add_endpoint(shard->receiver_proxy, shard);
+            }
+
+            aeron_driver_receiver_proxy_on_add_subscription(shard->receiver_proxy, shard, stream_id);
+        }
     }
 
     return ++count->refcnt;
@@ -417,19 +883,106 @@ int32_t aeron_receive_channel_endpoint_decref_to_stream(
         aeron_int64_to_ptr_hash_map_remove(&endpoint->stream_id_to_refcnt_map, stream_id);
         aeron_free(count);
 
-        aeron_driver_receiver_proxy_on_remove_subscription(endpoint->receiver_proxy, endpoint, stream_id);
-
-        if (0 == endpoint->stream_id_to_refcnt_map.size)
+        for (size_t i = 0; i < endpoint->shard_count; i++)
         {
-            /* mark as CLOSING to be aware not to use again (to be receiver_released and deleted) */
-            endpoint->conductor_fields.status = AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_CLOSING;
-            aeron_driver_receiver_proxy_on_remove_endpoint(endpoint->receiver_proxy, endpoint);
+            aeron_receive_channel_endpoint_t *shard = endpoint->shards[i];
+
+            aeron_driver_receiver_proxy_on_remove_subscription(shard->receiver_proxy, shard, stream_id);
         }
+
+        aeron_receive_channel_endpoint_close_if_unsubscribed(endpoint);
     }
 
     return result;
 }
 
+int32_t aeron_receive_channel_endpoint_incref_to_stream_range(
+    aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id_low, int32_t stream_id_high)
+{
+    if (stream_id_low == stream_id_high)
+    {
+        return aeron_receive_channel_endpoint_incref_to_stream(endpoint, stream_id_low);
+    }
+
+    for (size_t i = 0, length = endpoint->stream_ranges.length; i < length; i++)
+    {
+        aeron_stream_range_refcnt_t *range = &endpoint->stream_ranges.array[i];
+
+        if (stream_id_low == range->stream_id_low && stream_id_high == range->stream_id_high)
+        {
+            return ++range->refcnt;
+        }
+    }
+
+    bool is_first_subscription = !aeron_receive_channel_endpoint_has_subscriptions(endpoint);
+    int ensure_capacity_result = 0;
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, endpoint->stream_ranges, aeron_stream_range_refcnt_t);
+
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    aeron_stream_range_refcnt_t *range = &endpoint->stream_ranges.array[endpoint->stream_ranges.length++];
+    range->stream_id_low = stream_id_low;
+    range->stream_id_high = stream_id_high;
+    range->refcnt = 1;
+
+    for (size_t i = 0; i < endpoint->shard_count; i++)
+    {
+        aeron_receive_channel_endpoint_t *shard = endpoint->shards[i];
+
+        if (is_first_subscription)
+        {
+            aeron_driver_receiver_proxy_on_add_endpoint(shard->receiver_proxy, shard);
+        }
+
+        aeron_driver_receiver_proxy_on_add_subscription_range(
+            shard->receiver_proxy, shard, stream_id_low, stream_id_high);
+    }
+
+    return range->refcnt;
+}
+
+int32_t aeron_receive_channel_endpoint_decref_to_stream_range(
+    aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id_low, int32_t stream_id_high)
+{
+    if (stream_id_low == stream_id_high)
+    {
+        return aeron_receive_channel_endpoint_decref_to_stream(endpoint, stream_id_low);
+    }
+
+    for (size_t i = 0, length = endpoint->stream_ranges.length; i < length; i++)
+    {
+        aeron_stream_range_refcnt_t *range = &endpoint->stream_ranges.array[i];
+
+        if (stream_id_low == range->stream_id_low && stream_id_high == range->stream_id_high)
+        {
+            int32_t result = --range->refcnt;
+            if (0 == result)
+            {
+                aeron_array_fast_unordered_remove(
+                    (uint8_t *)endpoint->stream_ranges.array, sizeof(aeron_stream_range_refcnt_t), i, length - 1);
+                endpoint->stream_ranges.length--;
+
+                for (size_t j = 0; j < endpoint->shard_count; j++)
+                {
+                    aeron_receive_channel_endpoint_t *shard = endpoint->shards[j];
+
+                    aeron_driver_receiver_proxy_on_remove_subscription_range(
+                        shard->receiver_proxy, shard, stream_id_low, stream_id_high);
+                }
+
+                aeron_receive_channel_endpoint_close_if_unsubscribed(endpoint);
+            }
+
+            return result;
+        }
+    }
+
+    return 0;
+}
+
 int aeron_receive_channel_endpoint_on_add_subscription(
     aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id)
 {
@@ -442,6 +995,19 @@ int aeron_receive_channel_endpoint_on_remove_subscription(
     return aeron_data_packet_dispatcher_remove_subscription(&endpoint->dispatcher, stream_id);
 }
 
+int aeron_receive_channel_endpoint_on_add_subscription_range(
+    aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id_low, int32_t stream_id_high)
+{
+    return aeron_data_packet_dispatcher_add_subscription_range(&endpoint->dispatcher, stream_id_low, stream_id_high);
+}
+
+int aeron_receive_channel_endpoint_on_remove_subscription_range(
+    aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id_low, int32_t stream_id_high)
+{
+    return aeron_data_packet_dispatcher_remove_subscription_range(
+        &endpoint->dispatcher, stream_id_low, stream_id_high);
+}
+
 int aeron_receive_channel_endpoint_on_add_publication_image(
     aeron_receive_channel_endpoint_t *endpoint, aeron_publication_image_t *image)
 {
@@ -509,3 +1075,5 @@ extern size_t aeron_receive_channel_endpoint_stream_count(aeron_receive_channel_
 extern void aeron_receive_channel_endpoint_receiver_release(aeron_receive_channel_endpoint_t *endpoint);
 extern bool aeron_receive_channel_endpoint_has_receiver_released(aeron_receive_channel_endpoint_t *endpoint);
 extern bool aeron_receive_channel_endpoint_should_elicit_setup_message(aeron_receive_channel_endpoint_t *endpoint);
+extern aeron_receive_channel_endpoint_t *aeron_receive_channel_endpoint_parent(
+    aeron_receive_channel_endpoint_t *endpoint);
@@ -31,12 +31,23 @@ typedef enum aeron_receive_channel_endpoint_status_enum
 }
 aeron_receive_channel_endpoint_status_t;
 
+#define AERON_RECEIVE_CHANNEL_ENDPOINT_CONTROL_BATCH_LENGTH (32)
+#define AERON_RECEIVE_CHANNEL_ENDPOINT_CONTROL_FRAME_MAX_LENGTH (64)
+
 typedef struct aeron_stream_id_refcnt_stct
 {
     int32_t refcnt;
 }
 aeron_stream_id_refcnt_t;
 
+typedef struct aeron_stream_range_refcnt_stct
+{
+    int32_t stream_id_low;
+    int32_t stream_id_high;
+    int32_t refcnt;
+}
+aeron_stream_range_refcnt_t;
+
 typedef struct aeron_receive_channel_endpoint_stct
 {
     struct aeron_receive_channel_endpoint_conductor_fields_stct
@@ -50,16 +61,57 @@ typedef struct aeron_receive_channel_endpoint_stct
     /* uint8_t conductor_fields_pad[(2 * AERON_CACHE_LINE_LENGTH) - sizeof(struct conductor_fields_stct)]; */
 
     aeron_udp_channel_transport_t transport;
+    /* joined to the control group of a multicast channel to overhear the NAKs of other receivers, fd -1 if not */
+    aeron_udp_channel_transport_t control_transport;
     aeron_data_packet_dispatcher_t dispatcher;
     aeron_int64_to_ptr_hash_map_t stream_id_to_refcnt_map;
+    /* subscriptions with a streams param, each distinct range counted once however many subscriptions share it */
+    struct aeron_receive_channel_endpoint_stream_ranges_stct
+    {
+        aeron_stream_range_refcnt_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    stream_ranges;
     aeron_counter_t channel_status;
     aeron_driver_receiver_proxy_t *receiver_proxy;
     int64_t receiver_id;
+    int64_t group_tag;
     size_t so_rcvbuf;
+    /* kernel drops for a full receive buffer, the counter is allocated by the conductor when drop_monitoring is on */
+    aeron_counter_t socket_drops;
+    uint32_t last_socket_drops;
+    size_t so_rcvbuf_requested;
+    size_t so_rcvbuf_max;
+    bool drop_monitoring;
+    bool has_group_tag;
     bool has_receiver_released;
+    /* images stamp the receive time into the reserved value of each data frame */
+    bool receive_timestamp;
+    /* datagrams of data frames are dropped unless each frame has the checksum the sender stamped into it */
+    bool checksum;
 
     int64_t *short_sends_counter;
     int64_t *possible_ttl_asymmetry_counter;
+    int64_t *checksum_failures_counter;
+
+    /* SMs, NAKs and RTTMs are queued here during a receiver duty cycle and sent with one sendmmsg at its end */
+    struct aeron_receive_channel_endpoint_control_batch_stct
+    {
+        size_t length;
+        uint8_t *frames;
+        struct mmsghdr *mmsghdrs;
+        struct iovec *iov;
+        struct sockaddr_storage *addrs;
+    }
+    control_batch;
+
+    /* with receiver-shards the sessions of a unicast channel are steered over several shards, each a full endpoint
+     * with its own socket in the SO_REUSEPORT group of the port and its own receiver. The endpoint the conductor
+     * knows is the first shard and holds them all, the others have it as their parent. */
+    struct aeron_receive_channel_endpoint_stct *shards[AERON_DRIVER_RECEIVER_MAX_COUNT];
+    size_t shard_count;
+    struct aeron_receive_channel_endpoint_stct *parent;
 }
 aeron_receive_channel_endpoint_t;
 
@@ -73,8 +125,21 @@ int aeron_receive_channel_endpoint_create(
 int aeron_receive_channel_endpoint_delete(
     aeron_counters_manager_t *counters_manager, aeron_receive_channel_endpoint_t *endpoint);
 
+/*
+ * Add the datagrams the kernel has dropped since the last check to the socket drops counter and, if there were any,
+ * double the socket receive buffer up to so_rcvbuf_max. Returns the number of drops.
+ */
+int aeron_receive_channel_endpoint_check_socket_drops(aeron_receive_channel_endpoint_t *endpoint);
+
 int aeron_receive_channel_endpoint_sendmsg(aeron_receive_channel_endpoint_t *endpoint, struct msghdr *msghdr);
 
+/*
+ * Send the control frames queued by the send functions below since the last flush. The receiver flushes each of its
+ * endpoints at the end of a duty cycle and a full batch is flushed before the next frame is queued. Returns the
+ * number of frames sent.
+ */
+int aeron_receive_channel_endpoint_flush(aeron_receive_channel_endpoint_t *endpoint);
+
 int aeron_receive_channel_endpoint_send_sm(
     aeron_receive_channel_endpoint_t *endpoint,
     struct sockaddr_storage *addr,
@@ -106,22 +171,47 @@ int aeron_receive_channel_endpoint_send_rttm(
 void aeron_receive_channel_endpoint_dispatch(
     void *receiver_clientd, void *endpoint_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
 
+/*
+ * Inserts the data frames aeron_receive_channel_endpoint_dispatch deferred while the transport was in a recvmmsg
+ * batch, see aeron_udp_channel_transport_t.recv_batch_end_func.
+ */
+void aeron_receive_channel_endpoint_dispatch_batch_end(void *receiver_clientd, void *endpoint_clientd);
+
 int aeron_receive_channel_endpoint_on_data(
     aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
 
 int aeron_receive_channel_endpoint_on_setup(
     aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
 
+int aeron_receive_channel_endpoint_on_nak(
+    aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
+
 int aeron_receive_channel_endpoint_on_rttm(
     aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
 
+int aeron_receive_channel_endpoint_on_fec(
+    aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
+
 int32_t aeron_receive_channel_endpoint_incref_to_stream(aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id);
 int32_t aeron_receive_channel_endpoint_decref_to_stream(aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id);
 
+/*
+ * Count a subscription to the inclusive range of stream ids from stream_id_low to stream_id_high, a single stream id
+ * being counted as by the functions above. Returns the count for the range.
+ */
+int32_t aeron_receive_channel_endpoint_incref_to_stream_range(
+    aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id_low, int32_t stream_id_high);
+int32_t aeron_receive_channel_endpoint_decref_to_stream_range(
+    aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id_low, int32_t stream_id_high);
+
 int aeron_receive_channel_endpoint_on_add_subscription(
     aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id);
 int aeron_receive_channel_endpoint_on_remove_subscription(
     aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id);
+int aeron_receive_channel_endpoint_on_add_subscription_range(
+    aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id_low, int32_t stream_id_high);
+int aeron_receive_channel_endpoint_on_remove_subscription_range(
+    aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id_low, int32_t stream_id_high);
 int aeron_receive_channel_endpoint_on_add_publication_image(
     aeron_receive_channel_endpoint_t *endpoint, aeron_publication_image_t *image);
 int aeron_receive_channel_endpoint_on_remove_publication_image(
@@ -149,10 +239,28 @@ inline void aeron_receive_channel_endpoint_receiver_release(aeron_receive_channe
 
 inline bool aeron_receive_channel_endpoint_has_receiver_released(aeron_receive_channel_endpoint_t *endpoint)
 {
-    bool has_receiver_released;
-    AERON_GET_VOLATILE(has_receiver_released, endpoint->has_receiver_released);
+    for (size_t i = 0; i < endpoint->shard_count; i++)
+    {
+        bool has_receiver_released;
+        AERON_GET_VOLATILE(has_receiver_released, endpoint->shards[i]->has_receiver_released);
 
-    return has_receiver_released;
+        if (!has_receiver_released)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * The endpoint the conductor knows a shard by, for matching images to subscriptions. NULL for NULL, as the endpoint
+ * of an image is once it has been disconnected.
+ */
+inline aeron_receive_channel_endpoint_t *aeron_receive_channel_endpoint_parent(
+    aeron_receive_channel_endpoint_t *endpoint)
+{
+    return NULL != endpoint && NULL != endpoint->parent ? endpoint->parent : endpoint;
 }
 
 inline bool aeron_receive_channel_endpoint_should_elicit_setup_message(aeron_receive_channel_endpoint_t *endpoint)
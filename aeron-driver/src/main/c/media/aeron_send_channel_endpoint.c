@@ -29,6 +29,8 @@
 #include "util/aeron_error.h"
 #include "aeron_alloc.h"
 #include "media/aeron_send_channel_endpoint.h"
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
@@ -45,6 +47,19 @@ int aeron_send_channel_endpoint_create(
     aeron_driver_context_t *context)
 {
     aeron_send_channel_endpoint_t *_endpoint = NULL;
+    int32_t sender_affinity = -1;
+    bool pmtu_discovery = context->pmtu_discovery;
+    bool checksum = false;
+    int64_t coalesce_window_ns = 0;
+    size_t coalesce_batch_length = 0;
+
+    if (aeron_uri_sender_affinity(&channel->uri, &sender_affinity) < 0 ||
+        aeron_uri_pmtu_discovery(&channel->uri, &pmtu_discovery) < 0 ||
+        aeron_uri_checksum(&channel->uri, &checksum) < 0 ||
+        aeron_uri_coalesce(&channel->uri, &coalesce_window_ns, &coalesce_batch_length) < 0)
+    {
+        return -1;
+    }
 
     if (aeron_alloc((void **)&_endpoint, sizeof(aeron_send_channel_endpoint_t)) < 0)
     {
@@ -85,21 +100,79 @@ int aeron_send_channel_endpoint_create(
     _endpoint->conductor_fields.managed_resource.registration_id = -1;
     _endpoint->conductor_fields.status = AERON_SEND_CHANNEL_ENDPOINT_STATUS_ACTIVE;
     _endpoint->transport.fd = -1;
+    _endpoint->transport.recv_timestamp_ns = 0;
+    _endpoint->transport.is_connected = false;
+    _endpoint->path_transports_length = 0;
+    _endpoint->next_stripe_path = 0;
     _endpoint->channel_status.counter_id = -1;
 
-    if (aeron_udp_channel_transport_init(
+    if ((_endpoint->transport.bindings = aeron_udp_channel_transport_bindings_for_uri(
+        &channel->uri, context->udp_channel_transport_bindings)) == NULL)
+    {
+        aeron_send_channel_endpoint_delete(NULL, _endpoint);
+        return -1;
+    }
+
+    if (_endpoint->transport.bindings->init_func(
         &_endpoint->transport,
         (channel->multicast) ? &channel->remote_control : &channel->local_control,
         (channel->multicast) ? &channel->local_control : &channel->remote_control,
         channel->interface_index,
         (0 != channel->multicast_ttl) ? channel->multicast_ttl : context->multicast_ttl,
         context->socket_rcvbuf,
-        context->socket_sndbuf) < 0)
+        context->socket_sndbuf,
+        false,
+        0,
+        false,
+        false,
+        (context->socket_connected_send && !channel->multicast && NULL == _endpoint->destination_tracker) ?
+            &channel->remote_data : NULL) < 0)
     {
         aeron_send_channel_endpoint_delete(NULL, _endpoint);
         return -1;
     }
 
+    for (size_t i = 1; i < channel->path_count; i++)
+    {
+        aeron_udp_channel_transport_t *path_transport = &_endpoint->path_transports[i - 1];
+
+        path_transport->fd = -1;
+        path_transport->recv_timestamp_ns = 0;
+        path_transport->is_connected = false;
+        path_transport->bindings = _endpoint->transport.bindings;
+
+        if (path_transport->bindings->init_func(
+            path_transport,
+            &channel->path_local_data[i],
+            &channel->path_remote_data[i],
+            0,
+            context->multicast_ttl,
+            context->socket_rcvbuf,
+            context->socket_sndbuf,
+            false,
+            0,
+            false,
+            false,
+            NULL) < 0)
+        {
+            aeron_send_channel_endpoint_delete(NULL, _endpoint);
+            return -1;
+        }
+
+        path_transport->dispatch_clientd = _endpoint;
+        _endpoint->path_transports_length++;
+    }
+
+    _endpoint->pmtu_discovery =
+        pmtu_discovery &&
+        !channel->multicast &&
+        NULL == _endpoint->destination_tracker &&
+        1 == channel->path_count &&
+        aeron_udp_channel_transport_set_pmtu_probe(&_endpoint->transport, channel->remote_data.ss_family) >= 0;
+    _endpoint->checksum = checksum;
+    _endpoint->coalesce_window_ns = coalesce_window_ns;
+    _endpoint->coalesce_batch_length = coalesce_batch_length;
+
     if (aeron_int64_to_ptr_hash_map_init(
         &_endpoint->publication_dispatch_map, 8, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
@@ -113,7 +186,8 @@ int aeron_send_channel_endpoint_create(
     _endpoint->channel_status.counter_id = status_indicator->counter_id;
     _endpoint->channel_status.value_addr = status_indicator->value_addr;
 
-    _endpoint->sender_proxy = context->sender_proxy;
+    _endpoint->sender_proxy = aeron_driver_sender_proxy_select(context, sender_affinity);
+    _endpoint->sender_proxy->endpoint_count++;
 
     *endpoint = _endpoint;
     return 0;
@@ -128,7 +202,21 @@ int aeron_send_channel_endpoint_delete(aeron_counters_manager_t *counters_manage
 
     aeron_int64_to_ptr_hash_map_delete(&endpoint->publication_dispatch_map);
     aeron_udp_channel_delete(endpoint->conductor_fields.udp_channel);
-    aeron_udp_channel_transport_close(&endpoint->transport);
+
+    if (NULL != endpoint->sender_proxy)
+    {
+        endpoint->sender_proxy->endpoint_count--;
+    }
+
+    if (NULL != endpoint->transport.bindings)
+    {
+        endpoint->transport.bindings->close_func(&endpoint->transport);
+    }
+
+    for (size_t i = 0; i < endpoint->path_transports_length; i++)
+    {
+        endpoint->path_transports[i].bindings->close_func(&endpoint->path_transports[i]);
+    }
 
     if (NULL != endpoint->destination_tracker)
     {
@@ -159,19 +247,68 @@ void aeron_send_channel_endpoint_decref(void *clientd)
     }
 }
 
+static int aeron_send_channel_path_sendmmsg(
+    aeron_send_channel_endpoint_t *endpoint, size_t path, struct mmsghdr *mmsghdr, size_t vlen)
+{
+    aeron_udp_channel_transport_t *transport = 0 == path ? &endpoint->transport : &endpoint->path_transports[path - 1];
+    struct sockaddr_storage *remote_data = &endpoint->conductor_fields.udp_channel->path_remote_data[path];
+    const bool is_connected = transport->is_connected;
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        mmsghdr[i].msg_hdr.msg_name = is_connected ? NULL : remote_data;
+        mmsghdr[i].msg_hdr.msg_namelen = is_connected ? 0 : AERON_ADDR_LEN(remote_data);
+    }
+
+    return transport->bindings->sendmmsg_func(transport, mmsghdr, vlen);
+}
+
+/*
+ * Send down the next path of a striped channel, or down every path with the result of path 0, which then governs
+ * progress while the other paths are best effort.
+ */
+static int aeron_send_channel_multipath_sendmmsg(
+    aeron_send_channel_endpoint_t *endpoint, struct mmsghdr *mmsghdr, size_t vlen)
+{
+    aeron_udp_channel_t *channel = endpoint->conductor_fields.udp_channel;
+
+    if (channel->is_striped)
+    {
+        const size_t path = endpoint->next_stripe_path;
+
+        endpoint->next_stripe_path = path + 1 < channel->path_count ? path + 1 : 0;
+
+        return aeron_send_channel_path_sendmmsg(endpoint, path, mmsghdr, vlen);
+    }
+
+    for (size_t path = channel->path_count - 1; path > 0; path--)
+    {
+        aeron_send_channel_path_sendmmsg(endpoint, path, mmsghdr, vlen);
+    }
+
+    return aeron_send_channel_path_sendmmsg(endpoint, 0, mmsghdr, vlen);
+}
+
 int aeron_send_channel_sendmmsg(aeron_send_channel_endpoint_t *endpoint, struct mmsghdr *mmsghdr, size_t vlen)
 {
     int result = 0;
 
-    if (NULL == endpoint->destination_tracker)
+    if (endpoint->path_transports_length > 0)
     {
+        result = aeron_send_channel_multipath_sendmmsg(endpoint, mmsghdr, vlen);
+    }
+    else if (NULL == endpoint->destination_tracker)
+    {
+        struct sockaddr_storage *remote_data = &endpoint->conductor_fields.udp_channel->remote_data;
+        const bool is_connected = endpoint->transport.is_connected;
+
         for (size_t i = 0; i < vlen; i++)
         {
-            mmsghdr[i].msg_hdr.msg_name = &endpoint->conductor_fields.udp_channel->remote_data;
-            mmsghdr[i].msg_hdr.msg_namelen = AERON_ADDR_LEN(&endpoint->conductor_fields.udp_channel->remote_data);
+            mmsghdr[i].msg_hdr.msg_name = is_connected ? NULL : remote_data;
+            mmsghdr[i].msg_hdr.msg_namelen = is_connected ? 0 : AERON_ADDR_LEN(remote_data);
         }
 
-        result = aeron_udp_channel_transport_sendmmsg(&endpoint->transport, mmsghdr, vlen);
+        result = endpoint->transport.bindings->sendmmsg_func(&endpoint->transport, mmsghdr, vlen);
     }
     else
     {
@@ -186,12 +323,28 @@ int aeron_send_channel_sendmsg(aeron_send_channel_endpoint_t *endpoint, struct m
 {
     int result = 0;
 
-    if (NULL == endpoint->destination_tracker)
+    if (endpoint->path_transports_length > 0)
+    {
+        struct mmsghdr mmsghdr;
+
+        mmsghdr.msg_hdr = *msghdr;
+        mmsghdr.msg_len = 0;
+
+        result = aeron_send_channel_multipath_sendmmsg(endpoint, &mmsghdr, 1);
+        if (result > 0)
+        {
+            result = (int)mmsghdr.msg_len;
+        }
+    }
+    else if (NULL == endpoint->destination_tracker)
     {
-        msghdr->msg_name = &endpoint->conductor_fields.udp_channel->remote_data;
-        msghdr->msg_namelen = AERON_ADDR_LEN(&endpoint->conductor_fields.udp_channel->remote_data);
+        struct sockaddr_storage *remote_data = &endpoint->conductor_fields.udp_channel->remote_data;
+        const bool is_connected = endpoint->transport.is_connected;
+
+        msghdr->msg_name = is_connected ? NULL : remote_data;
+        msghdr->msg_namelen = is_connected ? 0 : AERON_ADDR_LEN(remote_data);
 
-        result = aeron_udp_channel_transport_sendmsg(&endpoint->transport, msghdr);
+        result = endpoint->transport.bindings->sendmsg_func(&endpoint->transport, msghdr);
     }
     else
     {
@@ -243,7 +396,7 @@ void aeron_send_channel_endpoint_dispatch(
             if (length >= sizeof(aeron_nak_header_t))
             {
                 aeron_send_channel_endpoint_on_nak(endpoint, buffer, length, addr);
-                aeron_counter_ordered_increment(sender->nak_messages_received_counter, 1);
+                aeron_counter_increment(sender->nak_messages_received_counter, 1);
             }
             else
             {
@@ -254,8 +407,8 @@ void aeron_send_channel_endpoint_dispatch(
         case AERON_HDR_TYPE_SM:
             if (length >= sizeof(aeron_status_message_header_t))
             {
-                aeron_send_channel_endpoint_on_status_message(endpoint, buffer, length, addr);
-                aeron_counter_ordered_increment(sender->status_messages_received_counter, 1);
+                aeron_send_channel_endpoint_on_status_message(endpoint, sender, buffer, length, addr);
+                aeron_counter_increment(sender->status_messages_received_counter, 1);
             }
             else
             {
@@ -303,7 +456,11 @@ void aeron_send_channel_endpoint_publication_trigger_send_setup_frame(
 }
 
 void aeron_send_channel_endpoint_on_status_message(
-    aeron_send_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    aeron_send_channel_endpoint_t *endpoint,
+    aeron_driver_sender_t *sender,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
 {
     aeron_status_message_header_t *sm_header = (aeron_status_message_header_t *)buffer;
     int64_t key_value =
@@ -334,7 +491,7 @@ void aeron_send_channel_endpoint_on_status_message(
         }
         else
         {
-            aeron_network_publication_on_status_message(publication, buffer, length, addr);
+            aeron_driver_sender_on_status_message(sender, publication, buffer, length, addr);
         }
     }
 }
@@ -33,6 +33,8 @@ typedef enum aeron_send_channel_endpoint_status_enum
 }
 aeron_send_channel_endpoint_status_t;
 
+struct aeron_driver_sender_stct;
+
 typedef struct aeron_send_channel_endpoint_stct
 {
     struct aeron_send_channel_endpoint_conductor_fields_stct
@@ -48,11 +50,24 @@ typedef struct aeron_send_channel_endpoint_stct
     /* uint8_t conductor_fields_pad[(2 * AERON_CACHE_LINE_LENGTH) - sizeof(struct conductor_fields_stct)]; */
 
     aeron_udp_channel_transport_t transport;
+
+    /* transports of paths 1 and on of a multi-path channel, path 0 being transport */
+    aeron_udp_channel_transport_t path_transports[AERON_UDP_CHANNEL_MAX_PATHS - 1];
+    size_t path_transports_length;
+    size_t next_stripe_path;
+
     aeron_int64_to_ptr_hash_map_t publication_dispatch_map;
     aeron_counter_t channel_status;
     aeron_udp_destination_tracker_t *destination_tracker;
     aeron_driver_sender_proxy_t *sender_proxy;
+    /* publications discover the path MTU, only for a single unicast destination whose socket could be set to probe */
+    bool pmtu_discovery;
+    /* publications stamp a checksum into the data frames they send, see aeron_frame_checksum.h */
+    bool checksum;
     bool has_sender_released;
+    /* publications hold back a send of less than the batch length for up to the window, see aeron_uri_coalesce */
+    int64_t coalesce_window_ns;
+    size_t coalesce_batch_length;
 }
 aeron_send_channel_endpoint_t;
 
@@ -83,7 +98,11 @@ void aeron_send_channel_endpoint_on_nak(
     aeron_send_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
 
 void aeron_send_channel_endpoint_on_status_message(
-    aeron_send_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
+    aeron_send_channel_endpoint_t *endpoint,
+    struct aeron_driver_sender_stct *sender,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
 
 void aeron_send_channel_endpoint_on_rttm(
     aeron_send_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
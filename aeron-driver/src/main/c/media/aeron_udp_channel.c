@@ -177,6 +177,156 @@ int aeron_uri_udp_canonicalize(
         canonical_form, length, "UDP-%s-%d-%s-%d", local_data_str, local_data_port, remote_data_str, remote_data_port);
 }
 
+static bool aeron_udp_channel_is_list(const char *value)
+{
+    return NULL != value && NULL != strchr(value, ',');
+}
+
+/*
+ * Split a comma separated parameter value into at most AERON_UDP_CHANNEL_MAX_PATHS values. Returns the count.
+ */
+static int aeron_udp_channel_split_list(
+    const char *key, const char *value, char values[AERON_UDP_CHANNEL_MAX_PATHS][AERON_MAX_PATH])
+{
+    int count = 0;
+
+    for (const char *start = value; NULL != start; count++)
+    {
+        const char *end = strchr(start, ',');
+        const size_t length = NULL != end ? (size_t)(end - start) : strlen(start);
+
+        if (count >= AERON_UDP_CHANNEL_MAX_PATHS || 0 == length || length >= AERON_MAX_PATH)
+        {
+            aeron_set_err(
+                EINVAL, "%s=(%s) must be a list of at most %d values", key, value, AERON_UDP_CHANNEL_MAX_PATHS);
+            return -1;
+        }
+
+        memcpy(values[count], start, length);
+        values[count][length] = '\0';
+        start = NULL != end ? end + 1 : NULL;
+    }
+
+    return count;
+}
+
+/*
+ * Resolve the paths of a unicast channel with a list of interfaces and/or endpoints. Either list may have a single
+ * value that applies to every path, otherwise both have the same length.
+ */
+static int aeron_udp_channel_parse_paths(aeron_udp_channel_t *channel)
+{
+    char endpoints[AERON_UDP_CHANNEL_MAX_PATHS][AERON_MAX_PATH];
+    char interfaces[AERON_UDP_CHANNEL_MAX_PATHS][AERON_MAX_PATH];
+    const char *endpoint_key = channel->uri.params.udp.endpoint_key;
+    const char *interface_key = channel->uri.params.udp.interface_key;
+    const char *multipath =
+        aeron_uri_find_param_value(&channel->uri.params.udp.additional_params, AERON_UDP_CHANNEL_MULTIPATH_KEY);
+    int num_interfaces = 0;
+
+    if (NULL == endpoint_key || NULL != channel->uri.params.udp.control_key)
+    {
+        aeron_set_err(EINVAL, "%s", "multi-path channels need an endpoint and no control address");
+        return -1;
+    }
+
+    const int num_endpoints = aeron_udp_channel_split_list(AERON_UDP_CHANNEL_ENDPOINT_KEY, endpoint_key, endpoints);
+    if (num_endpoints < 0)
+    {
+        return -1;
+    }
+
+    if (NULL != interface_key &&
+        (num_interfaces = aeron_udp_channel_split_list(
+            AERON_UDP_CHANNEL_INTERFACE_KEY, interface_key, interfaces)) < 0)
+    {
+        return -1;
+    }
+
+    const int path_count = num_endpoints > num_interfaces ? num_endpoints : num_interfaces;
+
+    if ((num_endpoints > 1 && num_endpoints != path_count) || (num_interfaces > 1 && num_interfaces != path_count))
+    {
+        aeron_set_err(
+            EINVAL, "endpoint=(%s) and interface=(%s) lists differ in length", endpoint_key, interface_key);
+        return -1;
+    }
+
+    if (NULL != multipath &&
+        strcmp(multipath, AERON_UDP_CHANNEL_MULTIPATH_STRIPE_VALUE) != 0 &&
+        strcmp(multipath, AERON_UDP_CHANNEL_MULTIPATH_DUPLICATE_VALUE) != 0)
+    {
+        aeron_set_err(EINVAL, "%s=(%s) must be %s or %s", AERON_UDP_CHANNEL_MULTIPATH_KEY, multipath,
+            AERON_UDP_CHANNEL_MULTIPATH_DUPLICATE_VALUE, AERON_UDP_CHANNEL_MULTIPATH_STRIPE_VALUE);
+        return -1;
+    }
+
+    for (int i = 0; i < path_count; i++)
+    {
+        const char *endpoint_str = endpoints[num_endpoints > 1 ? i : 0];
+        const char *interface_str = 0 == num_interfaces ? NULL : interfaces[num_interfaces > 1 ? i : 0];
+        unsigned int interface_index = 0;
+
+        if (aeron_host_and_port_parse_and_resolve(endpoint_str, &channel->path_remote_data[i]) < 0)
+        {
+            aeron_set_err(
+                aeron_errcode(), "could not resolve endpoint address=(%s): %s", endpoint_str, aeron_errmsg());
+            return -1;
+        }
+
+        if (aeron_is_addr_multicast(&channel->path_remote_data[i]))
+        {
+            aeron_set_err(EINVAL, "multi-path channels are unicast: %s", endpoint_str);
+            return -1;
+        }
+
+        if (aeron_find_unicast_interface(
+            channel->path_remote_data[i].ss_family, interface_str, &channel->path_local_data[i], &interface_index) < 0)
+        {
+            return -1;
+        }
+
+        if (0 == i)
+        {
+            channel->interface_index = interface_index;
+        }
+    }
+
+    channel->path_count = (size_t)path_count;
+    channel->is_striped = NULL != multipath && strcmp(multipath, AERON_UDP_CHANNEL_MULTIPATH_STRIPE_VALUE) == 0;
+    channel->multicast_ttl = 0;
+    memcpy(&channel->remote_data, &channel->path_remote_data[0], sizeof(struct sockaddr_storage));
+    memcpy(&channel->remote_control, &channel->path_remote_data[0], sizeof(struct sockaddr_storage));
+    memcpy(&channel->local_data, &channel->path_local_data[0], sizeof(struct sockaddr_storage));
+    memcpy(&channel->local_control, &channel->path_local_data[0], sizeof(struct sockaddr_storage));
+
+    /* every path is part of the canonical form so a channel only shares an endpoint with the same paths */
+    size_t length = 0;
+    for (int i = 0; i < path_count && length < sizeof(channel->canonical_form); i++)
+    {
+        if (i > 0)
+        {
+            channel->canonical_form[length++] = '+';
+        }
+
+        aeron_uri_udp_canonicalize(
+            channel->canonical_form + length,
+            sizeof(channel->canonical_form) - length,
+            &channel->path_local_data[i],
+            &channel->path_remote_data[i]);
+        length = strlen(channel->canonical_form);
+    }
+
+    if (channel->is_striped && length < sizeof(channel->canonical_form))
+    {
+        snprintf(channel->canonical_form + length, sizeof(channel->canonical_form) - length, "-stripe");
+    }
+
+    channel->canonical_length = strlen(channel->canonical_form);
+
+    return 0;
+}
+
 int aeron_udp_channel_parse(const char *uri, size_t uri_length, aeron_udp_channel_t **channel)
 {
     aeron_udp_channel_t *_channel = NULL;
@@ -202,6 +352,11 @@ int aeron_udp_channel_parse(const char *uri, size_t uri_length, aeron_udp_channe
     _channel->uri_length = uri_length;
     _channel->explicit_control = false;
     _channel->multicast = false;
+    _channel->path_count = 1;
+    _channel->is_striped = false;
+    _channel->tag = 0;
+    _channel->has_tag = false;
+    _channel->is_tag_reference = false;
 
     if (_channel->uri.type != AERON_URI_UDP)
     {
@@ -209,6 +364,35 @@ int aeron_udp_channel_parse(const char *uri, size_t uri_length, aeron_udp_channe
         goto error_cleanup;
     }
 
+    if (aeron_uri_channel_tag(&_channel->uri, &_channel->has_tag, &_channel->tag) < 0)
+    {
+        goto error_cleanup;
+    }
+
+    if (_channel->has_tag &&
+        NULL == _channel->uri.params.udp.endpoint_key &&
+        NULL == _channel->uri.params.udp.control_key)
+    {
+        _channel->is_tag_reference = true;
+        _channel->canonical_form[0] = '\0';
+        _channel->canonical_length = 0;
+
+        *channel = _channel;
+        return 0;
+    }
+
+    if (aeron_udp_channel_is_list(_channel->uri.params.udp.endpoint_key) ||
+        aeron_udp_channel_is_list(_channel->uri.params.udp.interface_key))
+    {
+        if (aeron_udp_channel_parse_paths(_channel) < 0)
+        {
+            goto error_cleanup;
+        }
+
+        *channel = _channel;
+        return 0;
+    }
+
     if (NULL == _channel->uri.params.udp.endpoint_key && NULL == _channel->uri.params.udp.control_key)
     {
         aeron_set_err(EINVAL, "%s", "Aeron URIs for UDP must specify an endpoint address and/or a control address");
@@ -306,6 +490,24 @@ int aeron_udp_channel_parse(const char *uri, size_t uri_length, aeron_udp_channe
         return -1;
 }
 
+void aeron_udp_channel_adopt_addresses(aeron_udp_channel_t *channel, aeron_udp_channel_t *tagged_channel)
+{
+    memcpy(channel->canonical_form, tagged_channel->canonical_form, sizeof(channel->canonical_form));
+    channel->canonical_length = tagged_channel->canonical_length;
+    channel->remote_data = tagged_channel->remote_data;
+    channel->local_data = tagged_channel->local_data;
+    channel->remote_control = tagged_channel->remote_control;
+    channel->local_control = tagged_channel->local_control;
+    channel->interface_index = tagged_channel->interface_index;
+    channel->multicast_ttl = tagged_channel->multicast_ttl;
+    channel->explicit_control = tagged_channel->explicit_control;
+    channel->multicast = tagged_channel->multicast;
+    memcpy(channel->path_local_data, tagged_channel->path_local_data, sizeof(channel->path_local_data));
+    memcpy(channel->path_remote_data, tagged_channel->path_remote_data, sizeof(channel->path_remote_data));
+    channel->path_count = tagged_channel->path_count;
+    channel->is_striped = tagged_channel->is_striped;
+}
+
 void aeron_udp_channel_delete(aeron_udp_channel_t *channel)
 {
     if (NULL != channel)
@@ -314,3 +516,188 @@ void aeron_udp_channel_delete(aeron_udp_channel_t *channel)
         aeron_free(channel);
     }
 }
+
+typedef struct aeron_udp_channel_cache_entry_stct
+{
+    /* NULL when resolving the channel failed with errcode and errmsg */
+    aeron_udp_channel_t *channel;
+    int64_t expire_ns;
+    int errcode;
+    char errmsg[AERON_MAX_PATH];
+    size_t uri_length;
+    char uri[AERON_MAX_PATH];
+}
+aeron_udp_channel_cache_entry_t;
+
+static int aeron_udp_channel_copy(aeron_udp_channel_t *src, aeron_udp_channel_t **channel)
+{
+    aeron_udp_channel_t *_channel = NULL;
+
+    if (aeron_alloc((void **)&_channel, sizeof(aeron_udp_channel_t)) < 0)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not allocate UDP channel");
+        return -1;
+    }
+
+    memcpy(_channel, src, sizeof(aeron_udp_channel_t));
+    memset(&_channel->uri, 0, sizeof(_channel->uri));
+
+    if (aeron_uri_parse(src->original_uri, &_channel->uri) < 0)
+    {
+        aeron_udp_channel_delete(_channel);
+        return -1;
+    }
+
+    *channel = _channel;
+    return 0;
+}
+
+static void aeron_udp_channel_cache_entry_delete(aeron_udp_channel_cache_entry_t *entry)
+{
+    aeron_udp_channel_delete(entry->channel);
+    aeron_free(entry);
+}
+
+static void aeron_udp_channel_cache_entry_delete_func(void *clientd, const char *key, size_t key_len, void *value)
+{
+    aeron_udp_channel_cache_entry_delete((aeron_udp_channel_cache_entry_t *)value);
+}
+
+int aeron_udp_channel_cache_init(aeron_udp_channel_cache_t *cache, int64_t ttl_ns)
+{
+    cache->ttl_ns = ttl_ns;
+
+    return aeron_str_to_ptr_hash_map_init(&cache->entry_by_uri_map, 64, AERON_STR_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR);
+}
+
+void aeron_udp_channel_cache_close(aeron_udp_channel_cache_t *cache)
+{
+    aeron_str_to_ptr_hash_map_for_each(&cache->entry_by_uri_map, aeron_udp_channel_cache_entry_delete_func, NULL);
+    aeron_str_to_ptr_hash_map_delete(&cache->entry_by_uri_map);
+}
+
+static void aeron_udp_channel_cache_clear(aeron_udp_channel_cache_t *cache)
+{
+    aeron_str_to_ptr_hash_map_for_each(&cache->entry_by_uri_map, aeron_udp_channel_cache_entry_delete_func, NULL);
+    memset(cache->entry_by_uri_map.keys, 0, cache->entry_by_uri_map.capacity * sizeof(aeron_str_to_ptr_hash_map_key_t));
+    memset(cache->entry_by_uri_map.values, 0, cache->entry_by_uri_map.capacity * sizeof(void *));
+    cache->entry_by_uri_map.size = 0;
+}
+
+static aeron_udp_channel_cache_entry_t *aeron_udp_channel_cache_get(
+    aeron_udp_channel_cache_t *cache, const char *uri, size_t uri_length, int64_t now_ns)
+{
+    aeron_udp_channel_cache_entry_t *entry = aeron_str_to_ptr_hash_map_get(&cache->entry_by_uri_map, uri, uri_length);
+
+    if (NULL != entry && now_ns >= entry->expire_ns)
+    {
+        aeron_str_to_ptr_hash_map_remove(&cache->entry_by_uri_map, uri, uri_length);
+        aeron_udp_channel_cache_entry_delete(entry);
+        entry = NULL;
+    }
+
+    return entry;
+}
+
+/* takes ownership of channel; failing to cache it only costs a resolution next time */
+static void aeron_udp_channel_cache_add(
+    aeron_udp_channel_cache_t *cache,
+    const char *uri,
+    size_t uri_length,
+    int64_t now_ns,
+    aeron_udp_channel_t *channel,
+    int errcode,
+    const char *errmsg)
+{
+    aeron_udp_channel_cache_entry_t *entry = NULL;
+
+    if (uri_length >= sizeof(entry->uri) || aeron_alloc((void **)&entry, sizeof(aeron_udp_channel_cache_entry_t)) < 0)
+    {
+        aeron_udp_channel_delete(channel);
+        return;
+    }
+
+    if (cache->entry_by_uri_map.size >= AERON_UDP_CHANNEL_CACHE_MAX_ENTRIES)
+    {
+        aeron_udp_channel_cache_clear(cache);
+    }
+
+    entry->channel = channel;
+    entry->expire_ns = now_ns + cache->ttl_ns;
+    entry->errcode = errcode;
+    strncpy(entry->errmsg, NULL == errmsg ? "" : errmsg, sizeof(entry->errmsg) - 1);
+    entry->uri_length = uri_length;
+    memcpy(entry->uri, uri, uri_length);
+    entry->uri[uri_length] = '\0';
+
+    if (aeron_str_to_ptr_hash_map_put(&cache->entry_by_uri_map, entry->uri, entry->uri_length, entry) < 0)
+    {
+        aeron_udp_channel_cache_entry_delete(entry);
+    }
+}
+
+int aeron_udp_channel_cache_parse(
+    aeron_udp_channel_cache_t *cache, const char *uri, size_t uri_length, int64_t now_ns, aeron_udp_channel_t **channel)
+{
+    if (0 == cache->ttl_ns)
+    {
+        return aeron_udp_channel_parse(uri, uri_length, channel);
+    }
+
+    aeron_udp_channel_cache_entry_t *entry = aeron_udp_channel_cache_get(cache, uri, uri_length, now_ns);
+    aeron_udp_channel_t *cached_channel = NULL;
+
+    if (NULL != entry)
+    {
+        if (NULL == entry->channel)
+        {
+            aeron_set_err(entry->errcode, "%s", entry->errmsg);
+            return -1;
+        }
+
+        return aeron_udp_channel_copy(entry->channel, channel);
+    }
+
+    if (aeron_udp_channel_parse(uri, uri_length, channel) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_udp_channel_copy(*channel, &cached_channel) == 0)
+    {
+        aeron_udp_channel_cache_add(cache, uri, uri_length, now_ns, cached_channel, 0, NULL);
+    }
+
+    return 0;
+}
+
+bool aeron_udp_channel_cache_contains(
+    aeron_udp_channel_cache_t *cache, const char *uri, size_t uri_length, int64_t now_ns)
+{
+    return 0 != cache->ttl_ns && NULL != aeron_udp_channel_cache_get(cache, uri, uri_length, now_ns);
+}
+
+void aeron_udp_channel_cache_put(
+    aeron_udp_channel_cache_t *cache,
+    const char *uri,
+    size_t uri_length,
+    int64_t now_ns,
+    aeron_udp_channel_t *channel,
+    int errcode,
+    const char *errmsg)
+{
+    aeron_udp_channel_cache_entry_t *entry = aeron_str_to_ptr_hash_map_remove(&cache->entry_by_uri_map, uri, uri_length);
+
+    if (NULL != entry)
+    {
+        aeron_udp_channel_cache_entry_delete(entry);
+    }
+
+    if (0 == cache->ttl_ns)
+    {
+        aeron_udp_channel_delete(channel);
+        return;
+    }
+
+    aeron_udp_channel_cache_add(cache, uri, uri_length, now_ns, channel, errcode, errmsg);
+}
@@ -19,6 +19,9 @@
 
 #include <netinet/in.h>
 #include "uri/aeron_uri.h"
+#include "collections/aeron_str_to_ptr_hash_map.h"
+
+#define AERON_UDP_CHANNEL_MAX_PATHS (4)
 
 typedef struct aeron_udp_channel_stct
 {
@@ -35,10 +38,72 @@ typedef struct aeron_udp_channel_stct
     uint8_t multicast_ttl;
     bool explicit_control;
     bool multicast;
+
+    /*
+     * Paths of a unicast channel given comma separated interface and/or endpoint lists, path 0 being local_data and
+     * remote_data. Frames are duplicated down every path, or with multipath=stripe each batch goes down the next one.
+     */
+    struct sockaddr_storage path_local_data[AERON_UDP_CHANNEL_MAX_PATHS];
+    struct sockaddr_storage path_remote_data[AERON_UDP_CHANNEL_MAX_PATHS];
+    size_t path_count;
+    bool is_striped;
+
+    /*
+     * Tag set with tags=, with which later channels name the endpoint of this one. A channel with a tag and no
+     * endpoint or control address refers to the endpoint already tagged and takes its addresses from it.
+     */
+    int64_t tag;
+    bool has_tag;
+    bool is_tag_reference;
 }
 aeron_udp_channel_t;
 
+#define AERON_UDP_CHANNEL_CACHE_MAX_ENTRIES (1024)
+
+/*
+ * Channels parsed before, by original URI, so adding the same channel again does not resolve its addresses and
+ * interface again until the entry is older than the TTL. Each parse still hands out a channel of its own.
+ */
+typedef struct aeron_udp_channel_cache_stct
+{
+    aeron_str_to_ptr_hash_map_t entry_by_uri_map;
+    int64_t ttl_ns;
+}
+aeron_udp_channel_cache_t;
+
 int aeron_udp_channel_parse(const char *uri, size_t uri_length, aeron_udp_channel_t **channel);
 void aeron_udp_channel_delete(aeron_udp_channel_t *channel);
 
+/*
+ * Give a channel referring to a tag the addresses and canonical form of the tagged channel, so it matches the
+ * endpoint, publications and spies of that channel.
+ */
+void aeron_udp_channel_adopt_addresses(aeron_udp_channel_t *channel, aeron_udp_channel_t *tagged_channel);
+
+int aeron_udp_channel_cache_init(aeron_udp_channel_cache_t *cache, int64_t ttl_ns);
+void aeron_udp_channel_cache_close(aeron_udp_channel_cache_t *cache);
+
+/*
+ * Parse a channel as aeron_udp_channel_parse does, copying the resolved addresses of a cached entry younger than the
+ * TTL rather than resolving them again. Failures of this parse are not cached. A TTL of 0 disables the cache.
+ */
+int aeron_udp_channel_cache_parse(
+    aeron_udp_channel_cache_t *cache, const char *uri, size_t uri_length, int64_t now_ns, aeron_udp_channel_t **channel);
+
+bool aeron_udp_channel_cache_contains(
+    aeron_udp_channel_cache_t *cache, const char *uri, size_t uri_length, int64_t now_ns);
+
+/*
+ * Cache the outcome of parsing a channel elsewhere: the channel, which the cache then owns, or NULL with the error the
+ * parse gave so adds of a channel that cannot be resolved fail fast until the entry expires.
+ */
+void aeron_udp_channel_cache_put(
+    aeron_udp_channel_cache_t *cache,
+    const char *uri,
+    size_t uri_length,
+    int64_t now_ns,
+    aeron_udp_channel_t *channel,
+    int errcode,
+    const char *errmsg);
+
 #endif //AERON_AERON_UDP_CHANNEL_H
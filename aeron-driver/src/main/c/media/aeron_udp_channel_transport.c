@@ -25,10 +25,18 @@
 #include <net/if.h>
 #include <fcntl.h>
 #include <netinet/ip.h>
+#if defined(__linux__)
+#include <netinet/udp.h>
+#include <linux/net_tstamp.h>
+#include <linux/errqueue.h>
+#include <linux/filter.h>
+#endif
+#include <stddef.h>
 #include <errno.h>
 #include "util/aeron_error.h"
 #include "util/aeron_netutil.h"
 #include "aeron_udp_channel_transport.h"
+#include "protocol/aeron_udp_protocol.h"
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
@@ -38,20 +46,33 @@ struct mmsghdr
 };
 #endif
 
-int aeron_udp_channel_transport_init(
+static int aeron_udp_channel_transport_open(
     aeron_udp_channel_transport_t *transport,
     struct sockaddr_storage *bind_addr,
     struct sockaddr_storage *multicast_if_addr,
     unsigned int multicast_if_index,
     uint8_t ttl,
     size_t socket_rcvbuf,
-    size_t socket_sndbuf)
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr,
+    bool reuse_port)
 {
     bool is_ipv6, is_multicast;
     struct sockaddr_in *in4 = (struct sockaddr_in *)bind_addr;
     struct sockaddr_in6 *in6 = (struct sockaddr_in6 *)bind_addr;
 
     transport->fd = -1;
+    transport->recv_timestamp_ns = 0;
+    transport->socket_drops = 0;
+    transport->bindings_clientd = NULL;
+    transport->is_connected = false;
+    transport->recv_batch_end_func = NULL;
+    transport->recv_bytes_available = 0;
+    transport->in_recv_batch = false;
     if ((transport->fd = socket(bind_addr->ss_family, SOCK_DGRAM, 0)) < 0)
     {
         goto error;
@@ -63,6 +84,24 @@ int aeron_udp_channel_transport_init(
 
     if (!is_multicast)
     {
+        if (reuse_port)
+        {
+#if defined(SO_REUSEPORT)
+            int reuse = 1;
+
+            if (setsockopt(transport->fd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse)) < 0)
+            {
+                int errcode = errno;
+
+                aeron_set_err(errcode, "setsockopt(SO_REUSEPORT): %s", strerror(errcode));
+                goto error;
+            }
+#else
+            aeron_set_err(ENOTSUP, "SO_REUSEPORT: %s", strerror(ENOTSUP));
+            goto error;
+#endif
+        }
+
         if (bind(transport->fd, (struct sockaddr *)bind_addr, bind_addr_len) < 0)
         {
             int errcode = errno;
@@ -213,6 +252,95 @@ int aeron_udp_channel_transport_init(
         }
     }
 
+    if (use_gro)
+    {
+#if defined(UDP_GRO)
+        int gro = 1;
+
+        if (setsockopt(transport->fd, SOL_UDP, UDP_GRO, &gro, sizeof(gro)) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "setsockopt(UDP_GRO): %s", strerror(errcode));
+            goto error;
+        }
+#else
+        aeron_set_err(ENOTSUP, "UDP_GRO: %s", strerror(ENOTSUP));
+        goto error;
+#endif
+    }
+
+    if (busy_poll_us > 0)
+    {
+#if defined(SO_BUSY_POLL)
+        int busy_poll = (int)busy_poll_us;
+
+        if (setsockopt(transport->fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll, sizeof(busy_poll)) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "setsockopt(SO_BUSY_POLL): %s", strerror(errcode));
+            goto error;
+        }
+#else
+        aeron_set_err(ENOTSUP, "SO_BUSY_POLL: %s", strerror(ENOTSUP));
+        goto error;
+#endif
+    }
+
+    if (prefer_busy_poll)
+    {
+#if defined(SO_PREFER_BUSY_POLL)
+        int prefer = 1;
+
+        if (setsockopt(transport->fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer, sizeof(prefer)) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "setsockopt(SO_PREFER_BUSY_POLL): %s", strerror(errcode));
+            goto error;
+        }
+#else
+        aeron_set_err(ENOTSUP, "SO_PREFER_BUSY_POLL: %s", strerror(ENOTSUP));
+        goto error;
+#endif
+    }
+
+    if (use_rx_timestamping)
+    {
+#if defined(SO_TIMESTAMPING) && defined(__linux__)
+        int timestamping =
+            SOF_TIMESTAMPING_RX_HARDWARE |
+            SOF_TIMESTAMPING_RAW_HARDWARE |
+            SOF_TIMESTAMPING_RX_SOFTWARE |
+            SOF_TIMESTAMPING_SOFTWARE;
+
+        if (setsockopt(transport->fd, SOL_SOCKET, SO_TIMESTAMPING, &timestamping, sizeof(timestamping)) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "setsockopt(SO_TIMESTAMPING): %s", strerror(errcode));
+            goto error;
+        }
+#else
+        aeron_set_err(ENOTSUP, "SO_TIMESTAMPING: %s", strerror(ENOTSUP));
+        goto error;
+#endif
+    }
+
+    if (NULL != connect_addr)
+    {
+        if (connect(transport->fd, (struct sockaddr *)connect_addr, AERON_ADDR_LEN(connect_addr)) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "connect: %s", strerror(errcode));
+            goto error;
+        }
+
+        transport->is_connected = true;
+    }
+
     int flags;
 
     if ((flags = fcntl(transport->fd, F_GETFL, 0)) < 0)
@@ -240,6 +368,65 @@ int aeron_udp_channel_transport_init(
         return -1;
 }
 
+int aeron_udp_channel_transport_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr)
+{
+    return aeron_udp_channel_transport_open(
+        transport,
+        bind_addr,
+        multicast_if_addr,
+        multicast_if_index,
+        ttl,
+        socket_rcvbuf,
+        socket_sndbuf,
+        use_gro,
+        busy_poll_us,
+        prefer_busy_poll,
+        use_rx_timestamping,
+        connect_addr,
+        false);
+}
+
+int aeron_udp_channel_transport_init_reuse_port(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping)
+{
+    return aeron_udp_channel_transport_open(
+        transport,
+        bind_addr,
+        multicast_if_addr,
+        multicast_if_index,
+        ttl,
+        socket_rcvbuf,
+        socket_sndbuf,
+        use_gro,
+        busy_poll_us,
+        prefer_busy_poll,
+        use_rx_timestamping,
+        NULL,
+        true);
+}
+
 int aeron_udp_channel_transport_close(aeron_udp_channel_transport_t *transport)
 {
     if (transport->fd != -1)
@@ -250,6 +437,81 @@ int aeron_udp_channel_transport_close(aeron_udp_channel_transport_t *transport)
     return 0;
 }
 
+void aeron_udp_channel_transport_dispatch(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *msghdr,
+    size_t length,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    uint8_t *buffer = msghdr->msg_iov[0].iov_base;
+    size_t segment_length = length;
+
+    transport->recv_timestamp_ns = 0;
+
+#if defined(UDP_GRO) || defined(SO_TIMESTAMPING) || defined(SO_RXQ_OVFL)
+    if (msghdr->msg_controllen > 0)
+    {
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(msghdr); NULL != cmsg; cmsg = CMSG_NXTHDR(msghdr, cmsg))
+        {
+#if defined(UDP_GRO)
+            if (SOL_UDP == cmsg->cmsg_level && UDP_GRO == cmsg->cmsg_type)
+            {
+                int gso_size;
+
+                memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(gso_size));
+                if (gso_size > 0)
+                {
+                    segment_length = (size_t)gso_size;
+                }
+            }
+#endif
+#if defined(SO_TIMESTAMPING) && defined(__linux__)
+            if (SOL_SOCKET == cmsg->cmsg_level && SO_TIMESTAMPING == cmsg->cmsg_type)
+            {
+                struct scm_timestamping timestamping;
+
+                /* ts[2] is the raw hardware stamp, ts[0] the software one; prefer hardware when the NIC provides it */
+                memcpy(&timestamping, CMSG_DATA(cmsg), sizeof(timestamping));
+                struct timespec *ts =
+                    (0 != timestamping.ts[2].tv_sec || 0 != timestamping.ts[2].tv_nsec) ?
+                    &timestamping.ts[2] : &timestamping.ts[0];
+
+                transport->recv_timestamp_ns = ((int64_t)ts->tv_sec * 1000 * 1000 * 1000) + ts->tv_nsec;
+            }
+#endif
+#if defined(SO_RXQ_OVFL)
+            if (SOL_SOCKET == cmsg->cmsg_level && SO_RXQ_OVFL == cmsg->cmsg_type)
+            {
+                memcpy(&transport->socket_drops, CMSG_DATA(cmsg), sizeof(transport->socket_drops));
+            }
+#endif
+        }
+    }
+#endif
+
+    for (size_t offset = 0; offset < length; offset += segment_length)
+    {
+        size_t remaining = length - offset;
+
+        recv_func(
+            clientd,
+            transport->dispatch_clientd,
+            buffer + offset,
+            remaining < segment_length ? remaining : segment_length,
+            msghdr->msg_name);
+    }
+}
+
+static void aeron_udp_channel_transport_recv_batch_end(aeron_udp_channel_transport_t *transport, void *clientd)
+{
+    if (transport->in_recv_batch)
+    {
+        transport->in_recv_batch = false;
+        transport->recv_batch_end_func(clientd, transport->dispatch_clientd);
+    }
+}
+
 int aeron_udp_channel_transport_recvmmsg(
     aeron_udp_channel_transport_t *transport,
     struct mmsghdr *msgvec,
@@ -265,7 +527,8 @@ int aeron_udp_channel_transport_recvmmsg(
     {
         int err = errno;
 
-        if (EINTR == err || EAGAIN == err)
+        /* a connected socket reports an ICMP port unreachable from the peer as ECONNREFUSED on the next call */
+        if (EINTR == err || EAGAIN == err || ECONNREFUSED == err)
         {
             return 0;
         }
@@ -279,20 +542,22 @@ int aeron_udp_channel_transport_recvmmsg(
     }
     else
     {
+        transport->in_recv_batch = NULL != transport->recv_batch_end_func;
+
         for (size_t i = 0, length = result; i < length; i++)
         {
-            recv_func(
-                clientd,
-                transport->dispatch_clientd,
-                msgvec[i].msg_hdr.msg_iov[0].iov_base,
-                msgvec[i].msg_len,
-                msgvec[i].msg_hdr.msg_name);
+            aeron_udp_channel_transport_dispatch(transport, &msgvec[i].msg_hdr, msgvec[i].msg_len, recv_func, clientd);
         }
 
+        aeron_udp_channel_transport_recv_batch_end(transport, clientd);
+
         return result;
     }
 #else
     int work_count = 0;
+    int64_t bytes_remaining = transport->recv_bytes_available;
+
+    transport->in_recv_batch = NULL != transport->recv_batch_end_func;
 
     for (size_t i = 0, length = vlen; i < length; i++)
     {
@@ -302,11 +567,12 @@ int aeron_udp_channel_transport_recvmmsg(
         {
             int err = errno;
 
-            if (EINTR == err || EAGAIN == err)
+            if (EINTR == err || EAGAIN == err || ECONNREFUSED == err)
             {
                 break;
             }
 
+            aeron_udp_channel_transport_recv_batch_end(transport, clientd);
             aeron_set_err(err, "recvmsg: %s", strerror(err));
             return -1;
         }
@@ -316,15 +582,17 @@ int aeron_udp_channel_transport_recvmmsg(
         }
 
         msgvec[i].msg_len = (unsigned int)result;
-        recv_func(
-            clientd,
-            transport->dispatch_clientd,
-            msgvec[i].msg_hdr.msg_iov[0].iov_base,
-            msgvec[i].msg_len,
-            msgvec[i].msg_hdr.msg_name);
+        aeron_udp_channel_transport_dispatch(transport, &msgvec[i].msg_hdr, msgvec[i].msg_len, recv_func, clientd);
         work_count++;
+
+        if (bytes_remaining > 0 && (bytes_remaining -= result) <= 0)
+        {
+            break;
+        }
     }
 
+    aeron_udp_channel_transport_recv_batch_end(transport, clientd);
+
     return work_count;
 #endif
 }
@@ -397,3 +665,146 @@ int aeron_udp_channel_transport_get_so_rcvbuf(aeron_udp_channel_transport_t *tra
 
     return 0;
 }
+
+int aeron_udp_channel_transport_set_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t so_rcvbuf)
+{
+    if (setsockopt(transport->fd, SOL_SOCKET, SO_RCVBUF, &so_rcvbuf, sizeof(so_rcvbuf)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "setsockopt(SO_RCVBUF): %s", strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_set_drop_monitoring(aeron_udp_channel_transport_t *transport)
+{
+#if defined(SO_RXQ_OVFL)
+    int value = 1;
+
+    if (setsockopt(transport->fd, SOL_SOCKET, SO_RXQ_OVFL, &value, sizeof(value)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "setsockopt(SO_RXQ_OVFL): %s", strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "SO_RXQ_OVFL: %s", strerror(ENOTSUP));
+    return -1;
+#endif
+}
+
+int aeron_udp_channel_transport_get_incoming_cpu(aeron_udp_channel_transport_t *transport, int *cpu)
+{
+    *cpu = -1;
+
+#if defined(SO_INCOMING_CPU)
+    if (-1 != transport->fd)
+    {
+        socklen_t len = sizeof(*cpu);
+
+        if (getsockopt(transport->fd, SOL_SOCKET, SO_INCOMING_CPU, cpu, &len) < 0)
+        {
+            int errcode = errno;
+
+            *cpu = -1;
+            aeron_set_err(errcode, "getsockopt(SO_INCOMING_CPU): %s", strerror(errcode));
+            return -1;
+        }
+    }
+#endif
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_set_pmtu_probe(aeron_udp_channel_transport_t *transport, int family)
+{
+#if defined(IP_PMTUDISC_PROBE) && defined(IPV6_PMTUDISC_PROBE)
+    const int level = AF_INET6 == family ? IPPROTO_IPV6 : IPPROTO_IP;
+    const int optname = AF_INET6 == family ? IPV6_MTU_DISCOVER : IP_MTU_DISCOVER;
+    const int value = AF_INET6 == family ? IPV6_PMTUDISC_PROBE : IP_PMTUDISC_PROBE;
+
+    if (setsockopt(transport->fd, level, optname, &value, sizeof(value)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "setsockopt(MTU_DISCOVER): %s", strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "%s", "path MTU probing not supported");
+    return -1;
+#endif
+}
+
+#if defined(SO_ATTACH_REUSEPORT_CBPF)
+/*
+ * Load the little endian int32 at offset into the accumulator, classic BPF loads being big endian.
+ */
+static size_t aeron_udp_channel_transport_bpf_load_le32(struct sock_filter *program, uint32_t offset)
+{
+    size_t i = 0;
+
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_LD | BPF_B | BPF_ABS, offset + 3);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_LSH | BPF_K, 24);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_MISC | BPF_TAX, 0);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_LD | BPF_B | BPF_ABS, offset + 2);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_LSH | BPF_K, 16);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_OR | BPF_X, 0);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_MISC | BPF_TAX, 0);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_LD | BPF_B | BPF_ABS, offset + 1);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_LSH | BPF_K, 8);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_OR | BPF_X, 0);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_MISC | BPF_TAX, 0);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_LD | BPF_B | BPF_ABS, offset);
+    program[i++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_OR | BPF_X, 0);
+
+    return i;
+}
+#endif
+
+int aeron_udp_channel_transport_set_session_steering(aeron_udp_channel_transport_t *transport, size_t shards)
+{
+#if defined(SO_ATTACH_REUSEPORT_CBPF)
+    struct sock_filter program[64];
+    struct sock_fprog fprog;
+    size_t length = 0;
+
+    /* the program sees the datagram from the UDP payload, where the session id of an RTTM frame comes earlier */
+    program[length++] = (struct sock_filter)BPF_STMT(BPF_LD | BPF_H | BPF_ABS, offsetof(aeron_frame_header_t, type));
+    program[length++] = (struct sock_filter)BPF_JUMP(
+        BPF_JMP | BPF_JEQ | BPF_K, (uint32_t)htons(AERON_HDR_TYPE_RTTM), 0, 14);
+    length += aeron_udp_channel_transport_bpf_load_le32(
+        &program[length], offsetof(aeron_rttm_header_t, session_id));
+    program[length++] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JA, 13, 0, 0);
+    length += aeron_udp_channel_transport_bpf_load_le32(
+        &program[length], offsetof(aeron_data_header_t, session_id));
+    program[length++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, (uint32_t)shards);
+    program[length++] = (struct sock_filter)BPF_STMT(BPF_RET | BPF_A, 0);
+
+    fprog.len = (unsigned short)length;
+    fprog.filter = program;
+
+    if (setsockopt(transport->fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &fprog, sizeof(fprog)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "setsockopt(SO_ATTACH_REUSEPORT_CBPF): %s", strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "SO_ATTACH_REUSEPORT_CBPF: %s", strerror(ENOTSUP));
+    return -1;
+#endif
+}
+
+extern uint32_t aeron_udp_channel_transport_session_shard(int32_t session_id, size_t shards);
@@ -24,15 +24,50 @@
 
 typedef int aeron_fd_t;
 
+#define AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH (128)
+
+typedef union aeron_udp_channel_transport_control_un
+{
+    size_t align;
+    uint8_t buffer[AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH];
+}
+aeron_udp_channel_transport_control_t;
+
+typedef struct aeron_udp_channel_transport_bindings_stct aeron_udp_channel_transport_bindings_t;
+
+typedef void (*aeron_udp_transport_recv_batch_end_func_t)(void *clientd, void *transport_clientd);
+
 typedef struct aeron_udp_channel_transport_stct
 {
     aeron_fd_t fd;
     void *dispatch_clientd;
+    aeron_udp_channel_transport_bindings_t *bindings;
+    /* CLOCK_REALTIME receive timestamp of the message being dispatched when rx timestamping is on, otherwise 0 */
+    int64_t recv_timestamp_ns;
+    /* datagrams the kernel dropped for a full receive buffer since the socket was opened, as of the last message
+     * received, when drop monitoring is on */
+    uint32_t socket_drops;
+    /* state owned by bindings layered over the default ones, NULL for the default bindings */
+    void *bindings_clientd;
+    /* connected to a single destination so messages are sent without a msg_name */
+    bool is_connected;
+    /* when set, recvmmsg of the default bindings calls it with the clientd of recv_func once every message of the
+     * vector has been handed to recv_func, while their buffers are still valid, and in_recv_batch is true in between
+     * so recv_func may defer work on them until then */
+    aeron_udp_transport_recv_batch_end_func_t recv_batch_end_func;
+    /* bytes the poller was told are waiting on the socket, 0 when it was not told, so that without recvmmsg the
+     * receive loop stops once it has taken them rather than call recvmsg again only to find the socket empty */
+    int64_t recv_bytes_available;
+    bool in_recv_batch;
 }
 aeron_udp_channel_transport_t;
 
 struct mmsghdr;
 
+/*
+ * Open and bind the socket for a transport. When connect_addr is not NULL the socket is also connected to it, which
+ * saves the kernel a route lookup per message sent and means only messages from that address are received.
+ */
 int aeron_udp_channel_transport_init(
     aeron_udp_channel_transport_t *transport,
     struct sockaddr_storage *bind_addr,
@@ -40,12 +75,46 @@ int aeron_udp_channel_transport_init(
     unsigned int multicast_if_index,
     uint8_t ttl,
     size_t socket_rcvbuf,
-    size_t socket_sndbuf);
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr);
+
+/*
+ * As aeron_udp_channel_transport_init for a unicast socket that joins the SO_REUSEPORT group of the sockets bound to
+ * the same address before it, so several transports receive on one port.
+ */
+int aeron_udp_channel_transport_init_reuse_port(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping);
 
 int aeron_udp_channel_transport_close(aeron_udp_channel_transport_t *transport);
 
 typedef void (*aeron_udp_transport_recv_func_t)(void *, void *, uint8_t *, size_t, struct sockaddr_storage *);
 
+/*
+ * Hand a received message to recv_func. A message coalesced by UDP_GRO is split back into its datagrams using the
+ * segment size carried in the control message, so msg_control should be provided when GRO is in use. The same goes
+ * for SO_TIMESTAMPING, whose receive timestamp is made available in recv_timestamp_ns for the duration of the dispatch.
+ */
+void aeron_udp_channel_transport_dispatch(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *msghdr,
+    size_t length,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
 int aeron_udp_channel_transport_recvmmsg(
     aeron_udp_channel_transport_t *transport,
     struct mmsghdr *msgvec,
@@ -64,4 +133,36 @@ int aeron_udp_channel_transport_sendmsg(
 
 int aeron_udp_channel_transport_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf);
 
+int aeron_udp_channel_transport_set_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t so_rcvbuf);
+
+/*
+ * Have the kernel report with each message received how many datagrams it has dropped for a full receive buffer
+ * (SO_RXQ_OVFL), which dispatch makes available in socket_drops.
+ */
+int aeron_udp_channel_transport_set_drop_monitoring(aeron_udp_channel_transport_t *transport);
+
+/*
+ * CPU the kernel last processed an incoming packet for this socket on (SO_INCOMING_CPU), or -1 when not known.
+ */
+int aeron_udp_channel_transport_get_incoming_cpu(aeron_udp_channel_transport_t *transport, int *cpu);
+
+/*
+ * Set the don't fragment bit on every datagram sent and ignore the path MTU the kernel has learned, so datagrams of
+ * any length up to the interface MTU can be sent to probe the path (IP_PMTUDISC_PROBE).
+ */
+int aeron_udp_channel_transport_set_pmtu_probe(aeron_udp_channel_transport_t *transport, int family);
+
+/*
+ * Have the SO_REUSEPORT group of a socket deliver each datagram to the socket at index
+ * aeron_udp_channel_transport_session_shard of the session id in its header, counting in the order the sockets were
+ * bound, with a classic BPF program attached to the group (SO_ATTACH_REUSEPORT_CBPF). Datagrams too short to hold a
+ * session id go to the first socket.
+ */
+int aeron_udp_channel_transport_set_session_steering(aeron_udp_channel_transport_t *transport, size_t shards);
+
+inline uint32_t aeron_udp_channel_transport_session_shard(int32_t session_id, size_t shards)
+{
+    return (uint32_t)session_id % (uint32_t)shards;
+}
+
 #endif //AERON_AERON_UDP_CHANNEL_TRANSPORT_H
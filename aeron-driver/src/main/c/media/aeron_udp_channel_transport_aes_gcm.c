@@ -0,0 +1,412 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "util/aeron_error.h"
+#include "media/aeron_udp_channel_transport_aes_gcm.h"
+
+static int aeron_udp_channel_transport_aes_gcm_hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+
+    return -1;
+}
+
+int aeron_udp_channel_transport_aes_gcm_parse_key(const char *hex, uint8_t *key, size_t *key_length)
+{
+    const size_t hex_length = NULL == hex ? 0 : strlen(hex);
+
+    if (32 != hex_length && 64 != hex_length)
+    {
+        return -1;
+    }
+
+    for (size_t i = 0; i < hex_length; i += 2)
+    {
+        const int high = aeron_udp_channel_transport_aes_gcm_hex_value(hex[i]);
+        const int low = aeron_udp_channel_transport_aes_gcm_hex_value(hex[i + 1]);
+
+        if (high < 0 || low < 0)
+        {
+            return -1;
+        }
+
+        key[i / 2] = (uint8_t)((high << 4) | low);
+    }
+
+    *key_length = hex_length / 2;
+
+    return 0;
+}
+
+#if defined(HAVE_LIBCRYPTO)
+
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "aeron_alloc.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_aes_gcm =
+    {
+        aeron_udp_channel_transport_aes_gcm_init,
+        aeron_udp_channel_transport_aes_gcm_close,
+        aeron_udp_channel_transport_aes_gcm_recvmmsg,
+        aeron_udp_channel_transport_aes_gcm_sendmmsg,
+        aeron_udp_channel_transport_aes_gcm_sendmsg,
+        aeron_udp_channel_transport_get_so_rcvbuf
+    };
+
+typedef struct aeron_udp_channel_transport_aes_gcm_recv_stct
+{
+    aeron_udp_channel_transport_t *transport;
+    aeron_udp_channel_transport_aes_gcm_t *aes_gcm;
+    aeron_udp_transport_recv_func_t recv_func;
+    void *clientd;
+}
+aeron_udp_channel_transport_aes_gcm_recv_t;
+
+static void aeron_udp_channel_transport_aes_gcm_delete(aeron_udp_channel_transport_aes_gcm_t *aes_gcm)
+{
+    EVP_CIPHER_CTX_free((EVP_CIPHER_CTX *)aes_gcm->encrypt_ctx);
+    EVP_CIPHER_CTX_free((EVP_CIPHER_CTX *)aes_gcm->decrypt_ctx);
+    aeron_free(aes_gcm->scratch);
+    aeron_free(aes_gcm);
+}
+
+static int aeron_udp_channel_transport_aes_gcm_configure(aeron_udp_channel_transport_aes_gcm_t *aes_gcm)
+{
+    const char *hex = getenv(AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_KEY_ENV_VAR);
+    uint8_t key[AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_KEY_LENGTH];
+    size_t key_length = 0;
+    int result = -1;
+
+    if (aeron_udp_channel_transport_aes_gcm_parse_key(hex, key, &key_length) < 0)
+    {
+        aeron_set_err(EINVAL, "%s must be 32 or 64 hex digits", AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_KEY_ENV_VAR);
+        return -1;
+    }
+
+    const EVP_CIPHER *cipher = 16 == key_length ? EVP_aes_128_gcm() : EVP_aes_256_gcm();
+
+    if (NULL == (aes_gcm->encrypt_ctx = EVP_CIPHER_CTX_new()) ||
+        NULL == (aes_gcm->decrypt_ctx = EVP_CIPHER_CTX_new()) ||
+        1 != EVP_EncryptInit_ex((EVP_CIPHER_CTX *)aes_gcm->encrypt_ctx, cipher, NULL, key, NULL) ||
+        1 != EVP_DecryptInit_ex((EVP_CIPHER_CTX *)aes_gcm->decrypt_ctx, cipher, NULL, key, NULL))
+    {
+        aeron_set_err(EINVAL, "%s", "could not create AES-GCM cipher contexts");
+    }
+    else if (1 != RAND_bytes(aes_gcm->nonce, sizeof(aes_gcm->nonce)))
+    {
+        aeron_set_err(EINVAL, "%s", "could not draw AES-GCM nonce");
+    }
+    else
+    {
+        result = 0;
+    }
+
+    memset(key, 0, sizeof(key));
+
+    return result;
+}
+
+int aeron_udp_channel_transport_aes_gcm_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr)
+{
+    aeron_udp_channel_transport_aes_gcm_t *aes_gcm = NULL;
+
+    if (aeron_alloc((void **)&aes_gcm, sizeof(aeron_udp_channel_transport_aes_gcm_t)) < 0)
+    {
+        return -1;
+    }
+
+    aes_gcm->encrypt_ctx = NULL;
+    aes_gcm->decrypt_ctx = NULL;
+    aes_gcm->scratch = NULL;
+    aes_gcm->frames_rejected = 0;
+
+    if (aeron_udp_channel_transport_aes_gcm_configure(aes_gcm) < 0 ||
+        aeron_alloc(
+            (void **)&aes_gcm->scratch,
+            (size_t)AERON_MAX_UDP_PAYLOAD_LENGTH * AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_BATCH) < 0)
+    {
+        aeron_udp_channel_transport_aes_gcm_delete(aes_gcm);
+        return -1;
+    }
+
+    if (aeron_udp_channel_transport_init(
+        transport,
+        bind_addr,
+        multicast_if_addr,
+        multicast_if_index,
+        ttl,
+        socket_rcvbuf,
+        socket_sndbuf,
+        use_gro,
+        busy_poll_us,
+        prefer_busy_poll,
+        use_rx_timestamping,
+        connect_addr) < 0)
+    {
+        aeron_udp_channel_transport_aes_gcm_delete(aes_gcm);
+        return -1;
+    }
+
+    transport->bindings_clientd = aes_gcm;
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_aes_gcm_close(aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_channel_transport_aes_gcm_t *aes_gcm = aeron_udp_channel_transport_aes_gcm_state(transport);
+
+    if (NULL != aes_gcm)
+    {
+        aeron_udp_channel_transport_aes_gcm_delete(aes_gcm);
+        transport->bindings_clientd = NULL;
+    }
+
+    return aeron_udp_channel_transport_close(transport);
+}
+
+static void aeron_udp_channel_transport_aes_gcm_on_message(
+    void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_transport_aes_gcm_recv_t *recv = (aeron_udp_channel_transport_aes_gcm_recv_t *)clientd;
+    aeron_udp_channel_transport_aes_gcm_t *aes_gcm = recv->aes_gcm;
+    EVP_CIPHER_CTX *ctx = (EVP_CIPHER_CTX *)aes_gcm->decrypt_ctx;
+
+    if (length <= AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_OVERHEAD)
+    {
+        aes_gcm->frames_rejected++;
+        return;
+    }
+
+    /* frames follow the 12 byte nonce so stay 4 byte aligned, which is all the packed protocol structs assume */
+    uint8_t *text = buffer + AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_NONCE_LENGTH;
+    const int text_length = (int)(length - AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_OVERHEAD);
+    int update_length = 0, final_length = 0;
+
+    if (1 != EVP_DecryptInit_ex(ctx, NULL, NULL, NULL, buffer) ||
+        1 != EVP_DecryptUpdate(ctx, text, &update_length, text, text_length) ||
+        1 != EVP_CIPHER_CTX_ctrl(
+            ctx, EVP_CTRL_GCM_SET_TAG, AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_TAG_LENGTH, text + text_length) ||
+        1 != EVP_DecryptFinal_ex(ctx, text + update_length, &final_length))
+    {
+        aes_gcm->frames_rejected++;
+        return;
+    }
+
+    recv->recv_func(recv->clientd, transport_clientd, text, (size_t)text_length, addr);
+}
+
+int aeron_udp_channel_transport_aes_gcm_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    aeron_udp_channel_transport_aes_gcm_recv_t recv =
+        {
+            .transport = transport,
+            .aes_gcm = aeron_udp_channel_transport_aes_gcm_state(transport),
+            .recv_func = recv_func,
+            .clientd = clientd
+        };
+
+    return aeron_udp_channel_transport_recvmmsg(
+        transport, msgvec, vlen, aeron_udp_channel_transport_aes_gcm_on_message, &recv);
+}
+
+static void aeron_udp_channel_transport_aes_gcm_next_nonce(aeron_udp_channel_transport_aes_gcm_t *aes_gcm)
+{
+    for (int i = AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_NONCE_LENGTH - 1; i >= 4; i--)
+    {
+        if (0 != ++aes_gcm->nonce[i])
+        {
+            break;
+        }
+    }
+}
+
+static int aeron_udp_channel_transport_aes_gcm_encrypt(
+    aeron_udp_channel_transport_aes_gcm_t *aes_gcm, struct msghdr *message, uint8_t *slot, size_t *slot_length)
+{
+    EVP_CIPHER_CTX *ctx = (EVP_CIPHER_CTX *)aes_gcm->encrypt_ctx;
+    uint8_t *out = slot + AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_NONCE_LENGTH;
+    size_t text_length = 0;
+    int out_length = 0;
+
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        text_length += message->msg_iov[i].iov_len;
+    }
+
+    if (text_length > AERON_MAX_UDP_PAYLOAD_LENGTH - AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_OVERHEAD)
+    {
+        aeron_set_err(EMSGSIZE, "datagram of %d bytes too long for AES-GCM", (int)text_length);
+        return -1;
+    }
+
+    aeron_udp_channel_transport_aes_gcm_next_nonce(aes_gcm);
+    memcpy(slot, aes_gcm->nonce, AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_NONCE_LENGTH);
+
+    if (1 != EVP_EncryptInit_ex(ctx, NULL, NULL, NULL, aes_gcm->nonce))
+    {
+        aeron_set_err(EINVAL, "%s", "AES-GCM nonce rejected");
+        return -1;
+    }
+
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        if (1 != EVP_EncryptUpdate(
+            ctx, out, &out_length, message->msg_iov[i].iov_base, (int)message->msg_iov[i].iov_len))
+        {
+            aeron_set_err(EINVAL, "%s", "AES-GCM encrypt failed");
+            return -1;
+        }
+
+        out += out_length;
+    }
+
+    if (1 != EVP_EncryptFinal_ex(ctx, out, &out_length) ||
+        1 != EVP_CIPHER_CTX_ctrl(
+            ctx, EVP_CTRL_GCM_GET_TAG, AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_TAG_LENGTH, out + out_length))
+    {
+        aeron_set_err(EINVAL, "%s", "AES-GCM encrypt failed");
+        return -1;
+    }
+
+    *slot_length = text_length + AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_OVERHEAD;
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_aes_gcm_sendmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    aeron_udp_channel_transport_aes_gcm_t *aes_gcm = aeron_udp_channel_transport_aes_gcm_state(transport);
+    struct mmsghdr batch[AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_BATCH];
+    struct iovec iov[AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_BATCH];
+    int result = 0;
+
+    for (size_t offset = 0; offset < vlen; offset += AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_BATCH)
+    {
+        const size_t batch_length = vlen - offset < AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_BATCH ?
+            vlen - offset : AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_BATCH;
+
+        for (size_t i = 0; i < batch_length; i++)
+        {
+            struct msghdr *message = &msgvec[offset + i].msg_hdr;
+
+            iov[i].iov_base = aes_gcm->scratch + (i * AERON_MAX_UDP_PAYLOAD_LENGTH);
+            if (aeron_udp_channel_transport_aes_gcm_encrypt(
+                aes_gcm, message, (uint8_t *)iov[i].iov_base, &iov[i].iov_len) < 0)
+            {
+                return -1;
+            }
+
+            memset(&batch[i], 0, sizeof(batch[i]));
+            batch[i].msg_hdr.msg_name = message->msg_name;
+            batch[i].msg_hdr.msg_namelen = message->msg_namelen;
+            batch[i].msg_hdr.msg_iov = &iov[i];
+            batch[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int sent = aeron_udp_channel_transport_sendmmsg(transport, batch, batch_length);
+        if (sent < 0)
+        {
+            return -1;
+        }
+
+        /* callers account for the bytes they handed over, not for what the cipher added */
+        for (int i = 0; i < sent; i++)
+        {
+            msgvec[offset + i].msg_len = batch[i].msg_len > AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_OVERHEAD ?
+                batch[i].msg_len - AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_OVERHEAD : 0;
+        }
+
+        result += sent;
+
+        if ((size_t)sent < batch_length)
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+int aeron_udp_channel_transport_aes_gcm_sendmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    struct mmsghdr mmsghdr;
+
+    mmsghdr.msg_hdr = *message;
+    mmsghdr.msg_len = 0;
+
+    const int result = aeron_udp_channel_transport_aes_gcm_sendmmsg(transport, &mmsghdr, 1);
+
+    return result > 0 ? (int)mmsghdr.msg_len : result;
+}
+
+extern aeron_udp_channel_transport_aes_gcm_t *aeron_udp_channel_transport_aes_gcm_state(
+    aeron_udp_channel_transport_t *transport);
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_H
+#define AERON_AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_H
+
+#include "media/aeron_udp_channel_transport_bindings.h"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_AES_GCM "aes-gcm"
+
+/**
+ * Key shared by both ends of channels using the aes-gcm bindings, as 32 or 64 hex digits for AES-128 or AES-256.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_KEY_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_KEY"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_KEY_LENGTH (32)
+#define AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_NONCE_LENGTH (12)
+#define AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_TAG_LENGTH (16)
+#define AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_OVERHEAD \
+    (AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_NONCE_LENGTH + AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_TAG_LENGTH)
+#define AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_BATCH (4)
+
+/*
+ * Key from its hex form. Returns -1 unless the value is 32 or 64 hex digits.
+ */
+int aeron_udp_channel_transport_aes_gcm_parse_key(const char *hex, uint8_t *key, size_t *key_length);
+
+#if defined(HAVE_LIBCRYPTO)
+
+/*
+ * Per transport state of the aes-gcm bindings. The cipher contexts keep the expanded key so only the nonce is set
+ * for each datagram. Nonces are a random 12 bytes drawn when the transport is created with the last 8 of them then
+ * counted up, so they do not repeat for a key unless two transports draw within 2^64 datagrams of each other.
+ */
+typedef struct aeron_udp_channel_transport_aes_gcm_stct
+{
+    void *encrypt_ctx;
+    void *decrypt_ctx;
+    uint8_t nonce[AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_NONCE_LENGTH];
+    uint8_t *scratch;
+    int64_t frames_rejected;
+}
+aeron_udp_channel_transport_aes_gcm_t;
+
+/*
+ * Default bindings that encrypt and authenticate every datagram with AES-GCM, selected with
+ * AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA=aes-gcm or media-bindings=aes-gcm on a channel at both ends. Frames are
+ * encrypted out of the caller's buffers, which may be the term buffer, into scratch slots and sent as a batch, and
+ * are decrypted in place as they are received, so the endpoints only ever see plaintext. A datagram carries its
+ * nonce ahead of the ciphertext and its tag after it, so the channel mtu must leave room for
+ * AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_OVERHEAD bytes. Datagrams that fail authentication are dropped and counted.
+ * OpenSSL picks AES-NI, VAES or the ARMv8 crypto extensions when the machine has them.
+ */
+extern aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_aes_gcm;
+
+int aeron_udp_channel_transport_aes_gcm_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr);
+
+int aeron_udp_channel_transport_aes_gcm_close(aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_channel_transport_aes_gcm_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
+int aeron_udp_channel_transport_aes_gcm_sendmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen);
+
+int aeron_udp_channel_transport_aes_gcm_sendmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message);
+
+inline aeron_udp_channel_transport_aes_gcm_t *aeron_udp_channel_transport_aes_gcm_state(
+    aeron_udp_channel_transport_t *transport)
+{
+    return (aeron_udp_channel_transport_aes_gcm_t *)transport->bindings_clientd;
+}
+
+#endif
+
+#endif //AERON_AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_H
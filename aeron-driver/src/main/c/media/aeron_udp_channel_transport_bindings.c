@@ -0,0 +1,105 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <string.h>
+#include "util/aeron_error.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
+#include "media/aeron_udp_channel_transport_debug.h"
+#include "media/aeron_udp_channel_transport_aes_gcm.h"
+#include "media/aeron_udp_channel_transport_ibverbs.h"
+#include "media/aeron_udp_channel_transport_dpdk.h"
+#include "media/aeron_udp_channel_transport_shm.h"
+
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_default =
+    {
+        aeron_udp_channel_transport_init,
+        aeron_udp_channel_transport_close,
+        aeron_udp_channel_transport_recvmmsg,
+        aeron_udp_channel_transport_sendmmsg,
+        aeron_udp_channel_transport_sendmsg,
+        aeron_udp_channel_transport_get_so_rcvbuf
+    };
+
+aeron_udp_channel_transport_bindings_t *aeron_udp_channel_transport_bindings_load(const char *bindings_name)
+{
+    aeron_udp_channel_transport_bindings_t *bindings = NULL;
+
+    if (NULL == bindings_name || strcmp(bindings_name, AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_DEFAULT) == 0)
+    {
+        return &aeron_udp_channel_transport_bindings_default;
+    }
+
+    if (strcmp(bindings_name, AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_DEBUG) == 0)
+    {
+        return &aeron_udp_channel_transport_bindings_debug;
+    }
+
+#if defined(HAVE_LIBCRYPTO)
+    if (strcmp(bindings_name, AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_AES_GCM) == 0)
+    {
+        return &aeron_udp_channel_transport_bindings_aes_gcm;
+    }
+#endif
+
+#if defined(HAVE_IBVERBS)
+    if (strcmp(bindings_name, AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IBVERBS) == 0)
+    {
+        return &aeron_udp_channel_transport_bindings_ibverbs;
+    }
+#endif
+
+#if defined(HAVE_DPDK)
+    if (strcmp(bindings_name, AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_DPDK) == 0)
+    {
+        return &aeron_udp_channel_transport_bindings_dpdk;
+    }
+#endif
+
+#if defined(__linux__)
+    if (strcmp(bindings_name, AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_SHM) == 0)
+    {
+        return &aeron_udp_channel_transport_bindings_shm;
+    }
+#endif
+
+    if ((bindings = (aeron_udp_channel_transport_bindings_t *)dlsym(RTLD_DEFAULT, bindings_name)) == NULL)
+    {
+        aeron_set_err(EINVAL, "could not find udp channel transport bindings %s: dlsym - %s", bindings_name, dlerror());
+        return NULL;
+    }
+
+    return bindings;
+}
+
+aeron_udp_channel_transport_bindings_t *aeron_udp_channel_transport_bindings_for_uri(
+    aeron_uri_t *uri, aeron_udp_channel_transport_bindings_t *default_bindings)
+{
+    const char *bindings_name = aeron_uri_media_bindings(uri);
+
+    if (NULL == bindings_name)
+    {
+        return NULL != default_bindings ? default_bindings : &aeron_udp_channel_transport_bindings_default;
+    }
+
+    return aeron_udp_channel_transport_bindings_load(bindings_name);
+}
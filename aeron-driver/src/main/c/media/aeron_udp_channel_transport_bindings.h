@@ -0,0 +1,87 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_H
+#define AERON_AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_H
+
+#include "media/aeron_udp_channel_transport.h"
+#include "uri/aeron_uri.h"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_DEFAULT "default"
+
+typedef int (*aeron_udp_channel_transport_init_func_t)(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr);
+
+typedef int (*aeron_udp_channel_transport_close_func_t)(aeron_udp_channel_transport_t *transport);
+
+typedef int (*aeron_udp_channel_transport_recvmmsg_func_t)(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
+typedef int (*aeron_udp_channel_transport_sendmmsg_func_t)(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen);
+
+typedef int (*aeron_udp_channel_transport_sendmsg_func_t)(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message);
+
+typedef int (*aeron_udp_channel_transport_get_so_rcvbuf_func_t)(
+    aeron_udp_channel_transport_t *transport,
+    size_t *so_rcvbuf);
+
+/*
+ * Media layer used by the send and receive channel endpoints. Alternative media, e.g. a kernel-bypass AF_XDP
+ * implementation, can be supplied from a shared library by exporting a bindings struct and naming it in
+ * AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA or the media-bindings channel URI parameter. Transports using anything
+ * other than the default bindings are expected to provide a pollable fd.
+ */
+struct aeron_udp_channel_transport_bindings_stct
+{
+    aeron_udp_channel_transport_init_func_t init_func;
+    aeron_udp_channel_transport_close_func_t close_func;
+    aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func;
+    aeron_udp_channel_transport_sendmmsg_func_t sendmmsg_func;
+    aeron_udp_channel_transport_sendmsg_func_t sendmsg_func;
+    aeron_udp_channel_transport_get_so_rcvbuf_func_t get_so_rcvbuf_func;
+};
+
+extern aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_default;
+
+aeron_udp_channel_transport_bindings_t *aeron_udp_channel_transport_bindings_load(const char *bindings_name);
+
+/*
+ * Bindings named by the channel's media-bindings parameter or, if it has none, the supplied default.
+ */
+aeron_udp_channel_transport_bindings_t *aeron_udp_channel_transport_bindings_for_uri(
+    aeron_uri_t *uri, aeron_udp_channel_transport_bindings_t *default_bindings);
+
+#endif //AERON_AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_H
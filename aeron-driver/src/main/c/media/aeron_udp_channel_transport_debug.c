@@ -0,0 +1,382 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "protocol/aeron_udp_protocol.h"
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_error.h"
+#include "aeron_alloc.h"
+#include "aeronmd.h"
+#include "media/aeron_udp_channel_transport_debug.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_debug =
+    {
+        aeron_udp_channel_transport_debug_init,
+        aeron_udp_channel_transport_debug_close,
+        aeron_udp_channel_transport_debug_recvmmsg,
+        aeron_udp_channel_transport_sendmmsg,
+        aeron_udp_channel_transport_sendmsg,
+        aeron_udp_channel_transport_get_so_rcvbuf
+    };
+
+static int64_t aeron_udp_channel_transport_debug_transport_count = 0;
+
+typedef struct aeron_udp_channel_transport_debug_recv_stct
+{
+    aeron_udp_channel_transport_t *transport;
+    aeron_udp_channel_transport_debug_t *debug;
+    aeron_udp_transport_recv_func_t recv_func;
+    void *clientd;
+    int64_t now_ns;
+}
+aeron_udp_channel_transport_debug_recv_t;
+
+static int aeron_udp_channel_transport_debug_parse_rate(const char *env_var, double *rate)
+{
+    const char *value = getenv(env_var);
+    char *end_ptr = NULL;
+
+    *rate = 0.0;
+    if (NULL == value)
+    {
+        return 0;
+    }
+
+    errno = 0;
+    const double parsed = strtod(value, &end_ptr);
+    if (0 != errno || end_ptr == value || '\0' != *end_ptr || parsed < 0.0 || parsed > 1.0)
+    {
+        aeron_set_err(EINVAL, "%s must be between 0 and 1: %s", env_var, value);
+        return -1;
+    }
+
+    *rate = parsed;
+    return 0;
+}
+
+static int aeron_udp_channel_transport_debug_parse_int64(const char *env_var, int64_t *result, int64_t def)
+{
+    const char *value = getenv(env_var);
+    char *end_ptr = NULL;
+
+    *result = def;
+    if (NULL == value)
+    {
+        return 0;
+    }
+
+    errno = 0;
+    const long long parsed = strtoll(value, &end_ptr, 0);
+    if (0 != errno || end_ptr == value || '\0' != *end_ptr || parsed < 0)
+    {
+        aeron_set_err(EINVAL, "%s must be a non negative integer: %s", env_var, value);
+        return -1;
+    }
+
+    *result = (int64_t)parsed;
+    return 0;
+}
+
+static int aeron_udp_channel_transport_debug_configure(aeron_udp_channel_transport_debug_t *debug)
+{
+    int64_t seed = 0, transport_index = 0;
+
+    if (aeron_udp_channel_transport_debug_parse_rate(
+            AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DATA_LOSS_RATE_ENV_VAR, &debug->data_loss_rate) < 0 ||
+        aeron_udp_channel_transport_debug_parse_rate(
+            AERON_UDP_CHANNEL_TRANSPORT_DEBUG_CONTROL_LOSS_RATE_ENV_VAR, &debug->control_loss_rate) < 0 ||
+        aeron_udp_channel_transport_debug_parse_rate(
+            AERON_UDP_CHANNEL_TRANSPORT_DEBUG_REORDER_RATE_ENV_VAR, &debug->reorder_rate) < 0 ||
+        aeron_udp_channel_transport_debug_parse_int64(
+            AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DELAY_ENV_VAR, &debug->delay_ns, 0) < 0 ||
+        aeron_udp_channel_transport_debug_parse_int64(
+            AERON_UDP_CHANNEL_TRANSPORT_DEBUG_SEED_ENV_VAR, &seed, aeron_nanoclock()) < 0)
+    {
+        return -1;
+    }
+
+    /* transports of one process get distinct but repeatable sequences for a given seed */
+    AERON_GET_AND_ADD_INT64(transport_index, aeron_udp_channel_transport_debug_transport_count, 1);
+    seed += transport_index * 0x9E3779B97F4A7C15LL;
+
+    debug->xsubi[0] = (unsigned short)(seed & 0xFFFF);
+    debug->xsubi[1] = (unsigned short)((seed >> 16) & 0xFFFF);
+    debug->xsubi[2] = (unsigned short)((seed >> 32) & 0xFFFF);
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_debug_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr)
+{
+    aeron_udp_channel_transport_debug_t *debug = NULL;
+
+    if (aeron_alloc((void **)&debug, sizeof(aeron_udp_channel_transport_debug_t)) < 0)
+    {
+        return -1;
+    }
+
+    debug->has_reordered = false;
+    debug->delayed.array = NULL;
+    debug->delayed.head = 0;
+    debug->delayed.length = 0;
+    debug->frames_dropped = 0;
+    debug->frames_reordered = 0;
+    debug->frames_delayed = 0;
+
+    if (aeron_udp_channel_transport_debug_configure(debug) < 0)
+    {
+        aeron_free(debug);
+        return -1;
+    }
+
+    if (debug->delay_ns > 0 && aeron_alloc(
+        (void **)&debug->delayed.array,
+        sizeof(aeron_udp_channel_transport_debug_held_frame_t) * AERON_UDP_CHANNEL_TRANSPORT_DEBUG_MAX_HELD_FRAMES) < 0)
+    {
+        aeron_free(debug);
+        return -1;
+    }
+
+    if (aeron_udp_channel_transport_init(
+        transport,
+        bind_addr,
+        multicast_if_addr,
+        multicast_if_index,
+        ttl,
+        socket_rcvbuf,
+        socket_sndbuf,
+        use_gro,
+        busy_poll_us,
+        prefer_busy_poll,
+        use_rx_timestamping,
+        connect_addr) < 0)
+    {
+        aeron_free(debug->delayed.array);
+        aeron_free(debug);
+        return -1;
+    }
+
+    transport->bindings_clientd = debug;
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_debug_close(aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_channel_transport_debug_t *debug = aeron_udp_channel_transport_debug_state(transport);
+
+    if (NULL != debug)
+    {
+        if (debug->has_reordered)
+        {
+            aeron_free(debug->reordered.buffer);
+        }
+
+        for (size_t i = 0; i < debug->delayed.length; i++)
+        {
+            size_t index = (debug->delayed.head + i) % AERON_UDP_CHANNEL_TRANSPORT_DEBUG_MAX_HELD_FRAMES;
+            aeron_free(debug->delayed.array[index].buffer);
+        }
+
+        aeron_free(debug->delayed.array);
+        aeron_free(debug);
+        transport->bindings_clientd = NULL;
+    }
+
+    return aeron_udp_channel_transport_close(transport);
+}
+
+static int aeron_udp_channel_transport_debug_hold(
+    aeron_udp_channel_transport_debug_held_frame_t *frame,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    int64_t release_ns)
+{
+    if (aeron_alloc_no_err((void **)&frame->buffer, length) < 0)
+    {
+        return -1;
+    }
+
+    memcpy(frame->buffer, buffer, length);
+    memcpy(&frame->addr, addr, sizeof(struct sockaddr_storage));
+    frame->length = length;
+    frame->release_ns = release_ns;
+
+    return 0;
+}
+
+static void aeron_udp_channel_transport_debug_hand_over(
+    aeron_udp_channel_transport_debug_recv_t *recv, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_transport_debug_t *debug = recv->debug;
+
+    if (debug->delay_ns > 0 && debug->delayed.length < AERON_UDP_CHANNEL_TRANSPORT_DEBUG_MAX_HELD_FRAMES)
+    {
+        size_t tail = (debug->delayed.head + debug->delayed.length) % AERON_UDP_CHANNEL_TRANSPORT_DEBUG_MAX_HELD_FRAMES;
+
+        if (aeron_udp_channel_transport_debug_hold(
+            &debug->delayed.array[tail], buffer, length, addr, recv->now_ns + debug->delay_ns) == 0)
+        {
+            debug->delayed.length++;
+            debug->frames_delayed++;
+            return;
+        }
+    }
+
+    recv->recv_func(recv->clientd, recv->transport->dispatch_clientd, buffer, length, addr);
+}
+
+static void aeron_udp_channel_transport_debug_hand_over_reordered(aeron_udp_channel_transport_debug_recv_t *recv)
+{
+    aeron_udp_channel_transport_debug_t *debug = recv->debug;
+    aeron_udp_channel_transport_debug_held_frame_t *frame = &debug->reordered;
+
+    debug->has_reordered = false;
+    aeron_udp_channel_transport_debug_hand_over(recv, frame->buffer, frame->length, &frame->addr);
+    aeron_free(frame->buffer);
+}
+
+static void aeron_udp_channel_transport_debug_on_message(
+    void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_transport_debug_recv_t *recv = (aeron_udp_channel_transport_debug_recv_t *)clientd;
+    aeron_udp_channel_transport_debug_t *debug = recv->debug;
+    double loss_rate = 0.0;
+
+    if (length >= sizeof(aeron_frame_header_t))
+    {
+        switch (((aeron_frame_header_t *)buffer)->type)
+        {
+            case AERON_HDR_TYPE_DATA:
+            case AERON_HDR_TYPE_PAD:
+            case AERON_HDR_TYPE_SETUP:
+                loss_rate = debug->data_loss_rate;
+                break;
+
+            case AERON_HDR_TYPE_SM:
+            case AERON_HDR_TYPE_NAK:
+            case AERON_HDR_TYPE_RTTM:
+            case AERON_HDR_TYPE_ERR:
+                loss_rate = debug->control_loss_rate;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (loss_rate > 0.0 && erand48(debug->xsubi) < loss_rate)
+    {
+        debug->frames_dropped++;
+        return;
+    }
+
+    if (debug->reorder_rate > 0.0 && !debug->has_reordered && erand48(debug->xsubi) < debug->reorder_rate &&
+        aeron_udp_channel_transport_debug_hold(
+            &debug->reordered,
+            buffer,
+            length,
+            addr,
+            recv->now_ns + AERON_UDP_CHANNEL_TRANSPORT_DEBUG_REORDER_TIMEOUT_NS) == 0)
+    {
+        debug->has_reordered = true;
+        debug->frames_reordered++;
+        return;
+    }
+
+    aeron_udp_channel_transport_debug_hand_over(recv, buffer, length, addr);
+
+    if (debug->has_reordered)
+    {
+        aeron_udp_channel_transport_debug_hand_over_reordered(recv);
+    }
+}
+
+int aeron_udp_channel_transport_debug_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    aeron_udp_channel_transport_debug_t *debug = aeron_udp_channel_transport_debug_state(transport);
+    aeron_udp_channel_transport_debug_recv_t recv =
+        {
+            .transport = transport,
+            .debug = debug,
+            .recv_func = recv_func,
+            .clientd = clientd,
+            .now_ns = aeron_nanoclock()
+        };
+
+    /* receive timestamps belong to the datagram last read, not to frames held back */
+    transport->recv_timestamp_ns = 0;
+
+    while (debug->delayed.length > 0)
+    {
+        aeron_udp_channel_transport_debug_held_frame_t *frame = &debug->delayed.array[debug->delayed.head];
+
+        if (frame->release_ns > recv.now_ns)
+        {
+            break;
+        }
+
+        recv_func(clientd, transport->dispatch_clientd, frame->buffer, frame->length, &frame->addr);
+        aeron_free(frame->buffer);
+
+        debug->delayed.head = (debug->delayed.head + 1) % AERON_UDP_CHANNEL_TRANSPORT_DEBUG_MAX_HELD_FRAMES;
+        debug->delayed.length--;
+    }
+
+    if (debug->has_reordered && debug->reordered.release_ns <= recv.now_ns)
+    {
+        aeron_udp_channel_transport_debug_hand_over_reordered(&recv);
+    }
+
+    return aeron_udp_channel_transport_recvmmsg(
+        transport, msgvec, vlen, aeron_udp_channel_transport_debug_on_message, &recv);
+}
+
+extern aeron_udp_channel_transport_debug_t *aeron_udp_channel_transport_debug_state(
+    aeron_udp_channel_transport_t *transport);
@@ -0,0 +1,130 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_UDP_CHANNEL_TRANSPORT_DEBUG_H
+#define AERON_AERON_UDP_CHANNEL_TRANSPORT_DEBUG_H
+
+#include "media/aeron_udp_channel_transport_bindings.h"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_DEBUG "debug"
+
+/**
+ * Probability, from 0 to 1, that a received DATA, PAD or SETUP frame is dropped by the debug bindings.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DATA_LOSS_RATE_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DATA_LOSS_RATE"
+
+/**
+ * Probability, from 0 to 1, that a received SM, NAK, RTTM or ERR frame is dropped by the debug bindings.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_DEBUG_CONTROL_LOSS_RATE_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_DEBUG_CONTROL_LOSS_RATE"
+
+/**
+ * Probability, from 0 to 1, that a received frame is held back and handed over after the frame that follows it.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_DEBUG_REORDER_RATE_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_DEBUG_REORDER_RATE"
+
+/**
+ * Delay (in nanoseconds) added to every received frame by the debug bindings.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DELAY_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DELAY"
+
+/**
+ * Seed for the loss and reorder decisions so a run can be repeated. Seeded from the clock if not set.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_DEBUG_SEED_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_DEBUG_SEED"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_DEBUG_MAX_HELD_FRAMES (4096)
+
+/* a frame held for reordering that is not followed by another within this time is handed over on its own */
+#define AERON_UDP_CHANNEL_TRANSPORT_DEBUG_REORDER_TIMEOUT_NS (1000 * 1000L)
+
+typedef struct aeron_udp_channel_transport_debug_held_frame_stct
+{
+    int64_t release_ns;
+    size_t length;
+    struct sockaddr_storage addr;
+    uint8_t *buffer;
+}
+aeron_udp_channel_transport_debug_held_frame_t;
+
+/*
+ * Per transport state of the debug bindings. Loss, reordering and delay are injected on receive so the frames a
+ * receiver takes in and the control frames a sender takes in are both covered by the one transport implementation,
+ * which is used by the send and receive channel endpoints alike.
+ */
+typedef struct aeron_udp_channel_transport_debug_stct
+{
+    double data_loss_rate;
+    double control_loss_rate;
+    double reorder_rate;
+    int64_t delay_ns;
+    unsigned short xsubi[3];
+
+    aeron_udp_channel_transport_debug_held_frame_t reordered;
+    bool has_reordered;
+
+    struct aeron_udp_channel_transport_debug_delayed_stct
+    {
+        aeron_udp_channel_transport_debug_held_frame_t *array;
+        size_t head;
+        size_t length;
+    }
+    delayed;
+
+    int64_t frames_dropped;
+    int64_t frames_reordered;
+    int64_t frames_delayed;
+}
+aeron_udp_channel_transport_debug_t;
+
+/*
+ * Default bindings with loss, reordering and delay injected on receive, for testing how the driver recovers from an
+ * imperfect network. Selected with AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA=debug or media-bindings=debug on a
+ * channel, and configured from the environment when each transport is created. Frames held back are handed over on
+ * later receives of the same transport, so they are not counted as work.
+ */
+extern aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_debug;
+
+int aeron_udp_channel_transport_debug_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr);
+
+int aeron_udp_channel_transport_debug_close(aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_channel_transport_debug_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
+inline aeron_udp_channel_transport_debug_t *aeron_udp_channel_transport_debug_state(
+    aeron_udp_channel_transport_t *transport)
+{
+    return (aeron_udp_channel_transport_debug_t *)transport->bindings_clientd;
+}
+
+#endif //AERON_AERON_UDP_CHANNEL_TRANSPORT_DEBUG_H
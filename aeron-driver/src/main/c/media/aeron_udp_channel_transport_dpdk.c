@@ -0,0 +1,1083 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include "util/aeron_error.h"
+#include "media/aeron_udp_channel_transport_dpdk.h"
+
+static const uint8_t aeron_udp_channel_transport_dpdk_broadcast_mac[
+    AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+static void aeron_udp_channel_transport_dpdk_put_uint16(uint8_t *buffer, uint16_t value)
+{
+    const uint16_t network_value = htons(value);
+
+    memcpy(buffer, &network_value, sizeof(network_value));
+}
+
+static uint16_t aeron_udp_channel_transport_dpdk_get_uint16(const uint8_t *buffer)
+{
+    uint16_t network_value;
+
+    memcpy(&network_value, buffer, sizeof(network_value));
+
+    return ntohs(network_value);
+}
+
+static void aeron_udp_channel_transport_dpdk_encode_ether(
+    uint8_t *frame, const uint8_t src_mac[6], const uint8_t dst_mac[6], uint16_t ether_type)
+{
+    memcpy(frame, dst_mac, AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH);
+    memcpy(frame + 6, src_mac, AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH);
+    aeron_udp_channel_transport_dpdk_put_uint16(frame + 12, ether_type);
+}
+
+void aeron_udp_channel_transport_dpdk_encode_headers(
+    uint8_t *frame,
+    const uint8_t src_mac[6],
+    const uint8_t dst_mac[6],
+    struct sockaddr_in *src_addr,
+    struct sockaddr_in *dst_addr,
+    uint8_t ttl,
+    size_t payload_length)
+{
+    uint8_t *ip = frame + AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH;
+    uint8_t *udp = ip + AERON_UDP_CHANNEL_TRANSPORT_DPDK_IPV4_HEADER_LENGTH;
+    const size_t udp_length = AERON_UDP_CHANNEL_TRANSPORT_DPDK_UDP_HEADER_LENGTH + payload_length;
+    uint32_t sum = 0;
+
+    aeron_udp_channel_transport_dpdk_encode_ether(
+        frame, src_mac, dst_mac, AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_TYPE_IPV4);
+
+    ip[0] = 0x45;
+    ip[1] = 0;
+    aeron_udp_channel_transport_dpdk_put_uint16(
+        ip + 2, (uint16_t)(AERON_UDP_CHANNEL_TRANSPORT_DPDK_IPV4_HEADER_LENGTH + udp_length));
+    aeron_udp_channel_transport_dpdk_put_uint16(ip + 4, 0);
+    /* don't fragment, datagrams are never longer than the MTU */
+    aeron_udp_channel_transport_dpdk_put_uint16(ip + 6, 0x4000);
+    ip[8] = ttl;
+    ip[9] = IPPROTO_UDP;
+    aeron_udp_channel_transport_dpdk_put_uint16(ip + 10, 0);
+    memcpy(ip + 12, &src_addr->sin_addr, sizeof(struct in_addr));
+    memcpy(ip + 16, &dst_addr->sin_addr, sizeof(struct in_addr));
+
+    for (size_t i = 0; i < AERON_UDP_CHANNEL_TRANSPORT_DPDK_IPV4_HEADER_LENGTH; i += 2)
+    {
+        sum += aeron_udp_channel_transport_dpdk_get_uint16(ip + i);
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+
+    aeron_udp_channel_transport_dpdk_put_uint16(ip + 10, (uint16_t)~sum);
+
+    memcpy(udp, &src_addr->sin_port, sizeof(in_port_t));
+    memcpy(udp + 2, &dst_addr->sin_port, sizeof(in_port_t));
+    aeron_udp_channel_transport_dpdk_put_uint16(udp + 4, (uint16_t)udp_length);
+    aeron_udp_channel_transport_dpdk_put_uint16(udp + 6, 0);
+}
+
+bool aeron_udp_channel_transport_dpdk_decode_headers(
+    const uint8_t *frame,
+    size_t length,
+    struct sockaddr_in *src_addr,
+    struct sockaddr_in *dst_addr,
+    size_t *payload_offset,
+    size_t *payload_length)
+{
+    const uint8_t *ip = frame + AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH;
+
+    if (length < AERON_UDP_CHANNEL_TRANSPORT_DPDK_HEADERS_LENGTH ||
+        AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_TYPE_IPV4 != aeron_udp_channel_transport_dpdk_get_uint16(frame + 12) ||
+        4 != (ip[0] >> 4) ||
+        IPPROTO_UDP != ip[9] ||
+        0 != (aeron_udp_channel_transport_dpdk_get_uint16(ip + 6) & 0x3FFF))
+    {
+        return false;
+    }
+
+    const size_t ip_header_length = (size_t)(ip[0] & 0x0F) * 4;
+    const size_t ip_length = aeron_udp_channel_transport_dpdk_get_uint16(ip + 2);
+    const uint8_t *udp = ip + ip_header_length;
+
+    if (ip_header_length < AERON_UDP_CHANNEL_TRANSPORT_DPDK_IPV4_HEADER_LENGTH ||
+        ip_length > length - AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH ||
+        ip_length < ip_header_length + AERON_UDP_CHANNEL_TRANSPORT_DPDK_UDP_HEADER_LENGTH)
+    {
+        return false;
+    }
+
+    const size_t udp_length = aeron_udp_channel_transport_dpdk_get_uint16(udp + 4);
+
+    if (udp_length < AERON_UDP_CHANNEL_TRANSPORT_DPDK_UDP_HEADER_LENGTH || udp_length > ip_length - ip_header_length)
+    {
+        return false;
+    }
+
+    memset(src_addr, 0, sizeof(struct sockaddr_in));
+    src_addr->sin_family = AF_INET;
+    memcpy(&src_addr->sin_addr, ip + 12, sizeof(struct in_addr));
+    memcpy(&src_addr->sin_port, udp, sizeof(in_port_t));
+
+    memset(dst_addr, 0, sizeof(struct sockaddr_in));
+    dst_addr->sin_family = AF_INET;
+    memcpy(&dst_addr->sin_addr, ip + 16, sizeof(struct in_addr));
+    memcpy(&dst_addr->sin_port, udp + 2, sizeof(in_port_t));
+
+    *payload_offset = (size_t)(udp - frame) + AERON_UDP_CHANNEL_TRANSPORT_DPDK_UDP_HEADER_LENGTH;
+    *payload_length = udp_length - AERON_UDP_CHANNEL_TRANSPORT_DPDK_UDP_HEADER_LENGTH;
+
+    return true;
+}
+
+void aeron_udp_channel_transport_dpdk_encode_arp(
+    uint8_t *frame,
+    uint16_t op,
+    const uint8_t sender_mac[6],
+    struct in_addr sender_ip,
+    const uint8_t target_mac[6],
+    struct in_addr target_ip)
+{
+    static const uint8_t unknown_mac[AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH] = { 0 };
+    uint8_t *arp = frame + AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH;
+
+    aeron_udp_channel_transport_dpdk_encode_ether(
+        frame,
+        sender_mac,
+        NULL != target_mac ? target_mac : aeron_udp_channel_transport_dpdk_broadcast_mac,
+        AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_TYPE_ARP);
+
+    aeron_udp_channel_transport_dpdk_put_uint16(arp, 1);
+    aeron_udp_channel_transport_dpdk_put_uint16(arp + 2, AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_TYPE_IPV4);
+    arp[4] = AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH;
+    arp[5] = sizeof(struct in_addr);
+    aeron_udp_channel_transport_dpdk_put_uint16(arp + 6, op);
+    memcpy(arp + 8, sender_mac, AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH);
+    memcpy(arp + 14, &sender_ip, sizeof(struct in_addr));
+    memcpy(arp + 18, NULL != target_mac ? target_mac : unknown_mac, AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH);
+    memcpy(arp + 24, &target_ip, sizeof(struct in_addr));
+}
+
+void aeron_udp_channel_transport_dpdk_multicast_mac(struct in_addr group, uint8_t mac[6])
+{
+    const uint32_t addr = ntohl(group.s_addr);
+
+    mac[0] = 0x01;
+    mac[1] = 0x00;
+    mac[2] = 0x5E;
+    mac[3] = (uint8_t)((addr >> 16) & 0x7F);
+    mac[4] = (uint8_t)((addr >> 8) & 0xFF);
+    mac[5] = (uint8_t)(addr & 0xFF);
+}
+
+#if defined(HAVE_DPDK)
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <rte_eal.h>
+#include <rte_errno.h>
+#include <rte_ethdev.h>
+#include <rte_mbuf.h>
+#include <rte_ring.h>
+#include <rte_cycles.h>
+#include <rte_spinlock.h>
+#include "util/aeron_netutil.h"
+#include "aeron_alloc.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_MAX_EAL_ARGS (32)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_NUM_MBUFS (8192)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_MBUF_CACHE_SIZE (256)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_EPHEMERAL_PORT_LOW (49152)
+
+typedef struct aeron_udp_channel_transport_dpdk_stct
+{
+    struct sockaddr_in bind_addr;
+    struct sockaddr_in connect_addr;
+    bool is_multicast;
+    uint8_t ttl;
+    struct rte_ring *ring;
+}
+aeron_udp_channel_transport_dpdk_t;
+
+typedef struct aeron_udp_channel_transport_dpdk_neighbour_stct
+{
+    struct in_addr addr;
+    uint8_t mac[AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH];
+    bool is_resolved;
+    uint64_t last_request_cycles;
+}
+aeron_udp_channel_transport_dpdk_neighbour_t;
+
+typedef struct aeron_udp_channel_transport_dpdk_port_stct
+{
+    uint16_t port_id;
+    struct rte_mempool *pool;
+    uint8_t mac[AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH];
+    struct in_addr local_addr;
+    size_t prefixlen;
+    struct in_addr gateway_addr;
+    bool has_gateway;
+    uint16_t next_ephemeral_port;
+    uint64_t arp_retry_cycles;
+
+    /* held by the agent draining the receive queue, and by the conductor to change the transports */
+    rte_spinlock_t rx_lock;
+    rte_spinlock_t tx_lock;
+    rte_spinlock_t neighbour_lock;
+
+    aeron_udp_channel_transport_dpdk_t *transports[AERON_UDP_CHANNEL_TRANSPORT_DPDK_MAX_TRANSPORTS];
+    size_t transports_length;
+
+    aeron_udp_channel_transport_dpdk_neighbour_t neighbours[AERON_UDP_CHANNEL_TRANSPORT_DPDK_MAX_NEIGHBOURS];
+    size_t neighbours_length;
+}
+aeron_udp_channel_transport_dpdk_port_t;
+
+static pthread_mutex_t aeron_udp_channel_transport_dpdk_port_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* the EAL can only be initialised once per process, so the port is started by the first transport and left running */
+static aeron_udp_channel_transport_dpdk_port_t *aeron_udp_channel_transport_dpdk_port = NULL;
+
+int aeron_udp_channel_transport_dpdk_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr);
+
+int aeron_udp_channel_transport_dpdk_close(aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_channel_transport_dpdk_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
+int aeron_udp_channel_transport_dpdk_sendmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen);
+
+int aeron_udp_channel_transport_dpdk_sendmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message);
+
+int aeron_udp_channel_transport_dpdk_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf);
+
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_dpdk =
+    {
+        aeron_udp_channel_transport_dpdk_init,
+        aeron_udp_channel_transport_dpdk_close,
+        aeron_udp_channel_transport_dpdk_recvmmsg,
+        aeron_udp_channel_transport_dpdk_sendmmsg,
+        aeron_udp_channel_transport_dpdk_sendmsg,
+        aeron_udp_channel_transport_dpdk_get_so_rcvbuf
+    };
+
+static inline aeron_udp_channel_transport_dpdk_t *aeron_udp_channel_transport_dpdk_state(
+    aeron_udp_channel_transport_t *transport)
+{
+    return (aeron_udp_channel_transport_dpdk_t *)transport->bindings_clientd;
+}
+
+static int aeron_udp_channel_transport_dpdk_eal_init(void)
+{
+    char args[AERON_MAX_PATH];
+    char *argv[AERON_UDP_CHANNEL_TRANSPORT_DPDK_MAX_EAL_ARGS];
+    char *saveptr = NULL;
+    int argc = 0;
+    const char *args_str = getenv(AERON_UDP_CHANNEL_TRANSPORT_DPDK_EAL_ARGS_ENV_VAR);
+
+    snprintf(args, sizeof(args), "%s", NULL != args_str ? args_str : "");
+    argv[argc++] = "aeronmd";
+
+    for (char *arg = strtok_r(args, " ", &saveptr);
+        NULL != arg && argc < AERON_UDP_CHANNEL_TRANSPORT_DPDK_MAX_EAL_ARGS - 1;
+        arg = strtok_r(NULL, " ", &saveptr))
+    {
+        argv[argc++] = arg;
+    }
+
+    argv[argc] = NULL;
+
+    if (rte_eal_init(argc, argv) < 0)
+    {
+        aeron_set_err(rte_errno, "rte_eal_init: %s", rte_strerror(rte_errno));
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_udp_channel_transport_dpdk_parse_addresses(aeron_udp_channel_transport_dpdk_port_t *port)
+{
+    const char *local_address_str = getenv(AERON_UDP_CHANNEL_TRANSPORT_DPDK_LOCAL_ADDRESS_ENV_VAR);
+    const char *gateway_str = getenv(AERON_UDP_CHANNEL_TRANSPORT_DPDK_GATEWAY_ENV_VAR);
+    struct sockaddr_storage local_addr;
+
+    if (NULL == local_address_str)
+    {
+        aeron_set_err(
+            EINVAL, "%s must be set for DPDK bindings", AERON_UDP_CHANNEL_TRANSPORT_DPDK_LOCAL_ADDRESS_ENV_VAR);
+        return -1;
+    }
+
+    if (aeron_interface_parse_and_resolve(local_address_str, &local_addr, &port->prefixlen) < 0)
+    {
+        return -1;
+    }
+
+    if (AF_INET != local_addr.ss_family)
+    {
+        aeron_set_err(EAFNOSUPPORT, "DPDK bindings are IPv4 only: %s", local_address_str);
+        return -1;
+    }
+
+    port->local_addr = ((struct sockaddr_in *)&local_addr)->sin_addr;
+    port->has_gateway = false;
+
+    if (NULL != gateway_str)
+    {
+        if (inet_pton(AF_INET, gateway_str, &port->gateway_addr) != 1)
+        {
+            aeron_set_err(EINVAL, "invalid %s: %s", AERON_UDP_CHANNEL_TRANSPORT_DPDK_GATEWAY_ENV_VAR, gateway_str);
+            return -1;
+        }
+
+        port->has_gateway = true;
+    }
+
+    return 0;
+}
+
+static int aeron_udp_channel_transport_dpdk_port_start(aeron_udp_channel_transport_dpdk_port_t *port)
+{
+    const char *port_id_str = getenv(AERON_UDP_CHANNEL_TRANSPORT_DPDK_PORT_ID_ENV_VAR);
+    struct rte_eth_conf port_conf;
+    struct rte_ether_addr mac;
+    uint16_t num_rx_desc = 1024;
+    uint16_t num_tx_desc = 1024;
+    int result;
+
+    port->port_id = NULL != port_id_str ? (uint16_t)strtoul(port_id_str, NULL, 10) : 0;
+
+    if (!rte_eth_dev_is_valid_port(port->port_id))
+    {
+        aeron_set_err(ENODEV, "no DPDK port %d", (int)port->port_id);
+        return -1;
+    }
+
+    const int socket_id = rte_eth_dev_socket_id(port->port_id);
+
+    port->pool = rte_pktmbuf_pool_create(
+        "aeron_mbuf_pool",
+        AERON_UDP_CHANNEL_TRANSPORT_DPDK_NUM_MBUFS,
+        AERON_UDP_CHANNEL_TRANSPORT_DPDK_MBUF_CACHE_SIZE,
+        0,
+        RTE_MBUF_DEFAULT_BUF_SIZE,
+        socket_id < 0 ? (int)rte_socket_id() : socket_id);
+
+    if (NULL == port->pool)
+    {
+        aeron_set_err(rte_errno, "rte_pktmbuf_pool_create: %s", rte_strerror(rte_errno));
+        return -1;
+    }
+
+    memset(&port_conf, 0, sizeof(port_conf));
+
+    if ((result = rte_eth_dev_configure(port->port_id, 1, 1, &port_conf)) < 0 ||
+        (result = rte_eth_dev_adjust_nb_rx_tx_desc(port->port_id, &num_rx_desc, &num_tx_desc)) < 0 ||
+        (result = rte_eth_rx_queue_setup(
+            port->port_id, 0, num_rx_desc, (unsigned int)socket_id, NULL, port->pool)) < 0 ||
+        (result = rte_eth_tx_queue_setup(port->port_id, 0, num_tx_desc, (unsigned int)socket_id, NULL)) < 0 ||
+        (result = rte_eth_dev_start(port->port_id)) < 0 ||
+        (result = rte_eth_macaddr_get(port->port_id, &mac)) < 0)
+    {
+        aeron_set_err(-result, "DPDK port %d setup: %s", (int)port->port_id, rte_strerror(-result));
+        return -1;
+    }
+
+    /* multicast groups are not joined, so all multicast is accepted and filtered by the transports */
+    rte_eth_allmulticast_enable(port->port_id);
+
+    memcpy(port->mac, mac.addr_bytes, sizeof(port->mac));
+    port->next_ephemeral_port = AERON_UDP_CHANNEL_TRANSPORT_DPDK_EPHEMERAL_PORT_LOW;
+    port->arp_retry_cycles =
+        (rte_get_timer_hz() * AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_RETRY_NS) / (1000 * 1000 * 1000);
+    rte_spinlock_init(&port->rx_lock);
+    rte_spinlock_init(&port->tx_lock);
+    rte_spinlock_init(&port->neighbour_lock);
+
+    return 0;
+}
+
+static aeron_udp_channel_transport_dpdk_port_t *aeron_udp_channel_transport_dpdk_port_get(void)
+{
+    aeron_udp_channel_transport_dpdk_port_t *port = NULL;
+
+    pthread_mutex_lock(&aeron_udp_channel_transport_dpdk_port_mutex);
+
+    if (NULL == aeron_udp_channel_transport_dpdk_port)
+    {
+        if (aeron_alloc((void **)&port, sizeof(aeron_udp_channel_transport_dpdk_port_t)) == 0)
+        {
+            if (aeron_udp_channel_transport_dpdk_parse_addresses(port) < 0 ||
+                aeron_udp_channel_transport_dpdk_eal_init() < 0 ||
+                aeron_udp_channel_transport_dpdk_port_start(port) < 0)
+            {
+                aeron_free(port);
+                port = NULL;
+            }
+
+            aeron_udp_channel_transport_dpdk_port = port;
+        }
+    }
+
+    port = aeron_udp_channel_transport_dpdk_port;
+
+    pthread_mutex_unlock(&aeron_udp_channel_transport_dpdk_port_mutex);
+
+    return port;
+}
+
+static bool aeron_udp_channel_transport_dpdk_is_port_in_use(
+    aeron_udp_channel_transport_dpdk_port_t *port, in_port_t sin_port)
+{
+    for (size_t i = 0; i < port->transports_length; i++)
+    {
+        if (port->transports[i]->bind_addr.sin_port == sin_port)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static int aeron_udp_channel_transport_dpdk_register(
+    aeron_udp_channel_transport_dpdk_port_t *port, aeron_udp_channel_transport_dpdk_t *dpdk)
+{
+    int result = 0;
+
+    rte_spinlock_lock(&port->rx_lock);
+
+    if (port->transports_length >= AERON_UDP_CHANNEL_TRANSPORT_DPDK_MAX_TRANSPORTS)
+    {
+        aeron_set_err(
+            ENOBUFS, "DPDK bindings support at most %d transports", AERON_UDP_CHANNEL_TRANSPORT_DPDK_MAX_TRANSPORTS);
+        result = -1;
+    }
+    else if (0 == dpdk->bind_addr.sin_port)
+    {
+        do
+        {
+            dpdk->bind_addr.sin_port = htons(port->next_ephemeral_port);
+            port->next_ephemeral_port = port->next_ephemeral_port == UINT16_MAX ?
+                AERON_UDP_CHANNEL_TRANSPORT_DPDK_EPHEMERAL_PORT_LOW : (uint16_t)(port->next_ephemeral_port + 1);
+        }
+        while (aeron_udp_channel_transport_dpdk_is_port_in_use(port, dpdk->bind_addr.sin_port));
+    }
+    else if (!dpdk->is_multicast && aeron_udp_channel_transport_dpdk_is_port_in_use(port, dpdk->bind_addr.sin_port))
+    {
+        aeron_set_err(EADDRINUSE, "DPDK port already bound to UDP port %d", (int)ntohs(dpdk->bind_addr.sin_port));
+        result = -1;
+    }
+
+    if (0 == result)
+    {
+        port->transports[port->transports_length++] = dpdk;
+    }
+
+    rte_spinlock_unlock(&port->rx_lock);
+
+    return result;
+}
+
+static void aeron_udp_channel_transport_dpdk_unregister(
+    aeron_udp_channel_transport_dpdk_port_t *port, aeron_udp_channel_transport_dpdk_t *dpdk)
+{
+    rte_spinlock_lock(&port->rx_lock);
+
+    for (size_t i = 0; i < port->transports_length; i++)
+    {
+        if (port->transports[i] == dpdk)
+        {
+            port->transports[i] = port->transports[--port->transports_length];
+            break;
+        }
+    }
+
+    rte_spinlock_unlock(&port->rx_lock);
+}
+
+int aeron_udp_channel_transport_dpdk_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr)
+{
+    static volatile uint32_t ring_id = 0;
+    aeron_udp_channel_transport_dpdk_port_t *port = NULL;
+    aeron_udp_channel_transport_dpdk_t *dpdk = NULL;
+    char ring_name[RTE_RING_NAMESIZE];
+
+    transport->fd = -1;
+    transport->bindings_clientd = NULL;
+    transport->recv_timestamp_ns = 0;
+
+    if (AF_INET != bind_addr->ss_family || (NULL != connect_addr && AF_INET != connect_addr->ss_family))
+    {
+        aeron_set_err(EAFNOSUPPORT, "%s", "DPDK bindings are IPv4 only");
+        return -1;
+    }
+
+    if (NULL == (port = aeron_udp_channel_transport_dpdk_port_get()))
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&dpdk, sizeof(aeron_udp_channel_transport_dpdk_t)) < 0)
+    {
+        return -1;
+    }
+
+    memcpy(&dpdk->bind_addr, bind_addr, sizeof(struct sockaddr_in));
+    dpdk->is_multicast = aeron_is_addr_multicast(bind_addr);
+    dpdk->ttl = dpdk->is_multicast && ttl > 0 ? ttl : 64;
+
+    if (NULL != connect_addr)
+    {
+        memcpy(&dpdk->connect_addr, connect_addr, sizeof(struct sockaddr_in));
+        transport->is_connected = true;
+    }
+
+    snprintf(ring_name, sizeof(ring_name), "aeron_rx_%u", __sync_fetch_and_add(&ring_id, 1));
+    dpdk->ring = rte_ring_create(
+        ring_name, AERON_UDP_CHANNEL_TRANSPORT_DPDK_RING_SIZE, (int)rte_socket_id(), RING_F_SP_ENQ | RING_F_SC_DEQ);
+
+    if (NULL == dpdk->ring)
+    {
+        aeron_set_err(rte_errno, "rte_ring_create: %s", rte_strerror(rte_errno));
+        aeron_free(dpdk);
+        return -1;
+    }
+
+    /* never read, so the pollers always find it readable and call recvmmsg */
+    if ((transport->fd = eventfd(1, EFD_NONBLOCK | EFD_CLOEXEC)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "eventfd: %s", strerror(errcode));
+        rte_ring_free(dpdk->ring);
+        aeron_free(dpdk);
+        return -1;
+    }
+
+    if (aeron_udp_channel_transport_dpdk_register(port, dpdk) < 0)
+    {
+        close(transport->fd);
+        transport->fd = -1;
+        rte_ring_free(dpdk->ring);
+        aeron_free(dpdk);
+        return -1;
+    }
+
+    transport->bindings_clientd = dpdk;
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_dpdk_close(aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_channel_transport_dpdk_t *dpdk = aeron_udp_channel_transport_dpdk_state(transport);
+
+    if (NULL != dpdk)
+    {
+        struct rte_mbuf *mbufs[AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST];
+        unsigned int num_mbufs;
+
+        aeron_udp_channel_transport_dpdk_unregister(aeron_udp_channel_transport_dpdk_port, dpdk);
+
+        while ((num_mbufs = rte_ring_sc_dequeue_burst(
+            dpdk->ring, (void **)mbufs, AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST, NULL)) > 0)
+        {
+            rte_pktmbuf_free_bulk(mbufs, num_mbufs);
+        }
+
+        rte_ring_free(dpdk->ring);
+        aeron_free(dpdk);
+        transport->bindings_clientd = NULL;
+    }
+
+    if (-1 != transport->fd)
+    {
+        close(transport->fd);
+        transport->fd = -1;
+    }
+
+    return 0;
+}
+
+static bool aeron_udp_channel_transport_dpdk_is_local(
+    aeron_udp_channel_transport_dpdk_port_t *port, struct in_addr addr)
+{
+    return aeron_ipv4_does_prefix_match(&port->local_addr, &addr, port->prefixlen);
+}
+
+static aeron_udp_channel_transport_dpdk_neighbour_t *aeron_udp_channel_transport_dpdk_neighbour(
+    aeron_udp_channel_transport_dpdk_port_t *port, struct in_addr addr, bool should_add)
+{
+    for (size_t i = 0; i < port->neighbours_length; i++)
+    {
+        if (port->neighbours[i].addr.s_addr == addr.s_addr)
+        {
+            return &port->neighbours[i];
+        }
+    }
+
+    if (!should_add || port->neighbours_length >= AERON_UDP_CHANNEL_TRANSPORT_DPDK_MAX_NEIGHBOURS)
+    {
+        return NULL;
+    }
+
+    aeron_udp_channel_transport_dpdk_neighbour_t *neighbour = &port->neighbours[port->neighbours_length++];
+    neighbour->addr = addr;
+    neighbour->is_resolved = false;
+    neighbour->last_request_cycles = 0;
+
+    return neighbour;
+}
+
+static void aeron_udp_channel_transport_dpdk_learn(
+    aeron_udp_channel_transport_dpdk_port_t *port, struct in_addr addr, const uint8_t mac[6])
+{
+    if (!aeron_udp_channel_transport_dpdk_is_local(port, addr))
+    {
+        return;
+    }
+
+    rte_spinlock_lock(&port->neighbour_lock);
+
+    aeron_udp_channel_transport_dpdk_neighbour_t *neighbour =
+        aeron_udp_channel_transport_dpdk_neighbour(port, addr, true);
+    if (NULL != neighbour)
+    {
+        memcpy(neighbour->mac, mac, sizeof(neighbour->mac));
+        neighbour->is_resolved = true;
+    }
+
+    rte_spinlock_unlock(&port->neighbour_lock);
+}
+
+static void aeron_udp_channel_transport_dpdk_send_arp(
+    aeron_udp_channel_transport_dpdk_port_t *port, uint16_t op, const uint8_t target_mac[6], struct in_addr target_ip)
+{
+    struct rte_mbuf *mbuf = rte_pktmbuf_alloc(port->pool);
+    uint8_t *frame;
+
+    if (NULL == mbuf)
+    {
+        return;
+    }
+
+    if (NULL == (frame = (uint8_t *)rte_pktmbuf_append(mbuf, AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_FRAME_LENGTH)))
+    {
+        rte_pktmbuf_free(mbuf);
+        return;
+    }
+
+    aeron_udp_channel_transport_dpdk_encode_arp(frame, op, port->mac, port->local_addr, target_mac, target_ip);
+
+    rte_spinlock_lock(&port->tx_lock);
+    const uint16_t sent = rte_eth_tx_burst(port->port_id, 0, &mbuf, 1);
+    rte_spinlock_unlock(&port->tx_lock);
+
+    if (0 == sent)
+    {
+        rte_pktmbuf_free(mbuf);
+    }
+}
+
+static void aeron_udp_channel_transport_dpdk_on_arp(
+    aeron_udp_channel_transport_dpdk_port_t *port, const uint8_t *frame, size_t length)
+{
+    const uint8_t *arp = frame + AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH;
+    struct in_addr sender_ip, target_ip;
+
+    if (length < AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_FRAME_LENGTH)
+    {
+        return;
+    }
+
+    memcpy(&sender_ip, arp + 14, sizeof(sender_ip));
+    memcpy(&target_ip, arp + 24, sizeof(target_ip));
+
+    aeron_udp_channel_transport_dpdk_learn(port, sender_ip, arp + 8);
+
+    if (AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_OP_REQUEST == aeron_udp_channel_transport_dpdk_get_uint16(arp + 6) &&
+        target_ip.s_addr == port->local_addr.s_addr)
+    {
+        aeron_udp_channel_transport_dpdk_send_arp(
+            port, AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_OP_REPLY, arp + 8, sender_ip);
+    }
+}
+
+static aeron_udp_channel_transport_dpdk_t *aeron_udp_channel_transport_dpdk_find_transport(
+    aeron_udp_channel_transport_dpdk_port_t *port, struct sockaddr_in *dst_addr)
+{
+    const bool is_multicast = IN_MULTICAST(ntohl(dst_addr->sin_addr.s_addr));
+
+    if (!is_multicast && dst_addr->sin_addr.s_addr != port->local_addr.s_addr)
+    {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < port->transports_length; i++)
+    {
+        aeron_udp_channel_transport_dpdk_t *dpdk = port->transports[i];
+
+        if (dpdk->bind_addr.sin_port == dst_addr->sin_port &&
+            (is_multicast ? dpdk->bind_addr.sin_addr.s_addr == dst_addr->sin_addr.s_addr : !dpdk->is_multicast))
+        {
+            return dpdk;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Drain the receive queue into the rings of the transports, if no other agent is already doing so.
+ */
+static void aeron_udp_channel_transport_dpdk_distribute(aeron_udp_channel_transport_dpdk_port_t *port)
+{
+    struct rte_mbuf *mbufs[AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST];
+
+    if (!rte_spinlock_trylock(&port->rx_lock))
+    {
+        return;
+    }
+
+    const uint16_t num_mbufs = rte_eth_rx_burst(port->port_id, 0, mbufs, AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST);
+
+    for (uint16_t i = 0; i < num_mbufs; i++)
+    {
+        struct rte_mbuf *mbuf = mbufs[i];
+        const uint8_t *frame = rte_pktmbuf_mtod(mbuf, const uint8_t *);
+        const size_t length = rte_pktmbuf_data_len(mbuf);
+        struct sockaddr_in src_addr, dst_addr;
+        size_t payload_offset, payload_length;
+
+        if (length >= AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH &&
+            AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_TYPE_ARP == aeron_udp_channel_transport_dpdk_get_uint16(frame + 12))
+        {
+            aeron_udp_channel_transport_dpdk_on_arp(port, frame, length);
+        }
+        else if (aeron_udp_channel_transport_dpdk_decode_headers(
+            frame, length, &src_addr, &dst_addr, &payload_offset, &payload_length))
+        {
+            aeron_udp_channel_transport_dpdk_t *dpdk = aeron_udp_channel_transport_dpdk_find_transport(port, &dst_addr);
+
+            if (NULL != dpdk && rte_ring_sp_enqueue(dpdk->ring, mbuf) == 0)
+            {
+                continue;
+            }
+        }
+
+        rte_pktmbuf_free(mbuf);
+    }
+
+    rte_spinlock_unlock(&port->rx_lock);
+}
+
+int aeron_udp_channel_transport_dpdk_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    aeron_udp_channel_transport_dpdk_t *dpdk = aeron_udp_channel_transport_dpdk_state(transport);
+    struct rte_mbuf *mbufs[AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST];
+
+    aeron_udp_channel_transport_dpdk_distribute(aeron_udp_channel_transport_dpdk_port);
+
+    const unsigned int num_mbufs = rte_ring_sc_dequeue_burst(
+        dpdk->ring,
+        (void **)mbufs,
+        vlen < AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST ? (unsigned int)vlen : AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST,
+        NULL);
+
+    for (unsigned int i = 0; i < num_mbufs; i++)
+    {
+        uint8_t *frame = rte_pktmbuf_mtod(mbufs[i], uint8_t *);
+        struct sockaddr_storage src_addr;
+        struct sockaddr_in dst_addr;
+        size_t payload_offset = 0, payload_length = 0;
+
+        /* already validated when distributed */
+        aeron_udp_channel_transport_dpdk_decode_headers(
+            frame,
+            rte_pktmbuf_data_len(mbufs[i]),
+            (struct sockaddr_in *)&src_addr,
+            &dst_addr,
+            &payload_offset,
+            &payload_length);
+
+        recv_func(clientd, transport->dispatch_clientd, frame + payload_offset, payload_length, &src_addr);
+        msgvec[i].msg_len = (unsigned int)payload_length;
+    }
+
+    if (num_mbufs > 0)
+    {
+        rte_pktmbuf_free_bulk(mbufs, num_mbufs);
+    }
+
+    return (int)num_mbufs;
+}
+
+/*
+ * Ethernet address of the next hop to an address, or false when it is not yet known.
+ */
+static bool aeron_udp_channel_transport_dpdk_next_hop(
+    aeron_udp_channel_transport_dpdk_port_t *port, struct in_addr addr, uint8_t mac[6])
+{
+    aeron_udp_channel_transport_dpdk_neighbour_t *neighbour;
+    bool should_request = false;
+    bool is_resolved = false;
+
+    if (IN_MULTICAST(ntohl(addr.s_addr)))
+    {
+        aeron_udp_channel_transport_dpdk_multicast_mac(addr, mac);
+        return true;
+    }
+
+    if (!aeron_udp_channel_transport_dpdk_is_local(port, addr))
+    {
+        if (!port->has_gateway)
+        {
+            return false;
+        }
+
+        addr = port->gateway_addr;
+    }
+
+    rte_spinlock_lock(&port->neighbour_lock);
+
+    if (NULL != (neighbour = aeron_udp_channel_transport_dpdk_neighbour(port, addr, true)))
+    {
+        const uint64_t now_cycles = rte_get_timer_cycles();
+
+        if (neighbour->is_resolved)
+        {
+            memcpy(mac, neighbour->mac, AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH);
+            is_resolved = true;
+        }
+        else if (now_cycles - neighbour->last_request_cycles > port->arp_retry_cycles)
+        {
+            neighbour->last_request_cycles = now_cycles;
+            should_request = true;
+        }
+    }
+
+    rte_spinlock_unlock(&port->neighbour_lock);
+
+    if (should_request)
+    {
+        aeron_udp_channel_transport_dpdk_send_arp(port, AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_OP_REQUEST, NULL, addr);
+    }
+
+    return is_resolved;
+}
+
+/*
+ * Build the frame for a message into an mbuf. Returns 1 with the mbuf, 0 if the message is dropped as its next hop is
+ * unresolved, or -1 on error.
+ */
+static int aeron_udp_channel_transport_dpdk_build(
+    aeron_udp_channel_transport_dpdk_port_t *port,
+    aeron_udp_channel_transport_dpdk_t *dpdk,
+    struct msghdr *message,
+    struct rte_mbuf **mbuf,
+    size_t *payload_length)
+{
+    struct sockaddr_in src_addr = dpdk->bind_addr;
+    struct sockaddr_in *dst_addr = NULL != message->msg_name ?
+        (struct sockaddr_in *)message->msg_name : &dpdk->connect_addr;
+    uint8_t dst_mac[AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH];
+    uint8_t *frame;
+    size_t length = 0;
+
+    if (AF_INET != dst_addr->sin_family)
+    {
+        aeron_set_err(EAFNOSUPPORT, "%s", "DPDK bindings are IPv4 only");
+        return -1;
+    }
+
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        length += message->msg_iov[i].iov_len;
+    }
+
+    *payload_length = length;
+
+    if (!aeron_udp_channel_transport_dpdk_next_hop(port, dst_addr->sin_addr, dst_mac))
+    {
+        return 0;
+    }
+
+    if (NULL == (*mbuf = rte_pktmbuf_alloc(port->pool)))
+    {
+        aeron_set_err(ENOBUFS, "%s", "rte_pktmbuf_alloc: mbuf pool exhausted");
+        return -1;
+    }
+
+    frame = (uint8_t *)rte_pktmbuf_append(*mbuf, (uint16_t)(AERON_UDP_CHANNEL_TRANSPORT_DPDK_HEADERS_LENGTH + length));
+    if (NULL == frame)
+    {
+        rte_pktmbuf_free(*mbuf);
+        aeron_set_err(EMSGSIZE, "datagram of %d bytes too long for an mbuf", (int)length);
+        return -1;
+    }
+
+    src_addr.sin_addr = port->local_addr;
+    aeron_udp_channel_transport_dpdk_encode_headers(frame, port->mac, dst_mac, &src_addr, dst_addr, dpdk->ttl, length);
+
+    /* term buffers are not DMA mapped for the NIC, so the payload is copied behind the headers */
+    uint8_t *payload = frame + AERON_UDP_CHANNEL_TRANSPORT_DPDK_HEADERS_LENGTH;
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        memcpy(payload, message->msg_iov[i].iov_base, message->msg_iov[i].iov_len);
+        payload += message->msg_iov[i].iov_len;
+    }
+
+    return 1;
+}
+
+int aeron_udp_channel_transport_dpdk_sendmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    aeron_udp_channel_transport_dpdk_port_t *port = aeron_udp_channel_transport_dpdk_port;
+    aeron_udp_channel_transport_dpdk_t *dpdk = aeron_udp_channel_transport_dpdk_state(transport);
+    struct rte_mbuf *mbufs[AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST];
+    size_t message_index[AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST];
+    uint16_t num_mbufs = 0;
+    size_t num_messages = 0;
+
+    for (; num_messages < vlen && num_mbufs < AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST; num_messages++)
+    {
+        size_t payload_length = 0;
+        const int result = aeron_udp_channel_transport_dpdk_build(
+            port, dpdk, &msgvec[num_messages].msg_hdr, &mbufs[num_mbufs], &payload_length);
+
+        if (result < 0)
+        {
+            if (0 == num_messages)
+            {
+                return -1;
+            }
+
+            break;
+        }
+
+        msgvec[num_messages].msg_len = (unsigned int)payload_length;
+
+        if (result > 0)
+        {
+            message_index[num_mbufs++] = num_messages;
+        }
+    }
+
+    if (0 == num_mbufs)
+    {
+        return (int)num_messages;
+    }
+
+    rte_spinlock_lock(&port->tx_lock);
+    const uint16_t num_sent = rte_eth_tx_burst(port->port_id, 0, mbufs, num_mbufs);
+    rte_spinlock_unlock(&port->tx_lock);
+
+    if (num_sent < num_mbufs)
+    {
+        rte_pktmbuf_free_bulk(&mbufs[num_sent], num_mbufs - num_sent);
+
+        /* messages after the first one the queue had no room for are retried by the caller */
+        return (int)message_index[num_sent];
+    }
+
+    return (int)num_messages;
+}
+
+int aeron_udp_channel_transport_dpdk_sendmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    struct mmsghdr mmsg;
+
+    mmsg.msg_hdr = *message;
+    mmsg.msg_len = 0;
+
+    const int result = aeron_udp_channel_transport_dpdk_sendmmsg(transport, &mmsg, 1);
+
+    return result <= 0 ? result : (int)mmsg.msg_len;
+}
+
+int aeron_udp_channel_transport_dpdk_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf)
+{
+    *so_rcvbuf = AERON_UDP_CHANNEL_TRANSPORT_DPDK_RING_SIZE * (RTE_MBUF_DEFAULT_BUF_SIZE - RTE_PKTMBUF_HEADROOM);
+
+    return 0;
+}
+
+#endif
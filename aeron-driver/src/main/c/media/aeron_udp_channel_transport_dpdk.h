@@ -0,0 +1,123 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_UDP_CHANNEL_TRANSPORT_DPDK_H
+#define AERON_AERON_UDP_CHANNEL_TRANSPORT_DPDK_H
+
+#include "media/aeron_udp_channel_transport_bindings.h"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_DPDK "dpdk"
+
+/**
+ * Arguments for the DPDK environment abstraction layer, separated by spaces, e.g. "-l 2-3 -a 0000:3b:00.0".
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_EAL_ARGS_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_DPDK_EAL_ARGS"
+
+/**
+ * DPDK port id of the NIC to use for DPDK bindings. Defaults to 0.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_PORT_ID_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_DPDK_PORT_ID"
+
+/**
+ * IPv4 address and prefix length the DPDK port answers to, e.g. 10.0.0.5/24, as the port has no kernel interface to
+ * take them from.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_LOCAL_ADDRESS_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_DPDK_LOCAL_ADDRESS"
+
+/**
+ * IPv4 address of the gateway for destinations outside the local prefix. If not set such destinations are dropped.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_GATEWAY_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_DPDK_GATEWAY"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_ADDR_LENGTH (6)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH (14)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_IPV4_HEADER_LENGTH (20)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_UDP_HEADER_LENGTH (8)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_HEADERS_LENGTH \
+    (AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH + \
+    AERON_UDP_CHANNEL_TRANSPORT_DPDK_IPV4_HEADER_LENGTH + \
+    AERON_UDP_CHANNEL_TRANSPORT_DPDK_UDP_HEADER_LENGTH)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_FRAME_LENGTH (AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH + 28)
+
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_TYPE_IPV4 (0x0800)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_TYPE_ARP (0x0806)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_OP_REQUEST (1)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_OP_REPLY (2)
+
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_BURST (32)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_RING_SIZE (1024)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_MAX_TRANSPORTS (64)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_MAX_NEIGHBOURS (256)
+#define AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_RETRY_NS (1000 * 1000LL)
+
+/*
+ * Write the Ethernet, IPv4 and UDP headers for a datagram of payload_length to frame, which must have
+ * AERON_UDP_CHANNEL_TRANSPORT_DPDK_HEADERS_LENGTH bytes before the payload. The UDP checksum is left as zero, which
+ * IPv4 allows, and the IPv4 header checksum is computed.
+ */
+void aeron_udp_channel_transport_dpdk_encode_headers(
+    uint8_t *frame,
+    const uint8_t src_mac[6],
+    const uint8_t dst_mac[6],
+    struct sockaddr_in *src_addr,
+    struct sockaddr_in *dst_addr,
+    uint8_t ttl,
+    size_t payload_length);
+
+/*
+ * Parse an Ethernet frame holding an unfragmented IPv4 UDP datagram. Returns false for any other frame.
+ */
+bool aeron_udp_channel_transport_dpdk_decode_headers(
+    const uint8_t *frame,
+    size_t length,
+    struct sockaddr_in *src_addr,
+    struct sockaddr_in *dst_addr,
+    size_t *payload_offset,
+    size_t *payload_length);
+
+/*
+ * Write an ARP request or reply over Ethernet, broadcast when target_mac is NULL.
+ */
+void aeron_udp_channel_transport_dpdk_encode_arp(
+    uint8_t *frame,
+    uint16_t op,
+    const uint8_t sender_mac[6],
+    struct in_addr sender_ip,
+    const uint8_t target_mac[6],
+    struct in_addr target_ip);
+
+/*
+ * Ethernet address an IPv4 multicast group is delivered to.
+ */
+void aeron_udp_channel_transport_dpdk_multicast_mac(struct in_addr group, uint8_t mac[6]);
+
+#if defined(HAVE_DPDK)
+
+/*
+ * Media bindings that drive a NIC with a DPDK poll-mode driver instead of the kernel UDP stack, selected with
+ * AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA=dpdk or media-bindings=dpdk on a channel. IPv4 only.
+ * <p>
+ * The port has one receive and one transmit queue, shared by all transports. Whichever agent polls first takes the
+ * receive queue, hands each datagram to the ring of the transport it is addressed to, and resolves ARP; each transport
+ * then dispatches the received mbufs in place. Sends are built in mbufs and put on the transmit queue in one burst per
+ * sendmmsg. Neighbours are learned with ARP and datagrams to a neighbour not yet resolved are dropped, to be recovered
+ * by the protocol. The fd of each transport is always readable so the pollers call into the bindings every cycle.
+ */
+extern aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_dpdk;
+
+#endif
+
+#endif //AERON_AERON_UDP_CHANNEL_TRANSPORT_DPDK_H
@@ -0,0 +1,1012 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "util/aeron_error.h"
+#include "media/aeron_udp_channel_transport_ibverbs.h"
+
+int aeron_udp_channel_transport_ibverbs_gid_from_addr(struct sockaddr_storage *addr, uint8_t gid[16])
+{
+    if (AF_INET == addr->ss_family)
+    {
+        memset(gid, 0, 10);
+        gid[10] = 0xFF;
+        gid[11] = 0xFF;
+        memcpy(&gid[12], &((struct sockaddr_in *)addr)->sin_addr, sizeof(struct in_addr));
+        return 0;
+    }
+
+    if (AF_INET6 == addr->ss_family)
+    {
+        memcpy(gid, &((struct sockaddr_in6 *)addr)->sin6_addr, sizeof(struct in6_addr));
+        return 0;
+    }
+
+    return -1;
+}
+
+void aeron_udp_channel_transport_ibverbs_advertisement_encode(
+    aeron_udp_channel_transport_ibverbs_advertisement_t *advertisement,
+    uint32_t qpn,
+    uint32_t qkey,
+    const uint8_t gid[16])
+{
+    advertisement->frame_header.frame_length = (int32_t)sizeof(aeron_udp_channel_transport_ibverbs_advertisement_t);
+    advertisement->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    advertisement->frame_header.flags = 0;
+    advertisement->frame_header.type = (int16_t)AERON_HDR_TYPE_EXT;
+    advertisement->magic = AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_ADVERTISEMENT_MAGIC;
+    advertisement->qpn = qpn;
+    advertisement->qkey = qkey;
+    memcpy(advertisement->gid, gid, sizeof(advertisement->gid));
+}
+
+bool aeron_udp_channel_transport_ibverbs_is_advertisement(const uint8_t *buffer, size_t length)
+{
+    const aeron_udp_channel_transport_ibverbs_advertisement_t *advertisement =
+        (const aeron_udp_channel_transport_ibverbs_advertisement_t *)buffer;
+
+    return length == sizeof(aeron_udp_channel_transport_ibverbs_advertisement_t) &&
+        (int16_t)AERON_HDR_TYPE_EXT == advertisement->frame_header.type &&
+        AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_ADVERTISEMENT_MAGIC == advertisement->magic;
+}
+
+#if defined(HAVE_IBVERBS)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <infiniband/verbs.h>
+#include "util/aeron_netutil.h"
+#include "aeron_alloc.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+typedef struct aeron_udp_channel_transport_ibverbs_peer_stct
+{
+    struct sockaddr_storage addr;
+    /* NULL until the peer has advertised its queue pair */
+    struct ibv_ah *ah;
+    uint32_t qpn;
+    uint32_t qkey;
+    bool is_advertised;
+}
+aeron_udp_channel_transport_ibverbs_peer_t;
+
+typedef struct aeron_udp_channel_transport_ibverbs_stct
+{
+    /* the socket the transport would have had under the default bindings */
+    aeron_udp_channel_transport_t udp;
+    struct sockaddr_storage connect_addr;
+
+    struct ibv_context *context;
+    struct ibv_pd *pd;
+    struct ibv_comp_channel *channel;
+    struct ibv_cq *send_cq;
+    struct ibv_cq *recv_cq;
+    struct ibv_qp *qp;
+    struct ibv_mr *recv_mr;
+    struct ibv_mr *send_mr;
+    uint8_t *recv_slots;
+    uint8_t *send_slots;
+    size_t slot_length;
+    size_t max_datagram_length;
+    uint32_t max_inline_length;
+    uint64_t send_head;
+    uint64_t send_tail;
+    uint8_t port_num;
+    int gid_index;
+    uint8_t gid[16];
+
+    aeron_udp_channel_transport_ibverbs_peer_t peers[AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_MAX_PEERS];
+    size_t peers_length;
+}
+aeron_udp_channel_transport_ibverbs_t;
+
+typedef struct aeron_udp_channel_transport_ibverbs_recv_stct
+{
+    aeron_udp_channel_transport_t *transport;
+    aeron_udp_channel_transport_ibverbs_t *ibverbs;
+    aeron_udp_transport_recv_func_t recv_func;
+    void *clientd;
+}
+aeron_udp_channel_transport_ibverbs_recv_t;
+
+int aeron_udp_channel_transport_ibverbs_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr);
+
+int aeron_udp_channel_transport_ibverbs_close(aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_channel_transport_ibverbs_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
+int aeron_udp_channel_transport_ibverbs_sendmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen);
+
+int aeron_udp_channel_transport_ibverbs_sendmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message);
+
+int aeron_udp_channel_transport_ibverbs_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf);
+
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_ibverbs =
+    {
+        aeron_udp_channel_transport_ibverbs_init,
+        aeron_udp_channel_transport_ibverbs_close,
+        aeron_udp_channel_transport_ibverbs_recvmmsg,
+        aeron_udp_channel_transport_ibverbs_sendmmsg,
+        aeron_udp_channel_transport_ibverbs_sendmsg,
+        aeron_udp_channel_transport_ibverbs_get_so_rcvbuf
+    };
+
+static inline aeron_udp_channel_transport_ibverbs_t *aeron_udp_channel_transport_ibverbs_state(
+    aeron_udp_channel_transport_t *transport)
+{
+    return (aeron_udp_channel_transport_ibverbs_t *)transport->bindings_clientd;
+}
+
+static bool aeron_udp_channel_transport_ibverbs_is_gid_family(const uint8_t gid[16], sa_family_t family)
+{
+    static const uint8_t ipv4_mapped_prefix[12] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF };
+    const bool is_ipv4_mapped = memcmp(gid, ipv4_mapped_prefix, sizeof(ipv4_mapped_prefix)) == 0;
+
+    return AF_INET == family ? is_ipv4_mapped : !is_ipv4_mapped;
+}
+
+/*
+ * Open the device and find the port and RoCE v2 GID index the bind address is reachable on.
+ */
+static int aeron_udp_channel_transport_ibverbs_open_device(
+    aeron_udp_channel_transport_ibverbs_t *ibverbs, struct sockaddr_storage *bind_addr)
+{
+    const char *device_name = getenv(AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_DEVICE_ENV_VAR);
+    const bool is_wildcard = aeron_is_wildcard_addr(bind_addr);
+    uint8_t bind_gid[16];
+    int num_devices = 0;
+    struct ibv_device **devices = NULL;
+
+    if (aeron_udp_channel_transport_ibverbs_gid_from_addr(bind_addr, bind_gid) < 0)
+    {
+        aeron_set_err(EINVAL, "%s", "ibverbs bindings need an IPv4 or IPv6 bind address");
+        return -1;
+    }
+
+    if (NULL == (devices = ibv_get_device_list(&num_devices)))
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "ibv_get_device_list: %s", strerror(errcode));
+        return -1;
+    }
+
+    for (int i = 0; i < num_devices; i++)
+    {
+        struct ibv_context *context = NULL;
+        struct ibv_device_attr device_attr;
+
+        if (NULL != device_name && strcmp(ibv_get_device_name(devices[i]), device_name) != 0)
+        {
+            continue;
+        }
+
+        if (NULL == (context = ibv_open_device(devices[i])))
+        {
+            continue;
+        }
+
+        if (ibv_query_device(context, &device_attr) == 0)
+        {
+            for (uint8_t port_num = 1; port_num <= device_attr.phys_port_cnt; port_num++)
+            {
+                struct ibv_port_attr port_attr;
+
+                if (ibv_query_port(context, port_num, &port_attr) != 0 || IBV_PORT_ACTIVE != port_attr.state)
+                {
+                    continue;
+                }
+
+                for (int gid_index = 0; gid_index < port_attr.gid_tbl_len; gid_index++)
+                {
+                    struct ibv_gid_entry entry;
+
+                    if (ibv_query_gid_ex(context, port_num, (uint32_t)gid_index, &entry, 0) != 0 ||
+                        IBV_GID_TYPE_ROCE_V2 != entry.gid_type)
+                    {
+                        continue;
+                    }
+
+                    if (is_wildcard ?
+                        !aeron_udp_channel_transport_ibverbs_is_gid_family(entry.gid.raw, bind_addr->ss_family) :
+                        memcmp(entry.gid.raw, bind_gid, sizeof(bind_gid)) != 0)
+                    {
+                        continue;
+                    }
+
+                    ibverbs->context = context;
+                    ibverbs->port_num = port_num;
+                    ibverbs->gid_index = gid_index;
+                    ibverbs->max_datagram_length = (size_t)128 << port_attr.active_mtu;
+                    memcpy(ibverbs->gid, entry.gid.raw, sizeof(ibverbs->gid));
+                    ibv_free_device_list(devices);
+
+                    return 0;
+                }
+            }
+        }
+
+        ibv_close_device(context);
+    }
+
+    ibv_free_device_list(devices);
+    aeron_set_err(ENODEV, "%s", "no RDMA device has an active RoCE v2 port for the bind address");
+
+    return -1;
+}
+
+static int aeron_udp_channel_transport_ibverbs_post_recv(aeron_udp_channel_transport_ibverbs_t *ibverbs, size_t slot)
+{
+    struct ibv_recv_wr *bad_wr = NULL;
+    struct ibv_sge sge =
+        {
+            .addr = (uint64_t)(uintptr_t)(ibverbs->recv_slots + (slot * ibverbs->slot_length)),
+            .length = (uint32_t)ibverbs->slot_length,
+            .lkey = ibverbs->recv_mr->lkey
+        };
+    struct ibv_recv_wr wr =
+        {
+            .wr_id = slot,
+            .next = NULL,
+            .sg_list = &sge,
+            .num_sge = 1
+        };
+
+    int result = ibv_post_recv(ibverbs->qp, &wr, &bad_wr);
+    if (0 != result)
+    {
+        aeron_set_err(result, "ibv_post_recv: %s", strerror(result));
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_udp_channel_transport_ibverbs_modify_qp(
+    aeron_udp_channel_transport_ibverbs_t *ibverbs, struct ibv_qp_attr *attr, int attr_mask)
+{
+    int result = ibv_modify_qp(ibverbs->qp, attr, attr_mask);
+    if (0 != result)
+    {
+        aeron_set_err(result, "ibv_modify_qp(%d): %s", (int)attr->qp_state, strerror(result));
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_udp_channel_transport_ibverbs_create_qp(aeron_udp_channel_transport_ibverbs_t *ibverbs)
+{
+    struct ibv_qp_init_attr init_attr;
+    struct ibv_qp_attr attr;
+    const char *failed = NULL;
+
+    if (NULL == (ibverbs->pd = ibv_alloc_pd(ibverbs->context)))
+    {
+        failed = "ibv_alloc_pd";
+    }
+    else if (NULL == (ibverbs->channel = ibv_create_comp_channel(ibverbs->context)))
+    {
+        failed = "ibv_create_comp_channel";
+    }
+    else if (fcntl(ibverbs->channel->fd, F_SETFL, fcntl(ibverbs->channel->fd, F_GETFL) | O_NONBLOCK) < 0)
+    {
+        failed = "fcntl(O_NONBLOCK)";
+    }
+    else if (NULL == (ibverbs->send_cq = ibv_create_cq(
+        ibverbs->context, AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SEND_SLOTS, NULL, NULL, 0)))
+    {
+        failed = "ibv_create_cq";
+    }
+    else if (NULL == (ibverbs->recv_cq = ibv_create_cq(
+        ibverbs->context, AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_RECV_SLOTS, NULL, ibverbs->channel, 0)))
+    {
+        failed = "ibv_create_cq";
+    }
+
+    if (NULL != failed)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "%s: %s", failed, strerror(errcode));
+        return -1;
+    }
+
+    memset(&init_attr, 0, sizeof(init_attr));
+    init_attr.send_cq = ibverbs->send_cq;
+    init_attr.recv_cq = ibverbs->recv_cq;
+    init_attr.cap.max_send_wr = AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SEND_SLOTS;
+    init_attr.cap.max_recv_wr = AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_RECV_SLOTS;
+    init_attr.cap.max_send_sge = 1;
+    init_attr.cap.max_recv_sge = 1;
+    init_attr.cap.max_inline_data = 256;
+    init_attr.qp_type = IBV_QPT_UD;
+    /* only every AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SIGNAL_INTERVAL send completes, which frees the slots before it */
+    init_attr.sq_sig_all = 0;
+
+    if (NULL == (ibverbs->qp = ibv_create_qp(ibverbs->pd, &init_attr)))
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "ibv_create_qp: %s", strerror(errcode));
+        return -1;
+    }
+
+    ibverbs->max_inline_length = init_attr.cap.max_inline_data;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.qp_state = IBV_QPS_INIT;
+    attr.pkey_index = 0;
+    attr.port_num = ibverbs->port_num;
+    attr.qkey = AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_QKEY;
+    if (aeron_udp_channel_transport_ibverbs_modify_qp(
+        ibverbs, &attr, IBV_QP_STATE | IBV_QP_PKEY_INDEX | IBV_QP_PORT | IBV_QP_QKEY) < 0)
+    {
+        return -1;
+    }
+
+    memset(&attr, 0, sizeof(attr));
+    attr.qp_state = IBV_QPS_RTR;
+    if (aeron_udp_channel_transport_ibverbs_modify_qp(ibverbs, &attr, IBV_QP_STATE) < 0)
+    {
+        return -1;
+    }
+
+    memset(&attr, 0, sizeof(attr));
+    attr.qp_state = IBV_QPS_RTS;
+    attr.sq_psn = 0;
+    if (aeron_udp_channel_transport_ibverbs_modify_qp(ibverbs, &attr, IBV_QP_STATE | IBV_QP_SQ_PSN) < 0)
+    {
+        return -1;
+    }
+
+    return ibv_req_notify_cq(ibverbs->recv_cq, 0) == 0 ? 0 : -1;
+}
+
+static int aeron_udp_channel_transport_ibverbs_register_slots(aeron_udp_channel_transport_ibverbs_t *ibverbs)
+{
+    /* a UD receive starts with the global routing header, which is not part of the datagram */
+    ibverbs->slot_length = AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_GRH_LENGTH + ibverbs->max_datagram_length;
+
+    const size_t recv_length = AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_RECV_SLOTS * ibverbs->slot_length;
+    const size_t send_length = AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SEND_SLOTS * ibverbs->max_datagram_length;
+
+    if (aeron_alloc((void **)&ibverbs->recv_slots, recv_length) < 0 ||
+        aeron_alloc((void **)&ibverbs->send_slots, send_length) < 0)
+    {
+        return -1;
+    }
+
+    if (NULL == (ibverbs->recv_mr = ibv_reg_mr(
+        ibverbs->pd, ibverbs->recv_slots, recv_length, IBV_ACCESS_LOCAL_WRITE)) ||
+        NULL == (ibverbs->send_mr = ibv_reg_mr(ibverbs->pd, ibverbs->send_slots, send_length, 0)))
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "ibv_reg_mr: %s", strerror(errcode));
+        return -1;
+    }
+
+    for (size_t i = 0; i < AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_RECV_SLOTS; i++)
+    {
+        if (aeron_udp_channel_transport_ibverbs_post_recv(ibverbs, i) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static void aeron_udp_channel_transport_ibverbs_release(aeron_udp_channel_transport_ibverbs_t *ibverbs)
+{
+    for (size_t i = 0; i < ibverbs->peers_length; i++)
+    {
+        if (NULL != ibverbs->peers[i].ah)
+        {
+            ibv_destroy_ah(ibverbs->peers[i].ah);
+        }
+    }
+
+    if (NULL != ibverbs->qp)
+    {
+        ibv_destroy_qp(ibverbs->qp);
+    }
+
+    if (NULL != ibverbs->send_mr)
+    {
+        ibv_dereg_mr(ibverbs->send_mr);
+    }
+
+    if (NULL != ibverbs->recv_mr)
+    {
+        ibv_dereg_mr(ibverbs->recv_mr);
+    }
+
+    if (NULL != ibverbs->recv_cq)
+    {
+        ibv_destroy_cq(ibverbs->recv_cq);
+    }
+
+    if (NULL != ibverbs->send_cq)
+    {
+        ibv_destroy_cq(ibverbs->send_cq);
+    }
+
+    if (NULL != ibverbs->channel)
+    {
+        ibv_destroy_comp_channel(ibverbs->channel);
+    }
+
+    if (NULL != ibverbs->pd)
+    {
+        ibv_dealloc_pd(ibverbs->pd);
+    }
+
+    if (NULL != ibverbs->context)
+    {
+        ibv_close_device(ibverbs->context);
+    }
+
+    aeron_free(ibverbs->send_slots);
+    aeron_free(ibverbs->recv_slots);
+    aeron_free(ibverbs);
+}
+
+static int aeron_udp_channel_transport_ibverbs_epoll_add(int epoll_fd, int fd)
+{
+    struct epoll_event event;
+
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "epoll_ctl(EPOLL_CTL_ADD): %s", strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_ibverbs_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr)
+{
+    aeron_udp_channel_transport_ibverbs_t *ibverbs = NULL;
+    int epoll_fd = -1;
+
+    transport->fd = -1;
+    transport->bindings_clientd = NULL;
+
+    if (aeron_alloc((void **)&ibverbs, sizeof(aeron_udp_channel_transport_ibverbs_t)) < 0)
+    {
+        return -1;
+    }
+
+    ibverbs->udp.fd = -1;
+
+    if (aeron_udp_channel_transport_ibverbs_open_device(ibverbs, bind_addr) < 0 ||
+        aeron_udp_channel_transport_ibverbs_create_qp(ibverbs) < 0 ||
+        aeron_udp_channel_transport_ibverbs_register_slots(ibverbs) < 0)
+    {
+        aeron_udp_channel_transport_ibverbs_release(ibverbs);
+        return -1;
+    }
+
+    if (aeron_udp_channel_transport_init(
+        &ibverbs->udp,
+        bind_addr,
+        multicast_if_addr,
+        multicast_if_index,
+        ttl,
+        socket_rcvbuf,
+        socket_sndbuf,
+        use_gro,
+        busy_poll_us,
+        prefer_busy_poll,
+        use_rx_timestamping,
+        connect_addr) < 0)
+    {
+        aeron_udp_channel_transport_ibverbs_release(ibverbs);
+        return -1;
+    }
+
+    if (NULL != connect_addr)
+    {
+        memcpy(&ibverbs->connect_addr, connect_addr, sizeof(struct sockaddr_storage));
+    }
+
+    /* the pollers wait on one fd per transport, so both the socket and the receive completions are behind it */
+    if ((epoll_fd = epoll_create1(0)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "epoll_create1: %s", strerror(errcode));
+        aeron_udp_channel_transport_close(&ibverbs->udp);
+        aeron_udp_channel_transport_ibverbs_release(ibverbs);
+        return -1;
+    }
+
+    if (aeron_udp_channel_transport_ibverbs_epoll_add(epoll_fd, ibverbs->udp.fd) < 0 ||
+        aeron_udp_channel_transport_ibverbs_epoll_add(epoll_fd, ibverbs->channel->fd) < 0)
+    {
+        close(epoll_fd);
+        aeron_udp_channel_transport_close(&ibverbs->udp);
+        aeron_udp_channel_transport_ibverbs_release(ibverbs);
+        return -1;
+    }
+
+    transport->fd = epoll_fd;
+    transport->is_connected = ibverbs->udp.is_connected;
+    transport->recv_timestamp_ns = 0;
+    transport->bindings_clientd = ibverbs;
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_ibverbs_close(aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_channel_transport_ibverbs_t *ibverbs = aeron_udp_channel_transport_ibverbs_state(transport);
+
+    if (NULL != ibverbs)
+    {
+        aeron_udp_channel_transport_close(&ibverbs->udp);
+        aeron_udp_channel_transport_ibverbs_release(ibverbs);
+        transport->bindings_clientd = NULL;
+    }
+
+    return aeron_udp_channel_transport_close(transport);
+}
+
+static bool aeron_udp_channel_transport_ibverbs_is_same_addr(struct sockaddr_storage *a, struct sockaddr_storage *b)
+{
+    if (a->ss_family != b->ss_family)
+    {
+        return false;
+    }
+
+    if (AF_INET == a->ss_family)
+    {
+        struct sockaddr_in *in_a = (struct sockaddr_in *)a;
+        struct sockaddr_in *in_b = (struct sockaddr_in *)b;
+
+        return in_a->sin_port == in_b->sin_port && in_a->sin_addr.s_addr == in_b->sin_addr.s_addr;
+    }
+
+    struct sockaddr_in6 *in6_a = (struct sockaddr_in6 *)a;
+    struct sockaddr_in6 *in6_b = (struct sockaddr_in6 *)b;
+
+    return in6_a->sin6_port == in6_b->sin6_port &&
+        memcmp(&in6_a->sin6_addr, &in6_b->sin6_addr, sizeof(struct in6_addr)) == 0;
+}
+
+static aeron_udp_channel_transport_ibverbs_peer_t *aeron_udp_channel_transport_ibverbs_peer(
+    aeron_udp_channel_transport_ibverbs_t *ibverbs, struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_transport_ibverbs_peer_t *peer = NULL;
+
+    if (aeron_is_addr_multicast(addr))
+    {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < ibverbs->peers_length; i++)
+    {
+        if (aeron_udp_channel_transport_ibverbs_is_same_addr(&ibverbs->peers[i].addr, addr))
+        {
+            return &ibverbs->peers[i];
+        }
+    }
+
+    /* peers past the limit are reached over UDP */
+    if (ibverbs->peers_length >= AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_MAX_PEERS)
+    {
+        return NULL;
+    }
+
+    peer = &ibverbs->peers[ibverbs->peers_length++];
+    memcpy(&peer->addr, addr, sizeof(struct sockaddr_storage));
+    peer->ah = NULL;
+    peer->qpn = 0;
+    peer->qkey = 0;
+    peer->is_advertised = false;
+
+    return peer;
+}
+
+static void aeron_udp_channel_transport_ibverbs_advertise(
+    aeron_udp_channel_transport_ibverbs_t *ibverbs, aeron_udp_channel_transport_ibverbs_peer_t *peer)
+{
+    aeron_udp_channel_transport_ibverbs_advertisement_t advertisement;
+    struct iovec iov;
+    struct msghdr message;
+
+    aeron_udp_channel_transport_ibverbs_advertisement_encode(
+        &advertisement, ibverbs->qp->qp_num, AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_QKEY, ibverbs->gid);
+
+    iov.iov_base = &advertisement;
+    iov.iov_len = sizeof(advertisement);
+    memset(&message, 0, sizeof(message));
+    message.msg_name = ibverbs->udp.is_connected ? NULL : &peer->addr;
+    message.msg_namelen = ibverbs->udp.is_connected ?
+        0 : (AF_INET6 == peer->addr.ss_family ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+
+    /* a lost advertisement is sent again when the peer advertises or the next datagram to it goes over UDP */
+    peer->is_advertised = aeron_udp_channel_transport_sendmsg(&ibverbs->udp, &message) > 0;
+}
+
+static void aeron_udp_channel_transport_ibverbs_on_advertisement(
+    aeron_udp_channel_transport_ibverbs_t *ibverbs,
+    aeron_udp_channel_transport_ibverbs_advertisement_t *advertisement,
+    struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_transport_ibverbs_peer_t *peer = aeron_udp_channel_transport_ibverbs_peer(ibverbs, addr);
+
+    if (NULL == peer)
+    {
+        return;
+    }
+
+    if (NULL == peer->ah || peer->qpn != advertisement->qpn)
+    {
+        struct ibv_ah_attr ah_attr;
+
+        memset(&ah_attr, 0, sizeof(ah_attr));
+        ah_attr.is_global = 1;
+        ah_attr.port_num = ibverbs->port_num;
+        ah_attr.grh.sgid_index = (uint8_t)ibverbs->gid_index;
+        ah_attr.grh.hop_limit = 64;
+        memcpy(ah_attr.grh.dgid.raw, advertisement->gid, sizeof(advertisement->gid));
+
+        if (NULL != peer->ah)
+        {
+            ibv_destroy_ah(peer->ah);
+        }
+
+        /* a peer whose GID cannot be routed to stays on UDP */
+        peer->ah = ibv_create_ah(ibverbs->pd, &ah_attr);
+        peer->qpn = advertisement->qpn;
+        peer->qkey = advertisement->qkey;
+    }
+
+    if (!peer->is_advertised)
+    {
+        aeron_udp_channel_transport_ibverbs_advertise(ibverbs, peer);
+    }
+}
+
+static void aeron_udp_channel_transport_ibverbs_on_udp_message(
+    void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_transport_ibverbs_recv_t *recv = (aeron_udp_channel_transport_ibverbs_recv_t *)clientd;
+    aeron_udp_channel_transport_ibverbs_t *ibverbs = recv->ibverbs;
+
+    if (aeron_udp_channel_transport_ibverbs_is_advertisement(buffer, length))
+    {
+        aeron_udp_channel_transport_ibverbs_on_advertisement(
+            ibverbs, (aeron_udp_channel_transport_ibverbs_advertisement_t *)buffer, addr);
+        return;
+    }
+
+    aeron_udp_channel_transport_ibverbs_peer_t *peer = aeron_udp_channel_transport_ibverbs_peer(ibverbs, addr);
+    if (NULL != peer && !peer->is_advertised)
+    {
+        aeron_udp_channel_transport_ibverbs_advertise(ibverbs, peer);
+    }
+
+    recv->transport->recv_timestamp_ns = ibverbs->udp.recv_timestamp_ns;
+    recv->recv_func(recv->clientd, transport_clientd, buffer, length, addr);
+}
+
+static aeron_udp_channel_transport_ibverbs_peer_t *aeron_udp_channel_transport_ibverbs_peer_by_qpn(
+    aeron_udp_channel_transport_ibverbs_t *ibverbs, uint32_t qpn)
+{
+    for (size_t i = 0; i < ibverbs->peers_length; i++)
+    {
+        if (NULL != ibverbs->peers[i].ah && qpn == ibverbs->peers[i].qpn)
+        {
+            return &ibverbs->peers[i];
+        }
+    }
+
+    return NULL;
+}
+
+static int aeron_udp_channel_transport_ibverbs_poll_recv(
+    aeron_udp_channel_transport_ibverbs_recv_t *recv, struct mmsghdr *msgvec, size_t vlen)
+{
+    aeron_udp_channel_transport_ibverbs_t *ibverbs = recv->ibverbs;
+    struct ibv_wc wcs[AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SIGNAL_INTERVAL];
+    struct ibv_cq *event_cq = NULL;
+    void *event_context = NULL;
+    bool has_event = false;
+    int received = 0;
+
+    while (ibv_get_cq_event(ibverbs->channel, &event_cq, &event_context) == 0)
+    {
+        ibv_ack_cq_events(event_cq, 1);
+        has_event = true;
+    }
+
+    /* armed before polling so a completion that lands after the poll still makes the fd readable */
+    if (has_event)
+    {
+        ibv_req_notify_cq(ibverbs->recv_cq, 0);
+    }
+
+    const int max_wcs = vlen < AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SIGNAL_INTERVAL ?
+        (int)vlen : AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SIGNAL_INTERVAL;
+    const int num_wcs = ibv_poll_cq(ibverbs->recv_cq, max_wcs, wcs);
+
+    if (num_wcs < 0)
+    {
+        aeron_set_err(EIO, "%s", "ibv_poll_cq failed");
+        return -1;
+    }
+
+    for (int i = 0; i < num_wcs; i++)
+    {
+        const size_t slot = (size_t)wcs[i].wr_id;
+
+        if (IBV_WC_SUCCESS == wcs[i].status && wcs[i].byte_len > AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_GRH_LENGTH)
+        {
+            /* datagrams from a queue pair not yet advertised have no address to be attributed to */
+            aeron_udp_channel_transport_ibverbs_peer_t *peer = aeron_udp_channel_transport_ibverbs_peer_by_qpn(
+                ibverbs, wcs[i].src_qp);
+
+            if (NULL != peer)
+            {
+                const size_t length = wcs[i].byte_len - AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_GRH_LENGTH;
+                uint8_t *buffer = ibverbs->recv_slots + (slot * ibverbs->slot_length) +
+                    AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_GRH_LENGTH;
+
+                recv->transport->recv_timestamp_ns = 0;
+                recv->recv_func(recv->clientd, recv->transport->dispatch_clientd, buffer, length, &peer->addr);
+                msgvec[received++].msg_len = (unsigned int)length;
+            }
+        }
+
+        if (aeron_udp_channel_transport_ibverbs_post_recv(ibverbs, slot) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return received;
+}
+
+int aeron_udp_channel_transport_ibverbs_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    aeron_udp_channel_transport_ibverbs_t *ibverbs = aeron_udp_channel_transport_ibverbs_state(transport);
+    aeron_udp_channel_transport_ibverbs_recv_t recv =
+        {
+            .transport = transport,
+            .ibverbs = ibverbs,
+            .recv_func = recv_func,
+            .clientd = clientd
+        };
+
+    const int received = aeron_udp_channel_transport_ibverbs_poll_recv(&recv, msgvec, vlen);
+    if (received < 0 || (size_t)received >= vlen)
+    {
+        return received;
+    }
+
+    ibverbs->udp.dispatch_clientd = transport->dispatch_clientd;
+
+    const int udp_received = aeron_udp_channel_transport_recvmmsg(
+        &ibverbs->udp,
+        msgvec + received,
+        vlen - (size_t)received,
+        aeron_udp_channel_transport_ibverbs_on_udp_message,
+        &recv);
+
+    return udp_received < 0 ? udp_received : received + udp_received;
+}
+
+static bool aeron_udp_channel_transport_ibverbs_reserve_send_slot(aeron_udp_channel_transport_ibverbs_t *ibverbs)
+{
+    struct ibv_wc wcs[
+        AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SEND_SLOTS / AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SIGNAL_INTERVAL];
+
+    if (ibverbs->send_head - ibverbs->send_tail < AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SEND_SLOTS)
+    {
+        return true;
+    }
+
+    const int num_wcs = ibv_poll_cq(ibverbs->send_cq, (int)(sizeof(wcs) / sizeof(wcs[0])), wcs);
+    for (int i = 0; i < num_wcs; i++)
+    {
+        /* sends complete in order, so a signalled send frees its own slot and all those before it */
+        ibverbs->send_tail = wcs[i].wr_id + 1;
+    }
+
+    return ibverbs->send_head - ibverbs->send_tail < AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SEND_SLOTS;
+}
+
+static int aeron_udp_channel_transport_ibverbs_send(
+    aeron_udp_channel_transport_ibverbs_t *ibverbs, struct msghdr *message)
+{
+    struct sockaddr_storage *dest = NULL != message->msg_name ?
+        (struct sockaddr_storage *)message->msg_name : (ibverbs->udp.is_connected ? &ibverbs->connect_addr : NULL);
+    aeron_udp_channel_transport_ibverbs_peer_t *peer = NULL;
+    size_t length = 0;
+
+    if (NULL != dest && NULL != (peer = aeron_udp_channel_transport_ibverbs_peer(ibverbs, dest)) &&
+        !peer->is_advertised)
+    {
+        aeron_udp_channel_transport_ibverbs_advertise(ibverbs, peer);
+    }
+
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        length += message->msg_iov[i].iov_len;
+    }
+
+    if (NULL == peer || NULL == peer->ah || length > ibverbs->max_datagram_length ||
+        !aeron_udp_channel_transport_ibverbs_reserve_send_slot(ibverbs))
+    {
+        return aeron_udp_channel_transport_sendmsg(&ibverbs->udp, message);
+    }
+
+    const uint64_t sequence = ibverbs->send_head;
+    uint8_t *slot = ibverbs->send_slots +
+        ((sequence % AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SEND_SLOTS) * ibverbs->max_datagram_length);
+    size_t offset = 0;
+
+    /* the bindings see iovecs into the term buffers, not their mappings, so they are copied to registered memory */
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        memcpy(slot + offset, message->msg_iov[i].iov_base, message->msg_iov[i].iov_len);
+        offset += message->msg_iov[i].iov_len;
+    }
+
+    struct ibv_send_wr *bad_wr = NULL;
+    struct ibv_sge sge =
+        {
+            .addr = (uint64_t)(uintptr_t)slot,
+            .length = (uint32_t)length,
+            .lkey = ibverbs->send_mr->lkey
+        };
+    struct ibv_send_wr wr;
+
+    memset(&wr, 0, sizeof(wr));
+    wr.wr_id = sequence;
+    wr.sg_list = &sge;
+    wr.num_sge = 1;
+    wr.opcode = IBV_WR_SEND;
+    wr.send_flags = length <= ibverbs->max_inline_length ? IBV_SEND_INLINE : 0;
+    if ((sequence % AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SIGNAL_INTERVAL) ==
+        AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SIGNAL_INTERVAL - 1)
+    {
+        wr.send_flags |= IBV_SEND_SIGNALED;
+    }
+    wr.wr.ud.ah = peer->ah;
+    wr.wr.ud.remote_qpn = peer->qpn;
+    wr.wr.ud.remote_qkey = peer->qkey;
+
+    if (ibv_post_send(ibverbs->qp, &wr, &bad_wr) != 0)
+    {
+        return aeron_udp_channel_transport_sendmsg(&ibverbs->udp, message);
+    }
+
+    ibverbs->send_head++;
+
+    return (int)length;
+}
+
+int aeron_udp_channel_transport_ibverbs_sendmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    aeron_udp_channel_transport_ibverbs_t *ibverbs = aeron_udp_channel_transport_ibverbs_state(transport);
+    int result = 0;
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        const int send_result = aeron_udp_channel_transport_ibverbs_send(ibverbs, &msgvec[i].msg_hdr);
+        if (send_result < 0)
+        {
+            return result > 0 ? result : -1;
+        }
+
+        msgvec[i].msg_len = (unsigned int)send_result;
+
+        if (0 == send_result)
+        {
+            break;
+        }
+
+        result++;
+    }
+
+    return result;
+}
+
+int aeron_udp_channel_transport_ibverbs_sendmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    return aeron_udp_channel_transport_ibverbs_send(aeron_udp_channel_transport_ibverbs_state(transport), message);
+}
+
+int aeron_udp_channel_transport_ibverbs_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf)
+{
+    aeron_udp_channel_transport_ibverbs_t *ibverbs = aeron_udp_channel_transport_ibverbs_state(transport);
+
+    return aeron_udp_channel_transport_get_so_rcvbuf(&ibverbs->udp, so_rcvbuf);
+}
+
+#endif
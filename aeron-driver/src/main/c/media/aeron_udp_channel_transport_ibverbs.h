@@ -0,0 +1,86 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_H
+#define AERON_AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_H
+
+#include "media/aeron_udp_channel_transport_bindings.h"
+#include "protocol/aeron_udp_protocol.h"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IBVERBS "ibverbs"
+
+/**
+ * Name of the RDMA device to use for ibverbs bindings, e.g. mlx5_0. If not set the first device with an active port
+ * holding a RoCE v2 GID for the bind address, or any RoCE v2 GID when bound to the wildcard address, is used.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_DEVICE_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_DEVICE"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_QKEY (0x0AE20000)
+#define AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_RECV_SLOTS (256)
+#define AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SEND_SLOTS (256)
+#define AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_SIGNAL_INTERVAL (64)
+#define AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_GRH_LENGTH (40)
+#define AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_MAX_PEERS (64)
+#define AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_ADVERTISEMENT_MAGIC (0x49425642)
+
+#pragma pack(push)
+#pragma pack(4)
+/*
+ * Sent over UDP to tell a peer the queue pair to reach this transport on. Never handed to the endpoints, so it is
+ * not part of the protocol and peers not using ibverbs bindings ignore it as an unknown extension frame.
+ */
+typedef struct aeron_udp_channel_transport_ibverbs_advertisement_stct
+{
+    aeron_frame_header_t frame_header;
+    int32_t magic;
+    uint32_t qpn;
+    uint32_t qkey;
+    uint8_t gid[16];
+}
+aeron_udp_channel_transport_ibverbs_advertisement_t;
+#pragma pack(pop)
+
+/*
+ * RoCE v2 GID of an address, an IPv4 address as IPv4-mapped IPv6. Returns -1 for other address families.
+ */
+int aeron_udp_channel_transport_ibverbs_gid_from_addr(struct sockaddr_storage *addr, uint8_t gid[16]);
+
+void aeron_udp_channel_transport_ibverbs_advertisement_encode(
+    aeron_udp_channel_transport_ibverbs_advertisement_t *advertisement,
+    uint32_t qpn,
+    uint32_t qkey,
+    const uint8_t gid[16]);
+
+bool aeron_udp_channel_transport_ibverbs_is_advertisement(const uint8_t *buffer, size_t length);
+
+#if defined(HAVE_IBVERBS)
+
+/*
+ * Media bindings over an ibverbs unreliable datagram queue pair for RoCE fabrics, selected with
+ * AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA=ibverbs or media-bindings=ibverbs on a channel at both ends.
+ * <p>
+ * The transport keeps its UDP socket, through which peers exchange queue pair advertisements the first time they
+ * hear from or send to each other. Datagrams to a peer that has advertised are posted to the queue pair from
+ * registered send slots without a system call, everything else, including multicast and datagrams longer than the
+ * path MTU, goes over UDP as before. Datagrams that arrive on the queue pair before the advertisement of their sender
+ * are dropped and recovered by the protocol. The pollable fd is an epoll set of the socket and the completion
+ * channel, so these bindings do not work with the io_uring receive path.
+ */
+extern aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_ibverbs;
+
+#endif
+
+#endif //AERON_AERON_UDP_CHANNEL_TRANSPORT_IBVERBS_H
@@ -0,0 +1,646 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include "util/aeron_error.h"
+#include "media/aeron_udp_channel_transport_shm.h"
+
+int aeron_udp_channel_transport_shm_inbox_path(char *path, size_t path_length, const char *dir, uint64_t inbox_id)
+{
+    const int result = snprintf(path, path_length, "%s/%016" PRIx64 ".inbox", dir, inbox_id);
+
+    return result < 0 || (size_t)result >= path_length ? -1 : result;
+}
+
+void aeron_udp_channel_transport_shm_advertisement_encode(
+    aeron_udp_channel_transport_shm_advertisement_t *advertisement, uint64_t inbox_id)
+{
+    advertisement->frame_header.frame_length = (int32_t)sizeof(aeron_udp_channel_transport_shm_advertisement_t);
+    advertisement->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    advertisement->frame_header.flags = 0;
+    advertisement->frame_header.type = (int16_t)AERON_HDR_TYPE_EXT;
+    advertisement->magic = AERON_UDP_CHANNEL_TRANSPORT_SHM_ADVERTISEMENT_MAGIC;
+    advertisement->inbox_id = inbox_id;
+}
+
+bool aeron_udp_channel_transport_shm_is_advertisement(const uint8_t *buffer, size_t length)
+{
+    const aeron_udp_channel_transport_shm_advertisement_t *advertisement =
+        (const aeron_udp_channel_transport_shm_advertisement_t *)buffer;
+
+    return length == sizeof(aeron_udp_channel_transport_shm_advertisement_t) &&
+        (int16_t)AERON_HDR_TYPE_EXT == advertisement->frame_header.type &&
+        AERON_UDP_CHANNEL_TRANSPORT_SHM_ADVERTISEMENT_MAGIC == advertisement->magic;
+}
+
+#if defined(__linux__)
+
+#include <limits.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+#include "concurrent/aeron_mpsc_rb.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_fileutil.h"
+#include "util/aeron_netutil.h"
+#include "aeron_alloc.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define AERON_UDP_CHANNEL_TRANSPORT_SHM_MAX_DATAGRAM_LENGTH (64 * 1024)
+
+typedef struct aeron_udp_channel_transport_shm_peer_stct
+{
+    struct sockaddr_storage addr;
+    /* the inbox of the peer, unmapped until the peer has advertised one found in the shm directory */
+    aeron_mapped_file_t inbox_file;
+    aeron_mpsc_rb_t inbox;
+    uint64_t inbox_id;
+    bool is_advertised;
+}
+aeron_udp_channel_transport_shm_peer_t;
+
+typedef struct aeron_udp_channel_transport_shm_stct
+{
+    /* the socket the transport would have had under the default bindings */
+    aeron_udp_channel_transport_t udp;
+    struct sockaddr_storage connect_addr;
+
+    char inbox_path[PATH_MAX];
+    aeron_mapped_file_t inbox_file;
+    aeron_mpsc_rb_t inbox;
+    uint64_t inbox_id;
+    const char *dir;
+
+    uint8_t scratch[sizeof(aeron_udp_channel_transport_shm_record_header_t) +
+        AERON_UDP_CHANNEL_TRANSPORT_SHM_MAX_DATAGRAM_LENGTH];
+
+    aeron_udp_channel_transport_shm_peer_t peers[AERON_UDP_CHANNEL_TRANSPORT_SHM_MAX_PEERS];
+    size_t peers_length;
+}
+aeron_udp_channel_transport_shm_t;
+
+typedef struct aeron_udp_channel_transport_shm_recv_stct
+{
+    aeron_udp_channel_transport_t *transport;
+    aeron_udp_channel_transport_shm_t *shm;
+    aeron_udp_transport_recv_func_t recv_func;
+    void *clientd;
+    struct mmsghdr *msgvec;
+    int received;
+}
+aeron_udp_channel_transport_shm_recv_t;
+
+int aeron_udp_channel_transport_shm_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr);
+
+int aeron_udp_channel_transport_shm_close(aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_channel_transport_shm_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
+int aeron_udp_channel_transport_shm_sendmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen);
+
+int aeron_udp_channel_transport_shm_sendmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message);
+
+int aeron_udp_channel_transport_shm_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf);
+
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_shm =
+    {
+        aeron_udp_channel_transport_shm_init,
+        aeron_udp_channel_transport_shm_close,
+        aeron_udp_channel_transport_shm_recvmmsg,
+        aeron_udp_channel_transport_shm_sendmmsg,
+        aeron_udp_channel_transport_shm_sendmsg,
+        aeron_udp_channel_transport_shm_get_so_rcvbuf
+    };
+
+static inline aeron_udp_channel_transport_shm_t *aeron_udp_channel_transport_shm_state(
+    aeron_udp_channel_transport_t *transport)
+{
+    return (aeron_udp_channel_transport_shm_t *)transport->bindings_clientd;
+}
+
+static int aeron_udp_channel_transport_shm_create_inbox(aeron_udp_channel_transport_shm_t *shm)
+{
+    static volatile uint32_t inbox_counter = 0;
+    const char *ring_length_str = getenv(AERON_UDP_CHANNEL_TRANSPORT_SHM_RING_LENGTH_ENV_VAR);
+    const uint64_t ring_length = NULL != ring_length_str ?
+        strtoull(ring_length_str, NULL, 10) : AERON_UDP_CHANNEL_TRANSPORT_SHM_RING_LENGTH_DEFAULT;
+
+    if (!AERON_RB_IS_CAPACITY_VALID(ring_length) || ring_length < 64 * 1024 || ring_length > (1024 * 1024 * 1024))
+    {
+        aeron_set_err(EINVAL, "%s=%s is not a power of two from 64k to 1g",
+            AERON_UDP_CHANNEL_TRANSPORT_SHM_RING_LENGTH_ENV_VAR, ring_length_str);
+        return -1;
+    }
+
+    if (mkdir(shm->dir, S_IRWXU) != 0 && EEXIST != errno)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "mkdir %s: %s", shm->dir, strerror(errcode));
+        return -1;
+    }
+
+    /* unique across the drivers sharing the directory, so a restarted peer is told apart by its new inbox */
+    shm->inbox_id = ((uint64_t)(uint32_t)aeron_randomised_int32() << 32) |
+        (uint32_t)__sync_fetch_and_add(&inbox_counter, 1);
+
+    if (aeron_udp_channel_transport_shm_inbox_path(
+        shm->inbox_path, sizeof(shm->inbox_path), shm->dir, shm->inbox_id) < 0)
+    {
+        aeron_set_err(ENAMETOOLONG, "%s: %s", shm->dir, strerror(ENAMETOOLONG));
+        return -1;
+    }
+
+    shm->inbox_file.length = (size_t)ring_length + AERON_RB_TRAILER_LENGTH;
+    if (aeron_map_new_file(&shm->inbox_file, shm->inbox_path, true, (size_t)getpagesize()) < 0)
+    {
+        shm->inbox_path[0] = '\0';
+        return -1;
+    }
+
+    return aeron_mpsc_rb_init(&shm->inbox, shm->inbox_file.addr, shm->inbox_file.length);
+}
+
+static void aeron_udp_channel_transport_shm_release(aeron_udp_channel_transport_shm_t *shm)
+{
+    for (size_t i = 0; i < shm->peers_length; i++)
+    {
+        if (NULL != shm->peers[i].inbox_file.addr)
+        {
+            aeron_unmap(&shm->peers[i].inbox_file);
+        }
+    }
+
+    if (NULL != shm->inbox_file.addr)
+    {
+        aeron_unmap(&shm->inbox_file);
+    }
+
+    /* peers still holding the mapping write into it until the ring fills, then fall back to UDP */
+    if ('\0' != shm->inbox_path[0])
+    {
+        unlink(shm->inbox_path);
+    }
+
+    aeron_free(shm);
+}
+
+int aeron_udp_channel_transport_shm_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr)
+{
+    aeron_udp_channel_transport_shm_t *shm = NULL;
+    const char *dir = getenv(AERON_UDP_CHANNEL_TRANSPORT_SHM_DIR_ENV_VAR);
+
+    transport->fd = -1;
+    transport->bindings_clientd = NULL;
+
+    if (aeron_alloc((void **)&shm, sizeof(aeron_udp_channel_transport_shm_t)) < 0)
+    {
+        return -1;
+    }
+
+    shm->udp.fd = -1;
+    shm->dir = NULL == dir ? AERON_UDP_CHANNEL_TRANSPORT_SHM_DIR_DEFAULT : dir;
+
+    if (aeron_udp_channel_transport_shm_create_inbox(shm) < 0)
+    {
+        aeron_udp_channel_transport_shm_release(shm);
+        return -1;
+    }
+
+    if (aeron_udp_channel_transport_init(
+        &shm->udp,
+        bind_addr,
+        multicast_if_addr,
+        multicast_if_index,
+        ttl,
+        socket_rcvbuf,
+        socket_sndbuf,
+        use_gro,
+        busy_poll_us,
+        prefer_busy_poll,
+        use_rx_timestamping,
+        connect_addr) < 0)
+    {
+        aeron_udp_channel_transport_shm_release(shm);
+        return -1;
+    }
+
+    if (NULL != connect_addr)
+    {
+        memcpy(&shm->connect_addr, connect_addr, sizeof(struct sockaddr_storage));
+    }
+
+    /* never read, so the pollers always find it readable and call recvmmsg to drain the inbox */
+    if ((transport->fd = eventfd(1, EFD_NONBLOCK | EFD_CLOEXEC)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "eventfd: %s", strerror(errcode));
+        aeron_udp_channel_transport_close(&shm->udp);
+        aeron_udp_channel_transport_shm_release(shm);
+        return -1;
+    }
+
+    transport->is_connected = shm->udp.is_connected;
+    transport->recv_timestamp_ns = 0;
+    transport->bindings_clientd = shm;
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_shm_close(aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_channel_transport_shm_t *shm = aeron_udp_channel_transport_shm_state(transport);
+
+    if (NULL != shm)
+    {
+        aeron_udp_channel_transport_close(&shm->udp);
+        aeron_udp_channel_transport_shm_release(shm);
+        transport->bindings_clientd = NULL;
+    }
+
+    return aeron_udp_channel_transport_close(transport);
+}
+
+static bool aeron_udp_channel_transport_shm_is_same_addr(struct sockaddr_storage *a, struct sockaddr_storage *b)
+{
+    if (a->ss_family != b->ss_family)
+    {
+        return false;
+    }
+
+    if (AF_INET == a->ss_family)
+    {
+        struct sockaddr_in *in_a = (struct sockaddr_in *)a;
+        struct sockaddr_in *in_b = (struct sockaddr_in *)b;
+
+        return in_a->sin_port == in_b->sin_port && in_a->sin_addr.s_addr == in_b->sin_addr.s_addr;
+    }
+
+    struct sockaddr_in6 *in6_a = (struct sockaddr_in6 *)a;
+    struct sockaddr_in6 *in6_b = (struct sockaddr_in6 *)b;
+
+    return in6_a->sin6_port == in6_b->sin6_port &&
+        memcmp(&in6_a->sin6_addr, &in6_b->sin6_addr, sizeof(struct in6_addr)) == 0;
+}
+
+static aeron_udp_channel_transport_shm_peer_t *aeron_udp_channel_transport_shm_peer(
+    aeron_udp_channel_transport_shm_t *shm, struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_transport_shm_peer_t *peer = NULL;
+
+    if (aeron_is_addr_multicast(addr))
+    {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < shm->peers_length; i++)
+    {
+        if (aeron_udp_channel_transport_shm_is_same_addr(&shm->peers[i].addr, addr))
+        {
+            return &shm->peers[i];
+        }
+    }
+
+    /* peers past the limit are reached over UDP */
+    if (shm->peers_length >= AERON_UDP_CHANNEL_TRANSPORT_SHM_MAX_PEERS)
+    {
+        return NULL;
+    }
+
+    peer = &shm->peers[shm->peers_length++];
+    memcpy(&peer->addr, addr, sizeof(struct sockaddr_storage));
+    peer->inbox_file.addr = NULL;
+    peer->inbox_file.length = 0;
+    peer->inbox_id = 0;
+    peer->is_advertised = false;
+
+    return peer;
+}
+
+static void aeron_udp_channel_transport_shm_advertise(
+    aeron_udp_channel_transport_shm_t *shm, aeron_udp_channel_transport_shm_peer_t *peer)
+{
+    aeron_udp_channel_transport_shm_advertisement_t advertisement;
+    struct iovec iov;
+    struct msghdr message;
+
+    aeron_udp_channel_transport_shm_advertisement_encode(&advertisement, shm->inbox_id);
+
+    iov.iov_base = &advertisement;
+    iov.iov_len = sizeof(advertisement);
+    memset(&message, 0, sizeof(message));
+    message.msg_name = shm->udp.is_connected ? NULL : &peer->addr;
+    message.msg_namelen = shm->udp.is_connected ?
+        0 : (AF_INET6 == peer->addr.ss_family ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+
+    /* a lost advertisement is sent again when the peer advertises or the next datagram to it goes over UDP */
+    peer->is_advertised = aeron_udp_channel_transport_sendmsg(&shm->udp, &message) > 0;
+}
+
+static void aeron_udp_channel_transport_shm_on_advertisement(
+    aeron_udp_channel_transport_shm_t *shm,
+    aeron_udp_channel_transport_shm_advertisement_t *advertisement,
+    struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_transport_shm_peer_t *peer = aeron_udp_channel_transport_shm_peer(shm, addr);
+
+    if (NULL == peer)
+    {
+        return;
+    }
+
+    if (NULL == peer->inbox_file.addr || peer->inbox_id != advertisement->inbox_id)
+    {
+        char path[PATH_MAX];
+
+        if (NULL != peer->inbox_file.addr)
+        {
+            aeron_unmap(&peer->inbox_file);
+            peer->inbox_file.addr = NULL;
+        }
+
+        peer->inbox_id = advertisement->inbox_id;
+
+        /* an inbox not in the shm directory belongs to a peer on another host, which stays on UDP */
+        if (aeron_udp_channel_transport_shm_inbox_path(path, sizeof(path), shm->dir, peer->inbox_id) >= 0 &&
+            access(path, R_OK | W_OK) == 0)
+        {
+            if (aeron_map_existing_file(&peer->inbox_file, path) < 0 ||
+                aeron_mpsc_rb_init(&peer->inbox, peer->inbox_file.addr, peer->inbox_file.length) < 0)
+            {
+                if (NULL != peer->inbox_file.addr)
+                {
+                    aeron_unmap(&peer->inbox_file);
+                }
+
+                peer->inbox_file.addr = NULL;
+            }
+        }
+    }
+
+    if (!peer->is_advertised)
+    {
+        aeron_udp_channel_transport_shm_advertise(shm, peer);
+    }
+}
+
+static void aeron_udp_channel_transport_shm_on_udp_message(
+    void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_transport_shm_recv_t *recv = (aeron_udp_channel_transport_shm_recv_t *)clientd;
+    aeron_udp_channel_transport_shm_t *shm = recv->shm;
+
+    if (aeron_udp_channel_transport_shm_is_advertisement(buffer, length))
+    {
+        aeron_udp_channel_transport_shm_on_advertisement(
+            shm, (aeron_udp_channel_transport_shm_advertisement_t *)buffer, addr);
+        return;
+    }
+
+    aeron_udp_channel_transport_shm_peer_t *peer = aeron_udp_channel_transport_shm_peer(shm, addr);
+    if (NULL != peer && !peer->is_advertised)
+    {
+        aeron_udp_channel_transport_shm_advertise(shm, peer);
+    }
+
+    recv->transport->recv_timestamp_ns = shm->udp.recv_timestamp_ns;
+    recv->recv_func(recv->clientd, transport_clientd, buffer, length, addr);
+}
+
+static aeron_udp_channel_transport_shm_peer_t *aeron_udp_channel_transport_shm_peer_by_inbox_id(
+    aeron_udp_channel_transport_shm_t *shm, uint64_t inbox_id)
+{
+    for (size_t i = 0; i < shm->peers_length; i++)
+    {
+        if (NULL != shm->peers[i].inbox_file.addr && inbox_id == shm->peers[i].inbox_id)
+        {
+            return &shm->peers[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void aeron_udp_channel_transport_shm_on_inbox_message(
+    int32_t msg_type_id, const void *buffer, size_t length, void *clientd)
+{
+    aeron_udp_channel_transport_shm_recv_t *recv = (aeron_udp_channel_transport_shm_recv_t *)clientd;
+    const size_t header_length = sizeof(aeron_udp_channel_transport_shm_record_header_t);
+
+    if (AERON_UDP_CHANNEL_TRANSPORT_SHM_MSG_TYPE_ID != msg_type_id || length <= header_length)
+    {
+        return;
+    }
+
+    /* datagrams from an inbox not yet advertised have no address to be attributed to */
+    const aeron_udp_channel_transport_shm_record_header_t *header =
+        (const aeron_udp_channel_transport_shm_record_header_t *)buffer;
+    aeron_udp_channel_transport_shm_peer_t *peer = aeron_udp_channel_transport_shm_peer_by_inbox_id(
+        recv->shm, header->inbox_id);
+
+    if (NULL != peer)
+    {
+        recv->transport->recv_timestamp_ns = 0;
+        recv->recv_func(
+            recv->clientd,
+            recv->transport->dispatch_clientd,
+            (uint8_t *)buffer + header_length,
+            length - header_length,
+            &peer->addr);
+        recv->msgvec[recv->received++].msg_len = (unsigned int)(length - header_length);
+    }
+}
+
+int aeron_udp_channel_transport_shm_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    aeron_udp_channel_transport_shm_t *shm = aeron_udp_channel_transport_shm_state(transport);
+    aeron_udp_channel_transport_shm_recv_t recv =
+        {
+            .transport = transport,
+            .shm = shm,
+            .recv_func = recv_func,
+            .clientd = clientd,
+            .msgvec = msgvec,
+            .received = 0
+        };
+
+    /* the records stay in the ring until the read returns, so they are dispatched in place */
+    aeron_mpsc_rb_read(&shm->inbox, aeron_udp_channel_transport_shm_on_inbox_message, &recv, vlen);
+    if ((size_t)recv.received >= vlen)
+    {
+        return recv.received;
+    }
+
+    shm->udp.dispatch_clientd = transport->dispatch_clientd;
+
+    const int udp_received = aeron_udp_channel_transport_recvmmsg(
+        &shm->udp,
+        msgvec + recv.received,
+        vlen - (size_t)recv.received,
+        aeron_udp_channel_transport_shm_on_udp_message,
+        &recv);
+
+    return udp_received < 0 ? udp_received : recv.received + udp_received;
+}
+
+static int aeron_udp_channel_transport_shm_send(aeron_udp_channel_transport_shm_t *shm, struct msghdr *message)
+{
+    struct sockaddr_storage *dest = NULL != message->msg_name ?
+        (struct sockaddr_storage *)message->msg_name : (shm->udp.is_connected ? &shm->connect_addr : NULL);
+    aeron_udp_channel_transport_shm_peer_t *peer = NULL;
+    aeron_udp_channel_transport_shm_record_header_t *header =
+        (aeron_udp_channel_transport_shm_record_header_t *)shm->scratch;
+    size_t length = 0;
+
+    if (NULL != dest && NULL != (peer = aeron_udp_channel_transport_shm_peer(shm, dest)) && !peer->is_advertised)
+    {
+        aeron_udp_channel_transport_shm_advertise(shm, peer);
+    }
+
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        length += message->msg_iov[i].iov_len;
+    }
+
+    const size_t record_length = sizeof(aeron_udp_channel_transport_shm_record_header_t) + length;
+
+    if (NULL == peer || NULL == peer->inbox_file.addr || record_length > sizeof(shm->scratch) ||
+        record_length > peer->inbox.max_message_length)
+    {
+        return aeron_udp_channel_transport_sendmsg(&shm->udp, message);
+    }
+
+    size_t offset = sizeof(aeron_udp_channel_transport_shm_record_header_t);
+
+    /* the iovecs point into the term buffers, so they are gathered before the one copy into the ring */
+    header->inbox_id = shm->inbox_id;
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        memcpy(shm->scratch + offset, message->msg_iov[i].iov_base, message->msg_iov[i].iov_len);
+        offset += message->msg_iov[i].iov_len;
+    }
+
+    if (AERON_RB_SUCCESS != aeron_mpsc_rb_write(
+        &peer->inbox, AERON_UDP_CHANNEL_TRANSPORT_SHM_MSG_TYPE_ID, shm->scratch, record_length))
+    {
+        return aeron_udp_channel_transport_sendmsg(&shm->udp, message);
+    }
+
+    return (int)length;
+}
+
+int aeron_udp_channel_transport_shm_sendmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    aeron_udp_channel_transport_shm_t *shm = aeron_udp_channel_transport_shm_state(transport);
+    int result = 0;
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        const int send_result = aeron_udp_channel_transport_shm_send(shm, &msgvec[i].msg_hdr);
+        if (send_result < 0)
+        {
+            return result > 0 ? result : -1;
+        }
+
+        msgvec[i].msg_len = (unsigned int)send_result;
+
+        if (0 == send_result)
+        {
+            break;
+        }
+
+        result++;
+    }
+
+    return result;
+}
+
+int aeron_udp_channel_transport_shm_sendmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    return aeron_udp_channel_transport_shm_send(aeron_udp_channel_transport_shm_state(transport), message);
+}
+
+int aeron_udp_channel_transport_shm_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf)
+{
+    aeron_udp_channel_transport_shm_t *shm = aeron_udp_channel_transport_shm_state(transport);
+
+    return aeron_udp_channel_transport_get_so_rcvbuf(&shm->udp, so_rcvbuf);
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_UDP_CHANNEL_TRANSPORT_SHM_H
+#define AERON_AERON_UDP_CHANNEL_TRANSPORT_SHM_H
+
+#include "media/aeron_udp_channel_transport_bindings.h"
+#include "protocol/aeron_udp_protocol.h"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_SHM "shm"
+
+/**
+ * Directory the inboxes of shm bindings are created in. Drivers in different containers on the same host exchange
+ * datagrams through shared memory when they mount the same host directory here, e.g. a hostPath volume.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_SHM_DIR_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_SHM_DIR"
+
+/**
+ * Length of the ring buffer of each inbox, a power of two. Datagrams longer than an eighth of it go over UDP.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_SHM_RING_LENGTH_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_SHM_RING_LENGTH"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_SHM_DIR_DEFAULT "/dev/shm/aeron-udp"
+#define AERON_UDP_CHANNEL_TRANSPORT_SHM_RING_LENGTH_DEFAULT (4 * 1024 * 1024)
+#define AERON_UDP_CHANNEL_TRANSPORT_SHM_MAX_PEERS (64)
+#define AERON_UDP_CHANNEL_TRANSPORT_SHM_MSG_TYPE_ID (1)
+#define AERON_UDP_CHANNEL_TRANSPORT_SHM_ADVERTISEMENT_MAGIC (0x53484D49)
+
+#pragma pack(push)
+#pragma pack(4)
+/*
+ * Sent over UDP to tell a peer the inbox to reach this transport through. Never handed to the endpoints, so it is
+ * not part of the protocol and peers not using shm bindings ignore it as an unknown extension frame.
+ */
+typedef struct aeron_udp_channel_transport_shm_advertisement_stct
+{
+    aeron_frame_header_t frame_header;
+    int32_t magic;
+    uint64_t inbox_id;
+}
+aeron_udp_channel_transport_shm_advertisement_t;
+
+/*
+ * Precedes each datagram in an inbox so the receiver can attribute it to the UDP address of its sender.
+ */
+typedef struct aeron_udp_channel_transport_shm_record_header_stct
+{
+    uint64_t inbox_id;
+}
+aeron_udp_channel_transport_shm_record_header_t;
+#pragma pack(pop)
+
+/*
+ * Path of the inbox file for an inbox id within dir. Returns the length of the path or -1 if it does not fit.
+ */
+int aeron_udp_channel_transport_shm_inbox_path(char *path, size_t path_length, const char *dir, uint64_t inbox_id);
+
+void aeron_udp_channel_transport_shm_advertisement_encode(
+    aeron_udp_channel_transport_shm_advertisement_t *advertisement, uint64_t inbox_id);
+
+bool aeron_udp_channel_transport_shm_is_advertisement(const uint8_t *buffer, size_t length);
+
+#if defined(__linux__)
+
+/*
+ * Media bindings that deliver datagrams between drivers on the same host through shared memory, for drivers in
+ * separate containers or network namespaces where the IPC channel cannot be used, selected with
+ * AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA=shm or media-bindings=shm on a channel at both ends.
+ * <p>
+ * Each transport keeps its UDP socket and creates an inbox, a memory mapped ring buffer in the shm directory. Peers
+ * exchange inbox advertisements over UDP the first time they hear from or send to each other, and a peer whose
+ * advertised inbox exists in the local shm directory is on the same host, so datagrams to it are written to its inbox
+ * instead of the socket. Everything else, including multicast, datagrams too long for the ring and datagrams to an
+ * inbox that is full because its owner has gone, goes over UDP as before. The fd of each transport is always readable
+ * so the pollers call into the bindings every cycle, which rules out the io_uring receive path.
+ */
+extern aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_shm;
+
+#endif
+
+#endif //AERON_AERON_UDP_CHANNEL_TRANSPORT_SHM_H
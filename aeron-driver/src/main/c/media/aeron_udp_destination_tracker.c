@@ -23,6 +23,7 @@
 #include "util/aeron_netutil.h"
 #include "util/aeron_arrayutil.h"
 #include "media/aeron_udp_destination_tracker.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
@@ -32,14 +33,23 @@ struct mmsghdr
 };
 #endif
 
+inline static int64_t aeron_udp_destination_tracker_now_ns(aeron_udp_destination_tracker_t *tracker)
+{
+    return NULL != tracker->cached_clock ?
+        aeron_clock_cached_nano_time(tracker->cached_clock) : tracker->nano_clock();
+}
+
 int aeron_udp_destination_tracker_init(
     aeron_udp_destination_tracker_t *tracker, aeron_clock_func_t clock, int64_t timeout)
 {
     tracker->nano_clock = clock;
+    tracker->cached_clock = NULL;
     tracker->destination_timeout_ns = timeout;
     tracker->destinations.array = NULL;
     tracker->destinations.length = 0;
     tracker->destinations.capacity = 0;
+    tracker->messages.array = NULL;
+    tracker->messages.capacity = 0;
     tracker->is_manual_control_mode =
         timeout == AERON_UDP_DESTINATION_TRACKER_MANUAL_DESTINATION_TIMEOUT_NS ? true : false;
 
@@ -51,6 +61,7 @@ int aeron_udp_destination_tracker_close(aeron_udp_destination_tracker_t *tracker
     if (NULL != tracker)
     {
         aeron_free(tracker->destinations.array);
+        aeron_free(tracker->messages.array);
     }
 
     return 0;
@@ -59,14 +70,15 @@ int aeron_udp_destination_tracker_close(aeron_udp_destination_tracker_t *tracker
 int aeron_udp_destination_tracker_sendmmsg(
     aeron_udp_destination_tracker_t *tracker, aeron_udp_channel_transport_t *transport, struct mmsghdr *mmsghdr, size_t vlen)
 {
-    int64_t now_ns = tracker->nano_clock();
+    int64_t now_ns = aeron_udp_destination_tracker_now_ns(tracker);
     int min_msgs_sent = (int)vlen;
 
     for (int last_index = (int)tracker->destinations.length - 1, i = last_index; i >= 0; i--)
     {
         aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
 
-        if (now_ns > (entry->time_of_last_activity_ns + tracker->destination_timeout_ns))
+        if (!tracker->is_manual_control_mode &&
+            now_ns > (entry->time_of_last_activity_ns + tracker->destination_timeout_ns))
         {
             aeron_array_fast_unordered_remove(
                 (uint8_t *)tracker->destinations.array,
@@ -76,19 +88,67 @@ int aeron_udp_destination_tracker_sendmmsg(
             last_index--;
             tracker->destinations.length--;
         }
-        else
+    }
+
+    const size_t num_destinations = tracker->destinations.length;
+    const size_t total_msgs = num_destinations * vlen;
+
+    if (0 == total_msgs)
+    {
+        return min_msgs_sent;
+    }
+
+    if (total_msgs > tracker->messages.capacity)
+    {
+        if (aeron_array_ensure_capacity(
+            (uint8_t **)&tracker->messages.array, sizeof(struct mmsghdr), tracker->messages.capacity, total_msgs) < 0)
         {
-            for (size_t j = 0; j < vlen; j++)
-            {
-                mmsghdr[j].msg_hdr.msg_name = &entry->addr;
-                mmsghdr[j].msg_hdr.msg_namelen = AERON_ADDR_LEN(&entry->addr);
-                mmsghdr[j].msg_len = 0;
-            }
+            return -1;
+        }
 
-            const int sendmmsg_result = aeron_udp_channel_transport_sendmmsg(transport, mmsghdr, vlen);
+        tracker->messages.capacity = total_msgs;
+    }
 
-            min_msgs_sent = sendmmsg_result < min_msgs_sent ? sendmmsg_result : min_msgs_sent;
+    struct mmsghdr *messages = tracker->messages.array;
+
+    for (size_t d = 0; d < num_destinations; d++)
+    {
+        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[d];
+
+        for (size_t j = 0; j < vlen; j++)
+        {
+            struct mmsghdr *message = &messages[(d * vlen) + j];
+
+            message->msg_hdr = mmsghdr[j].msg_hdr;
+            message->msg_hdr.msg_name = &entry->addr;
+            message->msg_hdr.msg_namelen = AERON_ADDR_LEN(&entry->addr);
+            message->msg_len = 0;
+        }
+    }
+
+    size_t offset = 0;
+    while (offset < total_msgs)
+    {
+        size_t remaining = total_msgs - offset;
+        size_t batch_vlen = remaining < AERON_UDP_DESTINATION_TRACKER_MAX_SENDMMSG_VLEN ?
+            remaining : AERON_UDP_DESTINATION_TRACKER_MAX_SENDMMSG_VLEN;
+
+        const int sendmmsg_result = transport->bindings->sendmmsg_func(transport, &messages[offset], batch_vlen);
+
+        if (sendmmsg_result == (int)batch_vlen)
+        {
+            offset += batch_vlen;
+            continue;
         }
+
+        /* short or failed send: account it against the destination it stopped on and carry on with the next one */
+        size_t stalled_offset = offset + (sendmmsg_result > 0 ? (size_t)sendmmsg_result : 0);
+        size_t d = stalled_offset / vlen;
+        int msgs_sent = sendmmsg_result < 0 ? sendmmsg_result : (int)(stalled_offset - (d * vlen));
+
+        tracker->destinations.array[d].short_sends++;
+        min_msgs_sent = msgs_sent < min_msgs_sent ? msgs_sent : min_msgs_sent;
+        offset = (d + 1) * vlen;
     }
 
     return min_msgs_sent;
@@ -97,14 +157,15 @@ int aeron_udp_destination_tracker_sendmmsg(
 int aeron_udp_destination_tracker_sendmsg(
     aeron_udp_destination_tracker_t *tracker, aeron_udp_channel_transport_t *transport, struct msghdr *msghdr)
 {
-    int64_t now_ns = tracker->nano_clock();
+    int64_t now_ns = aeron_udp_destination_tracker_now_ns(tracker);
     int min_bytes_sent = (int)msghdr->msg_iov->iov_len;
 
     for (int last_index = (int)tracker->destinations.length - 1, i = last_index; i >= 0; i--)
     {
         aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
 
-        if (now_ns > (entry->time_of_last_activity_ns + tracker->destination_timeout_ns))
+        if (!tracker->is_manual_control_mode &&
+            now_ns > (entry->time_of_last_activity_ns + tracker->destination_timeout_ns))
         {
             aeron_array_fast_unordered_remove(
                 (uint8_t *)tracker->destinations.array,
@@ -119,7 +180,7 @@ int aeron_udp_destination_tracker_sendmsg(
             msghdr->msg_name = &entry->addr;
             msghdr->msg_namelen = AERON_ADDR_LEN(&entry->addr);
 
-            const int sendmsg_result = aeron_udp_channel_transport_sendmsg(transport, msghdr);
+            const int sendmsg_result = transport->bindings->sendmsg_func(transport, msghdr);
 
             min_bytes_sent = sendmsg_result < min_bytes_sent ? sendmsg_result : min_bytes_sent;
         }
@@ -158,7 +219,7 @@ int aeron_udp_destination_tracker_on_status_message(
     if (tracker->destination_timeout_ns > 0)
     {
         aeron_status_message_header_t *status_message_header = (aeron_status_message_header_t *)buffer;
-        const int64_t now_ns = tracker->nano_clock();
+        const int64_t now_ns = aeron_udp_destination_tracker_now_ns(tracker);
         const int64_t receiver_id = status_message_header->receiver_id;
         bool is_existing = false;
 
@@ -194,6 +255,7 @@ int aeron_udp_destination_tracker_add_destination(
         aeron_udp_destination_entry_t *entry = &tracker->destinations.array[tracker->destinations.length++];
 
         entry->receiver_id = receiver_id;
+        entry->short_sends = 0;
         entry->time_of_last_activity_ns = now_ns;
         memcpy(&entry->addr, addr, sizeof(struct sockaddr_storage));
     }
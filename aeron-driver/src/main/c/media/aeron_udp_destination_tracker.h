@@ -20,15 +20,18 @@
 #include <netinet/in.h>
 #include "aeronmd.h"
 #include "aeron_udp_channel_transport.h"
+#include "util/aeron_clock.h"
 
 #define AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS (5 * 1000 * 1000 * 1000L)
 #define AERON_UDP_DESTINATION_TRACKER_MANUAL_DESTINATION_TIMEOUT_NS (0L)
+#define AERON_UDP_DESTINATION_TRACKER_MAX_SENDMMSG_VLEN (1024)
 
 typedef struct aeron_udp_destination_entry_stct
 {
     struct sockaddr_storage addr;
     int64_t time_of_last_activity_ns;
     int64_t receiver_id;
+    int64_t short_sends;
 }
 aeron_udp_destination_entry_t;
 
@@ -42,7 +45,17 @@ typedef struct aeron_udp_destination_tracker_stct
     }
     destinations;
 
+    /* combined destinations x messages vector so a fan-out is sent in as few sendmmsg calls as possible */
+    struct aeron_udp_destination_tracker_messages_stct
+    {
+        struct mmsghdr *array;
+        size_t capacity;
+    }
+    messages;
+
     aeron_clock_func_t nano_clock;
+    /* time of the duty cycle of the sender driving the tracker, NULL until added to a sender */
+    aeron_clock_cache_t *cached_clock;
     int64_t destination_timeout_ns;
     bool is_manual_control_mode;
 }
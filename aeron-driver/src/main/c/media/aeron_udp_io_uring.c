@@ -0,0 +1,262 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+#include <errno.h>
+#include "util/aeron_error.h"
+#include "concurrent/aeron_atomic.h"
+#include "media/aeron_udp_io_uring.h"
+
+#if defined(HAVE_IO_URING)
+
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+static int aeron_udp_io_uring_setup(unsigned int entries, struct io_uring_params *params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int aeron_udp_io_uring_enter(int fd, unsigned int to_submit, unsigned int min_complete, unsigned int flags)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+int aeron_udp_io_uring_init(aeron_udp_io_uring_t *ring, unsigned int entries)
+{
+    struct io_uring_params params;
+
+    memset(ring, 0, sizeof(aeron_udp_io_uring_t));
+    memset(&params, 0, sizeof(params));
+    ring->ring_fd = -1;
+
+    if ((ring->ring_fd = aeron_udp_io_uring_setup(entries, &params)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "io_uring_setup: %s", strerror(errcode));
+        return -1;
+    }
+
+    ring->entries = params.sq_entries;
+    ring->sq.ring_length = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    ring->cq.ring_length = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (ring->cq.ring_length > ring->sq.ring_length)
+        {
+            ring->sq.ring_length = ring->cq.ring_length;
+        }
+        ring->cq.ring_length = ring->sq.ring_length;
+    }
+
+    ring->sq.ring_ptr = mmap(
+        NULL, ring->sq.ring_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQ_RING);
+    if (MAP_FAILED == ring->sq.ring_ptr)
+    {
+        int errcode = errno;
+
+        ring->sq.ring_ptr = NULL;
+        aeron_set_err(errcode, "io_uring mmap(IORING_OFF_SQ_RING): %s", strerror(errcode));
+        goto error;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring->cq.ring_ptr = ring->sq.ring_ptr;
+    }
+    else
+    {
+        ring->cq.ring_ptr = mmap(
+            NULL,
+            ring->cq.ring_length,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            ring->ring_fd,
+            IORING_OFF_CQ_RING);
+        if (MAP_FAILED == ring->cq.ring_ptr)
+        {
+            int errcode = errno;
+
+            ring->cq.ring_ptr = NULL;
+            aeron_set_err(errcode, "io_uring mmap(IORING_OFF_CQ_RING): %s", strerror(errcode));
+            goto error;
+        }
+    }
+
+    ring->sq.sqes_length = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sq.sqes = mmap(
+        NULL, ring->sq.sqes_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQES);
+    if (MAP_FAILED == ring->sq.sqes)
+    {
+        int errcode = errno;
+
+        ring->sq.sqes = NULL;
+        aeron_set_err(errcode, "io_uring mmap(IORING_OFF_SQES): %s", strerror(errcode));
+        goto error;
+    }
+
+    uint8_t *sq_ptr = (uint8_t *)ring->sq.ring_ptr;
+    uint8_t *cq_ptr = (uint8_t *)ring->cq.ring_ptr;
+
+    ring->sq.head = (unsigned int *)(sq_ptr + params.sq_off.head);
+    ring->sq.tail = (unsigned int *)(sq_ptr + params.sq_off.tail);
+    ring->sq.ring_mask = (unsigned int *)(sq_ptr + params.sq_off.ring_mask);
+    ring->sq.array = (unsigned int *)(sq_ptr + params.sq_off.array);
+    ring->sq.sqe_tail = *ring->sq.tail;
+
+    ring->cq.head = (unsigned int *)(cq_ptr + params.cq_off.head);
+    ring->cq.tail = (unsigned int *)(cq_ptr + params.cq_off.tail);
+    ring->cq.ring_mask = (unsigned int *)(cq_ptr + params.cq_off.ring_mask);
+    ring->cq.cqes = (struct io_uring_cqe *)(cq_ptr + params.cq_off.cqes);
+
+    return 0;
+
+    error:
+        aeron_udp_io_uring_close(ring);
+        return -1;
+}
+
+int aeron_udp_io_uring_close(aeron_udp_io_uring_t *ring)
+{
+    if (NULL != ring->sq.sqes)
+    {
+        munmap(ring->sq.sqes, ring->sq.sqes_length);
+        ring->sq.sqes = NULL;
+    }
+
+    if (NULL != ring->cq.ring_ptr && ring->cq.ring_ptr != ring->sq.ring_ptr)
+    {
+        munmap(ring->cq.ring_ptr, ring->cq.ring_length);
+    }
+    ring->cq.ring_ptr = NULL;
+
+    if (NULL != ring->sq.ring_ptr)
+    {
+        munmap(ring->sq.ring_ptr, ring->sq.ring_length);
+        ring->sq.ring_ptr = NULL;
+    }
+
+    if (ring->ring_fd != -1)
+    {
+        close(ring->ring_fd);
+        ring->ring_fd = -1;
+    }
+
+    return 0;
+}
+
+struct io_uring_sqe *aeron_udp_io_uring_get_sqe(aeron_udp_io_uring_t *ring)
+{
+    unsigned int head;
+    AERON_GET_VOLATILE(head, *ring->sq.head);
+
+    if (ring->sq.sqe_tail - head >= ring->entries)
+    {
+        return NULL;
+    }
+
+    unsigned int index = ring->sq.sqe_tail & *ring->sq.ring_mask;
+    struct io_uring_sqe *sqe = &ring->sq.sqes[index];
+
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    ring->sq.array[index] = index;
+    ring->sq.sqe_tail++;
+    ring->to_submit++;
+
+    return sqe;
+}
+
+int aeron_udp_io_uring_submit(aeron_udp_io_uring_t *ring, unsigned int min_complete)
+{
+    unsigned int to_submit = ring->to_submit;
+
+    if (0 == to_submit && 0 == min_complete)
+    {
+        return 0;
+    }
+
+    AERON_PUT_ORDERED(*ring->sq.tail, ring->sq.sqe_tail);
+
+    int result = aeron_udp_io_uring_enter(
+        ring->ring_fd, to_submit, min_complete, min_complete > 0 ? IORING_ENTER_GETEVENTS : 0);
+    if (result < 0)
+    {
+        int errcode = errno;
+
+        if (EINTR == errcode || EAGAIN == errcode || EBUSY == errcode)
+        {
+            return 0;
+        }
+
+        aeron_set_err(errcode, "io_uring_enter: %s", strerror(errcode));
+        return -1;
+    }
+
+    ring->to_submit -= (unsigned int)result;
+
+    return result;
+}
+
+int aeron_udp_io_uring_for_each_cqe(aeron_udp_io_uring_t *ring, aeron_udp_io_uring_cqe_func_t handler, void *clientd)
+{
+    unsigned int head = *ring->cq.head;
+    unsigned int tail;
+    int count = 0;
+
+    AERON_GET_VOLATILE(tail, *ring->cq.tail);
+
+    while (head != tail)
+    {
+        handler(clientd, &ring->cq.cqes[head & *ring->cq.ring_mask]);
+        head++;
+        count++;
+    }
+
+    AERON_PUT_ORDERED(*ring->cq.head, head);
+
+    return count;
+}
+
+bool aeron_udp_io_uring_is_supported()
+{
+    aeron_udp_io_uring_t ring;
+
+    if (aeron_udp_io_uring_init(&ring, 2) < 0)
+    {
+        aeron_set_err(0, "%s", "no error");
+        return false;
+    }
+
+    aeron_udp_io_uring_close(&ring);
+    return true;
+}
+
+#else
+
+bool aeron_udp_io_uring_is_supported()
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_UDP_IO_URING_H
+#define AERON_AERON_UDP_IO_URING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(HAVE_IO_URING)
+#include <linux/io_uring.h>
+
+/*
+ * Minimal io_uring ring built directly on the io_uring_setup/io_uring_enter system calls so the driver does not
+ * take a dependency on liburing. Only what the transport poller needs is provided.
+ */
+typedef struct aeron_udp_io_uring_stct
+{
+    int ring_fd;
+    unsigned int entries;
+
+    struct aeron_udp_io_uring_sq_stct
+    {
+        unsigned int *head;
+        unsigned int *tail;
+        unsigned int *ring_mask;
+        unsigned int *array;
+        struct io_uring_sqe *sqes;
+        unsigned int sqe_tail;
+        void *ring_ptr;
+        size_t ring_length;
+        size_t sqes_length;
+    }
+    sq;
+
+    struct aeron_udp_io_uring_cq_stct
+    {
+        unsigned int *head;
+        unsigned int *tail;
+        unsigned int *ring_mask;
+        struct io_uring_cqe *cqes;
+        void *ring_ptr;
+        size_t ring_length;
+    }
+    cq;
+
+    unsigned int to_submit;
+}
+aeron_udp_io_uring_t;
+
+int aeron_udp_io_uring_init(aeron_udp_io_uring_t *ring, unsigned int entries);
+int aeron_udp_io_uring_close(aeron_udp_io_uring_t *ring);
+
+/*
+ * Returns NULL when the submission queue is full.
+ */
+struct io_uring_sqe *aeron_udp_io_uring_get_sqe(aeron_udp_io_uring_t *ring);
+
+/*
+ * Submit all prepared entries and optionally wait for min_complete completions. Returns number submitted or -1.
+ */
+int aeron_udp_io_uring_submit(aeron_udp_io_uring_t *ring, unsigned int min_complete);
+
+typedef void (*aeron_udp_io_uring_cqe_func_t)(void *clientd, struct io_uring_cqe *cqe);
+
+/*
+ * Dispatch all available completions to the handler and return the number consumed.
+ */
+int aeron_udp_io_uring_for_each_cqe(aeron_udp_io_uring_t *ring, aeron_udp_io_uring_cqe_func_t handler, void *clientd);
+
+#endif
+
+bool aeron_udp_io_uring_is_supported();
+
+#endif //AERON_AERON_UDP_IO_URING_H
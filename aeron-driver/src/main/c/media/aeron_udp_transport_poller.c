@@ -14,16 +14,372 @@
  * limitations under the License.
  */
 
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/socket.h>
 #include "util/aeron_arrayutil.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_error.h"
 #include "aeron_alloc.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
 #include "media/aeron_udp_transport_poller.h"
 
-int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller)
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#if defined(HAVE_IO_URING)
+
+typedef struct aeron_udp_transport_poller_io_uring_poll_state_stct
+{
+    aeron_udp_transport_poller_t *poller;
+    aeron_udp_transport_recv_func_t recv_func;
+    void *clientd;
+    int64_t bytes_received;
+    int work_count;
+    int errcode;
+}
+aeron_udp_transport_poller_io_uring_poll_state_t;
+
+static void aeron_udp_transport_poller_io_uring_arm(
+    aeron_udp_transport_poller_t *poller, aeron_udp_transport_poller_io_uring_recv_t *recv)
+{
+    struct io_uring_sqe *sqe = aeron_udp_io_uring_get_sqe(&poller->ring);
+
+    if (NULL == sqe)
+    {
+        poller->io_uring_unarmed_count++;
+        return;
+    }
+
+    recv->msghdr.msg_name = &recv->addr;
+    recv->msghdr.msg_namelen = sizeof(recv->addr);
+    recv->msghdr.msg_iov = &recv->iov;
+    recv->msghdr.msg_iovlen = 1;
+    recv->msghdr.msg_control = recv->control.buffer;
+    recv->msghdr.msg_controllen = sizeof(recv->control.buffer);
+    recv->msghdr.msg_flags = 0;
+
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = recv->transport->fd;
+    sqe->addr = (uint64_t)(uintptr_t)&recv->msghdr;
+    sqe->len = 1;
+    sqe->user_data = (uint64_t)(uintptr_t)recv;
+    recv->in_flight = true;
+}
+
+static void aeron_udp_transport_poller_io_uring_cancel(
+    aeron_udp_transport_poller_t *poller, aeron_udp_transport_poller_io_uring_recv_t *recv)
+{
+    struct io_uring_sqe *sqe;
+
+    while (NULL == (sqe = aeron_udp_io_uring_get_sqe(&poller->ring)))
+    {
+        if (aeron_udp_io_uring_submit(&poller->ring, 0) < 0)
+        {
+            return;
+        }
+    }
+
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)(uintptr_t)recv;
+    sqe->user_data = 0;
+}
+
+static void aeron_udp_transport_poller_io_uring_delete(
+    aeron_udp_transport_poller_t *poller, aeron_udp_transport_poller_io_uring_recv_t *recv)
+{
+    int last_index = (int)poller->io_uring_recvs.length - 1;
+
+    for (int i = last_index; i >= 0; i--)
+    {
+        if (poller->io_uring_recvs.array[i] == recv)
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)poller->io_uring_recvs.array,
+                sizeof(aeron_udp_transport_poller_io_uring_recv_t *),
+                (size_t)i,
+                (size_t)last_index);
+            poller->io_uring_recvs.length--;
+            break;
+        }
+    }
+
+    aeron_free(recv->buffer);
+    aeron_free(recv);
+}
+
+static void aeron_udp_transport_poller_io_uring_on_cqe(void *clientd, struct io_uring_cqe *cqe)
+{
+    aeron_udp_transport_poller_io_uring_poll_state_t *state =
+        (aeron_udp_transport_poller_io_uring_poll_state_t *)clientd;
+    aeron_udp_transport_poller_io_uring_recv_t *recv =
+        (aeron_udp_transport_poller_io_uring_recv_t *)(uintptr_t)cqe->user_data;
+
+    if (NULL == recv)
+    {
+        return;
+    }
+
+    recv->in_flight = false;
+
+    if (NULL == recv->transport)
+    {
+        aeron_udp_transport_poller_io_uring_delete(state->poller, recv);
+        return;
+    }
+
+    if (cqe->res > 0 && NULL != state->recv_func)
+    {
+        aeron_udp_channel_transport_dispatch(
+            recv->transport, &recv->msghdr, (size_t)cqe->res, state->recv_func, state->clientd);
+        state->bytes_received += cqe->res;
+        state->work_count++;
+    }
+    else if (cqe->res < 0 && -EAGAIN != cqe->res && -EINTR != cqe->res && -ECANCELED != cqe->res &&
+        -ECONNREFUSED != cqe->res)
+    {
+        state->errcode = -cqe->res;
+    }
+
+    if (NULL != state->recv_func)
+    {
+        aeron_udp_transport_poller_io_uring_arm(state->poller, recv);
+    }
+}
+
+static int aeron_udp_transport_poller_io_uring_add(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport)
+{
+    if (transport->bindings != &aeron_udp_channel_transport_bindings_default)
+    {
+        aeron_set_err(EINVAL, "io_uring poller requires default transport bindings: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (poller->io_uring_recvs.length + AERON_UDP_TRANSPORT_POLLER_IO_URING_RECVS_PER_TRANSPORT >
+        poller->ring.entries)
+    {
+        aeron_set_err(ENOSPC, "io_uring poller full: %s", strerror(ENOSPC));
+        return -1;
+    }
+
+    for (size_t i = 0; i < AERON_UDP_TRANSPORT_POLLER_IO_URING_RECVS_PER_TRANSPORT; i++)
+    {
+        int ensure_capacity_result = 0;
+        aeron_udp_transport_poller_io_uring_recv_t *recv = NULL;
+        size_t offset = 0;
+
+        AERON_ARRAY_ENSURE_CAPACITY(
+            ensure_capacity_result, poller->io_uring_recvs, aeron_udp_transport_poller_io_uring_recv_t *);
+        if (ensure_capacity_result < 0)
+        {
+            return -1;
+        }
+
+        if (aeron_alloc((void **)&recv, sizeof(aeron_udp_transport_poller_io_uring_recv_t)) < 0)
+        {
+            return -1;
+        }
+
+        if (aeron_alloc_aligned(
+            (void **)&recv->buffer, &offset, poller->io_uring_buffer_length, AERON_CACHE_LINE_LENGTH * 2) < 0)
+        {
+            aeron_free(recv);
+            return -1;
+        }
+
+        recv->transport = transport;
+        recv->iov.iov_base = recv->buffer + offset;
+        recv->iov.iov_len = poller->io_uring_buffer_length;
+        recv->in_flight = false;
+
+        poller->io_uring_recvs.array[poller->io_uring_recvs.length++] = recv;
+        aeron_udp_transport_poller_io_uring_arm(poller, recv);
+    }
+
+    return aeron_udp_io_uring_submit(&poller->ring, 0) < 0 ? -1 : 0;
+}
+
+static int aeron_udp_transport_poller_io_uring_remove(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport)
+{
+    for (int i = (int)poller->io_uring_recvs.length - 1; i >= 0; i--)
+    {
+        aeron_udp_transport_poller_io_uring_recv_t *recv = poller->io_uring_recvs.array[i];
+
+        if (recv->transport == transport)
+        {
+            recv->transport = NULL;
+
+            if (recv->in_flight)
+            {
+                aeron_udp_transport_poller_io_uring_cancel(poller, recv);
+            }
+            else
+            {
+                if (poller->io_uring_unarmed_count > 0)
+                {
+                    poller->io_uring_unarmed_count--;
+                }
+                aeron_udp_transport_poller_io_uring_delete(poller, recv);
+            }
+        }
+    }
+
+    return aeron_udp_io_uring_submit(&poller->ring, 0) < 0 ? -1 : 0;
+}
+
+static int aeron_udp_transport_poller_io_uring_poll(
+    aeron_udp_transport_poller_t *poller,
+    int64_t *bytes_received,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    aeron_udp_transport_poller_io_uring_poll_state_t state =
+        {
+            .poller = poller,
+            .recv_func = recv_func,
+            .clientd = clientd,
+            .bytes_received = 0,
+            .work_count = 0,
+            .errcode = 0
+        };
+
+    aeron_udp_io_uring_for_each_cqe(&poller->ring, aeron_udp_transport_poller_io_uring_on_cqe, &state);
+
+    if (poller->io_uring_unarmed_count > 0)
+    {
+        poller->io_uring_unarmed_count = 0;
+
+        for (size_t i = 0, length = poller->io_uring_recvs.length; i < length; i++)
+        {
+            aeron_udp_transport_poller_io_uring_recv_t *recv = poller->io_uring_recvs.array[i];
+
+            if (!recv->in_flight && NULL != recv->transport)
+            {
+                aeron_udp_transport_poller_io_uring_arm(poller, recv);
+            }
+        }
+    }
+
+    *bytes_received = state.bytes_received;
+
+    if (aeron_udp_io_uring_submit(&poller->ring, 0) < 0)
+    {
+        return -1;
+    }
+
+    if (0 != state.errcode)
+    {
+        aeron_set_err(state.errcode, "io_uring recvmsg: %s", strerror(state.errcode));
+        return -1;
+    }
+
+    return state.work_count;
+}
+
+static void aeron_udp_transport_poller_io_uring_close(aeron_udp_transport_poller_t *poller)
+{
+    aeron_udp_transport_poller_io_uring_poll_state_t state =
+        {
+            .poller = poller,
+            .recv_func = NULL,
+            .clientd = NULL,
+            .bytes_received = 0,
+            .work_count = 0,
+            .errcode = 0
+        };
+    size_t in_flight = 0;
+
+    for (size_t i = 0, length = poller->io_uring_recvs.length; i < length; i++)
+    {
+        aeron_udp_transport_poller_io_uring_recv_t *recv = poller->io_uring_recvs.array[i];
+
+        if (recv->in_flight)
+        {
+            aeron_udp_transport_poller_io_uring_cancel(poller, recv);
+            in_flight++;
+        }
+    }
+
+    while (in_flight > 0)
+    {
+        if (aeron_udp_io_uring_submit(&poller->ring, 1) < 0)
+        {
+            break;
+        }
+
+        aeron_udp_io_uring_for_each_cqe(&poller->ring, aeron_udp_transport_poller_io_uring_on_cqe, &state);
+
+        in_flight = 0;
+        for (size_t i = 0, length = poller->io_uring_recvs.length; i < length; i++)
+        {
+            in_flight += poller->io_uring_recvs.array[i]->in_flight ? 1 : 0;
+        }
+    }
+
+    aeron_udp_io_uring_close(&poller->ring);
+
+    for (size_t i = 0, length = poller->io_uring_recvs.length; i < length; i++)
+    {
+        aeron_free(poller->io_uring_recvs.array[i]->buffer);
+        aeron_free(poller->io_uring_recvs.array[i]);
+    }
+
+    aeron_free(poller->io_uring_recvs.array);
+}
+
+#endif
+
+static int64_t aeron_udp_transport_poller_bytes_received(struct mmsghdr *msgvec, int count)
+{
+    int64_t bytes_received = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        bytes_received += msgvec[i].msg_len;
+    }
+
+    return bytes_received;
+}
+
+int aeron_udp_transport_poller_init(
+    aeron_udp_transport_poller_t *poller, bool use_io_uring, size_t recv_buffer_length)
 {
     poller->transports.array = NULL;
     poller->transports.length = 0;
     poller->transports.capacity = 0;
+    poller->use_io_uring = false;
+
+#if defined(HAVE_IO_URING)
+    poller->io_uring_recvs.array = NULL;
+    poller->io_uring_recvs.length = 0;
+    poller->io_uring_recvs.capacity = 0;
+    poller->io_uring_buffer_length = recv_buffer_length;
+    poller->io_uring_unarmed_count = 0;
+
+    if (use_io_uring && aeron_udp_io_uring_is_supported())
+    {
+        if (aeron_udp_io_uring_init(&poller->ring, AERON_UDP_TRANSPORT_POLLER_IO_URING_ENTRIES) < 0)
+        {
+            return -1;
+        }
+
+        poller->use_io_uring = true;
+    }
+#endif
 
 #if defined(HAVE_EPOLL)
     if ((poller->epoll_fd = epoll_create1(0)) < 0)
@@ -32,6 +388,13 @@ int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller)
         return -1;
     }
     poller->epoll_events = NULL;
+#elif defined(HAVE_KQUEUE)
+    if ((poller->kqueue_fd = kqueue()) < 0)
+    {
+        aeron_set_err(errno, "kqueue: %s", strerror(errno));
+        return -1;
+    }
+    poller->kevents = NULL;
 #elif defined(HAVE_POLL)
     poller->pollfds = NULL;
 #endif
@@ -41,10 +404,20 @@ int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller)
 
 int aeron_udp_transport_poller_close(aeron_udp_transport_poller_t *poller)
 {
+#if defined(HAVE_IO_URING)
+    if (poller->use_io_uring)
+    {
+        aeron_udp_transport_poller_io_uring_close(poller);
+    }
+#endif
+
     aeron_free(poller->transports.array);
 #if defined(HAVE_EPOLL)
     close(poller->epoll_fd);
     aeron_free(poller->epoll_events);
+#elif defined(HAVE_KQUEUE)
+    close(poller->kqueue_fd);
+    aeron_free(poller->kevents);
 #elif defined(HAVE_POLL)
     aeron_free(poller->pollfds);
 #endif
@@ -64,6 +437,13 @@ int aeron_udp_transport_poller_add(aeron_udp_transport_poller_t *poller, aeron_u
 
     poller->transports.array[index].transport = transport;
 
+#if defined(HAVE_IO_URING)
+    if (poller->use_io_uring && aeron_udp_transport_poller_io_uring_add(poller, transport) < 0)
+    {
+        return -1;
+    }
+#endif
+
 #if defined(HAVE_EPOLL)
     size_t new_capacity = poller->transports.capacity;
 
@@ -87,6 +467,27 @@ int aeron_udp_transport_poller_add(aeron_udp_transport_poller_t *poller, aeron_u
         return -1;
     }
 
+#elif defined(HAVE_KQUEUE)
+    size_t new_capacity = poller->transports.capacity;
+
+    if (new_capacity > old_capacity)
+    {
+        if (aeron_array_ensure_capacity(
+            (uint8_t **)&poller->kevents, sizeof(struct kevent), old_capacity, new_capacity) < 0)
+        {
+            return -1;
+        }
+    }
+
+    struct kevent change;
+
+    EV_SET(&change, transport->fd, EVFILT_READ, EV_ADD, 0, 0, transport);
+    if (kevent(poller->kqueue_fd, &change, 1, NULL, 0, NULL) < 0)
+    {
+        aeron_set_err(errno, "kevent(EV_ADD): %s", strerror(errno));
+        return -1;
+    }
+
 #elif defined(HAVE_POLL)
     size_t new_capacity = poller->transports.capacity;
 
@@ -123,6 +524,13 @@ int aeron_udp_transport_poller_remove(aeron_udp_transport_poller_t *poller, aero
 
     if (index >= 0)
     {
+#if defined(HAVE_IO_URING)
+        if (poller->use_io_uring && aeron_udp_transport_poller_io_uring_remove(poller, transport) < 0)
+        {
+            return -1;
+        }
+#endif
+
         aeron_array_fast_unordered_remove(
             (uint8_t *)poller->transports.array,
             sizeof(aeron_udp_channel_transport_entry_t),
@@ -148,6 +556,16 @@ int aeron_udp_transport_poller_remove(aeron_udp_transport_poller_t *poller, aero
             return -1;
         }
 
+#elif defined(HAVE_KQUEUE)
+        struct kevent change;
+
+        EV_SET(&change, transport->fd, EVFILT_READ, EV_DELETE, 0, 0, NULL);
+        if (kevent(poller->kqueue_fd, &change, 1, NULL, 0, NULL) < 0)
+        {
+            aeron_set_err(errno, "kevent(EV_DELETE): %s", strerror(errno));
+            return -1;
+        }
+
 #elif defined(HAVE_POLL)
         aeron_array_fast_unordered_remove(
             (uint8_t *)poller->pollfds,
@@ -165,22 +583,33 @@ int aeron_udp_transport_poller_poll(
     aeron_udp_transport_poller_t *poller,
     struct mmsghdr *msgvec,
     size_t vlen,
+    int64_t *bytes_received,
     aeron_udp_transport_recv_func_t recv_func,
     void *clientd)
 {
     int work_count = 0;
 
+    *bytes_received = 0;
+
+#if defined(HAVE_IO_URING)
+    if (poller->use_io_uring)
+    {
+        return aeron_udp_transport_poller_io_uring_poll(poller, bytes_received, recv_func, clientd);
+    }
+#endif
+
     if (poller->transports.length <= AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD)
     {
         for (size_t i = 0, length = poller->transports.length; i < length; i++)
         {
-            int recv_result = aeron_udp_channel_transport_recvmmsg(
+            int recv_result = poller->transports.array[i].transport->bindings->recvmmsg_func(
                 poller->transports.array[i].transport, msgvec, vlen, recv_func, clientd);
             if (recv_result < 0)
             {
                 return recv_result;
             }
 
+            *bytes_received += aeron_udp_transport_poller_bytes_received(msgvec, recv_result);
             work_count += recv_result;
         }
     }
@@ -211,21 +640,70 @@ int aeron_udp_transport_poller_poll(
             {
                 if (poller->epoll_events[i].events & EPOLLIN)
                 {
-                    int recv_result = aeron_udp_channel_transport_recvmmsg(
-                        poller->epoll_events[i].data.ptr, msgvec, vlen, recv_func, clientd);
+                    aeron_udp_channel_transport_t *transport = poller->epoll_events[i].data.ptr;
+                    int recv_result = transport->bindings->recvmmsg_func(
+                        transport, msgvec, vlen, recv_func, clientd);
 
                     if (recv_result < 0)
                     {
                         return recv_result;
                     }
 
-                    work_count += recv_result;
+                    *bytes_received += aeron_udp_transport_poller_bytes_received(msgvec, recv_result);
+            work_count += recv_result;
                 }
 
                 poller->epoll_events[i].events = 0;
             }
         }
 
+#elif defined(HAVE_KQUEUE)
+        struct timespec timeout = { 0, 0 };
+        int result = kevent(
+            poller->kqueue_fd, NULL, 0, poller->kevents, (int)poller->transports.length, &timeout);
+
+        if (result < 0)
+        {
+            int err = errno;
+
+            if (EINTR == err || EAGAIN == err)
+            {
+                return 0;
+            }
+
+            aeron_set_err(err, "kevent: %s", strerror(err));
+            return -1;
+        }
+        else if (0 == result)
+        {
+            return 0;
+        }
+        else
+        {
+            for (size_t i = 0, length = result; i < length; i++)
+            {
+                if (EVFILT_READ == poller->kevents[i].filter)
+                {
+                    aeron_udp_channel_transport_t *transport =
+                        (aeron_udp_channel_transport_t *)poller->kevents[i].udata;
+
+                    /* data of a read filter on a socket is the bytes waiting in its receive buffer */
+                    transport->recv_bytes_available = (int64_t)poller->kevents[i].data;
+                    int recv_result = transport->bindings->recvmmsg_func(
+                        transport, msgvec, vlen, recv_func, clientd);
+                    transport->recv_bytes_available = 0;
+
+                    if (recv_result < 0)
+                    {
+                        return recv_result;
+                    }
+
+                    *bytes_received += aeron_udp_transport_poller_bytes_received(msgvec, recv_result);
+                    work_count += recv_result;
+                }
+            }
+        }
+
 #elif defined(HAVE_POLL)
         int result = poll(poller->pollfds, (nfds_t)poller->transports.length, 0);
 
@@ -251,15 +729,17 @@ int aeron_udp_transport_poller_poll(
             {
                 if (poller->pollfds[i].revents & POLLIN)
                 {
-                    int recv_result = aeron_udp_channel_transport_recvmmsg(
-                        poller->transports.array[i].transport, msgvec, vlen, recv_func, clientd);
+                    aeron_udp_channel_transport_t *transport = poller->transports.array[i].transport;
+                    int recv_result = transport->bindings->recvmmsg_func(
+                        transport, msgvec, vlen, recv_func, clientd);
 
                     if (recv_result < 0)
                     {
                         return recv_result;
                     }
 
-                    work_count += recv_result;
+                    *bytes_received += aeron_udp_transport_poller_bytes_received(msgvec, recv_result);
+            work_count += recv_result;
                 }
 
                 poller->pollfds[i].revents = 0;
@@ -19,13 +19,20 @@
 
 #if defined(HAVE_EPOLL)
 #include <sys/epoll.h>
+#elif defined(HAVE_KQUEUE)
+#include <sys/types.h>
+#include <sys/event.h>
+#include <sys/time.h>
 #elif defined(HAVE_POLL)
 #include <poll.h>
 #endif
 
 #include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_io_uring.h"
 
 #define AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD (5)
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_ENTRIES (1024)
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_RECVS_PER_TRANSPORT (8)
 
 typedef struct aeron_udp_channel_transport_entry_stct
 {
@@ -33,6 +40,20 @@ typedef struct aeron_udp_channel_transport_entry_stct
 }
 aeron_udp_channel_transport_entry_t;
 
+#if defined(HAVE_IO_URING)
+typedef struct aeron_udp_transport_poller_io_uring_recv_stct
+{
+    aeron_udp_channel_transport_t *transport;
+    struct msghdr msghdr;
+    struct iovec iov;
+    struct sockaddr_storage addr;
+    aeron_udp_channel_transport_control_t control;
+    uint8_t *buffer;
+    bool in_flight;
+}
+aeron_udp_transport_poller_io_uring_recv_t;
+#endif
+
 typedef struct aeron_udp_transport_poller_stct
 {
     struct aeron_udp_channel_transports_stct
@@ -46,13 +67,39 @@ typedef struct aeron_udp_transport_poller_stct
 #if defined(HAVE_EPOLL)
     int epoll_fd;
     struct epoll_event *epoll_events;
+#elif defined(HAVE_KQUEUE)
+    int kqueue_fd;
+    struct kevent *kevents;
 #elif defined(HAVE_POLL)
     struct pollfd *pollfds;
 #endif
+
+    bool use_io_uring;
+#if defined(HAVE_IO_URING)
+    aeron_udp_io_uring_t ring;
+    size_t io_uring_buffer_length;
+    size_t io_uring_unarmed_count;
+
+    struct aeron_udp_transport_poller_io_uring_recvs_stct
+    {
+        aeron_udp_transport_poller_io_uring_recv_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    io_uring_recvs;
+#endif
 }
 aeron_udp_transport_poller_t;
 
-int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller);
+/*
+ * When use_io_uring is set and the kernel supports it, each transport keeps
+ * AERON_UDP_TRANSPORT_POLLER_IO_URING_RECVS_PER_TRANSPORT receives of recv_buffer_length bytes in flight and a poll
+ * reaps completions and re-arms with at most one io_uring_enter call regardless of the number of transports.
+ * Otherwise falls back to recvmmsg with epoll, kqueue or poll. kqueue reports the bytes waiting on each socket, which
+ * the receive loop used where there is no recvmmsg stops at, saving a call to find the socket empty.
+ */
+int aeron_udp_transport_poller_init(
+    aeron_udp_transport_poller_t *poller, bool use_io_uring, size_t recv_buffer_length);
 int aeron_udp_transport_poller_close(aeron_udp_transport_poller_t *poller);
 
 int aeron_udp_transport_poller_add(aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport);
@@ -62,6 +109,7 @@ int aeron_udp_transport_poller_poll(
     aeron_udp_transport_poller_t *poller,
     struct mmsghdr *msgvec,
     size_t vlen,
+    int64_t *bytes_received,
     aeron_udp_transport_recv_func_t recv_func,
     void *clientd);
 
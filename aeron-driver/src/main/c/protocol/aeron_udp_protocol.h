@@ -78,6 +78,9 @@ typedef struct aeron_status_message_header_stct
 }
 aeron_status_message_header_t;
 
+/* a status message may be followed by the receiver's group tag (int64) for tagged flow control */
+#define AERON_STATUS_MESSAGE_GROUP_TAG_OFFSET (sizeof(aeron_status_message_header_t))
+
 typedef struct aeron_rttm_header_stct
 {
     aeron_frame_header_t frame_header;
@@ -88,6 +91,22 @@ typedef struct aeron_rttm_header_stct
     int64_t receiver_id;
 }
 aeron_rttm_header_t;
+
+/*
+ * Parity over a group of consecutive datagrams of a term, followed by the length of each datagram as int32 and then
+ * parity_length bytes of parity, see aeron_fec.h.
+ */
+typedef struct aeron_fec_header_stct
+{
+    aeron_frame_header_t frame_header;
+    int32_t term_offset;
+    int32_t session_id;
+    int32_t stream_id;
+    int32_t term_id;
+    int32_t datagram_count;
+    int32_t parity_length;
+}
+aeron_fec_header_t;
 #pragma pack(pop)
 
 #define AERON_FRAME_HEADER_VERSION (0)
@@ -99,6 +118,7 @@ aeron_rttm_header_t;
 #define AERON_HDR_TYPE_ERR (0x04)
 #define AERON_HDR_TYPE_SETUP (0x05)
 #define AERON_HDR_TYPE_RTTM (0x06)
+#define AERON_HDR_TYPE_FEC (0x07)
 #define AERON_HDR_TYPE_EXT (0xFFFF)
 
 #define AERON_DATA_HEADER_LENGTH (sizeof(aeron_data_header_t))
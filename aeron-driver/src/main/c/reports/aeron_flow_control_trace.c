@@ -0,0 +1,110 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+#include "reports/aeron_flow_control_trace.h"
+#include "util/aeron_error.h"
+
+int aeron_flow_control_trace_init(aeron_flow_control_trace_t *trace, uint8_t *buffer, size_t length)
+{
+    if (length < sizeof(aeron_flow_control_trace_header_t) + sizeof(aeron_flow_control_trace_record_t))
+    {
+        aeron_set_err(EINVAL, "flow control trace buffer too short: %" PRIu64, (uint64_t)length);
+        return -1;
+    }
+
+    const size_t max_records =
+        (length - sizeof(aeron_flow_control_trace_header_t)) / sizeof(aeron_flow_control_trace_record_t);
+    int64_t record_capacity = 1;
+
+    while ((size_t)(record_capacity << 1) <= max_records)
+    {
+        record_capacity <<= 1;
+    }
+
+    trace->header = (aeron_flow_control_trace_header_t *)buffer;
+    trace->records = (aeron_flow_control_trace_record_t *)(buffer + sizeof(aeron_flow_control_trace_header_t));
+    trace->capacity_mask = record_capacity - 1;
+
+    AERON_PUT_ORDERED(trace->header->record_capacity, record_capacity);
+
+    return 0;
+}
+
+extern void aeron_flow_control_trace_record(
+    aeron_flow_control_trace_t *trace,
+    int32_t event_type,
+    int32_t cause,
+    int64_t cause_id,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int64_t limit,
+    int64_t position,
+    int64_t timestamp_ns);
+
+size_t aeron_flow_control_trace_read(
+    const uint8_t *buffer, size_t length, aeron_flow_control_trace_read_func_t record_func, void *clientd)
+{
+    const aeron_flow_control_trace_header_t *header = (const aeron_flow_control_trace_header_t *)buffer;
+    const aeron_flow_control_trace_record_t *records =
+        (const aeron_flow_control_trace_record_t *)(buffer + sizeof(aeron_flow_control_trace_header_t));
+    int64_t record_capacity, tail;
+    size_t records_read = 0;
+
+    if (length < sizeof(aeron_flow_control_trace_header_t))
+    {
+        return 0;
+    }
+
+    AERON_GET_VOLATILE(record_capacity, header->record_capacity);
+    AERON_GET_VOLATILE(tail, header->tail);
+
+    if (record_capacity <= 0 ||
+        length < sizeof(aeron_flow_control_trace_header_t) +
+            ((size_t)record_capacity * sizeof(aeron_flow_control_trace_record_t)))
+    {
+        return 0;
+    }
+
+    for (int64_t index = tail > record_capacity ? tail - record_capacity : 0; index < tail; index++)
+    {
+        const aeron_flow_control_trace_record_t *record = &records[index & (record_capacity - 1)];
+        aeron_flow_control_trace_record_t copy;
+        int64_t sequence;
+
+        AERON_GET_VOLATILE(sequence, record->sequence);
+        if (sequence != index + 1)
+        {
+            continue;
+        }
+
+        memcpy(&copy, (const void *)record, sizeof(copy));
+
+        AERON_GET_VOLATILE(sequence, record->sequence);
+        if (sequence != index + 1)
+        {
+            continue;
+        }
+
+        records_read++;
+        record_func(clientd, &copy);
+    }
+
+    return records_read;
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_FLOW_CONTROL_TRACE_H
+#define AERON_AERON_FLOW_CONTROL_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_bitutil.h"
+
+#define AERON_FLOW_CONTROL_TRACE_FILE "flow-control-trace.dat"
+
+/* the sender limit of a network publication changed, set by its flow control strategy */
+#define AERON_FLOW_CONTROL_TRACE_EVENT_SND_LMT (1)
+/* the publication limit changed, set by the conductor from the slowest consumer and the term window */
+#define AERON_FLOW_CONTROL_TRACE_EVENT_PUB_LMT (2)
+
+/* cause_id is the receiver id whose window set the sender limit */
+#define AERON_FLOW_CONTROL_TRACE_CAUSE_RECEIVER (1)
+/* the publication limit follows the sender position, cause_id is -1 */
+#define AERON_FLOW_CONTROL_TRACE_CAUSE_SENDER (2)
+/* the publication limit follows a spy, cause_id is the counter id of its subscriber position */
+#define AERON_FLOW_CONTROL_TRACE_CAUSE_SUBSCRIBER (3)
+/* the publication limit is held back by cleaning of the log, cause_id is -1 */
+#define AERON_FLOW_CONTROL_TRACE_CAUSE_CLEANING (4)
+
+/*
+ * The trace file is this header followed by a power of two number of records. Writers claim a record by adding to
+ * tail so the sender and conductor can both write, and a record is overwritten once the ring wraps. A record is
+ * complete when its sequence is its index in the ring plus one and was the same before and after it was read.
+ * position is the sender position for a sender limit event and the slowest consumer position for a publication limit
+ * event.
+ */
+typedef struct aeron_flow_control_trace_header_stct
+{
+    int64_t record_capacity;
+    uint8_t pad_1[AERON_CACHE_LINE_LENGTH - sizeof(int64_t)];
+    volatile int64_t tail;
+    uint8_t pad_2[AERON_CACHE_LINE_LENGTH - sizeof(int64_t)];
+}
+aeron_flow_control_trace_header_t;
+
+typedef struct aeron_flow_control_trace_record_stct
+{
+    volatile int64_t sequence;
+    int64_t timestamp_ns;
+    int64_t registration_id;
+    int64_t limit;
+    int64_t position;
+    int64_t cause_id;
+    int32_t session_id;
+    int32_t stream_id;
+    int32_t event_type;
+    int32_t cause;
+}
+aeron_flow_control_trace_record_t;
+
+typedef struct aeron_flow_control_trace_stct
+{
+    aeron_flow_control_trace_header_t *header;
+    aeron_flow_control_trace_record_t *records;
+    int64_t capacity_mask;
+}
+aeron_flow_control_trace_t;
+
+int aeron_flow_control_trace_init(aeron_flow_control_trace_t *trace, uint8_t *buffer, size_t length);
+
+/*
+ * Record a limit change. A no-op when the trace is NULL or has no buffer, which is when tracing is not enabled.
+ */
+inline void aeron_flow_control_trace_record(
+    aeron_flow_control_trace_t *trace,
+    int32_t event_type,
+    int32_t cause,
+    int64_t cause_id,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int64_t limit,
+    int64_t position,
+    int64_t timestamp_ns)
+{
+    if (NULL == trace || NULL == trace->records)
+    {
+        return;
+    }
+
+    int64_t index;
+    AERON_GET_AND_ADD_INT64(index, trace->header->tail, 1);
+    aeron_flow_control_trace_record_t *record = &trace->records[index & trace->capacity_mask];
+
+    AERON_PUT_ORDERED(record->sequence, 0);
+    record->timestamp_ns = timestamp_ns;
+    record->registration_id = registration_id;
+    record->limit = limit;
+    record->position = position;
+    record->cause_id = cause_id;
+    record->session_id = session_id;
+    record->stream_id = stream_id;
+    record->event_type = event_type;
+    record->cause = cause;
+    AERON_PUT_ORDERED(record->sequence, index + 1);
+}
+
+typedef void (*aeron_flow_control_trace_read_func_t)(
+    void *clientd, const aeron_flow_control_trace_record_t *record);
+
+/*
+ * Visit the complete records still in the ring from oldest to newest. Returns the number of records read.
+ */
+size_t aeron_flow_control_trace_read(
+    const uint8_t *buffer, size_t length, aeron_flow_control_trace_read_func_t record_func, void *clientd);
+
+#endif //AERON_AERON_FLOW_CONTROL_TRACE_H
@@ -38,7 +38,7 @@ aeron_loss_reporter_entry_offset_t aeron_loss_reporter_create_entry(
 {
     aeron_loss_reporter_entry_offset_t entry_offset = -1;
     const size_t required_capacity =
-        sizeof(aeron_loss_reporter_entry_t) + (2 * sizeof(int32_t)) + channel_length + source_length;
+        aeron_loss_reporter_rate_series_offset(channel_length, source_length) + sizeof(aeron_loss_reporter_rate_series_t);
 
     if (required_capacity <= (reporter->capacity - reporter->next_record_offset))
     {
@@ -61,6 +61,12 @@ aeron_loss_reporter_entry_offset_t aeron_loss_reporter_create_entry(
         ptr += sizeof(int32_t);
         memcpy(ptr, source, source_length);
 
+        aeron_loss_reporter_rate_series_t *series =
+            aeron_loss_reporter_rate_series(reporter->buffer + reporter->next_record_offset);
+        memset(series, 0, sizeof(aeron_loss_reporter_rate_series_t));
+        series->sample_interval_ms = AERON_LOSS_REPORTER_RATE_SAMPLE_INTERVAL_MS;
+        series->sample_capacity = AERON_LOSS_REPORTER_RATE_SAMPLE_CAPACITY;
+
         AERON_PUT_ORDERED(entry->observation_count, 1);
 
         entry_offset = (aeron_loss_reporter_entry_offset_t)reporter->next_record_offset;
@@ -75,6 +81,17 @@ aeron_loss_reporter_entry_offset_t aeron_loss_reporter_create_entry(
     return entry_offset;
 }
 
+extern size_t aeron_loss_reporter_rate_series_offset(size_t channel_length, size_t source_length);
+
+extern aeron_loss_reporter_rate_series_t *aeron_loss_reporter_rate_series(const uint8_t *entry_ptr);
+
+extern void aeron_loss_reporter_record_rate_sample(
+    aeron_loss_reporter_t *reporter,
+    aeron_loss_reporter_entry_offset_t offset,
+    int64_t bytes_lost,
+    int64_t naks_sent,
+    int64_t timestamp_ms);
+
 extern void aeron_loss_reporter_record_observation(
     aeron_loss_reporter_t *reporter,
     aeron_loss_reporter_entry_offset_t offset,
@@ -125,9 +142,68 @@ size_t aeron_loss_reporter_read(
             source_length);
 
         const size_t record_length =
-            sizeof(aeron_loss_reporter_entry_t) + (2 * sizeof(int32_t)) + channel_length + source_length;
+            aeron_loss_reporter_rate_series_offset((size_t)channel_length, (size_t)source_length) +
+            sizeof(aeron_loss_reporter_rate_series_t);
         offset += AERON_ALIGN(record_length, AERON_LOSS_REPORTER_ENTRY_ALIGNMENT);
     }
 
     return records_read;
 }
+
+size_t aeron_loss_reporter_read_rate_samples(
+    const uint8_t *buffer, size_t capacity, aeron_loss_reporter_read_rate_sample_func_t sample_func, void *clientd)
+{
+    size_t samples_read = 0;
+    size_t offset = 0;
+
+    while (offset < capacity)
+    {
+        const uint8_t *ptr = buffer + offset;
+        aeron_loss_reporter_entry_t *entry = (aeron_loss_reporter_entry_t *)ptr;
+
+        int64_t observation_count;
+        AERON_GET_VOLATILE(observation_count, entry->observation_count);
+        if (observation_count <= 0)
+        {
+            break;
+        }
+
+        aeron_loss_reporter_rate_series_t *series = aeron_loss_reporter_rate_series(ptr);
+
+        for (size_t i = 0; i < AERON_LOSS_REPORTER_RATE_SAMPLE_CAPACITY; i++)
+        {
+            aeron_loss_reporter_rate_sample_t *sample = &series->samples[i];
+            int64_t timestamp, loss_observations, bytes_lost, naks_sent, timestamp_after;
+
+            AERON_GET_VOLATILE(timestamp, sample->timestamp);
+            AERON_GET_VOLATILE(loss_observations, sample->loss_observations);
+            AERON_GET_VOLATILE(bytes_lost, sample->bytes_lost);
+            AERON_GET_VOLATILE(naks_sent, sample->naks_sent);
+            AERON_GET_VOLATILE(timestamp_after, sample->timestamp);
+
+            if (0 != timestamp && timestamp == timestamp_after)
+            {
+                ++samples_read;
+                sample_func(
+                    clientd,
+                    entry->session_id,
+                    entry->stream_id,
+                    series->sample_interval_ms,
+                    timestamp,
+                    loss_observations,
+                    bytes_lost,
+                    naks_sent);
+            }
+        }
+
+        const int32_t channel_length = *(int32_t *)(ptr + sizeof(aeron_loss_reporter_entry_t));
+        const int32_t source_length =
+            *(int32_t *)(ptr + sizeof(aeron_loss_reporter_entry_t) + sizeof(int32_t) + channel_length);
+        const size_t record_length =
+            aeron_loss_reporter_rate_series_offset((size_t)channel_length, (size_t)source_length) +
+            sizeof(aeron_loss_reporter_rate_series_t);
+        offset += AERON_ALIGN(record_length, AERON_LOSS_REPORTER_ENTRY_ALIGNMENT);
+    }
+
+    return samples_read;
+}
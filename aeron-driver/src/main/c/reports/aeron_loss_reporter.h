@@ -40,6 +40,35 @@ aeron_loss_reporter_entry_t;
 
 #define AERON_LOSS_REPORTER_ENTRY_ALIGNMENT (AERON_CACHE_LINE_LENGTH)
 
+#define AERON_LOSS_REPORTER_RATE_SAMPLE_CAPACITY (128)
+#define AERON_LOSS_REPORTER_RATE_SAMPLE_INTERVAL_MS (100)
+#define AERON_LOSS_REPORTER_RATE_SERIES_ALIGNMENT (sizeof(int64_t))
+
+/*
+ * Loss and retransmit request counts for one fixed interval. Slots are indexed by interval so quiet intervals leave no
+ * sample. timestamp is the start of the interval and is zero while the receiver resets the slot for a new interval.
+ */
+typedef struct aeron_loss_reporter_rate_sample_stct
+{
+    int64_t timestamp;
+    int64_t loss_observations;
+    int64_t bytes_lost;
+    int64_t naks_sent;
+}
+aeron_loss_reporter_rate_sample_t;
+
+/*
+ * Follows the channel and source of each entry, aligned to AERON_LOSS_REPORTER_RATE_SERIES_ALIGNMENT. Written only by
+ * the receiver.
+ */
+typedef struct aeron_loss_reporter_rate_series_stct
+{
+    int64_t sample_interval_ms;
+    int64_t sample_capacity;
+    aeron_loss_reporter_rate_sample_t samples[AERON_LOSS_REPORTER_RATE_SAMPLE_CAPACITY];
+}
+aeron_loss_reporter_rate_series_t;
+
 typedef struct aeron_loss_reporter_stct
 {
     uint8_t *buffer;
@@ -50,6 +79,23 @@ aeron_loss_reporter_t;
 
 typedef int64_t aeron_loss_reporter_entry_offset_t;
 
+inline size_t aeron_loss_reporter_rate_series_offset(size_t channel_length, size_t source_length)
+{
+    return AERON_ALIGN(
+        sizeof(aeron_loss_reporter_entry_t) + (2 * sizeof(int32_t)) + channel_length + source_length,
+        AERON_LOSS_REPORTER_RATE_SERIES_ALIGNMENT);
+}
+
+inline aeron_loss_reporter_rate_series_t *aeron_loss_reporter_rate_series(const uint8_t *entry_ptr)
+{
+    const int32_t channel_length = *(int32_t *)(entry_ptr + sizeof(aeron_loss_reporter_entry_t));
+    const int32_t source_length =
+        *(int32_t *)(entry_ptr + sizeof(aeron_loss_reporter_entry_t) + sizeof(int32_t) + channel_length);
+
+    return (aeron_loss_reporter_rate_series_t *)
+        (entry_ptr + aeron_loss_reporter_rate_series_offset((size_t)channel_length, (size_t)source_length));
+}
+
 int aeron_loss_reporter_init(aeron_loss_reporter_t *reporter, uint8_t *buffer, size_t length);
 
 aeron_loss_reporter_entry_offset_t aeron_loss_reporter_create_entry(
@@ -81,6 +127,39 @@ inline void aeron_loss_reporter_record_observation(
     }
 }
 
+/*
+ * Add to the rate sample for the interval containing timestamp_ms. Must only be called from the receiver.
+ */
+inline void aeron_loss_reporter_record_rate_sample(
+    aeron_loss_reporter_t *reporter,
+    aeron_loss_reporter_entry_offset_t offset,
+    int64_t bytes_lost,
+    int64_t naks_sent,
+    int64_t timestamp_ms)
+{
+    if (offset >= 0)
+    {
+        aeron_loss_reporter_rate_series_t *series = aeron_loss_reporter_rate_series(reporter->buffer + offset);
+        const int64_t interval = timestamp_ms / series->sample_interval_ms;
+        const int64_t interval_start = interval * series->sample_interval_ms;
+        aeron_loss_reporter_rate_sample_t *sample =
+            &series->samples[(size_t)interval & (AERON_LOSS_REPORTER_RATE_SAMPLE_CAPACITY - 1)];
+
+        if (sample->timestamp != interval_start)
+        {
+            AERON_PUT_ORDERED(sample->timestamp, 0);
+            sample->loss_observations = 0;
+            sample->bytes_lost = 0;
+            sample->naks_sent = 0;
+            AERON_PUT_ORDERED(sample->timestamp, interval_start);
+        }
+
+        AERON_PUT_ORDERED(sample->loss_observations, sample->loss_observations + 1);
+        AERON_PUT_ORDERED(sample->bytes_lost, sample->bytes_lost + bytes_lost);
+        AERON_PUT_ORDERED(sample->naks_sent, sample->naks_sent + naks_sent);
+    }
+}
+
 typedef void (*aeron_loss_reporter_read_entry_func_t)(
     void *clientd,
     int64_t observation_count,
@@ -97,4 +176,20 @@ typedef void (*aeron_loss_reporter_read_entry_func_t)(
 size_t aeron_loss_reporter_read(
     const uint8_t *buffer, size_t capacity, aeron_loss_reporter_read_entry_func_t entry_func, void *clientd);
 
+typedef void (*aeron_loss_reporter_read_rate_sample_func_t)(
+    void *clientd,
+    int32_t session_id,
+    int32_t stream_id,
+    int64_t sample_interval_ms,
+    int64_t timestamp,
+    int64_t loss_observations,
+    int64_t bytes_lost,
+    int64_t naks_sent);
+
+/*
+ * Visit the complete rate samples of every entry, in slot order. Returns the number of samples read.
+ */
+size_t aeron_loss_reporter_read_rate_samples(
+    const uint8_t *buffer, size_t capacity, aeron_loss_reporter_read_rate_sample_func_t sample_func, void *clientd);
+
 #endif //AERON_AERON_LOSS_REPORTER_H
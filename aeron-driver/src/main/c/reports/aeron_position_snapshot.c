@@ -0,0 +1,164 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+#include "reports/aeron_position_snapshot.h"
+#include "util/aeron_error.h"
+
+extern size_t aeron_position_snapshot_section_length(size_t section_capacity);
+extern size_t aeron_position_snapshot_length(size_t section_count, size_t section_capacity);
+extern void aeron_position_snapshot_begin(aeron_position_snapshot_writer_t *writer);
+extern void aeron_position_snapshot_put(
+    aeron_position_snapshot_writer_t *writer,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int64_t position,
+    int64_t high_water_mark,
+    int64_t limit);
+extern void aeron_position_snapshot_end(aeron_position_snapshot_writer_t *writer, int64_t now_ns);
+
+static uint8_t *aeron_position_snapshot_section(const uint8_t *buffer, int32_t section_capacity, int32_t index)
+{
+    return (uint8_t *)buffer + sizeof(aeron_position_snapshot_header_t) +
+        ((size_t)index * aeron_position_snapshot_section_length((size_t)section_capacity));
+}
+
+int aeron_position_snapshot_init(
+    uint8_t *buffer, size_t length, int32_t sender_count, int32_t receiver_count, int32_t section_capacity)
+{
+    const int32_t section_count = sender_count + receiver_count;
+
+    if (section_capacity <= 0 ||
+        length < aeron_position_snapshot_length((size_t)section_count, (size_t)section_capacity))
+    {
+        aeron_set_err(EINVAL, "position snapshot buffer too short: %" PRIu64, (uint64_t)length);
+        return -1;
+    }
+
+    aeron_position_snapshot_header_t *header = (aeron_position_snapshot_header_t *)buffer;
+
+    for (int32_t i = 0; i < section_count; i++)
+    {
+        aeron_position_snapshot_section_header_t *section_header =
+            (aeron_position_snapshot_section_header_t *)aeron_position_snapshot_section(buffer, section_capacity, i);
+
+        section_header->kind = i < sender_count ?
+            AERON_POSITION_SNAPSHOT_KIND_SENDER : AERON_POSITION_SNAPSHOT_KIND_RECEIVER;
+    }
+
+    header->section_capacity = section_capacity;
+    header->sender_count = sender_count;
+    AERON_PUT_ORDERED(header->section_count, section_count);
+
+    return 0;
+}
+
+void aeron_position_snapshot_writer_init(aeron_position_snapshot_writer_t *writer, uint8_t *buffer, int32_t index)
+{
+    memset(writer, 0, sizeof(aeron_position_snapshot_writer_t));
+
+    if (NULL == buffer)
+    {
+        return;
+    }
+
+    const aeron_position_snapshot_header_t *header = (const aeron_position_snapshot_header_t *)buffer;
+    const size_t capacity = (size_t)header->section_capacity;
+    uint8_t *section = aeron_position_snapshot_section(buffer, header->section_capacity, index);
+    uint8_t *columns = section + sizeof(aeron_position_snapshot_section_header_t);
+
+    writer->header = (aeron_position_snapshot_section_header_t *)section;
+    writer->registration_ids = (int64_t *)columns;
+    writer->positions = (int64_t *)(columns + (capacity * sizeof(int64_t)));
+    writer->high_water_marks = (int64_t *)(columns + (2 * capacity * sizeof(int64_t)));
+    writer->limits = (int64_t *)(columns + (3 * capacity * sizeof(int64_t)));
+    writer->session_ids = (int32_t *)(columns + (4 * capacity * sizeof(int64_t)));
+    writer->stream_ids = (int32_t *)(columns + (4 * capacity * sizeof(int64_t)) + (capacity * sizeof(int32_t)));
+    writer->capacity = header->section_capacity;
+}
+
+int32_t aeron_position_snapshot_read(
+    const uint8_t *buffer,
+    size_t length,
+    int32_t index,
+    aeron_position_snapshot_entry_t *entries,
+    int32_t entries_length,
+    int32_t *kind,
+    int64_t *timestamp_ns)
+{
+    const aeron_position_snapshot_header_t *header = (const aeron_position_snapshot_header_t *)buffer;
+    int32_t section_count;
+
+    if (length < sizeof(aeron_position_snapshot_header_t))
+    {
+        aeron_set_err(EINVAL, "position snapshot buffer too short: %" PRIu64, (uint64_t)length);
+        return -1;
+    }
+
+    AERON_GET_VOLATILE(section_count, header->section_count);
+
+    if (index < 0 || index >= section_count || header->section_capacity <= 0 ||
+        length < aeron_position_snapshot_length((size_t)section_count, (size_t)header->section_capacity))
+    {
+        aeron_set_err(EINVAL, "position snapshot has no section %" PRId32, index);
+        return -1;
+    }
+
+    aeron_position_snapshot_writer_t section;
+    aeron_position_snapshot_writer_init(&section, (uint8_t *)buffer, index);
+
+    for (int attempt = 0; attempt < AERON_POSITION_SNAPSHOT_MAX_READ_ATTEMPTS; attempt++)
+    {
+        int64_t begin_sequence, end_sequence;
+        AERON_GET_VOLATILE(begin_sequence, section.header->sequence);
+
+        if (0 != (begin_sequence & 1))
+        {
+            continue;
+        }
+
+        int32_t section_length = section.header->length;
+        section_length = section_length < entries_length ? section_length : entries_length;
+        section_length = section_length < section.capacity ? section_length : section.capacity;
+
+        for (int32_t i = 0; i < section_length; i++)
+        {
+            entries[i].registration_id = section.registration_ids[i];
+            entries[i].position = section.positions[i];
+            entries[i].high_water_mark = section.high_water_marks[i];
+            entries[i].limit = section.limits[i];
+            entries[i].session_id = section.session_ids[i];
+            entries[i].stream_id = section.stream_ids[i];
+        }
+
+        *kind = section.header->kind;
+        *timestamp_ns = section.header->timestamp_ns;
+
+        aeron_acquire();
+        AERON_GET_VOLATILE(end_sequence, section.header->sequence);
+
+        if (begin_sequence == end_sequence)
+        {
+            return section_length < 0 ? 0 : section_length;
+        }
+    }
+
+    aeron_set_err(EAGAIN, "position snapshot section %" PRId32 " changed on every read", index);
+    return -1;
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_POSITION_SNAPSHOT_H
+#define AERON_AERON_POSITION_SNAPSHOT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_bitutil.h"
+
+#define AERON_POSITION_SNAPSHOT_FILE "position-snapshot.dat"
+
+/* section written by a sender: position is the sender position, high water mark the producer position and limit the
+ * sender limit of each network publication */
+#define AERON_POSITION_SNAPSHOT_KIND_SENDER (1)
+/* section written by a receiver: position is the receiver position, high water mark the receiver high water mark and
+ * limit the window edge of the last status message of each image */
+#define AERON_POSITION_SNAPSHOT_KIND_RECEIVER (2)
+
+#define AERON_POSITION_SNAPSHOT_MAX_READ_ATTEMPTS (16)
+
+/*
+ * The snapshot file is this header followed by a section for each sender then each receiver. A section is a header
+ * and then the columns registration id, position, high water mark and limit of int64_t and session id and stream id
+ * of int32_t, each of section_capacity entries. The agent owning a section rewrites it once per duty cycle inside a
+ * seqlock, so a reader gets the positions of all of its publications or images from the same moment.
+ */
+typedef struct aeron_position_snapshot_header_stct
+{
+    int32_t section_count;
+    int32_t section_capacity;
+    int32_t sender_count;
+    int32_t pad_0;
+    uint8_t pad_1[AERON_CACHE_LINE_LENGTH - (4 * sizeof(int32_t))];
+}
+aeron_position_snapshot_header_t;
+
+/* sequence is odd while the section is written, length may be less than the publications or images of the agent
+ * when they do not all fit */
+typedef struct aeron_position_snapshot_section_header_stct
+{
+    volatile int64_t sequence;
+    int64_t timestamp_ns;
+    int32_t length;
+    int32_t kind;
+    uint8_t pad[AERON_CACHE_LINE_LENGTH - (2 * sizeof(int64_t)) - (2 * sizeof(int32_t))];
+}
+aeron_position_snapshot_section_header_t;
+
+typedef struct aeron_position_snapshot_entry_stct
+{
+    int64_t registration_id;
+    int64_t position;
+    int64_t high_water_mark;
+    int64_t limit;
+    int32_t session_id;
+    int32_t stream_id;
+}
+aeron_position_snapshot_entry_t;
+
+/* a section as its agent writes it, header is NULL when snapshots are not enabled */
+typedef struct aeron_position_snapshot_writer_stct
+{
+    aeron_position_snapshot_section_header_t *header;
+    int64_t *registration_ids;
+    int64_t *positions;
+    int64_t *high_water_marks;
+    int64_t *limits;
+    int32_t *session_ids;
+    int32_t *stream_ids;
+    int32_t capacity;
+    int32_t length;
+}
+aeron_position_snapshot_writer_t;
+
+inline size_t aeron_position_snapshot_section_length(size_t section_capacity)
+{
+    return AERON_ALIGN(
+        sizeof(aeron_position_snapshot_section_header_t) +
+            (section_capacity * ((4 * sizeof(int64_t)) + (2 * sizeof(int32_t)))),
+        AERON_CACHE_LINE_LENGTH);
+}
+
+inline size_t aeron_position_snapshot_length(size_t section_count, size_t section_capacity)
+{
+    return sizeof(aeron_position_snapshot_header_t) +
+        (section_count * aeron_position_snapshot_section_length(section_capacity));
+}
+
+int aeron_position_snapshot_init(
+    uint8_t *buffer, size_t length, int32_t sender_count, int32_t receiver_count, int32_t section_capacity);
+
+/*
+ * Writer for the section at index, senders first, of a snapshot set up by aeron_position_snapshot_init. A NULL buffer
+ * gives a writer that ignores what it is given.
+ */
+void aeron_position_snapshot_writer_init(aeron_position_snapshot_writer_t *writer, uint8_t *buffer, int32_t index);
+
+inline void aeron_position_snapshot_begin(aeron_position_snapshot_writer_t *writer)
+{
+    AERON_PUT_ORDERED(writer->header->sequence, writer->header->sequence + 1);
+    aeron_release();
+    writer->length = 0;
+}
+
+inline void aeron_position_snapshot_put(
+    aeron_position_snapshot_writer_t *writer,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int64_t position,
+    int64_t high_water_mark,
+    int64_t limit)
+{
+    if (writer->length < writer->capacity)
+    {
+        const int32_t index = writer->length++;
+
+        writer->registration_ids[index] = registration_id;
+        writer->positions[index] = position;
+        writer->high_water_marks[index] = high_water_mark;
+        writer->limits[index] = limit;
+        writer->session_ids[index] = session_id;
+        writer->stream_ids[index] = stream_id;
+    }
+}
+
+inline void aeron_position_snapshot_end(aeron_position_snapshot_writer_t *writer, int64_t now_ns)
+{
+    writer->header->timestamp_ns = now_ns;
+    writer->header->length = writer->length;
+    AERON_PUT_ORDERED(writer->header->sequence, writer->header->sequence + 1);
+}
+
+/*
+ * Copy the entries of the section at index into entries, retrying while it is being written. Returns the number of
+ * entries copied, at most entries_length, or -1 when the section could not be read whole within
+ * AERON_POSITION_SNAPSHOT_MAX_READ_ATTEMPTS or the buffer does not hold it.
+ */
+int32_t aeron_position_snapshot_read(
+    const uint8_t *buffer,
+    size_t length,
+    int32_t index,
+    aeron_position_snapshot_entry_t *entries,
+    int32_t entries_length,
+    int32_t *kind,
+    int64_t *timestamp_ns);
+
+#endif //AERON_AERON_POSITION_SNAPSHOT_H
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+#include "reports/aeron_stream_activity.h"
+#include "util/aeron_error.h"
+
+extern size_t aeron_stream_activity_length(size_t capacity);
+extern void aeron_stream_activity_append(aeron_stream_activity_t *activity, int64_t correlation_id);
+extern bool aeron_stream_activity_track(
+    aeron_stream_activity_t *activity, int64_t correlation_id, int64_t position, int64_t *last_position);
+
+int aeron_stream_activity_init(aeron_stream_activity_t *activity, uint8_t *buffer, size_t length, int32_t capacity)
+{
+    memset(activity, 0, sizeof(aeron_stream_activity_t));
+
+    if (NULL == buffer)
+    {
+        return 0;
+    }
+
+    if (capacity <= 0 || !AERON_IS_POWER_OF_TWO(capacity))
+    {
+        aeron_set_err(EINVAL, "stream activity capacity not a power of two: %" PRId32, capacity);
+        return -1;
+    }
+
+    if (length < aeron_stream_activity_length((size_t)capacity))
+    {
+        aeron_set_err(EINVAL, "stream activity buffer too short: %" PRIu64, (uint64_t)length);
+        return -1;
+    }
+
+    aeron_stream_activity_header_t *header = (aeron_stream_activity_header_t *)buffer;
+
+    activity->header = header;
+    activity->entries = (aeron_stream_activity_entry_t *)(buffer + sizeof(aeron_stream_activity_header_t));
+    activity->mask = capacity - 1;
+
+    AERON_PUT_ORDERED(header->capacity, capacity);
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_STREAM_ACTIVITY_H
+#define AERON_AERON_STREAM_ACTIVITY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_bitutil.h"
+
+#define AERON_STREAM_ACTIVITY_FILE "stream-activity.dat"
+
+/*
+ * The activity file is this header followed by capacity entries, a ring of the correlation ids of the images and
+ * publications whose logs have had data added. The conductor is the only writer and appends an entry for each stream
+ * that moved on in a duty cycle, so consumers of many streams read which ones to poll rather than checking them all.
+ * The tail is the count of entries ever appended and sits in a cache line of its own.
+ */
+typedef struct aeron_stream_activity_header_stct
+{
+    int32_t capacity;
+    int32_t pad_0;
+    uint8_t pad_1[AERON_CACHE_LINE_LENGTH - (2 * sizeof(int32_t))];
+    volatile int64_t tail;
+    uint8_t pad_2[AERON_CACHE_LINE_LENGTH - sizeof(int64_t)];
+}
+aeron_stream_activity_header_t;
+
+/* sequence is the count of entries appended before this one, or -1 while the entry is written */
+typedef struct aeron_stream_activity_entry_stct
+{
+    volatile int64_t sequence;
+    int64_t correlation_id;
+}
+aeron_stream_activity_entry_t;
+
+/* the ring as the conductor writes it, header is NULL when stream activity is not enabled */
+typedef struct aeron_stream_activity_stct
+{
+    aeron_stream_activity_header_t *header;
+    aeron_stream_activity_entry_t *entries;
+    int64_t tail;
+    int64_t mask;
+}
+aeron_stream_activity_t;
+
+inline size_t aeron_stream_activity_length(size_t capacity)
+{
+    return sizeof(aeron_stream_activity_header_t) + (capacity * sizeof(aeron_stream_activity_entry_t));
+}
+
+/*
+ * Set up the ring in buffer, of capacity entries which must be a power of two. A NULL buffer gives a ring that
+ * ignores what is appended.
+ */
+int aeron_stream_activity_init(aeron_stream_activity_t *activity, uint8_t *buffer, size_t length, int32_t capacity);
+
+inline void aeron_stream_activity_append(aeron_stream_activity_t *activity, int64_t correlation_id)
+{
+    const int64_t sequence = activity->tail;
+    aeron_stream_activity_entry_t *entry = &activity->entries[sequence & activity->mask];
+
+    AERON_PUT_ORDERED(entry->sequence, -1);
+    aeron_release();
+    entry->correlation_id = correlation_id;
+    AERON_PUT_ORDERED(entry->sequence, sequence);
+
+    activity->tail = sequence + 1;
+    AERON_PUT_ORDERED(activity->header->tail, sequence + 1);
+}
+
+/*
+ * Append the correlation id of a stream when position has moved on from the last position it was flagged at.
+ */
+inline bool aeron_stream_activity_track(
+    aeron_stream_activity_t *activity, int64_t correlation_id, int64_t position, int64_t *last_position)
+{
+    if (position > *last_position)
+    {
+        *last_position = position;
+
+        if (NULL != activity->header)
+        {
+            aeron_stream_activity_append(activity, correlation_id);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#endif //AERON_AERON_STREAM_ACTIVITY_H
@@ -21,6 +21,7 @@
 #include "aeron_driver_context.h"
 #include "aeron_uri.h"
 #include "aeron_alloc.h"
+#include "aeron_fec.h"
 
 typedef enum aeron_uri_parser_state_enum
 {
@@ -291,6 +292,7 @@ int aeron_uri_get_term_length_param(aeron_uri_params_t *uri_params, aeron_uri_pu
         }
 
         params->term_length = value;
+        params->has_term_length = true;
     }
 
     return 0;
@@ -333,6 +335,8 @@ int aeron_uri_publication_params(
     params->term_offset = 0;
     params->term_id = 0;
     params->is_replay = false;
+    params->is_durable = false;
+    params->has_term_length = false;
     aeron_uri_params_t *uri_params =
         (AERON_URI_IPC == uri->type) ? &uri->params.ipc.additional_params : &uri->params.udp.additional_params;
 
@@ -346,6 +350,11 @@ int aeron_uri_publication_params(
         return -1;
     }
 
+    if (aeron_uri_durable(uri, &params->is_durable) < 0)
+    {
+        return -1;
+    }
+
     if (is_exclusive)
     {
         const char *initial_term_id_str = NULL;
@@ -434,12 +443,572 @@ int aeron_uri_publication_params(
     return 0;
 }
 
+const char *aeron_uri_media_bindings(aeron_uri_t *uri)
+{
+    if (AERON_URI_UDP != uri->type)
+    {
+        return NULL;
+    }
+
+    return aeron_uri_find_param_value(&uri->params.udp.additional_params, AERON_UDP_CHANNEL_MEDIA_BINDINGS_KEY);
+}
+
+int aeron_uri_sender_affinity(aeron_uri_t *uri, int32_t *sender_affinity)
+{
+    const char *value_str;
+
+    *sender_affinity = -1;
+
+    if (AERON_URI_UDP == uri->type &&
+        (value_str = aeron_uri_find_param_value(
+            &uri->params.udp.additional_params, AERON_UDP_CHANNEL_SENDER_AFFINITY_KEY)) != NULL)
+    {
+        char *end_ptr = NULL;
+        uint64_t value;
+
+        errno = 0;
+        value = strtoull(value_str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == value_str || '\0' != *end_ptr || value > INT32_MAX)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_SENDER_AFFINITY_KEY);
+            return -1;
+        }
+
+        *sender_affinity = (int32_t)value;
+    }
+
+    return 0;
+}
+
+int aeron_uri_numa_node(aeron_uri_t *uri, int32_t *numa_node)
+{
+    const char *value_str;
+
+    *numa_node = -1;
+
+    if (AERON_URI_UNKNOWN == uri->type)
+    {
+        return 0;
+    }
+
+    aeron_uri_params_t *uri_params =
+        (AERON_URI_IPC == uri->type) ? &uri->params.ipc.additional_params : &uri->params.udp.additional_params;
+
+    if ((value_str = aeron_uri_find_param_value(uri_params, AERON_URI_NUMA_NODE_KEY)) != NULL)
+    {
+        char *end_ptr = NULL;
+        uint64_t value;
+
+        errno = 0;
+        value = strtoull(value_str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == value_str || '\0' != *end_ptr || value > INT32_MAX)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_URI_NUMA_NODE_KEY);
+            return -1;
+        }
+
+        *numa_node = (int32_t)value;
+    }
+
+    return 0;
+}
+
+int aeron_uri_fec_group_size(aeron_uri_t *uri, size_t *fec_group_size)
+{
+    const char *value_str;
+
+    *fec_group_size = 0;
+
+    if (AERON_URI_UDP == uri->type &&
+        (value_str = aeron_uri_find_param_value(&uri->params.udp.additional_params, AERON_UDP_CHANNEL_FEC_KEY)) != NULL)
+    {
+        char *end_ptr = NULL;
+        uint64_t value;
+
+        errno = 0;
+        value = strtoull(value_str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == value_str || '\0' != *end_ptr || value > AERON_FEC_MAX_GROUP_SIZE)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_FEC_KEY);
+            return -1;
+        }
+
+        *fec_group_size = (size_t)value;
+    }
+
+    return 0;
+}
+
+static int aeron_uri_parse_bounded_int32(
+    aeron_uri_t *uri, const char *key, int32_t min_value, int32_t max_value, int32_t *value)
+{
+    const char *value_str;
+
+    if ((value_str = aeron_uri_find_param_value(&uri->params.udp.additional_params, key)) != NULL)
+    {
+        char *end_ptr = NULL;
+        uint64_t parsed;
+
+        errno = 0;
+        parsed = strtoull(value_str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == value_str || '\0' != *end_ptr ||
+            parsed < (uint64_t)min_value || parsed > (uint64_t)max_value)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", key);
+            return -1;
+        }
+
+        *value = (int32_t)parsed;
+    }
+
+    return 0;
+}
+
+int aeron_uri_send_schedule(aeron_uri_t *uri, int32_t *send_priority, int32_t *send_weight)
+{
+    *send_priority = 0;
+    *send_weight = 1;
+
+    if (AERON_URI_UDP != uri->type)
+    {
+        return 0;
+    }
+
+    if (aeron_uri_parse_bounded_int32(
+        uri, AERON_UDP_CHANNEL_SEND_PRIORITY_KEY, 0, AERON_UDP_CHANNEL_SEND_PRIORITY_CLASSES - 1, send_priority) < 0)
+    {
+        return -1;
+    }
+
+    return aeron_uri_parse_bounded_int32(
+        uri, AERON_UDP_CHANNEL_SEND_WEIGHT_KEY, 1, AERON_UDP_CHANNEL_MAX_SEND_WEIGHT, send_weight);
+}
+
+int aeron_uri_resume_token(aeron_uri_t *uri, bool *has_resume_token, int64_t *resume_token)
+{
+    const char *value_str;
+
+    if (AERON_URI_UDP != uri->type)
+    {
+        return 0;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(
+        &uri->params.udp.additional_params, AERON_UDP_CHANNEL_RESUME_TOKEN_KEY)) != NULL)
+    {
+        char *end_ptr = NULL;
+        long long value;
+
+        errno = 0;
+        value = strtoll(value_str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == value_str || '\0' != *end_ptr)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_RESUME_TOKEN_KEY);
+            return -1;
+        }
+
+        *has_resume_token = true;
+        *resume_token = (int64_t)value;
+    }
+
+    return 0;
+}
+
+int aeron_uri_busy_poll(aeron_uri_t *uri, uint32_t *busy_poll_us, bool *prefer_busy_poll)
+{
+    const char *value_str;
+
+    if (AERON_URI_UDP != uri->type)
+    {
+        return 0;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(
+        &uri->params.udp.additional_params, AERON_UDP_CHANNEL_BUSY_POLL_KEY)) != NULL)
+    {
+        char *end_ptr = NULL;
+        uint64_t value;
+
+        errno = 0;
+        value = strtoull(value_str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == value_str || '\0' != *end_ptr || value > INT32_MAX)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_BUSY_POLL_KEY);
+            return -1;
+        }
+
+        *busy_poll_us = (uint32_t)value;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(
+        &uri->params.udp.additional_params, AERON_UDP_CHANNEL_PREFER_BUSY_POLL_KEY)) != NULL)
+    {
+        if (strcmp("true", value_str) == 0)
+        {
+            *prefer_busy_poll = true;
+        }
+        else if (strcmp("false", value_str) == 0)
+        {
+            *prefer_busy_poll = false;
+        }
+        else
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_PREFER_BUSY_POLL_KEY);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_uri_group_tag(aeron_uri_t *uri, bool *has_group_tag, int64_t *group_tag)
+{
+    const char *value_str;
+
+    if (AERON_URI_UDP != uri->type)
+    {
+        return 0;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(
+        &uri->params.udp.additional_params, AERON_UDP_CHANNEL_GROUP_TAG_KEY)) != NULL)
+    {
+        char *end_ptr = NULL;
+        long long value;
+
+        errno = 0;
+        value = strtoll(value_str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == value_str || '\0' != *end_ptr)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_GROUP_TAG_KEY);
+            return -1;
+        }
+
+        *has_group_tag = true;
+        *group_tag = (int64_t)value;
+    }
+
+    return 0;
+}
+
+int aeron_uri_channel_tag(aeron_uri_t *uri, bool *has_tag, int64_t *tag)
+{
+    const char *value_str;
+
+    if (AERON_URI_UDP != uri->type)
+    {
+        return 0;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(&uri->params.udp.additional_params, AERON_URI_TAGS_KEY)) != NULL)
+    {
+        char *end_ptr = NULL;
+        long long value;
+
+        errno = 0;
+        value = strtoll(value_str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == value_str || ('\0' != *end_ptr && ',' != *end_ptr))
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_URI_TAGS_KEY);
+            return -1;
+        }
+
+        *has_tag = true;
+        *tag = (int64_t)value;
+    }
+
+    return 0;
+}
+
+int aeron_uri_stream_range(aeron_uri_t *uri, int32_t stream_id, int32_t *stream_id_low, int32_t *stream_id_high)
+{
+    const char *value_str;
+
+    *stream_id_low = stream_id;
+    *stream_id_high = stream_id;
+
+    if (AERON_URI_UDP != uri->type)
+    {
+        return 0;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(
+        &uri->params.udp.additional_params, AERON_UDP_CHANNEL_STREAMS_KEY)) != NULL)
+    {
+        char *end_ptr = NULL;
+        long low, high;
+
+        errno = 0;
+        low = strtol(value_str, &end_ptr, 0);
+        if (0 != errno || end_ptr == value_str || '-' != *end_ptr || low < INT32_MIN || low > INT32_MAX)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_STREAMS_KEY);
+            return -1;
+        }
+
+        const char *high_str = end_ptr + 1;
+        high = strtol(high_str, &end_ptr, 0);
+        if (0 != errno || end_ptr == high_str || '\0' != *end_ptr || high < INT32_MIN || high > INT32_MAX)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_STREAMS_KEY);
+            return -1;
+        }
+
+        if (low > high || stream_id < low || stream_id > high)
+        {
+            aeron_set_err(
+                EINVAL, "%s=%s must be low-high and include streamId=%" PRId32,
+                AERON_UDP_CHANNEL_STREAMS_KEY, value_str, stream_id);
+            return -1;
+        }
+
+        *stream_id_low = (int32_t)low;
+        *stream_id_high = (int32_t)high;
+    }
+
+    return 0;
+}
+
+int aeron_uri_receive_timestamp(aeron_uri_t *uri, bool *receive_timestamp)
+{
+    const char *value_str;
+
+    if (AERON_URI_UDP != uri->type)
+    {
+        return 0;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(
+        &uri->params.udp.additional_params, AERON_UDP_CHANNEL_RECEIVE_TIMESTAMP_KEY)) != NULL)
+    {
+        if (strcmp("true", value_str) == 0)
+        {
+            *receive_timestamp = true;
+        }
+        else if (strcmp("false", value_str) == 0)
+        {
+            *receive_timestamp = false;
+        }
+        else
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_RECEIVE_TIMESTAMP_KEY);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_uri_durable(aeron_uri_t *uri, bool *is_durable)
+{
+    aeron_uri_params_t *uri_params =
+        (AERON_URI_IPC == uri->type) ? &uri->params.ipc.additional_params : &uri->params.udp.additional_params;
+    const char *value_str;
+
+    if ((value_str = aeron_uri_find_param_value(uri_params, AERON_URI_DURABLE_KEY)) != NULL)
+    {
+        if (strcmp("true", value_str) == 0)
+        {
+            *is_durable = true;
+        }
+        else if (strcmp("false", value_str) == 0)
+        {
+            *is_durable = false;
+        }
+        else
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_URI_DURABLE_KEY);
+            return -1;
+        }
+    }
+
+    /* the sender would have to be held to the durable position too, as it sends and retransmits from the term */
+    if (*is_durable && AERON_URI_IPC != uri->type)
+    {
+        aeron_set_err(EINVAL, "%s is only supported on IPC channels", AERON_URI_DURABLE_KEY);
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_uri_pmtu_discovery(aeron_uri_t *uri, bool *pmtu_discovery)
+{
+    const char *value_str;
+
+    if (AERON_URI_UDP != uri->type)
+    {
+        return 0;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(
+        &uri->params.udp.additional_params, AERON_UDP_CHANNEL_PMTU_DISCOVERY_KEY)) != NULL)
+    {
+        if (strcmp("true", value_str) == 0)
+        {
+            *pmtu_discovery = true;
+        }
+        else if (strcmp("false", value_str) == 0)
+        {
+            *pmtu_discovery = false;
+        }
+        else
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_PMTU_DISCOVERY_KEY);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_uri_checksum(aeron_uri_t *uri, bool *checksum)
+{
+    const char *value_str;
+
+    if (AERON_URI_UDP != uri->type)
+    {
+        return 0;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(
+        &uri->params.udp.additional_params, AERON_UDP_CHANNEL_CHECKSUM_KEY)) != NULL)
+    {
+        if (strcmp(AERON_UDP_CHANNEL_CHECKSUM_CRC32C_VALUE, value_str) == 0)
+        {
+            *checksum = true;
+        }
+        else if (strcmp(AERON_UDP_CHANNEL_CHECKSUM_NONE_VALUE, value_str) == 0)
+        {
+            *checksum = false;
+        }
+        else
+        {
+            aeron_set_err(
+                EINVAL,
+                "%s=(%s) must be %s or %s",
+                AERON_UDP_CHANNEL_CHECKSUM_KEY,
+                value_str,
+                AERON_UDP_CHANNEL_CHECKSUM_CRC32C_VALUE,
+                AERON_UDP_CHANNEL_CHECKSUM_NONE_VALUE);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int aeron_uri_parse_duration_ns(const char *value_str, int64_t *duration_ns)
+{
+    char *end_ptr = NULL;
+    uint64_t value;
+    uint64_t multiplier = 1;
+
+    errno = 0;
+    value = strtoull(value_str, &end_ptr, 0);
+
+    if (0 != errno || end_ptr == value_str)
+    {
+        return -1;
+    }
+
+    if (strcmp("us", end_ptr) == 0)
+    {
+        multiplier = 1000;
+    }
+    else if (strcmp("ms", end_ptr) == 0)
+    {
+        multiplier = 1000 * 1000;
+    }
+    else if ('\0' != *end_ptr && strcmp("ns", end_ptr) != 0)
+    {
+        return -1;
+    }
+
+    if (value > (uint64_t)AERON_UDP_CHANNEL_MAX_COALESCE_NS / multiplier)
+    {
+        return -1;
+    }
+
+    *duration_ns = (int64_t)(value * multiplier);
+
+    return 0;
+}
+
+int aeron_uri_coalesce(aeron_uri_t *uri, int64_t *coalesce_window_ns, size_t *coalesce_batch_length)
+{
+    const char *value_str;
+
+    *coalesce_window_ns = 0;
+    *coalesce_batch_length = 0;
+
+    if (AERON_URI_UDP != uri->type)
+    {
+        return 0;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(
+        &uri->params.udp.additional_params, AERON_UDP_CHANNEL_COALESCE_KEY)) != NULL)
+    {
+        if (aeron_uri_parse_duration_ns(value_str, coalesce_window_ns) < 0)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_COALESCE_KEY);
+            return -1;
+        }
+    }
+
+    if ((value_str = aeron_uri_find_param_value(
+        &uri->params.udp.additional_params, AERON_UDP_CHANNEL_COALESCE_BATCH_KEY)) != NULL)
+    {
+        char *end_ptr = NULL;
+        uint64_t value;
+
+        errno = 0;
+        value = strtoull(value_str, &end_ptr, 0);
+
+        if (0 != errno || end_ptr == value_str || '\0' != *end_ptr ||
+            0 == value || value > AERON_MAX_UDP_PAYLOAD_LENGTH)
+        {
+            aeron_set_err(EINVAL, "could not parse %s in URI", AERON_UDP_CHANNEL_COALESCE_BATCH_KEY);
+            return -1;
+        }
+
+        *coalesce_batch_length = (size_t)value;
+    }
+
+    return 0;
+}
+
+int aeron_uri_receiver_shards(aeron_uri_t *uri, size_t *receiver_shards)
+{
+    int32_t value = 1;
+
+    if (AERON_URI_UDP == uri->type && aeron_uri_parse_bounded_int32(
+        uri, AERON_UDP_CHANNEL_RECEIVER_SHARDS_KEY, 1, AERON_DRIVER_RECEIVER_MAX_COUNT, &value) < 0)
+    {
+        return -1;
+    }
+
+    *receiver_shards = (size_t)value;
+
+    return 0;
+}
+
 int aeron_udp_channel_subscription_params(
     aeron_uri_t *uri,
     aeron_udp_channel_subscription_params_t *params,
     aeron_driver_context_t *context)
 {
     params->reliable = true;
+    params->is_blocking_spy = true;
 
     const char *value_str;
 
@@ -453,6 +1022,15 @@ int aeron_udp_channel_subscription_params(
                 params->reliable = false;
             }
         }
+
+        if ((value_str = aeron_uri_find_param_value(
+            &uri->params.udp.additional_params, AERON_UDP_CHANNEL_SPY_BLOCKING_KEY)) != NULL)
+        {
+            if (strncmp("false", value_str, strlen("false")) == 0)
+            {
+                params->is_blocking_spy = false;
+            }
+        }
     }
 
     return 0;
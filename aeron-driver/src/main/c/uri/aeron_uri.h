@@ -48,23 +48,57 @@ aeron_uri_params_t;
 #define AERON_URI_TERM_OFFSET_KEY "term-offset"
 #define AERON_URI_TERM_LENGTH_KEY "term-length"
 #define AERON_URI_MTU_LENGTH_KEY "mtu"
+#define AERON_URI_NUMA_NODE_KEY "numa-node"
+#define AERON_URI_TAGS_KEY "tags"
+#define AERON_URI_DURABLE_KEY "durable"
 
 #define AERON_UDP_CHANNEL_RELIABLE_STREAM_KEY "reliable"
 
+#define AERON_UDP_CHANNEL_MEDIA_BINDINGS_KEY "media-bindings"
+#define AERON_UDP_CHANNEL_SENDER_AFFINITY_KEY "sender-affinity"
+#define AERON_UDP_CHANNEL_BUSY_POLL_KEY "busy-poll"
+#define AERON_UDP_CHANNEL_PREFER_BUSY_POLL_KEY "prefer-busy-poll"
+#define AERON_UDP_CHANNEL_FLOW_CONTROL_KEY "fc"
+#define AERON_UDP_CHANNEL_GROUP_TAG_KEY "gtag"
+#define AERON_UDP_CHANNEL_FEC_KEY "fec"
+#define AERON_UDP_CHANNEL_SEND_PRIORITY_KEY "send-priority"
+#define AERON_UDP_CHANNEL_SEND_WEIGHT_KEY "send-weight"
+#define AERON_UDP_CHANNEL_RECEIVE_TIMESTAMP_KEY "rcv-ts"
+#define AERON_UDP_CHANNEL_MULTIPATH_KEY "multipath"
+#define AERON_UDP_CHANNEL_MULTIPATH_DUPLICATE_VALUE "duplicate"
+#define AERON_UDP_CHANNEL_MULTIPATH_STRIPE_VALUE "stripe"
+#define AERON_UDP_CHANNEL_PMTU_DISCOVERY_KEY "pmtu-discovery"
+#define AERON_UDP_CHANNEL_RECEIVER_SHARDS_KEY "receiver-shards"
+#define AERON_UDP_CHANNEL_STREAMS_KEY "streams"
+#define AERON_UDP_CHANNEL_CHECKSUM_KEY "checksum"
+#define AERON_UDP_CHANNEL_CHECKSUM_CRC32C_VALUE "crc32c"
+#define AERON_UDP_CHANNEL_CHECKSUM_NONE_VALUE "none"
+#define AERON_UDP_CHANNEL_COALESCE_KEY "coalesce"
+#define AERON_UDP_CHANNEL_COALESCE_BATCH_KEY "coalesce-batch"
+
+#define AERON_UDP_CHANNEL_SEND_PRIORITY_CLASSES (4)
+#define AERON_UDP_CHANNEL_MAX_SEND_WEIGHT (64)
+#define AERON_UDP_CHANNEL_MAX_COALESCE_NS (1000 * 1000 * 1000LL)
+#define AERON_UDP_CHANNEL_SPY_BLOCKING_KEY "spy-blocking"
+#define AERON_UDP_CHANNEL_RESUME_TOKEN_KEY "resume-token"
+
 typedef struct aeron_uri_publication_params_stct
 {
     size_t term_length;
     size_t mtu_length;
+    bool has_term_length;
     int64_t initial_term_id;
     int64_t term_id;
     uint64_t term_offset;
     bool is_replay;
+    bool is_durable;
 }
 aeron_uri_publication_params_t;
 
 typedef struct aeron_udp_channel_subscription_params_stct
 {
     bool reliable;
+    bool is_blocking_spy;
 }
 aeron_udp_channel_subscription_params_t;
 
@@ -119,6 +153,91 @@ uint8_t aeron_uri_multicast_ttl(aeron_uri_t *uri);
 
 const char *aeron_uri_find_param_value(aeron_uri_params_t *uri_params, const char *key);
 
+const char *aeron_uri_media_bindings(aeron_uri_t *uri);
+int aeron_uri_sender_affinity(aeron_uri_t *uri, int32_t *sender_affinity);
+
+/*
+ * NUMA node a publication's log buffer should be bound to, -1 when the channel does not name one.
+ */
+int aeron_uri_numa_node(aeron_uri_t *uri, int32_t *numa_node);
+
+/*
+ * Number of datagrams a publication covers with each FEC frame, 0 when the channel does not enable FEC.
+ */
+int aeron_uri_fec_group_size(aeron_uri_t *uri, size_t *fec_group_size);
+
+/*
+ * Priority class, from 0 for bulk to AERON_UDP_CHANNEL_SEND_PRIORITY_CLASSES - 1, and weight within the class with
+ * which the sender schedules a publication. 0 and 1 when the channel does not name them.
+ */
+int aeron_uri_send_schedule(aeron_uri_t *uri, int32_t *send_priority, int32_t *send_weight);
+
+/*
+ * Token with which a restarted publisher reattaches to the publication it held, set with resume-token. has_resume_token
+ * and resume_token are only changed when the channel sets it.
+ */
+int aeron_uri_resume_token(aeron_uri_t *uri, bool *has_resume_token, int64_t *resume_token);
+
+/*
+ * busy_poll_us and prefer_busy_poll hold the defaults on entry and are only changed when the channel sets them.
+ */
+int aeron_uri_busy_poll(aeron_uri_t *uri, uint32_t *busy_poll_us, bool *prefer_busy_poll);
+
+/*
+ * Group tag a receiver puts on its status messages for tagged flow control. has_group_tag and group_tag hold the
+ * defaults on entry and are only changed when the channel sets gtag.
+ */
+int aeron_uri_group_tag(aeron_uri_t *uri, bool *has_group_tag, int64_t *group_tag);
+
+/*
+ * Channel tag, the first value of tags, with which other channels can name the endpoint of this one. has_tag and tag
+ * are only changed when the channel sets tags.
+ */
+int aeron_uri_channel_tag(aeron_uri_t *uri, bool *has_tag, int64_t *tag);
+
+/*
+ * Inclusive range of stream ids, given as low-high with streams, that a subscription channel receives. stream_id_low
+ * and stream_id_high are set to stream_id when the channel does not set streams, otherwise stream_id must be in range.
+ */
+int aeron_uri_stream_range(aeron_uri_t *uri, int32_t stream_id, int32_t *stream_id_low, int32_t *stream_id_high);
+
+/*
+ * Whether images of a subscription channel have the receive time stamped into the reserved value of each data frame.
+ * receive_timestamp holds the default on entry and is only changed when the channel sets rcv-ts.
+ */
+int aeron_uri_receive_timestamp(aeron_uri_t *uri, bool *receive_timestamp);
+
+/*
+ * Whether publications of a send channel discover the path MTU. pmtu_discovery holds the default on entry and is only
+ * changed when the channel sets pmtu-discovery.
+ */
+int aeron_uri_pmtu_discovery(aeron_uri_t *uri, bool *pmtu_discovery);
+
+/*
+ * Whether data frames of a channel carry a CRC32C checksum, set with checksum=crc32c on both the publication and the
+ * subscription channel, see aeron_frame_checksum.h. checksum is only changed when the channel sets checksum.
+ */
+int aeron_uri_checksum(aeron_uri_t *uri, bool *checksum);
+
+/*
+ * How long publications of a send channel hold back frames that fill less than a batch for more to be committed
+ * behind them, set with coalesce as a duration in ns, us or ms, a plain number being ns, and the batch to fill with
+ * coalesce-batch in bytes. coalesce_window_ns is 0, not coalescing, and coalesce_batch_length 0, a full datagram,
+ * when the channel does not set them.
+ */
+int aeron_uri_coalesce(aeron_uri_t *uri, int64_t *coalesce_window_ns, size_t *coalesce_batch_length);
+
+/*
+ * Whether a publication keeps its log on persistent storage, set with durable. Only IPC channels may be durable.
+ */
+int aeron_uri_durable(aeron_uri_t *uri, bool *is_durable);
+
+/*
+ * Number of receivers a unicast subscription channel spreads its sessions over, each with its own socket on the
+ * endpoint port, 1 when the channel does not set receiver-shards.
+ */
+int aeron_uri_receiver_shards(aeron_uri_t *uri, size_t *receiver_shards);
+
 typedef struct aeron_driver_context_stct aeron_driver_context_t;
 
 int aeron_uri_publication_params(
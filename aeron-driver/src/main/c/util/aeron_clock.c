@@ -0,0 +1,125 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include "aeronmd.h"
+#include "util/aeron_platform.h"
+#include "util/aeron_error.h"
+#include "util/aeron_clock.h"
+
+#if defined(AERON_CPU_X64) && defined(AERON_COMPILER_GCC)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define AERON_TSC_CLOCK_SUPPORTED
+
+__extension__ typedef unsigned __int128 aeron_tsc_clock_uint128_t;
+#endif
+
+#define AERON_TSC_CLOCK_SCALE_SHIFT (32)
+
+typedef struct aeron_tsc_clock_stct
+{
+    uint64_t base_tsc;
+    int64_t base_ns;
+    /* nanoseconds per tick in 32.32 fixed point */
+    uint64_t scale;
+}
+aeron_tsc_clock_t;
+
+static aeron_tsc_clock_t aeron_tsc_clock = { 0, 0, 0 };
+
+extern void aeron_clock_update_cached_nano_time(aeron_clock_cache_t *cache, int64_t nano_time);
+extern int64_t aeron_clock_cached_nano_time(aeron_clock_cache_t *cache);
+
+#if defined(AERON_TSC_CLOCK_SUPPORTED)
+
+static bool aeron_tsc_clock_is_invariant()
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007)
+    {
+        return false;
+    }
+
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+
+    return 0 != (edx & (1u << 8u));
+}
+
+int aeron_tsc_clock_calibrate(int64_t calibration_ns)
+{
+    if (!aeron_tsc_clock_is_invariant())
+    {
+        aeron_set_err(ENOTSUP, "%s", "TSC clock: CPU does not have an invariant TSC");
+        return -1;
+    }
+
+    const int64_t start_ns = aeron_nanoclock();
+    const uint64_t start_tsc = __rdtsc();
+    int64_t end_ns;
+
+    do
+    {
+        end_ns = aeron_nanoclock();
+    }
+    while (end_ns - start_ns < calibration_ns);
+
+    const uint64_t end_tsc = __rdtsc();
+
+    if (end_tsc <= start_tsc)
+    {
+        aeron_set_err(EINVAL, "%s", "TSC clock: TSC did not advance during calibration");
+        return -1;
+    }
+
+    const aeron_tsc_clock_uint128_t elapsed_ns = (aeron_tsc_clock_uint128_t)(end_ns - start_ns);
+
+    aeron_tsc_clock.scale = (uint64_t)((elapsed_ns << AERON_TSC_CLOCK_SCALE_SHIFT) / (end_tsc - start_tsc));
+    aeron_tsc_clock.base_tsc = end_tsc;
+    aeron_tsc_clock.base_ns = end_ns;
+
+    return 0;
+}
+
+int64_t aeron_tsc_nanoclock()
+{
+    const uint64_t ticks = __rdtsc() - aeron_tsc_clock.base_tsc;
+
+    return aeron_tsc_clock.base_ns +
+        (int64_t)(((aeron_tsc_clock_uint128_t)ticks * aeron_tsc_clock.scale) >> AERON_TSC_CLOCK_SCALE_SHIFT);
+}
+
+#else
+
+int aeron_tsc_clock_calibrate(int64_t calibration_ns)
+{
+    aeron_set_err(ENOTSUP, "%s", "TSC clock: not supported on this platform");
+    return -1;
+}
+
+int64_t aeron_tsc_nanoclock()
+{
+    return aeron_nanoclock();
+}
+
+#endif
+
+bool aeron_tsc_clock_is_calibrated()
+{
+    return 0 != aeron_tsc_clock.scale;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_CLOCK_H
+#define AERON_AERON_CLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "concurrent/aeron_atomic.h"
+
+#define AERON_TSC_CLOCK_CALIBRATION_NS (100 * 1000 * 1000L)
+
+/*
+ * Time taken once per duty cycle by an agent so the work it does in the cycle can read it without a clock call.
+ */
+typedef struct aeron_clock_cache_stct
+{
+    volatile int64_t cached_nano_time;
+}
+aeron_clock_cache_t;
+
+inline void aeron_clock_update_cached_nano_time(aeron_clock_cache_t *cache, int64_t nano_time)
+{
+    AERON_PUT_ORDERED(cache->cached_nano_time, nano_time);
+}
+
+inline int64_t aeron_clock_cached_nano_time(aeron_clock_cache_t *cache)
+{
+    int64_t nano_time;
+    AERON_GET_VOLATILE(nano_time, cache->cached_nano_time);
+    return nano_time;
+}
+
+/*
+ * Calibrate the TSC against CLOCK_MONOTONIC_RAW by spinning for calibration_ns. Fails with ENOTSUP when the CPU does
+ * not report an invariant TSC, as the rate then changes with power states and the count may differ between cores.
+ * Calibrating again re-anchors the clock, which may then step.
+ */
+int aeron_tsc_clock_calibrate(int64_t calibration_ns);
+
+bool aeron_tsc_clock_is_calibrated();
+
+/*
+ * Nanoseconds on the same timeline as aeron_nanoclock from a read of the TSC, which avoids the cost of a clock_gettime
+ * call, notably on virtual machines without a fast vDSO clock. Only valid once calibrated.
+ */
+int64_t aeron_tsc_nanoclock();
+
+#endif //AERON_AERON_CLOCK_H
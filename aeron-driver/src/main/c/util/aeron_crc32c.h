@@ -0,0 +1,30 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_CRC32C_H
+#define AERON_AERON_CRC32C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * CRC32C (Castagnoli) of length bytes of buffer, carried on from crc so a checksum can be taken over several buffers,
+ * starting from 0. Uses the CRC32 instruction of SSE4.2 when the CPU has it, or of ARMv8 when the driver is built for
+ * a CPU with the CRC extension, and a table otherwise.
+ */
+uint32_t aeron_crc32c(uint32_t crc, const uint8_t *buffer, size_t length);
+
+#endif //AERON_AERON_CRC32C_H
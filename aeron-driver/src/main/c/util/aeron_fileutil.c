@@ -32,8 +32,6 @@
 #include "util/aeron_fileutil.h"
 #include "aeron_error.h"
 
-#define AERON_BLOCK_SIZE (4 * 1024)
-
 inline static int aeron_mmap(aeron_mapped_file_t *mapping, int fd, off_t offset)
 {
     mapping->addr = mmap(NULL, mapping->length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset);
@@ -53,6 +51,17 @@ int aeron_unmap(aeron_mapped_file_t *mapped_file)
     return result;
 }
 
+inline static void aeron_advise_huge_pages(void *addr, size_t length, size_t page_size)
+{
+#if defined(MADV_HUGEPAGE)
+    if (page_size >= AERON_HUGE_PAGE_MIN_SIZE)
+    {
+        /* best effort, hugetlbfs mappings are huge regardless and other file systems may not support the advice */
+        madvise(addr, length, MADV_HUGEPAGE);
+    }
+#endif
+}
+
 inline static void aeron_touch_pages(uint8_t *base, size_t length, size_t page_size)
 {
     for (size_t i = 0; i < length; i += page_size)
@@ -93,7 +102,7 @@ int aeron_fallocate(int fd, off_t length, bool fill_with_zeroes)
     return 0;
 }
 
-int aeron_map_new_file(aeron_mapped_file_t *mapped_file, const char *path, bool fill_with_zeroes)
+int aeron_map_new_file(aeron_mapped_file_t *mapped_file, const char *path, bool fill_with_zeroes, size_t page_size)
 {
     int fd, result = -1;
 
@@ -106,9 +115,11 @@ int aeron_map_new_file(aeron_mapped_file_t *mapped_file, const char *path, bool
 
             if (MAP_FAILED != file_mmap)
             {
+                aeron_advise_huge_pages(file_mmap, mapped_file->length, page_size);
+
                 if (fill_with_zeroes)
                 {
-                    aeron_touch_pages(file_mmap, mapped_file->length, AERON_BLOCK_SIZE);
+                    aeron_touch_pages(file_mmap, mapped_file->length, page_size);
                 }
 
                 mapped_file->addr = file_mmap;
@@ -248,6 +259,21 @@ int aeron_publication_image_location(
         aeron_dir, channel_canonical_form, session_id, stream_id, correlation_id);
 }
 
+static void aeron_raw_log_set_buffers(aeron_mapped_raw_log_t *mapped_raw_log, uint64_t term_length, uint64_t log_length)
+{
+    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        mapped_raw_log->term_buffers[i].addr = (uint8_t *)mapped_raw_log->mapped_file.addr + (i * term_length);
+        mapped_raw_log->term_buffers[i].length = term_length;
+    }
+
+    mapped_raw_log->log_meta_data.addr =
+        (uint8_t *)mapped_raw_log->mapped_file.addr + (log_length - AERON_LOGBUFFER_META_DATA_LENGTH);
+    mapped_raw_log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
+
+    mapped_raw_log->term_length = term_length;
+}
+
 int aeron_map_raw_log(
     aeron_mapped_raw_log_t *mapped_raw_log,
     const char *path,
@@ -276,24 +302,14 @@ int aeron_map_raw_log(
                 return -1;
             }
 
+            aeron_advise_huge_pages(mapped_raw_log->mapped_file.addr, log_length, page_size);
+
             if (!use_sparse_files)
             {
                 aeron_touch_pages(mapped_raw_log->mapped_file.addr, log_length, page_size);
             }
 
-            for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
-            {
-                mapped_raw_log->term_buffers[i].addr =
-                    (uint8_t *) mapped_raw_log->mapped_file.addr + (i * term_length);
-                mapped_raw_log->term_buffers[i].length = term_length;
-            }
-
-            mapped_raw_log->log_meta_data.addr =
-                (uint8_t *) mapped_raw_log->mapped_file.addr +
-                    (log_length - AERON_LOGBUFFER_META_DATA_LENGTH);
-            mapped_raw_log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
-
-            mapped_raw_log->term_length = term_length;
+            aeron_raw_log_set_buffers(mapped_raw_log, term_length, log_length);
 
             result = 0;
         }
@@ -315,6 +331,65 @@ int aeron_map_raw_log(
     return result;
 }
 
+void aeron_mapped_raw_log_prefault(aeron_mapped_raw_log_t *mapped_raw_log, size_t page_size)
+{
+    volatile uint8_t *base = (volatile uint8_t *)mapped_raw_log->mapped_file.addr;
+    const size_t length = mapped_raw_log->mapped_file.length;
+
+#if defined(MADV_POPULATE_WRITE)
+    if (0 == madvise(mapped_raw_log->mapped_file.addr, length, MADV_POPULATE_WRITE))
+    {
+        return;
+    }
+#endif
+
+    /* rewrite what is there so a log already in use is left as it is */
+    for (size_t i = 0; i < length; i += page_size)
+    {
+        base[i] = base[i];
+    }
+}
+
+int aeron_mapped_raw_log_lock(aeron_mapped_raw_log_t *mapped_raw_log)
+{
+    if (mlock(mapped_raw_log->mapped_file.addr, mapped_raw_log->mapped_file.length) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "mlock of raw log: %s", strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_map_existing_raw_log(
+    aeron_mapped_raw_log_t *mapped_raw_log, const char *path, uint64_t term_length, uint64_t page_size)
+{
+    const uint64_t log_length = aeron_logbuffer_compute_log_length(term_length, page_size);
+
+    mapped_raw_log->mapped_file.addr = NULL;
+
+    if (aeron_map_existing_file(&mapped_raw_log->mapped_file, path) < 0)
+    {
+        return -1;
+    }
+
+    if (log_length != mapped_raw_log->mapped_file.length)
+    {
+        aeron_unmap(&mapped_raw_log->mapped_file);
+        mapped_raw_log->mapped_file.addr = NULL;
+        aeron_set_err(EINVAL, "%s is not a log of term length %" PRIu64, path, term_length);
+        return -1;
+    }
+
+    aeron_advise_huge_pages(mapped_raw_log->mapped_file.addr, log_length, page_size);
+    memset(mapped_raw_log->mapped_file.addr, 0, log_length);
+    aeron_raw_log_set_buffers(mapped_raw_log, term_length, log_length);
+
+    return 0;
+}
+
 int aeron_map_raw_log_close(aeron_mapped_raw_log_t *mapped_raw_log)
 {
     int result = 0;
@@ -331,3 +406,55 @@ int aeron_map_raw_log_close(aeron_mapped_raw_log_t *mapped_raw_log)
 
     return result;
 }
+
+size_t aeron_mapped_buffer_clean(uint8_t *addr, size_t length, size_t page_size, bool release_pages)
+{
+#if defined(MADV_REMOVE)
+    if (release_pages && length >= page_size)
+    {
+        uint8_t *pages_begin = (uint8_t *)(((uintptr_t)addr + (page_size - 1)) & ~((uintptr_t)page_size - 1));
+        uint8_t *pages_end = (uint8_t *)(((uintptr_t)addr + length) & ~((uintptr_t)page_size - 1));
+
+        /* punches a hole in the backing file so the pages read back as zero, tmpfs and most file systems support it */
+        if (pages_end > pages_begin && 0 == madvise(pages_begin, (size_t)(pages_end - pages_begin), MADV_REMOVE))
+        {
+            memset(addr, 0, (size_t)(pages_begin - addr));
+            memset(pages_end, 0, (size_t)((addr + length) - pages_end));
+            return (size_t)(pages_end - pages_begin);
+        }
+    }
+#endif
+
+    memset(addr, 0, length);
+    return 0;
+}
+
+#define AERON_MINCORE_VECTOR_LENGTH (4096)
+
+size_t aeron_mapped_buffer_resident_length(void *addr, size_t length)
+{
+    const size_t page_size = (size_t)getpagesize();
+    unsigned char residency[AERON_MINCORE_VECTOR_LENGTH];
+    size_t resident_length = 0;
+
+    /* in chunks so the vector stays on the stack however long the log */
+    for (size_t offset = 0; offset < length; offset += AERON_MINCORE_VECTOR_LENGTH * page_size)
+    {
+        const size_t remaining = length - offset;
+        const size_t chunk_length =
+            remaining < AERON_MINCORE_VECTOR_LENGTH * page_size ? remaining : AERON_MINCORE_VECTOR_LENGTH * page_size;
+        const size_t num_pages = (chunk_length + page_size - 1) / page_size;
+
+        if (mincore((uint8_t *)addr + offset, chunk_length, residency) < 0)
+        {
+            return 0;
+        }
+
+        for (size_t i = 0; i < num_pages; i++)
+        {
+            resident_length += (residency[i] & 1) ? page_size : 0;
+        }
+    }
+
+    return resident_length;
+}
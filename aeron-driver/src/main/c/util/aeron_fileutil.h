@@ -36,7 +36,14 @@ typedef struct aeron_mapped_buffer_stct
 }
 aeron_mapped_buffer_t;
 
-int aeron_map_new_file(aeron_mapped_file_t *mapped_file, const char *path, bool fill_with_zeroes);
+/*
+ * A page size of at least this is taken to mean the file belongs on huge pages: mappings are advised with
+ * MADV_HUGEPAGE before they are touched, which tmpfs honours when mounted with huge=advise, and lengths are aligned
+ * so the files can live on hugetlbfs.
+ */
+#define AERON_HUGE_PAGE_MIN_SIZE (2 * 1024 * 1024)
+
+int aeron_map_new_file(aeron_mapped_file_t *mapped_file, const char *path, bool fill_with_zeroes, size_t page_size);
 int aeron_map_existing_file(aeron_mapped_file_t *mapped_file, const char *path);
 int aeron_unmap(aeron_mapped_file_t *mapped_file);
 
@@ -96,4 +103,36 @@ int aeron_map_raw_log(
     uint64_t page_size);
 int aeron_map_raw_log_close(aeron_mapped_raw_log_t *mapped_raw_log);
 
+/*
+ * Map a log left by an earlier run so it can be used again without creating and allocating a new file. Fails with
+ * EINVAL when the file is not the length of a log with term_length and page_size. The whole log is zeroed, as term
+ * scans rely on unwritten frames having a zero length.
+ */
+int aeron_map_existing_raw_log(
+    aeron_mapped_raw_log_t *mapped_raw_log, const char *path, uint64_t term_length, uint64_t page_size);
+
+/*
+ * Fault in every page of a mapped log so first writes and reads do not page fault, which also allocates the pages of
+ * a sparse log. Uses MADV_POPULATE_WRITE where available and touches each page otherwise, leaving contents unchanged.
+ */
+void aeron_mapped_raw_log_prefault(aeron_mapped_raw_log_t *mapped_raw_log, size_t page_size);
+
+/*
+ * Lock the pages of a mapped log in memory so they are never paged out. Needs RLIMIT_MEMLOCK or CAP_IPC_LOCK to cover
+ * the log length, the lock is released when the log is unmapped.
+ */
+int aeron_mapped_raw_log_lock(aeron_mapped_raw_log_t *mapped_raw_log);
+
+/*
+ * Zero a range of a mapped log. When release_pages is set the whole pages in the range are released back to the file
+ * system rather than written, which suits sparse logs that are faulted in on demand anyway. Returns the number of
+ * bytes released.
+ */
+size_t aeron_mapped_buffer_clean(uint8_t *addr, size_t length, size_t page_size, bool release_pages);
+
+/*
+ * Bytes of a mapping that are resident in memory, by mincore, or 0 where that is not supported.
+ */
+size_t aeron_mapped_buffer_resident_length(void *addr, size_t length);
+
 #endif //AERON_AERON_FILEUTIL_H
@@ -27,6 +27,7 @@
 #include <regex.h>
 #include <ifaddrs.h>
 #include <net/if.h>
+#include <pthread.h>
 #include "util/aeron_netutil.h"
 #include "util/aeron_error.h"
 
@@ -39,6 +40,55 @@ void aeron_uri_hostname_resolver(aeron_uri_hostname_resolver_func_t func, void *
     aeron_uri_hostname_resolver_clientd = clientd;
 }
 
+#if defined(Darwin)
+#define AERON_IPV4_REGCOMP_CFLAGS (REG_EXTENDED)
+#else
+#define AERON_IPV4_REGCOMP_CFLAGS (REG_EXTENDED)
+#endif
+
+typedef struct aeron_netutil_regexs_stct
+{
+    regex_t ipv4;
+    regex_t ipv6;
+    int result;
+    char error[AERON_MAX_PATH];
+}
+aeron_netutil_regexs_t;
+
+/* compiled once for all threads, as the name resolver agent parses channels alongside the conductor */
+static aeron_netutil_regexs_t aeron_address_regexs;
+static aeron_netutil_regexs_t aeron_interface_regexs;
+static pthread_once_t aeron_address_regexs_once = PTHREAD_ONCE_INIT;
+static pthread_once_t aeron_interface_regexs_once = PTHREAD_ONCE_INIT;
+
+static void aeron_netutil_regexs_compile(aeron_netutil_regexs_t *regexs, const char *ipv4, const char *ipv6)
+{
+    if ((regexs->result = regcomp(&regexs->ipv4, ipv4, AERON_IPV4_REGCOMP_CFLAGS)) != 0)
+    {
+        regerror(regexs->result, &regexs->ipv4, regexs->error, sizeof(regexs->error));
+    }
+    else if ((regexs->result = regcomp(&regexs->ipv6, ipv6, AERON_IPV4_REGCOMP_CFLAGS)) != 0)
+    {
+        regerror(regexs->result, &regexs->ipv6, regexs->error, sizeof(regexs->error));
+    }
+}
+
+static void aeron_address_regexs_init(void)
+{
+    aeron_netutil_regexs_compile(
+        &aeron_address_regexs,
+        "([^:]+)(:([0-9]+))?",
+        "\\[([0-9A-Fa-f:]+)(%([a-zA-Z0-9_.~-]+))?\\](:([0-9]+))?");
+}
+
+static void aeron_interface_regexs_init(void)
+{
+    aeron_netutil_regexs_compile(
+        &aeron_interface_regexs,
+        "([^:/]+)(:([0-9]+))?(/([0-9]+))?",
+        "\\[([0-9A-Fa-f:]+)(%([a-zA-Z0-9_.~-]+))?\\](:([0-9]+))?(/([0-9]+))?");
+}
+
 int aeron_ip_addr_resolver(const char *host, struct sockaddr_storage *sockaddr, int family_hint)
 {
     struct addrinfo hints;
@@ -164,46 +214,18 @@ int aeron_host_and_port_resolver(
     return result;
 }
 
-#if defined(Darwin)
-#define AERON_IPV4_REGCOMP_CFLAGS (REG_EXTENDED)
-#else
-#define AERON_IPV4_REGCOMP_CFLAGS (REG_EXTENDED)
-#endif
-
 int aeron_host_and_port_parse_and_resolve(const char *address_str, struct sockaddr_storage *sockaddr)
 {
-    static bool regexs_compiled = false;
-    static regex_t ipv4_regex, ipv6_regex;
     regmatch_t matches[8];
 
-    if (!regexs_compiled)
+    pthread_once(&aeron_address_regexs_once, aeron_address_regexs_init);
+    if (0 != aeron_address_regexs.result)
     {
-        const char *ipv4 = "([^:]+)(:([0-9]+))?";
-        const char *ipv6 = "\\[([0-9A-Fa-f:]+)(%([a-zA-Z0-9_.~-]+))?\\](:([0-9]+))?";
-
-        int regcomp_result;
-        if ((regcomp_result = regcomp(&ipv4_regex, ipv4, AERON_IPV4_REGCOMP_CFLAGS)) != 0)
-        {
-            char message[AERON_MAX_PATH];
-
-            regerror(regcomp_result, &ipv4_regex, message, sizeof(message));
-            aeron_set_err(EINVAL, "could not regcomp IPv4 regex: %s", message);
-            return -1;
-        }
-
-        if ((regcomp_result = regcomp(&ipv6_regex, ipv6, AERON_IPV4_REGCOMP_CFLAGS)) != 0)
-        {
-            char message[AERON_MAX_PATH];
-
-            regerror(regcomp_result, &ipv6_regex, message, sizeof(message));
-            aeron_set_err(EINVAL, "could not regcomp IPv6 regex: %s", message);
-            return -1;
-        }
-
-        regexs_compiled = true;
+        aeron_set_err(EINVAL, "could not regcomp address regex: %s", aeron_address_regexs.error);
+        return -1;
     }
 
-    int regexec_result = regexec(&ipv6_regex, address_str, 8, matches, 0);
+    int regexec_result = regexec(&aeron_address_regexs.ipv6, address_str, 8, matches, 0);
     if (0 == regexec_result)
     {
         char host[AERON_MAX_PATH], port[AERON_MAX_PATH];
@@ -221,12 +243,12 @@ int aeron_host_and_port_parse_and_resolve(const char *address_str, struct sockad
     {
         char message[AERON_MAX_PATH];
 
-        regerror(regexec_result, &ipv4_regex, message, sizeof(message));
+        regerror(regexec_result, &aeron_address_regexs.ipv4, message, sizeof(message));
         aeron_set_err(EINVAL, "could not regexec IPv6 regex: %s", message);
         return -1;
     }
 
-    regexec_result = regexec(&ipv4_regex, address_str, 3, matches, 0);
+    regexec_result = regexec(&aeron_address_regexs.ipv4, address_str, 3, matches, 0);
     if (0 == regexec_result)
     {
         char host[AERON_MAX_PATH], port[AERON_MAX_PATH];
@@ -244,7 +266,7 @@ int aeron_host_and_port_parse_and_resolve(const char *address_str, struct sockad
     {
         char message[AERON_MAX_PATH];
 
-        regerror(regexec_result, &ipv4_regex, message, sizeof(message));
+        regerror(regexec_result, &aeron_address_regexs.ipv4, message, sizeof(message));
         aeron_set_err(EINVAL, "could not regexec IPv4 regex: %s", message);
         return -1;
     }
@@ -315,38 +337,16 @@ int aeron_host_port_prefixlen_resolver(
 
 int aeron_interface_parse_and_resolve(const char *interface_str, struct sockaddr_storage *sockaddr, size_t *prefixlen)
 {
-    static bool regexs_compiled = false;
-    static regex_t ipv4_regex, ipv6_regex;
     regmatch_t matches[10];
 
-    if (!regexs_compiled)
+    pthread_once(&aeron_interface_regexs_once, aeron_interface_regexs_init);
+    if (0 != aeron_interface_regexs.result)
     {
-        const char *ipv4 = "([^:/]+)(:([0-9]+))?(/([0-9]+))?";
-        const char *ipv6 = "\\[([0-9A-Fa-f:]+)(%([a-zA-Z0-9_.~-]+))?\\](:([0-9]+))?(/([0-9]+))?";
-
-        int regcomp_result;
-        if ((regcomp_result = regcomp(&ipv4_regex, ipv4, AERON_IPV4_REGCOMP_CFLAGS)) != 0)
-        {
-            char message[AERON_MAX_PATH];
-
-            regerror(regcomp_result, &ipv4_regex, message, sizeof(message));
-            aeron_set_err(EINVAL, "could not regcomp IPv4 regex: %s", message);
-            return -1;
-        }
-
-        if ((regcomp_result = regcomp(&ipv6_regex, ipv6, AERON_IPV4_REGCOMP_CFLAGS)) != 0)
-        {
-            char message[AERON_MAX_PATH];
-
-            regerror(regcomp_result, &ipv6_regex, message, sizeof(message));
-            aeron_set_err(EINVAL, "could not regcomp IPv6 regex: %s", message);
-            return -1;
-        }
-
-        regexs_compiled = true;
+        aeron_set_err(EINVAL, "could not regcomp interface regex: %s", aeron_interface_regexs.error);
+        return -1;
     }
 
-    int regexec_result = regexec(&ipv6_regex, interface_str, 10, matches, 0);
+    int regexec_result = regexec(&aeron_interface_regexs.ipv6, interface_str, 10, matches, 0);
     if (0 == regexec_result)
     {
         char host_str[AERON_MAX_PATH], port_str[AERON_MAX_PATH], prefixlen_str[AERON_MAX_PATH];
@@ -367,12 +367,12 @@ int aeron_interface_parse_and_resolve(const char *interface_str, struct sockaddr
     {
         char message[AERON_MAX_PATH];
 
-        regerror(regexec_result, &ipv4_regex, message, sizeof(message));
+        regerror(regexec_result, &aeron_interface_regexs.ipv4, message, sizeof(message));
         aeron_set_err(EINVAL, "could not regexec IPv6 regex: %s", message);
         return -1;
     }
 
-    regexec_result = regexec(&ipv4_regex, interface_str, 5, matches, 0);
+    regexec_result = regexec(&aeron_interface_regexs.ipv4, interface_str, 5, matches, 0);
     if (0 == regexec_result)
     {
         char host_str[AERON_MAX_PATH], port_str[AERON_MAX_PATH], prefixlen_str[AERON_MAX_PATH];
@@ -393,7 +393,7 @@ int aeron_interface_parse_and_resolve(const char *interface_str, struct sockaddr
     {
         char message[AERON_MAX_PATH];
 
-        regerror(regexec_result, &ipv4_regex, message, sizeof(message));
+        regerror(regexec_result, &aeron_interface_regexs.ipv4, message, sizeof(message));
         aeron_set_err(EINVAL, "could not regexec IPv4 regex: %s", message);
         return -1;
     }
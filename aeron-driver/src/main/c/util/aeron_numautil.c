@@ -0,0 +1,106 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <unistd.h>
+#include "util/aeron_numautil.h"
+#include "util/aeron_error.h"
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#if !defined(MPOL_BIND)
+#define MPOL_BIND (2)
+#endif
+
+#if !defined(MPOL_MF_MOVE)
+#define MPOL_MF_MOVE (1 << 1)
+#endif
+
+int32_t aeron_numa_node_of_cpu(int32_t cpu)
+{
+    char path[64];
+    DIR *dir = NULL;
+    struct dirent *entry = NULL;
+    int32_t node = -1;
+
+    if (cpu < 0)
+    {
+        return -1;
+    }
+
+    snprintf(path, sizeof(path) - 1, "/sys/devices/system/cpu/cpu%d", cpu);
+
+    if ((dir = opendir(path)) == NULL)
+    {
+        return -1;
+    }
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        int value;
+
+        if (strncmp(entry->d_name, "node", 4) == 0 && sscanf(entry->d_name + 4, "%d", &value) == 1)
+        {
+            node = (int32_t)value;
+            break;
+        }
+    }
+
+    closedir(dir);
+
+    return node;
+}
+
+int aeron_numa_bind(void *addr, size_t length, int32_t node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    const size_t bits_per_word = sizeof(unsigned long) * 8;
+    unsigned long node_mask[AERON_NUMA_MAX_NODES / (sizeof(unsigned long) * 8)];
+
+    if (node < 0 || node >= AERON_NUMA_MAX_NODES)
+    {
+        aeron_set_err(EINVAL, "invalid NUMA node: %d", node);
+        return -1;
+    }
+
+    memset(node_mask, 0, sizeof(node_mask));
+    node_mask[(size_t)node / bits_per_word] = 1UL << ((size_t)node % bits_per_word);
+
+    /* the kernel drops the last bit of maxnode, so pass one more than the mask holds */
+    if (syscall(SYS_mbind, addr, length, MPOL_BIND, node_mask, AERON_NUMA_MAX_NODES + 1, MPOL_MF_MOVE) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "mbind to NUMA node %d: %s", node, strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "%s", "NUMA binding not supported");
+    return -1;
+#endif
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_NUMAUTIL_H
+#define AERON_AERON_NUMAUTIL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define AERON_NUMA_MAX_NODES (1024)
+
+/*
+ * NUMA node the given CPU belongs to, or -1 when the CPU is negative or its node can not be determined.
+ */
+int32_t aeron_numa_node_of_cpu(int32_t cpu);
+
+/*
+ * Bind the pages of a mapping to a NUMA node, migrating any pages already touched by this process.
+ */
+int aeron_numa_bind(void *addr, size_t length, int32_t node);
+
+#endif //AERON_AERON_NUMAUTIL_H
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_PROBES_H
+#define AERON_AERON_PROBES_H
+
+/*
+ * Static tracepoints for bpftrace, perf and systemtap, in the aeron provider. Built in with the AERON_PROBES CMake
+ * option, which needs sys/sdt.h. Each probe is then a nop in the code until a tracer attaches, and without the option
+ * the probes and their arguments compile away. Arguments are integers so reading them costs nothing.
+ *
+ *     bpftrace -e 'usdt:./aeronmd:aeron:image_loss_detected { @[arg1] = sum(arg4); }'
+ */
+#if defined(AERON_PROBES)
+
+#include <sys/sdt.h>
+
+#define AERON_PROBE2(name, a1, a2) DTRACE_PROBE2(aeron, name, a1, a2)
+#define AERON_PROBE4(name, a1, a2, a3, a4) DTRACE_PROBE4(aeron, name, a1, a2, a3, a4)
+#define AERON_PROBE5(name, a1, a2, a3, a4, a5) DTRACE_PROBE5(aeron, name, a1, a2, a3, a4, a5)
+
+#else
+
+#define AERON_PROBE2(name, a1, a2)
+#define AERON_PROBE4(name, a1, a2, a3, a4)
+#define AERON_PROBE5(name, a1, a2, a3, a4, a5)
+
+#endif
+
+#endif //AERON_AERON_PROBES_H
@@ -0,0 +1,227 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+extern "C"
+{
+#include "aeron_driver.h"
+#include "aeron_agent.h"
+}
+
+#define MAX_SPINS (2)
+#define MAX_YIELDS (3)
+#define MIN_PARK_PERIOD_NS (1)
+#define MAX_PARK_PERIOD_NS (8)
+
+class AgentTest : public testing::Test
+{
+public:
+    AgentTest()
+    {
+        setenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS_ENV_VAR, std::to_string(MAX_SPINS).c_str(), 1);
+        setenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS_ENV_VAR, std::to_string(MAX_YIELDS).c_str(), 1);
+        setenv(AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD_ENV_VAR, std::to_string(MIN_PARK_PERIOD_NS).c_str(), 1);
+        setenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD_ENV_VAR, std::to_string(MAX_PARK_PERIOD_NS).c_str(), 1);
+
+        m_idle = aeron_idle_strategy_load("backoff", &m_state);
+        if (NULL == m_idle)
+        {
+            throw std::runtime_error("could not load backoff idle strategy");
+        }
+
+        m_backoff = (aeron_idle_strategy_backoff_state_t *)m_state;
+    }
+
+    ~AgentTest() override
+    {
+        aeron_free(m_state);
+
+        unsetenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS_ENV_VAR);
+        unsetenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS_ENV_VAR);
+        unsetenv(AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD_ENV_VAR);
+        unsetenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD_ENV_VAR);
+    }
+
+protected:
+    void idleUntilParking()
+    {
+        for (int i = 0; i < 1 + MAX_SPINS + MAX_YIELDS + 1; i++)
+        {
+            m_idle(m_state, 0);
+        }
+
+        ASSERT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_PARKING);
+    }
+
+    aeron_idle_strategy_func_t m_idle = NULL;
+    void *m_state = NULL;
+    aeron_idle_strategy_backoff_state_t *m_backoff = NULL;
+};
+
+TEST_F(AgentTest, shouldLoadBackoffConfigFromEnvironment)
+{
+    EXPECT_EQ(m_backoff->max_spins, (uint64_t)MAX_SPINS);
+    EXPECT_EQ(m_backoff->max_yields, (uint64_t)MAX_YIELDS);
+    EXPECT_EQ(m_backoff->min_park_period_ns, (uint64_t)MIN_PARK_PERIOD_NS);
+    EXPECT_EQ(m_backoff->max_park_period_ns, (uint64_t)MAX_PARK_PERIOD_NS);
+    EXPECT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_NOT_IDLE);
+}
+
+TEST_F(AgentTest, shouldSpinThenYieldThenPark)
+{
+    m_idle(m_state, 0);
+    EXPECT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_SPINNING);
+    EXPECT_EQ(m_backoff->spins, 1u);
+
+    for (int i = 0; i < MAX_SPINS - 1; i++)
+    {
+        m_idle(m_state, 0);
+        EXPECT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_SPINNING);
+    }
+
+    m_idle(m_state, 0);
+    EXPECT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_YIELDING);
+    EXPECT_EQ(m_backoff->yields, 0u);
+
+    for (int i = 0; i < MAX_YIELDS; i++)
+    {
+        m_idle(m_state, 0);
+        EXPECT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_YIELDING);
+    }
+
+    m_idle(m_state, 0);
+    EXPECT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_PARKING);
+    EXPECT_EQ(m_backoff->park_period_ns, (uint64_t)MIN_PARK_PERIOD_NS);
+}
+
+TEST_F(AgentTest, shouldDoubleParkPeriodUpToMax)
+{
+    idleUntilParking();
+
+    uint64_t expected = MIN_PARK_PERIOD_NS;
+    for (int i = 0; i < 6; i++)
+    {
+        m_idle(m_state, 0);
+        expected = expected * 2 > MAX_PARK_PERIOD_NS ? MAX_PARK_PERIOD_NS : expected * 2;
+
+        EXPECT_EQ(m_backoff->park_period_ns, expected);
+        EXPECT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_PARKING);
+    }
+
+    EXPECT_EQ(m_backoff->park_period_ns, (uint64_t)MAX_PARK_PERIOD_NS);
+}
+
+TEST_F(AgentTest, shouldResetWhenWorkDone)
+{
+    idleUntilParking();
+    m_idle(m_state, 0);
+    ASSERT_GT(m_backoff->park_period_ns, (uint64_t)MIN_PARK_PERIOD_NS);
+
+    m_idle(m_state, 1);
+
+    EXPECT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_NOT_IDLE);
+    EXPECT_EQ(m_backoff->spins, 0u);
+    EXPECT_EQ(m_backoff->yields, 0u);
+    EXPECT_EQ(m_backoff->park_period_ns, (uint64_t)MIN_PARK_PERIOD_NS);
+
+    m_idle(m_state, 0);
+    EXPECT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_SPINNING);
+}
+
+TEST_F(AgentTest, shouldCloneBackoffStateAsOwnResetCopy)
+{
+    idleUntilParking();
+
+    void *cloned = NULL;
+    ASSERT_EQ(aeron_idle_strategy_clone_state(m_idle, m_state, &cloned), 0) << aeron_errmsg();
+    ASSERT_NE(cloned, m_state);
+
+    aeron_idle_strategy_backoff_state_t *clone = (aeron_idle_strategy_backoff_state_t *)cloned;
+    EXPECT_EQ(clone->max_spins, m_backoff->max_spins);
+    EXPECT_EQ(clone->max_yields, m_backoff->max_yields);
+    EXPECT_EQ(clone->min_park_period_ns, m_backoff->min_park_period_ns);
+    EXPECT_EQ(clone->max_park_period_ns, m_backoff->max_park_period_ns);
+    EXPECT_EQ(clone->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_NOT_IDLE);
+    EXPECT_EQ(clone->spins, 0u);
+
+    m_idle(cloned, 0);
+    EXPECT_EQ(clone->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_SPINNING);
+    EXPECT_EQ(m_backoff->state, AERON_IDLE_STRATEGY_BACKOFF_STATE_PARKING);
+
+    aeron_free(cloned);
+}
+
+TEST_F(AgentTest, shouldShareStateOfStatelessStrategies)
+{
+    void *state = NULL;
+    aeron_idle_strategy_func_t idle = aeron_idle_strategy_load("yielding", &state);
+    ASSERT_NE(idle, (aeron_idle_strategy_func_t)NULL);
+
+    void *cloned = &state;
+    ASSERT_EQ(aeron_idle_strategy_clone_state(idle, state, &cloned), 0);
+    EXPECT_EQ(cloned, state);
+}
+
+TEST_F(AgentTest, shouldGiveEachExtraSenderAndReceiverItsOwnBackoffState)
+{
+    char dir_template[] = "/tmp/aeron-agent-test-XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), (char *)NULL);
+    const std::string dir = std::string(dir_template) + "/driver";
+
+    setenv(AERON_SENDER_IDLE_STRATEGY_ENV_VAR, "backoff", 1);
+    setenv(AERON_RECEIVER_IDLE_STRATEGY_ENV_VAR, "backoff", 1);
+
+    aeron_driver_context_t *context = NULL;
+    const int context_result = aeron_driver_context_init(&context);
+
+    unsetenv(AERON_SENDER_IDLE_STRATEGY_ENV_VAR);
+    unsetenv(AERON_RECEIVER_IDLE_STRATEGY_ENV_VAR);
+    ASSERT_EQ(context_result, 0) << aeron_errmsg();
+
+    snprintf(context->aeron_dir, AERON_MAX_PATH - 1, "%s", dir.c_str());
+    context->sender_count = 2;
+    context->receiver_count = 2;
+
+    aeron_driver_t *driver = NULL;
+    ASSERT_EQ(aeron_driver_init(&driver, context), 0) << aeron_errmsg();
+
+    const int runner_offsets[] = { AERON_AGENT_RUNNER_SENDER, AERON_AGENT_RUNNER_RECEIVER };
+    void *context_states[] = { context->sender_idle_strategy_state, context->receiver_idle_strategy_state };
+
+    for (int i = 0; i < 2; i++)
+    {
+        aeron_agent_runner_t *first = &driver->runners[runner_offsets[i]];
+        aeron_agent_runner_t *second = &driver->runners[runner_offsets[i] + 1];
+
+        EXPECT_EQ(first->idle_strategy_state, context_states[i]);
+        EXPECT_NE(second->idle_strategy_state, context_states[i]);
+        EXPECT_NE(second->idle_strategy_state, (void *)NULL);
+        EXPECT_EQ(
+            ((aeron_idle_strategy_backoff_state_t *)second->idle_strategy_state)->max_spins,
+            ((aeron_idle_strategy_backoff_state_t *)context_states[i])->max_spins);
+    }
+
+    EXPECT_EQ(aeron_driver_close(driver), 0);
+    EXPECT_EQ(aeron_driver_context_close(context), 0);
+
+    aeron_dir_delete(dir.c_str());
+    rmdir(dir_template);
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+extern "C"
+{
+#include "aeron_driver_context.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "archive/aeron_archive_catalog.h"
+#include "archive/aeron_archive_recording_writer.h"
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define SEGMENT_LENGTH (TERM_LENGTH * 2)
+
+class ArchiveCatalogTest : public testing::Test
+{
+public:
+    ArchiveCatalogTest()
+    {
+        char dir_template[] = "/tmp/aeron-archive-catalog-test-XXXXXX";
+
+        if (NULL == mkdtemp(dir_template))
+        {
+            throw std::runtime_error("could not create temp dir");
+        }
+
+        m_dir = dir_template;
+    }
+
+    ~ArchiveCatalogTest() override
+    {
+        aeron_archive_catalog_close(&m_catalog);
+        aeron_dir_delete(m_dir.c_str());
+    }
+
+    std::vector<uint8_t> readSegment(int64_t recording_id, int32_t segment_index)
+    {
+        char path[AERON_MAX_PATH];
+
+        aeron_archive_segment_file_name(path, sizeof(path), m_dir.c_str(), recording_id, segment_index);
+        std::ifstream in(path, std::ios::binary);
+
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    static std::vector<uint8_t> frames(size_t count, uint8_t fill)
+    {
+        const size_t frame_length = 64;
+        std::vector<uint8_t> buffer(count * frame_length, fill);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            auto *frame = reinterpret_cast<aeron_frame_header_t *>(buffer.data() + (i * frame_length));
+            frame->frame_length = static_cast<int32_t>(frame_length);
+            frame->type = AERON_HDR_TYPE_DATA;
+        }
+
+        return buffer;
+    }
+
+protected:
+    std::string m_dir;
+    aeron_archive_catalog_t m_catalog = {};
+};
+
+TEST_F(ArchiveCatalogTest, shouldAddRecordingsWithJavaLayout)
+{
+    ASSERT_EQ(aeron_archive_catalog_open(&m_catalog, m_dir.c_str(), 16, 0), 0) << aeron_errmsg();
+    EXPECT_EQ(sizeof(aeron_archive_recording_descriptor_header_t), 32u);
+    EXPECT_EQ(sizeof(aeron_archive_recording_descriptor_t), 80u);
+
+    EXPECT_EQ(aeron_archive_catalog_add_recording(
+        &m_catalog, 0, 1, 7, SEGMENT_LENGTH, TERM_LENGTH, 1408, 11, 101, "aeron:ipc", "aeron:ipc", "aeron:ipc"), 0);
+    EXPECT_EQ(aeron_archive_catalog_add_recording(
+        &m_catalog, 64, 2, 8, SEGMENT_LENGTH, TERM_LENGTH, 1408, 12, 102, "aeron:udp", "aeron:udp", ""), 1);
+    EXPECT_EQ(aeron_archive_catalog_recording_count(&m_catalog), 2);
+
+    auto *header = reinterpret_cast<aeron_archive_catalog_header_t *>(m_catalog.mapped_file.addr);
+    EXPECT_EQ(header->entry_length, AERON_ARCHIVE_CATALOG_RECORD_LENGTH);
+
+    aeron_archive_recording_descriptor_t *descriptor = aeron_archive_catalog_descriptor(&m_catalog, 1);
+    ASSERT_NE(descriptor, nullptr);
+    EXPECT_EQ(descriptor->recording_id, 1);
+    EXPECT_EQ(descriptor->start_position, 64);
+    EXPECT_EQ(descriptor->stop_position, AERON_ARCHIVE_NULL_POSITION);
+    EXPECT_EQ(descriptor->stream_id, 102);
+    EXPECT_EQ(aeron_archive_catalog_descriptor(&m_catalog, 2), nullptr);
+
+    int32_t length = 0;
+    const char *channel = aeron_archive_catalog_descriptor_string(&m_catalog, 1, 1, &length);
+    EXPECT_EQ(std::string(channel, static_cast<size_t>(length)), "aeron:udp");
+    aeron_archive_catalog_descriptor_string(&m_catalog, 1, 2, &length);
+    EXPECT_EQ(length, 0);
+
+    aeron_archive_catalog_recording_stopped(&m_catalog, 0, 4096, 3);
+    EXPECT_EQ(aeron_archive_catalog_descriptor(&m_catalog, 0)->stop_position, 4096);
+}
+
+TEST_F(ArchiveCatalogTest, shouldRejectRecordingWhenFull)
+{
+    ASSERT_EQ(aeron_archive_catalog_open(&m_catalog, m_dir.c_str(), 1, 0), 0) << aeron_errmsg();
+
+    EXPECT_EQ(aeron_archive_catalog_add_recording(
+        &m_catalog, 0, 1, 0, SEGMENT_LENGTH, TERM_LENGTH, 1408, 1, 1, "aeron:ipc", "aeron:ipc", ""), 0);
+    EXPECT_EQ(aeron_archive_catalog_add_recording(
+        &m_catalog, 0, 1, 0, SEGMENT_LENGTH, TERM_LENGTH, 1408, 2, 1, "aeron:ipc", "aeron:ipc", ""), -1);
+}
+
+TEST_F(ArchiveCatalogTest, shouldWriteBlocksAcrossSegments)
+{
+    const int64_t start_position = TERM_LENGTH + 1024;
+    aeron_archive_recording_writer_t writer;
+
+    ASSERT_EQ(aeron_archive_recording_writer_init(
+        &writer, m_dir.c_str(), 0, start_position, TERM_LENGTH, SEGMENT_LENGTH, 0), 0) << aeron_errmsg();
+
+    std::vector<uint8_t> first = frames((SEGMENT_LENGTH - 1024) / 64, 1);
+    std::vector<uint8_t> second = frames(4, 2);
+
+    ASSERT_EQ(aeron_archive_recording_writer_on_block(&writer, first.data(), first.size()), 0);
+    EXPECT_EQ(aeron_archive_recording_writer_position(&writer), start_position);
+    ASSERT_EQ(aeron_archive_recording_writer_on_block(&writer, second.data(), second.size()), 0);
+    EXPECT_EQ(aeron_archive_recording_writer_position(&writer), start_position + (int64_t)first.size());
+    ASSERT_EQ(aeron_archive_recording_writer_close(&writer), 0) << aeron_errmsg();
+    EXPECT_EQ(
+        aeron_archive_recording_writer_position(&writer), start_position + (int64_t)(first.size() + second.size()));
+
+    std::vector<uint8_t> segment0 = readSegment(0, 0);
+    std::vector<uint8_t> segment1 = readSegment(0, 1);
+
+    ASSERT_EQ(segment0.size(), static_cast<size_t>(SEGMENT_LENGTH));
+    ASSERT_EQ(segment1.size(), static_cast<size_t>(SEGMENT_LENGTH));
+    EXPECT_TRUE(std::equal(first.begin(), first.end(), segment0.begin() + 1024));
+    EXPECT_TRUE(std::equal(second.begin(), second.end(), segment1.begin()));
+    EXPECT_EQ(segment1[second.size()], 0);
+}
+
+TEST_F(ArchiveCatalogTest, shouldRecoverStopPositionOnReopen)
+{
+    ASSERT_EQ(aeron_archive_catalog_open(&m_catalog, m_dir.c_str(), 4, 0), 0) << aeron_errmsg();
+
+    const int64_t start_position = 128;
+    int64_t recording_id = aeron_archive_catalog_add_recording(
+        &m_catalog, start_position, 1, 0, TERM_LENGTH, TERM_LENGTH, 1408, 1, 1, "aeron:ipc", "aeron:ipc", "");
+    ASSERT_EQ(recording_id, 0);
+
+    aeron_archive_recording_writer_t writer;
+    ASSERT_EQ(aeron_archive_recording_writer_init(
+        &writer, m_dir.c_str(), recording_id, start_position, TERM_LENGTH, TERM_LENGTH, 0), 0);
+
+    std::vector<uint8_t> first = frames(TERM_LENGTH / 64 - 2, 1);
+    std::vector<uint8_t> second = frames(3, 2);
+    ASSERT_EQ(aeron_archive_recording_writer_on_block(&writer, first.data(), first.size()), 0);
+    ASSERT_EQ(aeron_archive_recording_writer_on_block(&writer, second.data(), second.size()), 0);
+    ASSERT_EQ(aeron_archive_recording_writer_close(&writer), 0) << aeron_errmsg();
+
+    aeron_archive_catalog_close(&m_catalog);
+    ASSERT_EQ(aeron_archive_catalog_open(&m_catalog, m_dir.c_str(), 4, 0), 0) << aeron_errmsg();
+
+    EXPECT_EQ(aeron_archive_catalog_recording_count(&m_catalog), 1);
+    EXPECT_EQ(
+        aeron_archive_catalog_descriptor(&m_catalog, recording_id)->stop_position,
+        start_position + (int64_t)(first.size() + second.size()));
+}
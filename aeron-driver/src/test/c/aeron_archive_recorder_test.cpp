@@ -0,0 +1,429 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <functional>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+extern "C"
+{
+#include "aeron_driver.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "client/aeronc.h"
+#include "archive/aeron_archive_recorder.h"
+}
+
+#define STREAM_ID (101)
+#define REPLAY_STREAM_ID (202)
+#define IPC_CHANNEL "aeron:ipc"
+#define TERM_LENGTH (64 * 1024)
+#define MESSAGE_LENGTH (1000)
+#define ALIGNED_FRAME_LENGTH (1056)
+
+static void recording_fragment_handler(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    auto *fragments = static_cast<std::vector<std::pair<int64_t, std::vector<uint8_t>>> *>(clientd);
+
+    fragments->push_back({ aeron_header_position(header), std::vector<uint8_t>(buffer, buffer + length) });
+}
+
+class ArchiveRecorderTest : public testing::Test
+{
+public:
+    ArchiveRecorderTest()
+    {
+        char dir_template[] = "/tmp/aeron-archive-recorder-test-XXXXXX";
+
+        if (NULL == mkdtemp(dir_template))
+        {
+            throw std::runtime_error("could not create temp dir");
+        }
+
+        m_base_dir = dir_template;
+        m_dir = m_base_dir + "/aeron";
+        m_archive_dir = m_base_dir + "/archive";
+
+        setenv(AERON_DIR_ENV_VAR, m_dir.c_str(), 1);
+        setenv(AERON_IPC_TERM_BUFFER_LENGTH_ENV_VAR, std::to_string(TERM_LENGTH).c_str(), 1);
+
+        if (aeron_driver_context_init(&m_driver_context) < 0 ||
+            aeron_driver_init(&m_driver, m_driver_context) < 0 ||
+            aeron_driver_invoker_start(m_driver) < 0)
+        {
+            throw std::runtime_error("could not start driver");
+        }
+
+        if (aeron_context_init(&m_context) < 0 || aeron_init(&m_aeron, m_context) < 0 ||
+            aeron_context_init(&m_recorder_client_context) < 0 ||
+            aeron_init(&m_recorder_client, m_recorder_client_context) < 0)
+        {
+            throw std::runtime_error(std::string("could not connect client: ") + aeron_errmsg());
+        }
+
+        aeron_archive_recorder_context_init(&m_recorder_context);
+        m_recorder_context.archive_dir = m_archive_dir.c_str();
+        m_recorder_context.segment_file_length = TERM_LENGTH;
+        m_recorder_context.recordings = NULL;
+    }
+
+    ~ArchiveRecorderTest() override
+    {
+        if (NULL != m_recorder)
+        {
+            aeron_archive_recorder_on_close(m_recorder);
+        }
+        else if (NULL != m_recorder_client)
+        {
+            aeron_close(m_recorder_client);
+        }
+
+        aeron_close(m_aeron);
+        aeron_context_close(m_recorder_client_context);
+        aeron_context_close(m_context);
+        aeron_driver_close(m_driver);
+        aeron_driver_context_close(m_driver_context);
+        aeron_dir_delete(m_archive_dir.c_str());
+        aeron_dir_delete(m_dir.c_str());
+        rmdir(m_base_dir.c_str());
+        unsetenv(AERON_DIR_ENV_VAR);
+        unsetenv(AERON_IPC_TERM_BUFFER_LENGTH_ENV_VAR);
+    }
+
+    void doWork()
+    {
+        aeron_driver_invoker_do_work(m_driver);
+        ASSERT_GE(aeron_main_do_work(m_aeron), 0) << aeron_errmsg();
+        if (NULL != m_recorder)
+        {
+            ASSERT_GE(aeron_archive_recorder_do_work(m_recorder), 0) << aeron_errmsg();
+        }
+    }
+
+    bool doWorkUntil(const std::function<bool()>& condition)
+    {
+        for (int i = 0; i < 100000; i++)
+        {
+            if (condition())
+            {
+                return true;
+            }
+
+            doWork();
+        }
+
+        return false;
+    }
+
+    aeron_publication_t *addPublication(const char *channel)
+    {
+        aeron_async_add_publication_t *async = NULL;
+        aeron_publication_t *publication = NULL;
+
+        if (aeron_async_add_publication(&async, m_aeron, channel, STREAM_ID) < 0)
+        {
+            return NULL;
+        }
+
+        doWorkUntil([&]() { return 0 != aeron_async_add_publication_poll(&publication, async); });
+
+        return publication;
+    }
+
+    std::vector<uint8_t> readRecording(int64_t recording_id)
+    {
+        std::vector<uint8_t> recording;
+
+        for (int32_t segment_index = 0; ; segment_index++)
+        {
+            char path[AERON_MAX_PATH];
+
+            aeron_archive_segment_file_name(path, sizeof(path), m_archive_dir.c_str(), recording_id, segment_index);
+            std::ifstream in(path, std::ios::binary);
+            if (!in)
+            {
+                return recording;
+            }
+
+            recording.insert(recording.end(), std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+    }
+
+    /*
+     * Record messages of MESSAGE_LENGTH filled with their index, then stop the recorder so the recording is stopped.
+     */
+    int64_t recordMessages(aeron_publication_t *publication, int count, int64_t *stop_position)
+    {
+        std::vector<uint8_t> message(MESSAGE_LENGTH);
+        int64_t position = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            message.assign(message.size(), (uint8_t)i);
+            doWorkUntil(
+                [&]() { return (position = aeron_publication_offer(publication, message.data(), message.size())) > 0; });
+        }
+
+        aeron_archive_recording_session_t *session = m_recorder->sessions.array[0];
+        doWorkUntil([&]() { return aeron_archive_recording_writer_position(&session->writer) == position; });
+
+        const int64_t recording_id = session->recording_id;
+        aeron_archive_recorder_on_close(m_recorder);
+        m_recorder = NULL;
+        m_recorder_client = NULL;
+        *stop_position = position;
+
+        return recording_id;
+    }
+
+    int initRecorder()
+    {
+        return aeron_archive_recorder_init(
+            &m_recorder,
+            &m_recorder_context,
+            m_recorder_client,
+            &m_driver->conductor.error_log,
+            m_driver->conductor.errors_counter);
+    }
+
+    static void countObservations(
+        int32_t observation_count,
+        int64_t first_observation_timestamp,
+        int64_t last_observation_timestamp,
+        const char *error,
+        size_t error_length,
+        void *clientd)
+    {
+        *static_cast<int32_t *>(clientd) += observation_count;
+    }
+
+    int32_t errorObservations()
+    {
+        int32_t observations = 0;
+
+        aeron_error_log_read(
+            m_driver_context->error_buffer,
+            m_driver_context->error_buffer_length,
+            countObservations,
+            &observations,
+            0);
+
+        return observations;
+    }
+
+    int restartRecorder()
+    {
+        aeron_context_close(m_recorder_client_context);
+        m_recorder_client_context = NULL;
+
+        if (aeron_context_init(&m_recorder_client_context) < 0 ||
+            aeron_init(&m_recorder_client, m_recorder_client_context) < 0)
+        {
+            return -1;
+        }
+
+        return initRecorder();
+    }
+
+    aeron_subscription_t *addSubscription(const char *channel, int32_t stream_id)
+    {
+        aeron_async_add_subscription_t *async = NULL;
+        aeron_subscription_t *subscription = NULL;
+
+        if (aeron_async_add_subscription(&async, m_aeron, channel, stream_id, NULL, NULL, NULL, NULL) < 0)
+        {
+            return NULL;
+        }
+
+        doWorkUntil([&]() { return 0 != aeron_async_add_subscription_poll(&subscription, async); });
+
+        return subscription;
+    }
+
+protected:
+    std::string m_base_dir;
+    std::string m_dir;
+    std::string m_archive_dir;
+    aeron_driver_context_t *m_driver_context = NULL;
+    aeron_driver_t *m_driver = NULL;
+    aeron_context_t *m_context = NULL;
+    aeron_t *m_aeron = NULL;
+    aeron_context_t *m_recorder_client_context = NULL;
+    aeron_t *m_recorder_client = NULL;
+    aeron_archive_recorder_context_t m_recorder_context = {};
+    aeron_archive_recorder_t *m_recorder = NULL;
+};
+
+TEST_F(ArchiveRecorderTest, shouldRecordIpcPublicationToSegmentFiles)
+{
+    ASSERT_EQ(initRecorder(), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_archive_recorder_add_recording(m_recorder, IPC_CHANNEL, STREAM_ID), 0) << aeron_errmsg();
+
+    aeron_publication_t *publication = addPublication(IPC_CHANNEL);
+    ASSERT_NE(publication, nullptr) << aeron_errmsg();
+    ASSERT_TRUE(doWorkUntil([&]() { return 1 == m_recorder->sessions.length; }));
+
+    int64_t position = 0;
+    const int64_t recording_id = recordMessages(publication, 100, &position);
+    EXPECT_GT(position, TERM_LENGTH);
+
+    aeron_archive_catalog_t catalog = {};
+    ASSERT_EQ(aeron_archive_catalog_open(&catalog, m_archive_dir.c_str(), 1, 0), 0) << aeron_errmsg();
+    aeron_archive_recording_descriptor_t *descriptor = aeron_archive_catalog_descriptor(&catalog, recording_id);
+    ASSERT_NE(descriptor, nullptr);
+    EXPECT_EQ(descriptor->start_position, 0);
+    EXPECT_EQ(descriptor->stop_position, position);
+    EXPECT_EQ(descriptor->stream_id, STREAM_ID);
+    EXPECT_EQ(descriptor->session_id, aeron_publication_session_id(publication));
+    aeron_archive_catalog_close(&catalog);
+
+    std::vector<uint8_t> segment = readRecording(recording_id);
+    size_t offset = 0;
+    int frames = 0;
+    while (offset < segment.size())
+    {
+        auto *frame = reinterpret_cast<aeron_data_header_t *>(segment.data() + offset);
+        if (frame->frame_header.frame_length <= 0)
+        {
+            break;
+        }
+
+        if (AERON_HDR_TYPE_DATA == frame->frame_header.type)
+        {
+            EXPECT_EQ(frame->stream_id, STREAM_ID);
+            EXPECT_EQ(frame->term_offset, (int32_t)(offset & (TERM_LENGTH - 1)));
+            EXPECT_EQ(segment[offset + AERON_DATA_HEADER_LENGTH], (uint8_t)frames);
+            frames++;
+        }
+
+        offset += AERON_ALIGN(frame->frame_header.frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+    EXPECT_EQ(frames, 100);
+    EXPECT_EQ(aeron_publication_close(publication), 0);
+}
+
+TEST_F(ArchiveRecorderTest, shouldReplayRecordingAtRecordedPositions)
+{
+    ASSERT_EQ(initRecorder(), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_archive_recorder_add_recording(m_recorder, IPC_CHANNEL, STREAM_ID), 0) << aeron_errmsg();
+
+    aeron_publication_t *publication = addPublication(IPC_CHANNEL);
+    ASSERT_NE(publication, nullptr) << aeron_errmsg();
+    ASSERT_TRUE(doWorkUntil([&]() { return 1 == m_recorder->sessions.length; }));
+
+    int64_t stop_position = 0;
+    const int64_t recording_id = recordMessages(publication, 100, &stop_position);
+    ASSERT_EQ(restartRecorder(), 0) << aeron_errmsg();
+
+    aeron_subscription_t *subscription = addSubscription(IPC_CHANNEL, REPLAY_STREAM_ID);
+    ASSERT_NE(subscription, nullptr) << aeron_errmsg();
+
+    std::vector<std::pair<int64_t, std::vector<uint8_t>>> fragments;
+
+    ASSERT_EQ(aeron_archive_recorder_start_replay(
+        m_recorder, recording_id, AERON_ARCHIVE_NULL_POSITION, AERON_ARCHIVE_NULL_LENGTH, IPC_CHANNEL, REPLAY_STREAM_ID),
+        0) << aeron_errmsg();
+    ASSERT_TRUE(doWorkUntil(
+        [&]()
+        {
+            aeron_subscription_poll(subscription, recording_fragment_handler, &fragments, 10);
+            return fragments.size() >= 100;
+        }));
+
+    ASSERT_EQ(fragments.size(), 100u);
+    for (size_t i = 0; i < fragments.size(); i++)
+    {
+        EXPECT_EQ(fragments[i].first, (int64_t)((i + 1) * ALIGNED_FRAME_LENGTH + (i >= 62 ? 64 : 0)));
+        EXPECT_EQ(fragments[i].second, std::vector<uint8_t>(MESSAGE_LENGTH, (uint8_t)i));
+    }
+    EXPECT_EQ(fragments.back().first, stop_position);
+    ASSERT_TRUE(doWorkUntil([&]() { return 0 == m_recorder->replays.length; }));
+
+    const int64_t position = 70 * ALIGNED_FRAME_LENGTH + 64;
+    fragments.clear();
+
+    ASSERT_EQ(aeron_archive_recorder_start_replay(
+        m_recorder, recording_id, position, 10 * ALIGNED_FRAME_LENGTH, IPC_CHANNEL, REPLAY_STREAM_ID),
+        0) << aeron_errmsg();
+    ASSERT_TRUE(doWorkUntil(
+        [&]()
+        {
+            aeron_subscription_poll(subscription, recording_fragment_handler, &fragments, 10);
+            return fragments.size() >= 10 && 0 == m_recorder->replays.length;
+        }));
+
+    ASSERT_EQ(fragments.size(), 10u);
+    EXPECT_EQ(fragments.front().first, position + ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(fragments.front().second, std::vector<uint8_t>(MESSAGE_LENGTH, 70));
+    EXPECT_EQ(fragments.back().second, std::vector<uint8_t>(MESSAGE_LENGTH, 79));
+
+    EXPECT_EQ(aeron_subscription_close(subscription), 0);
+    EXPECT_EQ(aeron_publication_close(publication), 0);
+}
+
+TEST_F(ArchiveRecorderTest, shouldReportImageThatCannotBeRecordedOnceWithoutRetrying)
+{
+    m_recorder_context.max_catalog_entries = 1;
+    ASSERT_EQ(initRecorder(), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_archive_recorder_add_recording(m_recorder, IPC_CHANNEL, STREAM_ID), 0) << aeron_errmsg();
+
+    aeron_publication_t *publication = addPublication(IPC_CHANNEL);
+    ASSERT_NE(publication, nullptr) << aeron_errmsg();
+    ASSERT_TRUE(doWorkUntil([&]() { return 1 == m_recorder->sessions.length; }));
+    ASSERT_EQ(*m_driver->conductor.errors_counter, 0);
+
+    aeron_async_add_exclusive_publication_t *async = NULL;
+    aeron_publication_t *exclusive_publication = NULL;
+    ASSERT_EQ(aeron_async_add_exclusive_publication(&async, m_aeron, IPC_CHANNEL, STREAM_ID), 0) << aeron_errmsg();
+    ASSERT_TRUE(doWorkUntil(
+        [&]() { return 0 != aeron_async_add_exclusive_publication_poll(&exclusive_publication, async); }));
+    ASSERT_NE(exclusive_publication, nullptr) << aeron_errmsg();
+
+    ASSERT_TRUE(doWorkUntil([&]() { return 0 != *m_driver->conductor.errors_counter; }));
+    for (int i = 0; i < 1000; i++)
+    {
+        doWork();
+    }
+
+    EXPECT_EQ(*m_driver->conductor.errors_counter, 1);
+    EXPECT_EQ(errorObservations(), 1);
+    EXPECT_EQ(m_recorder->sessions.length, 1u);
+
+    EXPECT_EQ(aeron_publication_close(exclusive_publication), 0);
+    EXPECT_EQ(aeron_publication_close(publication), 0);
+}
+
+TEST_F(ArchiveRecorderTest, shouldRejectReplayOfUnknownRecording)
+{
+    ASSERT_EQ(initRecorder(), 0) << aeron_errmsg();
+
+    EXPECT_EQ(aeron_archive_recorder_start_replay(
+        m_recorder, 7, AERON_ARCHIVE_NULL_POSITION, AERON_ARCHIVE_NULL_LENGTH, IPC_CHANNEL, REPLAY_STREAM_ID), -1);
+}
+
+TEST_F(ArchiveRecorderTest, shouldRejectInvalidRecordingsSpec)
+{
+    m_recorder_context.recordings = "101aeron:ipc";
+
+    EXPECT_EQ(initRecorder(), -1);
+    EXPECT_EQ(m_recorder, nullptr);
+}
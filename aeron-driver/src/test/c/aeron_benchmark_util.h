@@ -0,0 +1,95 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_BENCHMARK_UTIL_H
+#define AERON_BENCHMARK_UTIL_H
+
+#include <atomic>
+#include <thread>
+#include <functional>
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+/*
+ * Contended benchmarks run the consumer on core 0 and producer thread i on core i + 1, wrapping on machines with fewer
+ * cores, so the numbers are comparable between runs on the same machine.
+ */
+inline void aeron_benchmark_pin_to_core(int core)
+{
+    const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t cpu_set;
+
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cores > 0 ? core % (int)cores : 0, &cpu_set);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+}
+
+inline int aeron_benchmark_producer_core(int thread_index)
+{
+    return thread_index + 1;
+}
+
+/* A producer finding the buffer full gives up its core, or a consumer sharing the core would never drain it. */
+inline void aeron_benchmark_backoff()
+{
+    std::this_thread::yield();
+}
+
+/* Drains on its own pinned thread until stopped, for the benchmarks measuring producers. */
+class BenchmarkConsumer
+{
+public:
+    explicit BenchmarkConsumer(std::function<void()> poll) : m_poll(std::move(poll)), m_running(false)
+    {
+    }
+
+    ~BenchmarkConsumer()
+    {
+        stop();
+    }
+
+    void start()
+    {
+        m_running = true;
+        m_thread = std::thread(
+            [this]()
+            {
+                aeron_benchmark_pin_to_core(0);
+                while (m_running.load(std::memory_order_acquire))
+                {
+                    m_poll();
+                }
+            });
+    }
+
+    void stop()
+    {
+        if (m_thread.joinable())
+        {
+            m_running = false;
+            m_thread.join();
+        }
+    }
+
+private:
+    std::function<void()> m_poll;
+    std::atomic<bool> m_running;
+    std::thread m_thread;
+};
+
+#endif //AERON_BENCHMARK_UTIL_H
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <concurrent/aeron_broadcast_transmitter.h>
+#include <concurrent/aeron_broadcast_receiver.h>
+}
+
+#define CAPACITY (1024)
+#define BUFFER_SZ (CAPACITY + AERON_BROADCAST_BUFFER_TRAILER_LENGTH)
+#define MSG_TYPE_ID (101)
+
+typedef std::array<std::uint8_t, BUFFER_SZ> buffer_t;
+
+struct received_message_t
+{
+    int32_t msg_type_id;
+    std::vector<std::uint8_t> data;
+};
+
+static void recording_handler(int32_t msg_type_id, uint8_t *buffer, size_t length, void *clientd)
+{
+    auto *messages = static_cast<std::vector<received_message_t> *>(clientd);
+
+    messages->push_back({ msg_type_id, std::vector<std::uint8_t>(buffer, buffer + length) });
+}
+
+class BroadcastReceiverTest : public testing::Test
+{
+public:
+
+    BroadcastReceiverTest()
+    {
+        m_buffer.fill(0);
+        m_srcBuffer.fill(0);
+    }
+
+    ~BroadcastReceiverTest() override
+    {
+        aeron_broadcast_receiver_close(&m_receiver);
+    }
+
+protected:
+    buffer_t m_buffer;
+    buffer_t m_srcBuffer;
+    aeron_broadcast_transmitter_t m_transmitter;
+    aeron_broadcast_receiver_t m_receiver = {};
+    std::vector<received_message_t> m_messages;
+};
+
+TEST_F(BroadcastReceiverTest, shouldErrorForCapacityNotPowerOfTwo)
+{
+    ASSERT_EQ(aeron_broadcast_receiver_init(&m_receiver, m_buffer.data(), m_buffer.size() - 1), -1);
+}
+
+TEST_F(BroadcastReceiverTest, shouldNotReceiveFromEmptyBuffer)
+{
+    ASSERT_EQ(aeron_broadcast_receiver_init(&m_receiver, m_buffer.data(), m_buffer.size()), 0);
+
+    EXPECT_FALSE(aeron_broadcast_receiver_receive_next(&m_receiver));
+    EXPECT_EQ(aeron_broadcast_receiver_receive(&m_receiver, recording_handler, &m_messages), 0);
+}
+
+TEST_F(BroadcastReceiverTest, shouldReceiveTransmittedMessagesInOrder)
+{
+    ASSERT_EQ(aeron_broadcast_transmitter_init(&m_transmitter, m_buffer.data(), m_buffer.size()), 0);
+    ASSERT_EQ(aeron_broadcast_receiver_init(&m_receiver, m_buffer.data(), m_buffer.size()), 0);
+
+    for (int i = 0; i < 3; i++)
+    {
+        std::memset(m_srcBuffer.data(), i + 1, 20);
+        ASSERT_EQ(aeron_broadcast_transmitter_transmit(&m_transmitter, MSG_TYPE_ID + i, m_srcBuffer.data(), 20), 0);
+    }
+
+    EXPECT_EQ(aeron_broadcast_receiver_receive(&m_receiver, recording_handler, &m_messages), 3);
+    ASSERT_EQ(m_messages.size(), 3u);
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(m_messages[i].msg_type_id, MSG_TYPE_ID + i);
+        ASSERT_EQ(m_messages[i].data.size(), 20u);
+        EXPECT_EQ(m_messages[i].data[0], (std::uint8_t)(i + 1));
+    }
+
+    EXPECT_EQ(aeron_broadcast_receiver_receive(&m_receiver, recording_handler, &m_messages), 0);
+}
+
+TEST_F(BroadcastReceiverTest, shouldReceiveAcrossPaddingAtEndOfBuffer)
+{
+    const size_t length = 100;
+    const size_t aligned_record_length = AERON_ALIGN(
+        length + AERON_BROADCAST_RECORD_HEADER_LENGTH, AERON_BROADCAST_RECORD_ALIGNMENT);
+    const size_t records_to_fill = CAPACITY / aligned_record_length;
+
+    ASSERT_EQ(aeron_broadcast_transmitter_init(&m_transmitter, m_buffer.data(), m_buffer.size()), 0);
+    ASSERT_EQ(aeron_broadcast_receiver_init(&m_receiver, m_buffer.data(), m_buffer.size()), 0);
+
+    for (size_t i = 0; i < records_to_fill; i++)
+    {
+        ASSERT_EQ(aeron_broadcast_transmitter_transmit(&m_transmitter, MSG_TYPE_ID, m_srcBuffer.data(), length), 0);
+    }
+
+    EXPECT_EQ(aeron_broadcast_receiver_receive(&m_receiver, recording_handler, &m_messages), (int)records_to_fill);
+
+    m_srcBuffer[0] = 42;
+    ASSERT_EQ(aeron_broadcast_transmitter_transmit(&m_transmitter, MSG_TYPE_ID, m_srcBuffer.data(), length), 0);
+
+    m_messages.clear();
+    EXPECT_EQ(aeron_broadcast_receiver_receive(&m_receiver, recording_handler, &m_messages), 1);
+    ASSERT_EQ(m_messages.size(), 1u);
+    EXPECT_EQ(m_messages[0].data.size(), length);
+    EXPECT_EQ(m_messages[0].data[0], 42);
+}
+
+TEST_F(BroadcastReceiverTest, shouldErrorWhenLappedByTransmitter)
+{
+    ASSERT_EQ(aeron_broadcast_transmitter_init(&m_transmitter, m_buffer.data(), m_buffer.size()), 0);
+    ASSERT_EQ(aeron_broadcast_receiver_init(&m_receiver, m_buffer.data(), m_buffer.size()), 0);
+
+    for (int i = 0; i < 64; i++)
+    {
+        ASSERT_EQ(aeron_broadcast_transmitter_transmit(&m_transmitter, MSG_TYPE_ID, m_srcBuffer.data(), 100), 0);
+    }
+
+    EXPECT_EQ(aeron_broadcast_receiver_receive(&m_receiver, recording_handler, &m_messages), -1);
+    EXPECT_EQ(m_receiver.lapped_count, 1);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "aeron_benchmark_util.h"
+
+extern "C"
+{
+#include "concurrent/aeron_broadcast_transmitter.h"
+#include "concurrent/aeron_broadcast_receiver.h"
+}
+
+#define CAPACITY (1024 * 1024)
+#define BUFFER_LENGTH (CAPACITY + AERON_BROADCAST_BUFFER_TRAILER_LENGTH)
+#define MSG_TYPE_ID (101)
+
+static std::vector<uint8_t> broadcast_buffer(BUFFER_LENGTH, 0);
+static aeron_broadcast_transmitter_t transmitter;
+static aeron_broadcast_receiver_t receiver;
+
+static void null_handler(int32_t msg_type_id, uint8_t *buffer, size_t length, void *clientd)
+{
+}
+
+static void BM_BroadcastTransmit(benchmark::State &state)
+{
+    std::vector<uint8_t> msg((size_t)state.range(0), 0x5A);
+
+    std::fill(broadcast_buffer.begin(), broadcast_buffer.end(), 0);
+    aeron_broadcast_transmitter_init(&transmitter, broadcast_buffer.data(), BUFFER_LENGTH);
+
+    while (state.KeepRunning())
+    {
+        aeron_broadcast_transmitter_transmit(&transmitter, MSG_TYPE_ID, msg.data(), msg.size());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+/* the transmitter never waits, so this measures the cost of a receiver on another core pulling the lines away */
+static void BM_BroadcastTransmitWithReceiver(benchmark::State &state)
+{
+    BenchmarkConsumer consumer([]() { aeron_broadcast_receiver_receive(&receiver, null_handler, NULL); });
+    std::vector<uint8_t> msg((size_t)state.range(0), 0x5A);
+
+    std::fill(broadcast_buffer.begin(), broadcast_buffer.end(), 0);
+    aeron_broadcast_transmitter_init(&transmitter, broadcast_buffer.data(), BUFFER_LENGTH);
+    aeron_broadcast_receiver_init(&receiver, broadcast_buffer.data(), BUFFER_LENGTH);
+    consumer.start();
+    aeron_benchmark_pin_to_core(aeron_benchmark_producer_core(0));
+
+    while (state.KeepRunning())
+    {
+        aeron_broadcast_transmitter_transmit(&transmitter, MSG_TYPE_ID, msg.data(), msg.size());
+    }
+
+    consumer.stop();
+    aeron_broadcast_receiver_close(&receiver);
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_BroadcastTransmit)->Arg(32)->Arg(256)->Arg(4096);
+BENCHMARK(BM_BroadcastTransmitWithReceiver)->Arg(32)->Arg(256)->Arg(4096)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,378 @@
+/*
+ * Copyright 2014 - 2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+extern "C"
+{
+#include "aeron_driver.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "client/aeronc.h"
+}
+
+#define STREAM_ID (101)
+#define IPC_CHANNEL "aeron:ipc"
+
+static void recording_fragment_handler(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    auto *fragments = static_cast<std::vector<std::vector<uint8_t>> *>(clientd);
+
+    fragments->push_back(std::vector<uint8_t>(buffer, buffer + length));
+}
+
+static void recording_block_handler(
+    void *clientd, const uint8_t *buffer, int32_t term_offset, size_t length, int32_t session_id, int32_t term_id)
+{
+    auto *blocks = static_cast<std::vector<std::vector<uint8_t>> *>(clientd);
+
+    blocks->push_back(std::vector<uint8_t>(buffer, buffer + length));
+}
+
+static void collect_image(void *clientd, aeron_image_t *image)
+{
+    static_cast<std::vector<aeron_image_t *> *>(clientd)->push_back(image);
+}
+
+static void collect_image_of_subscription(void *clientd, aeron_subscription_t *subscription, aeron_image_t *image)
+{
+    static_cast<std::vector<aeron_image_t *> *>(clientd)->push_back(image);
+}
+
+class CClientTest : public testing::Test
+{
+public:
+    explicit CClientTest(bool ipc_client_publisher_limit = false)
+    {
+        char dir_template[] = "/tmp/aeron-c-client-test-XXXXXX";
+
+        if (NULL == mkdtemp(dir_template))
+        {
+            throw std::runtime_error("could not create temp dir");
+        }
+
+        m_base_dir = dir_template;
+        m_dir = m_base_dir + "/aeron";
+
+        setenv(AERON_DIR_ENV_VAR, m_dir.c_str(), 1);
+
+        if (aeron_driver_context_init(&m_driver_context) < 0)
+        {
+            throw std::runtime_error("could not init driver context");
+        }
+
+        m_driver_context->ipc_client_publisher_limit = ipc_client_publisher_limit;
+        m_driver_context->publication_linger_timeout_ns = 10 * 1000 * 1000;
+        m_driver_context->timer_interval_ns = 10 * 1000 * 1000;
+
+        if (aeron_driver_init(&m_driver, m_driver_context) < 0 ||
+            aeron_driver_invoker_start(m_driver) < 0)
+        {
+            throw std::runtime_error("could not start driver");
+        }
+
+        if (aeron_context_init(&m_context) < 0 || aeron_init(&m_aeron, m_context) < 0)
+        {
+            throw std::runtime_error(std::string("could not connect client: ") + aeron_errmsg());
+        }
+    }
+
+    ~CClientTest() override
+    {
+        aeron_close(m_aeron);
+        aeron_context_close(m_context);
+        aeron_driver_close(m_driver);
+        aeron_driver_context_close(m_driver_context);
+        aeron_dir_delete(m_dir.c_str());
+        rmdir(m_base_dir.c_str());
+        unsetenv(AERON_DIR_ENV_VAR);
+    }
+
+    void doWork()
+    {
+        aeron_driver_invoker_do_work(m_driver);
+        ASSERT_GE(aeron_main_do_work(m_aeron), 0) << aeron_errmsg();
+    }
+
+    bool doWorkUntil(const std::function<bool()>& condition)
+    {
+        for (int i = 0; i < 100000; i++)
+        {
+            if (condition())
+            {
+                return true;
+            }
+
+            doWork();
+        }
+
+        return false;
+    }
+
+    aeron_publication_t *addPublication(const char *channel)
+    {
+        aeron_async_add_publication_t *async = NULL;
+        aeron_publication_t *publication = NULL;
+        int result = 0;
+
+        if (aeron_async_add_publication(&async, m_aeron, channel, STREAM_ID) < 0)
+        {
+            return NULL;
+        }
+
+        doWorkUntil([&]() { return 0 != (result = aeron_async_add_publication_poll(&publication, async)); });
+
+        return publication;
+    }
+
+    aeron_subscription_t *addSubscription(const char *channel)
+    {
+        aeron_async_add_subscription_t *async = NULL;
+        aeron_subscription_t *subscription = NULL;
+        int result = 0;
+
+        if (aeron_async_add_subscription(&async, m_aeron, channel, STREAM_ID, NULL, NULL, NULL, NULL) < 0)
+        {
+            return NULL;
+        }
+
+        doWorkUntil([&]() { return 0 != (result = aeron_async_add_subscription_poll(&subscription, async)); });
+
+        return subscription;
+    }
+
+protected:
+    std::string m_base_dir;
+    std::string m_dir;
+    aeron_driver_context_t *m_driver_context = NULL;
+    aeron_driver_t *m_driver = NULL;
+    aeron_context_t *m_context = NULL;
+    aeron_t *m_aeron = NULL;
+    std::vector<std::vector<uint8_t>> m_fragments;
+};
+
+TEST_F(CClientTest, shouldExchangeMessagesOverIpc)
+{
+    aeron_subscription_t *subscription = addSubscription(IPC_CHANNEL);
+    ASSERT_NE(subscription, nullptr) << aeron_errmsg();
+
+    aeron_publication_t *publication = addPublication(IPC_CHANNEL);
+    ASSERT_NE(publication, nullptr) << aeron_errmsg();
+
+    ASSERT_TRUE(doWorkUntil([&]() { return aeron_subscription_is_connected(subscription); }));
+    ASSERT_TRUE(doWorkUntil([&]() { return aeron_publication_is_connected(publication); }));
+
+    const uint8_t message[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    int64_t position = 0;
+
+    ASSERT_TRUE(doWorkUntil(
+        [&]() { return (position = aeron_publication_offer(publication, message, sizeof(message))) > 0; }));
+    EXPECT_EQ(position, 64);
+
+    ASSERT_TRUE(doWorkUntil(
+        [&]() { return aeron_subscription_poll(subscription, recording_fragment_handler, &m_fragments, 10) > 0; }));
+    ASSERT_EQ(m_fragments.size(), 1u);
+    EXPECT_EQ(m_fragments[0], std::vector<uint8_t>(message, message + sizeof(message)));
+
+    EXPECT_EQ(aeron_publication_close(publication), 0);
+    EXPECT_EQ(aeron_subscription_close(subscription), 0);
+}
+
+TEST_F(CClientTest, shouldFragmentMessagesLongerThanMtu)
+{
+    aeron_subscription_t *subscription = addSubscription(IPC_CHANNEL);
+    ASSERT_NE(subscription, nullptr) << aeron_errmsg();
+
+    aeron_publication_t *publication = addPublication(IPC_CHANNEL);
+    ASSERT_NE(publication, nullptr) << aeron_errmsg();
+
+    ASSERT_TRUE(doWorkUntil([&]() { return aeron_publication_is_connected(publication); }));
+
+    std::vector<uint8_t> message(10000);
+    for (size_t i = 0; i < message.size(); i++)
+    {
+        message[i] = (uint8_t)i;
+    }
+
+    ASSERT_TRUE(doWorkUntil(
+        [&]() { return aeron_publication_offer(publication, message.data(), message.size()) > 0; }));
+
+    size_t totalLength = 0;
+    ASSERT_TRUE(doWorkUntil(
+        [&]()
+        {
+            aeron_subscription_poll(subscription, recording_fragment_handler, &m_fragments, 10);
+            totalLength = 0;
+            for (auto &fragment : m_fragments)
+            {
+                totalLength += fragment.size();
+            }
+            return totalLength >= message.size();
+        }));
+
+    EXPECT_GT(m_fragments.size(), 1u);
+
+    std::vector<uint8_t> reassembled;
+    for (auto &fragment : m_fragments)
+    {
+        reassembled.insert(reassembled.end(), fragment.begin(), fragment.end());
+    }
+
+    EXPECT_EQ(reassembled, message);
+}
+
+TEST_F(CClientTest, shouldBlockPollWholeFramesUpToLimit)
+{
+    aeron_subscription_t *subscription = addSubscription(IPC_CHANNEL);
+    ASSERT_NE(subscription, nullptr) << aeron_errmsg();
+
+    aeron_publication_t *publication = addPublication(IPC_CHANNEL);
+    ASSERT_NE(publication, nullptr) << aeron_errmsg();
+
+    ASSERT_TRUE(doWorkUntil([&]() { return aeron_subscription_is_connected(subscription); }));
+
+    const uint8_t message[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(doWorkUntil(
+            [&]() { return aeron_publication_offer(publication, message, sizeof(message)) > 0; }));
+    }
+
+    std::vector<aeron_image_t *> images;
+    aeron_subscription_for_each_image(subscription, collect_image, &images);
+    ASSERT_EQ(images.size(), 1u);
+
+    aeron_image_t *image = images[0];
+    EXPECT_EQ(aeron_image_session_id(image), aeron_publication_session_id(publication));
+
+    EXPECT_EQ(aeron_image_block_poll(image, recording_block_handler, &m_fragments, 100), 64);
+    EXPECT_EQ(aeron_image_block_poll(image, recording_block_handler, &m_fragments, 1024), 128);
+    EXPECT_EQ(aeron_image_block_poll(image, recording_block_handler, &m_fragments, 1024), 0);
+    EXPECT_EQ(aeron_image_position(image), 192);
+
+    ASSERT_EQ(m_fragments.size(), 2u);
+    EXPECT_EQ(m_fragments[1].size(), 128u);
+    EXPECT_EQ(m_fragments[1][AERON_DATA_HEADER_LENGTH], 1);
+}
+
+class CClientIpcPublisherLimitTest : public CClientTest
+{
+public:
+    CClientIpcPublisherLimitTest() : CClientTest(true)
+    {
+    }
+};
+
+TEST_F(CClientIpcPublisherLimitTest, shouldOfferPastDriverLimitOnceSubscriberConsumes)
+{
+    aeron_subscription_t *subscription = addSubscription(IPC_CHANNEL);
+    ASSERT_NE(subscription, nullptr) << aeron_errmsg();
+
+    aeron_publication_t *publication = addPublication(IPC_CHANNEL "?term-length=65536");
+    ASSERT_NE(publication, nullptr) << aeron_errmsg();
+
+    ASSERT_TRUE(doWorkUntil([&]() { return aeron_subscription_is_connected(subscription); }));
+
+    const uint8_t message[1024] = { 0 };
+    int64_t result;
+    while ((result = aeron_publication_offer(publication, message, sizeof(message))) > 0 ||
+        AERON_PUBLICATION_ADMIN_ACTION == result)
+    {
+    }
+
+    ASSERT_EQ(result, AERON_PUBLICATION_BACK_PRESSURED);
+
+    while (aeron_subscription_poll(subscription, recording_fragment_handler, &m_fragments, 10) > 0)
+    {
+    }
+
+    EXPECT_GT(aeron_publication_offer(publication, message, sizeof(message)), 0);
+}
+
+TEST_F(CClientTest, shouldReportErrorForInvalidChannel)
+{
+    aeron_async_add_publication_t *async = NULL;
+    aeron_publication_t *publication = NULL;
+    int result = 0;
+
+    ASSERT_EQ(aeron_async_add_publication(&async, m_aeron, "aeron:invalid", STREAM_ID), 0);
+    ASSERT_TRUE(doWorkUntil(
+        [&]() { return 0 != (result = aeron_async_add_publication_poll(&publication, async)); }));
+
+    EXPECT_EQ(result, -1);
+    EXPECT_EQ(publication, nullptr);
+}
+
+TEST_F(CClientTest, shouldCallImageHandlersAsImagesComeAndGo)
+{
+    aeron_async_add_subscription_t *async = NULL;
+    aeron_subscription_t *subscription = NULL;
+    std::vector<aeron_image_t *> available;
+    std::vector<aeron_image_t *> unavailable;
+
+    ASSERT_EQ(aeron_async_add_subscription(
+        &async,
+        m_aeron,
+        IPC_CHANNEL,
+        STREAM_ID,
+        collect_image_of_subscription,
+        &available,
+        collect_image_of_subscription,
+        &unavailable), 0) << aeron_errmsg();
+    ASSERT_TRUE(doWorkUntil([&]() { return 0 != aeron_async_add_subscription_poll(&subscription, async); }));
+    ASSERT_NE(subscription, nullptr) << aeron_errmsg();
+
+    aeron_publication_t *publication = addPublication(IPC_CHANNEL);
+    ASSERT_NE(publication, nullptr) << aeron_errmsg();
+
+    ASSERT_TRUE(doWorkUntil([&]() { return !available.empty(); }));
+    ASSERT_EQ(available.size(), 1u);
+    EXPECT_EQ(aeron_image_session_id(available[0]), aeron_publication_session_id(publication));
+    EXPECT_FALSE(aeron_image_is_closed(available[0]));
+    EXPECT_TRUE(unavailable.empty());
+
+    EXPECT_EQ(aeron_publication_close(publication), 0);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (unavailable.empty() && std::chrono::steady_clock::now() < deadline)
+    {
+        doWork();
+    }
+
+    ASSERT_EQ(unavailable.size(), 1u);
+    EXPECT_EQ(unavailable[0], available[0]);
+    EXPECT_TRUE(aeron_image_is_closed(unavailable[0]));
+    EXPECT_EQ(available.size(), 1u);
+
+    EXPECT_EQ(aeron_subscription_close(subscription), 0);
+}
+
+TEST_F(CClientTest, shouldReportNotConnectedWithoutSubscriber)
+{
+    aeron_publication_t *publication = addPublication(IPC_CHANNEL);
+    ASSERT_NE(publication, nullptr) << aeron_errmsg();
+
+    const uint8_t message[] = { 1, 2, 3, 4 };
+
+    EXPECT_EQ(aeron_publication_offer(publication, message, sizeof(message)), AERON_PUBLICATION_NOT_CONNECTED);
+    EXPECT_EQ(aeron_publication_close(publication), 0);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cerrno>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeronmd.h"
+#include "util/aeron_clock.h"
+}
+
+#define CALIBRATION_NS (10 * 1000 * 1000L)
+#define TOLERANCE_NS (1000 * 1000L)
+
+class ClockTest : public testing::Test
+{
+};
+
+TEST_F(ClockTest, shouldReadUpdatedCachedNanoTime)
+{
+    aeron_clock_cache_t cache;
+
+    aeron_clock_update_cached_nano_time(&cache, 42);
+    EXPECT_EQ(aeron_clock_cached_nano_time(&cache), 42);
+
+    aeron_clock_update_cached_nano_time(&cache, 1024);
+    EXPECT_EQ(aeron_clock_cached_nano_time(&cache), 1024);
+}
+
+TEST_F(ClockTest, shouldTrackSystemNanoClockWhenTscClockCalibrated)
+{
+    if (aeron_tsc_clock_calibrate(CALIBRATION_NS) < 0)
+    {
+        EXPECT_EQ(aeron_errcode(), ENOTSUP);
+        EXPECT_FALSE(aeron_tsc_clock_is_calibrated());
+        return;
+    }
+
+    ASSERT_TRUE(aeron_tsc_clock_is_calibrated());
+
+    int64_t last_ns = aeron_tsc_nanoclock();
+
+    for (int i = 0; i < 1000; i++)
+    {
+        const int64_t system_ns = aeron_nanoclock();
+        const int64_t tsc_ns = aeron_tsc_nanoclock();
+
+        EXPECT_GE(tsc_ns, last_ns);
+        EXPECT_LT(std::abs(tsc_ns - system_ns), TOLERANCE_NS);
+        last_ns = tsc_ns;
+    }
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "aeron_benchmark_util.h"
+
+extern "C"
+{
+#include "concurrent/aeron_spsc_concurrent_array_queue.h"
+#include "concurrent/aeron_mpsc_concurrent_array_queue.h"
+}
+
+#define CAPACITY (64 * 1024)
+
+static aeron_spsc_concurrent_array_queue_t spsc_queue;
+static aeron_mpsc_concurrent_array_queue_t mpsc_queue;
+static int element = 42;
+
+static void null_drain_func(void *clientd, volatile void *item)
+{
+}
+
+static void BM_SpscQueueOfferDrain(benchmark::State &state)
+{
+    const int burst = (int)state.range(0);
+
+    aeron_spsc_concurrent_array_queue_init(&spsc_queue, CAPACITY);
+
+    while (state.KeepRunning())
+    {
+        for (int i = 0; i < burst; i++)
+        {
+            aeron_spsc_concurrent_array_queue_offer(&spsc_queue, &element);
+        }
+
+        benchmark::DoNotOptimize(aeron_spsc_concurrent_array_queue_drain_all(&spsc_queue, null_drain_func, NULL));
+    }
+
+    aeron_spsc_concurrent_array_queue_close(&spsc_queue);
+    state.SetItemsProcessed(state.iterations() * burst);
+}
+
+static void BM_SpscQueueOfferWithConsumer(benchmark::State &state)
+{
+    BenchmarkConsumer consumer(
+        []() { aeron_spsc_concurrent_array_queue_drain_all(&spsc_queue, null_drain_func, NULL); });
+
+    aeron_spsc_concurrent_array_queue_init(&spsc_queue, CAPACITY);
+    consumer.start();
+    aeron_benchmark_pin_to_core(aeron_benchmark_producer_core(0));
+
+    while (state.KeepRunning())
+    {
+        while (AERON_OFFER_SUCCESS != aeron_spsc_concurrent_array_queue_offer(&spsc_queue, &element))
+        {
+            aeron_benchmark_backoff();
+        }
+    }
+
+    consumer.stop();
+    aeron_spsc_concurrent_array_queue_close(&spsc_queue);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_MpscQueueOfferDrain(benchmark::State &state)
+{
+    const int burst = (int)state.range(0);
+
+    aeron_mpsc_concurrent_array_queue_init(&mpsc_queue, CAPACITY);
+
+    while (state.KeepRunning())
+    {
+        for (int i = 0; i < burst; i++)
+        {
+            aeron_mpsc_concurrent_array_queue_offer(&mpsc_queue, &element);
+        }
+
+        benchmark::DoNotOptimize(aeron_mpsc_concurrent_array_queue_drain_all(&mpsc_queue, null_drain_func, NULL));
+    }
+
+    aeron_mpsc_concurrent_array_queue_close(&mpsc_queue);
+    state.SetItemsProcessed(state.iterations() * burst);
+}
+
+/* each producer retries until its element is taken, against a consumer draining on its own core */
+static void BM_MpscQueueOfferContended(benchmark::State &state)
+{
+    static BenchmarkConsumer consumer(
+        []() { aeron_mpsc_concurrent_array_queue_drain_all(&mpsc_queue, null_drain_func, NULL); });
+
+    if (0 == state.thread_index)
+    {
+        aeron_mpsc_concurrent_array_queue_init(&mpsc_queue, CAPACITY);
+        consumer.start();
+    }
+
+    aeron_benchmark_pin_to_core(aeron_benchmark_producer_core(state.thread_index));
+
+    while (state.KeepRunning())
+    {
+        while (AERON_OFFER_SUCCESS != aeron_mpsc_concurrent_array_queue_offer(&mpsc_queue, &element))
+        {
+            aeron_benchmark_backoff();
+        }
+    }
+
+    if (0 == state.thread_index)
+    {
+        consumer.stop();
+        aeron_mpsc_concurrent_array_queue_close(&mpsc_queue);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SpscQueueOfferDrain)->Arg(1)->Arg(64);
+BENCHMARK(BM_SpscQueueOfferWithConsumer)->UseRealTime();
+BENCHMARK(BM_MpscQueueOfferDrain)->Arg(1)->Arg(64);
+BENCHMARK(BM_MpscQueueOfferContended)->Threads(1)->Threads(2)->Threads(4)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,198 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "concurrent/aeron_counters_manager.h"
+#include "aeron_congestion_control.h"
+#include "aeron_driver_context.h"
+}
+
+#define TERM_LENGTH (64 * 1024 * 1024)
+#define MTU_LENGTH (1408)
+#define INITIAL_WINDOW_LENGTH (2 * 1024 * 1024)
+#define INITIAL_RTT_NS (100 * 1000L)
+#define CHANNEL "aeron:udp?endpoint=localhost:40123"
+
+static int64_t now_ns = 0;
+
+static int64_t test_nano_clock()
+{
+    return now_ns;
+}
+
+static int64_t null_epoch_clock()
+{
+    return 0;
+}
+
+class CubicCongestionControlTest : public testing::Test
+{
+public:
+    CubicCongestionControlTest()
+    {
+        now_ns = 0;
+        m_metadata.fill(0);
+        m_values.fill(0);
+
+        aeron_counters_manager_init(
+            &m_counters_manager,
+            m_metadata.data(),
+            m_metadata.size(),
+            m_values.data(),
+            m_values.size(),
+            null_epoch_clock,
+            0);
+
+        memset(&m_context, 0, sizeof(m_context));
+        m_context.initial_window_length = INITIAL_WINDOW_LENGTH;
+        m_context.cubic_cc_initial_rtt_ns = INITIAL_RTT_NS;
+        m_context.nano_clock = test_nano_clock;
+    }
+
+    ~CubicCongestionControlTest()
+    {
+        if (NULL != m_strategy)
+        {
+            m_strategy->fini(m_strategy);
+        }
+
+        aeron_counters_manager_close(&m_counters_manager);
+    }
+
+protected:
+    void createStrategy()
+    {
+        ASSERT_EQ(aeron_cubic_congestion_control_strategy_supplier(
+            &m_strategy, CHANNEL, 1001, 7, 42, TERM_LENGTH, MTU_LENGTH, &m_context, &m_counters_manager), 0);
+    }
+
+    int32_t onTrackRebuild(bool *should_force_sm, bool loss_occurred)
+    {
+        return m_strategy->on_track_rebuild(
+            m_strategy->state, should_force_sm, now_ns, 0, 0, 0, 0, 0, loss_occurred);
+    }
+
+    std::array<std::uint8_t, 4 * 1024> m_metadata;
+    std::array<std::uint8_t, 1024> m_values;
+    aeron_counters_manager_t m_counters_manager;
+    aeron_driver_context_t m_context;
+    aeron_congestion_control_strategy_t *m_strategy = NULL;
+};
+
+TEST_F(CubicCongestionControlTest, shouldStartWithOneMtuWindow)
+{
+    createStrategy();
+
+    EXPECT_EQ(m_strategy->initial_window_length(m_strategy->state), MTU_LENGTH);
+    EXPECT_EQ(aeron_counters_manager_next_counter_id(&m_counters_manager), 2);
+}
+
+TEST_F(CubicCongestionControlTest, shouldOpenToMaxWindowWithoutLoss)
+{
+    createStrategy();
+    bool should_force_sm = false;
+
+    now_ns += 1000 * 1000 * 1000L;
+    EXPECT_EQ(onTrackRebuild(&should_force_sm, false), (INITIAL_WINDOW_LENGTH / MTU_LENGTH) * MTU_LENGTH);
+    EXPECT_TRUE(should_force_sm);
+
+    now_ns += 1000 * 1000 * 1000L;
+    EXPECT_EQ(onTrackRebuild(&should_force_sm, false), (INITIAL_WINDOW_LENGTH / MTU_LENGTH) * MTU_LENGTH);
+    EXPECT_FALSE(should_force_sm);
+}
+
+TEST_F(CubicCongestionControlTest, shouldGrowWindowBackAfterLoss)
+{
+    createStrategy();
+    bool should_force_sm = false;
+
+    now_ns += 1000 * 1000 * 1000L;
+    const int32_t max_window = onTrackRebuild(&should_force_sm, false);
+
+    now_ns += 1;
+    int32_t window = onTrackRebuild(&should_force_sm, true);
+    int32_t previous_window = window;
+
+    for (int i = 0; i < 100 && window < max_window; i++)
+    {
+        now_ns += 100 * 1000 * 1000L;
+        window = onTrackRebuild(&should_force_sm, false);
+        EXPECT_GE(window, previous_window);
+        previous_window = window;
+    }
+
+    EXPECT_EQ(window, max_window);
+}
+
+TEST_F(CubicCongestionControlTest, shouldShrinkWindowAndForceStatusMessageOnLoss)
+{
+    createStrategy();
+    bool should_force_sm = false;
+
+    now_ns += 1000 * 1000 * 1000L;
+    const int32_t window_before_loss = onTrackRebuild(&should_force_sm, false);
+
+    now_ns += 1;
+    const int32_t window_after_loss = onTrackRebuild(&should_force_sm, true);
+
+    EXPECT_TRUE(should_force_sm);
+    EXPECT_LT(window_after_loss, window_before_loss);
+    EXPECT_EQ(window_after_loss, (int32_t)((window_before_loss / MTU_LENGTH) * 0.8) * MTU_LENGTH);
+}
+
+TEST_F(CubicCongestionControlTest, shouldNotUpdateWindowBeforeRttHasPassed)
+{
+    createStrategy();
+    bool should_force_sm = true;
+
+    now_ns += INITIAL_RTT_NS / 2;
+    EXPECT_EQ(onTrackRebuild(&should_force_sm, false), MTU_LENGTH);
+    EXPECT_FALSE(should_force_sm);
+}
+
+TEST_F(CubicCongestionControlTest, shouldNotMeasureRttByDefault)
+{
+    createStrategy();
+
+    now_ns = 20 * 1000 * 1000L;
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+}
+
+TEST_F(CubicCongestionControlTest, shouldMeasureRttWhenNoneOutstanding)
+{
+    m_context.cubic_cc_measure_rtt = true;
+    createStrategy();
+
+    now_ns = 20 * 1000 * 1000L;
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+    m_strategy->on_rttm_sent(m_strategy->state, now_ns);
+
+    now_ns += 20 * 1000 * 1000L;
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+
+    m_strategy->on_rttm(m_strategy->state, now_ns, 5 * 1000 * 1000L, NULL);
+    EXPECT_EQ(*aeron_counter_addr(&m_counters_manager, 0), 5 * 1000 * 1000L);
+
+    now_ns += 20 * 1000 * 1000L;
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+}
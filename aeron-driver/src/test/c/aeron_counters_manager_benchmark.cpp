@@ -0,0 +1,123 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "aeron_benchmark_util.h"
+
+extern "C"
+{
+#include "concurrent/aeron_counters_manager.h"
+}
+
+#define NUM_COUNTERS (64)
+#define MAX_THREADS (8)
+#define TYPE_ID (101)
+
+static std::vector<uint8_t> metadata(NUM_COUNTERS * AERON_COUNTERS_MANAGER_METADATA_LENGTH, 0);
+static std::vector<uint8_t> values(NUM_COUNTERS * AERON_COUNTERS_MANAGER_VALUE_LENGTH, 0);
+static aeron_counters_manager_t manager;
+static int64_t *counters[MAX_THREADS];
+
+static int64_t null_epoch_clock()
+{
+    return 0;
+}
+
+static void counters_manager_init()
+{
+    std::fill(metadata.begin(), metadata.end(), 0);
+    std::fill(values.begin(), values.end(), 0);
+    aeron_counters_manager_init(
+        &manager, metadata.data(), metadata.size(), values.data(), values.size(), null_epoch_clock, 0);
+}
+
+static void BM_CounterAllocateFree(benchmark::State &state)
+{
+    const int64_t key = 42;
+    const char label[] = "benchmark counter: 42";
+
+    counters_manager_init();
+
+    while (state.KeepRunning())
+    {
+        int32_t counter_id = aeron_counters_manager_allocate(
+            &manager, TYPE_ID, (const uint8_t *)&key, sizeof(key), label, sizeof(label) - 1);
+        aeron_counters_manager_free(&manager, counter_id);
+    }
+
+    aeron_counters_manager_close(&manager);
+}
+
+/* each thread owns a counter, so any slowdown as threads are added is false sharing between the values */
+static void BM_CounterOrderedIncrementOwned(benchmark::State &state)
+{
+    if (0 == state.thread_index)
+    {
+        counters_manager_init();
+        for (int i = 0; i < state.threads; i++)
+        {
+            counters[i] = aeron_counter_addr(
+                &manager, aeron_counters_manager_allocate(&manager, TYPE_ID, NULL, 0, "owned", 5));
+        }
+    }
+
+    aeron_benchmark_pin_to_core(aeron_benchmark_producer_core(state.thread_index));
+
+    while (state.KeepRunning())
+    {
+        aeron_counter_ordered_increment(counters[state.thread_index], 1);
+    }
+
+    if (0 == state.thread_index)
+    {
+        aeron_counters_manager_close(&manager);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_CounterIncrementShared(benchmark::State &state)
+{
+    if (0 == state.thread_index)
+    {
+        counters_manager_init();
+        counters[0] = aeron_counter_addr(
+            &manager, aeron_counters_manager_allocate(&manager, TYPE_ID, NULL, 0, "shared", 6));
+    }
+
+    aeron_benchmark_pin_to_core(aeron_benchmark_producer_core(state.thread_index));
+
+    while (state.KeepRunning())
+    {
+        aeron_counter_increment(counters[0], 1);
+    }
+
+    if (0 == state.thread_index)
+    {
+        aeron_counters_manager_close(&manager);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_CounterAllocateFree);
+BENCHMARK(BM_CounterOrderedIncrementOwned)->Threads(1)->Threads(2)->Threads(4)->Threads(MAX_THREADS)->UseRealTime();
+BENCHMARK(BM_CounterIncrementShared)->Threads(1)->Threads(2)->Threads(4)->Threads(MAX_THREADS)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -16,6 +16,9 @@
 
 #include <array>
 #include <cstdint>
+#include <thread>
+#include <vector>
+#include <set>
 
 #include <gtest/gtest.h>
 
@@ -100,6 +103,22 @@ TEST_F(CountersManagerTest, shouldNotIterateOverEmptyCounters)
     aeron_counters_reader_foreach(m_metadata.data(), m_metadata.size(), func_should_never_be_called, NULL);
 }
 
+TEST_F(CountersManagerTest, shouldPlaceEachCounterValueOnSeparateCacheLinePair)
+{
+    ASSERT_EQ(counters_manager_init(), 0);
+
+    int32_t id_0 = aeron_counters_manager_allocate(&m_manager, 0, NULL, 0, "lab0", 4);
+    int32_t id_1 = aeron_counters_manager_allocate(&m_manager, 0, NULL, 0, "lab1", 4);
+    ASSERT_GE(id_0, 0);
+    ASSERT_GE(id_1, 0);
+
+    uint8_t *addr_0 = (uint8_t *)aeron_counter_addr(&m_manager, id_0);
+    uint8_t *addr_1 = (uint8_t *)aeron_counter_addr(&m_manager, id_1);
+
+    EXPECT_EQ(AERON_COUNTERS_MANAGER_VALUE_LENGTH, 2u * AERON_CACHE_LINE_LENGTH);
+    EXPECT_GE((size_t)(addr_1 - addr_0), 2u * AERON_CACHE_LINE_LENGTH);
+}
+
 TEST_F(CountersManagerTest, shouldErrorOnAllocatingWhenFull)
 {
     ASSERT_EQ(counters_manager_init(), 0);
@@ -269,3 +288,173 @@ TEST_F(CountersManagerTest, shouldStoreMetaData)
 
     aeron_counters_reader_foreach(m_metadata.data(), m_metadata.size(), func_should_store_metadata, info);
 }
+
+TEST_F(CountersManagerTest, shouldAllocateConcurrentlyAboveHighWaterMarkOnly)
+{
+    ASSERT_EQ(counters_manager_init(), 0);
+
+    int32_t id_0 = aeron_counters_manager_allocate(&m_manager, 0, NULL, 0, "lab0", 4);
+    ASSERT_EQ(aeron_counters_manager_free(&m_manager, id_0), 0);
+
+    EXPECT_EQ(aeron_counters_manager_allocate_concurrent(&m_manager, 0, NULL, 0, "lab1", 4), id_0 + 1);
+    EXPECT_EQ(aeron_counters_manager_allocate(&m_manager, 0, NULL, 0, "lab2", 4), id_0);
+    EXPECT_EQ(aeron_counters_manager_allocate(&m_manager, 0, NULL, 0, "lab3", 4), id_0 + 2);
+    EXPECT_EQ(aeron_counters_manager_allocate_concurrent(&m_manager, 0, NULL, 0, "lab4", 4), id_0 + 3);
+    EXPECT_EQ(aeron_counters_manager_allocate_concurrent(&m_manager, 0, NULL, 0, "lab5", 4), -1);
+}
+
+TEST(CountersManagerConcurrentTest, shouldAllocateUniqueIdsFromMultipleThreads)
+{
+    const size_t num_threads = 4;
+    const size_t counters_per_thread = 64;
+    const size_t num_counters = num_threads * counters_per_thread;
+    std::vector<std::uint8_t> metadata(num_counters * AERON_COUNTERS_MANAGER_METADATA_LENGTH, 0);
+    std::vector<std::uint8_t> values(num_counters * AERON_COUNTERS_MANAGER_VALUE_LENGTH, 0);
+    std::vector<std::vector<int32_t>> ids(num_threads);
+    std::vector<std::thread> threads;
+    aeron_counters_manager_t manager;
+
+    ASSERT_EQ(aeron_counters_manager_init(
+        &manager, metadata.data(), metadata.size(), values.data(), values.size(), null_epoch_clock, 0), 0);
+
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.push_back(std::thread([&, t]()
+        {
+            for (size_t i = 0; i < counters_per_thread; i++)
+            {
+                ids[t].push_back(aeron_counters_manager_allocate_concurrent(&manager, 0, NULL, 0, "lab", 3));
+            }
+        }));
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::set<int32_t> unique_ids;
+    for (std::vector<int32_t> &thread_ids : ids)
+    {
+        for (int32_t id : thread_ids)
+        {
+            EXPECT_GE(id, 0);
+            unique_ids.insert(id);
+        }
+    }
+
+    EXPECT_EQ(unique_ids.size(), num_counters);
+    EXPECT_EQ(aeron_counters_manager_allocate_concurrent(&manager, 0, NULL, 0, "lab", 3), -1);
+
+    aeron_counters_manager_close(&manager);
+}
+
+TEST_F(CountersManagerTest, shouldRejectSnapshotBufferTooSmallForCapacity)
+{
+    ASSERT_EQ(counters_manager_init(), 0);
+
+    aeron_counters_snapshot_t snapshot;
+    std::vector<uint8_t> buffer(aeron_counters_snapshot_buffer_length(NUM_COUNTERS, true) - 1);
+
+    EXPECT_EQ(aeron_counters_snapshot_init(&snapshot, buffer.data(), buffer.size(), NUM_COUNTERS, true), -1);
+}
+
+TEST_F(CountersManagerTest, shouldSnapshotAllocatedCountersSkippingFreed)
+{
+    ASSERT_EQ(counters_manager_init(), 0);
+
+    int32_t id_0 = aeron_counters_manager_allocate(&m_manager, 101, NULL, 0, "lab0", 4);
+    int32_t id_1 = aeron_counters_manager_allocate(&m_manager, 102, NULL, 0, "lab1", 4);
+    int32_t id_2 = aeron_counters_manager_allocate(&m_manager, 103, NULL, 0, "lab2", 4);
+    ASSERT_EQ(aeron_counters_manager_free(&m_manager, id_1), 0);
+
+    *aeron_counter_addr(&m_manager, id_0) = 7;
+    *aeron_counter_addr(&m_manager, id_2) = 9;
+
+    aeron_counters_snapshot_t snapshot;
+    std::vector<uint8_t> buffer(aeron_counters_snapshot_buffer_length(NUM_COUNTERS, true));
+    ASSERT_EQ(aeron_counters_snapshot_init(&snapshot, buffer.data(), buffer.size(), NUM_COUNTERS, true), 0);
+
+    EXPECT_EQ(aeron_counters_snapshot_take(
+        &snapshot, m_metadata.data(), m_metadata.size(), m_values.data(), m_values.size(), 1000), 2u);
+
+    EXPECT_EQ(snapshot.counter_ids[0], id_0);
+    EXPECT_EQ(snapshot.type_ids[0], 101);
+    EXPECT_EQ(snapshot.values[0], 7);
+    EXPECT_EQ(snapshot.counter_ids[1], id_2);
+    EXPECT_EQ(snapshot.type_ids[1], 103);
+    EXPECT_EQ(snapshot.values[1], 9);
+    EXPECT_EQ(std::string(aeron_counters_snapshot_label(&snapshot, 1), (size_t)snapshot.label_lengths[1]), "lab2");
+    EXPECT_EQ(snapshot.timestamp_ns, 1000);
+}
+
+TEST_F(CountersManagerTest, shouldComputeSnapshotRatesOnlyForMatchingCounters)
+{
+    ASSERT_EQ(counters_manager_init(), 0);
+
+    int32_t id_0 = aeron_counters_manager_allocate(&m_manager, 101, NULL, 0, "lab0", 4);
+    int32_t id_1 = aeron_counters_manager_allocate(&m_manager, 102, NULL, 0, "lab1", 4);
+
+    aeron_counters_snapshot_t previous, current;
+    std::vector<uint8_t> previous_buffer(aeron_counters_snapshot_buffer_length(NUM_COUNTERS, false));
+    std::vector<uint8_t> current_buffer(aeron_counters_snapshot_buffer_length(NUM_COUNTERS, false));
+    ASSERT_EQ(aeron_counters_snapshot_init(
+        &previous, previous_buffer.data(), previous_buffer.size(), NUM_COUNTERS, false), 0);
+    ASSERT_EQ(aeron_counters_snapshot_init(
+        &current, current_buffer.data(), current_buffer.size(), NUM_COUNTERS, false), 0);
+
+    *aeron_counter_addr(&m_manager, id_0) = 100;
+    aeron_counters_snapshot_take(
+        &previous, m_metadata.data(), m_metadata.size(), m_values.data(), m_values.size(), 0);
+
+    *aeron_counter_addr(&m_manager, id_0) = 600;
+    ASSERT_EQ(aeron_counters_manager_free(&m_manager, id_1), 0);
+    int32_t id_1_reused = aeron_counters_manager_allocate(&m_manager, 202, NULL, 0, "lab1", 4);
+    ASSERT_EQ(id_1_reused, id_1);
+    int32_t id_2 = aeron_counters_manager_allocate(&m_manager, 103, NULL, 0, "lab2", 4);
+    *aeron_counter_addr(&m_manager, id_2) = 50;
+
+    ASSERT_EQ(aeron_counters_snapshot_take(
+        &current, m_metadata.data(), m_metadata.size(), m_values.data(), m_values.size(), 500 * 1000 * 1000), 3u);
+    EXPECT_EQ(current.label_lengths, nullptr);
+
+    aeron_counters_snapshot_compute_rates(&current, &previous);
+
+    EXPECT_DOUBLE_EQ(current.rates[0], 1000.0);
+    EXPECT_DOUBLE_EQ(current.rates[1], 0.0);
+    EXPECT_DOUBLE_EQ(current.rates[2], 0.0);
+}
+
+TEST_F(CountersManagerTest, shouldStopSnapshotAtCapacity)
+{
+    ASSERT_EQ(counters_manager_init(), 0);
+
+    for (size_t i = 0; i < NUM_COUNTERS; i++)
+    {
+        ASSERT_GE(aeron_counters_manager_allocate(&m_manager, 0, NULL, 0, "lab", 3), 0);
+    }
+
+    aeron_counters_snapshot_t snapshot;
+    std::vector<uint8_t> buffer(aeron_counters_snapshot_buffer_length(2, false));
+    ASSERT_EQ(aeron_counters_snapshot_init(&snapshot, buffer.data(), buffer.size(), 2, false), 0);
+
+    EXPECT_EQ(aeron_counters_snapshot_take(
+        &snapshot, m_metadata.data(), m_metadata.size(), m_values.data(), m_values.size(), 0), 2u);
+}
+
+TEST_F(CountersManagerTest, shouldBumpWakeSequenceOnlyWhenCounterHasWaiters)
+{
+    ASSERT_EQ(counters_manager_init(), 0);
+
+    int32_t id = aeron_counters_manager_allocate(&m_manager, 0, NULL, 0, "lab0", 4);
+    int64_t *addr = aeron_counter_addr(&m_manager, id);
+    int32_t *waiters = (int32_t *)((uint8_t *)addr + AERON_COUNTER_WAITERS_OFFSET);
+    int32_t *sequence = (int32_t *)((uint8_t *)addr + AERON_COUNTER_WAKE_SEQUENCE_OFFSET);
+
+    aeron_counter_signal_waiters(addr);
+    EXPECT_EQ(*sequence, 0);
+
+    *waiters = 1;
+    aeron_counter_signal_waiters(addr);
+    EXPECT_EQ(*sequence, 1);
+}
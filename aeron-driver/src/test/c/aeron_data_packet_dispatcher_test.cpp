@@ -0,0 +1,350 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_data_packet_dispatcher.h"
+#include "aeron_publication_image.h"
+}
+
+#define STREAM_ID (101)
+#define OTHER_STREAM_ID (102)
+#define SESSION_ID (7)
+
+/*
+ * Images are zeroed stand-ins with only their ids set. A NAK is dispatched to them as it only counts into peer_naks,
+ * which shows which image, if any, a frame of a session reached.
+ */
+class DataPacketDispatcherTest : public testing::Test
+{
+public:
+    DataPacketDispatcherTest()
+    {
+        if (aeron_data_packet_dispatcher_init(&m_dispatcher, NULL, NULL) < 0)
+        {
+            throw std::runtime_error("could not init dispatcher");
+        }
+    }
+
+    ~DataPacketDispatcherTest() override
+    {
+        aeron_data_packet_dispatcher_close(&m_dispatcher);
+
+        for (aeron_publication_image_t *image : m_images)
+        {
+            aeron_free(image);
+        }
+    }
+
+protected:
+    aeron_publication_image_t *newImage(int32_t session_id, int32_t stream_id)
+    {
+        aeron_publication_image_t *image = NULL;
+
+        if (aeron_alloc((void **)&image, sizeof(aeron_publication_image_t)) < 0)
+        {
+            throw std::runtime_error("could not allocate image");
+        }
+
+        image->session_id = session_id;
+        image->stream_id = stream_id;
+        image->conductor_fields.managed_resource.registration_id = (int64_t)m_images.size() + 1;
+        m_images.push_back(image);
+
+        return image;
+    }
+
+    aeron_publication_image_t *addImage(int32_t session_id, int32_t stream_id)
+    {
+        aeron_publication_image_t *image = newImage(session_id, stream_id);
+
+        EXPECT_EQ(aeron_data_packet_dispatcher_add_publication_image(&m_dispatcher, image), 0);
+
+        return image;
+    }
+
+    void nak(int32_t session_id, int32_t stream_id)
+    {
+        aeron_nak_header_t header = {};
+
+        header.session_id = session_id;
+        header.stream_id = stream_id;
+
+        ASSERT_EQ(aeron_data_packet_dispatcher_on_nak(
+            &m_dispatcher, NULL, &header, (uint8_t *)&header, sizeof(header), NULL), 0);
+    }
+
+    int onData(int32_t session_id, int32_t stream_id)
+    {
+        aeron_data_header_t header = {};
+
+        header.frame_header.type = AERON_HDR_TYPE_DATA;
+        header.session_id = session_id;
+        header.stream_id = stream_id;
+
+        return aeron_data_packet_dispatcher_on_data(
+            &m_dispatcher, NULL, &header, (uint8_t *)&header, sizeof(header), NULL);
+    }
+
+    int onSetup(int32_t session_id, int32_t stream_id)
+    {
+        aeron_setup_header_t header = {};
+
+        header.frame_header.type = AERON_HDR_TYPE_SETUP;
+        header.session_id = session_id;
+        header.stream_id = stream_id;
+
+        return aeron_data_packet_dispatcher_on_setup(
+            &m_dispatcher, NULL, &header, (uint8_t *)&header, sizeof(header), NULL);
+    }
+
+    void *status(int32_t session_id, int32_t stream_id)
+    {
+        return aeron_int64_to_ptr_hash_map_get(
+            &m_dispatcher.session_map, aeron_int64_to_ptr_hash_map_compound_key(session_id, stream_id));
+    }
+
+    void putToken(int32_t session_id, int32_t stream_id, int *token)
+    {
+        ASSERT_EQ(aeron_int64_to_ptr_hash_map_put(
+            &m_dispatcher.session_map, aeron_int64_to_ptr_hash_map_compound_key(session_id, stream_id), token), 0);
+    }
+
+    aeron_data_packet_dispatcher_t m_dispatcher = {};
+    std::vector<aeron_publication_image_t *> m_images;
+};
+
+TEST_F(DataPacketDispatcherTest, shouldDispatchToImageAndCacheItAsLastImage)
+{
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&m_dispatcher, STREAM_ID), 0);
+    aeron_publication_image_t *image = addImage(SESSION_ID, STREAM_ID);
+    aeron_publication_image_t *other = addImage(SESSION_ID + 1, STREAM_ID);
+
+    nak(SESSION_ID, STREAM_ID);
+    EXPECT_EQ(image->peer_naks.count, 1);
+    EXPECT_EQ(m_dispatcher.last_image, image);
+
+    nak(SESSION_ID + 1, STREAM_ID);
+    nak(SESSION_ID, STREAM_ID);
+    EXPECT_EQ(image->peer_naks.count, 2);
+    EXPECT_EQ(other->peer_naks.count, 1);
+    EXPECT_EQ(m_dispatcher.last_image, image);
+}
+
+TEST_F(DataPacketDispatcherTest, shouldInvalidateLastImageWhenImageRemoved)
+{
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&m_dispatcher, STREAM_ID), 0);
+    aeron_publication_image_t *image = addImage(SESSION_ID, STREAM_ID);
+
+    nak(SESSION_ID, STREAM_ID);
+    ASSERT_EQ(m_dispatcher.last_image, image);
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_publication_image(&m_dispatcher, image), 0);
+    EXPECT_EQ(m_dispatcher.last_image, nullptr);
+    EXPECT_EQ(status(SESSION_ID, STREAM_ID), &m_dispatcher.tokens.on_cooldown);
+
+    nak(SESSION_ID, STREAM_ID);
+    EXPECT_EQ(image->peer_naks.count, 1);
+    EXPECT_EQ(onData(SESSION_ID, STREAM_ID), 0);
+    EXPECT_EQ(status(SESSION_ID, STREAM_ID), &m_dispatcher.tokens.on_cooldown);
+}
+
+TEST_F(DataPacketDispatcherTest, shouldInvalidateLastImageWhenImageReplaced)
+{
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&m_dispatcher, STREAM_ID), 0);
+    aeron_publication_image_t *old_image = addImage(SESSION_ID, STREAM_ID);
+
+    nak(SESSION_ID, STREAM_ID);
+    ASSERT_EQ(m_dispatcher.last_image, old_image);
+
+    aeron_publication_image_t *new_image = addImage(SESSION_ID, STREAM_ID);
+    EXPECT_EQ(m_dispatcher.last_image, nullptr);
+
+    nak(SESSION_ID, STREAM_ID);
+    EXPECT_EQ(old_image->peer_naks.count, 1);
+    EXPECT_EQ(new_image->peer_naks.count, 1);
+    EXPECT_EQ(m_dispatcher.last_image, new_image);
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_publication_image(&m_dispatcher, old_image), 0);
+    EXPECT_EQ(status(SESSION_ID, STREAM_ID), new_image);
+
+    nak(SESSION_ID, STREAM_ID);
+    EXPECT_EQ(new_image->peer_naks.count, 2);
+}
+
+TEST_F(DataPacketDispatcherTest, shouldIgnoreStreamsNotSubscribedTo)
+{
+    EXPECT_FALSE(aeron_data_packet_dispatcher_should_elicit_setup_message(&m_dispatcher));
+
+    aeron_publication_image_t *image = addImage(SESSION_ID, STREAM_ID);
+    EXPECT_EQ(status(SESSION_ID, STREAM_ID), nullptr);
+
+    EXPECT_EQ(onData(SESSION_ID, STREAM_ID), 0);
+    EXPECT_EQ(onSetup(SESSION_ID, STREAM_ID), 0);
+    nak(SESSION_ID, STREAM_ID);
+
+    EXPECT_EQ(image->peer_naks.count, 0);
+    EXPECT_EQ(m_dispatcher.session_map.size, 0u);
+}
+
+TEST_F(DataPacketDispatcherTest, shouldMovePendingSetupTombstoneOnlyWhenPendingSetupRemoved)
+{
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&m_dispatcher, STREAM_ID), 0);
+    putToken(SESSION_ID, STREAM_ID, &m_dispatcher.tokens.pending_setup_frame);
+
+    EXPECT_TRUE(aeron_data_packet_dispatcher_is_not_already_in_progress_or_on_cooldown(
+        &m_dispatcher, STREAM_ID, SESSION_ID));
+    EXPECT_EQ(onData(SESSION_ID, STREAM_ID), 0);
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_cooldown(&m_dispatcher, SESSION_ID, STREAM_ID), 0);
+    EXPECT_EQ(status(SESSION_ID, STREAM_ID), &m_dispatcher.tokens.pending_setup_frame);
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_pending_setup(&m_dispatcher, SESSION_ID, STREAM_ID), 0);
+    EXPECT_EQ(status(SESSION_ID, STREAM_ID), nullptr);
+}
+
+TEST_F(DataPacketDispatcherTest, shouldReplaceInitInProgressTombstoneWithImage)
+{
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&m_dispatcher, STREAM_ID), 0);
+    putToken(SESSION_ID, STREAM_ID, &m_dispatcher.tokens.init_in_progress);
+
+    EXPECT_FALSE(aeron_data_packet_dispatcher_is_not_already_in_progress_or_on_cooldown(
+        &m_dispatcher, STREAM_ID, SESSION_ID));
+    EXPECT_EQ(onSetup(SESSION_ID, STREAM_ID), 0);
+    EXPECT_EQ(onData(SESSION_ID, STREAM_ID), 0);
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_pending_setup(&m_dispatcher, SESSION_ID, STREAM_ID), 0);
+    EXPECT_EQ(status(SESSION_ID, STREAM_ID), &m_dispatcher.tokens.init_in_progress);
+
+    aeron_publication_image_t *image = addImage(SESSION_ID, STREAM_ID);
+    EXPECT_EQ(status(SESSION_ID, STREAM_ID), image);
+
+    nak(SESSION_ID, STREAM_ID);
+    EXPECT_EQ(image->peer_naks.count, 1);
+}
+
+TEST_F(DataPacketDispatcherTest, shouldHoldCooldownTombstoneUntilCooldownRemoved)
+{
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&m_dispatcher, STREAM_ID), 0);
+    aeron_publication_image_t *image = addImage(SESSION_ID, STREAM_ID);
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_publication_image(&m_dispatcher, image), 0);
+
+    EXPECT_FALSE(aeron_data_packet_dispatcher_is_not_already_in_progress_or_on_cooldown(
+        &m_dispatcher, STREAM_ID, SESSION_ID));
+    EXPECT_EQ(onSetup(SESSION_ID, STREAM_ID), 0);
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_pending_setup(&m_dispatcher, SESSION_ID, STREAM_ID), 0);
+    EXPECT_EQ(status(SESSION_ID, STREAM_ID), &m_dispatcher.tokens.on_cooldown);
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_cooldown(&m_dispatcher, SESSION_ID, STREAM_ID), 0);
+    EXPECT_EQ(status(SESSION_ID, STREAM_ID), nullptr);
+    EXPECT_TRUE(aeron_data_packet_dispatcher_is_not_already_in_progress_or_on_cooldown(
+        &m_dispatcher, STREAM_ID, SESSION_ID));
+}
+
+TEST_F(DataPacketDispatcherTest, shouldOnlyRemoveImagesOfStreamNoLongerSubscribedTo)
+{
+    const int32_t session_count = 40;
+    std::vector<aeron_publication_image_t *> images;
+    std::vector<aeron_publication_image_t *> other_images;
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&m_dispatcher, STREAM_ID), 0);
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&m_dispatcher, OTHER_STREAM_ID), 0);
+
+    for (int32_t session_id = 0; session_id < session_count; session_id++)
+    {
+        images.push_back(addImage(session_id, STREAM_ID));
+        other_images.push_back(addImage(session_id, OTHER_STREAM_ID));
+    }
+    putToken(session_count, STREAM_ID, &m_dispatcher.tokens.on_cooldown);
+
+    nak(0, STREAM_ID);
+    ASSERT_EQ(m_dispatcher.last_image, images[0]);
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_subscription(&m_dispatcher, STREAM_ID), 0);
+    EXPECT_EQ(m_dispatcher.last_image, nullptr);
+    EXPECT_EQ(m_dispatcher.session_map.size, (size_t)session_count + 1);
+    EXPECT_EQ(status(session_count, STREAM_ID), &m_dispatcher.tokens.on_cooldown);
+
+    for (int32_t session_id = 0; session_id < session_count; session_id++)
+    {
+        EXPECT_EQ(status(session_id, STREAM_ID), nullptr) << session_id;
+        EXPECT_EQ(status(session_id, OTHER_STREAM_ID), other_images[session_id]) << session_id;
+
+        nak(session_id, STREAM_ID);
+        nak(session_id, OTHER_STREAM_ID);
+        EXPECT_EQ(images[session_id]->peer_naks.count, 0 == session_id ? 1 : 0) << session_id;
+        EXPECT_EQ(other_images[session_id]->peer_naks.count, 1) << session_id;
+    }
+}
+
+TEST_F(DataPacketDispatcherTest, shouldOnlyRemoveImagesOfStreamRangeNoLongerSubscribedTo)
+{
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription_range(&m_dispatcher, 10, 20), 0);
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&m_dispatcher, 15), 0);
+    aeron_publication_image_t *in_range = addImage(SESSION_ID, 12);
+    aeron_publication_image_t *also_subscribed = addImage(SESSION_ID, 15);
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_subscription_range(&m_dispatcher, 10, 20), 0);
+
+    EXPECT_EQ(status(SESSION_ID, 12), nullptr);
+    EXPECT_EQ(status(SESSION_ID, 15), also_subscribed);
+    nak(SESSION_ID, 12);
+    EXPECT_EQ(in_range->peer_naks.count, 0);
+}
+
+TEST_F(DataPacketDispatcherTest, shouldKeepSessionsWithNegativeIdsApart)
+{
+    const int32_t ids[] = { -1, 1, INT32_MIN, INT32_MAX, 0 };
+    std::vector<aeron_publication_image_t *> images;
+
+    for (int32_t stream_id : ids)
+    {
+        ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&m_dispatcher, stream_id), 0);
+    }
+
+    for (int32_t session_id : ids)
+    {
+        for (int32_t stream_id : ids)
+        {
+            images.push_back(addImage(session_id, stream_id));
+        }
+    }
+
+    EXPECT_EQ(m_dispatcher.session_map.size, images.size());
+
+    for (aeron_publication_image_t *image : images)
+    {
+        EXPECT_EQ(status(image->session_id, image->stream_id), image)
+            << image->session_id << ":" << image->stream_id;
+        nak(image->session_id, image->stream_id);
+        EXPECT_EQ(image->peer_naks.count, 1) << image->session_id << ":" << image->stream_id;
+    }
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_subscription(&m_dispatcher, -1), 0);
+
+    for (aeron_publication_image_t *image : images)
+    {
+        EXPECT_EQ(status(image->session_id, image->stream_id), -1 == image->stream_id ? nullptr : image)
+            << image->session_id << ":" << image->stream_id;
+    }
+}
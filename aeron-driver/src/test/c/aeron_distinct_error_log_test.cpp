@@ -133,6 +133,45 @@ TEST_F(DistinctErrorLogTest, shouldRecordTwoDistinctObservations)
     EXPECT_EQ(aeron_distinct_error_log_num_observations(&m_log), (size_t)2);
 }
 
+TEST_F(DistinctErrorLogTest, shouldOnlyCountRepeatedErrorsFromSiteWithinInterval)
+{
+    ASSERT_EQ(aeron_distinct_error_log_init(&m_log, m_buffer.data(), m_buffer.size(), clock, linger_resource, NULL), 0);
+
+    aeron_error_log_entry_t *entry = (aeron_error_log_entry_t *)(m_log.buffer);
+    static const char *site = "site %s";
+
+    EXPECT_FALSE(aeron_distinct_error_log_try_record_at_site(&m_log, 1, site));
+    EXPECT_EQ(aeron_distinct_error_log_record_at_site(&m_log, 1, site, "description 1", "message"), 0);
+    clock_value++;
+    EXPECT_TRUE(aeron_distinct_error_log_try_record_at_site(&m_log, 1, site));
+    EXPECT_FALSE(aeron_distinct_error_log_try_record_at_site(&m_log, 2, site));
+
+    EXPECT_EQ(entry->observation_count, 2);
+    EXPECT_EQ(entry->last_observation_timestamp, 8);
+    EXPECT_EQ(aeron_distinct_error_log_num_observations(&m_log), (size_t)1);
+}
+
+TEST_F(DistinctErrorLogTest, shouldRecordErrorFromSiteAgainAfterInterval)
+{
+    ASSERT_EQ(aeron_distinct_error_log_init(&m_log, m_buffer.data(), m_buffer.size(), clock, linger_resource, NULL), 0);
+
+    static const char *site = "site %s";
+
+    EXPECT_EQ(aeron_distinct_error_log_record_at_site(&m_log, 1, site, "description 1", "message"), 0);
+    clock_value += AERON_DISTINCT_ERROR_LOG_SITE_RECORD_INTERVAL_MS;
+    EXPECT_FALSE(aeron_distinct_error_log_try_record_at_site(&m_log, 1, site));
+    EXPECT_EQ(aeron_distinct_error_log_record_at_site(&m_log, 1, site, "description 2", "message"), 0);
+    clock_value++;
+    EXPECT_TRUE(aeron_distinct_error_log_try_record_at_site(&m_log, 1, site));
+
+    aeron_error_log_entry_t *entry = (aeron_error_log_entry_t *)(m_log.buffer);
+    size_t length = AERON_ALIGN(entry->length, AERON_ERROR_LOG_RECORD_ALIGNMENT);
+    entry = (aeron_error_log_entry_t *)((uint8_t *)m_log.buffer + length);
+
+    EXPECT_EQ(entry->observation_count, 2);
+    EXPECT_EQ(aeron_distinct_error_log_num_observations(&m_log), (size_t)2);
+}
+
 static void error_log_reader_no_entries(
     int32_t observation_count,
     int64_t first_observation_timestamp,
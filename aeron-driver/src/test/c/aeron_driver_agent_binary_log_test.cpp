@@ -0,0 +1,121 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <cstring>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "agent/aeron_driver_agent_binary_log.h"
+}
+
+#define CAPACITY (8)
+
+class DriverAgentBinaryLogTest : public testing::Test
+{
+public:
+    DriverAgentBinaryLogTest()
+    {
+        std::snprintf(m_path, sizeof(m_path), "/tmp/aeron-binary-log-test-%d.dat", (int)getpid());
+    }
+
+    ~DriverAgentBinaryLogTest() override
+    {
+        if (nullptr != m_log.mapped_file.addr)
+        {
+            aeron_unmap(&m_log.mapped_file);
+        }
+
+        unlink(m_path);
+    }
+
+    static void on_record(const aeron_driver_agent_binary_log_record_t *record, void *clientd)
+    {
+        DriverAgentBinaryLogTest *t = (DriverAgentBinaryLogTest *)clientd;
+        t->m_records.push_back(*record);
+    }
+
+protected:
+    char m_path[256];
+    aeron_driver_agent_binary_log_t m_log = {};
+    std::vector<aeron_driver_agent_binary_log_record_t> m_records;
+};
+
+TEST_F(DriverAgentBinaryLogTest, shouldRejectCapacityNotPowerOfTwo)
+{
+    EXPECT_EQ(aeron_driver_agent_binary_log_create(&m_log, m_path, 7), -1);
+}
+
+TEST_F(DriverAgentBinaryLogTest, shouldAppendAndDecodeRecordsWithTruncatedSample)
+{
+    ASSERT_EQ(aeron_driver_agent_binary_log_create(&m_log, m_path, CAPACITY), 0);
+
+    uint8_t frame[AERON_AGENT_BINARY_LOG_SAMPLE_LENGTH * 2];
+    for (size_t i = 0; i < sizeof(frame); i++)
+    {
+        frame[i] = (uint8_t)i;
+    }
+
+    aeron_driver_agent_binary_log_append(&m_log, 0x08, 1, 1024, (int32_t)sizeof(frame), frame, sizeof(frame));
+    aeron_driver_agent_binary_log_append(&m_log, 0x11, 7, -1, 0, nullptr, 0);
+
+    aeron_driver_agent_binary_log_t reader;
+    ASSERT_EQ(aeron_driver_agent_binary_log_wrap(&reader, m_log.mapped_file.addr, m_log.mapped_file.length), 0);
+    EXPECT_EQ(aeron_driver_agent_binary_log_decode(&reader, on_record, this), 2u);
+
+    ASSERT_EQ(m_records.size(), 2u);
+    EXPECT_EQ(m_records[0].event_type, 0x08);
+    EXPECT_EQ(m_records[0].event_count, 1);
+    EXPECT_EQ(m_records[0].result, 1024);
+    EXPECT_EQ(m_records[0].length, (int32_t)sizeof(frame));
+    EXPECT_EQ(m_records[0].sample_length, AERON_AGENT_BINARY_LOG_SAMPLE_LENGTH);
+    EXPECT_EQ(std::memcmp(m_records[0].sample, frame, AERON_AGENT_BINARY_LOG_SAMPLE_LENGTH), 0);
+    EXPECT_GT(m_records[0].timestamp_ns, 0);
+
+    EXPECT_EQ(m_records[1].event_type, 0x11);
+    EXPECT_EQ(m_records[1].event_count, 7);
+    EXPECT_EQ(m_records[1].result, -1);
+    EXPECT_EQ(m_records[1].sample_length, 0);
+}
+
+TEST_F(DriverAgentBinaryLogTest, shouldDecodeOnlyMostRecentRecordsAfterWrap)
+{
+    ASSERT_EQ(aeron_driver_agent_binary_log_create(&m_log, m_path, CAPACITY), 0);
+
+    for (int64_t i = 0; i < (CAPACITY * 2) + 3; i++)
+    {
+        aeron_driver_agent_binary_log_append(&m_log, 0x04, i, 0, 0, nullptr, 0);
+    }
+
+    EXPECT_EQ(aeron_driver_agent_binary_log_decode(&m_log, on_record, this), (size_t)CAPACITY);
+
+    ASSERT_EQ(m_records.size(), (size_t)CAPACITY);
+    for (size_t i = 0; i < m_records.size(); i++)
+    {
+        EXPECT_EQ(m_records[i].event_count, (int64_t)(CAPACITY + 3 + i));
+    }
+}
+
+TEST_F(DriverAgentBinaryLogTest, shouldRejectBufferWithoutHeader)
+{
+    std::vector<uint8_t> buffer(aeron_driver_agent_binary_log_file_length(CAPACITY), 0);
+    aeron_driver_agent_binary_log_t reader;
+
+    EXPECT_EQ(aeron_driver_agent_binary_log_wrap(&reader, buffer.data(), buffer.size()), -1);
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+#include <arpa/inet.h>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "agent/aeron_driver_agent_pcap.h"
+}
+
+#define SNAP_LENGTH (64)
+#define QUEUE_LENGTH (64 * 1024)
+#define FRAME_LENGTH (100)
+
+#define SHB_LENGTH (28)
+#define IDB_LENGTH (32)
+#define EPB_HEADER_LENGTH (28)
+#define EPB_TRAILER_LENGTH (16)
+#define IPV4_UDP_HEADERS_LENGTH (28)
+
+class DriverAgentPcapTest : public testing::Test
+{
+public:
+    DriverAgentPcapTest()
+    {
+        std::snprintf(m_path, sizeof(m_path), "/tmp/aeron-pcap-test-%d.pcapng", (int)getpid());
+
+        for (size_t i = 0; i < sizeof(m_frame); i++)
+        {
+            m_frame[i] = (uint8_t)i;
+        }
+
+        std::memset(&m_peer, 0, sizeof(m_peer));
+        m_peer.sin_family = AF_INET;
+        m_peer.sin_port = htons(40123);
+        m_peer.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        m_iov.iov_base = m_frame;
+        m_iov.iov_len = sizeof(m_frame);
+
+        std::memset(&m_msghdr, 0, sizeof(m_msghdr));
+        m_msghdr.msg_name = &m_peer;
+        m_msghdr.msg_namelen = sizeof(m_peer);
+        m_msghdr.msg_iov = &m_iov;
+        m_msghdr.msg_iovlen = 1;
+    }
+
+    ~DriverAgentPcapTest() override
+    {
+        unlink(m_path);
+    }
+
+    std::vector<uint8_t> readFile()
+    {
+        std::ifstream in(m_path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    static uint32_t readUInt32(const std::vector<uint8_t> &data, size_t offset)
+    {
+        uint32_t value;
+        std::memcpy(&value, data.data() + offset, sizeof(value));
+        return value;
+    }
+
+protected:
+    char m_path[256];
+    uint8_t m_frame[FRAME_LENGTH];
+    struct sockaddr_in m_peer;
+    struct iovec m_iov;
+    struct msghdr m_msghdr;
+    aeron_driver_agent_pcap_writer_t m_writer;
+};
+
+TEST_F(DriverAgentPcapTest, shouldRejectInvalidSnapLength)
+{
+    EXPECT_EQ(aeron_driver_agent_pcap_writer_init(&m_writer, m_path, 0, QUEUE_LENGTH), -1);
+    EXPECT_EQ(aeron_driver_agent_pcap_writer_init(
+        &m_writer, m_path, AERON_AGENT_PCAP_MAX_SNAP_LENGTH + 1, QUEUE_LENGTH), -1);
+}
+
+TEST_F(DriverAgentPcapTest, shouldWriteTruncatedOutboundFrameWithIpAndUdpHeaders)
+{
+    ASSERT_EQ(aeron_driver_agent_pcap_writer_init(&m_writer, m_path, SNAP_LENGTH, QUEUE_LENGTH), 0);
+
+    aeron_driver_agent_pcap_capture(&m_writer, AERON_AGENT_PCAP_FRAME_OUT, -1, &m_msghdr, FRAME_LENGTH);
+    EXPECT_EQ(aeron_driver_agent_pcap_writer_poll(&m_writer), 1);
+    ASSERT_EQ(aeron_driver_agent_pcap_writer_close(&m_writer), 0);
+
+    const size_t captured_length = IPV4_UDP_HEADERS_LENGTH + SNAP_LENGTH;
+    const size_t epb_length = EPB_HEADER_LENGTH + captured_length + EPB_TRAILER_LENGTH;
+    std::vector<uint8_t> data = readFile();
+
+    ASSERT_EQ(data.size(), (size_t)(SHB_LENGTH + IDB_LENGTH + epb_length));
+    EXPECT_EQ(readUInt32(data, 0), 0x0A0D0D0Au);
+    EXPECT_EQ(readUInt32(data, 8), 0x1A2B3C4Du);
+    EXPECT_EQ(readUInt32(data, SHB_LENGTH), 1u);
+    EXPECT_EQ(readUInt32(data, SHB_LENGTH + 8) & 0xFFFF, (uint32_t)AERON_AGENT_PCAP_LINKTYPE_RAW);
+
+    const size_t epb = SHB_LENGTH + IDB_LENGTH;
+    EXPECT_EQ(readUInt32(data, epb), 6u);
+    EXPECT_EQ(readUInt32(data, epb + 4), (uint32_t)epb_length);
+    EXPECT_EQ(readUInt32(data, epb + 20), (uint32_t)captured_length);
+    EXPECT_EQ(readUInt32(data, epb + 24), (uint32_t)(IPV4_UDP_HEADERS_LENGTH + FRAME_LENGTH));
+    EXPECT_EQ(readUInt32(data, epb + epb_length - 4), (uint32_t)epb_length);
+
+    const size_t ip = epb + EPB_HEADER_LENGTH;
+    EXPECT_EQ(data[ip], 0x45);
+    EXPECT_EQ(data[ip + 9], IPPROTO_UDP);
+    EXPECT_EQ(std::memcmp(data.data() + ip + 16, &m_peer.sin_addr, 4), 0);
+    EXPECT_EQ(std::memcmp(data.data() + ip + 22, &m_peer.sin_port, 2), 0);
+    EXPECT_EQ(std::memcmp(data.data() + ip + IPV4_UDP_HEADERS_LENGTH, m_frame, SNAP_LENGTH), 0);
+
+    const size_t flags = epb + EPB_HEADER_LENGTH + captured_length + 4;
+    EXPECT_EQ(readUInt32(data, flags), 0x2u);
+}
+
+TEST_F(DriverAgentPcapTest, shouldCountDroppedFramesWhenQueueIsFull)
+{
+    ASSERT_EQ(aeron_driver_agent_pcap_writer_init(&m_writer, m_path, SNAP_LENGTH, 4096), 0);
+
+    for (int i = 0; i < 64; i++)
+    {
+        aeron_driver_agent_pcap_capture(&m_writer, AERON_AGENT_PCAP_FRAME_IN, -1, &m_msghdr, FRAME_LENGTH);
+    }
+
+    EXPECT_GT(m_writer.dropped_frames, 0);
+    EXPECT_GT(aeron_driver_agent_pcap_writer_poll(&m_writer), 0);
+    ASSERT_EQ(aeron_driver_agent_pcap_writer_close(&m_writer), 0);
+}
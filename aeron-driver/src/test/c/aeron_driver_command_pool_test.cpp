@@ -0,0 +1,114 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_driver_command_pool.h"
+#include "aeron_driver_common.h"
+}
+
+#define POOL_CAPACITY (2)
+
+class DriverCommandPoolTest : public testing::Test
+{
+public:
+    DriverCommandPoolTest()
+    {
+        if (aeron_driver_command_pool_init(&m_pool, sizeof(aeron_command_base_t), POOL_CAPACITY) < 0)
+        {
+            throw std::runtime_error("could not init command pool");
+        }
+    }
+
+    ~DriverCommandPoolTest() override
+    {
+        aeron_driver_command_pool_close(&m_pool);
+    }
+
+    bool isPooled(void *command)
+    {
+        uint8_t *address = (uint8_t *)command;
+
+        return address >= m_pool.slots && address < m_pool.slots + (m_pool.slot_length * m_pool.capacity);
+    }
+
+protected:
+    aeron_driver_command_pool_t m_pool;
+};
+
+TEST_F(DriverCommandPoolTest, shouldReuseReleasedCommand)
+{
+    auto *command = (aeron_command_base_t *)aeron_driver_command_pool_acquire(&m_pool, sizeof(aeron_command_base_t));
+    ASSERT_NE(command, nullptr);
+    EXPECT_TRUE(isPooled(command));
+
+    command->item = command;
+    aeron_driver_command_pool_release(command);
+
+    auto *reused = (aeron_command_base_t *)aeron_driver_command_pool_acquire(&m_pool, sizeof(aeron_command_base_t));
+    EXPECT_EQ(reused, command);
+    EXPECT_EQ(reused->item, nullptr);
+
+    aeron_driver_command_pool_release(reused);
+}
+
+TEST_F(DriverCommandPoolTest, shouldFallBackToHeapWhenExhausted)
+{
+    void *commands[POOL_CAPACITY];
+
+    for (auto &command : commands)
+    {
+        command = aeron_driver_command_pool_acquire(&m_pool, sizeof(aeron_command_base_t));
+        ASSERT_NE(command, nullptr);
+        EXPECT_TRUE(isPooled(command));
+    }
+
+    void *overflow = aeron_driver_command_pool_acquire(&m_pool, sizeof(aeron_command_base_t));
+    ASSERT_NE(overflow, nullptr);
+    EXPECT_FALSE(isPooled(overflow));
+    aeron_driver_command_pool_release(overflow);
+
+    EXPECT_EQ(m_pool.free_list, nullptr);
+
+    for (auto &command : commands)
+    {
+        aeron_driver_command_pool_release(command);
+    }
+
+    EXPECT_NE(m_pool.free_list, nullptr);
+}
+
+TEST_F(DriverCommandPoolTest, shouldFallBackToHeapWhenCommandDoesNotFitSlot)
+{
+    void *command = aeron_driver_command_pool_acquire(&m_pool, m_pool.slot_length);
+    ASSERT_NE(command, nullptr);
+    EXPECT_FALSE(isPooled(command));
+
+    aeron_driver_command_pool_release(command);
+}
+
+TEST_F(DriverCommandPoolTest, shouldTakeFromHeapWithoutPool)
+{
+    void *command = aeron_driver_command_pool_acquire(nullptr, sizeof(aeron_command_base_t));
+    ASSERT_NE(command, nullptr);
+    EXPECT_FALSE(isPooled(command));
+
+    aeron_driver_command_pool_release(command);
+}
@@ -120,6 +120,46 @@ TEST_F(DriverConductorIpcTest, shouldBeAbleToAddAndRemoveSingleIpcSubscription)
     EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
 }
 
+TEST_F(DriverConductorIpcTest, shouldProcessMoreThanTenCommandsInOneDutyCycle)
+{
+    int64_t client_id = nextCorrelationId();
+    const size_t num_subscriptions = 32;
+
+    for (size_t i = 0; i < num_subscriptions; i++)
+    {
+        ASSERT_EQ(addIpcSubscription(client_id, nextCorrelationId(), STREAM_ID_1, false), 0);
+    }
+
+    doWork();
+
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_subscriptions(&m_conductor.m_conductor), num_subscriptions);
+}
+
+TEST_F(DriverConductorIpcTest, shouldHandleKeepaliveAheadOfCommandsBeyondBudget)
+{
+    int64_t client_id = nextCorrelationId();
+    const size_t num_subscriptions = AERON_DRIVER_CONDUCTOR_COMMAND_BUDGET + 8;
+
+    for (size_t i = 0; i < num_subscriptions; i++)
+    {
+        ASSERT_EQ(addIpcSubscription(client_id, nextCorrelationId(), STREAM_ID_1, false), 0);
+    }
+    ASSERT_EQ(clientKeepalive(client_id), 0);
+
+    doWork();
+
+    EXPECT_EQ(
+        aeron_driver_conductor_num_ipc_subscriptions(&m_conductor.m_conductor),
+        (size_t)AERON_DRIVER_CONDUCTOR_COMMAND_BUDGET);
+    EXPECT_EQ(aeron_counter_get(m_conductor.m_conductor.client_keep_alives_counter), 1);
+    EXPECT_EQ(aeron_counter_get(m_conductor.m_conductor.commands_waiting_counter), 8);
+
+    doWork();
+
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_subscriptions(&m_conductor.m_conductor), num_subscriptions);
+    EXPECT_EQ(aeron_counter_get(m_conductor.m_conductor.commands_waiting_counter), 0);
+}
+
 TEST_F(DriverConductorIpcTest, shouldBeAbleToAddMultipleIpcPublications)
 {
     int64_t client_id = nextCorrelationId();
@@ -630,6 +670,50 @@ TEST_F(DriverConductorIpcTest, shouldBeAbleToNotTimeoutIpcPublicationOnKeepalive
     EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 1u);
 }
 
+TEST_F(DriverConductorIpcTest, shouldBeAbleToNotTimeoutIpcPublicationOnHeartbeatTimestamp)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addIpcPublication(client_id, pub_id, STREAM_ID_1, false), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
+
+    int32_t heartbeat_id = findClientHeartbeatCounterId(client_id);
+    ASSERT_GE(heartbeat_id, 0);
+
+    int64_t timeout =
+        m_context.m_context->publication_linger_timeout_ns +
+            (m_context.m_context->client_liveness_timeout_ns * 2);
+
+    doWorkUntilTimeNs(
+        timeout,
+        100,
+        [&]()
+        {
+            clientHeartbeat(heartbeat_id);
+        });
+
+    EXPECT_EQ(aeron_driver_conductor_num_clients(&m_conductor.m_conductor), 1u);
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 1u);
+}
+
+TEST_F(DriverConductorIpcTest, shouldFreeHeartbeatTimestampOnClientTimeout)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addIpcPublication(client_id, pub_id, STREAM_ID_1, false), 0);
+    doWork();
+    ASSERT_GE(findClientHeartbeatCounterId(client_id), 0);
+
+    doWorkUntilTimeNs(
+        m_context.m_context->publication_linger_timeout_ns +
+            (m_context.m_context->client_liveness_timeout_ns * 2));
+    EXPECT_EQ(aeron_driver_conductor_num_clients(&m_conductor.m_conductor), 0u);
+    EXPECT_EQ(findClientHeartbeatCounterId(client_id), -1);
+}
+
 TEST_F(DriverConductorIpcTest, shouldBeAbleToTimeoutIpcSubscription)
 {
     int64_t client_id = nextCorrelationId();
@@ -694,6 +778,39 @@ TEST_F(DriverConductorIpcTest, shouldBeAbleToNotTimeoutIpcSubscriptionOnKeepaliv
     EXPECT_EQ(aeron_driver_conductor_num_ipc_subscriptions(&m_conductor.m_conductor), 1u);
 }
 
+TEST_F(DriverConductorIpcTest, shouldKeepFindingClientsAfterOtherClientTimesOut)
+{
+    int64_t client_id1 = nextCorrelationId();
+    int64_t client_id2 = nextCorrelationId();
+    int64_t client_id3 = nextCorrelationId();
+
+    ASSERT_EQ(addIpcSubscription(client_id1, nextCorrelationId(), STREAM_ID_1, false), 0);
+    ASSERT_EQ(addIpcSubscription(client_id2, nextCorrelationId(), STREAM_ID_2, false), 0);
+    ASSERT_EQ(addIpcSubscription(client_id3, nextCorrelationId(), STREAM_ID_3, false), 0);
+    doWork();
+    EXPECT_EQ(aeron_driver_conductor_num_clients(&m_conductor.m_conductor), 3u);
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 3u);
+
+    int64_t timeout =
+        m_context.m_context->publication_linger_timeout_ns +
+            (m_context.m_context->client_liveness_timeout_ns * 2);
+
+    doWorkUntilTimeNs(
+        timeout,
+        100,
+        [&]()
+        {
+            clientKeepalive(client_id2);
+            clientKeepalive(client_id3);
+        });
+
+    EXPECT_EQ(aeron_driver_conductor_num_clients(&m_conductor.m_conductor), 2u);
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_subscriptions(&m_conductor.m_conductor), 2u);
+    EXPECT_EQ(aeron_driver_conductor_find_client(&m_conductor.m_conductor, client_id1), -1);
+    EXPECT_GE(aeron_driver_conductor_find_client(&m_conductor.m_conductor, client_id2), 0);
+    EXPECT_GE(aeron_driver_conductor_find_client(&m_conductor.m_conductor, client_id3), 0);
+}
+
 TEST_F(DriverConductorIpcTest, shouldBeAbleToTimeoutIpcPublicationWithActiveIpcSubscription)
 {
     int64_t client_id = nextCorrelationId();
@@ -737,3 +854,170 @@ TEST_F(DriverConductorIpcTest, shouldBeAbleToTimeoutIpcPublicationWithActiveIpcS
     EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
 }
 
+
+TEST_F(DriverConductorIpcTest, shouldCleanIpcPublicationTermsInChunks)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    const int64_t chunk_length = 4096;
+
+    m_context.m_context->term_buffer_clean_chunk_length = (size_t)chunk_length;
+
+    ASSERT_EQ(addIpcPublication(client_id, pub_id, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addIpcSubscription(client_id, sub_id, STREAM_ID_1, false), 0);
+    doWork();
+
+    aeron_ipc_publication_t *publication =
+        aeron_driver_conductor_find_ipc_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_ipc_publication_t *)NULL);
+    ASSERT_EQ(publication->conductor_fields.subscribable.length, 1u);
+
+    uint8_t *term_buffer = publication->mapped_raw_log.term_buffers[0].addr;
+    memset(term_buffer, 0xFF, TERM_LENGTH);
+
+    aeron_counter_set_ordered(publication->conductor_fields.subscribable.array[0].value_addr, TERM_LENGTH);
+    doWork();
+
+    EXPECT_EQ(publication->conductor_fields.cleaning_position, chunk_length);
+    EXPECT_EQ(term_buffer[chunk_length - 1], 0u);
+    EXPECT_EQ(term_buffer[chunk_length], 0xFFu);
+
+    for (int i = 0; i < (TERM_LENGTH / chunk_length) - 1; i++)
+    {
+        doWork();
+    }
+
+    EXPECT_EQ(publication->conductor_fields.cleaning_position, TERM_LENGTH);
+    for (int i = 0; i < TERM_LENGTH; i++)
+    {
+        ASSERT_EQ(term_buffer[i], 0u) << i;
+    }
+}
+
+TEST_F(DriverConductorIpcTest, shouldNotLetIpcPublicationLimitPassPartitionStillBeingCleaned)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    const int64_t chunk_length = 4096;
+
+    m_context.m_context->term_buffer_clean_chunk_length = (size_t)chunk_length;
+
+    ASSERT_EQ(addIpcPublication(client_id, pub_id, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addIpcSubscription(client_id, sub_id, STREAM_ID_1, false), 0);
+    doWork();
+
+    aeron_ipc_publication_t *publication =
+        aeron_driver_conductor_find_ipc_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_ipc_publication_t *)NULL);
+
+    aeron_counter_set_ordered(publication->conductor_fields.subscribable.array[0].value_addr, 2 * TERM_LENGTH);
+    doWork();
+
+    EXPECT_EQ(publication->conductor_fields.cleaning_position, chunk_length);
+    EXPECT_EQ(
+        aeron_counter_get(publication->pub_lmt_position.value_addr),
+        ((AERON_LOGBUFFER_PARTITION_COUNT - 1) * TERM_LENGTH) + chunk_length);
+}
+
+TEST_F(DriverConductorIpcTest, shouldFollowSlowestIpcSubscriberWhenOthersAdvance)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+    const size_t subscriber_count = 3;
+
+    ASSERT_EQ(addIpcPublication(client_id, pub_id, STREAM_ID_1, false), 0);
+    for (size_t i = 0; i < subscriber_count; i++)
+    {
+        ASSERT_EQ(addIpcSubscription(client_id, nextCorrelationId(), STREAM_ID_1, false), 0);
+    }
+    doWork();
+
+    aeron_ipc_publication_t *publication =
+        aeron_driver_conductor_find_ipc_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_ipc_publication_t *)NULL);
+    ASSERT_EQ(publication->conductor_fields.subscribable.length, subscriber_count);
+
+    aeron_position_t *positions = publication->conductor_fields.subscribable.array;
+    const int64_t window_length = publication->term_window_length;
+    const int64_t initial_limit = aeron_counter_get(publication->pub_lmt_position.value_addr);
+
+    aeron_counter_set_ordered(positions[0].value_addr, TERM_LENGTH);
+    aeron_counter_set_ordered(positions[1].value_addr, TERM_LENGTH);
+    doWork();
+
+    EXPECT_EQ(aeron_counter_get(publication->pub_lmt_position.value_addr), initial_limit);
+
+    aeron_counter_set_ordered(positions[2].value_addr, TERM_LENGTH / 2);
+    doWork();
+
+    EXPECT_EQ(aeron_counter_get(publication->pub_lmt_position.value_addr), (TERM_LENGTH / 2) + window_length);
+
+    aeron_counter_set_ordered(positions[0].value_addr, 2 * TERM_LENGTH);
+    aeron_counter_set_ordered(positions[2].value_addr, TERM_LENGTH);
+    doWork();
+
+    EXPECT_EQ(aeron_counter_get(publication->pub_lmt_position.value_addr), TERM_LENGTH + window_length);
+    EXPECT_EQ(aeron_ipc_publication_joining_position(publication), 2 * TERM_LENGTH);
+}
+
+TEST_F(DriverConductorIpcTest, shouldUnblockSharedIpcPublicationWhenClientTimesOutMidClaim)
+{
+    int64_t client_id1 = nextCorrelationId();
+    int64_t client_id2 = nextCorrelationId();
+    int64_t pub_id1 = nextCorrelationId();
+    int64_t pub_id2 = nextCorrelationId();
+    const int32_t claim_length = 64;
+
+    m_context.m_context->publication_unblock_timeout_ns = m_context.m_context->client_liveness_timeout_ns * 100;
+
+    ASSERT_EQ(addIpcPublication(client_id1, pub_id1, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addIpcPublication(client_id2, pub_id2, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addIpcSubscription(client_id2, nextCorrelationId(), STREAM_ID_1, false), 0);
+    doWork();
+
+    aeron_ipc_publication_t *publication =
+        aeron_driver_conductor_find_ipc_publication(&m_conductor.m_conductor, pub_id1);
+    ASSERT_NE(publication, (aeron_ipc_publication_t *)NULL);
+
+    /* the first client claims a frame and dies before it commits */
+    aeron_frame_header_t *frame_header = (aeron_frame_header_t *)publication->mapped_raw_log.term_buffers[0].addr;
+    frame_header->frame_length = -claim_length;
+    publication->log_meta_data->term_tail_counters[0] += claim_length;
+
+    int64_t *unblocked_publications = aeron_system_counter_addr(
+        &m_conductor.m_conductor.system_counters, AERON_SYSTEM_COUNTER_UNBLOCKED_PUBLICATIONS);
+
+    doWorkUntilTimeNs(
+        m_context.m_context->client_liveness_timeout_ns * 2,
+        100,
+        [&]()
+        {
+            clientKeepalive(client_id2);
+        });
+
+    EXPECT_EQ(aeron_driver_conductor_find_client(&m_conductor.m_conductor, client_id1), -1);
+    EXPECT_EQ(aeron_counter_get(unblocked_publications), 1);
+    EXPECT_EQ(frame_header->frame_length, claim_length);
+    EXPECT_EQ(frame_header->type, AERON_HDR_TYPE_PAD);
+}
+
+TEST_F(DriverConductorIpcTest, shouldFailToAddDurableIpcPublicationWithoutDurableDir)
+{
+    int64_t client_id = nextCorrelationId();
+
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        ASSERT_EQ(msgTypeId, AERON_RESPONSE_ON_ERROR);
+    };
+
+    ASSERT_EQ(addNetworkPublication(client_id, nextCorrelationId(), "aeron:ipc?durable=true", STREAM_ID_1, false), 0);
+    ASSERT_EQ(addNetworkPublication(
+        client_id, nextCorrelationId(), "aeron:udp?endpoint=localhost:40001|durable=true", STREAM_ID_1, false), 0);
+    doWork();
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 2u);
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 0u);
+    EXPECT_EQ(aeron_driver_conductor_num_network_publications(&m_conductor.m_conductor), 0u);
+}
@@ -14,14 +14,59 @@
  * limitations under the License.
  */
 
+#include <set>
+
 #include "aeron_driver_conductor_test.h"
 
+extern "C"
+{
+#include "aeron_name_resolver.h"
+}
+
 class DriverConductorNetworkTest : public DriverConductorTest
 {
 public:
     DriverConductorNetworkTest() : DriverConductorTest()
     {
     }
+
+protected:
+    void addPendingSetup(
+        aeron_driver_receiver_t *receiver,
+        aeron_receive_channel_endpoint_t *endpoint,
+        int32_t session_id,
+        int64_t time_ms,
+        bool is_periodic)
+    {
+        struct sockaddr_storage control_addr = {};
+        fill_sockaddr_ipv4(&control_addr, CONTROL_IP_ADDR, CONTROL_UDP_PORT);
+
+        ms_timestamp = time_ms;
+        ASSERT_EQ(aeron_driver_receiver_add_pending_setup(
+            receiver, endpoint, session_id, STREAM_ID_1, is_periodic ? &control_addr : NULL), 0) << aeron_errmsg();
+    }
+
+    static void expectPendingSetupHeap(aeron_driver_receiver_t *receiver)
+    {
+        aeron_driver_receiver_pending_setup_entry_t *array = receiver->pending_setups.array;
+
+        for (size_t i = 1; i < receiver->pending_setups.length; i++)
+        {
+            EXPECT_LE(array[(i - 1) / 2].time_of_status_message_ns, array[i].time_of_status_message_ns) << i;
+        }
+    }
+
+    static std::set<int32_t> pendingSetupSessionIds(aeron_driver_receiver_t *receiver)
+    {
+        std::set<int32_t> session_ids;
+
+        for (size_t i = 0; i < receiver->pending_setups.length; i++)
+        {
+            session_ids.insert(receiver->pending_setups.array[i].session_id);
+        }
+
+        return session_ids;
+    }
 };
 
 TEST_F(DriverConductorNetworkTest, shouldBeAbleToAddSingleNetworkPublication)
@@ -82,6 +127,194 @@ TEST_F(DriverConductorNetworkTest, shouldBeAbleToAddAndRemoveSingleNetworkPublic
     EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
 }
 
+TEST_F(DriverConductorNetworkTest, shouldCompleteAddOfNetworkPublicationOnceNameResolverHasResolvedChannel)
+{
+    aeron_name_resolver_t resolver;
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(aeron_name_resolver_init(&resolver), 0);
+    m_context.m_context->name_resolver = &resolver;
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+    EXPECT_EQ(aeron_driver_conductor_num_network_publications(&m_conductor.m_conductor), 0u);
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 0u);
+
+    EXPECT_EQ(aeron_name_resolver_do_work(&resolver), 1);
+    EXPECT_EQ(aeron_name_resolver_do_work(&resolver), 0);
+    doWork();
+    EXPECT_EQ(aeron_driver_conductor_num_network_publications(&m_conductor.m_conductor), 1u);
+    EXPECT_EQ(aeron_driver_conductor_num_network_subscriptions(&m_conductor.m_conductor), 1u);
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 2u);
+
+    aeron_name_resolver_on_close(&resolver);
+    m_context.m_context->name_resolver = NULL;
+}
+
+TEST_F(DriverConductorNetworkTest, shouldFailAddOfNetworkPublicationOnChannelNameResolverFailedToResolve)
+{
+    const char *invalid_channel = "aeron:udp?endpoint=224.10.9.8";
+    aeron_name_resolver_t resolver;
+    int64_t client_id = nextCorrelationId();
+
+    ASSERT_EQ(aeron_name_resolver_init(&resolver), 0);
+    m_context.m_context->name_resolver = &resolver;
+
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        ASSERT_EQ(msgTypeId, AERON_RESPONSE_ON_ERROR);
+    };
+
+    ASSERT_EQ(addNetworkPublication(client_id, nextCorrelationId(), invalid_channel, STREAM_ID_1, false), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 0u);
+
+    EXPECT_EQ(aeron_name_resolver_do_work(&resolver), 1);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
+
+    ASSERT_EQ(addNetworkPublication(client_id, nextCorrelationId(), invalid_channel, STREAM_ID_1, false), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
+    EXPECT_EQ(aeron_name_resolver_do_work(&resolver), 0);
+
+    aeron_name_resolver_on_close(&resolver);
+    m_context.m_context->name_resolver = NULL;
+}
+
+TEST_F(DriverConductorNetworkTest, shouldAssignSendChannelEndpointsToLeastLoadedOrAffineSender)
+{
+    aeron_driver_sender_t *second_sender = &m_conductor.m_second_sender;
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id_1 = nextCorrelationId();
+    int64_t pub_id_2 = nextCorrelationId();
+    int64_t pub_id_3 = nextCorrelationId();
+
+    m_context.m_context->sender_count = 2;
+    m_context.m_context->sender_proxies[0] = &m_conductor.m_sender.sender_proxy;
+    m_context.m_context->sender_proxies[1] = &second_sender->sender_proxy;
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id_1, CHANNEL_1, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id_2, CHANNEL_2, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addNetworkPublication(
+        client_id, pub_id_3, "aeron:udp?endpoint=localhost:40003|sender-affinity=3", STREAM_ID_1, false), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 3u);
+
+    aeron_network_publication_t *publication_1 =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id_1);
+    aeron_network_publication_t *publication_2 =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id_2);
+    aeron_network_publication_t *publication_3 =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id_3);
+
+    ASSERT_NE(publication_1, (aeron_network_publication_t *)NULL);
+    ASSERT_NE(publication_2, (aeron_network_publication_t *)NULL);
+    ASSERT_NE(publication_3, (aeron_network_publication_t *)NULL);
+
+    EXPECT_EQ(publication_1->endpoint->sender_proxy, &m_conductor.m_sender.sender_proxy);
+    EXPECT_EQ(publication_2->endpoint->sender_proxy, &second_sender->sender_proxy);
+    EXPECT_EQ(publication_3->endpoint->sender_proxy, &second_sender->sender_proxy);
+    EXPECT_EQ(m_conductor.m_sender.network_publicaitons.length, 1u);
+    EXPECT_EQ(second_sender->network_publicaitons.length, 2u);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldCoalesceStatusMessagesFromEachReceiverWithinSenderPoll)
+{
+    aeron_driver_sender_t *sender = &m_conductor.m_sender;
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
+
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+
+    uint8_t buffer[sizeof(aeron_status_message_header_t)];
+    aeron_status_message_header_t *sm = (aeron_status_message_header_t *)buffer;
+    struct sockaddr_storage addr = {};
+    memset(buffer, 0, sizeof(buffer));
+    sm->frame_header.frame_length = sizeof(aeron_status_message_header_t);
+    sm->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    sm->frame_header.type = AERON_HDR_TYPE_SM;
+    sm->session_id = publication->session_id;
+    sm->stream_id = publication->stream_id;
+    sm->consumption_term_id = publication->initial_term_id;
+    sm->receiver_window = 64 * 1024;
+
+    auto on_status_message = [&](int64_t receiver_id, int32_t term_offset)
+    {
+        sm->receiver_id = receiver_id;
+        sm->consumption_term_offset = term_offset;
+        aeron_send_channel_endpoint_dispatch(sender, publication->endpoint, buffer, sizeof(buffer), &addr);
+    };
+
+    sender->pending_status_messages.is_coalescing = true;
+    on_status_message(1, 4096);
+    on_status_message(1, 1024);
+    on_status_message(2, 2048);
+
+    ASSERT_EQ(sender->pending_status_messages.length, 2u);
+    EXPECT_EQ(
+        ((aeron_status_message_header_t *)sender->pending_status_messages.array[0].buffer)->consumption_term_offset,
+        1024);
+    EXPECT_FALSE(publication->sender_fields.has_receivers);
+
+    aeron_driver_sender_flush_status_messages(sender);
+    sender->pending_status_messages.is_coalescing = false;
+
+    EXPECT_EQ(sender->pending_status_messages.length, 0u);
+    EXPECT_TRUE(publication->sender_fields.has_receivers);
+    EXPECT_EQ(*publication->snd_lmt_position.value_addr, 2048 + 64 * 1024);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldPollForStatusMessagesSoonerAsWindowRunsOutWhenAdaptive)
+{
+    aeron_driver_sender_t *sender = &m_conductor.m_sender;
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
+
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+
+    EXPECT_EQ(aeron_driver_sender_adaptive_poll_ratio(sender), sender->duty_cycle_ratio * 2);
+
+    uint8_t buffer[sizeof(aeron_status_message_header_t)];
+    aeron_status_message_header_t *sm = (aeron_status_message_header_t *)buffer;
+    struct sockaddr_storage addr = {};
+    memset(buffer, 0, sizeof(buffer));
+    sm->frame_header.frame_length = sizeof(aeron_status_message_header_t);
+    sm->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    sm->frame_header.type = AERON_HDR_TYPE_SM;
+    sm->session_id = publication->session_id;
+    sm->stream_id = publication->stream_id;
+    sm->consumption_term_id = publication->initial_term_id;
+    sm->receiver_window = 64 * 1024;
+    sm->receiver_id = 1;
+
+    aeron_send_channel_endpoint_dispatch(sender, publication->endpoint, buffer, sizeof(buffer), &addr);
+    ASSERT_EQ(*publication->snd_lmt_position.value_addr, 64 * 1024);
+
+    EXPECT_EQ(aeron_driver_sender_adaptive_poll_ratio(sender), sender->duty_cycle_ratio * 2);
+
+    aeron_counter_set_ordered(publication->snd_pos_position.value_addr, 40 * 1024);
+    EXPECT_EQ(aeron_driver_sender_adaptive_poll_ratio(sender), sender->duty_cycle_ratio);
+
+    aeron_counter_set_ordered(publication->snd_pos_position.value_addr, 60 * 1024);
+    EXPECT_EQ(aeron_driver_sender_adaptive_poll_ratio(sender), 1u);
+}
+
 TEST_F(DriverConductorNetworkTest, shouldBeAbleToAddSingleNetworkSubscription)
 {
     int64_t client_id = nextCorrelationId();
@@ -108,6 +341,40 @@ TEST_F(DriverConductorNetworkTest, shouldBeAbleToAddSingleNetworkSubscription)
     EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
 }
 
+TEST_F(DriverConductorNetworkTest, shouldAssignReceiveChannelEndpointsToLeastLoadedReceiver)
+{
+    aeron_driver_receiver_t *second_receiver = &m_conductor.m_second_receiver;
+
+    m_context.m_context->receiver_count = 2;
+    m_context.m_context->receiver_proxies[0] = &m_conductor.m_receiver.receiver_proxy;
+    m_context.m_context->receiver_proxies[1] = &second_receiver->receiver_proxy;
+
+    int64_t client_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, nextCorrelationId(), CHANNEL_1, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, nextCorrelationId(), CHANNEL_2, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, nextCorrelationId(), CHANNEL_3, STREAM_ID_1, -1), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 3u);
+
+    aeron_receive_channel_endpoint_t *endpoint_1 =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+    aeron_receive_channel_endpoint_t *endpoint_2 =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_2);
+    aeron_receive_channel_endpoint_t *endpoint_3 =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_3);
+
+    ASSERT_NE(endpoint_1, (aeron_receive_channel_endpoint_t *)NULL);
+    ASSERT_NE(endpoint_2, (aeron_receive_channel_endpoint_t *)NULL);
+    ASSERT_NE(endpoint_3, (aeron_receive_channel_endpoint_t *)NULL);
+
+    EXPECT_EQ(endpoint_1->receiver_proxy, &m_conductor.m_receiver.receiver_proxy);
+    EXPECT_EQ(endpoint_2->receiver_proxy, &second_receiver->receiver_proxy);
+    EXPECT_EQ(endpoint_3->receiver_proxy, &m_conductor.m_receiver.receiver_proxy);
+    EXPECT_EQ(m_conductor.m_receiver.receiver_proxy.endpoint_count, 2u);
+    EXPECT_EQ(second_receiver->receiver_proxy.endpoint_count, 1u);
+}
+
 TEST_F(DriverConductorNetworkTest, shouldBeAbleToAddAndRemoveSingleNetworkSubscription)
 {
     int64_t client_id = nextCorrelationId();
@@ -295,6 +562,95 @@ TEST_F(DriverConductorNetworkTest, shouldBeAbleToAddMultipleExclusiveNetworkPubl
     EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 4u);
 }
 
+#define RESUMABLE_CHANNEL_1 CHANNEL_1 "|resume-token=7"
+
+TEST_F(DriverConductorNetworkTest, shouldResumeExclusiveNetworkPublicationWithSameResumeToken)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id_1 = nextCorrelationId();
+    int64_t pub_id_2 = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id_1, RESUMABLE_CHANNEL_1, STREAM_ID_1, true), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
+
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id_1);
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+
+    ASSERT_EQ(removePublication(client_id, nextCorrelationId(), pub_id_1), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
+    EXPECT_EQ(publication->conductor_fields.status, AERON_NETWORK_PUBLICATION_STATUS_RESUMABLE);
+    EXPECT_EQ(publication->log_meta_data->end_of_stream_position, INT64_MAX);
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id_2, RESUMABLE_CHANNEL_1, STREAM_ID_1, true), 0);
+    doWork();
+
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        ASSERT_EQ(msgTypeId, AERON_RESPONSE_ON_EXCLUSIVE_PUBLICATION_READY);
+
+        const command::PublicationBuffersReadyFlyweight response(buffer, offset);
+
+        EXPECT_EQ(response.correlationId(), pub_id_2);
+        EXPECT_EQ(response.registrationId(), pub_id_1);
+        EXPECT_EQ(response.sessionId(), publication->session_id);
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
+    EXPECT_EQ(aeron_driver_conductor_num_network_publications(&m_conductor.m_conductor), 1u);
+    EXPECT_EQ(publication->conductor_fields.status, AERON_NETWORK_PUBLICATION_STATUS_ACTIVE);
+    EXPECT_EQ(publication->conductor_fields.refcnt, 1);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldErrorOnResumeTokenInUseOrForNonExclusivePublication)
+{
+    int64_t client_id = nextCorrelationId();
+
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        ASSERT_EQ(msgTypeId, AERON_RESPONSE_ON_ERROR);
+    };
+
+    ASSERT_EQ(addNetworkPublication(client_id, nextCorrelationId(), RESUMABLE_CHANNEL_1, STREAM_ID_1, false), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
+
+    ASSERT_EQ(addNetworkPublication(client_id, nextCorrelationId(), RESUMABLE_CHANNEL_1, STREAM_ID_1, true), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
+
+    ASSERT_EQ(addNetworkPublication(client_id, nextCorrelationId(), RESUMABLE_CHANNEL_1, STREAM_ID_1, true), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
+    EXPECT_EQ(aeron_driver_conductor_num_network_publications(&m_conductor.m_conductor), 1u);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldEndStreamOfResumablePublicationOnceResumeTimeoutExpires)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    m_context.m_context->publication_resume_timeout_ns = 1000 * 1000 * 1000L;
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, RESUMABLE_CHANNEL_1, STREAM_ID_1, true), 0);
+    doWork();
+
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+
+    ASSERT_EQ(removePublication(client_id, nextCorrelationId(), pub_id), 0);
+    doWork();
+    EXPECT_EQ(publication->conductor_fields.status, AERON_NETWORK_PUBLICATION_STATUS_RESUMABLE);
+
+    doWorkUntilTimeNs(ms_timestamp + 3000);
+    EXPECT_NE(publication->conductor_fields.status, AERON_NETWORK_PUBLICATION_STATUS_RESUMABLE);
+    EXPECT_FALSE(publication->is_resumable);
+    EXPECT_EQ(publication->log_meta_data->end_of_stream_position, 0);
+}
+
 TEST_F(DriverConductorNetworkTest, shouldBeAbleToAddMultipleNetworkSubscriptionsWithSameChannelSameStreamId)
 {
     int64_t client_id = nextCorrelationId();
@@ -354,6 +710,55 @@ TEST_F(DriverConductorNetworkTest, shouldBeAbleToAddMultipleNetworkSubscriptions
     EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 4u);
 }
 
+TEST_F(DriverConductorNetworkTest, shouldShareChannelEndpointsReferredToByTag)
+{
+    int64_t client_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(
+        client_id, nextCorrelationId(), "aeron:udp?endpoint=localhost:40001|tags=1001", STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, nextCorrelationId(), "aeron:udp?tags=1001", STREAM_ID_2, -1), 0);
+    ASSERT_EQ(addNetworkPublication(
+        client_id, nextCorrelationId(), "aeron:udp?endpoint=localhost:40002|tags=1002", STREAM_ID_1, false), 0);
+    ASSERT_EQ(addNetworkPublication(client_id, nextCorrelationId(), "aeron:udp?tags=1002", STREAM_ID_2, false), 0);
+
+    doWork();
+
+    ASSERT_EQ(aeron_driver_conductor_num_receive_channel_endpoints(&m_conductor.m_conductor), 1u);
+    ASSERT_EQ(aeron_driver_conductor_num_network_subscriptions(&m_conductor.m_conductor), 2u);
+    ASSERT_EQ(aeron_driver_conductor_num_send_channel_endpoints(&m_conductor.m_conductor), 1u);
+    ASSERT_EQ(aeron_driver_conductor_num_network_publications(&m_conductor.m_conductor), 2u);
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 4u);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldErrorOnAddSubscriptionWithUnknownOrConflictingTag)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id_1 = nextCorrelationId();
+    int64_t sub_id_2 = nextCorrelationId();
+    int64_t sub_id_3 = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_1, "aeron:udp?tags=1001", STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_2, "aeron:udp?endpoint=localhost:40001|tags=1001", STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_3, "aeron:udp?endpoint=localhost:40002|tags=1001", STREAM_ID_1, -1), 0);
+
+    doWork();
+
+    std::vector<int64_t> failed;
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        if (AERON_RESPONSE_ON_ERROR == msgTypeId)
+        {
+            const command::ErrorResponseFlyweight response(buffer, offset);
+            failed.push_back(response.offendingCommandCorrelationId());
+        }
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 3u);
+    EXPECT_EQ(failed, std::vector<int64_t>({ sub_id_1, sub_id_3 }));
+    EXPECT_EQ(aeron_driver_conductor_num_receive_channel_endpoints(&m_conductor.m_conductor), 1u);
+}
+
 TEST_F(DriverConductorNetworkTest, shouldKeepSubscriptionMediaEndpointUponRemovalOfAllButOneSubscriber)
 {
     int64_t client_id = nextCorrelationId();
@@ -655,31 +1060,142 @@ TEST_F(DriverConductorNetworkTest, shouldCreatePublicationImageForActiveNetworkS
     EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
 }
 
-TEST_F(DriverConductorNetworkTest, shouldNotCreatePublicationImageForNonActiveNetworkSubscription)
+TEST_F(DriverConductorNetworkTest, shouldCreateImageThatFillsGapsForUnreliableSubscription)
 {
     int64_t client_id = nextCorrelationId();
     int64_t sub_id = nextCorrelationId();
 
-    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1 "|reliable=false", STREAM_ID_1, -1), 0);
     doWork();
     EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
 
     aeron_receive_channel_endpoint_t *endpoint =
-        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1 "|reliable=false");
+    ASSERT_NE(endpoint, (aeron_receive_channel_endpoint_t *)NULL);
 
-    createPublicationImage(endpoint, STREAM_ID_2, 1000);
+    createPublicationImage(endpoint, STREAM_ID_1, 1000);
 
-    EXPECT_EQ(aeron_driver_conductor_num_images(&m_conductor.m_conductor), 0u);
+    aeron_publication_image_t *image =
+        aeron_driver_conductor_find_publication_image(&m_conductor.m_conductor, endpoint, STREAM_ID_1);
 
-    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 0u);
+    ASSERT_NE(image, (aeron_publication_image_t *)NULL);
+    EXPECT_FALSE(image->conductor_fields.is_reliable);
+    EXPECT_EQ(image->conductor_fields.loss_detector.fixed_delay_ns, 0);
 }
 
-TEST_F(DriverConductorNetworkTest, shouldRemoveSubscriptionFromImageWhenRemoveSubscription)
+TEST_F(DriverConductorNetworkTest, shouldErrorOnAddSubscriptionWithConflictingReliability)
 {
     int64_t client_id = nextCorrelationId();
-    int64_t sub_id = nextCorrelationId();
+    int64_t sub_id_1 = nextCorrelationId();
+    int64_t sub_id_2 = nextCorrelationId();
+    int64_t sub_id_3 = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_1, CHANNEL_1, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_2, CHANNEL_1 "|reliable=false", STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_3, CHANNEL_1 "|reliable=false", STREAM_ID_2, -1), 0);
 
-    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    std::vector<int64_t> failed;
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        if (AERON_RESPONSE_ON_ERROR == msgTypeId)
+        {
+            const command::ErrorResponseFlyweight response(buffer, offset);
+            failed.push_back(response.offendingCommandCorrelationId());
+        }
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 3u);
+    EXPECT_EQ(failed, std::vector<int64_t>({ sub_id_2 }));
+}
+
+TEST_F(DriverConductorNetworkTest, shouldNotCreatePublicationImageForNonActiveNetworkSubscription)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+
+    createPublicationImage(endpoint, STREAM_ID_2, 1000);
+
+    EXPECT_EQ(aeron_driver_conductor_num_images(&m_conductor.m_conductor), 0u);
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 0u);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldCreatePublicationImagesForStreamsInRangeOfNetworkSubscription)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    const char *channel = CHANNEL_1 "|streams=101-103";
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, channel, STREAM_ID_1, -1), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, channel);
+    ASSERT_NE(endpoint, (aeron_receive_channel_endpoint_t *)NULL);
+
+    EXPECT_TRUE(aeron_driver_conductor_has_network_subscription_interest(
+        &m_conductor.m_conductor, endpoint, STREAM_ID_3));
+    EXPECT_FALSE(aeron_driver_conductor_has_network_subscription_interest(
+        &m_conductor.m_conductor, endpoint, STREAM_ID_4));
+
+    createPublicationImage(endpoint, STREAM_ID_2, 1000);
+    createPublicationImage(endpoint, STREAM_ID_3, 1000);
+    createPublicationImage(endpoint, STREAM_ID_4, 1000);
+
+    EXPECT_EQ(aeron_driver_conductor_num_images(&m_conductor.m_conductor), 2u);
+
+    std::vector<int32_t> stream_ids;
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        ASSERT_EQ(msgTypeId, AERON_RESPONSE_ON_AVAILABLE_IMAGE);
+
+        const command::ImageBuffersReadyFlyweight response(buffer, offset);
+
+        EXPECT_EQ(response.subscriberRegistrationId(), sub_id);
+        stream_ids.push_back(response.streamId());
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 2u);
+    EXPECT_EQ(stream_ids, std::vector<int32_t>({ STREAM_ID_2, STREAM_ID_3 }));
+}
+
+TEST_F(DriverConductorNetworkTest, shouldErrorOnAddNetworkSubscriptionWithStreamOutsideRange)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1 "|streams=101-103", STREAM_ID_4, -1), 0);
+    doWork();
+
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        ASSERT_EQ(msgTypeId, AERON_RESPONSE_ON_ERROR);
+
+        const command::ErrorResponseFlyweight response(buffer, offset);
+
+        EXPECT_EQ(response.offendingCommandCorrelationId(), sub_id);
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
+    EXPECT_EQ(aeron_driver_conductor_num_receive_channel_endpoints(&m_conductor.m_conductor), 0u);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldRemoveSubscriptionFromImageWhenRemoveSubscription)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
     doWork();
     EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
 
@@ -910,6 +1426,50 @@ TEST_F(DriverConductorNetworkTest, shouldSendAvailableImageForSecondSubscription
     EXPECT_EQ(readAllBroadcastsFromConductor(handler), 4u);
 }
 
+TEST_F(DriverConductorNetworkTest, shouldSendOneAvailableImagesForAllSubscriptionsWhenBatching)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id_1 = nextCorrelationId();
+    int64_t sub_id_2 = nextCorrelationId();
+
+    m_context.m_context->available_image_batching = true;
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_1, CHANNEL_1, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_2, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 2u);
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+
+    createPublicationImage(endpoint, STREAM_ID_1, 1000);
+
+    aeron_publication_image_t *image =
+        aeron_driver_conductor_find_publication_image(&m_conductor.m_conductor, endpoint, STREAM_ID_1);
+
+    ASSERT_NE(image, (aeron_publication_image_t *)NULL);
+
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        ASSERT_EQ(msgTypeId, AERON_RESPONSE_ON_AVAILABLE_IMAGES);
+
+        command::ImageBuffersReadyBatchFlyweight response(buffer, offset);
+
+        EXPECT_EQ(response.sessionId(), SESSION_ID);
+        EXPECT_EQ(response.streamId(), STREAM_ID_1);
+        EXPECT_EQ(response.correlationId(), aeron_publication_image_registration_id(image));
+        ASSERT_EQ(response.subscriberCount(), 2);
+        EXPECT_EQ(response.subscriberRegistrationId(0), sub_id_1);
+        EXPECT_EQ(response.subscriberRegistrationId(1), sub_id_2);
+        EXPECT_NE(response.subscriberPositionId(0), response.subscriberPositionId(1));
+        EXPECT_EQ(std::string(aeron_publication_image_log_file_name(image)), response.logFileName());
+        EXPECT_EQ(SOURCE_IDENTITY, response.sourceIdentity());
+        EXPECT_EQ(response.length(), length);
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 1u);
+}
+
 TEST_F(DriverConductorNetworkTest, shouldTimeoutImageAndSendUnavailableImageWhenNoAcitvityForMultipleSubscriptions)
 {
     int64_t client_id = nextCorrelationId();
@@ -1009,3 +1569,305 @@ TEST_F(DriverConductorNetworkTest, shouldTimeoutImageAndSendUnavailableImageWhen
 
     EXPECT_EQ(readAllBroadcastsFromConductor(handler), 6u);
 }
+
+TEST_F(DriverConductorNetworkTest, shouldBackOffStatusMessagesForIdleImageWhenAdaptive)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    const int64_t sm_timeout_ns = (int64_t)m_context.m_context->status_message_timeout_ns;
+
+    m_context.m_context->status_message_adaptive = true;
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+
+    createPublicationImage(endpoint, STREAM_ID_1, 1000);
+
+    aeron_publication_image_t *image =
+        aeron_driver_conductor_find_publication_image(&m_conductor.m_conductor, endpoint, STREAM_ID_1);
+    ASSERT_NE(image, (aeron_publication_image_t *)NULL);
+
+    int64_t now_ns = sm_timeout_ns + 1;
+    aeron_publication_image_track_rebuild(image, now_ns, sm_timeout_ns);
+    EXPECT_EQ(image->conductor_fields.last_status_mesage_timestamp, now_ns);
+
+    int64_t last_sm_ns = now_ns;
+    aeron_publication_image_track_rebuild(image, last_sm_ns + sm_timeout_ns + 1, sm_timeout_ns);
+    EXPECT_EQ(image->conductor_fields.last_status_mesage_timestamp, last_sm_ns);
+
+    now_ns = last_sm_ns + (2 * sm_timeout_ns) + 1;
+    aeron_publication_image_track_rebuild(image, now_ns, sm_timeout_ns);
+    EXPECT_EQ(image->conductor_fields.last_status_mesage_timestamp, now_ns);
+
+    last_sm_ns = now_ns;
+    aeron_publication_image_track_rebuild(image, last_sm_ns + (2 * sm_timeout_ns) + 1, sm_timeout_ns);
+    EXPECT_EQ(image->conductor_fields.last_status_mesage_timestamp, last_sm_ns);
+
+    now_ns = last_sm_ns + (4 * sm_timeout_ns) + 1;
+    aeron_publication_image_track_rebuild(image, now_ns, sm_timeout_ns);
+    EXPECT_EQ(image->conductor_fields.last_status_mesage_timestamp, now_ns);
+    EXPECT_EQ(image->conductor_fields.sm_idle_backoff_shift, AERON_PUBLICATION_IMAGE_MAX_SM_IDLE_BACKOFF_SHIFT);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldSendStatusMessageSoonerNearWindowEdgeWhenAdaptive)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    const int64_t sm_timeout_ns = (int64_t)m_context.m_context->status_message_timeout_ns;
+
+    m_context.m_context->status_message_adaptive = true;
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+
+    createPublicationImage(endpoint, STREAM_ID_1, 1000);
+
+    aeron_publication_image_t *image =
+        aeron_driver_conductor_find_publication_image(&m_conductor.m_conductor, endpoint, STREAM_ID_1);
+    ASSERT_NE(image, (aeron_publication_image_t *)NULL);
+    ASSERT_EQ(image->conductor_fields.subscribable.length, 1u);
+
+    const int64_t sm_position = image->conductor_fields.next_sm_position;
+    const int32_t window_length = image->conductor_fields.next_sm_receiver_window_length;
+    const int64_t end_sm_change = image->conductor_fields.end_sm_change;
+
+    aeron_counter_set_ordered(image->rcv_hwm_position.value_addr, sm_position + window_length - 32);
+    aeron_counter_set_ordered(
+        image->conductor_fields.subscribable.array[0].value_addr, sm_position + (window_length / 8));
+
+    aeron_publication_image_track_rebuild(image, 1, sm_timeout_ns);
+
+    EXPECT_GT(image->conductor_fields.end_sm_change, end_sm_change);
+    EXPECT_EQ(image->conductor_fields.next_sm_position, sm_position + (window_length / 8));
+}
+
+TEST_F(DriverConductorNetworkTest, shouldQueueImageForReceiverOnceUntilServiced)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    const int64_t sm_timeout_ns = (int64_t)m_context.m_context->status_message_timeout_ns;
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+
+    createPublicationImage(endpoint, STREAM_ID_1, 1000);
+
+    aeron_publication_image_t *image =
+        aeron_driver_conductor_find_publication_image(&m_conductor.m_conductor, endpoint, STREAM_ID_1);
+    ASSERT_NE(image, (aeron_publication_image_t *)NULL);
+
+    aeron_spsc_concurrent_array_queue_t *queue = endpoint->receiver_proxy->pending_image_queue;
+    aeron_spsc_concurrent_array_queue_drain_all(queue, [](void *, volatile void *) {}, NULL);
+    image->receiver_fields.is_service_pending = 0;
+
+    aeron_publication_image_track_rebuild(image, sm_timeout_ns + 1, sm_timeout_ns);
+    aeron_publication_image_track_rebuild(image, (3 * sm_timeout_ns) + 2, sm_timeout_ns);
+
+    EXPECT_EQ(image->receiver_fields.is_service_pending, 1);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(queue), 1u);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldNotAllocateStreamStatsByDefault)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    doWork();
+
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id);
+
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+    EXPECT_EQ(publication->stats.bytes_rate.counter_id, -1);
+    EXPECT_EQ(publication->stats.depth.counter_id, -1);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldSampleStreamStatsWhenEnabled)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    m_context.m_context->stream_stats = true;
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, CHANNEL_2, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id);
+
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+    EXPECT_GE(publication->stats.bytes_rate.counter_id, 0);
+    EXPECT_GE(publication->stats.depth.counter_id, 0);
+    EXPECT_EQ(publication->stats.rtt.counter_id, -1);
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+
+    createPublicationImage(endpoint, STREAM_ID_1, 1000);
+
+    aeron_publication_image_t *image =
+        aeron_driver_conductor_find_publication_image(&m_conductor.m_conductor, endpoint, STREAM_ID_1);
+
+    ASSERT_NE(image, (aeron_publication_image_t *)NULL);
+    ASSERT_GE(image->stats.depth.counter_id, 0);
+    ASSERT_GE(image->stats.rtt.counter_id, 0);
+    EXPECT_EQ(aeron_counter_get(image->stats.rtt.value_addr), -1);
+
+    aeron_counter_set_ordered(image->rcv_hwm_position.value_addr, 4096);
+    doWorkUntilTimeNs(ms_timestamp + (int64_t)(m_context.m_context->timer_interval_ns / (1000 * 1000)) * 2);
+
+    EXPECT_EQ(aeron_counter_get(image->stats.depth.value_addr), 4096);
+    EXPECT_EQ(aeron_counter_get(publication->stats.depth.value_addr), 0);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldOnlyRemoveDuePendingSetupsAndKeepHeapOrder)
+{
+    ASSERT_EQ(addNetworkSubscription(nextCorrelationId(), nextCorrelationId(), CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+    ASSERT_NE(endpoint, (aeron_receive_channel_endpoint_t *)NULL);
+    aeron_driver_receiver_t *receiver = endpoint->receiver_proxy->receiver;
+    ASSERT_EQ(receiver->pending_setups.length, 0u);
+
+    for (int32_t time_ms : { 50, 10, 70, 30, 90, 20, 60, 40, 80 })
+    {
+        addPendingSetup(receiver, endpoint, time_ms, time_ms, false);
+    }
+
+    expectPendingSetupHeap(receiver);
+    EXPECT_EQ(receiver->pending_setups.array[0].session_id, 10);
+
+    ms_timestamp = (AERON_DRIVER_RECEIVER_PENDING_SETUP_TIMEOUT_NS / (1000 * 1000)) + 45;
+    aeron_driver_receiver_do_work(receiver);
+
+    EXPECT_EQ(pendingSetupSessionIds(receiver), std::set<int32_t>({ 50, 60, 70, 80, 90 }));
+    expectPendingSetupHeap(receiver);
+    EXPECT_EQ(receiver->pending_setups.array[0].session_id, 50);
+
+    aeron_driver_receiver_do_work(receiver);
+    EXPECT_EQ(receiver->pending_setups.length, 5u);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldRearmDuePeriodicPendingSetups)
+{
+    ASSERT_EQ(addNetworkSubscription(nextCorrelationId(), nextCorrelationId(), CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+    ASSERT_NE(endpoint, (aeron_receive_channel_endpoint_t *)NULL);
+    aeron_driver_receiver_t *receiver = endpoint->receiver_proxy->receiver;
+
+    addPendingSetup(receiver, endpoint, 30, 30, true);
+    addPendingSetup(receiver, endpoint, 10, 10, true);
+    addPendingSetup(receiver, endpoint, 20, 20, true);
+    addPendingSetup(receiver, endpoint, 40, 40, false);
+
+    const int64_t now_ms = (AERON_DRIVER_RECEIVER_PENDING_SETUP_TIMEOUT_NS / (1000 * 1000)) + 25;
+    ms_timestamp = now_ms;
+    aeron_driver_receiver_do_work(receiver);
+
+    ASSERT_EQ(pendingSetupSessionIds(receiver), std::set<int32_t>({ 10, 20, 30, 40 }));
+    expectPendingSetupHeap(receiver);
+    EXPECT_EQ(receiver->pending_setups.array[0].session_id, 30);
+
+    for (size_t i = 0; i < receiver->pending_setups.length; i++)
+    {
+        aeron_driver_receiver_pending_setup_entry_t *entry = &receiver->pending_setups.array[i];
+
+        if (entry->session_id < 30)
+        {
+            EXPECT_TRUE(entry->is_periodic);
+            EXPECT_EQ(entry->time_of_status_message_ns, now_ms * 1000 * 1000);
+        }
+        else
+        {
+            EXPECT_EQ(entry->time_of_status_message_ns, entry->session_id * 1000 * 1000LL);
+        }
+    }
+}
+
+TEST_F(DriverConductorNetworkTest, shouldKeepDuePeriodicPendingSetupsOnHeapWhenNotElicitingSetup)
+{
+    ASSERT_EQ(addNetworkSubscription(nextCorrelationId(), nextCorrelationId(), CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+    ASSERT_NE(endpoint, (aeron_receive_channel_endpoint_t *)NULL);
+    aeron_driver_receiver_t *receiver = endpoint->receiver_proxy->receiver;
+
+    for (int32_t time_ms : { 30, 10, 40, 20, 50 })
+    {
+        addPendingSetup(receiver, endpoint, time_ms, time_ms, true);
+    }
+
+    /* with nothing subscribed the due setups are not sent, so they stay due and go back on the heap as they were */
+    ASSERT_EQ(aeron_data_packet_dispatcher_remove_subscription(&endpoint->dispatcher, STREAM_ID_1), 0);
+
+    ms_timestamp = (AERON_DRIVER_RECEIVER_PENDING_SETUP_TIMEOUT_NS / (1000 * 1000)) + 25;
+    aeron_driver_receiver_do_work(receiver);
+
+    ASSERT_EQ(aeron_data_packet_dispatcher_add_subscription(&endpoint->dispatcher, STREAM_ID_1), 0);
+
+    EXPECT_EQ(pendingSetupSessionIds(receiver), std::set<int32_t>({ 10, 20, 30, 40, 50 }));
+    expectPendingSetupHeap(receiver);
+    EXPECT_EQ(receiver->pending_setups.array[0].session_id, 10);
+
+    for (size_t i = 0; i < receiver->pending_setups.length; i++)
+    {
+        aeron_driver_receiver_pending_setup_entry_t *entry = &receiver->pending_setups.array[i];
+        EXPECT_EQ(entry->time_of_status_message_ns, entry->session_id * 1000 * 1000LL);
+    }
+}
+
+TEST_F(DriverConductorNetworkTest, shouldKeepPendingSetupHeapOrderAfterEndpointRemoved)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, nextCorrelationId(), CHANNEL_2, STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint_1 =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+    aeron_receive_channel_endpoint_t *endpoint_2 =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_2);
+    ASSERT_NE(endpoint_1, (aeron_receive_channel_endpoint_t *)NULL);
+    ASSERT_NE(endpoint_2, (aeron_receive_channel_endpoint_t *)NULL);
+    aeron_driver_receiver_t *receiver = endpoint_1->receiver_proxy->receiver;
+    ASSERT_EQ(endpoint_2->receiver_proxy->receiver, receiver);
+
+    for (int32_t time_ms : { 10, 20, 30, 90, 40, 80, 50, 70, 60, 15, 25 })
+    {
+        addPendingSetup(receiver, time_ms < 30 ? endpoint_1 : endpoint_2, time_ms, time_ms, time_ms % 20 == 0);
+    }
+    expectPendingSetupHeap(receiver);
+
+    ASSERT_EQ(removeSubscription(client_id, nextCorrelationId(), sub_id), 0);
+    doWork();
+
+    EXPECT_EQ(pendingSetupSessionIds(receiver), std::set<int32_t>({ 30, 40, 50, 60, 70, 80, 90 }));
+    expectPendingSetupHeap(receiver);
+    EXPECT_EQ(receiver->pending_setups.array[0].session_id, 30);
+
+    for (size_t i = 0; i < receiver->pending_setups.length; i++)
+    {
+        EXPECT_EQ(receiver->pending_setups.array[i].endpoint, endpoint_2);
+    }
+}
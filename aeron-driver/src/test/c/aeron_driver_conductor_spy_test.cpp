@@ -503,3 +503,70 @@ TEST_F(DriverConductorSpyTest, shouldBeAbleToNotTimeoutSubscriptionOnKeepalive)
     EXPECT_EQ(aeron_driver_conductor_num_clients(&m_conductor.m_conductor), 1u);
     EXPECT_EQ(aeron_driver_conductor_num_spy_subscriptions(&m_conductor.m_conductor), 1u);
 }
+
+TEST_F(DriverConductorSpyTest, shouldNotHoldPublicationLimitForNonBlockingSpy)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t blocking_sub_id = nextCorrelationId();
+    int64_t non_blocking_sub_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    m_context.m_context->spies_simulate_connection = true;
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addSpySubscription(
+        client_id, non_blocking_sub_id, CHANNEL_1 "|spy-blocking=false", STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+    EXPECT_EQ(aeron_network_publication_num_spy_subscribers(publication), 1u);
+    EXPECT_EQ(aeron_network_publication_num_non_blocking_spy_subscribers(publication), 1u);
+
+    const int64_t snd_pos = 1024;
+    aeron_counter_set_ordered(publication->snd_pos_position.value_addr, snd_pos);
+    doWork();
+
+    EXPECT_EQ(aeron_counter_get(publication->pub_lmt_position.value_addr), snd_pos + publication->term_window_length);
+
+    ASSERT_EQ(addSpySubscription(client_id, blocking_sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    EXPECT_EQ(aeron_network_publication_num_spy_subscribers(publication), 2u);
+    EXPECT_EQ(aeron_network_publication_num_non_blocking_spy_subscribers(publication), 1u);
+
+    int64_t remove_correlation_id = nextCorrelationId();
+    ASSERT_EQ(removeSubscription(client_id, remove_correlation_id, non_blocking_sub_id), 0);
+    doWork();
+
+    EXPECT_EQ(aeron_network_publication_num_spy_subscribers(publication), 1u);
+    EXPECT_EQ(aeron_network_publication_num_non_blocking_spy_subscribers(publication), 0u);
+}
+
+TEST_F(DriverConductorSpyTest, shouldPublishMaxSpyPositionForSender)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    m_context.m_context->spies_simulate_connection = true;
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addSpySubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+    ASSERT_EQ(aeron_network_publication_num_spy_subscribers(publication), 1u);
+
+    const int64_t spy_position = 2048;
+    aeron_counter_set_ordered(publication->conductor_fields.subscribable.array[0].value_addr, spy_position);
+    EXPECT_EQ(aeron_network_publication_max_spy_position(publication, 0), 0);
+
+    doWork();
+
+    EXPECT_EQ(aeron_network_publication_max_spy_position(publication, 0), spy_position);
+    EXPECT_EQ(aeron_network_publication_max_spy_position(publication, 4096), 4096);
+}
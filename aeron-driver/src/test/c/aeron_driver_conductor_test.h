@@ -25,6 +25,7 @@
 #include <gtest/gtest.h>
 #include <arpa/inet.h>
 #include <concurrent/CountersReader.h>
+#include <concurrent/status/HeartbeatTimestamp.h>
 
 extern "C"
 {
@@ -38,6 +39,7 @@ extern "C"
 #include "concurrent/broadcast/CopyBroadcastReceiver.h"
 #include "command/PublicationBuffersReadyFlyweight.h"
 #include "command/ImageBuffersReadyFlyweight.h"
+#include "command/ImageBuffersReadyBatchFlyweight.h"
 #include "command/CorrelatedMessageFlyweight.h"
 #include "command/PublicationMessageFlyweight.h"
 #include "command/SubscriptionMessageFlyweight.h"
@@ -187,24 +189,40 @@ struct TestDriverConductor
 
         context.m_context->sender_proxy = &m_sender.sender_proxy;
 
+        if (aeron_driver_sender_init(
+            &m_second_sender, context.m_context, &m_conductor.system_counters, &m_conductor.error_log) < 0)
+        {
+            throw std::runtime_error("could not init second sender: " + std::string(aeron_errmsg()));
+        }
+
         if (aeron_driver_receiver_init(&m_receiver, context.m_context, &m_conductor.system_counters, &m_conductor.error_log) < 0)
         {
             throw std::runtime_error("could not init receiver: " + std::string(aeron_errmsg()));
         }
 
         context.m_context->receiver_proxy = &m_receiver.receiver_proxy;
+
+        if (aeron_driver_receiver_init(
+            &m_second_receiver, context.m_context, &m_conductor.system_counters, &m_conductor.error_log) < 0)
+        {
+            throw std::runtime_error("could not init second receiver: " + std::string(aeron_errmsg()));
+        }
     }
 
     virtual ~TestDriverConductor()
     {
         aeron_driver_conductor_on_close(&m_conductor);
         aeron_driver_sender_on_close(&m_sender);
+        aeron_driver_sender_on_close(&m_second_sender);
         aeron_driver_receiver_on_close(&m_receiver);
+        aeron_driver_receiver_on_close(&m_second_receiver);
     }
 
     aeron_driver_conductor_t m_conductor;
     aeron_driver_sender_t m_sender;
+    aeron_driver_sender_t m_second_sender;
     aeron_driver_receiver_t m_receiver;
+    aeron_driver_receiver_t m_second_receiver;
 };
 
 class DriverConductorTest : public testing::Test
@@ -373,6 +391,23 @@ public:
         return writeCommand(AERON_COMMAND_REMOVE_COUNTER, command.length());
     }
 
+    int32_t findClientHeartbeatCounterId(int64_t client_id)
+    {
+        aeron_driver_context_t *ctx = m_context.m_context;
+        AtomicBuffer metadata(ctx->counters_metadata_buffer, static_cast<util::index_t>(ctx->counters_metadata_buffer_length));
+        AtomicBuffer values(ctx->counters_values_buffer, static_cast<util::index_t>(ctx->counters_values_buffer_length));
+        CountersReader reader(metadata, values);
+
+        return concurrent::status::HeartbeatTimestamp::findCounterIdByRegistrationId(
+            reader, concurrent::status::HeartbeatTimestamp::CLIENT_HEARTBEAT_TYPE_ID, client_id);
+    }
+
+    void clientHeartbeat(int32_t counter_id)
+    {
+        aeron_counter_set_ordered(
+            aeron_counter_addr(&m_conductor.m_conductor.counters_manager, counter_id), test_epoch_clock());
+    }
+
     template<typename F>
     bool findCounter(int32_t counter_id, F&& func)
     {
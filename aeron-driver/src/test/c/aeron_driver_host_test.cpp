@@ -0,0 +1,128 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+extern "C"
+{
+#include "aeron_driver.h"
+}
+
+#define TENANT_COUNT (2)
+
+static void null_log(const char *)
+{
+}
+
+class DriverHostTest : public testing::Test
+{
+public:
+    DriverHostTest()
+    {
+        char dir_template[] = "/tmp/aeron-driver-host-test-XXXXXX";
+
+        if (NULL == mkdtemp(dir_template))
+        {
+            throw std::runtime_error("could not create temp dir");
+        }
+
+        m_base_dir = dir_template;
+
+        for (int i = 0; i < TENANT_COUNT; i++)
+        {
+            m_dirs[i] = m_base_dir + "/tenant-" + std::to_string(i);
+
+            if (aeron_driver_context_init(&m_contexts[i]) < 0)
+            {
+                throw std::runtime_error("could not init context");
+            }
+
+            snprintf(m_contexts[i]->aeron_dir, AERON_MAX_PATH - 1, "%s", m_dirs[i].c_str());
+        }
+    }
+
+    ~DriverHostTest()
+    {
+        if (NULL != m_host)
+        {
+            aeron_driver_host_close(m_host);
+        }
+        else
+        {
+            for (int i = 0; i < TENANT_COUNT; i++)
+            {
+                if (NULL != m_drivers[i])
+                {
+                    aeron_driver_close(m_drivers[i]);
+                }
+            }
+        }
+
+        for (int i = 0; i < TENANT_COUNT; i++)
+        {
+            aeron_driver_context_close(m_contexts[i]);
+            aeron_dir_delete(m_dirs[i].c_str());
+        }
+
+        rmdir(m_base_dir.c_str());
+    }
+
+protected:
+    std::string m_base_dir;
+    std::string m_dirs[TENANT_COUNT];
+    aeron_driver_context_t *m_contexts[TENANT_COUNT] = {};
+    aeron_driver_t *m_drivers[TENANT_COUNT] = {};
+    aeron_driver_host_t *m_host = NULL;
+};
+
+TEST_F(DriverHostTest, shouldRunTenantsWithOwnConductorsAndSharedNetworkThreads)
+{
+    for (int i = 0; i < TENANT_COUNT; i++)
+    {
+        ASSERT_EQ(aeron_driver_init(&m_drivers[i], m_contexts[i]), 0) << aeron_errmsg();
+    }
+
+    ASSERT_EQ(aeron_driver_host_init(&m_host, m_drivers, TENANT_COUNT), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_driver_host_start(m_host), 0) << aeron_errmsg();
+
+    EXPECT_EQ(m_host->sender_runner.state, AERON_AGENT_STATE_STARTED);
+    EXPECT_EQ(m_host->receiver_runner.state, AERON_AGENT_STATE_STARTED);
+
+    for (int i = 0; i < TENANT_COUNT; i++)
+    {
+        EXPECT_EQ(m_drivers[i]->runners[AERON_AGENT_RUNNER_CONDUCTOR].state, AERON_AGENT_STATE_STARTED);
+        EXPECT_EQ(m_drivers[i]->runners[AERON_AGENT_RUNNER_SENDER].state, AERON_AGENT_STATE_MANUAL);
+        EXPECT_EQ(m_drivers[i]->runners[AERON_AGENT_RUNNER_RECEIVER].state, AERON_AGENT_STATE_MANUAL);
+        EXPECT_TRUE(aeron_is_driver_active(m_dirs[i].c_str(), 10000, aeron_epochclock(), null_log));
+    }
+}
+
+TEST_F(DriverHostTest, shouldRejectTenantNotInDedicatedThreadingMode)
+{
+    m_contexts[1]->threading_mode = AERON_THREADING_MODE_SHARED;
+
+    for (int i = 0; i < TENANT_COUNT; i++)
+    {
+        ASSERT_EQ(aeron_driver_init(&m_drivers[i], m_contexts[i]), 0) << aeron_errmsg();
+    }
+
+    EXPECT_EQ(aeron_driver_host_init(&m_host, m_drivers, TENANT_COUNT), -1);
+    EXPECT_EQ(m_host, (aeron_driver_host_t *)NULL);
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <pthread.h>
+
+extern "C"
+{
+#include "aeron_driver.h"
+}
+
+static int num_on_starts = 0;
+static pthread_t on_start_thread;
+
+static void recording_on_start(void *state, const char *role_name)
+{
+    num_on_starts++;
+    on_start_thread = pthread_self();
+}
+
+class DriverInvokerTest : public testing::Test
+{
+public:
+    DriverInvokerTest()
+    {
+        char dir_template[] = "/tmp/aeron-driver-invoker-test-XXXXXX";
+
+        if (NULL == mkdtemp(dir_template))
+        {
+            throw std::runtime_error("could not create temp dir");
+        }
+
+        m_dir = std::string(dir_template) + "/aeron";
+        num_on_starts = 0;
+        m_base_dir = dir_template;
+
+        setenv(AERON_DIR_ENV_VAR, m_dir.c_str(), 1);
+
+        if (aeron_driver_context_init(&m_context) < 0)
+        {
+            throw std::runtime_error("could not init context");
+        }
+
+        m_context->agent_on_start_func = recording_on_start;
+    }
+
+    ~DriverInvokerTest()
+    {
+        if (NULL != m_driver)
+        {
+            aeron_driver_close(m_driver);
+        }
+
+        aeron_driver_context_close(m_context);
+        aeron_dir_delete(m_dir.c_str());
+        rmdir(m_base_dir.c_str());
+        unsetenv(AERON_DIR_ENV_VAR);
+    }
+
+protected:
+    std::string m_base_dir;
+    std::string m_dir;
+    aeron_driver_context_t *m_context = NULL;
+    aeron_driver_t *m_driver = NULL;
+};
+
+TEST_F(DriverInvokerTest, shouldRunDedicatedAgentsOnCallerThread)
+{
+    ASSERT_EQ(aeron_driver_init(&m_driver, m_context), 0);
+    ASSERT_EQ(aeron_driver_invoker_start(m_driver), 0);
+
+    EXPECT_EQ(m_driver->runners[AERON_AGENT_RUNNER_CONDUCTOR].state, AERON_AGENT_STATE_MANUAL);
+    EXPECT_EQ(m_driver->runners[AERON_AGENT_RUNNER_SENDER].state, AERON_AGENT_STATE_MANUAL);
+    EXPECT_EQ(m_driver->runners[AERON_AGENT_RUNNER_RECEIVER].state, AERON_AGENT_STATE_MANUAL);
+
+    EXPECT_EQ(num_on_starts, 3);
+    EXPECT_TRUE(pthread_equal(on_start_thread, pthread_self()));
+
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_GE(aeron_driver_invoker_do_work(m_driver), 0);
+    }
+}
+
+TEST_F(DriverInvokerTest, shouldRunSharedAgentOnCallerThread)
+{
+    m_context->threading_mode = AERON_THREADING_MODE_SHARED;
+
+    ASSERT_EQ(aeron_driver_init(&m_driver, m_context), 0);
+    ASSERT_EQ(aeron_driver_invoker_start(m_driver), 0);
+
+    EXPECT_EQ(m_driver->runners[AERON_AGENT_RUNNER_SHARED].state, AERON_AGENT_STATE_MANUAL);
+    EXPECT_EQ(num_on_starts, 1);
+    EXPECT_GE(aeron_driver_invoker_do_work(m_driver), 0);
+}
+
+TEST_F(DriverInvokerTest, shouldTrackDutyCyclesOfInvokedAgents)
+{
+    m_context->duty_cycle_tracking = true;
+
+    ASSERT_EQ(aeron_driver_init(&m_driver, m_context), 0);
+    ASSERT_EQ(aeron_driver_invoker_start(m_driver), 0);
+
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_GE(aeron_driver_invoker_do_work(m_driver), 0);
+    }
+
+    for (int runner : { AERON_AGENT_RUNNER_CONDUCTOR, AERON_AGENT_RUNNER_SENDER, AERON_AGENT_RUNNER_RECEIVER })
+    {
+        aeron_duty_cycle_tracker_t *tracker = m_driver->runners[runner].duty_cycle_tracker;
+        int64_t cycles = 0;
+
+        ASSERT_NE(tracker, nullptr);
+        for (size_t i = 0; i < AERON_DUTY_CYCLE_HISTOGRAM_BUCKET_COUNT; i++)
+        {
+            cycles += *tracker->histogram[i];
+        }
+
+        EXPECT_GT(*tracker->cycle_timestamp, 0);
+        EXPECT_EQ(cycles, 9);
+    }
+
+    EXPECT_EQ(m_driver->runners[AERON_AGENT_RUNNER_RAW_LOG_POOL].duty_cycle_tracker, nullptr);
+}
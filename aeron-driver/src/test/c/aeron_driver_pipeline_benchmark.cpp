@@ -0,0 +1,562 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <stdexcept>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "aeron_driver_conductor.h"
+#include "aeron_driver_sender.h"
+#include "aeron_driver_receiver.h"
+#include "media/aeron_send_channel_endpoint.h"
+#include "media/aeron_receive_channel_endpoint.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
+#include "command/aeron_control_protocol.h"
+#include "concurrent/aeron_mpsc_rb.h"
+#include "client/aeronc.h"
+#include "client/aeron_publication.h"
+#include "util/aeron_error.h"
+}
+
+#define CHANNEL "aeron:udp?endpoint=localhost:40123"
+#define STREAM_ID (1001)
+#define CLIENT_ID (7)
+#define TERM_LENGTH (1024 * 1024)
+
+/*
+ * Runs a publication and an image of the same stream through the sender and receiver data paths in one thread, with
+ * a loopback transport plugged in through the transport bindings in place of the sockets. Data frames are handed
+ * over by pointer into the publication's term, as a zero copy transport would, so only the driver's own work is
+ * measured: sending covers scanning the term and building the batches, receiving covers dispatch, the image lookup
+ * and the term rebuild. Control frames are copied as they are built on the stack.
+ */
+struct LoopbackDatagram
+{
+    const uint8_t *buffer;
+    size_t length;
+};
+
+class LoopbackNetwork
+{
+public:
+    void send(const uint8_t *buffer, size_t length, bool copy)
+    {
+        const uint16_t type = ((const aeron_frame_header_t *)buffer)->type;
+        std::vector<LoopbackDatagram> &queue =
+            (AERON_HDR_TYPE_SM == type || AERON_HDR_TYPE_NAK == type) ? m_to_sender : m_to_receiver;
+
+        if (copy)
+        {
+            m_copies.emplace_back(buffer, buffer + length);
+            buffer = m_copies.back().data();
+        }
+
+        queue.push_back({ buffer, length });
+    }
+
+    std::vector<LoopbackDatagram> &toSender()
+    {
+        return m_to_sender;
+    }
+
+    std::vector<LoopbackDatagram> &toReceiver()
+    {
+        return m_to_receiver;
+    }
+
+    void clearCopies()
+    {
+        if (m_to_sender.empty() && m_to_receiver.empty())
+        {
+            m_copies.clear();
+        }
+    }
+
+private:
+    std::vector<LoopbackDatagram> m_to_sender;
+    std::vector<LoopbackDatagram> m_to_receiver;
+    std::vector<std::vector<uint8_t>> m_copies;
+};
+
+static LoopbackNetwork loopback_network;
+
+static int loopback_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    bool use_gro,
+    uint32_t busy_poll_us,
+    bool prefer_busy_poll,
+    bool use_rx_timestamping,
+    struct sockaddr_storage *connect_addr)
+{
+    /* never readable, it only gives the poller something to register */
+    if ((transport->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0)
+    {
+        aeron_set_err(errno, "eventfd: %s", strerror(errno));
+        return -1;
+    }
+
+    transport->recv_timestamp_ns = 0;
+    transport->is_connected = false;
+    return 0;
+}
+
+static int loopback_close(aeron_udp_channel_transport_t *transport)
+{
+    if (transport->fd >= 0)
+    {
+        close(transport->fd);
+    }
+
+    return 0;
+}
+
+static int loopback_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    return 0;
+}
+
+static int loopback_sendmmsg(aeron_udp_channel_transport_t *transport, struct mmsghdr *msgvec, size_t vlen)
+{
+    for (size_t i = 0; i < vlen; i++)
+    {
+        struct iovec *iov = msgvec[i].msg_hdr.msg_iov;
+        const uint16_t type = ((const aeron_frame_header_t *)iov[0].iov_base)->type;
+
+        /* data frames point into the term buffers, control frames into the reused batch of the receive endpoint */
+        loopback_network.send(
+            (const uint8_t *)iov[0].iov_base, iov[0].iov_len, AERON_HDR_TYPE_SM == type || AERON_HDR_TYPE_NAK == type);
+        msgvec[i].msg_len = (unsigned int)iov[0].iov_len;
+    }
+
+    return (int)vlen;
+}
+
+static int loopback_sendmsg(aeron_udp_channel_transport_t *transport, struct msghdr *message)
+{
+    struct iovec *iov = message->msg_iov;
+
+    loopback_network.send((const uint8_t *)iov[0].iov_base, iov[0].iov_len, true);
+
+    return (int)iov[0].iov_len;
+}
+
+static int loopback_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf)
+{
+    *so_rcvbuf = 2 * 1024 * 1024;
+    return 0;
+}
+
+static aeron_udp_channel_transport_bindings_t loopback_bindings =
+    {
+        loopback_init,
+        loopback_close,
+        loopback_recvmmsg,
+        loopback_sendmmsg,
+        loopback_sendmsg,
+        loopback_get_so_rcvbuf
+    };
+
+static int64_t ms_timestamp = 0;
+
+static int64_t pipeline_nano_clock()
+{
+    return ms_timestamp * 1000 * 1000;
+}
+
+static int64_t pipeline_epoch_clock()
+{
+    return ms_timestamp;
+}
+
+static int pipeline_map_raw_log(
+    aeron_mapped_raw_log_t *log, const char *path, bool use_sparse_file, uint64_t term_length, uint64_t page_size)
+{
+    uint64_t log_length = aeron_logbuffer_compute_log_length(term_length, page_size);
+
+    log->mapped_file.length = 0;
+    log->mapped_file.addr = calloc(1, log_length);
+
+    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        log->term_buffers[i].addr = (uint8_t *)log->mapped_file.addr + (i * term_length);
+        log->term_buffers[i].length = term_length;
+    }
+
+    log->log_meta_data.addr = (uint8_t *)log->mapped_file.addr + (log_length - AERON_LOGBUFFER_META_DATA_LENGTH);
+    log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
+    log->term_length = term_length;
+
+    return 0;
+}
+
+static int pipeline_map_raw_log_close(aeron_mapped_raw_log_t *log)
+{
+    free(log->mapped_file.addr);
+    return 0;
+}
+
+static uint64_t pipeline_usable_fs_space(const char *path)
+{
+    return UINT64_MAX;
+}
+
+class DriverPipeline
+{
+public:
+    explicit DriverPipeline(size_t payload_length) : m_payload(payload_length, 0x5A)
+    {
+        ms_timestamp = 0;
+
+        if (aeron_driver_context_init(&m_context) < 0)
+        {
+            throw std::runtime_error("could not init context: " + std::string(aeron_errmsg()));
+        }
+
+        m_context->threading_mode = AERON_THREADING_MODE_SHARED;
+        m_context->cnc_map.length = aeron_cnc_length(m_context);
+        m_cnc = std::unique_ptr<uint8_t[]>(new uint8_t[m_context->cnc_map.length]());
+        m_context->cnc_map.addr = m_cnc.get();
+        aeron_driver_fill_cnc_metadata(m_context);
+
+        m_context->term_buffer_length = TERM_LENGTH;
+        m_context->term_buffer_sparse_file = true;
+        m_context->socket_gso = false;
+        m_context->nano_clock = pipeline_nano_clock;
+        m_context->epoch_clock = pipeline_epoch_clock;
+        m_context->usable_fs_space_func = pipeline_usable_fs_space;
+        m_context->map_raw_log_func = pipeline_map_raw_log;
+        m_context->map_raw_log_close_func = pipeline_map_raw_log_close;
+        m_context->udp_channel_transport_bindings = &loopback_bindings;
+
+        /* each agent picks up the proxies of those initialised before it */
+        if (aeron_driver_conductor_init(&m_conductor, m_context) < 0)
+        {
+            throw std::runtime_error("could not init conductor: " + std::string(aeron_errmsg()));
+        }
+
+        m_context->conductor_proxy = &m_conductor.conductor_proxy;
+
+        if (aeron_driver_sender_init(&m_sender, m_context, &m_conductor.system_counters, &m_conductor.error_log) < 0)
+        {
+            throw std::runtime_error("could not init sender: " + std::string(aeron_errmsg()));
+        }
+
+        m_context->sender_proxy = &m_sender.sender_proxy;
+
+        if (aeron_driver_receiver_init(&m_receiver, m_context, &m_conductor.system_counters, &m_conductor.error_log) < 0)
+        {
+            throw std::runtime_error("could not init receiver: " + std::string(aeron_errmsg()));
+        }
+
+        m_context->receiver_proxy = &m_receiver.receiver_proxy;
+
+        aeron_mpsc_rb_init(&m_to_driver, m_context->to_driver_buffer, m_context->to_driver_buffer_length);
+
+        connect();
+    }
+
+    ~DriverPipeline()
+    {
+        aeron_driver_conductor_on_close(&m_conductor);
+        aeron_driver_sender_on_close(&m_sender);
+        aeron_driver_receiver_on_close(&m_receiver);
+        m_context->cnc_map.addr = NULL;
+        aeron_driver_context_close(m_context);
+    }
+
+    int framesPerRound() const
+    {
+        return m_frames_per_round;
+    }
+
+    /* offer a round of messages, nothing is timed here */
+    void publish()
+    {
+        for (int i = 0; i < m_frames_per_round; i++)
+        {
+            int64_t result;
+
+            while ((result = aeron_publication_offer(&m_publication, m_payload.data(), m_payload.size())) < 0)
+            {
+                if (AERON_PUBLICATION_BACK_PRESSURED != result && AERON_PUBLICATION_ADMIN_ACTION != result)
+                {
+                    throw std::runtime_error("offer failed: " + std::to_string(result));
+                }
+
+                housekeeping();
+            }
+
+            m_publisher_position = result;
+        }
+    }
+
+    /* nanoseconds the sender spent putting everything published on the loopback */
+    int64_t send()
+    {
+        const int64_t now_ns = pipeline_nano_clock();
+        const int64_t target = m_publisher_position;
+        const auto start = std::chrono::steady_clock::now();
+
+        while (aeron_counter_get(m_network_publication->snd_pos_position.value_addr) < target)
+        {
+            if (aeron_network_publication_send(m_network_publication, now_ns) <= 0)
+            {
+                throw std::runtime_error("sender stalled below the flow control window");
+            }
+        }
+
+        return elapsedNs(start);
+    }
+
+    /* nanoseconds the receiver spent dispatching what the sender put on the loopback */
+    int64_t receive()
+    {
+        std::vector<LoopbackDatagram> &datagrams = loopback_network.toReceiver();
+        const auto start = std::chrono::steady_clock::now();
+
+        for (const LoopbackDatagram &datagram : datagrams)
+        {
+            aeron_receive_channel_endpoint_dispatch(
+                &m_receiver, m_receive_endpoint, (uint8_t *)datagram.buffer, datagram.length, &m_source_address);
+        }
+
+        const int64_t elapsed_ns = elapsedNs(start);
+        datagrams.clear();
+
+        return elapsed_ns;
+    }
+
+    /* a subscriber consuming everything, status messages back to the sender and the duty cycles in between */
+    void housekeeping()
+    {
+        if (NULL != m_image)
+        {
+            const int64_t rcv_pos = aeron_counter_get_volatile(m_image->rcv_pos_position.value_addr);
+
+            for (size_t i = 0; i < m_image->conductor_fields.subscribable.length; i++)
+            {
+                aeron_counter_set_ordered(m_image->conductor_fields.subscribable.array[i].value_addr, rcv_pos);
+            }
+        }
+
+        ms_timestamp++;
+        clientKeepalive();
+        aeron_driver_conductor_do_work(&m_conductor);
+        aeron_driver_receiver_do_work(&m_receiver);
+
+        std::vector<LoopbackDatagram> &to_sender = loopback_network.toSender();
+        for (const LoopbackDatagram &datagram : to_sender)
+        {
+            aeron_send_channel_endpoint_dispatch(
+                &m_sender, m_send_endpoint, (uint8_t *)datagram.buffer, datagram.length, &m_source_address);
+        }
+
+        to_sender.clear();
+        loopback_network.clearCopies();
+    }
+
+private:
+    void connect()
+    {
+        const int64_t publication_id = aeron_mpsc_rb_next_correlation_id(&m_to_driver);
+        const int64_t subscription_id = aeron_mpsc_rb_next_correlation_id(&m_to_driver);
+
+        addSubscription(subscription_id);
+        addPublication(publication_id);
+        aeron_driver_conductor_do_work(&m_conductor);
+
+        m_network_publication = aeron_driver_conductor_find_network_publication(&m_conductor, publication_id);
+        m_send_endpoint = aeron_driver_conductor_find_send_channel_endpoint(&m_conductor, CHANNEL);
+        m_receive_endpoint = aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor, CHANNEL);
+        if (NULL == m_network_publication || NULL == m_send_endpoint || NULL == m_receive_endpoint)
+        {
+            throw std::runtime_error("could not add publication and subscription: " + std::string(aeron_errmsg()));
+        }
+
+        initPublication(publication_id);
+
+        for (int i = 0; i < 1000 && !(aeron_publication_is_connected(&m_publication) && NULL != m_image); i++)
+        {
+            aeron_network_publication_send(m_network_publication, pipeline_nano_clock());
+            receive();
+            m_image = aeron_driver_conductor_find_publication_image(&m_conductor, m_receive_endpoint, STREAM_ID);
+            housekeeping();
+        }
+
+        if (NULL == m_image || !aeron_publication_is_connected(&m_publication))
+        {
+            throw std::runtime_error("publication did not connect over the loopback");
+        }
+
+        const size_t aligned_frame_length = AERON_ALIGN(
+            m_payload.size() + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        m_frames_per_round = std::max(1, (int)((m_context->initial_window_length / 4) / aligned_frame_length));
+    }
+
+    void initPublication(int64_t publication_id)
+    {
+        aeron_logbuffer_metadata_t *log_meta_data = m_network_publication->log_meta_data;
+
+        std::memset(&m_publication, 0, sizeof(m_publication));
+        m_publication.mapped_raw_log = m_network_publication->mapped_raw_log;
+        m_publication.log_meta_data = log_meta_data;
+        m_publication.default_header = (uint8_t *)log_meta_data + sizeof(aeron_logbuffer_metadata_t);
+        m_publication.position_limit = m_network_publication->pub_lmt_position.value_addr;
+        m_publication.registration_id = publication_id;
+        m_publication.original_registration_id = publication_id;
+        m_publication.stream_id = STREAM_ID;
+        m_publication.session_id = m_network_publication->session_id;
+        m_publication.initial_term_id = log_meta_data->initial_term_id;
+        m_publication.term_length = log_meta_data->term_length;
+        m_publication.position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes(log_meta_data->term_length);
+        m_publication.max_payload_length = (size_t)(log_meta_data->mtu_length - AERON_DATA_HEADER_LENGTH);
+        m_publication.max_message_length = (size_t)(log_meta_data->term_length / 8);
+        m_publication.max_possible_position = ((int64_t)log_meta_data->term_length << 31);
+    }
+
+    void addPublication(int64_t correlation_id)
+    {
+        uint8_t buffer[sizeof(aeron_publication_command_t) + sizeof(CHANNEL)];
+        aeron_publication_command_t *command = (aeron_publication_command_t *)buffer;
+
+        command->correlated.client_id = CLIENT_ID;
+        command->correlated.correlation_id = correlation_id;
+        command->stream_id = STREAM_ID;
+        command->channel_length = (int32_t)strlen(CHANNEL);
+        std::memcpy(buffer + sizeof(aeron_publication_command_t), CHANNEL, strlen(CHANNEL));
+
+        writeCommand(AERON_COMMAND_ADD_PUBLICATION, buffer, sizeof(aeron_publication_command_t) + strlen(CHANNEL));
+    }
+
+    void addSubscription(int64_t correlation_id)
+    {
+        uint8_t buffer[sizeof(aeron_subscription_command_t) + sizeof(CHANNEL)];
+        aeron_subscription_command_t *command = (aeron_subscription_command_t *)buffer;
+
+        command->correlated.client_id = CLIENT_ID;
+        command->correlated.correlation_id = correlation_id;
+        command->registration_correlation_id = -1;
+        command->stream_id = STREAM_ID;
+        command->channel_length = (int32_t)strlen(CHANNEL);
+        std::memcpy(buffer + sizeof(aeron_subscription_command_t), CHANNEL, strlen(CHANNEL));
+
+        writeCommand(AERON_COMMAND_ADD_SUBSCRIPTION, buffer, sizeof(aeron_subscription_command_t) + strlen(CHANNEL));
+    }
+
+    void clientKeepalive()
+    {
+        aeron_correlated_command_t command = { CLIENT_ID, 0 };
+
+        writeCommand(AERON_COMMAND_CLIENT_KEEPALIVE, &command, sizeof(command));
+    }
+
+    void writeCommand(int32_t msg_type_id, const void *buffer, size_t length)
+    {
+        if (AERON_RB_SUCCESS != aeron_mpsc_rb_write(&m_to_driver, msg_type_id, buffer, length))
+        {
+            throw std::runtime_error("could not write command to driver");
+        }
+    }
+
+    static int64_t elapsedNs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    aeron_driver_context_t *m_context = NULL;
+    std::unique_ptr<uint8_t[]> m_cnc;
+    aeron_driver_conductor_t m_conductor;
+    aeron_driver_sender_t m_sender;
+    aeron_driver_receiver_t m_receiver;
+    aeron_mpsc_rb_t m_to_driver;
+
+    aeron_network_publication_t *m_network_publication = NULL;
+    aeron_send_channel_endpoint_t *m_send_endpoint = NULL;
+    aeron_receive_channel_endpoint_t *m_receive_endpoint = NULL;
+    aeron_publication_image_t *m_image = NULL;
+    aeron_publication_t m_publication;
+    struct sockaddr_storage m_source_address = {};
+
+    std::vector<uint8_t> m_payload;
+    int m_frames_per_round = 1;
+    int64_t m_publisher_position = 0;
+};
+
+/*
+ * The agents are too large for the stack. Each iteration is a round of frames but reports its elapsed time divided by
+ * the frame count, so the time and items per second are per frame.
+ */
+static void BM_SenderDataPath(benchmark::State &state)
+{
+    std::unique_ptr<DriverPipeline> pipeline(new DriverPipeline((size_t)state.range(0)));
+    const int frames = pipeline->framesPerRound();
+
+    while (state.KeepRunning())
+    {
+        pipeline->publish();
+        const int64_t elapsed_ns = pipeline->send();
+        pipeline->receive();
+        pipeline->housekeeping();
+
+        state.SetIterationTime((double)elapsed_ns / frames / 1e9);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_ReceiverDataPath(benchmark::State &state)
+{
+    std::unique_ptr<DriverPipeline> pipeline(new DriverPipeline((size_t)state.range(0)));
+    const int frames = pipeline->framesPerRound();
+
+    while (state.KeepRunning())
+    {
+        pipeline->publish();
+        pipeline->send();
+        const int64_t elapsed_ns = pipeline->receive();
+        pipeline->housekeeping();
+
+        state.SetIterationTime((double)elapsed_ns / frames / 1e9);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SenderDataPath)->Arg(32)->Arg(1344)->UseManualTime();
+BENCHMARK(BM_ReceiverDataPath)->Arg(32)->Arg(1344)->UseManualTime();
+
+BENCHMARK_MAIN();
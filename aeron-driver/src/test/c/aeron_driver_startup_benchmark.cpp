@@ -0,0 +1,475 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <thread>
+#include <stdexcept>
+#include <functional>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "aeron_driver.h"
+#include "aeron_cnc_file_descriptor.h"
+#include "client/aeronc.h"
+#include "util/aeron_error.h"
+}
+
+#define IPC_CHANNEL "aeron:ipc"
+#define UDP_CHANNEL "aeron:udp?endpoint=localhost:40126"
+#define BASE_STREAM_ID (10000)
+#define SETUP_BATCH_SIZE (100)
+#define ROUND_TRIP_TIMEOUT_NS (10LL * 1000 * 1000 * 1000)
+
+static int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+class TempAeronDir
+{
+public:
+    TempAeronDir()
+    {
+        char dir_template[] = "/tmp/aeron-startup-benchmark-XXXXXX";
+
+        if (NULL == mkdtemp(dir_template))
+        {
+            throw std::runtime_error("could not create temp dir");
+        }
+
+        m_base_dir = dir_template;
+        m_dir = m_base_dir + "/aeron";
+        m_cnc_file = m_dir + "/" + AERON_CNC_FILE;
+    }
+
+    ~TempAeronDir()
+    {
+        aeron_dir_delete(m_dir.c_str());
+        rmdir(m_base_dir.c_str());
+    }
+
+    const std::string &dir() const
+    {
+        return m_dir;
+    }
+
+    /* spin until the driver has created the cnc file and signalled it ready */
+    bool awaitCncReady(int64_t timeout_ns) const
+    {
+        const int64_t deadline_ns = now_ns() + timeout_ns;
+        struct stat sb;
+        int fd = -1;
+
+        while ((fd = open(m_cnc_file.c_str(), O_RDONLY)) < 0 || fstat(fd, &sb) < 0 ||
+            (size_t)sb.st_size < sizeof(aeron_cnc_metadata_t))
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+
+            if (now_ns() > deadline_ns)
+            {
+                return false;
+            }
+
+            std::this_thread::yield();
+        }
+
+        void *addr = mmap(NULL, sizeof(aeron_cnc_metadata_t), PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (MAP_FAILED == addr)
+        {
+            return false;
+        }
+
+        bool ready;
+        while (!(ready = 0 != aeron_cnc_version_volatile((aeron_cnc_metadata_t *)addr)) && now_ns() <= deadline_ns)
+        {
+            std::this_thread::yield();
+        }
+
+        munmap(addr, sizeof(aeron_cnc_metadata_t));
+
+        return ready;
+    }
+
+private:
+    std::string m_base_dir;
+    std::string m_dir;
+    std::string m_cnc_file;
+};
+
+/*
+ * Time from launching aeronmd until a client could see cnc.dat ready. Includes the process exec, context init from
+ * the environment and creating and mapping the cnc and its buffers.
+ */
+static void BM_AeronmdStartToCncReady(benchmark::State &state)
+{
+    while (state.KeepRunning())
+    {
+        TempAeronDir dir;
+        const int64_t start_ns = now_ns();
+        const pid_t pid = fork();
+
+        if (0 == pid)
+        {
+            const int null_fd = open("/dev/null", O_WRONLY);
+
+            dup2(null_fd, STDOUT_FILENO);
+            dup2(null_fd, STDERR_FILENO);
+            setenv(AERON_DIR_ENV_VAR, dir.dir().c_str(), 1);
+            execl(AERONMD_PATH, AERONMD_PATH, (char *)NULL);
+            _exit(127);
+        }
+        else if (pid < 0)
+        {
+            state.SkipWithError("fork failed");
+            return;
+        }
+
+        const bool ready = dir.awaitCncReady(ROUND_TRIP_TIMEOUT_NS);
+        const int64_t elapsed_ns = now_ns() - start_ns;
+
+        int status = 0;
+        kill(pid, SIGINT);
+        waitpid(pid, &status, 0);
+
+        if (!ready)
+        {
+            state.SkipWithError("aeronmd did not signal cnc ready");
+            return;
+        }
+
+        state.SetIterationTime((double)elapsed_ns / 1e9);
+    }
+}
+
+/* The same without the process: context init and driver init, which signals cnc ready. */
+static void BM_DriverInitToCncReady(benchmark::State &state)
+{
+    while (state.KeepRunning())
+    {
+        TempAeronDir dir;
+        aeron_driver_context_t *context = NULL;
+        aeron_driver_t *driver = NULL;
+
+        setenv(AERON_DIR_ENV_VAR, dir.dir().c_str(), 1);
+        const int64_t start_ns = now_ns();
+
+        if (aeron_driver_context_init(&context) < 0 || aeron_driver_init(&driver, context) < 0)
+        {
+            state.SkipWithError(aeron_errmsg());
+            return;
+        }
+
+        state.SetIterationTime((double)(now_ns() - start_ns) / 1e9);
+
+        aeron_driver_close(driver);
+        aeron_driver_context_close(context);
+        unsetenv(AERON_DIR_ENV_VAR);
+    }
+}
+
+/*
+ * An embedded driver and the C client duty cycled in one thread, preloaded with existing publications or subscriptions
+ * on distinct streams. IPC publications each create and map a log file, UDP subscriptions share one receive endpoint.
+ * Logs are kept small, the counters buffer is sized for two counters per resource and publications linger briefly so
+ * tens of thousands fit and the count stays steady while the benchmark adds and removes its own.
+ */
+class ResourceHarness
+{
+public:
+    ResourceHarness()
+    {
+        setenv(AERON_DIR_ENV_VAR, m_dir.dir().c_str(), 1);
+
+        if (aeron_driver_context_init(&m_driver_context) < 0)
+        {
+            throw std::runtime_error("could not init driver context: " + std::string(aeron_errmsg()));
+        }
+
+        /* with dedicated agents invoked on one thread the conductor would spin on a full receiver command queue */
+        m_driver_context->threading_mode = AERON_THREADING_MODE_SHARED;
+        m_driver_context->term_buffer_length = 64 * 1024;
+        m_driver_context->ipc_term_buffer_length = 64 * 1024;
+        m_driver_context->term_buffer_sparse_file = true;
+        m_driver_context->publication_linger_timeout_ns = 1000 * 1000;
+        m_driver_context->counters_values_buffer_length = 8 * 1024 * 1024;
+        m_driver_context->counters_metadata_buffer_length =
+            m_driver_context->counters_values_buffer_length *
+            (AERON_COUNTERS_MANAGER_METADATA_LENGTH / AERON_COUNTERS_MANAGER_VALUE_LENGTH);
+
+        if (aeron_driver_init(&m_driver, m_driver_context) < 0 || aeron_driver_invoker_start(m_driver) < 0)
+        {
+            throw std::runtime_error("could not start driver: " + std::string(aeron_errmsg()));
+        }
+
+        if (aeron_context_init(&m_context) < 0 || aeron_init(&m_aeron, m_context) < 0)
+        {
+            throw std::runtime_error("could not connect client: " + std::string(aeron_errmsg()));
+        }
+    }
+
+    ~ResourceHarness()
+    {
+        aeron_close(m_aeron);
+        aeron_context_close(m_context);
+        aeron_driver_close(m_driver);
+        aeron_driver_context_close(m_driver_context);
+        unsetenv(AERON_DIR_ENV_VAR);
+    }
+
+    void preload(bool publications, int count)
+    {
+        /* removing the last subscription closes the endpoint, which would race with binding it again */
+        if (!publications)
+        {
+            awaitSubscription(addSubscription(m_next_stream_id++));
+        }
+
+        for (int i = 0; i < count; i += SETUP_BATCH_SIZE)
+        {
+            const int batch = std::min(SETUP_BATCH_SIZE, count - i);
+            std::vector<aeron_async_add_publication_t *> async_pubs;
+            std::vector<aeron_async_add_subscription_t *> async_subs;
+
+            for (int j = 0; j < batch; j++)
+            {
+                const int32_t stream_id = m_next_stream_id++;
+
+                if (publications)
+                {
+                    async_pubs.push_back(addPublication(stream_id));
+                }
+                else
+                {
+                    async_subs.push_back(addSubscription(stream_id));
+                }
+            }
+
+            for (aeron_async_add_publication_t *async : async_pubs)
+            {
+                awaitPublication(async);
+            }
+
+            for (aeron_async_add_subscription_t *async : async_subs)
+            {
+                awaitSubscription(async);
+            }
+        }
+    }
+
+    /* nanoseconds for one add round trip, the new resource is closed again untimed */
+    int64_t addAndRemove(bool publication)
+    {
+        const int32_t stream_id = m_next_stream_id++;
+        const int64_t start_ns = now_ns();
+        int64_t elapsed_ns;
+
+        if (publication)
+        {
+            aeron_publication_t *added = awaitPublication(addPublication(stream_id));
+            elapsed_ns = now_ns() - start_ns;
+            aeron_publication_close(added);
+        }
+        else
+        {
+            aeron_subscription_t *added = awaitSubscription(addSubscription(stream_id));
+            elapsed_ns = now_ns() - start_ns;
+            aeron_subscription_close(added);
+        }
+
+        doWork();
+
+        return elapsed_ns;
+    }
+
+private:
+    aeron_async_add_publication_t *addPublication(int32_t stream_id)
+    {
+        aeron_async_add_publication_t *async = NULL;
+
+        if (aeron_async_add_publication(&async, m_aeron, IPC_CHANNEL, stream_id) < 0)
+        {
+            throw std::runtime_error("could not add publication: " + std::string(aeron_errmsg()));
+        }
+
+        return async;
+    }
+
+    aeron_async_add_subscription_t *addSubscription(int32_t stream_id)
+    {
+        aeron_async_add_subscription_t *async = NULL;
+
+        if (aeron_async_add_subscription(&async, m_aeron, UDP_CHANNEL, stream_id, NULL, NULL, NULL, NULL) < 0)
+        {
+            throw std::runtime_error("could not add subscription: " + std::string(aeron_errmsg()));
+        }
+
+        return async;
+    }
+
+    aeron_publication_t *awaitPublication(aeron_async_add_publication_t *async)
+    {
+        aeron_publication_t *publication = NULL;
+        int result;
+
+        doWorkUntil([&]() { return 0 != (result = aeron_async_add_publication_poll(&publication, async)); });
+        if (result < 0 || NULL == publication)
+        {
+            throw std::runtime_error("publication not added: " + std::string(aeron_errmsg()));
+        }
+
+        return publication;
+    }
+
+    aeron_subscription_t *awaitSubscription(aeron_async_add_subscription_t *async)
+    {
+        aeron_subscription_t *subscription = NULL;
+        int result;
+
+        doWorkUntil([&]() { return 0 != (result = aeron_async_add_subscription_poll(&subscription, async)); });
+        if (result < 0 || NULL == subscription)
+        {
+            throw std::runtime_error("subscription not added: " + std::string(aeron_errmsg()));
+        }
+
+        return subscription;
+    }
+
+    void doWork()
+    {
+        aeron_driver_invoker_do_work(m_driver);
+        if (aeron_main_do_work(m_aeron) < 0)
+        {
+            throw std::runtime_error("client failed: " + std::string(aeron_errmsg()));
+        }
+    }
+
+    void doWorkUntil(const std::function<bool()> &condition)
+    {
+        const int64_t deadline_ns = now_ns() + ROUND_TRIP_TIMEOUT_NS;
+
+        while (!condition())
+        {
+            if (now_ns() > deadline_ns)
+            {
+                throw std::runtime_error("driver did not respond");
+            }
+
+            doWork();
+        }
+    }
+
+    TempAeronDir m_dir;
+    aeron_driver_context_t *m_driver_context = NULL;
+    aeron_driver_t *m_driver = NULL;
+    aeron_context_t *m_context = NULL;
+    aeron_t *m_aeron = NULL;
+    int32_t m_next_stream_id = BASE_STREAM_ID;
+};
+
+static std::string latency_label(std::vector<int64_t> &latencies_ns)
+{
+    char label[128];
+
+    if (latencies_ns.empty())
+    {
+        return "";
+    }
+
+    std::sort(latencies_ns.begin(), latencies_ns.end());
+    std::snprintf(
+        label, sizeof(label), "p50=%.1fus p99=%.1fus max=%.1fus",
+        latencies_ns[(latencies_ns.size() - 1) / 2] / 1000.0,
+        latencies_ns[(size_t)(0.99 * (double)(latencies_ns.size() - 1))] / 1000.0,
+        latencies_ns.back() / 1000.0);
+
+    return label;
+}
+
+/*
+ * The argument is the number of existing resources of the same kind. The harness is kept between the runs the library
+ * makes to settle the iteration count so the preload is only paid once per argument.
+ */
+static void add_resource_round_trip(benchmark::State &state, bool publication)
+{
+    static std::unique_ptr<ResourceHarness> harness;
+    static std::pair<bool, int64_t> harness_key;
+    std::vector<int64_t> latencies_ns;
+
+    try
+    {
+        if (!harness || harness_key != std::make_pair(publication, (int64_t)state.range(0)))
+        {
+            harness.reset();
+            harness.reset(new ResourceHarness());
+            harness_key = std::make_pair(publication, (int64_t)state.range(0));
+            harness->preload(publication, (int)state.range(0));
+        }
+
+        while (state.KeepRunning())
+        {
+            const int64_t elapsed_ns = harness->addAndRemove(publication);
+
+            latencies_ns.push_back(elapsed_ns);
+            state.SetIterationTime((double)elapsed_ns / 1e9);
+        }
+    }
+    catch (const std::exception &ex)
+    {
+        harness.reset();
+        state.SkipWithError(ex.what());
+        return;
+    }
+
+    state.SetLabel(latency_label(latencies_ns));
+}
+
+static void BM_AddPublicationRoundTrip(benchmark::State &state)
+{
+    add_resource_round_trip(state, true);
+}
+
+static void BM_AddSubscriptionRoundTrip(benchmark::State &state)
+{
+    add_resource_round_trip(state, false);
+}
+
+BENCHMARK(BM_AeronmdStartToCncReady)->UseManualTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DriverInitToCncReady)->UseManualTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AddPublicationRoundTrip)->Arg(0)->Arg(1000)->Arg(10000)->UseManualTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AddSubscriptionRoundTrip)->Arg(0)->Arg(1000)->Arg(10000)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <cstring>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+extern "C"
+{
+#include "aeron_durable_log_syncer.h"
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define PAGE_SIZE (4 * 1024)
+
+static int64_t now_ns = 0;
+
+static int64_t test_nano_clock()
+{
+    return now_ns;
+}
+
+class DurableLogSyncerTest : public testing::Test
+{
+public:
+    DurableLogSyncerTest()
+    {
+        char dir_template[] = "/tmp/aeron-durable-log-syncer-test-XXXXXX";
+
+        if (NULL == mkdtemp(dir_template))
+        {
+            throw std::runtime_error("could not create temp dir");
+        }
+
+        m_dir = dir_template;
+        now_ns = 0;
+    }
+
+    ~DurableLogSyncerTest() override
+    {
+        aeron_dir_delete(m_dir.c_str());
+    }
+
+    void createLog(int64_t sync_interval_ns)
+    {
+        ASSERT_EQ(aeron_durable_log_syncer_init(
+            &m_syncer, (m_dir + "/durable").c_str(), sync_interval_ns, test_nano_clock, 0x1234), 0);
+
+        m_path = std::string(m_syncer.dir) + "/" + AERON_DURABLE_LOG_SYNCER_PUBLICATIONS_DIR + "/test.logbuffer";
+        ASSERT_EQ(aeron_map_raw_log(&m_raw_log, m_path.c_str(), false, TERM_LENGTH, PAGE_SIZE), 0);
+
+        m_meta_data = (aeron_logbuffer_metadata_t *)m_raw_log.log_meta_data.addr;
+        m_meta_data->term_length = TERM_LENGTH;
+        m_meta_data->page_size = PAGE_SIZE;
+        m_meta_data->initial_term_id = 0;
+        m_meta_data->term_tail_counters[0] = 0;
+        m_meta_data->active_term_count = 0;
+
+        ASSERT_EQ(aeron_durable_log_syncer_add(&m_syncer, m_path.c_str(), 0, &m_log), 0);
+    }
+
+    void closeLog()
+    {
+        aeron_durable_log_syncer_on_close(&m_syncer);
+        aeron_map_raw_log_close(&m_raw_log);
+    }
+
+    int32_t claim(int32_t length)
+    {
+        const int32_t offset = (int32_t)m_meta_data->term_tail_counters[0];
+        aeron_frame_header_t *frame_header = (aeron_frame_header_t *)(m_raw_log.term_buffers[0].addr + offset);
+
+        frame_header->frame_length = -length;
+        m_meta_data->term_tail_counters[0] = offset + AERON_ALIGN(length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+        return offset;
+    }
+
+    void commit(int32_t offset)
+    {
+        aeron_frame_header_t *frame_header = (aeron_frame_header_t *)(m_raw_log.term_buffers[0].addr + offset);
+
+        frame_header->frame_length = -frame_header->frame_length;
+    }
+
+protected:
+    std::string m_dir;
+    std::string m_path;
+    aeron_durable_log_syncer_t m_syncer;
+    aeron_mapped_raw_log_t m_raw_log;
+    aeron_logbuffer_metadata_t *m_meta_data;
+    aeron_durable_log_t *m_log;
+};
+
+TEST_F(DurableLogSyncerTest, shouldKeepLogsOfRunInDirectoryNamedForStartTime)
+{
+    createLog(0);
+
+    struct stat sb;
+    EXPECT_EQ(stat((m_dir + "/durable/1234/publications").c_str(), &sb), 0);
+    EXPECT_EQ(aeron_durable_log_position(m_log), 0);
+
+    closeLog();
+}
+
+TEST_F(DurableLogSyncerTest, shouldOnlyMakeCommittedFramesDurable)
+{
+    createLog(0);
+
+    aeron_durable_log_syncer_do_work(&m_syncer);
+    EXPECT_EQ(m_syncer.logs.length, 1u);
+
+    const int32_t first = claim(100);
+    const int32_t second = claim(64);
+    commit(first);
+
+    EXPECT_EQ(aeron_durable_log_syncer_do_work(&m_syncer), 1);
+    EXPECT_EQ(aeron_durable_log_position(m_log), 128);
+
+    EXPECT_EQ(aeron_durable_log_syncer_do_work(&m_syncer), 0);
+    EXPECT_EQ(aeron_durable_log_position(m_log), 128);
+
+    commit(second);
+    EXPECT_EQ(aeron_durable_log_syncer_do_work(&m_syncer), 1);
+    EXPECT_EQ(aeron_durable_log_position(m_log), 192);
+    EXPECT_EQ(m_syncer.sync_failures, 0);
+
+    closeLog();
+}
+
+TEST_F(DurableLogSyncerTest, shouldSyncAsGroupOnInterval)
+{
+    createLog(1000);
+
+    aeron_durable_log_syncer_do_work(&m_syncer);
+
+    commit(claim(32));
+    commit(claim(32));
+    commit(claim(32));
+
+    EXPECT_EQ(aeron_durable_log_syncer_do_work(&m_syncer), 0);
+    EXPECT_EQ(aeron_durable_log_position(m_log), 0);
+
+    now_ns += 1000;
+    EXPECT_EQ(aeron_durable_log_syncer_do_work(&m_syncer), 1);
+    EXPECT_EQ(aeron_durable_log_position(m_log), 96);
+
+    closeLog();
+}
+
+TEST_F(DurableLogSyncerTest, shouldFreeLogOnceRemoved)
+{
+    createLog(0);
+
+    aeron_durable_log_syncer_do_work(&m_syncer);
+    EXPECT_EQ(m_syncer.logs.length, 1u);
+
+    aeron_durable_log_syncer_remove(m_log);
+    EXPECT_EQ(aeron_durable_log_syncer_do_work(&m_syncer), 1);
+    EXPECT_EQ(m_syncer.logs.length, 0u);
+
+    closeLog();
+}
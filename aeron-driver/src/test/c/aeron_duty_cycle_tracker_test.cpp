@@ -0,0 +1,162 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_duty_cycle_tracker.h"
+}
+
+#define THRESHOLD_NS (1000 * 1000L)
+#define NUM_COUNTERS (3 + AERON_DUTY_CYCLE_HISTOGRAM_BUCKET_COUNT)
+
+static int64_t null_epoch_clock()
+{
+    return 0;
+}
+
+static int64_t test_nano_clock()
+{
+    return 0;
+}
+
+typedef struct counter_record_stct
+{
+    int32_t type_id;
+    int64_t key;
+    std::string label;
+}
+counter_record_t;
+
+static void record_counter(
+    int32_t id, int32_t type_id, const uint8_t *key, size_t key_length, const uint8_t *label, size_t label_length,
+    void *clientd)
+{
+    auto *records = static_cast<std::vector<counter_record_t> *>(clientd);
+    int64_t key_value;
+
+    std::memcpy(&key_value, key, sizeof(key_value));
+    records->push_back({ type_id, key_value, std::string((const char *)label, label_length) });
+}
+
+class DutyCycleTrackerTest : public testing::Test
+{
+public:
+    DutyCycleTrackerTest()
+    {
+        m_metadata.fill(0);
+        m_values.fill(0);
+        aeron_counters_manager_init(
+            &m_manager, m_metadata.data(), m_metadata.size(), m_values.data(), m_values.size(), null_epoch_clock, 0);
+    }
+
+    ~DutyCycleTrackerTest() override
+    {
+        aeron_counters_manager_close(&m_manager);
+    }
+
+protected:
+    std::array<std::uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_METADATA_LENGTH> m_metadata;
+    std::array<std::uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_VALUE_LENGTH> m_values;
+    aeron_counters_manager_t m_manager;
+    aeron_duty_cycle_tracker_t m_tracker;
+};
+
+TEST_F(DutyCycleTrackerTest, shouldAllocateLabelledCountersForRole)
+{
+    std::vector<counter_record_t> records;
+
+    ASSERT_EQ(aeron_duty_cycle_tracker_init(&m_tracker, &m_manager, "sender", THRESHOLD_NS, test_nano_clock), 0);
+    aeron_counters_reader_foreach(m_metadata.data(), m_metadata.size(), record_counter, &records);
+
+    ASSERT_EQ(records.size(), (size_t)NUM_COUNTERS);
+    EXPECT_EQ(records[0].type_id, AERON_COUNTER_DUTY_CYCLE_TIMESTAMP_TYPE_ID);
+    EXPECT_EQ(records[0].label, "sender duty cycle timestamp in ns");
+    EXPECT_EQ(records[1].type_id, AERON_COUNTER_DUTY_CYCLE_MAX_TYPE_ID);
+    EXPECT_EQ(records[1].label, "sender max duty cycle time in ns");
+    EXPECT_EQ(records[2].type_id, AERON_COUNTER_DUTY_CYCLE_THRESHOLD_EXCEEDED_TYPE_ID);
+    EXPECT_EQ(records[2].key, THRESHOLD_NS);
+    EXPECT_EQ(records[2].label, "sender duty cycle time exceeded count: threshold=1000000ns");
+    EXPECT_EQ(records[3].type_id, AERON_COUNTER_DUTY_CYCLE_HISTOGRAM_TYPE_ID);
+    EXPECT_EQ(records[3].key, 1000);
+    EXPECT_EQ(records[3].label, "sender duty cycles <= 1000ns");
+    EXPECT_EQ(records[NUM_COUNTERS - 2].label, "sender duty cycles <= 1000000000ns");
+    EXPECT_EQ(records[NUM_COUNTERS - 1].key, INT64_MAX);
+    EXPECT_EQ(records[NUM_COUNTERS - 1].label, "sender duty cycles > 1000000000ns");
+}
+
+TEST_F(DutyCycleTrackerTest, shouldOnlyRecordTimestampOnFirstCycle)
+{
+    ASSERT_EQ(aeron_duty_cycle_tracker_init(&m_tracker, &m_manager, "conductor", THRESHOLD_NS, test_nano_clock), 0);
+
+    aeron_duty_cycle_tracker_update(&m_tracker, 5 * 1000 * 1000 * 1000L);
+
+    EXPECT_EQ(*m_tracker.cycle_timestamp, 5 * 1000 * 1000 * 1000L);
+    EXPECT_EQ(*m_tracker.max_cycle_time, 0);
+    EXPECT_EQ(*m_tracker.threshold_exceeded, 0);
+    for (size_t i = 0; i < AERON_DUTY_CYCLE_HISTOGRAM_BUCKET_COUNT; i++)
+    {
+        EXPECT_EQ(*m_tracker.histogram[i], 0);
+    }
+}
+
+TEST_F(DutyCycleTrackerTest, shouldTrackMaxHistogramAndThreshold)
+{
+    ASSERT_EQ(aeron_duty_cycle_tracker_init(&m_tracker, &m_manager, "receiver", THRESHOLD_NS, test_nano_clock), 0);
+
+    int64_t now_ns = 1000;
+    aeron_duty_cycle_tracker_update(&m_tracker, now_ns);
+
+    const int64_t cycle_times_ns[] = { 500, 1000, 1001, 50 * 1000, 2 * 1000 * 1000, 5LL * 1000 * 1000 * 1000 };
+    for (int64_t cycle_time_ns : cycle_times_ns)
+    {
+        now_ns += cycle_time_ns;
+        aeron_duty_cycle_tracker_update(&m_tracker, now_ns);
+    }
+
+    EXPECT_EQ(*m_tracker.cycle_timestamp, now_ns);
+    EXPECT_EQ(*m_tracker.max_cycle_time, 5LL * 1000 * 1000 * 1000);
+    EXPECT_EQ(*m_tracker.threshold_exceeded, 2);
+    EXPECT_EQ(*m_tracker.histogram[0], 2);
+    EXPECT_EQ(*m_tracker.histogram[1], 1);
+    EXPECT_EQ(*m_tracker.histogram[2], 1);
+    EXPECT_EQ(*m_tracker.histogram[3], 0);
+    EXPECT_EQ(*m_tracker.histogram[4], 1);
+    EXPECT_EQ(*m_tracker.histogram[5], 0);
+    EXPECT_EQ(*m_tracker.histogram[6], 0);
+    EXPECT_EQ(*m_tracker.histogram[7], 1);
+}
+
+TEST_F(DutyCycleTrackerTest, shouldFailWhenCountersAreExhausted)
+{
+    std::array<std::uint8_t, 2 * AERON_COUNTERS_MANAGER_METADATA_LENGTH> metadata = {};
+    std::array<std::uint8_t, 2 * AERON_COUNTERS_MANAGER_VALUE_LENGTH> values = {};
+    aeron_counters_manager_t manager;
+
+    aeron_counters_manager_init(
+        &manager, metadata.data(), metadata.size(), values.data(), values.size(), null_epoch_clock, 0);
+
+    EXPECT_EQ(aeron_duty_cycle_tracker_init(&m_tracker, &manager, "conductor", THRESHOLD_NS, test_nano_clock), -1);
+
+    aeron_counters_manager_close(&manager);
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_fec.h"
+}
+
+#define MTU_LENGTH (1408)
+#define TERM_LENGTH (64 * 1024)
+#define SESSION_ID (7)
+#define STREAM_ID (11)
+#define TERM_ID (3)
+
+class FecTest : public testing::Test
+{
+public:
+    FecTest()
+    {
+        m_sent.fill(0);
+        m_term.fill(0);
+        aeron_fec_encoder_init(&m_encoder, 3, MTU_LENGTH);
+    }
+
+    ~FecTest() override
+    {
+        aeron_fec_encoder_close(&m_encoder);
+    }
+
+protected:
+    /* writes a data frame of length at term_offset into the sent term and adds it to the encoder */
+    bool send(int32_t term_offset, int32_t length)
+    {
+        auto *header = (aeron_data_header_t *)(m_sent.data() + term_offset);
+        header->frame_header.frame_length = length;
+        header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        header->frame_header.flags = AERON_DATA_HEADER_BEGIN_FLAG | AERON_DATA_HEADER_END_FLAG;
+        header->frame_header.type = AERON_HDR_TYPE_DATA;
+        header->term_offset = term_offset;
+        header->session_id = SESSION_ID;
+        header->stream_id = STREAM_ID;
+        header->term_id = TERM_ID;
+
+        for (int32_t i = AERON_DATA_HEADER_LENGTH; i < length; i++)
+        {
+            m_sent[term_offset + i] = static_cast<uint8_t>(term_offset + i * 31);
+        }
+
+        return aeron_fec_encoder_add(&m_encoder, TERM_ID, term_offset, m_sent.data() + term_offset, length, 0);
+    }
+
+    void receive(int32_t term_offset, int32_t length)
+    {
+        std::memcpy(m_term.data() + term_offset, m_sent.data() + term_offset, static_cast<size_t>(length));
+    }
+
+    size_t encode()
+    {
+        return aeron_fec_encoder_encode(&m_encoder, SESSION_ID, STREAM_ID, m_frame.data(), m_frame.size());
+    }
+
+    int decode(size_t frame_length, int32_t *term_offset)
+    {
+        return aeron_fec_decode(
+            m_frame.data(), frame_length, m_term.data(), m_term.size(), m_rebuilt.data(), m_rebuilt.size(), term_offset);
+    }
+
+    aeron_fec_encoder_t m_encoder;
+    std::array<uint8_t, TERM_LENGTH> m_sent;
+    std::array<uint8_t, TERM_LENGTH> m_term;
+    std::array<uint8_t, AERON_FEC_FRAME_MAX_LENGTH(MTU_LENGTH)> m_frame;
+    std::array<uint8_t, MTU_LENGTH> m_rebuilt;
+};
+
+TEST_F(FecTest, shouldRejectInvalidGroupSize)
+{
+    aeron_fec_encoder_t encoder;
+
+    EXPECT_EQ(aeron_fec_encoder_init(&encoder, 0, MTU_LENGTH), -1);
+    EXPECT_EQ(aeron_fec_encoder_init(&encoder, AERON_FEC_MAX_GROUP_SIZE + 1, MTU_LENGTH), -1);
+}
+
+TEST_F(FecTest, shouldSignalWhenGroupIsFull)
+{
+    EXPECT_FALSE(send(0, 1024));
+    EXPECT_FALSE(send(1024, 256));
+    EXPECT_TRUE(send(1280, 512));
+    EXPECT_GT(encode(), sizeof(aeron_fec_header_t));
+    EXPECT_EQ(encode(), 0u);
+}
+
+TEST_F(FecTest, shouldDetectDiscontiguousDatagram)
+{
+    send(0, 1024);
+
+    EXPECT_FALSE(aeron_fec_encoder_is_discontiguous(&m_encoder, TERM_ID, 1024));
+    EXPECT_TRUE(aeron_fec_encoder_is_discontiguous(&m_encoder, TERM_ID, 2048));
+    EXPECT_TRUE(aeron_fec_encoder_is_discontiguous(&m_encoder, TERM_ID + 1, 1024));
+}
+
+TEST_F(FecTest, shouldRebuildSingleMissingDatagram)
+{
+    send(0, 1024);
+    send(1024, 256);
+    send(1280, 512);
+    const size_t frame_length = encode();
+
+    receive(0, 1024);
+    receive(1280, 512);
+
+    int32_t term_offset = -1;
+    ASSERT_EQ(decode(frame_length, &term_offset), 256);
+    EXPECT_EQ(term_offset, 1024);
+    EXPECT_EQ(std::memcmp(m_rebuilt.data(), m_sent.data() + 1024, 256), 0);
+}
+
+TEST_F(FecTest, shouldRebuildLongestDatagram)
+{
+    send(0, 1024);
+    send(1024, 256);
+    send(1280, 512);
+    const size_t frame_length = encode();
+
+    receive(1024, 256);
+    receive(1280, 512);
+
+    int32_t term_offset = -1;
+    ASSERT_EQ(decode(frame_length, &term_offset), 1024);
+    EXPECT_EQ(term_offset, 0);
+    EXPECT_EQ(std::memcmp(m_rebuilt.data(), m_sent.data(), 1024), 0);
+}
+
+TEST_F(FecTest, shouldNotRebuildWhenNothingIsMissing)
+{
+    send(0, 1024);
+    send(1024, 256);
+    send(1280, 512);
+    const size_t frame_length = encode();
+
+    receive(0, 1792);
+
+    int32_t term_offset = -1;
+    EXPECT_EQ(decode(frame_length, &term_offset), 0);
+}
+
+TEST_F(FecTest, shouldNotRebuildWhenMoreThanOneIsMissing)
+{
+    send(0, 1024);
+    send(1024, 256);
+    send(1280, 512);
+    const size_t frame_length = encode();
+
+    receive(1280, 512);
+
+    int32_t term_offset = -1;
+    EXPECT_EQ(decode(frame_length, &term_offset), 0);
+}
+
+TEST_F(FecTest, shouldRejectMalformedFrame)
+{
+    send(0, 1024);
+    send(1024, 256);
+    send(1280, 512);
+    const size_t frame_length = encode();
+
+    receive(0, 1024);
+
+    int32_t term_offset = -1;
+    EXPECT_EQ(decode(sizeof(aeron_fec_header_t), &term_offset), -1);
+
+    auto *header = (aeron_fec_header_t *)m_frame.data();
+    header->datagram_count = AERON_FEC_MAX_GROUP_SIZE + 1;
+    EXPECT_EQ(decode(frame_length, &term_offset), -1);
+}
+
+TEST_F(FecTest, shouldRejectRebuildThatDoesNotMatchStream)
+{
+    send(0, 1024);
+    send(1024, 256);
+    send(1280, 512);
+    const size_t frame_length = encode();
+
+    receive(0, 1024);
+    receive(1280, 512);
+
+    auto *header = (aeron_fec_header_t *)m_frame.data();
+    header->stream_id = STREAM_ID + 1;
+
+    int32_t term_offset = -1;
+    EXPECT_EQ(decode(frame_length, &term_offset), -1);
+}
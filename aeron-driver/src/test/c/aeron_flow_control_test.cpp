@@ -0,0 +1,207 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "protocol/aeron_udp_protocol.h"
+#include "aeron_flow_control.h"
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define POSITION_BITS_TO_SHIFT (16)
+#define INITIAL_TERM_ID (7)
+#define WINDOW_LENGTH (16 * 1024)
+#define RECEIVER_TIMEOUT_NS (2 * 1000 * 1000 * 1000L)
+#define GROUP_TAG (100)
+
+class FlowControlTest : public testing::Test
+{
+public:
+    ~FlowControlTest()
+    {
+        if (NULL != m_strategy)
+        {
+            m_strategy->fini(m_strategy);
+        }
+    }
+
+protected:
+    int create(aeron_flow_control_strategy_supplier_func_t supplier, const char *channel)
+    {
+        return supplier(&m_strategy, channel, 1001, 1, INITIAL_TERM_ID, TERM_LENGTH);
+    }
+
+    int64_t onStatusMessage(
+        int64_t receiver_id, int64_t position, int64_t snd_lmt, int64_t now_ns, const int64_t *group_tag = NULL)
+    {
+        uint8_t buffer[sizeof(aeron_status_message_header_t) + sizeof(int64_t)];
+        aeron_status_message_header_t *sm = (aeron_status_message_header_t *)buffer;
+        size_t length = sizeof(aeron_status_message_header_t);
+
+        memset(buffer, 0, sizeof(buffer));
+        sm->frame_header.type = AERON_HDR_TYPE_SM;
+        sm->consumption_term_id = INITIAL_TERM_ID + (int32_t)(position >> POSITION_BITS_TO_SHIFT);
+        sm->consumption_term_offset = (int32_t)(position & (TERM_LENGTH - 1));
+        sm->receiver_window = WINDOW_LENGTH;
+        sm->receiver_id = receiver_id;
+
+        if (NULL != group_tag)
+        {
+            memcpy(buffer + AERON_STATUS_MESSAGE_GROUP_TAG_OFFSET, group_tag, sizeof(int64_t));
+            length += sizeof(int64_t);
+        }
+
+        return m_strategy->on_status_message(
+            m_strategy->state, buffer, length, &m_addr, snd_lmt, INITIAL_TERM_ID, POSITION_BITS_TO_SHIFT, now_ns);
+    }
+
+    aeron_flow_control_strategy_t *m_strategy = NULL;
+    struct sockaddr_storage m_addr = {};
+};
+
+TEST_F(FlowControlTest, shouldParseOptions)
+{
+    aeron_flow_control_strategy_options_t options;
+
+    ASSERT_EQ(aeron_flow_control_strategy_parse_options("tagged,g:-5,t:500ms", &options), 0);
+    EXPECT_EQ(std::string(options.strategy_name, options.strategy_name_length), "tagged");
+    EXPECT_TRUE(options.has_group_tag);
+    EXPECT_EQ(options.group_tag, -5);
+    EXPECT_EQ(options.receiver_timeout_ns, 500 * 1000 * 1000L);
+
+    ASSERT_EQ(aeron_flow_control_strategy_parse_options("min", &options), 0);
+    EXPECT_EQ(std::string(options.strategy_name, options.strategy_name_length), "min");
+    EXPECT_FALSE(options.has_group_tag);
+    EXPECT_EQ(options.receiver_timeout_ns, AERON_MIN_FLOW_CONTROL_STRATEGY_RECEIVER_TIMEOUT_NS);
+
+    ASSERT_EQ(aeron_flow_control_strategy_parse_options("min,t:3s", &options), 0);
+    EXPECT_EQ(options.receiver_timeout_ns, 3 * 1000 * 1000 * 1000L);
+
+    EXPECT_EQ(aeron_flow_control_strategy_parse_options("min,t:3h", &options), -1);
+    EXPECT_EQ(aeron_flow_control_strategy_parse_options("tagged,g:1x", &options), -1);
+    EXPECT_EQ(aeron_flow_control_strategy_parse_options("min,x:1", &options), -1);
+}
+
+TEST_F(FlowControlTest, shouldSelectSupplierFromChannel)
+{
+    aeron_uri_t uri;
+    aeron_flow_control_strategy_supplier_func_t supplier = NULL;
+
+    ASSERT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.20.30.39:24326|fc=min", &uri), 0);
+    ASSERT_EQ(aeron_flow_control_strategy_supplier_for_uri(
+        &uri, aeron_max_multicast_flow_control_strategy_supplier, &supplier), 0);
+    EXPECT_TRUE(aeron_min_multicast_flow_control_strategy_supplier == supplier);
+    aeron_uri_close(&uri);
+
+    ASSERT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.20.30.39:24326", &uri), 0);
+    ASSERT_EQ(aeron_flow_control_strategy_supplier_for_uri(
+        &uri, aeron_max_multicast_flow_control_strategy_supplier, &supplier), 0);
+    EXPECT_TRUE(aeron_max_multicast_flow_control_strategy_supplier == supplier);
+    aeron_uri_close(&uri);
+
+    ASSERT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.20.30.39:24326|fc=slowest", &uri), 0);
+    EXPECT_EQ(aeron_flow_control_strategy_supplier_for_uri(
+        &uri, aeron_max_multicast_flow_control_strategy_supplier, &supplier), -1);
+    aeron_uri_close(&uri);
+}
+
+TEST_F(FlowControlTest, shouldLimitToSlowestReceiverWithMin)
+{
+    ASSERT_EQ(create(aeron_min_multicast_flow_control_strategy_supplier, "aeron:udp?endpoint=224.20.30.39:24326"), 0);
+
+    EXPECT_EQ(onStatusMessage(1, 4096, 0, 0), 4096 + WINDOW_LENGTH);
+    EXPECT_EQ(onStatusMessage(2, 1024, 4096 + WINDOW_LENGTH, 0), 1024 + WINDOW_LENGTH);
+    EXPECT_EQ(onStatusMessage(1, 8192, 1024 + WINDOW_LENGTH, 0), 1024 + WINDOW_LENGTH);
+    EXPECT_EQ(onStatusMessage(2, 8192, 1024 + WINDOW_LENGTH, 0), 8192 + WINDOW_LENGTH);
+}
+
+TEST_F(FlowControlTest, shouldReportLimitingReceiverWithMin)
+{
+    ASSERT_EQ(create(aeron_min_multicast_flow_control_strategy_supplier, "aeron:udp?endpoint=224.20.30.39:24326"), 0);
+
+    onStatusMessage(1, 4096, 0, 0);
+    EXPECT_EQ(m_strategy->limiting_receiver_id(m_strategy->state), 1);
+    onStatusMessage(2, 1024, 4096 + WINDOW_LENGTH, 0);
+    EXPECT_EQ(m_strategy->limiting_receiver_id(m_strategy->state), 2);
+    onStatusMessage(1, 8192, 1024 + WINDOW_LENGTH, 0);
+    EXPECT_EQ(m_strategy->limiting_receiver_id(m_strategy->state), 2);
+    onStatusMessage(2, 16384, 1024 + WINDOW_LENGTH, 0);
+    EXPECT_EQ(m_strategy->limiting_receiver_id(m_strategy->state), 1);
+}
+
+TEST_F(FlowControlTest, shouldDropTimedOutReceiversWithMin)
+{
+    ASSERT_EQ(create(
+        aeron_min_multicast_flow_control_strategy_supplier, "aeron:udp?endpoint=224.20.30.39:24326|fc=min,t:1s"), 0);
+
+    const int64_t timeout_ns = 1000 * 1000 * 1000L;
+
+    onStatusMessage(1, 1024, 0, 0);
+    EXPECT_EQ(onStatusMessage(2, 8192, 0, timeout_ns), 1024 + WINDOW_LENGTH);
+
+    EXPECT_EQ(m_strategy->on_idle(m_strategy->state, timeout_ns, 1024 + WINDOW_LENGTH, 0, false),
+        1024 + WINDOW_LENGTH);
+    EXPECT_EQ(m_strategy->on_idle(m_strategy->state, timeout_ns + 1, 1024 + WINDOW_LENGTH, 0, false),
+        8192 + WINDOW_LENGTH);
+    EXPECT_EQ(m_strategy->on_idle(m_strategy->state, (2 * timeout_ns) + 1, 8192 + WINDOW_LENGTH, 0, false),
+        8192 + WINDOW_LENGTH);
+}
+
+TEST_F(FlowControlTest, shouldStopLingeringOnceReceiversCatchUpWithMin)
+{
+    ASSERT_EQ(create(aeron_min_multicast_flow_control_strategy_supplier, "aeron:udp?endpoint=224.20.30.39:24326"), 0);
+
+    onStatusMessage(1, 1024, 0, 0);
+    onStatusMessage(2, 4096, 0, 0);
+
+    m_strategy->on_idle(m_strategy->state, 0, 1024 + WINDOW_LENGTH, 4096, true);
+    EXPECT_TRUE(m_strategy->should_linger(m_strategy->state, 0));
+
+    onStatusMessage(1, 4096, 0, 0);
+    m_strategy->on_idle(m_strategy->state, 0, 4096 + WINDOW_LENGTH, 4096, true);
+    EXPECT_FALSE(m_strategy->should_linger(m_strategy->state, 0));
+}
+
+TEST_F(FlowControlTest, shouldOnlyCountReceiversInGroupWithTagged)
+{
+    ASSERT_EQ(create(
+        aeron_tagged_multicast_flow_control_strategy_supplier,
+        "aeron:udp?endpoint=224.20.30.39:24326|fc=tagged,g:100"), 0);
+
+    const int64_t group_tag = GROUP_TAG;
+    const int64_t other_group_tag = GROUP_TAG + 1;
+
+    EXPECT_EQ(onStatusMessage(1, 0, 0, 0), 0);
+    EXPECT_EQ(onStatusMessage(2, 0, 0, 0, &other_group_tag), 0);
+    EXPECT_EQ(m_strategy->on_idle(m_strategy->state, 0, 0, 0, false), 0);
+
+    EXPECT_EQ(onStatusMessage(3, 4096, 0, 0, &group_tag), 4096 + WINDOW_LENGTH);
+    EXPECT_EQ(onStatusMessage(1, 0, 4096 + WINDOW_LENGTH, 0), 4096 + WINDOW_LENGTH);
+    EXPECT_EQ(onStatusMessage(4, 2048, 4096 + WINDOW_LENGTH, 0, &group_tag), 2048 + WINDOW_LENGTH);
+}
+
+TEST_F(FlowControlTest, shouldRequireGroupTagForTagged)
+{
+    EXPECT_EQ(create(
+        aeron_tagged_multicast_flow_control_strategy_supplier, "aeron:udp?endpoint=224.20.30.39:24326|fc=tagged"), -1);
+    EXPECT_EQ(m_strategy, (aeron_flow_control_strategy_t *)NULL);
+}
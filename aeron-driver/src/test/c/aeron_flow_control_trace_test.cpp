@@ -0,0 +1,127 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "reports/aeron_flow_control_trace.h"
+}
+
+#define RECORD_CAPACITY (8)
+#define CAPACITY \
+    (sizeof(aeron_flow_control_trace_header_t) + (RECORD_CAPACITY * sizeof(aeron_flow_control_trace_record_t)))
+
+#define REGISTRATION_ID (7)
+#define SESSION_ID (0x0EADBEEF)
+#define STREAM_ID (0x12A)
+
+typedef std::array<std::uint8_t, CAPACITY + sizeof(aeron_flow_control_trace_record_t) - 1> buffer_t;
+
+class FlowControlTraceTest : public testing::Test
+{
+public:
+    FlowControlTraceTest()
+    {
+        m_buffer.fill(0);
+    }
+
+protected:
+    static void on_record(void *clientd, const aeron_flow_control_trace_record_t *record)
+    {
+        ((FlowControlTraceTest *)clientd)->m_records.push_back(*record);
+    }
+
+    size_t read()
+    {
+        m_records.clear();
+        return aeron_flow_control_trace_read(m_buffer.data(), m_buffer.size(), on_record, this);
+    }
+
+    void record(aeron_flow_control_trace_t *trace, int64_t limit)
+    {
+        aeron_flow_control_trace_record(
+            trace,
+            AERON_FLOW_CONTROL_TRACE_EVENT_SND_LMT,
+            AERON_FLOW_CONTROL_TRACE_CAUSE_RECEIVER,
+            42,
+            REGISTRATION_ID,
+            SESSION_ID,
+            STREAM_ID,
+            limit,
+            limit - 1024,
+            limit * 10);
+    }
+
+    AERON_DECL_ALIGNED(buffer_t m_buffer, 16);
+    std::vector<aeron_flow_control_trace_record_t> m_records;
+};
+
+TEST_F(FlowControlTraceTest, shouldRoundCapacityDownToPowerOfTwo)
+{
+    aeron_flow_control_trace_t trace;
+
+    ASSERT_EQ(aeron_flow_control_trace_init(&trace, m_buffer.data(), m_buffer.size()), 0);
+    EXPECT_EQ(trace.header->record_capacity, RECORD_CAPACITY);
+    EXPECT_EQ(read(), 0u);
+}
+
+TEST_F(FlowControlTraceTest, shouldReadRecordsInOrder)
+{
+    aeron_flow_control_trace_t trace;
+
+    ASSERT_EQ(aeron_flow_control_trace_init(&trace, m_buffer.data(), m_buffer.size()), 0);
+    record(&trace, 4096);
+    record(&trace, 8192);
+
+    ASSERT_EQ(read(), 2u);
+    EXPECT_EQ(m_records[0].limit, 4096);
+    EXPECT_EQ(m_records[0].position, 4096 - 1024);
+    EXPECT_EQ(m_records[0].timestamp_ns, 40960);
+    EXPECT_EQ(m_records[0].event_type, AERON_FLOW_CONTROL_TRACE_EVENT_SND_LMT);
+    EXPECT_EQ(m_records[0].cause, AERON_FLOW_CONTROL_TRACE_CAUSE_RECEIVER);
+    EXPECT_EQ(m_records[0].cause_id, 42);
+    EXPECT_EQ(m_records[0].registration_id, REGISTRATION_ID);
+    EXPECT_EQ(m_records[0].session_id, SESSION_ID);
+    EXPECT_EQ(m_records[0].stream_id, STREAM_ID);
+    EXPECT_EQ(m_records[1].limit, 8192);
+}
+
+TEST_F(FlowControlTraceTest, shouldKeepNewestRecordsOnceWrapped)
+{
+    aeron_flow_control_trace_t trace;
+
+    ASSERT_EQ(aeron_flow_control_trace_init(&trace, m_buffer.data(), m_buffer.size()), 0);
+    for (int64_t i = 1; i <= RECORD_CAPACITY + 3; i++)
+    {
+        record(&trace, i);
+    }
+
+    ASSERT_EQ(read(), (size_t)RECORD_CAPACITY);
+    EXPECT_EQ(m_records.front().limit, 4);
+    EXPECT_EQ(m_records.back().limit, RECORD_CAPACITY + 3);
+}
+
+TEST_F(FlowControlTraceTest, shouldNotRecordWhenNotEnabled)
+{
+    aeron_flow_control_trace_t trace = { NULL, NULL, 0 };
+
+    record(&trace, 4096);
+    record(NULL, 4096);
+}
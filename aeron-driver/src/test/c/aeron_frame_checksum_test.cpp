@@ -0,0 +1,137 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_frame_checksum.h"
+#include "util/aeron_crc32c.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+}
+
+#define SESSION_ID (7)
+#define STREAM_ID (11)
+#define TERM_ID (3)
+
+class FrameChecksumTest : public testing::Test
+{
+public:
+    FrameChecksumTest()
+    {
+        m_datagram.fill(0);
+    }
+
+    size_t addFrame(size_t offset, int32_t frame_length, uint16_t type, uint8_t fill)
+    {
+        aeron_data_header_t *data_header = (aeron_data_header_t *)(m_datagram.data() + offset);
+
+        data_header->frame_header.frame_length = frame_length;
+        data_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        data_header->frame_header.flags = AERON_DATA_HEADER_BEGIN_FLAG | AERON_DATA_HEADER_END_FLAG;
+        data_header->frame_header.type = type;
+        data_header->term_offset = (int32_t)offset;
+        data_header->session_id = SESSION_ID;
+        data_header->stream_id = STREAM_ID;
+        data_header->term_id = TERM_ID;
+        data_header->reserved_value = 0;
+
+        if (AERON_HDR_TYPE_DATA == type && frame_length > (int32_t)sizeof(aeron_data_header_t))
+        {
+            memset(data_header + 1, fill, (size_t)frame_length - sizeof(aeron_data_header_t));
+        }
+
+        return AERON_ALIGN((size_t)frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+protected:
+    std::array<uint8_t, 1024> m_datagram;
+};
+
+TEST_F(FrameChecksumTest, shouldComputeCrc32c)
+{
+    const char *check = "123456789";
+
+    EXPECT_EQ(aeron_crc32c(0, (const uint8_t *)check, strlen(check)), 0xE3069283u);
+    EXPECT_EQ(aeron_crc32c(aeron_crc32c(0, (const uint8_t *)check, 4), (const uint8_t *)check + 4, 5), 0xE3069283u);
+    EXPECT_EQ(aeron_crc32c(0, (const uint8_t *)check, 0), 0u);
+}
+
+TEST_F(FrameChecksumTest, shouldVerifyEachFrameOfBatchStamped)
+{
+    size_t length = addFrame(0, 100, AERON_HDR_TYPE_DATA, 'a');
+    length += addFrame(length, 64, AERON_HDR_TYPE_DATA, 'b');
+
+    aeron_frame_checksum_stamp(m_datagram.data(), length);
+
+    EXPECT_NE(((aeron_data_header_t *)m_datagram.data())->reserved_value, 0);
+    EXPECT_TRUE(aeron_frame_checksum_verify(m_datagram.data(), length));
+}
+
+TEST_F(FrameChecksumTest, shouldFailVerifyOfCorruptedPayload)
+{
+    size_t length = addFrame(0, 100, AERON_HDR_TYPE_DATA, 'a');
+    length += addFrame(length, 64, AERON_HDR_TYPE_DATA, 'b');
+
+    aeron_frame_checksum_stamp(m_datagram.data(), length);
+    m_datagram[length - 1] ^= 0x01u;
+
+    EXPECT_FALSE(aeron_frame_checksum_verify(m_datagram.data(), length));
+}
+
+TEST_F(FrameChecksumTest, shouldFailVerifyOfCorruptedHeader)
+{
+    const size_t length = addFrame(0, 100, AERON_HDR_TYPE_DATA, 'a');
+
+    aeron_frame_checksum_stamp(m_datagram.data(), length);
+    ((aeron_data_header_t *)m_datagram.data())->term_id++;
+
+    EXPECT_FALSE(aeron_frame_checksum_verify(m_datagram.data(), length));
+}
+
+TEST_F(FrameChecksumTest, shouldFailVerifyOfUnstampedFrame)
+{
+    const size_t length = addFrame(0, 100, AERON_HDR_TYPE_DATA, 'a');
+
+    EXPECT_FALSE(aeron_frame_checksum_verify(m_datagram.data(), length));
+}
+
+TEST_F(FrameChecksumTest, shouldFailVerifyOfFrameRunningPastDatagram)
+{
+    const size_t length = addFrame(0, 100, AERON_HDR_TYPE_DATA, 'a');
+
+    aeron_frame_checksum_stamp(m_datagram.data(), length);
+
+    EXPECT_FALSE(aeron_frame_checksum_verify(m_datagram.data(), length - AERON_LOGBUFFER_FRAME_ALIGNMENT));
+}
+
+TEST_F(FrameChecksumTest, shouldCoverOnlyHeaderOfPaddingAndHeartbeat)
+{
+    size_t length = addFrame(0, 64, AERON_HDR_TYPE_DATA, 'a');
+    addFrame(length, 512, AERON_HDR_TYPE_PAD, 0);
+    length += sizeof(aeron_data_header_t);
+
+    aeron_frame_checksum_stamp(m_datagram.data(), length);
+    EXPECT_TRUE(aeron_frame_checksum_verify(m_datagram.data(), length));
+
+    addFrame(0, 0, AERON_HDR_TYPE_DATA, 0);
+    aeron_frame_checksum_stamp(m_datagram.data(), sizeof(aeron_data_header_t));
+    EXPECT_TRUE(aeron_frame_checksum_verify(m_datagram.data(), sizeof(aeron_data_header_t)));
+}
@@ -16,6 +16,7 @@
 
 #include <array>
 #include <functional>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -386,6 +387,128 @@ TEST_F(LossDetectorTest, shouldStopNakOnReceivingData)
     EXPECT_FALSE(loss_found);
 }
 
+TEST_F(LossDetectorTest, shouldHoldImmediateNakForReorderWindow)
+{
+    int64_t rebuild_position = 0;
+    const int64_t hwm_position = rebuild_position + (ALIGNED_FRAME_LENGTH * 3);
+    bool loss_found;
+    int called = 0;
+
+    insert_frame(offset_of_message(0));
+    insert_frame(offset_of_message(2));
+
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, true, static_feedback_generator_20ms, LossDetectorTest::on_gap_detected, this), 0);
+    aeron_loss_detector_reorder_window(&m_detector, 10 * 1000 * 1000L);
+
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        called++;
+    };
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_EQ(called, 0);
+    EXPECT_TRUE(loss_found);
+
+    m_time = 5 * 1000 * 1000L;
+    insert_frame(offset_of_message(1));
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        hwm_position);
+    EXPECT_EQ(called, 0);
+    EXPECT_EQ(m_detector.reorder_window_ns, 10 * 1000 * 1000L);
+}
+
+TEST_F(LossDetectorTest, shouldNakOnceGapOutlivesLearnedReorderWindow)
+{
+    int64_t rebuild_position = 0;
+    int64_t hwm_position = rebuild_position + (ALIGNED_FRAME_LENGTH * 3);
+    bool loss_found;
+    int called = 0;
+
+    insert_frame(offset_of_message(0));
+    insert_frame(offset_of_message(2));
+
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, true, static_feedback_generator_20ms, LossDetectorTest::on_gap_detected, this), 0);
+    aeron_loss_detector_reorder_window(&m_detector, 40 * 1000 * 1000L);
+
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_offset, offset_of_message(3));
+        called++;
+    };
+
+    aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID);
+
+    m_time = 5 * 1000 * 1000L;
+    insert_frame(offset_of_message(1));
+    insert_frame(offset_of_message(4));
+    rebuild_position += (3 * ALIGNED_FRAME_LENGTH);
+    hwm_position += (2 * ALIGNED_FRAME_LENGTH);
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(3));
+    EXPECT_EQ(called, 0);
+    EXPECT_TRUE(loss_found);
+
+    const int64_t reorder_window_ns = (40 * 1000 * 1000L) - ((30 * 1000 * 1000L) >> 3);
+    EXPECT_EQ(m_detector.reorder_window_ns, reorder_window_ns);
+
+    m_time += reorder_window_ns - 1;
+    aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID);
+    EXPECT_EQ(called, 0);
+
+    m_time += 1;
+    aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID);
+    EXPECT_EQ(called, 1);
+}
+
+TEST_F(LossDetectorTest, shouldBackOffNakForGapCoveredByPeerNak)
+{
+    int64_t rebuild_position = 0;
+    const int64_t hwm_position = rebuild_position + (ALIGNED_FRAME_LENGTH * 3);
+    bool loss_found;
+    int called = 0;
+
+    insert_frame(offset_of_message(0));
+    insert_frame(offset_of_message(2));
+
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, false, static_feedback_generator_20ms, LossDetectorTest::on_gap_detected, this), 0);
+
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_offset, offset_of_message(1));
+        called++;
+    };
+
+    aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID);
+    EXPECT_TRUE(loss_found);
+
+    m_time = 10 * 1000 * 1000L;
+    aeron_loss_detector_on_peer_nak(&m_detector, TERM_ID, offset_of_message(2), ALIGNED_FRAME_LENGTH, m_time);
+    aeron_loss_detector_on_peer_nak(&m_detector, TERM_ID, 0, 3 * ALIGNED_FRAME_LENGTH, m_time);
+
+    m_time = 20 * 1000 * 1000L;
+    aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID);
+    EXPECT_EQ(called, 0);
+
+    m_time = 30 * 1000 * 1000L;
+    aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID);
+    EXPECT_EQ(called, 1);
+}
+
 TEST_F(LossDetectorTest, shouldHandleMoreThan2Gaps)
 {
     int64_t rebuild_position = 0;
@@ -401,20 +524,13 @@ TEST_F(LossDetectorTest, shouldHandleMoreThan2Gaps)
     ASSERT_EQ(aeron_loss_detector_init(
         &m_detector, false, static_feedback_generator_20ms, LossDetectorTest::on_gap_detected, this), 0);
 
+    std::vector<int32_t> offsets;
     m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
     {
         EXPECT_EQ(term_id, TERM_ID);
         EXPECT_EQ(length, ALIGNED_FRAME_LENGTH);
+        offsets.push_back(term_offset);
         called++;
-
-        if (1 == called)
-        {
-            EXPECT_EQ(term_offset, offset_of_message(1));
-        }
-        else if (2 == called)
-        {
-            EXPECT_EQ(term_offset, offset_of_message(3));
-        }
     };
 
     ASSERT_EQ(aeron_loss_detector_scan(
@@ -427,7 +543,8 @@ TEST_F(LossDetectorTest, shouldHandleMoreThan2Gaps)
     ASSERT_EQ(aeron_loss_detector_scan(
         &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
         offset_of_message(1));
-    EXPECT_EQ(called, 1);
+    EXPECT_EQ(called, 3);
+    EXPECT_EQ(offsets, std::vector<int32_t>({ offset_of_message(1), offset_of_message(3), offset_of_message(5) }));
     EXPECT_FALSE(loss_found);
 
     insert_frame(offset_of_message(1));
@@ -436,17 +553,92 @@ TEST_F(LossDetectorTest, shouldHandleMoreThan2Gaps)
     ASSERT_EQ(aeron_loss_detector_scan(
         &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
         offset_of_message(3));
-    EXPECT_EQ(called, 1);
-    EXPECT_TRUE(loss_found);
+    EXPECT_EQ(called, 3);
+    EXPECT_FALSE(loss_found);
 
     m_time = 80 * 1000 * 1000L;
     ASSERT_EQ(aeron_loss_detector_scan(
         &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
         offset_of_message(3));
-    EXPECT_EQ(called, 2);
+    EXPECT_EQ(called, 5);
+    EXPECT_EQ(offsets[3], offset_of_message(3));
+    EXPECT_EQ(offsets[4], offset_of_message(5));
     EXPECT_FALSE(loss_found);
 }
 
+TEST_F(LossDetectorTest, shouldTrackNewGapBeyondActiveGaps)
+{
+    int64_t hwm_position = ALIGNED_FRAME_LENGTH * 3;
+    bool loss_found;
+    int called = 0;
+
+    insert_frame(offset_of_message(0));
+    insert_frame(offset_of_message(2));
+
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, false, static_feedback_generator_20ms, LossDetectorTest::on_gap_detected, this), 0);
+
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_offset, offset_of_message(1 == called ? 3 : 1));
+        called++;
+    };
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, 0, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_TRUE(loss_found);
+
+    insert_frame(offset_of_message(4));
+    hwm_position = ALIGNED_FRAME_LENGTH * 5;
+    m_time = 10 * 1000 * 1000L;
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, 0, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_TRUE(loss_found);
+    EXPECT_EQ(called, 0);
+
+    m_time = 20 * 1000 * 1000L;
+    aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, 0, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID);
+    EXPECT_EQ(called, 1);
+
+    m_time = 30 * 1000 * 1000L;
+    aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, 0, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID);
+    EXPECT_EQ(called, 2);
+}
+
+TEST_F(LossDetectorTest, shouldBoundNumberOfActiveGaps)
+{
+    const int num_frames = (AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS + 4) * 2;
+    const int64_t hwm_position = ALIGNED_FRAME_LENGTH * (num_frames + 1);
+    bool loss_found;
+    int called = 0;
+
+    for (int i = 0; i <= num_frames; i += 2)
+    {
+        insert_frame(offset_of_message(i));
+    }
+
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, true, static_feedback_generator_20ms, LossDetectorTest::on_gap_detected, this), 0);
+
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_offset, offset_of_message((called * 2) + 1));
+        called++;
+    };
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, 0, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_TRUE(loss_found);
+    EXPECT_EQ(called, AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS);
+    EXPECT_EQ(m_detector.active_gaps_length, (size_t)AERON_LOSS_DETECTOR_MAX_ACTIVE_GAPS);
+}
+
 TEST_F(LossDetectorTest, shouldReplaceOldNakWithNewNak)
 {
     int64_t rebuild_position = 0;
@@ -0,0 +1,303 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <functional>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "aeron_driver.h"
+#include "media/aeron_udp_channel_transport_debug.h"
+#include "client/aeronc.h"
+#include "util/aeron_error.h"
+}
+
+#define CHANNEL "aeron:udp?endpoint=localhost:40125"
+#define STREAM_ID (1002)
+#define MESSAGES_PER_ROUND (1000)
+#define STALL_TIMEOUT_NS (10LL * 1000 * 1000 * 1000)
+
+/*
+ * An embedded driver and the C client duty cycled in one thread over localhost, with the debug transport bindings
+ * dropping data frames on receive at a fixed rate and seed. Loss is per datagram, so small messages batched into one
+ * datagram are lost together. Every lost datagram has to be detected as a gap, or after a heartbeat when it was the
+ * last one sent, NAKed after the loss detector delay and retransmitted, so the latency tail and the collapse of the
+ * throughput with the loss rate show the cost of those delays directly.
+ */
+class LossRecoveryHarness
+{
+public:
+    LossRecoveryHarness(double loss_rate, size_t message_length) : m_message(message_length, 0)
+    {
+        char dir_template[] = "/tmp/aeron-loss-recovery-benchmark-XXXXXX";
+        char rate[32];
+
+        if (NULL == mkdtemp(dir_template))
+        {
+            throw std::runtime_error("could not create temp dir");
+        }
+
+        m_base_dir = dir_template;
+        m_dir = m_base_dir + "/aeron";
+        std::snprintf(rate, sizeof(rate), "%f", loss_rate);
+
+        setenv(AERON_DIR_ENV_VAR, m_dir.c_str(), 1);
+        setenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DATA_LOSS_RATE_ENV_VAR, rate, 1);
+        setenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_SEED_ENV_VAR, "1", 1);
+
+        if (aeron_driver_context_init(&m_driver_context) < 0)
+        {
+            throw std::runtime_error("could not init driver context: " + std::string(aeron_errmsg()));
+        }
+
+        m_driver_context->udp_channel_transport_bindings = &aeron_udp_channel_transport_bindings_debug;
+        m_driver_context->term_buffer_sparse_file = true;
+
+        if (aeron_driver_init(&m_driver, m_driver_context) < 0 || aeron_driver_invoker_start(m_driver) < 0)
+        {
+            throw std::runtime_error("could not start driver: " + std::string(aeron_errmsg()));
+        }
+
+        if (aeron_context_init(&m_context) < 0 || aeron_init(&m_aeron, m_context) < 0)
+        {
+            throw std::runtime_error("could not connect client: " + std::string(aeron_errmsg()));
+        }
+
+        connect();
+    }
+
+    ~LossRecoveryHarness()
+    {
+        aeron_close(m_aeron);
+        aeron_context_close(m_context);
+        aeron_driver_close(m_driver);
+        aeron_driver_context_close(m_driver_context);
+        aeron_dir_delete(m_dir.c_str());
+        rmdir(m_base_dir.c_str());
+        unsetenv(AERON_DIR_ENV_VAR);
+        unsetenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DATA_LOSS_RATE_ENV_VAR);
+        unsetenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_SEED_ENV_VAR);
+    }
+
+    /* nanoseconds from the first offer of a round until its last message has been received */
+    int64_t round()
+    {
+        const int64_t start_ns = nowNs();
+        const int64_t target = m_sent + MESSAGES_PER_ROUND;
+
+        while (m_sent < target)
+        {
+            const int64_t send_ns = nowNs();
+
+            std::memcpy(m_message.data(), &send_ns, sizeof(send_ns));
+            if (aeron_publication_offer(m_publication, m_message.data(), m_message.size()) > 0)
+            {
+                m_sent++;
+            }
+            else
+            {
+                doWork();
+            }
+        }
+
+        int64_t progress_ns = nowNs();
+        int64_t received = m_received;
+
+        while (m_received < m_sent)
+        {
+            doWork();
+
+            if (m_received != received)
+            {
+                received = m_received;
+                progress_ns = nowNs();
+            }
+            else if (nowNs() - progress_ns > STALL_TIMEOUT_NS)
+            {
+                throw std::runtime_error("stream did not recover from loss");
+            }
+        }
+
+        return nowNs() - start_ns;
+    }
+
+    std::string summary()
+    {
+        std::vector<int64_t> &latencies = m_latencies_ns;
+        char label[256];
+
+        if (latencies.empty())
+        {
+            return "";
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        std::snprintf(
+            label, sizeof(label), "p50=%.1fus p99=%.1fus max=%.1fus naks=%lld retransmits=%lld",
+            percentile(0.5) / 1000.0,
+            percentile(0.99) / 1000.0,
+            latencies.back() / 1000.0,
+            (long long)counter(AERON_SYSTEM_COUNTER_NAK_MESSAGES_SENT),
+            (long long)counter(AERON_SYSTEM_COUNTER_RETRANSMITS_SENT));
+
+        return label;
+    }
+
+private:
+    static void onFragment(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        LossRecoveryHarness *harness = static_cast<LossRecoveryHarness *>(clientd);
+        int64_t send_ns;
+
+        std::memcpy(&send_ns, buffer, sizeof(send_ns));
+        harness->m_latencies_ns.push_back(harness->nowNs() - send_ns);
+        harness->m_received++;
+    }
+
+    void doWork()
+    {
+        aeron_driver_invoker_do_work(m_driver);
+        aeron_main_do_work(m_aeron);
+        aeron_subscription_poll(m_subscription, LossRecoveryHarness::onFragment, this, 10);
+    }
+
+    bool doWorkUntil(const std::function<bool()> &condition)
+    {
+        const int64_t deadline_ns = nowNs() + STALL_TIMEOUT_NS;
+
+        while (!condition())
+        {
+            if (nowNs() > deadline_ns)
+            {
+                return false;
+            }
+
+            aeron_driver_invoker_do_work(m_driver);
+            if (aeron_main_do_work(m_aeron) < 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void connect()
+    {
+        aeron_async_add_subscription_t *async_sub = NULL;
+        aeron_async_add_publication_t *async_pub = NULL;
+
+        if (aeron_async_add_subscription(&async_sub, m_aeron, CHANNEL, STREAM_ID, NULL, NULL, NULL, NULL) < 0 ||
+            !doWorkUntil([&]() { return 0 != aeron_async_add_subscription_poll(&m_subscription, async_sub); }) ||
+            NULL == m_subscription)
+        {
+            throw std::runtime_error("could not add subscription: " + std::string(aeron_errmsg()));
+        }
+
+        if (aeron_async_add_publication(&async_pub, m_aeron, CHANNEL, STREAM_ID) < 0 ||
+            !doWorkUntil([&]() { return 0 != aeron_async_add_publication_poll(&m_publication, async_pub); }) ||
+            NULL == m_publication)
+        {
+            throw std::runtime_error("could not add publication: " + std::string(aeron_errmsg()));
+        }
+
+        /* the setup frame is subject to loss as well */
+        if (!doWorkUntil([&]() { return aeron_publication_is_connected(m_publication); }))
+        {
+            throw std::runtime_error("publication did not connect");
+        }
+    }
+
+    double percentile(double fraction) const
+    {
+        const size_t index = (size_t)(fraction * (double)(m_latencies_ns.size() - 1));
+
+        return (double)m_latencies_ns[index];
+    }
+
+    int64_t counter(aeron_system_counter_enum_t type)
+    {
+        return aeron_counter_get_volatile(aeron_system_counter_addr(&m_driver->conductor.system_counters, type));
+    }
+
+    static int64_t nowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    std::string m_base_dir;
+    std::string m_dir;
+    aeron_driver_context_t *m_driver_context = NULL;
+    aeron_driver_t *m_driver = NULL;
+    aeron_context_t *m_context = NULL;
+    aeron_t *m_aeron = NULL;
+    aeron_publication_t *m_publication = NULL;
+    aeron_subscription_t *m_subscription = NULL;
+
+    std::vector<uint8_t> m_message;
+    std::vector<int64_t> m_latencies_ns;
+    int64_t m_sent = 0;
+    int64_t m_received = 0;
+};
+
+/*
+ * The first argument is the loss rate in hundredths of a percent, the second the message length. Each iteration is a
+ * round of messages sent and fully received, and the label carries the message latencies over the whole run along
+ * with the NAKs and retransmits it took.
+ */
+static void BM_LossRecovery(benchmark::State &state)
+{
+    std::unique_ptr<LossRecoveryHarness> harness;
+
+    try
+    {
+        harness.reset(new LossRecoveryHarness((double)state.range(0) / 10000.0, (size_t)state.range(1)));
+
+        while (state.KeepRunning())
+        {
+            state.SetIterationTime((double)harness->round() / 1e9);
+        }
+    }
+    catch (const std::exception &ex)
+    {
+        state.SkipWithError(ex.what());
+        return;
+    }
+
+    state.SetItemsProcessed(state.iterations() * MESSAGES_PER_ROUND);
+    state.SetBytesProcessed(state.iterations() * MESSAGES_PER_ROUND * state.range(1));
+    state.SetLabel(harness->summary());
+}
+
+BENCHMARK(BM_LossRecovery)
+    ->ArgPair(0, 64)->ArgPair(1, 64)->ArgPair(10, 64)->ArgPair(100, 64)->ArgPair(500, 64)
+    ->ArgPair(0, 1376)->ArgPair(1, 1376)->ArgPair(10, 1376)->ArgPair(100, 1376)->ArgPair(500, 1376)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
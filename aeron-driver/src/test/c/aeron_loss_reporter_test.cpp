@@ -16,6 +16,7 @@
 
 #include <array>
 #include <functional>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -24,7 +25,7 @@ extern "C"
 #include "reports/aeron_loss_reporter.h"
 }
 
-#define CAPACITY (1024)
+#define CAPACITY (16 * 1024)
 
 #define SESSION_ID (0x0EADBEEF)
 #define STREAM_ID (0x12A)
@@ -69,7 +70,35 @@ public:
     }
 
 protected:
+    static void on_rate_sample(
+        void *clientd,
+        int32_t session_id,
+        int32_t stream_id,
+        int64_t sample_interval_ms,
+        int64_t timestamp,
+        int64_t loss_observations,
+        int64_t bytes_lost,
+        int64_t naks_sent)
+    {
+        LossReporterTest *t = (LossReporterTest *)clientd;
+
+        t->m_rate_samples.push_back({ timestamp, loss_observations, bytes_lost, naks_sent });
+        EXPECT_EQ(session_id, SESSION_ID);
+        EXPECT_EQ(stream_id, STREAM_ID);
+        EXPECT_EQ(sample_interval_ms, AERON_LOSS_REPORTER_RATE_SAMPLE_INTERVAL_MS);
+    }
+
+    aeron_loss_reporter_entry_offset_t createEntry()
+    {
+        const char *channel = "aeron:udp://stuff";
+        const char *source = "127.0.0.1:8888";
+
+        return aeron_loss_reporter_create_entry(
+            &m_reporter, 32, 7, SESSION_ID, STREAM_ID, channel, strlen(channel), source, strlen(source));
+    }
+
     buffer_t m_buffer;
+    std::vector<aeron_loss_reporter_rate_sample_t> m_rate_samples;
     uint8_t *m_ptr;
     aeron_loss_reporter_t m_reporter;
     std::function<void(int64_t,int64_t,int64_t,int64_t,int32_t,int32_t,const char *,int32_t,const char *,int32_t)>
@@ -311,3 +340,59 @@ TEST_F(LossReporterTest, shouldReadTwoEntries)
     EXPECT_EQ(aeron_loss_reporter_read(m_ptr, CAPACITY, LossReporterTest::on_loss_entry, this), 2u);
     EXPECT_EQ(called, 2u);
 }
+
+TEST_F(LossReporterTest, shouldReadNoRateSamplesForNewEntry)
+{
+    ASSERT_EQ(aeron_loss_reporter_init(&m_reporter, m_ptr, CAPACITY), 0);
+    ASSERT_EQ(createEntry(), 0);
+
+    EXPECT_EQ(aeron_loss_reporter_read_rate_samples(m_ptr, CAPACITY, LossReporterTest::on_rate_sample, this), 0u);
+}
+
+TEST_F(LossReporterTest, shouldAccumulateRateSamplesPerInterval)
+{
+    ASSERT_EQ(aeron_loss_reporter_init(&m_reporter, m_ptr, CAPACITY), 0);
+    aeron_loss_reporter_entry_offset_t offset = createEntry();
+    ASSERT_EQ(offset, 0);
+
+    const int64_t interval = AERON_LOSS_REPORTER_RATE_SAMPLE_INTERVAL_MS;
+    const int64_t base_ms = 1000 * interval;
+
+    aeron_loss_reporter_record_rate_sample(&m_reporter, offset, 64, 1, base_ms + 1);
+    aeron_loss_reporter_record_rate_sample(&m_reporter, offset, 32, 0, base_ms + interval - 1);
+    aeron_loss_reporter_record_rate_sample(&m_reporter, offset, 128, 1, base_ms + interval);
+
+    EXPECT_EQ(aeron_loss_reporter_read_rate_samples(m_ptr, CAPACITY, LossReporterTest::on_rate_sample, this), 2u);
+    ASSERT_EQ(m_rate_samples.size(), 2u);
+
+    EXPECT_EQ(m_rate_samples[0].timestamp, base_ms);
+    EXPECT_EQ(m_rate_samples[0].loss_observations, 2);
+    EXPECT_EQ(m_rate_samples[0].bytes_lost, 96);
+    EXPECT_EQ(m_rate_samples[0].naks_sent, 1);
+
+    EXPECT_EQ(m_rate_samples[1].timestamp, base_ms + interval);
+    EXPECT_EQ(m_rate_samples[1].loss_observations, 1);
+    EXPECT_EQ(m_rate_samples[1].bytes_lost, 128);
+    EXPECT_EQ(m_rate_samples[1].naks_sent, 1);
+}
+
+TEST_F(LossReporterTest, shouldResetRateSampleSlotWhenRingWraps)
+{
+    ASSERT_EQ(aeron_loss_reporter_init(&m_reporter, m_ptr, CAPACITY), 0);
+    aeron_loss_reporter_entry_offset_t offset = createEntry();
+    ASSERT_EQ(offset, 0);
+
+    const int64_t interval = AERON_LOSS_REPORTER_RATE_SAMPLE_INTERVAL_MS;
+    const int64_t base_ms = 1024 * interval;
+    const int64_t wrapped_ms = base_ms + (AERON_LOSS_REPORTER_RATE_SAMPLE_CAPACITY * interval);
+
+    aeron_loss_reporter_record_rate_sample(&m_reporter, offset, 64, 1, base_ms);
+    aeron_loss_reporter_record_rate_sample(&m_reporter, offset, 16, 0, wrapped_ms);
+
+    EXPECT_EQ(aeron_loss_reporter_read_rate_samples(m_ptr, CAPACITY, LossReporterTest::on_rate_sample, this), 1u);
+    ASSERT_EQ(m_rate_samples.size(), 1u);
+    EXPECT_EQ(m_rate_samples[0].timestamp, wrapped_ms);
+    EXPECT_EQ(m_rate_samples[0].loss_observations, 1);
+    EXPECT_EQ(m_rate_samples[0].bytes_lost, 16);
+    EXPECT_EQ(m_rate_samples[0].naks_sent, 0);
+}
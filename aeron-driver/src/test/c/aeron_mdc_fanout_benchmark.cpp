@@ -0,0 +1,379 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ctime>
+#include <memory>
+#include <vector>
+#include <cstring>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "media/aeron_udp_destination_tracker.h"
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_error.h"
+}
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define MESSAGE_LENGTH (1408)
+#define MAX_VLEN (8)
+#define SOCKET_BUFFER_LENGTH (2 * 1024 * 1024)
+
+/*
+ * Fans data frames out from one sender socket to a growing number of multi-destination-cast receivers on loopback
+ * through aeron_udp_destination_tracker_sendmmsg and the real socket bindings, so the per destination cost of the
+ * system calls is included. Sender cost is thread CPU time, which counts the time spent in the kernel on the sender's
+ * behalf. Receiver latency uses the software receive timestamps of the last destination to get its copy.
+ */
+static int64_t fanout_nano_clock()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((int64_t)ts.tv_sec * 1000 * 1000 * 1000) + ts.tv_nsec;
+}
+
+static int64_t fanout_clock_ns(clockid_t clock_id)
+{
+    struct timespec ts;
+    clock_gettime(clock_id, &ts);
+
+    return ((int64_t)ts.tv_sec * 1000 * 1000 * 1000) + ts.tv_nsec;
+}
+
+static struct sockaddr_storage fanout_loopback_addr(uint16_t port)
+{
+    struct sockaddr_storage addr;
+    struct sockaddr_in *in4 = (struct sockaddr_in *)&addr;
+
+    memset(&addr, 0, sizeof(addr));
+    in4->sin_family = AF_INET;
+    in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    in4->sin_port = htons(port);
+
+    return addr;
+}
+
+class FanOutReceiver
+{
+public:
+    explicit FanOutReceiver(bool use_rx_timestamping)
+    {
+        struct sockaddr_storage bind_addr = fanout_loopback_addr(0);
+
+        if (aeron_udp_channel_transport_init(
+            &m_transport, &bind_addr, NULL, 0, 0, SOCKET_BUFFER_LENGTH, 0, false, 0, false, use_rx_timestamping, NULL) < 0)
+        {
+            throw std::runtime_error(aeron_errmsg());
+        }
+
+        socklen_t addr_len = sizeof(m_addr);
+        getsockname(m_transport.fd, (struct sockaddr *)&m_addr, &addr_len);
+
+        for (size_t i = 0; i < MAX_VLEN; i++)
+        {
+            m_iov[i].iov_base = m_buffers[i];
+            m_iov[i].iov_len = MESSAGE_LENGTH;
+            memset(&m_msgs[i], 0, sizeof(m_msgs[i]));
+            m_msgs[i].msg_hdr.msg_name = &m_src_addrs[i];
+            m_msgs[i].msg_hdr.msg_iov = &m_iov[i];
+            m_msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    ~FanOutReceiver()
+    {
+        aeron_udp_channel_transport_close(&m_transport);
+    }
+
+    /* Read the given number of messages, returning the latest receive timestamp seen. */
+    int64_t drain(size_t messages)
+    {
+        m_latest_timestamp_ns = 0;
+
+        while (messages > 0)
+        {
+            const size_t vlen = messages < MAX_VLEN ? messages : MAX_VLEN;
+
+            for (size_t i = 0; i < vlen; i++)
+            {
+                m_msgs[i].msg_hdr.msg_namelen = sizeof(m_src_addrs[i]);
+                m_msgs[i].msg_hdr.msg_control = m_control[i].buffer;
+                m_msgs[i].msg_hdr.msg_controllen = sizeof(m_control[i].buffer);
+            }
+
+            const int result = aeron_udp_channel_transport_recvmmsg(
+                &m_transport, m_msgs, vlen, FanOutReceiver::on_message, this);
+            if (result < 0)
+            {
+                throw std::runtime_error(aeron_errmsg());
+            }
+
+            messages -= result;
+        }
+
+        return m_latest_timestamp_ns;
+    }
+
+    struct sockaddr_storage *addr()
+    {
+        return &m_addr;
+    }
+
+private:
+    static void on_message(void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    {
+        FanOutReceiver *receiver = (FanOutReceiver *)clientd;
+        const int64_t timestamp_ns = receiver->m_transport.recv_timestamp_ns;
+
+        receiver->m_latest_timestamp_ns =
+            timestamp_ns > receiver->m_latest_timestamp_ns ? timestamp_ns : receiver->m_latest_timestamp_ns;
+    }
+
+    aeron_udp_channel_transport_t m_transport;
+    struct sockaddr_storage m_addr;
+    struct sockaddr_storage m_src_addrs[MAX_VLEN];
+    struct mmsghdr m_msgs[MAX_VLEN];
+    struct iovec m_iov[MAX_VLEN];
+    aeron_udp_channel_transport_control_t m_control[MAX_VLEN];
+    uint8_t m_buffers[MAX_VLEN][MESSAGE_LENGTH];
+    int64_t m_latest_timestamp_ns = 0;
+};
+
+class FanOut
+{
+public:
+    FanOut(size_t destinations, bool use_rx_timestamping, int64_t destination_timeout_ns)
+    {
+        struct sockaddr_storage bind_addr = fanout_loopback_addr(0);
+
+        if (aeron_udp_channel_transport_init(
+            &m_transport, &bind_addr, NULL, 0, 0, 0, SOCKET_BUFFER_LENGTH, false, 0, false, false, NULL) < 0)
+        {
+            throw std::runtime_error(aeron_errmsg());
+        }
+
+        m_transport.bindings = &aeron_udp_channel_transport_bindings_default;
+        aeron_udp_destination_tracker_init(&m_tracker, fanout_nano_clock, destination_timeout_ns);
+
+        for (size_t i = 0; i < destinations; i++)
+        {
+            m_receivers.emplace_back(new FanOutReceiver(use_rx_timestamping));
+        }
+
+        memset(m_frame, 0, sizeof(m_frame));
+        aeron_data_header_t *data_header = (aeron_data_header_t *)m_frame;
+        data_header->frame_header.frame_length = MESSAGE_LENGTH;
+        data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+
+        memset(m_status_message, 0, sizeof(m_status_message));
+        aeron_status_message_header_t *status_message = (aeron_status_message_header_t *)m_status_message;
+        status_message->frame_header.frame_length = sizeof(aeron_status_message_header_t);
+        status_message->frame_header.type = AERON_HDR_TYPE_SM;
+
+        for (size_t i = 0; i < MAX_VLEN; i++)
+        {
+            m_iov[i].iov_base = m_frame;
+            m_iov[i].iov_len = MESSAGE_LENGTH;
+            memset(&m_msgs[i], 0, sizeof(m_msgs[i]));
+            m_msgs[i].msg_hdr.msg_iov = &m_iov[i];
+            m_msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    ~FanOut()
+    {
+        aeron_udp_destination_tracker_close(&m_tracker);
+        aeron_udp_channel_transport_close(&m_transport);
+    }
+
+    /* Manual control mode, as with destinations added through the add destination command. */
+    void add_destinations()
+    {
+        for (size_t i = 0; i < m_receivers.size(); i++)
+        {
+            if (aeron_udp_destination_tracker_add_destination(
+                &m_tracker, (int64_t)i, fanout_nano_clock(), m_receivers[i]->addr()) < 0)
+            {
+                throw std::runtime_error(aeron_errmsg());
+            }
+        }
+    }
+
+    /* Dynamic control mode: each receiver is added or refreshed by a status message carrying its receiver id. */
+    void on_status_messages()
+    {
+        aeron_status_message_header_t *status_message = (aeron_status_message_header_t *)m_status_message;
+
+        for (size_t i = 0; i < m_receivers.size(); i++)
+        {
+            status_message->receiver_id = (int64_t)i;
+
+            if (aeron_udp_destination_tracker_on_status_message(
+                &m_tracker, m_status_message, sizeof(m_status_message), m_receivers[i]->addr()) < 0)
+            {
+                throw std::runtime_error(aeron_errmsg());
+            }
+        }
+    }
+
+    int send(size_t vlen)
+    {
+        return aeron_udp_destination_tracker_sendmmsg(&m_tracker, &m_transport, m_msgs, vlen);
+    }
+
+    int64_t drain(size_t vlen)
+    {
+        int64_t latest_timestamp_ns = 0;
+
+        for (auto &receiver : m_receivers)
+        {
+            const int64_t timestamp_ns = receiver->drain(vlen);
+            latest_timestamp_ns = timestamp_ns > latest_timestamp_ns ? timestamp_ns : latest_timestamp_ns;
+        }
+
+        return latest_timestamp_ns;
+    }
+
+    size_t destinations() const
+    {
+        return m_receivers.size();
+    }
+
+private:
+    aeron_udp_channel_transport_t m_transport;
+    aeron_udp_destination_tracker_t m_tracker;
+    std::vector<std::unique_ptr<FanOutReceiver>> m_receivers;
+    uint8_t m_frame[MESSAGE_LENGTH];
+    uint8_t m_status_message[sizeof(aeron_status_message_header_t)];
+    struct mmsghdr m_msgs[MAX_VLEN];
+    struct iovec m_iov[MAX_VLEN];
+};
+
+/* Sender thread CPU per message handed to the tracker, whatever the number of destinations it goes out to. */
+static void BM_MdcSenderCpu(benchmark::State &state)
+{
+    const size_t destinations = (size_t)state.range(0);
+    const size_t vlen = (size_t)state.range(1);
+    FanOut fan_out(destinations, false, AERON_UDP_DESTINATION_TRACKER_MANUAL_DESTINATION_TIMEOUT_NS);
+
+    fan_out.add_destinations();
+
+    while (state.KeepRunning())
+    {
+        const int64_t start_ns = fanout_clock_ns(CLOCK_THREAD_CPUTIME_ID);
+        const int result = fan_out.send(vlen);
+        const int64_t end_ns = fanout_clock_ns(CLOCK_THREAD_CPUTIME_ID);
+
+        if ((size_t)result != vlen)
+        {
+            state.SkipWithError("short send");
+            break;
+        }
+
+        state.SetIterationTime((double)(end_ns - start_ns) / vlen / 1e9);
+        fan_out.drain(vlen);
+    }
+
+    /* iteration time is per message, so the rates are per message too */
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * destinations * MESSAGE_LENGTH);
+}
+
+/* Time from handing one message to the tracker until the last destination's copy is received. */
+static void BM_MdcFanOutLatency(benchmark::State &state)
+{
+    FanOut fan_out((size_t)state.range(0), true, AERON_UDP_DESTINATION_TRACKER_MANUAL_DESTINATION_TIMEOUT_NS);
+
+    fan_out.add_destinations();
+
+    while (state.KeepRunning())
+    {
+        const int64_t start_ns = fanout_clock_ns(CLOCK_REALTIME);
+        fan_out.send(1);
+        const int64_t latest_timestamp_ns = fan_out.drain(1);
+
+        if (0 == latest_timestamp_ns)
+        {
+            state.SkipWithError("no receive timestamps, SO_TIMESTAMPING not supported");
+            break;
+        }
+
+        state.SetIterationTime((double)(latest_timestamp_ns - start_ns) / 1e9);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/* Dynamic control: one round of status messages from every receiver, then a send to the destinations they keep. */
+static void BM_MdcDynamicControl(benchmark::State &state)
+{
+    FanOut fan_out((size_t)state.range(0), false, AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS);
+
+    fan_out.on_status_messages();
+
+    while (state.KeepRunning())
+    {
+        const int64_t start_ns = fanout_clock_ns(CLOCK_THREAD_CPUTIME_ID);
+        fan_out.on_status_messages();
+        fan_out.send(1);
+        const int64_t end_ns = fanout_clock_ns(CLOCK_THREAD_CPUTIME_ID);
+
+        state.SetIterationTime((double)(end_ns - start_ns) / 1e9);
+        fan_out.drain(1);
+    }
+
+    state.SetItemsProcessed(state.iterations() * fan_out.destinations());
+}
+
+static void fanOutArguments(benchmark::internal::Benchmark *b)
+{
+    for (int destinations : { 1, 8, 32, 128 })
+    {
+        b->Arg(destinations);
+    }
+}
+
+static void senderCpuArguments(benchmark::internal::Benchmark *b)
+{
+    for (int destinations : { 1, 8, 32, 128 })
+    {
+        for (int vlen : { 1, MAX_VLEN })
+        {
+            b->Args({ destinations, vlen });
+        }
+    }
+}
+
+BENCHMARK(BM_MdcSenderCpu)->Apply(senderCpuArguments)->UseManualTime();
+BENCHMARK(BM_MdcFanOutLatency)->Apply(fanOutArguments)->UseManualTime();
+BENCHMARK(BM_MdcDynamicControl)->Apply(fanOutArguments)->UseManualTime();
+
+BENCHMARK_MAIN();
@@ -155,6 +155,29 @@ TEST_F(MpscQueueTest, shouldDraingFullQueueWithLimit)
     EXPECT_EQ(aeron_mpsc_concurrent_array_queue_size(&m_q), CAPACITY - limit);
 }
 
+TEST_F(MpscQueueTest, shouldReleaseSlotsBeforeProcessingDrainedBatch)
+{
+    fillQueue();
+
+    int64_t counter = 1;
+    m_drain = [&](volatile void *e)
+    {
+        ASSERT_EQ(e, (void *)counter);
+        if (1 == counter)
+        {
+            EXPECT_EQ(aeron_mpsc_concurrent_array_queue_size(&m_q), 0u);
+            EXPECT_EQ(aeron_mpsc_concurrent_array_queue_offer(&m_q, (void *)(CAPACITY + 1)), AERON_OFFER_SUCCESS);
+        }
+        counter++;
+    };
+
+    EXPECT_EQ(aeron_mpsc_concurrent_array_queue_drain(&m_q, MpscQueueTest::drain_func, this, CAPACITY), CAPACITY);
+    EXPECT_EQ(aeron_mpsc_concurrent_array_queue_size(&m_q), 1u);
+
+    EXPECT_EQ(aeron_mpsc_concurrent_array_queue_drain_all(&m_q, MpscQueueTest::drain_func, this), 1u);
+    EXPECT_EQ(counter, (int64_t)CAPACITY + 2);
+}
+
 #define NUM_MESSAGES_PER_PUBLISHER (10 * 1000 * 1000)
 #define NUM_PUBLISHERS (2)
 
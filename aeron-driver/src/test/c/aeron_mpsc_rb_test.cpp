@@ -326,6 +326,85 @@ TEST_F(MpscRbTest, shouldLimitReadOfMessages)
     }
 }
 
+static void batch_count_handler(int32_t msg_type_id, const void *buffer, size_t length, void *clientd)
+{
+    size_t *count = (size_t *)clientd;
+
+    EXPECT_EQ(msg_type_id, MSG_TYPE_ID);
+    (*count)++;
+}
+
+TEST_F(MpscRbTest, shouldWriteBatchWithSingleClaimAndPadRemainder)
+{
+    aeron_mpsc_rb_t rb;
+    aeron_mpsc_rb_batch_t batch;
+    size_t length = 8;
+    size_t alignedRecordLength = aeron_mpsc_rb_batch_record_length(length);
+
+    ASSERT_EQ(aeron_mpsc_rb_init(&rb, m_buffer.data(), m_buffer.size()), 0);
+
+    ASSERT_EQ(aeron_mpsc_rb_try_claim_batch(&rb, &batch, alignedRecordLength * 3), AERON_RB_SUCCESS);
+    EXPECT_EQ(rb.descriptor->tail_position, (int64_t)(alignedRecordLength * 3));
+
+    ASSERT_EQ(aeron_mpsc_rb_batch_write(&batch, MSG_TYPE_ID, m_srcBuffer.data(), length), AERON_RB_SUCCESS);
+    ASSERT_EQ(aeron_mpsc_rb_batch_write(&batch, MSG_TYPE_ID, m_srcBuffer.data(), length), AERON_RB_SUCCESS);
+    aeron_mpsc_rb_batch_commit(&batch);
+
+    EXPECT_EQ(aeron_mpsc_rb_batch_write(&batch, MSG_TYPE_ID, m_srcBuffer.data(), length), AERON_RB_FULL);
+
+    aeron_rb_record_descriptor_t *padding =
+        (aeron_rb_record_descriptor_t *)(m_buffer.data() + (alignedRecordLength * 2));
+    EXPECT_EQ(padding->msg_type_id, AERON_RB_PADDING_MSG_TYPE_ID);
+    EXPECT_EQ(padding->length, (int32_t)alignedRecordLength);
+
+    size_t count = 0;
+    EXPECT_EQ(aeron_mpsc_rb_read(&rb, batch_count_handler, &count, 10), 2u);
+    EXPECT_EQ(count, 2u);
+    EXPECT_EQ(rb.descriptor->head_position, (int64_t)(alignedRecordLength * 3));
+}
+
+TEST_F(MpscRbTest, shouldRejectBatchClaimWhenInsufficientSpace)
+{
+    aeron_mpsc_rb_t rb;
+    aeron_mpsc_rb_batch_t batch;
+    size_t tail = CAPACITY - 32;
+
+    ASSERT_EQ(aeron_mpsc_rb_init(&rb, m_buffer.data(), m_buffer.size()), 0);
+    rb.descriptor->head_position = 0;
+    rb.descriptor->tail_position = (int64_t)tail;
+
+    EXPECT_EQ(aeron_mpsc_rb_try_claim_batch(&rb, &batch, 64), AERON_RB_FULL);
+    EXPECT_EQ(aeron_mpsc_rb_try_claim_batch(&rb, &batch, rb.max_message_length + AERON_RB_ALIGNMENT), AERON_RB_ERROR);
+    EXPECT_EQ(rb.descriptor->tail_position, (int64_t)tail);
+}
+
+static void block_length_handler(const uint8_t *block, size_t length, void *clientd)
+{
+    size_t *block_length = (size_t *)clientd;
+
+    *block_length += length;
+}
+
+TEST_F(MpscRbTest, shouldReadContiguousBlockOfCommittedRecords)
+{
+    aeron_mpsc_rb_t rb;
+    size_t length = 8;
+    size_t alignedRecordLength = aeron_mpsc_rb_batch_record_length(length);
+
+    ASSERT_EQ(aeron_mpsc_rb_init(&rb, m_buffer.data(), m_buffer.size()), 0);
+    ASSERT_EQ(aeron_mpsc_rb_write(&rb, MSG_TYPE_ID, m_srcBuffer.data(), length), AERON_RB_SUCCESS);
+    ASSERT_EQ(aeron_mpsc_rb_write(&rb, MSG_TYPE_ID, m_srcBuffer.data(), length), AERON_RB_SUCCESS);
+
+    size_t block_length = 0;
+    EXPECT_EQ(aeron_mpsc_rb_read_block(&rb, block_length_handler, &block_length, alignedRecordLength), alignedRecordLength);
+    EXPECT_EQ(block_length, alignedRecordLength);
+
+    EXPECT_EQ(aeron_mpsc_rb_read_block(&rb, block_length_handler, &block_length, CAPACITY), alignedRecordLength);
+    EXPECT_EQ(block_length, alignedRecordLength * 2);
+    EXPECT_EQ(rb.descriptor->head_position, (int64_t)(alignedRecordLength * 2));
+    EXPECT_EQ(aeron_mpsc_rb_read_block(&rb, block_length_handler, &block_length, CAPACITY), 0u);
+}
+
 TEST_F(MpscRbTest, shouldNotUnblockWhenEmpty)
 {
     aeron_mpsc_rb_t rb;
@@ -0,0 +1,524 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <netinet/udp.h>
+
+extern "C"
+{
+#include "aeron_network_publication.h"
+#include "media/aeron_send_channel_endpoint.h"
+#include "media/aeron_udp_channel.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+}
+
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define INITIAL_TERM_ID (7)
+#define SESSION_ID (11)
+#define STREAM_ID (101)
+#define MTU_LENGTH (4096)
+#define FRAME_LENGTH (1024)
+#define FEC_GROUP_SIZE (4)
+#define COALESCE_WINDOW_NS (1000)
+#define RETRANSMIT_LINGER_NS (10)
+#define NAK_TIME_NS (2)
+
+typedef struct sent_datagram_stct
+{
+    int32_t term_id;
+    int32_t term_offset;
+    size_t length;
+    size_t segment_length;
+}
+sent_datagram_t;
+
+/*
+ * A publication wired by hand to an endpoint whose transport bindings capture what the sender hands them, so a send
+ * pass can be checked frame by frame without a conductor or sockets.
+ */
+class NetworkPublicationTest : public testing::Test
+{
+public:
+    NetworkPublicationTest()
+    {
+        memset(&m_publication, 0, sizeof(m_publication));
+        memset(&m_endpoint, 0, sizeof(m_endpoint));
+        memset(&m_channel, 0, sizeof(m_channel));
+
+        m_bindings = aeron_udp_channel_transport_bindings_default;
+        m_bindings.sendmmsg_func = capture_sendmmsg;
+        m_bindings.sendmsg_func = capture_sendmsg;
+
+        m_endpoint.conductor_fields.udp_channel = &m_channel;
+        m_endpoint.transport.bindings = &m_bindings;
+        m_endpoint.transport.bindings_clientd = this;
+        m_endpoint.transport.is_connected = true;
+
+        for (int i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+        {
+            m_terms[i].assign(TERM_LENGTH, 0);
+            m_publication.mapped_raw_log.term_buffers[i].addr = m_terms[i].data();
+            m_publication.mapped_raw_log.term_buffers[i].length = TERM_LENGTH;
+        }
+
+        m_fec_frame.assign(AERON_FEC_FRAME_MAX_LENGTH(MTU_LENGTH), 0);
+
+        m_publication.endpoint = &m_endpoint;
+        m_publication.session_id = SESSION_ID;
+        m_publication.stream_id = STREAM_ID;
+        m_publication.initial_term_id = INITIAL_TERM_ID;
+        m_publication.term_length_mask = TERM_LENGTH - 1;
+        m_publication.position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes(TERM_LENGTH);
+        m_publication.mtu_length = MTU_LENGTH;
+        m_publication.fec_frame = m_fec_frame.data();
+        m_publication.snd_pos_position.value_addr = &m_snd_pos;
+        m_publication.snd_lmt_position.value_addr = &m_snd_lmt;
+        m_publication.short_sends_counter = &m_short_sends;
+        m_publication.sender_flow_control_limits_counter = &m_flow_control_limits;
+        m_publication.fec_frames_sent_counter = &m_fec_frames_sent;
+        m_publication.sender_fields.datagram_length = 2 * FRAME_LENGTH;
+        m_publication.sender_fields.send_quota = INT32_MAX;
+        m_publication.sender_fields.coalesce_position = -1;
+        m_publication.heartbeats_sent_counter = &m_heartbeats_sent;
+        m_publication.retransmits_sent_counter = &m_retransmits_sent;
+        m_publication.nano_clock = nak_clock;
+
+        m_flow_control.on_idle = hold_snd_lmt;
+        m_flow_control.state = this;
+        m_publication.flow_control = &m_flow_control;
+
+        aeron_retransmit_handler_init(
+            &m_publication.sender_fields.retransmit_handler, &m_invalid_packets, RETRANSMIT_LINGER_NS);
+
+        if (aeron_fec_encoder_init(&m_publication.sender_fields.fec_encoder, FEC_GROUP_SIZE, MTU_LENGTH) < 0)
+        {
+            throw std::runtime_error("could not init FEC encoder");
+        }
+    }
+
+    ~NetworkPublicationTest() override
+    {
+        aeron_fec_encoder_close(&m_publication.sender_fields.fec_encoder);
+    }
+
+protected:
+    static int capture_sendmmsg(aeron_udp_channel_transport_t *transport, struct mmsghdr *msgvec, size_t vlen)
+    {
+        NetworkPublicationTest *test = (NetworkPublicationTest *)transport->bindings_clientd;
+
+        for (size_t i = 0; i < vlen; i++)
+        {
+            const struct iovec *iov = msgvec[i].msg_hdr.msg_iov;
+            const aeron_data_header_t *header = (const aeron_data_header_t *)iov->iov_base;
+            sent_datagram_t datagram = { header->term_id, header->term_offset, iov->iov_len, 0 };
+
+#if defined(UDP_SEGMENT)
+            if (NULL != msgvec[i].msg_hdr.msg_control)
+            {
+                struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msgvec[i].msg_hdr);
+                EXPECT_EQ(cmsg->cmsg_type, UDP_SEGMENT);
+                datagram.segment_length = *(uint16_t *)CMSG_DATA(cmsg);
+            }
+#endif
+
+            test->m_datagrams.push_back(datagram);
+            msgvec[i].msg_len = (unsigned int)iov->iov_len;
+        }
+
+        return (int)vlen;
+    }
+
+    static int capture_sendmsg(aeron_udp_channel_transport_t *transport, struct msghdr *message)
+    {
+        NetworkPublicationTest *test = (NetworkPublicationTest *)transport->bindings_clientd;
+        const struct iovec *iov = message->msg_iov;
+        const aeron_frame_header_t *frame_header = (const aeron_frame_header_t *)iov->iov_base;
+
+        if (AERON_HDR_TYPE_FEC == frame_header->type)
+        {
+            test->m_fec_headers.push_back(*(const aeron_fec_header_t *)iov->iov_base);
+        }
+        else
+        {
+            test->m_messages.push_back(*frame_header);
+        }
+
+        return (int)iov->iov_len;
+    }
+
+    static int64_t hold_snd_lmt(void *state, int64_t now_ns, int64_t snd_lmt, int64_t snd_pos, bool is_end_of_stream)
+    {
+        ((NetworkPublicationTest *)state)->m_idle_passes++;
+
+        return snd_lmt;
+    }
+
+    static int64_t nak_clock()
+    {
+        return NAK_TIME_NS;
+    }
+
+    int64_t position(int32_t term_count, int32_t term_offset)
+    {
+        return ((int64_t)term_count * TERM_LENGTH) + term_offset;
+    }
+
+    void appendFrames(int32_t term_count, int32_t term_offset, int count, int32_t frame_length = FRAME_LENGTH)
+    {
+        uint8_t *term_buffer = m_terms[term_count % AERON_LOGBUFFER_PARTITION_COUNT].data();
+
+        for (int i = 0; i < count; i++, term_offset += frame_length)
+        {
+            aeron_data_header_t *header = (aeron_data_header_t *)(term_buffer + term_offset);
+
+            header->frame_header.frame_length = frame_length;
+            header->frame_header.type = AERON_HDR_TYPE_DATA;
+            header->term_offset = term_offset;
+            header->session_id = SESSION_ID;
+            header->stream_id = STREAM_ID;
+            header->term_id = INITIAL_TERM_ID + term_count;
+        }
+    }
+
+    int sendData(int64_t now_ns)
+    {
+        return aeron_network_publication_send_data(
+            &m_publication, now_ns, m_snd_pos, (int32_t)m_snd_pos & m_publication.term_length_mask);
+    }
+
+    int send(int64_t now_ns)
+    {
+        return aeron_network_publication_send(&m_publication, now_ns);
+    }
+
+    std::vector<uint8_t> m_terms[AERON_LOGBUFFER_PARTITION_COUNT];
+    std::vector<uint8_t> m_fec_frame;
+    std::vector<sent_datagram_t> m_datagrams;
+    std::vector<aeron_fec_header_t> m_fec_headers;
+    std::vector<aeron_frame_header_t> m_messages;
+    aeron_flow_control_strategy_t m_flow_control = {};
+    aeron_network_publication_t m_publication;
+    aeron_send_channel_endpoint_t m_endpoint;
+    aeron_udp_channel_t m_channel;
+    aeron_udp_channel_transport_bindings_t m_bindings;
+    int64_t m_snd_pos = 0;
+    int64_t m_snd_lmt = 0;
+    int64_t m_short_sends = 0;
+    int64_t m_flow_control_limits = 0;
+    int64_t m_fec_frames_sent = 0;
+    int64_t m_heartbeats_sent = 0;
+    int64_t m_retransmits_sent = 0;
+    int64_t m_invalid_packets = 0;
+    int m_idle_passes = 0;
+};
+
+TEST_F(NetworkPublicationTest, shouldSendAcrossTermEndInOnePass)
+{
+    const int32_t term_offset = TERM_LENGTH - (2 * FRAME_LENGTH);
+
+    appendFrames(0, term_offset, 2);
+    appendFrames(1, 0, 2);
+    m_snd_pos = position(0, term_offset);
+    m_snd_lmt = m_snd_pos + (TERM_LENGTH / 2);
+
+    ASSERT_EQ(sendData(0), 4 * FRAME_LENGTH);
+
+    ASSERT_EQ(m_datagrams.size(), 2u);
+    EXPECT_EQ(m_datagrams[0].term_id, INITIAL_TERM_ID);
+    EXPECT_EQ(m_datagrams[0].term_offset, term_offset);
+    EXPECT_EQ(m_datagrams[0].length, (size_t)(2 * FRAME_LENGTH));
+    EXPECT_EQ(m_datagrams[1].term_id, INITIAL_TERM_ID + 1);
+    EXPECT_EQ(m_datagrams[1].term_offset, 0);
+    EXPECT_EQ(m_datagrams[1].length, (size_t)(2 * FRAME_LENGTH));
+
+    EXPECT_EQ(m_snd_pos, position(1, 2 * FRAME_LENGTH));
+    EXPECT_TRUE(m_fec_headers.empty());
+}
+
+TEST_F(NetworkPublicationTest, shouldFindNextPartitionCleanWhenSendingAcrossTermEnd)
+{
+    const int32_t frames_per_term = TERM_LENGTH / FRAME_LENGTH;
+    const int32_t last_term_count = AERON_LOGBUFFER_PARTITION_COUNT - 1;
+    const int64_t term_end_position = position(last_term_count + 1, 0);
+
+    /* every partition is full, so the next one holds the whole of the term a round of partitions back */
+    for (int32_t term_count = 0; term_count <= last_term_count; term_count++)
+    {
+        appendFrames(term_count, 0, frames_per_term);
+    }
+
+    m_publication.term_clean_chunk_length = FRAME_LENGTH;
+    while (aeron_network_publication_clean_buffer(&m_publication, term_end_position) > 0)
+    {
+    }
+
+    /* a publication limit at the term end is within the clean limit, so the writes up to it were allowed */
+    EXPECT_GE(
+        m_publication.conductor_fields.clean_position + ((AERON_LOGBUFFER_PARTITION_COUNT - 1) * TERM_LENGTH),
+        term_end_position);
+
+    m_snd_pos = term_end_position - FRAME_LENGTH;
+    m_snd_lmt = term_end_position + (TERM_LENGTH / 2);
+
+    ASSERT_EQ(sendData(0), FRAME_LENGTH);
+    ASSERT_EQ(m_datagrams.size(), 1u);
+    EXPECT_EQ(m_datagrams[0].term_id, INITIAL_TERM_ID + last_term_count);
+    EXPECT_EQ(m_snd_pos, term_end_position);
+
+    appendFrames(last_term_count + 1, 0, 1);
+
+    ASSERT_EQ(sendData(1), FRAME_LENGTH);
+    ASSERT_EQ(m_datagrams.size(), 2u);
+    EXPECT_EQ(m_datagrams[1].term_id, INITIAL_TERM_ID + last_term_count + 1);
+    EXPECT_EQ(m_datagrams[1].term_offset, 0);
+}
+
+TEST_F(NetworkPublicationTest, shouldAddDatagramsToFecGroupsOfTheirOwnTermAcrossTermEnd)
+{
+    const int32_t term_offset = TERM_LENGTH - (2 * FRAME_LENGTH);
+    aeron_fec_encoder_t *encoder = &m_publication.sender_fields.fec_encoder;
+
+    m_publication.fec_enabled = true;
+    appendFrames(0, term_offset, 2);
+    appendFrames(1, 0, 2);
+    m_snd_pos = position(0, term_offset);
+    m_snd_lmt = m_snd_pos + (TERM_LENGTH / 2);
+
+    ASSERT_EQ(sendData(0), 4 * FRAME_LENGTH);
+    ASSERT_EQ(m_datagrams.size(), 2u);
+    EXPECT_EQ(m_snd_pos, position(1, 2 * FRAME_LENGTH));
+
+    /* the datagram of the next term is not contiguous with the group of the first, so that group goes out alone */
+    ASSERT_EQ(m_fec_headers.size(), 1u);
+    EXPECT_EQ(m_fec_headers[0].term_id, INITIAL_TERM_ID);
+    EXPECT_EQ(m_fec_headers[0].term_offset, term_offset);
+    EXPECT_EQ(m_fec_headers[0].datagram_count, 1);
+    EXPECT_EQ(m_fec_frames_sent, 1);
+
+    EXPECT_EQ(encoder->datagram_count, 1u);
+    EXPECT_EQ(encoder->term_id, INITIAL_TERM_ID + 1);
+    EXPECT_EQ(encoder->term_offset, 0);
+    EXPECT_EQ(encoder->next_term_offset, 2 * FRAME_LENGTH);
+}
+
+#if defined(UDP_SEGMENT)
+TEST_F(NetworkPublicationTest, shouldSendAcrossTermEndInOnePassWithGso)
+{
+    const int32_t term_offset = TERM_LENGTH - (4 * FRAME_LENGTH);
+
+    m_publication.sender_fields.gso_enabled = true;
+    appendFrames(0, term_offset, 4);
+    appendFrames(1, 0, 4);
+    m_snd_pos = position(0, term_offset);
+    m_snd_lmt = m_snd_pos + (TERM_LENGTH / 2);
+
+    ASSERT_EQ(sendData(0), 8 * FRAME_LENGTH);
+
+    /* a batch never spans the end of a term, so each term has its own */
+    ASSERT_EQ(m_datagrams.size(), 2u);
+    EXPECT_EQ(m_datagrams[0].term_id, INITIAL_TERM_ID);
+    EXPECT_EQ(m_datagrams[0].term_offset, term_offset);
+    EXPECT_EQ(m_datagrams[0].length, (size_t)(4 * FRAME_LENGTH));
+    EXPECT_EQ(m_datagrams[0].segment_length, (size_t)(2 * FRAME_LENGTH));
+    EXPECT_EQ(m_datagrams[1].term_id, INITIAL_TERM_ID + 1);
+    EXPECT_EQ(m_datagrams[1].term_offset, 0);
+    EXPECT_EQ(m_datagrams[1].length, (size_t)(4 * FRAME_LENGTH));
+    EXPECT_EQ(m_datagrams[1].segment_length, (size_t)(2 * FRAME_LENGTH));
+
+    EXPECT_EQ(m_snd_pos, position(1, 4 * FRAME_LENGTH));
+    EXPECT_TRUE(m_publication.sender_fields.gso_enabled);
+}
+#endif
+
+TEST_F(NetworkPublicationTest, shouldHoldFramesThatFillLessThanBatchWhenCoalescing)
+{
+    m_endpoint.coalesce_window_ns = COALESCE_WINDOW_NS;
+    appendFrames(0, 0, 1);
+    m_snd_lmt = TERM_LENGTH / 2;
+
+    EXPECT_EQ(sendData(0), 0);
+    EXPECT_EQ(sendData(COALESCE_WINDOW_NS - 1), 0);
+
+    EXPECT_TRUE(m_datagrams.empty());
+    EXPECT_EQ(m_snd_pos, 0);
+    EXPECT_EQ(m_publication.sender_fields.coalesce_position, 0);
+    EXPECT_EQ(m_publication.sender_fields.coalesce_deadline_ns, COALESCE_WINDOW_NS);
+}
+
+TEST_F(NetworkPublicationTest, shouldReleaseHeldFramesAtCoalesceDeadline)
+{
+    m_endpoint.coalesce_window_ns = COALESCE_WINDOW_NS;
+    appendFrames(0, 0, 1);
+    m_snd_lmt = TERM_LENGTH / 2;
+
+    ASSERT_EQ(sendData(0), 0);
+    ASSERT_EQ(sendData(COALESCE_WINDOW_NS), FRAME_LENGTH);
+
+    ASSERT_EQ(m_datagrams.size(), 1u);
+    EXPECT_EQ(m_datagrams[0].length, (size_t)FRAME_LENGTH);
+    EXPECT_EQ(m_snd_pos, FRAME_LENGTH);
+}
+
+TEST_F(NetworkPublicationTest, shouldSendFramesThatFillBatchWhenCoalescing)
+{
+    m_endpoint.coalesce_window_ns = COALESCE_WINDOW_NS;
+    appendFrames(0, 0, 2);
+    m_snd_lmt = TERM_LENGTH / 2;
+
+    ASSERT_EQ(sendData(0), 2 * FRAME_LENGTH);
+    ASSERT_EQ(m_datagrams.size(), 1u);
+    EXPECT_EQ(m_datagrams[0].length, (size_t)(2 * FRAME_LENGTH));
+}
+
+TEST_F(NetworkPublicationTest, shouldNotHoldWhenLaterFrameDoesNotFitBatch)
+{
+    m_endpoint.coalesce_window_ns = COALESCE_WINDOW_NS;
+    appendFrames(0, 0, 1);
+    appendFrames(0, FRAME_LENGTH, 1, 2 * FRAME_LENGTH);
+    m_snd_lmt = TERM_LENGTH / 2;
+
+    ASSERT_EQ(sendData(0), 3 * FRAME_LENGTH);
+
+    ASSERT_EQ(m_datagrams.size(), 2u);
+    EXPECT_EQ(m_datagrams[0].term_offset, 0);
+    EXPECT_EQ(m_datagrams[0].length, (size_t)FRAME_LENGTH);
+    EXPECT_EQ(m_datagrams[1].term_offset, FRAME_LENGTH);
+    EXPECT_EQ(m_datagrams[1].length, (size_t)(2 * FRAME_LENGTH));
+}
+
+TEST_F(NetworkPublicationTest, shouldNotHoldFramesAtTermEndWhenCoalescing)
+{
+    const int32_t term_offset = TERM_LENGTH - FRAME_LENGTH;
+
+    m_endpoint.coalesce_window_ns = COALESCE_WINDOW_NS;
+    appendFrames(0, term_offset, 1);
+    m_snd_pos = position(0, term_offset);
+    m_snd_lmt = m_snd_pos + (TERM_LENGTH / 2);
+
+    ASSERT_EQ(sendData(0), FRAME_LENGTH);
+
+    ASSERT_EQ(m_datagrams.size(), 1u);
+    EXPECT_EQ(m_datagrams[0].term_offset, term_offset);
+    EXPECT_EQ(m_snd_pos, position(1, 0));
+}
+
+TEST_F(NetworkPublicationTest, shouldNotHoldWhenWindowIsShorterThanBatch)
+{
+    m_endpoint.coalesce_window_ns = COALESCE_WINDOW_NS;
+    appendFrames(0, 0, 1);
+    m_snd_lmt = FRAME_LENGTH;
+
+    ASSERT_EQ(sendData(0), FRAME_LENGTH);
+
+    ASSERT_EQ(m_datagrams.size(), 1u);
+    EXPECT_EQ(m_snd_pos, FRAME_LENGTH);
+}
+
+/*
+ * A pass that sends nothing hands the publication to flow control as idle, so m_idle_passes counts the passes that
+ * were not skipped by the idle check.
+ */
+TEST_F(NetworkPublicationTest, shouldSkipPassesWhileIdleUntilFrameAppended)
+{
+    m_snd_lmt = TERM_LENGTH / 2;
+
+    ASSERT_EQ(send(0), 0);
+    ASSERT_EQ(m_idle_passes, 1);
+    ASSERT_EQ(send(1), 0);
+    ASSERT_EQ(m_idle_passes, 1);
+
+    appendFrames(0, 0, 2);
+
+    ASSERT_EQ(send(2), 2 * FRAME_LENGTH);
+    ASSERT_EQ(m_datagrams.size(), 1u);
+    EXPECT_EQ(m_snd_pos, 2 * FRAME_LENGTH);
+}
+
+TEST_F(NetworkPublicationTest, shouldResumeFromIdleWhenSenderLimitAdvances)
+{
+    appendFrames(0, 0, 2);
+
+    ASSERT_EQ(send(0), 0);
+    ASSERT_EQ(send(1), 0);
+    ASSERT_EQ(m_idle_passes, 1);
+    ASSERT_TRUE(m_datagrams.empty());
+
+    m_snd_lmt = TERM_LENGTH / 2;
+
+    ASSERT_EQ(send(2), 2 * FRAME_LENGTH);
+    ASSERT_EQ(m_datagrams.size(), 1u);
+    EXPECT_EQ(m_snd_pos, 2 * FRAME_LENGTH);
+}
+
+TEST_F(NetworkPublicationTest, shouldResumeFromIdleWhenSetupRequested)
+{
+    m_publication.sender_fields.time_of_last_setup_ns = -AERON_NETWORK_PUBLICATION_SETUP_TIMEOUT_NS;
+
+    ASSERT_EQ(send(0), 0);
+    ASSERT_EQ(send(1), 0);
+    ASSERT_EQ(m_idle_passes, 1);
+
+    m_publication.sender_fields.should_send_setup_frame = true;
+
+    ASSERT_EQ(send(2), 0);
+    ASSERT_EQ(m_messages.size(), 1u);
+    EXPECT_EQ(m_messages[0].type, AERON_HDR_TYPE_SETUP);
+    EXPECT_EQ(m_publication.sender_fields.time_of_last_setup_ns, 2);
+}
+
+TEST_F(NetworkPublicationTest, shouldResumeFromIdleToExpireRetransmitAction)
+{
+    aeron_retransmit_handler_t *handler = &m_publication.sender_fields.retransmit_handler;
+
+    appendFrames(0, 0, 2);
+    m_snd_lmt = TERM_LENGTH / 2;
+
+    ASSERT_EQ(send(0), 2 * FRAME_LENGTH);
+    ASSERT_EQ(send(1), 0);
+    ASSERT_EQ(m_idle_passes, 1);
+
+    aeron_network_publication_on_nak(&m_publication, INITIAL_TERM_ID, 0, FRAME_LENGTH);
+    ASSERT_EQ(m_datagrams.size(), 2u);
+    EXPECT_EQ(m_datagrams[1].term_offset, 0);
+    EXPECT_EQ(m_retransmits_sent, 1);
+    ASSERT_EQ(handler->active_actions_length, 1u);
+
+    ASSERT_EQ(send(NAK_TIME_NS + RETRANSMIT_LINGER_NS + 1), 0);
+    EXPECT_EQ(m_idle_passes, 2);
+    EXPECT_EQ(handler->active_actions_length, 0u);
+}
+
+TEST_F(NetworkPublicationTest, shouldResumeFromIdleWhenHeartbeatDue)
+{
+    const int64_t heartbeat_due_ns = AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS + 1;
+
+    ASSERT_EQ(send(heartbeat_due_ns - 2), 0);
+    ASSERT_EQ(send(heartbeat_due_ns - 1), 0);
+    ASSERT_EQ(m_idle_passes, 1);
+    ASSERT_TRUE(m_messages.empty());
+
+    ASSERT_EQ(send(heartbeat_due_ns), (int)sizeof(aeron_data_header_t));
+    ASSERT_EQ(m_messages.size(), 1u);
+    EXPECT_EQ(m_messages[0].type, AERON_HDR_TYPE_DATA);
+    EXPECT_EQ(m_messages[0].frame_length, 0);
+    EXPECT_EQ(m_heartbeats_sent, 1);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_pmtu_discovery.h"
+}
+
+#define MTU_LENGTH (1408)
+#define MAX_LENGTH (8960)
+
+class PmtuDiscoveryTest : public testing::Test
+{
+public:
+    PmtuDiscoveryTest()
+    {
+        aeron_pmtu_discovery_init(&m_discovery, MTU_LENGTH, MAX_LENGTH);
+    }
+
+protected:
+    /* runs the search against a path that delivers datagrams up to path_length */
+    size_t discover(size_t path_length)
+    {
+        int64_t now_ns = 0;
+
+        for (int i = 0; i < 100 && !aeron_pmtu_discovery_is_complete(&m_discovery); i++)
+        {
+            const size_t probe_length = aeron_pmtu_discovery_next_probe(&m_discovery, now_ns);
+
+            if (0 != probe_length && probe_length <= path_length)
+            {
+                aeron_pmtu_discovery_on_echo(&m_discovery, now_ns);
+            }
+
+            now_ns += AERON_PMTU_DISCOVERY_PROBE_TIMEOUT_NS;
+        }
+
+        return aeron_pmtu_discovery_confirmed_length(&m_discovery);
+    }
+
+    aeron_pmtu_discovery_t m_discovery;
+};
+
+TEST_F(PmtuDiscoveryTest, shouldProbeMaxLengthFirst)
+{
+    EXPECT_EQ(aeron_pmtu_discovery_next_probe(&m_discovery, 0), (size_t)MAX_LENGTH);
+    EXPECT_EQ(aeron_pmtu_discovery_next_probe(&m_discovery, 1), 0u);
+    EXPECT_TRUE(aeron_pmtu_discovery_on_echo(&m_discovery, 0));
+    EXPECT_TRUE(aeron_pmtu_discovery_is_complete(&m_discovery));
+    EXPECT_EQ(aeron_pmtu_discovery_confirmed_length(&m_discovery), (size_t)MAX_LENGTH);
+}
+
+TEST_F(PmtuDiscoveryTest, shouldIgnoreEchoOfEarlierAttempt)
+{
+    aeron_pmtu_discovery_next_probe(&m_discovery, 0);
+    aeron_pmtu_discovery_next_probe(&m_discovery, AERON_PMTU_DISCOVERY_PROBE_TIMEOUT_NS);
+
+    EXPECT_FALSE(aeron_pmtu_discovery_on_echo(&m_discovery, 0));
+    EXPECT_EQ(aeron_pmtu_discovery_confirmed_length(&m_discovery), (size_t)MTU_LENGTH);
+}
+
+TEST_F(PmtuDiscoveryTest, shouldBisectToPathLength)
+{
+    const size_t path_length = 4000;
+    const size_t confirmed_length = discover(path_length);
+
+    EXPECT_TRUE(aeron_pmtu_discovery_is_complete(&m_discovery));
+    EXPECT_LE(confirmed_length, path_length);
+    EXPECT_GT(confirmed_length + AERON_PMTU_DISCOVERY_RESOLUTION, path_length);
+    EXPECT_EQ(confirmed_length % 32, 0u);
+}
+
+TEST_F(PmtuDiscoveryTest, shouldKeepMtuLengthWhenNothingLargerIsDelivered)
+{
+    EXPECT_EQ(discover(1500), (size_t)MTU_LENGTH);
+    EXPECT_TRUE(aeron_pmtu_discovery_is_complete(&m_discovery));
+}
+
+TEST_F(PmtuDiscoveryTest, shouldBoundSearchOnSendFailure)
+{
+    EXPECT_EQ(aeron_pmtu_discovery_next_probe(&m_discovery, 0), (size_t)MAX_LENGTH);
+    aeron_pmtu_discovery_on_send_failure(&m_discovery);
+
+    const size_t probe_length = aeron_pmtu_discovery_next_probe(&m_discovery, 1);
+    EXPECT_LT(probe_length, (size_t)MAX_LENGTH);
+    EXPECT_GT(probe_length, (size_t)MTU_LENGTH);
+}
+
+TEST_F(PmtuDiscoveryTest, shouldBeCompleteWhenMaxLengthIsNotAboveMtu)
+{
+    aeron_pmtu_discovery_init(&m_discovery, MTU_LENGTH, MTU_LENGTH);
+
+    EXPECT_TRUE(aeron_pmtu_discovery_is_complete(&m_discovery));
+    EXPECT_EQ(aeron_pmtu_discovery_next_probe(&m_discovery, 0), 0u);
+}
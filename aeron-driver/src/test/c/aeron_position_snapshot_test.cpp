@@ -0,0 +1,174 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+
+#include <gtest/gtest.h>
+#include <concurrent/reports/PositionSnapshotReader.h>
+
+extern "C"
+{
+#include "reports/aeron_position_snapshot.h"
+}
+
+#define SENDER_COUNT (1)
+#define RECEIVER_COUNT (2)
+#define SECTION_CAPACITY (4)
+#define CAPACITY (4096)
+
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::reports;
+
+typedef std::array<std::uint8_t, CAPACITY> buffer_t;
+
+class PositionSnapshotTest : public testing::Test
+{
+public:
+    PositionSnapshotTest()
+    {
+        m_buffer.fill(0);
+    }
+
+protected:
+    void write(int32_t index, int32_t count, int64_t base, int64_t now_ns)
+    {
+        aeron_position_snapshot_writer_t writer;
+
+        aeron_position_snapshot_writer_init(&writer, m_buffer.data(), index);
+        aeron_position_snapshot_begin(&writer);
+        for (int32_t i = 0; i < count; i++)
+        {
+            aeron_position_snapshot_put(&writer, base + i, 100 + i, 200 + i, base * 10, base * 20, base * 30);
+        }
+        aeron_position_snapshot_end(&writer, now_ns);
+    }
+
+    AERON_DECL_ALIGNED(buffer_t m_buffer, 16);
+};
+
+TEST_F(PositionSnapshotTest, shouldFailInitWhenBufferTooShort)
+{
+    EXPECT_EQ(aeron_position_snapshot_init(
+        m_buffer.data(), aeron_position_snapshot_length(3, SECTION_CAPACITY) - 1, 1, 2, SECTION_CAPACITY), -1);
+}
+
+TEST_F(PositionSnapshotTest, shouldReadSectionsAsWritten)
+{
+    aeron_position_snapshot_entry_t entries[SECTION_CAPACITY];
+    int32_t kind = 0;
+    int64_t timestamp_ns = 0;
+
+    ASSERT_EQ(aeron_position_snapshot_init(
+        m_buffer.data(), m_buffer.size(), SENDER_COUNT, RECEIVER_COUNT, SECTION_CAPACITY), 0);
+
+    write(0, 2, 7, 1000);
+    write(2, 1, 9, 2000);
+
+    ASSERT_EQ(aeron_position_snapshot_read(
+        m_buffer.data(), m_buffer.size(), 0, entries, SECTION_CAPACITY, &kind, &timestamp_ns), 2);
+    EXPECT_EQ(kind, AERON_POSITION_SNAPSHOT_KIND_SENDER);
+    EXPECT_EQ(timestamp_ns, 1000);
+    EXPECT_EQ(entries[1].registration_id, 8);
+    EXPECT_EQ(entries[1].session_id, 101);
+    EXPECT_EQ(entries[1].stream_id, 201);
+    EXPECT_EQ(entries[1].position, 70);
+    EXPECT_EQ(entries[1].high_water_mark, 140);
+    EXPECT_EQ(entries[1].limit, 210);
+
+    ASSERT_EQ(aeron_position_snapshot_read(
+        m_buffer.data(), m_buffer.size(), 1, entries, SECTION_CAPACITY, &kind, &timestamp_ns), 0);
+    EXPECT_EQ(kind, AERON_POSITION_SNAPSHOT_KIND_RECEIVER);
+
+    ASSERT_EQ(aeron_position_snapshot_read(
+        m_buffer.data(), m_buffer.size(), 2, entries, SECTION_CAPACITY, &kind, &timestamp_ns), 1);
+    EXPECT_EQ(kind, AERON_POSITION_SNAPSHOT_KIND_RECEIVER);
+    EXPECT_EQ(entries[0].registration_id, 9);
+
+    EXPECT_EQ(aeron_position_snapshot_read(
+        m_buffer.data(), m_buffer.size(), 3, entries, SECTION_CAPACITY, &kind, &timestamp_ns), -1);
+}
+
+TEST_F(PositionSnapshotTest, shouldKeepOnlyCapacityEntries)
+{
+    aeron_position_snapshot_entry_t entries[SECTION_CAPACITY];
+    int32_t kind = 0;
+    int64_t timestamp_ns = 0;
+
+    ASSERT_EQ(aeron_position_snapshot_init(
+        m_buffer.data(), m_buffer.size(), SENDER_COUNT, RECEIVER_COUNT, SECTION_CAPACITY), 0);
+
+    write(0, SECTION_CAPACITY + 2, 1, 1000);
+
+    EXPECT_EQ(aeron_position_snapshot_read(
+        m_buffer.data(), m_buffer.size(), 0, entries, SECTION_CAPACITY, &kind, &timestamp_ns), SECTION_CAPACITY);
+    EXPECT_EQ(entries[SECTION_CAPACITY - 1].registration_id, SECTION_CAPACITY);
+}
+
+TEST_F(PositionSnapshotTest, shouldNotReadSectionWhileWritten)
+{
+    aeron_position_snapshot_entry_t entries[SECTION_CAPACITY];
+    aeron_position_snapshot_writer_t writer;
+    int32_t kind = 0;
+    int64_t timestamp_ns = 0;
+
+    ASSERT_EQ(aeron_position_snapshot_init(
+        m_buffer.data(), m_buffer.size(), SENDER_COUNT, RECEIVER_COUNT, SECTION_CAPACITY), 0);
+
+    aeron_position_snapshot_writer_init(&writer, m_buffer.data(), 0);
+    aeron_position_snapshot_begin(&writer);
+    aeron_position_snapshot_put(&writer, 1, 2, 3, 4, 5, 6);
+
+    EXPECT_EQ(aeron_position_snapshot_read(
+        m_buffer.data(), m_buffer.size(), 0, entries, SECTION_CAPACITY, &kind, &timestamp_ns), -1);
+
+    aeron_position_snapshot_end(&writer, 1000);
+
+    EXPECT_EQ(aeron_position_snapshot_read(
+        m_buffer.data(), m_buffer.size(), 0, entries, SECTION_CAPACITY, &kind, &timestamp_ns), 1);
+}
+
+TEST_F(PositionSnapshotTest, shouldReadSectionsWithClientReader)
+{
+    ASSERT_EQ(aeron_position_snapshot_init(
+        m_buffer.data(), m_buffer.size(), SENDER_COUNT, RECEIVER_COUNT, SECTION_CAPACITY), 0);
+
+    write(0, 2, 7, 1000);
+    write(1, 3, 11, 2000);
+
+    AtomicBuffer buffer(m_buffer.data(), static_cast<aeron::util::index_t>(m_buffer.size()));
+    PositionSnapshotReader::Section section;
+
+    ASSERT_EQ(PositionSnapshotReader::sectionCount(buffer), SENDER_COUNT + RECEIVER_COUNT);
+
+    ASSERT_TRUE(PositionSnapshotReader::read(buffer, 0, section));
+    EXPECT_EQ(section.kind, PositionSnapshotDescriptor::KIND_SENDER);
+    EXPECT_EQ(section.timestampNs, 1000);
+    ASSERT_EQ(section.entries.size(), 2u);
+    EXPECT_EQ(section.entries[1].registrationId, 8);
+    EXPECT_EQ(section.entries[1].sessionId, 101);
+    EXPECT_EQ(section.entries[1].streamId, 201);
+    EXPECT_EQ(section.entries[1].position, 70);
+    EXPECT_EQ(section.entries[1].highWaterMark, 140);
+    EXPECT_EQ(section.entries[1].limit, 210);
+
+    ASSERT_TRUE(PositionSnapshotReader::read(buffer, 1, section));
+    EXPECT_EQ(section.kind, PositionSnapshotDescriptor::KIND_RECEIVER);
+    ASSERT_EQ(section.entries.size(), 3u);
+    EXPECT_EQ(section.entries[2].registrationId, 13);
+    EXPECT_EQ(section.entries[2].streamId, 202);
+
+    EXPECT_FALSE(PositionSnapshotReader::read(buffer, 3, section));
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+#include <benchmark/benchmark.h>
+
+#include "aeron_benchmark_util.h"
+
+extern "C"
+{
+#include "util/aeron_bitutil.h"
+#include "aeron_network_publication.h"
+}
+
+static aeron_network_publication_t *publication = NULL;
+static int64_t snd_pos = 0;
+
+static aeron_network_publication_t *publication_allocate()
+{
+    const size_t length = AERON_ALIGN(sizeof(aeron_network_publication_t), AERON_CACHE_LINE_LENGTH);
+    auto *pub = (aeron_network_publication_t *)aligned_alloc(AERON_CACHE_LINE_LENGTH, length);
+
+    memset(pub, 0, length);
+    pub->position_bits_to_shift = 16;
+    pub->term_length_mask = (64 * 1024) - 1;
+    pub->mtu_length = 1408;
+    pub->initial_term_id = 7;
+    pub->snd_pos_position.value_addr = &snd_pos;
+
+    return pub;
+}
+
+/*
+ * The sender reading what it reads for each send while the conductor, on its own core, keeps writing either its own
+ * section or a field on the same cache line as those reads. The second stands in for the conductor written flags that
+ * sat among the data path fields before the structs were split by writer.
+ */
+static void BM_PublicationSenderReadsWithConductorWriting(benchmark::State &state)
+{
+    const bool is_shared_line = 0 != state.range(0);
+    publication = publication_allocate();
+
+    BenchmarkConsumer conductor(
+        [is_shared_line]()
+        {
+            if (is_shared_line)
+            {
+                AERON_PUT_ORDERED(publication->log_file_name_length, publication->log_file_name_length + 1);
+            }
+            else
+            {
+                AERON_PUT_ORDERED(
+                    publication->conductor_fields.time_of_last_activity_ns,
+                    publication->conductor_fields.time_of_last_activity_ns + 1);
+            }
+        });
+
+    conductor.start();
+    aeron_benchmark_pin_to_core(aeron_benchmark_producer_core(0));
+
+    int64_t now_ns = 0;
+
+    while (state.KeepRunning())
+    {
+        const int64_t position = *publication->snd_pos_position.value_addr;
+        const int32_t term_offset = (int32_t)position & publication->term_length_mask;
+        const int32_t term_id =
+            (int32_t)(position >> publication->position_bits_to_shift) + publication->initial_term_id;
+
+        publication->sender_fields.time_of_last_send_or_heartbeat_ns = ++now_ns;
+
+        benchmark::DoNotOptimize(term_offset + term_id + (int64_t)publication->mtu_length);
+        benchmark::ClobberMemory();
+    }
+
+    conductor.stop();
+    free(publication);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_PublicationSenderReadsWithConductorWriting)->Arg(0)->Arg(1)->UseRealTime();
+
+BENCHMARK_MAIN();
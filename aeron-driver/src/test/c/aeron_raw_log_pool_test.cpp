@@ -0,0 +1,231 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+extern "C"
+{
+#include "aeron_raw_log_pool.h"
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define POOL_SIZE (2)
+
+static int num_maps = 0;
+
+static int counting_map_raw_log(
+    aeron_mapped_raw_log_t *log, const char *path, bool use_sparse_files, uint64_t term_length, uint64_t page_size)
+{
+    num_maps++;
+    return aeron_map_raw_log(log, path, use_sparse_files, term_length, page_size);
+}
+
+class RawLogPoolTest : public testing::Test
+{
+public:
+    RawLogPoolTest()
+    {
+        char dir_template[] = "/tmp/aeron-raw-log-pool-test-XXXXXX";
+
+        if (NULL == mkdtemp(dir_template))
+        {
+            throw std::runtime_error("could not create temp dir");
+        }
+
+        m_dir = dir_template;
+        num_maps = 0;
+
+        memset(&m_context, 0, sizeof(m_context));
+        m_context.aeron_dir = (char *)m_dir.c_str();
+        m_context.term_buffer_length = TERM_LENGTH;
+        m_context.ipc_term_buffer_length = TERM_LENGTH;
+        m_context.term_buffer_sparse_file = true;
+        m_context.file_page_size = 4 * 1024;
+        m_context.raw_log_pool_size = POOL_SIZE;
+        m_context.map_raw_log_func = counting_map_raw_log;
+        m_context.map_raw_log_close_func = aeron_map_raw_log_close;
+    }
+
+    ~RawLogPoolTest()
+    {
+        rmdir(m_dir.c_str());
+    }
+
+protected:
+    static bool exists(const std::string& path)
+    {
+        struct stat sb;
+        return stat(path.c_str(), &sb) == 0;
+    }
+
+    std::string m_dir;
+    aeron_driver_context_t m_context;
+    aeron_raw_log_pool_t m_pool;
+};
+
+TEST_F(RawLogPoolTest, shouldFillPoolOncePerTermLengthAndClaimReadyLog)
+{
+    ASSERT_EQ(aeron_raw_log_pool_init(&m_pool, &m_context), 0);
+    EXPECT_EQ(m_pool.num_term_lengths, 1u);
+
+    while (aeron_raw_log_pool_do_work(&m_pool) > 0)
+    {
+    }
+
+    EXPECT_EQ(num_maps, POOL_SIZE);
+
+    const std::string path = m_dir + "/claimed.logbuffer";
+    aeron_mapped_raw_log_t log;
+
+    ASSERT_EQ(aeron_raw_log_pool_map_raw_log(
+        &m_pool, counting_map_raw_log, &log, path.c_str(), true, TERM_LENGTH, 4 * 1024, false, false), 0);
+    EXPECT_EQ(num_maps, POOL_SIZE);
+    EXPECT_TRUE(exists(path));
+    EXPECT_EQ(log.term_length, (size_t)TERM_LENGTH);
+
+    aeron_map_raw_log_close(&log);
+    unlink(path.c_str());
+
+    aeron_raw_log_pool_on_close(&m_pool);
+}
+
+TEST_F(RawLogPoolTest, shouldFallBackToMappingWhenShapeDoesNotMatch)
+{
+    ASSERT_EQ(aeron_raw_log_pool_init(&m_pool, &m_context), 0);
+    aeron_raw_log_pool_do_work(&m_pool);
+    num_maps = 0;
+
+    const std::string path = m_dir + "/other.logbuffer";
+    aeron_mapped_raw_log_t log;
+
+    ASSERT_EQ(aeron_raw_log_pool_map_raw_log(
+        &m_pool, counting_map_raw_log, &log, path.c_str(), true, TERM_LENGTH * 2, 4 * 1024, false, false), 0);
+    EXPECT_EQ(num_maps, 1);
+    EXPECT_EQ(log.term_length, (size_t)(TERM_LENGTH * 2));
+
+    aeron_map_raw_log_close(&log);
+    unlink(path.c_str());
+
+    aeron_raw_log_pool_on_close(&m_pool);
+}
+
+TEST_F(RawLogPoolTest, shouldMapDirectlyWithoutPool)
+{
+    const std::string path = m_dir + "/direct.logbuffer";
+    aeron_mapped_raw_log_t log;
+
+    ASSERT_EQ(aeron_raw_log_pool_map_raw_log(
+        NULL, counting_map_raw_log, &log, path.c_str(), true, TERM_LENGTH, 4 * 1024, false, false), 0);
+    EXPECT_EQ(num_maps, 1);
+
+    aeron_map_raw_log_close(&log);
+    unlink(path.c_str());
+}
+
+TEST_F(RawLogPoolTest, shouldPrefaultSparseLogWhenMapped)
+{
+    const std::string path = m_dir + "/prefault.logbuffer";
+    aeron_mapped_raw_log_t log;
+
+    ASSERT_EQ(aeron_raw_log_pool_map_raw_log(
+        NULL, counting_map_raw_log, &log, path.c_str(), true, TERM_LENGTH, 4 * 1024, true, false), 0);
+
+    const size_t num_pages = log.mapped_file.length / (4 * 1024);
+    std::vector<unsigned char> residency(num_pages);
+
+    ASSERT_EQ(mincore(log.mapped_file.addr, log.mapped_file.length, residency.data()), 0);
+    for (size_t i = 0; i < num_pages; i++)
+    {
+        EXPECT_NE(residency[i] & 1, 0) << "page " << i;
+    }
+
+    aeron_map_raw_log_close(&log);
+    unlink(path.c_str());
+}
+
+TEST_F(RawLogPoolTest, shouldReleaseCleanedPagesFromResidency)
+{
+    const std::string path = m_dir + "/release.logbuffer";
+    aeron_mapped_raw_log_t log;
+
+    ASSERT_EQ(aeron_raw_log_pool_map_raw_log(
+        NULL, counting_map_raw_log, &log, path.c_str(), true, TERM_LENGTH, 4 * 1024, true, false), 0);
+    EXPECT_EQ(aeron_mapped_buffer_resident_length(log.mapped_file.addr, log.mapped_file.length),
+        log.mapped_file.length);
+
+    EXPECT_EQ(aeron_mapped_buffer_clean(log.term_buffers[0].addr, TERM_LENGTH, 4 * 1024, true), (size_t)TERM_LENGTH);
+    EXPECT_EQ(aeron_mapped_buffer_resident_length(log.mapped_file.addr, log.mapped_file.length),
+        log.mapped_file.length - TERM_LENGTH);
+
+    aeron_map_raw_log_close(&log);
+    unlink(path.c_str());
+}
+
+TEST_F(RawLogPoolTest, shouldRemovePooledFilesOnClose)
+{
+    ASSERT_EQ(aeron_raw_log_pool_init(&m_pool, &m_context), 0);
+
+    while (aeron_raw_log_pool_do_work(&m_pool) > 0)
+    {
+    }
+
+    const std::string pool_dir = m_dir + "/" + AERON_RAW_LOG_POOL_DIR;
+    EXPECT_TRUE(exists(pool_dir));
+
+    aeron_raw_log_pool_on_close(&m_pool);
+    EXPECT_FALSE(exists(pool_dir));
+}
+
+TEST_F(RawLogPoolTest, shouldAdoptRecycledLogsOnWarmRestart)
+{
+    const std::string recycled_dir = m_dir + "/" + AERON_RAW_LOG_POOL_RECYCLED_DIR;
+    const std::string recycled = recycled_dir + "/0.logbuffer";
+    const std::string mismatched = recycled_dir + "/1.logbuffer";
+    aeron_mapped_raw_log_t log;
+
+    ASSERT_EQ(mkdir(recycled_dir.c_str(), S_IRWXU), 0);
+    ASSERT_EQ(aeron_map_raw_log(&log, recycled.c_str(), false, TERM_LENGTH, 4 * 1024), 0);
+    memset(log.term_buffers[0].addr, 0xFF, 64);
+    aeron_map_raw_log_close(&log);
+    ASSERT_EQ(aeron_map_raw_log(&log, mismatched.c_str(), false, TERM_LENGTH * 2, 4 * 1024), 0);
+    aeron_map_raw_log_close(&log);
+
+    m_context.dirs_warm_restart = true;
+    ASSERT_EQ(aeron_raw_log_pool_init(&m_pool, &m_context), 0);
+    EXPECT_FALSE(exists(mismatched));
+
+    const std::string path = m_dir + "/claimed.logbuffer";
+
+    ASSERT_EQ(aeron_raw_log_pool_map_raw_log(
+        &m_pool, counting_map_raw_log, &log, path.c_str(), true, TERM_LENGTH, 4 * 1024, false, false), 0);
+    EXPECT_EQ(num_maps, 0);
+    EXPECT_FALSE(exists(recycled));
+    EXPECT_EQ(log.term_buffers[0].addr[0], 0);
+
+    aeron_map_raw_log_close(&log);
+    unlink(path.c_str());
+
+    aeron_raw_log_pool_on_close(&m_pool);
+    EXPECT_FALSE(exists(recycled_dir));
+}
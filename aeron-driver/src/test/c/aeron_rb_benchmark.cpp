@@ -0,0 +1,131 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "aeron_benchmark_util.h"
+
+extern "C"
+{
+#include "concurrent/aeron_mpsc_rb.h"
+#include "concurrent/aeron_spsc_rb.h"
+}
+
+#define CAPACITY (1024 * 1024)
+#define BUFFER_LENGTH (CAPACITY + AERON_RB_TRAILER_LENGTH)
+#define MSG_TYPE_ID (101)
+
+static std::vector<uint8_t> rb_buffer(BUFFER_LENGTH, 0);
+static aeron_mpsc_rb_t mpsc_rb;
+static aeron_spsc_rb_t spsc_rb;
+
+static void null_handler(int32_t msg_type_id, const void *msg, size_t length, void *clientd)
+{
+}
+
+static void BM_MpscRbWriteRead(benchmark::State &state)
+{
+    std::vector<uint8_t> msg((size_t)state.range(0), 0x5A);
+
+    std::fill(rb_buffer.begin(), rb_buffer.end(), 0);
+    aeron_mpsc_rb_init(&mpsc_rb, rb_buffer.data(), BUFFER_LENGTH);
+
+    while (state.KeepRunning())
+    {
+        aeron_mpsc_rb_write(&mpsc_rb, MSG_TYPE_ID, msg.data(), msg.size());
+        benchmark::DoNotOptimize(aeron_mpsc_rb_read(&mpsc_rb, null_handler, NULL, 1));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/* each producer retries until its message is written, against a reader draining on its own core */
+static void BM_MpscRbWriteContended(benchmark::State &state)
+{
+    static BenchmarkConsumer consumer([]() { aeron_mpsc_rb_read(&mpsc_rb, null_handler, NULL, 64); });
+    std::vector<uint8_t> msg((size_t)state.range(0), 0x5A);
+
+    if (0 == state.thread_index)
+    {
+        std::fill(rb_buffer.begin(), rb_buffer.end(), 0);
+        aeron_mpsc_rb_init(&mpsc_rb, rb_buffer.data(), BUFFER_LENGTH);
+        consumer.start();
+    }
+
+    aeron_benchmark_pin_to_core(aeron_benchmark_producer_core(state.thread_index));
+
+    while (state.KeepRunning())
+    {
+        while (AERON_RB_SUCCESS != aeron_mpsc_rb_write(&mpsc_rb, MSG_TYPE_ID, msg.data(), msg.size()))
+        {
+            aeron_benchmark_backoff();
+        }
+    }
+
+    if (0 == state.thread_index)
+    {
+        consumer.stop();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_SpscRbWriteRead(benchmark::State &state)
+{
+    std::vector<uint8_t> msg((size_t)state.range(0), 0x5A);
+
+    std::fill(rb_buffer.begin(), rb_buffer.end(), 0);
+    aeron_spsc_rb_init(&spsc_rb, rb_buffer.data(), BUFFER_LENGTH);
+
+    while (state.KeepRunning())
+    {
+        aeron_spsc_rb_write(&spsc_rb, MSG_TYPE_ID, msg.data(), msg.size());
+        benchmark::DoNotOptimize(aeron_spsc_rb_read(&spsc_rb, null_handler, NULL, 1));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_SpscRbWriteWithReader(benchmark::State &state)
+{
+    BenchmarkConsumer consumer([]() { aeron_spsc_rb_read(&spsc_rb, null_handler, NULL, 64); });
+    std::vector<uint8_t> msg((size_t)state.range(0), 0x5A);
+
+    std::fill(rb_buffer.begin(), rb_buffer.end(), 0);
+    aeron_spsc_rb_init(&spsc_rb, rb_buffer.data(), BUFFER_LENGTH);
+    consumer.start();
+    aeron_benchmark_pin_to_core(aeron_benchmark_producer_core(0));
+
+    while (state.KeepRunning())
+    {
+        while (AERON_RB_SUCCESS != aeron_spsc_rb_write(&spsc_rb, MSG_TYPE_ID, msg.data(), msg.size()))
+        {
+            aeron_benchmark_backoff();
+        }
+    }
+
+    consumer.stop();
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_MpscRbWriteRead)->Arg(32)->Arg(256);
+BENCHMARK(BM_MpscRbWriteContended)->Arg(32)->Arg(256)->Threads(1)->Threads(2)->Threads(4)->UseRealTime();
+BENCHMARK(BM_SpscRbWriteRead)->Arg(32)->Arg(256);
+BENCHMARK(BM_SpscRbWriteWithReader)->Arg(32)->Arg(256)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -16,6 +16,8 @@
 
 #include <array>
 #include <functional>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -178,3 +180,101 @@ TEST_F(RetransmitHandlerTest, shouldRetransmitOnMultipleNaks)
         &m_handler, TERM_ID, nak_offset_2, nak_length_2, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 2u);
 }
+
+TEST_F(RetransmitHandlerTest, shouldOnlyRetransmitUncoveredPartOfOverlappingNak)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, LINGER_TIMEOUT_20MS), 0);
+
+    std::vector<std::pair<int32_t, size_t>> resends;
+    m_resend = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_id, TERM_ID);
+        resends.emplace_back(term_offset, length);
+        return 0;
+    };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, ALIGNED_FRAME_LENGTH * 2, ALIGNED_FRAME_LENGTH * 2, TERM_LENGTH, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, ALIGNED_FRAME_LENGTH * 3, ALIGNED_FRAME_LENGTH * 3, TERM_LENGTH, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, ALIGNED_FRAME_LENGTH * 2, ALIGNED_FRAME_LENGTH * 4, TERM_LENGTH, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+
+    ASSERT_EQ(resends.size(), 2u);
+    EXPECT_EQ(resends[0].first, (int32_t)(ALIGNED_FRAME_LENGTH * 2));
+    EXPECT_EQ(resends[0].second, (size_t)(ALIGNED_FRAME_LENGTH * 2));
+    EXPECT_EQ(resends[1].first, (int32_t)(ALIGNED_FRAME_LENGTH * 4));
+    EXPECT_EQ(resends[1].second, (size_t)(ALIGNED_FRAME_LENGTH * 2));
+    EXPECT_EQ(m_handler.active_actions_length, 1u);
+}
+
+TEST_F(RetransmitHandlerTest, shouldMergeAdjacentNaksIntoSingleAction)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, LINGER_TIMEOUT_20MS), 0);
+
+    size_t called = 0;
+    m_resend = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        called++;
+        return 0;
+    };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, 0, ALIGNED_FRAME_LENGTH, TERM_LENGTH, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, ALIGNED_FRAME_LENGTH, ALIGNED_FRAME_LENGTH, TERM_LENGTH, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 2u);
+    EXPECT_EQ(m_handler.active_actions_length, 1u);
+    EXPECT_EQ(m_handler.active_actions[0]->length, (size_t)(ALIGNED_FRAME_LENGTH * 2));
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID + 1, ALIGNED_FRAME_LENGTH, ALIGNED_FRAME_LENGTH, TERM_LENGTH, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 3u);
+    EXPECT_EQ(m_handler.active_actions_length, 2u);
+
+    m_time = 30 * 1000 * 1000L;
+    EXPECT_EQ(aeron_retransmit_handler_process_timeouts(&m_handler, m_time), 2);
+    EXPECT_EQ(m_handler.active_actions_length, 0u);
+}
+
+TEST_F(RetransmitHandlerTest, shouldBridgeGapBetweenLingeringActions)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, LINGER_TIMEOUT_20MS), 0);
+
+    std::vector<std::pair<int32_t, size_t>> resends;
+    m_resend = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        resends.emplace_back(term_offset, length);
+        return 0;
+    };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, ALIGNED_FRAME_LENGTH, ALIGNED_FRAME_LENGTH, TERM_LENGTH, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, ALIGNED_FRAME_LENGTH * 4, ALIGNED_FRAME_LENGTH, TERM_LENGTH, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(m_handler.active_actions_length, 2u);
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, 0, ALIGNED_FRAME_LENGTH * 6, TERM_LENGTH, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+
+    ASSERT_EQ(resends.size(), 5u);
+    EXPECT_EQ(resends[2].first, 0);
+    EXPECT_EQ(resends[2].second, (size_t)ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(resends[3].first, (int32_t)(ALIGNED_FRAME_LENGTH * 2));
+    EXPECT_EQ(resends[3].second, (size_t)(ALIGNED_FRAME_LENGTH * 2));
+    EXPECT_EQ(resends[4].first, (int32_t)(ALIGNED_FRAME_LENGTH * 5));
+    EXPECT_EQ(resends[4].second, (size_t)ALIGNED_FRAME_LENGTH);
+
+    ASSERT_EQ(m_handler.active_actions_length, 1u);
+    EXPECT_EQ(m_handler.active_actions[0]->term_offset, 0);
+    EXPECT_EQ(m_handler.active_actions[0]->length, (size_t)(ALIGNED_FRAME_LENGTH * 6));
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_send_pacer.h"
+}
+
+#define MAX_BURST_LENGTH (2 * 1408)
+#define STEP_NS (10 * 1000L)
+#define RTT_NS (100 * 1000L)
+#define BYTES_PER_STEP (10 * 1000)
+
+class SendPacerTest : public testing::Test
+{
+public:
+    SendPacerTest()
+    {
+        aeron_send_pacer_init(&m_pacer, MAX_BURST_LENGTH, 0);
+    }
+
+protected:
+    /* sends at one byte per ns and acknowledges what was sent one RTT earlier */
+    void runSteadyFlow(int steps)
+    {
+        for (int i = 0; i < steps; i++)
+        {
+            m_now_ns += STEP_NS;
+            m_position += BYTES_PER_STEP;
+            aeron_send_pacer_on_send(&m_pacer, m_now_ns, m_position, BYTES_PER_STEP, false);
+
+            const int64_t acked_position = m_position - (RTT_NS / STEP_NS) * BYTES_PER_STEP;
+            if (acked_position > 0)
+            {
+                aeron_send_pacer_on_status_message(&m_pacer, m_now_ns, acked_position);
+            }
+        }
+    }
+
+    aeron_send_pacer_t m_pacer;
+    int64_t m_now_ns = 0;
+    int64_t m_position = 0;
+};
+
+TEST_F(SendPacerTest, shouldNotPaceWithoutBandwidthEstimate)
+{
+    EXPECT_EQ(aeron_send_pacer_available(&m_pacer, 1000), INT32_MAX);
+    EXPECT_EQ(aeron_send_pacer_rate(&m_pacer), 0);
+}
+
+TEST_F(SendPacerTest, shouldEstimateBottleneckBandwidthAndMinRtt)
+{
+    runSteadyFlow(1000);
+
+    EXPECT_DOUBLE_EQ(m_pacer.btl_bw, 1.0);
+    EXPECT_EQ(m_pacer.min_rtt_ns, RTT_NS);
+    EXPECT_EQ(m_pacer.mode, AERON_SEND_PACER_MODE_PROBE_BW);
+}
+
+TEST_F(SendPacerTest, shouldLeaveStartupOnceBandwidthStopsGrowing)
+{
+    runSteadyFlow(20);
+    EXPECT_EQ(m_pacer.mode, AERON_SEND_PACER_MODE_STARTUP);
+    EXPECT_DOUBLE_EQ(m_pacer.pacing_gain, AERON_SEND_PACER_STARTUP_GAIN);
+
+    runSteadyFlow(100);
+    EXPECT_NE(m_pacer.mode, AERON_SEND_PACER_MODE_STARTUP);
+}
+
+TEST_F(SendPacerTest, shouldLimitToBurstAndRefillAtPacingRate)
+{
+    runSteadyFlow(1000);
+    const double gain = m_pacer.pacing_gain;
+
+    m_now_ns += 1000 * 1000L;
+    EXPECT_EQ(aeron_send_pacer_available(&m_pacer, m_now_ns), MAX_BURST_LENGTH);
+
+    aeron_send_pacer_on_send(&m_pacer, m_now_ns, m_position + MAX_BURST_LENGTH, MAX_BURST_LENGTH, false);
+    EXPECT_EQ(aeron_send_pacer_available(&m_pacer, m_now_ns), 0);
+
+    m_now_ns += 1000;
+    EXPECT_EQ(aeron_send_pacer_available(&m_pacer, m_now_ns), (int32_t)(gain * 1000));
+}
+
+TEST_F(SendPacerTest, shouldIgnoreLowerAppLimitedDeliveryRate)
+{
+    runSteadyFlow(1000);
+
+    for (int i = 0; i < 200; i++)
+    {
+        m_now_ns += STEP_NS;
+        m_position += BYTES_PER_STEP / 10;
+        aeron_send_pacer_on_send(&m_pacer, m_now_ns, m_position, BYTES_PER_STEP / 10, true);
+        aeron_send_pacer_on_status_message(&m_pacer, m_now_ns, m_position);
+    }
+
+    EXPECT_DOUBLE_EQ(m_pacer.btl_bw, 1.0);
+}
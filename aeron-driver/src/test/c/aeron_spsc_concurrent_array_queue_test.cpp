@@ -155,6 +155,29 @@ TEST_F(SpscQueueTest, shouldDraingFullQueueWithLimit)
     EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_q), CAPACITY - limit);
 }
 
+TEST_F(SpscQueueTest, shouldReleaseSlotsBeforeProcessingDrainedBatch)
+{
+    fillQueue();
+
+    int64_t counter = 1;
+    m_drain = [&](volatile void *e)
+    {
+        ASSERT_EQ(e, (void *)counter);
+        if (1 == counter)
+        {
+            EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_q), 0u);
+            EXPECT_EQ(aeron_spsc_concurrent_array_queue_offer(&m_q, (void *)(CAPACITY + 1)), AERON_OFFER_SUCCESS);
+        }
+        counter++;
+    };
+
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_drain(&m_q, SpscQueueTest::drain_func, this, CAPACITY), CAPACITY);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_q), 1u);
+
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_drain_all(&m_q, SpscQueueTest::drain_func, this), 1u);
+    EXPECT_EQ(counter, (int64_t)CAPACITY + 2);
+}
+
 #define NUM_MESSAGES (10 * 1000 * 1000)
 
 static void spsc_queue_concurrent_handler(void *clientd, volatile void *element)
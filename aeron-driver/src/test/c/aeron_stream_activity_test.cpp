@@ -0,0 +1,130 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <concurrent/reports/StreamActivityReader.h>
+
+extern "C"
+{
+#include "reports/aeron_stream_activity.h"
+}
+
+#define ACTIVITY_CAPACITY (8)
+#define CAPACITY (1024)
+
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::reports;
+
+typedef std::array<std::uint8_t, CAPACITY> buffer_t;
+
+class StreamActivityTest : public testing::Test
+{
+public:
+    StreamActivityTest()
+    {
+        m_buffer.fill(0);
+        m_atomicBuffer.wrap(m_buffer.data(), m_buffer.size());
+    }
+
+protected:
+    std::vector<std::int64_t> poll(StreamActivityReader& reader, int expected)
+    {
+        std::vector<std::int64_t> correlationIds;
+
+        const int result = reader.poll([&](std::int64_t correlationId) { correlationIds.push_back(correlationId); });
+        EXPECT_EQ(result, expected);
+
+        return correlationIds;
+    }
+
+    AERON_DECL_ALIGNED(buffer_t m_buffer, 16);
+    AtomicBuffer m_atomicBuffer;
+    aeron_stream_activity_t m_activity;
+};
+
+TEST_F(StreamActivityTest, shouldFailInitWhenCapacityNotPowerOfTwoOrBufferTooShort)
+{
+    EXPECT_EQ(aeron_stream_activity_init(&m_activity, m_buffer.data(), m_buffer.size(), 6), -1);
+    EXPECT_EQ(aeron_stream_activity_init(
+        &m_activity, m_buffer.data(), aeron_stream_activity_length(ACTIVITY_CAPACITY) - 1, ACTIVITY_CAPACITY), -1);
+    EXPECT_THROW(StreamActivityReader reader(m_atomicBuffer), aeron::util::IllegalStateException);
+}
+
+TEST_F(StreamActivityTest, shouldOnlyAppendWhenPositionMovesOn)
+{
+    int64_t last_position = 0;
+
+    ASSERT_EQ(aeron_stream_activity_init(&m_activity, m_buffer.data(), m_buffer.size(), ACTIVITY_CAPACITY), 0);
+
+    EXPECT_FALSE(aeron_stream_activity_track(&m_activity, 7, 0, &last_position));
+    EXPECT_TRUE(aeron_stream_activity_track(&m_activity, 7, 64, &last_position));
+    EXPECT_FALSE(aeron_stream_activity_track(&m_activity, 7, 64, &last_position));
+    EXPECT_EQ(last_position, 64);
+    EXPECT_EQ(m_activity.header->tail, 1);
+}
+
+TEST_F(StreamActivityTest, shouldIgnoreAppendsWhenNotEnabled)
+{
+    int64_t last_position = 0;
+
+    ASSERT_EQ(aeron_stream_activity_init(&m_activity, NULL, 0, 0), 0);
+
+    EXPECT_FALSE(aeron_stream_activity_track(&m_activity, 7, 64, &last_position));
+    EXPECT_EQ(last_position, 64);
+}
+
+TEST_F(StreamActivityTest, shouldReadEntriesAppendedAfterReaderCreated)
+{
+    ASSERT_EQ(aeron_stream_activity_init(&m_activity, m_buffer.data(), m_buffer.size(), ACTIVITY_CAPACITY), 0);
+
+    aeron_stream_activity_append(&m_activity, 1);
+
+    StreamActivityReader reader(m_atomicBuffer);
+    EXPECT_EQ(reader.capacity(), ACTIVITY_CAPACITY);
+    EXPECT_TRUE(poll(reader, 0).empty());
+
+    aeron_stream_activity_append(&m_activity, 2);
+    aeron_stream_activity_append(&m_activity, 3);
+    EXPECT_EQ(poll(reader, 2), std::vector<std::int64_t>({ 2, 3 }));
+
+    for (int64_t i = 0; i < ACTIVITY_CAPACITY; i++)
+    {
+        aeron_stream_activity_append(&m_activity, 10 + i);
+    }
+    EXPECT_EQ(poll(reader, ACTIVITY_CAPACITY).back(), 10 + ACTIVITY_CAPACITY - 1);
+    EXPECT_EQ(reader.lappedCount(), 0);
+}
+
+TEST_F(StreamActivityTest, shouldMoveReaderToTailWhenLapped)
+{
+    ASSERT_EQ(aeron_stream_activity_init(&m_activity, m_buffer.data(), m_buffer.size(), ACTIVITY_CAPACITY), 0);
+
+    StreamActivityReader reader(m_atomicBuffer);
+
+    for (int64_t i = 0; i < ACTIVITY_CAPACITY + 1; i++)
+    {
+        aeron_stream_activity_append(&m_activity, i);
+    }
+
+    EXPECT_TRUE(poll(reader, StreamActivityReader::LAPPED).empty());
+    EXPECT_EQ(reader.lappedCount(), 1);
+
+    aeron_stream_activity_append(&m_activity, 42);
+    EXPECT_EQ(poll(reader, 1), std::vector<std::int64_t>({ 42 }));
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "concurrent/aeron_term_gap_scanner.h"
+}
+
+#define CAPACITY (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define TERM_ID (1)
+#define FRAME_LENGTH (AERON_DATA_HEADER_LENGTH * 2)
+
+typedef std::array<std::uint8_t, CAPACITY> buffer_t;
+
+class TermGapScannerTest : public testing::Test
+{
+public:
+    TermGapScannerTest()
+    {
+        m_buffer.fill(0);
+    }
+
+    static void on_gap_detected(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
+    {
+        TermGapScannerTest *t = (TermGapScannerTest *)clientd;
+
+        t->m_on_gap_detected(term_id, term_offset, length);
+    }
+
+protected:
+    void write_frames(int32_t offset, int32_t count, int32_t frame_length)
+    {
+        for (int32_t i = 0; i < count; i++)
+        {
+            aeron_frame_header_t *frame_header = (aeron_frame_header_t *)(m_buffer.data() + offset + (i * frame_length));
+            frame_header->frame_length = frame_length;
+            frame_header->type = AERON_HDR_TYPE_DATA;
+        }
+    }
+
+    int32_t scan(int32_t term_offset, int32_t limit_offset)
+    {
+        return aeron_term_gap_scanner_scan_for_gap(
+            m_buffer.data(), TERM_ID, term_offset, limit_offset, TermGapScannerTest::on_gap_detected, this);
+    }
+
+    buffer_t m_buffer;
+    std::function<void(int32_t,int32_t,size_t)> m_on_gap_detected;
+};
+
+TEST_F(TermGapScannerTest, shouldReportGapAfterRunOfFrames)
+{
+    write_frames(0, 37, FRAME_LENGTH);
+    write_frames(45 * FRAME_LENGTH, 1, FRAME_LENGTH);
+
+    size_t called = 0;
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_id, TERM_ID);
+        EXPECT_EQ(term_offset, (int32_t)(37 * FRAME_LENGTH));
+        EXPECT_EQ(length, (size_t)(8 * FRAME_LENGTH));
+        called++;
+    };
+
+    EXPECT_EQ(scan(0, 46 * FRAME_LENGTH), 37 * FRAME_LENGTH);
+    EXPECT_EQ(called, 1u);
+}
+
+TEST_F(TermGapScannerTest, shouldReportGapUpToLimitWhenNothingFollows)
+{
+    write_frames(0, 3, FRAME_LENGTH);
+
+    size_t called = 0;
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_offset, (int32_t)(3 * FRAME_LENGTH));
+        EXPECT_EQ(length, (size_t)(17 * FRAME_LENGTH));
+        called++;
+    };
+
+    EXPECT_EQ(scan(0, 20 * FRAME_LENGTH), 3 * FRAME_LENGTH);
+    EXPECT_EQ(called, 1u);
+}
+
+TEST_F(TermGapScannerTest, shouldNotReportGapWhenRunReachesLimit)
+{
+    write_frames(0, 16, FRAME_LENGTH);
+    write_frames(16 * FRAME_LENGTH, 1, FRAME_LENGTH * 2);
+    write_frames(18 * FRAME_LENGTH, 6, FRAME_LENGTH);
+
+    size_t called = 0;
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        called++;
+    };
+
+    EXPECT_EQ(scan(0, 24 * FRAME_LENGTH), 24 * FRAME_LENGTH);
+    EXPECT_EQ(called, 0u);
+}
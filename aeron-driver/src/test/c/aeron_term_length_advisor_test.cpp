@@ -0,0 +1,124 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_term_length_advisor.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+}
+
+#define STREAM_ID (1001)
+#define MAX_TERM_LENGTH (16 * 1024 * 1024)
+#define SAMPLE_INTERVAL_NS (1000 * 1000 * 1000L)
+#define TARGET_BUFFERING_NS (100 * 1000 * 1000L)
+
+static int64_t null_epoch_clock()
+{
+    return 0;
+}
+
+class TermLengthAdvisorTest : public testing::Test
+{
+public:
+    TermLengthAdvisorTest()
+    {
+        m_metadata.fill(0);
+        m_values.fill(0);
+        aeron_counters_manager_init(
+            &m_manager, m_metadata.data(), m_metadata.size(), m_values.data(), m_values.size(), null_epoch_clock, 0);
+        aeron_term_length_advisor_init(&m_advisor, &m_manager, TARGET_BUFFERING_NS, 0);
+    }
+
+    ~TermLengthAdvisorTest() override
+    {
+        aeron_term_length_advisor_close(&m_advisor);
+        aeron_counters_manager_close(&m_manager);
+    }
+
+    void sampleAtRate(int32_t stream_id, int64_t bytes_per_sec, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            aeron_term_length_advisor_on_bytes_appended(&m_advisor, stream_id, false, bytes_per_sec);
+            m_now_ns += SAMPLE_INTERVAL_NS;
+            aeron_term_length_advisor_on_sample(&m_advisor, m_now_ns);
+        }
+    }
+
+protected:
+    static const size_t NUM_COUNTERS = 4;
+    std::array<std::uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_METADATA_LENGTH> m_metadata;
+    std::array<std::uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_VALUE_LENGTH> m_values;
+    aeron_counters_manager_t m_manager;
+    aeron_term_length_advisor_t m_advisor;
+    int64_t m_now_ns = 0;
+};
+
+TEST_F(TermLengthAdvisorTest, shouldKeepConfiguredLengthForUnknownStream)
+{
+    EXPECT_EQ(aeron_term_length_advisor_term_length(&m_advisor, STREAM_ID, false, MAX_TERM_LENGTH),
+        (size_t)MAX_TERM_LENGTH);
+}
+
+TEST_F(TermLengthAdvisorTest, shouldKeepConfiguredLengthUntilRateSettles)
+{
+    sampleAtRate(STREAM_ID, 0, AERON_TERM_LENGTH_ADVISOR_MIN_SAMPLES - 1);
+
+    EXPECT_EQ(aeron_term_length_advisor_term_length(&m_advisor, STREAM_ID, false, MAX_TERM_LENGTH),
+        (size_t)MAX_TERM_LENGTH);
+}
+
+TEST_F(TermLengthAdvisorTest, shouldUseMinimumLengthForQuietStream)
+{
+    sampleAtRate(STREAM_ID, 1024, AERON_TERM_LENGTH_ADVISOR_MIN_SAMPLES * 4);
+
+    EXPECT_EQ(aeron_term_length_advisor_term_length(&m_advisor, STREAM_ID, false, MAX_TERM_LENGTH),
+        (size_t)AERON_LOGBUFFER_TERM_MIN_LENGTH);
+}
+
+TEST_F(TermLengthAdvisorTest, shouldSizeTermToTargetBuffering)
+{
+    const int64_t rate = 10 * 1024 * 1024;
+    sampleAtRate(STREAM_ID, rate, AERON_TERM_LENGTH_ADVISOR_MIN_SAMPLES * 8);
+
+    const size_t term_length = aeron_term_length_advisor_term_length(&m_advisor, STREAM_ID, false, MAX_TERM_LENGTH);
+
+    EXPECT_EQ(term_length, (size_t)(2 * 1024 * 1024));
+    EXPECT_EQ(aeron_term_length_advisor_term_length(&m_advisor, STREAM_ID, true, MAX_TERM_LENGTH),
+        (size_t)MAX_TERM_LENGTH);
+}
+
+TEST_F(TermLengthAdvisorTest, shouldCapAtConfiguredLength)
+{
+    sampleAtRate(STREAM_ID, 1024L * 1024 * 1024, AERON_TERM_LENGTH_ADVISOR_MIN_SAMPLES * 8);
+
+    EXPECT_EQ(aeron_term_length_advisor_term_length(&m_advisor, STREAM_ID, false, MAX_TERM_LENGTH),
+        (size_t)MAX_TERM_LENGTH);
+}
+
+TEST_F(TermLengthAdvisorTest, shouldPublishRateInCounter)
+{
+    sampleAtRate(STREAM_ID, 1 << 20, AERON_TERM_LENGTH_ADVISOR_MIN_SAMPLES * 8);
+
+    const int64_t *counter = aeron_counter_addr(&m_manager, 0);
+    EXPECT_GT(*counter, (1 << 20) * 9 / 10);
+    EXPECT_LE(*counter, 1 << 20);
+}
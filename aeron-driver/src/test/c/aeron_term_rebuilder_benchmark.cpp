@@ -0,0 +1,141 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "util/aeron_bitutil.h"
+#include "concurrent/aeron_term_rebuilder.h"
+}
+
+#define TERM_LENGTH (64 * 1024 * 1024)
+#define WORKING_SET_LENGTH (128 * 1024)
+
+typedef void (*insert_func_t)(uint8_t *dest, const uint8_t *src, size_t length);
+
+class TermRebuilderBenchmark
+{
+public:
+    explicit TermRebuilderBenchmark(size_t frame_length) :
+        m_term(TERM_LENGTH, 0),
+        m_packet(frame_length, 0x5A),
+        m_working_set(WORKING_SET_LENGTH / sizeof(uint64_t), 1),
+        m_frame_length(frame_length),
+        m_offset(0)
+    {
+        aeron_data_header_t *hdr = (aeron_data_header_t *)m_packet.data();
+        hdr->frame_header.frame_length = (int32_t)frame_length;
+        hdr->frame_header.type = AERON_HDR_TYPE_DATA;
+    }
+
+    void insert(insert_func_t func)
+    {
+        if (m_offset + m_frame_length > TERM_LENGTH)
+        {
+            clean();
+        }
+
+        func(m_term.data() + m_offset, m_packet.data(), m_frame_length);
+        m_offset += AERON_ALIGN(m_frame_length, 32);
+    }
+
+    /* the rest of a receiver duty cycle, which wants its own data to still be in cache */
+    uint64_t touch_working_set()
+    {
+        uint64_t sum = 0;
+
+        for (uint64_t value : m_working_set)
+        {
+            sum += value;
+        }
+
+        return sum;
+    }
+
+private:
+    void clean()
+    {
+        for (size_t offset = 0; offset < TERM_LENGTH; offset += AERON_ALIGN(m_frame_length, 32))
+        {
+            ((aeron_frame_header_t *)(m_term.data() + offset))->frame_length = 0;
+        }
+
+        m_offset = 0;
+    }
+
+    std::vector<uint8_t> m_term;
+    std::vector<uint8_t> m_packet;
+    std::vector<uint64_t> m_working_set;
+    size_t m_frame_length;
+    size_t m_offset;
+};
+
+static void run_insert(benchmark::State &state, insert_func_t func)
+{
+    TermRebuilderBenchmark benchmark((size_t)state.range(0));
+
+    while (state.KeepRunning())
+    {
+        benchmark.insert(func);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void run_insert_with_working_set(benchmark::State &state, insert_func_t func)
+{
+    TermRebuilderBenchmark benchmark((size_t)state.range(0));
+
+    while (state.KeepRunning())
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            benchmark.insert(func);
+        }
+
+        benchmark::DoNotOptimize(benchmark.touch_working_set());
+    }
+}
+
+static void BM_Insert(benchmark::State &state)
+{
+    run_insert(state, aeron_term_rebuilder_insert);
+}
+
+static void BM_InsertNonTemporal(benchmark::State &state)
+{
+    run_insert(state, aeron_term_rebuilder_insert_non_temporal);
+}
+
+static void BM_InsertWithWorkingSet(benchmark::State &state)
+{
+    run_insert_with_working_set(state, aeron_term_rebuilder_insert);
+}
+
+static void BM_InsertNonTemporalWithWorkingSet(benchmark::State &state)
+{
+    run_insert_with_working_set(state, aeron_term_rebuilder_insert_non_temporal);
+}
+
+BENCHMARK(BM_Insert)->Arg(64)->Arg(1408)->Arg(8192);
+BENCHMARK(BM_InsertNonTemporal)->Arg(64)->Arg(1408)->Arg(8192);
+BENCHMARK(BM_InsertWithWorkingSet)->Arg(1408)->Arg(8192);
+BENCHMARK(BM_InsertNonTemporalWithWorkingSet)->Arg(1408)->Arg(8192);
+
+BENCHMARK_MAIN();
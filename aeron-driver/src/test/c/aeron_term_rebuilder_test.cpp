@@ -0,0 +1,105 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "concurrent/aeron_term_rebuilder.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+}
+
+#define CAPACITY (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+
+typedef std::array<std::uint8_t, CAPACITY> buffer_t;
+
+class TermRebuilderTest : public testing::TestWithParam<size_t>
+{
+public:
+    TermRebuilderTest()
+    {
+        m_term_buffer.fill(0);
+        m_packet.fill(0);
+    }
+
+protected:
+    size_t fill_packet(size_t payload_length)
+    {
+        const size_t length = AERON_DATA_HEADER_LENGTH + payload_length;
+        aeron_data_header_t *data_header = (aeron_data_header_t *)m_packet.data();
+
+        for (size_t i = AERON_DATA_HEADER_LENGTH; i < length; i++)
+        {
+            m_packet[i] = (uint8_t)(i * 7);
+        }
+
+        data_header->frame_header.frame_length = (int32_t)length;
+        data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+        data_header->term_offset = 1024;
+        data_header->session_id = 7;
+
+        return length;
+    }
+
+    buffer_t m_term_buffer;
+    buffer_t m_packet;
+};
+
+TEST_P(TermRebuilderTest, shouldInsertFrameWithNonTemporalStores)
+{
+    const size_t length = fill_packet(GetParam());
+    uint8_t *dest = m_term_buffer.data() + 1024;
+
+    aeron_term_rebuilder_insert_non_temporal(dest, m_packet.data(), length);
+
+    EXPECT_EQ(memcmp(dest, m_packet.data(), length), 0);
+    EXPECT_EQ(dest[length], 0u);
+}
+
+TEST_P(TermRebuilderTest, shouldNotOverwriteExistingFrameWithNonTemporalStores)
+{
+    const size_t length = fill_packet(GetParam());
+    uint8_t *dest = m_term_buffer.data() + 1024;
+    aeron_frame_header_t *existing = (aeron_frame_header_t *)dest;
+
+    existing->frame_length = (int32_t)length;
+    aeron_term_rebuilder_insert_non_temporal(dest, m_packet.data(), length);
+
+    EXPECT_EQ(dest[AERON_DATA_HEADER_LENGTH], 0u);
+}
+
+TEST_P(TermRebuilderTest, shouldInsertFrameWithReplacedReservedValue)
+{
+    const size_t length = fill_packet(GetParam());
+    uint8_t *dest = m_term_buffer.data() + 1024;
+    aeron_data_header_t *inserted = (aeron_data_header_t *)dest;
+
+    ((aeron_data_header_t *)m_packet.data())->reserved_value = 42;
+    aeron_term_rebuilder_insert_with_reserved_value(dest, m_packet.data(), length, 1234567890123LL);
+
+    EXPECT_EQ(inserted->reserved_value, 1234567890123LL);
+    EXPECT_EQ(inserted->frame_header.frame_length, (int32_t)length);
+    EXPECT_EQ(inserted->session_id, 7);
+    EXPECT_EQ(memcmp(
+        dest + AERON_DATA_HEADER_LENGTH,
+        m_packet.data() + AERON_DATA_HEADER_LENGTH,
+        length - AERON_DATA_HEADER_LENGTH), 0);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    TermRebuilderPayloadLengths, TermRebuilderTest, testing::Values(0, 1, 15, 16, 33, 64, 100, 1376, 4064));
@@ -189,3 +189,78 @@ TEST_F(TermScannerTest, shouldScanLastMessageInBufferMinusPaddingLimitedByMtu)
         m_ptr, CAPACITY - offset, mtu, &m_padding), (size_t)aligned_frame_length);
     EXPECT_EQ(m_padding, 0u);
 }
+
+class TermScannerRunTest : public TermScannerTest
+{
+protected:
+    void write_frames(size_t offset, size_t count, int32_t frame_length, int16_t type = AERON_HDR_TYPE_DATA)
+    {
+        const size_t aligned_frame_length = (size_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            aeron_data_header_t *data_header = (aeron_data_header_t *)(m_ptr + offset + (i * aligned_frame_length));
+            data_header->frame_header.frame_length = frame_length;
+            data_header->frame_header.type = type;
+        }
+    }
+};
+
+TEST_F(TermScannerRunTest, shouldScanRunOfEqualFramesUpToMtu)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH * 2;
+
+    write_frames(0, CAPACITY / frame_length, frame_length);
+
+    EXPECT_EQ(aeron_term_scanner_scan_for_availability(m_ptr, CAPACITY, MTU_LENGTH, &m_padding), (size_t)MTU_LENGTH);
+    EXPECT_EQ(m_padding, 0u);
+}
+
+TEST_F(TermScannerRunTest, shouldContinueScanAfterRunEndsWithDifferentLength)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH * 2;
+    const int32_t other_frame_length = AERON_DATA_HEADER_LENGTH * 4;
+
+    write_frames(0, 6, frame_length);
+    write_frames(6 * frame_length, 1, other_frame_length);
+    write_frames((6 * frame_length) + other_frame_length, 5, frame_length);
+
+    EXPECT_EQ(aeron_term_scanner_scan_for_availability(m_ptr, CAPACITY, 4096, &m_padding),
+        (size_t)((11 * frame_length) + other_frame_length));
+    EXPECT_EQ(m_padding, 0u);
+}
+
+TEST_F(TermScannerRunTest, shouldStopRunAtPaddingFrameOfSameLength)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH * 2;
+
+    write_frames(0, 6, frame_length);
+    write_frames(6 * frame_length, 1, frame_length, AERON_HDR_TYPE_PAD);
+
+    EXPECT_EQ(aeron_term_scanner_scan_for_availability(m_ptr, CAPACITY, 4096, &m_padding),
+        (size_t)((6 * frame_length) + AERON_DATA_HEADER_LENGTH));
+    EXPECT_EQ(m_padding, (size_t)(frame_length - AERON_DATA_HEADER_LENGTH));
+}
+
+TEST_F(TermScannerRunTest, shouldStopRunAtUnwrittenFrame)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH * 2;
+
+    write_frames(0, 9, frame_length);
+
+    EXPECT_EQ(aeron_term_scanner_scan_for_availability(m_ptr, CAPACITY, 4096, &m_padding),
+        (size_t)(9 * frame_length));
+    EXPECT_EQ(m_padding, 0u);
+}
+
+TEST_F(TermScannerRunTest, shouldStopRunAtEndOfTerm)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH * 2;
+    const size_t term_length_left = 7 * frame_length;
+
+    m_ptr += CAPACITY - term_length_left;
+    write_frames(0, 7, frame_length);
+
+    EXPECT_EQ(aeron_term_scanner_scan_for_availability(m_ptr, term_length_left, 4096, &m_padding), term_length_left);
+    EXPECT_EQ(m_padding, 0u);
+}
@@ -285,3 +285,97 @@ TEST_F(UdpChannelTest, shouldCanonicalizeForIpv6Multicast)
     ASSERT_EQ(parse_udp_channel("aeron:udp?interface=[::1]:54321/64|endpoint=[FF01::FD]:40456"), 0) << aeron_errmsg();
     EXPECT_STREQ(m_channel->canonical_form, "UDP-00000000000000000000000000000001-54321-ff0100000000000000000000000000fd-40456");
 }
+
+TEST_F(UdpChannelTest, shouldCopyCachedChannelUntilTtlExpires)
+{
+    const char *uri = "aeron:udp?interface=localhost:40123|endpoint=localhost:40124|mtu=8192";
+    aeron_udp_channel_cache_t cache;
+    aeron_udp_channel_t *first = NULL;
+    aeron_udp_channel_t *second = NULL;
+
+    ASSERT_EQ(aeron_udp_channel_cache_init(&cache, 1000), 0);
+
+    ASSERT_EQ(aeron_udp_channel_cache_parse(&cache, uri, strlen(uri), 0, &first), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_udp_channel_cache_parse(&cache, uri, strlen(uri), 999, &second), 0) << aeron_errmsg();
+    EXPECT_EQ(cache.entry_by_uri_map.size, 1u);
+
+    EXPECT_NE(first, second);
+    EXPECT_STREQ(first->canonical_form, second->canonical_form);
+    EXPECT_EQ(memcmp(&first->remote_data, &second->remote_data, sizeof(first->remote_data)), 0);
+    EXPECT_NE(second->uri.params.udp.endpoint_key, first->uri.params.udp.endpoint_key);
+    EXPECT_STREQ(second->uri.params.udp.endpoint_key, "localhost:40124");
+    EXPECT_EQ(second->uri.params.udp.additional_params.length, 1u);
+
+    aeron_udp_channel_delete(second);
+    ASSERT_EQ(aeron_udp_channel_cache_parse(&cache, uri, strlen(uri), 1000, &second), 0) << aeron_errmsg();
+    EXPECT_EQ(cache.entry_by_uri_map.size, 1u);
+    EXPECT_STREQ(first->canonical_form, second->canonical_form);
+
+    aeron_udp_channel_delete(first);
+    aeron_udp_channel_delete(second);
+    aeron_udp_channel_cache_close(&cache);
+}
+
+TEST_F(UdpChannelTest, shouldNotCacheChannelThatFailsToParse)
+{
+    const char *uri = "aeron:udp?endpoint=224.10.9.8";
+    aeron_udp_channel_cache_t cache;
+    aeron_udp_channel_t *channel = NULL;
+
+    ASSERT_EQ(aeron_udp_channel_cache_init(&cache, 1000), 0);
+
+    EXPECT_EQ(aeron_udp_channel_cache_parse(&cache, uri, strlen(uri), 0, &channel), -1);
+    EXPECT_EQ(cache.entry_by_uri_map.size, 0u);
+
+    aeron_udp_channel_cache_close(&cache);
+}
+
+TEST_F(UdpChannelTest, shouldParseMultiPathEndpointsAndInterfaces)
+{
+    ASSERT_EQ(parse_udp_channel(
+        "aeron:udp?endpoint=127.0.0.1:40124,127.0.0.2:40125|interface=127.0.0.1:40123,127.0.0.1:40126"), 0)
+        << aeron_errmsg();
+
+    EXPECT_EQ(m_channel->path_count, 2u);
+    EXPECT_FALSE(m_channel->is_striped);
+
+    EXPECT_STREQ(inet_ntop(&m_channel->path_remote_data[0]), "127.0.0.1");
+    EXPECT_EQ(port(&m_channel->path_remote_data[0]), 40124);
+    EXPECT_STREQ(inet_ntop(&m_channel->path_local_data[0]), "127.0.0.1");
+    EXPECT_EQ(port(&m_channel->path_local_data[0]), 40123);
+
+    EXPECT_STREQ(inet_ntop(&m_channel->path_remote_data[1]), "127.0.0.2");
+    EXPECT_EQ(port(&m_channel->path_remote_data[1]), 40125);
+    EXPECT_STREQ(inet_ntop(&m_channel->path_local_data[1]), "127.0.0.1");
+    EXPECT_EQ(port(&m_channel->path_local_data[1]), 40126);
+
+    EXPECT_EQ(memcmp(&m_channel->remote_data, &m_channel->path_remote_data[0], sizeof(m_channel->remote_data)), 0);
+}
+
+TEST_F(UdpChannelTest, shouldShareSingleEndpointAcrossMultiPathInterfaces)
+{
+    ASSERT_EQ(parse_udp_channel(
+        "aeron:udp?endpoint=127.0.0.1:40124|interface=127.0.0.1:40127,127.0.0.1:40128|multipath=stripe"), 0)
+        << aeron_errmsg();
+
+    EXPECT_EQ(m_channel->path_count, 2u);
+    EXPECT_TRUE(m_channel->is_striped);
+    EXPECT_EQ(port(&m_channel->path_remote_data[1]), 40124);
+    EXPECT_EQ(port(&m_channel->path_local_data[1]), 40128);
+}
+
+TEST_F(UdpChannelTest, shouldRejectInvalidMultiPathChannels)
+{
+    EXPECT_EQ(parse_udp_channel(
+        "aeron:udp?endpoint=127.0.0.1:40124,127.0.0.2:40125|interface=127.0.0.1,127.0.0.2,127.0.0.3"), -1);
+    EXPECT_EQ(parse_udp_channel("aeron:udp?endpoint=127.0.0.1:40124,224.10.9.8:40124"), -1);
+    EXPECT_EQ(parse_udp_channel("aeron:udp?endpoint=127.0.0.1:40124,127.0.0.2:40125|multipath=mirror"), -1);
+}
+
+TEST_F(UdpChannelTest, shouldNotUseMultiPathForSingleEndpoint)
+{
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=127.0.0.1:40124"), 0) << aeron_errmsg();
+
+    EXPECT_EQ(m_channel->path_count, 1u);
+    EXPECT_FALSE(m_channel->is_striped);
+}
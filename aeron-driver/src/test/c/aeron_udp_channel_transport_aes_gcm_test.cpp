@@ -0,0 +1,288 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+extern "C"
+{
+#include "media/aeron_udp_channel_transport_aes_gcm.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_error.h"
+}
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define NUM_RECV_BUFFERS (4)
+#define RECV_BUFFER_LENGTH (2048)
+#define KEY_HEX "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+
+TEST(UdpChannelTransportAesGcmKeyTest, shouldParseKeysOfBothLengths)
+{
+    uint8_t key[AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_KEY_LENGTH];
+    size_t key_length = 0;
+
+    ASSERT_EQ(aeron_udp_channel_transport_aes_gcm_parse_key("000102030405060708090A0B0C0D0E0F", key, &key_length), 0);
+    EXPECT_EQ(key_length, 16u);
+    EXPECT_EQ(key[15], 0x0F);
+
+    ASSERT_EQ(aeron_udp_channel_transport_aes_gcm_parse_key(KEY_HEX, key, &key_length), 0);
+    EXPECT_EQ(key_length, 32u);
+    EXPECT_EQ(key[31], 0x1F);
+}
+
+TEST(UdpChannelTransportAesGcmKeyTest, shouldRejectMalformedKeys)
+{
+    uint8_t key[AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_MAX_KEY_LENGTH];
+    size_t key_length = 0;
+
+    EXPECT_EQ(aeron_udp_channel_transport_aes_gcm_parse_key(NULL, key, &key_length), -1);
+    EXPECT_EQ(aeron_udp_channel_transport_aes_gcm_parse_key("0001020304", key, &key_length), -1);
+    EXPECT_EQ(aeron_udp_channel_transport_aes_gcm_parse_key("zz0102030405060708090a0b0c0d0e0f", key, &key_length), -1);
+}
+
+#if defined(HAVE_LIBCRYPTO)
+
+class UdpChannelTransportAesGcmTest : public testing::Test
+{
+public:
+    UdpChannelTransportAesGcmTest()
+    {
+        for (size_t i = 0; i < NUM_RECV_BUFFERS; i++)
+        {
+            m_iov[i].iov_base = m_buffers[i];
+            m_iov[i].iov_len = RECV_BUFFER_LENGTH;
+            memset(&m_msgvec[i], 0, sizeof(m_msgvec[i]));
+            m_msgvec[i].msg_hdr.msg_iov = &m_iov[i];
+            m_msgvec[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        m_sender.fd = -1;
+        m_sender.bindings_clientd = NULL;
+        m_receiver.fd = -1;
+        m_receiver.bindings_clientd = NULL;
+        setenv(AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_KEY_ENV_VAR, KEY_HEX, 1);
+    }
+
+    ~UdpChannelTransportAesGcmTest() override
+    {
+        if (-1 != m_sender.fd)
+        {
+            aeron_udp_channel_transport_aes_gcm_close(&m_sender);
+        }
+
+        if (-1 != m_receiver.fd)
+        {
+            aeron_udp_channel_transport_aes_gcm_close(&m_receiver);
+        }
+
+        unsetenv(AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_KEY_ENV_VAR);
+    }
+
+    static void on_recv(
+        void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    {
+        UdpChannelTransportAesGcmTest *test = (UdpChannelTransportAesGcmTest *)clientd;
+
+        ASSERT_EQ(length, sizeof(aeron_data_header_t));
+        test->m_received.push_back(((aeron_data_header_t *)buffer)->term_offset);
+    }
+
+    static int bind_transport(aeron_udp_channel_transport_t *transport, struct sockaddr_storage *addr)
+    {
+        struct sockaddr_in *in4 = (struct sockaddr_in *)addr;
+        socklen_t len = sizeof(struct sockaddr_in);
+
+        memset(addr, 0, sizeof(struct sockaddr_storage));
+        in4->sin_family = AF_INET;
+        in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        transport->bindings = &aeron_udp_channel_transport_bindings_aes_gcm;
+        transport->dispatch_clientd = NULL;
+
+        if (aeron_udp_channel_transport_aes_gcm_init(
+            transport, addr, NULL, 0, 0, 0, 0, false, 0, false, false, NULL) < 0)
+        {
+            return -1;
+        }
+
+        return getsockname(transport->fd, (struct sockaddr *)addr, &len);
+    }
+
+    int bind_transports()
+    {
+        if (bind_transport(&m_sender, &m_sender_addr) < 0)
+        {
+            return -1;
+        }
+
+        return bind_transport(&m_receiver, &m_receiver_addr);
+    }
+
+    /* frames are told apart by their term offset and the header is split over two iovecs like a sender's would be */
+    int send_frames(const std::vector<int32_t> &markers)
+    {
+        std::vector<aeron_data_header_t> headers(markers.size());
+        std::vector<struct iovec> iov(markers.size() * 2);
+        std::vector<struct mmsghdr> msgvec(markers.size());
+        const size_t split = sizeof(aeron_frame_header_t);
+
+        for (size_t i = 0; i < markers.size(); i++)
+        {
+            memset(&headers[i], 0, sizeof(aeron_data_header_t));
+            headers[i].frame_header.frame_length = sizeof(aeron_data_header_t);
+            headers[i].frame_header.type = AERON_HDR_TYPE_DATA;
+            headers[i].term_offset = markers[i];
+
+            iov[i * 2].iov_base = &headers[i];
+            iov[i * 2].iov_len = split;
+            iov[(i * 2) + 1].iov_base = (uint8_t *)&headers[i] + split;
+            iov[(i * 2) + 1].iov_len = sizeof(aeron_data_header_t) - split;
+
+            memset(&msgvec[i], 0, sizeof(struct mmsghdr));
+            msgvec[i].msg_hdr.msg_name = &m_receiver_addr;
+            msgvec[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+            msgvec[i].msg_hdr.msg_iov = &iov[i * 2];
+            msgvec[i].msg_hdr.msg_iovlen = 2;
+        }
+
+        const int result = aeron_udp_channel_transport_aes_gcm_sendmmsg(&m_sender, msgvec.data(), msgvec.size());
+
+        for (int i = 0; i < result; i++)
+        {
+            EXPECT_EQ(msgvec[i].msg_len, sizeof(aeron_data_header_t));
+        }
+
+        return result;
+    }
+
+    void poll_until_received(size_t count)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        const auto settle = std::chrono::milliseconds(10);
+        auto end = deadline;
+
+        while (std::chrono::steady_clock::now() < end)
+        {
+            for (size_t i = 0; i < NUM_RECV_BUFFERS; i++)
+            {
+                m_msgvec[i].msg_hdr.msg_name = &m_src_addr;
+                m_msgvec[i].msg_hdr.msg_namelen = sizeof(m_src_addr);
+            }
+
+            ASSERT_GE(aeron_udp_channel_transport_aes_gcm_recvmmsg(
+                &m_receiver, m_msgvec, NUM_RECV_BUFFERS, UdpChannelTransportAesGcmTest::on_recv, this), 0)
+                << aeron_errmsg();
+
+            if (m_received.size() >= count && end == deadline)
+            {
+                end = std::chrono::steady_clock::now() + settle;
+            }
+        }
+    }
+
+protected:
+    aeron_udp_channel_transport_t m_sender;
+    aeron_udp_channel_transport_t m_receiver;
+    struct sockaddr_storage m_sender_addr;
+    struct sockaddr_storage m_receiver_addr;
+    struct sockaddr_storage m_src_addr;
+    struct mmsghdr m_msgvec[NUM_RECV_BUFFERS];
+    struct iovec m_iov[NUM_RECV_BUFFERS];
+    uint8_t m_buffers[NUM_RECV_BUFFERS][RECV_BUFFER_LENGTH];
+    std::vector<int32_t> m_received;
+};
+
+TEST_F(UdpChannelTransportAesGcmTest, shouldRoundTripMoreFramesThanOneBatch)
+{
+    ASSERT_EQ(bind_transports(), 0) << aeron_errmsg();
+
+    ASSERT_EQ(send_frames({ 1, 2, 3, 4, 5, 6 }), 6) << aeron_errmsg();
+    poll_until_received(6);
+
+    EXPECT_EQ(m_received, std::vector<int32_t>({ 1, 2, 3, 4, 5, 6 }));
+    EXPECT_EQ(aeron_udp_channel_transport_aes_gcm_state(&m_receiver)->frames_rejected, 0);
+}
+
+TEST_F(UdpChannelTransportAesGcmTest, shouldNotSendPlaintext)
+{
+    ASSERT_EQ(bind_transports(), 0) << aeron_errmsg();
+
+    int plain_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in *in4 = (struct sockaddr_in *)&m_receiver_addr;
+    in4->sin_port = 0;
+    ASSERT_EQ(bind(plain_fd, (struct sockaddr *)in4, sizeof(struct sockaddr_in)), 0);
+    socklen_t len = sizeof(struct sockaddr_in);
+    ASSERT_EQ(getsockname(plain_fd, (struct sockaddr *)&m_receiver_addr, &len), 0);
+
+    ASSERT_EQ(send_frames({ 0x5A5A5A5A }), 1) << aeron_errmsg();
+
+    uint8_t buffer[RECV_BUFFER_LENGTH];
+    const ssize_t length = recv(plain_fd, buffer, sizeof(buffer), 0);
+    close(plain_fd);
+
+    ASSERT_EQ(length, (ssize_t)(sizeof(aeron_data_header_t) + AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_OVERHEAD));
+    EXPECT_EQ(memmem(buffer, (size_t)length, "\x5A\x5A\x5A\x5A", 4), nullptr);
+}
+
+TEST_F(UdpChannelTransportAesGcmTest, shouldRejectUnauthenticatedDatagrams)
+{
+    ASSERT_EQ(bind_transports(), 0) << aeron_errmsg();
+
+    int plain_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    uint8_t forged[sizeof(aeron_data_header_t) + AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_OVERHEAD];
+    memset(forged, 0, sizeof(forged));
+
+    ASSERT_EQ(
+        sendto(plain_fd, forged, sizeof(forged), 0, (struct sockaddr *)&m_receiver_addr, sizeof(struct sockaddr_in)),
+        (ssize_t)sizeof(forged));
+    ASSERT_EQ(
+        sendto(plain_fd, forged, 8, 0, (struct sockaddr *)&m_receiver_addr, sizeof(struct sockaddr_in)), 8);
+    close(plain_fd);
+
+    ASSERT_EQ(send_frames({ 7 }), 1) << aeron_errmsg();
+    poll_until_received(1);
+
+    EXPECT_EQ(m_received, std::vector<int32_t>({ 7 }));
+    EXPECT_EQ(aeron_udp_channel_transport_aes_gcm_state(&m_receiver)->frames_rejected, 2);
+}
+
+TEST_F(UdpChannelTransportAesGcmTest, shouldRejectTransportWithoutKey)
+{
+    unsetenv(AERON_UDP_CHANNEL_TRANSPORT_AES_GCM_KEY_ENV_VAR);
+
+    EXPECT_EQ(bind_transport(&m_sender, &m_sender_addr), -1);
+    EXPECT_EQ(m_sender.fd, -1);
+}
+
+TEST_F(UdpChannelTransportAesGcmTest, shouldBeLoadedByName)
+{
+    EXPECT_EQ(
+        aeron_udp_channel_transport_bindings_load(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_AES_GCM),
+        &aeron_udp_channel_transport_bindings_aes_gcm);
+}
+
+#endif
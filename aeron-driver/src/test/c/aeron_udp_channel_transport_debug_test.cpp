@@ -0,0 +1,296 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+extern "C"
+{
+#include "media/aeron_udp_channel_transport_debug.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_error.h"
+}
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define NUM_RECV_BUFFERS (4)
+#define RECV_BUFFER_LENGTH (2048)
+
+class UdpChannelTransportDebugTest : public testing::Test
+{
+public:
+    UdpChannelTransportDebugTest()
+    {
+        m_send_fd = socket(AF_INET, SOCK_DGRAM, 0);
+
+        for (size_t i = 0; i < NUM_RECV_BUFFERS; i++)
+        {
+            m_iov[i].iov_base = m_buffers[i];
+            m_iov[i].iov_len = RECV_BUFFER_LENGTH;
+            memset(&m_msgvec[i], 0, sizeof(m_msgvec[i]));
+            m_msgvec[i].msg_hdr.msg_iov = &m_iov[i];
+            m_msgvec[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        m_transport.fd = -1;
+        m_transport.bindings_clientd = NULL;
+    }
+
+    ~UdpChannelTransportDebugTest() override
+    {
+        if (-1 != m_transport.fd)
+        {
+            aeron_udp_channel_transport_debug_close(&m_transport);
+        }
+
+        close(m_send_fd);
+
+        unsetenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DATA_LOSS_RATE_ENV_VAR);
+        unsetenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_CONTROL_LOSS_RATE_ENV_VAR);
+        unsetenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_REORDER_RATE_ENV_VAR);
+        unsetenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DELAY_ENV_VAR);
+        unsetenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_SEED_ENV_VAR);
+    }
+
+    static void on_recv(
+        void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    {
+        UdpChannelTransportDebugTest *test = (UdpChannelTransportDebugTest *)clientd;
+
+        test->m_received.push_back(((aeron_data_header_t *)buffer)->term_offset);
+    }
+
+    int bind_transport()
+    {
+        struct sockaddr_in *in4 = (struct sockaddr_in *)&m_addr;
+        socklen_t len = sizeof(struct sockaddr_in);
+
+        memset(&m_addr, 0, sizeof(m_addr));
+        in4->sin_family = AF_INET;
+        in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        m_transport.bindings = &aeron_udp_channel_transport_bindings_debug;
+        m_transport.dispatch_clientd = NULL;
+
+        if (aeron_udp_channel_transport_debug_init(&m_transport, &m_addr, NULL, 0, 0, 0, 0, false, 0, false, false, NULL) < 0)
+        {
+            return -1;
+        }
+
+        return getsockname(m_transport.fd, (struct sockaddr *)&m_addr, &len);
+    }
+
+    /* frames are told apart by their term offset */
+    void send_frame(uint16_t type, int32_t marker)
+    {
+        aeron_data_header_t header;
+
+        memset(&header, 0, sizeof(header));
+        header.frame_header.frame_length = sizeof(header);
+        header.frame_header.type = type;
+        header.term_offset = marker;
+
+        ASSERT_EQ(
+            sendto(m_send_fd, &header, sizeof(header), 0, (struct sockaddr *)&m_addr, sizeof(struct sockaddr_in)),
+            (ssize_t)sizeof(header));
+    }
+
+    int poll()
+    {
+        for (size_t i = 0; i < NUM_RECV_BUFFERS; i++)
+        {
+            m_msgvec[i].msg_hdr.msg_name = &m_src_addr;
+            m_msgvec[i].msg_hdr.msg_namelen = sizeof(m_src_addr);
+        }
+
+        return aeron_udp_channel_transport_debug_recvmmsg(
+            &m_transport, m_msgvec, NUM_RECV_BUFFERS, UdpChannelTransportDebugTest::on_recv, this);
+    }
+
+    void poll_for(std::chrono::milliseconds duration)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + duration;
+
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            ASSERT_GE(poll(), 0) << aeron_errmsg();
+        }
+    }
+
+    /* allows for a loaded machine, then a little longer to catch anything unexpected */
+    void poll_until_received(size_t count)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+
+        while (m_received.size() < count && std::chrono::steady_clock::now() < deadline)
+        {
+            ASSERT_GE(poll(), 0) << aeron_errmsg();
+        }
+
+        poll_for(std::chrono::milliseconds(10));
+    }
+
+protected:
+    int m_send_fd;
+    aeron_udp_channel_transport_t m_transport;
+    struct sockaddr_storage m_addr;
+    struct sockaddr_storage m_src_addr;
+    struct mmsghdr m_msgvec[NUM_RECV_BUFFERS];
+    struct iovec m_iov[NUM_RECV_BUFFERS];
+    uint8_t m_buffers[NUM_RECV_BUFFERS][RECV_BUFFER_LENGTH];
+    std::vector<int32_t> m_received;
+};
+
+TEST_F(UdpChannelTransportDebugTest, shouldPassFramesThroughWithoutConfiguration)
+{
+    ASSERT_EQ(bind_transport(), 0) << aeron_errmsg();
+
+    send_frame(AERON_HDR_TYPE_DATA, 1);
+    send_frame(AERON_HDR_TYPE_SM, 2);
+    poll_until_received(2);
+
+    EXPECT_EQ(m_received, std::vector<int32_t>({ 1, 2 }));
+}
+
+TEST_F(UdpChannelTransportDebugTest, shouldDropDataFramesButNotControlFrames)
+{
+    setenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DATA_LOSS_RATE_ENV_VAR, "1", 1);
+    ASSERT_EQ(bind_transport(), 0) << aeron_errmsg();
+
+    send_frame(AERON_HDR_TYPE_DATA, 1);
+    send_frame(AERON_HDR_TYPE_SETUP, 2);
+    send_frame(AERON_HDR_TYPE_NAK, 3);
+    poll_until_received(1);
+
+    EXPECT_EQ(m_received, std::vector<int32_t>({ 3 }));
+    EXPECT_EQ(aeron_udp_channel_transport_debug_state(&m_transport)->frames_dropped, 2);
+}
+
+TEST_F(UdpChannelTransportDebugTest, shouldDropControlFramesButNotDataFrames)
+{
+    setenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_CONTROL_LOSS_RATE_ENV_VAR, "1.0", 1);
+    ASSERT_EQ(bind_transport(), 0) << aeron_errmsg();
+
+    send_frame(AERON_HDR_TYPE_SM, 1);
+    send_frame(AERON_HDR_TYPE_DATA, 2);
+    poll_until_received(1);
+
+    EXPECT_EQ(m_received, std::vector<int32_t>({ 2 }));
+}
+
+TEST_F(UdpChannelTransportDebugTest, shouldHandReorderedFrameOverAfterTheNextFrame)
+{
+    setenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_REORDER_RATE_ENV_VAR, "1", 1);
+    ASSERT_EQ(bind_transport(), 0) << aeron_errmsg();
+
+    send_frame(AERON_HDR_TYPE_DATA, 1);
+    send_frame(AERON_HDR_TYPE_DATA, 2);
+    poll_until_received(2);
+
+    EXPECT_EQ(m_received, std::vector<int32_t>({ 2, 1 }));
+}
+
+TEST_F(UdpChannelTransportDebugTest, shouldHandReorderedFrameOverAloneAfterTimeout)
+{
+    setenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_REORDER_RATE_ENV_VAR, "1", 1);
+    ASSERT_EQ(bind_transport(), 0) << aeron_errmsg();
+
+    send_frame(AERON_HDR_TYPE_DATA, 1);
+    poll_until_received(1);
+
+    EXPECT_EQ(m_received, std::vector<int32_t>({ 1 }));
+}
+
+TEST_F(UdpChannelTransportDebugTest, shouldHoldFramesForDelayInOrder)
+{
+    setenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DELAY_ENV_VAR, "50000000", 1);
+    ASSERT_EQ(bind_transport(), 0) << aeron_errmsg();
+
+    send_frame(AERON_HDR_TYPE_DATA, 1);
+    send_frame(AERON_HDR_TYPE_DATA, 2);
+    poll_for(std::chrono::milliseconds(5));
+
+    EXPECT_TRUE(m_received.empty());
+    EXPECT_EQ(aeron_udp_channel_transport_debug_state(&m_transport)->frames_delayed, 2);
+
+    poll_until_received(2);
+
+    EXPECT_EQ(m_received, std::vector<int32_t>({ 1, 2 }));
+}
+
+TEST_F(UdpChannelTransportDebugTest, shouldRepeatLossForTheSameSeed)
+{
+    std::vector<int32_t> first_run;
+
+    setenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DATA_LOSS_RATE_ENV_VAR, "0.5", 1);
+    setenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_SEED_ENV_VAR, "42", 1);
+
+    for (int run = 0; run < 2; run++)
+    {
+        ASSERT_EQ(bind_transport(), 0) << aeron_errmsg();
+
+        /* the seed of each transport is offset by how many were created before it */
+        aeron_udp_channel_transport_debug_t *debug = aeron_udp_channel_transport_debug_state(&m_transport);
+        debug->xsubi[0] = 42;
+        debug->xsubi[1] = 0;
+        debug->xsubi[2] = 0;
+
+        for (int32_t i = 0; i < 32; i++)
+        {
+            send_frame(AERON_HDR_TYPE_DATA, i);
+            poll_for(std::chrono::milliseconds(1));
+        }
+        poll_for(std::chrono::milliseconds(10));
+
+        if (0 == run)
+        {
+            first_run = m_received;
+            m_received.clear();
+            aeron_udp_channel_transport_debug_close(&m_transport);
+            m_transport.fd = -1;
+        }
+    }
+
+    EXPECT_GT(first_run.size(), 0u);
+    EXPECT_LT(first_run.size(), 32u);
+    EXPECT_EQ(m_received, first_run);
+}
+
+TEST_F(UdpChannelTransportDebugTest, shouldRejectLossRateOutOfRange)
+{
+    setenv(AERON_UDP_CHANNEL_TRANSPORT_DEBUG_DATA_LOSS_RATE_ENV_VAR, "1.5", 1);
+
+    EXPECT_EQ(bind_transport(), -1);
+    EXPECT_EQ(m_transport.fd, -1);
+}
+
+TEST_F(UdpChannelTransportDebugTest, shouldBeLoadedByName)
+{
+    EXPECT_EQ(
+        aeron_udp_channel_transport_bindings_load(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_DEBUG),
+        &aeron_udp_channel_transport_bindings_debug);
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+
+extern "C"
+{
+#include "media/aeron_udp_channel_transport_dpdk.h"
+}
+
+#define FRAME_LENGTH (256)
+
+static const uint8_t SRC_MAC[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t DST_MAC[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+
+class UdpChannelTransportDpdkTest : public testing::Test
+{
+public:
+    UdpChannelTransportDpdkTest()
+    {
+        memset(m_frame, 0, sizeof(m_frame));
+        makeAddr(m_src_addr, "10.0.0.1", 40123);
+        makeAddr(m_dst_addr, "10.0.0.2", 40456);
+    }
+
+    static void makeAddr(struct sockaddr_in &addr, const char *ip, uint16_t port)
+    {
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        inet_pton(AF_INET, ip, &addr.sin_addr);
+    }
+
+    static uint16_t ipChecksum(const uint8_t *ip)
+    {
+        uint32_t sum = 0;
+
+        for (size_t i = 0; i < AERON_UDP_CHANNEL_TRANSPORT_DPDK_IPV4_HEADER_LENGTH; i += 2)
+        {
+            sum += (uint32_t)((ip[i] << 8) | ip[i + 1]);
+        }
+
+        while (sum >> 16)
+        {
+            sum = (sum & 0xFFFF) + (sum >> 16);
+        }
+
+        return (uint16_t)~sum;
+    }
+
+protected:
+    uint8_t m_frame[FRAME_LENGTH];
+    struct sockaddr_in m_src_addr;
+    struct sockaddr_in m_dst_addr;
+};
+
+TEST_F(UdpChannelTransportDpdkTest, shouldDecodeEncodedHeaders)
+{
+    const size_t payload_length = 100;
+    struct sockaddr_in src_addr, dst_addr;
+    size_t payload_offset = 0, decoded_length = 0;
+
+    aeron_udp_channel_transport_dpdk_encode_headers(
+        m_frame, SRC_MAC, DST_MAC, &m_src_addr, &m_dst_addr, 64, payload_length);
+
+    ASSERT_TRUE(aeron_udp_channel_transport_dpdk_decode_headers(
+        m_frame,
+        AERON_UDP_CHANNEL_TRANSPORT_DPDK_HEADERS_LENGTH + payload_length,
+        &src_addr,
+        &dst_addr,
+        &payload_offset,
+        &decoded_length));
+
+    EXPECT_EQ(memcmp(m_frame, DST_MAC, sizeof(DST_MAC)), 0);
+    EXPECT_EQ(memcmp(m_frame + 6, SRC_MAC, sizeof(SRC_MAC)), 0);
+    EXPECT_EQ(payload_offset, (size_t)AERON_UDP_CHANNEL_TRANSPORT_DPDK_HEADERS_LENGTH);
+    EXPECT_EQ(decoded_length, payload_length);
+    EXPECT_EQ(src_addr.sin_addr.s_addr, m_src_addr.sin_addr.s_addr);
+    EXPECT_EQ(src_addr.sin_port, m_src_addr.sin_port);
+    EXPECT_EQ(dst_addr.sin_addr.s_addr, m_dst_addr.sin_addr.s_addr);
+    EXPECT_EQ(dst_addr.sin_port, m_dst_addr.sin_port);
+}
+
+TEST_F(UdpChannelTransportDpdkTest, shouldComputeValidIpv4HeaderChecksum)
+{
+    aeron_udp_channel_transport_dpdk_encode_headers(m_frame, SRC_MAC, DST_MAC, &m_src_addr, &m_dst_addr, 64, 37);
+
+    EXPECT_EQ(ipChecksum(m_frame + AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH), 0);
+}
+
+TEST_F(UdpChannelTransportDpdkTest, shouldNotDecodeTruncatedOrFragmentedDatagram)
+{
+    struct sockaddr_in src_addr, dst_addr;
+    size_t payload_offset = 0, payload_length = 0;
+
+    aeron_udp_channel_transport_dpdk_encode_headers(m_frame, SRC_MAC, DST_MAC, &m_src_addr, &m_dst_addr, 64, 100);
+
+    EXPECT_FALSE(aeron_udp_channel_transport_dpdk_decode_headers(
+        m_frame,
+        AERON_UDP_CHANNEL_TRANSPORT_DPDK_HEADERS_LENGTH + 99,
+        &src_addr,
+        &dst_addr,
+        &payload_offset,
+        &payload_length));
+
+    m_frame[AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH + 6] |= 0x20;
+
+    EXPECT_FALSE(aeron_udp_channel_transport_dpdk_decode_headers(
+        m_frame,
+        AERON_UDP_CHANNEL_TRANSPORT_DPDK_HEADERS_LENGTH + 100,
+        &src_addr,
+        &dst_addr,
+        &payload_offset,
+        &payload_length));
+}
+
+TEST_F(UdpChannelTransportDpdkTest, shouldEncodeBroadcastArpRequest)
+{
+    const uint8_t broadcast_mac[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    const uint8_t *arp = m_frame + AERON_UDP_CHANNEL_TRANSPORT_DPDK_ETHER_HEADER_LENGTH;
+
+    aeron_udp_channel_transport_dpdk_encode_arp(
+        m_frame,
+        AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_OP_REQUEST,
+        SRC_MAC,
+        m_src_addr.sin_addr,
+        nullptr,
+        m_dst_addr.sin_addr);
+
+    EXPECT_EQ(memcmp(m_frame, broadcast_mac, sizeof(broadcast_mac)), 0);
+    EXPECT_EQ(m_frame[12], 0x08);
+    EXPECT_EQ(m_frame[13], 0x06);
+    EXPECT_EQ(arp[7], AERON_UDP_CHANNEL_TRANSPORT_DPDK_ARP_OP_REQUEST);
+    EXPECT_EQ(memcmp(arp + 8, SRC_MAC, sizeof(SRC_MAC)), 0);
+    EXPECT_EQ(memcmp(arp + 14, &m_src_addr.sin_addr, sizeof(struct in_addr)), 0);
+    EXPECT_EQ(memcmp(arp + 24, &m_dst_addr.sin_addr, sizeof(struct in_addr)), 0);
+}
+
+TEST_F(UdpChannelTransportDpdkTest, shouldMapMulticastGroupToEthernetAddress)
+{
+    const uint8_t expected[6] = { 0x01, 0x00, 0x5E, 0x7F, 0x00, 0x01 };
+    struct in_addr group;
+    uint8_t mac[6];
+
+    inet_pton(AF_INET, "239.255.0.1", &group);
+    aeron_udp_channel_transport_dpdk_multicast_mac(group, mac);
+
+    EXPECT_EQ(memcmp(mac, expected, sizeof(expected)), 0);
+}
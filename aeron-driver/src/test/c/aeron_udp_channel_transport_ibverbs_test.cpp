@@ -0,0 +1,109 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+extern "C"
+{
+#include "media/aeron_udp_channel_transport_ibverbs.h"
+#include "protocol/aeron_udp_protocol.h"
+}
+
+class UdpChannelTransportIbverbsTest : public testing::Test
+{
+public:
+    UdpChannelTransportIbverbsTest()
+    {
+        memset(&m_addr, 0, sizeof(m_addr));
+    }
+
+protected:
+    struct sockaddr_storage m_addr;
+};
+
+TEST_F(UdpChannelTransportIbverbsTest, shouldMapIpv4AddressToIpv4MappedGid)
+{
+    const uint8_t expected[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 192, 168, 1, 20 };
+    uint8_t gid[16];
+    auto *in = (struct sockaddr_in *)&m_addr;
+
+    in->sin_family = AF_INET;
+    inet_pton(AF_INET, "192.168.1.20", &in->sin_addr);
+
+    ASSERT_EQ(aeron_udp_channel_transport_ibverbs_gid_from_addr(&m_addr, gid), 0);
+    EXPECT_EQ(memcmp(gid, expected, sizeof(expected)), 0);
+}
+
+TEST_F(UdpChannelTransportIbverbsTest, shouldMapIpv6AddressToSameGid)
+{
+    uint8_t gid[16];
+    auto *in6 = (struct sockaddr_in6 *)&m_addr;
+
+    in6->sin6_family = AF_INET6;
+    inet_pton(AF_INET6, "fe80::1:2", &in6->sin6_addr);
+
+    ASSERT_EQ(aeron_udp_channel_transport_ibverbs_gid_from_addr(&m_addr, gid), 0);
+    EXPECT_EQ(memcmp(gid, &in6->sin6_addr, sizeof(gid)), 0);
+}
+
+TEST_F(UdpChannelTransportIbverbsTest, shouldNotMapOtherAddressFamily)
+{
+    uint8_t gid[16];
+
+    m_addr.ss_family = AF_UNIX;
+
+    EXPECT_EQ(aeron_udp_channel_transport_ibverbs_gid_from_addr(&m_addr, gid), -1);
+}
+
+TEST_F(UdpChannelTransportIbverbsTest, shouldRecogniseEncodedAdvertisement)
+{
+    const uint8_t gid[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 10, 0, 0, 1 };
+    aeron_udp_channel_transport_ibverbs_advertisement_t advertisement;
+
+    aeron_udp_channel_transport_ibverbs_advertisement_encode(&advertisement, 0x1234, 0x5678, gid);
+
+    EXPECT_TRUE(aeron_udp_channel_transport_ibverbs_is_advertisement(
+        (const uint8_t *)&advertisement, sizeof(advertisement)));
+    EXPECT_EQ(advertisement.frame_header.frame_length, (int32_t)sizeof(advertisement));
+    EXPECT_EQ(advertisement.frame_header.type, (int16_t)AERON_HDR_TYPE_EXT);
+    EXPECT_EQ(advertisement.qpn, 0x1234u);
+    EXPECT_EQ(advertisement.qkey, 0x5678u);
+    EXPECT_EQ(memcmp(advertisement.gid, gid, sizeof(gid)), 0);
+}
+
+TEST_F(UdpChannelTransportIbverbsTest, shouldNotRecogniseOtherFramesAsAdvertisement)
+{
+    const uint8_t gid[16] = { 0 };
+    aeron_udp_channel_transport_ibverbs_advertisement_t advertisement;
+
+    aeron_udp_channel_transport_ibverbs_advertisement_encode(&advertisement, 1, 2, gid);
+
+    EXPECT_FALSE(aeron_udp_channel_transport_ibverbs_is_advertisement(
+        (const uint8_t *)&advertisement, sizeof(advertisement) - 1));
+
+    advertisement.frame_header.type = AERON_HDR_TYPE_DATA;
+    EXPECT_FALSE(aeron_udp_channel_transport_ibverbs_is_advertisement(
+        (const uint8_t *)&advertisement, sizeof(advertisement)));
+
+    advertisement.frame_header.type = (int16_t)AERON_HDR_TYPE_EXT;
+    advertisement.magic = 0;
+    EXPECT_FALSE(aeron_udp_channel_transport_ibverbs_is_advertisement(
+        (const uint8_t *)&advertisement, sizeof(advertisement)));
+}
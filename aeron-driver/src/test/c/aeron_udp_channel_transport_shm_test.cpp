@@ -0,0 +1,266 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+extern "C"
+{
+#include "media/aeron_udp_channel_transport_shm.h"
+#include "concurrent/aeron_mpsc_rb.h"
+#include "util/aeron_fileutil.h"
+}
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define NUM_RECV_BUFFERS (4)
+#define RECV_BUFFER_LENGTH (2048)
+
+class UdpChannelTransportShmTest : public testing::Test
+{
+public:
+    UdpChannelTransportShmTest()
+    {
+        char dir_template[] = "/tmp/aeron-shm-test-XXXXXX";
+
+        m_dir = mkdtemp(dir_template);
+        setenv(AERON_UDP_CHANNEL_TRANSPORT_SHM_DIR_ENV_VAR, m_dir.c_str(), 1);
+    }
+
+    ~UdpChannelTransportShmTest() override
+    {
+        unsetenv(AERON_UDP_CHANNEL_TRANSPORT_SHM_DIR_ENV_VAR);
+
+        for (const std::string &file : inbox_files())
+        {
+            unlink((m_dir + "/" + file).c_str());
+        }
+        rmdir(m_dir.c_str());
+    }
+
+    static void on_recv(
+        void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    {
+        auto *test = (UdpChannelTransportShmTest *)clientd;
+
+        test->m_received.emplace_back((const char *)buffer, length);
+        test->m_received_ports.push_back(ntohs(((struct sockaddr_in *)addr)->sin_port));
+    }
+
+    static uint16_t free_port()
+    {
+        struct sockaddr_in in4;
+        socklen_t len = sizeof(in4);
+        int fd = socket(AF_INET, SOCK_DGRAM, 0);
+
+        memset(&in4, 0, sizeof(in4));
+        in4.sin_family = AF_INET;
+        in4.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(fd, (struct sockaddr *)&in4, sizeof(in4));
+        getsockname(fd, (struct sockaddr *)&in4, &len);
+        close(fd);
+
+        return ntohs(in4.sin_port);
+    }
+
+    int bind_transport(aeron_udp_channel_transport_t *transport, struct sockaddr_storage *addr)
+    {
+        auto *in4 = (struct sockaddr_in *)addr;
+
+        memset(addr, 0, sizeof(struct sockaddr_storage));
+        in4->sin_family = AF_INET;
+        in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        in4->sin_port = htons(free_port());
+        transport->bindings = &aeron_udp_channel_transport_bindings_shm;
+        transport->dispatch_clientd = NULL;
+
+        return transport->bindings->init_func(transport, addr, addr, 0, 0, 0, 0, false, 0, false, false, NULL);
+    }
+
+    int send_to(aeron_udp_channel_transport_t *transport, struct sockaddr_storage *addr, const char *text)
+    {
+        struct iovec iov;
+        struct msghdr msghdr;
+
+        iov.iov_base = (void *)text;
+        iov.iov_len = strlen(text);
+        memset(&msghdr, 0, sizeof(msghdr));
+        msghdr.msg_name = addr;
+        msghdr.msg_namelen = sizeof(struct sockaddr_in);
+        msghdr.msg_iov = &iov;
+        msghdr.msg_iovlen = 1;
+
+        return transport->bindings->sendmsg_func(transport, &msghdr);
+    }
+
+    int poll(aeron_udp_channel_transport_t *transport)
+    {
+        struct mmsghdr mmsghdr[NUM_RECV_BUFFERS];
+        struct sockaddr_storage addrs[NUM_RECV_BUFFERS];
+        struct iovec iov[NUM_RECV_BUFFERS];
+
+        for (size_t i = 0; i < NUM_RECV_BUFFERS; i++)
+        {
+            iov[i].iov_base = m_buffers[i];
+            iov[i].iov_len = RECV_BUFFER_LENGTH;
+            memset(&mmsghdr[i], 0, sizeof(mmsghdr[i]));
+            mmsghdr[i].msg_hdr.msg_name = &addrs[i];
+            mmsghdr[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+            mmsghdr[i].msg_hdr.msg_iov = &iov[i];
+            mmsghdr[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        return transport->bindings->recvmmsg_func(
+            transport, mmsghdr, NUM_RECV_BUFFERS, UdpChannelTransportShmTest::on_recv, this);
+    }
+
+    std::vector<std::string> inbox_files()
+    {
+        std::vector<std::string> files;
+        DIR *dir = opendir(m_dir.c_str());
+
+        if (NULL != dir)
+        {
+            struct dirent *entry;
+            while (NULL != (entry = readdir(dir)))
+            {
+                if (strstr(entry->d_name, ".inbox") != NULL)
+                {
+                    files.emplace_back(entry->d_name);
+                }
+            }
+            closedir(dir);
+        }
+
+        return files;
+    }
+
+    int64_t inbox_bytes_written()
+    {
+        int64_t total = 0;
+
+        for (const std::string &file : inbox_files())
+        {
+            aeron_mapped_file_t mapped_file = { NULL, 0 };
+            aeron_mpsc_rb_t rb;
+
+            if (aeron_map_existing_file(&mapped_file, (m_dir + "/" + file).c_str()) == 0)
+            {
+                if (aeron_mpsc_rb_init(&rb, mapped_file.addr, mapped_file.length) == 0)
+                {
+                    total += aeron_mpsc_rb_producer_position(&rb);
+                }
+                aeron_unmap(&mapped_file);
+            }
+        }
+
+        return total;
+    }
+
+protected:
+    std::string m_dir;
+    std::vector<std::string> m_received;
+    std::vector<uint16_t> m_received_ports;
+    uint8_t m_buffers[NUM_RECV_BUFFERS][RECV_BUFFER_LENGTH];
+};
+
+TEST_F(UdpChannelTransportShmTest, shouldNameInboxWithinDirectory)
+{
+    char path[64];
+
+    ASSERT_EQ(aeron_udp_channel_transport_shm_inbox_path(path, sizeof(path), "/dev/shm/aeron", 0x1234abcdULL), 37);
+    EXPECT_STREQ(path, "/dev/shm/aeron/000000001234abcd.inbox");
+}
+
+TEST_F(UdpChannelTransportShmTest, shouldRejectInboxPathThatDoesNotFit)
+{
+    char path[16];
+
+    EXPECT_EQ(aeron_udp_channel_transport_shm_inbox_path(path, sizeof(path), "/dev/shm/aeron", 1), -1);
+}
+
+TEST_F(UdpChannelTransportShmTest, shouldRecogniseOnlyEncodedAdvertisement)
+{
+    aeron_udp_channel_transport_shm_advertisement_t advertisement;
+
+    aeron_udp_channel_transport_shm_advertisement_encode(&advertisement, 0x0102030405060708ULL);
+
+    EXPECT_EQ(advertisement.frame_header.frame_length, (int32_t)sizeof(advertisement));
+    EXPECT_EQ(advertisement.inbox_id, 0x0102030405060708ULL);
+    EXPECT_TRUE(aeron_udp_channel_transport_shm_is_advertisement((uint8_t *)&advertisement, sizeof(advertisement)));
+    EXPECT_FALSE(aeron_udp_channel_transport_shm_is_advertisement(
+        (uint8_t *)&advertisement, sizeof(advertisement) - 1));
+
+    advertisement.magic++;
+    EXPECT_FALSE(aeron_udp_channel_transport_shm_is_advertisement((uint8_t *)&advertisement, sizeof(advertisement)));
+}
+
+#if defined(__linux__)
+
+TEST_F(UdpChannelTransportShmTest, shouldSwitchToInboxOnceLocalPeersHaveAdvertised)
+{
+    aeron_udp_channel_transport_t a;
+    aeron_udp_channel_transport_t b;
+    struct sockaddr_storage a_addr;
+    struct sockaddr_storage b_addr;
+
+    ASSERT_EQ(bind_transport(&a, &a_addr), 0);
+    ASSERT_EQ(bind_transport(&b, &b_addr), 0);
+    EXPECT_EQ(inbox_files().size(), 2u);
+
+    ASSERT_EQ(send_to(&a, &b_addr, "over udp"), 8);
+    EXPECT_EQ(inbox_bytes_written(), 0);
+
+    for (int i = 0; i < 100 && m_received.empty(); i++)
+    {
+        ASSERT_GE(poll(&b), 0);
+    }
+    ASSERT_EQ(m_received.size(), 1u);
+
+    /* b advertised back to a on hearing from it, so a can now reach b through its inbox */
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_GE(poll(&a), 0);
+    }
+    EXPECT_EQ(m_received.size(), 1u);
+
+    ASSERT_EQ(send_to(&a, &b_addr, "over shm"), 8);
+    EXPECT_GT(inbox_bytes_written(), 0);
+
+    ASSERT_EQ(poll(&b), 1);
+    ASSERT_EQ(m_received.size(), 2u);
+    EXPECT_EQ(m_received[1], "over shm");
+    EXPECT_EQ(m_received_ports[1], ntohs(((struct sockaddr_in *)&a_addr)->sin_port));
+
+    a.bindings->close_func(&a);
+    b.bindings->close_func(&b);
+    EXPECT_EQ(inbox_files().size(), 0u);
+}
+
+#endif
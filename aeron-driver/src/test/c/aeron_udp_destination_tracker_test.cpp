@@ -0,0 +1,184 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+
+extern "C"
+{
+#include "media/aeron_udp_destination_tracker.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
+}
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define NUM_MESSAGES (3)
+
+static int64_t now_ns = 0;
+
+static int64_t test_nano_clock()
+{
+    return now_ns;
+}
+
+class UdpDestinationTrackerTest : public testing::Test
+{
+public:
+    UdpDestinationTrackerTest()
+    {
+        now_ns = 0;
+        aeron_udp_destination_tracker_init(
+            &m_tracker, test_nano_clock, AERON_UDP_DESTINATION_TRACKER_MANUAL_DESTINATION_TIMEOUT_NS);
+
+        m_bindings = aeron_udp_channel_transport_bindings_default;
+        m_bindings.sendmmsg_func = UdpDestinationTrackerTest::sendmmsg;
+        m_transport.fd = -1;
+        m_transport.dispatch_clientd = this;
+        m_transport.bindings = &m_bindings;
+
+        for (size_t i = 0; i < NUM_MESSAGES; i++)
+        {
+            m_iov[i].iov_base = m_buffer;
+            m_iov[i].iov_len = sizeof(m_buffer);
+            memset(&m_mmsghdr[i], 0, sizeof(struct mmsghdr));
+            m_mmsghdr[i].msg_hdr.msg_iov = &m_iov[i];
+            m_mmsghdr[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    virtual ~UdpDestinationTrackerTest()
+    {
+        aeron_udp_destination_tracker_close(&m_tracker);
+    }
+
+    static int sendmmsg(aeron_udp_channel_transport_t *transport, struct mmsghdr *msgvec, size_t vlen)
+    {
+        UdpDestinationTrackerTest *test = (UdpDestinationTrackerTest *)transport->dispatch_clientd;
+        int result = (int)vlen;
+
+        test->m_call_vlens.push_back(vlen);
+
+        if (!test->m_results.empty())
+        {
+            result = test->m_results.front();
+            test->m_results.erase(test->m_results.begin());
+        }
+
+        for (int i = 0; i < result; i++)
+        {
+            test->m_sent_ports.push_back(ntohs(((struct sockaddr_in *)msgvec[i].msg_hdr.msg_name)->sin_port));
+        }
+
+        return result;
+    }
+
+    void add_destinations(size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            struct sockaddr_storage addr;
+            struct sockaddr_in *in4 = (struct sockaddr_in *)&addr;
+
+            memset(&addr, 0, sizeof(addr));
+            in4->sin_family = AF_INET;
+            in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            in4->sin_port = htons((uint16_t)(40000 + i));
+
+            ASSERT_EQ(aeron_udp_destination_tracker_add_destination(&m_tracker, 0, now_ns, &addr), 0);
+        }
+    }
+
+protected:
+    aeron_udp_destination_tracker_t m_tracker;
+    aeron_udp_channel_transport_t m_transport;
+    aeron_udp_channel_transport_bindings_t m_bindings;
+    struct mmsghdr m_mmsghdr[NUM_MESSAGES];
+    struct iovec m_iov[NUM_MESSAGES];
+    uint8_t m_buffer[64];
+    std::vector<size_t> m_call_vlens;
+    std::vector<int> m_results;
+    std::vector<uint16_t> m_sent_ports;
+};
+
+TEST_F(UdpDestinationTrackerTest, shouldSendToAllDestinationsInSingleCall)
+{
+    add_destinations(4);
+
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmmsg(&m_tracker, &m_transport, m_mmsghdr, NUM_MESSAGES), NUM_MESSAGES);
+
+    ASSERT_EQ(m_call_vlens.size(), 1u);
+    EXPECT_EQ(m_call_vlens[0], 4u * NUM_MESSAGES);
+    ASSERT_EQ(m_sent_ports.size(), 4u * NUM_MESSAGES);
+
+    for (size_t i = 0; i < m_sent_ports.size(); i++)
+    {
+        EXPECT_EQ(m_sent_ports[i], 40000 + (i / NUM_MESSAGES));
+    }
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldBatchLargeFanOutIntoMaxVlenCalls)
+{
+    const size_t destinations = (AERON_UDP_DESTINATION_TRACKER_MAX_SENDMMSG_VLEN / NUM_MESSAGES) + 10;
+    add_destinations(destinations);
+
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmmsg(&m_tracker, &m_transport, m_mmsghdr, NUM_MESSAGES), NUM_MESSAGES);
+
+    ASSERT_EQ(m_call_vlens.size(), 2u);
+    EXPECT_EQ(m_call_vlens[0], (size_t)AERON_UDP_DESTINATION_TRACKER_MAX_SENDMMSG_VLEN);
+    EXPECT_EQ(m_call_vlens[0] + m_call_vlens[1], destinations * NUM_MESSAGES);
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldAccountShortSendPerDestinationAndContinueWithNext)
+{
+    add_destinations(3);
+    m_results.push_back(NUM_MESSAGES + 1);
+
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmmsg(&m_tracker, &m_transport, m_mmsghdr, NUM_MESSAGES), 1);
+
+    ASSERT_EQ(m_call_vlens.size(), 2u);
+    EXPECT_EQ(m_call_vlens[0], 3u * NUM_MESSAGES);
+    EXPECT_EQ(m_call_vlens[1], (size_t)NUM_MESSAGES);
+
+    EXPECT_EQ(m_tracker.destinations.array[0].short_sends, 0);
+    EXPECT_EQ(m_tracker.destinations.array[1].short_sends, 1);
+    EXPECT_EQ(m_tracker.destinations.array[2].short_sends, 0);
+    ASSERT_EQ(m_sent_ports.size(), (size_t)(NUM_MESSAGES + 1 + NUM_MESSAGES));
+    EXPECT_EQ(m_sent_ports.back(), 40002);
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldNotSendWithoutDestinations)
+{
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmmsg(&m_tracker, &m_transport, m_mmsghdr, NUM_MESSAGES), NUM_MESSAGES);
+    EXPECT_TRUE(m_call_vlens.empty());
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldNotTimeOutManualDestinations)
+{
+    add_destinations(2);
+    now_ns += AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS * 2;
+
+    EXPECT_EQ(aeron_udp_destination_tracker_sendmmsg(&m_tracker, &m_transport, m_mmsghdr, NUM_MESSAGES), NUM_MESSAGES);
+    EXPECT_EQ(m_tracker.destinations.length, 2u);
+    EXPECT_EQ(m_sent_ports.size(), 2u * NUM_MESSAGES);
+}
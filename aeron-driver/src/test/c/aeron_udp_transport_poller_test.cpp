@@ -0,0 +1,563 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <netinet/udp.h>
+
+extern "C"
+{
+#include "media/aeron_udp_transport_poller.h"
+#include "media/aeron_udp_channel_transport_bindings.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_error.h"
+}
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define NUM_TRANSPORTS (7)
+#define NUM_RECV_BUFFERS (2)
+#define RECV_BUFFER_LENGTH (2048)
+
+class UdpTransportPollerTest : public testing::TestWithParam<bool>
+{
+public:
+    UdpTransportPollerTest()
+    {
+        m_send_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    }
+
+    virtual ~UdpTransportPollerTest()
+    {
+        close(m_send_fd);
+    }
+
+    static void on_recv(
+        void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    {
+        UdpTransportPollerTest *test = (UdpTransportPollerTest *)clientd;
+
+        test->m_received.push_back((size_t)(uintptr_t)transport_clientd);
+        test->m_received_lengths.push_back(length);
+        test->m_received_timestamps.push_back(
+            NULL != test->m_dispatching_transport ? test->m_dispatching_transport->recv_timestamp_ns : 0);
+    }
+
+    int bind_transport(
+        aeron_udp_channel_transport_t *transport,
+        struct sockaddr_storage *addr,
+        bool use_gro = false,
+        bool use_rx_timestamping = false,
+        struct sockaddr_storage *connect_addr = NULL)
+    {
+        struct sockaddr_in *in4 = (struct sockaddr_in *)addr;
+        socklen_t len = sizeof(struct sockaddr_in);
+
+        memset(addr, 0, sizeof(struct sockaddr_storage));
+        in4->sin_family = AF_INET;
+        in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        in4->sin_port = 0;
+        transport->bindings = &aeron_udp_channel_transport_bindings_default;
+
+        if (aeron_udp_channel_transport_init(
+            transport, addr, addr, 0, 0, 0, 0, use_gro, 0, false, use_rx_timestamping, connect_addr) < 0)
+        {
+            return -1;
+        }
+
+        return getsockname(transport->fd, (struct sockaddr *)addr, &len);
+    }
+
+    void send_to(struct sockaddr_storage *addr, size_t length)
+    {
+        std::vector<uint8_t> buffer(length, 0);
+
+        ASSERT_EQ(
+            sendto(m_send_fd, buffer.data(), length, 0, (struct sockaddr *)addr, sizeof(struct sockaddr_in)),
+            (ssize_t)length);
+    }
+
+    void send_frame_to(struct sockaddr_storage *addr, int16_t type, int32_t session_id)
+    {
+        uint8_t buffer[AERON_DATA_HEADER_LENGTH];
+        aeron_frame_header_t *frame_header = (aeron_frame_header_t *)buffer;
+
+        memset(buffer, 0, sizeof(buffer));
+        frame_header->frame_length = sizeof(buffer);
+        frame_header->type = type;
+        if (AERON_HDR_TYPE_RTTM == type)
+        {
+            ((aeron_rttm_header_t *)buffer)->session_id = session_id;
+        }
+        else
+        {
+            ((aeron_data_header_t *)buffer)->session_id = session_id;
+        }
+
+        ASSERT_EQ(
+            sendto(m_send_fd, buffer, sizeof(buffer), 0, (struct sockaddr *)addr, sizeof(struct sockaddr_in)),
+            (ssize_t)sizeof(buffer));
+    }
+
+#if defined(UDP_SEGMENT)
+    void send_segmented_to(struct sockaddr_storage *addr, size_t length, uint16_t segment_length)
+    {
+        std::vector<uint8_t> buffer(length, 0);
+        aeron_udp_channel_transport_control_t control;
+        struct iovec iov;
+        struct msghdr msghdr;
+
+        iov.iov_base = buffer.data();
+        iov.iov_len = length;
+        memset(&msghdr, 0, sizeof(msghdr));
+        memset(&control, 0, sizeof(control));
+        msghdr.msg_name = addr;
+        msghdr.msg_namelen = sizeof(struct sockaddr_in);
+        msghdr.msg_iov = &iov;
+        msghdr.msg_iovlen = 1;
+        msghdr.msg_control = control.buffer;
+        msghdr.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+
+        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msghdr);
+        cmsg->cmsg_level = SOL_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        memcpy(CMSG_DATA(cmsg), &segment_length, sizeof(segment_length));
+
+        ASSERT_EQ(sendmsg(m_send_fd, &msghdr, 0), (ssize_t)length);
+    }
+#endif
+
+    int poll(aeron_udp_transport_poller_t *poller, int64_t *bytes_received)
+    {
+        struct mmsghdr mmsghdr[NUM_RECV_BUFFERS];
+        struct sockaddr_storage addrs[NUM_RECV_BUFFERS];
+        aeron_udp_channel_transport_control_t control[NUM_RECV_BUFFERS];
+
+        for (size_t i = 0; i < NUM_RECV_BUFFERS; i++)
+        {
+            m_iov[i].iov_base = m_buffers[i].data();
+            m_iov[i].iov_len = m_buffers[i].size();
+            mmsghdr[i].msg_hdr.msg_name = &addrs[i];
+            mmsghdr[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+            mmsghdr[i].msg_hdr.msg_iov = &m_iov[i];
+            mmsghdr[i].msg_hdr.msg_iovlen = 1;
+            mmsghdr[i].msg_hdr.msg_flags = 0;
+            mmsghdr[i].msg_hdr.msg_control = control[i].buffer;
+            mmsghdr[i].msg_hdr.msg_controllen = sizeof(control[i].buffer);
+            mmsghdr[i].msg_len = 0;
+        }
+
+        return aeron_udp_transport_poller_poll(
+            poller, mmsghdr, NUM_RECV_BUFFERS, bytes_received, UdpTransportPollerTest::on_recv, this);
+    }
+
+    int poll_until(aeron_udp_transport_poller_t *poller, size_t count, int64_t *total_bytes_received)
+    {
+        *total_bytes_received = 0;
+
+        for (int i = 0; i < 1000 && m_received.size() < count; i++)
+        {
+            int64_t bytes_received = 0;
+
+            if (poll(poller, &bytes_received) < 0)
+            {
+                return -1;
+            }
+
+            *total_bytes_received += bytes_received;
+        }
+
+        return 0;
+    }
+
+protected:
+    int m_send_fd;
+    std::array<std::array<uint8_t, RECV_BUFFER_LENGTH>, NUM_RECV_BUFFERS> m_buffers;
+    struct iovec m_iov[NUM_RECV_BUFFERS];
+    std::vector<size_t> m_received;
+    std::vector<size_t> m_received_lengths;
+    std::vector<int64_t> m_received_timestamps;
+    aeron_udp_channel_transport_t *m_dispatching_transport = NULL;
+};
+
+TEST_P(UdpTransportPollerTest, shouldReceiveFromAllTransportsAndCountBytes)
+{
+    aeron_udp_transport_poller_t poller;
+    aeron_udp_channel_transport_t transports[NUM_TRANSPORTS];
+    struct sockaddr_storage addrs[NUM_TRANSPORTS];
+
+    ASSERT_EQ(aeron_udp_transport_poller_init(&poller, GetParam(), RECV_BUFFER_LENGTH), 0) << aeron_errmsg();
+
+    for (size_t i = 0; i < NUM_TRANSPORTS; i++)
+    {
+        ASSERT_EQ(bind_transport(&transports[i], &addrs[i]), 0) << aeron_errmsg();
+        transports[i].dispatch_clientd = (void *)(uintptr_t)i;
+        ASSERT_EQ(aeron_udp_transport_poller_add(&poller, &transports[i]), 0) << aeron_errmsg();
+    }
+
+    for (size_t i = 0; i < NUM_TRANSPORTS; i++)
+    {
+        send_to(&addrs[i], 100 + i);
+    }
+
+    int64_t bytes_received = 0;
+    ASSERT_EQ(poll_until(&poller, NUM_TRANSPORTS, &bytes_received), 0) << aeron_errmsg();
+
+    int64_t expected_bytes = 0;
+    std::vector<bool> seen(NUM_TRANSPORTS, false);
+
+    ASSERT_EQ(m_received.size(), (size_t)NUM_TRANSPORTS);
+    for (size_t i = 0; i < m_received.size(); i++)
+    {
+        EXPECT_EQ(m_received_lengths[i], 100 + m_received[i]);
+        seen[m_received[i]] = true;
+        expected_bytes += m_received_lengths[i];
+    }
+
+    for (size_t i = 0; i < NUM_TRANSPORTS; i++)
+    {
+        EXPECT_TRUE(seen[i]);
+    }
+
+    EXPECT_EQ(bytes_received, expected_bytes);
+
+    for (size_t i = 0; i < NUM_TRANSPORTS; i++)
+    {
+        ASSERT_EQ(aeron_udp_transport_poller_remove(&poller, &transports[i]), 0) << aeron_errmsg();
+        aeron_udp_channel_transport_close(&transports[i]);
+    }
+
+    aeron_udp_transport_poller_close(&poller);
+}
+
+struct RecvBatch
+{
+    aeron_udp_channel_transport_t *transport;
+    size_t received_in_batch;
+    size_t received_at_batch_end;
+    size_t batch_ends;
+};
+
+static void on_recv_in_batch(
+    void *clientd, void *transport_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+{
+    auto *batch = (RecvBatch *)clientd;
+
+    batch->received_in_batch += batch->transport->in_recv_batch ? 1 : 0;
+}
+
+static void on_recv_batch_end(void *clientd, void *transport_clientd)
+{
+    auto *batch = (RecvBatch *)clientd;
+
+    batch->received_at_batch_end = batch->received_in_batch;
+    batch->batch_ends++;
+}
+
+TEST_P(UdpTransportPollerTest, shouldEndRecvBatchOnceAllMessagesOfVectorAreDispatched)
+{
+    aeron_udp_channel_transport_t transport;
+    struct sockaddr_storage addr;
+    struct mmsghdr mmsghdr[NUM_RECV_BUFFERS];
+    struct sockaddr_storage addrs[NUM_RECV_BUFFERS];
+    RecvBatch batch = { &transport, 0, 0, 0 };
+
+    ASSERT_EQ(bind_transport(&transport, &addr), 0) << aeron_errmsg();
+    transport.recv_batch_end_func = on_recv_batch_end;
+
+    for (size_t i = 0; i < NUM_RECV_BUFFERS; i++)
+    {
+        send_to(&addr, 64);
+        m_iov[i].iov_base = m_buffers[i].data();
+        m_iov[i].iov_len = m_buffers[i].size();
+        memset(&mmsghdr[i], 0, sizeof(mmsghdr[i]));
+        mmsghdr[i].msg_hdr.msg_name = &addrs[i];
+        mmsghdr[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+        mmsghdr[i].msg_hdr.msg_iov = &m_iov[i];
+        mmsghdr[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    size_t vectors_received = 0;
+    for (int i = 0; i < 1000 && batch.received_in_batch < NUM_RECV_BUFFERS; i++)
+    {
+        const int result = aeron_udp_channel_transport_recvmmsg(
+            &transport, mmsghdr, NUM_RECV_BUFFERS, on_recv_in_batch, &batch);
+        ASSERT_GE(result, 0) << aeron_errmsg();
+
+        vectors_received += result > 0 ? 1 : 0;
+        EXPECT_EQ(batch.received_at_batch_end, batch.received_in_batch);
+        EXPECT_FALSE(transport.in_recv_batch);
+    }
+
+    EXPECT_EQ(batch.received_in_batch, (size_t)NUM_RECV_BUFFERS);
+    EXPECT_EQ(batch.batch_ends, vectors_received);
+
+    aeron_udp_channel_transport_close(&transport);
+}
+
+TEST_P(UdpTransportPollerTest, shouldNotReceiveFromRemovedTransport)
+{
+    aeron_udp_transport_poller_t poller;
+    aeron_udp_channel_transport_t transports[2];
+    struct sockaddr_storage addrs[2];
+
+    ASSERT_EQ(aeron_udp_transport_poller_init(&poller, GetParam(), RECV_BUFFER_LENGTH), 0) << aeron_errmsg();
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        ASSERT_EQ(bind_transport(&transports[i], &addrs[i]), 0) << aeron_errmsg();
+        transports[i].dispatch_clientd = (void *)(uintptr_t)i;
+        ASSERT_EQ(aeron_udp_transport_poller_add(&poller, &transports[i]), 0) << aeron_errmsg();
+    }
+
+    ASSERT_EQ(aeron_udp_transport_poller_remove(&poller, &transports[0]), 0) << aeron_errmsg();
+
+    send_to(&addrs[0], 64);
+    send_to(&addrs[1], 32);
+
+    int64_t bytes_received = 0;
+    ASSERT_EQ(poll_until(&poller, 1, &bytes_received), 0) << aeron_errmsg();
+
+    for (int i = 0; i < 10; i++)
+    {
+        int64_t ignored;
+        ASSERT_GE(poll(&poller, &ignored), 0) << aeron_errmsg();
+    }
+
+    ASSERT_EQ(m_received.size(), 1u);
+    EXPECT_EQ(m_received[0], 1u);
+    EXPECT_EQ(bytes_received, 32);
+
+    ASSERT_EQ(aeron_udp_transport_poller_remove(&poller, &transports[1]), 0) << aeron_errmsg();
+    aeron_udp_channel_transport_close(&transports[0]);
+    aeron_udp_channel_transport_close(&transports[1]);
+    aeron_udp_transport_poller_close(&poller);
+}
+
+TEST_P(UdpTransportPollerTest, shouldSendWithoutAddressAndOnlyReceiveFromPeerWhenConnected)
+{
+    aeron_udp_transport_poller_t poller;
+    aeron_udp_channel_transport_t transports[2];
+    struct sockaddr_storage addrs[2];
+
+    ASSERT_EQ(aeron_udp_transport_poller_init(&poller, GetParam(), RECV_BUFFER_LENGTH), 0) << aeron_errmsg();
+    ASSERT_EQ(bind_transport(&transports[0], &addrs[0]), 0) << aeron_errmsg();
+    ASSERT_EQ(bind_transport(&transports[1], &addrs[1], false, false, &addrs[0]), 0) << aeron_errmsg();
+    EXPECT_FALSE(transports[0].is_connected);
+    EXPECT_TRUE(transports[1].is_connected);
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        transports[i].dispatch_clientd = (void *)(uintptr_t)i;
+        ASSERT_EQ(aeron_udp_transport_poller_add(&poller, &transports[i]), 0) << aeron_errmsg();
+    }
+
+    uint8_t buffer[48] = {};
+    struct iovec iov = { buffer, sizeof(buffer) };
+    struct msghdr msghdr;
+    memset(&msghdr, 0, sizeof(msghdr));
+    msghdr.msg_iov = &iov;
+    msghdr.msg_iovlen = 1;
+
+    ASSERT_EQ(aeron_udp_channel_transport_sendmsg(&transports[1], &msghdr), 48) << aeron_errmsg();
+
+    send_to(&addrs[1], 16);
+    msghdr.msg_name = &addrs[1];
+    msghdr.msg_namelen = sizeof(struct sockaddr_in);
+    iov.iov_len = 24;
+    ASSERT_EQ(aeron_udp_channel_transport_sendmsg(&transports[0], &msghdr), 24) << aeron_errmsg();
+
+    int64_t bytes_received = 0;
+    ASSERT_EQ(poll_until(&poller, 2, &bytes_received), 0) << aeron_errmsg();
+
+    for (int i = 0; i < 10; i++)
+    {
+        int64_t ignored;
+        ASSERT_GE(poll(&poller, &ignored), 0) << aeron_errmsg();
+    }
+
+    ASSERT_EQ(m_received.size(), 2u);
+    EXPECT_EQ(bytes_received, 48 + 24);
+
+    ASSERT_EQ(aeron_udp_transport_poller_remove(&poller, &transports[0]), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_udp_transport_poller_remove(&poller, &transports[1]), 0) << aeron_errmsg();
+    aeron_udp_channel_transport_close(&transports[0]);
+    aeron_udp_channel_transport_close(&transports[1]);
+    aeron_udp_transport_poller_close(&poller);
+}
+
+#if defined(UDP_GRO) && defined(UDP_SEGMENT)
+TEST_P(UdpTransportPollerTest, shouldSplitCoalescedDatagramsIntoSegments)
+{
+    aeron_udp_transport_poller_t poller;
+    aeron_udp_channel_transport_t transport;
+    struct sockaddr_storage addr;
+
+    ASSERT_EQ(aeron_udp_transport_poller_init(&poller, GetParam(), RECV_BUFFER_LENGTH), 0) << aeron_errmsg();
+    ASSERT_EQ(bind_transport(&transport, &addr, true), 0) << aeron_errmsg();
+    transport.dispatch_clientd = (void *)(uintptr_t)3;
+    ASSERT_EQ(aeron_udp_transport_poller_add(&poller, &transport), 0) << aeron_errmsg();
+
+    send_segmented_to(&addr, 3 * 256 + 64, 256);
+
+    int64_t bytes_received = 0;
+    ASSERT_EQ(poll_until(&poller, 4, &bytes_received), 0) << aeron_errmsg();
+
+    ASSERT_EQ(m_received.size(), 4u);
+    EXPECT_EQ(m_received_lengths[0], 256u);
+    EXPECT_EQ(m_received_lengths[1], 256u);
+    EXPECT_EQ(m_received_lengths[2], 256u);
+    EXPECT_EQ(m_received_lengths[3], 64u);
+    EXPECT_EQ(m_received[3], 3u);
+    EXPECT_EQ(bytes_received, 3 * 256 + 64);
+
+    ASSERT_EQ(aeron_udp_transport_poller_remove(&poller, &transport), 0) << aeron_errmsg();
+    aeron_udp_channel_transport_close(&transport);
+    aeron_udp_transport_poller_close(&poller);
+}
+#endif
+
+#if defined(SO_TIMESTAMPING)
+TEST_P(UdpTransportPollerTest, shouldProvideReceiveTimestampWhenTimestampingEnabled)
+{
+    aeron_udp_transport_poller_t poller;
+    aeron_udp_channel_transport_t transport;
+    struct sockaddr_storage addr;
+    struct timespec ts;
+
+    ASSERT_EQ(aeron_udp_transport_poller_init(&poller, GetParam(), RECV_BUFFER_LENGTH), 0) << aeron_errmsg();
+    ASSERT_EQ(bind_transport(&transport, &addr, false, true), 0) << aeron_errmsg();
+    transport.dispatch_clientd = (void *)(uintptr_t)5;
+    m_dispatching_transport = &transport;
+    ASSERT_EQ(aeron_udp_transport_poller_add(&poller, &transport), 0) << aeron_errmsg();
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    const int64_t before_ns = ((int64_t)ts.tv_sec * 1000 * 1000 * 1000) + ts.tv_nsec;
+    send_to(&addr, 128);
+
+    int64_t bytes_received = 0;
+    ASSERT_EQ(poll_until(&poller, 1, &bytes_received), 0) << aeron_errmsg();
+
+    ASSERT_EQ(m_received_timestamps.size(), 1u);
+    EXPECT_GE(m_received_timestamps[0], before_ns);
+
+    ASSERT_EQ(aeron_udp_transport_poller_remove(&poller, &transport), 0) << aeron_errmsg();
+    aeron_udp_channel_transport_close(&transport);
+    aeron_udp_transport_poller_close(&poller);
+}
+#endif
+
+#if defined(SO_RXQ_OVFL)
+TEST_P(UdpTransportPollerTest, shouldReportDatagramsDroppedForFullReceiveBuffer)
+{
+    aeron_udp_transport_poller_t poller;
+    aeron_udp_channel_transport_t transport;
+    struct sockaddr_storage addr;
+    int64_t bytes_received = 0;
+
+    ASSERT_EQ(aeron_udp_transport_poller_init(&poller, GetParam(), RECV_BUFFER_LENGTH), 0) << aeron_errmsg();
+    ASSERT_EQ(bind_transport(&transport, &addr), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_udp_channel_transport_set_so_rcvbuf(&transport, 4096), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_udp_channel_transport_set_drop_monitoring(&transport), 0) << aeron_errmsg();
+    transport.dispatch_clientd = (void *)(uintptr_t)1;
+    ASSERT_EQ(aeron_udp_transport_poller_add(&poller, &transport), 0) << aeron_errmsg();
+
+    for (int i = 0; i < 64; i++)
+    {
+        send_to(&addr, 1024);
+    }
+
+    ASSERT_EQ(poll_until(&poller, 64, &bytes_received), 0) << aeron_errmsg();
+    const size_t received = m_received.size();
+    EXPECT_LT(received, 64u);
+
+    /* the count is reported with each message received so it takes one queued after the drops to see them */
+    send_to(&addr, 1024);
+    ASSERT_EQ(poll_until(&poller, received + 1, &bytes_received), 0) << aeron_errmsg();
+
+    EXPECT_EQ(transport.socket_drops, 64u - received);
+
+    ASSERT_EQ(aeron_udp_transport_poller_remove(&poller, &transport), 0) << aeron_errmsg();
+    aeron_udp_channel_transport_close(&transport);
+    aeron_udp_transport_poller_close(&poller);
+}
+#endif
+
+#if defined(SO_ATTACH_REUSEPORT_CBPF)
+TEST_P(UdpTransportPollerTest, shouldSteerDatagramsToReusePortShardBySessionId)
+{
+    const size_t shards = 3;
+    aeron_udp_transport_poller_t poller;
+    aeron_udp_channel_transport_t transports[shards];
+    struct sockaddr_storage addr;
+    struct sockaddr_in *in4 = (struct sockaddr_in *)&addr;
+    socklen_t len = sizeof(struct sockaddr_in);
+    int64_t bytes_received = 0;
+
+    memset(&addr, 0, sizeof(addr));
+    in4->sin_family = AF_INET;
+    in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    ASSERT_EQ(aeron_udp_transport_poller_init(&poller, GetParam(), RECV_BUFFER_LENGTH), 0) << aeron_errmsg();
+    for (size_t i = 0; i < shards; i++)
+    {
+        transports[i].bindings = &aeron_udp_channel_transport_bindings_default;
+        ASSERT_EQ(aeron_udp_channel_transport_init_reuse_port(
+            &transports[i], &addr, &addr, 0, 0, 0, 0, false, 0, false, false), 0) << aeron_errmsg();
+        ASSERT_EQ(getsockname(transports[i].fd, (struct sockaddr *)&addr, &len), 0);
+        transports[i].dispatch_clientd = (void *)(uintptr_t)i;
+        ASSERT_EQ(aeron_udp_transport_poller_add(&poller, &transports[i]), 0) << aeron_errmsg();
+    }
+    ASSERT_EQ(aeron_udp_channel_transport_set_session_steering(&transports[0], shards), 0) << aeron_errmsg();
+
+    const int32_t session_ids[] = { 0, 1, 2, 7, -5, 1000001, INT32_MAX, INT32_MIN };
+    for (int32_t session_id : session_ids)
+    {
+        const size_t expected = aeron_udp_channel_transport_session_shard(session_id, shards);
+
+        send_frame_to(&addr, AERON_HDR_TYPE_DATA, session_id);
+        ASSERT_EQ(poll_until(&poller, m_received.size() + 1, &bytes_received), 0) << aeron_errmsg();
+        EXPECT_EQ(m_received.back(), expected) << "data session " << session_id;
+
+        send_frame_to(&addr, AERON_HDR_TYPE_RTTM, session_id);
+        ASSERT_EQ(poll_until(&poller, m_received.size() + 1, &bytes_received), 0) << aeron_errmsg();
+        EXPECT_EQ(m_received.back(), expected) << "rttm session " << session_id;
+    }
+
+    for (size_t i = 0; i < shards; i++)
+    {
+        ASSERT_EQ(aeron_udp_transport_poller_remove(&poller, &transports[i]), 0) << aeron_errmsg();
+        aeron_udp_channel_transport_close(&transports[i]);
+    }
+    aeron_udp_transport_poller_close(&poller);
+}
+#endif
+
+INSTANTIATE_TEST_CASE_P(
+    UdpTransportPollerTestWithIoMode,
+    UdpTransportPollerTest,
+    testing::Values(false, true));
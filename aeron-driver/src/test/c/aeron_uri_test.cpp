@@ -287,6 +287,274 @@ TEST_F(UriTest, shouldParseSubscriptionParamReliableDefault)
     EXPECT_EQ(params.reliable, true);
 }
 
+TEST_F(UriTest, shouldParseSubscriptionParamSpyBlocking)
+{
+    aeron_udp_channel_subscription_params_t params;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|spy-blocking=false", &m_uri), 0);
+    EXPECT_EQ(aeron_udp_channel_subscription_params(&m_uri, &params, m_context), 0);
+    EXPECT_EQ(params.is_blocking_spy, false);
+    EXPECT_EQ(params.reliable, true);
+}
+
+TEST_F(UriTest, shouldParseSenderAffinity)
+{
+    int32_t sender_affinity = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|sender-affinity=3", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_sender_affinity(&m_uri, &sender_affinity), 0);
+    EXPECT_EQ(sender_affinity, 3);
+}
+
+TEST_F(UriTest, shouldDefaultSenderAffinity)
+{
+    int32_t sender_affinity = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_sender_affinity(&m_uri, &sender_affinity), 0);
+    EXPECT_EQ(sender_affinity, -1);
+}
+
+TEST_F(UriTest, shouldNotParseInvalidSenderAffinity)
+{
+    int32_t sender_affinity = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|sender-affinity=first", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_sender_affinity(&m_uri, &sender_affinity), -1);
+}
+
+TEST_F(UriTest, shouldParseNumaNodeForUdpAndIpc)
+{
+    int32_t numa_node = -1;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|numa-node=1", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_numa_node(&m_uri, &numa_node), 0);
+    EXPECT_EQ(numa_node, 1);
+
+    aeron_uri_close(&m_uri);
+
+    EXPECT_EQ(aeron_uri_parse("aeron:ipc?numa-node=0", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_numa_node(&m_uri, &numa_node), 0);
+    EXPECT_EQ(numa_node, 0);
+}
+
+TEST_F(UriTest, shouldDefaultNumaNode)
+{
+    int32_t numa_node = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:ipc", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_numa_node(&m_uri, &numa_node), 0);
+    EXPECT_EQ(numa_node, -1);
+}
+
+TEST_F(UriTest, shouldNotParseInvalidNumaNode)
+{
+    int32_t numa_node = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|numa-node=-1", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_numa_node(&m_uri, &numa_node), -1);
+}
+
+TEST_F(UriTest, shouldParseSendSchedule)
+{
+    int32_t send_priority = 0;
+    int32_t send_weight = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|send-priority=3|send-weight=8", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_send_schedule(&m_uri, &send_priority, &send_weight), 0);
+    EXPECT_EQ(send_priority, 3);
+    EXPECT_EQ(send_weight, 8);
+}
+
+TEST_F(UriTest, shouldDefaultSendSchedule)
+{
+    int32_t send_priority = -1;
+    int32_t send_weight = -1;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_send_schedule(&m_uri, &send_priority, &send_weight), 0);
+    EXPECT_EQ(send_priority, 0);
+    EXPECT_EQ(send_weight, 1);
+}
+
+TEST_F(UriTest, shouldNotParseSendScheduleOutOfRange)
+{
+    int32_t send_priority = 0;
+    int32_t send_weight = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|send-priority=4", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_send_schedule(&m_uri, &send_priority, &send_weight), -1);
+
+    aeron_uri_close(&m_uri);
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|send-weight=0", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_send_schedule(&m_uri, &send_priority, &send_weight), -1);
+}
+
+TEST_F(UriTest, shouldParseBusyPoll)
+{
+    uint32_t busy_poll_us = 0;
+    bool prefer_busy_poll = false;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|busy-poll=50|prefer-busy-poll=true", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_busy_poll(&m_uri, &busy_poll_us, &prefer_busy_poll), 0);
+    EXPECT_EQ(busy_poll_us, 50u);
+    EXPECT_EQ(prefer_busy_poll, true);
+}
+
+TEST_F(UriTest, shouldKeepBusyPollDefaultsWhenNotSet)
+{
+    uint32_t busy_poll_us = 20;
+    bool prefer_busy_poll = true;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_busy_poll(&m_uri, &busy_poll_us, &prefer_busy_poll), 0);
+    EXPECT_EQ(busy_poll_us, 20u);
+    EXPECT_EQ(prefer_busy_poll, true);
+}
+
+TEST_F(UriTest, shouldNotParseInvalidBusyPoll)
+{
+    uint32_t busy_poll_us = 0;
+    bool prefer_busy_poll = false;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|busy-poll=-1", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_busy_poll(&m_uri, &busy_poll_us, &prefer_busy_poll), -1);
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|prefer-busy-poll=yes", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_busy_poll(&m_uri, &busy_poll_us, &prefer_busy_poll), -1);
+}
+
+TEST_F(UriTest, shouldParseGroupTag)
+{
+    bool has_group_tag = false;
+    int64_t group_tag = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|gtag=-12", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_group_tag(&m_uri, &has_group_tag, &group_tag), 0);
+    EXPECT_EQ(has_group_tag, true);
+    EXPECT_EQ(group_tag, -12);
+}
+
+TEST_F(UriTest, shouldNotParseInvalidGroupTag)
+{
+    bool has_group_tag = false;
+    int64_t group_tag = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|gtag=abc", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_group_tag(&m_uri, &has_group_tag, &group_tag), -1);
+    EXPECT_EQ(has_group_tag, false);
+}
+
+TEST_F(UriTest, shouldParseReceiveTimestamp)
+{
+    bool receive_timestamp = false;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|rcv-ts=true", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_receive_timestamp(&m_uri, &receive_timestamp), 0);
+    EXPECT_EQ(receive_timestamp, true);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|rcv-ts=yes", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_receive_timestamp(&m_uri, &receive_timestamp), -1);
+}
+
+TEST_F(UriTest, shouldParseChecksum)
+{
+    bool checksum = false;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|checksum=crc32c", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_checksum(&m_uri, &checksum), 0);
+    EXPECT_EQ(checksum, true);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|checksum=crc32", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_checksum(&m_uri, &checksum), -1);
+}
+
+TEST_F(UriTest, shouldParseCoalesce)
+{
+    int64_t coalesce_window_ns = -1;
+    size_t coalesce_batch_length = 1;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_coalesce(&m_uri, &coalesce_window_ns, &coalesce_batch_length), 0);
+    EXPECT_EQ(coalesce_window_ns, 0);
+    EXPECT_EQ(coalesce_batch_length, 0u);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|coalesce=5us|coalesce-batch=4096", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_coalesce(&m_uri, &coalesce_window_ns, &coalesce_batch_length), 0);
+    EXPECT_EQ(coalesce_window_ns, 5000);
+    EXPECT_EQ(coalesce_batch_length, 4096u);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|coalesce=2500", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_coalesce(&m_uri, &coalesce_window_ns, &coalesce_batch_length), 0);
+    EXPECT_EQ(coalesce_window_ns, 2500);
+}
+
+TEST_F(UriTest, shouldNotParseInvalidCoalesce)
+{
+    int64_t coalesce_window_ns = 0;
+    size_t coalesce_batch_length = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|coalesce=5s", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_coalesce(&m_uri, &coalesce_window_ns, &coalesce_batch_length), -1);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|coalesce=5000ms", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_coalesce(&m_uri, &coalesce_window_ns, &coalesce_batch_length), -1);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|coalesce-batch=0", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_coalesce(&m_uri, &coalesce_window_ns, &coalesce_batch_length), -1);
+}
+
+TEST_F(UriTest, shouldResolveMediaBindingsFromChannel)
+{
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|media-bindings=default", &m_uri), 0);
+    ASSERT_NE(aeron_uri_media_bindings(&m_uri), (const char *)NULL);
+    EXPECT_EQ(std::string(aeron_uri_media_bindings(&m_uri)), "default");
+    EXPECT_EQ(
+        aeron_udp_channel_transport_bindings_for_uri(&m_uri, m_context->udp_channel_transport_bindings),
+        &aeron_udp_channel_transport_bindings_default);
+}
+
+TEST_F(UriTest, shouldDefaultMediaBindingsWhenNotInChannel)
+{
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_media_bindings(&m_uri), (const char *)NULL);
+    EXPECT_EQ(
+        aeron_udp_channel_transport_bindings_for_uri(&m_uri, m_context->udp_channel_transport_bindings),
+        m_context->udp_channel_transport_bindings);
+}
+
+TEST_F(UriTest, shouldNotResolveUnknownMediaBindings)
+{
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=224.10.9.8|media-bindings=no_such_bindings", &m_uri), 0);
+    EXPECT_EQ(
+        aeron_udp_channel_transport_bindings_for_uri(&m_uri, m_context->udp_channel_transport_bindings),
+        (aeron_udp_channel_transport_bindings_t *)NULL);
+}
+
+TEST_F(UriTest, shouldParseReceiverShards)
+{
+    size_t receiver_shards = 0;
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_receiver_shards(&m_uri, &receiver_shards), 0);
+    EXPECT_EQ(receiver_shards, 1u);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|receiver-shards=4", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_receiver_shards(&m_uri, &receiver_shards), 0);
+    EXPECT_EQ(receiver_shards, 4u);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=localhost:40123|receiver-shards=0", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_receiver_shards(&m_uri, &receiver_shards), -1);
+}
+
 class UriResolverTest : public testing::Test
 {
 public:
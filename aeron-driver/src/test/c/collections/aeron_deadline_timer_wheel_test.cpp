@@ -0,0 +1,226 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "collections/aeron_deadline_timer_wheel.h"
+}
+
+#define TICK_RESOLUTION_NS (1024)
+#define TICKS_PER_WHEEL (256)
+
+class DeadlineTimerWheelTest : public testing::Test
+{
+public:
+    DeadlineTimerWheelTest()
+    {
+        if (aeron_deadline_timer_wheel_init(&m_wheel, 0, TICK_RESOLUTION_NS, TICKS_PER_WHEEL) < 0)
+        {
+            throw std::runtime_error("could not init timer wheel");
+        }
+    }
+
+    ~DeadlineTimerWheelTest()
+    {
+        aeron_deadline_timer_wheel_close(&m_wheel);
+    }
+
+protected:
+    static bool on_expiry(void *clientd, int64_t now_ns, int64_t timer_id, int64_t value)
+    {
+        DeadlineTimerWheelTest *t = (DeadlineTimerWheelTest *)clientd;
+
+        return t->m_on_expiry(now_ns, timer_id, value);
+    }
+
+    int poll(int64_t now_ns, const std::function<bool(int64_t,int64_t,int64_t)>& func, size_t limit = SIZE_MAX)
+    {
+        m_on_expiry = func;
+        return aeron_deadline_timer_wheel_poll(&m_wheel, now_ns, DeadlineTimerWheelTest::on_expiry, this, limit);
+    }
+
+    aeron_deadline_timer_wheel_t m_wheel;
+    std::function<bool(int64_t,int64_t,int64_t)> m_on_expiry;
+};
+
+TEST_F(DeadlineTimerWheelTest, shouldExpireTimerOnceDeadlineHasPassed)
+{
+    const int64_t timer_id = aeron_deadline_timer_wheel_schedule(&m_wheel, 5 * TICK_RESOLUTION_NS, 42);
+    std::vector<int64_t> expired;
+
+    ASSERT_NE(timer_id, AERON_DEADLINE_TIMER_WHEEL_NULL_TIMER_ID);
+    EXPECT_EQ(aeron_deadline_timer_wheel_timer_count(&m_wheel), 1u);
+
+    auto handler =
+        [&](int64_t now_ns, int64_t id, int64_t value)
+        {
+            EXPECT_EQ(id, timer_id);
+            expired.push_back(value);
+            return true;
+        };
+
+    EXPECT_EQ(poll(4 * TICK_RESOLUTION_NS, handler), 0);
+    EXPECT_TRUE(expired.empty());
+
+    EXPECT_EQ(poll(6 * TICK_RESOLUTION_NS, handler), 1);
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_EQ(expired[0], 42);
+    EXPECT_EQ(aeron_deadline_timer_wheel_timer_count(&m_wheel), 0u);
+}
+
+TEST_F(DeadlineTimerWheelTest, shouldNotExpireCancelledTimer)
+{
+    const int64_t timer_id = aeron_deadline_timer_wheel_schedule(&m_wheel, TICK_RESOLUTION_NS, 7);
+
+    EXPECT_TRUE(aeron_deadline_timer_wheel_cancel(&m_wheel, timer_id));
+    EXPECT_FALSE(aeron_deadline_timer_wheel_cancel(&m_wheel, timer_id));
+    EXPECT_EQ(aeron_deadline_timer_wheel_timer_count(&m_wheel), 0u);
+
+    auto handler = [](int64_t, int64_t, int64_t) { return true; };
+
+    EXPECT_EQ(poll(10 * TICK_RESOLUTION_NS, handler), 0);
+}
+
+TEST_F(DeadlineTimerWheelTest, shouldExpireTimerScheduledBeyondOneRevolution)
+{
+    const int64_t deadline_ns = (TICKS_PER_WHEEL + 3) * TICK_RESOLUTION_NS;
+    int64_t expired_at_ns = -1;
+
+    aeron_deadline_timer_wheel_schedule(&m_wheel, deadline_ns, 1);
+
+    for (int64_t now_ns = 0; now_ns <= 2 * deadline_ns && expired_at_ns < 0; now_ns += TICK_RESOLUTION_NS)
+    {
+        poll(
+            now_ns,
+            [&](int64_t now, int64_t, int64_t)
+            {
+                expired_at_ns = now;
+                return true;
+            });
+    }
+
+    EXPECT_GE(expired_at_ns, deadline_ns);
+    EXPECT_LT(expired_at_ns, deadline_ns + 2 * TICK_RESOLUTION_NS);
+}
+
+TEST_F(DeadlineTimerWheelTest, shouldCatchUpWhenPolledAfterLongGap)
+{
+    aeron_deadline_timer_wheel_schedule(&m_wheel, 3 * TICK_RESOLUTION_NS, 1);
+    aeron_deadline_timer_wheel_schedule(&m_wheel, 100 * TICK_RESOLUTION_NS, 2);
+    std::vector<int64_t> expired;
+
+    auto handler =
+        [&](int64_t, int64_t, int64_t value)
+        {
+            expired.push_back(value);
+            return true;
+        };
+
+    EXPECT_EQ(poll(200 * TICK_RESOLUTION_NS, handler), 2);
+    ASSERT_EQ(expired.size(), 2u);
+    EXPECT_EQ(expired[0], 1);
+    EXPECT_EQ(expired[1], 2);
+}
+
+TEST_F(DeadlineTimerWheelTest, shouldExpireTimersWhenPolledAfterManyRevolutions)
+{
+    aeron_deadline_timer_wheel_schedule(&m_wheel, 10 * TICK_RESOLUTION_NS, 1);
+    aeron_deadline_timer_wheel_schedule(&m_wheel, INT64_C(1) << 50, 2);
+    std::vector<int64_t> expired;
+
+    auto handler =
+        [&](int64_t, int64_t, int64_t value)
+        {
+            expired.push_back(value);
+            return true;
+        };
+
+    EXPECT_EQ(poll(INT64_C(1) << 40, handler), 1);
+    EXPECT_EQ(poll((INT64_C(1) << 50) + TICK_RESOLUTION_NS, handler), 1);
+    ASSERT_EQ(expired.size(), 2u);
+    EXPECT_EQ(expired[0], 1);
+    EXPECT_EQ(expired[1], 2);
+}
+
+TEST_F(DeadlineTimerWheelTest, shouldKeepTimerWhenHandlerDeclinesExpiry)
+{
+    aeron_deadline_timer_wheel_schedule(&m_wheel, TICK_RESOLUTION_NS, 9);
+    int calls = 0;
+
+    auto decline = [&](int64_t, int64_t, int64_t) { calls++; return false; };
+    auto accept = [&](int64_t, int64_t, int64_t) { calls++; return true; };
+
+    EXPECT_EQ(poll(2 * TICK_RESOLUTION_NS, decline), 0);
+    EXPECT_EQ(aeron_deadline_timer_wheel_timer_count(&m_wheel), 1u);
+
+    EXPECT_EQ(poll(2 * TICK_RESOLUTION_NS, accept), 1);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(aeron_deadline_timer_wheel_timer_count(&m_wheel), 0u);
+}
+
+TEST_F(DeadlineTimerWheelTest, shouldGrowSpokeAndKeepTimerIdsStable)
+{
+    const size_t num_timers = AERON_DEADLINE_TIMER_WHEEL_INITIAL_TICK_ALLOCATION * 3;
+    std::vector<int64_t> timer_ids;
+
+    for (size_t i = 0; i < num_timers; i++)
+    {
+        int64_t timer_id = aeron_deadline_timer_wheel_schedule(&m_wheel, 2 * TICK_RESOLUTION_NS, (int64_t)i);
+
+        ASSERT_NE(timer_id, AERON_DEADLINE_TIMER_WHEEL_NULL_TIMER_ID);
+        timer_ids.push_back(timer_id);
+    }
+
+    EXPECT_EQ(aeron_deadline_timer_wheel_timer_count(&m_wheel), num_timers);
+
+    for (size_t i = 0; i < num_timers; i++)
+    {
+        EXPECT_EQ(aeron_deadline_timer_wheel_deadline(&m_wheel, timer_ids[i]), 2 * TICK_RESOLUTION_NS);
+    }
+
+    EXPECT_TRUE(aeron_deadline_timer_wheel_cancel(&m_wheel, timer_ids[0]));
+
+    std::vector<int64_t> expired;
+    auto handler =
+        [&](int64_t, int64_t, int64_t value)
+        {
+            expired.push_back(value);
+            return true;
+        };
+
+    EXPECT_EQ(poll(3 * TICK_RESOLUTION_NS, handler), (int)num_timers - 1);
+    EXPECT_EQ(expired.size(), num_timers - 1);
+}
+
+TEST_F(DeadlineTimerWheelTest, shouldRespectExpiryLimit)
+{
+    for (int64_t i = 0; i < 5; i++)
+    {
+        aeron_deadline_timer_wheel_schedule(&m_wheel, TICK_RESOLUTION_NS, i);
+    }
+
+    auto handler = [](int64_t, int64_t, int64_t) { return true; };
+
+    EXPECT_EQ(poll(2 * TICK_RESOLUTION_NS, handler, 2), 2);
+    EXPECT_EQ(poll(2 * TICK_RESOLUTION_NS, handler, 2), 2);
+    EXPECT_EQ(poll(2 * TICK_RESOLUTION_NS, handler, 2), 1);
+    EXPECT_EQ(aeron_deadline_timer_wheel_timer_count(&m_wheel), 0u);
+}
@@ -15,6 +15,7 @@
  */
 
 #include <functional>
+#include <set>
 
 #include <gtest/gtest.h>
 
@@ -133,6 +134,38 @@ TEST_F(Int64ToPtrHashMapTest, shouldRemoveEntryAndCompactCollisionChain)
     EXPECT_EQ(aeron_int64_to_ptr_hash_map_remove(&m_map, 12), &value_12);
 }
 
+TEST_F(Int64ToPtrHashMapTest, shouldNotSignExtendLowHalfOfCompoundKey)
+{
+    ASSERT_EQ(aeron_int64_to_ptr_hash_map_init(&m_map, 8, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    EXPECT_EQ(aeron_int64_to_ptr_hash_map_compound_key(0, -1), INT64_C(0x00000000FFFFFFFF));
+    EXPECT_EQ(aeron_int64_to_ptr_hash_map_compound_key(-1, 0), (int64_t)UINT64_C(0xFFFFFFFF00000000));
+    EXPECT_NE(aeron_int64_to_ptr_hash_map_compound_key(5, -1), aeron_int64_to_ptr_hash_map_compound_key(-1, -1));
+    EXPECT_NE(aeron_int64_to_ptr_hash_map_compound_key(1, -1), aeron_int64_to_ptr_hash_map_compound_key(-1, 1));
+
+    int value_a = 1, value_b = 2;
+    EXPECT_EQ(aeron_int64_to_ptr_hash_map_put(&m_map, aeron_int64_to_ptr_hash_map_compound_key(5, -1), &value_a), 0);
+    EXPECT_EQ(aeron_int64_to_ptr_hash_map_put(&m_map, aeron_int64_to_ptr_hash_map_compound_key(-1, -1), &value_b), 0);
+    EXPECT_EQ(m_map.size, 2u);
+    EXPECT_EQ(aeron_int64_to_ptr_hash_map_get(&m_map, aeron_int64_to_ptr_hash_map_compound_key(5, -1)), &value_a);
+    EXPECT_EQ(aeron_int64_to_ptr_hash_map_get(&m_map, aeron_int64_to_ptr_hash_map_compound_key(-1, -1)), &value_b);
+}
+
+TEST_F(Int64ToPtrHashMapTest, shouldSpreadCompoundKeysSharingTheirLowHalf)
+{
+    ASSERT_EQ(aeron_int64_to_ptr_hash_map_init(&m_map, 8, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    const size_t mask = 63;
+    std::set<size_t> slots;
+
+    for (int32_t high = 0; high < 64; high++)
+    {
+        slots.insert(aeron_int64_to_ptr_hash_map_hash_key(aeron_int64_to_ptr_hash_map_compound_key(high, 0), mask));
+    }
+
+    EXPECT_GT(slots.size(), 32u);
+}
+
 TEST_F(Int64ToPtrHashMapTest, shouldNotForEachEmptyMap)
 {
     ASSERT_EQ(aeron_int64_to_ptr_hash_map_init(&m_map, 8, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR), 0);
@@ -0,0 +1,187 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "collections/aeron_int64_to_ptr_hash_map.h"
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
+}
+
+#define STREAM_ID (1001)
+
+/* (session_id, stream_id) keys as used by the data packet dispatcher */
+static std::vector<int64_t> session_keys(size_t count, uint64_t seed)
+{
+    std::mt19937 random(seed);
+    std::vector<int64_t> keys(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        keys[i] = aeron_int64_to_ptr_hash_map_compound_key((int32_t)random(), STREAM_ID);
+    }
+
+    return keys;
+}
+
+static void BM_HashMapGetHit(benchmark::State &state)
+{
+    const std::vector<int64_t> keys = session_keys((size_t)state.range(0), 1);
+    aeron_int64_to_ptr_hash_map_t map;
+    int value = 42;
+    size_t i = 0;
+
+    aeron_int64_to_ptr_hash_map_init(&map, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR);
+    for (int64_t key : keys)
+    {
+        aeron_int64_to_ptr_hash_map_put(&map, key, &value);
+    }
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(aeron_int64_to_ptr_hash_map_get(&map, keys[i]));
+        i = (i + 1) == keys.size() ? 0 : i + 1;
+    }
+
+    aeron_int64_to_ptr_hash_map_delete(&map);
+}
+
+static void BM_SwissMapGetHit(benchmark::State &state)
+{
+    const std::vector<int64_t> keys = session_keys((size_t)state.range(0), 1);
+    aeron_int64_to_ptr_swiss_map_t map;
+    int value = 42;
+    size_t i = 0;
+
+    aeron_int64_to_ptr_swiss_map_init(&map, 16, AERON_INT64_TO_PTR_SWISS_MAP_DEFAULT_LOAD_FACTOR);
+    for (int64_t key : keys)
+    {
+        aeron_int64_to_ptr_swiss_map_put(&map, key, &value);
+    }
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(aeron_int64_to_ptr_swiss_map_get(&map, keys[i]));
+        i = (i + 1) == keys.size() ? 0 : i + 1;
+    }
+
+    aeron_int64_to_ptr_swiss_map_delete(&map);
+}
+
+static void BM_HashMapGetMiss(benchmark::State &state)
+{
+    const std::vector<int64_t> keys = session_keys((size_t)state.range(0), 1);
+    const std::vector<int64_t> misses = session_keys((size_t)state.range(0), 2);
+    aeron_int64_to_ptr_hash_map_t map;
+    int value = 42;
+    size_t i = 0;
+
+    aeron_int64_to_ptr_hash_map_init(&map, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR);
+    for (int64_t key : keys)
+    {
+        aeron_int64_to_ptr_hash_map_put(&map, key, &value);
+    }
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(aeron_int64_to_ptr_hash_map_get(&map, misses[i]));
+        i = (i + 1) == misses.size() ? 0 : i + 1;
+    }
+
+    aeron_int64_to_ptr_hash_map_delete(&map);
+}
+
+static void BM_SwissMapGetMiss(benchmark::State &state)
+{
+    const std::vector<int64_t> keys = session_keys((size_t)state.range(0), 1);
+    const std::vector<int64_t> misses = session_keys((size_t)state.range(0), 2);
+    aeron_int64_to_ptr_swiss_map_t map;
+    int value = 42;
+    size_t i = 0;
+
+    aeron_int64_to_ptr_swiss_map_init(&map, 16, AERON_INT64_TO_PTR_SWISS_MAP_DEFAULT_LOAD_FACTOR);
+    for (int64_t key : keys)
+    {
+        aeron_int64_to_ptr_swiss_map_put(&map, key, &value);
+    }
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(aeron_int64_to_ptr_swiss_map_get(&map, misses[i]));
+        i = (i + 1) == misses.size() ? 0 : i + 1;
+    }
+
+    aeron_int64_to_ptr_swiss_map_delete(&map);
+}
+
+static void BM_HashMapPutRemove(benchmark::State &state)
+{
+    const std::vector<int64_t> keys = session_keys((size_t)state.range(0), 1);
+    aeron_int64_to_ptr_hash_map_t map;
+    int value = 42;
+    size_t i = 0;
+
+    aeron_int64_to_ptr_hash_map_init(&map, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR);
+    for (int64_t key : keys)
+    {
+        aeron_int64_to_ptr_hash_map_put(&map, key, &value);
+    }
+
+    while (state.KeepRunning())
+    {
+        aeron_int64_to_ptr_hash_map_remove(&map, keys[i]);
+        aeron_int64_to_ptr_hash_map_put(&map, keys[i], &value);
+        i = (i + 1) == keys.size() ? 0 : i + 1;
+    }
+
+    aeron_int64_to_ptr_hash_map_delete(&map);
+}
+
+static void BM_SwissMapPutRemove(benchmark::State &state)
+{
+    const std::vector<int64_t> keys = session_keys((size_t)state.range(0), 1);
+    aeron_int64_to_ptr_swiss_map_t map;
+    int value = 42;
+    size_t i = 0;
+
+    aeron_int64_to_ptr_swiss_map_init(&map, 16, AERON_INT64_TO_PTR_SWISS_MAP_DEFAULT_LOAD_FACTOR);
+    for (int64_t key : keys)
+    {
+        aeron_int64_to_ptr_swiss_map_put(&map, key, &value);
+    }
+
+    while (state.KeepRunning())
+    {
+        aeron_int64_to_ptr_swiss_map_remove(&map, keys[i]);
+        aeron_int64_to_ptr_swiss_map_put(&map, keys[i], &value);
+        i = (i + 1) == keys.size() ? 0 : i + 1;
+    }
+
+    aeron_int64_to_ptr_swiss_map_delete(&map);
+}
+
+BENCHMARK(BM_HashMapGetHit)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_SwissMapGetHit)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_HashMapGetMiss)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_SwissMapGetMiss)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_HashMapPutRemove)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_SwissMapPutRemove)->Arg(16)->Arg(256)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,202 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+#include <map>
+#include <random>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
+}
+
+class Int64ToPtrSwissMapTest : public testing::Test
+{
+public:
+    ~Int64ToPtrSwissMapTest()
+    {
+        aeron_int64_to_ptr_swiss_map_delete(&m_map);
+    }
+
+protected:
+    static void for_each(void *clientd, int64_t key, void *value)
+    {
+        Int64ToPtrSwissMapTest *t = (Int64ToPtrSwissMapTest *)clientd;
+
+        t->m_for_each(key, value);
+    }
+
+    void for_each(const std::function<void(int64_t,void*)>& func)
+    {
+        m_for_each = func;
+        aeron_int64_to_ptr_swiss_map_for_each(&m_map, Int64ToPtrSwissMapTest::for_each, this);
+    }
+
+    aeron_int64_to_ptr_swiss_map_t m_map;
+    std::function<void(int64_t,void*)> m_for_each;
+};
+
+TEST_F(Int64ToPtrSwissMapTest, shouldDoPutAndThenGetOnEmptyMap)
+{
+    int value = 42;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_INT64_TO_PTR_SWISS_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    EXPECT_EQ(m_map.capacity, (size_t)AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 7, (void *)&value), 0);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, 7), &value);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, 8), (void *)NULL);
+    EXPECT_EQ(m_map.size, 1u);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldReplaceExistingValueForTheSameKey)
+{
+    int value = 42, new_value = 43;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_INT64_TO_PTR_SWISS_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 7, (void *)&value), 0);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 7, (void *)&new_value), 0);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, 7), &new_value);
+    EXPECT_EQ(m_map.size, 1u);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldGrowWhenThresholdReached)
+{
+    int value = 42, value_at_16 = 43;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 32, 0.5f), 0);
+
+    for (size_t i = 0; i < 16; i++)
+    {
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, i, (void *)&value), 0);
+    }
+
+    EXPECT_EQ(m_map.resize_threshold, 16u);
+    EXPECT_EQ(m_map.capacity, 32u);
+    EXPECT_EQ(m_map.size, 16u);
+
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 16, (void *)&value_at_16), 0);
+
+    EXPECT_EQ(m_map.resize_threshold, 32u);
+    EXPECT_EQ(m_map.capacity, 64u);
+    EXPECT_EQ(m_map.size, 17u);
+
+    for (int64_t i = 0; i < 16; i++)
+    {
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, i), &value);
+    }
+
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, 16), &value_at_16);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldFindCompoundKeysSharingLowHalf)
+{
+    int values[64];
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 16, AERON_INT64_TO_PTR_SWISS_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    for (int32_t i = 0; i < 64; i++)
+    {
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, ((int64_t)i << 32) | 10, &values[i]), 0);
+    }
+
+    for (int32_t i = 0; i < 64; i++)
+    {
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, ((int64_t)i << 32) | 10), &values[i]);
+    }
+
+    EXPECT_EQ(m_map.size, 64u);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldRemoveEntry)
+{
+    int value = 42;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, 0.5f), 0);
+
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 7, (void *)&value), 0);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_remove(&m_map, 7), &value);
+    EXPECT_EQ(m_map.size, 0u);
+    EXPECT_EQ(m_map.tombstones, 0u);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, 7), (void *)NULL);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_remove(&m_map, 7), (void *)NULL);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldMatchReferenceUnderRandomChurn)
+{
+    int value = 42;
+    std::map<int64_t, void *> reference;
+    std::mt19937_64 random(7);
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 16, AERON_INT64_TO_PTR_SWISS_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    for (int i = 0; i < 100000; i++)
+    {
+        const int64_t key = (int64_t)(random() % 512);
+        void *ptr = (void *)(&value + (key % 4));
+
+        if (random() % 3 == 0)
+        {
+            auto it = reference.find(key);
+            void *expected = it == reference.end() ? NULL : it->second;
+
+            ASSERT_EQ(aeron_int64_to_ptr_swiss_map_remove(&m_map, key), expected);
+            reference.erase(key);
+        }
+        else
+        {
+            ASSERT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, key, ptr), 0);
+            reference[key] = ptr;
+        }
+
+        ASSERT_EQ(m_map.size, reference.size());
+        ASSERT_LT(m_map.size + m_map.tombstones, m_map.capacity);
+    }
+
+    for (int64_t key = 0; key < 512; key++)
+    {
+        auto it = reference.find(key);
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, key), it == reference.end() ? NULL : it->second);
+    }
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldNotForEachEmptyMap)
+{
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_INT64_TO_PTR_SWISS_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    size_t called = 0;
+    for_each([&](int64_t key, void *value_ptr)
+         {
+             called++;
+         });
+
+    ASSERT_EQ(called, 0u);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldForEachNonEmptyMap)
+{
+    int value = 42;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_INT64_TO_PTR_SWISS_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 7, (void *)&value), 0);
+
+    size_t called = 0;
+    for_each([&](int64_t key, void *value_ptr)
+         {
+             EXPECT_EQ(key, 7);
+             EXPECT_EQ(value_ptr, &value);
+             called++;
+         });
+
+    ASSERT_EQ(called, 1u);
+}
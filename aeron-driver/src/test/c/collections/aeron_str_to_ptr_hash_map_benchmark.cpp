@@ -0,0 +1,109 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "collections/aeron_str_to_ptr_hash_map.h"
+}
+
+/* channel URIs as used to look up send and receive channel endpoints */
+static std::vector<std::string> channel_keys(size_t count, int port_base)
+{
+    std::vector<std::string> keys(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        keys[i] = "aeron:udp?endpoint=192.168.0.1:" + std::to_string(port_base + (int)i);
+    }
+
+    return keys;
+}
+
+static void map_init(aeron_str_to_ptr_hash_map_t *map, const std::vector<std::string> &keys, void *value)
+{
+    aeron_str_to_ptr_hash_map_init(map, 16, AERON_STR_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR);
+    for (const std::string &key : keys)
+    {
+        aeron_str_to_ptr_hash_map_put(map, key.c_str(), key.length(), value);
+    }
+}
+
+static void BM_StrHashMapGetHit(benchmark::State &state)
+{
+    const std::vector<std::string> keys = channel_keys((size_t)state.range(0), 10000);
+    aeron_str_to_ptr_hash_map_t map;
+    int value = 42;
+    size_t i = 0;
+
+    map_init(&map, keys, &value);
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(aeron_str_to_ptr_hash_map_get(&map, keys[i].c_str(), keys[i].length()));
+        i = (i + 1) == keys.size() ? 0 : i + 1;
+    }
+
+    aeron_str_to_ptr_hash_map_delete(&map);
+}
+
+static void BM_StrHashMapGetMiss(benchmark::State &state)
+{
+    const std::vector<std::string> keys = channel_keys((size_t)state.range(0), 10000);
+    const std::vector<std::string> misses = channel_keys((size_t)state.range(0), 30000);
+    aeron_str_to_ptr_hash_map_t map;
+    int value = 42;
+    size_t i = 0;
+
+    map_init(&map, keys, &value);
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(aeron_str_to_ptr_hash_map_get(&map, misses[i].c_str(), misses[i].length()));
+        i = (i + 1) == misses.size() ? 0 : i + 1;
+    }
+
+    aeron_str_to_ptr_hash_map_delete(&map);
+}
+
+static void BM_StrHashMapPutRemove(benchmark::State &state)
+{
+    const std::vector<std::string> keys = channel_keys((size_t)state.range(0), 10000);
+    aeron_str_to_ptr_hash_map_t map;
+    int value = 42;
+    size_t i = 0;
+
+    map_init(&map, keys, &value);
+
+    while (state.KeepRunning())
+    {
+        aeron_str_to_ptr_hash_map_remove(&map, keys[i].c_str(), keys[i].length());
+        aeron_str_to_ptr_hash_map_put(&map, keys[i].c_str(), keys[i].length(), &value);
+        i = (i + 1) == keys.size() ? 0 : i + 1;
+    }
+
+    aeron_str_to_ptr_hash_map_delete(&map);
+}
+
+BENCHMARK(BM_StrHashMapGetHit)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_StrHashMapGetMiss)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_StrHashMapPutRemove)->Arg(16)->Arg(256)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -16,6 +16,7 @@
 
 #include <util/MemoryMappedFile.h>
 #include <concurrent/CountersReader.h>
+#include <concurrent/CountersSnapshot.h>
 #include <util/CommandOptionParser.h>
 
 #include <iostream>
@@ -24,6 +25,10 @@
 #include <signal.h>
 #include <Context.h>
 #include <cstdio>
+#include <vector>
+#include <ctime>
+#include <regex>
+#include <algorithm>
 
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
@@ -41,16 +46,109 @@ void sigIntHandler (int param)
     running = false;
 }
 
+/* driver agent duty cycle timestamps, in the driver nano clock, are shown as how long ago the latest cycle began */
+static const std::int32_t DUTY_CYCLE_TIMESTAMP_TYPE_ID = 17;
+
+static std::int64_t driverNanoClock()
+{
+    struct timespec ts;
+#if defined(CLOCK_MONOTONIC_RAW)
+    ::clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+#else
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return static_cast<std::int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
 static const char optHelp   = 'h';
 static const char optPath   = 'p';
 static const char optPeriod = 'u';
+static const char optRates  = 'r';
+static const char optFormat = 'f';
+static const char optTypes  = 't';
+static const char optLabel  = 'l';
+
+enum class OutputFormat
+{
+    TEXT,
+    JSON,
+    PROMETHEUS
+};
 
 struct Settings
 {
     std::string basePath = Context::defaultAeronPath();
     int updateIntervalms = 1000;
+    bool showRates = false;
+    OutputFormat format = OutputFormat::TEXT;
+    std::vector<std::int32_t> typeIds;
+    bool hasLabelPattern = false;
+    std::regex labelPattern;
 };
 
+static OutputFormat parseFormat(const std::string& name)
+{
+    if (name == "text")
+    {
+        return OutputFormat::TEXT;
+    }
+    else if (name == "json")
+    {
+        return OutputFormat::JSON;
+    }
+    else if (name == "prometheus")
+    {
+        return OutputFormat::PROMETHEUS;
+    }
+
+    throw CommandOptionException(std::string("unknown output format: ") + name, SOURCEINFO);
+}
+
+static bool isSelected(const Settings& settings, std::int32_t typeId, const std::string& label)
+{
+    if (!settings.typeIds.empty() &&
+        std::find(settings.typeIds.begin(), settings.typeIds.end(), typeId) == settings.typeIds.end())
+    {
+        return false;
+    }
+
+    return !settings.hasLabelPattern || std::regex_search(label, settings.labelPattern);
+}
+
+static void appendEscaped(std::string& out, const std::string& label, bool json)
+{
+    for (const char c : label)
+    {
+        switch (c)
+        {
+            case '"':
+                out += "\\\"";
+                break;
+
+            case '\\':
+                out += "\\\\";
+                break;
+
+            case '\n':
+                out += "\\n";
+                break;
+
+            default:
+                if (json && static_cast<unsigned char>(c) < 0x20)
+                {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+                    out += escaped;
+                }
+                else
+                {
+                    out += c;
+                }
+                break;
+        }
+    }
+}
+
 Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
 {
     cp.parse(argc, argv);
@@ -64,6 +162,27 @@ Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
 
     s.basePath = cp.getOption(optPath).getParam(0, s.basePath);
     s.updateIntervalms = cp.getOption(optPeriod).getParamAsInt(0, 1, 1000000, s.updateIntervalms);
+    s.showRates = cp.getOption(optRates).isPresent();
+    s.format = parseFormat(cp.getOption(optFormat).getParam(0, "text"));
+
+    const CommandOption& types = cp.getOption(optTypes);
+    for (std::size_t i = 0; i < types.getNumParams(); i++)
+    {
+        s.typeIds.push_back(types.getParamAsInt(i, 0, INT32_MAX, 0));
+    }
+
+    if (cp.getOption(optLabel).isPresent())
+    {
+        try
+        {
+            s.labelPattern = std::regex(cp.getOption(optLabel).getParam(0), std::regex::extended);
+            s.hasLabelPattern = true;
+        }
+        catch (const std::regex_error& e)
+        {
+            throw CommandOptionException(std::string("invalid label pattern: ") + e.what(), SOURCEINFO);
+        }
+    }
 
     return s;
 }
@@ -74,6 +193,10 @@ int main (int argc, char** argv)
     cp.addOption(CommandOption (optHelp,   0, 0, "                Displays help information."));
     cp.addOption(CommandOption (optPath,   1, 1, "basePath        Base Path to shared memory. Default: " + Context::defaultAeronPath()));
     cp.addOption(CommandOption (optPeriod, 1, 1, "update period   Update period in millseconds. Default: 1000ms"));
+    cp.addOption(CommandOption (optRates,  0, 0, "                Show the change per second of each counter."));
+    cp.addOption(CommandOption (optFormat, 1, 1, "format          text, or stream json lines or prometheus text with rates. Default: text"));
+    cp.addOption(CommandOption (optTypes,  1, 64, "typeId...       Only show counters of these type ids."));
+    cp.addOption(CommandOption (optLabel,  1, 1, "regex           Only show counters with a label matching this extended regex."));
 
     signal (SIGINT, sigIntHandler);
 
@@ -100,32 +223,191 @@ int main (int argc, char** argv)
 
         CountersReader counters(metadataBuffer, valuesBuffer);
 
+        const std::int32_t capacity = counters.maxCounterId();
+        std::vector<std::uint8_t> snapshotBuffers[2] =
+        {
+            std::vector<std::uint8_t>(static_cast<std::size_t>(CountersSnapshot::bufferLength(capacity, true))),
+            std::vector<std::uint8_t>(static_cast<std::size_t>(CountersSnapshot::bufferLength(capacity, true)))
+        };
+        CountersSnapshot snapshots[2] =
+        {
+            CountersSnapshot(snapshotBuffers[0].data(), static_cast<index_t>(snapshotBuffers[0].size()), capacity, true),
+            CountersSnapshot(snapshotBuffers[1].data(), static_cast<index_t>(snapshotBuffers[1].size()), capacity, true)
+        };
+        int current = 0;
+
+        const bool streaming = OutputFormat::TEXT != settings.format;
+        const milliseconds updateInterval(settings.updateIntervalms);
+        std::vector<std::int32_t> selected;
+        std::vector<std::int64_t> values;
+        std::string line;
+        steady_clock::time_point deadline = steady_clock::now();
+
+        if (streaming)
+        {
+            /* prime the previous snapshot so the first sample streamed carries real rates */
+            snapshots[current].take(counters, duration_cast<nanoseconds>(deadline.time_since_epoch()).count());
+            current ^= 1;
+            deadline += updateInterval;
+            std::this_thread::sleep_until(deadline);
+        }
+
         while(running)
         {
-            time_t rawtime;
-            char currentTime[80];
+            CountersSnapshot& snapshot = snapshots[current];
+            const std::int64_t nowNs =
+                duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+
+            snapshot.take(counters, nowNs);
+            snapshot.computeRates(snapshots[current ^ 1]);
+            const std::int64_t driverNowNs = driverNanoClock();
+
+            selected.clear();
+            values.clear();
+            for (std::int32_t i = 0, length = snapshot.length(); i < length; i++)
+            {
+                if (isSelected(settings, snapshot.typeId(i), snapshot.label(i)))
+                {
+                    std::int64_t value = snapshot.value(i);
+                    if (DUTY_CYCLE_TIMESTAMP_TYPE_ID == snapshot.typeId(i) && 0 != value)
+                    {
+                        value = driverNowNs - value;
+                    }
+
+                    selected.push_back(i);
+                    values.push_back(value);
+                }
+            }
+
+            if (streaming)
+            {
+                const std::int64_t timestampMs =
+                    duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+                char field[128];
+
+                line.clear();
+                if (OutputFormat::JSON == settings.format)
+                {
+                    std::snprintf(
+                        field, sizeof(field), "{\"timestamp_ms\":%" PRId64 ",\"pid\":%" PRId64 ",\"counters\":[",
+                        timestampMs, pid);
+                    line += field;
 
-            ::time(&rawtime);
-            ::strftime(currentTime, sizeof(currentTime) - 1, "%H:%M:%S", localtime(&rawtime));
+                    for (std::size_t j = 0; j < selected.size(); j++)
+                    {
+                        const std::int32_t i = selected[j];
+                        std::snprintf(
+                            field, sizeof(field),
+                            "%s{\"id\":%" PRId32 ",\"type_id\":%" PRId32 ",\"value\":%" PRId64
+                            ",\"rate\":%.3f,\"label\":\"",
+                            0 == j ? "" : ",", snapshot.counterId(i), snapshot.typeId(i), values[j], snapshot.rate(i));
+                        line += field;
+                        appendEscaped(line, snapshot.label(i), true);
+                        line += "\"}";
+                    }
 
-            std::printf("\033[H\033[2J");
+                    line += "]}\n";
+                }
+                else
+                {
+                    /* each metric family is written as one group, and each sample ends with a blank line */
+                    for (int rates = 0; rates < 2; rates++)
+                    {
+                        line += rates ? "# TYPE aeron_counter_rate gauge\n" : "# TYPE aeron_counter_value gauge\n";
 
-            std::printf(
-                "%s - Aeron Stat (CnC v%" PRId32 "), pid %" PRId64 ", client liveness %s ns\n",
-                currentTime, cncVersion, pid, toStringWithCommas(clientLivenessTimeoutNs).c_str());
-            std::printf("===========================\n");
+                        for (std::size_t j = 0; j < selected.size(); j++)
+                        {
+                            const std::int32_t i = selected[j];
+                            std::snprintf(
+                                field, sizeof(field),
+                                "%s{pid=\"%" PRId64 "\",id=\"%" PRId32 "\",type_id=\"%" PRId32 "\",label=\"",
+                                rates ? "aeron_counter_rate" : "aeron_counter_value", pid, snapshot.counterId(i),
+                                snapshot.typeId(i));
+                            line += field;
+                            appendEscaped(line, snapshot.label(i), false);
 
-            counters.forEach([&](std::int32_t counterId, std::int32_t, const AtomicBuffer&, const std::string& l)
+                            if (rates)
+                            {
+                                std::snprintf(
+                                    field, sizeof(field), "\"} %.3f %" PRId64 "\n", snapshot.rate(i), timestampMs);
+                            }
+                            else
+                            {
+                                std::snprintf(
+                                    field, sizeof(field), "\"} %" PRId64 " %" PRId64 "\n", values[j], timestampMs);
+                            }
+                            line += field;
+                        }
+                    }
+
+                    line += "\n";
+                }
+
+                std::fwrite(line.data(), 1, line.size(), stdout);
+                std::fflush(stdout);
+            }
+            else
             {
-                std::int64_t value = counters.getCounterValue(counterId);
+                time_t rawtime;
+                char currentTime[80];
+
+                ::time(&rawtime);
+                ::strftime(currentTime, sizeof(currentTime) - 1, "%H:%M:%S", localtime(&rawtime));
+
+                std::printf("\033[H\033[2J");
 
-                std::printf("%3d: %20s - %s\n", counterId, toStringWithCommas(value).c_str(), l.c_str());
-            });
+                std::printf(
+                    "%s - Aeron Stat (CnC v%" PRId32 "), pid %" PRId64 ", client liveness %s ns\n",
+                    currentTime, cncVersion, pid, toStringWithCommas(clientLivenessTimeoutNs).c_str());
+                std::printf("===========================\n");
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(settings.updateIntervalms));
+                for (std::size_t j = 0; j < selected.size(); j++)
+                {
+                    const std::int32_t i = selected[j];
+                    std::string label = snapshot.label(i);
+
+                    if (DUTY_CYCLE_TIMESTAMP_TYPE_ID == snapshot.typeId(i) && 0 != snapshot.value(i))
+                    {
+                        label += " (age in ns)";
+                    }
+
+                    if (settings.showRates)
+                    {
+                        std::printf(
+                            "%3d: %20s %16s/s - %s\n",
+                            snapshot.counterId(i),
+                            toStringWithCommas(values[j]).c_str(),
+                            toStringWithCommas(static_cast<std::int64_t>(snapshot.rate(i))).c_str(),
+                            label.c_str());
+                    }
+                    else
+                    {
+                        std::printf(
+                            "%3d: %20s - %s\n",
+                            snapshot.counterId(i),
+                            toStringWithCommas(values[j]).c_str(),
+                            label.c_str());
+                    }
+                }
+            }
+
+            current ^= 1;
+
+            /* keep to the interval rather than drifting by the time taken to sample, unless we fell well behind */
+            deadline += updateInterval;
+            const steady_clock::time_point now = steady_clock::now();
+            if (deadline < now)
+            {
+                deadline = now + updateInterval;
+            }
+
+            std::this_thread::sleep_until(deadline);
         }
 
-        std::cout << "Exiting..." << std::endl;
+        if (!streaming)
+        {
+            std::cout << "Exiting..." << std::endl;
+        }
     }
     catch (const CommandOptionException& e)
     {
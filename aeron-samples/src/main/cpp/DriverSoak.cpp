@@ -0,0 +1,649 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <util/CommandOptionParser.h>
+#include <thread>
+#include <mutex>
+#include <random>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <Aeron.h>
+#include "Configuration.h"
+
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+
+extern "C"
+{
+#include <hdr_histogram.h>
+}
+
+using namespace aeron::util;
+using namespace aeron;
+using namespace std::chrono;
+
+std::atomic<bool> running (true);
+
+void sigIntHandler (int param)
+{
+    running = false;
+}
+
+inline bool isRunning()
+{
+    return std::atomic_load_explicit(&running, std::memory_order_relaxed);
+}
+
+static const char optHelp      = 'h';
+static const char optDriver    = 'd';
+static const char optPrefix    = 'p';
+static const char optChannel   = 'c';
+static const char optStreamId  = 's';
+static const char optStreams   = 'n';
+static const char optHot       = 'H';
+static const char optInterval  = 'i';
+static const char optChurn     = 'C';
+static const char optDuration  = 'D';
+static const char optLength    = 'L';
+static const char optPending   = 'P';
+static const char optTerm      = 'T';
+
+static const std::string DEFAULT_SOAK_CHANNEL = "aeron:udp?endpoint=localhost:40123";
+
+/* driver agent counters written when the driver runs with duty cycle tracking */
+static const std::int32_t DUTY_CYCLE_MAX_TYPE_ID = 14;
+static const std::int32_t DUTY_CYCLE_THRESHOLD_EXCEEDED_TYPE_ID = 15;
+
+static const std::int64_t HIGHEST_TRACKABLE_LATENCY_NS = 60 * 1000 * 1000 * 1000LL;
+
+struct Settings
+{
+    std::string driverPath = "";
+    std::string dirPrefix = "";
+    std::string channel = DEFAULT_SOAK_CHANNEL;
+    std::int32_t streamId = samples::configuration::DEFAULT_STREAM_ID;
+    int numberOfStreams = 1000;
+    int hotPercent = 1;
+    int coldIntervalMs = 1000;
+    int churnPerSec = 0;
+    int durationSec = 0;
+    int messageLength = samples::configuration::DEFAULT_MESSAGE_LENGTH;
+    int maxPendingAdds = 256;
+    /* small terms so tens of thousands of streams fit in memory */
+    std::string termLength = "65536";
+};
+
+Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.driverPath = cp.getOption(optDriver).getParam(0, s.driverPath);
+    s.dirPrefix = cp.getOption(optPrefix).getParam(0, s.dirPrefix);
+    s.channel = cp.getOption(optChannel).getParam(0, s.channel);
+    s.streamId = cp.getOption(optStreamId).getParamAsInt(0, 1, INT32_MAX, s.streamId);
+    s.numberOfStreams = cp.getOption(optStreams).getParamAsInt(0, 1, 1000000, s.numberOfStreams);
+    s.hotPercent = cp.getOption(optHot).getParamAsInt(0, 0, 100, s.hotPercent);
+    s.coldIntervalMs = cp.getOption(optInterval).getParamAsInt(0, 1, INT32_MAX, s.coldIntervalMs);
+    s.churnPerSec = cp.getOption(optChurn).getParamAsInt(0, 0, INT32_MAX, s.churnPerSec);
+    s.durationSec = cp.getOption(optDuration).getParamAsInt(0, 0, INT32_MAX, s.durationSec);
+    s.messageLength = cp.getOption(optLength).getParamAsInt(0, 1, INT32_MAX, s.messageLength);
+    s.maxPendingAdds = cp.getOption(optPending).getParamAsInt(0, 1, 65536, s.maxPendingAdds);
+    s.termLength = cp.getOption(optTerm).getParam(0, s.termLength);
+    return s;
+}
+
+inline std::int64_t nanoClock()
+{
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * A stream of the soak with one publication and one subscription, and so one image once connected. Churn drops both
+ * and adds them again.
+ */
+struct Stream
+{
+    std::int32_t streamId = 0;
+    bool isHot = false;
+    int pendingAdds = 0;
+    std::int64_t nextOfferNs = 0;
+    std::shared_ptr<Publication> publication;
+    std::shared_ptr<Subscription> subscription;
+};
+
+/**
+ * Outcome of an add, handed over from the client conductor thread on which add handlers are called.
+ */
+struct AddCompletion
+{
+    std::size_t streamIndex;
+    std::int64_t latencyNs;
+    std::shared_ptr<Publication> publication;
+    std::shared_ptr<Subscription> subscription;
+    std::exception_ptr exception;
+};
+
+class AddCompletions
+{
+public:
+    void add(const AddCompletion& completion)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completions.push_back(completion);
+    }
+
+    void drain(std::vector<AddCompletion>& into)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        into.swap(m_completions);
+        m_completions.clear();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<AddCompletion> m_completions;
+};
+
+/**
+ * Latency of one kind of driver command, for the latest report interval and for the whole run.
+ */
+class CommandLatency
+{
+public:
+    explicit CommandLatency(const char *name) : m_name(name)
+    {
+        hdr_init(1, HIGHEST_TRACKABLE_LATENCY_NS, 3, &m_interval);
+        hdr_init(1, HIGHEST_TRACKABLE_LATENCY_NS, 3, &m_total);
+    }
+
+    ~CommandLatency()
+    {
+        /* histograms from hdr_init are a single allocation */
+        free(m_interval);
+        free(m_total);
+    }
+
+    CommandLatency(const CommandLatency&) = delete;
+    CommandLatency& operator=(const CommandLatency&) = delete;
+
+    inline void record(std::int64_t latencyNs)
+    {
+        hdr_record_value(m_interval, latencyNs);
+        hdr_record_value(m_total, latencyNs);
+    }
+
+    void printInterval()
+    {
+        print(m_interval);
+        hdr_reset(m_interval);
+    }
+
+    void printTotal()
+    {
+        print(m_total);
+    }
+
+private:
+    void print(const hdr_histogram *histogram) const
+    {
+        std::printf(
+            " | %s n=%" PRId64 " p50=%.1fus p99=%.1fus max=%.1fus",
+            m_name,
+            histogram->total_count,
+            hdr_value_at_percentile(histogram, 50.0) / 1000.0,
+            hdr_value_at_percentile(histogram, 99.0) / 1000.0,
+            hdr_max(histogram) / 1000.0);
+    }
+
+    const char *m_name;
+    hdr_histogram *m_interval = nullptr;
+    hdr_histogram *m_total = nullptr;
+};
+
+/**
+ * The max duty cycle time and threshold exceeded counters of the driver agents, found once at start as the driver
+ * allocates them when it starts.
+ */
+class DutyCycles
+{
+public:
+    explicit DutyCycles(CountersReader& countersReader) : m_countersReader(countersReader)
+    {
+        countersReader.forEach(
+            [&](std::int32_t id, std::int32_t typeId, const AtomicBuffer&, const std::string& label)
+            {
+                if (DUTY_CYCLE_MAX_TYPE_ID == typeId)
+                {
+                    m_agents.push_back({ label.substr(0, label.find(" max duty cycle")), id, -1, 0 });
+                }
+            });
+
+        countersReader.forEach(
+            [&](std::int32_t id, std::int32_t typeId, const AtomicBuffer&, const std::string& label)
+            {
+                if (DUTY_CYCLE_THRESHOLD_EXCEEDED_TYPE_ID == typeId)
+                {
+                    const std::string role = label.substr(0, label.find(" duty cycle"));
+                    for (auto& agent : m_agents)
+                    {
+                        if (agent.role == role)
+                        {
+                            agent.exceededCounterId = id;
+                            agent.lastExceeded = countersReader.getCounterValue(id);
+                        }
+                    }
+                }
+            });
+    }
+
+    bool isEmpty() const
+    {
+        return m_agents.empty();
+    }
+
+    void print()
+    {
+        for (auto& agent : m_agents)
+        {
+            std::printf(
+                " | %s max=%.1fus", agent.role.c_str(), m_countersReader.getCounterValue(agent.maxCounterId) / 1000.0);
+
+            if (agent.exceededCounterId >= 0)
+            {
+                const std::int64_t exceeded = m_countersReader.getCounterValue(agent.exceededCounterId);
+                std::printf(" exceeded=+%" PRId64, exceeded - agent.lastExceeded);
+                agent.lastExceeded = exceeded;
+            }
+        }
+    }
+
+private:
+    struct Agent
+    {
+        std::string role;
+        std::int32_t maxCounterId;
+        std::int32_t exceededCounterId;
+        std::int64_t lastExceeded;
+    };
+
+    CountersReader& m_countersReader;
+    std::vector<Agent> m_agents;
+};
+
+/* resident and peak resident memory in KB from /proc, or -1 when not available */
+static void readMemoryKb(const std::string& statusPath, long& rssKb, long& hwmKb)
+{
+    std::ifstream status(statusPath);
+    std::string line;
+
+    rssKb = -1;
+    hwmKb = -1;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 6, "VmRSS:") == 0)
+        {
+            rssKb = std::strtol(line.c_str() + 6, nullptr, 10);
+        }
+        else if (line.compare(0, 6, "VmHWM:") == 0)
+        {
+            hwmKb = std::strtol(line.c_str() + 6, nullptr, 10);
+        }
+    }
+}
+
+static void printMemory(const char *name, const std::string& statusPath)
+{
+    long rssKb;
+    long hwmKb;
+
+    readMemoryKb(statusPath, rssKb, hwmKb);
+    if (rssKb >= 0)
+    {
+        std::printf(" | %s rss=%.1fMB hwm=%.1fMB", name, rssKb / 1024.0, hwmKb / 1024.0);
+    }
+}
+
+static pid_t launchDriver(const Settings& settings)
+{
+    const pid_t pid = ::fork();
+
+    if (0 == pid)
+    {
+        if (!settings.dirPrefix.empty())
+        {
+            ::setenv("AERON_DIR", settings.dirPrefix.c_str(), 1);
+        }
+        ::setenv("AERON_DUTY_CYCLE_TRACKING", "true", 1);
+        ::setenv("AERON_TERM_BUFFER_LENGTH", settings.termLength.c_str(), 1);
+        ::execl(settings.driverPath.c_str(), settings.driverPath.c_str(), (char *)nullptr);
+
+        std::perror("exec of driver failed");
+        ::_exit(1);
+    }
+    else if (pid < 0)
+    {
+        throw IllegalStateException("could not fork driver: " + settings.driverPath, SOURCEINFO);
+    }
+
+    return pid;
+}
+
+static void stopDriver(pid_t pid)
+{
+    int status = 0;
+
+    ::kill(pid, SIGINT);
+    ::waitpid(pid, &status, 0);
+}
+
+int main(int argc, char **argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption (optHelp,     0, 0, "                Displays help information."));
+    cp.addOption(CommandOption (optDriver,   1, 1, "path            aeronmd to launch, else use a running driver."));
+    cp.addOption(CommandOption (optPrefix,   1, 1, "dir             Prefix directory for aeron driver."));
+    cp.addOption(CommandOption (optChannel,  1, 1, "channel         Channel."));
+    cp.addOption(CommandOption (optStreamId, 1, 1, "streamId        First Stream ID, streams use consecutive ids."));
+    cp.addOption(CommandOption (optStreams,  1, 1, "number          Streams, each a publication and subscription."));
+    cp.addOption(CommandOption (optHot,      1, 1, "percent         Streams offered to each pass, others are cold."));
+    cp.addOption(CommandOption (optInterval, 1, 1, "ms              Interval between messages on a cold stream."));
+    cp.addOption(CommandOption (optChurn,    1, 1, "number          Streams removed and added again per second."));
+    cp.addOption(CommandOption (optDuration, 1, 1, "seconds         Duration of the run, 0 to run until interrupted."));
+    cp.addOption(CommandOption (optLength,   1, 1, "length          Length of Messages."));
+    cp.addOption(CommandOption (optPending,  1, 1, "number          Adds awaiting the driver at once."));
+    cp.addOption(CommandOption (optTerm,     1, 1, "length          Term length of the launched driver, default 64k."));
+
+    signal (SIGINT, sigIntHandler);
+
+    pid_t driverPid = -1;
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+
+        std::cout << "Soaking " << settings.numberOfStreams << " streams of " << settings.channel << ", "
+            << settings.hotPercent << "% hot, cold streams every " << settings.coldIntervalMs << "ms, churning "
+            << settings.churnPerSec << " streams/sec" << std::endl;
+
+        if (!settings.driverPath.empty())
+        {
+            driverPid = launchDriver(settings);
+        }
+
+        aeron::Context context;
+
+        if (settings.dirPrefix != "")
+        {
+            context.aeronDir(settings.dirPrefix);
+        }
+
+        /* outlives the client as add handlers run on its conductor thread */
+        AddCompletions addCompletions;
+        Aeron aeron(context);
+        DutyCycles dutyCycles(aeron.countersReader());
+        CommandLatency addPublicationLatency("add pub");
+        CommandLatency addSubscriptionLatency("add sub");
+        std::vector<AddCompletion> completions;
+
+        if (dutyCycles.isEmpty())
+        {
+            std::cout << "Driver duty cycles not tracked, set AERON_DUTY_CYCLE_TRACKING=true for the driver"
+                << std::endl;
+        }
+
+        std::unique_ptr<std::uint8_t[]> buffer(new std::uint8_t[settings.messageLength]());
+        concurrent::AtomicBuffer srcBuffer(buffer.get(), settings.messageLength);
+        std::vector<Stream> streams(static_cast<std::size_t>(settings.numberOfStreams));
+        std::vector<std::size_t> toAdd;
+        const std::int64_t coldIntervalNs = settings.coldIntervalMs * 1000000LL;
+        const int hotStreams =
+            static_cast<int>((static_cast<long>(settings.numberOfStreams) * settings.hotPercent) / 100);
+        std::mt19937 random(0x5eed);
+        int pendingAdds = 0;
+        long addErrors = 0;
+        long addsCompleted = 0;
+        long messagesSent = 0;
+        long messagesReceived = 0;
+        long backPressured = 0;
+
+        for (int i = 0; i < settings.numberOfStreams; i++)
+        {
+            Stream& stream = streams[i];
+
+            stream.streamId = settings.streamId + i;
+            stream.isHot = i < hotStreams;
+            stream.nextOfferNs = random() % coldIntervalNs;
+            toAdd.push_back(static_cast<std::size_t>(i));
+        }
+
+        fragment_handler_t handler =
+            [&](const AtomicBuffer&, util::index_t, util::index_t, const Header&)
+            {
+                messagesReceived++;
+            };
+
+        const std::int64_t startNs = nanoClock();
+        const std::int64_t endNs = 0 == settings.durationSec ?
+            INT64_MAX : startNs + (settings.durationSec * 1000000000LL);
+        std::int64_t nextReportNs = startNs + 1000000000LL;
+        std::int64_t lastChurnNs = startNs;
+        double churnDue = 0;
+
+        while (isRunning() && nanoClock() < endNs)
+        {
+            addCompletions.drain(completions);
+            for (auto& completion : completions)
+            {
+                Stream& stream = streams[completion.streamIndex];
+
+                stream.pendingAdds--;
+                pendingAdds--;
+                addsCompleted++;
+                if (nullptr != completion.exception)
+                {
+                    if (0 == addErrors++)
+                    {
+                        try
+                        {
+                            std::rethrow_exception(completion.exception);
+                        }
+                        catch (const std::exception& e)
+                        {
+                            std::cout << "First add error: " << e.what() << std::endl;
+                        }
+                    }
+                }
+                else if (nullptr != completion.publication)
+                {
+                    addPublicationLatency.record(completion.latencyNs);
+                    stream.publication = completion.publication;
+                }
+                else
+                {
+                    addSubscriptionLatency.record(completion.latencyNs);
+                    stream.subscription = completion.subscription;
+                }
+            }
+            completions.clear();
+
+            const std::int64_t nowNs = nanoClock();
+
+            if (settings.churnPerSec > 0)
+            {
+                churnDue += (settings.churnPerSec * (nowNs - lastChurnNs)) / 1e9;
+                lastChurnNs = nowNs;
+
+                for (; churnDue >= 1.0; churnDue -= 1.0)
+                {
+                    const std::size_t index = random() % streams.size();
+                    Stream& stream = streams[index];
+
+                    if (0 == stream.pendingAdds && nullptr != stream.publication && nullptr != stream.subscription)
+                    {
+                        stream.publication.reset();
+                        stream.subscription.reset();
+                        toAdd.push_back(index);
+                    }
+                }
+            }
+
+            while (!toAdd.empty() && pendingAdds + 2 <= settings.maxPendingAdds)
+            {
+                const std::size_t index = toAdd.back();
+                Stream& stream = streams[index];
+                const std::int64_t addStartNs = nanoClock();
+
+                toAdd.pop_back();
+                stream.pendingAdds += 2;
+                pendingAdds += 2;
+
+                aeron.addSubscription(
+                    settings.channel,
+                    stream.streamId,
+                    [&addCompletions, index, addStartNs](
+                        std::shared_ptr<Subscription> subscription, std::exception_ptr exception)
+                    {
+                        addCompletions.add({ index, nanoClock() - addStartNs, nullptr, subscription, exception });
+                    });
+
+                aeron.addPublication(
+                    settings.channel,
+                    stream.streamId,
+                    [&addCompletions, index, addStartNs](
+                        std::shared_ptr<Publication> publication, std::exception_ptr exception)
+                    {
+                        addCompletions.add({ index, nanoClock() - addStartNs, publication, nullptr, exception });
+                    });
+            }
+
+            for (auto& stream : streams)
+            {
+                if (nullptr != stream.publication && (stream.isHot || nowNs >= stream.nextOfferNs))
+                {
+                    if (stream.publication->offer(srcBuffer, 0, settings.messageLength) > 0)
+                    {
+                        messagesSent++;
+                        stream.nextOfferNs = nowNs + coldIntervalNs;
+                    }
+                    else
+                    {
+                        backPressured++;
+                    }
+                }
+
+                if (nullptr != stream.subscription)
+                {
+                    stream.subscription->poll(handler, samples::configuration::DEFAULT_FRAGMENT_COUNT_LIMIT);
+                }
+            }
+
+            if (nowNs >= nextReportNs)
+            {
+                long publications = 0;
+                long subscriptions = 0;
+                long images = 0;
+
+                for (auto& stream : streams)
+                {
+                    if (nullptr != stream.publication)
+                    {
+                        publications++;
+                    }
+
+                    if (nullptr != stream.subscription)
+                    {
+                        subscriptions++;
+                        images += stream.subscription->imageCount();
+                    }
+                }
+
+                /* adds waiting a whole interval with none answered points at a driver that has stopped */
+                std::printf(
+                    "%.0fs pubs=%ld subs=%ld images=%ld pending=%d%s errors=%ld sent=%ld received=%ld backpressure=%ld",
+                    (nowNs - startNs) / 1e9, publications, subscriptions, images, pendingAdds,
+                    pendingAdds > 0 && 0 == addsCompleted ? " STALLED" : "", addErrors,
+                    messagesSent, messagesReceived, backPressured);
+                dutyCycles.print();
+                if (driverPid > 0)
+                {
+                    printMemory("driver", "/proc/" + std::to_string(driverPid) + "/status");
+                }
+                printMemory("client", "/proc/self/status");
+                addPublicationLatency.printInterval();
+                addSubscriptionLatency.printInterval();
+                std::printf("\n");
+                std::fflush(stdout);
+
+                addsCompleted = 0;
+                messagesSent = 0;
+                messagesReceived = 0;
+                backPressured = 0;
+                nextReportNs += 1000000000LL;
+            }
+        }
+
+        std::printf("Run of %.0fs", (nanoClock() - startNs) / 1e9);
+        addPublicationLatency.printTotal();
+        addSubscriptionLatency.printTotal();
+        std::printf("\n");
+    }
+    catch (const CommandOptionException& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException& e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        if (driverPid > 0)
+        {
+            stopDriver(driverPid);
+        }
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        if (driverPid > 0)
+        {
+            stopDriver(driverPid);
+        }
+        return -1;
+    }
+
+    if (driverPid > 0)
+    {
+        stopDriver(driverPid);
+    }
+
+    return 0;
+}
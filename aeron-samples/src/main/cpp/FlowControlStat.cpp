@@ -0,0 +1,191 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <util/MemoryMappedFile.h>
+#include <concurrent/reports/FlowControlTraceReader.h>
+#include <util/CommandOptionParser.h>
+
+#include <iostream>
+#include <map>
+#include <tuple>
+#include <Context.h>
+#include <cstdio>
+
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+
+using namespace aeron;
+using namespace aeron::util;
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::reports;
+
+static const char optHelp     = 'h';
+static const char optPath     = 'p';
+static const char optSummary  = 's';
+
+static const std::string FLOW_CONTROL_TRACE_FILE = "flow-control-trace.dat";
+
+struct Settings
+{
+    std::string basePath = Context::defaultAeronPath();
+    bool summaryOnly = false;
+};
+
+Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.basePath = cp.getOption(optPath).getParam(0, s.basePath);
+    s.summaryOnly = cp.getOption(optSummary).isPresent();
+
+    return s;
+}
+
+const char *eventName(std::int32_t eventType)
+{
+    switch (eventType)
+    {
+        case FlowControlTraceDescriptor::EVENT_SND_LMT:
+            return "snd-lmt";
+        case FlowControlTraceDescriptor::EVENT_PUB_LMT:
+            return "pub-lmt";
+        default:
+            return "unknown";
+    }
+}
+
+const char *causeName(std::int32_t cause)
+{
+    switch (cause)
+    {
+        case FlowControlTraceDescriptor::CAUSE_RECEIVER:
+            return "receiver";
+        case FlowControlTraceDescriptor::CAUSE_SENDER:
+            return "sender";
+        case FlowControlTraceDescriptor::CAUSE_SUBSCRIBER:
+            return "subscriber";
+        case FlowControlTraceDescriptor::CAUSE_CLEANING:
+            return "cleaning";
+        default:
+            return "unknown";
+    }
+}
+
+int main (int argc, char** argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption (optHelp,    0, 0, "                Displays help information."));
+    cp.addOption(CommandOption (optPath,    1, 1, "basePath        Base Path to shared memory. Default: " + Context::defaultAeronPath()));
+    cp.addOption(CommandOption (optSummary, 0, 0, "                Display only the count of limit changes by cause."));
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+
+        MemoryMappedFile::ptr_t traceFile =
+            MemoryMappedFile::mapExisting((settings.basePath + "/" + FLOW_CONTROL_TRACE_FILE).c_str());
+
+        AtomicBuffer buffer(traceFile->getMemoryPtr(), static_cast<util::index_t>(traceFile->getMemorySize()));
+
+        // registration id, session id, stream id, event, cause and cause id to the count of changes and last limit
+        std::map<std::tuple<std::int64_t, std::int32_t, std::int32_t, std::int32_t, std::int32_t, std::int64_t>,
+            std::pair<std::int64_t, std::int64_t>> summary;
+
+        if (!settings.summaryOnly)
+        {
+            std::printf(
+                "%-20s %-16s %-11s %-10s %-8s %-11s %-20s %-20s %s\n",
+                "TIMESTAMP_NS", "REGISTRATION_ID", "SESSION_ID", "STREAM_ID", "EVENT", "CAUSE", "CAUSE_ID",
+                "LIMIT", "POSITION");
+        }
+
+        const int records = FlowControlTraceReader::read(
+            buffer,
+            [&](const FlowControlTraceDescriptor::RecordDefn& record)
+            {
+                if (!settings.summaryOnly)
+                {
+                    std::printf(
+                        "%-20" PRId64 " %-16" PRId64 " %-11" PRId32 " %-10" PRId32 " %-8s %-11s %-20" PRId64
+                        " %-20" PRId64 " %" PRId64 "\n",
+                        record.timestampNs,
+                        record.registrationId,
+                        record.sessionId,
+                        record.streamId,
+                        eventName(record.eventType),
+                        causeName(record.cause),
+                        record.causeId,
+                        record.limit,
+                        record.position);
+                }
+
+                auto &entry = summary[std::make_tuple(
+                    record.registrationId,
+                    record.sessionId,
+                    record.streamId,
+                    record.eventType,
+                    record.cause,
+                    record.causeId)];
+                entry.first++;
+                entry.second = record.limit;
+            });
+
+        std::printf(
+            "\n%-16s %-11s %-10s %-8s %-11s %-20s %-10s %s\n",
+            "REGISTRATION_ID", "SESSION_ID", "STREAM_ID", "EVENT", "CAUSE", "CAUSE_ID", "CHANGES", "LAST_LIMIT");
+
+        for (auto &entry : summary)
+        {
+            std::printf(
+                "%-16" PRId64 " %-11" PRId32 " %-10" PRId32 " %-8s %-11s %-20" PRId64 " %-10" PRId64 " %" PRId64 "\n",
+                std::get<0>(entry.first),
+                std::get<1>(entry.first),
+                std::get<2>(entry.first),
+                eventName(std::get<3>(entry.first)),
+                causeName(std::get<4>(entry.first)),
+                std::get<5>(entry.first),
+                entry.second.first,
+                entry.second.second);
+        }
+
+        std::printf("\n%d trace records\n", records);
+    }
+    catch (const CommandOptionException& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException& e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
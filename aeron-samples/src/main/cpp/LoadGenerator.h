@@ -0,0 +1,153 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_LOADGENERATOR_H
+#define AERON_LOADGENERATOR_H
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <util/Exceptions.h>
+#include <util/StringUtil.h>
+
+namespace aeron {
+
+/**
+ * Message lengths drawn from a weighted list given as "length:weight,length:weight" e.g. "64:90,1024:9,8192:1". A
+ * single length without a weight gives every message that length.
+ */
+class MessageLengthDistribution
+{
+public:
+    MessageLengthDistribution(const std::string& spec, std::uint32_t seed = 0x5eed) : m_random(seed)
+    {
+        std::vector<double> weights;
+        std::size_t start = 0;
+
+        while (start < spec.length())
+        {
+            std::size_t end = spec.find(',', start);
+            const std::string entry = spec.substr(start, end == std::string::npos ? std::string::npos : end - start);
+            const std::size_t colon = entry.find(':');
+
+            const int length = parse<int>(entry.substr(0, colon), entry);
+            const double weight = colon == std::string::npos ? 1.0 : parse<double>(entry.substr(colon + 1), entry);
+
+            if (length <= 0 || weight <= 0)
+            {
+                throw util::IllegalArgumentException(
+                    "length and weight must be positive in message length distribution: " + entry, SOURCEINFO);
+            }
+
+            m_lengths.push_back(length);
+            weights.push_back(weight);
+
+            start = end == std::string::npos ? spec.length() : end + 1;
+        }
+
+        if (m_lengths.empty())
+        {
+            throw util::IllegalArgumentException("empty message length distribution", SOURCEINFO);
+        }
+
+        m_distribution = std::discrete_distribution<std::size_t>(weights.begin(), weights.end());
+    }
+
+    inline int next()
+    {
+        return m_lengths[m_distribution(m_random)];
+    }
+
+    int minLength() const
+    {
+        return *std::min_element(m_lengths.begin(), m_lengths.end());
+    }
+
+    int maxLength() const
+    {
+        return *std::max_element(m_lengths.begin(), m_lengths.end());
+    }
+
+private:
+    template<typename T>
+    static T parse(const std::string& value, const std::string& entry)
+    {
+        try
+        {
+            return util::parse<T>(value);
+        }
+        catch (const util::ParseException&)
+        {
+            throw util::IllegalArgumentException("invalid message length distribution entry: " + entry, SOURCEINFO);
+        }
+    }
+
+    std::vector<int> m_lengths;
+    std::mt19937 m_random;
+    std::discrete_distribution<std::size_t> m_distribution;
+};
+
+/**
+ * Send times for an open loop load at a fixed rate. Each send is due one interval after the previous one was due,
+ * not after it happened, so a sender held up by back pressure falls behind and catches up rather than quietly
+ * lowering the rate. Latency measured from the intended time of a send then includes the time it spent waiting to go
+ * out, which is what corrects for coordinated omission.
+ */
+class FixedRateSchedule
+{
+public:
+    FixedRateSchedule(double messagesPerSecond, std::int64_t startNs) :
+        m_intervalNs(1e9 / messagesPerSecond),
+        m_startNs(startNs)
+    {
+    }
+
+    inline std::int64_t intendedNs() const
+    {
+        return m_startNs + static_cast<std::int64_t>(m_sent * m_intervalNs);
+    }
+
+    inline bool isDue(std::int64_t nowNs) const
+    {
+        return nowNs >= intendedNs();
+    }
+
+    inline void onSent()
+    {
+        m_sent++;
+    }
+
+    inline long sent() const
+    {
+        return m_sent;
+    }
+
+    inline std::int64_t intervalNs() const
+    {
+        return static_cast<std::int64_t>(m_intervalNs);
+    }
+
+private:
+    const double m_intervalNs;
+    const std::int64_t m_startNs;
+    long m_sent = 0;
+};
+
+}
+
+#endif //AERON_LOADGENERATOR_H
@@ -0,0 +1,198 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <util/MemoryMappedFile.h>
+#include <concurrent/reports/LossReportReader.h>
+#include <util/CommandOptionParser.h>
+
+#include <iostream>
+#include <map>
+#include <tuple>
+#include <signal.h>
+#include <Context.h>
+#include <cstdio>
+
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <iomanip>
+
+using namespace aeron;
+using namespace aeron::util;
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::reports;
+using namespace std::chrono;
+
+static const char optHelp     = 'h';
+static const char optPath     = 'p';
+static const char optRates    = 'r';
+
+static const std::string LOSS_REPORT_FILE = "loss-report.dat";
+
+struct Settings
+{
+    std::string basePath = Context::defaultAeronPath();
+    bool showRates = false;
+};
+
+Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.basePath = cp.getOption(optPath).getParam(0, s.basePath);
+    s.showRates = cp.getOption(optRates).isPresent();
+
+    return s;
+}
+
+std::string formatDate(std::int64_t millisecondsSinceEpoch)
+{
+    // yyyy-MM-dd HH:mm:ss.SSSZ
+    milliseconds msSinceEpoch(millisecondsSinceEpoch);
+    milliseconds msAfterSec(millisecondsSinceEpoch % 1000);
+    system_clock::time_point tp(msSinceEpoch);
+
+    std::time_t tm = system_clock::to_time_t(tp);
+
+    char timeBuffer[80];
+    char msecBuffer[8];
+    char tzBuffer[8];
+
+    std::strftime(timeBuffer, sizeof(timeBuffer) - 1, "%Y-%m-%d %H:%M:%S.", std::localtime(&tm));
+    std::snprintf(msecBuffer, sizeof(msecBuffer) - 1, "%03" PRId64, msAfterSec.count());
+    std::strftime(tzBuffer, sizeof(tzBuffer) - 1, "%z", std::localtime(&tm));
+
+    return std::string(timeBuffer) + std::string(msecBuffer) + std::string(tzBuffer);
+}
+
+struct RateSample
+{
+    std::int64_t intervalMs;
+    std::int64_t lossObservations;
+    std::int64_t bytesLost;
+    std::int64_t naksSent;
+};
+
+int main (int argc, char** argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption (optHelp,   0, 0, "                Displays help information."));
+    cp.addOption(CommandOption (optPath,   1, 1, "basePath        Base Path to shared memory. Default: " + Context::defaultAeronPath()));
+    cp.addOption(CommandOption (optRates,  0, 0, "                Display the loss rate time series of each image."));
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+
+        MemoryMappedFile::ptr_t lossReportFile =
+            MemoryMappedFile::mapExisting((settings.basePath + "/" + LOSS_REPORT_FILE).c_str());
+
+        AtomicBuffer buffer(lossReportFile->getMemoryPtr(), static_cast<util::index_t>(lossReportFile->getMemorySize()));
+
+        std::printf(
+            "%-20s %-14s %-29s %-29s %-11s %-10s %-40s %s\n",
+            "OBSERVATION_COUNT", "TOTAL_BYTES_LOST", "FIRST_OBSERVATION", "LAST_OBSERVATION",
+            "SESSION_ID", "STREAM_ID", "CHANNEL", "SOURCE");
+
+        const int entries = LossReportReader::read(
+            buffer,
+            [](
+                std::int64_t observationCount,
+                std::int64_t totalBytesLost,
+                std::int64_t firstObservationTimestamp,
+                std::int64_t lastObservationTimestamp,
+                std::int32_t sessionId,
+                std::int32_t streamId,
+                const std::string &channel,
+                const std::string &source)
+                {
+                    std::printf(
+                        "%-20" PRId64 " %-14" PRId64 " %-29s %-29s %-11" PRId32 " %-10" PRId32 " %-40s %s\n",
+                        observationCount,
+                        totalBytesLost,
+                        formatDate(firstObservationTimestamp).c_str(),
+                        formatDate(lastObservationTimestamp).c_str(),
+                        sessionId,
+                        streamId,
+                        channel.c_str(),
+                        source.c_str());
+                });
+
+        std::printf("\n%d loss entries\n", entries);
+
+        if (settings.showRates)
+        {
+            std::map<std::tuple<std::int32_t, std::int32_t, std::int64_t>, RateSample> samples;
+
+            LossReportReader::readRateSamples(
+                buffer,
+                [&](
+                    std::int32_t sessionId,
+                    std::int32_t streamId,
+                    std::int64_t sampleIntervalMs,
+                    std::int64_t timestamp,
+                    std::int64_t lossObservations,
+                    std::int64_t bytesLost,
+                    std::int64_t naksSent)
+                    {
+                        samples[std::make_tuple(sessionId, streamId, timestamp)] =
+                            { sampleIntervalMs, lossObservations, bytesLost, naksSent };
+                    });
+
+            std::printf(
+                "\n%-29s %-11s %-10s %-12s %-17s %-14s %s\n",
+                "INTERVAL_START", "SESSION_ID", "STREAM_ID", "INTERVAL_MS", "LOSS_OBSERVATIONS", "BYTES_LOST",
+                "NAKS_SENT");
+
+            for (auto &entry : samples)
+            {
+                std::printf(
+                    "%-29s %-11" PRId32 " %-10" PRId32 " %-12" PRId64 " %-17" PRId64 " %-14" PRId64 " %" PRId64 "\n",
+                    formatDate(std::get<2>(entry.first)).c_str(),
+                    std::get<0>(entry.first),
+                    std::get<1>(entry.first),
+                    entry.second.intervalMs,
+                    entry.second.lossObservations,
+                    entry.second.bytesLost,
+                    entry.second.naksSent);
+            }
+        }
+    }
+    catch (const CommandOptionException& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException& e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
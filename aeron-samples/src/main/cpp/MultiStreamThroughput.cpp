@@ -0,0 +1,519 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <signal.h>
+#include <util/CommandOptionParser.h>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <sstream>
+#include <Aeron.h>
+#include <concurrent/BusySpinIdleStrategy.h>
+#include "Configuration.h"
+#include "RateReporter.h"
+#include "FragmentAssembler.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+using namespace aeron::util;
+using namespace aeron;
+
+std::atomic<bool> running (true);
+
+void sigIntHandler (int param)
+{
+    running = false;
+}
+
+static const char optHelp        = 'h';
+static const char optPrefix      = 'p';
+static const char optTransport   = 't';
+static const char optChannel     = 'c';
+static const char optStreamId    = 's';
+static const char optStreams     = 'n';
+static const char optSessions    = 'S';
+static const char optPublishers  = 'w';
+static const char optSubscribers = 'r';
+static const char optPubCpus     = 'a';
+static const char optSubCpus     = 'A';
+static const char optMessages    = 'm';
+static const char optLength      = 'L';
+static const char optFrags       = 'f';
+static const char optProgress    = 'P';
+
+static const std::string IPC_CHANNEL = "aeron:ipc";
+static const std::string MULTICAST_CHANNEL = "aeron:udp?endpoint=224.0.1.1:40456|interface=localhost";
+
+static const std::chrono::seconds DRAIN_TIMEOUT(10);
+
+struct Settings
+{
+    std::string dirPrefix = "";
+    std::string channel = samples::configuration::DEFAULT_CHANNEL;
+    std::int32_t streamId = samples::configuration::DEFAULT_STREAM_ID;
+    int numberOfStreams = 1;
+    int sessionsPerStream = 1;
+    int publisherThreads = 1;
+    int subscriberThreads = 1;
+    std::vector<int> publisherCpus;
+    std::vector<int> subscriberCpus;
+    long numberOfMessages = samples::configuration::DEFAULT_NUMBER_OF_MESSAGES;
+    int messageLength = samples::configuration::DEFAULT_MESSAGE_LENGTH;
+    int fragmentCountLimit = samples::configuration::DEFAULT_FRAGMENT_COUNT_LIMIT;
+    bool progress = samples::configuration::DEFAULT_PUBLICATION_RATE_PROGRESS;
+};
+
+std::vector<int> parseCpuList(const std::string& cpuList)
+{
+    std::vector<int> cpus;
+    std::istringstream in(cpuList);
+    std::string cpu;
+
+    while (std::getline(in, cpu, ','))
+    {
+        const int cpuId = fromString<int>(cpu);
+        if (cpuId < 0 || std::to_string(cpuId) != cpu)
+        {
+            throw CommandOptionException("invalid CPU in list: " + cpuList, SOURCEINFO);
+        }
+
+        cpus.push_back(cpuId);
+    }
+
+    return cpus;
+}
+
+Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.dirPrefix = cp.getOption(optPrefix).getParam(0, s.dirPrefix);
+
+    const std::string transport = cp.getOption(optTransport).getParam(0, "udp");
+    if (transport == "ipc")
+    {
+        s.channel = IPC_CHANNEL;
+    }
+    else if (transport == "multicast")
+    {
+        s.channel = MULTICAST_CHANNEL;
+    }
+    else if (transport != "udp")
+    {
+        throw CommandOptionException("unknown transport: " + transport, SOURCEINFO);
+    }
+
+    s.channel = cp.getOption(optChannel).getParam(0, s.channel);
+    s.streamId = cp.getOption(optStreamId).getParamAsInt(0, 1, INT32_MAX, s.streamId);
+    s.numberOfStreams = cp.getOption(optStreams).getParamAsInt(0, 1, 4096, s.numberOfStreams);
+    s.sessionsPerStream = cp.getOption(optSessions).getParamAsInt(0, 1, 4096, s.sessionsPerStream);
+    s.publisherThreads = cp.getOption(optPublishers).getParamAsInt(0, 1, 1024, s.publisherThreads);
+    s.subscriberThreads = cp.getOption(optSubscribers).getParamAsInt(0, 1, 1024, s.subscriberThreads);
+    s.publisherCpus = parseCpuList(cp.getOption(optPubCpus).getParam(0, ""));
+    s.subscriberCpus = parseCpuList(cp.getOption(optSubCpus).getParam(0, ""));
+    s.numberOfMessages = cp.getOption(optMessages).getParamAsLong(0, 0, LONG_MAX, s.numberOfMessages);
+    s.messageLength = cp.getOption(optLength).getParamAsInt(0, sizeof(std::int64_t), INT32_MAX, s.messageLength);
+    s.fragmentCountLimit = cp.getOption(optFrags).getParamAsInt(0, 1, INT32_MAX, s.fragmentCountLimit);
+    s.progress = cp.getOption(optProgress).isPresent();
+    return s;
+}
+
+inline bool isRunning()
+{
+    return std::atomic_load_explicit(&running, std::memory_order_relaxed);
+}
+
+void pinThread(const std::vector<int>& cpus, int threadIndex)
+{
+#if defined(__linux__)
+    if (!cpus.empty())
+    {
+        const int cpu = cpus[threadIndex % cpus.size()];
+        cpu_set_t cpuSet;
+
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) != 0)
+        {
+            std::cerr << "could not pin thread " << threadIndex << " to CPU " << cpu << std::endl;
+        }
+    }
+#endif
+}
+
+/**
+ * Rates of one stream as seen by the subscriber polling it, and the totals since the run started.
+ */
+struct StreamRate
+{
+    double messagesPerSec = 0;
+    double bytesPerSec = 0;
+    long totalMessages = 0;
+    long totalBytes = 0;
+};
+
+/**
+ * Each stream has a single subscription polled by exactly one subscriber thread, so its RateReporter has one writer.
+ * The aggregate is the sum of the per stream reports rather than a shared counter the subscriber threads contend on.
+ */
+class StreamRates
+{
+public:
+    explicit StreamRates(int numberOfStreams) : m_rates(numberOfStreams)
+    {
+        for (int i = 0; i < numberOfStreams; i++)
+        {
+            StreamRate& rate = m_rates[i];
+            m_reporters.emplace_back(new RateReporter(
+                std::chrono::seconds(1),
+                [&rate](double messagesPerSec, double bytesPerSec, long totalMessages, long totalBytes)
+                {
+                    rate.messagesPerSec = messagesPerSec;
+                    rate.bytesPerSec = bytesPerSec;
+                    rate.totalMessages = totalMessages;
+                    rate.totalBytes = totalBytes;
+                }));
+        }
+    }
+
+    inline RateReporter& reporter(int streamIndex)
+    {
+        return *m_reporters[streamIndex];
+    }
+
+    StreamRate report()
+    {
+        StreamRate aggregate;
+
+        for (std::size_t i = 0; i < m_reporters.size(); i++)
+        {
+            m_reporters[i]->report();
+
+            aggregate.messagesPerSec += m_rates[i].messagesPerSec;
+            aggregate.bytesPerSec += m_rates[i].bytesPerSec;
+            aggregate.totalMessages += m_rates[i].totalMessages;
+            aggregate.totalBytes += m_rates[i].totalBytes;
+        }
+
+        return aggregate;
+    }
+
+    inline const StreamRate& rate(int streamIndex) const
+    {
+        return m_rates[streamIndex];
+    }
+
+    inline int numberOfStreams() const
+    {
+        return static_cast<int>(m_rates.size());
+    }
+
+private:
+    std::vector<StreamRate> m_rates;
+    std::vector<std::unique_ptr<RateReporter>> m_reporters;
+};
+
+void printRates(const StreamRates& rates, const StreamRate& aggregate, std::int32_t baseStreamId)
+{
+    std::printf(
+        "aggregate %.02g msgs/sec, %.02g bytes/sec, totals %ld messages %ld MB payloads\n",
+        aggregate.messagesPerSec, aggregate.bytesPerSec, aggregate.totalMessages, aggregate.totalBytes / (1024 * 1024));
+
+    for (int i = 0; i < rates.numberOfStreams(); i++)
+    {
+        const StreamRate& rate = rates.rate(i);
+        std::printf(
+            "  stream %d: %.02g msgs/sec, %.02g bytes/sec, totals %ld messages\n",
+            baseStreamId + i, rate.messagesPerSec, rate.bytesPerSec, rate.totalMessages);
+    }
+}
+
+/**
+ * Offers to each of its publications in turn so a back pressured stream does not hold up the others.
+ */
+void runPublisher(
+    const std::vector<std::shared_ptr<ExclusivePublication>>& publications,
+    const Settings& settings,
+    int threadIndex,
+    std::atomic<long>& backPressureCount)
+{
+    pinThread(settings.publisherCpus, threadIndex);
+
+    std::unique_ptr<std::uint8_t[]> buffer(new std::uint8_t[settings.messageLength]);
+    concurrent::AtomicBuffer srcBuffer(buffer.get(), settings.messageLength);
+    std::vector<long> sent(publications.size(), 0);
+    BusySpinIdleStrategy offerIdleStrategy;
+    std::size_t remaining = publications.size();
+    long backPressured = 0;
+
+    srcBuffer.setMemory(0, settings.messageLength, 0);
+
+    while (remaining > 0 && isRunning())
+    {
+        int sentThisSweep = 0;
+
+        for (std::size_t i = 0; i < publications.size(); i++)
+        {
+            if (sent[i] < settings.numberOfMessages)
+            {
+                srcBuffer.putInt64(0, sent[i]);
+
+                if (publications[i]->offer(srcBuffer, 0, settings.messageLength) > 0)
+                {
+                    sentThisSweep++;
+                    if (++sent[i] == settings.numberOfMessages)
+                    {
+                        remaining--;
+                    }
+                }
+                else
+                {
+                    backPressured++;
+                }
+            }
+        }
+
+        offerIdleStrategy.idle(sentThisSweep);
+    }
+
+    backPressureCount += backPressured;
+}
+
+void runSubscriber(
+    const std::vector<std::shared_ptr<Subscription>>& subscriptions,
+    const std::vector<int>& streamIndexes,
+    StreamRates& rates,
+    const Settings& settings,
+    int threadIndex)
+{
+    pinThread(settings.subscriberCpus, threadIndex);
+
+    std::vector<std::unique_ptr<FragmentAssembler>> assemblers;
+    std::vector<fragment_handler_t> handlers;
+    BusySpinIdleStrategy pollIdleStrategy;
+
+    for (int streamIndex : streamIndexes)
+    {
+        RateReporter& reporter = rates.reporter(streamIndex);
+        assemblers.emplace_back(new FragmentAssembler(
+            [&reporter](AtomicBuffer&, util::index_t, util::index_t length, Header&)
+            {
+                reporter.onMessage(1, length);
+            }));
+        handlers.push_back(assemblers.back()->handler());
+    }
+
+    while (isRunning())
+    {
+        int fragmentsRead = 0;
+
+        for (std::size_t i = 0; i < subscriptions.size(); i++)
+        {
+            fragmentsRead += subscriptions[i]->poll(handlers[i], settings.fragmentCountLimit);
+        }
+
+        pollIdleStrategy.idle(fragmentsRead);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption (optHelp,        0, 0, "                Displays help information."));
+    cp.addOption(CommandOption (optProgress,    0, 0, "                Print aggregate and per stream rates every second."));
+    cp.addOption(CommandOption (optPrefix,      1, 1, "dir             Prefix directory for aeron driver."));
+    cp.addOption(CommandOption (optTransport,   1, 1, "transport       udp, multicast or ipc."));
+    cp.addOption(CommandOption (optChannel,     1, 1, "channel         Channel, overrides the transport default."));
+    cp.addOption(CommandOption (optStreamId,    1, 1, "streamId        First Stream ID, streams use consecutive ids."));
+    cp.addOption(CommandOption (optStreams,     1, 1, "number          Number of streams."));
+    cp.addOption(CommandOption (optSessions,    1, 1, "number          Publications, and so sessions, per stream."));
+    cp.addOption(CommandOption (optPublishers,  1, 1, "number          Publisher threads."));
+    cp.addOption(CommandOption (optSubscribers, 1, 1, "number          Subscriber threads."));
+    cp.addOption(CommandOption (optPubCpus,     1, 1, "cpu,cpu,...     CPUs to pin publisher threads to, round robin."));
+    cp.addOption(CommandOption (optSubCpus,     1, 1, "cpu,cpu,...     CPUs to pin subscriber threads to, round robin."));
+    cp.addOption(CommandOption (optMessages,    1, 1, "number          Number of Messages per publication."));
+    cp.addOption(CommandOption (optLength,      1, 1, "length          Length of Messages."));
+    cp.addOption(CommandOption (optFrags,       1, 1, "limit           Fragment Count Limit."));
+
+    signal (SIGINT, sigIntHandler);
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+        const int numberOfPublications = settings.numberOfStreams * settings.sessionsPerStream;
+
+        std::cout << "Streaming " << toStringWithCommas(settings.numberOfMessages) << " messages of payload length "
+            << settings.messageLength << " bytes from each of " << numberOfPublications << " publications on "
+            << settings.numberOfStreams << " streams of " << settings.channel << std::endl;
+        std::cout << settings.publisherThreads << " publisher threads, "
+            << settings.subscriberThreads << " subscriber threads" << std::endl;
+
+        aeron::Context context;
+
+        if (settings.dirPrefix != "")
+        {
+            context.aeronDir(settings.dirPrefix);
+        }
+
+        Aeron aeron(context);
+
+        std::vector<std::vector<std::shared_ptr<Subscription>>> subscriptionsByThread(settings.subscriberThreads);
+        std::vector<std::vector<int>> streamIndexesByThread(settings.subscriberThreads);
+        std::vector<std::vector<std::shared_ptr<ExclusivePublication>>> publicationsByThread(settings.publisherThreads);
+
+        for (int i = 0; i < settings.numberOfStreams; i++)
+        {
+            const int thread = i % settings.subscriberThreads;
+            subscriptionsByThread[thread].push_back(
+                aeron.asyncAddSubscription(settings.channel, settings.streamId + i).get());
+            streamIndexesByThread[thread].push_back(i);
+        }
+
+        for (int i = 0; i < numberOfPublications; i++)
+        {
+            publicationsByThread[i % settings.publisherThreads].push_back(
+                aeron.asyncAddExclusivePublication(
+                    settings.channel, settings.streamId + (i % settings.numberOfStreams)).get());
+        }
+
+        for (auto& publications : publicationsByThread)
+        {
+            for (auto& publication : publications)
+            {
+                while (!publication->isConnected() && isRunning())
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        StreamRates rates(settings.numberOfStreams);
+        std::atomic<long> backPressureCount(0);
+        std::atomic<int> activePublishers(settings.publisherThreads);
+        std::vector<std::thread> subscriberThreads;
+        std::vector<std::thread> publisherThreads;
+
+        for (int i = 0; i < settings.subscriberThreads; i++)
+        {
+            subscriberThreads.emplace_back(
+                [&, i]()
+                {
+                    runSubscriber(subscriptionsByThread[i], streamIndexesByThread[i], rates, settings, i);
+                });
+        }
+
+        const steady_clock::time_point start = steady_clock::now();
+        rates.report();
+
+        for (int i = 0; i < settings.publisherThreads; i++)
+        {
+            publisherThreads.emplace_back(
+                [&, i]()
+                {
+                    runPublisher(publicationsByThread[i], settings, i, backPressureCount);
+                    activePublishers--;
+                });
+        }
+
+        const long expectedMessages = numberOfPublications * settings.numberOfMessages;
+        steady_clock::time_point drainDeadline = steady_clock::time_point::max();
+        StreamRate aggregate;
+
+        while (isRunning())
+        {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+
+            aggregate = rates.report();
+            if (settings.progress)
+            {
+                printRates(rates, aggregate, settings.streamId);
+            }
+
+            if (aggregate.totalMessages >= expectedMessages || steady_clock::now() > drainDeadline)
+            {
+                break;
+            }
+
+            if (0 == activePublishers && steady_clock::time_point::max() == drainDeadline)
+            {
+                drainDeadline = steady_clock::now() + DRAIN_TIMEOUT;
+            }
+        }
+
+        const double elapsedSec = duration<double>(steady_clock::now() - start).count();
+
+        running = false;
+
+        for (auto& thread : publisherThreads)
+        {
+            thread.join();
+        }
+
+        for (auto& thread : subscriberThreads)
+        {
+            thread.join();
+        }
+
+        aggregate = rates.report();
+
+        std::printf(
+            "Received %ld of %ld messages in %.03f seconds, %.03g msgs/sec, %.03g bytes/sec aggregate\n",
+            aggregate.totalMessages, expectedMessages, elapsedSec,
+            aggregate.totalMessages / elapsedSec, aggregate.totalBytes / elapsedSec);
+
+        for (int i = 0; i < settings.numberOfStreams; i++)
+        {
+            const StreamRate& rate = rates.rate(i);
+            std::printf(
+                "  stream %d: %ld messages, %.03g msgs/sec, %.03g bytes/sec\n",
+                settings.streamId + i, rate.totalMessages,
+                rate.totalMessages / elapsedSec, rate.totalBytes / elapsedSec);
+        }
+
+        std::cout << "Back pressure ratio "
+            << ((double)backPressureCount / std::max(expectedMessages, 1L)) << std::endl;
+    }
+    catch (const CommandOptionException& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException& e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
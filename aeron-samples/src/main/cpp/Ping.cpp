@@ -16,14 +16,18 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <signal.h>
 #include <util/CommandOptionParser.h>
 #include <thread>
 #include <Aeron.h>
 #include <array>
+#include <vector>
+#include <algorithm>
 #include <concurrent/BusySpinIdleStrategy.h>
 #include "FragmentAssembler.h"
 #include "Configuration.h"
+#include "LoadGenerator.h"
 
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
@@ -31,6 +35,7 @@
 extern "C"
 {
 #include <hdr_histogram.h>
+#include <hdr_histogram_log.h>
 }
 
 using namespace std::chrono;
@@ -54,6 +59,16 @@ static const char optFrags          = 'f';
 static const char optMessages       = 'm';
 static const char optLength         = 'L';
 static const char optWarmupMessages = 'w';
+static const char optRate           = 'r';
+static const char optStreams        = 'n';
+static const char optLengths        = 'z';
+static const char optHistogramLog   = 'o';
+static const char optLogInterval    = 'i';
+
+/* an open loop ping carries the time it was due to be sent and the time it was sent */
+static const int OPEN_LOOP_HEADER_LENGTH = 2 * sizeof(std::int64_t);
+static const std::int64_t HIGHEST_TRACKABLE_LATENCY_NS = 60 * 1000 * 1000 * 1000LL;
+static const std::int64_t DRAIN_TIMEOUT_NS = 5 * 1000 * 1000 * 1000LL;
 
 struct Settings
 {
@@ -66,6 +81,11 @@ struct Settings
     int messageLength = samples::configuration::DEFAULT_MESSAGE_LENGTH;
     int fragmentCountLimit = samples::configuration::DEFAULT_FRAGMENT_COUNT_LIMIT;
     long numberOfWarmupMessages = samples::configuration::DEFAULT_NUMBER_OF_MESSAGES;
+    double messagesPerSecond = 0;
+    int numberOfStreams = 1;
+    std::string messageLengths = "";
+    std::string histogramLog = "";
+    long logIntervalMs = 1000;
 };
 
 Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
@@ -88,6 +108,11 @@ Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
     s.messageLength = cp.getOption(optLength).getParamAsInt(0, sizeof(std::int64_t), INT32_MAX, s.messageLength);
     s.fragmentCountLimit = cp.getOption(optFrags).getParamAsInt(0, 1, INT32_MAX, s.fragmentCountLimit);
     s.numberOfWarmupMessages = cp.getOption(optWarmupMessages).getParamAsLong(0, 0, LONG_MAX, s.numberOfWarmupMessages);
+    s.messagesPerSecond = cp.getOption(optRate).getParamAsLong(0, 0, LONG_MAX, 0);
+    s.numberOfStreams = cp.getOption(optStreams).getParamAsInt(0, 1, 1024, s.numberOfStreams);
+    s.messageLengths = cp.getOption(optLengths).getParam(0, s.messageLengths);
+    s.histogramLog = cp.getOption(optHistogramLog).getParam(0, s.histogramLog);
+    s.logIntervalMs = cp.getOption(optLogInterval).getParamAsLong(0, 1, LONG_MAX, s.logIntervalMs);
     return s;
 }
 
@@ -126,6 +151,207 @@ void sendPingAndReceivePong(
     }
 }
 
+inline std::int64_t nanoClock()
+{
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/* interval timestamps in the histogram log are wall clock seconds since the epoch */
+inline void wallClockTime(hdr_timespec* ts)
+{
+    const std::int64_t nowNs = duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count();
+    ts->tv_sec = nowNs / 1000000000;
+    ts->tv_nsec = nowNs % 1000000000;
+}
+
+class OpenLoopRecorder
+{
+public:
+    explicit OpenLoopRecorder(const std::string& histogramLog)
+    {
+        hdr_init(1, HIGHEST_TRACKABLE_LATENCY_NS, 3, &m_corrected);
+        hdr_init(1, HIGHEST_TRACKABLE_LATENCY_NS, 3, &m_uncorrected);
+        hdr_init(1, HIGHEST_TRACKABLE_LATENCY_NS, 3, &m_interval);
+        wallClockTime(&m_intervalStart);
+
+        if (!histogramLog.empty())
+        {
+            if ((m_log = std::fopen(histogramLog.c_str(), "w")) == nullptr)
+            {
+                throw IllegalArgumentException("could not open histogram log: " + histogramLog, SOURCEINFO);
+            }
+
+            hdr_log_writer_init(&m_writer);
+            hdr_log_write_header(&m_writer, m_log, "Ping open loop latency corrected for coordinated omission, ns", &m_intervalStart);
+        }
+    }
+
+    ~OpenLoopRecorder()
+    {
+        if (nullptr != m_log)
+        {
+            std::fclose(m_log);
+        }
+
+        /* histograms from hdr_init are a single allocation */
+        free(m_corrected);
+        free(m_uncorrected);
+        free(m_interval);
+    }
+
+    inline void record(std::int64_t intendedNs, std::int64_t sentNs, std::int64_t receivedNs)
+    {
+        hdr_record_value(m_corrected, receivedNs - intendedNs);
+        hdr_record_value(m_interval, receivedNs - intendedNs);
+        hdr_record_value(m_uncorrected, receivedNs - sentNs);
+        m_received++;
+    }
+
+    void endInterval()
+    {
+        hdr_timespec intervalEnd;
+        wallClockTime(&intervalEnd);
+
+        if (nullptr != m_log)
+        {
+            hdr_log_write(&m_writer, m_log, &m_intervalStart, &intervalEnd, m_interval);
+            std::fflush(m_log);
+        }
+
+        hdr_reset(m_interval);
+        m_intervalStart = intervalEnd;
+    }
+
+    long received() const
+    {
+        return m_received;
+    }
+
+    void print()
+    {
+        std::cout << "Latency from intended send time, corrected for coordinated omission:" << std::endl;
+        hdr_percentiles_print(m_corrected, stdout, 5, 1000.0, CLASSIC);
+        std::cout << "Latency from actual send time, not corrected:" << std::endl;
+        hdr_percentiles_print(m_uncorrected, stdout, 5, 1000.0, CLASSIC);
+        fflush(stdout);
+    }
+
+private:
+    hdr_histogram* m_corrected;
+    hdr_histogram* m_uncorrected;
+    hdr_histogram* m_interval;
+    hdr_timespec m_intervalStart;
+    hdr_log_writer m_writer;
+    FILE* m_log = nullptr;
+    long m_received = 0;
+};
+
+/*
+ * Send pings at a fixed total rate, round robin over the streams, without waiting for the pongs. A ping that cannot
+ * be sent when it is due, e.g. under back pressure, keeps its due time and is sent as soon as it can be, so queueing in
+ * the client, driver or network shows up in the latency instead of lowering the offered load.
+ */
+void sendPingsAtFixedRate(
+    std::vector<std::shared_ptr<Publication>>& publications,
+    std::vector<std::shared_ptr<Subscription>>& subscriptions,
+    const Settings& settings)
+{
+    MessageLengthDistribution lengths(
+        settings.messageLengths.empty() ? std::to_string(settings.messageLength) : settings.messageLengths);
+
+    if (lengths.minLength() < OPEN_LOOP_HEADER_LENGTH)
+    {
+        throw IllegalArgumentException(
+            "open loop messages must be at least " + std::to_string(OPEN_LOOP_HEADER_LENGTH) + " bytes", SOURCEINFO);
+    }
+
+    std::unique_ptr<std::uint8_t[]> buffer(new std::uint8_t[lengths.maxLength()]());
+    concurrent::AtomicBuffer srcBuffer(buffer.get(), lengths.maxLength());
+    OpenLoopRecorder recorder(settings.histogramLog);
+
+    std::vector<std::unique_ptr<FragmentAssembler>> assemblers;
+    std::vector<fragment_handler_t> handlers;
+    for (std::size_t i = 0; i < subscriptions.size(); i++)
+    {
+        assemblers.emplace_back(new FragmentAssembler(
+            [&](AtomicBuffer& buffer, index_t offset, index_t length, Header& header)
+            {
+                recorder.record(buffer.getInt64(offset), buffer.getInt64(offset + sizeof(std::int64_t)), nanoClock());
+            }));
+        handlers.push_back(assemblers.back()->handler());
+    }
+
+    std::cout << "Pinging "
+        << toStringWithCommas(settings.numberOfMessages) << " messages at "
+        << toStringWithCommas(static_cast<long>(settings.messagesPerSecond)) << " msgs/sec over "
+        << settings.numberOfStreams << " streams" << std::endl;
+
+    const std::int64_t logIntervalNs = settings.logIntervalMs * 1000 * 1000;
+    const std::int64_t startNs = nanoClock();
+    FixedRateSchedule schedule(settings.messagesPerSecond, startNs);
+    std::int64_t nextLogNs = startNs + logIntervalNs;
+    std::int64_t drainDeadlineNs = 0;
+    std::int64_t nowNs = startNs;
+    index_t length = lengths.next();
+
+    while (running)
+    {
+        nowNs = nanoClock();
+
+        while (schedule.sent() < settings.numberOfMessages && schedule.isDue(nowNs))
+        {
+            Publication& publication = *publications[schedule.sent() % publications.size()];
+
+            srcBuffer.putInt64(0, schedule.intendedNs());
+            srcBuffer.putInt64(sizeof(std::int64_t), nanoClock());
+            if (publication.offer(srcBuffer, 0, length) < 0)
+            {
+                break;
+            }
+
+            schedule.onSent();
+            length = lengths.next();
+        }
+
+        for (std::size_t i = 0; i < subscriptions.size(); i++)
+        {
+            subscriptions[i]->poll(handlers[i], settings.fragmentCountLimit);
+        }
+
+        if (nowNs >= nextLogNs)
+        {
+            recorder.endInterval();
+            nextLogNs += logIntervalNs;
+        }
+
+        if (schedule.sent() >= settings.numberOfMessages)
+        {
+            if (recorder.received() >= schedule.sent())
+            {
+                break;
+            }
+
+            if (0 == drainDeadlineNs)
+            {
+                drainDeadlineNs = nowNs + DRAIN_TIMEOUT_NS;
+            }
+            else if (nowNs > drainDeadlineNs)
+            {
+                break;
+            }
+        }
+    }
+
+    recorder.endInterval();
+
+    const double seconds = (nowNs - startNs) / 1e9;
+    std::cout << "Sent " << toStringWithCommas(schedule.sent()) << ", received "
+        << toStringWithCommas(recorder.received()) << " in " << seconds << "s, achieved "
+        << toStringWithCommas(static_cast<long>(schedule.sent() / seconds)) << " msgs/sec" << std::endl;
+
+    recorder.print();
+}
+
 int main(int argc, char **argv)
 {
     CommandOptionParser cp;
@@ -139,6 +365,11 @@ int main(int argc, char **argv)
     cp.addOption(CommandOption (optLength,        1, 1, "length          Length of Messages."));
     cp.addOption(CommandOption (optFrags,         1, 1, "limit           Fragment Count Limit."));
     cp.addOption(CommandOption (optWarmupMessages,1, 1, "number          Number of Messages for warmup."));
+    cp.addOption(CommandOption (optRate,          1, 1, "rate            Messages per second to send open loop, 0 to ping one message at a time."));
+    cp.addOption(CommandOption (optStreams,       1, 1, "number          Number of ping/pong stream pairs from the stream IDs, for open loop."));
+    cp.addOption(CommandOption (optLengths,       1, 1, "lengths         Message length distribution length:weight,..., for open loop."));
+    cp.addOption(CommandOption (optHistogramLog,  1, 1, "file            HdrHistogram log file of latencies, for open loop."));
+    cp.addOption(CommandOption (optLogInterval,   1, 1, "ms              Interval of each histogram in the log."));
 
     signal (SIGINT, sigIntHandler);
 
@@ -150,9 +381,10 @@ int main(int argc, char **argv)
         std::cout << "Publishing Ping at " << settings.pingChannel << " on Stream ID " << settings.pingStreamId << std::endl;
 
         aeron::Context context;
-        std::atomic<int> countDown(1);
-        std::int64_t subscriptionId;
-        std::int64_t publicationId;
+        const int numberOfStreams = settings.messagesPerSecond > 0 ? settings.numberOfStreams : 1;
+        std::atomic<int> countDown(numberOfStreams);
+        std::vector<std::int64_t> subscriptionIds;
+        std::vector<std::int64_t> publicationIds;
 
         if (settings.dirPrefix != "")
         {
@@ -177,7 +409,8 @@ int main(int argc, char **argv)
                 std::cout << "Available image correlationId=" << image.correlationId() << " sessionId=" << image.sessionId();
                 std::cout << " at position=" << image.position() << " from " << image.sourceIdentity() << std::endl;
 
-                if (image.subscriptionRegistrationId() == subscriptionId)
+                if (std::find(subscriptionIds.begin(), subscriptionIds.end(), image.subscriptionRegistrationId()) !=
+                    subscriptionIds.end())
                 {
                     countDown--;
                 }
@@ -191,23 +424,38 @@ int main(int argc, char **argv)
 
         Aeron aeron(context);
 
-        subscriptionId = aeron.addSubscription(settings.pongChannel, settings.pongStreamId);
-        publicationId = aeron.addPublication(settings.pingChannel, settings.pingStreamId);
+        std::vector<std::shared_ptr<Subscription>> pongSubscriptions;
+        std::vector<std::shared_ptr<Publication>> pingPublications;
 
-        std::shared_ptr<Subscription> pongSubscription = aeron.findSubscription(subscriptionId);
-        while (!pongSubscription)
+        for (int i = 0; i < numberOfStreams; i++)
         {
-            std::this_thread::yield();
-            pongSubscription = aeron.findSubscription(subscriptionId);
+            subscriptionIds.push_back(aeron.addSubscription(settings.pongChannel, settings.pongStreamId + i));
+            publicationIds.push_back(aeron.addPublication(settings.pingChannel, settings.pingStreamId + i));
         }
 
-        std::shared_ptr<Publication> pingPublication = aeron.findPublication(publicationId);
-        while (!pingPublication)
+        for (int i = 0; i < numberOfStreams; i++)
         {
-            std::this_thread::yield();
-            pingPublication = aeron.findPublication(publicationId);
+            std::shared_ptr<Subscription> pongSubscription = aeron.findSubscription(subscriptionIds[i]);
+            while (!pongSubscription)
+            {
+                std::this_thread::yield();
+                pongSubscription = aeron.findSubscription(subscriptionIds[i]);
+            }
+
+            std::shared_ptr<Publication> pingPublication = aeron.findPublication(publicationIds[i]);
+            while (!pingPublication)
+            {
+                std::this_thread::yield();
+                pingPublication = aeron.findPublication(publicationIds[i]);
+            }
+
+            pongSubscriptions.push_back(pongSubscription);
+            pingPublications.push_back(pingPublication);
         }
 
+        std::shared_ptr<Subscription> pongSubscription = pongSubscriptions[0];
+        std::shared_ptr<Publication> pingPublication = pingPublications[0];
+
         while (countDown > 0)
         {
             std::this_thread::yield();
@@ -232,6 +480,17 @@ int main(int argc, char **argv)
             std::cout << "Warmed up the media driver in " << nanoDuration << " [ns]" << std::endl;
         }
 
+        if (settings.messagesPerSecond > 0)
+        {
+            do
+            {
+                sendPingsAtFixedRate(pingPublications, pongSubscriptions, settings);
+            }
+            while (running && continuationBarrier("Execute again?"));
+
+            return 0;
+        }
+
         hdr_histogram* histogram;
         hdr_init(1, 10 * 1000 * 1000 * 1000LL, 3, &histogram);
 
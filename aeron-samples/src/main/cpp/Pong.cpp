@@ -21,6 +21,7 @@
 #include <thread>
 #include <Aeron.h>
 #include <array>
+#include <vector>
 #include <concurrent/BusySpinIdleStrategy.h>
 #include "FragmentAssembler.h"
 #include "Configuration.h"
@@ -42,6 +43,7 @@ static const char optPongChannel  = 'C';
 static const char optPingStreamId = 's';
 static const char optPongStreamId = 'S';
 static const char optFrags        = 'f';
+static const char optStreams      = 'n';
 
 struct Settings
 {
@@ -51,6 +53,7 @@ struct Settings
     std::int32_t pingStreamId = samples::configuration::DEFAULT_PING_STREAM_ID;
     std::int32_t pongStreamId = samples::configuration::DEFAULT_PONG_STREAM_ID;
     int fragmentCountLimit = samples::configuration::DEFAULT_FRAGMENT_COUNT_LIMIT;
+    int numberOfStreams = 1;
 };
 
 Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
@@ -70,6 +73,7 @@ Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
     s.pingStreamId = cp.getOption(optPingStreamId).getParamAsInt(0, 1, INT32_MAX, s.pingStreamId);
     s.pongStreamId = cp.getOption(optPongStreamId).getParamAsInt(0, 1, INT32_MAX, s.pongStreamId);
     s.fragmentCountLimit = cp.getOption(optFrags).getParamAsInt(0, 1, INT32_MAX, s.fragmentCountLimit);
+    s.numberOfStreams = cp.getOption(optStreams).getParamAsInt(0, 1, 1024, s.numberOfStreams);
     return s;
 }
 
@@ -83,6 +87,7 @@ int main(int argc, char **argv)
     cp.addOption(CommandOption (optPingStreamId, 1, 1, "streamId        Ping Stream ID."));
     cp.addOption(CommandOption (optPongStreamId, 1, 1, "streamId        Pong Stream ID."));
     cp.addOption(CommandOption (optFrags,        1, 1, "limit           Fragment Count Limit."));
+    cp.addOption(CommandOption (optStreams,      1, 1, "number          Number of ping/pong stream pairs from the stream IDs."));
 
     signal (SIGINT, sigIntHandler);
 
@@ -126,47 +131,75 @@ int main(int argc, char **argv)
 
         Aeron aeron(context);
 
-        std::int64_t subscriptionId = aeron.addSubscription(settings.pingChannel, settings.pingStreamId);
-        std::int64_t publicationId = aeron.addPublication(settings.pongChannel, settings.pongStreamId);
+        std::vector<std::int64_t> subscriptionIds;
+        std::vector<std::int64_t> publicationIds;
 
-        std::shared_ptr<Subscription> pingSubscription = aeron.findSubscription(subscriptionId);
-        while (!pingSubscription)
+        for (int i = 0; i < settings.numberOfStreams; i++)
         {
-            std::this_thread::yield();
-            pingSubscription = aeron.findSubscription(subscriptionId);
+            subscriptionIds.push_back(aeron.addSubscription(settings.pingChannel, settings.pingStreamId + i));
+            publicationIds.push_back(aeron.addPublication(settings.pongChannel, settings.pongStreamId + i));
         }
 
-        std::shared_ptr<Publication> pongPublication = aeron.findPublication(publicationId);
-        while (!pongPublication)
+        std::vector<std::shared_ptr<Subscription>> pingSubscriptions;
+        std::vector<std::shared_ptr<Publication>> pongPublications;
+
+        for (int i = 0; i < settings.numberOfStreams; i++)
         {
-            std::this_thread::yield();
-            pongPublication = aeron.findPublication(publicationId);
-        }
+            std::shared_ptr<Subscription> pingSubscription = aeron.findSubscription(subscriptionIds[i]);
+            while (!pingSubscription)
+            {
+                std::this_thread::yield();
+                pingSubscription = aeron.findSubscription(subscriptionIds[i]);
+            }
+
+            std::shared_ptr<Publication> pongPublication = aeron.findPublication(publicationIds[i]);
+            while (!pongPublication)
+            {
+                std::this_thread::yield();
+                pongPublication = aeron.findPublication(publicationIds[i]);
+            }
 
-        Publication &pongPublicationRef = *pongPublication;
-        Subscription &pingSubscriptionRef = *pingSubscription;
+            pingSubscriptions.push_back(pingSubscription);
+            pongPublications.push_back(pongPublication);
+        }
 
         BusySpinIdleStrategy idleStrategy;
         BusySpinIdleStrategy pingHandlerIdleStrategy;
-        FragmentAssembler fragmentAssembler(
-            [&](AtomicBuffer& buffer, index_t offset, index_t length, const Header& header)
-            {
-                if (pongPublicationRef.offer(buffer, offset, length) > 0L)
-                {
-                    return;
-                }
+        std::vector<std::unique_ptr<FragmentAssembler>> fragmentAssemblers;
+        std::vector<fragment_handler_t> handlers;
 
-                while (pongPublicationRef.offer(buffer, offset, length) < 0L)
-                {
-                    pingHandlerIdleStrategy.idle();
-                }
-            });
+        /* each ping stream is echoed on the pong stream of the same index */
+        for (int i = 0; i < settings.numberOfStreams; i++)
+        {
+            Publication &pongPublicationRef = *pongPublications[i];
 
-        fragment_handler_t handler = fragmentAssembler.handler();
+            fragmentAssemblers.emplace_back(new FragmentAssembler(
+                [&pongPublicationRef, &pingHandlerIdleStrategy](
+                    AtomicBuffer& buffer, index_t offset, index_t length, const Header& header)
+                {
+                    if (pongPublicationRef.offer(buffer, offset, length) > 0L)
+                    {
+                        return;
+                    }
+
+                    while (pongPublicationRef.offer(buffer, offset, length) < 0L)
+                    {
+                        pingHandlerIdleStrategy.idle();
+                    }
+                }));
+            handlers.push_back(fragmentAssemblers.back()->handler());
+        }
 
         while (running)
         {
-            idleStrategy.idle(pingSubscriptionRef.poll(handler, settings.fragmentCountLimit));
+            int fragmentsRead = 0;
+
+            for (int i = 0; i < settings.numberOfStreams; i++)
+            {
+                fragmentsRead += pingSubscriptions[i]->poll(handlers[i], settings.fragmentCountLimit);
+            }
+
+            idleStrategy.idle(fragmentsRead);
         }
 
         std::cout << "Shutting down...\n";
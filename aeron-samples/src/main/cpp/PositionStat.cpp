@@ -0,0 +1,126 @@
+/*
+ * Copyright 2014-2018 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <util/MemoryMappedFile.h>
+#include <concurrent/reports/PositionSnapshotReader.h>
+#include <util/CommandOptionParser.h>
+
+#include <iostream>
+#include <Context.h>
+#include <cstdio>
+
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+
+using namespace aeron;
+using namespace aeron::util;
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::reports;
+
+static const char optHelp     = 'h';
+static const char optPath     = 'p';
+
+static const std::string POSITION_SNAPSHOT_FILE = "position-snapshot.dat";
+
+struct Settings
+{
+    std::string basePath = Context::defaultAeronPath();
+};
+
+Settings parseCmdLine(CommandOptionParser& cp, int argc, char** argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.basePath = cp.getOption(optPath).getParam(0, s.basePath);
+
+    return s;
+}
+
+int main (int argc, char** argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption (optHelp,    0, 0, "                Displays help information."));
+    cp.addOption(CommandOption (optPath,    1, 1, "basePath        Base Path to shared memory. Default: " + Context::defaultAeronPath()));
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+
+        MemoryMappedFile::ptr_t snapshotFile =
+            MemoryMappedFile::mapExisting((settings.basePath + "/" + POSITION_SNAPSHOT_FILE).c_str());
+
+        AtomicBuffer buffer(snapshotFile->getMemoryPtr(), static_cast<util::index_t>(snapshotFile->getMemorySize()));
+        PositionSnapshotReader::Section section;
+
+        std::printf(
+            "%-8s %-20s %-16s %-11s %-10s %-20s %-20s %-20s %-12s %s\n",
+            "AGENT", "TIMESTAMP_NS", "REGISTRATION_ID", "SESSION_ID", "STREAM_ID", "POSITION", "HIGH_WATER_MARK",
+            "LIMIT", "LAG", "WINDOW");
+
+        for (std::int32_t i = 0, count = PositionSnapshotReader::sectionCount(buffer); i < count; i++)
+        {
+            if (!PositionSnapshotReader::read(buffer, i, section))
+            {
+                std::printf("section %d changed on every read\n", i);
+                continue;
+            }
+
+            const char *agent = PositionSnapshotDescriptor::KIND_SENDER == section.kind ? "sender" : "receiver";
+
+            for (const PositionSnapshotReader::Entry& entry : section.entries)
+            {
+                std::printf(
+                    "%-8s %-20" PRId64 " %-16" PRId64 " %-11" PRId32 " %-10" PRId32 " %-20" PRId64 " %-20" PRId64
+                    " %-20" PRId64 " %-12" PRId64 " %" PRId64 "\n",
+                    agent,
+                    section.timestampNs,
+                    entry.registrationId,
+                    entry.sessionId,
+                    entry.streamId,
+                    entry.position,
+                    entry.highWaterMark,
+                    entry.limit,
+                    entry.highWaterMark - entry.position,
+                    entry.limit - entry.position);
+            }
+        }
+    }
+    catch (const CommandOptionException& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException& e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}